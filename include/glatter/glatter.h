@@ -60,11 +60,7 @@ enum {
     GLATTER_WSI_EGL  = GLATTER_WSI_EGL_VALUE
 };
 
-
-
-#define GLATTER_str(s) #s
-#define GLATTER_xstr(s) GLATTER_str(s)
-#define GLATTER_PDIR(pd) platforms/pd
+#include "glatter_types.h"
 
 
 
@@ -101,6 +97,17 @@ enum {
         #define GLATTER_UBLOCK(...)
     #endif
 
+#elif defined(GLATTER_IFUNC) || defined(GLATTER_TRAMPOLINES)
+
+/* Compiled with GLATTER_IFUNC or GLATTER_TRAMPOLINES: the entry points are
+ * functions that end up in the driver entry (see glatter_def.h). */
+#define GLATTER_UBLOCK(rtype, cconv, name, dargs)\
+    typedef rtype (cconv *glatter_##name##_t) dargs;\
+    typedef rtype (cconv glatter_##name##_fn) dargs;\
+    extern glatter_##name##_fn glatter_##name;
+
+void glatter_set_log_handler(void(*handler_ptr)(const char*));
+
 #else
 
 #define GLATTER_UBLOCK(rtype, cconv, name, dargs)\
@@ -119,26 +126,55 @@ void glatter_set_log_handler(void(*handler_ptr)(const char*));
 GLATTER_INLINE_OR_NOT void  glatter_set_wsi(int wsi);
 GLATTER_INLINE_OR_NOT int   glatter_get_wsi(void);
 GLATTER_INLINE_OR_NOT void* glatter_get_proc_address(const char* function_name);
+GLATTER_INLINE_OR_NOT void  glatter_reset_missing_entry_points(void);
+/* Forgets only the misses of the current context's GL entry points, which
+ * are its own with GLATTER_CONTEXT_DISPATCH. Without it, entry points and
+ * their misses are shared by all contexts, and every miss is forgotten. */
+GLATTER_INLINE_OR_NOT void  glatter_reset_missing_entry_points_for_current_context(void);
+GLATTER_INLINE_OR_NOT int   glatter_set_proc_address_provider(glatter_proc_address_provider_fn provider, void* user_data);
+GLATTER_INLINE_OR_NOT int   glatter_set_library_path(int library, const char* path);
+GLATTER_INLINE_OR_NOT int   glatter_set_dlopen_policy(int policy);
+GLATTER_INLINE_OR_NOT void  glatter_get_configuration_stats(glatter_configuration_stats_t* stats);
+
+/* Completion handle of glatter_warmup_async(). */
+typedef struct glatter_warmup glatter_warmup_t;
+
+GLATTER_INLINE_OR_NOT glatter_warmup_t* glatter_warmup_async(void);
+GLATTER_INLINE_OR_NOT int  glatter_warmup_poll(glatter_warmup_t* warmup);
+GLATTER_INLINE_OR_NOT void glatter_warmup_wait(glatter_warmup_t* warmup);
 GLATTER_INLINE_OR_NOT void  glatter_bind_owner_to_current_thread(void);
 
 
+/* The sets returned by glatter_get_extension_support_<F>() and
+ * glatter_get_context_caps() are never freed, so the pointers stay valid for
+ * the process, from any thread. A set describes its context as it was when
+ * the set was built; after the context is destroyed or the cache invalidated,
+ * call again for a current one. The glatter_<extension> flags call
+ * glatter_extension_supported_<F>(). */
 #if defined(GLATTER_GL)
-    GLATTER_INLINE_OR_NOT glatter_extension_support_status_GL_t  glatter_get_extension_support_GL();
+    GLATTER_INLINE_OR_NOT const glatter_extension_support_status_GL_t* glatter_get_extension_support_GL(void);
+    GLATTER_INLINE_OR_NOT int glatter_extension_supported_GL(int index);
+    GLATTER_INLINE_OR_NOT const glatter_context_caps_t* glatter_get_context_caps(void);
     GLATTER_INLINE_OR_NOT const char* enum_to_string_GL(GLATTER_ENUM_GL e);
 #endif
 
 #if defined(GLATTER_GLX)
-    GLATTER_INLINE_OR_NOT glatter_extension_support_status_GLX_t glatter_get_extension_support_GLX();
+    GLATTER_INLINE_OR_NOT const glatter_extension_support_status_GLX_t* glatter_get_extension_support_GLX(void);
+    GLATTER_INLINE_OR_NOT int glatter_extension_supported_GLX(int index);
     GLATTER_INLINE_OR_NOT const char* enum_to_string_GLX(GLATTER_ENUM_GLX e);
 #endif
 
 #if defined(GLATTER_EGL)
-    GLATTER_INLINE_OR_NOT glatter_extension_support_status_EGL_t glatter_get_extension_support_EGL();
+    GLATTER_INLINE_OR_NOT const glatter_extension_support_status_EGL_t* glatter_get_extension_support_EGL(void);
+#if GLATTER_HAS_EGL_GENERATED_HEADERS
+    GLATTER_INLINE_OR_NOT int glatter_extension_supported_EGL(int index);
+#endif
     GLATTER_INLINE_OR_NOT const char* enum_to_string_EGL(GLATTER_ENUM_EGL e);
 #endif
 
 #if defined(GLATTER_WGL)
-    GLATTER_INLINE_OR_NOT glatter_extension_support_status_WGL_t glatter_get_extension_support_WGL();
+    GLATTER_INLINE_OR_NOT const glatter_extension_support_status_WGL_t* glatter_get_extension_support_WGL(void);
+    GLATTER_INLINE_OR_NOT int glatter_extension_supported_WGL(int index);
     GLATTER_INLINE_OR_NOT const char* enum_to_string_WGL(GLATTER_ENUM_WGL e);
 #endif
     
@@ -146,6 +182,141 @@ GLATTER_INLINE_OR_NOT void  glatter_bind_owner_to_current_thread(void);
     GLATTER_INLINE_OR_NOT const char* enum_to_string_GLU(GLATTER_ENUM_GLU e);
 #endif
 
+/* Which entry points of the family the loader resolves for the current
+ * context, without calling them: nothing is logged and a missing one never
+ * aborts. The set is built in one pass and cached per context. 'fn' is a
+ * GLATTER_FN_<name> of the family; 'bitmap' has GLATTER_FN_BITMAP_WORDS(family)
+ * words. Without a current context nothing is reported available.
+ * Like any lookup, the first query latches the WSI.
+ * glXGetProcAddress resolves any name, so with GLX a GL entry point is only
+ * reported if the context's version, or the extension it is listed under,
+ * also introduces it. That check is skipped if the version cannot be read.
+ * It does not cover entry points that a core profile removes, and those of an
+ * ARB extension promoted to the core are listed under the core version only,
+ * so they are not reported on an older context that has the extension. */
+#if defined(GLATTER_GL)
+    GLATTER_INLINE_OR_NOT int  glatter_function_available_GL(int fn);
+    GLATTER_INLINE_OR_NOT void glatter_query_available_functions_GL(uint32_t* bitmap);
+#endif
+#if defined(GLATTER_GLX)
+    GLATTER_INLINE_OR_NOT int  glatter_function_available_GLX(int fn);
+    GLATTER_INLINE_OR_NOT void glatter_query_available_functions_GLX(uint32_t* bitmap);
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    GLATTER_INLINE_OR_NOT int  glatter_function_available_EGL(int fn);
+    GLATTER_INLINE_OR_NOT void glatter_query_available_functions_EGL(uint32_t* bitmap);
+#endif
+#if defined(GLATTER_WGL)
+    GLATTER_INLINE_OR_NOT int  glatter_function_available_WGL(int fn);
+    GLATTER_INLINE_OR_NOT void glatter_query_available_functions_WGL(uint32_t* bitmap);
+#endif
+
+/* Call hooks: 'pre' and 'post' (either may be NULL) run around the calls made
+ * through glatter, on the calling thread; two NULLs remove them. Calls a hook
+ * makes itself are not hooked. While none are installed, a call costs at most
+ * one branch on a global flag. Returns 0 with GLATTER_IFUNC, whose calls do
+ * not pass through glatter once bound. 'mask' has
+ * GLATTER_FN_BITMAP_WORDS(family) words and selects the hooked entry points of
+ * the family; NULL, the default, hooks all of them. */
+GLATTER_INLINE_OR_NOT int glatter_set_call_hooks(glatter_call_hook_fn pre, glatter_call_hook_fn post, void* user_data);
+#if defined(GLATTER_GL)
+    GLATTER_INLINE_OR_NOT void glatter_set_call_hook_mask_GL(const uint32_t* mask);
+#endif
+#if defined(GLATTER_GLX)
+    GLATTER_INLINE_OR_NOT void glatter_set_call_hook_mask_GLX(const uint32_t* mask);
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    GLATTER_INLINE_OR_NOT void glatter_set_call_hook_mask_EGL(const uint32_t* mask);
+#endif
+#if defined(GLATTER_WGL)
+    GLATTER_INLINE_OR_NOT void glatter_set_call_hook_mask_WGL(const uint32_t* mask);
+#endif
+#if defined(GLATTER_GLU)
+    GLATTER_INLINE_OR_NOT void glatter_set_call_hook_mask_GLU(const uint32_t* mask);
+#endif
+
+#if defined(GLATTER_EAGER)
+/* Resolve every entry point of the family in one pass. Call once a context is
+ * current and before any other thread calls into the family. Returns nonzero
+ * if at least one entry point was resolved; 'report' may be NULL. */
+#if defined(GLATTER_GL)
+    GLATTER_INLINE_OR_NOT int glatter_init_GL(glatter_init_report_t* report);
+#endif
+#if defined(GLATTER_GLX)
+    GLATTER_INLINE_OR_NOT int glatter_init_GLX(glatter_init_report_t* report);
+#endif
+#if defined(GLATTER_EGL)
+    GLATTER_INLINE_OR_NOT int glatter_init_EGL(glatter_init_report_t* report);
+#endif
+#if defined(GLATTER_WGL)
+    GLATTER_INLINE_OR_NOT int glatter_init_WGL(glatter_init_report_t* report);
+#endif
+#if defined(GLATTER_GLU)
+    GLATTER_INLINE_OR_NOT int glatter_init_GLU(glatter_init_report_t* report);
+#endif
+#endif
+
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL)
+/* GL entry points are bound per context. The make-current calls below also
+ * switch the calling thread's dispatch table;
+ * glatter_bind_dispatch_to_current_context() does the same after a switch
+ * made elsewhere. */
+    GLATTER_INLINE_OR_NOT void glatter_bind_dispatch_to_current_context(void);
+    #if !defined(_WIN32)
+    /* Same, for a context made current with 'wsi' (GLATTER_WSI_GLX or
+     * GLATTER_WSI_EGL), which is then also the WSI GL entry points of that
+     * context resolve through; GLATTER_WSI_AUTO follows the process WSI. */
+    GLATTER_INLINE_OR_NOT void glatter_bind_dispatch_to_wsi(int wsi);
+    #endif
+#endif
+
+/* Make-current and destroy calls are routed through glatter, so that the
+ * cached extension and availability sets of a destroyed context are dropped
+ * before a new context can reuse its address. With GLATTER_LOG_CALLS or
+ * GLATTER_LOG_ERRORS the wrappers make the call through its logging variant,
+ * and take the call site for it. */
+#if defined(GLATTER_GLX)
+    GLATTER_INLINE_OR_NOT Bool glatter_glXMakeCurrent_switch(Display* dpy, GLXDrawable drawable, GLXContext ctx GLATTER_CALL_SITE_PARAMS);
+    GLATTER_INLINE_OR_NOT Bool glatter_glXMakeContextCurrent_switch(Display* dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx GLATTER_CALL_SITE_PARAMS);
+    GLATTER_INLINE_OR_NOT void glatter_glXDestroyContext_evict(Display* dpy, GLXContext ctx GLATTER_CALL_SITE_PARAMS);
+    #ifndef glXMakeCurrent
+    #define glXMakeCurrent(dpy, drawable, ctx) glatter_glXMakeCurrent_switch((dpy), (drawable), (ctx) GLATTER_CALL_SITE)
+    #endif
+    #ifndef glXMakeContextCurrent
+    #define glXMakeContextCurrent(dpy, draw, read, ctx) glatter_glXMakeContextCurrent_switch((dpy), (draw), (read), (ctx) GLATTER_CALL_SITE)
+    #endif
+    #ifndef glXDestroyContext
+    #define glXDestroyContext(dpy, ctx) glatter_glXDestroyContext_evict((dpy), (ctx) GLATTER_CALL_SITE)
+    #endif
+#endif
+
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    GLATTER_INLINE_OR_NOT EGLBoolean glatter_eglMakeCurrent_switch(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx GLATTER_CALL_SITE_PARAMS);
+    GLATTER_INLINE_OR_NOT EGLBoolean glatter_eglDestroyContext_evict(EGLDisplay dpy, EGLContext ctx GLATTER_CALL_SITE_PARAMS);
+    #ifndef eglMakeCurrent
+    #define eglMakeCurrent(dpy, draw, read, ctx) glatter_eglMakeCurrent_switch((dpy), (draw), (read), (ctx) GLATTER_CALL_SITE)
+    #endif
+    #ifndef eglDestroyContext
+    #define eglDestroyContext(dpy, ctx) glatter_eglDestroyContext_evict((dpy), (ctx) GLATTER_CALL_SITE)
+    #endif
+#endif
+
+#if defined(GLATTER_WGL)
+    GLATTER_INLINE_OR_NOT BOOL glatter_wglMakeCurrent_switch(HDC hdc, HGLRC hglrc GLATTER_CALL_SITE_PARAMS);
+    GLATTER_INLINE_OR_NOT BOOL glatter_wglDeleteContext_evict(HGLRC hglrc GLATTER_CALL_SITE_PARAMS);
+    #ifndef wglMakeCurrent
+    #define wglMakeCurrent(hdc, hglrc) glatter_wglMakeCurrent_switch((hdc), (hglrc) GLATTER_CALL_SITE)
+    #endif
+    #ifndef wglDeleteContext
+    #define wglDeleteContext(hglrc) glatter_wglDeleteContext_evict((hglrc) GLATTER_CALL_SITE)
+    #endif
+    #if defined(__wgl_wglext_h_) && defined(WGL_ARB_make_current_read)
+    GLATTER_INLINE_OR_NOT BOOL glatter_wglMakeContextCurrentARB_switch(HDC hDrawDC, HDC hReadDC, HGLRC hglrc GLATTER_CALL_SITE_PARAMS);
+    #ifndef wglMakeContextCurrentARB
+    #define wglMakeContextCurrentARB(hDrawDC, hReadDC, hglrc) glatter_wglMakeContextCurrentARB_switch((hDrawDC), (hReadDC), (hglrc) GLATTER_CALL_SITE)
+    #endif
+    #endif
+#endif
 
 #if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
 
@@ -170,33 +170,33 @@ printable_c_types =  {
     'unsigned long long int': '%llu',
     'float': '%f',
     'double': '%f',
-    'int8_t': '"%" PRId8',
-    'int16_t': '"%" PRId16',
-    'int32_t': '"%" PRId32',
-    'int64_t': '"%" PRId64',
-    'int_fast8_t': '"%" PRIdFAST8',
-    'int_fast16_t': '"%" PRIdFAST16',
-    'int_fast32_t': '"%" PRIdFAST32',
-    'int_fast64_t': '"%" PRIdFAST64',
-    'int_least8_t': '"%" PRIdLEAST8',
-    'int_least16_t': '"%" PRIdLEAST16',
-    'int_least32_t': '"%" PRIdLEAST32',
-    'int_least64_t': '"%" PRIdLEAST64',
-    'uint8_t': '"%" PRIu8',
-    'uint16_t': '"%" PRIu16',
-    'uint32_t': '"%" PRIu32',
-    'uint64_t': '"%" PRIu64',
-    'uint_fast8_t': '"%" PRIuFAST8',
-    'uint_fast16_t': '"%" PRIuFAST16',
-    'uint_fast32_t': '"%" PRIuFAST32',
-    'uint_fast64_t': '"%" PRIuFAST64',
-    'uint_least8_t': '"%" PRIuLEAST8',
-    'uint_least16_t': '"%" PRIuLEAST16',
-    'uint_least32_t': '"%" PRIuLEAST32',
-    'uint_least64_t': '"%" PRIuLEAST64',
-    'intptr_t': '"%" PRIxPTR',
-    'uintptr_t': '"%" PRIxPTR',
-    'size_t': '"%" GLATTER_FMT_ZU',
+    'int8_t': '%" PRId8 "',
+    'int16_t': '%" PRId16 "',
+    'int32_t': '%" PRId32 "',
+    'int64_t': '%" PRId64 "',
+    'int_fast8_t': '%" PRIdFAST8 "',
+    'int_fast16_t': '%" PRIdFAST16 "',
+    'int_fast32_t': '%" PRIdFAST32 "',
+    'int_fast64_t': '%" PRIdFAST64 "',
+    'int_least8_t': '%" PRIdLEAST8 "',
+    'int_least16_t': '%" PRIdLEAST16 "',
+    'int_least32_t': '%" PRIdLEAST32 "',
+    'int_least64_t': '%" PRIdLEAST64 "',
+    'uint8_t': '%" PRIu8 "',
+    'uint16_t': '%" PRIu16 "',
+    'uint32_t': '%" PRIu32 "',
+    'uint64_t': '%" PRIu64 "',
+    'uint_fast8_t': '%" PRIuFAST8 "',
+    'uint_fast16_t': '%" PRIuFAST16 "',
+    'uint_fast32_t': '%" PRIuFAST32 "',
+    'uint_fast64_t': '%" PRIuFAST64 "',
+    'uint_least8_t': '%" PRIuLEAST8 "',
+    'uint_least16_t': '%" PRIuLEAST16 "',
+    'uint_least32_t': '%" PRIuLEAST32 "',
+    'uint_least64_t': '%" PRIuLEAST64 "',
+    'intptr_t': '%" PRIxPTR "',
+    'uintptr_t': '%" PRIxPTR "',
+    'size_t': '%" GLATTER_FMT_ZU "',
     'wchar_t': '%lc',
     'ptrdiff_t': '%td'
 }
@@ -224,8 +224,6 @@ function_fine_pattern = re.compile(r'^((?P<expkw>extern|([A-Z0-9_]*API(CALL)?)?)
 function_group_pattern = re.compile(r'\w*[a-z]+(?P<group>[A-Z0-9]{2,10})$')
 typedef_pattern = re.compile(r'^typedef(?P<type>.+?)(?P<name>' + fm_sbp + r'\w+);$');
 
-hash_table_size = 0x4000
-
 
 class DataHolder(object):
     def __init__(self, value=None): self.value = value
@@ -350,12 +348,6 @@ def validate_extension_group(ext_group_str):
 def validate_enum(enum_str):
     return enum_str if not bool(re.match(validenum_pattern, enum_str)) else ''
 
-def hash_djb2(s):                                                                                                                                
-    hash = 5381
-    for x in s:
-        hash = (( hash << 5) + hash) + ord(x)
-    return hash & 0xFFFFFFFF
-
 def analyze_condition(ppline, former_condition = None):
     #if
     m = re.match('^# ?if (?P<condition>.+)', ppline)
@@ -516,13 +508,7 @@ def parse(filename):
             if mg_as == '1':
                 m = re.match(r'^(?P<family>[A-Z]+)_(?P<group>[A-Z0-9]+)_\w+$', mg_what)
                 if bool(m) and (m.group('family') in families) and (m.group('group') in all_extgroups) and bool(re.match('^# ?ifndef '+mg_what+'$', c3[i-1])):
-                    h = hash_djb2(mg_what)
-                    h_short = h & (hash_table_size-1)
-                    family = m.group('family')
-                    ext_name_to_hash[family][mg_what] = h_short
-                    if (h_short not in ext_hash_to_full_hash[family]):
-                        ext_hash_to_full_hash[family][h_short] = {}
-                    ext_hash_to_full_hash[family][h_short][h] = 0
+                    ext_names_found[m.group('family')].add(mg_what)
 
     #===========#
     #   ENUMS   #
@@ -729,13 +715,38 @@ def write_to_file(filename_with_path, content):
 # HEADER GENERATION                              #
 #================================================#
 
+# Resolver entry points are not wrapped, to avoid macro recursion and
+# standards-incompatible signatures (e.g., unnamed params in headers).
+resolver_denylist = {
+    'glXGetProcAddressARB',
+    'glXGetProcAddress',
+    'eglGetProcAddress',
+    'wglGetProcAddress',
+}
+
+
+# The feature that introduces the GL entry points of a block: the innermost
+# version or extension guard. It is marked in the entry point list for the
+# availability probe, which checks it against the context (see "Entry point
+# availability" in glatter_def.h).
+def get_block_feature(block):
+    for condition in reversed(block):
+        m = re.match(r'defined\(GL_(?:ES_)?VERSION_(?:ES_C[ML]_)?(\d+)_(\d+)\)$', condition)
+        if m:
+            return 'GLATTER_IVERSION(' + m.group(1) + ', ' + m.group(2) + ')'
+        m = re.match(r'defined\((GL_[A-Z0-9]+_\w+)\)$', condition)
+        if m:
+            return 'GLATTER_IEXTENSION(' + m.group(1) + ')'
+    return 'GLATTER_IVERSION(0, 0)'
+
+
 def get_function_mdnd(family): #macros, declarations and definitions
     #file buffers
     notes = ''
-    header_d = header_r = source_d = source_r = ''
+    header_d = header_r = source_d = source_r = source_i = ''
 
     if (len(function_definitions[family]) == 0):
-        return ['', '', '', '', '']
+        return ['', '', '', '', '', '']
 
     sfd0 = sorted(function_definitions[family], key=lambda x: tuple(x.block) + tuple([x.name]) )
 
@@ -773,14 +784,6 @@ def get_function_mdnd(family): #macros, declarations and definitions
 // header guard ''' + v.block[0][8:-1] + ''' was found to be potentially conflicting,
 // thus was omitted.'''
         else:
-            # Skip wrapping resolver entry points to avoid macro recursion and
-            # standards-incompatible signatures (e.g., unnamed params in headers).
-            resolver_denylist = {
-                'glXGetProcAddressARB',
-                'glXGetProcAddress',
-                'eglGetProcAddress',
-                'wglGetProcAddress',
-            }
             if v.name in resolver_denylist:
                 continue
             sfd.append(v)
@@ -792,8 +795,10 @@ def get_function_mdnd(family): #macros, declarations and definitions
 #ifdef GLATTER_''' + family + '''
 #if ''' + '\n#if '.join(sfd[0].block)
 
-    header_d, header_r, source_d, source_r = tmp, tmp, tmp, tmp
+    header_d, header_r, source_d, source_r, source_i = tmp, tmp, tmp, tmp, tmp
     tmp = ''
+    if family == 'GL':
+        source_i += '\n' + get_block_feature(current_block)
 
     for x in sfd:
         #test_block = '\n#if '.join(x.block)
@@ -823,7 +828,10 @@ def get_function_mdnd(family): #macros, declarations and definitions
             header_r += tmp
             source_d += tmp
             source_r += tmp
+            source_i += tmp
             tmp = ''
+            if family == 'GL':
+                source_i += '\n' + get_block_feature(current_block)
 
         #function block buffers
         dn_mac = '' #debug name macro
@@ -922,6 +930,7 @@ def get_function_mdnd(family): #macros, declarations and definitions
         header_r += rn_mac + ublock
         source_d += fb_d
         source_r += fb_r
+        source_i += '\nGLATTER_IBLOCK(' + x.name + ')'
 
     for v in current_block:
         tmp += '''
@@ -933,14 +942,130 @@ def get_function_mdnd(family): #macros, declarations and definitions
     header_r += tmp
     source_d += tmp
     source_r += tmp
+    source_i += tmp
 
-    return [header_d, header_r, source_d, source_r, notes]
+    return [header_d, header_r, source_d, source_r, notes, source_i]
 
 
 #================================================#
 # SOURCE GENERATION                              #
 #================================================#
 
+# Entry points that a typical render loop calls every frame, roughly hottest
+# first. They lead the GLATTER_FN_ order of their family, so the dispatch
+# slots one frame touches share a handful of cache lines; every other entry
+# point follows in name order.
+hot_entry_points = [
+    'glDrawArrays', 'glDrawElements', 'glDrawArraysInstanced', 'glDrawElementsInstanced',
+    'glDrawRangeElements', 'glDrawElementsBaseVertex', 'glDrawElementsInstancedBaseVertex',
+    'glDrawArraysInstancedBaseInstance', 'glDrawElementsInstancedBaseVertexBaseInstance',
+    'glDrawArraysIndirect', 'glDrawElementsIndirect', 'glMultiDrawArraysIndirect', 'glMultiDrawElementsIndirect',
+    'glBindVertexArray', 'glBindBuffer', 'glBindBufferBase', 'glBindBufferRange', 'glBindTexture',
+    'glBindTextureUnit', 'glBindSampler', 'glBindFramebuffer', 'glBindRenderbuffer', 'glBindImageTexture',
+    'glUseProgram', 'glBindProgramPipeline',
+    'glUniform1i', 'glUniform1f', 'glUniform2f', 'glUniform3f', 'glUniform4f', 'glUniform1iv', 'glUniform1fv',
+    'glUniform2fv', 'glUniform3fv', 'glUniform4fv', 'glUniformMatrix3fv', 'glUniformMatrix4fv',
+    'glActiveTexture', 'glBufferData', 'glBufferSubData', 'glMapBufferRange', 'glUnmapBuffer',
+    'glFlushMappedBufferRange', 'glTexSubImage2D', 'glTexImage2D',
+    'glEnable', 'glDisable', 'glEnableVertexAttribArray', 'glDisableVertexAttribArray',
+    'glVertexAttribPointer', 'glVertexAttribIPointer', 'glVertexAttribDivisor',
+    'glBlendFunc', 'glBlendFuncSeparate', 'glBlendEquation', 'glDepthFunc', 'glDepthMask', 'glColorMask',
+    'glStencilFunc', 'glStencilOp', 'glStencilMask', 'glCullFace', 'glScissor', 'glViewport',
+    'glPolygonOffset', 'glLineWidth',
+    'glClear', 'glClearColor', 'glClearDepth', 'glClearDepthf', 'glClearStencil', 'glClearBufferfv',
+    'glInvalidateFramebuffer', 'glBlitFramebuffer',
+    'glGetError', 'glGetIntegerv', 'glFenceSync', 'glClientWaitSync', 'glWaitSync', 'glDeleteSync',
+    'glFlush', 'glFinish',
+    'glXSwapBuffers', 'glXMakeCurrent', 'glXMakeContextCurrent', 'glXGetCurrentContext',
+    'glXGetCurrentDisplay', 'glXGetCurrentDrawable',
+    'eglSwapBuffers', 'eglMakeCurrent', 'eglGetCurrentContext', 'eglGetCurrentDisplay',
+    'eglGetCurrentSurface', 'eglGetError', 'eglSwapInterval',
+    'wglMakeContextCurrentARB', 'wglSwapIntervalEXT',
+]
+
+# Single-valued glGetIntegerv limits of glatter_get_context_caps(), with the
+# first GL and GLES versions that know them (major * 10 + minor, 0 for never).
+# A platform gets the ones its headers define.
+context_limits = [
+    ('GL_MAX_TEXTURE_SIZE',                       10, 10),
+    ('GL_MAX_CUBE_MAP_TEXTURE_SIZE',              13, 20),
+    ('GL_MAX_3D_TEXTURE_SIZE',                    12, 30),
+    ('GL_MAX_ARRAY_TEXTURE_LAYERS',               30, 30),
+    ('GL_MAX_RENDERBUFFER_SIZE',                  30, 20),
+    ('GL_MAX_SAMPLES',                            30, 30),
+    ('GL_MAX_COLOR_ATTACHMENTS',                  30, 30),
+    ('GL_MAX_DRAW_BUFFERS',                       20, 30),
+    ('GL_MAX_ELEMENTS_VERTICES',                  12, 30),
+    ('GL_MAX_ELEMENTS_INDICES',                   12, 30),
+    ('GL_MAX_VERTEX_ATTRIBS',                     20, 20),
+    ('GL_MAX_TEXTURE_IMAGE_UNITS',                20, 20),
+    ('GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS',         20, 20),
+    ('GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS',       20, 20),
+    ('GL_MAX_VERTEX_UNIFORM_VECTORS',             41, 20),
+    ('GL_MAX_FRAGMENT_UNIFORM_VECTORS',           41, 20),
+    ('GL_MAX_FRAGMENT_INPUT_COMPONENTS',          32, 30),
+    ('GL_MAX_UNIFORM_BLOCK_SIZE',                 31, 30),
+    ('GL_MAX_UNIFORM_BUFFER_BINDINGS',            31, 30),
+    ('GL_MAX_VERTEX_UNIFORM_BLOCKS',              31, 30),
+    ('GL_MAX_FRAGMENT_UNIFORM_BLOCKS',            31, 30),
+    ('GL_MAX_COMBINED_UNIFORM_BLOCKS',            31, 30),
+    ('GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT',        31, 30),
+    ('GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS',     43, 31),
+    ('GL_MAX_SHADER_STORAGE_BLOCK_SIZE',          43, 31),
+    ('GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT', 43, 31),
+    ('GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS',     43, 31),
+    ('GL_MAX_COMPUTE_SHARED_MEMORY_SIZE',         43, 31),
+]
+
+
+def get_context_limits(family):
+    # The entries of context_limits that the family's headers define.
+    if family != 'GL' or family not in enum_to_string:
+        return []
+    defined = set()
+    for blocks in enum_to_string[family].values():
+        for names in blocks.values():
+            defined |= names
+    return [x for x in context_limits if x[0] in defined]
+
+
+def get_layout_fingerprint(names, ext_names, limit_names):
+    # FNV-1a over the entry point names, then the extension names, then the
+    # context limits, one per line.
+    h = 2166136261
+    text = '\n'.join(names) + '\n\n' + '\n'.join(ext_names)
+    if limit_names:
+        text += '\n\n' + '\n'.join(limit_names)
+    for c in text.encode():
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def get_function_indices(family):
+    names = set(x.name for x in function_definitions[family] if x.name not in resolver_denylist)
+    if not names:
+        return ''
+
+    hot = [x for x in hot_entry_points if x in names]
+    names = hot + sorted(names - set(hot))
+
+    return '''
+/* Dense index of every ''' + family + ''' entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_''' + family + ''' {
+''' + '\n'.join('    GLATTER_FN_' + x + ',' for x in names) + '''
+    GLATTER_FN_COUNT_''' + family + '''
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_''' + family + ' ' + '0x%08xu' % get_layout_fingerprint(names,
+    ext_names_sorted.get(family, []), [x[0] for x in get_context_limits(family)]) + '''
+'''
+
+
 def get_enum_to_string(family):
     if family not in enum_to_string:
         return
@@ -1023,285 +1148,410 @@ def get_ext_support_decl(v):
     if v not in ext_names_sorted:
         return
 
+    count = len(ext_names_sorted[v])
+    words = (count + 31) // 32
+
     rv = '''
-#ifndef GLATTER_LOOKUP_SIZE
-#define GLATTER_LOOKUP_SIZE ''' + hex(hash_table_size) + '''
+/* Reads one bit of an extension support bitset. */
+#ifndef GLATTER_EXTENSION_SUPPORTED
+#define GLATTER_EXTENSION_SUPPORTED(status, index) \\
+    ((int)(((status)->bits[(index) >> 5] >> ((index) & 31)) & 1u))
 #endif
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4201)
-#endif
+/* Bit positions in glatter_extension_support_status_''' + v + '''_t::bits. */
+enum {
+''' + '\n'.join(['    GLATTER_EXT_' + x + ' = ' + str(i) + ',' for i, x in enumerate(ext_names_sorted[v])]) + '''
+    GLATTER_EXT_COUNT_''' + v + ' = ' + str(count) + '''
+};
 
+/* One bit per extension, indexed by GLATTER_EXT_* above. */
 typedef struct glatter_extension_support_status_''' + v + '''
 {
-''' + '\n'.join(['        int has_'+ x + ';' for x in ext_names_sorted[v]]) + '''
+    uint32_t bits[''' + str(words) + '''];
 } glatter_extension_support_status_''' + v + '''_t;
 
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-
-''' + '\n'.join([('#define glatter_' + x + ' glatter_get_extension_support_'+ v +'().has_' + x) for x in ext_names_sorted[v]]) + '''
+''' + '\n'.join([('#define glatter_' + x + ' glatter_extension_supported_' + v + '(GLATTER_EXT_' + x + ')') for x in ext_names_sorted[v]]) + '''
 '''
-    return rv
 
+    limits = get_context_limits(v)
+    if limits:
+        rv += '''
 
+/* Slots of glatter_context_caps_t::limits, each read with glGetIntegerv. */
+enum {
+''' + '\n'.join('    GLATTER_LIMIT_' + x[0][3:] + ' = ' + str(i) + ',' for i, x in enumerate(limits)) + '''
+    GLATTER_LIMIT_COUNT = ''' + str(len(limits)) + '''
+};
 
+/* What glatter_get_context_caps() reports of a context. Whatever the version
+ * of the context does not have stays 0. */
+typedef struct glatter_context_caps
+{
+    int   major, minor;                 /* GL_VERSION, e.g. 4 and 6 */
+    int   es;                           /* nonzero for OpenGL ES */
+    int   glsl_version;                 /* GL_SHADING_LANGUAGE_VERSION as in #version, e.g. 460 */
+    GLint profile_mask;                 /* GL_CONTEXT_PROFILE_MASK, from GL 3.2 */
+    GLint flags;                        /* GL_CONTEXT_FLAGS, from GL 3.0 and GLES 3.2 */
+    GLint limits[GLATTER_LIMIT_COUNT];  /* by GLATTER_LIMIT_* */
+} glatter_context_caps_t;
+'''
+    return rv
 
-def get_ext_support_def(v):
-    if v not in ext_names_sorted:
-        return
 
-    hts = ''
-    ht = ['0'] * hash_table_size;
-    for x in sorted(ext_hash_to_full_hash[v]):
-        ht[x] = 'e' + '{:x}'.format(x)
-    for idx, val in enumerate(ht):
-        hts += str(val) + ',' + ('\n        ' if (((idx+1) % 30) == 0) else '')
 
-    rv = '''
-#include <string.h> /* memcpy */
 
-/* ---- Per-context, per-thread extension support cache (generated) ---- */
-#ifndef GLATTER_ES_CACHE_SLOTS
-#define GLATTER_ES_CACHE_SLOTS 8
-#endif
-
-typedef struct {
-    uintptr_t key; /* context key from glatter_current_gl_context_key_() */
-    glatter_extension_support_status_''' + v + '''_t ess;
-} glatter_es_cache_entry_''' + v + '''_t;
+def open_template_ext_cache(v):
+    # Cache and accessor of a family's extension set, up to where the set is built.
+    # A GL set is a glatter_context_info_GL_t, which also holds the context caps.
+    if v == 'GL':
+        none_decl = ''
+        none_ref = '&glatter_context_info_none_GL.extensions'
+        payload = 'glatter_context_info_GL_t'
+        data = '''    glatter_context_info_GL_t* info = (glatter_context_info_GL_t*)glatter_context_set_data_(set);
+    glatter_extension_support_status_GL_t* ess = &info->extensions;
+'''
+    else:
+        none_decl = '''    static const glatter_extension_support_status_''' + v + '''_t none = {{0}};
 
-static GLATTER_THREAD_LOCAL glatter_es_cache_entry_''' + v + '''_t
-    glatter_es_cache_''' + v + '''[GLATTER_ES_CACHE_SLOTS];
+'''
+        none_ref = '&none'
+        payload = 'glatter_extension_support_status_' + v + '_t'
+        data = '''    glatter_extension_support_status_''' + v + '''_t* ess =
+        (glatter_extension_support_status_''' + v + '''_t*)glatter_context_set_data_(set);
+'''
 
-static GLATTER_THREAD_LOCAL unsigned glatter_es_cache_pos_''' + v + ''' = 0;
+    return '''/* ---- Per-context extension support cache (generated) ----
+ * A context cache shared by all threads; see "Context caches" in glatter_def.h. */
+GLATTER_LINKONCE glatter_context_cache_t glatter_es_cache_''' + v + ''';
 
 /* Optional: public invalidation for this family. */
 GLATTER_INLINE_OR_NOT void glatter_invalidate_extension_cache_''' + v + '''(void) {
-    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
-        glatter_es_cache_''' + v + '''[i].key = (uintptr_t)0;
-    }
+    GLATTER_REGISTRY_FORWARD_INVALIDATE(''' + v + ''');
+    glatter_context_cache_clear_(&glatter_es_cache_''' + v + ''');
 }
 
+/* Returns the extension bitset of the current context. The set is shared by
+ * all threads and stays valid for the process (see "Context caches" in
+ * glatter_def.h); once the cache is invalidated, the next call builds a new
+ * one. Without a current context it points to an all-zero set. */
 GLATTER_INLINE_OR_NOT
-glatter_extension_support_status_''' + v + '''_t glatter_get_extension_support_''' + v + '''()
+const glatter_extension_support_status_''' + v + '''_t* glatter_get_extension_support_''' + v + '''(void)
 {
-    /* Per-thread scratch array to build the bitset before mapping into ess. */
-    static GLATTER_THREAD_LOCAL int indexed_extensions[''' + str(len(ext_names_sorted[v])) + '''];
-
-    /* Local result object (returned by value). */
-    glatter_extension_support_status_''' + v + '''_t ess; /* will be filled then returned */
-    memset(&ess, 0, sizeof(ess));
+''' + none_decl + '''    /* 0) With GLATTER_SHARED_REGISTRY, the root instance's cache may serve this one. */
+    GLATTER_REGISTRY_FORWARD_EXTENSIONS(''' + v + ''');
 
     /* 1) Compute a key for the current context; 0 means "no current context". */
-    uintptr_t ctx_key = glatter_current_gl_context_key_();
+    uintptr_t ctx_handle;
+    uintptr_t ctx_key = glatter_current_gl_context_(&ctx_handle);
 
-    /* 2) If no current context, return zeros without touching the cache. */
+    /* 2) If no current context, report no extensions without touching the cache. */
     if (ctx_key == (uintptr_t)0) {
-        /* Leave ess zero-initialized to indicate "no extensions known". */
-        return ess;
+        return ''' + none_ref + ''';
     }
 
-    /* 3) Cache lookup (TLS ring of 8 entries). */
-    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
-        if (glatter_es_cache_''' + v + '''[i].key == ctx_key) {
-            return glatter_es_cache_''' + v + '''[i].ess; /* HIT */
-        }
+    /* 3) Cache lookup, shared by all threads. */
+    const glatter_extension_support_status_''' + v + '''_t* cached = (const glatter_extension_support_status_''' + v + '''_t*)
+        glatter_context_cache_find_(&glatter_es_cache_''' + v + ''', ctx_key);
+    if (cached) {
+        return cached; /* HIT */
     }
 
-    /* 4) MISS: (re)build indexed_extensions[...] for the *current* context. */
-    /* Ensure scratch is cleared before probing. */
-    memset(indexed_extensions, 0, sizeof(indexed_extensions));
+    /* 4) MISS: build the bitset for the *current* context in a new entry,
+     * which is published only once complete. An early return below frees it
+     * and leaves nothing cached. */
+    glatter_context_set_t* set = glatter_context_set_new_(ctx_key, ctx_handle, sizeof(''' + payload + '''));
+    if (!set) {
+        return ''' + none_ref + ''';
+    }
+''' + data
 
-    typedef glatter_es_record_t rt;
-#ifdef __cplusplus
-    static const rt zrt = {0, 0};
-#else
-#define zrt {0, 0}
-#endif
-''' + '\n'.join([
-        '    static rt e' + '{: <4x}'.format(x) + '[] = {{' + '}, {'.join(
-            str([y, ext_hash_to_full_hash[v][x][y]]).translate({ord(c): None for c in '[]'})
-            for y in sorted(ext_hash_to_full_hash[v][x])
-        ) + '}, zrt};'
-        for x in sorted(ext_hash_to_full_hash[v])
-    ]) + '''
-
-#ifndef __cplusplus
-#undef zrt
-#endif
 
-    static glatter_es_record_t* es_dispatch[GLATTER_LOOKUP_SIZE] = {
-        ''' + hts[:-1] + '''
-    };
+def get_ext_support_def(v):
+    if v not in ext_names_sorted:
+        return
 
+    names = ext_names_sorted[v]
+    slots, buckets, seeds, table = perfect_hash(names)
+    if max(seeds) > 0xFFFF or len(names) >= 0xFFFF:
+        sys.stderr.write('error: the extension hash of %s does not fit 16 bits\n' % v)
+        sys.exit(2)
+
+    index_of = {x: i for i, x in enumerate(names)}
+    offsets = []
+    offset = 0
+    for x in names:
+        offsets.append(offset)
+        offset += len(x) + 1
+    if offset > 0xFFFF:
+        sys.stderr.write('error: the extension names of %s do not fit 16-bit offsets\n' % v)
+        sys.exit(2)
+
+    def rows(values, per_row):
+        return ''.join('\n    ' + ' '.join(str(x) + ',' for x in values[i:i+per_row])
+            for i in range(0, len(values), per_row))
+
+    rv = '''
+/* ---- Extension name lookup (generated) ----
+ * Perfect hash over the GLATTER_EXT_* names of this family; see
+ * glatter_extension_index_ in glatter_def.h. */
+static const uint16_t glatter_ext_seeds_''' + v + '''[''' + str(buckets) + '''] = {''' + rows(seeds, 16) + '''
+};
+
+static const uint16_t glatter_ext_slots_''' + v + '''[''' + str(slots) + '''] = {''' + rows(
+        [index_of[x] if x else 0xFFFF for x in table], 16) + '''
+};
+
+static const uint16_t glatter_ext_name_offsets_''' + v + '''[GLATTER_EXT_COUNT_''' + v + '''] = {''' + rows(offsets, 12) + '''
+};
+
+static const char glatter_ext_names_''' + v + '''[] =
+''' + '\n'.join('    "' + x + '\\0"' for x in names) + ''';
+
+static const glatter_extension_table_t glatter_ext_table_''' + v + ''' = {
+    ''' + str(buckets) + ''', ''' + str(slots) + ''',
+    glatter_ext_seeds_''' + v + ''', glatter_ext_slots_''' + v + ''',
+    glatter_ext_name_offsets_''' + v + ''', glatter_ext_names_''' + v + '''
+};
 
 '''
+    if v == 'GL':
+        rv += get_context_caps_def(v)
+    rv += open_template_ext_cache(v)
+
     if (v == 'GL'):
         rv += '''
-        const uint8_t* glv = NULL;
-        if (glatter_get_proc_address_GL("glGetString")) {
-            glv = (const uint8_t*)glatter_glGetString(GL_VERSION);
-        }
-        int new_way = 0;
-        if (!glv) {
-            return ess;
-        }
-        if (glv[0] < '0' || glv[0] > '9') {
-            new_way = 0;
-        }
-        else {
-            new_way = glv[0] > '2'; // i.e. gl version is 3 or higher
-        }
+    const uint8_t* glv = NULL;
+    if (glatter_get_proc_address_GL("glGetString")) {
+        glv = (const uint8_t*)glatter_glGetString(GL_VERSION);
+    }
+    if (!glv) {
+        free(set);
+        return &glatter_context_info_none_GL.extensions;
+    }
+    glatter_query_context_caps_GL_(&info->caps, glv);
 
 #ifdef GL_NUM_EXTENSIONS
-        if (new_way && glatter_get_proc_address_GL("glGetStringi") ) {
-            GLint n = 0; 
-            glGetIntegerv(GL_NUM_EXTENSIONS, &n); 
-            for (GLint i=0; i<n; i++)  { 
-                uint32_t hash = glatter_djb2( (const uint8_t*)glatter_glGetStringi(GL_EXTENSIONS, i) );
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-                if (index == -1) {
-                    // (1) This scope will be reached if the implementation supports an extension
-                    // not listed in the headers. This may happen if the headers are old or the
-                    // extension is deprecated. The same condition repeats two more times below.
-                    // It is not an error, thus there is nothing to do.
-                    // The statement is left for debug purposes.
-                }
-            }
-        }
-        else {
-#endif
-            uint32_t hash = 5381;
-            const uint8_t* ext_str = (const uint8_t*)glatter_glGetString(GL_EXTENSIONS);
-            for ( ; ext_str && *ext_str; ext_str++) {
-                if (*ext_str == ' ') {
-                    int index = -1;
-                    rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                    for ( ; r && (r->hash | r->index); r++ ) {
-                        if (r->hash == hash) {
-                            index = r->index;
-                            indexed_extensions[index] = 1;
-                            break;
-                        }
-                    }
-
-                    if (index == -1) {
-                        // (2)
-                    }
-
-                    // reset
-                    hash = 5381;
-                    continue;
-                }
-
-                hash = ((hash << 5) + hash) + (int)(*ext_str);
-
+    if (info->caps.major >= 3 && glatter_get_proc_address_GL("glGetStringi")) {
+        GLint n = 0;
+        glatter_glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+        for (GLint i = 0; i < n; i++) {
+            const uint8_t* name = (const uint8_t*)glatter_glGetStringi(GL_EXTENSIONS, i);
+            if (name) {
+                glatter_extension_mark_(ess->bits, &glatter_ext_table_GL, name, strlen((const char*)name));
             }
-            if (ext_str && hash != 5381) {
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-                if (index == -1) {
-                    // (3)
-                }
-            }
-#ifdef GL_NUM_EXTENSIONS
         }
+    }
+    else
 #endif
+    {
+        glatter_extension_mark_list_(ess->bits, &glatter_ext_table_GL,
+            (const uint8_t*)glatter_glGetString(GL_EXTENSIONS));
+    }
 '''
     else:
         if (v == 'GLX'):
             estring_acquisition = '''
-        Display* d = glXGetCurrentDisplay();
-        const uint8_t* ext_str = d ? (const uint8_t*)glatter_glXQueryExtensionsString(d, DefaultScreen(d)) : NULL;'''
+    Display* d = glXGetCurrentDisplay();
+    const uint8_t* ext_str = d ? (const uint8_t*)glatter_glXQueryExtensionsString(d, DefaultScreen(d)) : NULL;'''
         elif (v == 'WGL'):
             estring_acquisition = '''
-        const uint8_t* ext_str = NULL;
-        if (glatter_wglGetExtensionsStringEXT) {
-            ext_str = (const uint8_t*)glatter_wglGetExtensionsStringEXT();
-        }
-        if (!ext_str && glatter_wglGetExtensionsStringARB) {
-            HDC dc = wglGetCurrentDC();
-            ext_str = dc ? (const uint8_t*)glatter_wglGetExtensionsStringARB(dc) : NULL;
-        }'''
+    const uint8_t* ext_str = NULL;
+    if (glatter_wglGetExtensionsStringEXT) {
+        ext_str = (const uint8_t*)glatter_wglGetExtensionsStringEXT();
+    }
+    if (!ext_str && glatter_wglGetExtensionsStringARB) {
+        HDC dc = wglGetCurrentDC();
+        ext_str = dc ? (const uint8_t*)glatter_wglGetExtensionsStringARB(dc) : NULL;
+    }'''
         elif (v == 'EGL'):
             estring_acquisition = '''
-        const uint8_t* ext_str = (const uint8_t*)glatter_eglQueryString(eglGetCurrentDisplay(), EGL_EXTENSIONS);'''
+    const uint8_t* ext_str = (const uint8_t*)glatter_eglQueryString(eglGetCurrentDisplay(), EGL_EXTENSIONS);'''
 
+        rv += estring_acquisition + '''
+    glatter_extension_mark_list_(ess->bits, &glatter_ext_table_''' + v + ''', ext_str);
+'''
+
+    rv += '''
+    return (const glatter_extension_support_status_''' + v + '''_t*)
+        glatter_context_cache_publish_(&glatter_es_cache_''' + v + ''', set);
+}
+'''
+    if v == 'GL':
         rv += '''
-        uint32_t hash = 5381;''' + estring_acquisition + '''
-        for ( ; ext_str && *ext_str; ext_str++) {
-            if (*ext_str == ' ') {
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-
-                if (index == -1) {
-                    // (2)
-                }
-
-                // reset
-                hash = 5381;
-                continue;
-            }
+/* Returns the version, profile and limits of the current context. They are
+ * queried with its extensions, cached with them and invalidated with them.
+ * Without a current context every field is 0. */
+GLATTER_INLINE_OR_NOT
+const glatter_context_caps_t* glatter_get_context_caps(void)
+{
+    /* Every GL set, including the empty one, is a glatter_context_info_GL_t. */
+    return &((const glatter_context_info_GL_t*)glatter_get_extension_support_GL())->caps;
+}
+'''
+    return rv
 
-            hash = ((hash << 5) + hash) + (int)(*ext_str);
 
-        }
-        if (ext_str && hash != 5381) {
-            int index = -1;
-            rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-            for ( ; r && (r->hash | r->index); r++ ) {
-                if (r->hash == hash) {
-                    index = r->index;
-                    indexed_extensions[index] = 1;
-                    break;
-                }
-            }
-            if (index == -1) {
-                // (3)
-            }
-        }
-        '''
+def get_context_caps_def(v):
+    # The cached payload of a GL context and the pass that fills its caps.
+    limits = get_context_limits(v)
+    return '''
+/* ---- Context capabilities (generated) ---- */
 
-    rv += '''
-    // Map array to a struct without undefined behaviour.
-    // No actual copy is performed with even basic optimization e.g.: -Og
-    memcpy((void*)&ess, indexed_extensions, sizeof(ess));
+/* A GL context's cached set. glatter_get_extension_support_GL returns the
+ * address of the first member, glatter_get_context_caps finds the second. */
+typedef struct glatter_context_info_GL
+{
+    glatter_extension_support_status_GL_t extensions;
+    glatter_context_caps_t                caps;
+} glatter_context_info_GL_t;
 
-    glatter_es_cache_''' + v + '''[glatter_es_cache_pos_''' + v + '''].key = ctx_key;
-    glatter_es_cache_''' + v + '''[glatter_es_cache_pos_''' + v + '''].ess = ess;
-    glatter_es_cache_pos_''' + v + ''' = (glatter_es_cache_pos_''' + v + ''' + 1) % GLATTER_ES_CACHE_SLOTS;
+/* All zero: the set of "no current context". Never written. */
+static glatter_context_info_GL_t glatter_context_info_none_GL;
 
-    return ess;
+typedef struct glatter_context_limit
+{
+    uint16_t slot;      /* GLATTER_LIMIT_* */
+    uint8_t  gl, es;    /* first version with the query, major * 10 + minor; 0 for none */
+    GLenum   name;
+} glatter_context_limit_t;
+
+/* The limits of context_limits in glatter.py that these headers define. */
+static const glatter_context_limit_t glatter_context_limits_GL[] = {
+''' + ''.join('''#ifdef ''' + x[0] + '''
+    { GLATTER_LIMIT_''' + x[0][3:] + ''', ''' + str(x[1]) + ''', ''' + str(x[2]) + ''', ''' + x[0] + ''' },
+#endif
+''' for x in limits) + '''    { GLATTER_LIMIT_COUNT, 0, 0, 0 }
+};
+
+static int glatter_context_has_(const glatter_context_caps_t* caps, int gl, int es)
+{
+    int first = caps->es ? es : gl;
+    return first != 0 && caps->major * 10 + caps->minor >= first;
 }
+
+/* Fills caps from GL_VERSION and the queries that version has, so that none
+ * of them raises GL_INVALID_ENUM. */
+static void glatter_query_context_caps_GL_(glatter_context_caps_t* caps, const uint8_t* version)
+{
+    caps->es = strncmp((const char*)version, "OpenGL ES", 9) == 0;
+    glatter_parse_version_(version, &caps->major, &caps->minor);
+
+#ifdef GL_SHADING_LANGUAGE_VERSION
+    if (glatter_context_has_(caps, 20, 20)) {
+        int major, minor;
+        glatter_parse_version_((const uint8_t*)glatter_glGetString(GL_SHADING_LANGUAGE_VERSION), &major, &minor);
+        caps->glsl_version = major * 100 + (minor < 10 ? minor * 10 : minor);
+    }
+#endif
+#ifdef GL_CONTEXT_PROFILE_MASK
+    if (glatter_context_has_(caps, 32, 0)) {
+        glatter_glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &caps->profile_mask);
+    }
+#endif
+#ifdef GL_CONTEXT_FLAGS
+    if (glatter_context_has_(caps, 30, 32)) {
+        glatter_glGetIntegerv(GL_CONTEXT_FLAGS, &caps->flags);
+    }
+#endif
+    for (const glatter_context_limit_t* limit = glatter_context_limits_GL; limit->slot != GLATTER_LIMIT_COUNT; ++limit) {
+        if (glatter_context_has_(caps, limit->gl, limit->es)) {
+            glatter_glGetIntegerv(limit->name, &caps->limits[limit->slot]);
+        }
+    }
+}
+
+'''
+
+
+def fnv1a_32(s):
+    h = 0x811C9DC5
+    for x in s.encode('ascii'):
+        h ^= x
+        h = (h * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def entry_point_slot(h, seed, mask):
+    # Must match glatter_entry_point_slot_() in glatter_def.h
+    x = h ^ seed
+    x ^= x >> 16
+    x = (x * 0x85EBCA6B) & 0xFFFFFFFF
+    x ^= x >> 13
+    x = (x * 0xC2B2AE35) & 0xFFFFFFFF
+    x ^= x >> 16
+    return x & mask
+
+
+def perfect_hash(names):
+    # Hash-and-displace perfect hash: the FNV-1a hash of a name selects a
+    # bucket, and the bucket's seed moves all of its names to distinct slots
+    # of a table with at least one slot per name. Returns the slot and bucket
+    # counts, the seed of each bucket and the name in each slot.
+    hashes = {}
+    for x in names:
+        h = fnv1a_32(x)
+        if h in hashes:
+            sys.stderr.write('error: FNV-1a collision between %s and %s\n' % (hashes[h], x))
+            sys.exit(2)
+        hashes[h] = x
+
+    slots = 1
+    while slots < len(names):
+        slots *= 2
+    buckets = max(1, slots // 2)
+
+    bucket_members = [[] for _ in range(buckets)]
+    for h in hashes:
+        bucket_members[(h ^ (h >> 16)) & (buckets - 1)].append(h)
+
+    seeds = [0] * buckets
+    table = [None] * slots
+    for b in sorted(range(buckets), key=lambda i: (-len(bucket_members[i]), i)):
+        members = bucket_members[b]
+        if not members:
+            break
+        seed = 1
+        while True:
+            positions = [entry_point_slot(h, seed, slots - 1) for h in members]
+            if len(set(positions)) == len(positions) and all(table[i] is None for i in positions):
+                break
+            seed += 1
+        seeds[b] = seed
+        for h, i in zip(members, positions):
+            table[i] = hashes[h]
+
+    return slots, buckets, seeds, table
+
+
+def get_entry_points_def(names):
+    # Perfect hash over every entry point of the platform.
+    if not names:
+        return
+
+    slots, buckets, seeds, table = perfect_hash(names)
+
+    seed_lines = ''
+    for i in range(0, buckets, 8):
+        seed_lines += '\n    ' + ' '.join(str(x) + ',' for x in seeds[i:i+8])
+
+    return '''
+/* Perfect hash of every entry point name known to this platform, used by
+ * glatter_get_proc_address to cache resolved addresses (see glatter_def.h).
+ * The arrays are not const so that they can be link-once in header-only mode,
+ * but nothing writes to them. */
+
+#define GLATTER_ENTRY_POINT_COUNT ''' + str(len(names)) + '''
+#define GLATTER_ENTRY_POINT_SLOTS ''' + str(slots) + '''
+#define GLATTER_ENTRY_POINT_BUCKETS ''' + str(buckets) + '''
+
+GLATTER_LINKONCE uint32_t glatter_entry_point_seeds[GLATTER_ENTRY_POINT_BUCKETS] = {''' + seed_lines + '''
+};
+
+GLATTER_LINKONCE const char* glatter_entry_point_names[GLATTER_ENTRY_POINT_SLOTS] = {
+''' + '\n'.join(('    "' + x + '",') if x else '    NULL,' for x in table) + '''
+};
 '''
-    return rv
 
 
 
@@ -1340,29 +1590,15 @@ for platform in platform_headers:
     # containers populated during parsing phase
     enum_to_string = {}
     function_definitions = {key: set() for key in families}
-    ext_hash_to_full_hash = {key: {} for key in families}
-    ext_name_to_hash = {key: {} for key in families}
+    ext_names_found = {key: set() for key in families}
     ext_names_sorted = {}
 
     for header in platform[1:]:    
         parse(header)
 
     for x in families:
-        if (bool(ext_name_to_hash[x])):
-            ext_names_sorted[x] = sorted(ext_name_to_hash[x])
-            for idx, val in enumerate(ext_names_sorted[x]):
-                h = hash_djb2(val)
-                ext_hash_to_full_hash[x][ext_name_to_hash[x][val]][h] = idx
-
-    seen_hashes = {}
-    for fam, names in ext_names_sorted.items():
-        for nm in names:
-            h = hash_djb2(nm)
-            if h in seen_hashes and seen_hashes[h] != nm:
-                print("WARNING: full djb2 hash collision between %s and %s in %s" % (
-                    seen_hashes[h], nm, fam))
-            else:
-                seen_hashes[h] = nm
+        if (bool(ext_names_found[x])):
+            ext_names_sorted[x] = sorted(ext_names_found[x])
 
 
     # GENERATE OUTPUT FILES
@@ -1376,9 +1612,16 @@ for platform in platform_headers:
         write_to_file(platform_output_dir + '/glatter_' + v + '_ges_decl.h', get_ext_support_decl(v))
         write_to_file(platform_output_dir + '/glatter_' + v + '_d.h', mndn[v][0])
         write_to_file(platform_output_dir + '/glatter_' + v + '_r.h', mndn[v][1])
+        write_to_file(platform_output_dir + '/glatter_' + v + '_fn.h', get_function_indices(v))
+
+    # GLU is resolved from libGLU directly, never through glatter_get_proc_address.
+    entry_point_names = sorted(set(
+        x.name for v in families if v != 'GLU' for x in function_definitions[v]))
+    write_to_file(platform_output_dir + '/glatter_entry_points_def.h', get_entry_points_def(entry_point_names))
 
     for v in families:
         write_to_file(platform_output_dir + '/glatter_' + v + '_e2s_def.h', get_enum_to_string(v))
         write_to_file(platform_output_dir + '/glatter_' + v + '_ges_def.h', get_ext_support_def(v))
         write_to_file(platform_output_dir + '/glatter_' + v + '_d_def.h', mndn[v][2])
         write_to_file(platform_output_dir + '/glatter_' + v + '_r_def.h', mndn[v][3])
+        write_to_file(platform_output_dir + '/glatter_' + v + '_i_def.h', mndn[v][5])
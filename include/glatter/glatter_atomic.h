@@ -13,12 +13,14 @@
  *
  *   2) INTEGER ATOMICS (int gates/counters)
  *      - Use for integer state (e.g., WSI decision gate).
- *      - Types/macros: glatter_atomic_int, GLATTER_ATOMIC_INT_LOAD/STORE/CAS, GLATTER_ATOMIC_INT_INIT(v)
+ *      - Types/macros: glatter_atomic_int, GLATTER_ATOMIC_INT_LOAD/STORE/CAS/FETCH_ADD,
+ *        GLATTER_ATOMIC_INT_INIT(v)
  *
  * Memory order:
  *   - LOAD  : acquire
  *   - STORE : release
  *   - CAS   : success=acq_rel, failure=acquire
+ *   - FETCH_ADD : acq_rel, yields the value before the addition
  *
  * This header intentionally avoids heavier abstractions. It simply unifies:
  *   - C++11 std::atomic
@@ -98,6 +100,7 @@ typedef std::atomic<int> glatter_atomic_int;
 #  define GLATTER_ATOMIC_INT_STORE(a,v) ((a).store((v), std::memory_order_release))
 #  define GLATTER_ATOMIC_INT_CAS(a,exp,des) \
         ((a).compare_exchange_strong((exp),(des), std::memory_order_acq_rel, std::memory_order_acquire))
+#  define GLATTER_ATOMIC_INT_FETCH_ADD(a,v) ((a).fetch_add((v), std::memory_order_acq_rel))
 
 #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
 
@@ -108,6 +111,7 @@ typedef _Atomic(int) glatter_atomic_int;
 #  define GLATTER_ATOMIC_INT_STORE(a,v) atomic_store_explicit(&(a), (v), memory_order_release)
 #  define GLATTER_ATOMIC_INT_CAS(a,exp,des) \
         atomic_compare_exchange_strong_explicit(&(a), &(exp), (des), memory_order_acq_rel, memory_order_acquire)
+#  define GLATTER_ATOMIC_INT_FETCH_ADD(a,v) atomic_fetch_add_explicit(&(a), (v), memory_order_acq_rel)
 
 #elif defined(_WIN32)
 
@@ -119,6 +123,7 @@ typedef LONG glatter_atomic_int;
 #  define GLATTER_ATOMIC_INT_STORE(a,v) ((void)InterlockedExchange((volatile LONG*)&(a), (LONG)(v)))
 #  define GLATTER_ATOMIC_INT_CAS(a,exp,des) \
         (InterlockedCompareExchange((volatile LONG*)&(a), (LONG)(des), (LONG)(exp)) == (LONG)(exp))
+#  define GLATTER_ATOMIC_INT_FETCH_ADD(a,v) ((int)InterlockedExchangeAdd((volatile LONG*)&(a), (LONG)(v)))
 
 #else
 
@@ -129,6 +134,7 @@ typedef int glatter_atomic_int;
 #  define GLATTER_ATOMIC_INT_STORE(a,v) __atomic_store_n(&(a), (v), __ATOMIC_RELEASE)
 #  define GLATTER_ATOMIC_INT_CAS(a,exp,des) \
         __atomic_compare_exchange_n(&(a), &(exp), (des), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#  define GLATTER_ATOMIC_INT_FETCH_ADD(a,v) __atomic_fetch_add(&(a), (v), __ATOMIC_ACQ_REL)
 
 #endif /* integer atomics selection */
 
@@ -25,8 +25,8 @@
 /* X11 */
 #define GLATTER_INSTALL_X_ERROR_HANDLER      1
 
-/* Optional: override the number of per-thread extension-cache slots.
-   Raise only if your app rapidly swaps among >8 contexts on the same thread. */
+/* Optional: override the number of contexts whose extension sets are cached.
+   Raise only if your app rapidly swaps among >8 contexts. */
 #ifndef GLATTER_ES_CACHE_SLOTS
 #define GLATTER_ES_CACHE_SLOTS               8
 #endif
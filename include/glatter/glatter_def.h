@@ -33,11 +33,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <glatter/glatter_config.h>
 #include <glatter/glatter_atomic.h>
 #include <glatter/glatter_platform_headers.h>
+#include <glatter/glatter_types.h>
 #include <glatter/glatter_masprintf.h>
 #include <glatter/glatter_once.h>
 
 #include <assert.h>
 #include <stdarg.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -49,6 +51,27 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #   define GLATTER_UNUSED
 #endif
 
+/* For code that only runs on first use, on a miss or to log. It is kept out of
+ * line, and GCC/Clang place it in .text.unlikely, so that the steady-state
+ * path of a wrapper is a few instructions and the hot code stays dense. */
+#if defined(__GNUC__) || defined(__clang__)
+#   define GLATTER_COLD __attribute__((cold, noinline))
+#   define GLATTER_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#elif defined(_MSC_VER)
+#   define GLATTER_COLD __declspec(noinline)
+#   define GLATTER_UNLIKELY(x) (x)
+#else
+#   define GLATTER_COLD
+#   define GLATTER_UNLIKELY(x) (x)
+#endif
+
+/* A cold internal function that header-only builds only emit where it is used. */
+#if defined(GLATTER_HEADER_ONLY)
+#   define GLATTER_COLD_STATIC static inline GLATTER_COLD
+#else
+#   define GLATTER_COLD_STATIC static GLATTER_COLD
+#endif
+
 #if defined(_WIN32)
 #   include <windows.h>
 #   include <tchar.h>
@@ -127,6 +150,38 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     #include <pthread.h>
     #include <sched.h>
     #include <sys/select.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+#if defined(GLATTER_SHARED_REGISTRY)
+    #include <link.h>
+    #include <stddef.h>
+#endif
+
+/* Vector width of the extension string scanner; see glatter_extension_separator_.
+ * Chosen at compile time, since header-only builds cannot dispatch at run time.
+ * The scanner reads whole aligned blocks around the string, which AddressSanitizer
+ * would report, so sanitized builds keep the scalar loop. */
+#if defined(__SANITIZE_ADDRESS__)
+#   define GLATTER_SCAN_SCALAR
+#elif defined(__has_feature)
+#   if __has_feature(address_sanitizer)
+#       define GLATTER_SCAN_SCALAR
+#   endif
+#endif
+#if defined(GLATTER_SCAN_SCALAR)
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+#   define GLATTER_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+#   define GLATTER_SCAN_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#   define GLATTER_SCAN_NEON
+#endif
+#if (defined(GLATTER_SCAN_AVX2) || defined(GLATTER_SCAN_SSE2)) && defined(_MSC_VER)
+    #include <intrin.h>
 #endif
 
 /*
@@ -183,16 +238,167 @@ typedef void (*glatter_log_handler_fn)(const char*);
 GLATTER_LINKONCE glatter_atomic(glatter_log_handler_fn) glatter_log_handler_state =
     GLATTER_ATOMIC_INIT_PTR(glatter_default_log_handler);
 
+#if defined(GLATTER_SHARED_REGISTRY)
+
+#if !defined(__ELF__) || !(defined(__GNUC__) || defined(__clang__))
+#  error "GLATTER_SHARED_REGISTRY needs GCC or Clang targeting ELF."
+#endif
+#if defined(GLATTER_CONTEXT_DISPATCH)
+#  error "GLATTER_SHARED_REGISTRY and GLATTER_CONTEXT_DISPATCH cannot be combined."
+#endif
+
+/* ---- Process-wide registry (GLATTER_SHARED_REGISTRY) ----
+ *
+ * Every glatter instance, i.e. the compiled library or one link unit of the
+ * header-only build, exports glatter_registry_v1. As it is loaded, an
+ * instance looks for the registry of an instance that is already in the
+ * process, in any loaded object, including plugins opened with RTLD_LOCAL,
+ * and makes it its root; the first instance is its own root. Loaders run
+ * constructors one object at a time, so the instances agree on the root.
+ *
+ * A non-root instance hands lookups and process configuration to the root,
+ * so the libraries are opened, the WSI decided and every name resolved once
+ * per process. It also uses the root's missing-symbol generation and log
+ * sink and, for each family whose generated layout (GLATTER_FN_LAYOUT_<F>)
+ * matches, the root's header-only dispatch table and extension cache. The
+ * root's object is pinned with RTLD_NODELETE, since the others call into it.
+ *
+ * The layout is ABI. Fields are only appended, and 'size' tells a newer
+ * instance how much of it an older root provides.
+ */
+#define GLATTER_REGISTRY_ABI 1
+
+struct glatter_configuration_stats;
+
+enum {
+    GLATTER_REGISTRY_GL,
+    GLATTER_REGISTRY_GLX,
+    GLATTER_REGISTRY_EGL,
+    GLATTER_REGISTRY_WGL,
+    GLATTER_REGISTRY_GLU,
+    GLATTER_REGISTRY_FAMILIES
+};
+
+/* Entries are NULL where the family or the feature is not built. The extension
+ * functions are stored type-erased and cast back to their own type to be called. */
+typedef struct glatter_registry_family {
+    uint32_t count;                         /* GLATTER_FN_COUNT_<F> */
+    uint32_t layout;                        /* GLATTER_FN_LAYOUT_<F> */
+    glatter_atomic(void*)* table;           /* header-only lazy dispatch table */
+    void (*extension_support)(void);        /* glatter_get_extension_support_<F> */
+    void (*invalidate_extensions)(void);    /* glatter_invalidate_extension_cache_<F> */
+} glatter_registry_family;
+
+typedef struct glatter_registry {
+    uint32_t abi;
+    uint32_t size;
+    glatter_atomic(void*) root;             /* NULL until this instance has joined */
+    glatter_atomic_int* phase;
+    glatter_atomic_int* missing_generation;
+    glatter_atomic(glatter_log_handler_fn)* log_handler;
+    void* (*get_proc_address)(const char*);
+    void  (*set_wsi)(int);
+    int   (*get_wsi)(void);
+    int   (*set_proc_address_provider)(void* (*)(const char*, void*), void*);
+    int   (*set_library_path)(int, const char*);
+    int   (*set_dlopen_policy)(int);
+    void  (*set_log_handler)(void (*)(const char*));
+    glatter_registry_family families[GLATTER_REGISTRY_FAMILIES];
+    void  (*get_configuration_stats)(struct glatter_configuration_stats*);
+    void  (*context_destroyed)(uintptr_t);
+    void  (*context_made_current)(uintptr_t);
+} glatter_registry;
+
+/* Exported for discovery, but bound locally: each instance must see its own. */
+#if defined(GLATTER_HEADER_ONLY)
+__attribute__((weak, visibility("protected")))
+#else
+__attribute__((visibility("protected")))
+#endif
+glatter_registry glatter_registry_v1 = {
+    GLATTER_REGISTRY_ABI, (uint32_t)sizeof(glatter_registry), GLATTER_ATOMIC_INIT_PTR(NULL),
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    { { 0, 0, NULL, NULL, NULL } },
+    NULL, NULL, NULL
+};
+
+static glatter_registry* glatter_registry_join_(void);
+
+/* The registry this instance defers to: its own if it is the root. */
+static inline glatter_registry* glatter_registry_root_(void)
+{
+    glatter_registry* root = (glatter_registry*)GLATTER_ATOMIC_LOAD(glatter_registry_v1.root);
+    return root ? root : glatter_registry_join_();
+}
+
+/* Hands a call of a process-level function to the root instance. */
+#define GLATTER_REGISTRY_FORWARD(call) \
+    do { \
+        glatter_registry* glatter_root_ = glatter_registry_root_(); \
+        if (glatter_root_ != &glatter_registry_v1) { \
+            return glatter_root_->call; \
+        } \
+    } while (0)
+#define GLATTER_REGISTRY_FORWARD_VOID(call) \
+    do { \
+        glatter_registry* glatter_root_ = glatter_registry_root_(); \
+        if (glatter_root_ != &glatter_registry_v1) { \
+            glatter_root_->call; \
+            return; \
+        } \
+    } while (0)
+/* The root's instance of a piece of state that is shared by address. */
+#define GLATTER_REGISTRY_SHARED(field, own) (glatter_registry_root_()->field)
+
+/* The root's record of 'family', if this instance may use its table and caches. */
+#define GLATTER_REGISTRY_FAMILY(family) \
+    glatter_registry_shared_family_(GLATTER_REGISTRY_##family, GLATTER_FN_COUNT_##family, GLATTER_FN_LAYOUT_##family)
+
+static inline glatter_registry_family* glatter_registry_shared_family_(int family, uint32_t count, uint32_t layout)
+{
+    glatter_registry* root = glatter_registry_root_();
+    if (root == &glatter_registry_v1) {
+        return NULL;
+    }
+    glatter_registry_family* f = &root->families[family];
+    return (f->count == count && f->layout == layout) ? f : NULL;
+}
+
+#define GLATTER_REGISTRY_FORWARD_EXTENSIONS(family) \
+    do { \
+        glatter_registry_family* glatter_family_ = GLATTER_REGISTRY_FAMILY(family); \
+        if (glatter_family_ && glatter_family_->extension_support) { \
+            typedef const glatter_extension_support_status_##family##_t* (*glatter_support_fn_)(void); \
+            return ((glatter_support_fn_)glatter_family_->extension_support)(); \
+        } \
+    } while (0)
+#define GLATTER_REGISTRY_FORWARD_INVALIDATE(family) \
+    do { \
+        glatter_registry_family* glatter_family_ = GLATTER_REGISTRY_FAMILY(family); \
+        if (glatter_family_ && glatter_family_->invalidate_extensions) { \
+            glatter_family_->invalidate_extensions(); \
+        } \
+    } while (0)
+
+#else
+#define GLATTER_REGISTRY_FORWARD(call)
+#define GLATTER_REGISTRY_FORWARD_VOID(call)
+#define GLATTER_REGISTRY_SHARED(field, own) (&(own))
+#define GLATTER_REGISTRY_FORWARD_EXTENSIONS(family)
+#define GLATTER_REGISTRY_FORWARD_INVALIDATE(family)
+#endif
+
 GLATTER_INLINE_OR_NOT
 void glatter_log_handler_store(glatter_log_handler_fn handler_ptr)
 {
-    GLATTER_ATOMIC_STORE(glatter_log_handler_state, handler_ptr);
+    GLATTER_ATOMIC_STORE(*GLATTER_REGISTRY_SHARED(log_handler, glatter_log_handler_state), handler_ptr);
 }
 
 GLATTER_INLINE_OR_NOT
 glatter_log_handler_fn glatter_log_handler_load(void)
 {
-    return (glatter_log_handler_fn)GLATTER_ATOMIC_LOAD(glatter_log_handler_state);
+    return (glatter_log_handler_fn)GLATTER_ATOMIC_LOAD(
+        *GLATTER_REGISTRY_SHARED(log_handler, glatter_log_handler_state));
 }
 
 
@@ -252,7 +458,7 @@ const char* glatter_log(const char* str)
 }
 
 
-GLATTER_INLINE_OR_NOT
+GLATTER_INLINE_OR_NOT GLATTER_COLD
 void glatter_log_printf(const char* fmt, ...)
 {
     char buffer[2048];
@@ -288,6 +494,7 @@ void glatter_log_printf(const char* fmt, ...)
 GLATTER_INLINE_OR_NOT
 void glatter_set_log_handler(void(*handler_ptr)(const char*))
 {
+    GLATTER_REGISTRY_FORWARD_VOID(set_log_handler(handler_ptr));
     if (handler_ptr == NULL) {
         handler_ptr = glatter_default_log_handler;
     }
@@ -339,10 +546,13 @@ typedef int glatter_wsi_t;
  *               latch README.md documents at "first successful resolution";
  *               configuration is immutable from here on. A failed first attempt
  *               returns the phase to CONFIGURABLE, because nothing latched.
+ * CONTENDED:    DECIDING, and a thread is blocked waiting for the outcome, so
+ *               the owner has to wake it when it publishes one (POSIX only).
  */
 #define GLATTER_PHASE_CONFIGURABLE 0
 #define GLATTER_PHASE_DECIDING     1
 #define GLATTER_PHASE_RESOLVED     2
+#define GLATTER_PHASE_CONTENDED    3
 
 #ifndef GLATTER_WSI_AUTO_VALUE
 #define GLATTER_WSI_AUTO_VALUE 0
@@ -366,12 +576,18 @@ static const char* const glatter_windows_gles_names[GLATTER_WINDOWS_GLES_MODULE_
 };
 #else
 #define GLATTER_GL_SONAME_COUNT 2
+#define GLATTER_GLVND_SONAME_COUNT 2
 #define GLATTER_EGL_SONAME_COUNT 2
 #define GLATTER_GLES_SONAME_COUNT 8
 static const char* const glatter_gl_sonames[GLATTER_GL_SONAME_COUNT] = {
     "libGL.so.1",
     "libGL.so"
 };
+/* GLVND splits libGL into the GL API and the GLX WSI; both are needed. */
+static const char* const glatter_glvnd_sonames[GLATTER_GLVND_SONAME_COUNT] = {
+    "libOpenGL.so.0",
+    "libGLX.so.0"
+};
 static const char* const glatter_egl_sonames[GLATTER_EGL_SONAME_COUNT] = {
     "libEGL.so.1",
     "libEGL.so"
@@ -388,6 +604,13 @@ static const char* const glatter_gles_sonames[GLATTER_GLES_SONAME_COUNT] = {
 };
 #endif
 
+#if !defined(_WIN32)
+/* Layers beyond this many in GLATTER_LAYERS are not loaded. */
+#ifndef GLATTER_MAX_LAYERS
+#define GLATTER_MAX_LAYERS 16
+#endif
+#endif
+
 typedef struct glatter_loader_state {
     /* The phase owns every WSI field below it: they are written only by the
      * thread holding GLATTER_PHASE_DECIDING, so no thread can observe a
@@ -398,6 +621,9 @@ typedef struct glatter_loader_state {
     glatter_atomic_int active;       /* GLATTER_WSI_* enum values */
     glatter_atomic_int wsi_explicit; /* 0/1 */
     glatter_atomic_int env_checked;
+    /* Set by glatter_set_proc_address_provider; replaces the WSI loaders. */
+    glatter_atomic(glatter_proc_address_provider_fn) provider;
+    glatter_atomic(void*) provider_data;
 #if defined(_WIN32)
     HMODULE opengl32_module;
     HMODULE egl_module;
@@ -409,10 +635,23 @@ typedef struct glatter_loader_state {
      * dlclose/FreeLibrary to avoid driver/layer teardown side effects.
      */
     void* gl_handles[GLATTER_GL_SONAME_COUNT];
+    void* glvnd_handles[GLATTER_GLVND_SONAME_COUNT];
+    int   glvnd; /* GL and GLX come from glvnd_handles rather than gl_handles */
     void* egl_handles[GLATTER_EGL_SONAME_COUNT];
     void* gles_handles[GLATTER_GLES_SONAME_COUNT];
     void* (*glx_get_proc)(const GLubyte*);
     void* (*egl_get_proc)(const char*);
+    /* Loading policy. Written by glatter_set_library_path/_dlopen_policy and
+     * read when the libraries are opened, both while holding the phase. */
+    char* library_paths[GLATTER_LIBRARY_COUNT]; /* heap copies; NULL probes the sonames */
+    int   dlopen_policy;                        /* GLATTER_DLOPEN_* bits, -1 until set */
+    int   libraries_opened;
+    /* GLATTER_LAYERS tables, outermost first. Loaded once while holding the
+     * phase and only read after it. */
+    const glatter_layer_entry_t* layers[GLATTER_MAX_LAYERS];
+    glatter_atomic_int* layer_bound[GLATTER_MAX_LAYERS]; /* per entry, see glatter_bind_layer_entry_ */
+    int   layer_count;
+    int   layers_loaded;
 #endif
 #if defined(GLATTER_GLX) && !defined(GLATTER_DO_NOT_INSTALL_X_ERROR_HANDLER)
     /* Atomic to avoid redundant installs/logs when multiple threads first-touch GLX. */
@@ -446,6 +685,8 @@ GLATTER_LINKONCE glatter_loader_state glatter_loader_state_singleton = {
         GLATTER_ATOMIC_INT_INIT(0),
 #endif
         /* env_checked */ GLATTER_ATOMIC_INT_INIT(0),
+        /* provider */ GLATTER_ATOMIC_INIT_PTR(NULL),
+        /* provider_data */ GLATTER_ATOMIC_INIT_PTR(NULL),
 #if defined(_WIN32)
         /* opengl32_module */ NULL,
         /* egl_module */ NULL,
@@ -454,10 +695,19 @@ GLATTER_LINKONCE glatter_loader_state glatter_loader_state_singleton = {
         /* egl_get_proc */ NULL,
 #else
         /* gl_handles */ { NULL },
+        /* glvnd_handles */ { NULL },
+        /* glvnd */ 0,
         /* egl_handles */ { NULL },
         /* gles_handles */ { NULL },
         /* glx_get_proc */ NULL,
         /* egl_get_proc */ NULL,
+        /* library_paths */ { NULL },
+        /* dlopen_policy */ -1,
+        /* libraries_opened */ 0,
+        /* layers */ { NULL },
+        /* layer_bound */ { NULL },
+        /* layer_count */ 0,
+        /* layers_loaded */ 0,
 #endif
 #if defined(GLATTER_GLX) && !defined(GLATTER_DO_NOT_INSTALL_X_ERROR_HANDLER)
         /* glx_error_handler_installed */ GLATTER_ATOMIC_INT_INIT(0)
@@ -469,9 +719,16 @@ static glatter_loader_state* glatter_loader_state_get(void)
     return &glatter_loader_state_singleton;
 }
 
+/* Generation of the negative cache. An entry point that failed to resolve
+ * records the generation it failed in, and is not looked up again while that
+ * generation is current. glatter_reset_missing_entry_points starts a new one.
+ * It starts at 1 so that a zero-initialised record never matches. */
+GLATTER_LINKONCE glatter_atomic_int glatter_missing_generation = GLATTER_ATOMIC_INT_INIT(1);
+
 /* Turn counts at which the configuration wait escalates: up to the first it
  * only hints to the CPU, up to the second it also offers the core to any other
- * runnable thread, and past it the waiter sleeps. */
+ * runnable thread, and past it the waiter sleeps. A POSIX configuration waiter
+ * blocks instead, once past the first (see glatter_configuration_enter_). */
 #define GLATTER_CONFIGURATION_SPIN_HINT_TURNS    64u
 #define GLATTER_CONFIGURATION_SPIN_YIELD_TURNS 1024u
 
@@ -535,6 +792,93 @@ static void glatter_configuration_wait_(unsigned turn)
 #endif
 }
 
+/* Counters of glatter_get_configuration_stats(). Only waiters update them, so
+ * the uncontended path never touches them. They are pointer sized, so on a
+ * 32-bit target the blocked time wraps after about four seconds. */
+typedef struct glatter_configuration_counters {
+    glatter_atomic(uintptr_t) waits;
+    glatter_atomic(uintptr_t) spins;
+    glatter_atomic(uintptr_t) blocks;
+    glatter_atomic(uintptr_t) blocked_ns;
+} glatter_configuration_counters;
+
+GLATTER_LINKONCE glatter_configuration_counters glatter_configuration_counters_state = {
+    GLATTER_ATOMIC_INIT_PTR(0),
+    GLATTER_ATOMIC_INIT_PTR(0),
+    GLATTER_ATOMIC_INIT_PTR(0),
+    GLATTER_ATOMIC_INIT_PTR(0)
+};
+
+static void glatter_counter_add_(glatter_atomic(uintptr_t)* counter, uintptr_t amount)
+{
+    for (;;) {
+        uintptr_t old = (uintptr_t)GLATTER_ATOMIC_LOAD(*counter);
+        if (GLATTER_ATOMIC_CAS(*counter, old, old + amount)) {
+            return;
+        }
+    }
+}
+
+/* Monotonic nanoseconds, for the blocked time only. A consumer that compiles
+ * this header as strict ISO C gets no CLOCK_MONOTONIC, and no blocked time. */
+static uint64_t glatter_configuration_clock_(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER now, frequency;
+    QueryPerformanceCounter(&now);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)now.QuadPart * 1e9 / (double)frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+#if !defined(_WIN32)
+/* Where POSIX waiters block. The condition variable parks them in the kernel
+ * (on a futex with glibc and musl) until the owner broadcasts, so they neither
+ * burn a core across the library loads nor oversleep the outcome. */
+GLATTER_LINKONCE pthread_mutex_t glatter_configuration_mutex = PTHREAD_MUTEX_INITIALIZER;
+GLATTER_LINKONCE pthread_cond_t  glatter_configuration_cond  = PTHREAD_COND_INITIALIZER;
+
+/* Block until the deciding thread publishes its outcome. The waiter marks the
+ * phase CONTENDED under the mutex, and the owner broadcasts under the same
+ * mutex after replacing the mark, so the wakeup cannot fall between the check
+ * and the wait. A waiter that finds the outcome already published returns at
+ * once. */
+static void glatter_configuration_block_(glatter_loader_state* state)
+{
+    pthread_mutex_lock(&glatter_configuration_mutex);
+    for (;;) {
+        int phase = GLATTER_ATOMIC_INT_LOAD(state->phase);
+        if (phase == GLATTER_PHASE_DECIDING) {
+            int expected = GLATTER_PHASE_DECIDING;
+            if (!GLATTER_ATOMIC_INT_CAS(state->phase, expected, GLATTER_PHASE_CONTENDED)) {
+                continue;
+            }
+        }
+        else
+        if (phase != GLATTER_PHASE_CONTENDED) {
+            break;
+        }
+        pthread_cond_wait(&glatter_configuration_cond, &glatter_configuration_mutex);
+    }
+    pthread_mutex_unlock(&glatter_configuration_mutex);
+}
+#endif
+
+static GLATTER_COLD void glatter_configuration_account_(unsigned turns, uint64_t began)
+{
+    glatter_configuration_counters* counters = &glatter_configuration_counters_state;
+    glatter_counter_add_(&counters->waits, 1);
+    glatter_counter_add_(&counters->spins, turns < GLATTER_CONFIGURATION_SPIN_HINT_TURNS
+        ? turns : GLATTER_CONFIGURATION_SPIN_HINT_TURNS);
+    glatter_counter_add_(&counters->blocked_ns, (uintptr_t)(glatter_configuration_clock_() - began));
+}
+
 /* Take exclusive ownership of the process configuration.
  *
  * Returns 1 when the caller now owns it and must release it with
@@ -545,28 +889,54 @@ static void glatter_configuration_wait_(unsigned turn)
  */
 static int glatter_configuration_enter_(glatter_loader_state* state)
 {
+    uint64_t began = 0;
     for (unsigned turn = 0; ; ++turn) {
         int phase = GLATTER_ATOMIC_INT_LOAD(state->phase);
-        if (phase == GLATTER_PHASE_RESOLVED) {
-            return 0;
-        }
+        int owned = 0;
         if (phase == GLATTER_PHASE_CONFIGURABLE) {
             int expected = GLATTER_PHASE_CONFIGURABLE;
-            if (GLATTER_ATOMIC_INT_CAS(state->phase, expected, GLATTER_PHASE_DECIDING)) {
-                return 1;
+            owned = GLATTER_ATOMIC_INT_CAS(state->phase, expected, GLATTER_PHASE_DECIDING);
+        }
+        if (owned || phase == GLATTER_PHASE_RESOLVED) {
+            if (turn) {
+                glatter_configuration_account_(turn, began);
             }
+            return owned;
+        }
+        /* Another thread is deciding; wait until it publishes an outcome.
+         * Past the spinning turns a POSIX waiter blocks until it is woken with
+         * it, rather than burn a core across the library loads or oversleep. */
+        if (!turn) {
+            began = glatter_configuration_clock_();
+        }
+        if (turn >= GLATTER_CONFIGURATION_SPIN_HINT_TURNS) {
+            glatter_counter_add_(&glatter_configuration_counters_state.blocks, 1);
+#if !defined(_WIN32)
+            glatter_configuration_block_(state);
+            continue;
+#endif
         }
-        /* Another thread is deciding; wait until it publishes an outcome. */
         glatter_configuration_wait_(turn);
     }
 }
 
 /* Release the configuration. `resolved` latches it permanently; anything else
- * reopens it, because nothing resolved and no entry point is bound to a WSI. */
+ * reopens it, because nothing resolved and no entry point is bound to a WSI.
+ * Waiters that blocked are woken to see the outcome. */
 static void glatter_configuration_leave_(glatter_loader_state* state, int resolved)
 {
-    GLATTER_ATOMIC_INT_STORE(state->phase,
-        resolved ? GLATTER_PHASE_RESOLVED : GLATTER_PHASE_CONFIGURABLE);
+    int outcome = resolved ? GLATTER_PHASE_RESOLVED : GLATTER_PHASE_CONFIGURABLE;
+    int phase = GLATTER_ATOMIC_INT_LOAD(state->phase);
+    while (!GLATTER_ATOMIC_INT_CAS(state->phase, phase, outcome)) {
+        phase = GLATTER_ATOMIC_INT_LOAD(state->phase);
+    }
+#if !defined(_WIN32)
+    if (phase == GLATTER_PHASE_CONTENDED) {
+        pthread_mutex_lock(&glatter_configuration_mutex);
+        pthread_cond_broadcast(&glatter_configuration_cond);
+        pthread_mutex_unlock(&glatter_configuration_mutex);
+    }
+#endif
 }
 
 static int glatter_equals_ignore_case(const char* a, const char* b)
@@ -792,6 +1162,9 @@ static void* glatter_linux_lookup_glx(glatter_loader_state* state, const char* n
         }
     }
 
+    if (state->glvnd) {
+        return glatter_linux_lookup_in_handles(state->glvnd_handles, GLATTER_GLVND_SONAME_COUNT, name);
+    }
     return glatter_linux_lookup_in_handles(state->gl_handles, GLATTER_GL_SONAME_COUNT, name);
 }
 
@@ -819,26 +1192,117 @@ static void* glatter_linux_lookup_egl(glatter_loader_state* state, const char* n
     return NULL;
 }
 
-static void glatter_init_posix_loader_once(void)
+/* GLATTER_DLOPEN: a list of "lazy", "now" and "noload" separated by commas. */
+static int glatter_dlopen_policy_from_env_(void)
 {
-    glatter_loader_state* state = glatter_loader_state_get();
-    
-    for (size_t i = 0; i < GLATTER_GL_SONAME_COUNT; ++i) {
-        if (!state->gl_handles[i]) {
-            state->gl_handles[i] = dlopen(glatter_gl_sonames[i], RTLD_LAZY | RTLD_LOCAL);
+    const char* env = getenv("GLATTER_DLOPEN");
+    int policy = GLATTER_DLOPEN_LAZY;
+    while (env && *env) {
+        char token[16];
+        size_t n = 0;
+        while (*env && *env != ',') {
+            if (n + 1 < sizeof(token)) {
+                token[n++] = *env;
+            }
+            ++env;
+        }
+        token[n] = '\0';
+        if (*env == ',') {
+            ++env;
+        }
+
+        if (glatter_equals_ignore_case(token, "now")) {
+            policy |= GLATTER_DLOPEN_NOW;
+        }
+        else
+        if (glatter_equals_ignore_case(token, "lazy")) {
+            policy &= ~GLATTER_DLOPEN_NOW;
+        }
+        else
+        if (glatter_equals_ignore_case(token, "noload")) {
+            policy |= GLATTER_DLOPEN_NOLOAD;
         }
     }
-    for (size_t i = 0; i < GLATTER_EGL_SONAME_COUNT; ++i) {
-        if (!state->egl_handles[i]) {
-            state->egl_handles[i] = dlopen(glatter_egl_sonames[i], RTLD_LAZY | RTLD_LOCAL);
+    return policy;
+}
+
+/* A pinned library path from the API, else from the environment. The
+ * environment is not trusted in a set-id process: it would let the invoking
+ * user choose a library for a more privileged one to run. */
+static const char* glatter_library_path_(glatter_loader_state* state, int library, const char* env_name)
+{
+    if (state->library_paths[library]) {
+        return state->library_paths[library];
+    }
+    if (getuid() != geteuid() || getgid() != getegid()) {
+        return NULL;
+    }
+    const char* env = getenv(env_name);
+    return (env && *env) ? env : NULL;
+}
+
+/* Open a pinned path alone, or else every candidate soname. */
+static void glatter_open_libraries_(void** handles, const char* const* sonames, size_t count,
+    const char* pinned, int policy)
+{
+    int mode = ((policy & GLATTER_DLOPEN_NOW) ? RTLD_NOW : RTLD_LAZY) | RTLD_LOCAL;
+#if defined(RTLD_NOLOAD)
+    if (policy & GLATTER_DLOPEN_NOLOAD) {
+        mode |= RTLD_NOLOAD; /* only reuse what the process already mapped */
+    }
+#endif
+
+    if (pinned) {
+        if (!handles[0]) {
+            handles[0] = dlopen(pinned, mode);
+            if (!handles[0]) {
+                const char* reason = dlerror();
+                glatter_log_printf("GLATTER: could not open '%s': %s\n", pinned, reason ? reason : "unknown error");
+            }
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!handles[i]) {
+            handles[i] = dlopen(sonames[i], mode);
         }
     }
+}
+
+static void glatter_init_posix_loader_once(void)
+{
+    glatter_loader_state* state = glatter_loader_state_get();
+    state->libraries_opened = 1;
+    if (state->dlopen_policy < 0) {
+        state->dlopen_policy = glatter_dlopen_policy_from_env_();
+    }
 
-    for (size_t i = 0; i < GLATTER_GL_SONAME_COUNT; ++i) {
-        if (state->gl_handles[i]) {
-            void* proc = dlsym(state->gl_handles[i], "glXGetProcAddressARB");
+    /* Prefer GLVND's libOpenGL and libGLX, which skip the dispatch layer of its
+     * libGL compatibility library, unless a GL library was pinned. Where either
+     * is missing, this is not a GLVND system and libGL is all there is. */
+    const char* pinned_gl = glatter_library_path_(state, GLATTER_LIBRARY_GL, "GLATTER_GL_LIBRARY");
+#if !defined(GLATTER_NO_GLVND)
+    if (!pinned_gl) {
+        glatter_open_libraries_(state->glvnd_handles, glatter_glvnd_sonames, GLATTER_GLVND_SONAME_COUNT,
+            NULL, state->dlopen_policy);
+        state->glvnd = state->glvnd_handles[0] && state->glvnd_handles[1];
+    }
+#endif
+    if (!state->glvnd) {
+        glatter_open_libraries_(state->gl_handles, glatter_gl_sonames, GLATTER_GL_SONAME_COUNT,
+            pinned_gl, state->dlopen_policy);
+    }
+    glatter_open_libraries_(state->egl_handles, glatter_egl_sonames, GLATTER_EGL_SONAME_COUNT,
+        glatter_library_path_(state, GLATTER_LIBRARY_EGL, "GLATTER_EGL_LIBRARY"), state->dlopen_policy);
+
+    void** gl_handles = state->glvnd ? state->glvnd_handles : state->gl_handles;
+    size_t gl_count   = state->glvnd ? GLATTER_GLVND_SONAME_COUNT : GLATTER_GL_SONAME_COUNT;
+    for (size_t i = 0; i < gl_count; ++i) {
+        if (gl_handles[i]) {
+            void* proc = dlsym(gl_handles[i], "glXGetProcAddressARB");
             if (!proc)
-                proc = dlsym(state->gl_handles[i], "glXGetProcAddress");
+                proc = dlsym(gl_handles[i], "glXGetProcAddress");
             if (proc) {
                state->glx_get_proc = (void* (*)(const GLubyte*))proc;
                 break;
@@ -859,25 +1323,24 @@ static void glatter_init_posix_loader_once(void)
 static void glatter_init_gles_loader_once(void)
 {
     glatter_loader_state* state = glatter_loader_state_get();
-    for (size_t i = 0; i < GLATTER_GLES_SONAME_COUNT; ++i) {
-        if (!state->gles_handles[i]) {
-            state->gles_handles[i] = dlopen(glatter_gles_sonames[i], RTLD_LAZY | RTLD_LOCAL);
-        }
-    }
+    glatter_open_libraries_(state->gles_handles, glatter_gles_sonames, GLATTER_GLES_SONAME_COUNT,
+        glatter_library_path_(state, GLATTER_LIBRARY_GLES, "GLATTER_GLES_LIBRARY"), state->dlopen_policy);
 }
 
 static int glatter_posix_probe_glx_(void)
 {
     pthread_once(&glatter_posix_loader_once, glatter_init_posix_loader_once);
     glatter_loader_state* state = glatter_loader_state_get();
-    for (size_t i = 0; i < GLATTER_GL_SONAME_COUNT; ++i) {
-        if (!state->gl_handles[i]) {
+    void** gl_handles = state->glvnd ? state->glvnd_handles : state->gl_handles;
+    size_t gl_count   = state->glvnd ? GLATTER_GLVND_SONAME_COUNT : GLATTER_GL_SONAME_COUNT;
+    for (size_t i = 0; i < gl_count; ++i) {
+        if (!gl_handles[i]) {
             continue;
         }
         // If any of the key symbols are found, we have GLX support. Return immediately.
-        if (dlsym(state->gl_handles[i], "glXGetProcAddressARB") ||
-            dlsym(state->gl_handles[i], "glXGetProcAddress")    ||
-            dlsym(state->gl_handles[i], "glXCreateContext"))
+        if (dlsym(gl_handles[i], "glXGetProcAddressARB") ||
+            dlsym(gl_handles[i], "glXGetProcAddress")    ||
+            dlsym(gl_handles[i], "glXCreateContext"))
         {
             return 1; // Found
         }
@@ -1003,6 +1466,7 @@ static void glatter_detect_wsi_from_env(glatter_loader_state* state)
 GLATTER_INLINE_OR_NOT
 void glatter_set_wsi(int wsi)
 {
+    GLATTER_REGISTRY_FORWARD_VOID(set_wsi(wsi));
     glatter_loader_state* state = glatter_loader_state_get();
     glatter_wsi_t value = (glatter_wsi_t)wsi;
     switch (value) {
@@ -1032,9 +1496,116 @@ void glatter_set_wsi(int wsi)
     glatter_configuration_leave_(state, 0);
 }
 
+/* Install the function that resolves entry points in place of glatter's own
+ * loaders, e.g. the windowing toolkit's GetProcAddress. Like the WSI, it can
+ * only change until the first successful resolution; NULL removes it. */
+GLATTER_INLINE_OR_NOT
+int glatter_set_proc_address_provider(glatter_proc_address_provider_fn provider, void* user_data)
+{
+    GLATTER_REGISTRY_FORWARD(set_proc_address_provider(provider, user_data));
+    glatter_loader_state* state = glatter_loader_state_get();
+    if (!glatter_configuration_enter_(state)) {
+        glatter_log(
+            "GLATTER: glatter_set_proc_address_provider() ignored; the WSI was latched at the first successful resolution.\n");
+        return 0;
+    }
+
+    GLATTER_ATOMIC_STORE(state->provider_data, user_data);
+    GLATTER_ATOMIC_STORE(state->provider, provider);
+    glatter_configuration_leave_(state, 0);
+    return 1;
+}
+
+/* Shared prologue of the loading policy setters: takes the phase and returns
+ * 1 if the libraries have not been opened yet, so the policy can still apply. */
+static int glatter_loading_policy_enter_(glatter_loader_state* state, const char* what)
+{
+#if defined(_WIN32)
+    (void)state;
+    glatter_log_printf("GLATTER: %s() ignored; Windows loads its modules from System32.\n", what);
+    return 0;
+#else
+    if (!glatter_configuration_enter_(state)) {
+        glatter_log_printf("GLATTER: %s() ignored; the WSI was latched at the first successful resolution.\n", what);
+        return 0;
+    }
+    if (state->libraries_opened) {
+        glatter_configuration_leave_(state, 0);
+        glatter_log_printf("GLATTER: %s() ignored; the libraries are already open.\n", what);
+        return 0;
+    }
+    return 1;
+#endif
+}
+
+GLATTER_INLINE_OR_NOT
+int glatter_set_library_path(int library, const char* path)
+{
+    GLATTER_REGISTRY_FORWARD(set_library_path(library, path));
+    if (library < 0 || library >= GLATTER_LIBRARY_COUNT) {
+        return 0;
+    }
+
+    glatter_loader_state* state = glatter_loader_state_get();
+    if (!glatter_loading_policy_enter_(state, "glatter_set_library_path")) {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    (void)path;
+    return 0;
+#else
+    char* copy = NULL;
+    if (path) {
+        size_t size = strlen(path) + 1;
+        copy = (char*)malloc(size);
+        if (!copy) {
+            glatter_configuration_leave_(state, 0);
+            return 0;
+        }
+        memcpy(copy, path, size);
+    }
+    free(state->library_paths[library]);
+    state->library_paths[library] = copy;
+    glatter_configuration_leave_(state, 0);
+    return 1;
+#endif
+}
+
+GLATTER_INLINE_OR_NOT
+int glatter_set_dlopen_policy(int policy)
+{
+    GLATTER_REGISTRY_FORWARD(set_dlopen_policy(policy));
+    glatter_loader_state* state = glatter_loader_state_get();
+    if (!glatter_loading_policy_enter_(state, "glatter_set_dlopen_policy")) {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    (void)policy;
+    return 0;
+#else
+    state->dlopen_policy = policy & (GLATTER_DLOPEN_NOW | GLATTER_DLOPEN_NOLOAD);
+    glatter_configuration_leave_(state, 0);
+    return 1;
+#endif
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_get_configuration_stats(glatter_configuration_stats_t* stats)
+{
+    GLATTER_REGISTRY_FORWARD_VOID(get_configuration_stats(stats));
+    glatter_configuration_counters* counters = &glatter_configuration_counters_state;
+    stats->waits      = (uint64_t)(uintptr_t)GLATTER_ATOMIC_LOAD(counters->waits);
+    stats->spins      = (uint64_t)(uintptr_t)GLATTER_ATOMIC_LOAD(counters->spins);
+    stats->blocks     = (uint64_t)(uintptr_t)GLATTER_ATOMIC_LOAD(counters->blocks);
+    stats->blocked_ns = (uint64_t)(uintptr_t)GLATTER_ATOMIC_LOAD(counters->blocked_ns);
+}
+
 GLATTER_INLINE_OR_NOT
 int glatter_get_wsi(void)
 {
+    GLATTER_REGISTRY_FORWARD(get_wsi());
     glatter_loader_state* state = glatter_loader_state_get();
     if (glatter_configuration_enter_(state)) {
         glatter_detect_wsi_from_env(state);
@@ -1048,10 +1619,132 @@ int glatter_get_wsi(void)
     return GLATTER_ATOMIC_INT_LOAD(state->requested);
 }
 
-/* Resolve through one decided WSI. AUTO has no provider of its own, so it is
- * handled by the probe loop in glatter_resolve_first_ instead. */
-static void* glatter_resolve_through_(glatter_loader_state* state, int wsi, const char* function_name)
+#if !defined(_WIN32)
+/* GLATTER_LAYERS: shared objects separated by colons, each exporting a
+ * glatter_layer_v1 table. The first one listed is called first. Like the
+ * library paths, the variable is not trusted in a set-id process. */
+static void glatter_load_layers_(glatter_loader_state* state)
+{
+    if (state->layers_loaded) {
+        return;
+    }
+    state->layers_loaded = 1;
+    if (getuid() != geteuid() || getgid() != getegid()) {
+        return;
+    }
+
+    const char* env = getenv("GLATTER_LAYERS");
+    while (env && *env) {
+        const char* name = env;
+        size_t n = strcspn(env, ":");
+        env += n;
+        if (*env == ':') {
+            ++env;
+        }
+        if (n == 0) {
+            continue;
+        }
+        char* path = (char*)malloc(n + 1);
+        if (!path) {
+            break;
+        }
+        memcpy(path, name, n);
+        path[n] = '\0';
+
+        if (state->layer_count == GLATTER_MAX_LAYERS) {
+            glatter_log_printf("GLATTER: layer '%s' not loaded; GLATTER_MAX_LAYERS is %d.\n", path, GLATTER_MAX_LAYERS);
+            free(path);
+            break;
+        }
+        /* Like the driver, a layer stays loaded for the process lifetime. */
+        void* handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        const glatter_layer_entry_t* table =
+            handle ? (const glatter_layer_entry_t*)dlsym(handle, "glatter_layer_v1") : NULL;
+        size_t entries = 0;
+        while (table && table[entries].name) {
+            ++entries;
+        }
+        glatter_atomic_int* bound = table
+            ? (glatter_atomic_int*)calloc(entries ? entries : 1, sizeof(glatter_atomic_int)) : NULL;
+        if (bound) {
+            state->layers[state->layer_count] = table;
+            state->layer_bound[state->layer_count++] = bound;
+        }
+        else if (table) {
+            glatter_log_printf("GLATTER: layer '%s' not loaded; out of memory.\n", path);
+        }
+        else {
+            const char* reason = dlerror();
+            glatter_log_printf("GLATTER: could not load layer '%s': %s\n", path, reason ? reason : "unknown error");
+        }
+        free(path);
+    }
+}
+
+/* Tells a layer entry what to call on, the first time its name is resolved.
+ * 'next' is then never written again, since the layer may be calling through
+ * it on another thread. 'bound' goes from 0 to 1 while it is written, to 2
+ * once it is, and to 3 once the entry has been bypassed, which is logged the
+ * first time. Returns whether the entry calls on 'ptr'. */
+static int glatter_bind_layer_entry_(glatter_atomic_int* bound, const glatter_layer_entry_t* entry, void* ptr)
+{
+    int expected = 0;
+    if (GLATTER_ATOMIC_INT_CAS(*bound, expected, 1)) {
+        *entry->next = ptr;
+        GLATTER_ATOMIC_INT_STORE(*bound, 2);
+        return 1;
+    }
+    for (unsigned turn = 0; GLATTER_ATOMIC_INT_LOAD(*bound) == 1; ++turn) {
+        glatter_configuration_wait_(turn);
+    }
+    if (*entry->next == ptr) {
+        return 1;
+    }
+    expected = 2;
+    if (GLATTER_ATOMIC_INT_CAS(*bound, expected, 3)) {
+        glatter_log_printf(
+            "GLATTER: '%s' resolved to another address than its layer calls on; the layer is bypassed there.\n",
+            entry->name);
+    }
+    return 0;
+}
+
+/* Puts the layers that intercept a name in front of its driver entry point,
+ * innermost first: each one is told what to call on and takes its place.
+ * Every other name keeps the driver's address, so layers cost nothing on the
+ * entry points they leave alone. A name is bound to the first entry point it
+ * resolves to, normally through the process WSI while the phase is held; a
+ * later lookup that yields another one, through another WSI or for another
+ * context's dispatch table, gets it without the layers from there outwards,
+ * and each bypassed layer entry logs that once. */
+static void* glatter_apply_layers_(glatter_loader_state* state, const char* function_name, void* ptr)
+{
+    for (int i = state->layer_count; ptr && i-- > 0; ) {
+        const glatter_layer_entry_t* entry = state->layers[i];
+        for (size_t j = 0; entry[j].name; ++j) {
+            if (strcmp(entry[j].name, function_name) == 0) {
+                if (!glatter_bind_layer_entry_(&state->layer_bound[i][j], &entry[j], ptr)) {
+                    return ptr;
+                }
+                ptr = entry[j].function;
+                break;
+            }
+        }
+    }
+    return ptr;
+}
+#endif
+
+/* The driver's entry point, through one decided WSI. An application provider
+ * takes the place of every WSI. */
+static void* glatter_resolve_driver_(glatter_loader_state* state, int wsi, const char* function_name)
 {
+    glatter_proc_address_provider_fn provider =
+        (glatter_proc_address_provider_fn)GLATTER_ATOMIC_LOAD(state->provider);
+    if (provider) {
+        return provider(function_name, GLATTER_ATOMIC_LOAD(state->provider_data));
+    }
+
     switch (wsi) {
 #if defined(_WIN32)
         case GLATTER_WSI_WGL_VALUE: return glatter_windows_resolve_wgl(state, function_name);
@@ -1064,6 +1757,18 @@ static void* glatter_resolve_through_(glatter_loader_state* state, int wsi, cons
     }
 }
 
+/* Resolve through one decided WSI, with the layers in front. AUTO has no
+ * provider of its own, so it is handled by the probe loop in
+ * glatter_resolve_first_ instead. */
+static void* glatter_resolve_through_(glatter_loader_state* state, int wsi, const char* function_name)
+{
+    void* ptr = glatter_resolve_driver_(state, wsi, function_name);
+#if !defined(_WIN32)
+    ptr = glatter_apply_layers_(state, function_name, ptr);
+#endif
+    return ptr;
+}
+
 /* The first resolution attempt, run by the thread holding the configuration
  * phase. On success it publishes the WSI that produced the pointer, which is
  * what the caller latches. */
@@ -1080,7 +1785,7 @@ static void* glatter_resolve_first_(glatter_loader_state* state, const char* fun
     };
 
     int requested = GLATTER_ATOMIC_INT_LOAD(state->requested);
-    if (requested != GLATTER_WSI_AUTO_VALUE) {
+    if (requested != GLATTER_WSI_AUTO_VALUE || GLATTER_ATOMIC_LOAD(state->provider)) {
         void* ptr = glatter_resolve_through_(state, requested, function_name);
         if (ptr) {
             GLATTER_ATOMIC_INT_STORE(state->active, requested);
@@ -1101,22 +1806,425 @@ static void* glatter_resolve_first_(glatter_loader_state* state, const char* fun
     return NULL;
 }
 
-GLATTER_INLINE_OR_NOT
-void* glatter_get_proc_address(const char* function_name)
-{
-    glatter_loader_state* state = glatter_loader_state_get();
-
-    if (!glatter_configuration_enter_(state)) {
-        return glatter_resolve_through_(state, GLATTER_ATOMIC_INT_LOAD(state->active), function_name);
-    }
-
-    glatter_detect_wsi_from_env(state);
-    glatter_decide_wsi_(state);
+#include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_entry_points_def.h)
 
-    void* ptr = glatter_resolve_first_(state, function_name);
-    glatter_configuration_leave_(state, ptr != NULL);
-    return ptr;
-}
+/* The generated GL entry point list (glatter_GL_i_def.h) marks the version or
+ * extension that introduces each block of GLATTER_IBLOCKs. Only the
+ * availability probe reads the marks; everywhere else they expand to nothing. */
+#define GLATTER_IVERSION(major, minor)
+#define GLATTER_IEXTENSION(extension)
+
+#if defined(GLATTER_HEADER_ONLY)
+/* Header-only dispatch tables: one process-wide slot per entry point, at
+ * GLATTER_FN_<name>. The hot entry points come first in that order, so the
+ * slots a frame uses share a few cache lines instead of being spread over
+ * one variable per entry point and translation unit. Eager builds fill the
+ * slots before other threads call in, so they are plain pointers there. */
+#if defined(GLATTER_EAGER)
+#  define GLATTER_FN_TABLE(family) \
+    alignas(64) GLATTER_LINKONCE void* glatter_fn_table_##family[GLATTER_FN_COUNT_##family];
+#else
+#  define GLATTER_FN_TABLE(family) \
+    alignas(64) GLATTER_LINKONCE glatter_atomic(void*) glatter_fn_table_##family[GLATTER_FN_COUNT_##family];
+#endif
+#if defined(GLATTER_GL)
+GLATTER_FN_TABLE(GL)
+#endif
+#if defined(GLATTER_GLX)
+GLATTER_FN_TABLE(GLX)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+GLATTER_FN_TABLE(EGL)
+#endif
+#if defined(GLATTER_WGL)
+GLATTER_FN_TABLE(WGL)
+#endif
+#if defined(GLATTER_GLU)
+GLATTER_FN_TABLE(GLU)
+#endif
+#undef GLATTER_FN_TABLE
+
+/* With GLATTER_SHARED_REGISTRY, lazy wrappers reach their table through a
+ * pointer, which glatter_registry_join_ repoints to the root instance's table
+ * when the layouts match. */
+#if defined(GLATTER_SHARED_REGISTRY) && !defined(GLATTER_EAGER)
+#  define GLATTER_FN_SLOTS(family) \
+    GLATTER_LINKONCE glatter_atomic(void*)* glatter_fn_slots_##family = glatter_fn_table_##family;
+#  define GLATTER_FN_SLOT(family, name) (glatter_fn_slots_##family[GLATTER_FN_##name])
+#if defined(GLATTER_GL)
+GLATTER_FN_SLOTS(GL)
+#endif
+#if defined(GLATTER_GLX)
+GLATTER_FN_SLOTS(GLX)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+GLATTER_FN_SLOTS(EGL)
+#endif
+#if defined(GLATTER_WGL)
+GLATTER_FN_SLOTS(WGL)
+#endif
+#if defined(GLATTER_GLU)
+GLATTER_FN_SLOTS(GLU)
+#endif
+#undef GLATTER_FN_SLOTS
+#else
+#  define GLATTER_FN_SLOT(family, name) (glatter_fn_table_##family[GLATTER_FN_##name])
+#endif
+#endif
+
+/* ---- Address cache of glatter_get_proc_address ----
+ *
+ * Once the WSI is latched, the address of a name no longer changes, so every
+ * successful lookup is kept and later lookups of the same name skip the
+ * loader. Names known to the generator find their slot through the perfect
+ * hash in glatter_entry_points_def.h; other names go to a small open
+ * addressing table. Both are lock-free and process-wide. Misses are not
+ * cached, since a name may be probed before the extension that provides it
+ * is available.
+ *
+ * This relies on addresses not depending on the current context, which
+ * glatter already assumes when it binds an entry point on first use (see
+ * GLATTER_FBLOCK). GLATTER_CONTEXT_DISPATCH builds drop that assumption for
+ * GL and do not use the cache for it.
+ */
+
+/* Power of two. Names beyond this many unknown ones are looked up uncached. */
+#ifndef GLATTER_PROC_ADDRESS_OVERFLOW_SLOTS
+#define GLATTER_PROC_ADDRESS_OVERFLOW_SLOTS 256
+#endif
+
+GLATTER_LINKONCE glatter_atomic(void*) glatter_entry_point_cache[GLATTER_ENTRY_POINT_SLOTS];
+
+typedef struct glatter_proc_overflow_slot {
+    glatter_atomic(void*) name; /* heap copy of the name, installed once and never freed */
+    glatter_atomic(void*) proc; /* published after name; NULL while it is pending */
+} glatter_proc_overflow_slot;
+
+GLATTER_LINKONCE glatter_proc_overflow_slot glatter_proc_overflow[GLATTER_PROC_ADDRESS_OVERFLOW_SLOTS];
+
+static uint32_t glatter_entry_point_hash_(const char* function_name)
+{
+    uint32_t h = 2166136261u;
+    for (const unsigned char* p = (const unsigned char*)function_name; *p; ++p) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Must match entry_point_slot() in glatter.py. */
+static uint32_t glatter_perfect_hash_slot_(uint32_t hash, uint32_t seed, uint32_t mask)
+{
+    uint32_t x = hash ^ seed;
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return x & mask;
+}
+
+static uint32_t glatter_entry_point_slot_(uint32_t hash)
+{
+    uint32_t seed = glatter_entry_point_seeds[(hash ^ (hash >> 16)) & (GLATTER_ENTRY_POINT_BUCKETS - 1)];
+    return glatter_perfect_hash_slot_(hash, seed, GLATTER_ENTRY_POINT_SLOTS - 1);
+}
+
+static void* glatter_resolve_overflow_(glatter_loader_state* state, int wsi, const char* function_name, uint32_t hash)
+{
+    const uint32_t mask = GLATTER_PROC_ADDRESS_OVERFLOW_SLOTS - 1;
+    for (uint32_t i = 0, pos = hash & mask; i <= mask; ++i, pos = (pos + 1) & mask) {
+        glatter_proc_overflow_slot* slot = &glatter_proc_overflow[pos];
+        const char* key = (const char*)GLATTER_ATOMIC_LOAD(slot->name);
+        if (key == NULL) {
+            void* ptr = glatter_resolve_through_(state, wsi, function_name);
+            if (!ptr) {
+                return NULL;
+            }
+            size_t size = strlen(function_name) + 1;
+            char* copy = (char*)malloc(size);
+            if (!copy) {
+                return ptr;
+            }
+            memcpy(copy, function_name, size);
+            void* expected = NULL;
+            if (GLATTER_ATOMIC_CAS(slot->name, expected, (void*)copy)) {
+                GLATTER_ATOMIC_STORE(slot->proc, ptr);
+                return ptr;
+            }
+            /* Another thread claimed the slot; it may be for this very name. */
+            free(copy);
+            key = (const char*)GLATTER_ATOMIC_LOAD(slot->name);
+        }
+        if (strcmp(key, function_name) == 0) {
+            void* ptr = GLATTER_ATOMIC_LOAD(slot->proc);
+            return ptr ? ptr : glatter_resolve_through_(state, wsi, function_name);
+        }
+    }
+    return glatter_resolve_through_(state, wsi, function_name);
+}
+
+/* The lookup path once the configuration is latched. */
+static void* glatter_resolve_cached_(glatter_loader_state* state, const char* function_name)
+{
+    int wsi = GLATTER_ATOMIC_INT_LOAD(state->active);
+    uint32_t hash = glatter_entry_point_hash_(function_name);
+    uint32_t index = glatter_entry_point_slot_(hash);
+    const char* known = glatter_entry_point_names[index];
+    if (!known || strcmp(known, function_name) != 0) {
+        return glatter_resolve_overflow_(state, wsi, function_name, hash);
+    }
+
+    void* ptr = GLATTER_ATOMIC_LOAD(glatter_entry_point_cache[index]);
+    if (!ptr) {
+        ptr = glatter_resolve_through_(state, wsi, function_name);
+        if (ptr) {
+            GLATTER_ATOMIC_STORE(glatter_entry_point_cache[index], ptr);
+        }
+    }
+    return ptr;
+}
+
+GLATTER_INLINE_OR_NOT
+void* glatter_get_proc_address(const char* function_name)
+{
+    GLATTER_REGISTRY_FORWARD(get_proc_address(function_name));
+    glatter_loader_state* state = glatter_loader_state_get();
+
+    if (!glatter_configuration_enter_(state)) {
+        return glatter_resolve_cached_(state, function_name);
+    }
+
+#if !defined(_WIN32)
+    glatter_load_layers_(state);
+#endif
+    /* With a provider there is nothing to detect, probe or load. */
+    if (!GLATTER_ATOMIC_LOAD(state->provider)) {
+        glatter_detect_wsi_from_env(state);
+        glatter_decide_wsi_(state);
+    }
+
+    void* ptr = glatter_resolve_first_(state, function_name);
+    glatter_configuration_leave_(state, ptr != NULL);
+    return ptr;
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_reset_missing_entry_points(void)
+{
+    glatter_atomic_int* generation = GLATTER_REGISTRY_SHARED(missing_generation, glatter_missing_generation);
+    int oldv = GLATTER_ATOMIC_INT_LOAD(*generation);
+    for (;;) {
+        int newv = (oldv == INT_MAX) ? 1 : oldv + 1;
+        if (GLATTER_ATOMIC_INT_CAS(*generation, oldv, newv)) break;
+        oldv = GLATTER_ATOMIC_INT_LOAD(*generation);
+    }
+}
+
+/* ---- Background warm-up ----
+ *
+ * glatter_warmup_async moves the cost of the first lookups off the calling
+ * thread: a worker looks up every entry point name known to the platform,
+ * which loads the libraries, decides and latches the WSI, and fills the
+ * address cache of glatter_get_proc_address. It then fills the slots of the
+ * entry points compiled in, as glatter_init_<family>() would, so their first
+ * calls go straight to the driver. A render thread that races it goes through
+ * the same configuration phase, so the libraries are loaded and the WSI
+ * decided exactly once, whichever thread gets there first. Entry points it
+ * binds meanwhile are looked up as usual, and a slot is only filled while it
+ * still holds its initial resolver.
+ *
+ * wglGetProcAddress answers for the context current on the calling thread,
+ * and the worker has none. With WGL, the worker therefore only looks up the
+ * names that opengl32.dll exports, which need no context; a miss on any other
+ * name could otherwise latch the wrong WSI. The rest resolve on first call.
+ * GL entry points of GLATTER_CONTEXT_DISPATCH builds have no process-wide
+ * slot, and GLATTER_EAGER builds bind theirs in glatter_init_<family>(), which
+ * then finds the addresses cached.
+ */
+
+enum {
+    GLATTER_WARMUP_IDLE    = 0,
+    GLATTER_WARMUP_RUNNING = 1,
+    GLATTER_WARMUP_DONE    = 2
+};
+
+/* glatter_warmup_t in glatter.h, which compiled builds do not include here. */
+struct glatter_warmup {
+    glatter_atomic_int state; /* GLATTER_WARMUP_* */
+};
+
+GLATTER_LINKONCE struct glatter_warmup glatter_warmup_singleton = {
+    GLATTER_ATOMIC_INT_INIT(GLATTER_WARMUP_IDLE)
+};
+
+#if defined(_WIN32)
+GLATTER_LINKONCE SRWLOCK            glatter_warmup_lock = SRWLOCK_INIT;
+GLATTER_LINKONCE CONDITION_VARIABLE glatter_warmup_cond = CONDITION_VARIABLE_INIT;
+#endif
+
+/* Whether the worker may look 'name' up; see the WGL note above. */
+static int glatter_warmup_resolvable_(const char* name)
+{
+#if defined(_WIN32) && defined(GLATTER_WGL)
+    glatter_loader_state* state = glatter_loader_state_get();
+    if (GLATTER_ATOMIC_LOAD(state->provider) || glatter_get_wsi() == GLATTER_WSI_EGL_VALUE) {
+        return 1;
+    }
+    InitOnceExecuteOnce(&glatter_wgl_loader_once, glatter_init_wgl_loader_once, NULL, NULL);
+    return state->opengl32_module && GetProcAddress(state->opengl32_module, name) != NULL;
+#else
+    (void)name;
+    return 1;
+#endif
+}
+
+/* Publishes the state of the warm-up and wakes glatter_warmup_wait. POSIX
+ * waiters share the condition variable of the configuration phase, whose
+ * waiters recheck the phase when they are woken by this. */
+static void glatter_warmup_publish_(int state)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&glatter_warmup_lock);
+    GLATTER_ATOMIC_INT_STORE(glatter_warmup_singleton.state, state);
+    ReleaseSRWLockExclusive(&glatter_warmup_lock);
+    WakeAllConditionVariable(&glatter_warmup_cond);
+#else
+    pthread_mutex_lock(&glatter_configuration_mutex);
+    GLATTER_ATOMIC_INT_STORE(glatter_warmup_singleton.state, state);
+    pthread_cond_broadcast(&glatter_configuration_cond);
+    pthread_mutex_unlock(&glatter_configuration_mutex);
+#endif
+}
+
+/* Declared like the public functions, so that a header-only build only emits
+ * the worker where the warm-up is used: filling the slots references every
+ * entry point, and with them the libraries of every family. */
+GLATTER_INLINE_OR_NOT void glatter_warmup_fill_(void);
+
+GLATTER_INLINE_OR_NOT
+void glatter_warmup_run_(void)
+{
+    for (uint32_t i = 0; i < GLATTER_ENTRY_POINT_SLOTS; ++i) {
+        const char* name = glatter_entry_point_names[i];
+        if (name && glatter_warmup_resolvable_(name)) {
+            (void)glatter_get_proc_address(name);
+        }
+    }
+    glatter_warmup_fill_();
+    glatter_warmup_publish_(GLATTER_WARMUP_DONE);
+}
+
+#if defined(_WIN32)
+GLATTER_INLINE_OR_NOT
+DWORD WINAPI glatter_warmup_thread_(LPVOID param)
+{
+    (void)param;
+    glatter_warmup_run_();
+    return 0;
+}
+#else
+GLATTER_INLINE_OR_NOT
+void* glatter_warmup_thread_(void* param)
+{
+    (void)param;
+    glatter_warmup_run_();
+    return NULL;
+}
+#endif
+
+/* Starts the warm-up once per process; later calls return the same handle.
+ * Returns NULL if no worker thread could be started, in which case entry
+ * points are simply resolved on first use. Select the WSI before calling it,
+ * since the warm-up latches it. */
+GLATTER_INLINE_OR_NOT
+struct glatter_warmup* glatter_warmup_async(void)
+{
+    struct glatter_warmup* warmup = &glatter_warmup_singleton;
+    int expected = GLATTER_WARMUP_IDLE;
+    if (!GLATTER_ATOMIC_INT_CAS(warmup->state, expected, GLATTER_WARMUP_RUNNING)) {
+        return warmup;
+    }
+
+#if defined(_WIN32)
+    HANDLE thread = CreateThread(NULL, 0, glatter_warmup_thread_, NULL, 0, NULL);
+    if (thread) {
+        CloseHandle(thread);
+        return warmup;
+    }
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, glatter_warmup_thread_, NULL) == 0) {
+        pthread_detach(thread);
+        return warmup;
+    }
+#endif
+
+    glatter_warmup_publish_(GLATTER_WARMUP_IDLE);
+    glatter_log("GLATTER: could not start the warm-up thread; entry points resolve on first use.\n");
+    return NULL;
+}
+
+/* Nonzero once the warm-up has finished. */
+GLATTER_INLINE_OR_NOT
+int glatter_warmup_poll(struct glatter_warmup* warmup)
+{
+    return warmup && GLATTER_ATOMIC_INT_LOAD(warmup->state) == GLATTER_WARMUP_DONE;
+}
+
+/* Blocks until the warm-up has finished. The wait is as long as the library
+ * loads, so the caller sleeps on a condition variable rather than poll. */
+GLATTER_INLINE_OR_NOT
+void glatter_warmup_wait(struct glatter_warmup* warmup)
+{
+    if (!warmup || GLATTER_ATOMIC_INT_LOAD(warmup->state) != GLATTER_WARMUP_RUNNING) {
+        return;
+    }
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&glatter_warmup_lock);
+    while (GLATTER_ATOMIC_INT_LOAD(warmup->state) == GLATTER_WARMUP_RUNNING) {
+        SleepConditionVariableSRW(&glatter_warmup_cond, &glatter_warmup_lock, INFINITE, 0);
+    }
+    ReleaseSRWLockExclusive(&glatter_warmup_lock);
+#else
+    pthread_mutex_lock(&glatter_configuration_mutex);
+    while (GLATTER_ATOMIC_INT_LOAD(warmup->state) == GLATTER_WARMUP_RUNNING) {
+        pthread_cond_wait(&glatter_configuration_cond, &glatter_configuration_mutex);
+    }
+    pthread_mutex_unlock(&glatter_configuration_mutex);
+#endif
+}
+
+/* Nonzero if the entry point owning 'record' already failed to resolve in the
+ * current generation, in which case the caller returns zero without asking the
+ * loader again. */
+static int glatter_is_known_missing_(glatter_atomic_int* record)
+{
+    return GLATTER_ATOMIC_INT_LOAD(*record) ==
+        GLATTER_ATOMIC_INT_LOAD(*GLATTER_REGISTRY_SHARED(missing_generation, glatter_missing_generation));
+}
+
+/* Record a failed resolution. The miss is only remembered once the WSI
+ * decision is final: before that, a miss may mean that nothing was loaded yet
+ * rather than that the driver lacks the entry. Only the thread that records
+ * the miss logs it, so a missing entry point called every frame logs once per
+ * generation instead of on every call. */
+static void glatter_note_missing_(glatter_atomic_int* record, const char* name)
+{
+    glatter_atomic_int* phase = GLATTER_REGISTRY_SHARED(phase, glatter_loader_state_get()->phase);
+    if (GLATTER_ATOMIC_INT_LOAD(*phase) != GLATTER_PHASE_RESOLVED) {
+        glatter_log_printf("GLATTER: failed to resolve '%s'\n", name);
+        return;
+    }
+
+    int generation = GLATTER_ATOMIC_INT_LOAD(
+        *GLATTER_REGISTRY_SHARED(missing_generation, glatter_missing_generation));
+    int previous = GLATTER_ATOMIC_INT_LOAD(*record);
+    if (previous != generation && GLATTER_ATOMIC_INT_CAS(*record, previous, generation)) {
+        glatter_log_printf(
+            "GLATTER: failed to resolve '%s'; not retried until glatter_reset_missing_entry_points()\n", name);
+    }
+}
 
 #if defined(GLATTER_GL)
 GLATTER_INLINE_OR_NOT
@@ -1126,7 +2234,7 @@ GLATTER_INLINE_OR_NOT
 void glatter_check_error_GL(const char* file, int line)
 {
     GLenum err;
-    while ((err = glGetError()) != GL_NO_ERROR) {
+    while (GLATTER_UNLIKELY((err = glGetError()) != GL_NO_ERROR)) {
         glatter_log_printf(
             "GLATTER: in '%s'(%d):\n", file, line
         );
@@ -1287,7 +2395,7 @@ void glatter_check_error_GLX(const char* file, int line)
         int before = GLATTER_ATOMIC_INT_LOAD(s->count);
         XSync(dpy, False);
         int after  = GLATTER_ATOMIC_INT_LOAD(s->count);
-        if (after != before) {
+        if (GLATTER_UNLIKELY(after != before)) {
             glatter_log_printf(
                 "GLATTER: GLX error detected after call at '%s'(%d); see prior X error log for details.\n",
                 file,
@@ -1312,7 +2420,7 @@ GLATTER_INLINE_OR_NOT
 void glatter_check_error_WGL(const char* file, int line)
 {
     DWORD eid = GetLastError();
-    if(eid == 0)
+    if (!GLATTER_UNLIKELY(eid != 0))
         return;
 
     LPVOID buffer = NULL;
@@ -1346,7 +2454,7 @@ GLATTER_INLINE_OR_NOT
 void glatter_check_error_EGL(const char* file, int line)
 {
     EGLint err = eglGetError();
-    if (err != EGL_SUCCESS) {
+    if (GLATTER_UNLIKELY(err != EGL_SUCCESS)) {
         glatter_log_printf(
             "GLATTER: EGL call produced %s error in %s(%d)\n", enum_to_string_EGL(err), file, line
         );
@@ -1415,12 +2523,6 @@ void* glatter_get_proc_address_GLU(const char* function_name)
 }
 #endif
 
-/* Every process-scoped object is declared by now. */
-#undef GLATTER_LINKONCE
-#undef GLATTER_LINKONCE_FN
-#undef GLATTER_LINKONCE_STORAGE
-#undef GLATTER_LINKONCE_DECORATION
-
 GLATTER_EXTERN_C_END
 
 #if defined(GLATTER_HEADER_ONLY) && defined(__cplusplus)
@@ -1642,21 +2744,162 @@ const char* get_prs(size_t sz, const void* obj)
 
 
 
-GLATTER_INLINE_OR_NOT
-uint32_t glatter_djb2(const uint8_t *str)
+/* ---- Extension name lookup ----
+ * Each family's generated glatter_<F>_ges_def.h carries a perfect hash over
+ * its GLATTER_EXT_* names, built by perfect_hash() in glatter.py the same way
+ * as the entry point table: the FNV-1a hash of a name picks a bucket, whose
+ * seed maps it to a slot. A slot holds at most one candidate, which is
+ * compared in full, so an unknown name never sets a bit. */
+typedef struct glatter_extension_table
+{
+    uint32_t        buckets; /* power of two */
+    uint32_t        slots;   /* power of two */
+    const uint16_t* seeds;   /* per bucket */
+    const uint16_t* index;   /* per slot; the GLATTER_EXT_* index, 0xffff if empty */
+    const uint16_t* offsets; /* per GLATTER_EXT_* index, into names */
+    const char*     names;   /* NUL-separated */
+} glatter_extension_table_t;
+
+/* Returns the GLATTER_EXT_* index of the first length bytes at name, or -1. */
+static int glatter_extension_index_(const glatter_extension_table_t* table, const uint8_t* name, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= name[i];
+        hash *= 16777619u;
+    }
+    uint32_t seed = table->seeds[(hash ^ (hash >> 16)) & (table->buckets - 1)];
+    uint16_t index = table->index[glatter_perfect_hash_slot_(hash, seed, table->slots - 1)];
+    if (index == 0xffff) {
+        return -1;
+    }
+    const char* known = table->names + table->offsets[index];
+    if (strncmp(known, (const char*)name, length) != 0 || known[length] != '\0') {
+        return -1;
+    }
+    return index;
+}
+
+static void glatter_extension_mark_(uint32_t* bits, const glatter_extension_table_t* table, const uint8_t* name, size_t length)
+{
+    int index = glatter_extension_index_(table, name, length);
+    if (index >= 0) {
+        bits[index >> 5] |= (uint32_t)1 << (index & 31);
+    }
+    // Otherwise the implementation reports an extension that the headers do
+    // not list, e.g. because they are older than the driver. Not an error.
+}
+
+#if defined(GLATTER_SCAN_AVX2) || defined(GLATTER_SCAN_SSE2)
+static unsigned glatter_scan_first_bit_(uint32_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanForward(&bit, mask);
+    return (unsigned)bit;
+#else
+    return (unsigned)__builtin_ctz(mask);
+#endif
+}
+#endif
+
+/* Returns the first ' ' or NUL at or after p. The vector variants load only
+ * aligned blocks, which cannot cross into an unmapped page, and discard the
+ * bytes of the first block that precede p. */
+static const uint8_t* glatter_extension_separator_(const uint8_t* p)
 {
-    uint32_t hash = 5381;
-    for (int c = *str; c; c = *++str)
-        hash = ((hash << 5) + hash) + c;
-    return hash;
+#if defined(GLATTER_SCAN_AVX2)
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i zero  = _mm256_setzero_si256();
+    const uint8_t* block = (const uint8_t*)((uintptr_t)p & ~(uintptr_t)31);
+    __m256i v = _mm256_load_si256((const __m256i*)block);
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, zero)));
+    mask &= ~(uint32_t)0 << (p - block);
+    while (!mask) {
+        block += 32;
+        v = _mm256_load_si256((const __m256i*)block);
+        mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, zero)));
+    }
+    return block + glatter_scan_first_bit_(mask);
+#elif defined(GLATTER_SCAN_SSE2)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i zero  = _mm_setzero_si128();
+    const uint8_t* block = (const uint8_t*)((uintptr_t)p & ~(uintptr_t)15);
+    __m128i v = _mm_load_si128((const __m128i*)block);
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, zero)));
+    mask &= ~(uint32_t)0 << (p - block);
+    while (!mask) {
+        block += 16;
+        v = _mm_load_si128((const __m128i*)block);
+        mask = (uint32_t)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, zero)));
+    }
+    return block + glatter_scan_first_bit_(mask);
+#elif defined(GLATTER_SCAN_NEON)
+    /* No movemask on NEON: narrow the byte mask to 4 bits per byte. */
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8_t* block = (const uint8_t*)((uintptr_t)p & ~(uintptr_t)15);
+    uint8x16_t v = vld1q_u8(block);
+    uint8x16_t hit = vorrq_u8(vceqq_u8(v, space), vceqzq_u8(v));
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hit), 4)), 0);
+    mask &= ~(uint64_t)0 << (4 * (p - block));
+    while (!mask) {
+        block += 16;
+        v = vld1q_u8(block);
+        hit = vorrq_u8(vceqq_u8(v, space), vceqzq_u8(v));
+        mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hit), 4)), 0);
+    }
+    return block + (__builtin_ctzll(mask) >> 2);
+#else
+    while (*p && *p != ' ') {
+        ++p;
+    }
+    return p;
+#endif
 }
 
+/* Reads the first "<major>.<minor>" of a GL_VERSION or GL_SHADING_LANGUAGE_VERSION
+ * string, after any prefix such as "OpenGL ES GLSL ES ". The minor number is
+ * read as written, so "4.60" gives 4 and 60. Both are 0 if there is none. */
+static void glatter_parse_version_(const uint8_t* s, int* major, int* minor)
+{
+    *major = *minor = 0;
+    if (!s) {
+        return;
+    }
+    while (*s && !(*s >= '0' && *s <= '9' && s[1] == '.')) {
+        ++s;
+    }
+    for (; *s >= '0' && *s <= '9'; ++s) {
+        *major = *major * 10 + (*s - '0');
+    }
+    if (*s == '.') {
+        for (++s; *s >= '0' && *s <= '9'; ++s) {
+            *minor = *minor * 10 + (*s - '0');
+        }
+    }
+}
 
-typedef struct glatter_es_record_struct
+/* Marks each name of a space-separated extension string; NULL marks nothing. */
+static void glatter_extension_mark_list_(uint32_t* bits, const glatter_extension_table_t* table, const uint8_t* list)
 {
-    uint32_t hash;
-    uint16_t index;
-} glatter_es_record_t;
+    if (!list) {
+        return;
+    }
+    for (const uint8_t* p = list; *p; ) {
+        while (*p == ' ') {
+            ++p;
+        }
+        const uint8_t* name = p;
+        p = glatter_extension_separator_(p);
+        if (p != name) {
+            glatter_extension_mark_(bits, table, name, (size_t)(p - name));
+        }
+    }
+}
 
 
 //==================
@@ -1669,290 +2912,2162 @@ typedef struct glatter_es_record_struct
 
 /* Missing-symbol policy: in debug, abort to surface configuration errors early. */
 
+/* First-use path shared by every wrapper: look the entry point up through the
+ * family's loader and apply the policy above to a miss, which is remembered in
+ * 'missing'. Returns NULL for a miss. */
+static GLATTER_COLD void* glatter_resolve_entry_(
+    void* (*get_proc_address)(const char*), glatter_atomic_int* missing, const char* function_name)
+{
+    if (glatter_is_known_missing_(missing)) {
+        return NULL;
+    }
+    void* resolved = get_proc_address(function_name);
+    if (!resolved) {
+        if (GLATTER_RESOLVE_ABORT_ON_MISSING) {
+            glatter_log_printf("GLATTER: missing '%s' (aborting in debug)\n", function_name);
+            abort();
+        }
+        glatter_note_missing_(missing, function_name);
+    }
+    return resolved;
+}
+
 #define GLATTER_RETURN_VALUE(return_or_not, rtype, value) \
     GLATTER_RETURN_VALUE_##return_or_not(rtype, value)
 
 #define GLATTER_RETURN_VALUE_return(rtype, value) return (value)
 #define GLATTER_RETURN_VALUE_(rtype, value)       return
 
-/* Note: header-only vs TU variants differ only in storage/linkage; call flow is identical. */
-#ifdef GLATTER_HEADER_ONLY
+/* Returns what 'call' returns, or makes it and returns for void entry points. */
+#define GLATTER_RETURN_CALL(return_or_not, call) GLATTER_RETURN_CALL_##return_or_not(call)
+#define GLATTER_RETURN_CALL_return(call) return call
+#define GLATTER_RETURN_CALL_(call)       call; return
 
-/* Thread-safe first use:
- * Resolution uses a single atomic CAS on the function pointer.
+/* ---- Retired objects ----
+ *
+ * A thread may be reading a dispatch table or a hook record at the moment
+ * another one takes it out of its list or replaces it, so the object is not
+ * freed there but retired: pushed on a list that the next reclaim frees when
+ * it finds no thread inside a read section. A read section is an increment
+ * and a decrement of a counter around the use of such an object, taken by
+ * the dispatch table lookups of the make-current calls and by hooked calls;
+ * sections are a few loads long, so the counters are at 0 most of the time. An
+ * object may also be pinned by a count of its own, as a dispatch table is by
+ * the threads bound to it and a hook record by the calls running its hooks,
+ * and is then kept until that count drops to 0 too. The cached sets of a
+ * context are not retired, but kept; see "Context caches".
+ *
+ * There are two counters, and a section counts on the one of the current
+ * epoch's parity. Reclaims run wherever objects are retired and free the
+ * pending objects if both counters are at 0. Those on behalf of the
+ * application, i.e. the destroy calls and the installation of hooks, which
+ * never run inside a section, wait for the readers instead once more than
+ * GLATTER_RETIRED_MAX objects are pending, which bounds the list. Waiting for
+ * a counter to reach 0 could starve while other threads keep entering
+ * sections, so the waiter advances the epoch first: new sections count on
+ * the other counter, and the one waited for only drains. Doing so twice
+ * drains the sections of either parity that began before the wait. Waiters
+ * take turns, lest one's advance send new sections back to the counter
+ * another one waits for.
+ *
+ * The reclaimer reads a counter with an atomic add of 0 instead of a load.
+ * Being a read-modify-write, it sees the latest count, and a reader whose
+ * increment comes after it also comes after the object was taken out, so it
+ * cannot have found that object.
  */
-#define GLATTER_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs)\
-    typedef rtype (cconv *glatter_##name##_t) dargs;\
-    static glatter_atomic(glatter_##name##_t) glatter_##name##_resolved = GLATTER_ATOMIC_INIT_PTR(0);\
-    static inline rtype cconv glatter_##name dargs\
-    {\
-        glatter_##name##_t fn = (glatter_##name##_t)GLATTER_ATOMIC_LOAD(glatter_##name##_resolved);\
-        if (!fn) {\
-            glatter_##name##_t resolved = (glatter_##name##_t)glatter_get_proc_address_##family(#name);\
-            if (!resolved) {\
-                if (GLATTER_RESOLVE_ABORT_ON_MISSING) {\
-                    glatter_log_printf("GLATTER: missing '%s' (aborting in debug)\n", #name);\
-                    abort();\
-                }\
-                glatter_log_printf("GLATTER: failed to resolve '%s'\n", #name);\
-                GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0);\
-            }\
-            glatter_##name##_t expected = (glatter_##name##_t)0;\
-            if (!GLATTER_ATOMIC_CAS(glatter_##name##_resolved, expected, resolved)) {\
-                /* another thread won the race, use its result */\
-            }\
-            fn = (glatter_##name##_t)GLATTER_ATOMIC_LOAD(glatter_##name##_resolved);\
-        }\
-        return_or_not fn cargs;\
-    }
+#ifndef GLATTER_RETIRED_MAX
+#define GLATTER_RETIRED_MAX 64
+#endif
 
-#else /* !GLATTER_HEADER_ONLY */
+/* Header of a retired object, first in its allocation, which is freed through it. */
+typedef struct glatter_retired {
+    struct glatter_retired* next;
+    glatter_atomic_int*     pins; /* kept while this is not 0; NULL for none */
+} glatter_retired_t;
 
-#if defined(_WIN32)
+GLATTER_LINKONCE glatter_atomic_int    glatter_retired_readers[2];
+GLATTER_LINKONCE glatter_atomic_int    glatter_retired_epoch;
+GLATTER_LINKONCE glatter_atomic_int    glatter_retired_waiting; /* a reclaim waits for the readers */
+GLATTER_LINKONCE glatter_atomic(void*) glatter_retired_objects; /* glatter_retired_t* */
 
-#  define GLATTER_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
-    cder rtype cconv name dargs; \
-    typedef rtype (cconv *glatter_##name##_t) dargs; \
-    static rtype cconv glatter_##name##_resolver dargs; \
-    glatter_##name##_t glatter_##name = glatter_##name##_resolver; \
-    static rtype cconv glatter_##name##_resolver dargs \
-    { \
-        glatter_##name##_t resolved = (glatter_##name##_t)glatter_get_proc_address_##family(#name); \
-        if (!resolved) { \
-            if (GLATTER_RESOLVE_ABORT_ON_MISSING) { \
-                glatter_log_printf("GLATTER: missing '%s' (aborting in debug)\n", #name); \
-                abort(); \
-            } \
-            glatter_log_printf("GLATTER: failed to resolve '%s'\n", #name); \
-            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
-        } \
-        (void)InterlockedCompareExchangePointer((volatile PVOID*)&glatter_##name, (PVOID)resolved, (PVOID)glatter_##name##_resolver); \
-        return_or_not glatter_##name cargs; \
-    }
+/* Enters a read section and returns what glatter_read_leave_() takes. */
+static inline int glatter_read_enter_(void)
+{
+    int side = GLATTER_ATOMIC_INT_LOAD(glatter_retired_epoch) & 1;
+    (void)GLATTER_ATOMIC_INT_FETCH_ADD(glatter_retired_readers[side], 1);
+    return side;
+}
 
-#else  /* POSIX: wrapper + call_once, no mutation of public pointer */
+static inline void glatter_read_leave_(int side)
+{
+    (void)GLATTER_ATOMIC_INT_FETCH_ADD(glatter_retired_readers[side], -1);
+}
 
-#  define GLATTER_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
-    cder rtype cconv name dargs; /* keep symbol available for debuggers if needed */ \
+/* Waits until the sections that were open on entry have all left. */
+static void glatter_read_drain_(void)
+{
+    for (unsigned turn = 0; ; ++turn) {
+        int expected = 0;
+        if (GLATTER_ATOMIC_INT_CAS(glatter_retired_waiting, expected, 1)) {
+            break;
+        }
+        glatter_configuration_wait_(turn);
+    }
+    for (int round = 0; round < 2; ++round) {
+        int side = GLATTER_ATOMIC_INT_FETCH_ADD(glatter_retired_epoch, 1) & 1;
+        for (unsigned turn = 0; GLATTER_ATOMIC_INT_FETCH_ADD(glatter_retired_readers[side], 0) != 0; ++turn) {
+            glatter_configuration_wait_(turn);
+        }
+    }
+    GLATTER_ATOMIC_INT_STORE(glatter_retired_waiting, 0);
+}
+
+/* Pushes the chain first..last on the list. */
+static void glatter_retire_chain_(glatter_retired_t* first, glatter_retired_t* last)
+{
+    for (;;) {
+        void* head = GLATTER_ATOMIC_LOAD(glatter_retired_objects);
+        last->next = (glatter_retired_t*)head;
+        if (GLATTER_ATOMIC_CAS(glatter_retired_objects, head, (void*)first)) {
+            return;
+        }
+    }
+}
+
+/* Retires an object that no cache or list holds any more. */
+static inline void glatter_retire_(glatter_retired_t* object, glatter_atomic_int* pins)
+{
+    object->pins = pins;
+    glatter_retire_chain_(object, object);
+}
+
+/* Publishes 'object' in 'slot' and returns what it replaces, to be retired. */
+static void* glatter_replace_(glatter_atomic(void*)* slot, void* object)
+{
+    for (;;) {
+        void* previous = GLATTER_ATOMIC_LOAD(*slot);
+        if (GLATTER_ATOMIC_CAS(*slot, previous, object)) {
+            return previous;
+        }
+    }
+}
+
+/* Frees the retired objects that no thread reads and nothing pins. With
+ * 'wait', a backlog above GLATTER_RETIRED_MAX waits for the readers to drain;
+ * the caller must not be inside a read section then. Waiting is bounded by
+ * the sections open when it starts, however often others are entered. */
+GLATTER_INLINE_OR_NOT
+void glatter_reclaim_(int wait)
+{
+    glatter_retired_t* taken = NULL;
+    for (;;) {
+        void* head = GLATTER_ATOMIC_LOAD(glatter_retired_objects);
+        if (!head) {
+            return;
+        }
+        if (GLATTER_ATOMIC_CAS(glatter_retired_objects, head, (void*)NULL)) {
+            taken = (glatter_retired_t*)head;
+            break;
+        }
+    }
+
+    glatter_retired_t* last = taken;
+    unsigned count = 1;
+    while (last->next) {
+        last = last->next;
+        ++count;
+    }
+
+    /* A section that began after the first read cannot have found them. */
+    if (GLATTER_ATOMIC_INT_FETCH_ADD(glatter_retired_readers[0], 0) != 0 ||
+        GLATTER_ATOMIC_INT_FETCH_ADD(glatter_retired_readers[1], 0) != 0)
+    {
+        if (!wait || count <= GLATTER_RETIRED_MAX) {
+            glatter_retire_chain_(taken, last);
+            return;
+        }
+        glatter_read_drain_();
+    }
+
+    while (taken) {
+        glatter_retired_t* next = taken->next;
+        if (taken->pins && GLATTER_ATOMIC_INT_LOAD(*taken->pins) != 0) {
+            glatter_retire_chain_(taken, taken);
+        }
+        else {
+            free(taken);
+        }
+        taken = next;
+    }
+}
+
+/* ---- Call hooks ----
+ *
+ * glatter_set_call_hooks() installs functions that run before and after the
+ * calls made through the wrappers; a per-family mask selects the hooked entry
+ * points, all of them by default. Hooked calls go through
+ * glatter_<name>_hooked, which hands the hooks the entry point's id, the
+ * addresses of its arguments and of its return value.
+ *
+ * Wrappers with a body of their own test glatter_call_hooks_installed first,
+ * so while no hooks are installed a call costs one more load and a branch that
+ * is never taken. Where the public pointer or slot is swapped for the driver
+ * entry instead (compiled builds without GLATTER_IFUNC), the hooked entry
+ * points are swapped for glatter_<name>_hooked, and the others cost nothing.
+ */
+typedef struct glatter_call_hooks {
+    glatter_retired_t    retired; /* for when it is replaced */
+    glatter_call_hook_fn pre;
+    glatter_call_hook_fn post;
+    void*                user_data;
+    glatter_atomic_int   calls;   /* calls running these hooks */
+} glatter_call_hooks;
+
+/* Per family, the mask of hooked entry points; NULL hooks all of them. A mask
+ * follows its glatter_retired_t header, through which it is retired. */
+GLATTER_LINKONCE glatter_atomic(void*) glatter_call_hook_masks[GLATTER_FAMILY_COUNT];
+
+#if !defined(GLATTER_IFUNC) /* whose calls are never hooked */
+/* The installed hooks, NULL while there are none. A replaced record is
+ * retired, and kept while calls in flight may still be running its hooks. */
+GLATTER_LINKONCE glatter_atomic(void*) glatter_call_hooks_installed = GLATTER_ATOMIC_INIT_PTR(NULL);
+
+/* Set while a hook runs, so that its own calls into glatter are not hooked. */
+GLATTER_LINKONCE GLATTER_THREAD_LOCAL int glatter_in_call_hook = 0;
+
+#define GLATTER_CALL_HOOKS_INSTALLED() (GLATTER_ATOMIC_LOAD(glatter_call_hooks_installed) != NULL)
+
+static inline void glatter_call_hook_run_(glatter_call_hook_fn hook, const glatter_call_t* call, void* user_data)
+{
+    if (hook) {
+        glatter_in_call_hook = 1;
+        hook(call, user_data);
+        glatter_in_call_hook = 0;
+    }
+}
+
+/* Runs the pre hook of 'call' and returns the hooks to finish it with, or
+ * NULL if the call is not hooked. */
+GLATTER_COLD_STATIC glatter_call_hooks* glatter_call_hooks_pre_(glatter_call_t* call)
+{
+    if (glatter_in_call_hook) {
+        return NULL;
+    }
+    int side = glatter_read_enter_();
+    glatter_call_hooks* hooks = (glatter_call_hooks*)GLATTER_ATOMIC_LOAD(glatter_call_hooks_installed);
+    if (hooks) {
+        const uint32_t* mask = (const uint32_t*)GLATTER_ATOMIC_LOAD(glatter_call_hook_masks[call->family]);
+        if (mask && !GLATTER_FN_BITMAP_TEST(mask, call->function)) {
+            hooks = NULL;
+        }
+        else {
+            (void)GLATTER_ATOMIC_INT_FETCH_ADD(hooks->calls, 1);
+        }
+    }
+    glatter_read_leave_(side);
+    if (hooks) {
+        glatter_call_hook_run_(hooks->pre, call, hooks->user_data);
+    }
+    return hooks;
+}
+
+GLATTER_COLD_STATIC void glatter_call_hooks_post_(glatter_call_hooks* hooks, glatter_call_t* call, void* result)
+{
+    if (hooks) {
+        call->result = result;
+        glatter_call_hook_run_(hooks->post, call, hooks->user_data);
+        (void)GLATTER_ATOMIC_INT_FETCH_ADD(hooks->calls, -1);
+    }
+}
+#endif
+
+/* Thread-safe first use of a slot: a single atomic CAS. A failed resolution
+ * is remembered in glatter_<name>_missing (see glatter_note_missing_), so
+ * calling an entry point the driver lacks does not repeat the loader lookup
+ * on every call. */
+GLATTER_COLD_STATIC void* glatter_resolve_slot_(glatter_atomic(void*)* slot,
+    void* (*get_proc_address)(const char*), glatter_atomic_int* missing, const char* function_name)
+{
+    void* resolved = glatter_resolve_entry_(get_proc_address, missing, function_name);
+    if (!resolved) {
+        return NULL;
+    }
+    void* expected = NULL;
+    if (!GLATTER_ATOMIC_CAS(*slot, expected, resolved)) {
+        /* another thread won the race, use its result */
+    }
+    return GLATTER_ATOMIC_LOAD(*slot);
+}
+
+static inline void* glatter_slot_entry_(glatter_atomic(void*)* slot,
+    void* (*get_proc_address)(const char*), glatter_atomic_int* missing, const char* function_name)
+{
+    void* fn = GLATTER_ATOMIC_LOAD(*slot);
+    return fn ? fn : glatter_resolve_slot_(slot, get_proc_address, missing, function_name);
+}
+
+/* GLATTER_HOOK_ARGS(a, b, ...) expands to "(const void*)&a, (const void*)&b, ..."
+ * with a trailing comma, and to nothing for an empty list. Entry points take
+ * at most 24 arguments. */
+#define GLATTER_HOOK_EXPAND_(x) x
+#define GLATTER_HOOK_CAT_(a, b) a##b
+#define GLATTER_HOOK_XCAT_(a, b) GLATTER_HOOK_CAT_(a, b)
+#define GLATTER_HOOK_NTH_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, n, ...) n
+#define GLATTER_HOOK_NARG_(...) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_NTH_(__VA_ARGS__, \
+    24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+#define GLATTER_HOOK_ARGS(...) \
+    GLATTER_HOOK_EXPAND_(GLATTER_HOOK_XCAT_(GLATTER_HOOK_ARGS_, GLATTER_HOOK_NARG_(__VA_ARGS__))(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_1(a) GLATTER_HOOK_ARG_(a)
+#define GLATTER_HOOK_ARGS_2(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_1(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_3(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_2(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_4(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_3(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_5(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_4(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_6(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_5(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_7(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_6(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_8(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_7(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_9(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_8(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_10(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_9(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_11(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_10(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_12(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_11(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_13(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_12(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_14(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_13(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_15(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_14(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_16(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_15(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_17(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_16(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_18(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_17(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_19(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_18(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_20(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_19(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_21(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_20(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_22(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_21(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_23(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_22(__VA_ARGS__))
+#define GLATTER_HOOK_ARGS_24(a, ...) GLATTER_HOOK_ARG_(a) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_ARGS_23(__VA_ARGS__))
+#define GLATTER_HOOK_ARG_(a) GLATTER_HOOK_XCAT_(GLATTER_HOOK_ARG_IF_EMPTY_, GLATTER_HOOK_IS_EMPTY_(a))(a)
+#define GLATTER_HOOK_ARG_IF_EMPTY_0(a) (const void*)&a,
+#define GLATTER_HOOK_ARG_IF_EMPTY_1(a)
+#define GLATTER_HOOK_IS_EMPTY_(a) GLATTER_HOOK_SECOND_(GLATTER_HOOK_PROBE_ a (), 0, )
+#define GLATTER_HOOK_PROBE_() ~, 1
+#define GLATTER_HOOK_SECOND_(...) GLATTER_HOOK_EXPAND_(GLATTER_HOOK_SECOND_I_(__VA_ARGS__))
+#define GLATTER_HOOK_SECOND_I_(x, y, ...) y
+
+/* Defines glatter_<name>_hooked, which calls 'target' between the hooks.
+ * 'target' yields the entry to call, or NULL if it cannot be resolved. */
+#define GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs, target) \
+    GLATTER_COLD_STATIC rtype cconv glatter_##name##_hooked dargs \
+    { \
+        glatter_##name##_t glatter_fn_ = (glatter_##name##_t)(target); \
+        if (!glatter_fn_) { \
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
+        } \
+        const void* glatter_args_[] = { GLATTER_HOOK_ARGS cargs NULL }; \
+        glatter_call_t glatter_call_ = { GLATTER_FAMILY_##family, GLATTER_FN_##name, #name, \
+            (int)(sizeof(glatter_args_) / sizeof(glatter_args_[0])) - 1, glatter_args_, NULL }; \
+        glatter_call_hooks* glatter_hooks_ = glatter_call_hooks_pre_(&glatter_call_); \
+        GLATTER_HOOKED_CALL_##return_or_not(rtype, glatter_fn_ cargs) \
+    }
+
+#define GLATTER_HOOKED_CALL_return(rtype, call) \
+    rtype glatter_result_ = call; \
+    glatter_call_hooks_post_(glatter_hooks_, &glatter_call_, (void*)&glatter_result_); \
+    return glatter_result_;
+#define GLATTER_HOOKED_CALL_(rtype, call) \
+    call; \
+    glatter_call_hooks_post_(glatter_hooks_, &glatter_call_, NULL);
+
+
+#if defined(GLATTER_EAGER)
+/* Defines glatter_<name>_bind(), used by glatter_init_<family>() to resolve an
+ * entry point up front and hand it to 'publish'. Returns 0 on a miss. */
+#  define GLATTER_EAGER_BIND(family, name, publish) \
+    static inline int glatter_##name##_bind(void) \
+    { \
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_get_proc_address_##family(#name); \
+        publish; \
+        return resolved != (glatter_##name##_t)0; \
+    }
+#else
+#  define GLATTER_EAGER_BIND(family, name, publish)
+#endif
+
+#if !defined(GLATTER_EAGER)
+/* Defines glatter_<name>_warm(), used by the warm-up to fill the slot of an
+ * entry point. 'publish' swaps 'resolved' in only over the slot's initial
+ * value, so an entry bound or a hook swapped in meanwhile stays. A miss leaves
+ * the slot to the first call, which reports it. */
+#  define GLATTER_WARM_BIND(family, name, publish) \
+    static inline void glatter_##name##_warm(void) \
+    { \
+        if (!glatter_warmup_resolvable_(#name)) { \
+            return; \
+        } \
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_get_proc_address_##family(#name); \
+        if (resolved) { \
+            publish; \
+        } \
+    }
+#else
+#  define GLATTER_WARM_BIND(family, name, publish)
+#endif
+
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL)
+
+/* ---- Per-context dispatch (GLATTER_CONTEXT_DISPATCH) ----
+ *
+ * Some drivers, notably EGL ones on multi-vendor systems, return addresses
+ * that are only valid for contexts of one display or vendor. In this mode GL
+ * entry points are not bound process-wide: every context gets its own table,
+ * indexed by GLATTER_FN_<name> and filled on first use while that context is
+ * current. Each thread keeps a pointer to the table of its current context,
+ * which the make-current wrappers (see glatter.h) swap. A call is then a
+ * thread-local load, an indexed load and an indirect call.
+ *
+ * Tables are found by glatter_current_gl_context_key_(). Destroying a
+ * context takes its tables out of the list, so a new context at the same
+ * address starts with an empty one, and retires them; they are freed once no
+ * thread is bound to them any more (see "Retired objects"). A thread that
+ * exits with a table bound keeps it allocated. Lookups for tables bypass the
+ * address cache of glatter_get_proc_address, which assumes one address per
+ * name.
+ *
+ * On POSIX a table also records the WSI its context was made current with,
+ * and resolves through that WSI's loader rather than the one latched for the
+ * process. The GLX and EGL make-current wrappers set it for the calling
+ * thread, and glatter_bind_dispatch_to_wsi() does so for a context made
+ * current elsewhere, so GLX and EGL contexts can be used side by side, also
+ * in a build that only has headers for one of them.
+ */
+typedef struct glatter_dispatch {
+    glatter_retired_t        retired; /* for when its context is destroyed */
+    uintptr_t                key;
+    uintptr_t                context; /* the context handle, for glatter_forget_dispatch_ */
+    int                      wsi;     /* GLATTER_WSI_*; AUTO follows the process */
+    glatter_atomic_int       bound;   /* threads whose current table this is */
+    glatter_atomic(void*)    next;    /* glatter_dispatch* */
+    glatter_atomic(void*)    entries[GLATTER_FN_COUNT_GL];
+    glatter_atomic_int       missing[GLATTER_FN_COUNT_GL]; /* see glatter_note_missing_ */
+} glatter_dispatch;
+
+/* The list is read inside read sections and changed under a lock, which is
+ * only taken to add a context's table or to remove a destroyed one. */
+GLATTER_LINKONCE glatter_atomic(void*) glatter_dispatch_tables = GLATTER_ATOMIC_INIT_PTR(NULL);
+GLATTER_LINKONCE glatter_atomic_int    glatter_dispatch_lock;
+GLATTER_LINKONCE GLATTER_THREAD_LOCAL glatter_dispatch* glatter_dispatch_current = NULL;
+#if !defined(_WIN32)
+/* WSI of the context current on this thread; AUTO until one is known. */
+GLATTER_LINKONCE GLATTER_THREAD_LOCAL int glatter_dispatch_wsi = GLATTER_WSI_AUTO_VALUE;
+#endif
+
+GLATTER_INLINE_OR_NOT uintptr_t glatter_current_gl_context_(uintptr_t* context);
+
+static void glatter_dispatch_lock_(void)
+{
+    for (unsigned turn = 0; ; ++turn) {
+        int expected = 0;
+        if (GLATTER_ATOMIC_INT_CAS(glatter_dispatch_lock, expected, 1)) {
+            return;
+        }
+        glatter_configuration_wait_(turn);
+    }
+}
+
+static void glatter_dispatch_unlock_(void)
+{
+    GLATTER_ATOMIC_INT_STORE(glatter_dispatch_lock, 0);
+}
+
+static glatter_dispatch* glatter_dispatch_find_(uintptr_t key, int wsi)
+{
+    glatter_dispatch* d = (glatter_dispatch*)GLATTER_ATOMIC_LOAD(glatter_dispatch_tables);
+    while (d && !(d->key == key && d->wsi == wsi)) {
+        d = (glatter_dispatch*)GLATTER_ATOMIC_LOAD(d->next);
+    }
+    return d;
+}
+
+/* The table of 'key', created if there is none, and bound once more: the
+ * caller hands the binding to glatter_dispatch_select_(). */
+static glatter_dispatch* glatter_dispatch_for_key_(uintptr_t key, uintptr_t context, int wsi)
+{
+    int side = glatter_read_enter_();
+    glatter_dispatch* d = glatter_dispatch_find_(key, wsi);
+    if (d) {
+        (void)GLATTER_ATOMIC_INT_FETCH_ADD(d->bound, 1);
+    }
+    glatter_read_leave_(side);
+    if (d) {
+        return d;
+    }
+
+    glatter_dispatch* created = (glatter_dispatch*)calloc(1, sizeof(glatter_dispatch));
+    if (!created) {
+        glatter_log("GLATTER: failed to allocate a dispatch table.\n");
+        return NULL;
+    }
+    created->key = key;
+    created->context = context;
+    created->wsi = wsi;
+    created->bound = 1;
+
+    /* A table added meanwhile may be for the same key, so look again. */
+    glatter_dispatch_lock_();
+    d = glatter_dispatch_find_(key, wsi);
+    if (d) {
+        (void)GLATTER_ATOMIC_INT_FETCH_ADD(d->bound, 1);
+    }
+    else {
+        GLATTER_ATOMIC_STORE(created->next, GLATTER_ATOMIC_LOAD(glatter_dispatch_tables));
+        GLATTER_ATOMIC_STORE(glatter_dispatch_tables, (void*)created);
+    }
+    glatter_dispatch_unlock_();
+    if (d) {
+        free(created);
+        return d;
+    }
+    return created;
+}
+
+/* Makes 'd', bound by glatter_dispatch_for_key_, the calling thread's table. */
+static void glatter_dispatch_select_(glatter_dispatch* d)
+{
+    glatter_dispatch* previous = glatter_dispatch_current;
+    glatter_dispatch_current = d;
+    if (previous) {
+        (void)GLATTER_ATOMIC_INT_FETCH_ADD(previous->bound, -1);
+    }
+}
+
+/* Takes the tables of a destroyed context out of the list and retires them. */
+GLATTER_INLINE_OR_NOT
+void glatter_forget_dispatch_(uintptr_t context)
+{
+    glatter_dispatch_lock_();
+    glatter_atomic(void*)* link = &glatter_dispatch_tables;
+    glatter_dispatch* d = (glatter_dispatch*)GLATTER_ATOMIC_LOAD(*link);
+    while (d) {
+        glatter_dispatch* next = (glatter_dispatch*)GLATTER_ATOMIC_LOAD(d->next);
+        if (d->context == context) {
+            GLATTER_ATOMIC_STORE(*link, (void*)next);
+            glatter_retire_(&d->retired, &d->bound);
+        }
+        else {
+            link = &d->next;
+        }
+        d = next;
+    }
+    glatter_dispatch_unlock_();
+}
+
+/* Select the table of the context that is current on this thread. The
+ * make-current wrappers call this; call it directly after a context switch
+ * that did not go through them, e.g. one made inside a windowing toolkit. */
+GLATTER_INLINE_OR_NOT
+void glatter_bind_dispatch_to_current_context(void)
+{
+#if defined(_WIN32)
+    int wsi = GLATTER_WSI_AUTO_VALUE;
+#else
+    int wsi = glatter_dispatch_wsi;
+#endif
+    uintptr_t context;
+    uintptr_t key = glatter_current_gl_context_(&context);
+    glatter_dispatch_select_(key ? glatter_dispatch_for_key_(key, context, wsi) : NULL);
+}
+
+#if !defined(_WIN32)
+/* Select the table of the context that 'wsi' (GLATTER_WSI_GLX or
+ * GLATTER_WSI_EGL) has current on this thread, resolving through that WSI
+ * from now on. GLATTER_WSI_AUTO goes back to the WSI of the process. */
+GLATTER_INLINE_OR_NOT
+void glatter_bind_dispatch_to_wsi(int wsi)
+{
+    glatter_dispatch_wsi = (wsi == GLATTER_WSI_GLX_VALUE || wsi == GLATTER_WSI_EGL_VALUE)
+        ? wsi : GLATTER_WSI_AUTO_VALUE;
+    glatter_bind_dispatch_to_current_context();
+}
+#endif
+
+/* Uncached lookup: once the WSI is latched, ask the loader of the table's WSI,
+ * or of the process WSI, directly. Before that, the first lookup latches the
+ * process WSI as usual, and is repeated through the table's own WSI if that
+ * is another one. */
+static void* glatter_dispatch_lookup_(glatter_dispatch* d, const char* function_name)
+{
+    glatter_loader_state* state = glatter_loader_state_get();
+    int wsi = d ? d->wsi : GLATTER_WSI_AUTO_VALUE;
+    if (GLATTER_ATOMIC_INT_LOAD(state->phase) != GLATTER_PHASE_RESOLVED) {
+        void* ptr = glatter_get_proc_address(function_name);
+        if (wsi == GLATTER_WSI_AUTO_VALUE || wsi == GLATTER_ATOMIC_INT_LOAD(state->active)) {
+            return ptr;
+        }
+    }
+    if (wsi == GLATTER_WSI_AUTO_VALUE) {
+        wsi = GLATTER_ATOMIC_INT_LOAD(state->active);
+    }
+    return glatter_resolve_through_(state, wsi, function_name);
+}
+
+/* Slow path of glatter_dispatch_entry_: binds the thread to a table if it has
+ * none yet and resolves the entry into it. With 'report' unset, a miss is
+ * neither logged nor remembered (used by glatter_init_GL). */
+static GLATTER_COLD void* glatter_dispatch_resolve_(int index, const char* function_name, int report)
+{
+    glatter_dispatch* d = glatter_dispatch_current;
+    if (!d) {
+        glatter_bind_dispatch_to_current_context();
+        d = glatter_dispatch_current;
+    }
+    if (!d) {
+        /* No context is current; there is no table to fill. */
+        return glatter_dispatch_lookup_(NULL, function_name);
+    }
+
+    void* ptr = GLATTER_ATOMIC_LOAD(d->entries[index]);
+    if (ptr || glatter_is_known_missing_(&d->missing[index])) {
+        return ptr;
+    }
+
+    ptr = glatter_dispatch_lookup_(d, function_name);
+    if (ptr) {
+        GLATTER_ATOMIC_STORE(d->entries[index], ptr);
+    }
+    else if (report) {
+        if (GLATTER_RESOLVE_ABORT_ON_MISSING) {
+            glatter_log_printf("GLATTER: missing '%s' (aborting in debug)\n", function_name);
+            abort();
+        }
+        glatter_note_missing_(&d->missing[index], function_name);
+    }
+    return ptr;
+}
+
+static inline void* glatter_dispatch_entry_(int index, const char* function_name)
+{
+    glatter_dispatch* d = glatter_dispatch_current;
+    if (d) {
+        void* ptr = GLATTER_ATOMIC_LOAD(d->entries[index]);
+        if (ptr) {
+            return ptr;
+        }
+    }
+    return glatter_dispatch_resolve_(index, function_name, 1);
+}
+
+#if defined(GLATTER_EAGER)
+/* glatter_init_GL() fills the table of the current context. */
+#  define GLATTER_DISPATCH_BIND(name) \
+    static inline int glatter_##name##_bind(void) \
+    { \
+        return glatter_dispatch_resolve_(GLATTER_FN_##name, #name, 0) != NULL; \
+    }
+#else
+#  define GLATTER_DISPATCH_BIND(name)
+#endif
+
+#if defined(GLATTER_HEADER_ONLY)
+#  define GLATTER_DISPATCH_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
     typedef rtype (cconv *glatter_##name##_t) dargs; \
-    static glatter_once_t        glatter_##name##_once = GLATTER_ONCE_INIT; \
-    static glatter_##name##_t glatter_##name##_impl = (glatter_##name##_t)0; \
-    static void glatter_##name##_init(void) { \
-        glatter_##name##_impl = (glatter_##name##_t)glatter_get_proc_address_##family(#name); \
-        if (!glatter_##name##_impl) { \
-            if (GLATTER_RESOLVE_ABORT_ON_MISSING) { \
-                glatter_log_printf("GLATTER: missing '%s' (aborting in debug)\n", #name); \
-                abort(); \
-            } \
-            glatter_log_printf("GLATTER: failed to resolve '%s'\n", #name); \
+    GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs, \
+        glatter_dispatch_entry_(GLATTER_FN_##name, #name)) \
+    static inline rtype cconv glatter_##name dargs \
+    { \
+        if (GLATTER_UNLIKELY(GLATTER_CALL_HOOKS_INSTALLED())) { \
+            GLATTER_RETURN_CALL(return_or_not, glatter_##name##_hooked cargs); \
+        } \
+        glatter_##name##_t fn = (glatter_##name##_t)glatter_dispatch_entry_(GLATTER_FN_##name, #name); \
+        if (!fn) { \
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
         } \
+        return_or_not fn cargs; \
     } \
-    static rtype cconv glatter_##name##_thunk dargs { \
-        glatter_call_once(&glatter_##name##_once, glatter_##name##_init); \
-        glatter_##name##_t fn = glatter_##name##_impl; \
-        if (!fn) { GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); } \
+    GLATTER_DISPATCH_BIND(name)
+#else
+/* The public pointer keeps its ABI and permanently points at the thunk. */
+#  define GLATTER_DISPATCH_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    cder rtype cconv name dargs; \
+    typedef rtype (cconv *glatter_##name##_t) dargs; \
+    GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs, \
+        glatter_dispatch_entry_(GLATTER_FN_##name, #name)) \
+    static rtype cconv glatter_##name##_thunk dargs \
+    { \
+        if (GLATTER_UNLIKELY(GLATTER_CALL_HOOKS_INSTALLED())) { \
+            GLATTER_RETURN_CALL(return_or_not, glatter_##name##_hooked cargs); \
+        } \
+        glatter_##name##_t fn = (glatter_##name##_t)glatter_dispatch_entry_(GLATTER_FN_##name, #name); \
+        if (!fn) { \
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
+        } \
         return_or_not fn cargs; \
     } \
-    /* Public variable keeps ABI, points permanently to the thunk (never mutated). */ \
-    glatter_##name##_t glatter_##name = glatter_##name##_thunk;
+    glatter_##name##_t glatter_##name = glatter_##name##_thunk; \
+    GLATTER_DISPATCH_BIND(name)
+#endif
+
+#endif /* GLATTER_CONTEXT_DISPATCH && GLATTER_GL */
 
+/* With GLATTER_CONTEXT_DISPATCH the GL entry points of each context, and so
+ * their misses, are in its own table, whose records are cleared. Otherwise
+ * an entry point and its miss are shared by all contexts, the current one
+ * included, so there is no narrower record to clear than the shared one. */
+GLATTER_INLINE_OR_NOT
+void glatter_reset_missing_entry_points_for_current_context(void)
+{
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL)
+    glatter_bind_dispatch_to_current_context();
+    glatter_dispatch* d = glatter_dispatch_current;
+    if (d) {
+        for (int i = 0; i < GLATTER_FN_COUNT_GL; ++i) {
+            GLATTER_ATOMIC_INT_STORE(d->missing[i], 0);
+        }
+    }
+#else
+    glatter_reset_missing_entry_points();
 #endif
+}
 
-#endif /* GLATTER_HEADER_ONLY */
+/* Note: header-only vs TU variants differ only in storage/linkage; call flow is identical. */
+#if defined(GLATTER_HEADER_ONLY) && defined(GLATTER_EAGER)
+
+/* Eager header-only: the table slot of each entry point is filled by
+ * glatter_init_<family>(), so a call is a single indirect call, behind the
+ * test for hooks. The slots are null until then. An entry point that was
+ * missing at init is bound to glatter_<name>_late, which keeps trying to
+ * resolve it. */
+#define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs)\
+    typedef rtype (cconv *glatter_##name##_t) dargs;\
+    static glatter_atomic_int glatter_##name##_missing = GLATTER_ATOMIC_INT_INIT(0);\
+    static GLATTER_COLD rtype cconv glatter_##name##_late dargs\
+    {\
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_resolve_entry_(\
+            glatter_get_proc_address_##family, &glatter_##name##_missing, #name);\
+        if (!resolved) {\
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0);\
+        }\
+        return_or_not resolved cargs;\
+    }\
+    GLATTER_EAGER_BIND(family, name,\
+        glatter_fn_table_##family[GLATTER_FN_##name] = (void*)(resolved ? resolved : glatter_##name##_late))\
+    GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs,\
+        glatter_fn_table_##family[GLATTER_FN_##name])\
+    static inline rtype cconv glatter_##name dargs\
+    {\
+        if (GLATTER_UNLIKELY(GLATTER_CALL_HOOKS_INSTALLED())) {\
+            GLATTER_RETURN_CALL(return_or_not, glatter_##name##_hooked cargs);\
+        }\
+        return_or_not ((glatter_##name##_t)glatter_fn_table_##family[GLATTER_FN_##name]) cargs;\
+    }
 
-//==================
+#elif defined(GLATTER_HEADER_ONLY)
 
-#include <stdarg.h>
-#include <stdio.h>
+/* Thread-safe first use: see glatter_resolve_slot_. What is inlined at a call
+ * site is the test for hooks, a load, a test and the indirect call. */
+#define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs)\
+    typedef rtype (cconv *glatter_##name##_t) dargs;\
+    static glatter_atomic_int glatter_##name##_missing = GLATTER_ATOMIC_INT_INIT(0);\
+    GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs,\
+        glatter_slot_entry_(&GLATTER_FN_SLOT(family, name),\
+            glatter_get_proc_address_##family, &glatter_##name##_missing, #name))\
+    static inline rtype cconv glatter_##name dargs\
+    {\
+        if (GLATTER_UNLIKELY(GLATTER_CALL_HOOKS_INSTALLED())) {\
+            GLATTER_RETURN_CALL(return_or_not, glatter_##name##_hooked cargs);\
+        }\
+        void* fn = GLATTER_ATOMIC_LOAD(GLATTER_FN_SLOT(family, name));\
+        if (GLATTER_UNLIKELY(!fn)) {\
+            fn = glatter_resolve_slot_(&GLATTER_FN_SLOT(family, name),\
+                glatter_get_proc_address_##family, &glatter_##name##_missing, #name);\
+            if (!fn) {\
+                GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0);\
+            }\
+        }\
+        return_or_not ((glatter_##name##_t)fn) cargs;\
+    }\
+    GLATTER_WARM_BIND(family, name,\
+        void* expected = NULL;\
+        (void)GLATTER_ATOMIC_CAS(GLATTER_FN_SLOT(family, name), expected, (void*)resolved))
 
-/* Internal: format varargs and route to glatter_log(...) */
-GLATTER_INLINE_OR_NOT
-void glatter_vlog_line_(const char* prefix, const char* fmt, va_list ap)
-{
-    char buf[1024];
+#else /* !GLATTER_HEADER_ONLY */
+
+/* Where the public pointer, or the slot of GLATTER_TRAMPOLINES, is swapped for
+ * the driver entry, a hooked call finds the entry in a slot of its own. The
+ * pointer is swapped for glatter_<name>_hooked, and back for the resolver,
+ * which then binds the driver entry again (see glatter_swap_call_hooks_). */
+#define GLATTER_SWAPPED_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    static glatter_atomic(void*) glatter_##name##_target; \
+    GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs, \
+        glatter_slot_entry_(&glatter_##name##_target, \
+            glatter_get_proc_address_##family, &glatter_##name##_missing, #name))
+
+#if defined(GLATTER_TRAMPOLINES)
+#  define GLATTER_HOOK_POINTER_(name) glatter_##name##_slot
+#else
+#  define GLATTER_HOOK_POINTER_(name) glatter_##name
+#endif
+
+#if defined(GLATTER_IFUNC) || defined(GLATTER_TRAMPOLINES)
+
+#if defined(GLATTER_IFUNC) && defined(GLATTER_TRAMPOLINES)
+#  error "GLATTER_IFUNC and GLATTER_TRAMPOLINES are alternatives; define only one of them."
+#endif
+#if defined(GLATTER_CONTEXT_DISPATCH)
+#  error "GLATTER_IFUNC and GLATTER_TRAMPOLINES bind GL entry points per process and cannot be combined with GLATTER_CONTEXT_DISPATCH."
+#endif
+
+/* In both modes glatter_<name> is a function, and the entry it ends up in is
+ * kept in a private slot. The slot starts at the resolver and is swapped for
+ * the driver entry by the first successful call, as in the POSIX branch below. */
+#  define GLATTER_SLOT_RESOLVER(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    static glatter_atomic_int glatter_##name##_missing = GLATTER_ATOMIC_INT_INIT(0); \
+    static GLATTER_COLD rtype cconv glatter_##name##_resolver dargs \
+    { \
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_resolve_entry_( \
+            glatter_get_proc_address_##family, &glatter_##name##_missing, #name); \
+        if (!resolved) { \
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
+        } \
+        glatter_##name##_t expected = glatter_##name##_resolver; \
+        (void)__atomic_compare_exchange_n(&glatter_##name##_slot, &expected, resolved, 0, \
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); \
+        return_or_not resolved cargs; \
+    }
+
+#endif
+
+#if defined(GLATTER_IFUNC)
+
+#if !defined(__linux__) || !defined(__ELF__) || !(defined(__GNUC__) || defined(__clang__))
+#  error "GLATTER_IFUNC needs GNU indirect functions (Linux, ELF, GCC or Clang)."
+#endif
+
+/* GNU IFUNC: each glatter_<name> is an indirect function whose resolver runs
+ * when the dynamic linker binds a call to it, and returns the driver entry
+ * itself. Calls from other modules then go from the PLT straight to the
+ * driver. The resolver runs inside the dynamic linker, where loading a
+ * library, loading layers or probing a WSI is not safe, so it only hands out
+ * an address that glatter_get_proc_address has already cached once the
+ * configuration is resolved. Otherwise, and before this library's
+ * constructors have run (BIND_NOW, LD_BIND_NOW), it returns
+ * glatter_<name>_indirect, the usual swap-on-first-call path, which then
+ * stays bound for that module. The constructor warns if that happened. */
+static int glatter_ifunc_ready_ = 0;
+static int glatter_ifunc_early_ = 0;
+
+__attribute__((constructor))
+static void glatter_ifunc_mark_ready_(void)
+{
+    __atomic_store_n(&glatter_ifunc_ready_, 1, __ATOMIC_RELEASE);
+    if (__atomic_load_n(&glatter_ifunc_early_, __ATOMIC_RELAXED)) {
+        glatter_log("GLATTER: GLATTER_IFUNC entry points were bound before glatter was initialized "
+            "(-z now or LD_BIND_NOW); their calls go through glatter instead of straight to the driver.\n");
+    }
+}
+
+/* The driver entry the resolver of 'function_name' may return, or NULL. It
+ * only reads the address cache, and never loads or resolves anything. */
+static void* glatter_ifunc_cached_(const char* function_name)
+{
+    if (!__atomic_load_n(&glatter_ifunc_ready_, __ATOMIC_ACQUIRE)) {
+        __atomic_store_n(&glatter_ifunc_early_, 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    glatter_loader_state* state = glatter_loader_state_get();
+    if (GLATTER_ATOMIC_INT_LOAD(state->phase) != GLATTER_PHASE_RESOLVED) {
+        return NULL;
+    }
+
+    uint32_t hash = glatter_entry_point_hash_(function_name);
+    uint32_t index = glatter_entry_point_slot_(hash);
+    const char* known = glatter_entry_point_names[index];
+    if (known && strcmp(known, function_name) == 0) {
+        return GLATTER_ATOMIC_LOAD(glatter_entry_point_cache[index]);
+    }
+
+    const uint32_t mask = GLATTER_PROC_ADDRESS_OVERFLOW_SLOTS - 1;
+    for (uint32_t i = 0, pos = hash & mask; i <= mask; ++i, pos = (pos + 1) & mask) {
+        const char* key = (const char*)GLATTER_ATOMIC_LOAD(glatter_proc_overflow[pos].name);
+        if (!key) {
+            return NULL;
+        }
+        if (strcmp(key, function_name) == 0) {
+            return GLATTER_ATOMIC_LOAD(glatter_proc_overflow[pos].proc);
+        }
+    }
+    return NULL;
+}
+
+#  define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    cder rtype cconv name dargs; \
+    typedef rtype (cconv *glatter_##name##_t) dargs; \
+    static rtype cconv glatter_##name##_resolver dargs; \
+    static glatter_##name##_t glatter_##name##_slot = glatter_##name##_resolver; \
+    GLATTER_SLOT_RESOLVER(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    static rtype cconv glatter_##name##_indirect dargs \
+    { \
+        return_or_not __atomic_load_n(&glatter_##name##_slot, __ATOMIC_ACQUIRE) cargs; \
+    } \
+    static glatter_##name##_t glatter_##name##_ifunc(void) \
+    { \
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_ifunc_cached_(#name); \
+        return resolved ? resolved : glatter_##name##_indirect; \
+    } \
+    rtype cconv glatter_##name dargs __attribute__((ifunc("glatter_" #name "_ifunc"))); \
+    GLATTER_EAGER_BIND(family, name, \
+        if (resolved) __atomic_store_n(&glatter_##name##_slot, resolved, __ATOMIC_RELEASE)) \
+    GLATTER_WARM_BIND(family, name, \
+        glatter_##name##_t expected = glatter_##name##_resolver; \
+        (void)__atomic_compare_exchange_n(&glatter_##name##_slot, &expected, resolved, 0, \
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+
+#elif defined(GLATTER_TRAMPOLINES)
+
+#if !defined(__ELF__) || !(defined(__GNUC__) || defined(__clang__)) || \
+    !(defined(__x86_64__) || defined(__aarch64__))
+#  error "GLATTER_TRAMPOLINES needs GCC or Clang targeting ELF on x86-64 or AArch64."
+#endif
+
+/* Trampolines: each glatter_<name> is an assembled stub that jumps through its
+ * slot. It has no frame of its own, so the driver returns straight to the
+ * caller, and profilers and debuggers attribute the time in between to the
+ * driver function, called from the application. The stubs are ordinary
+ * symbols of this object and need no perf map. The slot is only read here and
+ * written once, with release semantics, by the resolver; a plain load suffices
+ * on both targets. */
+#if defined(__x86_64__)
+#  if defined(__CET__)
+#    define GLATTER_TRAMPOLINE_LANDING "endbr64\n"
+#  else
+#    define GLATTER_TRAMPOLINE_LANDING ""
+#  endif
+#  define GLATTER_TRAMPOLINE_JUMP(slot) \
+    "jmp *" slot "(%rip)\n"
+#else
+#  if defined(__ARM_FEATURE_BTI_DEFAULT)
+#    define GLATTER_TRAMPOLINE_LANDING "bti c\n"
+#  else
+#    define GLATTER_TRAMPOLINE_LANDING ""
+#  endif
+#  define GLATTER_TRAMPOLINE_JUMP(slot) \
+    "adrp x16, " slot "\n" \
+    "ldr x16, [x16, :lo12:" slot "]\n" \
+    "br x16\n"
+#endif
+
+#  define GLATTER_TRAMPOLINE(name) \
+    __asm__( \
+        ".pushsection .text\n" \
+        ".globl glatter_" #name "\n" \
+        ".type glatter_" #name ", %function\n" \
+        ".p2align 4\n" \
+        "glatter_" #name ":\n" \
+        ".cfi_startproc\n" \
+        GLATTER_TRAMPOLINE_LANDING \
+        GLATTER_TRAMPOLINE_JUMP("glatter_" #name "_slot") \
+        ".cfi_endproc\n" \
+        ".size glatter_" #name ", .-glatter_" #name "\n" \
+        ".popsection\n");
+
+/* The slot is named in the stub, so its symbol is pinned with an asm label. */
+#  define GLATTER_CALL_HOOKS_SWAP
+#  define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    cder rtype cconv name dargs; \
+    typedef rtype (cconv *glatter_##name##_t) dargs; \
+    rtype cconv glatter_##name dargs; \
+    static rtype cconv glatter_##name##_resolver dargs; \
+    static glatter_##name##_t glatter_##name##_slot __asm__("glatter_" #name "_slot") \
+        __attribute__((used)) = glatter_##name##_resolver; \
+    GLATTER_SLOT_RESOLVER(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    GLATTER_SWAPPED_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    GLATTER_TRAMPOLINE(name) \
+    GLATTER_EAGER_BIND(family, name, \
+        if (resolved) __atomic_store_n(&glatter_##name##_slot, resolved, __ATOMIC_RELEASE)) \
+    GLATTER_WARM_BIND(family, name, \
+        glatter_##name##_t expected = glatter_##name##_resolver; \
+        (void)__atomic_compare_exchange_n(&glatter_##name##_slot, &expected, resolved, 0, \
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+
+#elif defined(_WIN32)
+
+#  define GLATTER_CALL_HOOKS_SWAP
+#  define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    cder rtype cconv name dargs; \
+    typedef rtype (cconv *glatter_##name##_t) dargs; \
+    static rtype cconv glatter_##name##_resolver dargs; \
+    glatter_##name##_t glatter_##name = glatter_##name##_resolver; \
+    static glatter_atomic_int glatter_##name##_missing = GLATTER_ATOMIC_INT_INIT(0); \
+    static GLATTER_COLD rtype cconv glatter_##name##_resolver dargs \
+    { \
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_resolve_entry_( \
+            glatter_get_proc_address_##family, &glatter_##name##_missing, #name); \
+        if (!resolved) { \
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
+        } \
+        (void)InterlockedCompareExchangePointer((volatile PVOID*)&glatter_##name, (PVOID)resolved, (PVOID)glatter_##name##_resolver); \
+        return_or_not glatter_##name cargs; \
+    } \
+    GLATTER_SWAPPED_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    GLATTER_EAGER_BIND(family, name, \
+        if (resolved) (void)InterlockedExchangePointer((volatile PVOID*)&glatter_##name, (PVOID)resolved)) \
+    GLATTER_WARM_BIND(family, name, \
+        (void)InterlockedCompareExchangePointer((volatile PVOID*)&glatter_##name, (PVOID)resolved, \
+            (PVOID)glatter_##name##_resolver))
+
+#elif defined(__GNUC__) || defined(__clang__)
+
+/* POSIX: same scheme as the Windows branch. The public pointer starts at the
+ * resolver and is swapped for the driver entry by the first successful call,
+ * so a resolved entry costs one indirect call and nothing else.
+ *
+ * The pointer keeps its plain type because it is part of the compiled-mode
+ * ABI (see GLATTER_UBLOCK in glatter.h). Only the swap needs to be atomic:
+ * callers load a pointer-sized, naturally aligned object that holds either the
+ * resolver or the final entry, and both are valid targets. A failed
+ * resolution leaves the resolver in place; it returns zero straight away while
+ * the miss is remembered (see glatter_note_missing_). */
+#  define GLATTER_CALL_HOOKS_SWAP
+#  define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    cder rtype cconv name dargs; \
+    typedef rtype (cconv *glatter_##name##_t) dargs; \
+    static rtype cconv glatter_##name##_resolver dargs; \
+    glatter_##name##_t glatter_##name = glatter_##name##_resolver; \
+    static glatter_atomic_int glatter_##name##_missing = GLATTER_ATOMIC_INT_INIT(0); \
+    static GLATTER_COLD rtype cconv glatter_##name##_resolver dargs \
+    { \
+        glatter_##name##_t resolved = (glatter_##name##_t)glatter_resolve_entry_( \
+            glatter_get_proc_address_##family, &glatter_##name##_missing, #name); \
+        if (!resolved) { \
+            GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); \
+        } \
+        glatter_##name##_t expected = glatter_##name##_resolver; \
+        (void)__atomic_compare_exchange_n(&glatter_##name, &expected, resolved, 0, \
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); \
+        return_or_not resolved cargs; \
+    } \
+    GLATTER_SWAPPED_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs) \
+    GLATTER_EAGER_BIND(family, name, \
+        if (resolved) __atomic_store_n(&glatter_##name, resolved, __ATOMIC_RELEASE)) \
+    GLATTER_WARM_BIND(family, name, \
+        glatter_##name##_t expected = glatter_##name##_resolver; \
+        (void)__atomic_compare_exchange_n(&glatter_##name, &expected, resolved, 0, \
+            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+
+#else  /* POSIX without GCC-style atomics: wrapper + call_once, no mutation of public pointer */
+
+#  define GLATTER_PROCESS_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    cder rtype cconv name dargs; /* keep symbol available for debuggers if needed */ \
+    typedef rtype (cconv *glatter_##name##_t) dargs; \
+    static glatter_once_t        glatter_##name##_once = GLATTER_ONCE_INIT; \
+    static glatter_##name##_t glatter_##name##_impl = (glatter_##name##_t)0; \
+    static GLATTER_COLD void glatter_##name##_init(void) { \
+        glatter_##name##_impl = (glatter_##name##_t)glatter_get_proc_address_##family(#name); \
+        if (!glatter_##name##_impl) { \
+            if (GLATTER_RESOLVE_ABORT_ON_MISSING) { \
+                glatter_log_printf("GLATTER: missing '%s' (aborting in debug)\n", #name); \
+                abort(); \
+            } \
+            glatter_log_printf("GLATTER: failed to resolve '%s'\n", #name); \
+        } \
+    } \
+    GLATTER_HOOKED(return_or_not, family, rtype, cconv, name, cargs, dargs, \
+        (glatter_call_once(&glatter_##name##_once, glatter_##name##_init), glatter_##name##_impl)) \
+    static rtype cconv glatter_##name##_thunk dargs { \
+        if (GLATTER_UNLIKELY(GLATTER_CALL_HOOKS_INSTALLED())) { \
+            GLATTER_RETURN_CALL(return_or_not, glatter_##name##_hooked cargs); \
+        } \
+        glatter_call_once(&glatter_##name##_once, glatter_##name##_init); \
+        glatter_##name##_t fn = glatter_##name##_impl; \
+        if (!fn) { GLATTER_RETURN_VALUE(return_or_not, rtype, (rtype)0); } \
+        return_or_not fn cargs; \
+    } \
+    /* Public variable keeps ABI, points permanently to the thunk (never mutated). */ \
+    glatter_##name##_t glatter_##name = glatter_##name##_thunk; \
+    GLATTER_EAGER_BIND(family, name, \
+        glatter_call_once(&glatter_##name##_once, glatter_##name##_init)) \
+    GLATTER_WARM_BIND(family, name, \
+        glatter_call_once(&glatter_##name##_once, glatter_##name##_init))
+
+#endif
+
+#endif /* GLATTER_HEADER_ONLY */
+
+/* Every family binds entry points process-wide, except GL in
+ * GLATTER_CONTEXT_DISPATCH mode, which binds them per context. */
+#define GLATTER_FBLOCK(return_or_not, family, cder, rtype, cconv, name, cargs, dargs) \
+    GLATTER_FBLOCK_##family(return_or_not, family, cder, rtype, cconv, name, cargs, dargs)
+#if defined(GLATTER_CONTEXT_DISPATCH)
+#  define GLATTER_FBLOCK_GL  GLATTER_DISPATCH_FBLOCK
+#else
+#  define GLATTER_FBLOCK_GL  GLATTER_PROCESS_FBLOCK
+#endif
+#define GLATTER_FBLOCK_GLX GLATTER_PROCESS_FBLOCK
+#define GLATTER_FBLOCK_EGL GLATTER_PROCESS_FBLOCK
+#define GLATTER_FBLOCK_WGL GLATTER_PROCESS_FBLOCK
+#define GLATTER_FBLOCK_GLU GLATTER_PROCESS_FBLOCK
+
+//==================
+
+#include <stdarg.h>
+#include <stdio.h>
+
+/* Internal: format varargs and route to glatter_log(...) */
+GLATTER_INLINE_OR_NOT
+void glatter_vlog_line_(const char* prefix, const char* fmt, va_list ap)
+{
+    char buf[1024];
     /* Diagnostic logging: truncation is acceptable; vsnprintf prevents overflow. */
     int n = vsnprintf(buf, sizeof(buf), fmt ? fmt : "", ap);
     (void)n; /* truncation ignored intentionally */
     if (prefix && *prefix) glatter_log(prefix);
     glatter_log(buf);
 }
-
+
+GLATTER_INLINE_OR_NOT
+void glatter_dbg_enter(const char* file, int line, const char* apiname,
+                       const char* fmt, ...)
+{
+    glatter_pre_callback(file, line);
+    glatter_log_printf("GLATTER: in '%s'(%d):\n", file, line);
+    glatter_log_printf("GLATTER: %s", apiname);
+
+    if (fmt && *fmt) {
+        va_list ap; va_start(ap, fmt);
+        glatter_vlog_line_("", fmt, ap);
+        va_end(ap);
+    }
+
+    glatter_log("\n");
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_dbg_return(const char* fmt, ...)
+{
+    glatter_log("GLATTER: returned ");
+    if (fmt && *fmt) {
+        va_list ap; va_start(ap, fmt);
+        glatter_vlog_line_("", fmt, ap);
+        va_end(ap);
+    }
+    else {
+        glatter_log("(void)\n");
+    }
+}
+
+#if defined(GLATTER_LOG_CALLS)
+
+    /* Debug macros become thin function calls for debugger-friendly stepping */
+    #define GLATTER_DBLOCK(file,line,name,printf_fmt,...) \
+        glatter_dbg_enter((file),(line), #name, (printf_fmt), ##__VA_ARGS__);
+    #define GLATTER_RBLOCK(...) \
+        glatter_dbg_return(__VA_ARGS__)
+#else
+    #define GLATTER_DBLOCK(file, line, name, printf_fmt, ...) \
+        glatter_pre_callback(file, line);
+    #define GLATTER_RBLOCK(...)
+#endif
+
+#if defined (GLATTER_LOG_ERRORS)
+    #define GLATTER_CHECK_ERROR(family, file, line) glatter_check_error_##family(file, line);
+#else
+    #define GLATTER_CHECK_ERROR(...)
+#endif
+
+#define GET_PRS(v)\
+    (get_prs(sizeof(v), (const void*)(&(v))))
+
+
+#if defined(__llvm__) || defined (__clang__)
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wunused-value"
+#elif defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wsizeof-array-argument"
+#endif
+
+
+#if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
+    #if defined(GLATTER_GL)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_d_def.h)
+    #endif
+    #if defined(GLATTER_GLX)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_d_def.h)
+    #endif
+    #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_d_def.h)
+    #endif
+    #if defined(GLATTER_WGL)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_d_def.h)
+    #endif
+    #if defined(GLATTER_GLU)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_d_def.h)
+    #endif
+#else
+    #if defined(GLATTER_GL)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_r_def.h)
+    #endif
+    #if defined(GLATTER_GLX)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_r_def.h)
+    #endif
+    #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_r_def.h)
+    #endif
+    #if defined(GLATTER_WGL)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_r_def.h)
+    #endif
+    #if defined(GLATTER_GLU)
+        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_r_def.h)
+    #endif
+#endif
+
+#if defined(GLATTER_EAGER)
+
+static void glatter_init_count_(glatter_init_report_t* report, int* any, const char* name, int resolved)
+{
+    if (resolved) {
+        *any = 1;
+    }
+    if (!report) {
+        return;
+    }
+    if (resolved) {
+        report->resolved++;
+        return;
+    }
+    if (report->missing < GLATTER_INIT_REPORT_NAMES) {
+        report->missing_names[report->missing] = name;
+    }
+    report->missing++;
+}
+
+#define GLATTER_IBLOCK(name) glatter_init_count_(report, &any, #name, glatter_##name##_bind());
+
+#define GLATTER_INIT_BEGIN \
+    int any = 0; \
+    if (report) { \
+        memset(report, 0, sizeof(*report)); \
+    }
+
+#if defined(GLATTER_GL)
+GLATTER_INLINE_OR_NOT
+int glatter_init_GL(glatter_init_report_t* report)
+{
+    GLATTER_INIT_BEGIN
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_i_def.h)
+    return any;
+}
+#endif
+#if defined(GLATTER_GLX)
+GLATTER_INLINE_OR_NOT
+int glatter_init_GLX(glatter_init_report_t* report)
+{
+    GLATTER_INIT_BEGIN
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_i_def.h)
+    return any;
+}
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+GLATTER_INLINE_OR_NOT
+int glatter_init_EGL(glatter_init_report_t* report)
+{
+    GLATTER_INIT_BEGIN
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_i_def.h)
+    return any;
+}
+#endif
+#if defined(GLATTER_WGL)
+GLATTER_INLINE_OR_NOT
+int glatter_init_WGL(glatter_init_report_t* report)
+{
+    GLATTER_INIT_BEGIN
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_i_def.h)
+    return any;
+}
+#endif
+#if defined(GLATTER_GLU)
+GLATTER_INLINE_OR_NOT
+int glatter_init_GLU(glatter_init_report_t* report)
+{
+    GLATTER_INIT_BEGIN
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_i_def.h)
+    return any;
+}
+#endif
+
+#undef GLATTER_INIT_BEGIN
+#undef GLATTER_IBLOCK
+
+#endif /* GLATTER_EAGER */
+
+/* Fills the slots of the entry points compiled in, for the warm-up. */
+GLATTER_INLINE_OR_NOT
+void glatter_warmup_fill_(void)
+{
+#if !defined(GLATTER_EAGER)
+#define GLATTER_IBLOCK(name) glatter_##name##_warm();
+#if defined(GLATTER_GL) && !defined(GLATTER_CONTEXT_DISPATCH)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_i_def.h)
+#endif
+#if defined(GLATTER_GLX)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_i_def.h)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_i_def.h)
+#endif
+#if defined(GLATTER_WGL)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_i_def.h)
+#endif
+#undef GLATTER_IBLOCK
+#endif
+}
+
+#ifndef GLATTER_HEADER_ONLY
+#if defined(GLATTER_GL)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_ges_decl.h)
+#endif
+#if defined(GLATTER_GLX)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_ges_decl.h)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_ges_decl.h)
+#endif
+#if defined(GLATTER_WGL)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_ges_decl.h)
+#endif
+#endif
+
+/** Returns a stable cache key for the *current thread's* GL context+display/DC.
+ *  - 0 means no current context bound.
+ *  - Key is process-local and not intended for persistence or IPC.
+ *  - Safe on 32/64-bit; avoids out-of-range shifts; O(1).
+ */
+/* Unique-ish key for the *current* GL/WSI context, per platform.
+   Safe on 32- and 64-bit builds (no UB shifts), cheap, and stable within a process. */
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL) && !defined(_WIN32)
+/* glXGetCurrentContext/Display and eglGetCurrentContext/Display, for a WSI
+ * this build has no headers for, as found by that WSI's loader. */
+GLATTER_LINKONCE glatter_atomic(void*) glatter_wsi_current_getters[4] = {
+    GLATTER_ATOMIC_INIT_PTR(NULL), GLATTER_ATOMIC_INIT_PTR(NULL),
+    GLATTER_ATOMIC_INIT_PTR(NULL), GLATTER_ATOMIC_INIT_PTR(NULL)
+};
+
+static uintptr_t glatter_wsi_current_(int index, const char* name)
+{
+    void* getter = GLATTER_ATOMIC_LOAD(glatter_wsi_current_getters[index]);
+    if (!getter) {
+        glatter_loader_state* state = glatter_loader_state_get();
+        getter = index < 2 ? glatter_linux_lookup_glx(state, name) : glatter_linux_lookup_egl(state, name);
+        if (!getter) {
+            return (uintptr_t)0;
+        }
+        GLATTER_ATOMIC_STORE(glatter_wsi_current_getters[index], getter);
+    }
+    return (uintptr_t)((void* (*)(void))getter)();
+}
+
+/* Context and display that 'wsi' has current on this thread. */
+static void glatter_wsi_current_context_(int wsi, uintptr_t* context, uintptr_t* display)
+{
+    if (wsi == GLATTER_WSI_GLX_VALUE) {
+#if defined(GLATTER_GLX)
+        *context = (uintptr_t)glXGetCurrentContext();
+        *display = (uintptr_t)glXGetCurrentDisplay();
+#else
+        *context = glatter_wsi_current_(0, "glXGetCurrentContext");
+        *display = glatter_wsi_current_(1, "glXGetCurrentDisplay");
+#endif
+    }
+    else {
+#if defined(GLATTER_EGL)
+        *context = (uintptr_t)eglGetCurrentContext();
+        *display = (uintptr_t)eglGetCurrentDisplay();
+#else
+        *context = glatter_wsi_current_(2, "eglGetCurrentContext");
+        *display = glatter_wsi_current_(3, "eglGetCurrentDisplay");
+#endif
+    }
+}
+#endif
+
+/* The cache key of the context current on this thread, 0 without one.
+ * 'context' receives the context handle itself, which a key does not reveal. */
+GLATTER_INLINE_OR_NOT uintptr_t glatter_current_gl_context_(uintptr_t* context) {
+    uintptr_t a = (uintptr_t)0, b = (uintptr_t)0;
+    *context = (uintptr_t)0;
+
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL) && !defined(_WIN32)
+    if (glatter_dispatch_wsi != GLATTER_WSI_AUTO_VALUE) {
+        /* The WSI the thread's context was made current with. */
+        glatter_wsi_current_context_(glatter_dispatch_wsi, &a, &b);
+    }
+    else
+#endif
+    {
+#if defined(_WIN32)
+        /* WGL: combine context and DC */
+        a = (uintptr_t)wglGetCurrentContext();
+        b = (uintptr_t)wglGetCurrentDC();
+#elif defined(GLATTER_GLX)
+        /* GLX: combine context and Display* */
+        a = (uintptr_t)glXGetCurrentContext();
+        b = (uintptr_t)glXGetCurrentDisplay();
+#elif defined(GLATTER_EGL)
+        /* EGL: combine context and Display* */
+        a = (uintptr_t)eglGetCurrentContext();
+        b = (uintptr_t)eglGetCurrentDisplay();
+#else
+        return (uintptr_t)0; /* Unknown WSI → treat as "no current context". */
+#endif
+    }
+
+    /* If both are null, no current context is bound. */
+    if (((a | b) == (uintptr_t)0)) {
+        return (uintptr_t)0;
+    }
+    *context = a;
+
+    /* Rotate/mix b by half the pointer width to avoid out-of-range shifts.
+       HALF = (bits in uintptr_t) / 2  → 16 on 32-bit, 32 on 64-bit. */
+    const unsigned HALF = (unsigned)(sizeof(uintptr_t) * 4);
+    const unsigned BITS = (unsigned)(sizeof(uintptr_t) * 8);
+
+    /* Rotations are defined because 0 < HALF < BITS on all sane targets. */
+    uintptr_t brot = (uintptr_t)((b << HALF) | (b >> (BITS - HALF)));
+
+    /* Final mix: cheap, symmetric, and stable enough for a cache key. */
+    return a ^ brot;
+}
+
+GLATTER_INLINE_OR_NOT uintptr_t glatter_current_gl_context_key_(void) {
+    uintptr_t context;
+    return glatter_current_gl_context_(&context);
+}
+
+/* ---- Context caches ----
+ *
+ * The extension support and entry point availability sets of a context are
+ * cached for the process, keyed by glatter_current_gl_context_key_(), so a
+ * thread that makes a shared context current finds them already built. A
+ * cache is GLATTER_ES_CACHE_SLOTS pointers to sets that never change once
+ * published: a hit is an acquire load and a key compare per slot. A miss
+ * builds the set on the side and publishes it with a CAS, into a free slot or
+ * else over the oldest one. Threads that miss on the same context at once may
+ * each build it; the first to publish wins and the other copies are dropped.
+ *
+ * A set that was handed out is never freed, since the application may hold
+ * its pointer: one that leaves its cache, because it was replaced,
+ * invalidated or its context destroyed, is kept on the cache's kept list.
+ * That is why a hit needs no accounting of its readers. A set built for a
+ * key is first compared with the kept ones of that key, and an equal one is
+ * published again in its place, so that rebuilding the set of a context, or
+ * of a new context at the address of a destroyed one, does not add up; only
+ * a set that was never handed out is freed.
+ */
+#ifndef GLATTER_ES_CACHE_SLOTS
+#define GLATTER_ES_CACHE_SLOTS 8
+#endif
+
+typedef struct glatter_context_cache {
+    glatter_atomic(void*) sets[GLATTER_ES_CACHE_SLOTS]; /* glatter_context_set_t* */
+    glatter_atomic_int    next;                         /* slot to replace when all are taken */
+    glatter_atomic(void*) kept;                         /* sets that left, newest first */
+} glatter_context_cache_t;
+
+/* Header of a cached set, which follows it in the same allocation. */
+typedef struct glatter_context_set {
+    struct glatter_context_set* kept_next; /* on the kept list, once 'kept' is set */
+    glatter_atomic_int          kept;
+    uintptr_t                   key;
+    uintptr_t                   context;   /* the context handle, for glatter_evict_context_caches_ */
+    size_t                      size;
+} glatter_context_set_t;
+
+static inline void* glatter_context_set_data_(glatter_context_set_t* set)
+{
+    return set + 1;
+}
+
+/* The set of 'key' in 'cache', or NULL. */
+static inline const void* glatter_context_cache_find_(glatter_context_cache_t* cache, uintptr_t key)
+{
+    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
+        const glatter_context_set_t* set = (const glatter_context_set_t*)GLATTER_ATOMIC_LOAD(cache->sets[i]);
+        if (set && set->key == key) {
+            return set + 1;
+        }
+    }
+    return NULL;
+}
+
+/* Puts a set that left 'cache' on its kept list, unless it is there already. */
+static void glatter_context_set_keep_(glatter_context_cache_t* cache, glatter_context_set_t* set)
+{
+    int expected = 0;
+    if (!GLATTER_ATOMIC_CAS(set->kept, expected, 1)) {
+        return;
+    }
+    for (;;) {
+        void* head = GLATTER_ATOMIC_LOAD(cache->kept);
+        set->kept_next = (glatter_context_set_t*)head;
+        if (GLATTER_ATOMIC_CAS(cache->kept, head, (void*)set)) {
+            return;
+        }
+    }
+}
+
+/* A kept set equal to 'set', or NULL. The list only grows, so it is walked
+ * without a lock. */
+static glatter_context_set_t* glatter_context_set_kept_(glatter_context_cache_t* cache, const glatter_context_set_t* set)
+{
+    for (glatter_context_set_t* kept = (glatter_context_set_t*)GLATTER_ATOMIC_LOAD(cache->kept); kept; kept = kept->kept_next) {
+        if (kept->key == set->key && kept->context == set->context && kept->size == set->size &&
+            memcmp(kept + 1, set + 1, set->size) == 0)
+        {
+            return kept;
+        }
+    }
+    return NULL;
+}
+
+/* A zeroed set of 'size' bytes for the context of 'key', to be built by the
+ * caller and then handed to glatter_context_cache_publish_, or freed. */
+GLATTER_INLINE_OR_NOT
+glatter_context_set_t* glatter_context_set_new_(uintptr_t key, uintptr_t context, size_t size)
+{
+    glatter_context_set_t* set = (glatter_context_set_t*)calloc(1, sizeof(glatter_context_set_t) + size);
+    if (!set) {
+        glatter_log("GLATTER: failed to allocate a context cache entry.\n");
+        return NULL;
+    }
+    set->key = key;
+    set->context = context;
+    set->size = size;
+    return set;
+}
+
+/* Publishes a built set and returns the cached one for its key, which is
+ * another thread's if that thread published first. A kept set equal to the
+ * built one is published instead. */
+GLATTER_INLINE_OR_NOT
+const void* glatter_context_cache_publish_(glatter_context_cache_t* cache, glatter_context_set_t* set)
+{
+    glatter_context_set_t* kept = glatter_context_set_kept_(cache, set);
+    if (kept) {
+        free(set);
+        set = kept;
+    }
+    for (;;) {
+        const void* found = glatter_context_cache_find_(cache, set->key);
+        if (found) {
+            if (found != set + 1 && !GLATTER_ATOMIC_INT_LOAD(set->kept)) {
+                free(set); /* never handed out */
+            }
+            return found;
+        }
+
+        void* expected = NULL;
+        unsigned slot = 0;
+        while (slot < GLATTER_ES_CACHE_SLOTS && GLATTER_ATOMIC_LOAD(cache->sets[slot])) {
+            ++slot;
+        }
+        if (slot == GLATTER_ES_CACHE_SLOTS) {
+            slot = (unsigned)GLATTER_ATOMIC_INT_FETCH_ADD(cache->next, 1) % GLATTER_ES_CACHE_SLOTS;
+            expected = GLATTER_ATOMIC_LOAD(cache->sets[slot]);
+        }
+        /* On failure another thread changed the slot, maybe for this key. */
+        if (GLATTER_ATOMIC_CAS(cache->sets[slot], expected, (void*)set)) {
+            if (expected) {
+                glatter_context_set_keep_(cache, (glatter_context_set_t*)expected);
+            }
+            return set + 1;
+        }
+    }
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_context_cache_clear_(glatter_context_cache_t* cache)
+{
+    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
+        void* set = GLATTER_ATOMIC_LOAD(cache->sets[i]);
+        while (set && !GLATTER_ATOMIC_CAS(cache->sets[i], set, (void*)NULL)) {
+            set = GLATTER_ATOMIC_LOAD(cache->sets[i]);
+        }
+        if (set) {
+            glatter_context_set_keep_(cache, (glatter_context_set_t*)set);
+        }
+    }
+}
+
+#if defined(GLATTER_GL)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_ges_def.h)
+#endif
+#if defined(GLATTER_GLX)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_ges_def.h)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_ges_def.h)
+#endif
+#if defined(GLATTER_WGL)
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_ges_def.h)
+#endif
+
+/* Behind the glatter_<extension> flags: one bit of the current context's set. */
+#define GLATTER_EXTENSION_FLAG(family) \
+    GLATTER_INLINE_OR_NOT int glatter_extension_supported_##family(int index) \
+    { \
+        return GLATTER_EXTENSION_SUPPORTED(glatter_get_extension_support_##family(), index); \
+    }
+
+#if defined(GLATTER_GL)
+GLATTER_EXTENSION_FLAG(GL)
+#endif
+#if defined(GLATTER_GLX)
+GLATTER_EXTENSION_FLAG(GLX)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+GLATTER_EXTENSION_FLAG(EGL)
+#endif
+#if defined(GLATTER_WGL)
+GLATTER_EXTENSION_FLAG(WGL)
+#endif
+
+#undef GLATTER_EXTENSION_FLAG
+
+/* ---- Entry point availability ----
+ *
+ * A family's set is filled in one pass over its generated entry point list
+ * (the same list glatter_init_<family> uses), asking the family's loader
+ * directly rather than going through the wrappers, so a miss is neither logged
+ * nor remembered and never aborts. Sets are cached like the extension support
+ * sets, in a context cache of the family. Found addresses are cached for the
+ * process like any other lookup.
+ *
+ * glXGetProcAddress returns an address for any gl* name, whether or not the
+ * context can run it. With GLX, a GL entry point therefore also needs the
+ * version or extension that introduces it, as marked in the generated list,
+ * to be supported by the current context (see glatter_get_context_caps).
+ * Where the context's version cannot be read, the loader's answer stands.
+ * The headers list an entry point under one feature only, the core version
+ * for those of promoted ARB extensions, which then need that version.
+ */
+#define GLATTER_IBLOCK(name) \
+    if (introduced && lookup(#name)) { \
+        bits[GLATTER_FN_##name >> 5] |= 1u << (GLATTER_FN_##name & 31); \
+    }
+
+/* The cached set of the current context, or NULL without one. */
+GLATTER_INLINE_OR_NOT
+const uint32_t* glatter_available_functions_(glatter_context_cache_t* cache, unsigned words,
+    void (*probe)(uint32_t* bits, void* (*lookup)(const char*)), void* (*lookup)(const char*))
+{
+    uintptr_t context;
+    uintptr_t key = glatter_current_gl_context_(&context);
+    if (key == (uintptr_t)0) {
+        return NULL;
+    }
+    const uint32_t* cached = (const uint32_t*)glatter_context_cache_find_(cache, key);
+    if (cached) {
+        return cached;
+    }
+    glatter_context_set_t* set = glatter_context_set_new_(key, context, words * sizeof(uint32_t));
+    if (!set) {
+        return NULL;
+    }
+    probe((uint32_t*)glatter_context_set_data_(set), lookup);
+    return (const uint32_t*)glatter_context_cache_publish_(cache, set);
+}
+
+#define GLATTER_AVAILABILITY(family) \
+    GLATTER_LINKONCE glatter_context_cache_t glatter_fn_available_cache_##family; \
+    GLATTER_INLINE_OR_NOT const uint32_t* glatter_available_functions_##family##_(void) \
+    { \
+        return glatter_available_functions_(&glatter_fn_available_cache_##family, \
+            GLATTER_FN_BITMAP_WORDS(family), glatter_probe_functions_##family##_, \
+            glatter_get_proc_address_##family); \
+    } \
+    GLATTER_INLINE_OR_NOT void glatter_invalidate_available_functions_##family##_(void) \
+    { \
+        glatter_context_cache_clear_(&glatter_fn_available_cache_##family); \
+    } \
+    GLATTER_INLINE_OR_NOT int glatter_function_available_##family(int fn) \
+    { \
+        if (fn < 0 || fn >= GLATTER_FN_COUNT_##family) { \
+            return 0; \
+        } \
+        const uint32_t* bits = glatter_available_functions_##family##_(); \
+        return bits ? GLATTER_FN_BITMAP_TEST(bits, fn) : 0; \
+    } \
+    GLATTER_INLINE_OR_NOT void glatter_query_available_functions_##family(uint32_t* bitmap) \
+    { \
+        const uint32_t* bits = glatter_available_functions_##family##_(); \
+        if (bits) { \
+            memcpy(bitmap, bits, GLATTER_FN_BITMAP_WORDS(family) * sizeof(uint32_t)); \
+        } \
+        else { \
+            memset(bitmap, 0, GLATTER_FN_BITMAP_WORDS(family) * sizeof(uint32_t)); \
+        } \
+    }
+
+#if defined(GLATTER_GL)
+GLATTER_INLINE_OR_NOT
+void glatter_probe_functions_GL_(uint32_t* bits, void* (*lookup)(const char*))
+{
+    int version = -1; /* major * 100 + minor of the context; -1 trusts the loader */
+#if defined(GLATTER_GLX)
+    if (glatter_get_wsi() == GLATTER_WSI_GLX_VALUE) {
+        const glatter_context_caps_t* caps = glatter_get_context_caps();
+        if (caps->major) {
+            version = caps->major * 100 + caps->minor;
+        }
+    }
+#endif
+    int introduced = 1;
+#undef GLATTER_IVERSION
+#undef GLATTER_IEXTENSION
+#define GLATTER_IVERSION(major, minor) introduced = version < 0 || version >= (major) * 100 + (minor);
+#define GLATTER_IEXTENSION(extension)  introduced = version < 0 || glatter_##extension;
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_i_def.h)
+#undef GLATTER_IVERSION
+#undef GLATTER_IEXTENSION
+#define GLATTER_IVERSION(major, minor)
+#define GLATTER_IEXTENSION(extension)
+}
+GLATTER_AVAILABILITY(GL)
+#endif
+#if defined(GLATTER_GLX)
+GLATTER_INLINE_OR_NOT
+void glatter_probe_functions_GLX_(uint32_t* bits, void* (*lookup)(const char*))
+{
+    const int introduced = 1;
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_i_def.h)
+}
+GLATTER_AVAILABILITY(GLX)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+GLATTER_INLINE_OR_NOT
+void glatter_probe_functions_EGL_(uint32_t* bits, void* (*lookup)(const char*))
+{
+    const int introduced = 1;
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_i_def.h)
+}
+GLATTER_AVAILABILITY(EGL)
+#endif
+#if defined(GLATTER_WGL)
+GLATTER_INLINE_OR_NOT
+void glatter_probe_functions_WGL_(uint32_t* bits, void* (*lookup)(const char*))
+{
+    const int introduced = 1;
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_i_def.h)
+}
+GLATTER_AVAILABILITY(WGL)
+#endif
+
+#undef GLATTER_AVAILABILITY
+#undef GLATTER_IBLOCK
+
+/* ---- Context lifetime ----
+ *
+ * glatter.h routes the WSI's make-current and destroy calls here. Destroying
+ * a context drops its sets from the context caches, and only those: a context
+ * created later may get the same address, and must not find them. GLX and EGL
+ * put off destroying a context that is current on some thread until it is
+ * released there, and lookups on that thread can cache its sets again in the
+ * meantime. Destroyed contexts are therefore also remembered, and their sets
+ * are dropped once more when a context at the same address is next made
+ * current. With GLATTER_CONTEXT_DISPATCH, the dispatch tables of a context
+ * go the same way, and each successful switch also selects the dispatch table
+ * of the new context.
+ *
+ * Contexts destroyed or made current elsewhere, e.g. inside a windowing
+ * toolkit, are not seen; glatter_invalidate_all_extension_caches() covers
+ * those.
+ */
+#define GLATTER_DESTROYED_CONTEXT_SLOTS 8
+
+GLATTER_LINKONCE glatter_atomic(void*) glatter_destroyed_contexts[GLATTER_DESTROYED_CONTEXT_SLOTS];
+GLATTER_LINKONCE glatter_atomic_int    glatter_destroyed_context_next;
+
+static inline void glatter_evict_context_(glatter_context_cache_t* cache, uintptr_t context)
+{
+    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
+        void* set = GLATTER_ATOMIC_LOAD(cache->sets[i]);
+        /* The CAS fails only if the slot was replaced meanwhile. */
+        if (set && ((const glatter_context_set_t*)set)->context == context &&
+            GLATTER_ATOMIC_CAS(cache->sets[i], set, (void*)NULL))
+        {
+            glatter_context_set_keep_(cache, (glatter_context_set_t*)set);
+        }
+    }
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_evict_context_caches_(uintptr_t context)
+{
+#if defined(GLATTER_GL)
+    glatter_evict_context_(&glatter_es_cache_GL, context);
+    glatter_evict_context_(&glatter_fn_available_cache_GL, context);
+#endif
+#if defined(GLATTER_GLX)
+    glatter_evict_context_(&glatter_es_cache_GLX, context);
+    glatter_evict_context_(&glatter_fn_available_cache_GLX, context);
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    glatter_evict_context_(&glatter_es_cache_EGL, context);
+    glatter_evict_context_(&glatter_fn_available_cache_EGL, context);
+#endif
+#if defined(GLATTER_WGL)
+    glatter_evict_context_(&glatter_es_cache_WGL, context);
+    glatter_evict_context_(&glatter_fn_available_cache_WGL, context);
+#endif
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL)
+    glatter_forget_dispatch_(context);
+#endif
+    glatter_reclaim_(1);
+}
+
+/* The caches this instance reads through the root, with
+ * GLATTER_SHARED_REGISTRY, are evicted there too. */
+GLATTER_INLINE_OR_NOT
+void glatter_context_destroyed_(uintptr_t context)
+{
+    if (!context) {
+        return;
+    }
+#if defined(GLATTER_SHARED_REGISTRY)
+    glatter_registry* root = glatter_registry_root_();
+    if (root != &glatter_registry_v1) {
+        root->context_destroyed(context);
+    }
+#endif
+    unsigned slot = (unsigned)GLATTER_ATOMIC_INT_FETCH_ADD(glatter_destroyed_context_next, 1) %
+        GLATTER_DESTROYED_CONTEXT_SLOTS;
+    GLATTER_ATOMIC_STORE(glatter_destroyed_contexts[slot], (void*)context);
+    glatter_evict_context_caches_(context);
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_context_made_current_(uintptr_t context)
+{
+    if (!context) {
+        return;
+    }
+#if defined(GLATTER_SHARED_REGISTRY)
+    glatter_registry* root = glatter_registry_root_();
+    if (root != &glatter_registry_v1) {
+        root->context_made_current(context);
+    }
+#endif
+    for (unsigned i = 0; i < GLATTER_DESTROYED_CONTEXT_SLOTS; ++i) {
+        void* destroyed = GLATTER_ATOMIC_LOAD(glatter_destroyed_contexts[i]);
+        if (destroyed == (void*)context && GLATTER_ATOMIC_CAS(glatter_destroyed_contexts[i], destroyed, NULL)) {
+            glatter_evict_context_caches_(context);
+        }
+    }
+}
+
+#if defined(GLATTER_CONTEXT_DISPATCH) && defined(GLATTER_GL)
+#  define GLATTER_SWITCHED_TO(wsi) glatter_bind_dispatch_to_wsi(wsi)
+#  define GLATTER_SWITCHED()       glatter_bind_dispatch_to_current_context()
+#else
+#  define GLATTER_SWITCHED_TO(wsi)
+#  define GLATTER_SWITCHED()
+#endif
+
+/* The wrapped call: its logging variant, given the caller's call site, where
+ * calls are logged or checked. */
+#if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
+#  define GLATTER_WRAPPED(name)   glatter_##name##_debug
+#  define GLATTER_WRAPPED_SITE    , file, line
+#else
+#  define GLATTER_WRAPPED(name)   glatter_##name
+#  define GLATTER_WRAPPED_SITE
+#endif
+
+#if defined(GLATTER_GLX)
+GLATTER_INLINE_OR_NOT
+Bool glatter_glXMakeCurrent_switch(Display* dpy, GLXDrawable drawable, GLXContext ctx GLATTER_CALL_SITE_PARAMS)
+{
+    Bool rval = GLATTER_WRAPPED(glXMakeCurrent)(dpy, drawable, ctx GLATTER_WRAPPED_SITE);
+    if (rval) {
+        glatter_context_made_current_((uintptr_t)ctx);
+        GLATTER_SWITCHED_TO(GLATTER_WSI_GLX_VALUE);
+    }
+    return rval;
+}
+
+GLATTER_INLINE_OR_NOT
+Bool glatter_glXMakeContextCurrent_switch(Display* dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx GLATTER_CALL_SITE_PARAMS)
+{
+    Bool rval = GLATTER_WRAPPED(glXMakeContextCurrent)(dpy, draw, read, ctx GLATTER_WRAPPED_SITE);
+    if (rval) {
+        glatter_context_made_current_((uintptr_t)ctx);
+        GLATTER_SWITCHED_TO(GLATTER_WSI_GLX_VALUE);
+    }
+    return rval;
+}
+
+GLATTER_INLINE_OR_NOT
+void glatter_glXDestroyContext_evict(Display* dpy, GLXContext ctx GLATTER_CALL_SITE_PARAMS)
+{
+    GLATTER_WRAPPED(glXDestroyContext)(dpy, ctx GLATTER_WRAPPED_SITE);
+    glatter_context_destroyed_((uintptr_t)ctx);
+}
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+GLATTER_INLINE_OR_NOT
+EGLBoolean glatter_eglMakeCurrent_switch(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx GLATTER_CALL_SITE_PARAMS)
+{
+    EGLBoolean rval = GLATTER_WRAPPED(eglMakeCurrent)(dpy, draw, read, ctx GLATTER_WRAPPED_SITE);
+    if (rval) {
+        glatter_context_made_current_((uintptr_t)ctx);
+#if defined(_WIN32)
+        GLATTER_SWITCHED();
+#else
+        GLATTER_SWITCHED_TO(GLATTER_WSI_EGL_VALUE);
+#endif
+    }
+    return rval;
+}
+
+GLATTER_INLINE_OR_NOT
+EGLBoolean glatter_eglDestroyContext_evict(EGLDisplay dpy, EGLContext ctx GLATTER_CALL_SITE_PARAMS)
+{
+    EGLBoolean rval = GLATTER_WRAPPED(eglDestroyContext)(dpy, ctx GLATTER_WRAPPED_SITE);
+    if (rval) {
+        glatter_context_destroyed_((uintptr_t)ctx);
+    }
+    return rval;
+}
+#endif
+#if defined(GLATTER_WGL)
+/* wglMakeCurrent and wglDeleteContext are opengl32 exports rather than glatter
+ * entry points, so they have no logging variant and are logged here; the
+ * parentheses keep the wrapper macros of glatter.h from expanding. */
 GLATTER_INLINE_OR_NOT
-void glatter_dbg_enter(const char* file, int line, const char* apiname,
-                       const char* fmt, ...)
+BOOL glatter_wglMakeCurrent_switch(HDC hdc, HGLRC hglrc GLATTER_CALL_SITE_PARAMS)
 {
-    glatter_pre_callback(file, line);
-    glatter_log_printf("GLATTER: in '%s'(%d):\n", file, line);
-    glatter_log_printf("GLATTER: %s", apiname);
-
-    if (fmt && *fmt) {
-        va_list ap; va_start(ap, fmt);
-        glatter_vlog_line_("", fmt, ap);
-        va_end(ap);
+#if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
+    GLATTER_DBLOCK(file, line, wglMakeCurrent, "(%s, %s)", GET_PRS(hdc), GET_PRS(hglrc))
+    SetLastError(0);
+    BOOL rval = (wglMakeCurrent)(hdc, hglrc);
+    GLATTER_RBLOCK("%li\n", (long)rval);
+    GLATTER_CHECK_ERROR(WGL, file, line)
+#else
+    BOOL rval = (wglMakeCurrent)(hdc, hglrc);
+#endif
+    if (rval) {
+        glatter_context_made_current_((uintptr_t)hglrc);
+        GLATTER_SWITCHED();
     }
-
-    glatter_log("\n");
+    return rval;
 }
 
+#if defined(__wgl_wglext_h_) && defined(WGL_ARB_make_current_read)
 GLATTER_INLINE_OR_NOT
-void glatter_dbg_return(const char* fmt, ...)
+BOOL glatter_wglMakeContextCurrentARB_switch(HDC hDrawDC, HDC hReadDC, HGLRC hglrc GLATTER_CALL_SITE_PARAMS)
 {
-    glatter_log("GLATTER: returned ");
-    if (fmt && *fmt) {
-        va_list ap; va_start(ap, fmt);
-        glatter_vlog_line_("", fmt, ap);
-        va_end(ap);
-    }
-    else {
-        glatter_log("(void)\n");
+    BOOL rval = GLATTER_WRAPPED(wglMakeContextCurrentARB)(hDrawDC, hReadDC, hglrc GLATTER_WRAPPED_SITE);
+    if (rval) {
+        glatter_context_made_current_((uintptr_t)hglrc);
+        GLATTER_SWITCHED();
     }
+    return rval;
 }
-
-#if defined(GLATTER_LOG_CALLS)
-
-    /* Debug macros become thin function calls for debugger-friendly stepping */
-    #define GLATTER_DBLOCK(file,line,name,printf_fmt,...) \
-        glatter_dbg_enter((file),(line), #name, (printf_fmt), ##__VA_ARGS__)
-    #define GLATTER_RBLOCK(...) \
-        glatter_dbg_return(__VA_ARGS__)
-#else
-    #define GLATTER_DBLOCK(file, line, name, printf_fmt, ...) \
-        glatter_pre_callback(file, line);
-    #define GLATTER_RBLOCK(...)
 #endif
 
-#if defined (GLATTER_LOG_ERRORS)
-    #define GLATTER_CHECK_ERROR(family, file, line) glatter_check_error_##family(file, line);
+GLATTER_INLINE_OR_NOT
+BOOL glatter_wglDeleteContext_evict(HGLRC hglrc GLATTER_CALL_SITE_PARAMS)
+{
+#if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
+    GLATTER_DBLOCK(file, line, wglDeleteContext, "(%s)", GET_PRS(hglrc))
+    SetLastError(0);
+    BOOL rval = (wglDeleteContext)(hglrc);
+    GLATTER_RBLOCK("%li\n", (long)rval);
+    GLATTER_CHECK_ERROR(WGL, file, line)
 #else
-    #define GLATTER_CHECK_ERROR(...)
+    BOOL rval = (wglDeleteContext)(hglrc);
 #endif
-
-#define GET_PRS(v)\
-    (get_prs(sizeof(v), (const void*)(&(v))))
-
-
-#if defined(__llvm__) || defined (__clang__)
-    #pragma clang diagnostic push
-    #pragma clang diagnostic ignored "-Wunused-value"
-#elif defined(__GNUC__)
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wsizeof-array-argument"
+    if (rval) {
+        glatter_context_destroyed_((uintptr_t)hglrc);
+    }
+    return rval;
+}
 #endif
 
+#undef GLATTER_SWITCHED_TO
+#undef GLATTER_SWITCHED
+#undef GLATTER_WRAPPED
+#undef GLATTER_WRAPPED_SITE
 
-#ifndef GLATTER_HEADER_ONLY
-    #define GLATTER_str(s) #s
-    #define GLATTER_xstr(s) GLATTER_str(s)
-    #define GLATTER_PDIR(pd) platforms/pd
+/* ---- Call hooks: installation ----
+ *
+ * Records and masks are copied and published with a single exchange; replaced
+ * ones are retired (see "Retired objects"). Where entry points are swapped,
+ * each change passes over a table of the family's swappable pointers, built
+ * from the generated entry point list.
+ */
+#if defined(GLATTER_CALL_HOOKS_SWAP)
+typedef struct glatter_hook_site {
+    glatter_atomic(void*)* pointer; /* public pointer, or GLATTER_TRAMPOLINES slot */
+    void*                  hooked;  /* glatter_<name>_hooked */
+    void*                  resolver;
+    int                    fn;      /* GLATTER_FN_<name> */
+} glatter_hook_site;
+
+#define GLATTER_IBLOCK(name) \
+    { (glatter_atomic(void*)*)(void*)&GLATTER_HOOK_POINTER_(name), \
+      (void*)glatter_##name##_hooked, (void*)glatter_##name##_resolver, GLATTER_FN_##name },
+
+#if defined(GLATTER_GL) && !defined(GLATTER_CONTEXT_DISPATCH)
+static const glatter_hook_site glatter_hook_sites_GL[] = {
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_i_def.h)
+    { NULL, NULL, NULL, 0 }
+};
 #endif
-
-
-#if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
-    #if defined(GLATTER_GL)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_d_def.h)
-    #endif
-    #if defined(GLATTER_GLX)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_d_def.h)
-    #endif
-    #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_d_def.h)
-    #endif
-    #if defined(GLATTER_WGL)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_d_def.h)
-    #endif
-    #if defined(GLATTER_GLU)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_d_def.h)
-    #endif
-#else
-    #if defined(GLATTER_GL)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_r_def.h)
-    #endif
-    #if defined(GLATTER_GLX)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_r_def.h)
-    #endif
-    #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_r_def.h)
-    #endif
-    #if defined(GLATTER_WGL)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_r_def.h)
-    #endif
-    #if defined(GLATTER_GLU)
-        #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_r_def.h)
-    #endif
+#if defined(GLATTER_GLX)
+static const glatter_hook_site glatter_hook_sites_GLX[] = {
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_i_def.h)
+    { NULL, NULL, NULL, 0 }
+};
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+static const glatter_hook_site glatter_hook_sites_EGL[] = {
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_i_def.h)
+    { NULL, NULL, NULL, 0 }
+};
+#endif
+#if defined(GLATTER_WGL)
+static const glatter_hook_site glatter_hook_sites_WGL[] = {
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_i_def.h)
+    { NULL, NULL, NULL, 0 }
+};
+#endif
+#if defined(GLATTER_GLU)
+static const glatter_hook_site glatter_hook_sites_GLU[] = {
+    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_i_def.h)
+    { NULL, NULL, NULL, 0 }
+};
 #endif
 
-#ifndef GLATTER_HEADER_ONLY
-#if defined(GLATTER_GL)
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_ges_decl.h)
+#undef GLATTER_IBLOCK
+
+/* Swaps glatter_<name>_hooked in for the hooked entry points of 'family' and
+ * out for the others. With GLATTER_CONTEXT_DISPATCH, GL wrappers test for
+ * hooks instead. */
+static void glatter_swap_call_hooks_(int family)
+{
+    const glatter_hook_site* site = NULL;
+    switch (family) {
+#if defined(GLATTER_GL) && !defined(GLATTER_CONTEXT_DISPATCH)
+        case GLATTER_FAMILY_GL:  site = glatter_hook_sites_GL;  break;
 #endif
 #if defined(GLATTER_GLX)
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_ges_decl.h)
+        case GLATTER_FAMILY_GLX: site = glatter_hook_sites_GLX; break;
 #endif
 #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_ges_decl.h)
+        case GLATTER_FAMILY_EGL: site = glatter_hook_sites_EGL; break;
 #endif
 #if defined(GLATTER_WGL)
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_ges_decl.h)
+        case GLATTER_FAMILY_WGL: site = glatter_hook_sites_WGL; break;
 #endif
+#if defined(GLATTER_GLU)
+        case GLATTER_FAMILY_GLU: site = glatter_hook_sites_GLU; break;
 #endif
+        default: return;
+    }
 
-/** Returns a stable cache key for the *current thread's* GL context+display/DC.
- *  - 0 means no current context bound.
- *  - Key is process-local and not intended for persistence or IPC.
- *  - Safe on 32/64-bit; avoids out-of-range shifts; O(1).
- */
-/* Unique-ish key for the *current* GL/WSI context, per platform.
-   Safe on 32- and 64-bit builds (no UB shifts), cheap, and stable within a process. */
-GLATTER_INLINE_OR_NOT uintptr_t glatter_current_gl_context_key_(void) {
-    uintptr_t a = (uintptr_t)0, b = (uintptr_t)0;
-
-#if defined(_WIN32)
-    /* WGL: combine context and DC */
-    a = (uintptr_t)wglGetCurrentContext();
-    b = (uintptr_t)wglGetCurrentDC();
-#elif defined(GLATTER_GLX)
-    /* GLX: combine context and Display* */
-    a = (uintptr_t)glXGetCurrentContext();
-    b = (uintptr_t)glXGetCurrentDisplay();
-#elif defined(GLATTER_EGL)
-    /* EGL: combine context and Display* */
-    a = (uintptr_t)eglGetCurrentContext();
-    b = (uintptr_t)eglGetCurrentDisplay();
+    int hooked = GLATTER_CALL_HOOKS_INSTALLED();
+    int side = glatter_read_enter_();
+    const uint32_t* mask = (const uint32_t*)GLATTER_ATOMIC_LOAD(glatter_call_hook_masks[family]);
+    for (; site->pointer; ++site) {
+        if (hooked && (!mask || GLATTER_FN_BITMAP_TEST(mask, site->fn))) {
+            GLATTER_ATOMIC_STORE(*site->pointer, site->hooked);
+        }
+        else {
+            void* expected = site->hooked;
+            (void)GLATTER_ATOMIC_CAS(*site->pointer, expected, site->resolver);
+        }
+    }
+    glatter_read_leave_(side);
+}
+#  define GLATTER_SWAP_CALL_HOOKS(family) glatter_swap_call_hooks_(family);
 #else
-    return (uintptr_t)0; /* Unknown WSI → treat as "no current context". */
+#  define GLATTER_SWAP_CALL_HOOKS(family)
 #endif
 
-    /* If both are null, no current context is bound. */
-    if (((a | b) == (uintptr_t)0)) {
-        return (uintptr_t)0;
+GLATTER_INLINE_OR_NOT
+int glatter_set_call_hooks(glatter_call_hook_fn pre, glatter_call_hook_fn post, void* user_data)
+{
+#if defined(GLATTER_IFUNC)
+    (void)pre;
+    (void)post;
+    (void)user_data;
+    glatter_log("GLATTER: glatter_set_call_hooks() ignored; GLATTER_IFUNC binds calls to the driver.\n");
+    return 0;
+#else
+    glatter_call_hooks* hooks = NULL;
+    if (pre || post) {
+        hooks = (glatter_call_hooks*)calloc(1, sizeof(glatter_call_hooks));
+        if (!hooks) {
+            glatter_log("GLATTER: failed to allocate the call hooks.\n");
+            return 0;
+        }
+        hooks->pre       = pre;
+        hooks->post      = post;
+        hooks->user_data = user_data;
     }
-
-    /* Rotate/mix b by half the pointer width to avoid out-of-range shifts.
-       HALF = (bits in uintptr_t) / 2  → 16 on 32-bit, 32 on 64-bit. */
-    const unsigned HALF = (unsigned)(sizeof(uintptr_t) * 4);
-    const unsigned BITS = (unsigned)(sizeof(uintptr_t) * 8);
-
-    /* Rotations are defined because 0 < HALF < BITS on all sane targets. */
-    uintptr_t brot = (uintptr_t)((b << HALF) | (b >> (BITS - HALF)));
-
-    /* Final mix: cheap, symmetric, and stable enough for a cache key. */
-    return a ^ brot;
+    glatter_call_hooks* replaced =
+        (glatter_call_hooks*)glatter_replace_(&glatter_call_hooks_installed, (void*)hooks);
+    for (int family = 0; family < GLATTER_FAMILY_COUNT; ++family) {
+        GLATTER_SWAP_CALL_HOOKS(family)
+    }
+    if (replaced) {
+        glatter_retire_(&replaced->retired, &replaced->calls);
+    }
+    glatter_reclaim_(1);
+    return 1;
+#endif
 }
 
+#define GLATTER_CALL_HOOK_MASK(family) \
+    GLATTER_INLINE_OR_NOT void glatter_set_call_hook_mask_##family(const uint32_t* mask) \
+    { \
+        uint32_t* copy = NULL; \
+        if (mask) { \
+            glatter_retired_t* header = (glatter_retired_t*)malloc( \
+                sizeof(glatter_retired_t) + GLATTER_FN_BITMAP_WORDS(family) * sizeof(uint32_t)); \
+            if (!header) { \
+                glatter_log("GLATTER: failed to allocate a call hook mask.\n"); \
+                return; \
+            } \
+            copy = (uint32_t*)(void*)(header + 1); \
+            memcpy(copy, mask, GLATTER_FN_BITMAP_WORDS(family) * sizeof(uint32_t)); \
+        } \
+        uint32_t* replaced = (uint32_t*)glatter_replace_( \
+            &glatter_call_hook_masks[GLATTER_FAMILY_##family], (void*)copy); \
+        GLATTER_SWAP_CALL_HOOKS(GLATTER_FAMILY_##family) \
+        if (replaced) { \
+            glatter_retire_((glatter_retired_t*)(void*)replaced - 1, NULL); \
+        } \
+        glatter_reclaim_(1); \
+    }
+
 #if defined(GLATTER_GL)
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_ges_def.h)
+GLATTER_CALL_HOOK_MASK(GL)
 #endif
 #if defined(GLATTER_GLX)
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_ges_def.h)
+GLATTER_CALL_HOOK_MASK(GLX)
 #endif
 #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_ges_def.h)
+GLATTER_CALL_HOOK_MASK(EGL)
 #endif
 #if defined(GLATTER_WGL)
-    #include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_ges_def.h)
+GLATTER_CALL_HOOK_MASK(WGL)
+#endif
+#if defined(GLATTER_GLU)
+GLATTER_CALL_HOOK_MASK(GLU)
 #endif
 
-/* Optional convenience to invalidate all families' caches available in this build. */
+#undef GLATTER_CALL_HOOK_MASK
+#undef GLATTER_SWAP_CALL_HOOKS
+
+/* Optional convenience to invalidate all families' caches available in this
+ * build, including the function availability sets. */
 GLATTER_INLINE_OR_NOT void glatter_invalidate_all_extension_caches(void) {
 #if defined(GLATTER_GL)
     glatter_invalidate_extension_cache_GL();
@@ -1965,6 +5080,16 @@ GLATTER_INLINE_OR_NOT void glatter_invalidate_all_extension_caches(void) {
 #endif
 #if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
     glatter_invalidate_extension_cache_EGL();
+    glatter_invalidate_available_functions_EGL_();
+#endif
+#if defined(GLATTER_GL)
+    glatter_invalidate_available_functions_GL_();
+#endif
+#if defined(GLATTER_GLX)
+    glatter_invalidate_available_functions_GLX_();
+#endif
+#if defined(GLATTER_WGL)
+    glatter_invalidate_available_functions_WGL_();
 #endif
 }
 
@@ -1986,10 +5111,10 @@ GLATTER_INLINE_OR_NOT void glatter_invalidate_all_extension_caches(void) {
 
 #if defined(GLATTER_EGL) && !GLATTER_HAS_EGL_GENERATED_HEADERS
 
-GLATTER_INLINE_OR_NOT glatter_extension_support_status_EGL_t glatter_get_extension_support_EGL(void)
+GLATTER_INLINE_OR_NOT const glatter_extension_support_status_EGL_t* glatter_get_extension_support_EGL(void)
 {
-    glatter_extension_support_status_EGL_t status = {0};
-    return status;
+    static const glatter_extension_support_status_EGL_t none = {{0}};
+    return &none;
 }
 
 GLATTER_INLINE_OR_NOT const char* enum_to_string_EGL(GLATTER_ENUM_EGL e)
@@ -2000,6 +5125,212 @@ GLATTER_INLINE_OR_NOT const char* enum_to_string_EGL(GLATTER_ENUM_EGL e)
 
 #endif
 
+#if defined(GLATTER_SHARED_REGISTRY)
+
+#if defined(__GLIBC__) && !defined(__USE_GNU)
+#  error "GLATTER_SHARED_REGISTRY needs dl_iterate_phdr(): define _GNU_SOURCE before any system header."
+#endif
+
+typedef struct glatter_registry_scan {
+    char**    names;   /* heap copies of the loaded objects' names; "" is the program */
+    size_t    count;
+    size_t    capacity;
+    uintptr_t address; /* when looking for the object that contains an address */
+    char*     owner;
+} glatter_registry_scan;
+
+static int glatter_registry_collect_(struct dl_phdr_info* info, size_t size, void* data)
+{
+    (void)size;
+    glatter_registry_scan* scan = (glatter_registry_scan*)data;
+    if (scan->count == scan->capacity) {
+        size_t capacity = scan->capacity ? 2 * scan->capacity : 64;
+        char** names = (char**)realloc(scan->names, capacity * sizeof(char*));
+        if (!names) {
+            return 1;
+        }
+        scan->names = names;
+        scan->capacity = capacity;
+    }
+    const char* name = info->dlpi_name ? info->dlpi_name : "";
+    size_t length = strlen(name) + 1;
+    char* copy = (char*)malloc(length);
+    if (copy) {
+        memcpy(copy, name, length);
+        scan->names[scan->count++] = copy;
+    }
+    return 0;
+}
+
+static int glatter_registry_find_owner_(struct dl_phdr_info* info, size_t size, void* data)
+{
+    (void)size;
+    glatter_registry_scan* scan = (glatter_registry_scan*)data;
+    for (ElfW(Half) i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr)* ph = &info->dlpi_phdr[i];
+        uintptr_t begin = (uintptr_t)info->dlpi_addr + (uintptr_t)ph->p_vaddr;
+        if (ph->p_type == PT_LOAD && scan->address - begin < (uintptr_t)ph->p_memsz) {
+            if (info->dlpi_name && *info->dlpi_name) {
+                size_t length = strlen(info->dlpi_name) + 1;
+                scan->owner = (char*)malloc(length);
+                if (scan->owner) {
+                    memcpy(scan->owner, info->dlpi_name, length);
+                }
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* The root of the instance whose registry is 'candidate', if it is compatible
+ * and has joined already. An instance that has not joined yet is loaded later
+ * than this one and will find the root itself. */
+static glatter_registry* glatter_registry_root_of_(glatter_registry* candidate)
+{
+    if (!candidate || candidate == &glatter_registry_v1) {
+        return NULL;
+    }
+    if (candidate->abi != GLATTER_REGISTRY_ABI || candidate->size < sizeof(glatter_registry)) {
+        return NULL;
+    }
+    return (glatter_registry*)GLATTER_ATOMIC_LOAD(candidate->root);
+}
+
+static glatter_registry* glatter_registry_discover_(void)
+{
+    glatter_registry_scan scan;
+    memset(&scan, 0, sizeof(scan));
+    dl_iterate_phdr(glatter_registry_collect_, &scan);
+
+    /* The object list is copied first: dlopen() must not run inside the
+     * iteration, which holds the loader's lock. */
+    glatter_registry* root = NULL;
+    for (size_t i = 0; i < scan.count; ++i) {
+        if (!root) {
+            void* handle = dlopen(scan.names[i][0] ? scan.names[i] : NULL, RTLD_LAZY | RTLD_NOLOAD);
+            if (handle) {
+                root = glatter_registry_root_of_((glatter_registry*)dlsym(handle, "glatter_registry_v1"));
+                dlclose(handle);
+            }
+        }
+        free(scan.names[i]);
+    }
+    free(scan.names);
+
+    if (root) {
+        /* Calls will be made into the root's object: keep it loaded. */
+        memset(&scan, 0, sizeof(scan));
+        scan.address = (uintptr_t)root;
+        dl_iterate_phdr(glatter_registry_find_owner_, &scan);
+        if (scan.owner) {
+            (void)dlopen(scan.owner, RTLD_LAZY | RTLD_NOLOAD | RTLD_NODELETE);
+            free(scan.owner);
+        }
+    }
+    return root;
+}
+
+#if defined(GLATTER_HEADER_ONLY) && !defined(GLATTER_EAGER)
+#  define GLATTER_REGISTRY_TABLE(family) glatter_fn_table_##family
+#else
+#  define GLATTER_REGISTRY_TABLE(family) NULL
+#endif
+
+#define GLATTER_REGISTRY_PUBLISH(family, support, invalidate) \
+    self->families[GLATTER_REGISTRY_##family].count = GLATTER_FN_COUNT_##family; \
+    self->families[GLATTER_REGISTRY_##family].layout = GLATTER_FN_LAYOUT_##family; \
+    self->families[GLATTER_REGISTRY_##family].table = GLATTER_REGISTRY_TABLE(family); \
+    self->families[GLATTER_REGISTRY_##family].extension_support = (void (*)(void))(support); \
+    self->families[GLATTER_REGISTRY_##family].invalidate_extensions = (invalidate);
+
+#if defined(GLATTER_HEADER_ONLY) && !defined(GLATTER_EAGER)
+#  define GLATTER_REGISTRY_ADOPT(family) \
+    { \
+        glatter_registry_family* shared = GLATTER_REGISTRY_FAMILY(family); \
+        if (shared && shared->table) { \
+            glatter_fn_slots_##family = shared->table; \
+        } \
+    }
+#else
+#  define GLATTER_REGISTRY_ADOPT(family)
+#endif
+
+/* Fills in this instance's registry, finds the root and publishes it. Runs
+ * from a load-time constructor, or on first use if that comes earlier. */
+static GLATTER_COLD glatter_registry* glatter_registry_join_(void)
+{
+    glatter_registry* self = &glatter_registry_v1;
+    self->phase = &glatter_loader_state_get()->phase;
+    self->missing_generation = &glatter_missing_generation;
+    self->log_handler = &glatter_log_handler_state;
+    self->get_proc_address = glatter_get_proc_address;
+    self->set_wsi = glatter_set_wsi;
+    self->get_wsi = glatter_get_wsi;
+    self->set_proc_address_provider = glatter_set_proc_address_provider;
+    self->set_library_path = glatter_set_library_path;
+    self->set_dlopen_policy = glatter_set_dlopen_policy;
+    self->set_log_handler = glatter_set_log_handler;
+    self->get_configuration_stats = glatter_get_configuration_stats;
+    self->context_destroyed = glatter_context_destroyed_;
+    self->context_made_current = glatter_context_made_current_;
+#if defined(GLATTER_GL)
+    GLATTER_REGISTRY_PUBLISH(GL, glatter_get_extension_support_GL, glatter_invalidate_extension_cache_GL)
+#endif
+#if defined(GLATTER_GLX)
+    GLATTER_REGISTRY_PUBLISH(GLX, glatter_get_extension_support_GLX, glatter_invalidate_extension_cache_GLX)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    GLATTER_REGISTRY_PUBLISH(EGL, glatter_get_extension_support_EGL, glatter_invalidate_extension_cache_EGL)
+#endif
+#if defined(GLATTER_WGL)
+    GLATTER_REGISTRY_PUBLISH(WGL, glatter_get_extension_support_WGL, glatter_invalidate_extension_cache_WGL)
+#endif
+#if defined(GLATTER_GLU)
+    GLATTER_REGISTRY_PUBLISH(GLU, NULL, NULL)
+#endif
+
+    glatter_registry* root = glatter_registry_discover_();
+    void* expected = NULL;
+    if (!GLATTER_ATOMIC_CAS(self->root, expected, (void*)(root ? root : self))) {
+        return (glatter_registry*)expected; /* joined concurrently */
+    }
+    if (!root) {
+        return self;
+    }
+#if defined(GLATTER_GL)
+    GLATTER_REGISTRY_ADOPT(GL)
+#endif
+#if defined(GLATTER_GLX)
+    GLATTER_REGISTRY_ADOPT(GLX)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+    GLATTER_REGISTRY_ADOPT(EGL)
+#endif
+#if defined(GLATTER_WGL)
+    GLATTER_REGISTRY_ADOPT(WGL)
+#endif
+#if defined(GLATTER_GLU)
+    GLATTER_REGISTRY_ADOPT(GLU)
+#endif
+    return root;
+}
+
+#undef GLATTER_REGISTRY_TABLE
+#undef GLATTER_REGISTRY_PUBLISH
+#undef GLATTER_REGISTRY_ADOPT
+
+/* Joins while the object is being loaded, when the loader runs one object's
+ * constructors at a time. Header-only builds have one per translation unit;
+ * all but the first find the instance joined. */
+__attribute__((constructor))
+static void glatter_registry_constructor_(void)
+{
+    (void)glatter_registry_root_();
+}
+
+#endif
+
 
 #if defined(__llvm__) || defined (__clang__)
     #pragma clang diagnostic pop
@@ -2008,6 +5339,13 @@ GLATTER_INLINE_OR_NOT const char* enum_to_string_EGL(GLATTER_ENUM_EGL e)
 #endif
 
 
+/* Every process-scoped object is declared by now, including the
+ * link-once entry points of GLATTER_EAGER header-only builds. */
+#undef GLATTER_LINKONCE
+#undef GLATTER_LINKONCE_FN
+#undef GLATTER_LINKONCE_STORAGE
+#undef GLATTER_LINKONCE_DECORATION
+
 #if defined(_MSC_VER)
 #  pragma warning(pop)
 #endif
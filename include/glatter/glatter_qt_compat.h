@@ -130,3 +130,22 @@
 #    undef Unsorted
 #  endif
 #endif
+
+/*
+ * Qt owns context creation, so let it resolve entry points as well. Include <QOpenGLContext> before glatter
+ * and call glatter_use_qt_proc_address() before the first GL call.
+ */
+#if defined(__cplusplus) && defined(QOPENGLCONTEXT_H) && !defined(GLATTER_QT_PROC_ADDRESS_DEFINED)
+#define GLATTER_QT_PROC_ADDRESS_DEFINED
+static inline void* glatter_qt_proc_address_(const char* function_name, void* user_data)
+{
+    (void)user_data;
+    QOpenGLContext* context = QOpenGLContext::currentContext();
+    return context ? reinterpret_cast<void*>(context->getProcAddress(function_name)) : 0;
+}
+
+static inline int glatter_use_qt_proc_address(void)
+{
+    return glatter_set_proc_address_provider(glatter_qt_proc_address_, 0);
+}
+#endif
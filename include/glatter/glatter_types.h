@@ -0,0 +1,110 @@
+#ifndef GLATTER_TYPES_H_DEFINED
+#define GLATTER_TYPES_H_DEFINED
+
+/* Types, constants and entry point indices of the public API. glatter.h
+ * includes this for applications; glatter_def.h includes it too, since
+ * compiled builds include glatter_def.h without glatter.h. */
+
+#include <inttypes.h>
+
+#define GLATTER_str(s) #s
+#define GLATTER_xstr(s) GLATTER_str(s)
+#define GLATTER_PDIR(pd) platforms/pd
+
+/* Resolves one entry point by name; see glatter_set_proc_address_provider(). */
+typedef void* (*glatter_proc_address_provider_fn)(const char* function_name, void* user_data);
+
+/* Libraries and dlopen flags for glatter_set_library_path() and
+ * glatter_set_dlopen_policy() (POSIX). */
+#define GLATTER_LIBRARY_GL     0
+#define GLATTER_LIBRARY_EGL    1
+#define GLATTER_LIBRARY_GLES   2
+#define GLATTER_LIBRARY_COUNT  3
+#define GLATTER_DLOPEN_LAZY    0
+#define GLATTER_DLOPEN_NOW     1
+#define GLATTER_DLOPEN_NOLOAD  2
+
+/* Entry point families, as reported to call hooks. */
+#define GLATTER_FAMILY_GL      0
+#define GLATTER_FAMILY_GLX     1
+#define GLATTER_FAMILY_EGL     2
+#define GLATTER_FAMILY_WGL     3
+#define GLATTER_FAMILY_GLU     4
+#define GLATTER_FAMILY_COUNT   5
+
+/* Filled by glatter_get_configuration_stats(). Only threads that reach the
+ * process configuration while another thread holds it are counted. */
+typedef struct glatter_configuration_stats {
+    uint64_t waits;      /* calls that had to wait for the deciding thread */
+    uint64_t spins;      /* turns those calls spent spinning before blocking */
+    uint64_t blocks;     /* times a waiter blocked until the outcome was published */
+    uint64_t blocked_ns; /* time spent waiting, spinning included */
+} glatter_configuration_stats_t;
+
+/* A call as seen by the hooks of glatter_set_call_hooks(). The arguments and
+ * the return value are passed by address and only valid during the hook. */
+typedef struct glatter_call {
+    int                family;   /* GLATTER_FAMILY_<F> */
+    int                function; /* GLATTER_FN_<name> of that family */
+    const char*        name;
+    int                argc;
+    const void* const* args;     /* address of each argument, in order */
+    void*              result;   /* address of the return value in the post hook, else NULL */
+} glatter_call_t;
+
+typedef void (*glatter_call_hook_fn)(const glatter_call_t* call, void* user_data);
+
+/* One entry of the glatter_layer_v1 table that a layer listed in GLATTER_LAYERS
+ * exports. The table ends with an entry whose name is NULL. */
+typedef struct glatter_layer_entry {
+    const char* name;     /* entry point the layer intercepts */
+    void*       function; /* the layer's replacement for it */
+    void**      next;     /* receives the entry point the replacement calls on */
+} glatter_layer_entry_t;
+
+#if defined(GLATTER_EAGER)
+#ifndef GLATTER_INIT_REPORT_NAMES
+#define GLATTER_INIT_REPORT_NAMES 32
+#endif
+
+/* Outcome of glatter_init_<family>(). */
+typedef struct glatter_init_report {
+    unsigned    resolved;  /* entry points bound to the driver */
+    unsigned    missing;   /* entry points the driver did not provide */
+    const char* missing_names[GLATTER_INIT_REPORT_NAMES]; /* the first missing ones */
+} glatter_init_report_t;
+#endif
+
+/* GLATTER_FN_<name>: dense index of each entry point within its family. */
+#if defined(GLATTER_GL)
+	#include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GL_fn.h)
+#endif
+#if defined(GLATTER_GLX)
+	#include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLX_fn.h)
+#endif
+#if defined(GLATTER_EGL) && GLATTER_HAS_EGL_GENERATED_HEADERS
+	#include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_EGL_fn.h)
+#endif
+#if defined(GLATTER_WGL)
+	#include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_WGL_fn.h)
+#endif
+#if defined(GLATTER_GLU)
+	#include GLATTER_xstr(GLATTER_PDIR(GLATTER_PLATFORM_DIR)/glatter_GLU_fn.h)
+#endif
+
+/* Bitmaps of glatter_query_available_functions_<family>(): one bit per
+ * GLATTER_FN_<name> of the family. */
+#define GLATTER_FN_BITMAP_WORDS(family) ((GLATTER_FN_COUNT_##family + 31) / 32)
+#define GLATTER_FN_BITMAP_TEST(bitmap, fn) ((int)(((bitmap)[(fn) >> 5] >> ((fn) & 31)) & 1u))
+
+/* Trailing parameters of the make-current and destroy wrappers: the call
+ * site, where calls are logged or checked. */
+#if defined(GLATTER_LOG_ERRORS) || defined(GLATTER_LOG_CALLS)
+    #define GLATTER_CALL_SITE_PARAMS , const char* file, int line
+    #define GLATTER_CALL_SITE , __FILE__, __LINE__
+#else
+    #define GLATTER_CALL_SITE_PARAMS
+    #define GLATTER_CALL_SITE
+#endif
+
+#endif
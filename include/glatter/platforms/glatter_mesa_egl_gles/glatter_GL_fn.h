@@ -0,0 +1,1116 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Dense index of every GL entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_GL {
+    GLATTER_FN_glDrawArrays,
+    GLATTER_FN_glDrawElements,
+    GLATTER_FN_glDrawArraysInstanced,
+    GLATTER_FN_glDrawElementsInstanced,
+    GLATTER_FN_glDrawRangeElements,
+    GLATTER_FN_glDrawElementsBaseVertex,
+    GLATTER_FN_glDrawElementsInstancedBaseVertex,
+    GLATTER_FN_glDrawArraysIndirect,
+    GLATTER_FN_glDrawElementsIndirect,
+    GLATTER_FN_glBindVertexArray,
+    GLATTER_FN_glBindBuffer,
+    GLATTER_FN_glBindBufferBase,
+    GLATTER_FN_glBindBufferRange,
+    GLATTER_FN_glBindTexture,
+    GLATTER_FN_glBindSampler,
+    GLATTER_FN_glBindFramebuffer,
+    GLATTER_FN_glBindRenderbuffer,
+    GLATTER_FN_glBindImageTexture,
+    GLATTER_FN_glUseProgram,
+    GLATTER_FN_glBindProgramPipeline,
+    GLATTER_FN_glUniform1i,
+    GLATTER_FN_glUniform1f,
+    GLATTER_FN_glUniform2f,
+    GLATTER_FN_glUniform3f,
+    GLATTER_FN_glUniform4f,
+    GLATTER_FN_glUniform1iv,
+    GLATTER_FN_glUniform1fv,
+    GLATTER_FN_glUniform2fv,
+    GLATTER_FN_glUniform3fv,
+    GLATTER_FN_glUniform4fv,
+    GLATTER_FN_glUniformMatrix3fv,
+    GLATTER_FN_glUniformMatrix4fv,
+    GLATTER_FN_glActiveTexture,
+    GLATTER_FN_glBufferData,
+    GLATTER_FN_glBufferSubData,
+    GLATTER_FN_glMapBufferRange,
+    GLATTER_FN_glUnmapBuffer,
+    GLATTER_FN_glFlushMappedBufferRange,
+    GLATTER_FN_glTexSubImage2D,
+    GLATTER_FN_glTexImage2D,
+    GLATTER_FN_glEnable,
+    GLATTER_FN_glDisable,
+    GLATTER_FN_glEnableVertexAttribArray,
+    GLATTER_FN_glDisableVertexAttribArray,
+    GLATTER_FN_glVertexAttribPointer,
+    GLATTER_FN_glVertexAttribIPointer,
+    GLATTER_FN_glVertexAttribDivisor,
+    GLATTER_FN_glBlendFunc,
+    GLATTER_FN_glBlendFuncSeparate,
+    GLATTER_FN_glBlendEquation,
+    GLATTER_FN_glDepthFunc,
+    GLATTER_FN_glDepthMask,
+    GLATTER_FN_glColorMask,
+    GLATTER_FN_glStencilFunc,
+    GLATTER_FN_glStencilOp,
+    GLATTER_FN_glStencilMask,
+    GLATTER_FN_glCullFace,
+    GLATTER_FN_glScissor,
+    GLATTER_FN_glViewport,
+    GLATTER_FN_glPolygonOffset,
+    GLATTER_FN_glLineWidth,
+    GLATTER_FN_glClear,
+    GLATTER_FN_glClearColor,
+    GLATTER_FN_glClearDepthf,
+    GLATTER_FN_glClearStencil,
+    GLATTER_FN_glClearBufferfv,
+    GLATTER_FN_glInvalidateFramebuffer,
+    GLATTER_FN_glBlitFramebuffer,
+    GLATTER_FN_glGetError,
+    GLATTER_FN_glGetIntegerv,
+    GLATTER_FN_glFenceSync,
+    GLATTER_FN_glClientWaitSync,
+    GLATTER_FN_glWaitSync,
+    GLATTER_FN_glDeleteSync,
+    GLATTER_FN_glFlush,
+    GLATTER_FN_glFinish,
+    GLATTER_FN_glAcquireKeyedMutexWin32EXT,
+    GLATTER_FN_glActiveShaderProgram,
+    GLATTER_FN_glActiveShaderProgramEXT,
+    GLATTER_FN_glAlphaFunc,
+    GLATTER_FN_glAlphaFuncQCOM,
+    GLATTER_FN_glAlphaFuncx,
+    GLATTER_FN_glAlphaFuncxOES,
+    GLATTER_FN_glApplyFramebufferAttachmentCMAAINTEL,
+    GLATTER_FN_glAttachShader,
+    GLATTER_FN_glBeginConditionalRenderNV,
+    GLATTER_FN_glBeginPerfMonitorAMD,
+    GLATTER_FN_glBeginPerfQueryINTEL,
+    GLATTER_FN_glBeginQuery,
+    GLATTER_FN_glBeginQueryEXT,
+    GLATTER_FN_glBeginTransformFeedback,
+    GLATTER_FN_glBindAttribLocation,
+    GLATTER_FN_glBindFragDataLocationEXT,
+    GLATTER_FN_glBindFragDataLocationIndexedEXT,
+    GLATTER_FN_glBindFramebufferOES,
+    GLATTER_FN_glBindProgramPipelineEXT,
+    GLATTER_FN_glBindRenderbufferOES,
+    GLATTER_FN_glBindShadingRateImageNV,
+    GLATTER_FN_glBindTransformFeedback,
+    GLATTER_FN_glBindVertexArrayOES,
+    GLATTER_FN_glBindVertexBuffer,
+    GLATTER_FN_glBlendBarrier,
+    GLATTER_FN_glBlendBarrierKHR,
+    GLATTER_FN_glBlendBarrierNV,
+    GLATTER_FN_glBlendColor,
+    GLATTER_FN_glBlendEquationOES,
+    GLATTER_FN_glBlendEquationSeparate,
+    GLATTER_FN_glBlendEquationSeparateOES,
+    GLATTER_FN_glBlendEquationSeparatei,
+    GLATTER_FN_glBlendEquationSeparateiEXT,
+    GLATTER_FN_glBlendEquationSeparateiOES,
+    GLATTER_FN_glBlendEquationi,
+    GLATTER_FN_glBlendEquationiEXT,
+    GLATTER_FN_glBlendEquationiOES,
+    GLATTER_FN_glBlendFuncSeparateOES,
+    GLATTER_FN_glBlendFuncSeparatei,
+    GLATTER_FN_glBlendFuncSeparateiEXT,
+    GLATTER_FN_glBlendFuncSeparateiOES,
+    GLATTER_FN_glBlendFunci,
+    GLATTER_FN_glBlendFunciEXT,
+    GLATTER_FN_glBlendFunciOES,
+    GLATTER_FN_glBlendParameteriNV,
+    GLATTER_FN_glBlitFramebufferANGLE,
+    GLATTER_FN_glBlitFramebufferLayerEXT,
+    GLATTER_FN_glBlitFramebufferLayersEXT,
+    GLATTER_FN_glBlitFramebufferNV,
+    GLATTER_FN_glBufferAttachMemoryNV,
+    GLATTER_FN_glBufferPageCommitmentMemNV,
+    GLATTER_FN_glBufferStorageEXT,
+    GLATTER_FN_glBufferStorageExternalEXT,
+    GLATTER_FN_glBufferStorageMemEXT,
+    GLATTER_FN_glCheckFramebufferStatus,
+    GLATTER_FN_glCheckFramebufferStatusOES,
+    GLATTER_FN_glClearBufferfi,
+    GLATTER_FN_glClearBufferiv,
+    GLATTER_FN_glClearBufferuiv,
+    GLATTER_FN_glClearColorx,
+    GLATTER_FN_glClearColorxOES,
+    GLATTER_FN_glClearDepthfOES,
+    GLATTER_FN_glClearDepthx,
+    GLATTER_FN_glClearDepthxOES,
+    GLATTER_FN_glClearPixelLocalStorageuiEXT,
+    GLATTER_FN_glClearTexImageEXT,
+    GLATTER_FN_glClearTexSubImageEXT,
+    GLATTER_FN_glClientActiveTexture,
+    GLATTER_FN_glClientWaitSyncAPPLE,
+    GLATTER_FN_glClipControlEXT,
+    GLATTER_FN_glClipPlanef,
+    GLATTER_FN_glClipPlanefIMG,
+    GLATTER_FN_glClipPlanefOES,
+    GLATTER_FN_glClipPlanex,
+    GLATTER_FN_glClipPlanexIMG,
+    GLATTER_FN_glClipPlanexOES,
+    GLATTER_FN_glColor4f,
+    GLATTER_FN_glColor4ub,
+    GLATTER_FN_glColor4x,
+    GLATTER_FN_glColor4xOES,
+    GLATTER_FN_glColorMaski,
+    GLATTER_FN_glColorMaskiEXT,
+    GLATTER_FN_glColorMaskiOES,
+    GLATTER_FN_glColorPointer,
+    GLATTER_FN_glCompileShader,
+    GLATTER_FN_glCompressedTexImage2D,
+    GLATTER_FN_glCompressedTexImage3D,
+    GLATTER_FN_glCompressedTexImage3DOES,
+    GLATTER_FN_glCompressedTexSubImage2D,
+    GLATTER_FN_glCompressedTexSubImage3D,
+    GLATTER_FN_glCompressedTexSubImage3DOES,
+    GLATTER_FN_glConservativeRasterParameteriNV,
+    GLATTER_FN_glCopyBufferSubData,
+    GLATTER_FN_glCopyBufferSubDataNV,
+    GLATTER_FN_glCopyImageSubData,
+    GLATTER_FN_glCopyImageSubDataEXT,
+    GLATTER_FN_glCopyImageSubDataOES,
+    GLATTER_FN_glCopyPathNV,
+    GLATTER_FN_glCopyTexImage2D,
+    GLATTER_FN_glCopyTexSubImage2D,
+    GLATTER_FN_glCopyTexSubImage3D,
+    GLATTER_FN_glCopyTexSubImage3DOES,
+    GLATTER_FN_glCopyTextureLevelsAPPLE,
+    GLATTER_FN_glCoverFillPathInstancedNV,
+    GLATTER_FN_glCoverFillPathNV,
+    GLATTER_FN_glCoverStrokePathInstancedNV,
+    GLATTER_FN_glCoverStrokePathNV,
+    GLATTER_FN_glCoverageMaskNV,
+    GLATTER_FN_glCoverageModulationNV,
+    GLATTER_FN_glCoverageModulationTableNV,
+    GLATTER_FN_glCoverageOperationNV,
+    GLATTER_FN_glCreateMemoryObjectsEXT,
+    GLATTER_FN_glCreatePerfQueryINTEL,
+    GLATTER_FN_glCreateProgram,
+    GLATTER_FN_glCreateSemaphoresNV,
+    GLATTER_FN_glCreateShader,
+    GLATTER_FN_glCreateShaderProgramv,
+    GLATTER_FN_glCreateShaderProgramvEXT,
+    GLATTER_FN_glCurrentPaletteMatrixOES,
+    GLATTER_FN_glDebugMessageCallback,
+    GLATTER_FN_glDebugMessageCallbackKHR,
+    GLATTER_FN_glDebugMessageControl,
+    GLATTER_FN_glDebugMessageControlKHR,
+    GLATTER_FN_glDebugMessageInsert,
+    GLATTER_FN_glDebugMessageInsertKHR,
+    GLATTER_FN_glDeleteBuffers,
+    GLATTER_FN_glDeleteFencesNV,
+    GLATTER_FN_glDeleteFramebuffers,
+    GLATTER_FN_glDeleteFramebuffersOES,
+    GLATTER_FN_glDeleteMemoryObjectsEXT,
+    GLATTER_FN_glDeletePathsNV,
+    GLATTER_FN_glDeletePerfMonitorsAMD,
+    GLATTER_FN_glDeletePerfQueryINTEL,
+    GLATTER_FN_glDeleteProgram,
+    GLATTER_FN_glDeleteProgramPipelines,
+    GLATTER_FN_glDeleteProgramPipelinesEXT,
+    GLATTER_FN_glDeleteQueries,
+    GLATTER_FN_glDeleteQueriesEXT,
+    GLATTER_FN_glDeleteRenderbuffers,
+    GLATTER_FN_glDeleteRenderbuffersOES,
+    GLATTER_FN_glDeleteSamplers,
+    GLATTER_FN_glDeleteSemaphoresEXT,
+    GLATTER_FN_glDeleteShader,
+    GLATTER_FN_glDeleteSyncAPPLE,
+    GLATTER_FN_glDeleteTextures,
+    GLATTER_FN_glDeleteTransformFeedbacks,
+    GLATTER_FN_glDeleteVertexArrays,
+    GLATTER_FN_glDeleteVertexArraysOES,
+    GLATTER_FN_glDepthRangeArrayfvNV,
+    GLATTER_FN_glDepthRangeArrayfvOES,
+    GLATTER_FN_glDepthRangeIndexedfNV,
+    GLATTER_FN_glDepthRangeIndexedfOES,
+    GLATTER_FN_glDepthRangef,
+    GLATTER_FN_glDepthRangefOES,
+    GLATTER_FN_glDepthRangex,
+    GLATTER_FN_glDepthRangexOES,
+    GLATTER_FN_glDetachShader,
+    GLATTER_FN_glDisableClientState,
+    GLATTER_FN_glDisableDriverControlQCOM,
+    GLATTER_FN_glDisablei,
+    GLATTER_FN_glDisableiEXT,
+    GLATTER_FN_glDisableiNV,
+    GLATTER_FN_glDisableiOES,
+    GLATTER_FN_glDiscardFramebufferEXT,
+    GLATTER_FN_glDispatchCompute,
+    GLATTER_FN_glDispatchComputeIndirect,
+    GLATTER_FN_glDrawArraysInstancedANGLE,
+    GLATTER_FN_glDrawArraysInstancedBaseInstanceEXT,
+    GLATTER_FN_glDrawArraysInstancedEXT,
+    GLATTER_FN_glDrawArraysInstancedNV,
+    GLATTER_FN_glDrawBuffers,
+    GLATTER_FN_glDrawBuffersEXT,
+    GLATTER_FN_glDrawBuffersIndexedEXT,
+    GLATTER_FN_glDrawBuffersNV,
+    GLATTER_FN_glDrawElementsBaseVertexEXT,
+    GLATTER_FN_glDrawElementsBaseVertexOES,
+    GLATTER_FN_glDrawElementsInstancedANGLE,
+    GLATTER_FN_glDrawElementsInstancedBaseInstanceEXT,
+    GLATTER_FN_glDrawElementsInstancedBaseVertexBaseInstanceEXT,
+    GLATTER_FN_glDrawElementsInstancedBaseVertexEXT,
+    GLATTER_FN_glDrawElementsInstancedBaseVertexOES,
+    GLATTER_FN_glDrawElementsInstancedEXT,
+    GLATTER_FN_glDrawElementsInstancedNV,
+    GLATTER_FN_glDrawMeshTasksEXT,
+    GLATTER_FN_glDrawMeshTasksIndirectEXT,
+    GLATTER_FN_glDrawMeshTasksIndirectNV,
+    GLATTER_FN_glDrawMeshTasksNV,
+    GLATTER_FN_glDrawRangeElementsBaseVertex,
+    GLATTER_FN_glDrawRangeElementsBaseVertexEXT,
+    GLATTER_FN_glDrawRangeElementsBaseVertexOES,
+    GLATTER_FN_glDrawTexfOES,
+    GLATTER_FN_glDrawTexfvOES,
+    GLATTER_FN_glDrawTexiOES,
+    GLATTER_FN_glDrawTexivOES,
+    GLATTER_FN_glDrawTexsOES,
+    GLATTER_FN_glDrawTexsvOES,
+    GLATTER_FN_glDrawTexxOES,
+    GLATTER_FN_glDrawTexxvOES,
+    GLATTER_FN_glDrawTransformFeedbackEXT,
+    GLATTER_FN_glDrawTransformFeedbackInstancedEXT,
+    GLATTER_FN_glDrawVkImageNV,
+    GLATTER_FN_glEGLImageTargetRenderbufferStorageOES,
+    GLATTER_FN_glEGLImageTargetTexStorageEXT,
+    GLATTER_FN_glEGLImageTargetTexture2DOES,
+    GLATTER_FN_glEGLImageTargetTextureStorageEXT,
+    GLATTER_FN_glEnableClientState,
+    GLATTER_FN_glEnableDriverControlQCOM,
+    GLATTER_FN_glEnablei,
+    GLATTER_FN_glEnableiEXT,
+    GLATTER_FN_glEnableiNV,
+    GLATTER_FN_glEnableiOES,
+    GLATTER_FN_glEndConditionalRenderNV,
+    GLATTER_FN_glEndPerfMonitorAMD,
+    GLATTER_FN_glEndPerfQueryINTEL,
+    GLATTER_FN_glEndQuery,
+    GLATTER_FN_glEndQueryEXT,
+    GLATTER_FN_glEndTilingQCOM,
+    GLATTER_FN_glEndTransformFeedback,
+    GLATTER_FN_glExtGetBufferPointervQCOM,
+    GLATTER_FN_glExtGetBuffersQCOM,
+    GLATTER_FN_glExtGetFramebuffersQCOM,
+    GLATTER_FN_glExtGetProgramBinarySourceQCOM,
+    GLATTER_FN_glExtGetProgramsQCOM,
+    GLATTER_FN_glExtGetRenderbuffersQCOM,
+    GLATTER_FN_glExtGetShadersQCOM,
+    GLATTER_FN_glExtGetTexLevelParameterivQCOM,
+    GLATTER_FN_glExtGetTexSubImageQCOM,
+    GLATTER_FN_glExtGetTexturesQCOM,
+    GLATTER_FN_glExtIsProgramBinaryQCOM,
+    GLATTER_FN_glExtTexObjectStateOverrideiQCOM,
+    GLATTER_FN_glExtrapolateTex2DQCOM,
+    GLATTER_FN_glFenceSyncAPPLE,
+    GLATTER_FN_glFinishFenceNV,
+    GLATTER_FN_glFlushMappedBufferRangeEXT,
+    GLATTER_FN_glFogf,
+    GLATTER_FN_glFogfv,
+    GLATTER_FN_glFogx,
+    GLATTER_FN_glFogxOES,
+    GLATTER_FN_glFogxv,
+    GLATTER_FN_glFogxvOES,
+    GLATTER_FN_glFragmentCoverageColorNV,
+    GLATTER_FN_glFramebufferFetchBarrierEXT,
+    GLATTER_FN_glFramebufferFetchBarrierQCOM,
+    GLATTER_FN_glFramebufferFoveationConfigQCOM,
+    GLATTER_FN_glFramebufferFoveationParametersQCOM,
+    GLATTER_FN_glFramebufferParameteri,
+    GLATTER_FN_glFramebufferParameteriMESA,
+    GLATTER_FN_glFramebufferPixelLocalStorageSizeEXT,
+    GLATTER_FN_glFramebufferRenderbuffer,
+    GLATTER_FN_glFramebufferRenderbufferOES,
+    GLATTER_FN_glFramebufferSampleLocationsfvNV,
+    GLATTER_FN_glFramebufferShadingRateEXT,
+    GLATTER_FN_glFramebufferTexture,
+    GLATTER_FN_glFramebufferTexture2D,
+    GLATTER_FN_glFramebufferTexture2DDownsampleIMG,
+    GLATTER_FN_glFramebufferTexture2DMultisampleEXT,
+    GLATTER_FN_glFramebufferTexture2DMultisampleIMG,
+    GLATTER_FN_glFramebufferTexture2DOES,
+    GLATTER_FN_glFramebufferTexture3DOES,
+    GLATTER_FN_glFramebufferTextureEXT,
+    GLATTER_FN_glFramebufferTextureLayer,
+    GLATTER_FN_glFramebufferTextureLayerDownsampleIMG,
+    GLATTER_FN_glFramebufferTextureMultisampleMultiviewOVR,
+    GLATTER_FN_glFramebufferTextureMultiviewOVR,
+    GLATTER_FN_glFramebufferTextureOES,
+    GLATTER_FN_glFrontFace,
+    GLATTER_FN_glFrustumf,
+    GLATTER_FN_glFrustumfOES,
+    GLATTER_FN_glFrustumx,
+    GLATTER_FN_glFrustumxOES,
+    GLATTER_FN_glGenBuffers,
+    GLATTER_FN_glGenFencesNV,
+    GLATTER_FN_glGenFramebuffers,
+    GLATTER_FN_glGenFramebuffersOES,
+    GLATTER_FN_glGenPathsNV,
+    GLATTER_FN_glGenPerfMonitorsAMD,
+    GLATTER_FN_glGenProgramPipelines,
+    GLATTER_FN_glGenProgramPipelinesEXT,
+    GLATTER_FN_glGenQueries,
+    GLATTER_FN_glGenQueriesEXT,
+    GLATTER_FN_glGenRenderbuffers,
+    GLATTER_FN_glGenRenderbuffersOES,
+    GLATTER_FN_glGenSamplers,
+    GLATTER_FN_glGenSemaphoresEXT,
+    GLATTER_FN_glGenTextures,
+    GLATTER_FN_glGenTransformFeedbacks,
+    GLATTER_FN_glGenVertexArrays,
+    GLATTER_FN_glGenVertexArraysOES,
+    GLATTER_FN_glGenerateMipmap,
+    GLATTER_FN_glGenerateMipmapOES,
+    GLATTER_FN_glGetActiveAttrib,
+    GLATTER_FN_glGetActiveUniform,
+    GLATTER_FN_glGetActiveUniformBlockName,
+    GLATTER_FN_glGetActiveUniformBlockiv,
+    GLATTER_FN_glGetActiveUniformsiv,
+    GLATTER_FN_glGetAttachedShaders,
+    GLATTER_FN_glGetAttribLocation,
+    GLATTER_FN_glGetBooleani_v,
+    GLATTER_FN_glGetBooleanv,
+    GLATTER_FN_glGetBufferParameteri64v,
+    GLATTER_FN_glGetBufferParameteriv,
+    GLATTER_FN_glGetBufferPointerv,
+    GLATTER_FN_glGetBufferPointervOES,
+    GLATTER_FN_glGetClipPlanef,
+    GLATTER_FN_glGetClipPlanefOES,
+    GLATTER_FN_glGetClipPlanex,
+    GLATTER_FN_glGetClipPlanexOES,
+    GLATTER_FN_glGetCoverageModulationTableNV,
+    GLATTER_FN_glGetDebugMessageLog,
+    GLATTER_FN_glGetDebugMessageLogKHR,
+    GLATTER_FN_glGetDriverControlStringQCOM,
+    GLATTER_FN_glGetDriverControlsQCOM,
+    GLATTER_FN_glGetFenceivNV,
+    GLATTER_FN_glGetFirstPerfQueryIdINTEL,
+    GLATTER_FN_glGetFixedv,
+    GLATTER_FN_glGetFixedvOES,
+    GLATTER_FN_glGetFloati_vNV,
+    GLATTER_FN_glGetFloati_vOES,
+    GLATTER_FN_glGetFloatv,
+    GLATTER_FN_glGetFragDataIndexEXT,
+    GLATTER_FN_glGetFragDataLocation,
+    GLATTER_FN_glGetFragmentShadingRatesEXT,
+    GLATTER_FN_glGetFramebufferAttachmentParameteriv,
+    GLATTER_FN_glGetFramebufferAttachmentParameterivOES,
+    GLATTER_FN_glGetFramebufferParameteriv,
+    GLATTER_FN_glGetFramebufferParameterivMESA,
+    GLATTER_FN_glGetFramebufferPixelLocalStorageSizeEXT,
+    GLATTER_FN_glGetGraphicsResetStatus,
+    GLATTER_FN_glGetGraphicsResetStatusEXT,
+    GLATTER_FN_glGetGraphicsResetStatusKHR,
+    GLATTER_FN_glGetImageHandleNV,
+    GLATTER_FN_glGetInteger64i_v,
+    GLATTER_FN_glGetInteger64v,
+    GLATTER_FN_glGetInteger64vAPPLE,
+    GLATTER_FN_glGetInteger64vEXT,
+    GLATTER_FN_glGetIntegeri_v,
+    GLATTER_FN_glGetIntegeri_vEXT,
+    GLATTER_FN_glGetInternalformatSampleivNV,
+    GLATTER_FN_glGetInternalformativ,
+    GLATTER_FN_glGetLightfv,
+    GLATTER_FN_glGetLightxv,
+    GLATTER_FN_glGetLightxvOES,
+    GLATTER_FN_glGetMaterialfv,
+    GLATTER_FN_glGetMaterialxv,
+    GLATTER_FN_glGetMaterialxvOES,
+    GLATTER_FN_glGetMemoryObjectDetachedResourcesuivNV,
+    GLATTER_FN_glGetMemoryObjectParameterivEXT,
+    GLATTER_FN_glGetMultisamplefv,
+    GLATTER_FN_glGetNextPerfQueryIdINTEL,
+    GLATTER_FN_glGetObjectLabel,
+    GLATTER_FN_glGetObjectLabelEXT,
+    GLATTER_FN_glGetObjectLabelKHR,
+    GLATTER_FN_glGetObjectPtrLabel,
+    GLATTER_FN_glGetObjectPtrLabelKHR,
+    GLATTER_FN_glGetPathCommandsNV,
+    GLATTER_FN_glGetPathCoordsNV,
+    GLATTER_FN_glGetPathDashArrayNV,
+    GLATTER_FN_glGetPathLengthNV,
+    GLATTER_FN_glGetPathMetricRangeNV,
+    GLATTER_FN_glGetPathMetricsNV,
+    GLATTER_FN_glGetPathParameterfvNV,
+    GLATTER_FN_glGetPathParameterivNV,
+    GLATTER_FN_glGetPathSpacingNV,
+    GLATTER_FN_glGetPerfCounterInfoINTEL,
+    GLATTER_FN_glGetPerfMonitorCounterDataAMD,
+    GLATTER_FN_glGetPerfMonitorCounterInfoAMD,
+    GLATTER_FN_glGetPerfMonitorCounterStringAMD,
+    GLATTER_FN_glGetPerfMonitorCountersAMD,
+    GLATTER_FN_glGetPerfMonitorGroupStringAMD,
+    GLATTER_FN_glGetPerfMonitorGroupsAMD,
+    GLATTER_FN_glGetPerfQueryDataINTEL,
+    GLATTER_FN_glGetPerfQueryIdByNameINTEL,
+    GLATTER_FN_glGetPerfQueryInfoINTEL,
+    GLATTER_FN_glGetPointerv,
+    GLATTER_FN_glGetPointervKHR,
+    GLATTER_FN_glGetProgramBinary,
+    GLATTER_FN_glGetProgramBinaryOES,
+    GLATTER_FN_glGetProgramInfoLog,
+    GLATTER_FN_glGetProgramInterfaceiv,
+    GLATTER_FN_glGetProgramPipelineInfoLog,
+    GLATTER_FN_glGetProgramPipelineInfoLogEXT,
+    GLATTER_FN_glGetProgramPipelineiv,
+    GLATTER_FN_glGetProgramPipelineivEXT,
+    GLATTER_FN_glGetProgramResourceIndex,
+    GLATTER_FN_glGetProgramResourceLocation,
+    GLATTER_FN_glGetProgramResourceLocationIndexEXT,
+    GLATTER_FN_glGetProgramResourceName,
+    GLATTER_FN_glGetProgramResourcefvNV,
+    GLATTER_FN_glGetProgramResourceiv,
+    GLATTER_FN_glGetProgramiv,
+    GLATTER_FN_glGetQueryObjecti64vEXT,
+    GLATTER_FN_glGetQueryObjectivEXT,
+    GLATTER_FN_glGetQueryObjectui64vEXT,
+    GLATTER_FN_glGetQueryObjectuiv,
+    GLATTER_FN_glGetQueryObjectuivEXT,
+    GLATTER_FN_glGetQueryiv,
+    GLATTER_FN_glGetQueryivEXT,
+    GLATTER_FN_glGetRenderbufferParameteriv,
+    GLATTER_FN_glGetRenderbufferParameterivOES,
+    GLATTER_FN_glGetSamplerParameterIiv,
+    GLATTER_FN_glGetSamplerParameterIivEXT,
+    GLATTER_FN_glGetSamplerParameterIivOES,
+    GLATTER_FN_glGetSamplerParameterIuiv,
+    GLATTER_FN_glGetSamplerParameterIuivEXT,
+    GLATTER_FN_glGetSamplerParameterIuivOES,
+    GLATTER_FN_glGetSamplerParameterfv,
+    GLATTER_FN_glGetSamplerParameteriv,
+    GLATTER_FN_glGetSemaphoreParameterivNV,
+    GLATTER_FN_glGetSemaphoreParameterui64vEXT,
+    GLATTER_FN_glGetShaderInfoLog,
+    GLATTER_FN_glGetShaderPrecisionFormat,
+    GLATTER_FN_glGetShaderSource,
+    GLATTER_FN_glGetShaderiv,
+    GLATTER_FN_glGetShadingRateImagePaletteNV,
+    GLATTER_FN_glGetShadingRateSampleLocationivNV,
+    GLATTER_FN_glGetString,
+    GLATTER_FN_glGetStringi,
+    GLATTER_FN_glGetSynciv,
+    GLATTER_FN_glGetSyncivAPPLE,
+    GLATTER_FN_glGetTexEnvfv,
+    GLATTER_FN_glGetTexEnviv,
+    GLATTER_FN_glGetTexEnvxv,
+    GLATTER_FN_glGetTexEnvxvOES,
+    GLATTER_FN_glGetTexGenfvOES,
+    GLATTER_FN_glGetTexGenivOES,
+    GLATTER_FN_glGetTexGenxvOES,
+    GLATTER_FN_glGetTexLevelParameterfv,
+    GLATTER_FN_glGetTexLevelParameteriv,
+    GLATTER_FN_glGetTexParameterIiv,
+    GLATTER_FN_glGetTexParameterIivEXT,
+    GLATTER_FN_glGetTexParameterIivOES,
+    GLATTER_FN_glGetTexParameterIuiv,
+    GLATTER_FN_glGetTexParameterIuivEXT,
+    GLATTER_FN_glGetTexParameterIuivOES,
+    GLATTER_FN_glGetTexParameterfv,
+    GLATTER_FN_glGetTexParameteriv,
+    GLATTER_FN_glGetTexParameterxv,
+    GLATTER_FN_glGetTexParameterxvOES,
+    GLATTER_FN_glGetTextureHandleIMG,
+    GLATTER_FN_glGetTextureHandleNV,
+    GLATTER_FN_glGetTextureSamplerHandleIMG,
+    GLATTER_FN_glGetTextureSamplerHandleNV,
+    GLATTER_FN_glGetTransformFeedbackVarying,
+    GLATTER_FN_glGetTranslatedShaderSourceANGLE,
+    GLATTER_FN_glGetUniformBlockIndex,
+    GLATTER_FN_glGetUniformIndices,
+    GLATTER_FN_glGetUniformLocation,
+    GLATTER_FN_glGetUniformfv,
+    GLATTER_FN_glGetUniformi64vNV,
+    GLATTER_FN_glGetUniformiv,
+    GLATTER_FN_glGetUniformuiv,
+    GLATTER_FN_glGetUnsignedBytei_vEXT,
+    GLATTER_FN_glGetUnsignedBytevEXT,
+    GLATTER_FN_glGetVertexAttribIiv,
+    GLATTER_FN_glGetVertexAttribIuiv,
+    GLATTER_FN_glGetVertexAttribPointerv,
+    GLATTER_FN_glGetVertexAttribfv,
+    GLATTER_FN_glGetVertexAttribiv,
+    GLATTER_FN_glGetVkProcAddrNV,
+    GLATTER_FN_glGetnUniformfv,
+    GLATTER_FN_glGetnUniformfvEXT,
+    GLATTER_FN_glGetnUniformfvKHR,
+    GLATTER_FN_glGetnUniformiv,
+    GLATTER_FN_glGetnUniformivEXT,
+    GLATTER_FN_glGetnUniformivKHR,
+    GLATTER_FN_glGetnUniformuiv,
+    GLATTER_FN_glGetnUniformuivKHR,
+    GLATTER_FN_glHint,
+    GLATTER_FN_glImportMemoryFdEXT,
+    GLATTER_FN_glImportMemoryWin32HandleEXT,
+    GLATTER_FN_glImportMemoryWin32NameEXT,
+    GLATTER_FN_glImportSemaphoreFdEXT,
+    GLATTER_FN_glImportSemaphoreWin32HandleEXT,
+    GLATTER_FN_glImportSemaphoreWin32NameEXT,
+    GLATTER_FN_glInsertEventMarkerEXT,
+    GLATTER_FN_glInterpolatePathsNV,
+    GLATTER_FN_glInvalidateSubFramebuffer,
+    GLATTER_FN_glIsBuffer,
+    GLATTER_FN_glIsEnabled,
+    GLATTER_FN_glIsEnabledi,
+    GLATTER_FN_glIsEnablediEXT,
+    GLATTER_FN_glIsEnablediNV,
+    GLATTER_FN_glIsEnablediOES,
+    GLATTER_FN_glIsFenceNV,
+    GLATTER_FN_glIsFramebuffer,
+    GLATTER_FN_glIsFramebufferOES,
+    GLATTER_FN_glIsImageHandleResidentNV,
+    GLATTER_FN_glIsMemoryObjectEXT,
+    GLATTER_FN_glIsPathNV,
+    GLATTER_FN_glIsPointInFillPathNV,
+    GLATTER_FN_glIsPointInStrokePathNV,
+    GLATTER_FN_glIsProgram,
+    GLATTER_FN_glIsProgramPipeline,
+    GLATTER_FN_glIsProgramPipelineEXT,
+    GLATTER_FN_glIsQuery,
+    GLATTER_FN_glIsQueryEXT,
+    GLATTER_FN_glIsRenderbuffer,
+    GLATTER_FN_glIsRenderbufferOES,
+    GLATTER_FN_glIsSampler,
+    GLATTER_FN_glIsSemaphoreEXT,
+    GLATTER_FN_glIsShader,
+    GLATTER_FN_glIsSync,
+    GLATTER_FN_glIsSyncAPPLE,
+    GLATTER_FN_glIsTexture,
+    GLATTER_FN_glIsTextureHandleResidentNV,
+    GLATTER_FN_glIsTransformFeedback,
+    GLATTER_FN_glIsVertexArray,
+    GLATTER_FN_glIsVertexArrayOES,
+    GLATTER_FN_glLabelObjectEXT,
+    GLATTER_FN_glLightModelf,
+    GLATTER_FN_glLightModelfv,
+    GLATTER_FN_glLightModelx,
+    GLATTER_FN_glLightModelxOES,
+    GLATTER_FN_glLightModelxv,
+    GLATTER_FN_glLightModelxvOES,
+    GLATTER_FN_glLightf,
+    GLATTER_FN_glLightfv,
+    GLATTER_FN_glLightx,
+    GLATTER_FN_glLightxOES,
+    GLATTER_FN_glLightxv,
+    GLATTER_FN_glLightxvOES,
+    GLATTER_FN_glLineWidthx,
+    GLATTER_FN_glLineWidthxOES,
+    GLATTER_FN_glLinkProgram,
+    GLATTER_FN_glLoadIdentity,
+    GLATTER_FN_glLoadMatrixf,
+    GLATTER_FN_glLoadMatrixx,
+    GLATTER_FN_glLoadMatrixxOES,
+    GLATTER_FN_glLoadPaletteFromModelViewMatrixOES,
+    GLATTER_FN_glLogicOp,
+    GLATTER_FN_glMakeImageHandleNonResidentNV,
+    GLATTER_FN_glMakeImageHandleResidentNV,
+    GLATTER_FN_glMakeTextureHandleNonResidentNV,
+    GLATTER_FN_glMakeTextureHandleResidentNV,
+    GLATTER_FN_glMapBufferOES,
+    GLATTER_FN_glMapBufferRangeEXT,
+    GLATTER_FN_glMaterialf,
+    GLATTER_FN_glMaterialfv,
+    GLATTER_FN_glMaterialx,
+    GLATTER_FN_glMaterialxOES,
+    GLATTER_FN_glMaterialxv,
+    GLATTER_FN_glMaterialxvOES,
+    GLATTER_FN_glMatrixFrustumEXT,
+    GLATTER_FN_glMatrixIndexPointerOES,
+    GLATTER_FN_glMatrixLoad3x2fNV,
+    GLATTER_FN_glMatrixLoad3x3fNV,
+    GLATTER_FN_glMatrixLoadIdentityEXT,
+    GLATTER_FN_glMatrixLoadTranspose3x3fNV,
+    GLATTER_FN_glMatrixLoadTransposedEXT,
+    GLATTER_FN_glMatrixLoadTransposefEXT,
+    GLATTER_FN_glMatrixLoaddEXT,
+    GLATTER_FN_glMatrixLoadfEXT,
+    GLATTER_FN_glMatrixMode,
+    GLATTER_FN_glMatrixMult3x2fNV,
+    GLATTER_FN_glMatrixMult3x3fNV,
+    GLATTER_FN_glMatrixMultTranspose3x3fNV,
+    GLATTER_FN_glMatrixMultTransposedEXT,
+    GLATTER_FN_glMatrixMultTransposefEXT,
+    GLATTER_FN_glMatrixMultdEXT,
+    GLATTER_FN_glMatrixMultfEXT,
+    GLATTER_FN_glMatrixOrthoEXT,
+    GLATTER_FN_glMatrixPopEXT,
+    GLATTER_FN_glMatrixPushEXT,
+    GLATTER_FN_glMatrixRotatedEXT,
+    GLATTER_FN_glMatrixRotatefEXT,
+    GLATTER_FN_glMatrixScaledEXT,
+    GLATTER_FN_glMatrixScalefEXT,
+    GLATTER_FN_glMatrixTranslatedEXT,
+    GLATTER_FN_glMatrixTranslatefEXT,
+    GLATTER_FN_glMaxActiveShaderCoresARM,
+    GLATTER_FN_glMaxShaderCompilerThreadsKHR,
+    GLATTER_FN_glMemoryBarrier,
+    GLATTER_FN_glMemoryBarrierByRegion,
+    GLATTER_FN_glMemoryObjectParameterivEXT,
+    GLATTER_FN_glMinSampleShading,
+    GLATTER_FN_glMinSampleShadingOES,
+    GLATTER_FN_glMultMatrixf,
+    GLATTER_FN_glMultMatrixx,
+    GLATTER_FN_glMultMatrixxOES,
+    GLATTER_FN_glMultiDrawArraysEXT,
+    GLATTER_FN_glMultiDrawArraysIndirectEXT,
+    GLATTER_FN_glMultiDrawElementsBaseVertexEXT,
+    GLATTER_FN_glMultiDrawElementsEXT,
+    GLATTER_FN_glMultiDrawElementsIndirectEXT,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectCountEXT,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectCountNV,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectEXT,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectNV,
+    GLATTER_FN_glMultiTexCoord4f,
+    GLATTER_FN_glMultiTexCoord4x,
+    GLATTER_FN_glMultiTexCoord4xOES,
+    GLATTER_FN_glNamedBufferAttachMemoryNV,
+    GLATTER_FN_glNamedBufferPageCommitmentMemNV,
+    GLATTER_FN_glNamedBufferStorageExternalEXT,
+    GLATTER_FN_glNamedBufferStorageMemEXT,
+    GLATTER_FN_glNamedFramebufferSampleLocationsfvNV,
+    GLATTER_FN_glNamedFramebufferTextureMultiviewOVR,
+    GLATTER_FN_glNamedRenderbufferStorageMultisampleAdvancedAMD,
+    GLATTER_FN_glNormal3f,
+    GLATTER_FN_glNormal3x,
+    GLATTER_FN_glNormal3xOES,
+    GLATTER_FN_glNormalPointer,
+    GLATTER_FN_glObjectLabel,
+    GLATTER_FN_glObjectLabelKHR,
+    GLATTER_FN_glObjectPtrLabel,
+    GLATTER_FN_glObjectPtrLabelKHR,
+    GLATTER_FN_glOrthof,
+    GLATTER_FN_glOrthofOES,
+    GLATTER_FN_glOrthox,
+    GLATTER_FN_glOrthoxOES,
+    GLATTER_FN_glPatchParameteri,
+    GLATTER_FN_glPatchParameteriEXT,
+    GLATTER_FN_glPatchParameteriOES,
+    GLATTER_FN_glPathCommandsNV,
+    GLATTER_FN_glPathCoordsNV,
+    GLATTER_FN_glPathCoverDepthFuncNV,
+    GLATTER_FN_glPathDashArrayNV,
+    GLATTER_FN_glPathGlyphIndexArrayNV,
+    GLATTER_FN_glPathGlyphIndexRangeNV,
+    GLATTER_FN_glPathGlyphRangeNV,
+    GLATTER_FN_glPathGlyphsNV,
+    GLATTER_FN_glPathMemoryGlyphIndexArrayNV,
+    GLATTER_FN_glPathParameterfNV,
+    GLATTER_FN_glPathParameterfvNV,
+    GLATTER_FN_glPathParameteriNV,
+    GLATTER_FN_glPathParameterivNV,
+    GLATTER_FN_glPathStencilDepthOffsetNV,
+    GLATTER_FN_glPathStencilFuncNV,
+    GLATTER_FN_glPathStringNV,
+    GLATTER_FN_glPathSubCommandsNV,
+    GLATTER_FN_glPathSubCoordsNV,
+    GLATTER_FN_glPauseTransformFeedback,
+    GLATTER_FN_glPixelStorei,
+    GLATTER_FN_glPointAlongPathNV,
+    GLATTER_FN_glPointParameterf,
+    GLATTER_FN_glPointParameterfv,
+    GLATTER_FN_glPointParameterx,
+    GLATTER_FN_glPointParameterxOES,
+    GLATTER_FN_glPointParameterxv,
+    GLATTER_FN_glPointParameterxvOES,
+    GLATTER_FN_glPointSize,
+    GLATTER_FN_glPointSizePointerOES,
+    GLATTER_FN_glPointSizex,
+    GLATTER_FN_glPointSizexOES,
+    GLATTER_FN_glPolygonModeNV,
+    GLATTER_FN_glPolygonOffsetClampEXT,
+    GLATTER_FN_glPolygonOffsetx,
+    GLATTER_FN_glPolygonOffsetxOES,
+    GLATTER_FN_glPopDebugGroup,
+    GLATTER_FN_glPopDebugGroupKHR,
+    GLATTER_FN_glPopGroupMarkerEXT,
+    GLATTER_FN_glPopMatrix,
+    GLATTER_FN_glPrimitiveBoundingBox,
+    GLATTER_FN_glPrimitiveBoundingBoxEXT,
+    GLATTER_FN_glPrimitiveBoundingBoxOES,
+    GLATTER_FN_glProgramBinary,
+    GLATTER_FN_glProgramBinaryOES,
+    GLATTER_FN_glProgramParameteri,
+    GLATTER_FN_glProgramParameteriEXT,
+    GLATTER_FN_glProgramPathFragmentInputGenNV,
+    GLATTER_FN_glProgramUniform1f,
+    GLATTER_FN_glProgramUniform1fEXT,
+    GLATTER_FN_glProgramUniform1fv,
+    GLATTER_FN_glProgramUniform1fvEXT,
+    GLATTER_FN_glProgramUniform1i,
+    GLATTER_FN_glProgramUniform1i64NV,
+    GLATTER_FN_glProgramUniform1i64vNV,
+    GLATTER_FN_glProgramUniform1iEXT,
+    GLATTER_FN_glProgramUniform1iv,
+    GLATTER_FN_glProgramUniform1ivEXT,
+    GLATTER_FN_glProgramUniform1ui,
+    GLATTER_FN_glProgramUniform1ui64NV,
+    GLATTER_FN_glProgramUniform1ui64vNV,
+    GLATTER_FN_glProgramUniform1uiEXT,
+    GLATTER_FN_glProgramUniform1uiv,
+    GLATTER_FN_glProgramUniform1uivEXT,
+    GLATTER_FN_glProgramUniform2f,
+    GLATTER_FN_glProgramUniform2fEXT,
+    GLATTER_FN_glProgramUniform2fv,
+    GLATTER_FN_glProgramUniform2fvEXT,
+    GLATTER_FN_glProgramUniform2i,
+    GLATTER_FN_glProgramUniform2i64NV,
+    GLATTER_FN_glProgramUniform2i64vNV,
+    GLATTER_FN_glProgramUniform2iEXT,
+    GLATTER_FN_glProgramUniform2iv,
+    GLATTER_FN_glProgramUniform2ivEXT,
+    GLATTER_FN_glProgramUniform2ui,
+    GLATTER_FN_glProgramUniform2ui64NV,
+    GLATTER_FN_glProgramUniform2ui64vNV,
+    GLATTER_FN_glProgramUniform2uiEXT,
+    GLATTER_FN_glProgramUniform2uiv,
+    GLATTER_FN_glProgramUniform2uivEXT,
+    GLATTER_FN_glProgramUniform3f,
+    GLATTER_FN_glProgramUniform3fEXT,
+    GLATTER_FN_glProgramUniform3fv,
+    GLATTER_FN_glProgramUniform3fvEXT,
+    GLATTER_FN_glProgramUniform3i,
+    GLATTER_FN_glProgramUniform3i64NV,
+    GLATTER_FN_glProgramUniform3i64vNV,
+    GLATTER_FN_glProgramUniform3iEXT,
+    GLATTER_FN_glProgramUniform3iv,
+    GLATTER_FN_glProgramUniform3ivEXT,
+    GLATTER_FN_glProgramUniform3ui,
+    GLATTER_FN_glProgramUniform3ui64NV,
+    GLATTER_FN_glProgramUniform3ui64vNV,
+    GLATTER_FN_glProgramUniform3uiEXT,
+    GLATTER_FN_glProgramUniform3uiv,
+    GLATTER_FN_glProgramUniform3uivEXT,
+    GLATTER_FN_glProgramUniform4f,
+    GLATTER_FN_glProgramUniform4fEXT,
+    GLATTER_FN_glProgramUniform4fv,
+    GLATTER_FN_glProgramUniform4fvEXT,
+    GLATTER_FN_glProgramUniform4i,
+    GLATTER_FN_glProgramUniform4i64NV,
+    GLATTER_FN_glProgramUniform4i64vNV,
+    GLATTER_FN_glProgramUniform4iEXT,
+    GLATTER_FN_glProgramUniform4iv,
+    GLATTER_FN_glProgramUniform4ivEXT,
+    GLATTER_FN_glProgramUniform4ui,
+    GLATTER_FN_glProgramUniform4ui64NV,
+    GLATTER_FN_glProgramUniform4ui64vNV,
+    GLATTER_FN_glProgramUniform4uiEXT,
+    GLATTER_FN_glProgramUniform4uiv,
+    GLATTER_FN_glProgramUniform4uivEXT,
+    GLATTER_FN_glProgramUniformHandleui64IMG,
+    GLATTER_FN_glProgramUniformHandleui64NV,
+    GLATTER_FN_glProgramUniformHandleui64vIMG,
+    GLATTER_FN_glProgramUniformHandleui64vNV,
+    GLATTER_FN_glProgramUniformMatrix2fv,
+    GLATTER_FN_glProgramUniformMatrix2fvEXT,
+    GLATTER_FN_glProgramUniformMatrix2x3fv,
+    GLATTER_FN_glProgramUniformMatrix2x3fvEXT,
+    GLATTER_FN_glProgramUniformMatrix2x4fv,
+    GLATTER_FN_glProgramUniformMatrix2x4fvEXT,
+    GLATTER_FN_glProgramUniformMatrix3fv,
+    GLATTER_FN_glProgramUniformMatrix3fvEXT,
+    GLATTER_FN_glProgramUniformMatrix3x2fv,
+    GLATTER_FN_glProgramUniformMatrix3x2fvEXT,
+    GLATTER_FN_glProgramUniformMatrix3x4fv,
+    GLATTER_FN_glProgramUniformMatrix3x4fvEXT,
+    GLATTER_FN_glProgramUniformMatrix4fv,
+    GLATTER_FN_glProgramUniformMatrix4fvEXT,
+    GLATTER_FN_glProgramUniformMatrix4x2fv,
+    GLATTER_FN_glProgramUniformMatrix4x2fvEXT,
+    GLATTER_FN_glProgramUniformMatrix4x3fv,
+    GLATTER_FN_glProgramUniformMatrix4x3fvEXT,
+    GLATTER_FN_glPushDebugGroup,
+    GLATTER_FN_glPushDebugGroupKHR,
+    GLATTER_FN_glPushGroupMarkerEXT,
+    GLATTER_FN_glPushMatrix,
+    GLATTER_FN_glQueryCounterEXT,
+    GLATTER_FN_glQueryMatrixxOES,
+    GLATTER_FN_glRasterSamplesEXT,
+    GLATTER_FN_glReadBuffer,
+    GLATTER_FN_glReadBufferIndexedEXT,
+    GLATTER_FN_glReadBufferNV,
+    GLATTER_FN_glReadPixels,
+    GLATTER_FN_glReadnPixels,
+    GLATTER_FN_glReadnPixelsEXT,
+    GLATTER_FN_glReadnPixelsKHR,
+    GLATTER_FN_glReleaseKeyedMutexWin32EXT,
+    GLATTER_FN_glReleaseShaderCompiler,
+    GLATTER_FN_glRenderbufferStorage,
+    GLATTER_FN_glRenderbufferStorageMultisample,
+    GLATTER_FN_glRenderbufferStorageMultisampleANGLE,
+    GLATTER_FN_glRenderbufferStorageMultisampleAPPLE,
+    GLATTER_FN_glRenderbufferStorageMultisampleAdvancedAMD,
+    GLATTER_FN_glRenderbufferStorageMultisampleEXT,
+    GLATTER_FN_glRenderbufferStorageMultisampleIMG,
+    GLATTER_FN_glRenderbufferStorageMultisampleNV,
+    GLATTER_FN_glRenderbufferStorageOES,
+    GLATTER_FN_glResetMemoryObjectParameterNV,
+    GLATTER_FN_glResolveDepthValuesNV,
+    GLATTER_FN_glResolveMultisampleFramebufferAPPLE,
+    GLATTER_FN_glResumeTransformFeedback,
+    GLATTER_FN_glRotatef,
+    GLATTER_FN_glRotatex,
+    GLATTER_FN_glRotatexOES,
+    GLATTER_FN_glSampleCoverage,
+    GLATTER_FN_glSampleCoveragex,
+    GLATTER_FN_glSampleCoveragexOES,
+    GLATTER_FN_glSampleMaski,
+    GLATTER_FN_glSamplerParameterIiv,
+    GLATTER_FN_glSamplerParameterIivEXT,
+    GLATTER_FN_glSamplerParameterIivOES,
+    GLATTER_FN_glSamplerParameterIuiv,
+    GLATTER_FN_glSamplerParameterIuivEXT,
+    GLATTER_FN_glSamplerParameterIuivOES,
+    GLATTER_FN_glSamplerParameterf,
+    GLATTER_FN_glSamplerParameterfv,
+    GLATTER_FN_glSamplerParameteri,
+    GLATTER_FN_glSamplerParameteriv,
+    GLATTER_FN_glScalef,
+    GLATTER_FN_glScalex,
+    GLATTER_FN_glScalexOES,
+    GLATTER_FN_glScissorArrayvNV,
+    GLATTER_FN_glScissorArrayvOES,
+    GLATTER_FN_glScissorExclusiveArrayvNV,
+    GLATTER_FN_glScissorExclusiveNV,
+    GLATTER_FN_glScissorIndexedNV,
+    GLATTER_FN_glScissorIndexedOES,
+    GLATTER_FN_glScissorIndexedvNV,
+    GLATTER_FN_glScissorIndexedvOES,
+    GLATTER_FN_glSelectPerfMonitorCountersAMD,
+    GLATTER_FN_glSemaphoreParameterivNV,
+    GLATTER_FN_glSemaphoreParameterui64vEXT,
+    GLATTER_FN_glSetFenceNV,
+    GLATTER_FN_glShadeModel,
+    GLATTER_FN_glShaderBinary,
+    GLATTER_FN_glShaderSource,
+    GLATTER_FN_glShadingRateCombinerOpsEXT,
+    GLATTER_FN_glShadingRateEXT,
+    GLATTER_FN_glShadingRateImageBarrierNV,
+    GLATTER_FN_glShadingRateImagePaletteNV,
+    GLATTER_FN_glShadingRateQCOM,
+    GLATTER_FN_glShadingRateSampleOrderCustomNV,
+    GLATTER_FN_glShadingRateSampleOrderNV,
+    GLATTER_FN_glSignalSemaphoreEXT,
+    GLATTER_FN_glSignalVkFenceNV,
+    GLATTER_FN_glSignalVkSemaphoreNV,
+    GLATTER_FN_glStartTilingQCOM,
+    GLATTER_FN_glStencilFillPathInstancedNV,
+    GLATTER_FN_glStencilFillPathNV,
+    GLATTER_FN_glStencilFuncSeparate,
+    GLATTER_FN_glStencilMaskSeparate,
+    GLATTER_FN_glStencilOpSeparate,
+    GLATTER_FN_glStencilStrokePathInstancedNV,
+    GLATTER_FN_glStencilStrokePathNV,
+    GLATTER_FN_glStencilThenCoverFillPathInstancedNV,
+    GLATTER_FN_glStencilThenCoverFillPathNV,
+    GLATTER_FN_glStencilThenCoverStrokePathInstancedNV,
+    GLATTER_FN_glStencilThenCoverStrokePathNV,
+    GLATTER_FN_glSubpixelPrecisionBiasNV,
+    GLATTER_FN_glTestFenceNV,
+    GLATTER_FN_glTexAttachMemoryNV,
+    GLATTER_FN_glTexBuffer,
+    GLATTER_FN_glTexBufferEXT,
+    GLATTER_FN_glTexBufferOES,
+    GLATTER_FN_glTexBufferRange,
+    GLATTER_FN_glTexBufferRangeEXT,
+    GLATTER_FN_glTexBufferRangeOES,
+    GLATTER_FN_glTexCoordPointer,
+    GLATTER_FN_glTexEnvf,
+    GLATTER_FN_glTexEnvfv,
+    GLATTER_FN_glTexEnvi,
+    GLATTER_FN_glTexEnviv,
+    GLATTER_FN_glTexEnvx,
+    GLATTER_FN_glTexEnvxOES,
+    GLATTER_FN_glTexEnvxv,
+    GLATTER_FN_glTexEnvxvOES,
+    GLATTER_FN_glTexEstimateMotionQCOM,
+    GLATTER_FN_glTexEstimateMotionRegionsQCOM,
+    GLATTER_FN_glTexGenfOES,
+    GLATTER_FN_glTexGenfvOES,
+    GLATTER_FN_glTexGeniOES,
+    GLATTER_FN_glTexGenivOES,
+    GLATTER_FN_glTexGenxOES,
+    GLATTER_FN_glTexGenxvOES,
+    GLATTER_FN_glTexImage3D,
+    GLATTER_FN_glTexImage3DOES,
+    GLATTER_FN_glTexPageCommitmentEXT,
+    GLATTER_FN_glTexPageCommitmentMemNV,
+    GLATTER_FN_glTexParameterIiv,
+    GLATTER_FN_glTexParameterIivEXT,
+    GLATTER_FN_glTexParameterIivOES,
+    GLATTER_FN_glTexParameterIuiv,
+    GLATTER_FN_glTexParameterIuivEXT,
+    GLATTER_FN_glTexParameterIuivOES,
+    GLATTER_FN_glTexParameterf,
+    GLATTER_FN_glTexParameterfv,
+    GLATTER_FN_glTexParameteri,
+    GLATTER_FN_glTexParameteriv,
+    GLATTER_FN_glTexParameterx,
+    GLATTER_FN_glTexParameterxOES,
+    GLATTER_FN_glTexParameterxv,
+    GLATTER_FN_glTexParameterxvOES,
+    GLATTER_FN_glTexStorage1DEXT,
+    GLATTER_FN_glTexStorage2D,
+    GLATTER_FN_glTexStorage2DEXT,
+    GLATTER_FN_glTexStorage2DMultisample,
+    GLATTER_FN_glTexStorage3D,
+    GLATTER_FN_glTexStorage3DEXT,
+    GLATTER_FN_glTexStorage3DMultisample,
+    GLATTER_FN_glTexStorage3DMultisampleOES,
+    GLATTER_FN_glTexStorageAttribs2DEXT,
+    GLATTER_FN_glTexStorageAttribs3DEXT,
+    GLATTER_FN_glTexStorageMem2DEXT,
+    GLATTER_FN_glTexStorageMem2DMultisampleEXT,
+    GLATTER_FN_glTexStorageMem3DEXT,
+    GLATTER_FN_glTexStorageMem3DMultisampleEXT,
+    GLATTER_FN_glTexSubImage3D,
+    GLATTER_FN_glTexSubImage3DOES,
+    GLATTER_FN_glTextureAttachMemoryNV,
+    GLATTER_FN_glTextureBarrierNV,
+    GLATTER_FN_glTextureFoveationParametersQCOM,
+    GLATTER_FN_glTexturePageCommitmentMemNV,
+    GLATTER_FN_glTextureStorage1DEXT,
+    GLATTER_FN_glTextureStorage2DEXT,
+    GLATTER_FN_glTextureStorage3DEXT,
+    GLATTER_FN_glTextureStorageMem2DEXT,
+    GLATTER_FN_glTextureStorageMem2DMultisampleEXT,
+    GLATTER_FN_glTextureStorageMem3DEXT,
+    GLATTER_FN_glTextureStorageMem3DMultisampleEXT,
+    GLATTER_FN_glTextureViewEXT,
+    GLATTER_FN_glTextureViewOES,
+    GLATTER_FN_glTransformFeedbackVaryings,
+    GLATTER_FN_glTransformPathNV,
+    GLATTER_FN_glTranslatef,
+    GLATTER_FN_glTranslatex,
+    GLATTER_FN_glTranslatexOES,
+    GLATTER_FN_glUniform1i64NV,
+    GLATTER_FN_glUniform1i64vNV,
+    GLATTER_FN_glUniform1ui,
+    GLATTER_FN_glUniform1ui64NV,
+    GLATTER_FN_glUniform1ui64vNV,
+    GLATTER_FN_glUniform1uiv,
+    GLATTER_FN_glUniform2i,
+    GLATTER_FN_glUniform2i64NV,
+    GLATTER_FN_glUniform2i64vNV,
+    GLATTER_FN_glUniform2iv,
+    GLATTER_FN_glUniform2ui,
+    GLATTER_FN_glUniform2ui64NV,
+    GLATTER_FN_glUniform2ui64vNV,
+    GLATTER_FN_glUniform2uiv,
+    GLATTER_FN_glUniform3i,
+    GLATTER_FN_glUniform3i64NV,
+    GLATTER_FN_glUniform3i64vNV,
+    GLATTER_FN_glUniform3iv,
+    GLATTER_FN_glUniform3ui,
+    GLATTER_FN_glUniform3ui64NV,
+    GLATTER_FN_glUniform3ui64vNV,
+    GLATTER_FN_glUniform3uiv,
+    GLATTER_FN_glUniform4i,
+    GLATTER_FN_glUniform4i64NV,
+    GLATTER_FN_glUniform4i64vNV,
+    GLATTER_FN_glUniform4iv,
+    GLATTER_FN_glUniform4ui,
+    GLATTER_FN_glUniform4ui64NV,
+    GLATTER_FN_glUniform4ui64vNV,
+    GLATTER_FN_glUniform4uiv,
+    GLATTER_FN_glUniformBlockBinding,
+    GLATTER_FN_glUniformHandleui64IMG,
+    GLATTER_FN_glUniformHandleui64NV,
+    GLATTER_FN_glUniformHandleui64vIMG,
+    GLATTER_FN_glUniformHandleui64vNV,
+    GLATTER_FN_glUniformMatrix2fv,
+    GLATTER_FN_glUniformMatrix2x3fv,
+    GLATTER_FN_glUniformMatrix2x3fvNV,
+    GLATTER_FN_glUniformMatrix2x4fv,
+    GLATTER_FN_glUniformMatrix2x4fvNV,
+    GLATTER_FN_glUniformMatrix3x2fv,
+    GLATTER_FN_glUniformMatrix3x2fvNV,
+    GLATTER_FN_glUniformMatrix3x4fv,
+    GLATTER_FN_glUniformMatrix3x4fvNV,
+    GLATTER_FN_glUniformMatrix4x2fv,
+    GLATTER_FN_glUniformMatrix4x2fvNV,
+    GLATTER_FN_glUniformMatrix4x3fv,
+    GLATTER_FN_glUniformMatrix4x3fvNV,
+    GLATTER_FN_glUnmapBufferOES,
+    GLATTER_FN_glUseProgramStages,
+    GLATTER_FN_glUseProgramStagesEXT,
+    GLATTER_FN_glValidateProgram,
+    GLATTER_FN_glValidateProgramPipeline,
+    GLATTER_FN_glValidateProgramPipelineEXT,
+    GLATTER_FN_glVertexAttrib1f,
+    GLATTER_FN_glVertexAttrib1fv,
+    GLATTER_FN_glVertexAttrib2f,
+    GLATTER_FN_glVertexAttrib2fv,
+    GLATTER_FN_glVertexAttrib3f,
+    GLATTER_FN_glVertexAttrib3fv,
+    GLATTER_FN_glVertexAttrib4f,
+    GLATTER_FN_glVertexAttrib4fv,
+    GLATTER_FN_glVertexAttribBinding,
+    GLATTER_FN_glVertexAttribDivisorANGLE,
+    GLATTER_FN_glVertexAttribDivisorEXT,
+    GLATTER_FN_glVertexAttribDivisorNV,
+    GLATTER_FN_glVertexAttribFormat,
+    GLATTER_FN_glVertexAttribI4i,
+    GLATTER_FN_glVertexAttribI4iv,
+    GLATTER_FN_glVertexAttribI4ui,
+    GLATTER_FN_glVertexAttribI4uiv,
+    GLATTER_FN_glVertexAttribIFormat,
+    GLATTER_FN_glVertexBindingDivisor,
+    GLATTER_FN_glVertexPointer,
+    GLATTER_FN_glViewportArrayvNV,
+    GLATTER_FN_glViewportArrayvOES,
+    GLATTER_FN_glViewportIndexedfNV,
+    GLATTER_FN_glViewportIndexedfOES,
+    GLATTER_FN_glViewportIndexedfvNV,
+    GLATTER_FN_glViewportIndexedfvOES,
+    GLATTER_FN_glViewportPositionWScaleNV,
+    GLATTER_FN_glViewportSwizzleNV,
+    GLATTER_FN_glWaitSemaphoreEXT,
+    GLATTER_FN_glWaitSyncAPPLE,
+    GLATTER_FN_glWaitVkSemaphoreNV,
+    GLATTER_FN_glWeightPathsNV,
+    GLATTER_FN_glWeightPointerOES,
+    GLATTER_FN_glWindowRectanglesEXT,
+    GLATTER_FN_COUNT_GL
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_GL 0x0bc4a0adu
+
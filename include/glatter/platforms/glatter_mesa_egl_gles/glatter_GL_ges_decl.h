@@ -27,719 +27,764 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#ifndef GLATTER_LOOKUP_SIZE
-#define GLATTER_LOOKUP_SIZE 0x4000
+/* Reads one bit of an extension support bitset. */
+#ifndef GLATTER_EXTENSION_SUPPORTED
+#define GLATTER_EXTENSION_SUPPORTED(status, index) \
+    ((int)(((status)->bits[(index) >> 5] >> ((index) & 31)) & 1u))
 #endif
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4201)
-#endif
+/* Bit positions in glatter_extension_support_status_GL_t::bits. */
+enum {
+    GLATTER_EXT_GL_AMD_compressed_3DC_texture = 0,
+    GLATTER_EXT_GL_AMD_compressed_ATC_texture = 1,
+    GLATTER_EXT_GL_AMD_framebuffer_multisample_advanced = 2,
+    GLATTER_EXT_GL_AMD_performance_monitor = 3,
+    GLATTER_EXT_GL_AMD_program_binary_Z400 = 4,
+    GLATTER_EXT_GL_ANDROID_extension_pack_es31a = 5,
+    GLATTER_EXT_GL_ANGLE_depth_texture = 6,
+    GLATTER_EXT_GL_ANGLE_framebuffer_blit = 7,
+    GLATTER_EXT_GL_ANGLE_framebuffer_multisample = 8,
+    GLATTER_EXT_GL_ANGLE_instanced_arrays = 9,
+    GLATTER_EXT_GL_ANGLE_pack_reverse_row_order = 10,
+    GLATTER_EXT_GL_ANGLE_program_binary = 11,
+    GLATTER_EXT_GL_ANGLE_texture_compression_dxt3 = 12,
+    GLATTER_EXT_GL_ANGLE_texture_compression_dxt5 = 13,
+    GLATTER_EXT_GL_ANGLE_texture_usage = 14,
+    GLATTER_EXT_GL_ANGLE_translated_shader_source = 15,
+    GLATTER_EXT_GL_APPLE_clip_distance = 16,
+    GLATTER_EXT_GL_APPLE_color_buffer_packed_float = 17,
+    GLATTER_EXT_GL_APPLE_copy_texture_levels = 18,
+    GLATTER_EXT_GL_APPLE_framebuffer_multisample = 19,
+    GLATTER_EXT_GL_APPLE_rgb_422 = 20,
+    GLATTER_EXT_GL_APPLE_sync = 21,
+    GLATTER_EXT_GL_APPLE_texture_2D_limited_npot = 22,
+    GLATTER_EXT_GL_APPLE_texture_format_BGRA8888 = 23,
+    GLATTER_EXT_GL_APPLE_texture_max_level = 24,
+    GLATTER_EXT_GL_APPLE_texture_packed_float = 25,
+    GLATTER_EXT_GL_ARM_mali_program_binary = 26,
+    GLATTER_EXT_GL_ARM_mali_shader_binary = 27,
+    GLATTER_EXT_GL_ARM_rgba8 = 28,
+    GLATTER_EXT_GL_ARM_shader_core_properties = 29,
+    GLATTER_EXT_GL_ARM_shader_framebuffer_fetch = 30,
+    GLATTER_EXT_GL_ARM_shader_framebuffer_fetch_depth_stencil = 31,
+    GLATTER_EXT_GL_ARM_texture_unnormalized_coordinates = 32,
+    GLATTER_EXT_GL_DMP_program_binary = 33,
+    GLATTER_EXT_GL_DMP_shader_binary = 34,
+    GLATTER_EXT_GL_EXT_EGL_image_array = 35,
+    GLATTER_EXT_GL_EXT_EGL_image_storage = 36,
+    GLATTER_EXT_GL_EXT_EGL_image_storage_compression = 37,
+    GLATTER_EXT_GL_EXT_YUV_target = 38,
+    GLATTER_EXT_GL_EXT_base_instance = 39,
+    GLATTER_EXT_GL_EXT_blend_func_extended = 40,
+    GLATTER_EXT_GL_EXT_blend_minmax = 41,
+    GLATTER_EXT_GL_EXT_buffer_storage = 42,
+    GLATTER_EXT_GL_EXT_clear_texture = 43,
+    GLATTER_EXT_GL_EXT_clip_control = 44,
+    GLATTER_EXT_GL_EXT_clip_cull_distance = 45,
+    GLATTER_EXT_GL_EXT_color_buffer_float = 46,
+    GLATTER_EXT_GL_EXT_color_buffer_half_float = 47,
+    GLATTER_EXT_GL_EXT_conservative_depth = 48,
+    GLATTER_EXT_GL_EXT_copy_image = 49,
+    GLATTER_EXT_GL_EXT_debug_label = 50,
+    GLATTER_EXT_GL_EXT_debug_marker = 51,
+    GLATTER_EXT_GL_EXT_depth_clamp = 52,
+    GLATTER_EXT_GL_EXT_discard_framebuffer = 53,
+    GLATTER_EXT_GL_EXT_disjoint_timer_query = 54,
+    GLATTER_EXT_GL_EXT_draw_buffers = 55,
+    GLATTER_EXT_GL_EXT_draw_buffers_indexed = 56,
+    GLATTER_EXT_GL_EXT_draw_elements_base_vertex = 57,
+    GLATTER_EXT_GL_EXT_draw_instanced = 58,
+    GLATTER_EXT_GL_EXT_draw_transform_feedback = 59,
+    GLATTER_EXT_GL_EXT_external_buffer = 60,
+    GLATTER_EXT_GL_EXT_float_blend = 61,
+    GLATTER_EXT_GL_EXT_fragment_shading_rate = 62,
+    GLATTER_EXT_GL_EXT_framebuffer_blit_layers = 63,
+    GLATTER_EXT_GL_EXT_geometry_point_size = 64,
+    GLATTER_EXT_GL_EXT_geometry_shader = 65,
+    GLATTER_EXT_GL_EXT_gpu_shader5 = 66,
+    GLATTER_EXT_GL_EXT_instanced_arrays = 67,
+    GLATTER_EXT_GL_EXT_map_buffer_range = 68,
+    GLATTER_EXT_GL_EXT_memory_object = 69,
+    GLATTER_EXT_GL_EXT_memory_object_fd = 70,
+    GLATTER_EXT_GL_EXT_memory_object_win32 = 71,
+    GLATTER_EXT_GL_EXT_mesh_shader = 72,
+    GLATTER_EXT_GL_EXT_multi_draw_arrays = 73,
+    GLATTER_EXT_GL_EXT_multi_draw_indirect = 74,
+    GLATTER_EXT_GL_EXT_multisampled_compatibility = 75,
+    GLATTER_EXT_GL_EXT_multisampled_render_to_texture = 76,
+    GLATTER_EXT_GL_EXT_multisampled_render_to_texture2 = 77,
+    GLATTER_EXT_GL_EXT_multiview_draw_buffers = 78,
+    GLATTER_EXT_GL_EXT_multiview_tessellation_geometry_shader = 79,
+    GLATTER_EXT_GL_EXT_multiview_texture_multisample = 80,
+    GLATTER_EXT_GL_EXT_multiview_timer_query = 81,
+    GLATTER_EXT_GL_EXT_occlusion_query_boolean = 82,
+    GLATTER_EXT_GL_EXT_polygon_offset_clamp = 83,
+    GLATTER_EXT_GL_EXT_post_depth_coverage = 84,
+    GLATTER_EXT_GL_EXT_primitive_bounding_box = 85,
+    GLATTER_EXT_GL_EXT_protected_textures = 86,
+    GLATTER_EXT_GL_EXT_pvrtc_sRGB = 87,
+    GLATTER_EXT_GL_EXT_raster_multisample = 88,
+    GLATTER_EXT_GL_EXT_read_format_bgra = 89,
+    GLATTER_EXT_GL_EXT_render_snorm = 90,
+    GLATTER_EXT_GL_EXT_robustness = 91,
+    GLATTER_EXT_GL_EXT_sRGB = 92,
+    GLATTER_EXT_GL_EXT_sRGB_write_control = 93,
+    GLATTER_EXT_GL_EXT_semaphore = 94,
+    GLATTER_EXT_GL_EXT_semaphore_fd = 95,
+    GLATTER_EXT_GL_EXT_semaphore_win32 = 96,
+    GLATTER_EXT_GL_EXT_separate_depth_stencil = 97,
+    GLATTER_EXT_GL_EXT_separate_shader_objects = 98,
+    GLATTER_EXT_GL_EXT_shader_framebuffer_fetch = 99,
+    GLATTER_EXT_GL_EXT_shader_framebuffer_fetch_non_coherent = 100,
+    GLATTER_EXT_GL_EXT_shader_group_vote = 101,
+    GLATTER_EXT_GL_EXT_shader_implicit_conversions = 102,
+    GLATTER_EXT_GL_EXT_shader_integer_mix = 103,
+    GLATTER_EXT_GL_EXT_shader_io_blocks = 104,
+    GLATTER_EXT_GL_EXT_shader_non_constant_global_initializers = 105,
+    GLATTER_EXT_GL_EXT_shader_pixel_local_storage = 106,
+    GLATTER_EXT_GL_EXT_shader_pixel_local_storage2 = 107,
+    GLATTER_EXT_GL_EXT_shader_samples_identical = 108,
+    GLATTER_EXT_GL_EXT_shader_texture_lod = 109,
+    GLATTER_EXT_GL_EXT_shader_texture_samples = 110,
+    GLATTER_EXT_GL_EXT_shadow_samplers = 111,
+    GLATTER_EXT_GL_EXT_sparse_texture = 112,
+    GLATTER_EXT_GL_EXT_sparse_texture2 = 113,
+    GLATTER_EXT_GL_EXT_tessellation_point_size = 114,
+    GLATTER_EXT_GL_EXT_tessellation_shader = 115,
+    GLATTER_EXT_GL_EXT_texture_border_clamp = 116,
+    GLATTER_EXT_GL_EXT_texture_buffer = 117,
+    GLATTER_EXT_GL_EXT_texture_compression_astc_decode_mode = 118,
+    GLATTER_EXT_GL_EXT_texture_compression_bptc = 119,
+    GLATTER_EXT_GL_EXT_texture_compression_dxt1 = 120,
+    GLATTER_EXT_GL_EXT_texture_compression_rgtc = 121,
+    GLATTER_EXT_GL_EXT_texture_compression_s3tc = 122,
+    GLATTER_EXT_GL_EXT_texture_compression_s3tc_srgb = 123,
+    GLATTER_EXT_GL_EXT_texture_cube_map_array = 124,
+    GLATTER_EXT_GL_EXT_texture_filter_anisotropic = 125,
+    GLATTER_EXT_GL_EXT_texture_filter_minmax = 126,
+    GLATTER_EXT_GL_EXT_texture_format_BGRA8888 = 127,
+    GLATTER_EXT_GL_EXT_texture_format_sRGB_override = 128,
+    GLATTER_EXT_GL_EXT_texture_lod_bias = 129,
+    GLATTER_EXT_GL_EXT_texture_mirror_clamp_to_edge = 130,
+    GLATTER_EXT_GL_EXT_texture_norm16 = 131,
+    GLATTER_EXT_GL_EXT_texture_query_lod = 132,
+    GLATTER_EXT_GL_EXT_texture_rg = 133,
+    GLATTER_EXT_GL_EXT_texture_sRGB_R8 = 134,
+    GLATTER_EXT_GL_EXT_texture_sRGB_RG8 = 135,
+    GLATTER_EXT_GL_EXT_texture_sRGB_decode = 136,
+    GLATTER_EXT_GL_EXT_texture_shadow_lod = 137,
+    GLATTER_EXT_GL_EXT_texture_storage = 138,
+    GLATTER_EXT_GL_EXT_texture_storage_compression = 139,
+    GLATTER_EXT_GL_EXT_texture_type_2_10_10_10_REV = 140,
+    GLATTER_EXT_GL_EXT_texture_view = 141,
+    GLATTER_EXT_GL_EXT_unpack_subimage = 142,
+    GLATTER_EXT_GL_EXT_win32_keyed_mutex = 143,
+    GLATTER_EXT_GL_EXT_window_rectangles = 144,
+    GLATTER_EXT_GL_FJ_shader_binary_GCCSO = 145,
+    GLATTER_EXT_GL_IMG_bindless_texture = 146,
+    GLATTER_EXT_GL_IMG_framebuffer_downsample = 147,
+    GLATTER_EXT_GL_IMG_multisampled_render_to_texture = 148,
+    GLATTER_EXT_GL_IMG_program_binary = 149,
+    GLATTER_EXT_GL_IMG_read_format = 150,
+    GLATTER_EXT_GL_IMG_shader_binary = 151,
+    GLATTER_EXT_GL_IMG_texture_compression_pvrtc = 152,
+    GLATTER_EXT_GL_IMG_texture_compression_pvrtc2 = 153,
+    GLATTER_EXT_GL_IMG_texture_env_enhanced_fixed_function = 154,
+    GLATTER_EXT_GL_IMG_texture_filter_cubic = 155,
+    GLATTER_EXT_GL_IMG_user_clip_plane = 156,
+    GLATTER_EXT_GL_INTEL_blackhole_render = 157,
+    GLATTER_EXT_GL_INTEL_conservative_rasterization = 158,
+    GLATTER_EXT_GL_INTEL_framebuffer_CMAA = 159,
+    GLATTER_EXT_GL_INTEL_performance_query = 160,
+    GLATTER_EXT_GL_KHR_blend_equation_advanced = 161,
+    GLATTER_EXT_GL_KHR_blend_equation_advanced_coherent = 162,
+    GLATTER_EXT_GL_KHR_context_flush_control = 163,
+    GLATTER_EXT_GL_KHR_debug = 164,
+    GLATTER_EXT_GL_KHR_no_error = 165,
+    GLATTER_EXT_GL_KHR_parallel_shader_compile = 166,
+    GLATTER_EXT_GL_KHR_robust_buffer_access_behavior = 167,
+    GLATTER_EXT_GL_KHR_robustness = 168,
+    GLATTER_EXT_GL_KHR_shader_subgroup = 169,
+    GLATTER_EXT_GL_KHR_texture_compression_astc_hdr = 170,
+    GLATTER_EXT_GL_KHR_texture_compression_astc_ldr = 171,
+    GLATTER_EXT_GL_KHR_texture_compression_astc_sliced_3d = 172,
+    GLATTER_EXT_GL_MESA_bgra = 173,
+    GLATTER_EXT_GL_MESA_framebuffer_flip_x = 174,
+    GLATTER_EXT_GL_MESA_framebuffer_flip_y = 175,
+    GLATTER_EXT_GL_MESA_framebuffer_swap_xy = 176,
+    GLATTER_EXT_GL_MESA_program_binary_formats = 177,
+    GLATTER_EXT_GL_MESA_sampler_objects = 178,
+    GLATTER_EXT_GL_MESA_shader_integer_functions = 179,
+    GLATTER_EXT_GL_MESA_texture_const_bandwidth = 180,
+    GLATTER_EXT_GL_NVX_blend_equation_advanced_multi_draw_buffers = 181,
+    GLATTER_EXT_GL_NV_bindless_texture = 182,
+    GLATTER_EXT_GL_NV_blend_equation_advanced = 183,
+    GLATTER_EXT_GL_NV_blend_equation_advanced_coherent = 184,
+    GLATTER_EXT_GL_NV_blend_minmax_factor = 185,
+    GLATTER_EXT_GL_NV_clip_space_w_scaling = 186,
+    GLATTER_EXT_GL_NV_compute_shader_derivatives = 187,
+    GLATTER_EXT_GL_NV_conditional_render = 188,
+    GLATTER_EXT_GL_NV_conservative_raster = 189,
+    GLATTER_EXT_GL_NV_conservative_raster_pre_snap = 190,
+    GLATTER_EXT_GL_NV_conservative_raster_pre_snap_triangles = 191,
+    GLATTER_EXT_GL_NV_copy_buffer = 192,
+    GLATTER_EXT_GL_NV_coverage_sample = 193,
+    GLATTER_EXT_GL_NV_depth_nonlinear = 194,
+    GLATTER_EXT_GL_NV_draw_buffers = 195,
+    GLATTER_EXT_GL_NV_draw_instanced = 196,
+    GLATTER_EXT_GL_NV_draw_vulkan_image = 197,
+    GLATTER_EXT_GL_NV_explicit_attrib_location = 198,
+    GLATTER_EXT_GL_NV_fbo_color_attachments = 199,
+    GLATTER_EXT_GL_NV_fence = 200,
+    GLATTER_EXT_GL_NV_fill_rectangle = 201,
+    GLATTER_EXT_GL_NV_fragment_coverage_to_color = 202,
+    GLATTER_EXT_GL_NV_fragment_shader_barycentric = 203,
+    GLATTER_EXT_GL_NV_fragment_shader_interlock = 204,
+    GLATTER_EXT_GL_NV_framebuffer_blit = 205,
+    GLATTER_EXT_GL_NV_framebuffer_mixed_samples = 206,
+    GLATTER_EXT_GL_NV_framebuffer_multisample = 207,
+    GLATTER_EXT_GL_NV_generate_mipmap_sRGB = 208,
+    GLATTER_EXT_GL_NV_geometry_shader_passthrough = 209,
+    GLATTER_EXT_GL_NV_gpu_shader5 = 210,
+    GLATTER_EXT_GL_NV_image_formats = 211,
+    GLATTER_EXT_GL_NV_instanced_arrays = 212,
+    GLATTER_EXT_GL_NV_internalformat_sample_query = 213,
+    GLATTER_EXT_GL_NV_memory_attachment = 214,
+    GLATTER_EXT_GL_NV_memory_object_sparse = 215,
+    GLATTER_EXT_GL_NV_mesh_shader = 216,
+    GLATTER_EXT_GL_NV_non_square_matrices = 217,
+    GLATTER_EXT_GL_NV_pack_subimage = 218,
+    GLATTER_EXT_GL_NV_path_rendering = 219,
+    GLATTER_EXT_GL_NV_path_rendering_shared_edge = 220,
+    GLATTER_EXT_GL_NV_pixel_buffer_object = 221,
+    GLATTER_EXT_GL_NV_polygon_mode = 222,
+    GLATTER_EXT_GL_NV_primitive_shading_rate = 223,
+    GLATTER_EXT_GL_NV_read_buffer = 224,
+    GLATTER_EXT_GL_NV_read_buffer_front = 225,
+    GLATTER_EXT_GL_NV_read_depth = 226,
+    GLATTER_EXT_GL_NV_read_depth_stencil = 227,
+    GLATTER_EXT_GL_NV_read_stencil = 228,
+    GLATTER_EXT_GL_NV_representative_fragment_test = 229,
+    GLATTER_EXT_GL_NV_sRGB_formats = 230,
+    GLATTER_EXT_GL_NV_sample_locations = 231,
+    GLATTER_EXT_GL_NV_sample_mask_override_coverage = 232,
+    GLATTER_EXT_GL_NV_scissor_exclusive = 233,
+    GLATTER_EXT_GL_NV_shader_atomic_fp16_vector = 234,
+    GLATTER_EXT_GL_NV_shader_noperspective_interpolation = 235,
+    GLATTER_EXT_GL_NV_shader_subgroup_partitioned = 236,
+    GLATTER_EXT_GL_NV_shader_texture_footprint = 237,
+    GLATTER_EXT_GL_NV_shading_rate_image = 238,
+    GLATTER_EXT_GL_NV_shadow_samplers_array = 239,
+    GLATTER_EXT_GL_NV_shadow_samplers_cube = 240,
+    GLATTER_EXT_GL_NV_stereo_view_rendering = 241,
+    GLATTER_EXT_GL_NV_texture_barrier = 242,
+    GLATTER_EXT_GL_NV_texture_border_clamp = 243,
+    GLATTER_EXT_GL_NV_texture_compression_s3tc_update = 244,
+    GLATTER_EXT_GL_NV_texture_npot_2D_mipmap = 245,
+    GLATTER_EXT_GL_NV_timeline_semaphore = 246,
+    GLATTER_EXT_GL_NV_viewport_array = 247,
+    GLATTER_EXT_GL_NV_viewport_array2 = 248,
+    GLATTER_EXT_GL_NV_viewport_swizzle = 249,
+    GLATTER_EXT_GL_OES_EGL_image = 250,
+    GLATTER_EXT_GL_OES_EGL_image_external = 251,
+    GLATTER_EXT_GL_OES_EGL_image_external_essl3 = 252,
+    GLATTER_EXT_GL_OES_blend_equation_separate = 253,
+    GLATTER_EXT_GL_OES_blend_func_separate = 254,
+    GLATTER_EXT_GL_OES_blend_subtract = 255,
+    GLATTER_EXT_GL_OES_byte_coordinates = 256,
+    GLATTER_EXT_GL_OES_compressed_ETC1_RGB8_sub_texture = 257,
+    GLATTER_EXT_GL_OES_compressed_ETC1_RGB8_texture = 258,
+    GLATTER_EXT_GL_OES_compressed_paletted_texture = 259,
+    GLATTER_EXT_GL_OES_copy_image = 260,
+    GLATTER_EXT_GL_OES_depth24 = 261,
+    GLATTER_EXT_GL_OES_depth32 = 262,
+    GLATTER_EXT_GL_OES_depth_texture = 263,
+    GLATTER_EXT_GL_OES_draw_buffers_indexed = 264,
+    GLATTER_EXT_GL_OES_draw_elements_base_vertex = 265,
+    GLATTER_EXT_GL_OES_draw_texture = 266,
+    GLATTER_EXT_GL_OES_element_index_uint = 267,
+    GLATTER_EXT_GL_OES_extended_matrix_palette = 268,
+    GLATTER_EXT_GL_OES_fbo_render_mipmap = 269,
+    GLATTER_EXT_GL_OES_fixed_point = 270,
+    GLATTER_EXT_GL_OES_fragment_precision_high = 271,
+    GLATTER_EXT_GL_OES_framebuffer_object = 272,
+    GLATTER_EXT_GL_OES_geometry_point_size = 273,
+    GLATTER_EXT_GL_OES_geometry_shader = 274,
+    GLATTER_EXT_GL_OES_get_program_binary = 275,
+    GLATTER_EXT_GL_OES_gpu_shader5 = 276,
+    GLATTER_EXT_GL_OES_mapbuffer = 277,
+    GLATTER_EXT_GL_OES_matrix_get = 278,
+    GLATTER_EXT_GL_OES_matrix_palette = 279,
+    GLATTER_EXT_GL_OES_packed_depth_stencil = 280,
+    GLATTER_EXT_GL_OES_point_size_array = 281,
+    GLATTER_EXT_GL_OES_point_sprite = 282,
+    GLATTER_EXT_GL_OES_primitive_bounding_box = 283,
+    GLATTER_EXT_GL_OES_query_matrix = 284,
+    GLATTER_EXT_GL_OES_read_format = 285,
+    GLATTER_EXT_GL_OES_required_internalformat = 286,
+    GLATTER_EXT_GL_OES_rgb8_rgba8 = 287,
+    GLATTER_EXT_GL_OES_sample_shading = 288,
+    GLATTER_EXT_GL_OES_sample_variables = 289,
+    GLATTER_EXT_GL_OES_shader_image_atomic = 290,
+    GLATTER_EXT_GL_OES_shader_io_blocks = 291,
+    GLATTER_EXT_GL_OES_shader_multisample_interpolation = 292,
+    GLATTER_EXT_GL_OES_single_precision = 293,
+    GLATTER_EXT_GL_OES_standard_derivatives = 294,
+    GLATTER_EXT_GL_OES_stencil1 = 295,
+    GLATTER_EXT_GL_OES_stencil4 = 296,
+    GLATTER_EXT_GL_OES_stencil8 = 297,
+    GLATTER_EXT_GL_OES_stencil_wrap = 298,
+    GLATTER_EXT_GL_OES_surfaceless_context = 299,
+    GLATTER_EXT_GL_OES_tessellation_point_size = 300,
+    GLATTER_EXT_GL_OES_tessellation_shader = 301,
+    GLATTER_EXT_GL_OES_texture_3D = 302,
+    GLATTER_EXT_GL_OES_texture_border_clamp = 303,
+    GLATTER_EXT_GL_OES_texture_buffer = 304,
+    GLATTER_EXT_GL_OES_texture_compression_astc = 305,
+    GLATTER_EXT_GL_OES_texture_cube_map = 306,
+    GLATTER_EXT_GL_OES_texture_cube_map_array = 307,
+    GLATTER_EXT_GL_OES_texture_env_crossbar = 308,
+    GLATTER_EXT_GL_OES_texture_float = 309,
+    GLATTER_EXT_GL_OES_texture_float_linear = 310,
+    GLATTER_EXT_GL_OES_texture_half_float = 311,
+    GLATTER_EXT_GL_OES_texture_half_float_linear = 312,
+    GLATTER_EXT_GL_OES_texture_mirrored_repeat = 313,
+    GLATTER_EXT_GL_OES_texture_npot = 314,
+    GLATTER_EXT_GL_OES_texture_stencil8 = 315,
+    GLATTER_EXT_GL_OES_texture_storage_multisample_2d_array = 316,
+    GLATTER_EXT_GL_OES_texture_view = 317,
+    GLATTER_EXT_GL_OES_vertex_array_object = 318,
+    GLATTER_EXT_GL_OES_vertex_half_float = 319,
+    GLATTER_EXT_GL_OES_vertex_type_10_10_10_2 = 320,
+    GLATTER_EXT_GL_OES_viewport_array = 321,
+    GLATTER_EXT_GL_OVR_multiview = 322,
+    GLATTER_EXT_GL_OVR_multiview2 = 323,
+    GLATTER_EXT_GL_OVR_multiview_multisampled_render_to_texture = 324,
+    GLATTER_EXT_GL_QCOM_YUV_texture_gather = 325,
+    GLATTER_EXT_GL_QCOM_alpha_test = 326,
+    GLATTER_EXT_GL_QCOM_binning_control = 327,
+    GLATTER_EXT_GL_QCOM_driver_control = 328,
+    GLATTER_EXT_GL_QCOM_extended_get = 329,
+    GLATTER_EXT_GL_QCOM_extended_get2 = 330,
+    GLATTER_EXT_GL_QCOM_frame_extrapolation = 331,
+    GLATTER_EXT_GL_QCOM_framebuffer_foveated = 332,
+    GLATTER_EXT_GL_QCOM_motion_estimation = 333,
+    GLATTER_EXT_GL_QCOM_perfmon_global_mode = 334,
+    GLATTER_EXT_GL_QCOM_render_sRGB_R8_RG8 = 335,
+    GLATTER_EXT_GL_QCOM_render_shared_exponent = 336,
+    GLATTER_EXT_GL_QCOM_shader_framebuffer_fetch_noncoherent = 337,
+    GLATTER_EXT_GL_QCOM_shader_framebuffer_fetch_rate = 338,
+    GLATTER_EXT_GL_QCOM_shading_rate = 339,
+    GLATTER_EXT_GL_QCOM_texture_foveated = 340,
+    GLATTER_EXT_GL_QCOM_texture_foveated2 = 341,
+    GLATTER_EXT_GL_QCOM_texture_foveated_subsampled_layout = 342,
+    GLATTER_EXT_GL_QCOM_texture_lod_bias = 343,
+    GLATTER_EXT_GL_QCOM_tiled_rendering = 344,
+    GLATTER_EXT_GL_QCOM_writeonly_rendering = 345,
+    GLATTER_EXT_GL_QCOM_ycbcr_degamma = 346,
+    GLATTER_EXT_GL_VIV_shader_binary = 347,
+    GLATTER_EXT_COUNT_GL = 348
+};
 
+/* One bit per extension, indexed by GLATTER_EXT_* above. */
 typedef struct glatter_extension_support_status_GL
 {
-        int has_GL_AMD_compressed_3DC_texture;
-        int has_GL_AMD_compressed_ATC_texture;
-        int has_GL_AMD_framebuffer_multisample_advanced;
-        int has_GL_AMD_performance_monitor;
-        int has_GL_AMD_program_binary_Z400;
-        int has_GL_ANDROID_extension_pack_es31a;
-        int has_GL_ANGLE_depth_texture;
-        int has_GL_ANGLE_framebuffer_blit;
-        int has_GL_ANGLE_framebuffer_multisample;
-        int has_GL_ANGLE_instanced_arrays;
-        int has_GL_ANGLE_pack_reverse_row_order;
-        int has_GL_ANGLE_program_binary;
-        int has_GL_ANGLE_texture_compression_dxt3;
-        int has_GL_ANGLE_texture_compression_dxt5;
-        int has_GL_ANGLE_texture_usage;
-        int has_GL_ANGLE_translated_shader_source;
-        int has_GL_APPLE_clip_distance;
-        int has_GL_APPLE_color_buffer_packed_float;
-        int has_GL_APPLE_copy_texture_levels;
-        int has_GL_APPLE_framebuffer_multisample;
-        int has_GL_APPLE_rgb_422;
-        int has_GL_APPLE_sync;
-        int has_GL_APPLE_texture_2D_limited_npot;
-        int has_GL_APPLE_texture_format_BGRA8888;
-        int has_GL_APPLE_texture_max_level;
-        int has_GL_APPLE_texture_packed_float;
-        int has_GL_ARM_mali_program_binary;
-        int has_GL_ARM_mali_shader_binary;
-        int has_GL_ARM_rgba8;
-        int has_GL_ARM_shader_core_properties;
-        int has_GL_ARM_shader_framebuffer_fetch;
-        int has_GL_ARM_shader_framebuffer_fetch_depth_stencil;
-        int has_GL_ARM_texture_unnormalized_coordinates;
-        int has_GL_DMP_program_binary;
-        int has_GL_DMP_shader_binary;
-        int has_GL_EXT_EGL_image_array;
-        int has_GL_EXT_EGL_image_storage;
-        int has_GL_EXT_EGL_image_storage_compression;
-        int has_GL_EXT_YUV_target;
-        int has_GL_EXT_base_instance;
-        int has_GL_EXT_blend_func_extended;
-        int has_GL_EXT_blend_minmax;
-        int has_GL_EXT_buffer_storage;
-        int has_GL_EXT_clear_texture;
-        int has_GL_EXT_clip_control;
-        int has_GL_EXT_clip_cull_distance;
-        int has_GL_EXT_color_buffer_float;
-        int has_GL_EXT_color_buffer_half_float;
-        int has_GL_EXT_conservative_depth;
-        int has_GL_EXT_copy_image;
-        int has_GL_EXT_debug_label;
-        int has_GL_EXT_debug_marker;
-        int has_GL_EXT_depth_clamp;
-        int has_GL_EXT_discard_framebuffer;
-        int has_GL_EXT_disjoint_timer_query;
-        int has_GL_EXT_draw_buffers;
-        int has_GL_EXT_draw_buffers_indexed;
-        int has_GL_EXT_draw_elements_base_vertex;
-        int has_GL_EXT_draw_instanced;
-        int has_GL_EXT_draw_transform_feedback;
-        int has_GL_EXT_external_buffer;
-        int has_GL_EXT_float_blend;
-        int has_GL_EXT_fragment_shading_rate;
-        int has_GL_EXT_framebuffer_blit_layers;
-        int has_GL_EXT_geometry_point_size;
-        int has_GL_EXT_geometry_shader;
-        int has_GL_EXT_gpu_shader5;
-        int has_GL_EXT_instanced_arrays;
-        int has_GL_EXT_map_buffer_range;
-        int has_GL_EXT_memory_object;
-        int has_GL_EXT_memory_object_fd;
-        int has_GL_EXT_memory_object_win32;
-        int has_GL_EXT_mesh_shader;
-        int has_GL_EXT_multi_draw_arrays;
-        int has_GL_EXT_multi_draw_indirect;
-        int has_GL_EXT_multisampled_compatibility;
-        int has_GL_EXT_multisampled_render_to_texture;
-        int has_GL_EXT_multisampled_render_to_texture2;
-        int has_GL_EXT_multiview_draw_buffers;
-        int has_GL_EXT_multiview_tessellation_geometry_shader;
-        int has_GL_EXT_multiview_texture_multisample;
-        int has_GL_EXT_multiview_timer_query;
-        int has_GL_EXT_occlusion_query_boolean;
-        int has_GL_EXT_polygon_offset_clamp;
-        int has_GL_EXT_post_depth_coverage;
-        int has_GL_EXT_primitive_bounding_box;
-        int has_GL_EXT_protected_textures;
-        int has_GL_EXT_pvrtc_sRGB;
-        int has_GL_EXT_raster_multisample;
-        int has_GL_EXT_read_format_bgra;
-        int has_GL_EXT_render_snorm;
-        int has_GL_EXT_robustness;
-        int has_GL_EXT_sRGB;
-        int has_GL_EXT_sRGB_write_control;
-        int has_GL_EXT_semaphore;
-        int has_GL_EXT_semaphore_fd;
-        int has_GL_EXT_semaphore_win32;
-        int has_GL_EXT_separate_depth_stencil;
-        int has_GL_EXT_separate_shader_objects;
-        int has_GL_EXT_shader_framebuffer_fetch;
-        int has_GL_EXT_shader_framebuffer_fetch_non_coherent;
-        int has_GL_EXT_shader_group_vote;
-        int has_GL_EXT_shader_implicit_conversions;
-        int has_GL_EXT_shader_integer_mix;
-        int has_GL_EXT_shader_io_blocks;
-        int has_GL_EXT_shader_non_constant_global_initializers;
-        int has_GL_EXT_shader_pixel_local_storage;
-        int has_GL_EXT_shader_pixel_local_storage2;
-        int has_GL_EXT_shader_samples_identical;
-        int has_GL_EXT_shader_texture_lod;
-        int has_GL_EXT_shader_texture_samples;
-        int has_GL_EXT_shadow_samplers;
-        int has_GL_EXT_sparse_texture;
-        int has_GL_EXT_sparse_texture2;
-        int has_GL_EXT_tessellation_point_size;
-        int has_GL_EXT_tessellation_shader;
-        int has_GL_EXT_texture_border_clamp;
-        int has_GL_EXT_texture_buffer;
-        int has_GL_EXT_texture_compression_astc_decode_mode;
-        int has_GL_EXT_texture_compression_bptc;
-        int has_GL_EXT_texture_compression_dxt1;
-        int has_GL_EXT_texture_compression_rgtc;
-        int has_GL_EXT_texture_compression_s3tc;
-        int has_GL_EXT_texture_compression_s3tc_srgb;
-        int has_GL_EXT_texture_cube_map_array;
-        int has_GL_EXT_texture_filter_anisotropic;
-        int has_GL_EXT_texture_filter_minmax;
-        int has_GL_EXT_texture_format_BGRA8888;
-        int has_GL_EXT_texture_format_sRGB_override;
-        int has_GL_EXT_texture_lod_bias;
-        int has_GL_EXT_texture_mirror_clamp_to_edge;
-        int has_GL_EXT_texture_norm16;
-        int has_GL_EXT_texture_query_lod;
-        int has_GL_EXT_texture_rg;
-        int has_GL_EXT_texture_sRGB_R8;
-        int has_GL_EXT_texture_sRGB_RG8;
-        int has_GL_EXT_texture_sRGB_decode;
-        int has_GL_EXT_texture_shadow_lod;
-        int has_GL_EXT_texture_storage;
-        int has_GL_EXT_texture_storage_compression;
-        int has_GL_EXT_texture_type_2_10_10_10_REV;
-        int has_GL_EXT_texture_view;
-        int has_GL_EXT_unpack_subimage;
-        int has_GL_EXT_win32_keyed_mutex;
-        int has_GL_EXT_window_rectangles;
-        int has_GL_FJ_shader_binary_GCCSO;
-        int has_GL_IMG_bindless_texture;
-        int has_GL_IMG_framebuffer_downsample;
-        int has_GL_IMG_multisampled_render_to_texture;
-        int has_GL_IMG_program_binary;
-        int has_GL_IMG_read_format;
-        int has_GL_IMG_shader_binary;
-        int has_GL_IMG_texture_compression_pvrtc;
-        int has_GL_IMG_texture_compression_pvrtc2;
-        int has_GL_IMG_texture_env_enhanced_fixed_function;
-        int has_GL_IMG_texture_filter_cubic;
-        int has_GL_IMG_user_clip_plane;
-        int has_GL_INTEL_blackhole_render;
-        int has_GL_INTEL_conservative_rasterization;
-        int has_GL_INTEL_framebuffer_CMAA;
-        int has_GL_INTEL_performance_query;
-        int has_GL_KHR_blend_equation_advanced;
-        int has_GL_KHR_blend_equation_advanced_coherent;
-        int has_GL_KHR_context_flush_control;
-        int has_GL_KHR_debug;
-        int has_GL_KHR_no_error;
-        int has_GL_KHR_parallel_shader_compile;
-        int has_GL_KHR_robust_buffer_access_behavior;
-        int has_GL_KHR_robustness;
-        int has_GL_KHR_shader_subgroup;
-        int has_GL_KHR_texture_compression_astc_hdr;
-        int has_GL_KHR_texture_compression_astc_ldr;
-        int has_GL_KHR_texture_compression_astc_sliced_3d;
-        int has_GL_MESA_bgra;
-        int has_GL_MESA_framebuffer_flip_x;
-        int has_GL_MESA_framebuffer_flip_y;
-        int has_GL_MESA_framebuffer_swap_xy;
-        int has_GL_MESA_program_binary_formats;
-        int has_GL_MESA_sampler_objects;
-        int has_GL_MESA_shader_integer_functions;
-        int has_GL_MESA_texture_const_bandwidth;
-        int has_GL_NVX_blend_equation_advanced_multi_draw_buffers;
-        int has_GL_NV_bindless_texture;
-        int has_GL_NV_blend_equation_advanced;
-        int has_GL_NV_blend_equation_advanced_coherent;
-        int has_GL_NV_blend_minmax_factor;
-        int has_GL_NV_clip_space_w_scaling;
-        int has_GL_NV_compute_shader_derivatives;
-        int has_GL_NV_conditional_render;
-        int has_GL_NV_conservative_raster;
-        int has_GL_NV_conservative_raster_pre_snap;
-        int has_GL_NV_conservative_raster_pre_snap_triangles;
-        int has_GL_NV_copy_buffer;
-        int has_GL_NV_coverage_sample;
-        int has_GL_NV_depth_nonlinear;
-        int has_GL_NV_draw_buffers;
-        int has_GL_NV_draw_instanced;
-        int has_GL_NV_draw_vulkan_image;
-        int has_GL_NV_explicit_attrib_location;
-        int has_GL_NV_fbo_color_attachments;
-        int has_GL_NV_fence;
-        int has_GL_NV_fill_rectangle;
-        int has_GL_NV_fragment_coverage_to_color;
-        int has_GL_NV_fragment_shader_barycentric;
-        int has_GL_NV_fragment_shader_interlock;
-        int has_GL_NV_framebuffer_blit;
-        int has_GL_NV_framebuffer_mixed_samples;
-        int has_GL_NV_framebuffer_multisample;
-        int has_GL_NV_generate_mipmap_sRGB;
-        int has_GL_NV_geometry_shader_passthrough;
-        int has_GL_NV_gpu_shader5;
-        int has_GL_NV_image_formats;
-        int has_GL_NV_instanced_arrays;
-        int has_GL_NV_internalformat_sample_query;
-        int has_GL_NV_memory_attachment;
-        int has_GL_NV_memory_object_sparse;
-        int has_GL_NV_mesh_shader;
-        int has_GL_NV_non_square_matrices;
-        int has_GL_NV_pack_subimage;
-        int has_GL_NV_path_rendering;
-        int has_GL_NV_path_rendering_shared_edge;
-        int has_GL_NV_pixel_buffer_object;
-        int has_GL_NV_polygon_mode;
-        int has_GL_NV_primitive_shading_rate;
-        int has_GL_NV_read_buffer;
-        int has_GL_NV_read_buffer_front;
-        int has_GL_NV_read_depth;
-        int has_GL_NV_read_depth_stencil;
-        int has_GL_NV_read_stencil;
-        int has_GL_NV_representative_fragment_test;
-        int has_GL_NV_sRGB_formats;
-        int has_GL_NV_sample_locations;
-        int has_GL_NV_sample_mask_override_coverage;
-        int has_GL_NV_scissor_exclusive;
-        int has_GL_NV_shader_atomic_fp16_vector;
-        int has_GL_NV_shader_noperspective_interpolation;
-        int has_GL_NV_shader_subgroup_partitioned;
-        int has_GL_NV_shader_texture_footprint;
-        int has_GL_NV_shading_rate_image;
-        int has_GL_NV_shadow_samplers_array;
-        int has_GL_NV_shadow_samplers_cube;
-        int has_GL_NV_stereo_view_rendering;
-        int has_GL_NV_texture_barrier;
-        int has_GL_NV_texture_border_clamp;
-        int has_GL_NV_texture_compression_s3tc_update;
-        int has_GL_NV_texture_npot_2D_mipmap;
-        int has_GL_NV_timeline_semaphore;
-        int has_GL_NV_viewport_array;
-        int has_GL_NV_viewport_array2;
-        int has_GL_NV_viewport_swizzle;
-        int has_GL_OES_EGL_image;
-        int has_GL_OES_EGL_image_external;
-        int has_GL_OES_EGL_image_external_essl3;
-        int has_GL_OES_blend_equation_separate;
-        int has_GL_OES_blend_func_separate;
-        int has_GL_OES_blend_subtract;
-        int has_GL_OES_byte_coordinates;
-        int has_GL_OES_compressed_ETC1_RGB8_sub_texture;
-        int has_GL_OES_compressed_ETC1_RGB8_texture;
-        int has_GL_OES_compressed_paletted_texture;
-        int has_GL_OES_copy_image;
-        int has_GL_OES_depth24;
-        int has_GL_OES_depth32;
-        int has_GL_OES_depth_texture;
-        int has_GL_OES_draw_buffers_indexed;
-        int has_GL_OES_draw_elements_base_vertex;
-        int has_GL_OES_draw_texture;
-        int has_GL_OES_element_index_uint;
-        int has_GL_OES_extended_matrix_palette;
-        int has_GL_OES_fbo_render_mipmap;
-        int has_GL_OES_fixed_point;
-        int has_GL_OES_fragment_precision_high;
-        int has_GL_OES_framebuffer_object;
-        int has_GL_OES_geometry_point_size;
-        int has_GL_OES_geometry_shader;
-        int has_GL_OES_get_program_binary;
-        int has_GL_OES_gpu_shader5;
-        int has_GL_OES_mapbuffer;
-        int has_GL_OES_matrix_get;
-        int has_GL_OES_matrix_palette;
-        int has_GL_OES_packed_depth_stencil;
-        int has_GL_OES_point_size_array;
-        int has_GL_OES_point_sprite;
-        int has_GL_OES_primitive_bounding_box;
-        int has_GL_OES_query_matrix;
-        int has_GL_OES_read_format;
-        int has_GL_OES_required_internalformat;
-        int has_GL_OES_rgb8_rgba8;
-        int has_GL_OES_sample_shading;
-        int has_GL_OES_sample_variables;
-        int has_GL_OES_shader_image_atomic;
-        int has_GL_OES_shader_io_blocks;
-        int has_GL_OES_shader_multisample_interpolation;
-        int has_GL_OES_single_precision;
-        int has_GL_OES_standard_derivatives;
-        int has_GL_OES_stencil1;
-        int has_GL_OES_stencil4;
-        int has_GL_OES_stencil8;
-        int has_GL_OES_stencil_wrap;
-        int has_GL_OES_surfaceless_context;
-        int has_GL_OES_tessellation_point_size;
-        int has_GL_OES_tessellation_shader;
-        int has_GL_OES_texture_3D;
-        int has_GL_OES_texture_border_clamp;
-        int has_GL_OES_texture_buffer;
-        int has_GL_OES_texture_compression_astc;
-        int has_GL_OES_texture_cube_map;
-        int has_GL_OES_texture_cube_map_array;
-        int has_GL_OES_texture_env_crossbar;
-        int has_GL_OES_texture_float;
-        int has_GL_OES_texture_float_linear;
-        int has_GL_OES_texture_half_float;
-        int has_GL_OES_texture_half_float_linear;
-        int has_GL_OES_texture_mirrored_repeat;
-        int has_GL_OES_texture_npot;
-        int has_GL_OES_texture_stencil8;
-        int has_GL_OES_texture_storage_multisample_2d_array;
-        int has_GL_OES_texture_view;
-        int has_GL_OES_vertex_array_object;
-        int has_GL_OES_vertex_half_float;
-        int has_GL_OES_vertex_type_10_10_10_2;
-        int has_GL_OES_viewport_array;
-        int has_GL_OVR_multiview;
-        int has_GL_OVR_multiview2;
-        int has_GL_OVR_multiview_multisampled_render_to_texture;
-        int has_GL_QCOM_YUV_texture_gather;
-        int has_GL_QCOM_alpha_test;
-        int has_GL_QCOM_binning_control;
-        int has_GL_QCOM_driver_control;
-        int has_GL_QCOM_extended_get;
-        int has_GL_QCOM_extended_get2;
-        int has_GL_QCOM_frame_extrapolation;
-        int has_GL_QCOM_framebuffer_foveated;
-        int has_GL_QCOM_motion_estimation;
-        int has_GL_QCOM_perfmon_global_mode;
-        int has_GL_QCOM_render_sRGB_R8_RG8;
-        int has_GL_QCOM_render_shared_exponent;
-        int has_GL_QCOM_shader_framebuffer_fetch_noncoherent;
-        int has_GL_QCOM_shader_framebuffer_fetch_rate;
-        int has_GL_QCOM_shading_rate;
-        int has_GL_QCOM_texture_foveated;
-        int has_GL_QCOM_texture_foveated2;
-        int has_GL_QCOM_texture_foveated_subsampled_layout;
-        int has_GL_QCOM_texture_lod_bias;
-        int has_GL_QCOM_tiled_rendering;
-        int has_GL_QCOM_writeonly_rendering;
-        int has_GL_QCOM_ycbcr_degamma;
-        int has_GL_VIV_shader_binary;
+    uint32_t bits[11];
 } glatter_extension_support_status_GL_t;
 
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+#define glatter_GL_AMD_compressed_3DC_texture glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_compressed_3DC_texture)
+#define glatter_GL_AMD_compressed_ATC_texture glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_compressed_ATC_texture)
+#define glatter_GL_AMD_framebuffer_multisample_advanced glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_framebuffer_multisample_advanced)
+#define glatter_GL_AMD_performance_monitor glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_performance_monitor)
+#define glatter_GL_AMD_program_binary_Z400 glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_program_binary_Z400)
+#define glatter_GL_ANDROID_extension_pack_es31a glatter_extension_supported_GL(GLATTER_EXT_GL_ANDROID_extension_pack_es31a)
+#define glatter_GL_ANGLE_depth_texture glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_depth_texture)
+#define glatter_GL_ANGLE_framebuffer_blit glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_framebuffer_blit)
+#define glatter_GL_ANGLE_framebuffer_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_framebuffer_multisample)
+#define glatter_GL_ANGLE_instanced_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_instanced_arrays)
+#define glatter_GL_ANGLE_pack_reverse_row_order glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_pack_reverse_row_order)
+#define glatter_GL_ANGLE_program_binary glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_program_binary)
+#define glatter_GL_ANGLE_texture_compression_dxt3 glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_texture_compression_dxt3)
+#define glatter_GL_ANGLE_texture_compression_dxt5 glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_texture_compression_dxt5)
+#define glatter_GL_ANGLE_texture_usage glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_texture_usage)
+#define glatter_GL_ANGLE_translated_shader_source glatter_extension_supported_GL(GLATTER_EXT_GL_ANGLE_translated_shader_source)
+#define glatter_GL_APPLE_clip_distance glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_clip_distance)
+#define glatter_GL_APPLE_color_buffer_packed_float glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_color_buffer_packed_float)
+#define glatter_GL_APPLE_copy_texture_levels glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_copy_texture_levels)
+#define glatter_GL_APPLE_framebuffer_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_framebuffer_multisample)
+#define glatter_GL_APPLE_rgb_422 glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_rgb_422)
+#define glatter_GL_APPLE_sync glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_sync)
+#define glatter_GL_APPLE_texture_2D_limited_npot glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_texture_2D_limited_npot)
+#define glatter_GL_APPLE_texture_format_BGRA8888 glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_texture_format_BGRA8888)
+#define glatter_GL_APPLE_texture_max_level glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_texture_max_level)
+#define glatter_GL_APPLE_texture_packed_float glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_texture_packed_float)
+#define glatter_GL_ARM_mali_program_binary glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_mali_program_binary)
+#define glatter_GL_ARM_mali_shader_binary glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_mali_shader_binary)
+#define glatter_GL_ARM_rgba8 glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_rgba8)
+#define glatter_GL_ARM_shader_core_properties glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_shader_core_properties)
+#define glatter_GL_ARM_shader_framebuffer_fetch glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_shader_framebuffer_fetch)
+#define glatter_GL_ARM_shader_framebuffer_fetch_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_shader_framebuffer_fetch_depth_stencil)
+#define glatter_GL_ARM_texture_unnormalized_coordinates glatter_extension_supported_GL(GLATTER_EXT_GL_ARM_texture_unnormalized_coordinates)
+#define glatter_GL_DMP_program_binary glatter_extension_supported_GL(GLATTER_EXT_GL_DMP_program_binary)
+#define glatter_GL_DMP_shader_binary glatter_extension_supported_GL(GLATTER_EXT_GL_DMP_shader_binary)
+#define glatter_GL_EXT_EGL_image_array glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_EGL_image_array)
+#define glatter_GL_EXT_EGL_image_storage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_EGL_image_storage)
+#define glatter_GL_EXT_EGL_image_storage_compression glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_EGL_image_storage_compression)
+#define glatter_GL_EXT_YUV_target glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_YUV_target)
+#define glatter_GL_EXT_base_instance glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_base_instance)
+#define glatter_GL_EXT_blend_func_extended glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_func_extended)
+#define glatter_GL_EXT_blend_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_minmax)
+#define glatter_GL_EXT_buffer_storage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_buffer_storage)
+#define glatter_GL_EXT_clear_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_clear_texture)
+#define glatter_GL_EXT_clip_control glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_clip_control)
+#define glatter_GL_EXT_clip_cull_distance glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_clip_cull_distance)
+#define glatter_GL_EXT_color_buffer_float glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_color_buffer_float)
+#define glatter_GL_EXT_color_buffer_half_float glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_color_buffer_half_float)
+#define glatter_GL_EXT_conservative_depth glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_conservative_depth)
+#define glatter_GL_EXT_copy_image glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_copy_image)
+#define glatter_GL_EXT_debug_label glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_debug_label)
+#define glatter_GL_EXT_debug_marker glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_debug_marker)
+#define glatter_GL_EXT_depth_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_depth_clamp)
+#define glatter_GL_EXT_discard_framebuffer glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_discard_framebuffer)
+#define glatter_GL_EXT_disjoint_timer_query glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_disjoint_timer_query)
+#define glatter_GL_EXT_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_buffers)
+#define glatter_GL_EXT_draw_buffers_indexed glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_buffers_indexed)
+#define glatter_GL_EXT_draw_elements_base_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_elements_base_vertex)
+#define glatter_GL_EXT_draw_instanced glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_instanced)
+#define glatter_GL_EXT_draw_transform_feedback glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_transform_feedback)
+#define glatter_GL_EXT_external_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_external_buffer)
+#define glatter_GL_EXT_float_blend glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_float_blend)
+#define glatter_GL_EXT_fragment_shading_rate glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_fragment_shading_rate)
+#define glatter_GL_EXT_framebuffer_blit_layers glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_blit_layers)
+#define glatter_GL_EXT_geometry_point_size glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_geometry_point_size)
+#define glatter_GL_EXT_geometry_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_geometry_shader)
+#define glatter_GL_EXT_gpu_shader5 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_gpu_shader5)
+#define glatter_GL_EXT_instanced_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_instanced_arrays)
+#define glatter_GL_EXT_map_buffer_range glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_map_buffer_range)
+#define glatter_GL_EXT_memory_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_memory_object)
+#define glatter_GL_EXT_memory_object_fd glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_memory_object_fd)
+#define glatter_GL_EXT_memory_object_win32 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_memory_object_win32)
+#define glatter_GL_EXT_mesh_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_mesh_shader)
+#define glatter_GL_EXT_multi_draw_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multi_draw_arrays)
+#define glatter_GL_EXT_multi_draw_indirect glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multi_draw_indirect)
+#define glatter_GL_EXT_multisampled_compatibility glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multisampled_compatibility)
+#define glatter_GL_EXT_multisampled_render_to_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multisampled_render_to_texture)
+#define glatter_GL_EXT_multisampled_render_to_texture2 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multisampled_render_to_texture2)
+#define glatter_GL_EXT_multiview_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_draw_buffers)
+#define glatter_GL_EXT_multiview_tessellation_geometry_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_tessellation_geometry_shader)
+#define glatter_GL_EXT_multiview_texture_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_texture_multisample)
+#define glatter_GL_EXT_multiview_timer_query glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_timer_query)
+#define glatter_GL_EXT_occlusion_query_boolean glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_occlusion_query_boolean)
+#define glatter_GL_EXT_polygon_offset_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_polygon_offset_clamp)
+#define glatter_GL_EXT_post_depth_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_post_depth_coverage)
+#define glatter_GL_EXT_primitive_bounding_box glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_primitive_bounding_box)
+#define glatter_GL_EXT_protected_textures glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_protected_textures)
+#define glatter_GL_EXT_pvrtc_sRGB glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_pvrtc_sRGB)
+#define glatter_GL_EXT_raster_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_raster_multisample)
+#define glatter_GL_EXT_read_format_bgra glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_read_format_bgra)
+#define glatter_GL_EXT_render_snorm glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_render_snorm)
+#define glatter_GL_EXT_robustness glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_robustness)
+#define glatter_GL_EXT_sRGB glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_sRGB)
+#define glatter_GL_EXT_sRGB_write_control glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_sRGB_write_control)
+#define glatter_GL_EXT_semaphore glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_semaphore)
+#define glatter_GL_EXT_semaphore_fd glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_semaphore_fd)
+#define glatter_GL_EXT_semaphore_win32 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_semaphore_win32)
+#define glatter_GL_EXT_separate_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_separate_depth_stencil)
+#define glatter_GL_EXT_separate_shader_objects glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_separate_shader_objects)
+#define glatter_GL_EXT_shader_framebuffer_fetch glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_framebuffer_fetch)
+#define glatter_GL_EXT_shader_framebuffer_fetch_non_coherent glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_framebuffer_fetch_non_coherent)
+#define glatter_GL_EXT_shader_group_vote glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_group_vote)
+#define glatter_GL_EXT_shader_implicit_conversions glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_implicit_conversions)
+#define glatter_GL_EXT_shader_integer_mix glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_integer_mix)
+#define glatter_GL_EXT_shader_io_blocks glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_io_blocks)
+#define glatter_GL_EXT_shader_non_constant_global_initializers glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_non_constant_global_initializers)
+#define glatter_GL_EXT_shader_pixel_local_storage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_pixel_local_storage)
+#define glatter_GL_EXT_shader_pixel_local_storage2 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_pixel_local_storage2)
+#define glatter_GL_EXT_shader_samples_identical glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_samples_identical)
+#define glatter_GL_EXT_shader_texture_lod glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_texture_lod)
+#define glatter_GL_EXT_shader_texture_samples glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_texture_samples)
+#define glatter_GL_EXT_shadow_samplers glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shadow_samplers)
+#define glatter_GL_EXT_sparse_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_sparse_texture)
+#define glatter_GL_EXT_sparse_texture2 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_sparse_texture2)
+#define glatter_GL_EXT_tessellation_point_size glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_tessellation_point_size)
+#define glatter_GL_EXT_tessellation_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_tessellation_shader)
+#define glatter_GL_EXT_texture_border_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_border_clamp)
+#define glatter_GL_EXT_texture_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_buffer)
+#define glatter_GL_EXT_texture_compression_astc_decode_mode glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_astc_decode_mode)
+#define glatter_GL_EXT_texture_compression_bptc glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_bptc)
+#define glatter_GL_EXT_texture_compression_dxt1 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_dxt1)
+#define glatter_GL_EXT_texture_compression_rgtc glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_rgtc)
+#define glatter_GL_EXT_texture_compression_s3tc glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_s3tc)
+#define glatter_GL_EXT_texture_compression_s3tc_srgb glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_s3tc_srgb)
+#define glatter_GL_EXT_texture_cube_map_array glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_cube_map_array)
+#define glatter_GL_EXT_texture_filter_anisotropic glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_filter_anisotropic)
+#define glatter_GL_EXT_texture_filter_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_filter_minmax)
+#define glatter_GL_EXT_texture_format_BGRA8888 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_format_BGRA8888)
+#define glatter_GL_EXT_texture_format_sRGB_override glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_format_sRGB_override)
+#define glatter_GL_EXT_texture_lod_bias glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_lod_bias)
+#define glatter_GL_EXT_texture_mirror_clamp_to_edge glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_mirror_clamp_to_edge)
+#define glatter_GL_EXT_texture_norm16 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_norm16)
+#define glatter_GL_EXT_texture_query_lod glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_query_lod)
+#define glatter_GL_EXT_texture_rg glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_rg)
+#define glatter_GL_EXT_texture_sRGB_R8 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB_R8)
+#define glatter_GL_EXT_texture_sRGB_RG8 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB_RG8)
+#define glatter_GL_EXT_texture_sRGB_decode glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB_decode)
+#define glatter_GL_EXT_texture_shadow_lod glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_shadow_lod)
+#define glatter_GL_EXT_texture_storage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_storage)
+#define glatter_GL_EXT_texture_storage_compression glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_storage_compression)
+#define glatter_GL_EXT_texture_type_2_10_10_10_REV glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_type_2_10_10_10_REV)
+#define glatter_GL_EXT_texture_view glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_view)
+#define glatter_GL_EXT_unpack_subimage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_unpack_subimage)
+#define glatter_GL_EXT_win32_keyed_mutex glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_win32_keyed_mutex)
+#define glatter_GL_EXT_window_rectangles glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_window_rectangles)
+#define glatter_GL_FJ_shader_binary_GCCSO glatter_extension_supported_GL(GLATTER_EXT_GL_FJ_shader_binary_GCCSO)
+#define glatter_GL_IMG_bindless_texture glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_bindless_texture)
+#define glatter_GL_IMG_framebuffer_downsample glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_framebuffer_downsample)
+#define glatter_GL_IMG_multisampled_render_to_texture glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_multisampled_render_to_texture)
+#define glatter_GL_IMG_program_binary glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_program_binary)
+#define glatter_GL_IMG_read_format glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_read_format)
+#define glatter_GL_IMG_shader_binary glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_shader_binary)
+#define glatter_GL_IMG_texture_compression_pvrtc glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_texture_compression_pvrtc)
+#define glatter_GL_IMG_texture_compression_pvrtc2 glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_texture_compression_pvrtc2)
+#define glatter_GL_IMG_texture_env_enhanced_fixed_function glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_texture_env_enhanced_fixed_function)
+#define glatter_GL_IMG_texture_filter_cubic glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_texture_filter_cubic)
+#define glatter_GL_IMG_user_clip_plane glatter_extension_supported_GL(GLATTER_EXT_GL_IMG_user_clip_plane)
+#define glatter_GL_INTEL_blackhole_render glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_blackhole_render)
+#define glatter_GL_INTEL_conservative_rasterization glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_conservative_rasterization)
+#define glatter_GL_INTEL_framebuffer_CMAA glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_framebuffer_CMAA)
+#define glatter_GL_INTEL_performance_query glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_performance_query)
+#define glatter_GL_KHR_blend_equation_advanced glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_blend_equation_advanced)
+#define glatter_GL_KHR_blend_equation_advanced_coherent glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_blend_equation_advanced_coherent)
+#define glatter_GL_KHR_context_flush_control glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_context_flush_control)
+#define glatter_GL_KHR_debug glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_debug)
+#define glatter_GL_KHR_no_error glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_no_error)
+#define glatter_GL_KHR_parallel_shader_compile glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_parallel_shader_compile)
+#define glatter_GL_KHR_robust_buffer_access_behavior glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_robust_buffer_access_behavior)
+#define glatter_GL_KHR_robustness glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_robustness)
+#define glatter_GL_KHR_shader_subgroup glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_shader_subgroup)
+#define glatter_GL_KHR_texture_compression_astc_hdr glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_texture_compression_astc_hdr)
+#define glatter_GL_KHR_texture_compression_astc_ldr glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_texture_compression_astc_ldr)
+#define glatter_GL_KHR_texture_compression_astc_sliced_3d glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_texture_compression_astc_sliced_3d)
+#define glatter_GL_MESA_bgra glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_bgra)
+#define glatter_GL_MESA_framebuffer_flip_x glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_framebuffer_flip_x)
+#define glatter_GL_MESA_framebuffer_flip_y glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_framebuffer_flip_y)
+#define glatter_GL_MESA_framebuffer_swap_xy glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_framebuffer_swap_xy)
+#define glatter_GL_MESA_program_binary_formats glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_program_binary_formats)
+#define glatter_GL_MESA_sampler_objects glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_sampler_objects)
+#define glatter_GL_MESA_shader_integer_functions glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_shader_integer_functions)
+#define glatter_GL_MESA_texture_const_bandwidth glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_texture_const_bandwidth)
+#define glatter_GL_NVX_blend_equation_advanced_multi_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_blend_equation_advanced_multi_draw_buffers)
+#define glatter_GL_NV_bindless_texture glatter_extension_supported_GL(GLATTER_EXT_GL_NV_bindless_texture)
+#define glatter_GL_NV_blend_equation_advanced glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_equation_advanced)
+#define glatter_GL_NV_blend_equation_advanced_coherent glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_equation_advanced_coherent)
+#define glatter_GL_NV_blend_minmax_factor glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_minmax_factor)
+#define glatter_GL_NV_clip_space_w_scaling glatter_extension_supported_GL(GLATTER_EXT_GL_NV_clip_space_w_scaling)
+#define glatter_GL_NV_compute_shader_derivatives glatter_extension_supported_GL(GLATTER_EXT_GL_NV_compute_shader_derivatives)
+#define glatter_GL_NV_conditional_render glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conditional_render)
+#define glatter_GL_NV_conservative_raster glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster)
+#define glatter_GL_NV_conservative_raster_pre_snap glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster_pre_snap)
+#define glatter_GL_NV_conservative_raster_pre_snap_triangles glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster_pre_snap_triangles)
+#define glatter_GL_NV_copy_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_NV_copy_buffer)
+#define glatter_GL_NV_coverage_sample glatter_extension_supported_GL(GLATTER_EXT_GL_NV_coverage_sample)
+#define glatter_GL_NV_depth_nonlinear glatter_extension_supported_GL(GLATTER_EXT_GL_NV_depth_nonlinear)
+#define glatter_GL_NV_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_NV_draw_buffers)
+#define glatter_GL_NV_draw_instanced glatter_extension_supported_GL(GLATTER_EXT_GL_NV_draw_instanced)
+#define glatter_GL_NV_draw_vulkan_image glatter_extension_supported_GL(GLATTER_EXT_GL_NV_draw_vulkan_image)
+#define glatter_GL_NV_explicit_attrib_location glatter_extension_supported_GL(GLATTER_EXT_GL_NV_explicit_attrib_location)
+#define glatter_GL_NV_fbo_color_attachments glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fbo_color_attachments)
+#define glatter_GL_NV_fence glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fence)
+#define glatter_GL_NV_fill_rectangle glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fill_rectangle)
+#define glatter_GL_NV_fragment_coverage_to_color glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_coverage_to_color)
+#define glatter_GL_NV_fragment_shader_barycentric glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_shader_barycentric)
+#define glatter_GL_NV_fragment_shader_interlock glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_shader_interlock)
+#define glatter_GL_NV_framebuffer_blit glatter_extension_supported_GL(GLATTER_EXT_GL_NV_framebuffer_blit)
+#define glatter_GL_NV_framebuffer_mixed_samples glatter_extension_supported_GL(GLATTER_EXT_GL_NV_framebuffer_mixed_samples)
+#define glatter_GL_NV_framebuffer_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_NV_framebuffer_multisample)
+#define glatter_GL_NV_generate_mipmap_sRGB glatter_extension_supported_GL(GLATTER_EXT_GL_NV_generate_mipmap_sRGB)
+#define glatter_GL_NV_geometry_shader_passthrough glatter_extension_supported_GL(GLATTER_EXT_GL_NV_geometry_shader_passthrough)
+#define glatter_GL_NV_gpu_shader5 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_gpu_shader5)
+#define glatter_GL_NV_image_formats glatter_extension_supported_GL(GLATTER_EXT_GL_NV_image_formats)
+#define glatter_GL_NV_instanced_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_NV_instanced_arrays)
+#define glatter_GL_NV_internalformat_sample_query glatter_extension_supported_GL(GLATTER_EXT_GL_NV_internalformat_sample_query)
+#define glatter_GL_NV_memory_attachment glatter_extension_supported_GL(GLATTER_EXT_GL_NV_memory_attachment)
+#define glatter_GL_NV_memory_object_sparse glatter_extension_supported_GL(GLATTER_EXT_GL_NV_memory_object_sparse)
+#define glatter_GL_NV_mesh_shader glatter_extension_supported_GL(GLATTER_EXT_GL_NV_mesh_shader)
+#define glatter_GL_NV_non_square_matrices glatter_extension_supported_GL(GLATTER_EXT_GL_NV_non_square_matrices)
+#define glatter_GL_NV_pack_subimage glatter_extension_supported_GL(GLATTER_EXT_GL_NV_pack_subimage)
+#define glatter_GL_NV_path_rendering glatter_extension_supported_GL(GLATTER_EXT_GL_NV_path_rendering)
+#define glatter_GL_NV_path_rendering_shared_edge glatter_extension_supported_GL(GLATTER_EXT_GL_NV_path_rendering_shared_edge)
+#define glatter_GL_NV_pixel_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_NV_pixel_buffer_object)
+#define glatter_GL_NV_polygon_mode glatter_extension_supported_GL(GLATTER_EXT_GL_NV_polygon_mode)
+#define glatter_GL_NV_primitive_shading_rate glatter_extension_supported_GL(GLATTER_EXT_GL_NV_primitive_shading_rate)
+#define glatter_GL_NV_read_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_NV_read_buffer)
+#define glatter_GL_NV_read_buffer_front glatter_extension_supported_GL(GLATTER_EXT_GL_NV_read_buffer_front)
+#define glatter_GL_NV_read_depth glatter_extension_supported_GL(GLATTER_EXT_GL_NV_read_depth)
+#define glatter_GL_NV_read_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_NV_read_depth_stencil)
+#define glatter_GL_NV_read_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_NV_read_stencil)
+#define glatter_GL_NV_representative_fragment_test glatter_extension_supported_GL(GLATTER_EXT_GL_NV_representative_fragment_test)
+#define glatter_GL_NV_sRGB_formats glatter_extension_supported_GL(GLATTER_EXT_GL_NV_sRGB_formats)
+#define glatter_GL_NV_sample_locations glatter_extension_supported_GL(GLATTER_EXT_GL_NV_sample_locations)
+#define glatter_GL_NV_sample_mask_override_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_NV_sample_mask_override_coverage)
+#define glatter_GL_NV_scissor_exclusive glatter_extension_supported_GL(GLATTER_EXT_GL_NV_scissor_exclusive)
+#define glatter_GL_NV_shader_atomic_fp16_vector glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_atomic_fp16_vector)
+#define glatter_GL_NV_shader_noperspective_interpolation glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_noperspective_interpolation)
+#define glatter_GL_NV_shader_subgroup_partitioned glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_subgroup_partitioned)
+#define glatter_GL_NV_shader_texture_footprint glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_texture_footprint)
+#define glatter_GL_NV_shading_rate_image glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shading_rate_image)
+#define glatter_GL_NV_shadow_samplers_array glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shadow_samplers_array)
+#define glatter_GL_NV_shadow_samplers_cube glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shadow_samplers_cube)
+#define glatter_GL_NV_stereo_view_rendering glatter_extension_supported_GL(GLATTER_EXT_GL_NV_stereo_view_rendering)
+#define glatter_GL_NV_texture_barrier glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_barrier)
+#define glatter_GL_NV_texture_border_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_border_clamp)
+#define glatter_GL_NV_texture_compression_s3tc_update glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_compression_s3tc_update)
+#define glatter_GL_NV_texture_npot_2D_mipmap glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_npot_2D_mipmap)
+#define glatter_GL_NV_timeline_semaphore glatter_extension_supported_GL(GLATTER_EXT_GL_NV_timeline_semaphore)
+#define glatter_GL_NV_viewport_array glatter_extension_supported_GL(GLATTER_EXT_GL_NV_viewport_array)
+#define glatter_GL_NV_viewport_array2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_viewport_array2)
+#define glatter_GL_NV_viewport_swizzle glatter_extension_supported_GL(GLATTER_EXT_GL_NV_viewport_swizzle)
+#define glatter_GL_OES_EGL_image glatter_extension_supported_GL(GLATTER_EXT_GL_OES_EGL_image)
+#define glatter_GL_OES_EGL_image_external glatter_extension_supported_GL(GLATTER_EXT_GL_OES_EGL_image_external)
+#define glatter_GL_OES_EGL_image_external_essl3 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_EGL_image_external_essl3)
+#define glatter_GL_OES_blend_equation_separate glatter_extension_supported_GL(GLATTER_EXT_GL_OES_blend_equation_separate)
+#define glatter_GL_OES_blend_func_separate glatter_extension_supported_GL(GLATTER_EXT_GL_OES_blend_func_separate)
+#define glatter_GL_OES_blend_subtract glatter_extension_supported_GL(GLATTER_EXT_GL_OES_blend_subtract)
+#define glatter_GL_OES_byte_coordinates glatter_extension_supported_GL(GLATTER_EXT_GL_OES_byte_coordinates)
+#define glatter_GL_OES_compressed_ETC1_RGB8_sub_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OES_compressed_ETC1_RGB8_sub_texture)
+#define glatter_GL_OES_compressed_ETC1_RGB8_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OES_compressed_ETC1_RGB8_texture)
+#define glatter_GL_OES_compressed_paletted_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OES_compressed_paletted_texture)
+#define glatter_GL_OES_copy_image glatter_extension_supported_GL(GLATTER_EXT_GL_OES_copy_image)
+#define glatter_GL_OES_depth24 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_depth24)
+#define glatter_GL_OES_depth32 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_depth32)
+#define glatter_GL_OES_depth_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OES_depth_texture)
+#define glatter_GL_OES_draw_buffers_indexed glatter_extension_supported_GL(GLATTER_EXT_GL_OES_draw_buffers_indexed)
+#define glatter_GL_OES_draw_elements_base_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_OES_draw_elements_base_vertex)
+#define glatter_GL_OES_draw_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OES_draw_texture)
+#define glatter_GL_OES_element_index_uint glatter_extension_supported_GL(GLATTER_EXT_GL_OES_element_index_uint)
+#define glatter_GL_OES_extended_matrix_palette glatter_extension_supported_GL(GLATTER_EXT_GL_OES_extended_matrix_palette)
+#define glatter_GL_OES_fbo_render_mipmap glatter_extension_supported_GL(GLATTER_EXT_GL_OES_fbo_render_mipmap)
+#define glatter_GL_OES_fixed_point glatter_extension_supported_GL(GLATTER_EXT_GL_OES_fixed_point)
+#define glatter_GL_OES_fragment_precision_high glatter_extension_supported_GL(GLATTER_EXT_GL_OES_fragment_precision_high)
+#define glatter_GL_OES_framebuffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_OES_framebuffer_object)
+#define glatter_GL_OES_geometry_point_size glatter_extension_supported_GL(GLATTER_EXT_GL_OES_geometry_point_size)
+#define glatter_GL_OES_geometry_shader glatter_extension_supported_GL(GLATTER_EXT_GL_OES_geometry_shader)
+#define glatter_GL_OES_get_program_binary glatter_extension_supported_GL(GLATTER_EXT_GL_OES_get_program_binary)
+#define glatter_GL_OES_gpu_shader5 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_gpu_shader5)
+#define glatter_GL_OES_mapbuffer glatter_extension_supported_GL(GLATTER_EXT_GL_OES_mapbuffer)
+#define glatter_GL_OES_matrix_get glatter_extension_supported_GL(GLATTER_EXT_GL_OES_matrix_get)
+#define glatter_GL_OES_matrix_palette glatter_extension_supported_GL(GLATTER_EXT_GL_OES_matrix_palette)
+#define glatter_GL_OES_packed_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_OES_packed_depth_stencil)
+#define glatter_GL_OES_point_size_array glatter_extension_supported_GL(GLATTER_EXT_GL_OES_point_size_array)
+#define glatter_GL_OES_point_sprite glatter_extension_supported_GL(GLATTER_EXT_GL_OES_point_sprite)
+#define glatter_GL_OES_primitive_bounding_box glatter_extension_supported_GL(GLATTER_EXT_GL_OES_primitive_bounding_box)
+#define glatter_GL_OES_query_matrix glatter_extension_supported_GL(GLATTER_EXT_GL_OES_query_matrix)
+#define glatter_GL_OES_read_format glatter_extension_supported_GL(GLATTER_EXT_GL_OES_read_format)
+#define glatter_GL_OES_required_internalformat glatter_extension_supported_GL(GLATTER_EXT_GL_OES_required_internalformat)
+#define glatter_GL_OES_rgb8_rgba8 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_rgb8_rgba8)
+#define glatter_GL_OES_sample_shading glatter_extension_supported_GL(GLATTER_EXT_GL_OES_sample_shading)
+#define glatter_GL_OES_sample_variables glatter_extension_supported_GL(GLATTER_EXT_GL_OES_sample_variables)
+#define glatter_GL_OES_shader_image_atomic glatter_extension_supported_GL(GLATTER_EXT_GL_OES_shader_image_atomic)
+#define glatter_GL_OES_shader_io_blocks glatter_extension_supported_GL(GLATTER_EXT_GL_OES_shader_io_blocks)
+#define glatter_GL_OES_shader_multisample_interpolation glatter_extension_supported_GL(GLATTER_EXT_GL_OES_shader_multisample_interpolation)
+#define glatter_GL_OES_single_precision glatter_extension_supported_GL(GLATTER_EXT_GL_OES_single_precision)
+#define glatter_GL_OES_standard_derivatives glatter_extension_supported_GL(GLATTER_EXT_GL_OES_standard_derivatives)
+#define glatter_GL_OES_stencil1 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_stencil1)
+#define glatter_GL_OES_stencil4 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_stencil4)
+#define glatter_GL_OES_stencil8 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_stencil8)
+#define glatter_GL_OES_stencil_wrap glatter_extension_supported_GL(GLATTER_EXT_GL_OES_stencil_wrap)
+#define glatter_GL_OES_surfaceless_context glatter_extension_supported_GL(GLATTER_EXT_GL_OES_surfaceless_context)
+#define glatter_GL_OES_tessellation_point_size glatter_extension_supported_GL(GLATTER_EXT_GL_OES_tessellation_point_size)
+#define glatter_GL_OES_tessellation_shader glatter_extension_supported_GL(GLATTER_EXT_GL_OES_tessellation_shader)
+#define glatter_GL_OES_texture_3D glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_3D)
+#define glatter_GL_OES_texture_border_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_border_clamp)
+#define glatter_GL_OES_texture_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_buffer)
+#define glatter_GL_OES_texture_compression_astc glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_compression_astc)
+#define glatter_GL_OES_texture_cube_map glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_cube_map)
+#define glatter_GL_OES_texture_cube_map_array glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_cube_map_array)
+#define glatter_GL_OES_texture_env_crossbar glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_env_crossbar)
+#define glatter_GL_OES_texture_float glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_float)
+#define glatter_GL_OES_texture_float_linear glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_float_linear)
+#define glatter_GL_OES_texture_half_float glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_half_float)
+#define glatter_GL_OES_texture_half_float_linear glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_half_float_linear)
+#define glatter_GL_OES_texture_mirrored_repeat glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_mirrored_repeat)
+#define glatter_GL_OES_texture_npot glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_npot)
+#define glatter_GL_OES_texture_stencil8 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_stencil8)
+#define glatter_GL_OES_texture_storage_multisample_2d_array glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_storage_multisample_2d_array)
+#define glatter_GL_OES_texture_view glatter_extension_supported_GL(GLATTER_EXT_GL_OES_texture_view)
+#define glatter_GL_OES_vertex_array_object glatter_extension_supported_GL(GLATTER_EXT_GL_OES_vertex_array_object)
+#define glatter_GL_OES_vertex_half_float glatter_extension_supported_GL(GLATTER_EXT_GL_OES_vertex_half_float)
+#define glatter_GL_OES_vertex_type_10_10_10_2 glatter_extension_supported_GL(GLATTER_EXT_GL_OES_vertex_type_10_10_10_2)
+#define glatter_GL_OES_viewport_array glatter_extension_supported_GL(GLATTER_EXT_GL_OES_viewport_array)
+#define glatter_GL_OVR_multiview glatter_extension_supported_GL(GLATTER_EXT_GL_OVR_multiview)
+#define glatter_GL_OVR_multiview2 glatter_extension_supported_GL(GLATTER_EXT_GL_OVR_multiview2)
+#define glatter_GL_OVR_multiview_multisampled_render_to_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OVR_multiview_multisampled_render_to_texture)
+#define glatter_GL_QCOM_YUV_texture_gather glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_YUV_texture_gather)
+#define glatter_GL_QCOM_alpha_test glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_alpha_test)
+#define glatter_GL_QCOM_binning_control glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_binning_control)
+#define glatter_GL_QCOM_driver_control glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_driver_control)
+#define glatter_GL_QCOM_extended_get glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_extended_get)
+#define glatter_GL_QCOM_extended_get2 glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_extended_get2)
+#define glatter_GL_QCOM_frame_extrapolation glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_frame_extrapolation)
+#define glatter_GL_QCOM_framebuffer_foveated glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_framebuffer_foveated)
+#define glatter_GL_QCOM_motion_estimation glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_motion_estimation)
+#define glatter_GL_QCOM_perfmon_global_mode glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_perfmon_global_mode)
+#define glatter_GL_QCOM_render_sRGB_R8_RG8 glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_render_sRGB_R8_RG8)
+#define glatter_GL_QCOM_render_shared_exponent glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_render_shared_exponent)
+#define glatter_GL_QCOM_shader_framebuffer_fetch_noncoherent glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_shader_framebuffer_fetch_noncoherent)
+#define glatter_GL_QCOM_shader_framebuffer_fetch_rate glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_shader_framebuffer_fetch_rate)
+#define glatter_GL_QCOM_shading_rate glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_shading_rate)
+#define glatter_GL_QCOM_texture_foveated glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_texture_foveated)
+#define glatter_GL_QCOM_texture_foveated2 glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_texture_foveated2)
+#define glatter_GL_QCOM_texture_foveated_subsampled_layout glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_texture_foveated_subsampled_layout)
+#define glatter_GL_QCOM_texture_lod_bias glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_texture_lod_bias)
+#define glatter_GL_QCOM_tiled_rendering glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_tiled_rendering)
+#define glatter_GL_QCOM_writeonly_rendering glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_writeonly_rendering)
+#define glatter_GL_QCOM_ycbcr_degamma glatter_extension_supported_GL(GLATTER_EXT_GL_QCOM_ycbcr_degamma)
+#define glatter_GL_VIV_shader_binary glatter_extension_supported_GL(GLATTER_EXT_GL_VIV_shader_binary)
 
 
-#define glatter_GL_AMD_compressed_3DC_texture glatter_get_extension_support_GL().has_GL_AMD_compressed_3DC_texture
-#define glatter_GL_AMD_compressed_ATC_texture glatter_get_extension_support_GL().has_GL_AMD_compressed_ATC_texture
-#define glatter_GL_AMD_framebuffer_multisample_advanced glatter_get_extension_support_GL().has_GL_AMD_framebuffer_multisample_advanced
-#define glatter_GL_AMD_performance_monitor glatter_get_extension_support_GL().has_GL_AMD_performance_monitor
-#define glatter_GL_AMD_program_binary_Z400 glatter_get_extension_support_GL().has_GL_AMD_program_binary_Z400
-#define glatter_GL_ANDROID_extension_pack_es31a glatter_get_extension_support_GL().has_GL_ANDROID_extension_pack_es31a
-#define glatter_GL_ANGLE_depth_texture glatter_get_extension_support_GL().has_GL_ANGLE_depth_texture
-#define glatter_GL_ANGLE_framebuffer_blit glatter_get_extension_support_GL().has_GL_ANGLE_framebuffer_blit
-#define glatter_GL_ANGLE_framebuffer_multisample glatter_get_extension_support_GL().has_GL_ANGLE_framebuffer_multisample
-#define glatter_GL_ANGLE_instanced_arrays glatter_get_extension_support_GL().has_GL_ANGLE_instanced_arrays
-#define glatter_GL_ANGLE_pack_reverse_row_order glatter_get_extension_support_GL().has_GL_ANGLE_pack_reverse_row_order
-#define glatter_GL_ANGLE_program_binary glatter_get_extension_support_GL().has_GL_ANGLE_program_binary
-#define glatter_GL_ANGLE_texture_compression_dxt3 glatter_get_extension_support_GL().has_GL_ANGLE_texture_compression_dxt3
-#define glatter_GL_ANGLE_texture_compression_dxt5 glatter_get_extension_support_GL().has_GL_ANGLE_texture_compression_dxt5
-#define glatter_GL_ANGLE_texture_usage glatter_get_extension_support_GL().has_GL_ANGLE_texture_usage
-#define glatter_GL_ANGLE_translated_shader_source glatter_get_extension_support_GL().has_GL_ANGLE_translated_shader_source
-#define glatter_GL_APPLE_clip_distance glatter_get_extension_support_GL().has_GL_APPLE_clip_distance
-#define glatter_GL_APPLE_color_buffer_packed_float glatter_get_extension_support_GL().has_GL_APPLE_color_buffer_packed_float
-#define glatter_GL_APPLE_copy_texture_levels glatter_get_extension_support_GL().has_GL_APPLE_copy_texture_levels
-#define glatter_GL_APPLE_framebuffer_multisample glatter_get_extension_support_GL().has_GL_APPLE_framebuffer_multisample
-#define glatter_GL_APPLE_rgb_422 glatter_get_extension_support_GL().has_GL_APPLE_rgb_422
-#define glatter_GL_APPLE_sync glatter_get_extension_support_GL().has_GL_APPLE_sync
-#define glatter_GL_APPLE_texture_2D_limited_npot glatter_get_extension_support_GL().has_GL_APPLE_texture_2D_limited_npot
-#define glatter_GL_APPLE_texture_format_BGRA8888 glatter_get_extension_support_GL().has_GL_APPLE_texture_format_BGRA8888
-#define glatter_GL_APPLE_texture_max_level glatter_get_extension_support_GL().has_GL_APPLE_texture_max_level
-#define glatter_GL_APPLE_texture_packed_float glatter_get_extension_support_GL().has_GL_APPLE_texture_packed_float
-#define glatter_GL_ARM_mali_program_binary glatter_get_extension_support_GL().has_GL_ARM_mali_program_binary
-#define glatter_GL_ARM_mali_shader_binary glatter_get_extension_support_GL().has_GL_ARM_mali_shader_binary
-#define glatter_GL_ARM_rgba8 glatter_get_extension_support_GL().has_GL_ARM_rgba8
-#define glatter_GL_ARM_shader_core_properties glatter_get_extension_support_GL().has_GL_ARM_shader_core_properties
-#define glatter_GL_ARM_shader_framebuffer_fetch glatter_get_extension_support_GL().has_GL_ARM_shader_framebuffer_fetch
-#define glatter_GL_ARM_shader_framebuffer_fetch_depth_stencil glatter_get_extension_support_GL().has_GL_ARM_shader_framebuffer_fetch_depth_stencil
-#define glatter_GL_ARM_texture_unnormalized_coordinates glatter_get_extension_support_GL().has_GL_ARM_texture_unnormalized_coordinates
-#define glatter_GL_DMP_program_binary glatter_get_extension_support_GL().has_GL_DMP_program_binary
-#define glatter_GL_DMP_shader_binary glatter_get_extension_support_GL().has_GL_DMP_shader_binary
-#define glatter_GL_EXT_EGL_image_array glatter_get_extension_support_GL().has_GL_EXT_EGL_image_array
-#define glatter_GL_EXT_EGL_image_storage glatter_get_extension_support_GL().has_GL_EXT_EGL_image_storage
-#define glatter_GL_EXT_EGL_image_storage_compression glatter_get_extension_support_GL().has_GL_EXT_EGL_image_storage_compression
-#define glatter_GL_EXT_YUV_target glatter_get_extension_support_GL().has_GL_EXT_YUV_target
-#define glatter_GL_EXT_base_instance glatter_get_extension_support_GL().has_GL_EXT_base_instance
-#define glatter_GL_EXT_blend_func_extended glatter_get_extension_support_GL().has_GL_EXT_blend_func_extended
-#define glatter_GL_EXT_blend_minmax glatter_get_extension_support_GL().has_GL_EXT_blend_minmax
-#define glatter_GL_EXT_buffer_storage glatter_get_extension_support_GL().has_GL_EXT_buffer_storage
-#define glatter_GL_EXT_clear_texture glatter_get_extension_support_GL().has_GL_EXT_clear_texture
-#define glatter_GL_EXT_clip_control glatter_get_extension_support_GL().has_GL_EXT_clip_control
-#define glatter_GL_EXT_clip_cull_distance glatter_get_extension_support_GL().has_GL_EXT_clip_cull_distance
-#define glatter_GL_EXT_color_buffer_float glatter_get_extension_support_GL().has_GL_EXT_color_buffer_float
-#define glatter_GL_EXT_color_buffer_half_float glatter_get_extension_support_GL().has_GL_EXT_color_buffer_half_float
-#define glatter_GL_EXT_conservative_depth glatter_get_extension_support_GL().has_GL_EXT_conservative_depth
-#define glatter_GL_EXT_copy_image glatter_get_extension_support_GL().has_GL_EXT_copy_image
-#define glatter_GL_EXT_debug_label glatter_get_extension_support_GL().has_GL_EXT_debug_label
-#define glatter_GL_EXT_debug_marker glatter_get_extension_support_GL().has_GL_EXT_debug_marker
-#define glatter_GL_EXT_depth_clamp glatter_get_extension_support_GL().has_GL_EXT_depth_clamp
-#define glatter_GL_EXT_discard_framebuffer glatter_get_extension_support_GL().has_GL_EXT_discard_framebuffer
-#define glatter_GL_EXT_disjoint_timer_query glatter_get_extension_support_GL().has_GL_EXT_disjoint_timer_query
-#define glatter_GL_EXT_draw_buffers glatter_get_extension_support_GL().has_GL_EXT_draw_buffers
-#define glatter_GL_EXT_draw_buffers_indexed glatter_get_extension_support_GL().has_GL_EXT_draw_buffers_indexed
-#define glatter_GL_EXT_draw_elements_base_vertex glatter_get_extension_support_GL().has_GL_EXT_draw_elements_base_vertex
-#define glatter_GL_EXT_draw_instanced glatter_get_extension_support_GL().has_GL_EXT_draw_instanced
-#define glatter_GL_EXT_draw_transform_feedback glatter_get_extension_support_GL().has_GL_EXT_draw_transform_feedback
-#define glatter_GL_EXT_external_buffer glatter_get_extension_support_GL().has_GL_EXT_external_buffer
-#define glatter_GL_EXT_float_blend glatter_get_extension_support_GL().has_GL_EXT_float_blend
-#define glatter_GL_EXT_fragment_shading_rate glatter_get_extension_support_GL().has_GL_EXT_fragment_shading_rate
-#define glatter_GL_EXT_framebuffer_blit_layers glatter_get_extension_support_GL().has_GL_EXT_framebuffer_blit_layers
-#define glatter_GL_EXT_geometry_point_size glatter_get_extension_support_GL().has_GL_EXT_geometry_point_size
-#define glatter_GL_EXT_geometry_shader glatter_get_extension_support_GL().has_GL_EXT_geometry_shader
-#define glatter_GL_EXT_gpu_shader5 glatter_get_extension_support_GL().has_GL_EXT_gpu_shader5
-#define glatter_GL_EXT_instanced_arrays glatter_get_extension_support_GL().has_GL_EXT_instanced_arrays
-#define glatter_GL_EXT_map_buffer_range glatter_get_extension_support_GL().has_GL_EXT_map_buffer_range
-#define glatter_GL_EXT_memory_object glatter_get_extension_support_GL().has_GL_EXT_memory_object
-#define glatter_GL_EXT_memory_object_fd glatter_get_extension_support_GL().has_GL_EXT_memory_object_fd
-#define glatter_GL_EXT_memory_object_win32 glatter_get_extension_support_GL().has_GL_EXT_memory_object_win32
-#define glatter_GL_EXT_mesh_shader glatter_get_extension_support_GL().has_GL_EXT_mesh_shader
-#define glatter_GL_EXT_multi_draw_arrays glatter_get_extension_support_GL().has_GL_EXT_multi_draw_arrays
-#define glatter_GL_EXT_multi_draw_indirect glatter_get_extension_support_GL().has_GL_EXT_multi_draw_indirect
-#define glatter_GL_EXT_multisampled_compatibility glatter_get_extension_support_GL().has_GL_EXT_multisampled_compatibility
-#define glatter_GL_EXT_multisampled_render_to_texture glatter_get_extension_support_GL().has_GL_EXT_multisampled_render_to_texture
-#define glatter_GL_EXT_multisampled_render_to_texture2 glatter_get_extension_support_GL().has_GL_EXT_multisampled_render_to_texture2
-#define glatter_GL_EXT_multiview_draw_buffers glatter_get_extension_support_GL().has_GL_EXT_multiview_draw_buffers
-#define glatter_GL_EXT_multiview_tessellation_geometry_shader glatter_get_extension_support_GL().has_GL_EXT_multiview_tessellation_geometry_shader
-#define glatter_GL_EXT_multiview_texture_multisample glatter_get_extension_support_GL().has_GL_EXT_multiview_texture_multisample
-#define glatter_GL_EXT_multiview_timer_query glatter_get_extension_support_GL().has_GL_EXT_multiview_timer_query
-#define glatter_GL_EXT_occlusion_query_boolean glatter_get_extension_support_GL().has_GL_EXT_occlusion_query_boolean
-#define glatter_GL_EXT_polygon_offset_clamp glatter_get_extension_support_GL().has_GL_EXT_polygon_offset_clamp
-#define glatter_GL_EXT_post_depth_coverage glatter_get_extension_support_GL().has_GL_EXT_post_depth_coverage
-#define glatter_GL_EXT_primitive_bounding_box glatter_get_extension_support_GL().has_GL_EXT_primitive_bounding_box
-#define glatter_GL_EXT_protected_textures glatter_get_extension_support_GL().has_GL_EXT_protected_textures
-#define glatter_GL_EXT_pvrtc_sRGB glatter_get_extension_support_GL().has_GL_EXT_pvrtc_sRGB
-#define glatter_GL_EXT_raster_multisample glatter_get_extension_support_GL().has_GL_EXT_raster_multisample
-#define glatter_GL_EXT_read_format_bgra glatter_get_extension_support_GL().has_GL_EXT_read_format_bgra
-#define glatter_GL_EXT_render_snorm glatter_get_extension_support_GL().has_GL_EXT_render_snorm
-#define glatter_GL_EXT_robustness glatter_get_extension_support_GL().has_GL_EXT_robustness
-#define glatter_GL_EXT_sRGB glatter_get_extension_support_GL().has_GL_EXT_sRGB
-#define glatter_GL_EXT_sRGB_write_control glatter_get_extension_support_GL().has_GL_EXT_sRGB_write_control
-#define glatter_GL_EXT_semaphore glatter_get_extension_support_GL().has_GL_EXT_semaphore
-#define glatter_GL_EXT_semaphore_fd glatter_get_extension_support_GL().has_GL_EXT_semaphore_fd
-#define glatter_GL_EXT_semaphore_win32 glatter_get_extension_support_GL().has_GL_EXT_semaphore_win32
-#define glatter_GL_EXT_separate_depth_stencil glatter_get_extension_support_GL().has_GL_EXT_separate_depth_stencil
-#define glatter_GL_EXT_separate_shader_objects glatter_get_extension_support_GL().has_GL_EXT_separate_shader_objects
-#define glatter_GL_EXT_shader_framebuffer_fetch glatter_get_extension_support_GL().has_GL_EXT_shader_framebuffer_fetch
-#define glatter_GL_EXT_shader_framebuffer_fetch_non_coherent glatter_get_extension_support_GL().has_GL_EXT_shader_framebuffer_fetch_non_coherent
-#define glatter_GL_EXT_shader_group_vote glatter_get_extension_support_GL().has_GL_EXT_shader_group_vote
-#define glatter_GL_EXT_shader_implicit_conversions glatter_get_extension_support_GL().has_GL_EXT_shader_implicit_conversions
-#define glatter_GL_EXT_shader_integer_mix glatter_get_extension_support_GL().has_GL_EXT_shader_integer_mix
-#define glatter_GL_EXT_shader_io_blocks glatter_get_extension_support_GL().has_GL_EXT_shader_io_blocks
-#define glatter_GL_EXT_shader_non_constant_global_initializers glatter_get_extension_support_GL().has_GL_EXT_shader_non_constant_global_initializers
-#define glatter_GL_EXT_shader_pixel_local_storage glatter_get_extension_support_GL().has_GL_EXT_shader_pixel_local_storage
-#define glatter_GL_EXT_shader_pixel_local_storage2 glatter_get_extension_support_GL().has_GL_EXT_shader_pixel_local_storage2
-#define glatter_GL_EXT_shader_samples_identical glatter_get_extension_support_GL().has_GL_EXT_shader_samples_identical
-#define glatter_GL_EXT_shader_texture_lod glatter_get_extension_support_GL().has_GL_EXT_shader_texture_lod
-#define glatter_GL_EXT_shader_texture_samples glatter_get_extension_support_GL().has_GL_EXT_shader_texture_samples
-#define glatter_GL_EXT_shadow_samplers glatter_get_extension_support_GL().has_GL_EXT_shadow_samplers
-#define glatter_GL_EXT_sparse_texture glatter_get_extension_support_GL().has_GL_EXT_sparse_texture
-#define glatter_GL_EXT_sparse_texture2 glatter_get_extension_support_GL().has_GL_EXT_sparse_texture2
-#define glatter_GL_EXT_tessellation_point_size glatter_get_extension_support_GL().has_GL_EXT_tessellation_point_size
-#define glatter_GL_EXT_tessellation_shader glatter_get_extension_support_GL().has_GL_EXT_tessellation_shader
-#define glatter_GL_EXT_texture_border_clamp glatter_get_extension_support_GL().has_GL_EXT_texture_border_clamp
-#define glatter_GL_EXT_texture_buffer glatter_get_extension_support_GL().has_GL_EXT_texture_buffer
-#define glatter_GL_EXT_texture_compression_astc_decode_mode glatter_get_extension_support_GL().has_GL_EXT_texture_compression_astc_decode_mode
-#define glatter_GL_EXT_texture_compression_bptc glatter_get_extension_support_GL().has_GL_EXT_texture_compression_bptc
-#define glatter_GL_EXT_texture_compression_dxt1 glatter_get_extension_support_GL().has_GL_EXT_texture_compression_dxt1
-#define glatter_GL_EXT_texture_compression_rgtc glatter_get_extension_support_GL().has_GL_EXT_texture_compression_rgtc
-#define glatter_GL_EXT_texture_compression_s3tc glatter_get_extension_support_GL().has_GL_EXT_texture_compression_s3tc
-#define glatter_GL_EXT_texture_compression_s3tc_srgb glatter_get_extension_support_GL().has_GL_EXT_texture_compression_s3tc_srgb
-#define glatter_GL_EXT_texture_cube_map_array glatter_get_extension_support_GL().has_GL_EXT_texture_cube_map_array
-#define glatter_GL_EXT_texture_filter_anisotropic glatter_get_extension_support_GL().has_GL_EXT_texture_filter_anisotropic
-#define glatter_GL_EXT_texture_filter_minmax glatter_get_extension_support_GL().has_GL_EXT_texture_filter_minmax
-#define glatter_GL_EXT_texture_format_BGRA8888 glatter_get_extension_support_GL().has_GL_EXT_texture_format_BGRA8888
-#define glatter_GL_EXT_texture_format_sRGB_override glatter_get_extension_support_GL().has_GL_EXT_texture_format_sRGB_override
-#define glatter_GL_EXT_texture_lod_bias glatter_get_extension_support_GL().has_GL_EXT_texture_lod_bias
-#define glatter_GL_EXT_texture_mirror_clamp_to_edge glatter_get_extension_support_GL().has_GL_EXT_texture_mirror_clamp_to_edge
-#define glatter_GL_EXT_texture_norm16 glatter_get_extension_support_GL().has_GL_EXT_texture_norm16
-#define glatter_GL_EXT_texture_query_lod glatter_get_extension_support_GL().has_GL_EXT_texture_query_lod
-#define glatter_GL_EXT_texture_rg glatter_get_extension_support_GL().has_GL_EXT_texture_rg
-#define glatter_GL_EXT_texture_sRGB_R8 glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB_R8
-#define glatter_GL_EXT_texture_sRGB_RG8 glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB_RG8
-#define glatter_GL_EXT_texture_sRGB_decode glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB_decode
-#define glatter_GL_EXT_texture_shadow_lod glatter_get_extension_support_GL().has_GL_EXT_texture_shadow_lod
-#define glatter_GL_EXT_texture_storage glatter_get_extension_support_GL().has_GL_EXT_texture_storage
-#define glatter_GL_EXT_texture_storage_compression glatter_get_extension_support_GL().has_GL_EXT_texture_storage_compression
-#define glatter_GL_EXT_texture_type_2_10_10_10_REV glatter_get_extension_support_GL().has_GL_EXT_texture_type_2_10_10_10_REV
-#define glatter_GL_EXT_texture_view glatter_get_extension_support_GL().has_GL_EXT_texture_view
-#define glatter_GL_EXT_unpack_subimage glatter_get_extension_support_GL().has_GL_EXT_unpack_subimage
-#define glatter_GL_EXT_win32_keyed_mutex glatter_get_extension_support_GL().has_GL_EXT_win32_keyed_mutex
-#define glatter_GL_EXT_window_rectangles glatter_get_extension_support_GL().has_GL_EXT_window_rectangles
-#define glatter_GL_FJ_shader_binary_GCCSO glatter_get_extension_support_GL().has_GL_FJ_shader_binary_GCCSO
-#define glatter_GL_IMG_bindless_texture glatter_get_extension_support_GL().has_GL_IMG_bindless_texture
-#define glatter_GL_IMG_framebuffer_downsample glatter_get_extension_support_GL().has_GL_IMG_framebuffer_downsample
-#define glatter_GL_IMG_multisampled_render_to_texture glatter_get_extension_support_GL().has_GL_IMG_multisampled_render_to_texture
-#define glatter_GL_IMG_program_binary glatter_get_extension_support_GL().has_GL_IMG_program_binary
-#define glatter_GL_IMG_read_format glatter_get_extension_support_GL().has_GL_IMG_read_format
-#define glatter_GL_IMG_shader_binary glatter_get_extension_support_GL().has_GL_IMG_shader_binary
-#define glatter_GL_IMG_texture_compression_pvrtc glatter_get_extension_support_GL().has_GL_IMG_texture_compression_pvrtc
-#define glatter_GL_IMG_texture_compression_pvrtc2 glatter_get_extension_support_GL().has_GL_IMG_texture_compression_pvrtc2
-#define glatter_GL_IMG_texture_env_enhanced_fixed_function glatter_get_extension_support_GL().has_GL_IMG_texture_env_enhanced_fixed_function
-#define glatter_GL_IMG_texture_filter_cubic glatter_get_extension_support_GL().has_GL_IMG_texture_filter_cubic
-#define glatter_GL_IMG_user_clip_plane glatter_get_extension_support_GL().has_GL_IMG_user_clip_plane
-#define glatter_GL_INTEL_blackhole_render glatter_get_extension_support_GL().has_GL_INTEL_blackhole_render
-#define glatter_GL_INTEL_conservative_rasterization glatter_get_extension_support_GL().has_GL_INTEL_conservative_rasterization
-#define glatter_GL_INTEL_framebuffer_CMAA glatter_get_extension_support_GL().has_GL_INTEL_framebuffer_CMAA
-#define glatter_GL_INTEL_performance_query glatter_get_extension_support_GL().has_GL_INTEL_performance_query
-#define glatter_GL_KHR_blend_equation_advanced glatter_get_extension_support_GL().has_GL_KHR_blend_equation_advanced
-#define glatter_GL_KHR_blend_equation_advanced_coherent glatter_get_extension_support_GL().has_GL_KHR_blend_equation_advanced_coherent
-#define glatter_GL_KHR_context_flush_control glatter_get_extension_support_GL().has_GL_KHR_context_flush_control
-#define glatter_GL_KHR_debug glatter_get_extension_support_GL().has_GL_KHR_debug
-#define glatter_GL_KHR_no_error glatter_get_extension_support_GL().has_GL_KHR_no_error
-#define glatter_GL_KHR_parallel_shader_compile glatter_get_extension_support_GL().has_GL_KHR_parallel_shader_compile
-#define glatter_GL_KHR_robust_buffer_access_behavior glatter_get_extension_support_GL().has_GL_KHR_robust_buffer_access_behavior
-#define glatter_GL_KHR_robustness glatter_get_extension_support_GL().has_GL_KHR_robustness
-#define glatter_GL_KHR_shader_subgroup glatter_get_extension_support_GL().has_GL_KHR_shader_subgroup
-#define glatter_GL_KHR_texture_compression_astc_hdr glatter_get_extension_support_GL().has_GL_KHR_texture_compression_astc_hdr
-#define glatter_GL_KHR_texture_compression_astc_ldr glatter_get_extension_support_GL().has_GL_KHR_texture_compression_astc_ldr
-#define glatter_GL_KHR_texture_compression_astc_sliced_3d glatter_get_extension_support_GL().has_GL_KHR_texture_compression_astc_sliced_3d
-#define glatter_GL_MESA_bgra glatter_get_extension_support_GL().has_GL_MESA_bgra
-#define glatter_GL_MESA_framebuffer_flip_x glatter_get_extension_support_GL().has_GL_MESA_framebuffer_flip_x
-#define glatter_GL_MESA_framebuffer_flip_y glatter_get_extension_support_GL().has_GL_MESA_framebuffer_flip_y
-#define glatter_GL_MESA_framebuffer_swap_xy glatter_get_extension_support_GL().has_GL_MESA_framebuffer_swap_xy
-#define glatter_GL_MESA_program_binary_formats glatter_get_extension_support_GL().has_GL_MESA_program_binary_formats
-#define glatter_GL_MESA_sampler_objects glatter_get_extension_support_GL().has_GL_MESA_sampler_objects
-#define glatter_GL_MESA_shader_integer_functions glatter_get_extension_support_GL().has_GL_MESA_shader_integer_functions
-#define glatter_GL_MESA_texture_const_bandwidth glatter_get_extension_support_GL().has_GL_MESA_texture_const_bandwidth
-#define glatter_GL_NVX_blend_equation_advanced_multi_draw_buffers glatter_get_extension_support_GL().has_GL_NVX_blend_equation_advanced_multi_draw_buffers
-#define glatter_GL_NV_bindless_texture glatter_get_extension_support_GL().has_GL_NV_bindless_texture
-#define glatter_GL_NV_blend_equation_advanced glatter_get_extension_support_GL().has_GL_NV_blend_equation_advanced
-#define glatter_GL_NV_blend_equation_advanced_coherent glatter_get_extension_support_GL().has_GL_NV_blend_equation_advanced_coherent
-#define glatter_GL_NV_blend_minmax_factor glatter_get_extension_support_GL().has_GL_NV_blend_minmax_factor
-#define glatter_GL_NV_clip_space_w_scaling glatter_get_extension_support_GL().has_GL_NV_clip_space_w_scaling
-#define glatter_GL_NV_compute_shader_derivatives glatter_get_extension_support_GL().has_GL_NV_compute_shader_derivatives
-#define glatter_GL_NV_conditional_render glatter_get_extension_support_GL().has_GL_NV_conditional_render
-#define glatter_GL_NV_conservative_raster glatter_get_extension_support_GL().has_GL_NV_conservative_raster
-#define glatter_GL_NV_conservative_raster_pre_snap glatter_get_extension_support_GL().has_GL_NV_conservative_raster_pre_snap
-#define glatter_GL_NV_conservative_raster_pre_snap_triangles glatter_get_extension_support_GL().has_GL_NV_conservative_raster_pre_snap_triangles
-#define glatter_GL_NV_copy_buffer glatter_get_extension_support_GL().has_GL_NV_copy_buffer
-#define glatter_GL_NV_coverage_sample glatter_get_extension_support_GL().has_GL_NV_coverage_sample
-#define glatter_GL_NV_depth_nonlinear glatter_get_extension_support_GL().has_GL_NV_depth_nonlinear
-#define glatter_GL_NV_draw_buffers glatter_get_extension_support_GL().has_GL_NV_draw_buffers
-#define glatter_GL_NV_draw_instanced glatter_get_extension_support_GL().has_GL_NV_draw_instanced
-#define glatter_GL_NV_draw_vulkan_image glatter_get_extension_support_GL().has_GL_NV_draw_vulkan_image
-#define glatter_GL_NV_explicit_attrib_location glatter_get_extension_support_GL().has_GL_NV_explicit_attrib_location
-#define glatter_GL_NV_fbo_color_attachments glatter_get_extension_support_GL().has_GL_NV_fbo_color_attachments
-#define glatter_GL_NV_fence glatter_get_extension_support_GL().has_GL_NV_fence
-#define glatter_GL_NV_fill_rectangle glatter_get_extension_support_GL().has_GL_NV_fill_rectangle
-#define glatter_GL_NV_fragment_coverage_to_color glatter_get_extension_support_GL().has_GL_NV_fragment_coverage_to_color
-#define glatter_GL_NV_fragment_shader_barycentric glatter_get_extension_support_GL().has_GL_NV_fragment_shader_barycentric
-#define glatter_GL_NV_fragment_shader_interlock glatter_get_extension_support_GL().has_GL_NV_fragment_shader_interlock
-#define glatter_GL_NV_framebuffer_blit glatter_get_extension_support_GL().has_GL_NV_framebuffer_blit
-#define glatter_GL_NV_framebuffer_mixed_samples glatter_get_extension_support_GL().has_GL_NV_framebuffer_mixed_samples
-#define glatter_GL_NV_framebuffer_multisample glatter_get_extension_support_GL().has_GL_NV_framebuffer_multisample
-#define glatter_GL_NV_generate_mipmap_sRGB glatter_get_extension_support_GL().has_GL_NV_generate_mipmap_sRGB
-#define glatter_GL_NV_geometry_shader_passthrough glatter_get_extension_support_GL().has_GL_NV_geometry_shader_passthrough
-#define glatter_GL_NV_gpu_shader5 glatter_get_extension_support_GL().has_GL_NV_gpu_shader5
-#define glatter_GL_NV_image_formats glatter_get_extension_support_GL().has_GL_NV_image_formats
-#define glatter_GL_NV_instanced_arrays glatter_get_extension_support_GL().has_GL_NV_instanced_arrays
-#define glatter_GL_NV_internalformat_sample_query glatter_get_extension_support_GL().has_GL_NV_internalformat_sample_query
-#define glatter_GL_NV_memory_attachment glatter_get_extension_support_GL().has_GL_NV_memory_attachment
-#define glatter_GL_NV_memory_object_sparse glatter_get_extension_support_GL().has_GL_NV_memory_object_sparse
-#define glatter_GL_NV_mesh_shader glatter_get_extension_support_GL().has_GL_NV_mesh_shader
-#define glatter_GL_NV_non_square_matrices glatter_get_extension_support_GL().has_GL_NV_non_square_matrices
-#define glatter_GL_NV_pack_subimage glatter_get_extension_support_GL().has_GL_NV_pack_subimage
-#define glatter_GL_NV_path_rendering glatter_get_extension_support_GL().has_GL_NV_path_rendering
-#define glatter_GL_NV_path_rendering_shared_edge glatter_get_extension_support_GL().has_GL_NV_path_rendering_shared_edge
-#define glatter_GL_NV_pixel_buffer_object glatter_get_extension_support_GL().has_GL_NV_pixel_buffer_object
-#define glatter_GL_NV_polygon_mode glatter_get_extension_support_GL().has_GL_NV_polygon_mode
-#define glatter_GL_NV_primitive_shading_rate glatter_get_extension_support_GL().has_GL_NV_primitive_shading_rate
-#define glatter_GL_NV_read_buffer glatter_get_extension_support_GL().has_GL_NV_read_buffer
-#define glatter_GL_NV_read_buffer_front glatter_get_extension_support_GL().has_GL_NV_read_buffer_front
-#define glatter_GL_NV_read_depth glatter_get_extension_support_GL().has_GL_NV_read_depth
-#define glatter_GL_NV_read_depth_stencil glatter_get_extension_support_GL().has_GL_NV_read_depth_stencil
-#define glatter_GL_NV_read_stencil glatter_get_extension_support_GL().has_GL_NV_read_stencil
-#define glatter_GL_NV_representative_fragment_test glatter_get_extension_support_GL().has_GL_NV_representative_fragment_test
-#define glatter_GL_NV_sRGB_formats glatter_get_extension_support_GL().has_GL_NV_sRGB_formats
-#define glatter_GL_NV_sample_locations glatter_get_extension_support_GL().has_GL_NV_sample_locations
-#define glatter_GL_NV_sample_mask_override_coverage glatter_get_extension_support_GL().has_GL_NV_sample_mask_override_coverage
-#define glatter_GL_NV_scissor_exclusive glatter_get_extension_support_GL().has_GL_NV_scissor_exclusive
-#define glatter_GL_NV_shader_atomic_fp16_vector glatter_get_extension_support_GL().has_GL_NV_shader_atomic_fp16_vector
-#define glatter_GL_NV_shader_noperspective_interpolation glatter_get_extension_support_GL().has_GL_NV_shader_noperspective_interpolation
-#define glatter_GL_NV_shader_subgroup_partitioned glatter_get_extension_support_GL().has_GL_NV_shader_subgroup_partitioned
-#define glatter_GL_NV_shader_texture_footprint glatter_get_extension_support_GL().has_GL_NV_shader_texture_footprint
-#define glatter_GL_NV_shading_rate_image glatter_get_extension_support_GL().has_GL_NV_shading_rate_image
-#define glatter_GL_NV_shadow_samplers_array glatter_get_extension_support_GL().has_GL_NV_shadow_samplers_array
-#define glatter_GL_NV_shadow_samplers_cube glatter_get_extension_support_GL().has_GL_NV_shadow_samplers_cube
-#define glatter_GL_NV_stereo_view_rendering glatter_get_extension_support_GL().has_GL_NV_stereo_view_rendering
-#define glatter_GL_NV_texture_barrier glatter_get_extension_support_GL().has_GL_NV_texture_barrier
-#define glatter_GL_NV_texture_border_clamp glatter_get_extension_support_GL().has_GL_NV_texture_border_clamp
-#define glatter_GL_NV_texture_compression_s3tc_update glatter_get_extension_support_GL().has_GL_NV_texture_compression_s3tc_update
-#define glatter_GL_NV_texture_npot_2D_mipmap glatter_get_extension_support_GL().has_GL_NV_texture_npot_2D_mipmap
-#define glatter_GL_NV_timeline_semaphore glatter_get_extension_support_GL().has_GL_NV_timeline_semaphore
-#define glatter_GL_NV_viewport_array glatter_get_extension_support_GL().has_GL_NV_viewport_array
-#define glatter_GL_NV_viewport_array2 glatter_get_extension_support_GL().has_GL_NV_viewport_array2
-#define glatter_GL_NV_viewport_swizzle glatter_get_extension_support_GL().has_GL_NV_viewport_swizzle
-#define glatter_GL_OES_EGL_image glatter_get_extension_support_GL().has_GL_OES_EGL_image
-#define glatter_GL_OES_EGL_image_external glatter_get_extension_support_GL().has_GL_OES_EGL_image_external
-#define glatter_GL_OES_EGL_image_external_essl3 glatter_get_extension_support_GL().has_GL_OES_EGL_image_external_essl3
-#define glatter_GL_OES_blend_equation_separate glatter_get_extension_support_GL().has_GL_OES_blend_equation_separate
-#define glatter_GL_OES_blend_func_separate glatter_get_extension_support_GL().has_GL_OES_blend_func_separate
-#define glatter_GL_OES_blend_subtract glatter_get_extension_support_GL().has_GL_OES_blend_subtract
-#define glatter_GL_OES_byte_coordinates glatter_get_extension_support_GL().has_GL_OES_byte_coordinates
-#define glatter_GL_OES_compressed_ETC1_RGB8_sub_texture glatter_get_extension_support_GL().has_GL_OES_compressed_ETC1_RGB8_sub_texture
-#define glatter_GL_OES_compressed_ETC1_RGB8_texture glatter_get_extension_support_GL().has_GL_OES_compressed_ETC1_RGB8_texture
-#define glatter_GL_OES_compressed_paletted_texture glatter_get_extension_support_GL().has_GL_OES_compressed_paletted_texture
-#define glatter_GL_OES_copy_image glatter_get_extension_support_GL().has_GL_OES_copy_image
-#define glatter_GL_OES_depth24 glatter_get_extension_support_GL().has_GL_OES_depth24
-#define glatter_GL_OES_depth32 glatter_get_extension_support_GL().has_GL_OES_depth32
-#define glatter_GL_OES_depth_texture glatter_get_extension_support_GL().has_GL_OES_depth_texture
-#define glatter_GL_OES_draw_buffers_indexed glatter_get_extension_support_GL().has_GL_OES_draw_buffers_indexed
-#define glatter_GL_OES_draw_elements_base_vertex glatter_get_extension_support_GL().has_GL_OES_draw_elements_base_vertex
-#define glatter_GL_OES_draw_texture glatter_get_extension_support_GL().has_GL_OES_draw_texture
-#define glatter_GL_OES_element_index_uint glatter_get_extension_support_GL().has_GL_OES_element_index_uint
-#define glatter_GL_OES_extended_matrix_palette glatter_get_extension_support_GL().has_GL_OES_extended_matrix_palette
-#define glatter_GL_OES_fbo_render_mipmap glatter_get_extension_support_GL().has_GL_OES_fbo_render_mipmap
-#define glatter_GL_OES_fixed_point glatter_get_extension_support_GL().has_GL_OES_fixed_point
-#define glatter_GL_OES_fragment_precision_high glatter_get_extension_support_GL().has_GL_OES_fragment_precision_high
-#define glatter_GL_OES_framebuffer_object glatter_get_extension_support_GL().has_GL_OES_framebuffer_object
-#define glatter_GL_OES_geometry_point_size glatter_get_extension_support_GL().has_GL_OES_geometry_point_size
-#define glatter_GL_OES_geometry_shader glatter_get_extension_support_GL().has_GL_OES_geometry_shader
-#define glatter_GL_OES_get_program_binary glatter_get_extension_support_GL().has_GL_OES_get_program_binary
-#define glatter_GL_OES_gpu_shader5 glatter_get_extension_support_GL().has_GL_OES_gpu_shader5
-#define glatter_GL_OES_mapbuffer glatter_get_extension_support_GL().has_GL_OES_mapbuffer
-#define glatter_GL_OES_matrix_get glatter_get_extension_support_GL().has_GL_OES_matrix_get
-#define glatter_GL_OES_matrix_palette glatter_get_extension_support_GL().has_GL_OES_matrix_palette
-#define glatter_GL_OES_packed_depth_stencil glatter_get_extension_support_GL().has_GL_OES_packed_depth_stencil
-#define glatter_GL_OES_point_size_array glatter_get_extension_support_GL().has_GL_OES_point_size_array
-#define glatter_GL_OES_point_sprite glatter_get_extension_support_GL().has_GL_OES_point_sprite
-#define glatter_GL_OES_primitive_bounding_box glatter_get_extension_support_GL().has_GL_OES_primitive_bounding_box
-#define glatter_GL_OES_query_matrix glatter_get_extension_support_GL().has_GL_OES_query_matrix
-#define glatter_GL_OES_read_format glatter_get_extension_support_GL().has_GL_OES_read_format
-#define glatter_GL_OES_required_internalformat glatter_get_extension_support_GL().has_GL_OES_required_internalformat
-#define glatter_GL_OES_rgb8_rgba8 glatter_get_extension_support_GL().has_GL_OES_rgb8_rgba8
-#define glatter_GL_OES_sample_shading glatter_get_extension_support_GL().has_GL_OES_sample_shading
-#define glatter_GL_OES_sample_variables glatter_get_extension_support_GL().has_GL_OES_sample_variables
-#define glatter_GL_OES_shader_image_atomic glatter_get_extension_support_GL().has_GL_OES_shader_image_atomic
-#define glatter_GL_OES_shader_io_blocks glatter_get_extension_support_GL().has_GL_OES_shader_io_blocks
-#define glatter_GL_OES_shader_multisample_interpolation glatter_get_extension_support_GL().has_GL_OES_shader_multisample_interpolation
-#define glatter_GL_OES_single_precision glatter_get_extension_support_GL().has_GL_OES_single_precision
-#define glatter_GL_OES_standard_derivatives glatter_get_extension_support_GL().has_GL_OES_standard_derivatives
-#define glatter_GL_OES_stencil1 glatter_get_extension_support_GL().has_GL_OES_stencil1
-#define glatter_GL_OES_stencil4 glatter_get_extension_support_GL().has_GL_OES_stencil4
-#define glatter_GL_OES_stencil8 glatter_get_extension_support_GL().has_GL_OES_stencil8
-#define glatter_GL_OES_stencil_wrap glatter_get_extension_support_GL().has_GL_OES_stencil_wrap
-#define glatter_GL_OES_surfaceless_context glatter_get_extension_support_GL().has_GL_OES_surfaceless_context
-#define glatter_GL_OES_tessellation_point_size glatter_get_extension_support_GL().has_GL_OES_tessellation_point_size
-#define glatter_GL_OES_tessellation_shader glatter_get_extension_support_GL().has_GL_OES_tessellation_shader
-#define glatter_GL_OES_texture_3D glatter_get_extension_support_GL().has_GL_OES_texture_3D
-#define glatter_GL_OES_texture_border_clamp glatter_get_extension_support_GL().has_GL_OES_texture_border_clamp
-#define glatter_GL_OES_texture_buffer glatter_get_extension_support_GL().has_GL_OES_texture_buffer
-#define glatter_GL_OES_texture_compression_astc glatter_get_extension_support_GL().has_GL_OES_texture_compression_astc
-#define glatter_GL_OES_texture_cube_map glatter_get_extension_support_GL().has_GL_OES_texture_cube_map
-#define glatter_GL_OES_texture_cube_map_array glatter_get_extension_support_GL().has_GL_OES_texture_cube_map_array
-#define glatter_GL_OES_texture_env_crossbar glatter_get_extension_support_GL().has_GL_OES_texture_env_crossbar
-#define glatter_GL_OES_texture_float glatter_get_extension_support_GL().has_GL_OES_texture_float
-#define glatter_GL_OES_texture_float_linear glatter_get_extension_support_GL().has_GL_OES_texture_float_linear
-#define glatter_GL_OES_texture_half_float glatter_get_extension_support_GL().has_GL_OES_texture_half_float
-#define glatter_GL_OES_texture_half_float_linear glatter_get_extension_support_GL().has_GL_OES_texture_half_float_linear
-#define glatter_GL_OES_texture_mirrored_repeat glatter_get_extension_support_GL().has_GL_OES_texture_mirrored_repeat
-#define glatter_GL_OES_texture_npot glatter_get_extension_support_GL().has_GL_OES_texture_npot
-#define glatter_GL_OES_texture_stencil8 glatter_get_extension_support_GL().has_GL_OES_texture_stencil8
-#define glatter_GL_OES_texture_storage_multisample_2d_array glatter_get_extension_support_GL().has_GL_OES_texture_storage_multisample_2d_array
-#define glatter_GL_OES_texture_view glatter_get_extension_support_GL().has_GL_OES_texture_view
-#define glatter_GL_OES_vertex_array_object glatter_get_extension_support_GL().has_GL_OES_vertex_array_object
-#define glatter_GL_OES_vertex_half_float glatter_get_extension_support_GL().has_GL_OES_vertex_half_float
-#define glatter_GL_OES_vertex_type_10_10_10_2 glatter_get_extension_support_GL().has_GL_OES_vertex_type_10_10_10_2
-#define glatter_GL_OES_viewport_array glatter_get_extension_support_GL().has_GL_OES_viewport_array
-#define glatter_GL_OVR_multiview glatter_get_extension_support_GL().has_GL_OVR_multiview
-#define glatter_GL_OVR_multiview2 glatter_get_extension_support_GL().has_GL_OVR_multiview2
-#define glatter_GL_OVR_multiview_multisampled_render_to_texture glatter_get_extension_support_GL().has_GL_OVR_multiview_multisampled_render_to_texture
-#define glatter_GL_QCOM_YUV_texture_gather glatter_get_extension_support_GL().has_GL_QCOM_YUV_texture_gather
-#define glatter_GL_QCOM_alpha_test glatter_get_extension_support_GL().has_GL_QCOM_alpha_test
-#define glatter_GL_QCOM_binning_control glatter_get_extension_support_GL().has_GL_QCOM_binning_control
-#define glatter_GL_QCOM_driver_control glatter_get_extension_support_GL().has_GL_QCOM_driver_control
-#define glatter_GL_QCOM_extended_get glatter_get_extension_support_GL().has_GL_QCOM_extended_get
-#define glatter_GL_QCOM_extended_get2 glatter_get_extension_support_GL().has_GL_QCOM_extended_get2
-#define glatter_GL_QCOM_frame_extrapolation glatter_get_extension_support_GL().has_GL_QCOM_frame_extrapolation
-#define glatter_GL_QCOM_framebuffer_foveated glatter_get_extension_support_GL().has_GL_QCOM_framebuffer_foveated
-#define glatter_GL_QCOM_motion_estimation glatter_get_extension_support_GL().has_GL_QCOM_motion_estimation
-#define glatter_GL_QCOM_perfmon_global_mode glatter_get_extension_support_GL().has_GL_QCOM_perfmon_global_mode
-#define glatter_GL_QCOM_render_sRGB_R8_RG8 glatter_get_extension_support_GL().has_GL_QCOM_render_sRGB_R8_RG8
-#define glatter_GL_QCOM_render_shared_exponent glatter_get_extension_support_GL().has_GL_QCOM_render_shared_exponent
-#define glatter_GL_QCOM_shader_framebuffer_fetch_noncoherent glatter_get_extension_support_GL().has_GL_QCOM_shader_framebuffer_fetch_noncoherent
-#define glatter_GL_QCOM_shader_framebuffer_fetch_rate glatter_get_extension_support_GL().has_GL_QCOM_shader_framebuffer_fetch_rate
-#define glatter_GL_QCOM_shading_rate glatter_get_extension_support_GL().has_GL_QCOM_shading_rate
-#define glatter_GL_QCOM_texture_foveated glatter_get_extension_support_GL().has_GL_QCOM_texture_foveated
-#define glatter_GL_QCOM_texture_foveated2 glatter_get_extension_support_GL().has_GL_QCOM_texture_foveated2
-#define glatter_GL_QCOM_texture_foveated_subsampled_layout glatter_get_extension_support_GL().has_GL_QCOM_texture_foveated_subsampled_layout
-#define glatter_GL_QCOM_texture_lod_bias glatter_get_extension_support_GL().has_GL_QCOM_texture_lod_bias
-#define glatter_GL_QCOM_tiled_rendering glatter_get_extension_support_GL().has_GL_QCOM_tiled_rendering
-#define glatter_GL_QCOM_writeonly_rendering glatter_get_extension_support_GL().has_GL_QCOM_writeonly_rendering
-#define glatter_GL_QCOM_ycbcr_degamma glatter_get_extension_support_GL().has_GL_QCOM_ycbcr_degamma
-#define glatter_GL_VIV_shader_binary glatter_get_extension_support_GL().has_GL_VIV_shader_binary
+/* Slots of glatter_context_caps_t::limits, each read with glGetIntegerv. */
+enum {
+    GLATTER_LIMIT_MAX_TEXTURE_SIZE = 0,
+    GLATTER_LIMIT_MAX_CUBE_MAP_TEXTURE_SIZE = 1,
+    GLATTER_LIMIT_MAX_3D_TEXTURE_SIZE = 2,
+    GLATTER_LIMIT_MAX_ARRAY_TEXTURE_LAYERS = 3,
+    GLATTER_LIMIT_MAX_RENDERBUFFER_SIZE = 4,
+    GLATTER_LIMIT_MAX_SAMPLES = 5,
+    GLATTER_LIMIT_MAX_COLOR_ATTACHMENTS = 6,
+    GLATTER_LIMIT_MAX_DRAW_BUFFERS = 7,
+    GLATTER_LIMIT_MAX_ELEMENTS_VERTICES = 8,
+    GLATTER_LIMIT_MAX_ELEMENTS_INDICES = 9,
+    GLATTER_LIMIT_MAX_VERTEX_ATTRIBS = 10,
+    GLATTER_LIMIT_MAX_TEXTURE_IMAGE_UNITS = 11,
+    GLATTER_LIMIT_MAX_VERTEX_TEXTURE_IMAGE_UNITS = 12,
+    GLATTER_LIMIT_MAX_COMBINED_TEXTURE_IMAGE_UNITS = 13,
+    GLATTER_LIMIT_MAX_VERTEX_UNIFORM_VECTORS = 14,
+    GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_VECTORS = 15,
+    GLATTER_LIMIT_MAX_FRAGMENT_INPUT_COMPONENTS = 16,
+    GLATTER_LIMIT_MAX_UNIFORM_BLOCK_SIZE = 17,
+    GLATTER_LIMIT_MAX_UNIFORM_BUFFER_BINDINGS = 18,
+    GLATTER_LIMIT_MAX_VERTEX_UNIFORM_BLOCKS = 19,
+    GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_BLOCKS = 20,
+    GLATTER_LIMIT_MAX_COMBINED_UNIFORM_BLOCKS = 21,
+    GLATTER_LIMIT_UNIFORM_BUFFER_OFFSET_ALIGNMENT = 22,
+    GLATTER_LIMIT_MAX_SHADER_STORAGE_BUFFER_BINDINGS = 23,
+    GLATTER_LIMIT_MAX_SHADER_STORAGE_BLOCK_SIZE = 24,
+    GLATTER_LIMIT_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT = 25,
+    GLATTER_LIMIT_MAX_COMPUTE_WORK_GROUP_INVOCATIONS = 26,
+    GLATTER_LIMIT_MAX_COMPUTE_SHARED_MEMORY_SIZE = 27,
+    GLATTER_LIMIT_COUNT = 28
+};
+
+/* What glatter_get_context_caps() reports of a context. Whatever the version
+ * of the context does not have stays 0. */
+typedef struct glatter_context_caps
+{
+    int   major, minor;                 /* GL_VERSION, e.g. 4 and 6 */
+    int   es;                           /* nonzero for OpenGL ES */
+    int   glsl_version;                 /* GL_SHADING_LANGUAGE_VERSION as in #version, e.g. 460 */
+    GLint profile_mask;                 /* GL_CONTEXT_PROFILE_MASK, from GL 3.2 */
+    GLint flags;                        /* GL_CONTEXT_FLAGS, from GL 3.0 and GLES 3.2 */
+    GLint limits[GLATTER_LIMIT_COUNT];  /* by GLATTER_LIMIT_* */
+} glatter_context_caps_t;
 
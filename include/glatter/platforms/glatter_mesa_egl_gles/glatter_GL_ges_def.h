@@ -27,1059 +27,683 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#include <string.h> /* memcpy */
+/* ---- Extension name lookup (generated) ----
+ * Perfect hash over the GLATTER_EXT_* names of this family; see
+ * glatter_extension_index_ in glatter_def.h. */
+static const uint16_t glatter_ext_seeds_GL[256] = {
+    0, 2, 2, 1, 0, 1, 1, 0, 2, 0, 1, 1, 1, 4, 2, 1,
+    1, 2, 0, 0, 1, 1, 7, 1, 2, 1, 1, 1, 2, 0, 1, 0,
+    1, 3, 1, 0, 2, 0, 4, 1, 2, 0, 6, 1, 2, 3, 3, 0,
+    1, 1, 0, 2, 1, 2, 0, 5, 1, 0, 0, 0, 2, 4, 3, 1,
+    0, 0, 1, 5, 1, 2, 0, 1, 1, 2, 1, 3, 1, 8, 2, 2,
+    6, 1, 1, 2, 3, 3, 1, 0, 2, 1, 5, 1, 4, 1, 1, 1,
+    1, 0, 3, 0, 2, 1, 3, 0, 0, 0, 1, 0, 2, 5, 0, 1,
+    3, 4, 2, 1, 1, 4, 0, 2, 0, 4, 2, 1, 1, 0, 1, 1,
+    5, 1, 3, 1, 0, 1, 1, 3, 7, 0, 2, 4, 1, 1, 3, 1,
+    2, 1, 4, 5, 0, 1, 1, 4, 2, 1, 5, 3, 2, 1, 1, 1,
+    13, 2, 7, 1, 1, 2, 2, 4, 0, 7, 2, 0, 1, 2, 3, 0,
+    4, 3, 0, 1, 2, 0, 2, 6, 1, 0, 11, 2, 1, 0, 1, 1,
+    2, 0, 2, 1, 0, 0, 0, 5, 2, 3, 7, 0, 1, 0, 1, 3,
+    0, 0, 3, 2, 1, 0, 0, 1, 2, 0, 0, 2, 1, 1, 1, 1,
+    1, 0, 1, 3, 6, 0, 3, 1, 3, 3, 11, 0, 1, 0, 8, 0,
+    2, 3, 4, 1, 1, 1, 0, 0, 0, 4, 1, 9, 0, 1, 12, 1,
+};
+
+static const uint16_t glatter_ext_slots_GL[512] = {
+    292, 116, 65535, 217, 152, 163, 228, 326, 115, 65535, 201, 194, 65535, 39, 191, 65535,
+    346, 65535, 85, 266, 65535, 282, 65535, 65535, 160, 65535, 22, 328, 90, 294, 321, 65535,
+    43, 286, 279, 65535, 297, 81, 162, 70, 190, 65535, 65535, 65535, 307, 72, 235, 65535,
+    206, 65535, 312, 209, 246, 65535, 153, 319, 314, 171, 20, 149, 65535, 144, 65535, 65535,
+    341, 65535, 65535, 186, 65535, 158, 69, 230, 42, 65535, 11, 258, 252, 65535, 97, 65535,
+    65535, 95, 65535, 65535, 108, 65535, 83, 65535, 65535, 269, 218, 271, 65535, 151, 71, 229,
+    86, 94, 65535, 61, 172, 65535, 38, 333, 65535, 276, 324, 65535, 178, 296, 13, 106,
+    65535, 343, 304, 131, 288, 65535, 65535, 335, 33, 65535, 280, 65535, 138, 337, 104, 34,
+    277, 65535, 114, 300, 2, 253, 59, 65535, 154, 175, 273, 65535, 65535, 126, 91, 148,
+    167, 88, 65535, 65535, 65535, 240, 303, 65535, 244, 295, 248, 322, 133, 65535, 74, 65535,
+    65535, 65535, 65535, 65535, 65535, 344, 65535, 24, 132, 80, 236, 306, 198, 245, 12, 65535,
+    96, 121, 226, 237, 211, 15, 65535, 291, 76, 93, 101, 65535, 257, 320, 7, 10,
+    129, 65535, 283, 1, 66, 65535, 250, 52, 47, 65535, 65535, 166, 65535, 173, 208, 56,
+    118, 241, 37, 329, 181, 267, 89, 109, 65535, 155, 227, 260, 78, 313, 256, 197,
+    289, 137, 165, 65535, 318, 45, 65535, 64, 124, 332, 65535, 263, 125, 150, 134, 159,
+    200, 51, 65535, 65535, 31, 330, 338, 40, 310, 128, 65535, 49, 177, 65535, 65535, 54,
+    65535, 87, 100, 164, 315, 111, 57, 75, 65535, 8, 23, 205, 212, 65535, 249, 339,
+    77, 139, 65535, 65535, 308, 261, 65535, 188, 36, 254, 65535, 274, 231, 262, 79, 65535,
+    3, 65535, 142, 112, 92, 251, 102, 21, 299, 65535, 199, 247, 65535, 4, 143, 28,
+    65535, 105, 65535, 65535, 65535, 65535, 242, 65535, 146, 65535, 98, 65535, 65535, 65535, 16, 65535,
+    117, 65535, 293, 65535, 65535, 285, 60, 120, 127, 311, 334, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 168, 161, 264, 130, 176, 103, 281, 44, 287, 195, 65535, 99, 65535, 25,
+    65535, 113, 136, 29, 65535, 202, 147, 65535, 65535, 220, 207, 32, 210, 185, 65535, 309,
+    204, 65535, 305, 224, 18, 140, 193, 65535, 123, 119, 65535, 65535, 222, 122, 145, 316,
+    67, 216, 184, 225, 65535, 290, 65535, 107, 239, 65535, 270, 48, 65535, 65535, 265, 182,
+    156, 275, 50, 65535, 65535, 14, 46, 65535, 9, 196, 65535, 214, 65535, 65535, 259, 110,
+    327, 65535, 65535, 65535, 65535, 65535, 347, 233, 65535, 213, 65, 0, 325, 55, 302, 65535,
+    135, 53, 298, 174, 73, 342, 63, 65535, 170, 317, 215, 65535, 65535, 65535, 5, 82,
+    65535, 336, 189, 65535, 169, 284, 323, 255, 65535, 6, 65535, 345, 243, 65535, 65535, 268,
+    84, 340, 219, 179, 65535, 19, 65535, 278, 58, 183, 180, 65535, 221, 65535, 65535, 62,
+    65535, 65535, 65535, 65535, 232, 187, 35, 26, 301, 238, 192, 331, 141, 68, 157, 203,
+    65535, 65535, 41, 65535, 65535, 30, 223, 65535, 272, 65535, 65535, 17, 65535, 234, 27, 65535,
+};
+
+static const uint16_t glatter_ext_name_offsets_GL[GLATTER_EXT_COUNT_GL] = {
+    0, 30, 60, 100, 127, 154, 186, 209, 235, 268, 294, 326,
+    350, 384, 418, 441, 475, 498, 533, 562, 595, 612, 626, 659,
+    692, 719, 749, 776, 802, 815, 845, 877, 923, 963, 985, 1006,
+    1029, 1054, 1091, 1109, 1130, 1157, 1177, 1199, 1220, 1240, 1266, 1292,
+    1323, 1349, 1367, 1386, 1406, 1425, 1452, 1480, 1500, 1528, 1561, 1583,
+    1614, 1637, 1656, 1685, 1716, 1743, 1766, 1785, 1809, 1833, 1854, 1878,
+    1905, 1924, 1949, 1976, 2010, 2048, 2087, 2117, 2163, 2200, 2229, 2260,
+    2288, 2315, 2345, 2371, 2389, 2415, 2439, 2459, 2477, 2489, 2515, 2532,
+    2552, 2575, 2605, 2636, 2668, 2713, 2738, 2773, 2799, 2823, 2870, 2904,
+    2939, 2971, 2997, 3027, 3050, 3072, 3095, 3126, 3153, 3181, 3203, 3247,
+    3279, 3311, 3343, 3375, 3412, 3442, 3476, 3505, 3536, 3572, 3596, 3632,
+    3654, 3679, 3697, 3720, 3744, 3771, 3797, 3820, 3855, 3890, 3910, 3933,
+    3958, 3983, 4009, 4033, 4063, 4101, 4123, 4142, 4163, 4196, 4230, 4273,
+    4301, 4324, 4350, 4386, 4412, 4439, 4470, 4510, 4539, 4552, 4568, 4599,
+    4636, 4654, 4677, 4713, 4749, 4791, 4804, 4831, 4858, 4886, 4917, 4941,
+    4974, 5006, 5056, 5079, 5109, 5148, 5174, 5201, 5234, 5259, 5285, 5320,
+    5365, 5383, 5405, 5427, 5446, 5467, 5491, 5522, 5550, 5562, 5583, 5616,
+    5650, 5682, 5705, 5737, 5767, 5794, 5828, 5846, 5866, 5889, 5923, 5947,
+    5974, 5992, 6018, 6038, 6059, 6092, 6118, 6137, 6166, 6184, 6208, 6225,
+    6250, 6269, 6304, 6323, 6346, 6382, 6406, 6438, 6479, 6513, 6544, 6569,
+    6597, 6624, 6652, 6674, 6701, 6739, 6768, 6793, 6814, 6836, 6859, 6876,
+    6902, 6934, 6965, 6992, 7014, 7038, 7078, 7114, 7149, 7167, 7182, 7197,
+    7218, 7246, 7279, 7299, 7325, 7356, 7381, 7400, 7431, 7457, 7484, 7507,
+    7533, 7552, 7569, 7587, 7609, 7637, 7661, 7681, 7711, 7731, 7750, 7781,
+    7799, 7821, 7845, 7872, 7896, 7936, 7960, 7988, 8004, 8020, 8036, 8056,
+    8083, 8114, 8141, 8159, 8187, 8209, 8241, 8265, 8295, 8323, 8344, 8372,
+    8398, 8431, 8462, 8482, 8506, 8550, 8570, 8597, 8622, 8652, 8674, 8691,
+    8709, 8757, 8784, 8803, 8827, 8850, 8871, 8893, 8921, 8950, 8976, 9004,
+    9031, 9062, 9107, 9145, 9166, 9191, 9217, 9260, 9285, 9309, 9337, 9359,
+};
+
+static const char glatter_ext_names_GL[] =
+    "GL_AMD_compressed_3DC_texture\0"
+    "GL_AMD_compressed_ATC_texture\0"
+    "GL_AMD_framebuffer_multisample_advanced\0"
+    "GL_AMD_performance_monitor\0"
+    "GL_AMD_program_binary_Z400\0"
+    "GL_ANDROID_extension_pack_es31a\0"
+    "GL_ANGLE_depth_texture\0"
+    "GL_ANGLE_framebuffer_blit\0"
+    "GL_ANGLE_framebuffer_multisample\0"
+    "GL_ANGLE_instanced_arrays\0"
+    "GL_ANGLE_pack_reverse_row_order\0"
+    "GL_ANGLE_program_binary\0"
+    "GL_ANGLE_texture_compression_dxt3\0"
+    "GL_ANGLE_texture_compression_dxt5\0"
+    "GL_ANGLE_texture_usage\0"
+    "GL_ANGLE_translated_shader_source\0"
+    "GL_APPLE_clip_distance\0"
+    "GL_APPLE_color_buffer_packed_float\0"
+    "GL_APPLE_copy_texture_levels\0"
+    "GL_APPLE_framebuffer_multisample\0"
+    "GL_APPLE_rgb_422\0"
+    "GL_APPLE_sync\0"
+    "GL_APPLE_texture_2D_limited_npot\0"
+    "GL_APPLE_texture_format_BGRA8888\0"
+    "GL_APPLE_texture_max_level\0"
+    "GL_APPLE_texture_packed_float\0"
+    "GL_ARM_mali_program_binary\0"
+    "GL_ARM_mali_shader_binary\0"
+    "GL_ARM_rgba8\0"
+    "GL_ARM_shader_core_properties\0"
+    "GL_ARM_shader_framebuffer_fetch\0"
+    "GL_ARM_shader_framebuffer_fetch_depth_stencil\0"
+    "GL_ARM_texture_unnormalized_coordinates\0"
+    "GL_DMP_program_binary\0"
+    "GL_DMP_shader_binary\0"
+    "GL_EXT_EGL_image_array\0"
+    "GL_EXT_EGL_image_storage\0"
+    "GL_EXT_EGL_image_storage_compression\0"
+    "GL_EXT_YUV_target\0"
+    "GL_EXT_base_instance\0"
+    "GL_EXT_blend_func_extended\0"
+    "GL_EXT_blend_minmax\0"
+    "GL_EXT_buffer_storage\0"
+    "GL_EXT_clear_texture\0"
+    "GL_EXT_clip_control\0"
+    "GL_EXT_clip_cull_distance\0"
+    "GL_EXT_color_buffer_float\0"
+    "GL_EXT_color_buffer_half_float\0"
+    "GL_EXT_conservative_depth\0"
+    "GL_EXT_copy_image\0"
+    "GL_EXT_debug_label\0"
+    "GL_EXT_debug_marker\0"
+    "GL_EXT_depth_clamp\0"
+    "GL_EXT_discard_framebuffer\0"
+    "GL_EXT_disjoint_timer_query\0"
+    "GL_EXT_draw_buffers\0"
+    "GL_EXT_draw_buffers_indexed\0"
+    "GL_EXT_draw_elements_base_vertex\0"
+    "GL_EXT_draw_instanced\0"
+    "GL_EXT_draw_transform_feedback\0"
+    "GL_EXT_external_buffer\0"
+    "GL_EXT_float_blend\0"
+    "GL_EXT_fragment_shading_rate\0"
+    "GL_EXT_framebuffer_blit_layers\0"
+    "GL_EXT_geometry_point_size\0"
+    "GL_EXT_geometry_shader\0"
+    "GL_EXT_gpu_shader5\0"
+    "GL_EXT_instanced_arrays\0"
+    "GL_EXT_map_buffer_range\0"
+    "GL_EXT_memory_object\0"
+    "GL_EXT_memory_object_fd\0"
+    "GL_EXT_memory_object_win32\0"
+    "GL_EXT_mesh_shader\0"
+    "GL_EXT_multi_draw_arrays\0"
+    "GL_EXT_multi_draw_indirect\0"
+    "GL_EXT_multisampled_compatibility\0"
+    "GL_EXT_multisampled_render_to_texture\0"
+    "GL_EXT_multisampled_render_to_texture2\0"
+    "GL_EXT_multiview_draw_buffers\0"
+    "GL_EXT_multiview_tessellation_geometry_shader\0"
+    "GL_EXT_multiview_texture_multisample\0"
+    "GL_EXT_multiview_timer_query\0"
+    "GL_EXT_occlusion_query_boolean\0"
+    "GL_EXT_polygon_offset_clamp\0"
+    "GL_EXT_post_depth_coverage\0"
+    "GL_EXT_primitive_bounding_box\0"
+    "GL_EXT_protected_textures\0"
+    "GL_EXT_pvrtc_sRGB\0"
+    "GL_EXT_raster_multisample\0"
+    "GL_EXT_read_format_bgra\0"
+    "GL_EXT_render_snorm\0"
+    "GL_EXT_robustness\0"
+    "GL_EXT_sRGB\0"
+    "GL_EXT_sRGB_write_control\0"
+    "GL_EXT_semaphore\0"
+    "GL_EXT_semaphore_fd\0"
+    "GL_EXT_semaphore_win32\0"
+    "GL_EXT_separate_depth_stencil\0"
+    "GL_EXT_separate_shader_objects\0"
+    "GL_EXT_shader_framebuffer_fetch\0"
+    "GL_EXT_shader_framebuffer_fetch_non_coherent\0"
+    "GL_EXT_shader_group_vote\0"
+    "GL_EXT_shader_implicit_conversions\0"
+    "GL_EXT_shader_integer_mix\0"
+    "GL_EXT_shader_io_blocks\0"
+    "GL_EXT_shader_non_constant_global_initializers\0"
+    "GL_EXT_shader_pixel_local_storage\0"
+    "GL_EXT_shader_pixel_local_storage2\0"
+    "GL_EXT_shader_samples_identical\0"
+    "GL_EXT_shader_texture_lod\0"
+    "GL_EXT_shader_texture_samples\0"
+    "GL_EXT_shadow_samplers\0"
+    "GL_EXT_sparse_texture\0"
+    "GL_EXT_sparse_texture2\0"
+    "GL_EXT_tessellation_point_size\0"
+    "GL_EXT_tessellation_shader\0"
+    "GL_EXT_texture_border_clamp\0"
+    "GL_EXT_texture_buffer\0"
+    "GL_EXT_texture_compression_astc_decode_mode\0"
+    "GL_EXT_texture_compression_bptc\0"
+    "GL_EXT_texture_compression_dxt1\0"
+    "GL_EXT_texture_compression_rgtc\0"
+    "GL_EXT_texture_compression_s3tc\0"
+    "GL_EXT_texture_compression_s3tc_srgb\0"
+    "GL_EXT_texture_cube_map_array\0"
+    "GL_EXT_texture_filter_anisotropic\0"
+    "GL_EXT_texture_filter_minmax\0"
+    "GL_EXT_texture_format_BGRA8888\0"
+    "GL_EXT_texture_format_sRGB_override\0"
+    "GL_EXT_texture_lod_bias\0"
+    "GL_EXT_texture_mirror_clamp_to_edge\0"
+    "GL_EXT_texture_norm16\0"
+    "GL_EXT_texture_query_lod\0"
+    "GL_EXT_texture_rg\0"
+    "GL_EXT_texture_sRGB_R8\0"
+    "GL_EXT_texture_sRGB_RG8\0"
+    "GL_EXT_texture_sRGB_decode\0"
+    "GL_EXT_texture_shadow_lod\0"
+    "GL_EXT_texture_storage\0"
+    "GL_EXT_texture_storage_compression\0"
+    "GL_EXT_texture_type_2_10_10_10_REV\0"
+    "GL_EXT_texture_view\0"
+    "GL_EXT_unpack_subimage\0"
+    "GL_EXT_win32_keyed_mutex\0"
+    "GL_EXT_window_rectangles\0"
+    "GL_FJ_shader_binary_GCCSO\0"
+    "GL_IMG_bindless_texture\0"
+    "GL_IMG_framebuffer_downsample\0"
+    "GL_IMG_multisampled_render_to_texture\0"
+    "GL_IMG_program_binary\0"
+    "GL_IMG_read_format\0"
+    "GL_IMG_shader_binary\0"
+    "GL_IMG_texture_compression_pvrtc\0"
+    "GL_IMG_texture_compression_pvrtc2\0"
+    "GL_IMG_texture_env_enhanced_fixed_function\0"
+    "GL_IMG_texture_filter_cubic\0"
+    "GL_IMG_user_clip_plane\0"
+    "GL_INTEL_blackhole_render\0"
+    "GL_INTEL_conservative_rasterization\0"
+    "GL_INTEL_framebuffer_CMAA\0"
+    "GL_INTEL_performance_query\0"
+    "GL_KHR_blend_equation_advanced\0"
+    "GL_KHR_blend_equation_advanced_coherent\0"
+    "GL_KHR_context_flush_control\0"
+    "GL_KHR_debug\0"
+    "GL_KHR_no_error\0"
+    "GL_KHR_parallel_shader_compile\0"
+    "GL_KHR_robust_buffer_access_behavior\0"
+    "GL_KHR_robustness\0"
+    "GL_KHR_shader_subgroup\0"
+    "GL_KHR_texture_compression_astc_hdr\0"
+    "GL_KHR_texture_compression_astc_ldr\0"
+    "GL_KHR_texture_compression_astc_sliced_3d\0"
+    "GL_MESA_bgra\0"
+    "GL_MESA_framebuffer_flip_x\0"
+    "GL_MESA_framebuffer_flip_y\0"
+    "GL_MESA_framebuffer_swap_xy\0"
+    "GL_MESA_program_binary_formats\0"
+    "GL_MESA_sampler_objects\0"
+    "GL_MESA_shader_integer_functions\0"
+    "GL_MESA_texture_const_bandwidth\0"
+    "GL_NVX_blend_equation_advanced_multi_draw_buffers\0"
+    "GL_NV_bindless_texture\0"
+    "GL_NV_blend_equation_advanced\0"
+    "GL_NV_blend_equation_advanced_coherent\0"
+    "GL_NV_blend_minmax_factor\0"
+    "GL_NV_clip_space_w_scaling\0"
+    "GL_NV_compute_shader_derivatives\0"
+    "GL_NV_conditional_render\0"
+    "GL_NV_conservative_raster\0"
+    "GL_NV_conservative_raster_pre_snap\0"
+    "GL_NV_conservative_raster_pre_snap_triangles\0"
+    "GL_NV_copy_buffer\0"
+    "GL_NV_coverage_sample\0"
+    "GL_NV_depth_nonlinear\0"
+    "GL_NV_draw_buffers\0"
+    "GL_NV_draw_instanced\0"
+    "GL_NV_draw_vulkan_image\0"
+    "GL_NV_explicit_attrib_location\0"
+    "GL_NV_fbo_color_attachments\0"
+    "GL_NV_fence\0"
+    "GL_NV_fill_rectangle\0"
+    "GL_NV_fragment_coverage_to_color\0"
+    "GL_NV_fragment_shader_barycentric\0"
+    "GL_NV_fragment_shader_interlock\0"
+    "GL_NV_framebuffer_blit\0"
+    "GL_NV_framebuffer_mixed_samples\0"
+    "GL_NV_framebuffer_multisample\0"
+    "GL_NV_generate_mipmap_sRGB\0"
+    "GL_NV_geometry_shader_passthrough\0"
+    "GL_NV_gpu_shader5\0"
+    "GL_NV_image_formats\0"
+    "GL_NV_instanced_arrays\0"
+    "GL_NV_internalformat_sample_query\0"
+    "GL_NV_memory_attachment\0"
+    "GL_NV_memory_object_sparse\0"
+    "GL_NV_mesh_shader\0"
+    "GL_NV_non_square_matrices\0"
+    "GL_NV_pack_subimage\0"
+    "GL_NV_path_rendering\0"
+    "GL_NV_path_rendering_shared_edge\0"
+    "GL_NV_pixel_buffer_object\0"
+    "GL_NV_polygon_mode\0"
+    "GL_NV_primitive_shading_rate\0"
+    "GL_NV_read_buffer\0"
+    "GL_NV_read_buffer_front\0"
+    "GL_NV_read_depth\0"
+    "GL_NV_read_depth_stencil\0"
+    "GL_NV_read_stencil\0"
+    "GL_NV_representative_fragment_test\0"
+    "GL_NV_sRGB_formats\0"
+    "GL_NV_sample_locations\0"
+    "GL_NV_sample_mask_override_coverage\0"
+    "GL_NV_scissor_exclusive\0"
+    "GL_NV_shader_atomic_fp16_vector\0"
+    "GL_NV_shader_noperspective_interpolation\0"
+    "GL_NV_shader_subgroup_partitioned\0"
+    "GL_NV_shader_texture_footprint\0"
+    "GL_NV_shading_rate_image\0"
+    "GL_NV_shadow_samplers_array\0"
+    "GL_NV_shadow_samplers_cube\0"
+    "GL_NV_stereo_view_rendering\0"
+    "GL_NV_texture_barrier\0"
+    "GL_NV_texture_border_clamp\0"
+    "GL_NV_texture_compression_s3tc_update\0"
+    "GL_NV_texture_npot_2D_mipmap\0"
+    "GL_NV_timeline_semaphore\0"
+    "GL_NV_viewport_array\0"
+    "GL_NV_viewport_array2\0"
+    "GL_NV_viewport_swizzle\0"
+    "GL_OES_EGL_image\0"
+    "GL_OES_EGL_image_external\0"
+    "GL_OES_EGL_image_external_essl3\0"
+    "GL_OES_blend_equation_separate\0"
+    "GL_OES_blend_func_separate\0"
+    "GL_OES_blend_subtract\0"
+    "GL_OES_byte_coordinates\0"
+    "GL_OES_compressed_ETC1_RGB8_sub_texture\0"
+    "GL_OES_compressed_ETC1_RGB8_texture\0"
+    "GL_OES_compressed_paletted_texture\0"
+    "GL_OES_copy_image\0"
+    "GL_OES_depth24\0"
+    "GL_OES_depth32\0"
+    "GL_OES_depth_texture\0"
+    "GL_OES_draw_buffers_indexed\0"
+    "GL_OES_draw_elements_base_vertex\0"
+    "GL_OES_draw_texture\0"
+    "GL_OES_element_index_uint\0"
+    "GL_OES_extended_matrix_palette\0"
+    "GL_OES_fbo_render_mipmap\0"
+    "GL_OES_fixed_point\0"
+    "GL_OES_fragment_precision_high\0"
+    "GL_OES_framebuffer_object\0"
+    "GL_OES_geometry_point_size\0"
+    "GL_OES_geometry_shader\0"
+    "GL_OES_get_program_binary\0"
+    "GL_OES_gpu_shader5\0"
+    "GL_OES_mapbuffer\0"
+    "GL_OES_matrix_get\0"
+    "GL_OES_matrix_palette\0"
+    "GL_OES_packed_depth_stencil\0"
+    "GL_OES_point_size_array\0"
+    "GL_OES_point_sprite\0"
+    "GL_OES_primitive_bounding_box\0"
+    "GL_OES_query_matrix\0"
+    "GL_OES_read_format\0"
+    "GL_OES_required_internalformat\0"
+    "GL_OES_rgb8_rgba8\0"
+    "GL_OES_sample_shading\0"
+    "GL_OES_sample_variables\0"
+    "GL_OES_shader_image_atomic\0"
+    "GL_OES_shader_io_blocks\0"
+    "GL_OES_shader_multisample_interpolation\0"
+    "GL_OES_single_precision\0"
+    "GL_OES_standard_derivatives\0"
+    "GL_OES_stencil1\0"
+    "GL_OES_stencil4\0"
+    "GL_OES_stencil8\0"
+    "GL_OES_stencil_wrap\0"
+    "GL_OES_surfaceless_context\0"
+    "GL_OES_tessellation_point_size\0"
+    "GL_OES_tessellation_shader\0"
+    "GL_OES_texture_3D\0"
+    "GL_OES_texture_border_clamp\0"
+    "GL_OES_texture_buffer\0"
+    "GL_OES_texture_compression_astc\0"
+    "GL_OES_texture_cube_map\0"
+    "GL_OES_texture_cube_map_array\0"
+    "GL_OES_texture_env_crossbar\0"
+    "GL_OES_texture_float\0"
+    "GL_OES_texture_float_linear\0"
+    "GL_OES_texture_half_float\0"
+    "GL_OES_texture_half_float_linear\0"
+    "GL_OES_texture_mirrored_repeat\0"
+    "GL_OES_texture_npot\0"
+    "GL_OES_texture_stencil8\0"
+    "GL_OES_texture_storage_multisample_2d_array\0"
+    "GL_OES_texture_view\0"
+    "GL_OES_vertex_array_object\0"
+    "GL_OES_vertex_half_float\0"
+    "GL_OES_vertex_type_10_10_10_2\0"
+    "GL_OES_viewport_array\0"
+    "GL_OVR_multiview\0"
+    "GL_OVR_multiview2\0"
+    "GL_OVR_multiview_multisampled_render_to_texture\0"
+    "GL_QCOM_YUV_texture_gather\0"
+    "GL_QCOM_alpha_test\0"
+    "GL_QCOM_binning_control\0"
+    "GL_QCOM_driver_control\0"
+    "GL_QCOM_extended_get\0"
+    "GL_QCOM_extended_get2\0"
+    "GL_QCOM_frame_extrapolation\0"
+    "GL_QCOM_framebuffer_foveated\0"
+    "GL_QCOM_motion_estimation\0"
+    "GL_QCOM_perfmon_global_mode\0"
+    "GL_QCOM_render_sRGB_R8_RG8\0"
+    "GL_QCOM_render_shared_exponent\0"
+    "GL_QCOM_shader_framebuffer_fetch_noncoherent\0"
+    "GL_QCOM_shader_framebuffer_fetch_rate\0"
+    "GL_QCOM_shading_rate\0"
+    "GL_QCOM_texture_foveated\0"
+    "GL_QCOM_texture_foveated2\0"
+    "GL_QCOM_texture_foveated_subsampled_layout\0"
+    "GL_QCOM_texture_lod_bias\0"
+    "GL_QCOM_tiled_rendering\0"
+    "GL_QCOM_writeonly_rendering\0"
+    "GL_QCOM_ycbcr_degamma\0"
+    "GL_VIV_shader_binary\0";
+
+static const glatter_extension_table_t glatter_ext_table_GL = {
+    256, 512,
+    glatter_ext_seeds_GL, glatter_ext_slots_GL,
+    glatter_ext_name_offsets_GL, glatter_ext_names_GL
+};
+
+
+/* ---- Context capabilities (generated) ---- */
+
+/* A GL context's cached set. glatter_get_extension_support_GL returns the
+ * address of the first member, glatter_get_context_caps finds the second. */
+typedef struct glatter_context_info_GL
+{
+    glatter_extension_support_status_GL_t extensions;
+    glatter_context_caps_t                caps;
+} glatter_context_info_GL_t;
+
+/* All zero: the set of "no current context". Never written. */
+static glatter_context_info_GL_t glatter_context_info_none_GL;
 
-/* ---- Per-context, per-thread extension support cache (generated) ---- */
-#ifndef GLATTER_ES_CACHE_SLOTS
-#define GLATTER_ES_CACHE_SLOTS 8
+typedef struct glatter_context_limit
+{
+    uint16_t slot;      /* GLATTER_LIMIT_* */
+    uint8_t  gl, es;    /* first version with the query, major * 10 + minor; 0 for none */
+    GLenum   name;
+} glatter_context_limit_t;
+
+/* The limits of context_limits in glatter.py that these headers define. */
+static const glatter_context_limit_t glatter_context_limits_GL[] = {
+#ifdef GL_MAX_TEXTURE_SIZE
+    { GLATTER_LIMIT_MAX_TEXTURE_SIZE, 10, 10, GL_MAX_TEXTURE_SIZE },
+#endif
+#ifdef GL_MAX_CUBE_MAP_TEXTURE_SIZE
+    { GLATTER_LIMIT_MAX_CUBE_MAP_TEXTURE_SIZE, 13, 20, GL_MAX_CUBE_MAP_TEXTURE_SIZE },
+#endif
+#ifdef GL_MAX_3D_TEXTURE_SIZE
+    { GLATTER_LIMIT_MAX_3D_TEXTURE_SIZE, 12, 30, GL_MAX_3D_TEXTURE_SIZE },
+#endif
+#ifdef GL_MAX_ARRAY_TEXTURE_LAYERS
+    { GLATTER_LIMIT_MAX_ARRAY_TEXTURE_LAYERS, 30, 30, GL_MAX_ARRAY_TEXTURE_LAYERS },
+#endif
+#ifdef GL_MAX_RENDERBUFFER_SIZE
+    { GLATTER_LIMIT_MAX_RENDERBUFFER_SIZE, 30, 20, GL_MAX_RENDERBUFFER_SIZE },
+#endif
+#ifdef GL_MAX_SAMPLES
+    { GLATTER_LIMIT_MAX_SAMPLES, 30, 30, GL_MAX_SAMPLES },
+#endif
+#ifdef GL_MAX_COLOR_ATTACHMENTS
+    { GLATTER_LIMIT_MAX_COLOR_ATTACHMENTS, 30, 30, GL_MAX_COLOR_ATTACHMENTS },
+#endif
+#ifdef GL_MAX_DRAW_BUFFERS
+    { GLATTER_LIMIT_MAX_DRAW_BUFFERS, 20, 30, GL_MAX_DRAW_BUFFERS },
+#endif
+#ifdef GL_MAX_ELEMENTS_VERTICES
+    { GLATTER_LIMIT_MAX_ELEMENTS_VERTICES, 12, 30, GL_MAX_ELEMENTS_VERTICES },
+#endif
+#ifdef GL_MAX_ELEMENTS_INDICES
+    { GLATTER_LIMIT_MAX_ELEMENTS_INDICES, 12, 30, GL_MAX_ELEMENTS_INDICES },
+#endif
+#ifdef GL_MAX_VERTEX_ATTRIBS
+    { GLATTER_LIMIT_MAX_VERTEX_ATTRIBS, 20, 20, GL_MAX_VERTEX_ATTRIBS },
+#endif
+#ifdef GL_MAX_TEXTURE_IMAGE_UNITS
+    { GLATTER_LIMIT_MAX_TEXTURE_IMAGE_UNITS, 20, 20, GL_MAX_TEXTURE_IMAGE_UNITS },
+#endif
+#ifdef GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS
+    { GLATTER_LIMIT_MAX_VERTEX_TEXTURE_IMAGE_UNITS, 20, 20, GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS },
+#endif
+#ifdef GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS
+    { GLATTER_LIMIT_MAX_COMBINED_TEXTURE_IMAGE_UNITS, 20, 20, GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS },
+#endif
+#ifdef GL_MAX_VERTEX_UNIFORM_VECTORS
+    { GLATTER_LIMIT_MAX_VERTEX_UNIFORM_VECTORS, 41, 20, GL_MAX_VERTEX_UNIFORM_VECTORS },
+#endif
+#ifdef GL_MAX_FRAGMENT_UNIFORM_VECTORS
+    { GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_VECTORS, 41, 20, GL_MAX_FRAGMENT_UNIFORM_VECTORS },
+#endif
+#ifdef GL_MAX_FRAGMENT_INPUT_COMPONENTS
+    { GLATTER_LIMIT_MAX_FRAGMENT_INPUT_COMPONENTS, 32, 30, GL_MAX_FRAGMENT_INPUT_COMPONENTS },
 #endif
+#ifdef GL_MAX_UNIFORM_BLOCK_SIZE
+    { GLATTER_LIMIT_MAX_UNIFORM_BLOCK_SIZE, 31, 30, GL_MAX_UNIFORM_BLOCK_SIZE },
+#endif
+#ifdef GL_MAX_UNIFORM_BUFFER_BINDINGS
+    { GLATTER_LIMIT_MAX_UNIFORM_BUFFER_BINDINGS, 31, 30, GL_MAX_UNIFORM_BUFFER_BINDINGS },
+#endif
+#ifdef GL_MAX_VERTEX_UNIFORM_BLOCKS
+    { GLATTER_LIMIT_MAX_VERTEX_UNIFORM_BLOCKS, 31, 30, GL_MAX_VERTEX_UNIFORM_BLOCKS },
+#endif
+#ifdef GL_MAX_FRAGMENT_UNIFORM_BLOCKS
+    { GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_BLOCKS, 31, 30, GL_MAX_FRAGMENT_UNIFORM_BLOCKS },
+#endif
+#ifdef GL_MAX_COMBINED_UNIFORM_BLOCKS
+    { GLATTER_LIMIT_MAX_COMBINED_UNIFORM_BLOCKS, 31, 30, GL_MAX_COMBINED_UNIFORM_BLOCKS },
+#endif
+#ifdef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    { GLATTER_LIMIT_UNIFORM_BUFFER_OFFSET_ALIGNMENT, 31, 30, GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT },
+#endif
+#ifdef GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS
+    { GLATTER_LIMIT_MAX_SHADER_STORAGE_BUFFER_BINDINGS, 43, 31, GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS },
+#endif
+#ifdef GL_MAX_SHADER_STORAGE_BLOCK_SIZE
+    { GLATTER_LIMIT_MAX_SHADER_STORAGE_BLOCK_SIZE, 43, 31, GL_MAX_SHADER_STORAGE_BLOCK_SIZE },
+#endif
+#ifdef GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT
+    { GLATTER_LIMIT_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, 43, 31, GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT },
+#endif
+#ifdef GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS
+    { GLATTER_LIMIT_MAX_COMPUTE_WORK_GROUP_INVOCATIONS, 43, 31, GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS },
+#endif
+#ifdef GL_MAX_COMPUTE_SHARED_MEMORY_SIZE
+    { GLATTER_LIMIT_MAX_COMPUTE_SHARED_MEMORY_SIZE, 43, 31, GL_MAX_COMPUTE_SHARED_MEMORY_SIZE },
+#endif
+    { GLATTER_LIMIT_COUNT, 0, 0, 0 }
+};
 
-typedef struct {
-    uintptr_t key; /* context key from glatter_current_gl_context_key_() */
-    glatter_extension_support_status_GL_t ess;
-} glatter_es_cache_entry_GL_t;
+static int glatter_context_has_(const glatter_context_caps_t* caps, int gl, int es)
+{
+    int first = caps->es ? es : gl;
+    return first != 0 && caps->major * 10 + caps->minor >= first;
+}
 
-static GLATTER_THREAD_LOCAL glatter_es_cache_entry_GL_t
-    glatter_es_cache_GL[GLATTER_ES_CACHE_SLOTS];
+/* Fills caps from GL_VERSION and the queries that version has, so that none
+ * of them raises GL_INVALID_ENUM. */
+static void glatter_query_context_caps_GL_(glatter_context_caps_t* caps, const uint8_t* version)
+{
+    caps->es = strncmp((const char*)version, "OpenGL ES", 9) == 0;
+    glatter_parse_version_(version, &caps->major, &caps->minor);
+
+#ifdef GL_SHADING_LANGUAGE_VERSION
+    if (glatter_context_has_(caps, 20, 20)) {
+        int major, minor;
+        glatter_parse_version_((const uint8_t*)glatter_glGetString(GL_SHADING_LANGUAGE_VERSION), &major, &minor);
+        caps->glsl_version = major * 100 + (minor < 10 ? minor * 10 : minor);
+    }
+#endif
+#ifdef GL_CONTEXT_PROFILE_MASK
+    if (glatter_context_has_(caps, 32, 0)) {
+        glatter_glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &caps->profile_mask);
+    }
+#endif
+#ifdef GL_CONTEXT_FLAGS
+    if (glatter_context_has_(caps, 30, 32)) {
+        glatter_glGetIntegerv(GL_CONTEXT_FLAGS, &caps->flags);
+    }
+#endif
+    for (const glatter_context_limit_t* limit = glatter_context_limits_GL; limit->slot != GLATTER_LIMIT_COUNT; ++limit) {
+        if (glatter_context_has_(caps, limit->gl, limit->es)) {
+            glatter_glGetIntegerv(limit->name, &caps->limits[limit->slot]);
+        }
+    }
+}
 
-static GLATTER_THREAD_LOCAL unsigned glatter_es_cache_pos_GL = 0;
+/* ---- Per-context extension support cache (generated) ----
+ * A context cache shared by all threads; see "Context caches" in glatter_def.h. */
+GLATTER_LINKONCE glatter_context_cache_t glatter_es_cache_GL;
 
 /* Optional: public invalidation for this family. */
 GLATTER_INLINE_OR_NOT void glatter_invalidate_extension_cache_GL(void) {
-    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
-        glatter_es_cache_GL[i].key = (uintptr_t)0;
-    }
+    GLATTER_REGISTRY_FORWARD_INVALIDATE(GL);
+    glatter_context_cache_clear_(&glatter_es_cache_GL);
 }
 
+/* Returns the extension bitset of the current context. The set is shared by
+ * all threads and stays valid for the process (see "Context caches" in
+ * glatter_def.h); once the cache is invalidated, the next call builds a new
+ * one. Without a current context it points to an all-zero set. */
 GLATTER_INLINE_OR_NOT
-glatter_extension_support_status_GL_t glatter_get_extension_support_GL()
+const glatter_extension_support_status_GL_t* glatter_get_extension_support_GL(void)
 {
-    /* Per-thread scratch array to build the bitset before mapping into ess. */
-    static GLATTER_THREAD_LOCAL int indexed_extensions[348];
-
-    /* Local result object (returned by value). */
-    glatter_extension_support_status_GL_t ess; /* will be filled then returned */
-    memset(&ess, 0, sizeof(ess));
+    /* 0) With GLATTER_SHARED_REGISTRY, the root instance's cache may serve this one. */
+    GLATTER_REGISTRY_FORWARD_EXTENSIONS(GL);
 
     /* 1) Compute a key for the current context; 0 means "no current context". */
-    uintptr_t ctx_key = glatter_current_gl_context_key_();
+    uintptr_t ctx_handle;
+    uintptr_t ctx_key = glatter_current_gl_context_(&ctx_handle);
 
-    /* 2) If no current context, return zeros without touching the cache. */
+    /* 2) If no current context, report no extensions without touching the cache. */
     if (ctx_key == (uintptr_t)0) {
-        /* Leave ess zero-initialized to indicate "no extensions known". */
-        return ess;
+        return &glatter_context_info_none_GL.extensions;
     }
 
-    /* 3) Cache lookup (TLS ring of 8 entries). */
-    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
-        if (glatter_es_cache_GL[i].key == ctx_key) {
-            return glatter_es_cache_GL[i].ess; /* HIT */
-        }
+    /* 3) Cache lookup, shared by all threads. */
+    const glatter_extension_support_status_GL_t* cached = (const glatter_extension_support_status_GL_t*)
+        glatter_context_cache_find_(&glatter_es_cache_GL, ctx_key);
+    if (cached) {
+        return cached; /* HIT */
     }
 
-    /* 4) MISS: (re)build indexed_extensions[...] for the *current* context. */
-    /* Ensure scratch is cleared before probing. */
-    memset(indexed_extensions, 0, sizeof(indexed_extensions));
-
-    typedef glatter_es_record_t rt;
-#ifdef __cplusplus
-    static const rt zrt = {0, 0};
-#else
-#define zrt {0, 0}
-#endif
-    static rt e3c  [] = {{2451914812, 23}, zrt};
-    static rt e84  [] = {{1489961092, 346}, zrt};
-    static rt ea2  [] = {{286900386, 14}, zrt};
-    static rt edd  [] = {{185827549, 311}, zrt};
-    static rt e12c [] = {{4113137964, 138}, zrt};
-    static rt e199 [] = {{4292002201, 183}, zrt};
-    static rt e1a4 [] = {{803127716, 212}, zrt};
-    static rt e1b4 [] = {{3510370740, 194}, zrt};
-    static rt e1b8 [] = {{3808788920, 211}, zrt};
-    static rt e1bb [] = {{515867067, 321}, zrt};
-    static rt e1c1 [] = {{607830465, 56}, zrt};
-    static rt e1d9 [] = {{2216133081, 203}, zrt};
-    static rt e205 [] = {{3469509125, 53}, zrt};
-    static rt e22a [] = {{1253818922, 319}, zrt};
-    static rt e281 [] = {{1205240449, 3}, zrt};
-    static rt e2c1 [] = {{3085091521, 285}, zrt};
-    static rt e32e [] = {{1588495150, 220}, zrt};
-    static rt e358 [] = {{3772269400, 333}, zrt};
-    static rt e35a [] = {{984253274, 20}, zrt};
-    static rt e378 [] = {{3762258808, 121}, zrt};
-    static rt e37f [] = {{3779494783, 31}, zrt};
-    static rt e397 [] = {{2497774487, 225}, zrt};
-    static rt e39a [] = {{4229137306, 190}, zrt};
-    static rt e3b4 [] = {{3828319156, 325}, zrt};
-    static rt e3dd [] = {{834307037, 139}, zrt};
-    static rt e3fe [] = {{2524169214, 108}, zrt};
-    static rt e424 [] = {{3985720356, 49}, zrt};
-    static rt e434 [] = {{2649261108, 308}, zrt};
-    static rt e43b [] = {{2184889403, 77}, zrt};
-    static rt e43d [] = {{2662908989, 216}, zrt};
-    static rt e45a [] = {{3151430746, 16}, zrt};
-    static rt e4ef [] = {{2542617839, 339}, zrt};
-    static rt e576 [] = {{1090520438, 69}, zrt};
-    static rt e5a1 [] = {{3952641441, 114}, zrt};
-    static rt e608 [] = {{3796387336, 298}, zrt};
-    static rt e628 [] = {{1979729448, 159}, zrt};
-    static rt e663 [] = {{4254107235, 309}, zrt};
-    static rt e674 [] = {{3791718004, 95}, zrt};
-    static rt e6bd [] = {{2229700285, 282}, zrt};
-    static rt e6df [] = {{974915295, 91}, zrt};
-    static rt e730 [] = {{2115454768, 345}, zrt};
-    static rt e776 [] = {{2046789494, 341}, zrt};
-    static rt e791 [] = {{2872182673, 4}, zrt};
-    static rt e7ba [] = {{1745242042, 131}, zrt};
-    static rt e7d1 [] = {{1282295761, 117}, zrt};
-    static rt e7e1 [] = {{62343137, 29}, zrt};
-    static rt e7f7 [] = {{1014745079, 105}, zrt};
-    static rt e848 [] = {{1128056904, 45}, zrt};
-    static rt e871 [] = {{1369704561, 313}, zrt};
-    static rt e8da [] = {{3019262170, 244}, zrt};
-    static rt e8eb [] = {{2022082795, 256}, zrt};
-    static rt e9ce [] = {{2250623438, 47}, zrt};
-    static rt ea5e [] = {{2382662238, 265}, zrt};
-    static rt ea95 [] = {{3359935125, 90}, zrt};
-    static rt eada [] = {{3730950874, 197}, zrt};
-    static rt eae4 [] = {{4127525604, 302}, zrt};
-    static rt eaf7 [] = {{2933115639, 250}, zrt};
-    static rt eafa [] = {{2326563578, 30}, zrt};
-    static rt eb2d [] = {{1981139757, 320}, zrt};
-    static rt eb37 [] = {{96701239, 150}, zrt};
-    static rt eb47 [] = {{3647933255, 101}, zrt};
-    static rt eb51 [] = {{568855377, 124}, zrt};
-    static rt ebc6 [] = {{1245678534, 144}, zrt};
-    static rt ebd1 [] = {{2704870353, 278}, zrt};
-    static rt ec47 [] = {{2418297927, 40}, zrt};
-    static rt ec73 [] = {{327978099, 33}, zrt};
-    static rt ec7b [] = {{1441680507, 98}, zrt};
-    static rt ec97 [] = {{1456966807, 233}, zrt};
-    static rt eca7 [] = {{3059158183, 9}, zrt};
-    static rt ecf4 [] = {{2902248692, 276}, zrt};
-    static rt ed21 [] = {{369233185, 165}, zrt};
-    static rt ed24 [] = {{442486052, 88}, zrt};
-    static rt ed38 [] = {{3708947768, 103}, zrt};
-    static rt ed49 [] = {{4128574793, 80}, zrt};
-    static rt ed79 [] = {{1494945145, 158}, zrt};
-    static rt edb5 [] = {{1033784757, 142}, zrt};
-    static rt edba [] = {{3107147194, 161}, zrt};
-    static rt edd3 [] = {{1170607571, 168}, zrt};
-    static rt ee01 [] = {{3315584513, 12}, zrt};
-    static rt ee03 [] = {{3315584515, 13}, zrt};
-    static rt ee15 [] = {{3693514261, 208}, zrt};
-    static rt ee28 [] = {{3301002792, 169}, zrt};
-    static rt ee6a [] = {{4061400682, 226}, zrt};
-    static rt ee78 [] = {{4167159416, 32}, zrt};
-    static rt eeb4 [] = {{1295797940, 246}, zrt};
-    static rt eec4 [] = {{2214629060, 219}, zrt};
-    static rt eef7 [] = {{3949727479, 312}, zrt};
-    static rt ef01 [] = {{2498629377, 316}, zrt};
-    static rt ef7b [] = {{570953595, 137}, zrt};
-    static rt efae [] = {{1409896366, 155}, zrt};
-    static rt efb5 [] = {{3057536949, 25}, {3197882293, 42}, zrt};
-    static rt efb7 [] = {{2192035767, 300}, zrt};
-    static rt efcf [] = {{687312847, 318}, zrt};
-    static rt efe4 [] = {{1112559588, 1}, zrt};
-    static rt e1004[] = {{487133188, 79}, zrt};
-    static rt e100a[] = {{841535498, 280}, zrt};
-    static rt e1012[] = {{521572370, 34}, zrt};
-    static rt e1017[] = {{2025508887, 303}, zrt};
-    static rt e101b[] = {{23482395, 253}, zrt};
-    static rt e102c[] = {{2263076908, 273}, zrt};
-    static rt e1035[] = {{1354321973, 22}, zrt};
-    static rt e104e[] = {{687804494, 204}, zrt};
-    static rt e1061[] = {{714117217, 55}, zrt};
-    static rt e1067[] = {{3712143463, 193}, zrt};
-    static rt e1073[] = {{953077875, 283}, zrt};
-    static rt e1091[] = {{1531302033, 249}, zrt};
-    static rt e1098[] = {{1315917976, 173}, zrt};
-    static rt e10c3[] = {{2461601987, 186}, zrt};
-    static rt e10cc[] = {{2905051340, 336}, zrt};
-    static rt e1106[] = {{441028870, 222}, zrt};
-    static rt e1144[] = {{2131693892, 170}, zrt};
-    static rt e116c[] = {{1660031340, 217}, zrt};
-    static rt e11d6[] = {{3857928662, 140}, zrt};
-    static rt e11ee[] = {{1386205678, 8}, zrt};
-    static rt e11fd[] = {{2526155261, 229}, zrt};
-    static rt e121b[] = {{2427064859, 266}, zrt};
-    static rt e1275[] = {{2890928757, 344}, zrt};
-    static rt e12b6[] = {{2557956790, 329}, zrt};
-    static rt e12f0[] = {{3919975152, 74}, zrt};
-    static rt e1382[] = {{350245762, 191}, zrt};
-    static rt e1397[] = {{3937555351, 264}, zrt};
-    static rt e13a2[] = {{2475430818, 252}, zrt};
-    static rt e13de[] = {{22402014, 66}, zrt};
-    static rt e1403[] = {{2948207619, 62}, zrt};
-    static rt e1446[] = {{3063239750, 0}, zrt};
-    static rt e1491[] = {{2297304209, 334}, zrt};
-    static rt e14ee[] = {{2150372590, 2}, zrt};
-    static rt e157a[] = {{1084511610, 118}, zrt};
-    static rt e15f5[] = {{311809525, 201}, zrt};
-    static rt e1638[] = {{1265882680, 275}, zrt};
-    static rt e16af[] = {{166876847, 44}, zrt};
-    static rt e16c3[] = {{3794917059, 230}, zrt};
-    static rt e175b[] = {{4066826075, 223}, zrt};
-    static rt e17f4[] = {{2859341812, 86}, zrt};
-    static rt e17f6[] = {{3119568886, 269}, zrt};
-    static rt e1831[] = {{2949355569, 75}, zrt};
-    static rt e18a3[] = {{134830243, 245}, zrt};
-    static rt e1926[] = {{625760550, 37}, zrt};
-    static rt e192f[] = {{4116977967, 107}, zrt};
-    static rt e1945[] = {{978901317, 21}, zrt};
-    static rt e196d[] = {{3269450093, 188}, zrt};
-    static rt e1a08[] = {{3643906568, 136}, zrt};
-    static rt e1a0b[] = {{2679986699, 326}, zrt};
-    static rt e1a9e[] = {{327211678, 235}, zrt};
-    static rt e1aac[] = {{1888688812, 109}, zrt};
-    static rt e1ad3[] = {{3219888851, 343}, zrt};
-    static rt e1b15[] = {{1144249109, 41}, zrt};
-    static rt e1b1d[] = {{857938717, 96}, zrt};
-    static rt e1b2f[] = {{822565679, 224}, zrt};
-    static rt e1b63[] = {{235002723, 60}, zrt};
-    static rt e1c29[] = {{510352425, 65}, zrt};
-    static rt e1cab[] = {{2140069035, 176}, zrt};
-    static rt e1cb2[] = {{1952832690, 104}, zrt};
-    static rt e1cb6[] = {{3584875702, 213}, zrt};
-    static rt e1d20[] = {{127589664, 258}, zrt};
-    static rt e1d4c[] = {{1241505100, 335}, zrt};
-    static rt e1d59[] = {{1554586969, 160}, zrt};
-    static rt e1df4[] = {{1317920244, 59}, zrt};
-    static rt e1e29[] = {{4013121065, 306}, zrt};
-    static rt e1e36[] = {{3958136374, 215}, zrt};
-    static rt e1e3f[] = {{3145178687, 93}, zrt};
-    static rt e1e49[] = {{3761774153, 120}, zrt};
-    static rt e1e4e[] = {{1070931534, 151}, zrt};
-    static rt e1e58[] = {{4247248472, 247}, zrt};
-    static rt e1f3b[] = {{3472219963, 127}, zrt};
-    static rt e1f49[] = {{1373953865, 206}, zrt};
-    static rt e1f8c[] = {{2595954572, 100}, zrt};
-    static rt e1fb3[] = {{2263130035, 209}, zrt};
-    static rt e2013[] = {{122167315, 111}, zrt};
-    static rt e2052[] = {{1796382802, 141}, zrt};
-    static rt e20ab[] = {{1275437227, 94}, zrt};
-    static rt e20b7[] = {{3186106551, 289}, zrt};
-    static rt e20f5[] = {{1809211637, 36}, zrt};
-    static rt e2102[] = {{1607082242, 110}, zrt};
-    static rt e2116[] = {{2292326678, 64}, zrt};
-    static rt e21bd[] = {{2196169149, 310}, zrt};
-    static rt e21f9[] = {{119120377, 19}, zrt};
-    static rt e222a[] = {{1365877290, 28}, {3515982378, 68}, zrt};
-    static rt e222f[] = {{1276961327, 149}, zrt};
-    static rt e2230[] = {{1780523568, 102}, zrt};
-    static rt e2248[] = {{2131698248, 171}, zrt};
-    static rt e224a[] = {{3066618442, 301}, zrt};
-    static rt e2287[] = {{1814946439, 228}, zrt};
-    static rt e22bc[] = {{1982554812, 288}, zrt};
-    static rt e22c8[] = {{4126827208, 57}, zrt};
-    static rt e2331[] = {{1475388209, 147}, zrt};
-    static rt e2342[] = {{454386498, 174}, zrt};
-    static rt e2343[] = {{454386499, 175}, zrt};
-    static rt e2390[] = {{1072472976, 184}, zrt};
-    static rt e23b1[] = {{3761693617, 119}, zrt};
-    static rt e23d3[] = {{1747280851, 177}, zrt};
-    static rt e23f5[] = {{146613237, 15}, zrt};
-    static rt e2411[] = {{32334865, 242}, zrt};
-    static rt e2442[] = {{233743426, 6}, zrt};
-    static rt e24cc[] = {{2689180876, 337}, zrt};
-    static rt e24d0[] = {{3129205968, 133}, zrt};
-    static rt e24d1[] = {{3523699921, 162}, zrt};
-    static rt e24e8[] = {{1122788584, 156}, zrt};
-    static rt e24f5[] = {{805922037, 148}, zrt};
-    static rt e250b[] = {{3904840971, 132}, zrt};
-    static rt e2585[] = {{3021333893, 237}, zrt};
-    static rt e25b0[] = {{4223018416, 172}, zrt};
-    static rt e25bd[] = {{583280061, 267}, zrt};
-    static rt e25df[] = {{891299295, 35}, zrt};
-    static rt e25e7[] = {{638166503, 284}, zrt};
-    static rt e26b1[] = {{789587633, 210}, zrt};
-    static rt e26c6[] = {{1540499142, 89}, zrt};
-    static rt e26e9[] = {{847111913, 76}, zrt};
-    static rt e2715[] = {{3930089237, 24}, zrt};
-    static rt e276c[] = {{3069929324, 84}, zrt};
-    static rt e277d[] = {{3525322621, 18}, zrt};
-    static rt e2783[] = {{2982471555, 87}, zrt};
-    static rt e278b[] = {{2695702411, 327}, zrt};
-    static rt e2797[] = {{1845159831, 315}, zrt};
-    static rt e27a0[] = {{380413856, 279}, zrt};
-    static rt e27b9[] = {{2723293113, 178}, zrt};
-    static rt e2821[] = {{3246008353, 61}, zrt};
-    static rt e2833[] = {{3270649907, 27}, zrt};
-    static rt e284b[] = {{3036964939, 207}, zrt};
-    static rt e285b[] = {{1736960091, 234}, zrt};
-    static rt e2881[] = {{2831394945, 83}, zrt};
-    static rt e28b4[] = {{853223604, 26}, zrt};
-    static rt e28cf[] = {{3893356751, 51}, zrt};
-    static rt e28f4[] = {{3649431796, 324}, zrt};
-    static rt e2914[] = {{2292820244, 129}, zrt};
-    static rt e2918[] = {{1402415384, 272}, zrt};
-    static rt e298a[] = {{2720246154, 248}, zrt};
-    static rt e29a8[] = {{2808195496, 330}, zrt};
-    static rt e2a0e[] = {{2733369870, 134}, zrt};
-    static rt e2a43[] = {{1790798403, 286}, zrt};
-    static rt e2a73[] = {{3814419059, 294}, zrt};
-    static rt e2aa4[] = {{4225411748, 239}, zrt};
-    static rt e2aa7[] = {{1686858407, 307}, zrt};
-    static rt e2ae0[] = {{3733793504, 54}, zrt};
-    static rt e2b0a[] = {{2674453258, 82}, zrt};
-    static rt e2c28[] = {{1170648104, 71}, zrt};
-    static rt e2c36[] = {{801451062, 39}, zrt};
-    static rt e2c66[] = {{1384803430, 166}, zrt};
-    static rt e2c72[] = {{3353160818, 290}, zrt};
-    static rt e2c98[] = {{2353163416, 332}, zrt};
-    static rt e2ca3[] = {{3936644259, 189}, zrt};
-    static rt e2cb0[] = {{141421744, 73}, zrt};
-    static rt e2cf2[] = {{3303615730, 187}, zrt};
-    static rt e2d1a[] = {{474410266, 331}, zrt};
-    static rt e2d5d[] = {{2727767389, 106}, zrt};
-    static rt e2df5[] = {{6893045, 135}, zrt};
-    static rt e2e41[] = {{2083286593, 163}, zrt};
-    static rt e2e74[] = {{2825875060, 243}, zrt};
-    static rt e2e87[] = {{2858544775, 180}, zrt};
-    static rt e2ec4[] = {{1623830212, 340}, zrt};
-    static rt e2f25[] = {{4228362021, 218}, zrt};
-    static rt e2f26[] = {{356544294, 347}, zrt};
-    static rt e2f49[] = {{2582048585, 236}, zrt};
-    static rt e2f53[] = {{1342254931, 167}, zrt};
-    static rt e2f59[] = {{3830902617, 251}, zrt};
-    static rt e2f78[] = {{4231163768, 179}, zrt};
-    static rt e2fa3[] = {{1263136675, 287}, zrt};
-    static rt e303f[] = {{3363106879, 274}, zrt};
-    static rt e3053[] = {{3777966163, 322}, zrt};
-    static rt e3054[] = {{2295820372, 48}, zrt};
-    static rt e3059[] = {{1032613977, 11}, zrt};
-    static rt e30e9[] = {{1496248553, 305}, zrt};
-    static rt e3109[] = {{1335341321, 205}, {1362620681, 10}, zrt};
-    static rt e311b[] = {{3439030555, 214}, zrt};
-    static rt e311d[] = {{4130042141, 85}, zrt};
-    static rt e3127[] = {{2800398631, 304}, zrt};
-    static rt e312a[] = {{1214705962, 293}, zrt};
-    static rt e316a[] = {{1895723370, 72}, zrt};
-    static rt e31a6[] = {{2343678374, 185}, zrt};
-    static rt e31c8[] = {{4230820296, 52}, zrt};
-    static rt e31fb[] = {{312046075, 200}, zrt};
-    static rt e3226[] = {{1441002022, 78}, zrt};
-    static rt e3250[] = {{3312333392, 268}, zrt};
-    static rt e3279[] = {{4106220153, 202}, zrt};
-    static rt e327a[] = {{689074810, 260}, zrt};
-    static rt e32a5[] = {{3762238117, 122}, zrt};
-    static rt e32aa[] = {{2240295594, 199}, zrt};
-    static rt e32f1[] = {{716223217, 67}, zrt};
-    static rt e3302[] = {{1601598210, 81}, zrt};
-    static rt e3334[] = {{3095868212, 115}, zrt};
-    static rt e336d[] = {{1027830637, 50}, zrt};
-    static rt e3388[] = {{1604449160, 291}, zrt};
-    static rt e33ce[] = {{1111274446, 5}, zrt};
-    static rt e3444[] = {{2731127876, 240}, zrt};
-    static rt e3455[] = {{2077815893, 153}, zrt};
-    static rt e34a5[] = {{4110808229, 63}, zrt};
-    static rt e34a7[] = {{2728408231, 231}, zrt};
-    static rt e34b4[] = {{1010054324, 46}, {3061232820, 130}, zrt};
-    static rt e3543[] = {{3293230403, 241}, zrt};
-    static rt e355e[] = {{1384002910, 182}, zrt};
-    static rt e3562[] = {{4218975586, 263}, zrt};
-    static rt e35c9[] = {{2229466569, 255}, zrt};
-    static rt e35ed[] = {{3550672365, 58}, zrt};
-    static rt e35f9[] = {{142652921, 198}, zrt};
-    static rt e3614[] = {{4095424020, 259}, zrt};
-    static rt e3665[] = {{2176431717, 238}, zrt};
-    static rt e36b7[] = {{2507060919, 113}, zrt};
-    static rt e36d8[] = {{3934058200, 261}, zrt};
-    static rt e36dd[] = {{2620503773, 143}, zrt};
-    static rt e36f7[] = {{3934058231, 262}, zrt};
-    static rt e375c[] = {{1838921564, 17}, zrt};
-    static rt e3795[] = {{1142765461, 92}, zrt};
-    static rt e381f[] = {{3687839775, 281}, zrt};
-    static rt e382e[] = {{2341763118, 314}, zrt};
-    static rt e38b6[] = {{2260318390, 157}, zrt};
-    static rt e3901[] = {{2541648129, 97}, zrt};
-    static rt e3950[] = {{1370601808, 342}, zrt};
-    static rt e39e5[] = {{3850336741, 112}, zrt};
-    static rt e39eb[] = {{1407580651, 99}, zrt};
-    static rt e3a34[] = {{4188142132, 181}, zrt};
-    static rt e3a47[] = {{3856906823, 292}, zrt};
-    static rt e3a4b[] = {{4169661003, 221}, zrt};
-    static rt e3ae5[] = {{118831845, 323}, zrt};
-    static rt e3ae6[] = {{1242839782, 126}, zrt};
-    static rt e3aef[] = {{1685043951, 145}, zrt};
-    static rt e3b12[] = {{3331504914, 328}, zrt};
-    static rt e3b3b[] = {{647510843, 227}, zrt};
-    static rt e3b5f[] = {{2751478623, 70}, zrt};
-    static rt e3b67[] = {{1709996903, 125}, zrt};
-    static rt e3b75[] = {{3153754997, 277}, zrt};
-    static rt e3b96[] = {{1539570582, 270}, zrt};
-    static rt e3bc3[] = {{2796125123, 152}, zrt};
-    static rt e3bd2[] = {{157924306, 123}, zrt};
-    static rt e3be0[] = {{210222048, 196}, {2055846880, 295}, zrt};
-    static rt e3be3[] = {{2055846883, 296}, zrt};
-    static rt e3be7[] = {{2055846887, 297}, zrt};
-    static rt e3bf5[] = {{1857666037, 338}, zrt};
-    static rt e3c0c[] = {{3591371788, 7}, zrt};
-    static rt e3c28[] = {{2342042664, 317}, zrt};
-    static rt e3cb1[] = {{1356381361, 38}, zrt};
-    static rt e3cb5[] = {{982826165, 154}, zrt};
-    static rt e3d2e[] = {{3182656814, 192}, zrt};
-    static rt e3d94[] = {{261438868, 195}, zrt};
-    static rt e3dbe[] = {{1452228030, 43}, zrt};
-    static rt e3e22[] = {{597196322, 164}, zrt};
-    static rt e3e41[] = {{2990751297, 116}, zrt};
-    static rt e3ebb[] = {{2837135035, 271}, zrt};
-    static rt e3ec9[] = {{3548692169, 257}, zrt};
-    static rt e3f61[] = {{2136768353, 299}, zrt};
-    static rt e3f6c[] = {{1405763436, 128}, zrt};
-    static rt e3f81[] = {{3117563777, 254}, zrt};
-    static rt e3f91[] = {{3178561425, 232}, zrt};
-    static rt e3fb7[] = {{3446325175, 146}, zrt};
-
-#ifndef __cplusplus
-#undef zrt
-#endif
-
-    static glatter_es_record_t* es_dispatch[GLATTER_LOOKUP_SIZE] = {
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e3c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,ea2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,edd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e12c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e199,0,0,0,0,0,0,0,0,0,0,
-        e1a4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1b4,0,0,0,e1b8,0,0,e1bb,0,0,0,0,0,e1c1,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1d9,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e22a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e281,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e32e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e358,0,e35a,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e378,0,0,0,0,0,0,e37f,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e397,0,0,e39a,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3b4,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3dd,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3fe,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e424,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e434,0,0,0,
-        0,0,0,e43b,0,e43d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e45a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e4ef,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e576,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e5a1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e608,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e628,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e663,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e674,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e6bd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e6df,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e730,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e776,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e791,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e7ba,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e7d1,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e7e1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e7f7,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e848,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e871,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e8da,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e8eb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e9ce,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,ea5e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,ea95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,eada,0,0,0,0,0,0,0,0,0,eae4,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,eaf7,0,0,eafa,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,eb2d,0,0,0,0,0,0,0,0,0,eb37,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,eb47,0,0,0,0,0,0,0,0,0,eb51,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,ebc6,0,0,0,0,0,0,0,0,0,0,ebd1,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ec47,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,ec73,0,0,0,0,0,0,0,ec7b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,ec97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,eca7,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ecf4,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,ed21,0,0,ed24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ed38,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,ed49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ed79,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,edb5,
-        0,0,0,0,edba,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,edd3,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ee01,0,ee03,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,ee15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ee28,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        ee6a,0,0,0,0,0,0,0,0,0,0,0,0,0,ee78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,eeb4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        eec4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,eef7,0,0,0,0,0,0,0,0,
-        0,ef01,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,ef7b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,efae,0,0,0,0,0,
-        0,efb5,0,efb7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,efcf,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,efe4,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1004,0,0,0,0,0,e100a,0,0,0,
-        0,0,0,0,e1012,0,0,0,0,e1017,0,0,0,e101b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e102c,0,0,0,0,0,0,0,0,e1035,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e104e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1061,0,0,0,0,0,e1067,
-        0,0,0,0,0,0,0,0,0,0,0,e1073,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e1091,0,0,0,0,0,0,e1098,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e10c3,0,0,0,0,0,0,0,0,e10cc,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e1106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e1144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e116c,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e11d6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e11ee,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e11fd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e121b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1275,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e12b6,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e12f0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e1397,0,0,0,0,0,0,0,0,0,0,e13a2,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e13de,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1403,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e1446,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1491,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e14ee,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e157a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e15f5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1638,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e16af,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e16c3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e175b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e17f4,0,e17f6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e1831,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e18a3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1926,0,0,0,0,0,0,0,0,e192f,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1945,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e196d,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e1a08,0,0,e1a0b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e1a9e,0,0,0,0,0,0,0,0,0,0,0,0,0,e1aac,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1ad3,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e1b15,0,0,0,0,0,0,0,e1b1d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1b2f,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1b63,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e1c29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1cab,0,0,0,0,0,0,e1cb2,0,0,0,
-        e1cb6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1d20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e1d4c,0,0,0,0,0,0,0,0,0,0,0,0,e1d59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1df4,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e1e29,0,0,0,0,0,0,0,0,0,0,0,0,e1e36,0,0,0,0,0,
-        0,0,0,e1e3f,0,0,0,0,0,0,0,0,0,e1e49,0,0,0,0,e1e4e,0,0,0,0,0,0,0,0,0,e1e58,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1f3b,0,0,0,0,0,0,0,0,0,0,0,0,0,e1f49,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e1f8c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1fb3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2013,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2052,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e20ab,0,0,0,0,0,0,
-        0,0,0,0,0,e20b7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e20f5,0,0,0,0,0,0,0,0,0,0,0,0,e2102,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e2116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e21bd,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e21f9,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e222a,0,0,0,0,e222f,e2230,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2248,0,e224a,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2287,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e22bc,0,0,0,0,0,0,0,0,0,0,0,e22c8,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e2331,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2342,e2343,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e23b1,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e23d3,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e23f5,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2411,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2442,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e24cc,0,0,0,e24d0,e24d1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e24e8,0,
-        0,0,0,0,0,0,0,0,0,0,0,e24f5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e250b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e2585,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e25b0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e25bd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e25df,0,0,0,0,0,0,0,e25e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e26b1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e26c6,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e26e9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2715,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e276c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e277d,
-        0,0,0,0,0,e2783,0,0,0,0,0,0,0,e278b,0,0,0,0,0,0,0,0,0,0,0,e2797,0,0,0,0,
-        0,0,0,0,e27a0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e27b9,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e2821,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e2833,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e284b,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e285b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2881,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e28b4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e28cf,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e28f4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2914,0,0,0,e2918,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e298a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e29a8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2a0e,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2a43,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e2a73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2aa4,0,0,e2aa7,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2ae0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e2b0a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c28,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e2c36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c66,0,0,0,
-        0,0,0,0,0,0,0,0,e2c72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c98,0,0,0,0,0,0,0,0,0,0,e2ca3,0,0,
-        0,0,0,0,0,0,0,0,0,0,e2cb0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2cf2,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2d1a,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e2d5d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e2df5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2e41,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2e74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e2e87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e2ec4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e2f25,e2f26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2f49,0,0,0,0,0,0,0,0,0,e2f53,0,0,0,0,
-        0,e2f59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e2f78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2fa3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e303f,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e3053,e3054,0,0,0,0,e3059,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e30e9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e3109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e311b,0,e311d,0,0,0,0,0,0,0,0,0,e3127,0,0,e312a,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e316a,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e31a6,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e31c8,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e31fb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3226,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e3250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3279,e327a,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e32a5,0,0,0,0,e32aa,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e32f1,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e3302,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3334,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e336d,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3388,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e33ce,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e3444,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3455,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e34a5,0,e34a7,0,0,0,0,0,0,0,0,0,0,0,0,e34b4,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3543,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e355e,0,0,0,e3562,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e35c9,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e35ed,0,0,0,0,0,0,0,0,0,0,0,e35f9,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e3665,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e36b7,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e36d8,0,0,0,0,e36dd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e36f7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e375c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e3795,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e381f,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e382e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e38b6,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e3901,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3950,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e39e5,0,0,0,0,0,e39eb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3a34,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e3a47,0,0,0,e3a4b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3ae5,e3ae6,0,0,0,0,0,0,0,0,e3aef,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3b12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e3b3b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3b5f,0,0,0,0,0,0,0,e3b67,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e3b75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3b96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3bc3,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3bd2,0,0,0,0,0,0,0,0,0,0,0,0,0,e3be0,0,
-        0,e3be3,0,0,0,e3be7,0,0,0,0,0,0,0,0,0,0,0,0,0,e3bf5,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e3c0c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e3c28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3cb1,0,0,
-        0,e3cb5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3d2e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3d94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3dbe,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e3e22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e3e41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e3ebb,0,0,0,0,0,0,0,0,0,0,0,0,0,e3ec9,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3f61,0,0,0,0,
-        0,0,0,0,0,0,e3f6c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3f81,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e3f91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3fb7,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0
-    };
-
-
+    /* 4) MISS: build the bitset for the *current* context in a new entry,
+     * which is published only once complete. An early return below frees it
+     * and leaves nothing cached. */
+    glatter_context_set_t* set = glatter_context_set_new_(ctx_key, ctx_handle, sizeof(glatter_context_info_GL_t));
+    if (!set) {
+        return &glatter_context_info_none_GL.extensions;
+    }
+    glatter_context_info_GL_t* info = (glatter_context_info_GL_t*)glatter_context_set_data_(set);
+    glatter_extension_support_status_GL_t* ess = &info->extensions;
 
-        const uint8_t* glv = NULL;
-        if (glatter_get_proc_address_GL("glGetString")) {
-            glv = (const uint8_t*)glatter_glGetString(GL_VERSION);
-        }
-        int new_way = 0;
-        if (!glv) {
-            return ess;
-        }
-        if (glv[0] < '0' || glv[0] > '9') {
-            new_way = 0;
-        }
-        else {
-            new_way = glv[0] > '2'; // i.e. gl version is 3 or higher
-        }
+    const uint8_t* glv = NULL;
+    if (glatter_get_proc_address_GL("glGetString")) {
+        glv = (const uint8_t*)glatter_glGetString(GL_VERSION);
+    }
+    if (!glv) {
+        free(set);
+        return &glatter_context_info_none_GL.extensions;
+    }
+    glatter_query_context_caps_GL_(&info->caps, glv);
 
 #ifdef GL_NUM_EXTENSIONS
-        if (new_way && glatter_get_proc_address_GL("glGetStringi") ) {
-            GLint n = 0; 
-            glGetIntegerv(GL_NUM_EXTENSIONS, &n); 
-            for (GLint i=0; i<n; i++)  { 
-                uint32_t hash = glatter_djb2( (const uint8_t*)glatter_glGetStringi(GL_EXTENSIONS, i) );
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-                if (index == -1) {
-                    // (1) This scope will be reached if the implementation supports an extension
-                    // not listed in the headers. This may happen if the headers are old or the
-                    // extension is deprecated. The same condition repeats two more times below.
-                    // It is not an error, thus there is nothing to do.
-                    // The statement is left for debug purposes.
-                }
-            }
-        }
-        else {
-#endif
-            uint32_t hash = 5381;
-            const uint8_t* ext_str = (const uint8_t*)glatter_glGetString(GL_EXTENSIONS);
-            for ( ; ext_str && *ext_str; ext_str++) {
-                if (*ext_str == ' ') {
-                    int index = -1;
-                    rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                    for ( ; r && (r->hash | r->index); r++ ) {
-                        if (r->hash == hash) {
-                            index = r->index;
-                            indexed_extensions[index] = 1;
-                            break;
-                        }
-                    }
-
-                    if (index == -1) {
-                        // (2)
-                    }
-
-                    // reset
-                    hash = 5381;
-                    continue;
-                }
-
-                hash = ((hash << 5) + hash) + (int)(*ext_str);
-
-            }
-            if (ext_str && hash != 5381) {
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-                if (index == -1) {
-                    // (3)
-                }
+    if (info->caps.major >= 3 && glatter_get_proc_address_GL("glGetStringi")) {
+        GLint n = 0;
+        glatter_glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+        for (GLint i = 0; i < n; i++) {
+            const uint8_t* name = (const uint8_t*)glatter_glGetStringi(GL_EXTENSIONS, i);
+            if (name) {
+                glatter_extension_mark_(ess->bits, &glatter_ext_table_GL, name, strlen((const char*)name));
             }
-#ifdef GL_NUM_EXTENSIONS
         }
+    }
+    else
 #endif
+    {
+        glatter_extension_mark_list_(ess->bits, &glatter_ext_table_GL,
+            (const uint8_t*)glatter_glGetString(GL_EXTENSIONS));
+    }
 
-    // Map array to a struct without undefined behaviour.
-    // No actual copy is performed with even basic optimization e.g.: -Og
-    memcpy((void*)&ess, indexed_extensions, sizeof(ess));
-
-    glatter_es_cache_GL[glatter_es_cache_pos_GL].key = ctx_key;
-    glatter_es_cache_GL[glatter_es_cache_pos_GL].ess = ess;
-    glatter_es_cache_pos_GL = (glatter_es_cache_pos_GL + 1) % GLATTER_ES_CACHE_SLOTS;
+    return (const glatter_extension_support_status_GL_t*)
+        glatter_context_cache_publish_(&glatter_es_cache_GL, set);
+}
 
-    return ess;
+/* Returns the version, profile and limits of the current context. They are
+ * queried with its extensions, cached with them and invalidated with them.
+ * Without a current context every field is 0. */
+GLATTER_INLINE_OR_NOT
+const glatter_context_caps_t* glatter_get_context_caps(void)
+{
+    /* Every GL set, including the empty one, is a glatter_context_info_GL_t. */
+    return &((const glatter_context_info_GL_t*)glatter_get_extension_support_GL())->caps;
 }
 
@@ -0,0 +1,2483 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+#ifdef GLATTER_GL
+#if defined(__gles1_gl_h_)
+#if defined(GL_OES_point_size_array)
+GLATTER_IEXTENSION(GL_OES_point_size_array)
+GLATTER_IBLOCK(glPointSizePointerOES)
+#endif // defined(GL_OES_point_size_array)
+#if defined(GL_VERSION_ES_CM_1_0)
+GLATTER_IVERSION(1, 0)
+GLATTER_IBLOCK(glActiveTexture)
+GLATTER_IBLOCK(glAlphaFunc)
+GLATTER_IBLOCK(glAlphaFuncx)
+GLATTER_IBLOCK(glBindBuffer)
+GLATTER_IBLOCK(glBindTexture)
+GLATTER_IBLOCK(glBlendFunc)
+GLATTER_IBLOCK(glBufferData)
+GLATTER_IBLOCK(glBufferSubData)
+GLATTER_IBLOCK(glClear)
+GLATTER_IBLOCK(glClearColor)
+GLATTER_IBLOCK(glClearColorx)
+GLATTER_IBLOCK(glClearDepthf)
+GLATTER_IBLOCK(glClearDepthx)
+GLATTER_IBLOCK(glClearStencil)
+GLATTER_IBLOCK(glClientActiveTexture)
+GLATTER_IBLOCK(glClipPlanef)
+GLATTER_IBLOCK(glClipPlanex)
+GLATTER_IBLOCK(glColor4f)
+GLATTER_IBLOCK(glColor4ub)
+GLATTER_IBLOCK(glColor4x)
+GLATTER_IBLOCK(glColorMask)
+GLATTER_IBLOCK(glColorPointer)
+GLATTER_IBLOCK(glCompressedTexImage2D)
+GLATTER_IBLOCK(glCompressedTexSubImage2D)
+GLATTER_IBLOCK(glCopyTexImage2D)
+GLATTER_IBLOCK(glCopyTexSubImage2D)
+GLATTER_IBLOCK(glCullFace)
+GLATTER_IBLOCK(glDeleteBuffers)
+GLATTER_IBLOCK(glDeleteTextures)
+GLATTER_IBLOCK(glDepthFunc)
+GLATTER_IBLOCK(glDepthMask)
+GLATTER_IBLOCK(glDepthRangef)
+GLATTER_IBLOCK(glDepthRangex)
+GLATTER_IBLOCK(glDisable)
+GLATTER_IBLOCK(glDisableClientState)
+GLATTER_IBLOCK(glDrawArrays)
+GLATTER_IBLOCK(glDrawElements)
+GLATTER_IBLOCK(glEnable)
+GLATTER_IBLOCK(glEnableClientState)
+GLATTER_IBLOCK(glFinish)
+GLATTER_IBLOCK(glFlush)
+GLATTER_IBLOCK(glFogf)
+GLATTER_IBLOCK(glFogfv)
+GLATTER_IBLOCK(glFogx)
+GLATTER_IBLOCK(glFogxv)
+GLATTER_IBLOCK(glFrontFace)
+GLATTER_IBLOCK(glFrustumf)
+GLATTER_IBLOCK(glFrustumx)
+GLATTER_IBLOCK(glGenBuffers)
+GLATTER_IBLOCK(glGenTextures)
+GLATTER_IBLOCK(glGetBooleanv)
+GLATTER_IBLOCK(glGetBufferParameteriv)
+GLATTER_IBLOCK(glGetClipPlanef)
+GLATTER_IBLOCK(glGetClipPlanex)
+GLATTER_IBLOCK(glGetError)
+GLATTER_IBLOCK(glGetFixedv)
+GLATTER_IBLOCK(glGetFloatv)
+GLATTER_IBLOCK(glGetIntegerv)
+GLATTER_IBLOCK(glGetLightfv)
+GLATTER_IBLOCK(glGetLightxv)
+GLATTER_IBLOCK(glGetMaterialfv)
+GLATTER_IBLOCK(glGetMaterialxv)
+GLATTER_IBLOCK(glGetPointerv)
+GLATTER_IBLOCK(glGetString)
+GLATTER_IBLOCK(glGetTexEnvfv)
+GLATTER_IBLOCK(glGetTexEnviv)
+GLATTER_IBLOCK(glGetTexEnvxv)
+GLATTER_IBLOCK(glGetTexParameterfv)
+GLATTER_IBLOCK(glGetTexParameteriv)
+GLATTER_IBLOCK(glGetTexParameterxv)
+GLATTER_IBLOCK(glHint)
+GLATTER_IBLOCK(glIsBuffer)
+GLATTER_IBLOCK(glIsEnabled)
+GLATTER_IBLOCK(glIsTexture)
+GLATTER_IBLOCK(glLightModelf)
+GLATTER_IBLOCK(glLightModelfv)
+GLATTER_IBLOCK(glLightModelx)
+GLATTER_IBLOCK(glLightModelxv)
+GLATTER_IBLOCK(glLightf)
+GLATTER_IBLOCK(glLightfv)
+GLATTER_IBLOCK(glLightx)
+GLATTER_IBLOCK(glLightxv)
+GLATTER_IBLOCK(glLineWidth)
+GLATTER_IBLOCK(glLineWidthx)
+GLATTER_IBLOCK(glLoadIdentity)
+GLATTER_IBLOCK(glLoadMatrixf)
+GLATTER_IBLOCK(glLoadMatrixx)
+GLATTER_IBLOCK(glLogicOp)
+GLATTER_IBLOCK(glMaterialf)
+GLATTER_IBLOCK(glMaterialfv)
+GLATTER_IBLOCK(glMaterialx)
+GLATTER_IBLOCK(glMaterialxv)
+GLATTER_IBLOCK(glMatrixMode)
+GLATTER_IBLOCK(glMultMatrixf)
+GLATTER_IBLOCK(glMultMatrixx)
+GLATTER_IBLOCK(glMultiTexCoord4f)
+GLATTER_IBLOCK(glMultiTexCoord4x)
+GLATTER_IBLOCK(glNormal3f)
+GLATTER_IBLOCK(glNormal3x)
+GLATTER_IBLOCK(glNormalPointer)
+GLATTER_IBLOCK(glOrthof)
+GLATTER_IBLOCK(glOrthox)
+GLATTER_IBLOCK(glPixelStorei)
+GLATTER_IBLOCK(glPointParameterf)
+GLATTER_IBLOCK(glPointParameterfv)
+GLATTER_IBLOCK(glPointParameterx)
+GLATTER_IBLOCK(glPointParameterxv)
+GLATTER_IBLOCK(glPointSize)
+GLATTER_IBLOCK(glPointSizex)
+GLATTER_IBLOCK(glPolygonOffset)
+GLATTER_IBLOCK(glPolygonOffsetx)
+GLATTER_IBLOCK(glPopMatrix)
+GLATTER_IBLOCK(glPushMatrix)
+GLATTER_IBLOCK(glReadPixels)
+GLATTER_IBLOCK(glRotatef)
+GLATTER_IBLOCK(glRotatex)
+GLATTER_IBLOCK(glSampleCoverage)
+GLATTER_IBLOCK(glSampleCoveragex)
+GLATTER_IBLOCK(glScalef)
+GLATTER_IBLOCK(glScalex)
+GLATTER_IBLOCK(glScissor)
+GLATTER_IBLOCK(glShadeModel)
+GLATTER_IBLOCK(glStencilFunc)
+GLATTER_IBLOCK(glStencilMask)
+GLATTER_IBLOCK(glStencilOp)
+GLATTER_IBLOCK(glTexCoordPointer)
+GLATTER_IBLOCK(glTexEnvf)
+GLATTER_IBLOCK(glTexEnvfv)
+GLATTER_IBLOCK(glTexEnvi)
+GLATTER_IBLOCK(glTexEnviv)
+GLATTER_IBLOCK(glTexEnvx)
+GLATTER_IBLOCK(glTexEnvxv)
+GLATTER_IBLOCK(glTexImage2D)
+GLATTER_IBLOCK(glTexParameterf)
+GLATTER_IBLOCK(glTexParameterfv)
+GLATTER_IBLOCK(glTexParameteri)
+GLATTER_IBLOCK(glTexParameteriv)
+GLATTER_IBLOCK(glTexParameterx)
+GLATTER_IBLOCK(glTexParameterxv)
+GLATTER_IBLOCK(glTexSubImage2D)
+GLATTER_IBLOCK(glTranslatef)
+GLATTER_IBLOCK(glTranslatex)
+GLATTER_IBLOCK(glVertexPointer)
+GLATTER_IBLOCK(glViewport)
+#endif // defined(GL_VERSION_ES_CM_1_0)
+#endif // defined(__gles1_gl_h_)
+#if defined(__gles1_glext_h_)
+#if defined(GL_APPLE_copy_texture_levels)
+GLATTER_IEXTENSION(GL_APPLE_copy_texture_levels)
+GLATTER_IBLOCK(glCopyTextureLevelsAPPLE)
+#endif // defined(GL_APPLE_copy_texture_levels)
+#if defined(GL_APPLE_framebuffer_multisample)
+GLATTER_IEXTENSION(GL_APPLE_framebuffer_multisample)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleAPPLE)
+GLATTER_IBLOCK(glResolveMultisampleFramebufferAPPLE)
+#endif // defined(GL_APPLE_framebuffer_multisample)
+#if defined(GL_APPLE_sync)
+GLATTER_IEXTENSION(GL_APPLE_sync)
+GLATTER_IBLOCK(glClientWaitSyncAPPLE)
+GLATTER_IBLOCK(glDeleteSyncAPPLE)
+GLATTER_IBLOCK(glFenceSyncAPPLE)
+GLATTER_IBLOCK(glGetInteger64vAPPLE)
+GLATTER_IBLOCK(glGetSyncivAPPLE)
+GLATTER_IBLOCK(glIsSyncAPPLE)
+GLATTER_IBLOCK(glWaitSyncAPPLE)
+#endif // defined(GL_APPLE_sync)
+#if defined(GL_EXT_debug_marker)
+GLATTER_IEXTENSION(GL_EXT_debug_marker)
+GLATTER_IBLOCK(glInsertEventMarkerEXT)
+GLATTER_IBLOCK(glPopGroupMarkerEXT)
+GLATTER_IBLOCK(glPushGroupMarkerEXT)
+#endif // defined(GL_EXT_debug_marker)
+#if defined(GL_EXT_discard_framebuffer)
+GLATTER_IEXTENSION(GL_EXT_discard_framebuffer)
+GLATTER_IBLOCK(glDiscardFramebufferEXT)
+#endif // defined(GL_EXT_discard_framebuffer)
+#if defined(GL_EXT_map_buffer_range)
+GLATTER_IEXTENSION(GL_EXT_map_buffer_range)
+GLATTER_IBLOCK(glFlushMappedBufferRangeEXT)
+GLATTER_IBLOCK(glMapBufferRangeEXT)
+#endif // defined(GL_EXT_map_buffer_range)
+#if defined(GL_EXT_multi_draw_arrays)
+GLATTER_IEXTENSION(GL_EXT_multi_draw_arrays)
+GLATTER_IBLOCK(glMultiDrawArraysEXT)
+GLATTER_IBLOCK(glMultiDrawElementsEXT)
+#endif // defined(GL_EXT_multi_draw_arrays)
+#if defined(GL_EXT_multisampled_render_to_texture)
+GLATTER_IEXTENSION(GL_EXT_multisampled_render_to_texture)
+GLATTER_IBLOCK(glFramebufferTexture2DMultisampleEXT)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleEXT)
+#endif // defined(GL_EXT_multisampled_render_to_texture)
+#if defined(GL_EXT_robustness)
+GLATTER_IEXTENSION(GL_EXT_robustness)
+GLATTER_IBLOCK(glGetGraphicsResetStatusEXT)
+GLATTER_IBLOCK(glGetnUniformfvEXT)
+GLATTER_IBLOCK(glGetnUniformivEXT)
+GLATTER_IBLOCK(glReadnPixelsEXT)
+#endif // defined(GL_EXT_robustness)
+#if defined(GL_EXT_texture_storage)
+GLATTER_IEXTENSION(GL_EXT_texture_storage)
+GLATTER_IBLOCK(glTexStorage1DEXT)
+GLATTER_IBLOCK(glTexStorage2DEXT)
+GLATTER_IBLOCK(glTexStorage3DEXT)
+GLATTER_IBLOCK(glTextureStorage1DEXT)
+GLATTER_IBLOCK(glTextureStorage2DEXT)
+GLATTER_IBLOCK(glTextureStorage3DEXT)
+#endif // defined(GL_EXT_texture_storage)
+#if defined(GL_IMG_multisampled_render_to_texture)
+GLATTER_IEXTENSION(GL_IMG_multisampled_render_to_texture)
+GLATTER_IBLOCK(glFramebufferTexture2DMultisampleIMG)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleIMG)
+#endif // defined(GL_IMG_multisampled_render_to_texture)
+#if defined(GL_IMG_user_clip_plane)
+GLATTER_IEXTENSION(GL_IMG_user_clip_plane)
+GLATTER_IBLOCK(glClipPlanefIMG)
+GLATTER_IBLOCK(glClipPlanexIMG)
+#endif // defined(GL_IMG_user_clip_plane)
+#if defined(GL_NV_fence)
+GLATTER_IEXTENSION(GL_NV_fence)
+GLATTER_IBLOCK(glDeleteFencesNV)
+GLATTER_IBLOCK(glFinishFenceNV)
+GLATTER_IBLOCK(glGenFencesNV)
+GLATTER_IBLOCK(glGetFenceivNV)
+GLATTER_IBLOCK(glIsFenceNV)
+GLATTER_IBLOCK(glSetFenceNV)
+GLATTER_IBLOCK(glTestFenceNV)
+#endif // defined(GL_NV_fence)
+#if defined(GL_OES_EGL_image)
+GLATTER_IEXTENSION(GL_OES_EGL_image)
+GLATTER_IBLOCK(glEGLImageTargetRenderbufferStorageOES)
+GLATTER_IBLOCK(glEGLImageTargetTexture2DOES)
+#endif // defined(GL_OES_EGL_image)
+#if defined(GL_OES_blend_equation_separate)
+GLATTER_IEXTENSION(GL_OES_blend_equation_separate)
+GLATTER_IBLOCK(glBlendEquationSeparateOES)
+#endif // defined(GL_OES_blend_equation_separate)
+#if defined(GL_OES_blend_func_separate)
+GLATTER_IEXTENSION(GL_OES_blend_func_separate)
+GLATTER_IBLOCK(glBlendFuncSeparateOES)
+#endif // defined(GL_OES_blend_func_separate)
+#if defined(GL_OES_blend_subtract)
+GLATTER_IEXTENSION(GL_OES_blend_subtract)
+GLATTER_IBLOCK(glBlendEquationOES)
+#endif // defined(GL_OES_blend_subtract)
+#if defined(GL_OES_draw_texture)
+GLATTER_IEXTENSION(GL_OES_draw_texture)
+GLATTER_IBLOCK(glDrawTexfOES)
+GLATTER_IBLOCK(glDrawTexfvOES)
+GLATTER_IBLOCK(glDrawTexiOES)
+GLATTER_IBLOCK(glDrawTexivOES)
+GLATTER_IBLOCK(glDrawTexsOES)
+GLATTER_IBLOCK(glDrawTexsvOES)
+GLATTER_IBLOCK(glDrawTexxOES)
+GLATTER_IBLOCK(glDrawTexxvOES)
+#endif // defined(GL_OES_draw_texture)
+#if defined(GL_OES_fixed_point)
+GLATTER_IEXTENSION(GL_OES_fixed_point)
+GLATTER_IBLOCK(glAlphaFuncxOES)
+GLATTER_IBLOCK(glClearColorxOES)
+GLATTER_IBLOCK(glClearDepthxOES)
+GLATTER_IBLOCK(glClipPlanexOES)
+GLATTER_IBLOCK(glColor4xOES)
+GLATTER_IBLOCK(glDepthRangexOES)
+GLATTER_IBLOCK(glFogxOES)
+GLATTER_IBLOCK(glFogxvOES)
+GLATTER_IBLOCK(glFrustumxOES)
+GLATTER_IBLOCK(glGetClipPlanexOES)
+GLATTER_IBLOCK(glGetFixedvOES)
+GLATTER_IBLOCK(glGetLightxvOES)
+GLATTER_IBLOCK(glGetMaterialxvOES)
+GLATTER_IBLOCK(glGetTexEnvxvOES)
+GLATTER_IBLOCK(glGetTexGenxvOES)
+GLATTER_IBLOCK(glGetTexParameterxvOES)
+GLATTER_IBLOCK(glLightModelxOES)
+GLATTER_IBLOCK(glLightModelxvOES)
+GLATTER_IBLOCK(glLightxOES)
+GLATTER_IBLOCK(glLightxvOES)
+GLATTER_IBLOCK(glLineWidthxOES)
+GLATTER_IBLOCK(glLoadMatrixxOES)
+GLATTER_IBLOCK(glMaterialxOES)
+GLATTER_IBLOCK(glMaterialxvOES)
+GLATTER_IBLOCK(glMultMatrixxOES)
+GLATTER_IBLOCK(glMultiTexCoord4xOES)
+GLATTER_IBLOCK(glNormal3xOES)
+GLATTER_IBLOCK(glOrthoxOES)
+GLATTER_IBLOCK(glPointParameterxOES)
+GLATTER_IBLOCK(glPointParameterxvOES)
+GLATTER_IBLOCK(glPointSizexOES)
+GLATTER_IBLOCK(glPolygonOffsetxOES)
+GLATTER_IBLOCK(glRotatexOES)
+GLATTER_IBLOCK(glSampleCoveragexOES)
+GLATTER_IBLOCK(glScalexOES)
+GLATTER_IBLOCK(glTexEnvxOES)
+GLATTER_IBLOCK(glTexEnvxvOES)
+GLATTER_IBLOCK(glTexGenxOES)
+GLATTER_IBLOCK(glTexGenxvOES)
+GLATTER_IBLOCK(glTexParameterxOES)
+GLATTER_IBLOCK(glTexParameterxvOES)
+GLATTER_IBLOCK(glTranslatexOES)
+#endif // defined(GL_OES_fixed_point)
+#if defined(GL_OES_framebuffer_object)
+GLATTER_IEXTENSION(GL_OES_framebuffer_object)
+GLATTER_IBLOCK(glBindFramebufferOES)
+GLATTER_IBLOCK(glBindRenderbufferOES)
+GLATTER_IBLOCK(glCheckFramebufferStatusOES)
+GLATTER_IBLOCK(glDeleteFramebuffersOES)
+GLATTER_IBLOCK(glDeleteRenderbuffersOES)
+GLATTER_IBLOCK(glFramebufferRenderbufferOES)
+GLATTER_IBLOCK(glFramebufferTexture2DOES)
+GLATTER_IBLOCK(glGenFramebuffersOES)
+GLATTER_IBLOCK(glGenRenderbuffersOES)
+GLATTER_IBLOCK(glGenerateMipmapOES)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameterivOES)
+GLATTER_IBLOCK(glGetRenderbufferParameterivOES)
+GLATTER_IBLOCK(glIsFramebufferOES)
+GLATTER_IBLOCK(glIsRenderbufferOES)
+GLATTER_IBLOCK(glRenderbufferStorageOES)
+#endif // defined(GL_OES_framebuffer_object)
+#if defined(GL_OES_mapbuffer)
+GLATTER_IEXTENSION(GL_OES_mapbuffer)
+GLATTER_IBLOCK(glGetBufferPointervOES)
+GLATTER_IBLOCK(glMapBufferOES)
+GLATTER_IBLOCK(glUnmapBufferOES)
+#endif // defined(GL_OES_mapbuffer)
+#if defined(GL_OES_matrix_palette)
+GLATTER_IEXTENSION(GL_OES_matrix_palette)
+GLATTER_IBLOCK(glCurrentPaletteMatrixOES)
+GLATTER_IBLOCK(glLoadPaletteFromModelViewMatrixOES)
+GLATTER_IBLOCK(glMatrixIndexPointerOES)
+GLATTER_IBLOCK(glWeightPointerOES)
+#endif // defined(GL_OES_matrix_palette)
+#if defined(GL_OES_query_matrix)
+GLATTER_IEXTENSION(GL_OES_query_matrix)
+GLATTER_IBLOCK(glQueryMatrixxOES)
+#endif // defined(GL_OES_query_matrix)
+#if defined(GL_OES_single_precision)
+GLATTER_IEXTENSION(GL_OES_single_precision)
+GLATTER_IBLOCK(glClearDepthfOES)
+GLATTER_IBLOCK(glClipPlanefOES)
+GLATTER_IBLOCK(glDepthRangefOES)
+GLATTER_IBLOCK(glFrustumfOES)
+GLATTER_IBLOCK(glGetClipPlanefOES)
+GLATTER_IBLOCK(glOrthofOES)
+#endif // defined(GL_OES_single_precision)
+#if defined(GL_OES_texture_cube_map)
+GLATTER_IEXTENSION(GL_OES_texture_cube_map)
+GLATTER_IBLOCK(glGetTexGenfvOES)
+GLATTER_IBLOCK(glGetTexGenivOES)
+GLATTER_IBLOCK(glTexGenfOES)
+GLATTER_IBLOCK(glTexGenfvOES)
+GLATTER_IBLOCK(glTexGeniOES)
+GLATTER_IBLOCK(glTexGenivOES)
+#endif // defined(GL_OES_texture_cube_map)
+#if defined(GL_OES_vertex_array_object)
+GLATTER_IEXTENSION(GL_OES_vertex_array_object)
+GLATTER_IBLOCK(glBindVertexArrayOES)
+GLATTER_IBLOCK(glDeleteVertexArraysOES)
+GLATTER_IBLOCK(glGenVertexArraysOES)
+GLATTER_IBLOCK(glIsVertexArrayOES)
+#endif // defined(GL_OES_vertex_array_object)
+#if defined(GL_QCOM_driver_control)
+GLATTER_IEXTENSION(GL_QCOM_driver_control)
+GLATTER_IBLOCK(glDisableDriverControlQCOM)
+GLATTER_IBLOCK(glEnableDriverControlQCOM)
+GLATTER_IBLOCK(glGetDriverControlStringQCOM)
+GLATTER_IBLOCK(glGetDriverControlsQCOM)
+#endif // defined(GL_QCOM_driver_control)
+#if defined(GL_QCOM_extended_get)
+GLATTER_IEXTENSION(GL_QCOM_extended_get)
+GLATTER_IBLOCK(glExtGetBufferPointervQCOM)
+GLATTER_IBLOCK(glExtGetBuffersQCOM)
+GLATTER_IBLOCK(glExtGetFramebuffersQCOM)
+GLATTER_IBLOCK(glExtGetRenderbuffersQCOM)
+GLATTER_IBLOCK(glExtGetTexLevelParameterivQCOM)
+GLATTER_IBLOCK(glExtGetTexSubImageQCOM)
+GLATTER_IBLOCK(glExtGetTexturesQCOM)
+GLATTER_IBLOCK(glExtTexObjectStateOverrideiQCOM)
+#endif // defined(GL_QCOM_extended_get)
+#if defined(GL_QCOM_extended_get2)
+GLATTER_IEXTENSION(GL_QCOM_extended_get2)
+GLATTER_IBLOCK(glExtGetProgramBinarySourceQCOM)
+GLATTER_IBLOCK(glExtGetProgramsQCOM)
+GLATTER_IBLOCK(glExtGetShadersQCOM)
+GLATTER_IBLOCK(glExtIsProgramBinaryQCOM)
+#endif // defined(GL_QCOM_extended_get2)
+#if defined(GL_QCOM_tiled_rendering)
+GLATTER_IEXTENSION(GL_QCOM_tiled_rendering)
+GLATTER_IBLOCK(glEndTilingQCOM)
+GLATTER_IBLOCK(glStartTilingQCOM)
+#endif // defined(GL_QCOM_tiled_rendering)
+#endif // defined(__gles1_glext_h_)
+#if defined(__gles2_gl2_h_)
+#if defined(GL_ES_VERSION_2_0)
+GLATTER_IVERSION(2, 0)
+GLATTER_IBLOCK(glActiveTexture)
+GLATTER_IBLOCK(glAttachShader)
+GLATTER_IBLOCK(glBindAttribLocation)
+GLATTER_IBLOCK(glBindBuffer)
+GLATTER_IBLOCK(glBindFramebuffer)
+GLATTER_IBLOCK(glBindRenderbuffer)
+GLATTER_IBLOCK(glBindTexture)
+GLATTER_IBLOCK(glBlendColor)
+GLATTER_IBLOCK(glBlendEquation)
+GLATTER_IBLOCK(glBlendEquationSeparate)
+GLATTER_IBLOCK(glBlendFunc)
+GLATTER_IBLOCK(glBlendFuncSeparate)
+GLATTER_IBLOCK(glBufferData)
+GLATTER_IBLOCK(glBufferSubData)
+GLATTER_IBLOCK(glCheckFramebufferStatus)
+GLATTER_IBLOCK(glClear)
+GLATTER_IBLOCK(glClearColor)
+GLATTER_IBLOCK(glClearDepthf)
+GLATTER_IBLOCK(glClearStencil)
+GLATTER_IBLOCK(glColorMask)
+GLATTER_IBLOCK(glCompileShader)
+GLATTER_IBLOCK(glCompressedTexImage2D)
+GLATTER_IBLOCK(glCompressedTexSubImage2D)
+GLATTER_IBLOCK(glCopyTexImage2D)
+GLATTER_IBLOCK(glCopyTexSubImage2D)
+GLATTER_IBLOCK(glCreateProgram)
+GLATTER_IBLOCK(glCreateShader)
+GLATTER_IBLOCK(glCullFace)
+GLATTER_IBLOCK(glDeleteBuffers)
+GLATTER_IBLOCK(glDeleteFramebuffers)
+GLATTER_IBLOCK(glDeleteProgram)
+GLATTER_IBLOCK(glDeleteRenderbuffers)
+GLATTER_IBLOCK(glDeleteShader)
+GLATTER_IBLOCK(glDeleteTextures)
+GLATTER_IBLOCK(glDepthFunc)
+GLATTER_IBLOCK(glDepthMask)
+GLATTER_IBLOCK(glDepthRangef)
+GLATTER_IBLOCK(glDetachShader)
+GLATTER_IBLOCK(glDisable)
+GLATTER_IBLOCK(glDisableVertexAttribArray)
+GLATTER_IBLOCK(glDrawArrays)
+GLATTER_IBLOCK(glDrawElements)
+GLATTER_IBLOCK(glEnable)
+GLATTER_IBLOCK(glEnableVertexAttribArray)
+GLATTER_IBLOCK(glFinish)
+GLATTER_IBLOCK(glFlush)
+GLATTER_IBLOCK(glFramebufferRenderbuffer)
+GLATTER_IBLOCK(glFramebufferTexture2D)
+GLATTER_IBLOCK(glFrontFace)
+GLATTER_IBLOCK(glGenBuffers)
+GLATTER_IBLOCK(glGenFramebuffers)
+GLATTER_IBLOCK(glGenRenderbuffers)
+GLATTER_IBLOCK(glGenTextures)
+GLATTER_IBLOCK(glGenerateMipmap)
+GLATTER_IBLOCK(glGetActiveAttrib)
+GLATTER_IBLOCK(glGetActiveUniform)
+GLATTER_IBLOCK(glGetAttachedShaders)
+GLATTER_IBLOCK(glGetAttribLocation)
+GLATTER_IBLOCK(glGetBooleanv)
+GLATTER_IBLOCK(glGetBufferParameteriv)
+GLATTER_IBLOCK(glGetError)
+GLATTER_IBLOCK(glGetFloatv)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameteriv)
+GLATTER_IBLOCK(glGetIntegerv)
+GLATTER_IBLOCK(glGetProgramInfoLog)
+GLATTER_IBLOCK(glGetProgramiv)
+GLATTER_IBLOCK(glGetRenderbufferParameteriv)
+GLATTER_IBLOCK(glGetShaderInfoLog)
+GLATTER_IBLOCK(glGetShaderPrecisionFormat)
+GLATTER_IBLOCK(glGetShaderSource)
+GLATTER_IBLOCK(glGetShaderiv)
+GLATTER_IBLOCK(glGetString)
+GLATTER_IBLOCK(glGetTexParameterfv)
+GLATTER_IBLOCK(glGetTexParameteriv)
+GLATTER_IBLOCK(glGetUniformLocation)
+GLATTER_IBLOCK(glGetUniformfv)
+GLATTER_IBLOCK(glGetUniformiv)
+GLATTER_IBLOCK(glGetVertexAttribPointerv)
+GLATTER_IBLOCK(glGetVertexAttribfv)
+GLATTER_IBLOCK(glGetVertexAttribiv)
+GLATTER_IBLOCK(glHint)
+GLATTER_IBLOCK(glIsBuffer)
+GLATTER_IBLOCK(glIsEnabled)
+GLATTER_IBLOCK(glIsFramebuffer)
+GLATTER_IBLOCK(glIsProgram)
+GLATTER_IBLOCK(glIsRenderbuffer)
+GLATTER_IBLOCK(glIsShader)
+GLATTER_IBLOCK(glIsTexture)
+GLATTER_IBLOCK(glLineWidth)
+GLATTER_IBLOCK(glLinkProgram)
+GLATTER_IBLOCK(glPixelStorei)
+GLATTER_IBLOCK(glPolygonOffset)
+GLATTER_IBLOCK(glReadPixels)
+GLATTER_IBLOCK(glReleaseShaderCompiler)
+GLATTER_IBLOCK(glRenderbufferStorage)
+GLATTER_IBLOCK(glSampleCoverage)
+GLATTER_IBLOCK(glScissor)
+GLATTER_IBLOCK(glShaderBinary)
+GLATTER_IBLOCK(glShaderSource)
+GLATTER_IBLOCK(glStencilFunc)
+GLATTER_IBLOCK(glStencilFuncSeparate)
+GLATTER_IBLOCK(glStencilMask)
+GLATTER_IBLOCK(glStencilMaskSeparate)
+GLATTER_IBLOCK(glStencilOp)
+GLATTER_IBLOCK(glStencilOpSeparate)
+GLATTER_IBLOCK(glTexImage2D)
+GLATTER_IBLOCK(glTexParameterf)
+GLATTER_IBLOCK(glTexParameterfv)
+GLATTER_IBLOCK(glTexParameteri)
+GLATTER_IBLOCK(glTexParameteriv)
+GLATTER_IBLOCK(glTexSubImage2D)
+GLATTER_IBLOCK(glUniform1f)
+GLATTER_IBLOCK(glUniform1fv)
+GLATTER_IBLOCK(glUniform1i)
+GLATTER_IBLOCK(glUniform1iv)
+GLATTER_IBLOCK(glUniform2f)
+GLATTER_IBLOCK(glUniform2fv)
+GLATTER_IBLOCK(glUniform2i)
+GLATTER_IBLOCK(glUniform2iv)
+GLATTER_IBLOCK(glUniform3f)
+GLATTER_IBLOCK(glUniform3fv)
+GLATTER_IBLOCK(glUniform3i)
+GLATTER_IBLOCK(glUniform3iv)
+GLATTER_IBLOCK(glUniform4f)
+GLATTER_IBLOCK(glUniform4fv)
+GLATTER_IBLOCK(glUniform4i)
+GLATTER_IBLOCK(glUniform4iv)
+GLATTER_IBLOCK(glUniformMatrix2fv)
+GLATTER_IBLOCK(glUniformMatrix3fv)
+GLATTER_IBLOCK(glUniformMatrix4fv)
+GLATTER_IBLOCK(glUseProgram)
+GLATTER_IBLOCK(glValidateProgram)
+GLATTER_IBLOCK(glVertexAttrib1f)
+GLATTER_IBLOCK(glVertexAttrib1fv)
+GLATTER_IBLOCK(glVertexAttrib2f)
+GLATTER_IBLOCK(glVertexAttrib2fv)
+GLATTER_IBLOCK(glVertexAttrib3f)
+GLATTER_IBLOCK(glVertexAttrib3fv)
+GLATTER_IBLOCK(glVertexAttrib4f)
+GLATTER_IBLOCK(glVertexAttrib4fv)
+GLATTER_IBLOCK(glVertexAttribPointer)
+GLATTER_IBLOCK(glViewport)
+#endif // defined(GL_ES_VERSION_2_0)
+#endif // defined(__gles2_gl2_h_)
+#if defined(__gles2_gl2ext_h_)
+#if defined(GL_AMD_framebuffer_multisample_advanced)
+GLATTER_IEXTENSION(GL_AMD_framebuffer_multisample_advanced)
+GLATTER_IBLOCK(glNamedRenderbufferStorageMultisampleAdvancedAMD)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleAdvancedAMD)
+#endif // defined(GL_AMD_framebuffer_multisample_advanced)
+#if defined(GL_AMD_performance_monitor)
+GLATTER_IEXTENSION(GL_AMD_performance_monitor)
+GLATTER_IBLOCK(glBeginPerfMonitorAMD)
+GLATTER_IBLOCK(glDeletePerfMonitorsAMD)
+GLATTER_IBLOCK(glEndPerfMonitorAMD)
+GLATTER_IBLOCK(glGenPerfMonitorsAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCounterDataAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCounterInfoAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCounterStringAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCountersAMD)
+GLATTER_IBLOCK(glGetPerfMonitorGroupStringAMD)
+GLATTER_IBLOCK(glGetPerfMonitorGroupsAMD)
+GLATTER_IBLOCK(glSelectPerfMonitorCountersAMD)
+#endif // defined(GL_AMD_performance_monitor)
+#if defined(GL_ANGLE_framebuffer_blit)
+GLATTER_IEXTENSION(GL_ANGLE_framebuffer_blit)
+GLATTER_IBLOCK(glBlitFramebufferANGLE)
+#endif // defined(GL_ANGLE_framebuffer_blit)
+#if defined(GL_ANGLE_framebuffer_multisample)
+GLATTER_IEXTENSION(GL_ANGLE_framebuffer_multisample)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleANGLE)
+#endif // defined(GL_ANGLE_framebuffer_multisample)
+#if defined(GL_ANGLE_instanced_arrays)
+GLATTER_IEXTENSION(GL_ANGLE_instanced_arrays)
+GLATTER_IBLOCK(glDrawArraysInstancedANGLE)
+GLATTER_IBLOCK(glDrawElementsInstancedANGLE)
+GLATTER_IBLOCK(glVertexAttribDivisorANGLE)
+#endif // defined(GL_ANGLE_instanced_arrays)
+#if defined(GL_ANGLE_translated_shader_source)
+GLATTER_IEXTENSION(GL_ANGLE_translated_shader_source)
+GLATTER_IBLOCK(glGetTranslatedShaderSourceANGLE)
+#endif // defined(GL_ANGLE_translated_shader_source)
+#if defined(GL_APPLE_copy_texture_levels)
+GLATTER_IEXTENSION(GL_APPLE_copy_texture_levels)
+GLATTER_IBLOCK(glCopyTextureLevelsAPPLE)
+#endif // defined(GL_APPLE_copy_texture_levels)
+#if defined(GL_APPLE_framebuffer_multisample)
+GLATTER_IEXTENSION(GL_APPLE_framebuffer_multisample)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleAPPLE)
+GLATTER_IBLOCK(glResolveMultisampleFramebufferAPPLE)
+#endif // defined(GL_APPLE_framebuffer_multisample)
+#if defined(GL_APPLE_sync)
+GLATTER_IEXTENSION(GL_APPLE_sync)
+GLATTER_IBLOCK(glClientWaitSyncAPPLE)
+GLATTER_IBLOCK(glDeleteSyncAPPLE)
+GLATTER_IBLOCK(glFenceSyncAPPLE)
+GLATTER_IBLOCK(glGetInteger64vAPPLE)
+GLATTER_IBLOCK(glGetSyncivAPPLE)
+GLATTER_IBLOCK(glIsSyncAPPLE)
+GLATTER_IBLOCK(glWaitSyncAPPLE)
+#endif // defined(GL_APPLE_sync)
+#if defined(GL_ARM_shader_core_properties)
+GLATTER_IEXTENSION(GL_ARM_shader_core_properties)
+GLATTER_IBLOCK(glMaxActiveShaderCoresARM)
+#endif // defined(GL_ARM_shader_core_properties)
+#if defined(GL_EXT_EGL_image_storage)
+GLATTER_IEXTENSION(GL_EXT_EGL_image_storage)
+GLATTER_IBLOCK(glEGLImageTargetTexStorageEXT)
+GLATTER_IBLOCK(glEGLImageTargetTextureStorageEXT)
+#endif // defined(GL_EXT_EGL_image_storage)
+#if defined(GL_EXT_base_instance)
+GLATTER_IEXTENSION(GL_EXT_base_instance)
+GLATTER_IBLOCK(glDrawArraysInstancedBaseInstanceEXT)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseInstanceEXT)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseVertexBaseInstanceEXT)
+#endif // defined(GL_EXT_base_instance)
+#if defined(GL_EXT_blend_func_extended)
+GLATTER_IEXTENSION(GL_EXT_blend_func_extended)
+GLATTER_IBLOCK(glBindFragDataLocationEXT)
+GLATTER_IBLOCK(glBindFragDataLocationIndexedEXT)
+GLATTER_IBLOCK(glGetFragDataIndexEXT)
+GLATTER_IBLOCK(glGetProgramResourceLocationIndexEXT)
+#endif // defined(GL_EXT_blend_func_extended)
+#if defined(GL_EXT_buffer_storage)
+GLATTER_IEXTENSION(GL_EXT_buffer_storage)
+GLATTER_IBLOCK(glBufferStorageEXT)
+#endif // defined(GL_EXT_buffer_storage)
+#if defined(GL_EXT_clear_texture)
+GLATTER_IEXTENSION(GL_EXT_clear_texture)
+GLATTER_IBLOCK(glClearTexImageEXT)
+GLATTER_IBLOCK(glClearTexSubImageEXT)
+#endif // defined(GL_EXT_clear_texture)
+#if defined(GL_EXT_clip_control)
+GLATTER_IEXTENSION(GL_EXT_clip_control)
+GLATTER_IBLOCK(glClipControlEXT)
+#endif // defined(GL_EXT_clip_control)
+#if defined(GL_EXT_copy_image)
+GLATTER_IEXTENSION(GL_EXT_copy_image)
+GLATTER_IBLOCK(glCopyImageSubDataEXT)
+#endif // defined(GL_EXT_copy_image)
+#if defined(GL_EXT_debug_label)
+GLATTER_IEXTENSION(GL_EXT_debug_label)
+GLATTER_IBLOCK(glGetObjectLabelEXT)
+GLATTER_IBLOCK(glLabelObjectEXT)
+#endif // defined(GL_EXT_debug_label)
+#if defined(GL_EXT_debug_marker)
+GLATTER_IEXTENSION(GL_EXT_debug_marker)
+GLATTER_IBLOCK(glInsertEventMarkerEXT)
+GLATTER_IBLOCK(glPopGroupMarkerEXT)
+GLATTER_IBLOCK(glPushGroupMarkerEXT)
+#endif // defined(GL_EXT_debug_marker)
+#if defined(GL_EXT_discard_framebuffer)
+GLATTER_IEXTENSION(GL_EXT_discard_framebuffer)
+GLATTER_IBLOCK(glDiscardFramebufferEXT)
+#endif // defined(GL_EXT_discard_framebuffer)
+#if defined(GL_EXT_disjoint_timer_query)
+GLATTER_IEXTENSION(GL_EXT_disjoint_timer_query)
+GLATTER_IBLOCK(glBeginQueryEXT)
+GLATTER_IBLOCK(glDeleteQueriesEXT)
+GLATTER_IBLOCK(glEndQueryEXT)
+GLATTER_IBLOCK(glGenQueriesEXT)
+GLATTER_IBLOCK(glGetInteger64vEXT)
+GLATTER_IBLOCK(glGetQueryObjecti64vEXT)
+GLATTER_IBLOCK(glGetQueryObjectivEXT)
+GLATTER_IBLOCK(glGetQueryObjectui64vEXT)
+GLATTER_IBLOCK(glGetQueryObjectuivEXT)
+GLATTER_IBLOCK(glGetQueryivEXT)
+GLATTER_IBLOCK(glIsQueryEXT)
+GLATTER_IBLOCK(glQueryCounterEXT)
+#endif // defined(GL_EXT_disjoint_timer_query)
+#if defined(GL_EXT_draw_buffers)
+GLATTER_IEXTENSION(GL_EXT_draw_buffers)
+GLATTER_IBLOCK(glDrawBuffersEXT)
+#endif // defined(GL_EXT_draw_buffers)
+#if defined(GL_EXT_draw_buffers_indexed)
+GLATTER_IEXTENSION(GL_EXT_draw_buffers_indexed)
+GLATTER_IBLOCK(glBlendEquationSeparateiEXT)
+GLATTER_IBLOCK(glBlendEquationiEXT)
+GLATTER_IBLOCK(glBlendFuncSeparateiEXT)
+GLATTER_IBLOCK(glBlendFunciEXT)
+GLATTER_IBLOCK(glColorMaskiEXT)
+GLATTER_IBLOCK(glDisableiEXT)
+GLATTER_IBLOCK(glEnableiEXT)
+GLATTER_IBLOCK(glIsEnablediEXT)
+#endif // defined(GL_EXT_draw_buffers_indexed)
+#if defined(GL_EXT_draw_elements_base_vertex)
+GLATTER_IEXTENSION(GL_EXT_draw_elements_base_vertex)
+GLATTER_IBLOCK(glDrawElementsBaseVertexEXT)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseVertexEXT)
+GLATTER_IBLOCK(glDrawRangeElementsBaseVertexEXT)
+#endif // defined(GL_EXT_draw_elements_base_vertex)
+#if defined(GL_EXT_draw_instanced)
+GLATTER_IEXTENSION(GL_EXT_draw_instanced)
+GLATTER_IBLOCK(glDrawArraysInstancedEXT)
+GLATTER_IBLOCK(glDrawElementsInstancedEXT)
+#endif // defined(GL_EXT_draw_instanced)
+#if defined(GL_EXT_draw_transform_feedback)
+GLATTER_IEXTENSION(GL_EXT_draw_transform_feedback)
+GLATTER_IBLOCK(glDrawTransformFeedbackEXT)
+GLATTER_IBLOCK(glDrawTransformFeedbackInstancedEXT)
+#endif // defined(GL_EXT_draw_transform_feedback)
+#if defined(GL_EXT_external_buffer)
+GLATTER_IEXTENSION(GL_EXT_external_buffer)
+GLATTER_IBLOCK(glBufferStorageExternalEXT)
+GLATTER_IBLOCK(glNamedBufferStorageExternalEXT)
+#endif // defined(GL_EXT_external_buffer)
+#if defined(GL_EXT_fragment_shading_rate)
+GLATTER_IEXTENSION(GL_EXT_fragment_shading_rate)
+GLATTER_IBLOCK(glFramebufferShadingRateEXT)
+GLATTER_IBLOCK(glGetFragmentShadingRatesEXT)
+GLATTER_IBLOCK(glShadingRateCombinerOpsEXT)
+GLATTER_IBLOCK(glShadingRateEXT)
+#endif // defined(GL_EXT_fragment_shading_rate)
+#if defined(GL_EXT_framebuffer_blit_layers)
+GLATTER_IEXTENSION(GL_EXT_framebuffer_blit_layers)
+GLATTER_IBLOCK(glBlitFramebufferLayerEXT)
+GLATTER_IBLOCK(glBlitFramebufferLayersEXT)
+#endif // defined(GL_EXT_framebuffer_blit_layers)
+#if defined(GL_EXT_geometry_shader)
+GLATTER_IEXTENSION(GL_EXT_geometry_shader)
+GLATTER_IBLOCK(glFramebufferTextureEXT)
+#endif // defined(GL_EXT_geometry_shader)
+#if defined(GL_EXT_instanced_arrays)
+GLATTER_IEXTENSION(GL_EXT_instanced_arrays)
+GLATTER_IBLOCK(glVertexAttribDivisorEXT)
+#endif // defined(GL_EXT_instanced_arrays)
+#if defined(GL_EXT_map_buffer_range)
+GLATTER_IEXTENSION(GL_EXT_map_buffer_range)
+GLATTER_IBLOCK(glFlushMappedBufferRangeEXT)
+GLATTER_IBLOCK(glMapBufferRangeEXT)
+#endif // defined(GL_EXT_map_buffer_range)
+#if defined(GL_EXT_memory_object)
+GLATTER_IEXTENSION(GL_EXT_memory_object)
+GLATTER_IBLOCK(glBufferStorageMemEXT)
+GLATTER_IBLOCK(glCreateMemoryObjectsEXT)
+GLATTER_IBLOCK(glDeleteMemoryObjectsEXT)
+GLATTER_IBLOCK(glGetMemoryObjectParameterivEXT)
+GLATTER_IBLOCK(glGetUnsignedBytei_vEXT)
+GLATTER_IBLOCK(glGetUnsignedBytevEXT)
+GLATTER_IBLOCK(glIsMemoryObjectEXT)
+GLATTER_IBLOCK(glMemoryObjectParameterivEXT)
+GLATTER_IBLOCK(glNamedBufferStorageMemEXT)
+GLATTER_IBLOCK(glTexStorageMem2DEXT)
+GLATTER_IBLOCK(glTexStorageMem2DMultisampleEXT)
+GLATTER_IBLOCK(glTexStorageMem3DEXT)
+GLATTER_IBLOCK(glTexStorageMem3DMultisampleEXT)
+GLATTER_IBLOCK(glTextureStorageMem2DEXT)
+GLATTER_IBLOCK(glTextureStorageMem2DMultisampleEXT)
+GLATTER_IBLOCK(glTextureStorageMem3DEXT)
+GLATTER_IBLOCK(glTextureStorageMem3DMultisampleEXT)
+#endif // defined(GL_EXT_memory_object)
+#if defined(GL_EXT_memory_object_fd)
+GLATTER_IEXTENSION(GL_EXT_memory_object_fd)
+GLATTER_IBLOCK(glImportMemoryFdEXT)
+#endif // defined(GL_EXT_memory_object_fd)
+#if defined(GL_EXT_memory_object_win32)
+GLATTER_IEXTENSION(GL_EXT_memory_object_win32)
+GLATTER_IBLOCK(glImportMemoryWin32HandleEXT)
+GLATTER_IBLOCK(glImportMemoryWin32NameEXT)
+#endif // defined(GL_EXT_memory_object_win32)
+#if defined(GL_EXT_mesh_shader)
+GLATTER_IEXTENSION(GL_EXT_mesh_shader)
+GLATTER_IBLOCK(glDrawMeshTasksEXT)
+GLATTER_IBLOCK(glDrawMeshTasksIndirectEXT)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectCountEXT)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectEXT)
+#endif // defined(GL_EXT_mesh_shader)
+#if defined(GL_EXT_multi_draw_arrays)
+GLATTER_IEXTENSION(GL_EXT_multi_draw_arrays)
+GLATTER_IBLOCK(glMultiDrawArraysEXT)
+GLATTER_IBLOCK(glMultiDrawElementsEXT)
+#endif // defined(GL_EXT_multi_draw_arrays)
+#if defined(GL_EXT_multi_draw_indirect)
+GLATTER_IEXTENSION(GL_EXT_multi_draw_indirect)
+GLATTER_IBLOCK(glMultiDrawArraysIndirectEXT)
+GLATTER_IBLOCK(glMultiDrawElementsIndirectEXT)
+#endif // defined(GL_EXT_multi_draw_indirect)
+#if defined(GL_EXT_multisampled_render_to_texture)
+GLATTER_IEXTENSION(GL_EXT_multisampled_render_to_texture)
+GLATTER_IBLOCK(glFramebufferTexture2DMultisampleEXT)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleEXT)
+#endif // defined(GL_EXT_multisampled_render_to_texture)
+#if defined(GL_EXT_multiview_draw_buffers)
+GLATTER_IEXTENSION(GL_EXT_multiview_draw_buffers)
+GLATTER_IBLOCK(glDrawBuffersIndexedEXT)
+GLATTER_IBLOCK(glGetIntegeri_vEXT)
+GLATTER_IBLOCK(glReadBufferIndexedEXT)
+#endif // defined(GL_EXT_multiview_draw_buffers)
+#if defined(GL_EXT_polygon_offset_clamp)
+GLATTER_IEXTENSION(GL_EXT_polygon_offset_clamp)
+GLATTER_IBLOCK(glPolygonOffsetClampEXT)
+#endif // defined(GL_EXT_polygon_offset_clamp)
+#if defined(GL_EXT_primitive_bounding_box)
+GLATTER_IEXTENSION(GL_EXT_primitive_bounding_box)
+GLATTER_IBLOCK(glPrimitiveBoundingBoxEXT)
+#endif // defined(GL_EXT_primitive_bounding_box)
+#if defined(GL_EXT_raster_multisample)
+GLATTER_IEXTENSION(GL_EXT_raster_multisample)
+GLATTER_IBLOCK(glRasterSamplesEXT)
+#endif // defined(GL_EXT_raster_multisample)
+#if defined(GL_EXT_robustness)
+GLATTER_IEXTENSION(GL_EXT_robustness)
+GLATTER_IBLOCK(glGetGraphicsResetStatusEXT)
+GLATTER_IBLOCK(glGetnUniformfvEXT)
+GLATTER_IBLOCK(glGetnUniformivEXT)
+GLATTER_IBLOCK(glReadnPixelsEXT)
+#endif // defined(GL_EXT_robustness)
+#if defined(GL_EXT_semaphore)
+GLATTER_IEXTENSION(GL_EXT_semaphore)
+GLATTER_IBLOCK(glDeleteSemaphoresEXT)
+GLATTER_IBLOCK(glGenSemaphoresEXT)
+GLATTER_IBLOCK(glGetSemaphoreParameterui64vEXT)
+GLATTER_IBLOCK(glIsSemaphoreEXT)
+GLATTER_IBLOCK(glSemaphoreParameterui64vEXT)
+GLATTER_IBLOCK(glSignalSemaphoreEXT)
+GLATTER_IBLOCK(glWaitSemaphoreEXT)
+#endif // defined(GL_EXT_semaphore)
+#if defined(GL_EXT_semaphore_fd)
+GLATTER_IEXTENSION(GL_EXT_semaphore_fd)
+GLATTER_IBLOCK(glImportSemaphoreFdEXT)
+#endif // defined(GL_EXT_semaphore_fd)
+#if defined(GL_EXT_semaphore_win32)
+GLATTER_IEXTENSION(GL_EXT_semaphore_win32)
+GLATTER_IBLOCK(glImportSemaphoreWin32HandleEXT)
+GLATTER_IBLOCK(glImportSemaphoreWin32NameEXT)
+#endif // defined(GL_EXT_semaphore_win32)
+#if defined(GL_EXT_separate_shader_objects)
+GLATTER_IEXTENSION(GL_EXT_separate_shader_objects)
+GLATTER_IBLOCK(glActiveShaderProgramEXT)
+GLATTER_IBLOCK(glBindProgramPipelineEXT)
+GLATTER_IBLOCK(glCreateShaderProgramvEXT)
+GLATTER_IBLOCK(glDeleteProgramPipelinesEXT)
+GLATTER_IBLOCK(glGenProgramPipelinesEXT)
+GLATTER_IBLOCK(glGetProgramPipelineInfoLogEXT)
+GLATTER_IBLOCK(glGetProgramPipelineivEXT)
+GLATTER_IBLOCK(glIsProgramPipelineEXT)
+GLATTER_IBLOCK(glProgramParameteriEXT)
+GLATTER_IBLOCK(glProgramUniform1fEXT)
+GLATTER_IBLOCK(glProgramUniform1fvEXT)
+GLATTER_IBLOCK(glProgramUniform1iEXT)
+GLATTER_IBLOCK(glProgramUniform1ivEXT)
+GLATTER_IBLOCK(glProgramUniform1uiEXT)
+GLATTER_IBLOCK(glProgramUniform1uivEXT)
+GLATTER_IBLOCK(glProgramUniform2fEXT)
+GLATTER_IBLOCK(glProgramUniform2fvEXT)
+GLATTER_IBLOCK(glProgramUniform2iEXT)
+GLATTER_IBLOCK(glProgramUniform2ivEXT)
+GLATTER_IBLOCK(glProgramUniform2uiEXT)
+GLATTER_IBLOCK(glProgramUniform2uivEXT)
+GLATTER_IBLOCK(glProgramUniform3fEXT)
+GLATTER_IBLOCK(glProgramUniform3fvEXT)
+GLATTER_IBLOCK(glProgramUniform3iEXT)
+GLATTER_IBLOCK(glProgramUniform3ivEXT)
+GLATTER_IBLOCK(glProgramUniform3uiEXT)
+GLATTER_IBLOCK(glProgramUniform3uivEXT)
+GLATTER_IBLOCK(glProgramUniform4fEXT)
+GLATTER_IBLOCK(glProgramUniform4fvEXT)
+GLATTER_IBLOCK(glProgramUniform4iEXT)
+GLATTER_IBLOCK(glProgramUniform4ivEXT)
+GLATTER_IBLOCK(glProgramUniform4uiEXT)
+GLATTER_IBLOCK(glProgramUniform4uivEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3fvEXT)
+GLATTER_IBLOCK(glUseProgramStagesEXT)
+GLATTER_IBLOCK(glValidateProgramPipelineEXT)
+#endif // defined(GL_EXT_separate_shader_objects)
+#if defined(GL_EXT_shader_framebuffer_fetch_non_coherent)
+GLATTER_IEXTENSION(GL_EXT_shader_framebuffer_fetch_non_coherent)
+GLATTER_IBLOCK(glFramebufferFetchBarrierEXT)
+#endif // defined(GL_EXT_shader_framebuffer_fetch_non_coherent)
+#if defined(GL_EXT_shader_pixel_local_storage2)
+GLATTER_IEXTENSION(GL_EXT_shader_pixel_local_storage2)
+GLATTER_IBLOCK(glClearPixelLocalStorageuiEXT)
+GLATTER_IBLOCK(glFramebufferPixelLocalStorageSizeEXT)
+GLATTER_IBLOCK(glGetFramebufferPixelLocalStorageSizeEXT)
+#endif // defined(GL_EXT_shader_pixel_local_storage2)
+#if defined(GL_EXT_sparse_texture)
+GLATTER_IEXTENSION(GL_EXT_sparse_texture)
+GLATTER_IBLOCK(glTexPageCommitmentEXT)
+#endif // defined(GL_EXT_sparse_texture)
+#if defined(GL_EXT_tessellation_shader)
+GLATTER_IEXTENSION(GL_EXT_tessellation_shader)
+GLATTER_IBLOCK(glPatchParameteriEXT)
+#endif // defined(GL_EXT_tessellation_shader)
+#if defined(GL_EXT_texture_border_clamp)
+GLATTER_IEXTENSION(GL_EXT_texture_border_clamp)
+GLATTER_IBLOCK(glGetSamplerParameterIivEXT)
+GLATTER_IBLOCK(glGetSamplerParameterIuivEXT)
+GLATTER_IBLOCK(glGetTexParameterIivEXT)
+GLATTER_IBLOCK(glGetTexParameterIuivEXT)
+GLATTER_IBLOCK(glSamplerParameterIivEXT)
+GLATTER_IBLOCK(glSamplerParameterIuivEXT)
+GLATTER_IBLOCK(glTexParameterIivEXT)
+GLATTER_IBLOCK(glTexParameterIuivEXT)
+#endif // defined(GL_EXT_texture_border_clamp)
+#if defined(GL_EXT_texture_buffer)
+GLATTER_IEXTENSION(GL_EXT_texture_buffer)
+GLATTER_IBLOCK(glTexBufferEXT)
+GLATTER_IBLOCK(glTexBufferRangeEXT)
+#endif // defined(GL_EXT_texture_buffer)
+#if defined(GL_EXT_texture_storage)
+GLATTER_IEXTENSION(GL_EXT_texture_storage)
+GLATTER_IBLOCK(glTexStorage1DEXT)
+GLATTER_IBLOCK(glTexStorage2DEXT)
+GLATTER_IBLOCK(glTexStorage3DEXT)
+GLATTER_IBLOCK(glTextureStorage1DEXT)
+GLATTER_IBLOCK(glTextureStorage2DEXT)
+GLATTER_IBLOCK(glTextureStorage3DEXT)
+#endif // defined(GL_EXT_texture_storage)
+#if defined(GL_EXT_texture_storage_compression)
+GLATTER_IEXTENSION(GL_EXT_texture_storage_compression)
+GLATTER_IBLOCK(glTexStorageAttribs2DEXT)
+GLATTER_IBLOCK(glTexStorageAttribs3DEXT)
+#endif // defined(GL_EXT_texture_storage_compression)
+#if defined(GL_EXT_texture_view)
+GLATTER_IEXTENSION(GL_EXT_texture_view)
+GLATTER_IBLOCK(glTextureViewEXT)
+#endif // defined(GL_EXT_texture_view)
+#if defined(GL_EXT_win32_keyed_mutex)
+GLATTER_IEXTENSION(GL_EXT_win32_keyed_mutex)
+GLATTER_IBLOCK(glAcquireKeyedMutexWin32EXT)
+GLATTER_IBLOCK(glReleaseKeyedMutexWin32EXT)
+#endif // defined(GL_EXT_win32_keyed_mutex)
+#if defined(GL_EXT_window_rectangles)
+GLATTER_IEXTENSION(GL_EXT_window_rectangles)
+GLATTER_IBLOCK(glWindowRectanglesEXT)
+#endif // defined(GL_EXT_window_rectangles)
+#if defined(GL_IMG_bindless_texture)
+GLATTER_IEXTENSION(GL_IMG_bindless_texture)
+GLATTER_IBLOCK(glGetTextureHandleIMG)
+GLATTER_IBLOCK(glGetTextureSamplerHandleIMG)
+GLATTER_IBLOCK(glProgramUniformHandleui64IMG)
+GLATTER_IBLOCK(glProgramUniformHandleui64vIMG)
+GLATTER_IBLOCK(glUniformHandleui64IMG)
+GLATTER_IBLOCK(glUniformHandleui64vIMG)
+#endif // defined(GL_IMG_bindless_texture)
+#if defined(GL_IMG_framebuffer_downsample)
+GLATTER_IEXTENSION(GL_IMG_framebuffer_downsample)
+GLATTER_IBLOCK(glFramebufferTexture2DDownsampleIMG)
+GLATTER_IBLOCK(glFramebufferTextureLayerDownsampleIMG)
+#endif // defined(GL_IMG_framebuffer_downsample)
+#if defined(GL_IMG_multisampled_render_to_texture)
+GLATTER_IEXTENSION(GL_IMG_multisampled_render_to_texture)
+GLATTER_IBLOCK(glFramebufferTexture2DMultisampleIMG)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleIMG)
+#endif // defined(GL_IMG_multisampled_render_to_texture)
+#if defined(GL_INTEL_framebuffer_CMAA)
+GLATTER_IEXTENSION(GL_INTEL_framebuffer_CMAA)
+GLATTER_IBLOCK(glApplyFramebufferAttachmentCMAAINTEL)
+#endif // defined(GL_INTEL_framebuffer_CMAA)
+#if defined(GL_INTEL_performance_query)
+GLATTER_IEXTENSION(GL_INTEL_performance_query)
+GLATTER_IBLOCK(glBeginPerfQueryINTEL)
+GLATTER_IBLOCK(glCreatePerfQueryINTEL)
+GLATTER_IBLOCK(glDeletePerfQueryINTEL)
+GLATTER_IBLOCK(glEndPerfQueryINTEL)
+GLATTER_IBLOCK(glGetFirstPerfQueryIdINTEL)
+GLATTER_IBLOCK(glGetNextPerfQueryIdINTEL)
+GLATTER_IBLOCK(glGetPerfCounterInfoINTEL)
+GLATTER_IBLOCK(glGetPerfQueryDataINTEL)
+GLATTER_IBLOCK(glGetPerfQueryIdByNameINTEL)
+GLATTER_IBLOCK(glGetPerfQueryInfoINTEL)
+#endif // defined(GL_INTEL_performance_query)
+#if defined(GL_KHR_blend_equation_advanced)
+GLATTER_IEXTENSION(GL_KHR_blend_equation_advanced)
+GLATTER_IBLOCK(glBlendBarrierKHR)
+#endif // defined(GL_KHR_blend_equation_advanced)
+#if defined(GL_KHR_debug)
+GLATTER_IEXTENSION(GL_KHR_debug)
+GLATTER_IBLOCK(glDebugMessageCallbackKHR)
+GLATTER_IBLOCK(glDebugMessageControlKHR)
+GLATTER_IBLOCK(glDebugMessageInsertKHR)
+GLATTER_IBLOCK(glGetDebugMessageLogKHR)
+GLATTER_IBLOCK(glGetObjectLabelKHR)
+GLATTER_IBLOCK(glGetObjectPtrLabelKHR)
+GLATTER_IBLOCK(glGetPointervKHR)
+GLATTER_IBLOCK(glObjectLabelKHR)
+GLATTER_IBLOCK(glObjectPtrLabelKHR)
+GLATTER_IBLOCK(glPopDebugGroupKHR)
+GLATTER_IBLOCK(glPushDebugGroupKHR)
+#endif // defined(GL_KHR_debug)
+#if defined(GL_KHR_parallel_shader_compile)
+GLATTER_IEXTENSION(GL_KHR_parallel_shader_compile)
+GLATTER_IBLOCK(glMaxShaderCompilerThreadsKHR)
+#endif // defined(GL_KHR_parallel_shader_compile)
+#if defined(GL_KHR_robustness)
+GLATTER_IEXTENSION(GL_KHR_robustness)
+GLATTER_IBLOCK(glGetGraphicsResetStatusKHR)
+GLATTER_IBLOCK(glGetnUniformfvKHR)
+GLATTER_IBLOCK(glGetnUniformivKHR)
+GLATTER_IBLOCK(glGetnUniformuivKHR)
+GLATTER_IBLOCK(glReadnPixelsKHR)
+#endif // defined(GL_KHR_robustness)
+#if defined(GL_MESA_framebuffer_flip_y)
+GLATTER_IEXTENSION(GL_MESA_framebuffer_flip_y)
+GLATTER_IBLOCK(glFramebufferParameteriMESA)
+GLATTER_IBLOCK(glGetFramebufferParameterivMESA)
+#endif // defined(GL_MESA_framebuffer_flip_y)
+#if defined(GL_MESA_sampler_objects)
+GLATTER_IEXTENSION(GL_MESA_sampler_objects)
+GLATTER_IBLOCK(glBindSampler)
+GLATTER_IBLOCK(glDeleteSamplers)
+GLATTER_IBLOCK(glGenSamplers)
+GLATTER_IBLOCK(glGetSamplerParameterfv)
+GLATTER_IBLOCK(glGetSamplerParameteriv)
+GLATTER_IBLOCK(glIsSampler)
+GLATTER_IBLOCK(glSamplerParameterf)
+GLATTER_IBLOCK(glSamplerParameterfv)
+GLATTER_IBLOCK(glSamplerParameteri)
+GLATTER_IBLOCK(glSamplerParameteriv)
+#endif // defined(GL_MESA_sampler_objects)
+#if defined(GL_NV_bindless_texture)
+GLATTER_IEXTENSION(GL_NV_bindless_texture)
+GLATTER_IBLOCK(glGetImageHandleNV)
+GLATTER_IBLOCK(glGetTextureHandleNV)
+GLATTER_IBLOCK(glGetTextureSamplerHandleNV)
+GLATTER_IBLOCK(glIsImageHandleResidentNV)
+GLATTER_IBLOCK(glIsTextureHandleResidentNV)
+GLATTER_IBLOCK(glMakeImageHandleNonResidentNV)
+GLATTER_IBLOCK(glMakeImageHandleResidentNV)
+GLATTER_IBLOCK(glMakeTextureHandleNonResidentNV)
+GLATTER_IBLOCK(glMakeTextureHandleResidentNV)
+GLATTER_IBLOCK(glProgramUniformHandleui64NV)
+GLATTER_IBLOCK(glProgramUniformHandleui64vNV)
+GLATTER_IBLOCK(glUniformHandleui64NV)
+GLATTER_IBLOCK(glUniformHandleui64vNV)
+#endif // defined(GL_NV_bindless_texture)
+#if defined(GL_NV_blend_equation_advanced)
+GLATTER_IEXTENSION(GL_NV_blend_equation_advanced)
+GLATTER_IBLOCK(glBlendBarrierNV)
+GLATTER_IBLOCK(glBlendParameteriNV)
+#endif // defined(GL_NV_blend_equation_advanced)
+#if defined(GL_NV_clip_space_w_scaling)
+GLATTER_IEXTENSION(GL_NV_clip_space_w_scaling)
+GLATTER_IBLOCK(glViewportPositionWScaleNV)
+#endif // defined(GL_NV_clip_space_w_scaling)
+#if defined(GL_NV_conditional_render)
+GLATTER_IEXTENSION(GL_NV_conditional_render)
+GLATTER_IBLOCK(glBeginConditionalRenderNV)
+GLATTER_IBLOCK(glEndConditionalRenderNV)
+#endif // defined(GL_NV_conditional_render)
+#if defined(GL_NV_conservative_raster)
+GLATTER_IEXTENSION(GL_NV_conservative_raster)
+GLATTER_IBLOCK(glSubpixelPrecisionBiasNV)
+#endif // defined(GL_NV_conservative_raster)
+#if defined(GL_NV_conservative_raster_pre_snap_triangles)
+GLATTER_IEXTENSION(GL_NV_conservative_raster_pre_snap_triangles)
+GLATTER_IBLOCK(glConservativeRasterParameteriNV)
+#endif // defined(GL_NV_conservative_raster_pre_snap_triangles)
+#if defined(GL_NV_copy_buffer)
+GLATTER_IEXTENSION(GL_NV_copy_buffer)
+GLATTER_IBLOCK(glCopyBufferSubDataNV)
+#endif // defined(GL_NV_copy_buffer)
+#if defined(GL_NV_coverage_sample)
+GLATTER_IEXTENSION(GL_NV_coverage_sample)
+GLATTER_IBLOCK(glCoverageMaskNV)
+GLATTER_IBLOCK(glCoverageOperationNV)
+#endif // defined(GL_NV_coverage_sample)
+#if defined(GL_NV_draw_buffers)
+GLATTER_IEXTENSION(GL_NV_draw_buffers)
+GLATTER_IBLOCK(glDrawBuffersNV)
+#endif // defined(GL_NV_draw_buffers)
+#if defined(GL_NV_draw_instanced)
+GLATTER_IEXTENSION(GL_NV_draw_instanced)
+GLATTER_IBLOCK(glDrawArraysInstancedNV)
+GLATTER_IBLOCK(glDrawElementsInstancedNV)
+#endif // defined(GL_NV_draw_instanced)
+#if defined(GL_NV_draw_vulkan_image)
+GLATTER_IEXTENSION(GL_NV_draw_vulkan_image)
+GLATTER_IBLOCK(glDrawVkImageNV)
+GLATTER_IBLOCK(glGetVkProcAddrNV)
+GLATTER_IBLOCK(glSignalVkFenceNV)
+GLATTER_IBLOCK(glSignalVkSemaphoreNV)
+GLATTER_IBLOCK(glWaitVkSemaphoreNV)
+#endif // defined(GL_NV_draw_vulkan_image)
+#if defined(GL_NV_fence)
+GLATTER_IEXTENSION(GL_NV_fence)
+GLATTER_IBLOCK(glDeleteFencesNV)
+GLATTER_IBLOCK(glFinishFenceNV)
+GLATTER_IBLOCK(glGenFencesNV)
+GLATTER_IBLOCK(glGetFenceivNV)
+GLATTER_IBLOCK(glIsFenceNV)
+GLATTER_IBLOCK(glSetFenceNV)
+GLATTER_IBLOCK(glTestFenceNV)
+#endif // defined(GL_NV_fence)
+#if defined(GL_NV_fragment_coverage_to_color)
+GLATTER_IEXTENSION(GL_NV_fragment_coverage_to_color)
+GLATTER_IBLOCK(glFragmentCoverageColorNV)
+#endif // defined(GL_NV_fragment_coverage_to_color)
+#if defined(GL_NV_framebuffer_blit)
+GLATTER_IEXTENSION(GL_NV_framebuffer_blit)
+GLATTER_IBLOCK(glBlitFramebufferNV)
+#endif // defined(GL_NV_framebuffer_blit)
+#if defined(GL_NV_framebuffer_mixed_samples)
+GLATTER_IEXTENSION(GL_NV_framebuffer_mixed_samples)
+GLATTER_IBLOCK(glCoverageModulationNV)
+GLATTER_IBLOCK(glCoverageModulationTableNV)
+GLATTER_IBLOCK(glGetCoverageModulationTableNV)
+#endif // defined(GL_NV_framebuffer_mixed_samples)
+#if defined(GL_NV_framebuffer_multisample)
+GLATTER_IEXTENSION(GL_NV_framebuffer_multisample)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleNV)
+#endif // defined(GL_NV_framebuffer_multisample)
+#if defined(GL_NV_gpu_shader5)
+GLATTER_IEXTENSION(GL_NV_gpu_shader5)
+GLATTER_IBLOCK(glGetUniformi64vNV)
+GLATTER_IBLOCK(glProgramUniform1i64NV)
+GLATTER_IBLOCK(glProgramUniform1i64vNV)
+GLATTER_IBLOCK(glProgramUniform1ui64NV)
+GLATTER_IBLOCK(glProgramUniform1ui64vNV)
+GLATTER_IBLOCK(glProgramUniform2i64NV)
+GLATTER_IBLOCK(glProgramUniform2i64vNV)
+GLATTER_IBLOCK(glProgramUniform2ui64NV)
+GLATTER_IBLOCK(glProgramUniform2ui64vNV)
+GLATTER_IBLOCK(glProgramUniform3i64NV)
+GLATTER_IBLOCK(glProgramUniform3i64vNV)
+GLATTER_IBLOCK(glProgramUniform3ui64NV)
+GLATTER_IBLOCK(glProgramUniform3ui64vNV)
+GLATTER_IBLOCK(glProgramUniform4i64NV)
+GLATTER_IBLOCK(glProgramUniform4i64vNV)
+GLATTER_IBLOCK(glProgramUniform4ui64NV)
+GLATTER_IBLOCK(glProgramUniform4ui64vNV)
+GLATTER_IBLOCK(glUniform1i64NV)
+GLATTER_IBLOCK(glUniform1i64vNV)
+GLATTER_IBLOCK(glUniform1ui64NV)
+GLATTER_IBLOCK(glUniform1ui64vNV)
+GLATTER_IBLOCK(glUniform2i64NV)
+GLATTER_IBLOCK(glUniform2i64vNV)
+GLATTER_IBLOCK(glUniform2ui64NV)
+GLATTER_IBLOCK(glUniform2ui64vNV)
+GLATTER_IBLOCK(glUniform3i64NV)
+GLATTER_IBLOCK(glUniform3i64vNV)
+GLATTER_IBLOCK(glUniform3ui64NV)
+GLATTER_IBLOCK(glUniform3ui64vNV)
+GLATTER_IBLOCK(glUniform4i64NV)
+GLATTER_IBLOCK(glUniform4i64vNV)
+GLATTER_IBLOCK(glUniform4ui64NV)
+GLATTER_IBLOCK(glUniform4ui64vNV)
+#endif // defined(GL_NV_gpu_shader5)
+#if defined(GL_NV_instanced_arrays)
+GLATTER_IEXTENSION(GL_NV_instanced_arrays)
+GLATTER_IBLOCK(glVertexAttribDivisorNV)
+#endif // defined(GL_NV_instanced_arrays)
+#if defined(GL_NV_internalformat_sample_query)
+GLATTER_IEXTENSION(GL_NV_internalformat_sample_query)
+GLATTER_IBLOCK(glGetInternalformatSampleivNV)
+#endif // defined(GL_NV_internalformat_sample_query)
+#if defined(GL_NV_memory_attachment)
+GLATTER_IEXTENSION(GL_NV_memory_attachment)
+GLATTER_IBLOCK(glBufferAttachMemoryNV)
+GLATTER_IBLOCK(glGetMemoryObjectDetachedResourcesuivNV)
+GLATTER_IBLOCK(glNamedBufferAttachMemoryNV)
+GLATTER_IBLOCK(glResetMemoryObjectParameterNV)
+GLATTER_IBLOCK(glTexAttachMemoryNV)
+GLATTER_IBLOCK(glTextureAttachMemoryNV)
+#endif // defined(GL_NV_memory_attachment)
+#if defined(GL_NV_memory_object_sparse)
+GLATTER_IEXTENSION(GL_NV_memory_object_sparse)
+GLATTER_IBLOCK(glBufferPageCommitmentMemNV)
+GLATTER_IBLOCK(glNamedBufferPageCommitmentMemNV)
+GLATTER_IBLOCK(glTexPageCommitmentMemNV)
+GLATTER_IBLOCK(glTexturePageCommitmentMemNV)
+#endif // defined(GL_NV_memory_object_sparse)
+#if defined(GL_NV_mesh_shader)
+GLATTER_IEXTENSION(GL_NV_mesh_shader)
+GLATTER_IBLOCK(glDrawMeshTasksIndirectNV)
+GLATTER_IBLOCK(glDrawMeshTasksNV)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectCountNV)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectNV)
+#endif // defined(GL_NV_mesh_shader)
+#if defined(GL_NV_non_square_matrices)
+GLATTER_IEXTENSION(GL_NV_non_square_matrices)
+GLATTER_IBLOCK(glUniformMatrix2x3fvNV)
+GLATTER_IBLOCK(glUniformMatrix2x4fvNV)
+GLATTER_IBLOCK(glUniformMatrix3x2fvNV)
+GLATTER_IBLOCK(glUniformMatrix3x4fvNV)
+GLATTER_IBLOCK(glUniformMatrix4x2fvNV)
+GLATTER_IBLOCK(glUniformMatrix4x3fvNV)
+#endif // defined(GL_NV_non_square_matrices)
+#if defined(GL_NV_path_rendering)
+GLATTER_IEXTENSION(GL_NV_path_rendering)
+GLATTER_IBLOCK(glCopyPathNV)
+GLATTER_IBLOCK(glCoverFillPathInstancedNV)
+GLATTER_IBLOCK(glCoverFillPathNV)
+GLATTER_IBLOCK(glCoverStrokePathInstancedNV)
+GLATTER_IBLOCK(glCoverStrokePathNV)
+GLATTER_IBLOCK(glDeletePathsNV)
+GLATTER_IBLOCK(glGenPathsNV)
+GLATTER_IBLOCK(glGetPathCommandsNV)
+GLATTER_IBLOCK(glGetPathCoordsNV)
+GLATTER_IBLOCK(glGetPathDashArrayNV)
+GLATTER_IBLOCK(glGetPathLengthNV)
+GLATTER_IBLOCK(glGetPathMetricRangeNV)
+GLATTER_IBLOCK(glGetPathMetricsNV)
+GLATTER_IBLOCK(glGetPathParameterfvNV)
+GLATTER_IBLOCK(glGetPathParameterivNV)
+GLATTER_IBLOCK(glGetPathSpacingNV)
+GLATTER_IBLOCK(glGetProgramResourcefvNV)
+GLATTER_IBLOCK(glInterpolatePathsNV)
+GLATTER_IBLOCK(glIsPathNV)
+GLATTER_IBLOCK(glIsPointInFillPathNV)
+GLATTER_IBLOCK(glIsPointInStrokePathNV)
+GLATTER_IBLOCK(glMatrixFrustumEXT)
+GLATTER_IBLOCK(glMatrixLoad3x2fNV)
+GLATTER_IBLOCK(glMatrixLoad3x3fNV)
+GLATTER_IBLOCK(glMatrixLoadIdentityEXT)
+GLATTER_IBLOCK(glMatrixLoadTranspose3x3fNV)
+GLATTER_IBLOCK(glMatrixLoadTransposedEXT)
+GLATTER_IBLOCK(glMatrixLoadTransposefEXT)
+GLATTER_IBLOCK(glMatrixLoaddEXT)
+GLATTER_IBLOCK(glMatrixLoadfEXT)
+GLATTER_IBLOCK(glMatrixMult3x2fNV)
+GLATTER_IBLOCK(glMatrixMult3x3fNV)
+GLATTER_IBLOCK(glMatrixMultTranspose3x3fNV)
+GLATTER_IBLOCK(glMatrixMultTransposedEXT)
+GLATTER_IBLOCK(glMatrixMultTransposefEXT)
+GLATTER_IBLOCK(glMatrixMultdEXT)
+GLATTER_IBLOCK(glMatrixMultfEXT)
+GLATTER_IBLOCK(glMatrixOrthoEXT)
+GLATTER_IBLOCK(glMatrixPopEXT)
+GLATTER_IBLOCK(glMatrixPushEXT)
+GLATTER_IBLOCK(glMatrixRotatedEXT)
+GLATTER_IBLOCK(glMatrixRotatefEXT)
+GLATTER_IBLOCK(glMatrixScaledEXT)
+GLATTER_IBLOCK(glMatrixScalefEXT)
+GLATTER_IBLOCK(glMatrixTranslatedEXT)
+GLATTER_IBLOCK(glMatrixTranslatefEXT)
+GLATTER_IBLOCK(glPathCommandsNV)
+GLATTER_IBLOCK(glPathCoordsNV)
+GLATTER_IBLOCK(glPathCoverDepthFuncNV)
+GLATTER_IBLOCK(glPathDashArrayNV)
+GLATTER_IBLOCK(glPathGlyphIndexArrayNV)
+GLATTER_IBLOCK(glPathGlyphIndexRangeNV)
+GLATTER_IBLOCK(glPathGlyphRangeNV)
+GLATTER_IBLOCK(glPathGlyphsNV)
+GLATTER_IBLOCK(glPathMemoryGlyphIndexArrayNV)
+GLATTER_IBLOCK(glPathParameterfNV)
+GLATTER_IBLOCK(glPathParameterfvNV)
+GLATTER_IBLOCK(glPathParameteriNV)
+GLATTER_IBLOCK(glPathParameterivNV)
+GLATTER_IBLOCK(glPathStencilDepthOffsetNV)
+GLATTER_IBLOCK(glPathStencilFuncNV)
+GLATTER_IBLOCK(glPathStringNV)
+GLATTER_IBLOCK(glPathSubCommandsNV)
+GLATTER_IBLOCK(glPathSubCoordsNV)
+GLATTER_IBLOCK(glPointAlongPathNV)
+GLATTER_IBLOCK(glProgramPathFragmentInputGenNV)
+GLATTER_IBLOCK(glStencilFillPathInstancedNV)
+GLATTER_IBLOCK(glStencilFillPathNV)
+GLATTER_IBLOCK(glStencilStrokePathInstancedNV)
+GLATTER_IBLOCK(glStencilStrokePathNV)
+GLATTER_IBLOCK(glStencilThenCoverFillPathInstancedNV)
+GLATTER_IBLOCK(glStencilThenCoverFillPathNV)
+GLATTER_IBLOCK(glStencilThenCoverStrokePathInstancedNV)
+GLATTER_IBLOCK(glStencilThenCoverStrokePathNV)
+GLATTER_IBLOCK(glTransformPathNV)
+GLATTER_IBLOCK(glWeightPathsNV)
+#endif // defined(GL_NV_path_rendering)
+#if defined(GL_NV_polygon_mode)
+GLATTER_IEXTENSION(GL_NV_polygon_mode)
+GLATTER_IBLOCK(glPolygonModeNV)
+#endif // defined(GL_NV_polygon_mode)
+#if defined(GL_NV_read_buffer)
+GLATTER_IEXTENSION(GL_NV_read_buffer)
+GLATTER_IBLOCK(glReadBufferNV)
+#endif // defined(GL_NV_read_buffer)
+#if defined(GL_NV_sample_locations)
+GLATTER_IEXTENSION(GL_NV_sample_locations)
+GLATTER_IBLOCK(glFramebufferSampleLocationsfvNV)
+GLATTER_IBLOCK(glNamedFramebufferSampleLocationsfvNV)
+GLATTER_IBLOCK(glResolveDepthValuesNV)
+#endif // defined(GL_NV_sample_locations)
+#if defined(GL_NV_scissor_exclusive)
+GLATTER_IEXTENSION(GL_NV_scissor_exclusive)
+GLATTER_IBLOCK(glScissorExclusiveArrayvNV)
+GLATTER_IBLOCK(glScissorExclusiveNV)
+#endif // defined(GL_NV_scissor_exclusive)
+#if defined(GL_NV_shading_rate_image)
+GLATTER_IEXTENSION(GL_NV_shading_rate_image)
+GLATTER_IBLOCK(glBindShadingRateImageNV)
+GLATTER_IBLOCK(glGetShadingRateImagePaletteNV)
+GLATTER_IBLOCK(glGetShadingRateSampleLocationivNV)
+GLATTER_IBLOCK(glShadingRateImageBarrierNV)
+GLATTER_IBLOCK(glShadingRateImagePaletteNV)
+GLATTER_IBLOCK(glShadingRateSampleOrderCustomNV)
+GLATTER_IBLOCK(glShadingRateSampleOrderNV)
+#endif // defined(GL_NV_shading_rate_image)
+#if defined(GL_NV_texture_barrier)
+GLATTER_IEXTENSION(GL_NV_texture_barrier)
+GLATTER_IBLOCK(glTextureBarrierNV)
+#endif // defined(GL_NV_texture_barrier)
+#if defined(GL_NV_timeline_semaphore)
+GLATTER_IEXTENSION(GL_NV_timeline_semaphore)
+GLATTER_IBLOCK(glCreateSemaphoresNV)
+GLATTER_IBLOCK(glGetSemaphoreParameterivNV)
+GLATTER_IBLOCK(glSemaphoreParameterivNV)
+#endif // defined(GL_NV_timeline_semaphore)
+#if defined(GL_NV_viewport_array)
+GLATTER_IEXTENSION(GL_NV_viewport_array)
+GLATTER_IBLOCK(glDepthRangeArrayfvNV)
+GLATTER_IBLOCK(glDepthRangeIndexedfNV)
+GLATTER_IBLOCK(glDisableiNV)
+GLATTER_IBLOCK(glEnableiNV)
+GLATTER_IBLOCK(glGetFloati_vNV)
+GLATTER_IBLOCK(glIsEnablediNV)
+GLATTER_IBLOCK(glScissorArrayvNV)
+GLATTER_IBLOCK(glScissorIndexedNV)
+GLATTER_IBLOCK(glScissorIndexedvNV)
+GLATTER_IBLOCK(glViewportArrayvNV)
+GLATTER_IBLOCK(glViewportIndexedfNV)
+GLATTER_IBLOCK(glViewportIndexedfvNV)
+#endif // defined(GL_NV_viewport_array)
+#if defined(GL_NV_viewport_swizzle)
+GLATTER_IEXTENSION(GL_NV_viewport_swizzle)
+GLATTER_IBLOCK(glViewportSwizzleNV)
+#endif // defined(GL_NV_viewport_swizzle)
+#if defined(GL_OES_EGL_image)
+GLATTER_IEXTENSION(GL_OES_EGL_image)
+GLATTER_IBLOCK(glEGLImageTargetRenderbufferStorageOES)
+GLATTER_IBLOCK(glEGLImageTargetTexture2DOES)
+#endif // defined(GL_OES_EGL_image)
+#if defined(GL_OES_copy_image)
+GLATTER_IEXTENSION(GL_OES_copy_image)
+GLATTER_IBLOCK(glCopyImageSubDataOES)
+#endif // defined(GL_OES_copy_image)
+#if defined(GL_OES_draw_buffers_indexed)
+GLATTER_IEXTENSION(GL_OES_draw_buffers_indexed)
+GLATTER_IBLOCK(glBlendEquationSeparateiOES)
+GLATTER_IBLOCK(glBlendEquationiOES)
+GLATTER_IBLOCK(glBlendFuncSeparateiOES)
+GLATTER_IBLOCK(glBlendFunciOES)
+GLATTER_IBLOCK(glColorMaskiOES)
+GLATTER_IBLOCK(glDisableiOES)
+GLATTER_IBLOCK(glEnableiOES)
+GLATTER_IBLOCK(glIsEnablediOES)
+#endif // defined(GL_OES_draw_buffers_indexed)
+#if defined(GL_OES_draw_elements_base_vertex)
+GLATTER_IEXTENSION(GL_OES_draw_elements_base_vertex)
+GLATTER_IBLOCK(glDrawElementsBaseVertexOES)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseVertexOES)
+GLATTER_IBLOCK(glDrawRangeElementsBaseVertexOES)
+GLATTER_IBLOCK(glMultiDrawElementsBaseVertexEXT)
+#endif // defined(GL_OES_draw_elements_base_vertex)
+#if defined(GL_OES_geometry_shader)
+GLATTER_IEXTENSION(GL_OES_geometry_shader)
+GLATTER_IBLOCK(glFramebufferTextureOES)
+#endif // defined(GL_OES_geometry_shader)
+#if defined(GL_OES_get_program_binary)
+GLATTER_IEXTENSION(GL_OES_get_program_binary)
+GLATTER_IBLOCK(glGetProgramBinaryOES)
+GLATTER_IBLOCK(glProgramBinaryOES)
+#endif // defined(GL_OES_get_program_binary)
+#if defined(GL_OES_mapbuffer)
+GLATTER_IEXTENSION(GL_OES_mapbuffer)
+GLATTER_IBLOCK(glGetBufferPointervOES)
+GLATTER_IBLOCK(glMapBufferOES)
+GLATTER_IBLOCK(glUnmapBufferOES)
+#endif // defined(GL_OES_mapbuffer)
+#if defined(GL_OES_primitive_bounding_box)
+GLATTER_IEXTENSION(GL_OES_primitive_bounding_box)
+GLATTER_IBLOCK(glPrimitiveBoundingBoxOES)
+#endif // defined(GL_OES_primitive_bounding_box)
+#if defined(GL_OES_sample_shading)
+GLATTER_IEXTENSION(GL_OES_sample_shading)
+GLATTER_IBLOCK(glMinSampleShadingOES)
+#endif // defined(GL_OES_sample_shading)
+#if defined(GL_OES_tessellation_shader)
+GLATTER_IEXTENSION(GL_OES_tessellation_shader)
+GLATTER_IBLOCK(glPatchParameteriOES)
+#endif // defined(GL_OES_tessellation_shader)
+#if defined(GL_OES_texture_3D)
+GLATTER_IEXTENSION(GL_OES_texture_3D)
+GLATTER_IBLOCK(glCompressedTexImage3DOES)
+GLATTER_IBLOCK(glCompressedTexSubImage3DOES)
+GLATTER_IBLOCK(glCopyTexSubImage3DOES)
+GLATTER_IBLOCK(glFramebufferTexture3DOES)
+GLATTER_IBLOCK(glTexImage3DOES)
+GLATTER_IBLOCK(glTexSubImage3DOES)
+#endif // defined(GL_OES_texture_3D)
+#if defined(GL_OES_texture_border_clamp)
+GLATTER_IEXTENSION(GL_OES_texture_border_clamp)
+GLATTER_IBLOCK(glGetSamplerParameterIivOES)
+GLATTER_IBLOCK(glGetSamplerParameterIuivOES)
+GLATTER_IBLOCK(glGetTexParameterIivOES)
+GLATTER_IBLOCK(glGetTexParameterIuivOES)
+GLATTER_IBLOCK(glSamplerParameterIivOES)
+GLATTER_IBLOCK(glSamplerParameterIuivOES)
+GLATTER_IBLOCK(glTexParameterIivOES)
+GLATTER_IBLOCK(glTexParameterIuivOES)
+#endif // defined(GL_OES_texture_border_clamp)
+#if defined(GL_OES_texture_buffer)
+GLATTER_IEXTENSION(GL_OES_texture_buffer)
+GLATTER_IBLOCK(glTexBufferOES)
+GLATTER_IBLOCK(glTexBufferRangeOES)
+#endif // defined(GL_OES_texture_buffer)
+#if defined(GL_OES_texture_storage_multisample_2d_array)
+GLATTER_IEXTENSION(GL_OES_texture_storage_multisample_2d_array)
+GLATTER_IBLOCK(glTexStorage3DMultisampleOES)
+#endif // defined(GL_OES_texture_storage_multisample_2d_array)
+#if defined(GL_OES_texture_view)
+GLATTER_IEXTENSION(GL_OES_texture_view)
+GLATTER_IBLOCK(glTextureViewOES)
+#endif // defined(GL_OES_texture_view)
+#if defined(GL_OES_vertex_array_object)
+GLATTER_IEXTENSION(GL_OES_vertex_array_object)
+GLATTER_IBLOCK(glBindVertexArrayOES)
+GLATTER_IBLOCK(glDeleteVertexArraysOES)
+GLATTER_IBLOCK(glGenVertexArraysOES)
+GLATTER_IBLOCK(glIsVertexArrayOES)
+#endif // defined(GL_OES_vertex_array_object)
+#if defined(GL_OES_viewport_array)
+GLATTER_IEXTENSION(GL_OES_viewport_array)
+GLATTER_IBLOCK(glDepthRangeArrayfvOES)
+GLATTER_IBLOCK(glDepthRangeIndexedfOES)
+GLATTER_IBLOCK(glGetFloati_vOES)
+GLATTER_IBLOCK(glScissorArrayvOES)
+GLATTER_IBLOCK(glScissorIndexedOES)
+GLATTER_IBLOCK(glScissorIndexedvOES)
+GLATTER_IBLOCK(glViewportArrayvOES)
+GLATTER_IBLOCK(glViewportIndexedfOES)
+GLATTER_IBLOCK(glViewportIndexedfvOES)
+#endif // defined(GL_OES_viewport_array)
+#if defined(GL_OVR_multiview)
+GLATTER_IEXTENSION(GL_OVR_multiview)
+GLATTER_IBLOCK(glFramebufferTextureMultiviewOVR)
+GLATTER_IBLOCK(glNamedFramebufferTextureMultiviewOVR)
+#endif // defined(GL_OVR_multiview)
+#if defined(GL_OVR_multiview_multisampled_render_to_texture)
+GLATTER_IEXTENSION(GL_OVR_multiview_multisampled_render_to_texture)
+GLATTER_IBLOCK(glFramebufferTextureMultisampleMultiviewOVR)
+#endif // defined(GL_OVR_multiview_multisampled_render_to_texture)
+#if defined(GL_QCOM_alpha_test)
+GLATTER_IEXTENSION(GL_QCOM_alpha_test)
+GLATTER_IBLOCK(glAlphaFuncQCOM)
+#endif // defined(GL_QCOM_alpha_test)
+#if defined(GL_QCOM_driver_control)
+GLATTER_IEXTENSION(GL_QCOM_driver_control)
+GLATTER_IBLOCK(glDisableDriverControlQCOM)
+GLATTER_IBLOCK(glEnableDriverControlQCOM)
+GLATTER_IBLOCK(glGetDriverControlStringQCOM)
+GLATTER_IBLOCK(glGetDriverControlsQCOM)
+#endif // defined(GL_QCOM_driver_control)
+#if defined(GL_QCOM_extended_get)
+GLATTER_IEXTENSION(GL_QCOM_extended_get)
+GLATTER_IBLOCK(glExtGetBufferPointervQCOM)
+GLATTER_IBLOCK(glExtGetBuffersQCOM)
+GLATTER_IBLOCK(glExtGetFramebuffersQCOM)
+GLATTER_IBLOCK(glExtGetRenderbuffersQCOM)
+GLATTER_IBLOCK(glExtGetTexLevelParameterivQCOM)
+GLATTER_IBLOCK(glExtGetTexSubImageQCOM)
+GLATTER_IBLOCK(glExtGetTexturesQCOM)
+GLATTER_IBLOCK(glExtTexObjectStateOverrideiQCOM)
+#endif // defined(GL_QCOM_extended_get)
+#if defined(GL_QCOM_extended_get2)
+GLATTER_IEXTENSION(GL_QCOM_extended_get2)
+GLATTER_IBLOCK(glExtGetProgramBinarySourceQCOM)
+GLATTER_IBLOCK(glExtGetProgramsQCOM)
+GLATTER_IBLOCK(glExtGetShadersQCOM)
+GLATTER_IBLOCK(glExtIsProgramBinaryQCOM)
+#endif // defined(GL_QCOM_extended_get2)
+#if defined(GL_QCOM_frame_extrapolation)
+GLATTER_IEXTENSION(GL_QCOM_frame_extrapolation)
+GLATTER_IBLOCK(glExtrapolateTex2DQCOM)
+#endif // defined(GL_QCOM_frame_extrapolation)
+#if defined(GL_QCOM_framebuffer_foveated)
+GLATTER_IEXTENSION(GL_QCOM_framebuffer_foveated)
+GLATTER_IBLOCK(glFramebufferFoveationConfigQCOM)
+GLATTER_IBLOCK(glFramebufferFoveationParametersQCOM)
+#endif // defined(GL_QCOM_framebuffer_foveated)
+#if defined(GL_QCOM_motion_estimation)
+GLATTER_IEXTENSION(GL_QCOM_motion_estimation)
+GLATTER_IBLOCK(glTexEstimateMotionQCOM)
+GLATTER_IBLOCK(glTexEstimateMotionRegionsQCOM)
+#endif // defined(GL_QCOM_motion_estimation)
+#if defined(GL_QCOM_shader_framebuffer_fetch_noncoherent)
+GLATTER_IEXTENSION(GL_QCOM_shader_framebuffer_fetch_noncoherent)
+GLATTER_IBLOCK(glFramebufferFetchBarrierQCOM)
+#endif // defined(GL_QCOM_shader_framebuffer_fetch_noncoherent)
+#if defined(GL_QCOM_shading_rate)
+GLATTER_IEXTENSION(GL_QCOM_shading_rate)
+GLATTER_IBLOCK(glShadingRateQCOM)
+#endif // defined(GL_QCOM_shading_rate)
+#if defined(GL_QCOM_texture_foveated)
+GLATTER_IEXTENSION(GL_QCOM_texture_foveated)
+GLATTER_IBLOCK(glTextureFoveationParametersQCOM)
+#endif // defined(GL_QCOM_texture_foveated)
+#if defined(GL_QCOM_tiled_rendering)
+GLATTER_IEXTENSION(GL_QCOM_tiled_rendering)
+GLATTER_IBLOCK(glEndTilingQCOM)
+GLATTER_IBLOCK(glStartTilingQCOM)
+#endif // defined(GL_QCOM_tiled_rendering)
+#endif // defined(__gles2_gl2ext_h_)
+#if defined(__gles2_gl31_h_)
+#if defined(GL_ES_VERSION_2_0)
+GLATTER_IVERSION(2, 0)
+GLATTER_IBLOCK(glActiveTexture)
+GLATTER_IBLOCK(glAttachShader)
+GLATTER_IBLOCK(glBindAttribLocation)
+GLATTER_IBLOCK(glBindBuffer)
+GLATTER_IBLOCK(glBindFramebuffer)
+GLATTER_IBLOCK(glBindRenderbuffer)
+GLATTER_IBLOCK(glBindTexture)
+GLATTER_IBLOCK(glBlendColor)
+GLATTER_IBLOCK(glBlendEquation)
+GLATTER_IBLOCK(glBlendEquationSeparate)
+GLATTER_IBLOCK(glBlendFunc)
+GLATTER_IBLOCK(glBlendFuncSeparate)
+GLATTER_IBLOCK(glBufferData)
+GLATTER_IBLOCK(glBufferSubData)
+GLATTER_IBLOCK(glCheckFramebufferStatus)
+GLATTER_IBLOCK(glClear)
+GLATTER_IBLOCK(glClearColor)
+GLATTER_IBLOCK(glClearDepthf)
+GLATTER_IBLOCK(glClearStencil)
+GLATTER_IBLOCK(glColorMask)
+GLATTER_IBLOCK(glCompileShader)
+GLATTER_IBLOCK(glCompressedTexImage2D)
+GLATTER_IBLOCK(glCompressedTexSubImage2D)
+GLATTER_IBLOCK(glCopyTexImage2D)
+GLATTER_IBLOCK(glCopyTexSubImage2D)
+GLATTER_IBLOCK(glCreateProgram)
+GLATTER_IBLOCK(glCreateShader)
+GLATTER_IBLOCK(glCullFace)
+GLATTER_IBLOCK(glDeleteBuffers)
+GLATTER_IBLOCK(glDeleteFramebuffers)
+GLATTER_IBLOCK(glDeleteProgram)
+GLATTER_IBLOCK(glDeleteRenderbuffers)
+GLATTER_IBLOCK(glDeleteShader)
+GLATTER_IBLOCK(glDeleteTextures)
+GLATTER_IBLOCK(glDepthFunc)
+GLATTER_IBLOCK(glDepthMask)
+GLATTER_IBLOCK(glDepthRangef)
+GLATTER_IBLOCK(glDetachShader)
+GLATTER_IBLOCK(glDisable)
+GLATTER_IBLOCK(glDisableVertexAttribArray)
+GLATTER_IBLOCK(glDrawArrays)
+GLATTER_IBLOCK(glDrawElements)
+GLATTER_IBLOCK(glEnable)
+GLATTER_IBLOCK(glEnableVertexAttribArray)
+GLATTER_IBLOCK(glFinish)
+GLATTER_IBLOCK(glFlush)
+GLATTER_IBLOCK(glFramebufferRenderbuffer)
+GLATTER_IBLOCK(glFramebufferTexture2D)
+GLATTER_IBLOCK(glFrontFace)
+GLATTER_IBLOCK(glGenBuffers)
+GLATTER_IBLOCK(glGenFramebuffers)
+GLATTER_IBLOCK(glGenRenderbuffers)
+GLATTER_IBLOCK(glGenTextures)
+GLATTER_IBLOCK(glGenerateMipmap)
+GLATTER_IBLOCK(glGetActiveAttrib)
+GLATTER_IBLOCK(glGetActiveUniform)
+GLATTER_IBLOCK(glGetAttachedShaders)
+GLATTER_IBLOCK(glGetAttribLocation)
+GLATTER_IBLOCK(glGetBooleanv)
+GLATTER_IBLOCK(glGetBufferParameteriv)
+GLATTER_IBLOCK(glGetError)
+GLATTER_IBLOCK(glGetFloatv)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameteriv)
+GLATTER_IBLOCK(glGetIntegerv)
+GLATTER_IBLOCK(glGetProgramInfoLog)
+GLATTER_IBLOCK(glGetProgramiv)
+GLATTER_IBLOCK(glGetRenderbufferParameteriv)
+GLATTER_IBLOCK(glGetShaderInfoLog)
+GLATTER_IBLOCK(glGetShaderPrecisionFormat)
+GLATTER_IBLOCK(glGetShaderSource)
+GLATTER_IBLOCK(glGetShaderiv)
+GLATTER_IBLOCK(glGetString)
+GLATTER_IBLOCK(glGetTexParameterfv)
+GLATTER_IBLOCK(glGetTexParameteriv)
+GLATTER_IBLOCK(glGetUniformLocation)
+GLATTER_IBLOCK(glGetUniformfv)
+GLATTER_IBLOCK(glGetUniformiv)
+GLATTER_IBLOCK(glGetVertexAttribPointerv)
+GLATTER_IBLOCK(glGetVertexAttribfv)
+GLATTER_IBLOCK(glGetVertexAttribiv)
+GLATTER_IBLOCK(glHint)
+GLATTER_IBLOCK(glIsBuffer)
+GLATTER_IBLOCK(glIsEnabled)
+GLATTER_IBLOCK(glIsFramebuffer)
+GLATTER_IBLOCK(glIsProgram)
+GLATTER_IBLOCK(glIsRenderbuffer)
+GLATTER_IBLOCK(glIsShader)
+GLATTER_IBLOCK(glIsTexture)
+GLATTER_IBLOCK(glLineWidth)
+GLATTER_IBLOCK(glLinkProgram)
+GLATTER_IBLOCK(glPixelStorei)
+GLATTER_IBLOCK(glPolygonOffset)
+GLATTER_IBLOCK(glReadPixels)
+GLATTER_IBLOCK(glReleaseShaderCompiler)
+GLATTER_IBLOCK(glRenderbufferStorage)
+GLATTER_IBLOCK(glSampleCoverage)
+GLATTER_IBLOCK(glScissor)
+GLATTER_IBLOCK(glShaderBinary)
+GLATTER_IBLOCK(glShaderSource)
+GLATTER_IBLOCK(glStencilFunc)
+GLATTER_IBLOCK(glStencilFuncSeparate)
+GLATTER_IBLOCK(glStencilMask)
+GLATTER_IBLOCK(glStencilMaskSeparate)
+GLATTER_IBLOCK(glStencilOp)
+GLATTER_IBLOCK(glStencilOpSeparate)
+GLATTER_IBLOCK(glTexImage2D)
+GLATTER_IBLOCK(glTexParameterf)
+GLATTER_IBLOCK(glTexParameterfv)
+GLATTER_IBLOCK(glTexParameteri)
+GLATTER_IBLOCK(glTexParameteriv)
+GLATTER_IBLOCK(glTexSubImage2D)
+GLATTER_IBLOCK(glUniform1f)
+GLATTER_IBLOCK(glUniform1fv)
+GLATTER_IBLOCK(glUniform1i)
+GLATTER_IBLOCK(glUniform1iv)
+GLATTER_IBLOCK(glUniform2f)
+GLATTER_IBLOCK(glUniform2fv)
+GLATTER_IBLOCK(glUniform2i)
+GLATTER_IBLOCK(glUniform2iv)
+GLATTER_IBLOCK(glUniform3f)
+GLATTER_IBLOCK(glUniform3fv)
+GLATTER_IBLOCK(glUniform3i)
+GLATTER_IBLOCK(glUniform3iv)
+GLATTER_IBLOCK(glUniform4f)
+GLATTER_IBLOCK(glUniform4fv)
+GLATTER_IBLOCK(glUniform4i)
+GLATTER_IBLOCK(glUniform4iv)
+GLATTER_IBLOCK(glUniformMatrix2fv)
+GLATTER_IBLOCK(glUniformMatrix3fv)
+GLATTER_IBLOCK(glUniformMatrix4fv)
+GLATTER_IBLOCK(glUseProgram)
+GLATTER_IBLOCK(glValidateProgram)
+GLATTER_IBLOCK(glVertexAttrib1f)
+GLATTER_IBLOCK(glVertexAttrib1fv)
+GLATTER_IBLOCK(glVertexAttrib2f)
+GLATTER_IBLOCK(glVertexAttrib2fv)
+GLATTER_IBLOCK(glVertexAttrib3f)
+GLATTER_IBLOCK(glVertexAttrib3fv)
+GLATTER_IBLOCK(glVertexAttrib4f)
+GLATTER_IBLOCK(glVertexAttrib4fv)
+GLATTER_IBLOCK(glVertexAttribPointer)
+GLATTER_IBLOCK(glViewport)
+#endif // defined(GL_ES_VERSION_2_0)
+#if defined(GL_ES_VERSION_3_0)
+GLATTER_IVERSION(3, 0)
+GLATTER_IBLOCK(glBeginQuery)
+GLATTER_IBLOCK(glBeginTransformFeedback)
+GLATTER_IBLOCK(glBindBufferBase)
+GLATTER_IBLOCK(glBindBufferRange)
+GLATTER_IBLOCK(glBindSampler)
+GLATTER_IBLOCK(glBindTransformFeedback)
+GLATTER_IBLOCK(glBindVertexArray)
+GLATTER_IBLOCK(glBlitFramebuffer)
+GLATTER_IBLOCK(glClearBufferfi)
+GLATTER_IBLOCK(glClearBufferfv)
+GLATTER_IBLOCK(glClearBufferiv)
+GLATTER_IBLOCK(glClearBufferuiv)
+GLATTER_IBLOCK(glClientWaitSync)
+GLATTER_IBLOCK(glCompressedTexImage3D)
+GLATTER_IBLOCK(glCompressedTexSubImage3D)
+GLATTER_IBLOCK(glCopyBufferSubData)
+GLATTER_IBLOCK(glCopyTexSubImage3D)
+GLATTER_IBLOCK(glDeleteQueries)
+GLATTER_IBLOCK(glDeleteSamplers)
+GLATTER_IBLOCK(glDeleteSync)
+GLATTER_IBLOCK(glDeleteTransformFeedbacks)
+GLATTER_IBLOCK(glDeleteVertexArrays)
+GLATTER_IBLOCK(glDrawArraysInstanced)
+GLATTER_IBLOCK(glDrawBuffers)
+GLATTER_IBLOCK(glDrawElementsInstanced)
+GLATTER_IBLOCK(glDrawRangeElements)
+GLATTER_IBLOCK(glEndQuery)
+GLATTER_IBLOCK(glEndTransformFeedback)
+GLATTER_IBLOCK(glFenceSync)
+GLATTER_IBLOCK(glFlushMappedBufferRange)
+GLATTER_IBLOCK(glFramebufferTextureLayer)
+GLATTER_IBLOCK(glGenQueries)
+GLATTER_IBLOCK(glGenSamplers)
+GLATTER_IBLOCK(glGenTransformFeedbacks)
+GLATTER_IBLOCK(glGenVertexArrays)
+GLATTER_IBLOCK(glGetActiveUniformBlockName)
+GLATTER_IBLOCK(glGetActiveUniformBlockiv)
+GLATTER_IBLOCK(glGetActiveUniformsiv)
+GLATTER_IBLOCK(glGetBufferParameteri64v)
+GLATTER_IBLOCK(glGetBufferPointerv)
+GLATTER_IBLOCK(glGetFragDataLocation)
+GLATTER_IBLOCK(glGetInteger64i_v)
+GLATTER_IBLOCK(glGetInteger64v)
+GLATTER_IBLOCK(glGetIntegeri_v)
+GLATTER_IBLOCK(glGetInternalformativ)
+GLATTER_IBLOCK(glGetProgramBinary)
+GLATTER_IBLOCK(glGetQueryObjectuiv)
+GLATTER_IBLOCK(glGetQueryiv)
+GLATTER_IBLOCK(glGetSamplerParameterfv)
+GLATTER_IBLOCK(glGetSamplerParameteriv)
+GLATTER_IBLOCK(glGetStringi)
+GLATTER_IBLOCK(glGetSynciv)
+GLATTER_IBLOCK(glGetTransformFeedbackVarying)
+GLATTER_IBLOCK(glGetUniformBlockIndex)
+GLATTER_IBLOCK(glGetUniformIndices)
+GLATTER_IBLOCK(glGetUniformuiv)
+GLATTER_IBLOCK(glGetVertexAttribIiv)
+GLATTER_IBLOCK(glGetVertexAttribIuiv)
+GLATTER_IBLOCK(glInvalidateFramebuffer)
+GLATTER_IBLOCK(glInvalidateSubFramebuffer)
+GLATTER_IBLOCK(glIsQuery)
+GLATTER_IBLOCK(glIsSampler)
+GLATTER_IBLOCK(glIsSync)
+GLATTER_IBLOCK(glIsTransformFeedback)
+GLATTER_IBLOCK(glIsVertexArray)
+GLATTER_IBLOCK(glMapBufferRange)
+GLATTER_IBLOCK(glPauseTransformFeedback)
+GLATTER_IBLOCK(glProgramBinary)
+GLATTER_IBLOCK(glProgramParameteri)
+GLATTER_IBLOCK(glReadBuffer)
+GLATTER_IBLOCK(glRenderbufferStorageMultisample)
+GLATTER_IBLOCK(glResumeTransformFeedback)
+GLATTER_IBLOCK(glSamplerParameterf)
+GLATTER_IBLOCK(glSamplerParameterfv)
+GLATTER_IBLOCK(glSamplerParameteri)
+GLATTER_IBLOCK(glSamplerParameteriv)
+GLATTER_IBLOCK(glTexImage3D)
+GLATTER_IBLOCK(glTexStorage2D)
+GLATTER_IBLOCK(glTexStorage3D)
+GLATTER_IBLOCK(glTexSubImage3D)
+GLATTER_IBLOCK(glTransformFeedbackVaryings)
+GLATTER_IBLOCK(glUniform1ui)
+GLATTER_IBLOCK(glUniform1uiv)
+GLATTER_IBLOCK(glUniform2ui)
+GLATTER_IBLOCK(glUniform2uiv)
+GLATTER_IBLOCK(glUniform3ui)
+GLATTER_IBLOCK(glUniform3uiv)
+GLATTER_IBLOCK(glUniform4ui)
+GLATTER_IBLOCK(glUniform4uiv)
+GLATTER_IBLOCK(glUniformBlockBinding)
+GLATTER_IBLOCK(glUniformMatrix2x3fv)
+GLATTER_IBLOCK(glUniformMatrix2x4fv)
+GLATTER_IBLOCK(glUniformMatrix3x2fv)
+GLATTER_IBLOCK(glUniformMatrix3x4fv)
+GLATTER_IBLOCK(glUniformMatrix4x2fv)
+GLATTER_IBLOCK(glUniformMatrix4x3fv)
+GLATTER_IBLOCK(glUnmapBuffer)
+GLATTER_IBLOCK(glVertexAttribDivisor)
+GLATTER_IBLOCK(glVertexAttribI4i)
+GLATTER_IBLOCK(glVertexAttribI4iv)
+GLATTER_IBLOCK(glVertexAttribI4ui)
+GLATTER_IBLOCK(glVertexAttribI4uiv)
+GLATTER_IBLOCK(glVertexAttribIPointer)
+GLATTER_IBLOCK(glWaitSync)
+#endif // defined(GL_ES_VERSION_3_0)
+#if defined(GL_ES_VERSION_3_1)
+GLATTER_IVERSION(3, 1)
+GLATTER_IBLOCK(glActiveShaderProgram)
+GLATTER_IBLOCK(glBindImageTexture)
+GLATTER_IBLOCK(glBindProgramPipeline)
+GLATTER_IBLOCK(glBindVertexBuffer)
+GLATTER_IBLOCK(glCreateShaderProgramv)
+GLATTER_IBLOCK(glDeleteProgramPipelines)
+GLATTER_IBLOCK(glDispatchCompute)
+GLATTER_IBLOCK(glDispatchComputeIndirect)
+GLATTER_IBLOCK(glDrawArraysIndirect)
+GLATTER_IBLOCK(glDrawElementsIndirect)
+GLATTER_IBLOCK(glFramebufferParameteri)
+GLATTER_IBLOCK(glGenProgramPipelines)
+GLATTER_IBLOCK(glGetBooleani_v)
+GLATTER_IBLOCK(glGetFramebufferParameteriv)
+GLATTER_IBLOCK(glGetMultisamplefv)
+GLATTER_IBLOCK(glGetProgramInterfaceiv)
+GLATTER_IBLOCK(glGetProgramPipelineInfoLog)
+GLATTER_IBLOCK(glGetProgramPipelineiv)
+GLATTER_IBLOCK(glGetProgramResourceIndex)
+GLATTER_IBLOCK(glGetProgramResourceLocation)
+GLATTER_IBLOCK(glGetProgramResourceName)
+GLATTER_IBLOCK(glGetProgramResourceiv)
+GLATTER_IBLOCK(glGetTexLevelParameterfv)
+GLATTER_IBLOCK(glGetTexLevelParameteriv)
+GLATTER_IBLOCK(glIsProgramPipeline)
+GLATTER_IBLOCK(glMemoryBarrier)
+GLATTER_IBLOCK(glMemoryBarrierByRegion)
+GLATTER_IBLOCK(glProgramUniform1f)
+GLATTER_IBLOCK(glProgramUniform1fv)
+GLATTER_IBLOCK(glProgramUniform1i)
+GLATTER_IBLOCK(glProgramUniform1iv)
+GLATTER_IBLOCK(glProgramUniform1ui)
+GLATTER_IBLOCK(glProgramUniform1uiv)
+GLATTER_IBLOCK(glProgramUniform2f)
+GLATTER_IBLOCK(glProgramUniform2fv)
+GLATTER_IBLOCK(glProgramUniform2i)
+GLATTER_IBLOCK(glProgramUniform2iv)
+GLATTER_IBLOCK(glProgramUniform2ui)
+GLATTER_IBLOCK(glProgramUniform2uiv)
+GLATTER_IBLOCK(glProgramUniform3f)
+GLATTER_IBLOCK(glProgramUniform3fv)
+GLATTER_IBLOCK(glProgramUniform3i)
+GLATTER_IBLOCK(glProgramUniform3iv)
+GLATTER_IBLOCK(glProgramUniform3ui)
+GLATTER_IBLOCK(glProgramUniform3uiv)
+GLATTER_IBLOCK(glProgramUniform4f)
+GLATTER_IBLOCK(glProgramUniform4fv)
+GLATTER_IBLOCK(glProgramUniform4i)
+GLATTER_IBLOCK(glProgramUniform4iv)
+GLATTER_IBLOCK(glProgramUniform4ui)
+GLATTER_IBLOCK(glProgramUniform4uiv)
+GLATTER_IBLOCK(glProgramUniformMatrix2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3fv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3fv)
+GLATTER_IBLOCK(glSampleMaski)
+GLATTER_IBLOCK(glTexStorage2DMultisample)
+GLATTER_IBLOCK(glUseProgramStages)
+GLATTER_IBLOCK(glValidateProgramPipeline)
+GLATTER_IBLOCK(glVertexAttribBinding)
+GLATTER_IBLOCK(glVertexAttribFormat)
+GLATTER_IBLOCK(glVertexAttribIFormat)
+GLATTER_IBLOCK(glVertexBindingDivisor)
+#endif // defined(GL_ES_VERSION_3_1)
+#endif // defined(__gles2_gl31_h_)
+#if defined(__gles2_gl32_h_)
+#if defined(GL_ES_VERSION_2_0)
+GLATTER_IVERSION(2, 0)
+GLATTER_IBLOCK(glActiveTexture)
+GLATTER_IBLOCK(glAttachShader)
+GLATTER_IBLOCK(glBindAttribLocation)
+GLATTER_IBLOCK(glBindBuffer)
+GLATTER_IBLOCK(glBindFramebuffer)
+GLATTER_IBLOCK(glBindRenderbuffer)
+GLATTER_IBLOCK(glBindTexture)
+GLATTER_IBLOCK(glBlendColor)
+GLATTER_IBLOCK(glBlendEquation)
+GLATTER_IBLOCK(glBlendEquationSeparate)
+GLATTER_IBLOCK(glBlendFunc)
+GLATTER_IBLOCK(glBlendFuncSeparate)
+GLATTER_IBLOCK(glBufferData)
+GLATTER_IBLOCK(glBufferSubData)
+GLATTER_IBLOCK(glCheckFramebufferStatus)
+GLATTER_IBLOCK(glClear)
+GLATTER_IBLOCK(glClearColor)
+GLATTER_IBLOCK(glClearDepthf)
+GLATTER_IBLOCK(glClearStencil)
+GLATTER_IBLOCK(glColorMask)
+GLATTER_IBLOCK(glCompileShader)
+GLATTER_IBLOCK(glCompressedTexImage2D)
+GLATTER_IBLOCK(glCompressedTexSubImage2D)
+GLATTER_IBLOCK(glCopyTexImage2D)
+GLATTER_IBLOCK(glCopyTexSubImage2D)
+GLATTER_IBLOCK(glCreateProgram)
+GLATTER_IBLOCK(glCreateShader)
+GLATTER_IBLOCK(glCullFace)
+GLATTER_IBLOCK(glDeleteBuffers)
+GLATTER_IBLOCK(glDeleteFramebuffers)
+GLATTER_IBLOCK(glDeleteProgram)
+GLATTER_IBLOCK(glDeleteRenderbuffers)
+GLATTER_IBLOCK(glDeleteShader)
+GLATTER_IBLOCK(glDeleteTextures)
+GLATTER_IBLOCK(glDepthFunc)
+GLATTER_IBLOCK(glDepthMask)
+GLATTER_IBLOCK(glDepthRangef)
+GLATTER_IBLOCK(glDetachShader)
+GLATTER_IBLOCK(glDisable)
+GLATTER_IBLOCK(glDisableVertexAttribArray)
+GLATTER_IBLOCK(glDrawArrays)
+GLATTER_IBLOCK(glDrawElements)
+GLATTER_IBLOCK(glEnable)
+GLATTER_IBLOCK(glEnableVertexAttribArray)
+GLATTER_IBLOCK(glFinish)
+GLATTER_IBLOCK(glFlush)
+GLATTER_IBLOCK(glFramebufferRenderbuffer)
+GLATTER_IBLOCK(glFramebufferTexture2D)
+GLATTER_IBLOCK(glFrontFace)
+GLATTER_IBLOCK(glGenBuffers)
+GLATTER_IBLOCK(glGenFramebuffers)
+GLATTER_IBLOCK(glGenRenderbuffers)
+GLATTER_IBLOCK(glGenTextures)
+GLATTER_IBLOCK(glGenerateMipmap)
+GLATTER_IBLOCK(glGetActiveAttrib)
+GLATTER_IBLOCK(glGetActiveUniform)
+GLATTER_IBLOCK(glGetAttachedShaders)
+GLATTER_IBLOCK(glGetAttribLocation)
+GLATTER_IBLOCK(glGetBooleanv)
+GLATTER_IBLOCK(glGetBufferParameteriv)
+GLATTER_IBLOCK(glGetError)
+GLATTER_IBLOCK(glGetFloatv)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameteriv)
+GLATTER_IBLOCK(glGetIntegerv)
+GLATTER_IBLOCK(glGetProgramInfoLog)
+GLATTER_IBLOCK(glGetProgramiv)
+GLATTER_IBLOCK(glGetRenderbufferParameteriv)
+GLATTER_IBLOCK(glGetShaderInfoLog)
+GLATTER_IBLOCK(glGetShaderPrecisionFormat)
+GLATTER_IBLOCK(glGetShaderSource)
+GLATTER_IBLOCK(glGetShaderiv)
+GLATTER_IBLOCK(glGetString)
+GLATTER_IBLOCK(glGetTexParameterfv)
+GLATTER_IBLOCK(glGetTexParameteriv)
+GLATTER_IBLOCK(glGetUniformLocation)
+GLATTER_IBLOCK(glGetUniformfv)
+GLATTER_IBLOCK(glGetUniformiv)
+GLATTER_IBLOCK(glGetVertexAttribPointerv)
+GLATTER_IBLOCK(glGetVertexAttribfv)
+GLATTER_IBLOCK(glGetVertexAttribiv)
+GLATTER_IBLOCK(glHint)
+GLATTER_IBLOCK(glIsBuffer)
+GLATTER_IBLOCK(glIsEnabled)
+GLATTER_IBLOCK(glIsFramebuffer)
+GLATTER_IBLOCK(glIsProgram)
+GLATTER_IBLOCK(glIsRenderbuffer)
+GLATTER_IBLOCK(glIsShader)
+GLATTER_IBLOCK(glIsTexture)
+GLATTER_IBLOCK(glLineWidth)
+GLATTER_IBLOCK(glLinkProgram)
+GLATTER_IBLOCK(glPixelStorei)
+GLATTER_IBLOCK(glPolygonOffset)
+GLATTER_IBLOCK(glReadPixels)
+GLATTER_IBLOCK(glReleaseShaderCompiler)
+GLATTER_IBLOCK(glRenderbufferStorage)
+GLATTER_IBLOCK(glSampleCoverage)
+GLATTER_IBLOCK(glScissor)
+GLATTER_IBLOCK(glShaderBinary)
+GLATTER_IBLOCK(glShaderSource)
+GLATTER_IBLOCK(glStencilFunc)
+GLATTER_IBLOCK(glStencilFuncSeparate)
+GLATTER_IBLOCK(glStencilMask)
+GLATTER_IBLOCK(glStencilMaskSeparate)
+GLATTER_IBLOCK(glStencilOp)
+GLATTER_IBLOCK(glStencilOpSeparate)
+GLATTER_IBLOCK(glTexImage2D)
+GLATTER_IBLOCK(glTexParameterf)
+GLATTER_IBLOCK(glTexParameterfv)
+GLATTER_IBLOCK(glTexParameteri)
+GLATTER_IBLOCK(glTexParameteriv)
+GLATTER_IBLOCK(glTexSubImage2D)
+GLATTER_IBLOCK(glUniform1f)
+GLATTER_IBLOCK(glUniform1fv)
+GLATTER_IBLOCK(glUniform1i)
+GLATTER_IBLOCK(glUniform1iv)
+GLATTER_IBLOCK(glUniform2f)
+GLATTER_IBLOCK(glUniform2fv)
+GLATTER_IBLOCK(glUniform2i)
+GLATTER_IBLOCK(glUniform2iv)
+GLATTER_IBLOCK(glUniform3f)
+GLATTER_IBLOCK(glUniform3fv)
+GLATTER_IBLOCK(glUniform3i)
+GLATTER_IBLOCK(glUniform3iv)
+GLATTER_IBLOCK(glUniform4f)
+GLATTER_IBLOCK(glUniform4fv)
+GLATTER_IBLOCK(glUniform4i)
+GLATTER_IBLOCK(glUniform4iv)
+GLATTER_IBLOCK(glUniformMatrix2fv)
+GLATTER_IBLOCK(glUniformMatrix3fv)
+GLATTER_IBLOCK(glUniformMatrix4fv)
+GLATTER_IBLOCK(glUseProgram)
+GLATTER_IBLOCK(glValidateProgram)
+GLATTER_IBLOCK(glVertexAttrib1f)
+GLATTER_IBLOCK(glVertexAttrib1fv)
+GLATTER_IBLOCK(glVertexAttrib2f)
+GLATTER_IBLOCK(glVertexAttrib2fv)
+GLATTER_IBLOCK(glVertexAttrib3f)
+GLATTER_IBLOCK(glVertexAttrib3fv)
+GLATTER_IBLOCK(glVertexAttrib4f)
+GLATTER_IBLOCK(glVertexAttrib4fv)
+GLATTER_IBLOCK(glVertexAttribPointer)
+GLATTER_IBLOCK(glViewport)
+#endif // defined(GL_ES_VERSION_2_0)
+#if defined(GL_ES_VERSION_3_0)
+GLATTER_IVERSION(3, 0)
+GLATTER_IBLOCK(glBeginQuery)
+GLATTER_IBLOCK(glBeginTransformFeedback)
+GLATTER_IBLOCK(glBindBufferBase)
+GLATTER_IBLOCK(glBindBufferRange)
+GLATTER_IBLOCK(glBindSampler)
+GLATTER_IBLOCK(glBindTransformFeedback)
+GLATTER_IBLOCK(glBindVertexArray)
+GLATTER_IBLOCK(glBlitFramebuffer)
+GLATTER_IBLOCK(glClearBufferfi)
+GLATTER_IBLOCK(glClearBufferfv)
+GLATTER_IBLOCK(glClearBufferiv)
+GLATTER_IBLOCK(glClearBufferuiv)
+GLATTER_IBLOCK(glClientWaitSync)
+GLATTER_IBLOCK(glCompressedTexImage3D)
+GLATTER_IBLOCK(glCompressedTexSubImage3D)
+GLATTER_IBLOCK(glCopyBufferSubData)
+GLATTER_IBLOCK(glCopyTexSubImage3D)
+GLATTER_IBLOCK(glDeleteQueries)
+GLATTER_IBLOCK(glDeleteSamplers)
+GLATTER_IBLOCK(glDeleteSync)
+GLATTER_IBLOCK(glDeleteTransformFeedbacks)
+GLATTER_IBLOCK(glDeleteVertexArrays)
+GLATTER_IBLOCK(glDrawArraysInstanced)
+GLATTER_IBLOCK(glDrawBuffers)
+GLATTER_IBLOCK(glDrawElementsInstanced)
+GLATTER_IBLOCK(glDrawRangeElements)
+GLATTER_IBLOCK(glEndQuery)
+GLATTER_IBLOCK(glEndTransformFeedback)
+GLATTER_IBLOCK(glFenceSync)
+GLATTER_IBLOCK(glFlushMappedBufferRange)
+GLATTER_IBLOCK(glFramebufferTextureLayer)
+GLATTER_IBLOCK(glGenQueries)
+GLATTER_IBLOCK(glGenSamplers)
+GLATTER_IBLOCK(glGenTransformFeedbacks)
+GLATTER_IBLOCK(glGenVertexArrays)
+GLATTER_IBLOCK(glGetActiveUniformBlockName)
+GLATTER_IBLOCK(glGetActiveUniformBlockiv)
+GLATTER_IBLOCK(glGetActiveUniformsiv)
+GLATTER_IBLOCK(glGetBufferParameteri64v)
+GLATTER_IBLOCK(glGetBufferPointerv)
+GLATTER_IBLOCK(glGetFragDataLocation)
+GLATTER_IBLOCK(glGetInteger64i_v)
+GLATTER_IBLOCK(glGetInteger64v)
+GLATTER_IBLOCK(glGetIntegeri_v)
+GLATTER_IBLOCK(glGetInternalformativ)
+GLATTER_IBLOCK(glGetProgramBinary)
+GLATTER_IBLOCK(glGetQueryObjectuiv)
+GLATTER_IBLOCK(glGetQueryiv)
+GLATTER_IBLOCK(glGetSamplerParameterfv)
+GLATTER_IBLOCK(glGetSamplerParameteriv)
+GLATTER_IBLOCK(glGetStringi)
+GLATTER_IBLOCK(glGetSynciv)
+GLATTER_IBLOCK(glGetTransformFeedbackVarying)
+GLATTER_IBLOCK(glGetUniformBlockIndex)
+GLATTER_IBLOCK(glGetUniformIndices)
+GLATTER_IBLOCK(glGetUniformuiv)
+GLATTER_IBLOCK(glGetVertexAttribIiv)
+GLATTER_IBLOCK(glGetVertexAttribIuiv)
+GLATTER_IBLOCK(glInvalidateFramebuffer)
+GLATTER_IBLOCK(glInvalidateSubFramebuffer)
+GLATTER_IBLOCK(glIsQuery)
+GLATTER_IBLOCK(glIsSampler)
+GLATTER_IBLOCK(glIsSync)
+GLATTER_IBLOCK(glIsTransformFeedback)
+GLATTER_IBLOCK(glIsVertexArray)
+GLATTER_IBLOCK(glMapBufferRange)
+GLATTER_IBLOCK(glPauseTransformFeedback)
+GLATTER_IBLOCK(glProgramBinary)
+GLATTER_IBLOCK(glProgramParameteri)
+GLATTER_IBLOCK(glReadBuffer)
+GLATTER_IBLOCK(glRenderbufferStorageMultisample)
+GLATTER_IBLOCK(glResumeTransformFeedback)
+GLATTER_IBLOCK(glSamplerParameterf)
+GLATTER_IBLOCK(glSamplerParameterfv)
+GLATTER_IBLOCK(glSamplerParameteri)
+GLATTER_IBLOCK(glSamplerParameteriv)
+GLATTER_IBLOCK(glTexImage3D)
+GLATTER_IBLOCK(glTexStorage2D)
+GLATTER_IBLOCK(glTexStorage3D)
+GLATTER_IBLOCK(glTexSubImage3D)
+GLATTER_IBLOCK(glTransformFeedbackVaryings)
+GLATTER_IBLOCK(glUniform1ui)
+GLATTER_IBLOCK(glUniform1uiv)
+GLATTER_IBLOCK(glUniform2ui)
+GLATTER_IBLOCK(glUniform2uiv)
+GLATTER_IBLOCK(glUniform3ui)
+GLATTER_IBLOCK(glUniform3uiv)
+GLATTER_IBLOCK(glUniform4ui)
+GLATTER_IBLOCK(glUniform4uiv)
+GLATTER_IBLOCK(glUniformBlockBinding)
+GLATTER_IBLOCK(glUniformMatrix2x3fv)
+GLATTER_IBLOCK(glUniformMatrix2x4fv)
+GLATTER_IBLOCK(glUniformMatrix3x2fv)
+GLATTER_IBLOCK(glUniformMatrix3x4fv)
+GLATTER_IBLOCK(glUniformMatrix4x2fv)
+GLATTER_IBLOCK(glUniformMatrix4x3fv)
+GLATTER_IBLOCK(glUnmapBuffer)
+GLATTER_IBLOCK(glVertexAttribDivisor)
+GLATTER_IBLOCK(glVertexAttribI4i)
+GLATTER_IBLOCK(glVertexAttribI4iv)
+GLATTER_IBLOCK(glVertexAttribI4ui)
+GLATTER_IBLOCK(glVertexAttribI4uiv)
+GLATTER_IBLOCK(glVertexAttribIPointer)
+GLATTER_IBLOCK(glWaitSync)
+#endif // defined(GL_ES_VERSION_3_0)
+#if defined(GL_ES_VERSION_3_1)
+GLATTER_IVERSION(3, 1)
+GLATTER_IBLOCK(glActiveShaderProgram)
+GLATTER_IBLOCK(glBindImageTexture)
+GLATTER_IBLOCK(glBindProgramPipeline)
+GLATTER_IBLOCK(glBindVertexBuffer)
+GLATTER_IBLOCK(glCreateShaderProgramv)
+GLATTER_IBLOCK(glDeleteProgramPipelines)
+GLATTER_IBLOCK(glDispatchCompute)
+GLATTER_IBLOCK(glDispatchComputeIndirect)
+GLATTER_IBLOCK(glDrawArraysIndirect)
+GLATTER_IBLOCK(glDrawElementsIndirect)
+GLATTER_IBLOCK(glFramebufferParameteri)
+GLATTER_IBLOCK(glGenProgramPipelines)
+GLATTER_IBLOCK(glGetBooleani_v)
+GLATTER_IBLOCK(glGetFramebufferParameteriv)
+GLATTER_IBLOCK(glGetMultisamplefv)
+GLATTER_IBLOCK(glGetProgramInterfaceiv)
+GLATTER_IBLOCK(glGetProgramPipelineInfoLog)
+GLATTER_IBLOCK(glGetProgramPipelineiv)
+GLATTER_IBLOCK(glGetProgramResourceIndex)
+GLATTER_IBLOCK(glGetProgramResourceLocation)
+GLATTER_IBLOCK(glGetProgramResourceName)
+GLATTER_IBLOCK(glGetProgramResourceiv)
+GLATTER_IBLOCK(glGetTexLevelParameterfv)
+GLATTER_IBLOCK(glGetTexLevelParameteriv)
+GLATTER_IBLOCK(glIsProgramPipeline)
+GLATTER_IBLOCK(glMemoryBarrier)
+GLATTER_IBLOCK(glMemoryBarrierByRegion)
+GLATTER_IBLOCK(glProgramUniform1f)
+GLATTER_IBLOCK(glProgramUniform1fv)
+GLATTER_IBLOCK(glProgramUniform1i)
+GLATTER_IBLOCK(glProgramUniform1iv)
+GLATTER_IBLOCK(glProgramUniform1ui)
+GLATTER_IBLOCK(glProgramUniform1uiv)
+GLATTER_IBLOCK(glProgramUniform2f)
+GLATTER_IBLOCK(glProgramUniform2fv)
+GLATTER_IBLOCK(glProgramUniform2i)
+GLATTER_IBLOCK(glProgramUniform2iv)
+GLATTER_IBLOCK(glProgramUniform2ui)
+GLATTER_IBLOCK(glProgramUniform2uiv)
+GLATTER_IBLOCK(glProgramUniform3f)
+GLATTER_IBLOCK(glProgramUniform3fv)
+GLATTER_IBLOCK(glProgramUniform3i)
+GLATTER_IBLOCK(glProgramUniform3iv)
+GLATTER_IBLOCK(glProgramUniform3ui)
+GLATTER_IBLOCK(glProgramUniform3uiv)
+GLATTER_IBLOCK(glProgramUniform4f)
+GLATTER_IBLOCK(glProgramUniform4fv)
+GLATTER_IBLOCK(glProgramUniform4i)
+GLATTER_IBLOCK(glProgramUniform4iv)
+GLATTER_IBLOCK(glProgramUniform4ui)
+GLATTER_IBLOCK(glProgramUniform4uiv)
+GLATTER_IBLOCK(glProgramUniformMatrix2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3fv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3fv)
+GLATTER_IBLOCK(glSampleMaski)
+GLATTER_IBLOCK(glTexStorage2DMultisample)
+GLATTER_IBLOCK(glUseProgramStages)
+GLATTER_IBLOCK(glValidateProgramPipeline)
+GLATTER_IBLOCK(glVertexAttribBinding)
+GLATTER_IBLOCK(glVertexAttribFormat)
+GLATTER_IBLOCK(glVertexAttribIFormat)
+GLATTER_IBLOCK(glVertexBindingDivisor)
+#endif // defined(GL_ES_VERSION_3_1)
+#if defined(GL_ES_VERSION_3_2)
+GLATTER_IVERSION(3, 2)
+GLATTER_IBLOCK(glBlendBarrier)
+GLATTER_IBLOCK(glBlendEquationSeparatei)
+GLATTER_IBLOCK(glBlendEquationi)
+GLATTER_IBLOCK(glBlendFuncSeparatei)
+GLATTER_IBLOCK(glBlendFunci)
+GLATTER_IBLOCK(glColorMaski)
+GLATTER_IBLOCK(glCopyImageSubData)
+GLATTER_IBLOCK(glDebugMessageCallback)
+GLATTER_IBLOCK(glDebugMessageControl)
+GLATTER_IBLOCK(glDebugMessageInsert)
+GLATTER_IBLOCK(glDisablei)
+GLATTER_IBLOCK(glDrawElementsBaseVertex)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseVertex)
+GLATTER_IBLOCK(glDrawRangeElementsBaseVertex)
+GLATTER_IBLOCK(glEnablei)
+GLATTER_IBLOCK(glFramebufferTexture)
+GLATTER_IBLOCK(glGetDebugMessageLog)
+GLATTER_IBLOCK(glGetGraphicsResetStatus)
+GLATTER_IBLOCK(glGetObjectLabel)
+GLATTER_IBLOCK(glGetObjectPtrLabel)
+GLATTER_IBLOCK(glGetPointerv)
+GLATTER_IBLOCK(glGetSamplerParameterIiv)
+GLATTER_IBLOCK(glGetSamplerParameterIuiv)
+GLATTER_IBLOCK(glGetTexParameterIiv)
+GLATTER_IBLOCK(glGetTexParameterIuiv)
+GLATTER_IBLOCK(glGetnUniformfv)
+GLATTER_IBLOCK(glGetnUniformiv)
+GLATTER_IBLOCK(glGetnUniformuiv)
+GLATTER_IBLOCK(glIsEnabledi)
+GLATTER_IBLOCK(glMinSampleShading)
+GLATTER_IBLOCK(glObjectLabel)
+GLATTER_IBLOCK(glObjectPtrLabel)
+GLATTER_IBLOCK(glPatchParameteri)
+GLATTER_IBLOCK(glPopDebugGroup)
+GLATTER_IBLOCK(glPrimitiveBoundingBox)
+GLATTER_IBLOCK(glPushDebugGroup)
+GLATTER_IBLOCK(glReadnPixels)
+GLATTER_IBLOCK(glSamplerParameterIiv)
+GLATTER_IBLOCK(glSamplerParameterIuiv)
+GLATTER_IBLOCK(glTexBuffer)
+GLATTER_IBLOCK(glTexBufferRange)
+GLATTER_IBLOCK(glTexParameterIiv)
+GLATTER_IBLOCK(glTexParameterIuiv)
+GLATTER_IBLOCK(glTexStorage3DMultisample)
+#endif // defined(GL_ES_VERSION_3_2)
+#endif // defined(__gles2_gl32_h_)
+#if defined(__gles2_gl3_h_)
+#if defined(GL_ES_VERSION_2_0)
+GLATTER_IVERSION(2, 0)
+GLATTER_IBLOCK(glActiveTexture)
+GLATTER_IBLOCK(glAttachShader)
+GLATTER_IBLOCK(glBindAttribLocation)
+GLATTER_IBLOCK(glBindBuffer)
+GLATTER_IBLOCK(glBindFramebuffer)
+GLATTER_IBLOCK(glBindRenderbuffer)
+GLATTER_IBLOCK(glBindTexture)
+GLATTER_IBLOCK(glBlendColor)
+GLATTER_IBLOCK(glBlendEquation)
+GLATTER_IBLOCK(glBlendEquationSeparate)
+GLATTER_IBLOCK(glBlendFunc)
+GLATTER_IBLOCK(glBlendFuncSeparate)
+GLATTER_IBLOCK(glBufferData)
+GLATTER_IBLOCK(glBufferSubData)
+GLATTER_IBLOCK(glCheckFramebufferStatus)
+GLATTER_IBLOCK(glClear)
+GLATTER_IBLOCK(glClearColor)
+GLATTER_IBLOCK(glClearDepthf)
+GLATTER_IBLOCK(glClearStencil)
+GLATTER_IBLOCK(glColorMask)
+GLATTER_IBLOCK(glCompileShader)
+GLATTER_IBLOCK(glCompressedTexImage2D)
+GLATTER_IBLOCK(glCompressedTexSubImage2D)
+GLATTER_IBLOCK(glCopyTexImage2D)
+GLATTER_IBLOCK(glCopyTexSubImage2D)
+GLATTER_IBLOCK(glCreateProgram)
+GLATTER_IBLOCK(glCreateShader)
+GLATTER_IBLOCK(glCullFace)
+GLATTER_IBLOCK(glDeleteBuffers)
+GLATTER_IBLOCK(glDeleteFramebuffers)
+GLATTER_IBLOCK(glDeleteProgram)
+GLATTER_IBLOCK(glDeleteRenderbuffers)
+GLATTER_IBLOCK(glDeleteShader)
+GLATTER_IBLOCK(glDeleteTextures)
+GLATTER_IBLOCK(glDepthFunc)
+GLATTER_IBLOCK(glDepthMask)
+GLATTER_IBLOCK(glDepthRangef)
+GLATTER_IBLOCK(glDetachShader)
+GLATTER_IBLOCK(glDisable)
+GLATTER_IBLOCK(glDisableVertexAttribArray)
+GLATTER_IBLOCK(glDrawArrays)
+GLATTER_IBLOCK(glDrawElements)
+GLATTER_IBLOCK(glEnable)
+GLATTER_IBLOCK(glEnableVertexAttribArray)
+GLATTER_IBLOCK(glFinish)
+GLATTER_IBLOCK(glFlush)
+GLATTER_IBLOCK(glFramebufferRenderbuffer)
+GLATTER_IBLOCK(glFramebufferTexture2D)
+GLATTER_IBLOCK(glFrontFace)
+GLATTER_IBLOCK(glGenBuffers)
+GLATTER_IBLOCK(glGenFramebuffers)
+GLATTER_IBLOCK(glGenRenderbuffers)
+GLATTER_IBLOCK(glGenTextures)
+GLATTER_IBLOCK(glGenerateMipmap)
+GLATTER_IBLOCK(glGetActiveAttrib)
+GLATTER_IBLOCK(glGetActiveUniform)
+GLATTER_IBLOCK(glGetAttachedShaders)
+GLATTER_IBLOCK(glGetAttribLocation)
+GLATTER_IBLOCK(glGetBooleanv)
+GLATTER_IBLOCK(glGetBufferParameteriv)
+GLATTER_IBLOCK(glGetError)
+GLATTER_IBLOCK(glGetFloatv)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameteriv)
+GLATTER_IBLOCK(glGetIntegerv)
+GLATTER_IBLOCK(glGetProgramInfoLog)
+GLATTER_IBLOCK(glGetProgramiv)
+GLATTER_IBLOCK(glGetRenderbufferParameteriv)
+GLATTER_IBLOCK(glGetShaderInfoLog)
+GLATTER_IBLOCK(glGetShaderPrecisionFormat)
+GLATTER_IBLOCK(glGetShaderSource)
+GLATTER_IBLOCK(glGetShaderiv)
+GLATTER_IBLOCK(glGetString)
+GLATTER_IBLOCK(glGetTexParameterfv)
+GLATTER_IBLOCK(glGetTexParameteriv)
+GLATTER_IBLOCK(glGetUniformLocation)
+GLATTER_IBLOCK(glGetUniformfv)
+GLATTER_IBLOCK(glGetUniformiv)
+GLATTER_IBLOCK(glGetVertexAttribPointerv)
+GLATTER_IBLOCK(glGetVertexAttribfv)
+GLATTER_IBLOCK(glGetVertexAttribiv)
+GLATTER_IBLOCK(glHint)
+GLATTER_IBLOCK(glIsBuffer)
+GLATTER_IBLOCK(glIsEnabled)
+GLATTER_IBLOCK(glIsFramebuffer)
+GLATTER_IBLOCK(glIsProgram)
+GLATTER_IBLOCK(glIsRenderbuffer)
+GLATTER_IBLOCK(glIsShader)
+GLATTER_IBLOCK(glIsTexture)
+GLATTER_IBLOCK(glLineWidth)
+GLATTER_IBLOCK(glLinkProgram)
+GLATTER_IBLOCK(glPixelStorei)
+GLATTER_IBLOCK(glPolygonOffset)
+GLATTER_IBLOCK(glReadPixels)
+GLATTER_IBLOCK(glReleaseShaderCompiler)
+GLATTER_IBLOCK(glRenderbufferStorage)
+GLATTER_IBLOCK(glSampleCoverage)
+GLATTER_IBLOCK(glScissor)
+GLATTER_IBLOCK(glShaderBinary)
+GLATTER_IBLOCK(glShaderSource)
+GLATTER_IBLOCK(glStencilFunc)
+GLATTER_IBLOCK(glStencilFuncSeparate)
+GLATTER_IBLOCK(glStencilMask)
+GLATTER_IBLOCK(glStencilMaskSeparate)
+GLATTER_IBLOCK(glStencilOp)
+GLATTER_IBLOCK(glStencilOpSeparate)
+GLATTER_IBLOCK(glTexImage2D)
+GLATTER_IBLOCK(glTexParameterf)
+GLATTER_IBLOCK(glTexParameterfv)
+GLATTER_IBLOCK(glTexParameteri)
+GLATTER_IBLOCK(glTexParameteriv)
+GLATTER_IBLOCK(glTexSubImage2D)
+GLATTER_IBLOCK(glUniform1f)
+GLATTER_IBLOCK(glUniform1fv)
+GLATTER_IBLOCK(glUniform1i)
+GLATTER_IBLOCK(glUniform1iv)
+GLATTER_IBLOCK(glUniform2f)
+GLATTER_IBLOCK(glUniform2fv)
+GLATTER_IBLOCK(glUniform2i)
+GLATTER_IBLOCK(glUniform2iv)
+GLATTER_IBLOCK(glUniform3f)
+GLATTER_IBLOCK(glUniform3fv)
+GLATTER_IBLOCK(glUniform3i)
+GLATTER_IBLOCK(glUniform3iv)
+GLATTER_IBLOCK(glUniform4f)
+GLATTER_IBLOCK(glUniform4fv)
+GLATTER_IBLOCK(glUniform4i)
+GLATTER_IBLOCK(glUniform4iv)
+GLATTER_IBLOCK(glUniformMatrix2fv)
+GLATTER_IBLOCK(glUniformMatrix3fv)
+GLATTER_IBLOCK(glUniformMatrix4fv)
+GLATTER_IBLOCK(glUseProgram)
+GLATTER_IBLOCK(glValidateProgram)
+GLATTER_IBLOCK(glVertexAttrib1f)
+GLATTER_IBLOCK(glVertexAttrib1fv)
+GLATTER_IBLOCK(glVertexAttrib2f)
+GLATTER_IBLOCK(glVertexAttrib2fv)
+GLATTER_IBLOCK(glVertexAttrib3f)
+GLATTER_IBLOCK(glVertexAttrib3fv)
+GLATTER_IBLOCK(glVertexAttrib4f)
+GLATTER_IBLOCK(glVertexAttrib4fv)
+GLATTER_IBLOCK(glVertexAttribPointer)
+GLATTER_IBLOCK(glViewport)
+#endif // defined(GL_ES_VERSION_2_0)
+#if defined(GL_ES_VERSION_3_0)
+GLATTER_IVERSION(3, 0)
+GLATTER_IBLOCK(glBeginQuery)
+GLATTER_IBLOCK(glBeginTransformFeedback)
+GLATTER_IBLOCK(glBindBufferBase)
+GLATTER_IBLOCK(glBindBufferRange)
+GLATTER_IBLOCK(glBindSampler)
+GLATTER_IBLOCK(glBindTransformFeedback)
+GLATTER_IBLOCK(glBindVertexArray)
+GLATTER_IBLOCK(glBlitFramebuffer)
+GLATTER_IBLOCK(glClearBufferfi)
+GLATTER_IBLOCK(glClearBufferfv)
+GLATTER_IBLOCK(glClearBufferiv)
+GLATTER_IBLOCK(glClearBufferuiv)
+GLATTER_IBLOCK(glClientWaitSync)
+GLATTER_IBLOCK(glCompressedTexImage3D)
+GLATTER_IBLOCK(glCompressedTexSubImage3D)
+GLATTER_IBLOCK(glCopyBufferSubData)
+GLATTER_IBLOCK(glCopyTexSubImage3D)
+GLATTER_IBLOCK(glDeleteQueries)
+GLATTER_IBLOCK(glDeleteSamplers)
+GLATTER_IBLOCK(glDeleteSync)
+GLATTER_IBLOCK(glDeleteTransformFeedbacks)
+GLATTER_IBLOCK(glDeleteVertexArrays)
+GLATTER_IBLOCK(glDrawArraysInstanced)
+GLATTER_IBLOCK(glDrawBuffers)
+GLATTER_IBLOCK(glDrawElementsInstanced)
+GLATTER_IBLOCK(glDrawRangeElements)
+GLATTER_IBLOCK(glEndQuery)
+GLATTER_IBLOCK(glEndTransformFeedback)
+GLATTER_IBLOCK(glFenceSync)
+GLATTER_IBLOCK(glFlushMappedBufferRange)
+GLATTER_IBLOCK(glFramebufferTextureLayer)
+GLATTER_IBLOCK(glGenQueries)
+GLATTER_IBLOCK(glGenSamplers)
+GLATTER_IBLOCK(glGenTransformFeedbacks)
+GLATTER_IBLOCK(glGenVertexArrays)
+GLATTER_IBLOCK(glGetActiveUniformBlockName)
+GLATTER_IBLOCK(glGetActiveUniformBlockiv)
+GLATTER_IBLOCK(glGetActiveUniformsiv)
+GLATTER_IBLOCK(glGetBufferParameteri64v)
+GLATTER_IBLOCK(glGetBufferPointerv)
+GLATTER_IBLOCK(glGetFragDataLocation)
+GLATTER_IBLOCK(glGetInteger64i_v)
+GLATTER_IBLOCK(glGetInteger64v)
+GLATTER_IBLOCK(glGetIntegeri_v)
+GLATTER_IBLOCK(glGetInternalformativ)
+GLATTER_IBLOCK(glGetProgramBinary)
+GLATTER_IBLOCK(glGetQueryObjectuiv)
+GLATTER_IBLOCK(glGetQueryiv)
+GLATTER_IBLOCK(glGetSamplerParameterfv)
+GLATTER_IBLOCK(glGetSamplerParameteriv)
+GLATTER_IBLOCK(glGetStringi)
+GLATTER_IBLOCK(glGetSynciv)
+GLATTER_IBLOCK(glGetTransformFeedbackVarying)
+GLATTER_IBLOCK(glGetUniformBlockIndex)
+GLATTER_IBLOCK(glGetUniformIndices)
+GLATTER_IBLOCK(glGetUniformuiv)
+GLATTER_IBLOCK(glGetVertexAttribIiv)
+GLATTER_IBLOCK(glGetVertexAttribIuiv)
+GLATTER_IBLOCK(glInvalidateFramebuffer)
+GLATTER_IBLOCK(glInvalidateSubFramebuffer)
+GLATTER_IBLOCK(glIsQuery)
+GLATTER_IBLOCK(glIsSampler)
+GLATTER_IBLOCK(glIsSync)
+GLATTER_IBLOCK(glIsTransformFeedback)
+GLATTER_IBLOCK(glIsVertexArray)
+GLATTER_IBLOCK(glMapBufferRange)
+GLATTER_IBLOCK(glPauseTransformFeedback)
+GLATTER_IBLOCK(glProgramBinary)
+GLATTER_IBLOCK(glProgramParameteri)
+GLATTER_IBLOCK(glReadBuffer)
+GLATTER_IBLOCK(glRenderbufferStorageMultisample)
+GLATTER_IBLOCK(glResumeTransformFeedback)
+GLATTER_IBLOCK(glSamplerParameterf)
+GLATTER_IBLOCK(glSamplerParameterfv)
+GLATTER_IBLOCK(glSamplerParameteri)
+GLATTER_IBLOCK(glSamplerParameteriv)
+GLATTER_IBLOCK(glTexImage3D)
+GLATTER_IBLOCK(glTexStorage2D)
+GLATTER_IBLOCK(glTexStorage3D)
+GLATTER_IBLOCK(glTexSubImage3D)
+GLATTER_IBLOCK(glTransformFeedbackVaryings)
+GLATTER_IBLOCK(glUniform1ui)
+GLATTER_IBLOCK(glUniform1uiv)
+GLATTER_IBLOCK(glUniform2ui)
+GLATTER_IBLOCK(glUniform2uiv)
+GLATTER_IBLOCK(glUniform3ui)
+GLATTER_IBLOCK(glUniform3uiv)
+GLATTER_IBLOCK(glUniform4ui)
+GLATTER_IBLOCK(glUniform4uiv)
+GLATTER_IBLOCK(glUniformBlockBinding)
+GLATTER_IBLOCK(glUniformMatrix2x3fv)
+GLATTER_IBLOCK(glUniformMatrix2x4fv)
+GLATTER_IBLOCK(glUniformMatrix3x2fv)
+GLATTER_IBLOCK(glUniformMatrix3x4fv)
+GLATTER_IBLOCK(glUniformMatrix4x2fv)
+GLATTER_IBLOCK(glUniformMatrix4x3fv)
+GLATTER_IBLOCK(glUnmapBuffer)
+GLATTER_IBLOCK(glVertexAttribDivisor)
+GLATTER_IBLOCK(glVertexAttribI4i)
+GLATTER_IBLOCK(glVertexAttribI4iv)
+GLATTER_IBLOCK(glVertexAttribI4ui)
+GLATTER_IBLOCK(glVertexAttribI4uiv)
+GLATTER_IBLOCK(glVertexAttribIPointer)
+GLATTER_IBLOCK(glWaitSync)
+#endif // defined(__gles2_gl3_h_)
+#endif // defined(GL_ES_VERSION_3_0)
+#endif // GLATTER_GL
+
@@ -0,0 +1,2220 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Perfect hash of every entry point name known to this platform, used by
+ * glatter_get_proc_address to cache resolved addresses (see glatter_def.h).
+ * The arrays are not const so that they can be link-once in header-only mode,
+ * but nothing writes to them. */
+
+#define GLATTER_ENTRY_POINT_COUNT 1233
+#define GLATTER_ENTRY_POINT_SLOTS 2048
+#define GLATTER_ENTRY_POINT_BUCKETS 1024
+
+GLATTER_LINKONCE uint32_t glatter_entry_point_seeds[GLATTER_ENTRY_POINT_BUCKETS] = {
+    1, 0, 2, 1, 4, 1, 0, 1,
+    1, 0, 0, 1, 1, 3, 0, 1,
+    0, 1, 0, 2, 2, 1, 1, 0,
+    2, 2, 0, 1, 1, 3, 2, 1,
+    0, 0, 1, 1, 0, 0, 0, 2,
+    1, 0, 1, 1, 3, 0, 1, 3,
+    0, 2, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 0, 2, 2, 0,
+    4, 1, 2, 2, 1, 1, 2, 1,
+    2, 0, 0, 0, 0, 0, 1, 0,
+    2, 1, 1, 2, 1, 1, 5, 1,
+    2, 4, 1, 1, 1, 0, 0, 0,
+    1, 3, 2, 2, 3, 0, 1, 3,
+    0, 1, 1, 2, 1, 3, 0, 1,
+    0, 1, 0, 7, 1, 3, 1, 0,
+    1, 0, 3, 4, 1, 2, 1, 1,
+    0, 2, 2, 1, 0, 1, 1, 3,
+    0, 2, 0, 4, 0, 0, 2, 0,
+    1, 2, 0, 0, 0, 1, 1, 2,
+    1, 3, 0, 0, 2, 1, 1, 1,
+    0, 2, 1, 2, 1, 1, 4, 0,
+    4, 0, 4, 1, 1, 1, 2, 0,
+    1, 0, 1, 1, 2, 1, 0, 0,
+    1, 3, 5, 2, 1, 0, 2, 1,
+    4, 0, 2, 4, 1, 2, 0, 1,
+    1, 0, 2, 0, 0, 1, 1, 0,
+    0, 1, 1, 1, 3, 0, 6, 1,
+    2, 1, 4, 1, 0, 3, 3, 3,
+    2, 2, 2, 2, 1, 0, 1, 0,
+    1, 2, 0, 0, 3, 1, 1, 2,
+    1, 3, 0, 1, 3, 2, 1, 0,
+    1, 5, 3, 1, 2, 1, 0, 1,
+    3, 1, 1, 2, 1, 0, 1, 0,
+    0, 0, 0, 1, 1, 0, 1, 1,
+    2, 2, 3, 2, 1, 0, 1, 3,
+    0, 1, 0, 2, 3, 2, 1, 2,
+    2, 4, 0, 0, 2, 0, 2, 1,
+    2, 1, 1, 0, 4, 0, 1, 1,
+    1, 1, 3, 2, 1, 0, 3, 3,
+    0, 1, 2, 0, 0, 1, 2, 0,
+    1, 1, 1, 0, 1, 2, 0, 3,
+    3, 1, 0, 3, 1, 3, 0, 0,
+    0, 2, 1, 1, 0, 0, 1, 1,
+    2, 3, 1, 0, 1, 0, 1, 2,
+    0, 0, 1, 1, 1, 1, 1, 2,
+    3, 6, 2, 1, 2, 1, 4, 5,
+    1, 1, 2, 1, 2, 1, 4, 1,
+    2, 2, 3, 0, 3, 2, 1, 1,
+    1, 1, 1, 0, 2, 0, 1, 0,
+    0, 3, 1, 1, 3, 1, 2, 8,
+    1, 1, 0, 1, 0, 2, 1, 2,
+    1, 3, 5, 1, 2, 1, 1, 1,
+    3, 3, 2, 1, 0, 0, 0, 0,
+    1, 4, 0, 5, 3, 0, 1, 1,
+    0, 1, 4, 0, 0, 4, 1, 0,
+    1, 2, 3, 3, 0, 4, 1, 0,
+    3, 5, 1, 1, 0, 3, 2, 0,
+    1, 2, 1, 0, 0, 10, 1, 0,
+    4, 2, 0, 0, 1, 1, 0, 1,
+    2, 2, 1, 0, 1, 1, 0, 0,
+    0, 0, 0, 1, 1, 2, 0, 2,
+    5, 1, 0, 4, 0, 2, 0, 1,
+    0, 0, 1, 0, 4, 1, 2, 0,
+    0, 1, 1, 1, 0, 0, 3, 1,
+    1, 1, 1, 2, 3, 0, 2, 0,
+    2, 0, 0, 0, 0, 4, 10, 0,
+    0, 1, 11, 1, 5, 1, 1, 7,
+    3, 0, 5, 0, 1, 0, 0, 0,
+    0, 1, 2, 1, 4, 2, 0, 0,
+    3, 0, 1, 1, 0, 2, 2, 1,
+    2, 3, 1, 3, 6, 4, 4, 0,
+    1, 1, 2, 2, 5, 0, 1, 4,
+    1, 0, 3, 1, 3, 1, 1, 2,
+    1, 2, 5, 3, 4, 0, 2, 0,
+    2, 1, 1, 3, 1, 2, 0, 1,
+    1, 2, 0, 2, 0, 0, 2, 0,
+    3, 0, 4, 1, 0, 3, 2, 1,
+    6, 2, 0, 0, 5, 0, 0, 1,
+    1, 1, 8, 1, 1, 6, 0, 2,
+    6, 1, 1, 0, 0, 1, 1, 4,
+    2, 0, 1, 3, 1, 5, 0, 4,
+    0, 2, 0, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 2, 0, 2, 3,
+    0, 3, 1, 1, 1, 0, 0, 0,
+    1, 8, 0, 2, 1, 0, 1, 0,
+    0, 7, 2, 6, 1, 0, 3, 2,
+    2, 2, 2, 2, 7, 1, 1, 2,
+    0, 7, 0, 1, 3, 3, 0, 1,
+    6, 2, 4, 1, 9, 5, 1, 3,
+    0, 0, 1, 4, 0, 0, 5, 4,
+    1, 0, 0, 5, 1, 3, 2, 6,
+    2, 3, 1, 7, 0, 1, 1, 2,
+    2, 1, 3, 3, 0, 3, 0, 0,
+    1, 5, 1, 3, 1, 0, 2, 1,
+    1, 6, 1, 0, 2, 2, 1, 0,
+    2, 0, 2, 1, 0, 1, 1, 2,
+    1, 2, 1, 1, 2, 2, 0, 2,
+    0, 1, 0, 1, 1, 1, 1, 2,
+    2, 2, 1, 1, 4, 0, 3, 1,
+    2, 1, 1, 1, 0, 1, 1, 3,
+    1, 1, 1, 0, 2, 1, 0, 0,
+    0, 0, 1, 1, 0, 1, 1, 1,
+    0, 1, 1, 0, 3, 2, 0, 0,
+    5, 2, 1, 0, 1, 2, 0, 1,
+    2, 5, 2, 1, 3, 3, 0, 3,
+    0, 1, 0, 1, 0, 5, 2, 1,
+    5, 3, 1, 1, 1, 3, 9, 2,
+    1, 1, 3, 0, 4, 0, 1, 1,
+    4, 1, 0, 4, 3, 9, 0, 1,
+    1, 2, 3, 1, 0, 0, 3, 0,
+    1, 1, 1, 2, 0, 3, 1, 1,
+    3, 0, 4, 1, 2, 0, 0, 2,
+    13, 1, 1, 1, 6, 1, 1, 1,
+    1, 0, 2, 1, 1, 1, 0, 0,
+    2, 0, 0, 0, 1, 1, 2, 0,
+    0, 1, 0, 0, 0, 1, 0, 4,
+    0, 1, 3, 4, 0, 0, 0, 1,
+    1, 1, 0, 4, 1, 1, 5, 0,
+    0, 1, 0, 1, 0, 2, 2, 0,
+    1, 3, 3, 0, 0, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 10, 3,
+    7, 2, 0, 0, 0, 0, 0, 0,
+    1, 2, 0, 0, 0, 0, 0, 1,
+    1, 1, 0, 1, 5, 1, 2, 1,
+    2, 0, 3, 1, 0, 5, 10, 2,
+    0, 0, 3, 2, 1, 1, 0, 0,
+    8, 1, 2, 0, 1, 0, 1, 0,
+    0, 0, 0, 1, 2, 0, 1, 0,
+};
+
+GLATTER_LINKONCE const char* glatter_entry_point_names[GLATTER_ENTRY_POINT_SLOTS] = {
+    "glGetSamplerParameterIivOES",
+    "glDrawElementsInstanced",
+    "glMapBufferRange",
+    NULL,
+    NULL,
+    "glGetInternalformatSampleivNV",
+    "glClipPlanef",
+    "eglCompositorBindTexWindowEXT",
+    "glGetQueryObjectuivEXT",
+    "glBindBuffer",
+    NULL,
+    "eglQueryDebugKHR",
+    "glUniform3ui64NV",
+    NULL,
+    "glVertexBindingDivisor",
+    "glGetDebugMessageLogKHR",
+    "glVertexAttribDivisor",
+    "glMinSampleShadingOES",
+    "glExtGetRenderbuffersQCOM",
+    NULL,
+    NULL,
+    "glVertexAttribPointer",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glPathMemoryGlyphIndexArrayNV",
+    "glDrawRangeElements",
+    NULL,
+    "glTexImage2D",
+    "glPathParameterfvNV",
+    "glDrawArraysInstancedEXT",
+    "glProgramUniformMatrix4x2fv",
+    "glSampleCoveragex",
+    "glUniformMatrix3x2fvNV",
+    "glMultiTexCoord4xOES",
+    "glGetTexEnviv",
+    NULL,
+    "eglStreamConsumerGLTextureExternalAttribsNV",
+    "glPolygonOffsetClampEXT",
+    "glUniform1i64vNV",
+    "glLoadMatrixxOES",
+    NULL,
+    "glUniform1ui64NV",
+    "glClearBufferfi",
+    "eglSetDamageRegionKHR",
+    "eglWaitGL",
+    "eglGetSyncAttrib",
+    NULL,
+    "glObjectLabelKHR",
+    "eglPostSubBufferNV",
+    NULL,
+    "glEnableDriverControlQCOM",
+    "glGetProgramInterfaceiv",
+    "glVertexAttribBinding",
+    NULL,
+    NULL,
+    "glGetPathLengthNV",
+    NULL,
+    NULL,
+    "glFramebufferPixelLocalStorageSizeEXT",
+    "glProgramUniform3ui64vNV",
+    NULL,
+    "glCopyBufferSubDataNV",
+    "glApplyFramebufferAttachmentCMAAINTEL",
+    "glDeleteRenderbuffersOES",
+    NULL,
+    "eglStreamAttribKHR",
+    NULL,
+    NULL,
+    "glBlendFunci",
+    NULL,
+    "glGetTexParameterIiv",
+    "glIsSyncAPPLE",
+    NULL,
+    NULL,
+    NULL,
+    "glBlendEquationSeparateiEXT",
+    "eglStreamConsumerReleaseKHR",
+    "glGetTexParameterIivOES",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glIsVertexArray",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glGetObjectPtrLabelKHR",
+    NULL,
+    NULL,
+    "glLoadMatrixx",
+    "glProgramUniform3iEXT",
+    NULL,
+    "glStencilThenCoverStrokePathNV",
+    "eglCreateWindowSurface",
+    "glIsSync",
+    "glProgramUniform4i",
+    "glUniformMatrix2fv",
+    "eglQueryDisplayAttribKHR",
+    "glProgramUniform1fEXT",
+    "glGetPathMetricRangeNV",
+    NULL,
+    NULL,
+    "eglQueryDeviceAttribEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "eglBindAPI",
+    "glPointParameterfv",
+    "glUniform4fv",
+    "glCoverFillPathNV",
+    NULL,
+    NULL,
+    NULL,
+    "glTexStorage2DEXT",
+    "glUniformMatrix2x4fvNV",
+    "glCompressedTexSubImage3D",
+    NULL,
+    "glProgramParameteri",
+    NULL,
+    NULL,
+    "glGetFragmentShadingRatesEXT",
+    "glDepthRangeIndexedfOES",
+    "eglGetStreamFileDescriptorKHR",
+    "glPathStencilFuncNV",
+    "glGetUniformuiv",
+    "glGenSemaphoresEXT",
+    NULL,
+    "glTexParameterxv",
+    NULL,
+    NULL,
+    NULL,
+    "glDepthFunc",
+    "glGenVertexArraysOES",
+    "glGetProgramResourceLocationIndexEXT",
+    NULL,
+    "glClearDepthxOES",
+    "glGenVertexArrays",
+    NULL,
+    "glCreateShaderProgramvEXT",
+    "glMatrixMult3x3fNV",
+    "glDisableClientState",
+    NULL,
+    "glPolygonModeNV",
+    NULL,
+    "glLogicOp",
+    NULL,
+    "glExtrapolateTex2DQCOM",
+    NULL,
+    NULL,
+    "glUniform3i64NV",
+    "eglWaitClient",
+    "glGetPerfCounterInfoINTEL",
+    NULL,
+    "glTexGenfvOES",
+    "glGetQueryiv",
+    "glGetInteger64vEXT",
+    "glGetQueryObjecti64vEXT",
+    "eglDestroyDisplayEXT",
+    "glTexEnvxvOES",
+    "glClearTexSubImageEXT",
+    "glEnableiOES",
+    "glDepthRangefOES",
+    "glOrthof",
+    NULL,
+    "glCopyTexSubImage3D",
+    "glIsPointInFillPathNV",
+    "glGetProgramPipelineInfoLogEXT",
+    "eglGetError",
+    NULL,
+    NULL,
+    NULL,
+    "eglQueryOutputLayerAttribEXT",
+    "eglCreatePixmapSurface",
+    NULL,
+    NULL,
+    "glGetSamplerParameterIuivOES",
+    NULL,
+    "glNamedBufferStorageExternalEXT",
+    "glDrawRangeElementsBaseVertexEXT",
+    NULL,
+    "glCreatePerfQueryINTEL",
+    "glCopyTexImage2D",
+    "glMaterialfv",
+    "glDeleteSyncAPPLE",
+    NULL,
+    NULL,
+    NULL,
+    "eglGetOutputPortsEXT",
+    "glDrawElementsInstancedBaseInstanceEXT",
+    "glLightfv",
+    "glUniform3i",
+    NULL,
+    "glUniform3i64vNV",
+    "glFramebufferTextureLayer",
+    "glFogf",
+    NULL,
+    NULL,
+    "glTexParameterfv",
+    NULL,
+    "glUnmapBuffer",
+    "glIsRenderbufferOES",
+    NULL,
+    "glVertexAttribFormat",
+    "glDrawArraysIndirect",
+    "glIsShader",
+    "glGetTexParameteriv",
+    "eglDestroySync",
+    "glIsTextureHandleResidentNV",
+    NULL,
+    "glClearTexImageEXT",
+    "glClipPlanefOES",
+    NULL,
+    NULL,
+    "glProgramUniform2ivEXT",
+    NULL,
+    "glTexStorageMem3DEXT",
+    NULL,
+    "eglWaitNative",
+    NULL,
+    NULL,
+    "glFrustumxOES",
+    "glGetSyncivAPPLE",
+    NULL,
+    "glGenTextures",
+    "glAcquireKeyedMutexWin32EXT",
+    "glGetMaterialfv",
+    "glDebugMessageControl",
+    "glProgramUniform2ui64NV",
+    NULL,
+    NULL,
+    "glBlendEquationSeparateOES",
+    "glGetSynciv",
+    NULL,
+    NULL,
+    NULL,
+    "glPointParameterxOES",
+    "eglStreamConsumerGLTextureExternalKHR",
+    "glGetnUniformfvEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glMatrixMode",
+    "eglStreamConsumerAcquireAttribKHR",
+    "glFogfv",
+    "glDrawTexfvOES",
+    "glFramebufferTexture2DMultisampleIMG",
+    "glMatrixIndexPointerOES",
+    "glLightModelf",
+    "glIsEnablediOES",
+    NULL,
+    "glVertexAttrib1fv",
+    "glClearColorx",
+    NULL,
+    "glVertexAttribI4uiv",
+    "glUniformBlockBinding",
+    NULL,
+    NULL,
+    "glViewport",
+    "glUniformMatrix3x4fvNV",
+    NULL,
+    "glPauseTransformFeedback",
+    NULL,
+    "glProgramUniform4fvEXT",
+    NULL,
+    "eglExportDRMImageMESA",
+    "glMatrixTranslatefEXT",
+    "glGetBooleanv",
+    NULL,
+    "glTexEstimateMotionQCOM",
+    "eglQueryOutputLayerStringEXT",
+    "glMakeTextureHandleNonResidentNV",
+    "glUseProgramStages",
+    "glGetPerfQueryInfoINTEL",
+    NULL,
+    NULL,
+    "glGetGraphicsResetStatus",
+    NULL,
+    "glCurrentPaletteMatrixOES",
+    NULL,
+    NULL,
+    NULL,
+    "glFramebufferRenderbufferOES",
+    NULL,
+    NULL,
+    NULL,
+    "glSamplerParameterIuivOES",
+    "glClientWaitSync",
+    "glDrawElementsInstancedANGLE",
+    "eglGetMscRateANGLE",
+    NULL,
+    "glGetShaderSource",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glDeleteFencesNV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glPatchParameteriEXT",
+    "glExtGetFramebuffersQCOM",
+    "glAlphaFunc",
+    NULL,
+    "glDrawElementsBaseVertexEXT",
+    "glColor4f",
+    NULL,
+    "glVertexAttrib2fv",
+    "eglQueryDevicesEXT",
+    "glMatrixMultfEXT",
+    NULL,
+    NULL,
+    "glCoverageOperationNV",
+    "glTexBufferEXT",
+    "glGetNextPerfQueryIdINTEL",
+    NULL,
+    "glUniform4ui64NV",
+    "glGetUniformfv",
+    "glEnableVertexAttribArray",
+    "eglCreateDRMImageMESA",
+    "glProgramUniform1i64NV",
+    NULL,
+    "glFragmentCoverageColorNV",
+    NULL,
+    NULL,
+    NULL,
+    "glGetQueryObjectui64vEXT",
+    "eglSwapBuffersRegionNOK",
+    NULL,
+    NULL,
+    NULL,
+    "glPathStencilDepthOffsetNV",
+    "glGetTexLevelParameterfv",
+    "eglCreateStreamFromFileDescriptorKHR",
+    "glGenFramebuffersOES",
+    "glBeginQueryEXT",
+    NULL,
+    "glLightModelxOES",
+    NULL,
+    NULL,
+    "glReadnPixelsEXT",
+    "glIsFenceNV",
+    "eglCreateImageKHR",
+    NULL,
+    "glLightModelx",
+    NULL,
+    "glScalex",
+    "glMatrixMultdEXT",
+    NULL,
+    "glProgramUniform4fEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glProgramParameteriEXT",
+    "glBlitFramebufferNV",
+    "glUniform1i",
+    "glGetTexParameterIuivEXT",
+    "glDepthRangef",
+    NULL,
+    NULL,
+    "glUniform3f",
+    "glGetLightxv",
+    NULL,
+    NULL,
+    "glGetPathParameterivNV",
+    "glUniform3uiv",
+    NULL,
+    "glTranslatef",
+    "glProgramUniform2f",
+    "glGetProgramPipelineInfoLog",
+    "glGetSamplerParameterfv",
+    NULL,
+    "eglQueryStreamKHR",
+    NULL,
+    NULL,
+    "glProgramUniform4uiEXT",
+    "glGetnUniformuivKHR",
+    "glColor4ub",
+    "glPathParameterfNV",
+    NULL,
+    "glEndPerfMonitorAMD",
+    "glProgramUniform1fvEXT",
+    "glGenBuffers",
+    "glVertexAttribDivisorANGLE",
+    "glProgramUniform3fEXT",
+    NULL,
+    "glEnableClientState",
+    "glMatrixLoad3x2fNV",
+    "eglDestroySyncNV",
+    "glProgramUniform3iv",
+    "glDisableiEXT",
+    "glVertexAttribI4iv",
+    "glProgramUniform2i64NV",
+    "glGetPathCoordsNV",
+    "eglWaitSync",
+    "glGetRenderbufferParameteriv",
+    "glFramebufferTexture",
+    "glGetProgramResourceIndex",
+    "glBlendFunc",
+    NULL,
+    "glDeleteRenderbuffers",
+    NULL,
+    "glUniform1iv",
+    NULL,
+    NULL,
+    "glMultiDrawMeshTasksIndirectEXT",
+    "glProgramUniform3f",
+    NULL,
+    NULL,
+    "glClearColor",
+    "glShadingRateImageBarrierNV",
+    "glPrimitiveBoundingBoxOES",
+    NULL,
+    "eglQueryStreamAttribKHR",
+    NULL,
+    NULL,
+    "eglCreateImage",
+    "glIsSampler",
+    "glPushDebugGroupKHR",
+    "glImportSemaphoreWin32HandleEXT",
+    "glProgramUniform3i",
+    "glUniform1f",
+    "glClearBufferuiv",
+    NULL,
+    "glFramebufferFetchBarrierEXT",
+    "glDisableVertexAttribArray",
+    "glUniform4iv",
+    "glTexGenivOES",
+    "eglBindTexImage",
+    NULL,
+    "glDrawArraysInstancedANGLE",
+    "glProgramUniformMatrix2x3fv",
+    NULL,
+    NULL,
+    "glGetSemaphoreParameterivNV",
+    "glShaderBinary",
+    "glTexEstimateMotionRegionsQCOM",
+    "eglExportDMABUFImageMESA",
+    NULL,
+    "eglOutputPortAttribEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glUniform2iv",
+    "glCoverStrokePathInstancedNV",
+    "glPointParameterx",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexAttrib2f",
+    "glUniform4ui64vNV",
+    NULL,
+    "glRenderbufferStorageMultisampleAPPLE",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glUniformHandleui64vIMG",
+    NULL,
+    NULL,
+    "eglReleaseThread",
+    "glEndPerfQueryINTEL",
+    NULL,
+    "glMapBufferRangeEXT",
+    NULL,
+    "glGetTexParameterxv",
+    NULL,
+    "eglSetBlobCacheFuncsANDROID",
+    NULL,
+    "glGetIntegeri_v",
+    "glPathGlyphsNV",
+    "glGetUniformi64vNV",
+    "glGetShadingRateSampleLocationivNV",
+    "glBlendFuncSeparateiEXT",
+    NULL,
+    "glUniformMatrix4x2fvNV",
+    "glMultiDrawElementsIndirectEXT",
+    NULL,
+    "glGetCoverageModulationTableNV",
+    NULL,
+    NULL,
+    "glTexBufferOES",
+    "glGetPathMetricsNV",
+    "glProgramPathFragmentInputGenNV",
+    "glDeletePerfQueryINTEL",
+    NULL,
+    "eglQueryOutputPortStringEXT",
+    "glClearPixelLocalStorageuiEXT",
+    NULL,
+    "glGetBooleani_v",
+    NULL,
+    "glCoverageModulationTableNV",
+    NULL,
+    NULL,
+    NULL,
+    "glFrustumf",
+    NULL,
+    NULL,
+    "glCopyPathNV",
+    "glAlphaFuncQCOM",
+    "glTranslatexOES",
+    "glBindFragDataLocationEXT",
+    "glPointSizexOES",
+    "glGetBufferParameteri64v",
+    "eglDebugMessageControlKHR",
+    "glDrawArrays",
+    NULL,
+    NULL,
+    NULL,
+    "glRenderbufferStorageMultisampleNV",
+    "glMaterialxvOES",
+    "glReadPixels",
+    "glCreateProgram",
+    "glBeginQuery",
+    NULL,
+    "glDrawBuffers",
+    "glEndQueryEXT",
+    "glCreateMemoryObjectsEXT",
+    "glTexEnvx",
+    "glMaterialxOES",
+    "glProgramUniform1f",
+    "eglCreateStreamAttribKHR",
+    "glFramebufferTextureLayerDownsampleIMG",
+    NULL,
+    NULL,
+    "glUniform3ui64vNV",
+    NULL,
+    NULL,
+    NULL,
+    "glGetSamplerParameterIivEXT",
+    NULL,
+    NULL,
+    NULL,
+    "eglQueryDmaBufFormatsEXT",
+    "glFrustumx",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glTexParameterIuiv",
+    "glMatrixPopEXT",
+    "glDisableiNV",
+    "glProgramUniform1uiEXT",
+    "glRenderbufferStorageOES",
+    "glMatrixFrustumEXT",
+    "glUniformHandleui64NV",
+    "glReleaseKeyedMutexWin32EXT",
+    NULL,
+    "glTexStorage2D",
+    NULL,
+    NULL,
+    "glGetQueryivEXT",
+    "eglUnlockSurfaceKHR",
+    "glFramebufferTexture2D",
+    NULL,
+    "eglDestroySurface",
+    "glWaitSyncAPPLE",
+    "eglQueryStreamMetadataNV",
+    "glTransformFeedbackVaryings",
+    "glBindVertexArray",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniform1ui64vNV",
+    NULL,
+    "glProgramUniformMatrix2x4fv",
+    "glDrawMeshTasksIndirectNV",
+    NULL,
+    "glBlendBarrierNV",
+    NULL,
+    NULL,
+    "glMatrixLoaddEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glReadnPixelsKHR",
+    NULL,
+    "glGetnUniformivEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glUniformMatrix3x2fv",
+    NULL,
+    "glBlendEquationSeparate",
+    "eglSignalSyncNV",
+    "eglReleaseTexImage",
+    "glDrawTexxOES",
+    "glAttachShader",
+    "glGetAttribLocation",
+    "eglQuerySurface64KHR",
+    NULL,
+    "glDebugMessageCallback",
+    NULL,
+    "glBlendEquationSeparateiOES",
+    "glFrustumfOES",
+    "glClearDepthf",
+    "glCoverFillPathInstancedNV",
+    "eglUnbindWaylandDisplayWL",
+    "glProgramUniform2iEXT",
+    "glMemoryBarrierByRegion",
+    "glTextureAttachMemoryNV",
+    "glVertexAttribIPointer",
+    "glGetProgramBinaryOES",
+    "glDrawMeshTasksNV",
+    "glShadingRateQCOM",
+    "glGetPointerv",
+    NULL,
+    "eglCreatePbufferSurface",
+    "glCreateSemaphoresNV",
+    "glPathSubCommandsNV",
+    "glBlendFunciOES",
+    "glGetUnsignedBytei_vEXT",
+    NULL,
+    NULL,
+    "glGetClipPlanexOES",
+    NULL,
+    NULL,
+    NULL,
+    "glDrawTransformFeedbackInstancedEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glGenProgramPipelines",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "eglClientWaitSyncNV",
+    NULL,
+    "glGetPointervKHR",
+    NULL,
+    "glDepthRangexOES",
+    NULL,
+    "glGenFramebuffers",
+    NULL,
+    NULL,
+    "glGetPerfMonitorCounterStringAMD",
+    "glProgramUniformMatrix3fv",
+    NULL,
+    "glPathCommandsNV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glBindTransformFeedback",
+    NULL,
+    "glAlphaFuncxOES",
+    NULL,
+    "glTextureViewOES",
+    NULL,
+    NULL,
+    "eglGetDisplay",
+    NULL,
+    "glProgramUniform2iv",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glTextureStorage2DEXT",
+    NULL,
+    NULL,
+    "glBindRenderbuffer",
+    "eglCreateStreamProducerSurfaceKHR",
+    NULL,
+    NULL,
+    "glClientWaitSyncAPPLE",
+    NULL,
+    "glTextureStorageMem3DEXT",
+    NULL,
+    "glGetVertexAttribPointerv",
+    "glUniformMatrix4fv",
+    "eglStreamConsumerAcquireKHR",
+    "glTexCoordPointer",
+    "glUniformMatrix2x3fv",
+    "glGetIntegerv",
+    "glGetInteger64v",
+    "glMatrixRotatefEXT",
+    "glUniform1i64NV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "eglQueryDeviceStringEXT",
+    NULL,
+    NULL,
+    "glReadBufferIndexedEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glFramebufferShadingRateEXT",
+    "glUniformHandleui64vNV",
+    "eglDestroySyncKHR",
+    "glLoadMatrixf",
+    "glPathStringNV",
+    "glGetStringi",
+    "glGenQueriesEXT",
+    NULL,
+    NULL,
+    "glValidateProgram",
+    "glCheckFramebufferStatusOES",
+    "eglGetSyncAttribNV",
+    "glUniformMatrix4x3fvNV",
+    "eglSwapBuffersWithDamageKHR",
+    "eglCreatePlatformWindowSurface",
+    "glBlitFramebufferLayersEXT",
+    "eglGetFrameTimestampsANDROID",
+    "glUniform4uiv",
+    "glPrimitiveBoundingBoxEXT",
+    NULL,
+    "glGetTexLevelParameteriv",
+    "glExtGetShadersQCOM",
+    NULL,
+    "glProgramUniform3uiEXT",
+    NULL,
+    "glImportMemoryWin32NameEXT",
+    "glIsPathNV",
+    NULL,
+    "glMatrixMultTranspose3x3fNV",
+    "glEnableiEXT",
+    "glExtTexObjectStateOverrideiQCOM",
+    "glSamplerParameterIivOES",
+    NULL,
+    NULL,
+    "glGetFirstPerfQueryIdINTEL",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "eglDestroyStreamKHR",
+    NULL,
+    "glSamplerParameterIivEXT",
+    "eglQueryStreamConsumerEventNV",
+    "glGetRenderbufferParameterivOES",
+    "glUniform4f",
+    "glUniformMatrix2x3fvNV",
+    "glIsVertexArrayOES",
+    "glMultiDrawArraysEXT",
+    "eglQuerySurface",
+    "glVertexAttribI4ui",
+    "glProgramUniform4fv",
+    NULL,
+    NULL,
+    "glSamplerParameterIiv",
+    "glMaxShaderCompilerThreadsKHR",
+    NULL,
+    "glFrontFace",
+    "glProgramUniform1uivEXT",
+    "glDrawElementsIndirect",
+    NULL,
+    NULL,
+    "glOrthofOES",
+    NULL,
+    "glScissorIndexedvOES",
+    "glTranslatex",
+    "glBindShadingRateImageNV",
+    "glDeleteVertexArrays",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glSignalVkFenceNV",
+    "glCopyImageSubData",
+    NULL,
+    "glVertexAttribDivisorEXT",
+    "glMultiDrawMeshTasksIndirectCountEXT",
+    "glLightxOES",
+    NULL,
+    "glNormalPointer",
+    "glGetPathSpacingNV",
+    NULL,
+    "glGetFragDataIndexEXT",
+    "glGetIntegeri_vEXT",
+    "glTexParameterxOES",
+    "glGetTexParameterIuiv",
+    "glViewportIndexedfvNV",
+    "eglGetProcAddress",
+    "glViewportIndexedfvOES",
+    NULL,
+    "glGetUniformLocation",
+    "eglSwapBuffersWithDamageEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glUniform1fv",
+    NULL,
+    NULL,
+    "glPopGroupMarkerEXT",
+    NULL,
+    "glGetMemoryObjectParameterivEXT",
+    "glPushDebugGroup",
+    NULL,
+    "glClipControlEXT",
+    "glProgramUniform2uiEXT",
+    "glGetVkProcAddrNV",
+    "glGetShadingRateImagePaletteNV",
+    NULL,
+    NULL,
+    "glDisable",
+    "glGetFloati_vOES",
+    NULL,
+    "glGetFixedvOES",
+    "eglGetSystemTimeNV",
+    NULL,
+    "glNormal3x",
+    "glGetUnsignedBytevEXT",
+    "eglDestroyImageKHR",
+    "glMatrixMultTransposedEXT",
+    NULL,
+    "glProgramUniformMatrix4x2fvEXT",
+    "glMatrixLoadfEXT",
+    "glBlendParameteriNV",
+    "glColorPointer",
+    "glDrawArraysInstanced",
+    "glUniform2ui",
+    "glProgramUniform1i64vNV",
+    "glVertexPointer",
+    NULL,
+    "eglQueryDisplayAttribEXT",
+    "glRenderbufferStorage",
+    "glRotatef",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glLabelObjectEXT",
+    "glSampleCoveragexOES",
+    NULL,
+    NULL,
+    "glBlitFramebuffer",
+    NULL,
+    "glQueryCounterEXT",
+    NULL,
+    "glInterpolatePathsNV",
+    "glIsProgramPipeline",
+    "glDeleteSync",
+    "glViewportSwizzleNV",
+    "glEndTransformFeedback",
+    NULL,
+    NULL,
+    "glPrimitiveBoundingBox",
+    NULL,
+    NULL,
+    "eglSetStreamAttribKHR",
+    "glGetClipPlanef",
+    "glGetProgramPipelineiv",
+    NULL,
+    NULL,
+    NULL,
+    "eglQueryContext",
+    "glPathDashArrayNV",
+    "glUseProgramStagesEXT",
+    "glProgramUniformMatrix3x4fv",
+    "glResolveDepthValuesNV",
+    NULL,
+    "glDeleteMemoryObjectsEXT",
+    NULL,
+    "glGetInteger64i_v",
+    "glExtGetBuffersQCOM",
+    "glMaterialxv",
+    "glTexStorage3DEXT",
+    "glEndConditionalRenderNV",
+    NULL,
+    NULL,
+    "glObjectPtrLabelKHR",
+    "glMatrixPushEXT",
+    "glProgramUniformMatrix3x2fvEXT",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix4x3fv",
+    NULL,
+    "glBufferAttachMemoryNV",
+    NULL,
+    NULL,
+    "glDepthRangeArrayfvNV",
+    NULL,
+    NULL,
+    NULL,
+    "glCompileShader",
+    NULL,
+    "eglInitialize",
+    "glIsEnablediEXT",
+    "glTexStorage3DMultisample",
+    "glTexSubImage3DOES",
+    NULL,
+    "glGetBufferPointerv",
+    "glTexParameterxvOES",
+    "glMatrixLoad3x3fNV",
+    "glUseProgram",
+    "glTestFenceNV",
+    "glDrawArraysInstancedNV",
+    "glColor4xOES",
+    "glGetPerfMonitorGroupStringAMD",
+    NULL,
+    "glGetLightfv",
+    "glDeleteQueries",
+    NULL,
+    "glReleaseShaderCompiler",
+    "glProgramUniform3ui",
+    "glDeleteFramebuffersOES",
+    "glGetTexParameterIivEXT",
+    NULL,
+    "glPatchParameteri",
+    NULL,
+    NULL,
+    NULL,
+    "glUniform2ui64NV",
+    "glIsMemoryObjectEXT",
+    NULL,
+    NULL,
+    "glRenderbufferStorageMultisample",
+    "glFogxvOES",
+    NULL,
+    "eglGetDisplayDriverName",
+    "glGetObjectLabelEXT",
+    NULL,
+    NULL,
+    "glProgramUniform4f",
+    NULL,
+    "glGetDriverControlsQCOM",
+    "eglDupNativeFenceFDANDROID",
+    "glIsFramebuffer",
+    "glScissorArrayvOES",
+    "glCopyTexSubImage3DOES",
+    NULL,
+    NULL,
+    "eglQueryWaylandBufferWL",
+    NULL,
+    NULL,
+    "glGetPerfMonitorCountersAMD",
+    "glActiveShaderProgramEXT",
+    NULL,
+    "glGetShaderPrecisionFormat",
+    NULL,
+    NULL,
+    "glDrawTexiOES",
+    "glTextureStorageMem2DEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glDrawElements",
+    "glBlendEquationOES",
+    NULL,
+    NULL,
+    "glClipPlanefIMG",
+    "glMemoryBarrier",
+    "glGetProgramiv",
+    "glUniform1ui64vNV",
+    "glBeginPerfMonitorAMD",
+    NULL,
+    NULL,
+    "eglClientWaitSyncKHR",
+    "glBlendFuncSeparate",
+    NULL,
+    "glProgramUniformHandleui64IMG",
+    "glTextureViewEXT",
+    NULL,
+    NULL,
+    "glIsProgram",
+    NULL,
+    "eglCompositorSetWindowListEXT",
+    "glUniform3fv",
+    NULL,
+    NULL,
+    "glReadBufferNV",
+    "glBlendBarrier",
+    NULL,
+    NULL,
+    "glGetProgramBinary",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glEnableiNV",
+    NULL,
+    NULL,
+    "glCompressedTexSubImage2D",
+    "glUniform2uiv",
+    "glGenPathsNV",
+    NULL,
+    NULL,
+    "glTexGenxvOES",
+    "glGetUniformIndices",
+    NULL,
+    "glDepthRangeArrayfvOES",
+    "glProgramUniformMatrix2fvEXT",
+    "glSetFenceNV",
+    NULL,
+    "eglGetNextFrameIdANDROID",
+    "eglClientWaitSync",
+    NULL,
+    "glFramebufferFoveationConfigQCOM",
+    "glClearDepthx",
+    "glBlendFuncSeparateOES",
+    "glSemaphoreParameterui64vEXT",
+    "glGetImageHandleNV",
+    NULL,
+    "glScissorIndexedOES",
+    "glAlphaFuncx",
+    "glRotatex",
+    NULL,
+    NULL,
+    NULL,
+    "glGetError",
+    NULL,
+    "glMatrixRotatedEXT",
+    "glMultiDrawArraysIndirectEXT",
+    "glGetFixedv",
+    "glStencilOpSeparate",
+    "glGetnUniformivKHR",
+    "eglGetCurrentDisplay",
+    "glProgramUniform1ivEXT",
+    "glClearStencil",
+    NULL,
+    "glClearBufferiv",
+    "glFramebufferFoveationParametersQCOM",
+    "glLightModelfv",
+    NULL,
+    NULL,
+    "glGetMemoryObjectDetachedResourcesuivNV",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformMatrix3x4fvEXT",
+    "glFramebufferTexture2DOES",
+    "glSelectPerfMonitorCountersAMD",
+    "glMultMatrixf",
+    "glScalef",
+    NULL,
+    "eglGetSyncAttribKHR",
+    "glBindFragDataLocationIndexedEXT",
+    "glExtGetTexturesQCOM",
+    "glDrawElementsInstancedBaseVertexOES",
+    "glScissorArrayvNV",
+    "eglGetConfigs",
+    "glHint",
+    NULL,
+    "glSampleMaski",
+    "glClipPlanex",
+    NULL,
+    NULL,
+    "glGetSamplerParameterIuiv",
+    "glGetTexGenxvOES",
+    NULL,
+    "glPointSizePointerOES",
+    "glProgramUniformHandleui64vNV",
+    NULL,
+    NULL,
+    "glGetPathCommandsNV",
+    "glGetGraphicsResetStatusKHR",
+    NULL,
+    NULL,
+    "glCreateShaderProgramv",
+    "glSamplerParameterf",
+    "glGetTransformFeedbackVarying",
+    "glPopMatrix",
+    "eglSwapBuffers",
+    "eglQuerySurfacePointerANGLE",
+    "glProgramUniformMatrix4fv",
+    "glColorMaskiEXT",
+    "glDrawArraysInstancedBaseInstanceEXT",
+    NULL,
+    "glViewportArrayvNV",
+    "glProgramUniformMatrix2fv",
+    "glCheckFramebufferStatus",
+    NULL,
+    "glViewportArrayvOES",
+    "glDrawTransformFeedbackEXT",
+    "glGetFramebufferPixelLocalStorageSizeEXT",
+    NULL,
+    NULL,
+    "eglTerminate",
+    NULL,
+    NULL,
+    "glRasterSamplesEXT",
+    NULL,
+    "glGetPerfMonitorCounterDataAMD",
+    "glProgramUniform3i64NV",
+    "glVertexAttrib3fv",
+    NULL,
+    "glProgramUniform4ui64NV",
+    "glScalexOES",
+    "glDebugMessageCallbackKHR",
+    "glMultMatrixxOES",
+    NULL,
+    "glPathCoverDepthFuncNV",
+    "glStencilFillPathInstancedNV",
+    "glMultMatrixx",
+    NULL,
+    "glClientActiveTexture",
+    "glBindProgramPipeline",
+    NULL,
+    NULL,
+    "glUniformMatrix4x2fv",
+    NULL,
+    "eglQueryNativeWindowNV",
+    "glDrawTexfOES",
+    "glUniformMatrix3fv",
+    "glGetProgramInfoLog",
+    "glTexturePageCommitmentMemNV",
+    NULL,
+    NULL,
+    "glDisableiOES",
+    NULL,
+    "glBlendColor",
+    NULL,
+    "glProgramUniform1ui",
+    NULL,
+    NULL,
+    "glBufferSubData",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glUniformMatrix3x4fv",
+    NULL,
+    NULL,
+    "glGetPathDashArrayNV",
+    "glFramebufferTextureEXT",
+    "eglGetDisplayDriverConfig",
+    "eglSwapBuffersRegion2NOK",
+    "eglBindWaylandDisplayWL",
+    NULL,
+    "glVertexAttrib1f",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glGetPerfMonitorCounterInfoAMD",
+    "glStartTilingQCOM",
+    NULL,
+    "glLightxvOES",
+    NULL,
+    "glGetUniformBlockIndex",
+    NULL,
+    "glLightModelxv",
+    NULL,
+    "eglStreamConsumerOutputEXT",
+    NULL,
+    "glDepthRangeIndexedfNV",
+    "glProgramUniformMatrix3x2fv",
+    "glBeginPerfQueryINTEL",
+    "glIsTransformFeedback",
+    "glNamedFramebufferTextureMultiviewOVR",
+    NULL,
+    "glTexParameteri",
+    "eglCompositorSetContextListEXT",
+    NULL,
+    NULL,
+    "glPushMatrix",
+    "glPointParameterxv",
+    NULL,
+    "glWeightPathsNV",
+    "glEGLImageTargetRenderbufferStorageOES",
+    NULL,
+    NULL,
+    "glUniform2i",
+    NULL,
+    NULL,
+    "glRenderbufferStorageMultisampleANGLE",
+    "glValidateProgramPipeline",
+    "glTexEnvf",
+    "glFinish",
+    NULL,
+    NULL,
+    NULL,
+    "glMatrixScalefEXT",
+    "glPopDebugGroupKHR",
+    "glFramebufferTextureOES",
+    NULL,
+    "glEndTilingQCOM",
+    "glWaitSync",
+    NULL,
+    NULL,
+    "glGetActiveUniformsiv",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glBindFramebufferOES",
+    "glUniform2f",
+    NULL,
+    NULL,
+    "glInvalidateFramebuffer",
+    "glBlitFramebufferANGLE",
+    "glGetTexEnvxv",
+    "glDeleteVertexArraysOES",
+    NULL,
+    NULL,
+    NULL,
+    "glSamplerParameterIuiv",
+    "glBufferStorageEXT",
+    "eglQueryStreamu64KHR",
+    "glUniform4i64NV",
+    NULL,
+    "glDrawBuffersEXT",
+    "glProgramUniform4uiv",
+    NULL,
+    NULL,
+    "eglSwapInterval",
+    "glGetTextureHandleNV",
+    "glProgramUniform1fv",
+    "glGetSemaphoreParameterui64vEXT",
+    "glTexGenfOES",
+    NULL,
+    NULL,
+    "glBindBufferBase",
+    "eglCompositorSetSizeEXT",
+    "glGenProgramPipelinesEXT",
+    "glProgramUniform4uivEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "eglLockSurfaceKHR",
+    "glDeleteFramebuffers",
+    "glTexGenxOES",
+    "glDepthRangex",
+    NULL,
+    "glProgramUniform4iv",
+    "glGetnUniformuiv",
+    "eglCompositorSetWindowAttributesEXT",
+    "glDrawMeshTasksEXT",
+    "glTexStorageMem2DMultisampleEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glTexEnvi",
+    NULL,
+    NULL,
+    "glDeleteSemaphoresEXT",
+    NULL,
+    NULL,
+    "glDeleteShader",
+    NULL,
+    "glTexStorageAttribs3DEXT",
+    "glMatrixTranslatedEXT",
+    "glObjectLabel",
+    "glGetGraphicsResetStatusEXT",
+    "glProgramUniform4i64vNV",
+    "glTexParameterf",
+    "glShadeModel",
+    "glFramebufferTexture2DDownsampleIMG",
+    "glMatrixMult3x2fNV",
+    "glBlendEquationiEXT",
+    "glSamplerParameteriv",
+    "glBindBufferRange",
+    NULL,
+    NULL,
+    "glBlendBarrierKHR",
+    NULL,
+    "glUniformHandleui64IMG",
+    NULL,
+    "glPushGroupMarkerEXT",
+    NULL,
+    "glTexStorage1DEXT",
+    "glBufferPageCommitmentMemNV",
+    NULL,
+    "glProgramUniform4ui64vNV",
+    "glGenTransformFeedbacks",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glImportSemaphoreWin32NameEXT",
+    NULL,
+    "glGetTexParameterfv",
+    NULL,
+    "eglQueryAPI",
+    "glDebugMessageInsertKHR",
+    "glDrawTexsOES",
+    NULL,
+    "glSignalVkSemaphoreNV",
+    "glGetProgramResourcefvNV",
+    NULL,
+    "glStencilMask",
+    NULL,
+    "glGetInteger64vAPPLE",
+    NULL,
+    "glBlendEquation",
+    NULL,
+    "glGetFloatv",
+    NULL,
+    "glTexGeniOES",
+    NULL,
+    "glPointSize",
+    "glProgramUniform3i64vNV",
+    NULL,
+    "glDeleteSamplers",
+    "glSamplerParameterfv",
+    "glLineWidthx",
+    "glLightxv",
+    "glGetVertexAttribiv",
+    NULL,
+    NULL,
+    NULL,
+    "glMakeImageHandleNonResidentNV",
+    "glTexStorage3DMultisampleOES",
+    "glDebugMessageControlKHR",
+    "eglQueryNativePixmapNV",
+    NULL,
+    "glIsQueryEXT",
+    NULL,
+    "glGenerateMipmapOES",
+    "glPathGlyphRangeNV",
+    "glTexPageCommitmentMemNV",
+    "glTextureStorageMem3DMultisampleEXT",
+    "eglClientSignalSyncEXT",
+    "glDrawBuffersNV",
+    "glPointAlongPathNV",
+    "glClear",
+    NULL,
+    "glPathSubCoordsNV",
+    "eglCreateFenceSyncNV",
+    "glBindImageTexture",
+    "glFlushMappedBufferRange",
+    "glScissorIndexedvNV",
+    "glMatrixLoadTransposefEXT",
+    "glProgramUniform2i",
+    "eglPresentationTimeANDROID",
+    NULL,
+    "glGetTranslatedShaderSourceANGLE",
+    "glTextureStorageMem2DMultisampleEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glExtGetTexLevelParameterivQCOM",
+    "glGetClipPlanex",
+    NULL,
+    "glIsTexture",
+    NULL,
+    NULL,
+    "glDrawTexivOES",
+    "glGetProgramResourceLocation",
+    "glMemoryObjectParameterivEXT",
+    NULL,
+    NULL,
+    "glTextureFoveationParametersQCOM",
+    NULL,
+    "eglCreatePlatformPixmapSurfaceEXT",
+    NULL,
+    "glProgramUniformMatrix4fvEXT",
+    "glVertexAttrib4fv",
+    "glGetSamplerParameteriv",
+    "glDrawMeshTasksIndirectEXT",
+    NULL,
+    "glProgramBinary",
+    "glCopyImageSubDataOES",
+    NULL,
+    "glGetTexEnvxvOES",
+    "glGetObjectPtrLabel",
+    NULL,
+    "glBindAttribLocation",
+    NULL,
+    NULL,
+    "glGetAttachedShaders",
+    "glUniform3ui",
+    "glDispatchCompute",
+    "glProgramUniformMatrix4x3fvEXT",
+    "glMultiTexCoord4f",
+    "glGetQueryObjectivEXT",
+    "glGetBufferParameteriv",
+    "glProgramUniform2uiv",
+    NULL,
+    NULL,
+    "glLinkProgram",
+    "glBindTexture",
+    NULL,
+    "glGetLightxvOES",
+    NULL,
+    NULL,
+    "glReadnPixels",
+    "eglSignalSyncKHR",
+    "glFramebufferParameteri",
+    "glTextureBarrierNV",
+    "glLineWidth",
+    "glStencilStrokePathNV",
+    "eglGetOutputLayersEXT",
+    "glGetObjectLabelKHR",
+    "glMatrixLoadIdentityEXT",
+    "glDeletePathsNV",
+    "glBlendEquationiOES",
+    "glMakeImageHandleResidentNV",
+    "glProgramUniform3ui64NV",
+    NULL,
+    NULL,
+    NULL,
+    "glEGLImageTargetTexture2DOES",
+    "glColor4x",
+    "eglCreateWaylandBufferFromImageWL",
+    NULL,
+    NULL,
+    "glStencilFuncSeparate",
+    "glProgramUniformMatrix3fvEXT",
+    "glUniformMatrix4x3fv",
+    NULL,
+    "glDetachShader",
+    "glGetDriverControlStringQCOM",
+    "glGetQueryObjectuiv",
+    "glProgramUniform3ivEXT",
+    NULL,
+    NULL,
+    "eglCreateSync",
+    "eglGetCompositorTimingANDROID",
+    NULL,
+    NULL,
+    NULL,
+    "glStencilThenCoverFillPathInstancedNV",
+    "glPathGlyphIndexRangeNV",
+    "glProgramUniform3fv",
+    "glFramebufferFetchBarrierQCOM",
+    NULL,
+    "eglWaitSyncKHR",
+    NULL,
+    NULL,
+    NULL,
+    "glPolygonOffset",
+    NULL,
+    "glFenceSync",
+    "eglGetPlatformDisplayEXT",
+    "glShadingRateEXT",
+    "glGetTexEnvfv",
+    NULL,
+    "glGetVertexAttribIiv",
+    NULL,
+    "glDepthMask",
+    NULL,
+    "glPathCoordsNV",
+    NULL,
+    "glExtGetBufferPointervQCOM",
+    NULL,
+    "glLineWidthxOES",
+    NULL,
+    NULL,
+    "glGetPerfQueryDataINTEL",
+    "glGetTextureSamplerHandleIMG",
+    NULL,
+    "eglCreateStreamKHR",
+    "glConservativeRasterParameteriNV",
+    "eglStreamImageConsumerConnectNV",
+    "glLoadIdentity",
+    NULL,
+    NULL,
+    "glTexParameterIuivOES",
+    NULL,
+    NULL,
+    NULL,
+    "glGetTexParameterIuivOES",
+    "glRenderbufferStorageMultisampleEXT",
+    "glCoverageMaskNV",
+    "eglQueryStreamTimeKHR",
+    "glCompressedTexImage3D",
+    NULL,
+    "glProgramUniformMatrix2x3fvEXT",
+    "glUniform4ui",
+    "glGetFramebufferAttachmentParameteriv",
+    "glOrthox",
+    "glStencilFillPathNV",
+    NULL,
+    NULL,
+    "eglGetFrameTimestampSupportedANDROID",
+    NULL,
+    NULL,
+    "glNamedBufferPageCommitmentMemNV",
+    "glBindVertexArrayOES",
+    "glShadingRateSampleOrderCustomNV",
+    NULL,
+    NULL,
+    "glProgramUniform2fvEXT",
+    NULL,
+    NULL,
+    "eglQueryDisplayAttribNV",
+    NULL,
+    NULL,
+    "glGetMaterialxvOES",
+    "glSamplerParameteri",
+    NULL,
+    "glBufferStorageExternalEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glMatrixLoadTransposedEXT",
+    "eglCompositorSwapPolicyEXT",
+    "glGetFramebufferParameteriv",
+    "glViewportPositionWScaleNV",
+    NULL,
+    "glNamedBufferStorageMemEXT",
+    NULL,
+    "glDrawElementsInstancedBaseVertexEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glIsPointInStrokePathNV",
+    "glFramebufferRenderbuffer",
+    NULL,
+    "glFramebufferParameteriMESA",
+    "eglResetStreamNV",
+    "glViewportIndexedfNV",
+    NULL,
+    NULL,
+    "glMatrixScaledEXT",
+    "glTexSubImage3D",
+    "glVertexAttribIFormat",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glBlendFuncSeparateiOES",
+    "glEnablei",
+    NULL,
+    NULL,
+    NULL,
+    "glIsBuffer",
+    "eglDestroyContext",
+    "glLightf",
+    "glPointParameterf",
+    NULL,
+    NULL,
+    "glGetTexGenivOES",
+    "glGetPerfMonitorGroupsAMD",
+    "glImportMemoryWin32HandleEXT",
+    "glGetVertexAttribfv",
+    "glSemaphoreParameterivNV",
+    NULL,
+    "glDeleteBuffers",
+    NULL,
+    "glProgramUniform1iv",
+    NULL,
+    "glTexEnviv",
+    "glResumeTransformFeedback",
+    "glIsEnablediNV",
+    "glDrawTexxvOES",
+    NULL,
+    "glTexBuffer",
+    NULL,
+    "glInvalidateSubFramebuffer",
+    "glGetFramebufferAttachmentParameterivOES",
+    "eglCreateNativeClientBufferANDROID",
+    "glGenRenderbuffersOES",
+    "eglGetNativeClientBufferANDROID",
+    "glDeleteProgramPipelinesEXT",
+    NULL,
+    NULL,
+    "glCopyTexSubImage2D",
+    "glTexStorage2DMultisample",
+    NULL,
+    "glNamedRenderbufferStorageMultisampleAdvancedAMD",
+    "glProgramUniform4ui",
+    "glProgramUniform3uivEXT",
+    "glWindowRectanglesEXT",
+    "glStencilThenCoverFillPathNV",
+    "glGenerateMipmap",
+    "glFramebufferTexture3DOES",
+    "glSampleCoverage",
+    "glGetFenceivNV",
+    "glResolveMultisampleFramebufferAPPLE",
+    "glFramebufferSampleLocationsfvNV",
+    NULL,
+    "glEGLImageTargetTexStorageEXT",
+    NULL,
+    "glCompressedTexSubImage3DOES",
+    "glGetnUniformiv",
+    "glGenQueries",
+    NULL,
+    "glCreateShader",
+    NULL,
+    "eglLabelObjectKHR",
+    "glGetProgramPipelineivEXT",
+    NULL,
+    "glUniform1uiv",
+    "glGetDebugMessageLog",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glOrthoxOES",
+    NULL,
+    NULL,
+    "glIsSemaphoreEXT",
+    NULL,
+    "glTexStorage3D",
+    "glFogxv",
+    "glIsRenderbuffer",
+    "glClipPlanexIMG",
+    NULL,
+    "glStencilThenCoverStrokePathInstancedNV",
+    "glGetString",
+    "glPointSizex",
+    NULL,
+    "glGetFloati_vNV",
+    "glUniform2fv",
+    "glScissorIndexedNV",
+    "glProgramUniformHandleui64NV",
+    "glNormal3xOES",
+    "glDispatchComputeIndirect",
+    NULL,
+    NULL,
+    NULL,
+    "glFenceSyncAPPLE",
+    "glImportMemoryFdEXT",
+    "glMultiDrawMeshTasksIndirectNV",
+    "eglQueryDeviceBinaryEXT",
+    "glFramebufferTextureMultiviewOVR",
+    NULL,
+    NULL,
+    "glDrawElementsInstancedEXT",
+    "glVertexAttrib3f",
+    "glIsImageHandleResidentNV",
+    "glTexEnvxOES",
+    "glRenderbufferStorageMultisampleIMG",
+    "glTexImage3DOES",
+    NULL,
+    NULL,
+    "eglCopyBuffers",
+    NULL,
+    NULL,
+    "glShaderSource",
+    NULL,
+    "glProgramUniformMatrix2x4fvEXT",
+    "glGenFencesNV",
+    "glPathParameteriNV",
+    "glTexParameterIivEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glBindSampler",
+    "glFlushMappedBufferRangeEXT",
+    NULL,
+    "glBeginTransformFeedback",
+    "glTextureStorage1DEXT",
+    "eglGetConfigAttrib",
+    NULL,
+    "glDrawElementsBaseVertexOES",
+    NULL,
+    NULL,
+    NULL,
+    "eglGetCompositorTimingSupportedANDROID",
+    NULL,
+    "glGetFragDataLocation",
+    NULL,
+    "glTexPageCommitmentEXT",
+    NULL,
+    "glGetPerfQueryIdByNameINTEL",
+    NULL,
+    NULL,
+    "eglCreatePlatformWindowSurfaceEXT",
+    "glDrawElementsInstancedBaseVertexBaseInstanceEXT",
+    "eglGetSystemTimeFrequencyNV",
+    NULL,
+    NULL,
+    NULL,
+    "glClearColorxOES",
+    "eglStreamAcquireImageNV",
+    "eglSetStreamMetadataNV",
+    "glGetMaterialxv",
+    "glUniform2i64NV",
+    "glFramebufferTexture2DMultisampleEXT",
+    "glTexParameterIivOES",
+    NULL,
+    "glPatchParameteriOES",
+    NULL,
+    "glMakeTextureHandleResidentNV",
+    NULL,
+    NULL,
+    "eglGetCurrentContext",
+    "glWeightPointerOES",
+    "glUniformMatrix2x4fv",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glDeletePerfMonitorsAMD",
+    "glVertexAttribI4i",
+    "eglOutputLayerAttribEXT",
+    "eglGetCurrentSurface",
+    "glLightModelxvOES",
+    "glGetActiveAttrib",
+    NULL,
+    NULL,
+    NULL,
+    "glTexParameterIuivEXT",
+    NULL,
+    "eglChooseConfig",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glMapBufferOES",
+    NULL,
+    "glLightx",
+    NULL,
+    "glNormal3f",
+    "glMultiDrawElementsEXT",
+    NULL,
+    "glProgramUniform4i64NV",
+    "glPixelStorei",
+    NULL,
+    NULL,
+    "glDeleteQueriesEXT",
+    "glUniform4i",
+    "glUniform4i64vNV",
+    "glScissor",
+    NULL,
+    "glCopyImageSubDataEXT",
+    "glProgramUniform4ivEXT",
+    NULL,
+    NULL,
+    "eglStreamConsumerReleaseAttribKHR",
+    "glDrawVkImageNV",
+    "glMinSampleShading",
+    NULL,
+    NULL,
+    NULL,
+    "glDisableDriverControlQCOM",
+    "glGetInternalformativ",
+    "glGetVertexAttribIuiv",
+    "glGetTexParameterxvOES",
+    NULL,
+    "glClearDepthfOES",
+    NULL,
+    "glBindProgramPipelineEXT",
+    "glBindRenderbufferOES",
+    "glColorMaski",
+    "glProgramUniform1uiv",
+    NULL,
+    "glTexStorageMem2DEXT",
+    "glGetShaderiv",
+    "glColorMask",
+    NULL,
+    "glGetnUniformfv",
+    "glIsProgramPipelineEXT",
+    "eglQueryNativeDisplayNV",
+    NULL,
+    NULL,
+    "glDisablei",
+    "glIsQuery",
+    NULL,
+    "glGetProgramResourceiv",
+    "glGenSamplers",
+    "glUniform1ui",
+    "eglGetPlatformDisplay",
+    "glDrawElementsInstancedNV",
+    "glCoverStrokePathNV",
+    "glProgramUniformHandleui64vIMG",
+    "eglCompositorSetContextAttributesEXT",
+    NULL,
+    NULL,
+    "glTexStorageAttribs2DEXT",
+    "glShadingRateCombinerOpsEXT",
+    NULL,
+    "glFogxOES",
+    NULL,
+    "glGetActiveUniformBlockiv",
+    "glClearBufferfv",
+    NULL,
+    "glMatrixOrthoEXT",
+    "eglExportDMABUFImageQueryMESA",
+    "glRotatexOES",
+    NULL,
+    "glShadingRateSampleOrderNV",
+    NULL,
+    NULL,
+    NULL,
+    "glColorMaskiOES",
+    "glCopyTextureLevelsAPPLE",
+    "glStencilMaskSeparate",
+    NULL,
+    NULL,
+    "glEnable",
+    "glCompressedTexImage3DOES",
+    NULL,
+    "glCompressedTexImage2D",
+    "glUniform2i64vNV",
+    NULL,
+    NULL,
+    "glSubpixelPrecisionBiasNV",
+    NULL,
+    "glMaterialx",
+    "glActiveTexture",
+    "glProgramUniform2uivEXT",
+    "glDrawElementsBaseVertex",
+    "glUniform2ui64vNV",
+    NULL,
+    "glActiveShaderProgram",
+    "glMaxActiveShaderCoresARM",
+    "eglFenceNV",
+    "eglCreatePlatformPixmapSurface",
+    NULL,
+    "glSignalSemaphoreEXT",
+    NULL,
+    "glGetUniformiv",
+    NULL,
+    "glTexImage3D",
+    "glShadingRateImagePaletteNV",
+    "glValidateProgramPipelineEXT",
+    NULL,
+    "glGetTextureHandleIMG",
+    "eglQueryOutputPortAttribEXT",
+    NULL,
+    NULL,
+    "glPolygonOffsetxOES",
+    "glVertexAttrib4f",
+    "glWaitVkSemaphoreNV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glIsFramebufferOES",
+    "eglMakeCurrent",
+    "glProgramUniform2fEXT",
+    NULL,
+    NULL,
+    "glGetSamplerParameterIuivEXT",
+    NULL,
+    "glProgramUniform3fvEXT",
+    "glGetTextureSamplerHandleNV",
+    "glGetShaderInfoLog",
+    NULL,
+    "glGetActiveUniformBlockName",
+    "glMultiDrawElementsBaseVertexEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glBlendEquationSeparatei",
+    NULL,
+    "glIsEnabled",
+    "glGetFramebufferParameterivMESA",
+    NULL,
+    NULL,
+    NULL,
+    "glTextureStorage3DEXT",
+    "glProgramBinaryOES",
+    NULL,
+    "eglCreateSyncKHR",
+    NULL,
+    "glFinishFenceNV",
+    "eglCreateSync64KHR",
+    NULL,
+    "glGetMultisamplefv",
+    NULL,
+    "glScissorExclusiveNV",
+    "eglCreateContext",
+    "glDeleteTransformFeedbacks",
+    NULL,
+    "glGetPathParameterfvNV",
+    NULL,
+    NULL,
+    "glScissorExclusiveArrayvNV",
+    "glTexEnvxv",
+    "glDebugMessageInsert",
+    "glBindFramebuffer",
+    "glProgramUniform1ui64NV",
+    NULL,
+    "glGetSamplerParameterIiv",
+    "glSamplerParameterIuivEXT",
+    "glGenRenderbuffers",
+    "glImportSemaphoreFdEXT",
+    "glDrawBuffersIndexedEXT",
+    NULL,
+    "glGetProgramResourceName",
+    "glTexEnvfv",
+    NULL,
+    NULL,
+    "glExtIsProgramBinaryQCOM",
+    "glDrawRangeElementsBaseVertex",
+    NULL,
+    "glUnmapBufferOES",
+    "glProgramUniform2fv",
+    "glBeginConditionalRenderNV",
+    "eglStreamFlushNV",
+    NULL,
+    "glBufferStorageMemEXT",
+    NULL,
+    "glGetClipPlanefOES",
+    NULL,
+    "eglQueryDmaBufModifiersEXT",
+    "glCopyBufferSubData",
+    NULL,
+    "glQueryMatrixxOES",
+    "eglUnsignalSyncEXT",
+    "glMultiDrawMeshTasksIndirectCountNV",
+    NULL,
+    NULL,
+    NULL,
+    "glTexStorageMem3DMultisampleEXT",
+    NULL,
+    "glFogx",
+    NULL,
+    "glCoverageModulationNV",
+    "glDeleteProgramPipelines",
+    NULL,
+    "glStencilStrokePathInstancedNV",
+    "glProgramUniform1i",
+    "glBlendFuncSeparatei",
+    NULL,
+    "glDrawElementsInstancedBaseVertex",
+    "glTexAttachMemoryNV",
+    "glTexSubImage2D",
+    "glGetActiveUniform",
+    NULL,
+    NULL,
+    "glExtGetProgramsQCOM",
+    NULL,
+    "glFramebufferTextureMultisampleMultiviewOVR",
+    NULL,
+    "glTransformPathNV",
+    NULL,
+    "glIsEnabledi",
+    "glExtGetTexSubImageQCOM",
+    "glEGLImageTargetTextureStorageEXT",
+    NULL,
+    "eglStreamReleaseImageNV",
+    NULL,
+    "eglDestroyImage",
+    NULL,
+    "glTexBufferRangeEXT",
+    "glLoadPaletteFromModelViewMatrixOES",
+    "glTexBufferRange",
+    "glNamedFramebufferSampleLocationsfvNV",
+    NULL,
+    "glObjectPtrLabel",
+    "glDiscardFramebufferEXT",
+    "glPopDebugGroup",
+    NULL,
+    "glPathParameterivNV",
+    "glProgramUniform4iEXT",
+    "glViewportIndexedfOES",
+    "glProgramUniform2ui",
+    "glUniform3iv",
+    "glNamedBufferAttachMemoryNV",
+    "glStencilFunc",
+    "glProgramUniform3uiv",
+    NULL,
+    "glBlendFunciEXT",
+    "glResetMemoryObjectParameterNV",
+    "glPolygonOffsetx",
+    NULL,
+    NULL,
+    "glCullFace",
+    "glEndQuery",
+    "glVertexAttribDivisorNV",
+    "glMaterialf",
+    "glExtGetProgramBinarySourceQCOM",
+    "glGenPerfMonitorsAMD",
+    "glBlendEquationi",
+    "glRenderbufferStorageMultisampleAdvancedAMD",
+    NULL,
+    "glPointParameterxvOES",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniform1iEXT",
+    "glGetTexGenfvOES",
+    NULL,
+    "glBufferData",
+    "eglQuerySupportedCompressionRatesEXT",
+    NULL,
+    "glTexParameteriv",
+    NULL,
+    "glTexBufferRangeOES",
+    "eglCreatePixmapSurfaceHI",
+    "glDrawRangeElementsBaseVertexOES",
+    NULL,
+    "glMultiTexCoord4x",
+    NULL,
+    "glDeleteProgram",
+    NULL,
+    NULL,
+    NULL,
+    "eglSurfaceAttrib",
+    "eglCreateStreamSyncNV",
+    NULL,
+    "glDeleteTextures",
+    "glGetBufferPointervOES",
+    "glReadBuffer",
+    NULL,
+    NULL,
+    "eglQueryString",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniform2ui64vNV",
+    "glStencilOp",
+    "glBindVertexBuffer",
+    NULL,
+    "glGetnUniformfvKHR",
+    NULL,
+    "glMatrixMultTransposefEXT",
+    NULL,
+    "glTexParameterx",
+    "glInsertEventMarkerEXT",
+    "glProgramUniform2i64vNV",
+    "glDrawTexsvOES",
+    "glWaitSemaphoreEXT",
+    NULL,
+    "glFlush",
+    "glMatrixLoadTranspose3x3fNV",
+    NULL,
+    NULL,
+    "glGetObjectLabel",
+    "glPathGlyphIndexArrayNV",
+    NULL,
+    NULL,
+    NULL,
+    "glTexParameterIiv",
+    "glClipPlanexOES",
+    "glBlitFramebufferLayerEXT",
+    "eglCreatePbufferFromClientBuffer",
+    NULL,
+    NULL,
+};
+
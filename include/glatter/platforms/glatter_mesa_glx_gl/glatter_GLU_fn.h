@@ -0,0 +1,100 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Dense index of every GLU entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_GLU {
+    GLATTER_FN_gluBeginCurve,
+    GLATTER_FN_gluBeginPolygon,
+    GLATTER_FN_gluBeginSurface,
+    GLATTER_FN_gluBeginTrim,
+    GLATTER_FN_gluBuild1DMipmapLevels,
+    GLATTER_FN_gluBuild1DMipmaps,
+    GLATTER_FN_gluBuild2DMipmapLevels,
+    GLATTER_FN_gluBuild2DMipmaps,
+    GLATTER_FN_gluBuild3DMipmapLevels,
+    GLATTER_FN_gluBuild3DMipmaps,
+    GLATTER_FN_gluCheckExtension,
+    GLATTER_FN_gluCylinder,
+    GLATTER_FN_gluDeleteNurbsRenderer,
+    GLATTER_FN_gluDeleteQuadric,
+    GLATTER_FN_gluDeleteTess,
+    GLATTER_FN_gluDisk,
+    GLATTER_FN_gluEndCurve,
+    GLATTER_FN_gluEndPolygon,
+    GLATTER_FN_gluEndSurface,
+    GLATTER_FN_gluEndTrim,
+    GLATTER_FN_gluErrorString,
+    GLATTER_FN_gluGetNurbsProperty,
+    GLATTER_FN_gluGetString,
+    GLATTER_FN_gluGetTessProperty,
+    GLATTER_FN_gluLoadSamplingMatrices,
+    GLATTER_FN_gluLookAt,
+    GLATTER_FN_gluNewNurbsRenderer,
+    GLATTER_FN_gluNewQuadric,
+    GLATTER_FN_gluNewTess,
+    GLATTER_FN_gluNextContour,
+    GLATTER_FN_gluNurbsCallback,
+    GLATTER_FN_gluNurbsCallbackData,
+    GLATTER_FN_gluNurbsCallbackDataEXT,
+    GLATTER_FN_gluNurbsCurve,
+    GLATTER_FN_gluNurbsProperty,
+    GLATTER_FN_gluNurbsSurface,
+    GLATTER_FN_gluOrtho2D,
+    GLATTER_FN_gluPartialDisk,
+    GLATTER_FN_gluPerspective,
+    GLATTER_FN_gluPickMatrix,
+    GLATTER_FN_gluProject,
+    GLATTER_FN_gluPwlCurve,
+    GLATTER_FN_gluQuadricCallback,
+    GLATTER_FN_gluQuadricDrawStyle,
+    GLATTER_FN_gluQuadricNormals,
+    GLATTER_FN_gluQuadricOrientation,
+    GLATTER_FN_gluQuadricTexture,
+    GLATTER_FN_gluScaleImage,
+    GLATTER_FN_gluSphere,
+    GLATTER_FN_gluTessBeginContour,
+    GLATTER_FN_gluTessBeginPolygon,
+    GLATTER_FN_gluTessCallback,
+    GLATTER_FN_gluTessEndContour,
+    GLATTER_FN_gluTessEndPolygon,
+    GLATTER_FN_gluTessNormal,
+    GLATTER_FN_gluTessProperty,
+    GLATTER_FN_gluTessVertex,
+    GLATTER_FN_gluUnProject,
+    GLATTER_FN_gluUnProject4,
+    GLATTER_FN_COUNT_GLU
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_GLU 0xb813af36u
+
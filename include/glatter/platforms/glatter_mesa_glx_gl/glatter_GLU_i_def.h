@@ -0,0 +1,93 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+#ifdef GLATTER_GLU
+#if defined(__glu_h__)
+GLATTER_IBLOCK(gluBeginCurve)
+GLATTER_IBLOCK(gluBeginPolygon)
+GLATTER_IBLOCK(gluBeginSurface)
+GLATTER_IBLOCK(gluBeginTrim)
+GLATTER_IBLOCK(gluBuild1DMipmapLevels)
+GLATTER_IBLOCK(gluBuild1DMipmaps)
+GLATTER_IBLOCK(gluBuild2DMipmapLevels)
+GLATTER_IBLOCK(gluBuild2DMipmaps)
+GLATTER_IBLOCK(gluBuild3DMipmapLevels)
+GLATTER_IBLOCK(gluBuild3DMipmaps)
+GLATTER_IBLOCK(gluCheckExtension)
+GLATTER_IBLOCK(gluCylinder)
+GLATTER_IBLOCK(gluDeleteNurbsRenderer)
+GLATTER_IBLOCK(gluDeleteQuadric)
+GLATTER_IBLOCK(gluDeleteTess)
+GLATTER_IBLOCK(gluDisk)
+GLATTER_IBLOCK(gluEndCurve)
+GLATTER_IBLOCK(gluEndPolygon)
+GLATTER_IBLOCK(gluEndSurface)
+GLATTER_IBLOCK(gluEndTrim)
+GLATTER_IBLOCK(gluErrorString)
+GLATTER_IBLOCK(gluGetNurbsProperty)
+GLATTER_IBLOCK(gluGetString)
+GLATTER_IBLOCK(gluGetTessProperty)
+GLATTER_IBLOCK(gluLoadSamplingMatrices)
+GLATTER_IBLOCK(gluLookAt)
+GLATTER_IBLOCK(gluNewNurbsRenderer)
+GLATTER_IBLOCK(gluNewQuadric)
+GLATTER_IBLOCK(gluNewTess)
+GLATTER_IBLOCK(gluNextContour)
+GLATTER_IBLOCK(gluNurbsCallback)
+GLATTER_IBLOCK(gluNurbsCallbackData)
+GLATTER_IBLOCK(gluNurbsCallbackDataEXT)
+GLATTER_IBLOCK(gluNurbsCurve)
+GLATTER_IBLOCK(gluNurbsProperty)
+GLATTER_IBLOCK(gluNurbsSurface)
+GLATTER_IBLOCK(gluOrtho2D)
+GLATTER_IBLOCK(gluPartialDisk)
+GLATTER_IBLOCK(gluPerspective)
+GLATTER_IBLOCK(gluPickMatrix)
+GLATTER_IBLOCK(gluProject)
+GLATTER_IBLOCK(gluPwlCurve)
+GLATTER_IBLOCK(gluQuadricCallback)
+GLATTER_IBLOCK(gluQuadricDrawStyle)
+GLATTER_IBLOCK(gluQuadricNormals)
+GLATTER_IBLOCK(gluQuadricOrientation)
+GLATTER_IBLOCK(gluQuadricTexture)
+GLATTER_IBLOCK(gluScaleImage)
+GLATTER_IBLOCK(gluSphere)
+GLATTER_IBLOCK(gluTessBeginContour)
+GLATTER_IBLOCK(gluTessBeginPolygon)
+GLATTER_IBLOCK(gluTessCallback)
+GLATTER_IBLOCK(gluTessEndContour)
+GLATTER_IBLOCK(gluTessEndPolygon)
+GLATTER_IBLOCK(gluTessNormal)
+GLATTER_IBLOCK(gluTessProperty)
+GLATTER_IBLOCK(gluTessVertex)
+GLATTER_IBLOCK(gluUnProject)
+GLATTER_IBLOCK(gluUnProject4)
+#endif // defined(__glu_h__)
+#endif // GLATTER_GLU
+
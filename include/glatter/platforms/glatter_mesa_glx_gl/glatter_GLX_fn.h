@@ -0,0 +1,182 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Dense index of every GLX entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_GLX {
+    GLATTER_FN_glXSwapBuffers,
+    GLATTER_FN_glXMakeCurrent,
+    GLATTER_FN_glXMakeContextCurrent,
+    GLATTER_FN_glXGetCurrentContext,
+    GLATTER_FN_glXGetCurrentDisplay,
+    GLATTER_FN_glXGetCurrentDrawable,
+    GLATTER_FN_glXAllocateMemoryNV,
+    GLATTER_FN_glXAssociateDMPbufferSGIX,
+    GLATTER_FN_glXBeginFrameTrackingMESA,
+    GLATTER_FN_glXBindChannelToWindowSGIX,
+    GLATTER_FN_glXBindHyperpipeSGIX,
+    GLATTER_FN_glXBindSwapBarrierNV,
+    GLATTER_FN_glXBindSwapBarrierSGIX,
+    GLATTER_FN_glXBindTexImageARB,
+    GLATTER_FN_glXBindTexImageEXT,
+    GLATTER_FN_glXBindVideoCaptureDeviceNV,
+    GLATTER_FN_glXBindVideoDeviceNV,
+    GLATTER_FN_glXBindVideoImageNV,
+    GLATTER_FN_glXBlitContextFramebufferAMD,
+    GLATTER_FN_glXChannelRectSGIX,
+    GLATTER_FN_glXChannelRectSyncSGIX,
+    GLATTER_FN_glXChooseFBConfig,
+    GLATTER_FN_glXChooseFBConfigSGIX,
+    GLATTER_FN_glXChooseVisual,
+    GLATTER_FN_glXCopyBufferSubDataNV,
+    GLATTER_FN_glXCopyContext,
+    GLATTER_FN_glXCopyImageSubDataNV,
+    GLATTER_FN_glXCopySubBufferMESA,
+    GLATTER_FN_glXCreateAssociatedContextAMD,
+    GLATTER_FN_glXCreateAssociatedContextAttribsAMD,
+    GLATTER_FN_glXCreateContext,
+    GLATTER_FN_glXCreateContextAttribsARB,
+    GLATTER_FN_glXCreateContextWithConfigSGIX,
+    GLATTER_FN_glXCreateGLXPbufferSGIX,
+    GLATTER_FN_glXCreateGLXPixmap,
+    GLATTER_FN_glXCreateGLXPixmapMESA,
+    GLATTER_FN_glXCreateGLXPixmapWithConfigSGIX,
+    GLATTER_FN_glXCreateGLXVideoSourceSGIX,
+    GLATTER_FN_glXCreateNewContext,
+    GLATTER_FN_glXCreatePbuffer,
+    GLATTER_FN_glXCreatePixmap,
+    GLATTER_FN_glXCreateWindow,
+    GLATTER_FN_glXCushionSGI,
+    GLATTER_FN_glXDelayBeforeSwapNV,
+    GLATTER_FN_glXDeleteAssociatedContextAMD,
+    GLATTER_FN_glXDestroyContext,
+    GLATTER_FN_glXDestroyGLXPbufferSGIX,
+    GLATTER_FN_glXDestroyGLXPixmap,
+    GLATTER_FN_glXDestroyGLXVideoSourceSGIX,
+    GLATTER_FN_glXDestroyHyperpipeConfigSGIX,
+    GLATTER_FN_glXDestroyPbuffer,
+    GLATTER_FN_glXDestroyPixmap,
+    GLATTER_FN_glXDestroyWindow,
+    GLATTER_FN_glXDrawableAttribARB,
+    GLATTER_FN_glXEndFrameTrackingMESA,
+    GLATTER_FN_glXEnumerateVideoCaptureDevicesNV,
+    GLATTER_FN_glXEnumerateVideoDevicesNV,
+    GLATTER_FN_glXFreeContextEXT,
+    GLATTER_FN_glXFreeMemoryNV,
+    GLATTER_FN_glXGetAGPOffsetMESA,
+    GLATTER_FN_glXGetClientString,
+    GLATTER_FN_glXGetConfig,
+    GLATTER_FN_glXGetContextGPUIDAMD,
+    GLATTER_FN_glXGetContextIDEXT,
+    GLATTER_FN_glXGetCurrentAssociatedContextAMD,
+    GLATTER_FN_glXGetCurrentDisplayEXT,
+    GLATTER_FN_glXGetCurrentReadDrawable,
+    GLATTER_FN_glXGetCurrentReadDrawableSGI,
+    GLATTER_FN_glXGetFBConfigAttrib,
+    GLATTER_FN_glXGetFBConfigAttribSGIX,
+    GLATTER_FN_glXGetFBConfigFromVisualSGIX,
+    GLATTER_FN_glXGetFBConfigs,
+    GLATTER_FN_glXGetFrameUsageMESA,
+    GLATTER_FN_glXGetGPUIDsAMD,
+    GLATTER_FN_glXGetGPUInfoAMD,
+    GLATTER_FN_glXGetMscRateOML,
+    GLATTER_FN_glXGetSelectedEvent,
+    GLATTER_FN_glXGetSelectedEventSGIX,
+    GLATTER_FN_glXGetSwapIntervalMESA,
+    GLATTER_FN_glXGetSyncValuesOML,
+    GLATTER_FN_glXGetTransparentIndexSUN,
+    GLATTER_FN_glXGetVideoDeviceNV,
+    GLATTER_FN_glXGetVideoInfoNV,
+    GLATTER_FN_glXGetVideoSyncSGI,
+    GLATTER_FN_glXGetVisualFromFBConfig,
+    GLATTER_FN_glXGetVisualFromFBConfigSGIX,
+    GLATTER_FN_glXHyperpipeAttribSGIX,
+    GLATTER_FN_glXHyperpipeConfigSGIX,
+    GLATTER_FN_glXImportContextEXT,
+    GLATTER_FN_glXIsDirect,
+    GLATTER_FN_glXJoinSwapGroupNV,
+    GLATTER_FN_glXJoinSwapGroupSGIX,
+    GLATTER_FN_glXLockVideoCaptureDeviceNV,
+    GLATTER_FN_glXMakeAssociatedContextCurrentAMD,
+    GLATTER_FN_glXMakeCurrentReadSGI,
+    GLATTER_FN_glXNamedCopyBufferSubDataNV,
+    GLATTER_FN_glXQueryChannelDeltasSGIX,
+    GLATTER_FN_glXQueryChannelRectSGIX,
+    GLATTER_FN_glXQueryContext,
+    GLATTER_FN_glXQueryContextInfoEXT,
+    GLATTER_FN_glXQueryCurrentRendererIntegerMESA,
+    GLATTER_FN_glXQueryCurrentRendererStringMESA,
+    GLATTER_FN_glXQueryDrawable,
+    GLATTER_FN_glXQueryExtension,
+    GLATTER_FN_glXQueryExtensionsString,
+    GLATTER_FN_glXQueryFrameCountNV,
+    GLATTER_FN_glXQueryFrameTrackingMESA,
+    GLATTER_FN_glXQueryGLXPbufferSGIX,
+    GLATTER_FN_glXQueryHyperpipeAttribSGIX,
+    GLATTER_FN_glXQueryHyperpipeBestAttribSGIX,
+    GLATTER_FN_glXQueryHyperpipeConfigSGIX,
+    GLATTER_FN_glXQueryHyperpipeNetworkSGIX,
+    GLATTER_FN_glXQueryMaxSwapBarriersSGIX,
+    GLATTER_FN_glXQueryMaxSwapGroupsNV,
+    GLATTER_FN_glXQueryRendererIntegerMESA,
+    GLATTER_FN_glXQueryRendererStringMESA,
+    GLATTER_FN_glXQueryServerString,
+    GLATTER_FN_glXQuerySwapGroupNV,
+    GLATTER_FN_glXQueryVersion,
+    GLATTER_FN_glXQueryVideoCaptureDeviceNV,
+    GLATTER_FN_glXReleaseBuffersMESA,
+    GLATTER_FN_glXReleaseTexImageARB,
+    GLATTER_FN_glXReleaseTexImageEXT,
+    GLATTER_FN_glXReleaseVideoCaptureDeviceNV,
+    GLATTER_FN_glXReleaseVideoDeviceNV,
+    GLATTER_FN_glXReleaseVideoImageNV,
+    GLATTER_FN_glXResetFrameCountNV,
+    GLATTER_FN_glXSelectEvent,
+    GLATTER_FN_glXSelectEventSGIX,
+    GLATTER_FN_glXSendPbufferToVideoNV,
+    GLATTER_FN_glXSet3DfxModeMESA,
+    GLATTER_FN_glXSwapBuffersMscOML,
+    GLATTER_FN_glXSwapIntervalEXT,
+    GLATTER_FN_glXSwapIntervalMESA,
+    GLATTER_FN_glXSwapIntervalSGI,
+    GLATTER_FN_glXUseXFont,
+    GLATTER_FN_glXWaitForMscOML,
+    GLATTER_FN_glXWaitForSbcOML,
+    GLATTER_FN_glXWaitGL,
+    GLATTER_FN_glXWaitVideoSyncSGI,
+    GLATTER_FN_glXWaitX,
+    GLATTER_FN_COUNT_GLX
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_GLX 0x0631d4bau
+
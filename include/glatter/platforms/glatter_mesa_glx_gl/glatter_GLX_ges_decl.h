@@ -27,163 +27,162 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#ifndef GLATTER_LOOKUP_SIZE
-#define GLATTER_LOOKUP_SIZE 0x4000
+/* Reads one bit of an extension support bitset. */
+#ifndef GLATTER_EXTENSION_SUPPORTED
+#define GLATTER_EXTENSION_SUPPORTED(status, index) \
+    ((int)(((status)->bits[(index) >> 5] >> ((index) & 31)) & 1u))
 #endif
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4201)
-#endif
+/* Bit positions in glatter_extension_support_status_GLX_t::bits. */
+enum {
+    GLATTER_EXT_GLX_3DFX_multisample = 0,
+    GLATTER_EXT_GLX_AMD_gpu_association = 1,
+    GLATTER_EXT_GLX_ARB_context_flush_control = 2,
+    GLATTER_EXT_GLX_ARB_create_context = 3,
+    GLATTER_EXT_GLX_ARB_create_context_no_error = 4,
+    GLATTER_EXT_GLX_ARB_create_context_profile = 5,
+    GLATTER_EXT_GLX_ARB_create_context_robustness = 6,
+    GLATTER_EXT_GLX_ARB_fbconfig_float = 7,
+    GLATTER_EXT_GLX_ARB_framebuffer_sRGB = 8,
+    GLATTER_EXT_GLX_ARB_get_proc_address = 9,
+    GLATTER_EXT_GLX_ARB_multisample = 10,
+    GLATTER_EXT_GLX_ARB_render_texture = 11,
+    GLATTER_EXT_GLX_ARB_robustness_application_isolation = 12,
+    GLATTER_EXT_GLX_ARB_robustness_share_group_isolation = 13,
+    GLATTER_EXT_GLX_ARB_vertex_buffer_object = 14,
+    GLATTER_EXT_GLX_EXT_buffer_age = 15,
+    GLATTER_EXT_GLX_EXT_context_priority = 16,
+    GLATTER_EXT_GLX_EXT_create_context_es2_profile = 17,
+    GLATTER_EXT_GLX_EXT_create_context_es_profile = 18,
+    GLATTER_EXT_GLX_EXT_fbconfig_packed_float = 19,
+    GLATTER_EXT_GLX_EXT_framebuffer_sRGB = 20,
+    GLATTER_EXT_GLX_EXT_get_drawable_type = 21,
+    GLATTER_EXT_GLX_EXT_import_context = 22,
+    GLATTER_EXT_GLX_EXT_libglvnd = 23,
+    GLATTER_EXT_GLX_EXT_no_config_context = 24,
+    GLATTER_EXT_GLX_EXT_stereo_tree = 25,
+    GLATTER_EXT_GLX_EXT_swap_control = 26,
+    GLATTER_EXT_GLX_EXT_swap_control_tear = 27,
+    GLATTER_EXT_GLX_EXT_texture_from_pixmap = 28,
+    GLATTER_EXT_GLX_EXT_visual_info = 29,
+    GLATTER_EXT_GLX_EXT_visual_rating = 30,
+    GLATTER_EXT_GLX_INTEL_swap_event = 31,
+    GLATTER_EXT_GLX_MESA_agp_offset = 32,
+    GLATTER_EXT_GLX_MESA_copy_sub_buffer = 33,
+    GLATTER_EXT_GLX_MESA_pixmap_colormap = 34,
+    GLATTER_EXT_GLX_MESA_query_renderer = 35,
+    GLATTER_EXT_GLX_MESA_release_buffers = 36,
+    GLATTER_EXT_GLX_MESA_set_3dfx_mode = 37,
+    GLATTER_EXT_GLX_MESA_swap_control = 38,
+    GLATTER_EXT_GLX_MESA_swap_frame_usage = 39,
+    GLATTER_EXT_GLX_NV_copy_buffer = 40,
+    GLATTER_EXT_GLX_NV_copy_image = 41,
+    GLATTER_EXT_GLX_NV_delay_before_swap = 42,
+    GLATTER_EXT_GLX_NV_float_buffer = 43,
+    GLATTER_EXT_GLX_NV_multigpu_context = 44,
+    GLATTER_EXT_GLX_NV_multisample_coverage = 45,
+    GLATTER_EXT_GLX_NV_present_video = 46,
+    GLATTER_EXT_GLX_NV_robustness_video_memory_purge = 47,
+    GLATTER_EXT_GLX_NV_swap_group = 48,
+    GLATTER_EXT_GLX_NV_video_capture = 49,
+    GLATTER_EXT_GLX_NV_video_out = 50,
+    GLATTER_EXT_GLX_OML_swap_method = 51,
+    GLATTER_EXT_GLX_OML_sync_control = 52,
+    GLATTER_EXT_GLX_SGIS_blended_overlay = 53,
+    GLATTER_EXT_GLX_SGIS_multisample = 54,
+    GLATTER_EXT_GLX_SGIS_shared_multisample = 55,
+    GLATTER_EXT_GLX_SGIX_dmbuffer = 56,
+    GLATTER_EXT_GLX_SGIX_fbconfig = 57,
+    GLATTER_EXT_GLX_SGIX_hyperpipe = 58,
+    GLATTER_EXT_GLX_SGIX_pbuffer = 59,
+    GLATTER_EXT_GLX_SGIX_swap_barrier = 60,
+    GLATTER_EXT_GLX_SGIX_swap_group = 61,
+    GLATTER_EXT_GLX_SGIX_video_resize = 62,
+    GLATTER_EXT_GLX_SGIX_video_source = 63,
+    GLATTER_EXT_GLX_SGIX_visual_select_group = 64,
+    GLATTER_EXT_GLX_SGI_cushion = 65,
+    GLATTER_EXT_GLX_SGI_make_current_read = 66,
+    GLATTER_EXT_GLX_SGI_swap_control = 67,
+    GLATTER_EXT_GLX_SGI_video_sync = 68,
+    GLATTER_EXT_GLX_SUN_get_transparent_index = 69,
+    GLATTER_EXT_COUNT_GLX = 70
+};
 
+/* One bit per extension, indexed by GLATTER_EXT_* above. */
 typedef struct glatter_extension_support_status_GLX
 {
-        int has_GLX_3DFX_multisample;
-        int has_GLX_AMD_gpu_association;
-        int has_GLX_ARB_context_flush_control;
-        int has_GLX_ARB_create_context;
-        int has_GLX_ARB_create_context_no_error;
-        int has_GLX_ARB_create_context_profile;
-        int has_GLX_ARB_create_context_robustness;
-        int has_GLX_ARB_fbconfig_float;
-        int has_GLX_ARB_framebuffer_sRGB;
-        int has_GLX_ARB_get_proc_address;
-        int has_GLX_ARB_multisample;
-        int has_GLX_ARB_render_texture;
-        int has_GLX_ARB_robustness_application_isolation;
-        int has_GLX_ARB_robustness_share_group_isolation;
-        int has_GLX_ARB_vertex_buffer_object;
-        int has_GLX_EXT_buffer_age;
-        int has_GLX_EXT_context_priority;
-        int has_GLX_EXT_create_context_es2_profile;
-        int has_GLX_EXT_create_context_es_profile;
-        int has_GLX_EXT_fbconfig_packed_float;
-        int has_GLX_EXT_framebuffer_sRGB;
-        int has_GLX_EXT_get_drawable_type;
-        int has_GLX_EXT_import_context;
-        int has_GLX_EXT_libglvnd;
-        int has_GLX_EXT_no_config_context;
-        int has_GLX_EXT_stereo_tree;
-        int has_GLX_EXT_swap_control;
-        int has_GLX_EXT_swap_control_tear;
-        int has_GLX_EXT_texture_from_pixmap;
-        int has_GLX_EXT_visual_info;
-        int has_GLX_EXT_visual_rating;
-        int has_GLX_INTEL_swap_event;
-        int has_GLX_MESA_agp_offset;
-        int has_GLX_MESA_copy_sub_buffer;
-        int has_GLX_MESA_pixmap_colormap;
-        int has_GLX_MESA_query_renderer;
-        int has_GLX_MESA_release_buffers;
-        int has_GLX_MESA_set_3dfx_mode;
-        int has_GLX_MESA_swap_control;
-        int has_GLX_MESA_swap_frame_usage;
-        int has_GLX_NV_copy_buffer;
-        int has_GLX_NV_copy_image;
-        int has_GLX_NV_delay_before_swap;
-        int has_GLX_NV_float_buffer;
-        int has_GLX_NV_multigpu_context;
-        int has_GLX_NV_multisample_coverage;
-        int has_GLX_NV_present_video;
-        int has_GLX_NV_robustness_video_memory_purge;
-        int has_GLX_NV_swap_group;
-        int has_GLX_NV_video_capture;
-        int has_GLX_NV_video_out;
-        int has_GLX_OML_swap_method;
-        int has_GLX_OML_sync_control;
-        int has_GLX_SGIS_blended_overlay;
-        int has_GLX_SGIS_multisample;
-        int has_GLX_SGIS_shared_multisample;
-        int has_GLX_SGIX_dmbuffer;
-        int has_GLX_SGIX_fbconfig;
-        int has_GLX_SGIX_hyperpipe;
-        int has_GLX_SGIX_pbuffer;
-        int has_GLX_SGIX_swap_barrier;
-        int has_GLX_SGIX_swap_group;
-        int has_GLX_SGIX_video_resize;
-        int has_GLX_SGIX_video_source;
-        int has_GLX_SGIX_visual_select_group;
-        int has_GLX_SGI_cushion;
-        int has_GLX_SGI_make_current_read;
-        int has_GLX_SGI_swap_control;
-        int has_GLX_SGI_video_sync;
-        int has_GLX_SUN_get_transparent_index;
+    uint32_t bits[3];
 } glatter_extension_support_status_GLX_t;
 
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-
-#define glatter_GLX_3DFX_multisample glatter_get_extension_support_GLX().has_GLX_3DFX_multisample
-#define glatter_GLX_AMD_gpu_association glatter_get_extension_support_GLX().has_GLX_AMD_gpu_association
-#define glatter_GLX_ARB_context_flush_control glatter_get_extension_support_GLX().has_GLX_ARB_context_flush_control
-#define glatter_GLX_ARB_create_context glatter_get_extension_support_GLX().has_GLX_ARB_create_context
-#define glatter_GLX_ARB_create_context_no_error glatter_get_extension_support_GLX().has_GLX_ARB_create_context_no_error
-#define glatter_GLX_ARB_create_context_profile glatter_get_extension_support_GLX().has_GLX_ARB_create_context_profile
-#define glatter_GLX_ARB_create_context_robustness glatter_get_extension_support_GLX().has_GLX_ARB_create_context_robustness
-#define glatter_GLX_ARB_fbconfig_float glatter_get_extension_support_GLX().has_GLX_ARB_fbconfig_float
-#define glatter_GLX_ARB_framebuffer_sRGB glatter_get_extension_support_GLX().has_GLX_ARB_framebuffer_sRGB
-#define glatter_GLX_ARB_get_proc_address glatter_get_extension_support_GLX().has_GLX_ARB_get_proc_address
-#define glatter_GLX_ARB_multisample glatter_get_extension_support_GLX().has_GLX_ARB_multisample
-#define glatter_GLX_ARB_render_texture glatter_get_extension_support_GLX().has_GLX_ARB_render_texture
-#define glatter_GLX_ARB_robustness_application_isolation glatter_get_extension_support_GLX().has_GLX_ARB_robustness_application_isolation
-#define glatter_GLX_ARB_robustness_share_group_isolation glatter_get_extension_support_GLX().has_GLX_ARB_robustness_share_group_isolation
-#define glatter_GLX_ARB_vertex_buffer_object glatter_get_extension_support_GLX().has_GLX_ARB_vertex_buffer_object
-#define glatter_GLX_EXT_buffer_age glatter_get_extension_support_GLX().has_GLX_EXT_buffer_age
-#define glatter_GLX_EXT_context_priority glatter_get_extension_support_GLX().has_GLX_EXT_context_priority
-#define glatter_GLX_EXT_create_context_es2_profile glatter_get_extension_support_GLX().has_GLX_EXT_create_context_es2_profile
-#define glatter_GLX_EXT_create_context_es_profile glatter_get_extension_support_GLX().has_GLX_EXT_create_context_es_profile
-#define glatter_GLX_EXT_fbconfig_packed_float glatter_get_extension_support_GLX().has_GLX_EXT_fbconfig_packed_float
-#define glatter_GLX_EXT_framebuffer_sRGB glatter_get_extension_support_GLX().has_GLX_EXT_framebuffer_sRGB
-#define glatter_GLX_EXT_get_drawable_type glatter_get_extension_support_GLX().has_GLX_EXT_get_drawable_type
-#define glatter_GLX_EXT_import_context glatter_get_extension_support_GLX().has_GLX_EXT_import_context
-#define glatter_GLX_EXT_libglvnd glatter_get_extension_support_GLX().has_GLX_EXT_libglvnd
-#define glatter_GLX_EXT_no_config_context glatter_get_extension_support_GLX().has_GLX_EXT_no_config_context
-#define glatter_GLX_EXT_stereo_tree glatter_get_extension_support_GLX().has_GLX_EXT_stereo_tree
-#define glatter_GLX_EXT_swap_control glatter_get_extension_support_GLX().has_GLX_EXT_swap_control
-#define glatter_GLX_EXT_swap_control_tear glatter_get_extension_support_GLX().has_GLX_EXT_swap_control_tear
-#define glatter_GLX_EXT_texture_from_pixmap glatter_get_extension_support_GLX().has_GLX_EXT_texture_from_pixmap
-#define glatter_GLX_EXT_visual_info glatter_get_extension_support_GLX().has_GLX_EXT_visual_info
-#define glatter_GLX_EXT_visual_rating glatter_get_extension_support_GLX().has_GLX_EXT_visual_rating
-#define glatter_GLX_INTEL_swap_event glatter_get_extension_support_GLX().has_GLX_INTEL_swap_event
-#define glatter_GLX_MESA_agp_offset glatter_get_extension_support_GLX().has_GLX_MESA_agp_offset
-#define glatter_GLX_MESA_copy_sub_buffer glatter_get_extension_support_GLX().has_GLX_MESA_copy_sub_buffer
-#define glatter_GLX_MESA_pixmap_colormap glatter_get_extension_support_GLX().has_GLX_MESA_pixmap_colormap
-#define glatter_GLX_MESA_query_renderer glatter_get_extension_support_GLX().has_GLX_MESA_query_renderer
-#define glatter_GLX_MESA_release_buffers glatter_get_extension_support_GLX().has_GLX_MESA_release_buffers
-#define glatter_GLX_MESA_set_3dfx_mode glatter_get_extension_support_GLX().has_GLX_MESA_set_3dfx_mode
-#define glatter_GLX_MESA_swap_control glatter_get_extension_support_GLX().has_GLX_MESA_swap_control
-#define glatter_GLX_MESA_swap_frame_usage glatter_get_extension_support_GLX().has_GLX_MESA_swap_frame_usage
-#define glatter_GLX_NV_copy_buffer glatter_get_extension_support_GLX().has_GLX_NV_copy_buffer
-#define glatter_GLX_NV_copy_image glatter_get_extension_support_GLX().has_GLX_NV_copy_image
-#define glatter_GLX_NV_delay_before_swap glatter_get_extension_support_GLX().has_GLX_NV_delay_before_swap
-#define glatter_GLX_NV_float_buffer glatter_get_extension_support_GLX().has_GLX_NV_float_buffer
-#define glatter_GLX_NV_multigpu_context glatter_get_extension_support_GLX().has_GLX_NV_multigpu_context
-#define glatter_GLX_NV_multisample_coverage glatter_get_extension_support_GLX().has_GLX_NV_multisample_coverage
-#define glatter_GLX_NV_present_video glatter_get_extension_support_GLX().has_GLX_NV_present_video
-#define glatter_GLX_NV_robustness_video_memory_purge glatter_get_extension_support_GLX().has_GLX_NV_robustness_video_memory_purge
-#define glatter_GLX_NV_swap_group glatter_get_extension_support_GLX().has_GLX_NV_swap_group
-#define glatter_GLX_NV_video_capture glatter_get_extension_support_GLX().has_GLX_NV_video_capture
-#define glatter_GLX_NV_video_out glatter_get_extension_support_GLX().has_GLX_NV_video_out
-#define glatter_GLX_OML_swap_method glatter_get_extension_support_GLX().has_GLX_OML_swap_method
-#define glatter_GLX_OML_sync_control glatter_get_extension_support_GLX().has_GLX_OML_sync_control
-#define glatter_GLX_SGIS_blended_overlay glatter_get_extension_support_GLX().has_GLX_SGIS_blended_overlay
-#define glatter_GLX_SGIS_multisample glatter_get_extension_support_GLX().has_GLX_SGIS_multisample
-#define glatter_GLX_SGIS_shared_multisample glatter_get_extension_support_GLX().has_GLX_SGIS_shared_multisample
-#define glatter_GLX_SGIX_dmbuffer glatter_get_extension_support_GLX().has_GLX_SGIX_dmbuffer
-#define glatter_GLX_SGIX_fbconfig glatter_get_extension_support_GLX().has_GLX_SGIX_fbconfig
-#define glatter_GLX_SGIX_hyperpipe glatter_get_extension_support_GLX().has_GLX_SGIX_hyperpipe
-#define glatter_GLX_SGIX_pbuffer glatter_get_extension_support_GLX().has_GLX_SGIX_pbuffer
-#define glatter_GLX_SGIX_swap_barrier glatter_get_extension_support_GLX().has_GLX_SGIX_swap_barrier
-#define glatter_GLX_SGIX_swap_group glatter_get_extension_support_GLX().has_GLX_SGIX_swap_group
-#define glatter_GLX_SGIX_video_resize glatter_get_extension_support_GLX().has_GLX_SGIX_video_resize
-#define glatter_GLX_SGIX_video_source glatter_get_extension_support_GLX().has_GLX_SGIX_video_source
-#define glatter_GLX_SGIX_visual_select_group glatter_get_extension_support_GLX().has_GLX_SGIX_visual_select_group
-#define glatter_GLX_SGI_cushion glatter_get_extension_support_GLX().has_GLX_SGI_cushion
-#define glatter_GLX_SGI_make_current_read glatter_get_extension_support_GLX().has_GLX_SGI_make_current_read
-#define glatter_GLX_SGI_swap_control glatter_get_extension_support_GLX().has_GLX_SGI_swap_control
-#define glatter_GLX_SGI_video_sync glatter_get_extension_support_GLX().has_GLX_SGI_video_sync
-#define glatter_GLX_SUN_get_transparent_index glatter_get_extension_support_GLX().has_GLX_SUN_get_transparent_index
+#define glatter_GLX_3DFX_multisample glatter_extension_supported_GLX(GLATTER_EXT_GLX_3DFX_multisample)
+#define glatter_GLX_AMD_gpu_association glatter_extension_supported_GLX(GLATTER_EXT_GLX_AMD_gpu_association)
+#define glatter_GLX_ARB_context_flush_control glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_context_flush_control)
+#define glatter_GLX_ARB_create_context glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_create_context)
+#define glatter_GLX_ARB_create_context_no_error glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_create_context_no_error)
+#define glatter_GLX_ARB_create_context_profile glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_create_context_profile)
+#define glatter_GLX_ARB_create_context_robustness glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_create_context_robustness)
+#define glatter_GLX_ARB_fbconfig_float glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_fbconfig_float)
+#define glatter_GLX_ARB_framebuffer_sRGB glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_framebuffer_sRGB)
+#define glatter_GLX_ARB_get_proc_address glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_get_proc_address)
+#define glatter_GLX_ARB_multisample glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_multisample)
+#define glatter_GLX_ARB_render_texture glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_render_texture)
+#define glatter_GLX_ARB_robustness_application_isolation glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_robustness_application_isolation)
+#define glatter_GLX_ARB_robustness_share_group_isolation glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_robustness_share_group_isolation)
+#define glatter_GLX_ARB_vertex_buffer_object glatter_extension_supported_GLX(GLATTER_EXT_GLX_ARB_vertex_buffer_object)
+#define glatter_GLX_EXT_buffer_age glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_buffer_age)
+#define glatter_GLX_EXT_context_priority glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_context_priority)
+#define glatter_GLX_EXT_create_context_es2_profile glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_create_context_es2_profile)
+#define glatter_GLX_EXT_create_context_es_profile glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_create_context_es_profile)
+#define glatter_GLX_EXT_fbconfig_packed_float glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_fbconfig_packed_float)
+#define glatter_GLX_EXT_framebuffer_sRGB glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_framebuffer_sRGB)
+#define glatter_GLX_EXT_get_drawable_type glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_get_drawable_type)
+#define glatter_GLX_EXT_import_context glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_import_context)
+#define glatter_GLX_EXT_libglvnd glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_libglvnd)
+#define glatter_GLX_EXT_no_config_context glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_no_config_context)
+#define glatter_GLX_EXT_stereo_tree glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_stereo_tree)
+#define glatter_GLX_EXT_swap_control glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_swap_control)
+#define glatter_GLX_EXT_swap_control_tear glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_swap_control_tear)
+#define glatter_GLX_EXT_texture_from_pixmap glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_texture_from_pixmap)
+#define glatter_GLX_EXT_visual_info glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_visual_info)
+#define glatter_GLX_EXT_visual_rating glatter_extension_supported_GLX(GLATTER_EXT_GLX_EXT_visual_rating)
+#define glatter_GLX_INTEL_swap_event glatter_extension_supported_GLX(GLATTER_EXT_GLX_INTEL_swap_event)
+#define glatter_GLX_MESA_agp_offset glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_agp_offset)
+#define glatter_GLX_MESA_copy_sub_buffer glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_copy_sub_buffer)
+#define glatter_GLX_MESA_pixmap_colormap glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_pixmap_colormap)
+#define glatter_GLX_MESA_query_renderer glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_query_renderer)
+#define glatter_GLX_MESA_release_buffers glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_release_buffers)
+#define glatter_GLX_MESA_set_3dfx_mode glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_set_3dfx_mode)
+#define glatter_GLX_MESA_swap_control glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_swap_control)
+#define glatter_GLX_MESA_swap_frame_usage glatter_extension_supported_GLX(GLATTER_EXT_GLX_MESA_swap_frame_usage)
+#define glatter_GLX_NV_copy_buffer glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_copy_buffer)
+#define glatter_GLX_NV_copy_image glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_copy_image)
+#define glatter_GLX_NV_delay_before_swap glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_delay_before_swap)
+#define glatter_GLX_NV_float_buffer glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_float_buffer)
+#define glatter_GLX_NV_multigpu_context glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_multigpu_context)
+#define glatter_GLX_NV_multisample_coverage glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_multisample_coverage)
+#define glatter_GLX_NV_present_video glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_present_video)
+#define glatter_GLX_NV_robustness_video_memory_purge glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_robustness_video_memory_purge)
+#define glatter_GLX_NV_swap_group glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_swap_group)
+#define glatter_GLX_NV_video_capture glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_video_capture)
+#define glatter_GLX_NV_video_out glatter_extension_supported_GLX(GLATTER_EXT_GLX_NV_video_out)
+#define glatter_GLX_OML_swap_method glatter_extension_supported_GLX(GLATTER_EXT_GLX_OML_swap_method)
+#define glatter_GLX_OML_sync_control glatter_extension_supported_GLX(GLATTER_EXT_GLX_OML_sync_control)
+#define glatter_GLX_SGIS_blended_overlay glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIS_blended_overlay)
+#define glatter_GLX_SGIS_multisample glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIS_multisample)
+#define glatter_GLX_SGIS_shared_multisample glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIS_shared_multisample)
+#define glatter_GLX_SGIX_dmbuffer glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_dmbuffer)
+#define glatter_GLX_SGIX_fbconfig glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_fbconfig)
+#define glatter_GLX_SGIX_hyperpipe glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_hyperpipe)
+#define glatter_GLX_SGIX_pbuffer glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_pbuffer)
+#define glatter_GLX_SGIX_swap_barrier glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_swap_barrier)
+#define glatter_GLX_SGIX_swap_group glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_swap_group)
+#define glatter_GLX_SGIX_video_resize glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_video_resize)
+#define glatter_GLX_SGIX_video_source glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_video_source)
+#define glatter_GLX_SGIX_visual_select_group glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGIX_visual_select_group)
+#define glatter_GLX_SGI_cushion glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGI_cushion)
+#define glatter_GLX_SGI_make_current_read glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGI_make_current_read)
+#define glatter_GLX_SGI_swap_control glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGI_swap_control)
+#define glatter_GLX_SGI_video_sync glatter_extension_supported_GLX(GLATTER_EXT_GLX_SGI_video_sync)
+#define glatter_GLX_SUN_get_transparent_index glatter_extension_supported_GLX(GLATTER_EXT_GLX_SUN_get_transparent_index)
 
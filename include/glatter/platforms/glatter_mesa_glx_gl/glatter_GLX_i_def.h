@@ -0,0 +1,276 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+#ifdef GLATTER_GLX
+#if defined(GLX_H)
+#if defined(GLX_ARB_render_texture)
+GLATTER_IBLOCK(glXBindTexImageARB)
+GLATTER_IBLOCK(glXDrawableAttribARB)
+GLATTER_IBLOCK(glXReleaseTexImageARB)
+#endif // defined(GLX_ARB_render_texture)
+#if defined(GLX_MESA_swap_control)
+GLATTER_IBLOCK(glXGetSwapIntervalMESA)
+GLATTER_IBLOCK(glXSwapIntervalMESA)
+#endif // defined(GLX_MESA_swap_control)
+#if defined(GLX_MESA_swap_frame_usage)
+GLATTER_IBLOCK(glXBeginFrameTrackingMESA)
+GLATTER_IBLOCK(glXEndFrameTrackingMESA)
+GLATTER_IBLOCK(glXGetFrameUsageMESA)
+GLATTER_IBLOCK(glXQueryFrameTrackingMESA)
+#endif // defined(GLX_MESA_swap_frame_usage)
+#if defined(GLX_NV_vertex_array_range)
+GLATTER_IBLOCK(glXAllocateMemoryNV)
+GLATTER_IBLOCK(glXFreeMemoryNV)
+#endif // defined(GLX_NV_vertex_array_range)
+GLATTER_IBLOCK(glXChooseFBConfig)
+GLATTER_IBLOCK(glXChooseVisual)
+GLATTER_IBLOCK(glXCopyContext)
+GLATTER_IBLOCK(glXCreateContext)
+GLATTER_IBLOCK(glXCreateGLXPixmap)
+GLATTER_IBLOCK(glXCreateNewContext)
+GLATTER_IBLOCK(glXCreatePbuffer)
+GLATTER_IBLOCK(glXCreatePixmap)
+GLATTER_IBLOCK(glXCreateWindow)
+GLATTER_IBLOCK(glXDestroyContext)
+GLATTER_IBLOCK(glXDestroyGLXPixmap)
+GLATTER_IBLOCK(glXDestroyPbuffer)
+GLATTER_IBLOCK(glXDestroyPixmap)
+GLATTER_IBLOCK(glXDestroyWindow)
+GLATTER_IBLOCK(glXGetClientString)
+GLATTER_IBLOCK(glXGetConfig)
+GLATTER_IBLOCK(glXGetCurrentContext)
+GLATTER_IBLOCK(glXGetCurrentDisplay)
+GLATTER_IBLOCK(glXGetCurrentDrawable)
+GLATTER_IBLOCK(glXGetCurrentReadDrawable)
+GLATTER_IBLOCK(glXGetFBConfigAttrib)
+GLATTER_IBLOCK(glXGetFBConfigs)
+GLATTER_IBLOCK(glXGetSelectedEvent)
+GLATTER_IBLOCK(glXGetVisualFromFBConfig)
+GLATTER_IBLOCK(glXIsDirect)
+GLATTER_IBLOCK(glXMakeContextCurrent)
+GLATTER_IBLOCK(glXMakeCurrent)
+GLATTER_IBLOCK(glXQueryContext)
+GLATTER_IBLOCK(glXQueryDrawable)
+GLATTER_IBLOCK(glXQueryExtension)
+GLATTER_IBLOCK(glXQueryExtensionsString)
+GLATTER_IBLOCK(glXQueryServerString)
+GLATTER_IBLOCK(glXQueryVersion)
+GLATTER_IBLOCK(glXSelectEvent)
+GLATTER_IBLOCK(glXSwapBuffers)
+GLATTER_IBLOCK(glXUseXFont)
+GLATTER_IBLOCK(glXWaitGL)
+GLATTER_IBLOCK(glXWaitX)
+#endif // defined(GLX_H)
+#if defined(__glx_glxext_h_)
+#if defined(GLX_AMD_gpu_association)
+GLATTER_IBLOCK(glXBlitContextFramebufferAMD)
+GLATTER_IBLOCK(glXCreateAssociatedContextAMD)
+GLATTER_IBLOCK(glXCreateAssociatedContextAttribsAMD)
+GLATTER_IBLOCK(glXDeleteAssociatedContextAMD)
+GLATTER_IBLOCK(glXGetContextGPUIDAMD)
+GLATTER_IBLOCK(glXGetCurrentAssociatedContextAMD)
+GLATTER_IBLOCK(glXGetGPUIDsAMD)
+GLATTER_IBLOCK(glXGetGPUInfoAMD)
+GLATTER_IBLOCK(glXMakeAssociatedContextCurrentAMD)
+#endif // defined(GLX_AMD_gpu_association)
+#if defined(GLX_ARB_create_context)
+GLATTER_IBLOCK(glXCreateContextAttribsARB)
+#endif // defined(GLX_ARB_create_context)
+#if defined(GLX_EXT_import_context)
+GLATTER_IBLOCK(glXFreeContextEXT)
+GLATTER_IBLOCK(glXGetContextIDEXT)
+GLATTER_IBLOCK(glXGetCurrentDisplayEXT)
+GLATTER_IBLOCK(glXImportContextEXT)
+GLATTER_IBLOCK(glXQueryContextInfoEXT)
+#endif // defined(GLX_EXT_import_context)
+#if defined(GLX_EXT_swap_control)
+GLATTER_IBLOCK(glXSwapIntervalEXT)
+#endif // defined(GLX_EXT_swap_control)
+#if defined(GLX_EXT_texture_from_pixmap)
+GLATTER_IBLOCK(glXBindTexImageEXT)
+GLATTER_IBLOCK(glXReleaseTexImageEXT)
+#endif // defined(GLX_EXT_texture_from_pixmap)
+#if defined(GLX_MESA_agp_offset)
+GLATTER_IBLOCK(glXGetAGPOffsetMESA)
+#endif // defined(GLX_MESA_agp_offset)
+#if defined(GLX_MESA_copy_sub_buffer)
+GLATTER_IBLOCK(glXCopySubBufferMESA)
+#endif // defined(GLX_MESA_copy_sub_buffer)
+#if defined(GLX_MESA_pixmap_colormap)
+GLATTER_IBLOCK(glXCreateGLXPixmapMESA)
+#endif // defined(GLX_MESA_pixmap_colormap)
+#if defined(GLX_MESA_query_renderer)
+GLATTER_IBLOCK(glXQueryCurrentRendererIntegerMESA)
+GLATTER_IBLOCK(glXQueryCurrentRendererStringMESA)
+GLATTER_IBLOCK(glXQueryRendererIntegerMESA)
+GLATTER_IBLOCK(glXQueryRendererStringMESA)
+#endif // defined(GLX_MESA_query_renderer)
+#if defined(GLX_MESA_release_buffers)
+GLATTER_IBLOCK(glXReleaseBuffersMESA)
+#endif // defined(GLX_MESA_release_buffers)
+#if defined(GLX_MESA_set_3dfx_mode)
+GLATTER_IBLOCK(glXSet3DfxModeMESA)
+#endif // defined(GLX_MESA_set_3dfx_mode)
+#if defined(GLX_MESA_swap_control)
+GLATTER_IBLOCK(glXGetSwapIntervalMESA)
+GLATTER_IBLOCK(glXSwapIntervalMESA)
+#endif // defined(GLX_MESA_swap_control)
+#if defined(GLX_NV_copy_buffer)
+GLATTER_IBLOCK(glXCopyBufferSubDataNV)
+GLATTER_IBLOCK(glXNamedCopyBufferSubDataNV)
+#endif // defined(GLX_NV_copy_buffer)
+#if defined(GLX_NV_copy_image)
+GLATTER_IBLOCK(glXCopyImageSubDataNV)
+#endif // defined(GLX_NV_copy_image)
+#if defined(GLX_NV_delay_before_swap)
+GLATTER_IBLOCK(glXDelayBeforeSwapNV)
+#endif // defined(GLX_NV_delay_before_swap)
+#if defined(GLX_NV_present_video)
+GLATTER_IBLOCK(glXBindVideoDeviceNV)
+GLATTER_IBLOCK(glXEnumerateVideoDevicesNV)
+#endif // defined(GLX_NV_present_video)
+#if defined(GLX_NV_swap_group)
+GLATTER_IBLOCK(glXBindSwapBarrierNV)
+GLATTER_IBLOCK(glXJoinSwapGroupNV)
+GLATTER_IBLOCK(glXQueryFrameCountNV)
+GLATTER_IBLOCK(glXQueryMaxSwapGroupsNV)
+GLATTER_IBLOCK(glXQuerySwapGroupNV)
+GLATTER_IBLOCK(glXResetFrameCountNV)
+#endif // defined(GLX_NV_swap_group)
+#if defined(GLX_NV_video_capture)
+GLATTER_IBLOCK(glXBindVideoCaptureDeviceNV)
+GLATTER_IBLOCK(glXEnumerateVideoCaptureDevicesNV)
+GLATTER_IBLOCK(glXLockVideoCaptureDeviceNV)
+GLATTER_IBLOCK(glXQueryVideoCaptureDeviceNV)
+GLATTER_IBLOCK(glXReleaseVideoCaptureDeviceNV)
+#endif // defined(GLX_NV_video_capture)
+#if defined(GLX_NV_video_out)
+GLATTER_IBLOCK(glXBindVideoImageNV)
+GLATTER_IBLOCK(glXGetVideoDeviceNV)
+GLATTER_IBLOCK(glXGetVideoInfoNV)
+GLATTER_IBLOCK(glXReleaseVideoDeviceNV)
+GLATTER_IBLOCK(glXReleaseVideoImageNV)
+GLATTER_IBLOCK(glXSendPbufferToVideoNV)
+#endif // defined(GLX_NV_video_out)
+#if defined(GLX_OML_sync_control)
+GLATTER_IBLOCK(glXGetMscRateOML)
+GLATTER_IBLOCK(glXGetSyncValuesOML)
+GLATTER_IBLOCK(glXSwapBuffersMscOML)
+GLATTER_IBLOCK(glXWaitForMscOML)
+GLATTER_IBLOCK(glXWaitForSbcOML)
+#endif // defined(GLX_OML_sync_control)
+#if defined(GLX_SGIX_dmbuffer)
+#if defined(_DM_BUFFER_H_)
+GLATTER_IBLOCK(glXAssociateDMPbufferSGIX)
+#endif // defined(_DM_BUFFER_H_)
+#endif // defined(GLX_SGIX_dmbuffer)
+#if defined(GLX_SGIX_fbconfig)
+GLATTER_IBLOCK(glXChooseFBConfigSGIX)
+GLATTER_IBLOCK(glXCreateContextWithConfigSGIX)
+GLATTER_IBLOCK(glXCreateGLXPixmapWithConfigSGIX)
+GLATTER_IBLOCK(glXGetFBConfigAttribSGIX)
+GLATTER_IBLOCK(glXGetFBConfigFromVisualSGIX)
+GLATTER_IBLOCK(glXGetVisualFromFBConfigSGIX)
+#endif // defined(GLX_SGIX_fbconfig)
+#if defined(GLX_SGIX_hyperpipe)
+GLATTER_IBLOCK(glXBindHyperpipeSGIX)
+GLATTER_IBLOCK(glXDestroyHyperpipeConfigSGIX)
+GLATTER_IBLOCK(glXHyperpipeAttribSGIX)
+GLATTER_IBLOCK(glXHyperpipeConfigSGIX)
+GLATTER_IBLOCK(glXQueryHyperpipeAttribSGIX)
+GLATTER_IBLOCK(glXQueryHyperpipeBestAttribSGIX)
+GLATTER_IBLOCK(glXQueryHyperpipeConfigSGIX)
+GLATTER_IBLOCK(glXQueryHyperpipeNetworkSGIX)
+#endif // defined(GLX_SGIX_hyperpipe)
+#if defined(GLX_SGIX_pbuffer)
+GLATTER_IBLOCK(glXCreateGLXPbufferSGIX)
+GLATTER_IBLOCK(glXDestroyGLXPbufferSGIX)
+GLATTER_IBLOCK(glXGetSelectedEventSGIX)
+GLATTER_IBLOCK(glXQueryGLXPbufferSGIX)
+GLATTER_IBLOCK(glXSelectEventSGIX)
+#endif // defined(GLX_SGIX_pbuffer)
+#if defined(GLX_SGIX_swap_barrier)
+GLATTER_IBLOCK(glXBindSwapBarrierSGIX)
+GLATTER_IBLOCK(glXQueryMaxSwapBarriersSGIX)
+#endif // defined(GLX_SGIX_swap_barrier)
+#if defined(GLX_SGIX_swap_group)
+GLATTER_IBLOCK(glXJoinSwapGroupSGIX)
+#endif // defined(GLX_SGIX_swap_group)
+#if defined(GLX_SGIX_video_resize)
+GLATTER_IBLOCK(glXBindChannelToWindowSGIX)
+GLATTER_IBLOCK(glXChannelRectSGIX)
+GLATTER_IBLOCK(glXChannelRectSyncSGIX)
+GLATTER_IBLOCK(glXQueryChannelDeltasSGIX)
+GLATTER_IBLOCK(glXQueryChannelRectSGIX)
+#endif // defined(GLX_SGIX_video_resize)
+#if defined(GLX_SGIX_video_source)
+#if defined(_VL_H)
+GLATTER_IBLOCK(glXCreateGLXVideoSourceSGIX)
+GLATTER_IBLOCK(glXDestroyGLXVideoSourceSGIX)
+#endif // defined(_VL_H)
+#endif // defined(GLX_SGIX_video_source)
+#if defined(GLX_SGI_cushion)
+GLATTER_IBLOCK(glXCushionSGI)
+#endif // defined(GLX_SGI_cushion)
+#if defined(GLX_SGI_make_current_read)
+GLATTER_IBLOCK(glXGetCurrentReadDrawableSGI)
+GLATTER_IBLOCK(glXMakeCurrentReadSGI)
+#endif // defined(GLX_SGI_make_current_read)
+#if defined(GLX_SGI_swap_control)
+GLATTER_IBLOCK(glXSwapIntervalSGI)
+#endif // defined(GLX_SGI_swap_control)
+#if defined(GLX_SGI_video_sync)
+GLATTER_IBLOCK(glXGetVideoSyncSGI)
+GLATTER_IBLOCK(glXWaitVideoSyncSGI)
+#endif // defined(GLX_SGI_video_sync)
+#if defined(GLX_SUN_get_transparent_index)
+GLATTER_IBLOCK(glXGetTransparentIndexSUN)
+#endif // defined(GLX_SUN_get_transparent_index)
+#if defined(GLX_VERSION_1_3)
+GLATTER_IBLOCK(glXChooseFBConfig)
+GLATTER_IBLOCK(glXCreateNewContext)
+GLATTER_IBLOCK(glXCreatePbuffer)
+GLATTER_IBLOCK(glXCreatePixmap)
+GLATTER_IBLOCK(glXCreateWindow)
+GLATTER_IBLOCK(glXDestroyPbuffer)
+GLATTER_IBLOCK(glXDestroyPixmap)
+GLATTER_IBLOCK(glXDestroyWindow)
+GLATTER_IBLOCK(glXGetCurrentReadDrawable)
+GLATTER_IBLOCK(glXGetFBConfigAttrib)
+GLATTER_IBLOCK(glXGetFBConfigs)
+GLATTER_IBLOCK(glXGetSelectedEvent)
+GLATTER_IBLOCK(glXGetVisualFromFBConfig)
+GLATTER_IBLOCK(glXMakeContextCurrent)
+GLATTER_IBLOCK(glXQueryContext)
+GLATTER_IBLOCK(glXQueryDrawable)
+GLATTER_IBLOCK(glXSelectEvent)
+#endif // defined(__glx_glxext_h_)
+#endif // defined(GLX_VERSION_1_3)
+#endif // GLATTER_GLX
+
@@ -0,0 +1,3025 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Dense index of every GL entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_GL {
+    GLATTER_FN_glDrawArrays,
+    GLATTER_FN_glDrawElements,
+    GLATTER_FN_glDrawArraysInstanced,
+    GLATTER_FN_glDrawElementsInstanced,
+    GLATTER_FN_glDrawRangeElements,
+    GLATTER_FN_glDrawElementsBaseVertex,
+    GLATTER_FN_glDrawElementsInstancedBaseVertex,
+    GLATTER_FN_glDrawArraysInstancedBaseInstance,
+    GLATTER_FN_glDrawElementsInstancedBaseVertexBaseInstance,
+    GLATTER_FN_glDrawArraysIndirect,
+    GLATTER_FN_glDrawElementsIndirect,
+    GLATTER_FN_glMultiDrawArraysIndirect,
+    GLATTER_FN_glMultiDrawElementsIndirect,
+    GLATTER_FN_glBindVertexArray,
+    GLATTER_FN_glBindBuffer,
+    GLATTER_FN_glBindBufferBase,
+    GLATTER_FN_glBindBufferRange,
+    GLATTER_FN_glBindTexture,
+    GLATTER_FN_glBindTextureUnit,
+    GLATTER_FN_glBindSampler,
+    GLATTER_FN_glBindFramebuffer,
+    GLATTER_FN_glBindRenderbuffer,
+    GLATTER_FN_glBindImageTexture,
+    GLATTER_FN_glUseProgram,
+    GLATTER_FN_glBindProgramPipeline,
+    GLATTER_FN_glUniform1i,
+    GLATTER_FN_glUniform1f,
+    GLATTER_FN_glUniform2f,
+    GLATTER_FN_glUniform3f,
+    GLATTER_FN_glUniform4f,
+    GLATTER_FN_glUniform1iv,
+    GLATTER_FN_glUniform1fv,
+    GLATTER_FN_glUniform2fv,
+    GLATTER_FN_glUniform3fv,
+    GLATTER_FN_glUniform4fv,
+    GLATTER_FN_glUniformMatrix3fv,
+    GLATTER_FN_glUniformMatrix4fv,
+    GLATTER_FN_glActiveTexture,
+    GLATTER_FN_glBufferData,
+    GLATTER_FN_glBufferSubData,
+    GLATTER_FN_glMapBufferRange,
+    GLATTER_FN_glUnmapBuffer,
+    GLATTER_FN_glFlushMappedBufferRange,
+    GLATTER_FN_glTexSubImage2D,
+    GLATTER_FN_glTexImage2D,
+    GLATTER_FN_glEnable,
+    GLATTER_FN_glDisable,
+    GLATTER_FN_glEnableVertexAttribArray,
+    GLATTER_FN_glDisableVertexAttribArray,
+    GLATTER_FN_glVertexAttribPointer,
+    GLATTER_FN_glVertexAttribIPointer,
+    GLATTER_FN_glVertexAttribDivisor,
+    GLATTER_FN_glBlendFunc,
+    GLATTER_FN_glBlendFuncSeparate,
+    GLATTER_FN_glBlendEquation,
+    GLATTER_FN_glDepthFunc,
+    GLATTER_FN_glDepthMask,
+    GLATTER_FN_glColorMask,
+    GLATTER_FN_glStencilFunc,
+    GLATTER_FN_glStencilOp,
+    GLATTER_FN_glStencilMask,
+    GLATTER_FN_glCullFace,
+    GLATTER_FN_glScissor,
+    GLATTER_FN_glViewport,
+    GLATTER_FN_glPolygonOffset,
+    GLATTER_FN_glLineWidth,
+    GLATTER_FN_glClear,
+    GLATTER_FN_glClearColor,
+    GLATTER_FN_glClearDepth,
+    GLATTER_FN_glClearDepthf,
+    GLATTER_FN_glClearStencil,
+    GLATTER_FN_glClearBufferfv,
+    GLATTER_FN_glInvalidateFramebuffer,
+    GLATTER_FN_glBlitFramebuffer,
+    GLATTER_FN_glGetError,
+    GLATTER_FN_glGetIntegerv,
+    GLATTER_FN_glFenceSync,
+    GLATTER_FN_glClientWaitSync,
+    GLATTER_FN_glWaitSync,
+    GLATTER_FN_glDeleteSync,
+    GLATTER_FN_glFlush,
+    GLATTER_FN_glFinish,
+    GLATTER_FN_glAccum,
+    GLATTER_FN_glAccumxOES,
+    GLATTER_FN_glAcquireKeyedMutexWin32EXT,
+    GLATTER_FN_glActiveProgramEXT,
+    GLATTER_FN_glActiveShaderProgram,
+    GLATTER_FN_glActiveStencilFaceEXT,
+    GLATTER_FN_glActiveTextureARB,
+    GLATTER_FN_glActiveVaryingNV,
+    GLATTER_FN_glAlphaFragmentOp1ATI,
+    GLATTER_FN_glAlphaFragmentOp2ATI,
+    GLATTER_FN_glAlphaFragmentOp3ATI,
+    GLATTER_FN_glAlphaFunc,
+    GLATTER_FN_glAlphaFuncxOES,
+    GLATTER_FN_glAlphaToCoverageDitherControlNV,
+    GLATTER_FN_glApplyFramebufferAttachmentCMAAINTEL,
+    GLATTER_FN_glApplyTextureEXT,
+    GLATTER_FN_glAreProgramsResidentNV,
+    GLATTER_FN_glAreTexturesResident,
+    GLATTER_FN_glAreTexturesResidentEXT,
+    GLATTER_FN_glArrayElement,
+    GLATTER_FN_glArrayElementEXT,
+    GLATTER_FN_glArrayObjectATI,
+    GLATTER_FN_glAsyncCopyBufferSubDataNVX,
+    GLATTER_FN_glAsyncCopyImageSubDataNVX,
+    GLATTER_FN_glAsyncMarkerSGIX,
+    GLATTER_FN_glAttachObjectARB,
+    GLATTER_FN_glAttachShader,
+    GLATTER_FN_glBegin,
+    GLATTER_FN_glBeginConditionalRender,
+    GLATTER_FN_glBeginConditionalRenderNV,
+    GLATTER_FN_glBeginConditionalRenderNVX,
+    GLATTER_FN_glBeginFragmentShaderATI,
+    GLATTER_FN_glBeginOcclusionQueryNV,
+    GLATTER_FN_glBeginPerfMonitorAMD,
+    GLATTER_FN_glBeginPerfQueryINTEL,
+    GLATTER_FN_glBeginQuery,
+    GLATTER_FN_glBeginQueryARB,
+    GLATTER_FN_glBeginQueryIndexed,
+    GLATTER_FN_glBeginTransformFeedback,
+    GLATTER_FN_glBeginTransformFeedbackEXT,
+    GLATTER_FN_glBeginTransformFeedbackNV,
+    GLATTER_FN_glBeginVertexShaderEXT,
+    GLATTER_FN_glBeginVideoCaptureNV,
+    GLATTER_FN_glBindAttribLocation,
+    GLATTER_FN_glBindAttribLocationARB,
+    GLATTER_FN_glBindBufferARB,
+    GLATTER_FN_glBindBufferBaseEXT,
+    GLATTER_FN_glBindBufferBaseNV,
+    GLATTER_FN_glBindBufferOffsetEXT,
+    GLATTER_FN_glBindBufferOffsetNV,
+    GLATTER_FN_glBindBufferRangeEXT,
+    GLATTER_FN_glBindBufferRangeNV,
+    GLATTER_FN_glBindBuffersBase,
+    GLATTER_FN_glBindBuffersRange,
+    GLATTER_FN_glBindFragDataLocation,
+    GLATTER_FN_glBindFragDataLocationEXT,
+    GLATTER_FN_glBindFragDataLocationIndexed,
+    GLATTER_FN_glBindFragmentShaderATI,
+    GLATTER_FN_glBindFramebufferEXT,
+    GLATTER_FN_glBindImageTextureEXT,
+    GLATTER_FN_glBindImageTextures,
+    GLATTER_FN_glBindLightParameterEXT,
+    GLATTER_FN_glBindMaterialParameterEXT,
+    GLATTER_FN_glBindMultiTextureEXT,
+    GLATTER_FN_glBindParameterEXT,
+    GLATTER_FN_glBindProgramARB,
+    GLATTER_FN_glBindProgramNV,
+    GLATTER_FN_glBindRenderbufferEXT,
+    GLATTER_FN_glBindSamplers,
+    GLATTER_FN_glBindShadingRateImageNV,
+    GLATTER_FN_glBindTexGenParameterEXT,
+    GLATTER_FN_glBindTextureEXT,
+    GLATTER_FN_glBindTextureUnitParameterEXT,
+    GLATTER_FN_glBindTextures,
+    GLATTER_FN_glBindTransformFeedback,
+    GLATTER_FN_glBindTransformFeedbackNV,
+    GLATTER_FN_glBindVertexArrayAPPLE,
+    GLATTER_FN_glBindVertexBuffer,
+    GLATTER_FN_glBindVertexBuffers,
+    GLATTER_FN_glBindVertexShaderEXT,
+    GLATTER_FN_glBindVideoCaptureStreamBufferNV,
+    GLATTER_FN_glBindVideoCaptureStreamTextureNV,
+    GLATTER_FN_glBinormal3bEXT,
+    GLATTER_FN_glBinormal3bvEXT,
+    GLATTER_FN_glBinormal3dEXT,
+    GLATTER_FN_glBinormal3dvEXT,
+    GLATTER_FN_glBinormal3fEXT,
+    GLATTER_FN_glBinormal3fvEXT,
+    GLATTER_FN_glBinormal3iEXT,
+    GLATTER_FN_glBinormal3ivEXT,
+    GLATTER_FN_glBinormal3sEXT,
+    GLATTER_FN_glBinormal3svEXT,
+    GLATTER_FN_glBinormalPointerEXT,
+    GLATTER_FN_glBitmap,
+    GLATTER_FN_glBitmapxOES,
+    GLATTER_FN_glBlendBarrierKHR,
+    GLATTER_FN_glBlendBarrierNV,
+    GLATTER_FN_glBlendColor,
+    GLATTER_FN_glBlendColorEXT,
+    GLATTER_FN_glBlendColorxOES,
+    GLATTER_FN_glBlendEquationEXT,
+    GLATTER_FN_glBlendEquationIndexedAMD,
+    GLATTER_FN_glBlendEquationSeparate,
+    GLATTER_FN_glBlendEquationSeparateATI,
+    GLATTER_FN_glBlendEquationSeparateEXT,
+    GLATTER_FN_glBlendEquationSeparateIndexedAMD,
+    GLATTER_FN_glBlendEquationSeparatei,
+    GLATTER_FN_glBlendEquationSeparateiARB,
+    GLATTER_FN_glBlendEquationi,
+    GLATTER_FN_glBlendEquationiARB,
+    GLATTER_FN_glBlendFuncIndexedAMD,
+    GLATTER_FN_glBlendFuncSeparateEXT,
+    GLATTER_FN_glBlendFuncSeparateINGR,
+    GLATTER_FN_glBlendFuncSeparateIndexedAMD,
+    GLATTER_FN_glBlendFuncSeparatei,
+    GLATTER_FN_glBlendFuncSeparateiARB,
+    GLATTER_FN_glBlendFunci,
+    GLATTER_FN_glBlendFunciARB,
+    GLATTER_FN_glBlendParameteriNV,
+    GLATTER_FN_glBlitFramebufferEXT,
+    GLATTER_FN_glBlitFramebufferLayerEXT,
+    GLATTER_FN_glBlitFramebufferLayersEXT,
+    GLATTER_FN_glBlitNamedFramebuffer,
+    GLATTER_FN_glBufferAddressRangeNV,
+    GLATTER_FN_glBufferAttachMemoryNV,
+    GLATTER_FN_glBufferDataARB,
+    GLATTER_FN_glBufferPageCommitmentARB,
+    GLATTER_FN_glBufferPageCommitmentMemNV,
+    GLATTER_FN_glBufferParameteriAPPLE,
+    GLATTER_FN_glBufferStorage,
+    GLATTER_FN_glBufferStorageExternalEXT,
+    GLATTER_FN_glBufferStorageMemEXT,
+    GLATTER_FN_glBufferSubDataARB,
+    GLATTER_FN_glCallCommandListNV,
+    GLATTER_FN_glCallList,
+    GLATTER_FN_glCallLists,
+    GLATTER_FN_glCheckFramebufferStatus,
+    GLATTER_FN_glCheckFramebufferStatusEXT,
+    GLATTER_FN_glCheckNamedFramebufferStatus,
+    GLATTER_FN_glCheckNamedFramebufferStatusEXT,
+    GLATTER_FN_glClampColor,
+    GLATTER_FN_glClampColorARB,
+    GLATTER_FN_glClearAccum,
+    GLATTER_FN_glClearAccumxOES,
+    GLATTER_FN_glClearBufferData,
+    GLATTER_FN_glClearBufferSubData,
+    GLATTER_FN_glClearBufferfi,
+    GLATTER_FN_glClearBufferiv,
+    GLATTER_FN_glClearBufferuiv,
+    GLATTER_FN_glClearColorIiEXT,
+    GLATTER_FN_glClearColorIuiEXT,
+    GLATTER_FN_glClearColorxOES,
+    GLATTER_FN_glClearDepthdNV,
+    GLATTER_FN_glClearDepthfOES,
+    GLATTER_FN_glClearDepthxOES,
+    GLATTER_FN_glClearIndex,
+    GLATTER_FN_glClearNamedBufferData,
+    GLATTER_FN_glClearNamedBufferDataEXT,
+    GLATTER_FN_glClearNamedBufferSubData,
+    GLATTER_FN_glClearNamedBufferSubDataEXT,
+    GLATTER_FN_glClearNamedFramebufferfi,
+    GLATTER_FN_glClearNamedFramebufferfv,
+    GLATTER_FN_glClearNamedFramebufferiv,
+    GLATTER_FN_glClearNamedFramebufferuiv,
+    GLATTER_FN_glClearTexImage,
+    GLATTER_FN_glClearTexSubImage,
+    GLATTER_FN_glClientActiveTexture,
+    GLATTER_FN_glClientActiveTextureARB,
+    GLATTER_FN_glClientActiveVertexStreamATI,
+    GLATTER_FN_glClientAttribDefaultEXT,
+    GLATTER_FN_glClientWaitSemaphoreui64NVX,
+    GLATTER_FN_glClipControl,
+    GLATTER_FN_glClipPlane,
+    GLATTER_FN_glClipPlanefOES,
+    GLATTER_FN_glClipPlanexOES,
+    GLATTER_FN_glColor3b,
+    GLATTER_FN_glColor3bv,
+    GLATTER_FN_glColor3d,
+    GLATTER_FN_glColor3dv,
+    GLATTER_FN_glColor3f,
+    GLATTER_FN_glColor3fVertex3fSUN,
+    GLATTER_FN_glColor3fVertex3fvSUN,
+    GLATTER_FN_glColor3fv,
+    GLATTER_FN_glColor3hNV,
+    GLATTER_FN_glColor3hvNV,
+    GLATTER_FN_glColor3i,
+    GLATTER_FN_glColor3iv,
+    GLATTER_FN_glColor3s,
+    GLATTER_FN_glColor3sv,
+    GLATTER_FN_glColor3ub,
+    GLATTER_FN_glColor3ubv,
+    GLATTER_FN_glColor3ui,
+    GLATTER_FN_glColor3uiv,
+    GLATTER_FN_glColor3us,
+    GLATTER_FN_glColor3usv,
+    GLATTER_FN_glColor3xOES,
+    GLATTER_FN_glColor3xvOES,
+    GLATTER_FN_glColor4b,
+    GLATTER_FN_glColor4bv,
+    GLATTER_FN_glColor4d,
+    GLATTER_FN_glColor4dv,
+    GLATTER_FN_glColor4f,
+    GLATTER_FN_glColor4fNormal3fVertex3fSUN,
+    GLATTER_FN_glColor4fNormal3fVertex3fvSUN,
+    GLATTER_FN_glColor4fv,
+    GLATTER_FN_glColor4hNV,
+    GLATTER_FN_glColor4hvNV,
+    GLATTER_FN_glColor4i,
+    GLATTER_FN_glColor4iv,
+    GLATTER_FN_glColor4s,
+    GLATTER_FN_glColor4sv,
+    GLATTER_FN_glColor4ub,
+    GLATTER_FN_glColor4ubVertex2fSUN,
+    GLATTER_FN_glColor4ubVertex2fvSUN,
+    GLATTER_FN_glColor4ubVertex3fSUN,
+    GLATTER_FN_glColor4ubVertex3fvSUN,
+    GLATTER_FN_glColor4ubv,
+    GLATTER_FN_glColor4ui,
+    GLATTER_FN_glColor4uiv,
+    GLATTER_FN_glColor4us,
+    GLATTER_FN_glColor4usv,
+    GLATTER_FN_glColor4xOES,
+    GLATTER_FN_glColor4xvOES,
+    GLATTER_FN_glColorFormatNV,
+    GLATTER_FN_glColorFragmentOp1ATI,
+    GLATTER_FN_glColorFragmentOp2ATI,
+    GLATTER_FN_glColorFragmentOp3ATI,
+    GLATTER_FN_glColorMaskIndexedEXT,
+    GLATTER_FN_glColorMaski,
+    GLATTER_FN_glColorMaterial,
+    GLATTER_FN_glColorP3ui,
+    GLATTER_FN_glColorP3uiv,
+    GLATTER_FN_glColorP4ui,
+    GLATTER_FN_glColorP4uiv,
+    GLATTER_FN_glColorPointer,
+    GLATTER_FN_glColorPointerEXT,
+    GLATTER_FN_glColorPointerListIBM,
+    GLATTER_FN_glColorPointervINTEL,
+    GLATTER_FN_glColorSubTable,
+    GLATTER_FN_glColorSubTableEXT,
+    GLATTER_FN_glColorTable,
+    GLATTER_FN_glColorTableEXT,
+    GLATTER_FN_glColorTableParameterfv,
+    GLATTER_FN_glColorTableParameterfvSGI,
+    GLATTER_FN_glColorTableParameteriv,
+    GLATTER_FN_glColorTableParameterivSGI,
+    GLATTER_FN_glColorTableSGI,
+    GLATTER_FN_glCombinerInputNV,
+    GLATTER_FN_glCombinerOutputNV,
+    GLATTER_FN_glCombinerParameterfNV,
+    GLATTER_FN_glCombinerParameterfvNV,
+    GLATTER_FN_glCombinerParameteriNV,
+    GLATTER_FN_glCombinerParameterivNV,
+    GLATTER_FN_glCombinerStageParameterfvNV,
+    GLATTER_FN_glCommandListSegmentsNV,
+    GLATTER_FN_glCompileCommandListNV,
+    GLATTER_FN_glCompileShader,
+    GLATTER_FN_glCompileShaderARB,
+    GLATTER_FN_glCompileShaderIncludeARB,
+    GLATTER_FN_glCompressedMultiTexImage1DEXT,
+    GLATTER_FN_glCompressedMultiTexImage2DEXT,
+    GLATTER_FN_glCompressedMultiTexImage3DEXT,
+    GLATTER_FN_glCompressedMultiTexSubImage1DEXT,
+    GLATTER_FN_glCompressedMultiTexSubImage2DEXT,
+    GLATTER_FN_glCompressedMultiTexSubImage3DEXT,
+    GLATTER_FN_glCompressedTexImage1D,
+    GLATTER_FN_glCompressedTexImage1DARB,
+    GLATTER_FN_glCompressedTexImage2D,
+    GLATTER_FN_glCompressedTexImage2DARB,
+    GLATTER_FN_glCompressedTexImage3D,
+    GLATTER_FN_glCompressedTexImage3DARB,
+    GLATTER_FN_glCompressedTexSubImage1D,
+    GLATTER_FN_glCompressedTexSubImage1DARB,
+    GLATTER_FN_glCompressedTexSubImage2D,
+    GLATTER_FN_glCompressedTexSubImage2DARB,
+    GLATTER_FN_glCompressedTexSubImage3D,
+    GLATTER_FN_glCompressedTexSubImage3DARB,
+    GLATTER_FN_glCompressedTextureImage1DEXT,
+    GLATTER_FN_glCompressedTextureImage2DEXT,
+    GLATTER_FN_glCompressedTextureImage3DEXT,
+    GLATTER_FN_glCompressedTextureSubImage1D,
+    GLATTER_FN_glCompressedTextureSubImage1DEXT,
+    GLATTER_FN_glCompressedTextureSubImage2D,
+    GLATTER_FN_glCompressedTextureSubImage2DEXT,
+    GLATTER_FN_glCompressedTextureSubImage3D,
+    GLATTER_FN_glCompressedTextureSubImage3DEXT,
+    GLATTER_FN_glConservativeRasterParameterfNV,
+    GLATTER_FN_glConservativeRasterParameteriNV,
+    GLATTER_FN_glConvolutionFilter1D,
+    GLATTER_FN_glConvolutionFilter1DEXT,
+    GLATTER_FN_glConvolutionFilter2D,
+    GLATTER_FN_glConvolutionFilter2DEXT,
+    GLATTER_FN_glConvolutionParameterf,
+    GLATTER_FN_glConvolutionParameterfEXT,
+    GLATTER_FN_glConvolutionParameterfv,
+    GLATTER_FN_glConvolutionParameterfvEXT,
+    GLATTER_FN_glConvolutionParameteri,
+    GLATTER_FN_glConvolutionParameteriEXT,
+    GLATTER_FN_glConvolutionParameteriv,
+    GLATTER_FN_glConvolutionParameterivEXT,
+    GLATTER_FN_glConvolutionParameterxOES,
+    GLATTER_FN_glConvolutionParameterxvOES,
+    GLATTER_FN_glCopyBufferSubData,
+    GLATTER_FN_glCopyColorSubTable,
+    GLATTER_FN_glCopyColorSubTableEXT,
+    GLATTER_FN_glCopyColorTable,
+    GLATTER_FN_glCopyColorTableSGI,
+    GLATTER_FN_glCopyConvolutionFilter1D,
+    GLATTER_FN_glCopyConvolutionFilter1DEXT,
+    GLATTER_FN_glCopyConvolutionFilter2D,
+    GLATTER_FN_glCopyConvolutionFilter2DEXT,
+    GLATTER_FN_glCopyImageSubData,
+    GLATTER_FN_glCopyImageSubDataNV,
+    GLATTER_FN_glCopyMultiTexImage1DEXT,
+    GLATTER_FN_glCopyMultiTexImage2DEXT,
+    GLATTER_FN_glCopyMultiTexSubImage1DEXT,
+    GLATTER_FN_glCopyMultiTexSubImage2DEXT,
+    GLATTER_FN_glCopyMultiTexSubImage3DEXT,
+    GLATTER_FN_glCopyNamedBufferSubData,
+    GLATTER_FN_glCopyPathNV,
+    GLATTER_FN_glCopyPixels,
+    GLATTER_FN_glCopyTexImage1D,
+    GLATTER_FN_glCopyTexImage1DEXT,
+    GLATTER_FN_glCopyTexImage2D,
+    GLATTER_FN_glCopyTexImage2DEXT,
+    GLATTER_FN_glCopyTexSubImage1D,
+    GLATTER_FN_glCopyTexSubImage1DEXT,
+    GLATTER_FN_glCopyTexSubImage2D,
+    GLATTER_FN_glCopyTexSubImage2DEXT,
+    GLATTER_FN_glCopyTexSubImage3D,
+    GLATTER_FN_glCopyTexSubImage3DEXT,
+    GLATTER_FN_glCopyTextureImage1DEXT,
+    GLATTER_FN_glCopyTextureImage2DEXT,
+    GLATTER_FN_glCopyTextureSubImage1D,
+    GLATTER_FN_glCopyTextureSubImage1DEXT,
+    GLATTER_FN_glCopyTextureSubImage2D,
+    GLATTER_FN_glCopyTextureSubImage2DEXT,
+    GLATTER_FN_glCopyTextureSubImage3D,
+    GLATTER_FN_glCopyTextureSubImage3DEXT,
+    GLATTER_FN_glCoverFillPathInstancedNV,
+    GLATTER_FN_glCoverFillPathNV,
+    GLATTER_FN_glCoverStrokePathInstancedNV,
+    GLATTER_FN_glCoverStrokePathNV,
+    GLATTER_FN_glCoverageModulationNV,
+    GLATTER_FN_glCoverageModulationTableNV,
+    GLATTER_FN_glCreateBuffers,
+    GLATTER_FN_glCreateCommandListsNV,
+    GLATTER_FN_glCreateFramebuffers,
+    GLATTER_FN_glCreateMemoryObjectsEXT,
+    GLATTER_FN_glCreatePerfQueryINTEL,
+    GLATTER_FN_glCreateProgram,
+    GLATTER_FN_glCreateProgramObjectARB,
+    GLATTER_FN_glCreateProgramPipelines,
+    GLATTER_FN_glCreateProgressFenceNVX,
+    GLATTER_FN_glCreateQueries,
+    GLATTER_FN_glCreateRenderbuffers,
+    GLATTER_FN_glCreateSamplers,
+    GLATTER_FN_glCreateSemaphoresNV,
+    GLATTER_FN_glCreateShader,
+    GLATTER_FN_glCreateShaderObjectARB,
+    GLATTER_FN_glCreateShaderProgramEXT,
+    GLATTER_FN_glCreateShaderProgramv,
+    GLATTER_FN_glCreateStatesNV,
+    GLATTER_FN_glCreateSyncFromCLeventARB,
+    GLATTER_FN_glCreateTextures,
+    GLATTER_FN_glCreateTransformFeedbacks,
+    GLATTER_FN_glCreateVertexArrays,
+    GLATTER_FN_glCullParameterdvEXT,
+    GLATTER_FN_glCullParameterfvEXT,
+    GLATTER_FN_glCurrentPaletteMatrixARB,
+    GLATTER_FN_glDebugMessageCallback,
+    GLATTER_FN_glDebugMessageCallbackAMD,
+    GLATTER_FN_glDebugMessageCallbackARB,
+    GLATTER_FN_glDebugMessageControl,
+    GLATTER_FN_glDebugMessageControlARB,
+    GLATTER_FN_glDebugMessageEnableAMD,
+    GLATTER_FN_glDebugMessageInsert,
+    GLATTER_FN_glDebugMessageInsertAMD,
+    GLATTER_FN_glDebugMessageInsertARB,
+    GLATTER_FN_glDeformSGIX,
+    GLATTER_FN_glDeformationMap3dSGIX,
+    GLATTER_FN_glDeformationMap3fSGIX,
+    GLATTER_FN_glDeleteAsyncMarkersSGIX,
+    GLATTER_FN_glDeleteBuffers,
+    GLATTER_FN_glDeleteBuffersARB,
+    GLATTER_FN_glDeleteCommandListsNV,
+    GLATTER_FN_glDeleteFencesAPPLE,
+    GLATTER_FN_glDeleteFencesNV,
+    GLATTER_FN_glDeleteFragmentShaderATI,
+    GLATTER_FN_glDeleteFramebuffers,
+    GLATTER_FN_glDeleteFramebuffersEXT,
+    GLATTER_FN_glDeleteLists,
+    GLATTER_FN_glDeleteMemoryObjectsEXT,
+    GLATTER_FN_glDeleteNamedStringARB,
+    GLATTER_FN_glDeleteNamesAMD,
+    GLATTER_FN_glDeleteObjectARB,
+    GLATTER_FN_glDeleteOcclusionQueriesNV,
+    GLATTER_FN_glDeletePathsNV,
+    GLATTER_FN_glDeletePerfMonitorsAMD,
+    GLATTER_FN_glDeletePerfQueryINTEL,
+    GLATTER_FN_glDeleteProgram,
+    GLATTER_FN_glDeleteProgramPipelines,
+    GLATTER_FN_glDeleteProgramsARB,
+    GLATTER_FN_glDeleteProgramsNV,
+    GLATTER_FN_glDeleteQueries,
+    GLATTER_FN_glDeleteQueriesARB,
+    GLATTER_FN_glDeleteQueryResourceTagNV,
+    GLATTER_FN_glDeleteRenderbuffers,
+    GLATTER_FN_glDeleteRenderbuffersEXT,
+    GLATTER_FN_glDeleteSamplers,
+    GLATTER_FN_glDeleteSemaphoresEXT,
+    GLATTER_FN_glDeleteShader,
+    GLATTER_FN_glDeleteStatesNV,
+    GLATTER_FN_glDeleteTextures,
+    GLATTER_FN_glDeleteTexturesEXT,
+    GLATTER_FN_glDeleteTransformFeedbacks,
+    GLATTER_FN_glDeleteTransformFeedbacksNV,
+    GLATTER_FN_glDeleteVertexArrays,
+    GLATTER_FN_glDeleteVertexArraysAPPLE,
+    GLATTER_FN_glDeleteVertexShaderEXT,
+    GLATTER_FN_glDepthBoundsEXT,
+    GLATTER_FN_glDepthBoundsdNV,
+    GLATTER_FN_glDepthRange,
+    GLATTER_FN_glDepthRangeArraydvNV,
+    GLATTER_FN_glDepthRangeArrayv,
+    GLATTER_FN_glDepthRangeIndexed,
+    GLATTER_FN_glDepthRangeIndexeddNV,
+    GLATTER_FN_glDepthRangedNV,
+    GLATTER_FN_glDepthRangef,
+    GLATTER_FN_glDepthRangefOES,
+    GLATTER_FN_glDepthRangexOES,
+    GLATTER_FN_glDetachObjectARB,
+    GLATTER_FN_glDetachShader,
+    GLATTER_FN_glDetailTexFuncSGIS,
+    GLATTER_FN_glDisableClientState,
+    GLATTER_FN_glDisableClientStateIndexedEXT,
+    GLATTER_FN_glDisableClientStateiEXT,
+    GLATTER_FN_glDisableIndexedEXT,
+    GLATTER_FN_glDisableVariantClientStateEXT,
+    GLATTER_FN_glDisableVertexArrayAttrib,
+    GLATTER_FN_glDisableVertexArrayAttribEXT,
+    GLATTER_FN_glDisableVertexArrayEXT,
+    GLATTER_FN_glDisableVertexAttribAPPLE,
+    GLATTER_FN_glDisableVertexAttribArrayARB,
+    GLATTER_FN_glDisablei,
+    GLATTER_FN_glDispatchCompute,
+    GLATTER_FN_glDispatchComputeGroupSizeARB,
+    GLATTER_FN_glDispatchComputeIndirect,
+    GLATTER_FN_glDrawArraysEXT,
+    GLATTER_FN_glDrawArraysInstancedARB,
+    GLATTER_FN_glDrawArraysInstancedEXT,
+    GLATTER_FN_glDrawBuffer,
+    GLATTER_FN_glDrawBuffers,
+    GLATTER_FN_glDrawBuffersARB,
+    GLATTER_FN_glDrawBuffersATI,
+    GLATTER_FN_glDrawCommandsAddressNV,
+    GLATTER_FN_glDrawCommandsNV,
+    GLATTER_FN_glDrawCommandsStatesAddressNV,
+    GLATTER_FN_glDrawCommandsStatesNV,
+    GLATTER_FN_glDrawElementArrayAPPLE,
+    GLATTER_FN_glDrawElementArrayATI,
+    GLATTER_FN_glDrawElementsInstancedARB,
+    GLATTER_FN_glDrawElementsInstancedBaseInstance,
+    GLATTER_FN_glDrawElementsInstancedEXT,
+    GLATTER_FN_glDrawMeshArraysSUN,
+    GLATTER_FN_glDrawMeshTasksEXT,
+    GLATTER_FN_glDrawMeshTasksIndirectEXT,
+    GLATTER_FN_glDrawMeshTasksIndirectNV,
+    GLATTER_FN_glDrawMeshTasksNV,
+    GLATTER_FN_glDrawPixels,
+    GLATTER_FN_glDrawRangeElementArrayAPPLE,
+    GLATTER_FN_glDrawRangeElementArrayATI,
+    GLATTER_FN_glDrawRangeElementsBaseVertex,
+    GLATTER_FN_glDrawRangeElementsEXT,
+    GLATTER_FN_glDrawTextureNV,
+    GLATTER_FN_glDrawTransformFeedback,
+    GLATTER_FN_glDrawTransformFeedbackInstanced,
+    GLATTER_FN_glDrawTransformFeedbackNV,
+    GLATTER_FN_glDrawTransformFeedbackStream,
+    GLATTER_FN_glDrawTransformFeedbackStreamInstanced,
+    GLATTER_FN_glDrawVkImageNV,
+    GLATTER_FN_glEGLImageTargetTexStorageEXT,
+    GLATTER_FN_glEGLImageTargetTextureStorageEXT,
+    GLATTER_FN_glEdgeFlag,
+    GLATTER_FN_glEdgeFlagFormatNV,
+    GLATTER_FN_glEdgeFlagPointer,
+    GLATTER_FN_glEdgeFlagPointerEXT,
+    GLATTER_FN_glEdgeFlagPointerListIBM,
+    GLATTER_FN_glEdgeFlagv,
+    GLATTER_FN_glElementPointerAPPLE,
+    GLATTER_FN_glElementPointerATI,
+    GLATTER_FN_glEnableClientState,
+    GLATTER_FN_glEnableClientStateIndexedEXT,
+    GLATTER_FN_glEnableClientStateiEXT,
+    GLATTER_FN_glEnableIndexedEXT,
+    GLATTER_FN_glEnableVariantClientStateEXT,
+    GLATTER_FN_glEnableVertexArrayAttrib,
+    GLATTER_FN_glEnableVertexArrayAttribEXT,
+    GLATTER_FN_glEnableVertexArrayEXT,
+    GLATTER_FN_glEnableVertexAttribAPPLE,
+    GLATTER_FN_glEnableVertexAttribArrayARB,
+    GLATTER_FN_glEnablei,
+    GLATTER_FN_glEnd,
+    GLATTER_FN_glEndConditionalRender,
+    GLATTER_FN_glEndConditionalRenderNV,
+    GLATTER_FN_glEndConditionalRenderNVX,
+    GLATTER_FN_glEndFragmentShaderATI,
+    GLATTER_FN_glEndList,
+    GLATTER_FN_glEndOcclusionQueryNV,
+    GLATTER_FN_glEndPerfMonitorAMD,
+    GLATTER_FN_glEndPerfQueryINTEL,
+    GLATTER_FN_glEndQuery,
+    GLATTER_FN_glEndQueryARB,
+    GLATTER_FN_glEndQueryIndexed,
+    GLATTER_FN_glEndTransformFeedback,
+    GLATTER_FN_glEndTransformFeedbackEXT,
+    GLATTER_FN_glEndTransformFeedbackNV,
+    GLATTER_FN_glEndVertexShaderEXT,
+    GLATTER_FN_glEndVideoCaptureNV,
+    GLATTER_FN_glEvalCoord1d,
+    GLATTER_FN_glEvalCoord1dv,
+    GLATTER_FN_glEvalCoord1f,
+    GLATTER_FN_glEvalCoord1fv,
+    GLATTER_FN_glEvalCoord1xOES,
+    GLATTER_FN_glEvalCoord1xvOES,
+    GLATTER_FN_glEvalCoord2d,
+    GLATTER_FN_glEvalCoord2dv,
+    GLATTER_FN_glEvalCoord2f,
+    GLATTER_FN_glEvalCoord2fv,
+    GLATTER_FN_glEvalCoord2xOES,
+    GLATTER_FN_glEvalCoord2xvOES,
+    GLATTER_FN_glEvalMapsNV,
+    GLATTER_FN_glEvalMesh1,
+    GLATTER_FN_glEvalMesh2,
+    GLATTER_FN_glEvalPoint1,
+    GLATTER_FN_glEvalPoint2,
+    GLATTER_FN_glEvaluateDepthValuesARB,
+    GLATTER_FN_glExecuteProgramNV,
+    GLATTER_FN_glExtractComponentEXT,
+    GLATTER_FN_glFeedbackBuffer,
+    GLATTER_FN_glFeedbackBufferxOES,
+    GLATTER_FN_glFinalCombinerInputNV,
+    GLATTER_FN_glFinishAsyncSGIX,
+    GLATTER_FN_glFinishFenceAPPLE,
+    GLATTER_FN_glFinishFenceNV,
+    GLATTER_FN_glFinishObjectAPPLE,
+    GLATTER_FN_glFinishTextureSUNX,
+    GLATTER_FN_glFlushMappedBufferRangeAPPLE,
+    GLATTER_FN_glFlushMappedNamedBufferRange,
+    GLATTER_FN_glFlushMappedNamedBufferRangeEXT,
+    GLATTER_FN_glFlushPixelDataRangeNV,
+    GLATTER_FN_glFlushRasterSGIX,
+    GLATTER_FN_glFlushStaticDataIBM,
+    GLATTER_FN_glFlushVertexArrayRangeAPPLE,
+    GLATTER_FN_glFlushVertexArrayRangeNV,
+    GLATTER_FN_glFogCoordFormatNV,
+    GLATTER_FN_glFogCoordPointer,
+    GLATTER_FN_glFogCoordPointerEXT,
+    GLATTER_FN_glFogCoordPointerListIBM,
+    GLATTER_FN_glFogCoordd,
+    GLATTER_FN_glFogCoorddEXT,
+    GLATTER_FN_glFogCoorddv,
+    GLATTER_FN_glFogCoorddvEXT,
+    GLATTER_FN_glFogCoordf,
+    GLATTER_FN_glFogCoordfEXT,
+    GLATTER_FN_glFogCoordfv,
+    GLATTER_FN_glFogCoordfvEXT,
+    GLATTER_FN_glFogCoordhNV,
+    GLATTER_FN_glFogCoordhvNV,
+    GLATTER_FN_glFogFuncSGIS,
+    GLATTER_FN_glFogf,
+    GLATTER_FN_glFogfv,
+    GLATTER_FN_glFogi,
+    GLATTER_FN_glFogiv,
+    GLATTER_FN_glFogxOES,
+    GLATTER_FN_glFogxvOES,
+    GLATTER_FN_glFragmentColorMaterialSGIX,
+    GLATTER_FN_glFragmentCoverageColorNV,
+    GLATTER_FN_glFragmentLightModelfSGIX,
+    GLATTER_FN_glFragmentLightModelfvSGIX,
+    GLATTER_FN_glFragmentLightModeliSGIX,
+    GLATTER_FN_glFragmentLightModelivSGIX,
+    GLATTER_FN_glFragmentLightfSGIX,
+    GLATTER_FN_glFragmentLightfvSGIX,
+    GLATTER_FN_glFragmentLightiSGIX,
+    GLATTER_FN_glFragmentLightivSGIX,
+    GLATTER_FN_glFragmentMaterialfSGIX,
+    GLATTER_FN_glFragmentMaterialfvSGIX,
+    GLATTER_FN_glFragmentMaterialiSGIX,
+    GLATTER_FN_glFragmentMaterialivSGIX,
+    GLATTER_FN_glFrameTerminatorGREMEDY,
+    GLATTER_FN_glFrameZoomSGIX,
+    GLATTER_FN_glFramebufferDrawBufferEXT,
+    GLATTER_FN_glFramebufferDrawBuffersEXT,
+    GLATTER_FN_glFramebufferFetchBarrierEXT,
+    GLATTER_FN_glFramebufferParameteri,
+    GLATTER_FN_glFramebufferParameteriMESA,
+    GLATTER_FN_glFramebufferReadBufferEXT,
+    GLATTER_FN_glFramebufferRenderbuffer,
+    GLATTER_FN_glFramebufferRenderbufferEXT,
+    GLATTER_FN_glFramebufferSampleLocationsfvARB,
+    GLATTER_FN_glFramebufferSampleLocationsfvNV,
+    GLATTER_FN_glFramebufferSamplePositionsfvAMD,
+    GLATTER_FN_glFramebufferShadingRateEXT,
+    GLATTER_FN_glFramebufferTexture,
+    GLATTER_FN_glFramebufferTexture1D,
+    GLATTER_FN_glFramebufferTexture1DEXT,
+    GLATTER_FN_glFramebufferTexture2D,
+    GLATTER_FN_glFramebufferTexture2DEXT,
+    GLATTER_FN_glFramebufferTexture3D,
+    GLATTER_FN_glFramebufferTexture3DEXT,
+    GLATTER_FN_glFramebufferTextureARB,
+    GLATTER_FN_glFramebufferTextureEXT,
+    GLATTER_FN_glFramebufferTextureFaceARB,
+    GLATTER_FN_glFramebufferTextureFaceEXT,
+    GLATTER_FN_glFramebufferTextureLayer,
+    GLATTER_FN_glFramebufferTextureLayerARB,
+    GLATTER_FN_glFramebufferTextureLayerEXT,
+    GLATTER_FN_glFramebufferTextureMultiviewOVR,
+    GLATTER_FN_glFreeObjectBufferATI,
+    GLATTER_FN_glFrontFace,
+    GLATTER_FN_glFrustum,
+    GLATTER_FN_glFrustumfOES,
+    GLATTER_FN_glFrustumxOES,
+    GLATTER_FN_glGenAsyncMarkersSGIX,
+    GLATTER_FN_glGenBuffers,
+    GLATTER_FN_glGenBuffersARB,
+    GLATTER_FN_glGenFencesAPPLE,
+    GLATTER_FN_glGenFencesNV,
+    GLATTER_FN_glGenFragmentShadersATI,
+    GLATTER_FN_glGenFramebuffers,
+    GLATTER_FN_glGenFramebuffersEXT,
+    GLATTER_FN_glGenLists,
+    GLATTER_FN_glGenNamesAMD,
+    GLATTER_FN_glGenOcclusionQueriesNV,
+    GLATTER_FN_glGenPathsNV,
+    GLATTER_FN_glGenPerfMonitorsAMD,
+    GLATTER_FN_glGenProgramPipelines,
+    GLATTER_FN_glGenProgramsARB,
+    GLATTER_FN_glGenProgramsNV,
+    GLATTER_FN_glGenQueries,
+    GLATTER_FN_glGenQueriesARB,
+    GLATTER_FN_glGenQueryResourceTagNV,
+    GLATTER_FN_glGenRenderbuffers,
+    GLATTER_FN_glGenRenderbuffersEXT,
+    GLATTER_FN_glGenSamplers,
+    GLATTER_FN_glGenSemaphoresEXT,
+    GLATTER_FN_glGenSymbolsEXT,
+    GLATTER_FN_glGenTextures,
+    GLATTER_FN_glGenTexturesEXT,
+    GLATTER_FN_glGenTransformFeedbacks,
+    GLATTER_FN_glGenTransformFeedbacksNV,
+    GLATTER_FN_glGenVertexArrays,
+    GLATTER_FN_glGenVertexArraysAPPLE,
+    GLATTER_FN_glGenVertexShadersEXT,
+    GLATTER_FN_glGenerateMipmap,
+    GLATTER_FN_glGenerateMipmapEXT,
+    GLATTER_FN_glGenerateMultiTexMipmapEXT,
+    GLATTER_FN_glGenerateTextureMipmap,
+    GLATTER_FN_glGenerateTextureMipmapEXT,
+    GLATTER_FN_glGetActiveAtomicCounterBufferiv,
+    GLATTER_FN_glGetActiveAttrib,
+    GLATTER_FN_glGetActiveAttribARB,
+    GLATTER_FN_glGetActiveSubroutineName,
+    GLATTER_FN_glGetActiveSubroutineUniformName,
+    GLATTER_FN_glGetActiveSubroutineUniformiv,
+    GLATTER_FN_glGetActiveUniform,
+    GLATTER_FN_glGetActiveUniformARB,
+    GLATTER_FN_glGetActiveUniformBlockName,
+    GLATTER_FN_glGetActiveUniformBlockiv,
+    GLATTER_FN_glGetActiveUniformName,
+    GLATTER_FN_glGetActiveUniformsiv,
+    GLATTER_FN_glGetActiveVaryingNV,
+    GLATTER_FN_glGetArrayObjectfvATI,
+    GLATTER_FN_glGetArrayObjectivATI,
+    GLATTER_FN_glGetAttachedObjectsARB,
+    GLATTER_FN_glGetAttachedShaders,
+    GLATTER_FN_glGetAttribLocation,
+    GLATTER_FN_glGetAttribLocationARB,
+    GLATTER_FN_glGetBooleanIndexedvEXT,
+    GLATTER_FN_glGetBooleani_v,
+    GLATTER_FN_glGetBooleanv,
+    GLATTER_FN_glGetBufferParameteri64v,
+    GLATTER_FN_glGetBufferParameteriv,
+    GLATTER_FN_glGetBufferParameterivARB,
+    GLATTER_FN_glGetBufferParameterui64vNV,
+    GLATTER_FN_glGetBufferPointerv,
+    GLATTER_FN_glGetBufferPointervARB,
+    GLATTER_FN_glGetBufferSubData,
+    GLATTER_FN_glGetBufferSubDataARB,
+    GLATTER_FN_glGetClipPlane,
+    GLATTER_FN_glGetClipPlanefOES,
+    GLATTER_FN_glGetClipPlanexOES,
+    GLATTER_FN_glGetColorTable,
+    GLATTER_FN_glGetColorTableEXT,
+    GLATTER_FN_glGetColorTableParameterfv,
+    GLATTER_FN_glGetColorTableParameterfvEXT,
+    GLATTER_FN_glGetColorTableParameterfvSGI,
+    GLATTER_FN_glGetColorTableParameteriv,
+    GLATTER_FN_glGetColorTableParameterivEXT,
+    GLATTER_FN_glGetColorTableParameterivSGI,
+    GLATTER_FN_glGetColorTableSGI,
+    GLATTER_FN_glGetCombinerInputParameterfvNV,
+    GLATTER_FN_glGetCombinerInputParameterivNV,
+    GLATTER_FN_glGetCombinerOutputParameterfvNV,
+    GLATTER_FN_glGetCombinerOutputParameterivNV,
+    GLATTER_FN_glGetCombinerStageParameterfvNV,
+    GLATTER_FN_glGetCommandHeaderNV,
+    GLATTER_FN_glGetCompressedMultiTexImageEXT,
+    GLATTER_FN_glGetCompressedTexImage,
+    GLATTER_FN_glGetCompressedTexImageARB,
+    GLATTER_FN_glGetCompressedTextureImage,
+    GLATTER_FN_glGetCompressedTextureImageEXT,
+    GLATTER_FN_glGetCompressedTextureSubImage,
+    GLATTER_FN_glGetConvolutionFilter,
+    GLATTER_FN_glGetConvolutionFilterEXT,
+    GLATTER_FN_glGetConvolutionParameterfv,
+    GLATTER_FN_glGetConvolutionParameterfvEXT,
+    GLATTER_FN_glGetConvolutionParameteriv,
+    GLATTER_FN_glGetConvolutionParameterivEXT,
+    GLATTER_FN_glGetConvolutionParameterxvOES,
+    GLATTER_FN_glGetCoverageModulationTableNV,
+    GLATTER_FN_glGetDebugMessageLog,
+    GLATTER_FN_glGetDebugMessageLogAMD,
+    GLATTER_FN_glGetDebugMessageLogARB,
+    GLATTER_FN_glGetDetailTexFuncSGIS,
+    GLATTER_FN_glGetDoubleIndexedvEXT,
+    GLATTER_FN_glGetDoublei_v,
+    GLATTER_FN_glGetDoublei_vEXT,
+    GLATTER_FN_glGetDoublev,
+    GLATTER_FN_glGetFenceivNV,
+    GLATTER_FN_glGetFinalCombinerInputParameterfvNV,
+    GLATTER_FN_glGetFinalCombinerInputParameterivNV,
+    GLATTER_FN_glGetFirstPerfQueryIdINTEL,
+    GLATTER_FN_glGetFixedvOES,
+    GLATTER_FN_glGetFloatIndexedvEXT,
+    GLATTER_FN_glGetFloati_v,
+    GLATTER_FN_glGetFloati_vEXT,
+    GLATTER_FN_glGetFloatv,
+    GLATTER_FN_glGetFogFuncSGIS,
+    GLATTER_FN_glGetFragDataIndex,
+    GLATTER_FN_glGetFragDataLocation,
+    GLATTER_FN_glGetFragDataLocationEXT,
+    GLATTER_FN_glGetFragmentLightfvSGIX,
+    GLATTER_FN_glGetFragmentLightivSGIX,
+    GLATTER_FN_glGetFragmentMaterialfvSGIX,
+    GLATTER_FN_glGetFragmentMaterialivSGIX,
+    GLATTER_FN_glGetFragmentShadingRatesEXT,
+    GLATTER_FN_glGetFramebufferAttachmentParameteriv,
+    GLATTER_FN_glGetFramebufferAttachmentParameterivEXT,
+    GLATTER_FN_glGetFramebufferParameterfvAMD,
+    GLATTER_FN_glGetFramebufferParameteriv,
+    GLATTER_FN_glGetFramebufferParameterivEXT,
+    GLATTER_FN_glGetFramebufferParameterivMESA,
+    GLATTER_FN_glGetGraphicsResetStatus,
+    GLATTER_FN_glGetGraphicsResetStatusARB,
+    GLATTER_FN_glGetHandleARB,
+    GLATTER_FN_glGetHistogram,
+    GLATTER_FN_glGetHistogramEXT,
+    GLATTER_FN_glGetHistogramParameterfv,
+    GLATTER_FN_glGetHistogramParameterfvEXT,
+    GLATTER_FN_glGetHistogramParameteriv,
+    GLATTER_FN_glGetHistogramParameterivEXT,
+    GLATTER_FN_glGetHistogramParameterxvOES,
+    GLATTER_FN_glGetImageHandleARB,
+    GLATTER_FN_glGetImageHandleNV,
+    GLATTER_FN_glGetImageTransformParameterfvHP,
+    GLATTER_FN_glGetImageTransformParameterivHP,
+    GLATTER_FN_glGetInfoLogARB,
+    GLATTER_FN_glGetInstrumentsSGIX,
+    GLATTER_FN_glGetInteger64i_v,
+    GLATTER_FN_glGetInteger64v,
+    GLATTER_FN_glGetIntegerIndexedvEXT,
+    GLATTER_FN_glGetIntegeri_v,
+    GLATTER_FN_glGetIntegerui64i_vNV,
+    GLATTER_FN_glGetIntegerui64vNV,
+    GLATTER_FN_glGetInternalformatSampleivNV,
+    GLATTER_FN_glGetInternalformati64v,
+    GLATTER_FN_glGetInternalformativ,
+    GLATTER_FN_glGetInvariantBooleanvEXT,
+    GLATTER_FN_glGetInvariantFloatvEXT,
+    GLATTER_FN_glGetInvariantIntegervEXT,
+    GLATTER_FN_glGetLightfv,
+    GLATTER_FN_glGetLightiv,
+    GLATTER_FN_glGetLightxOES,
+    GLATTER_FN_glGetListParameterfvSGIX,
+    GLATTER_FN_glGetListParameterivSGIX,
+    GLATTER_FN_glGetLocalConstantBooleanvEXT,
+    GLATTER_FN_glGetLocalConstantFloatvEXT,
+    GLATTER_FN_glGetLocalConstantIntegervEXT,
+    GLATTER_FN_glGetMapAttribParameterfvNV,
+    GLATTER_FN_glGetMapAttribParameterivNV,
+    GLATTER_FN_glGetMapControlPointsNV,
+    GLATTER_FN_glGetMapParameterfvNV,
+    GLATTER_FN_glGetMapParameterivNV,
+    GLATTER_FN_glGetMapdv,
+    GLATTER_FN_glGetMapfv,
+    GLATTER_FN_glGetMapiv,
+    GLATTER_FN_glGetMapxvOES,
+    GLATTER_FN_glGetMaterialfv,
+    GLATTER_FN_glGetMaterialiv,
+    GLATTER_FN_glGetMaterialxOES,
+    GLATTER_FN_glGetMemoryObjectDetachedResourcesuivNV,
+    GLATTER_FN_glGetMemoryObjectParameterivEXT,
+    GLATTER_FN_glGetMinmax,
+    GLATTER_FN_glGetMinmaxEXT,
+    GLATTER_FN_glGetMinmaxParameterfv,
+    GLATTER_FN_glGetMinmaxParameterfvEXT,
+    GLATTER_FN_glGetMinmaxParameteriv,
+    GLATTER_FN_glGetMinmaxParameterivEXT,
+    GLATTER_FN_glGetMultiTexEnvfvEXT,
+    GLATTER_FN_glGetMultiTexEnvivEXT,
+    GLATTER_FN_glGetMultiTexGendvEXT,
+    GLATTER_FN_glGetMultiTexGenfvEXT,
+    GLATTER_FN_glGetMultiTexGenivEXT,
+    GLATTER_FN_glGetMultiTexImageEXT,
+    GLATTER_FN_glGetMultiTexLevelParameterfvEXT,
+    GLATTER_FN_glGetMultiTexLevelParameterivEXT,
+    GLATTER_FN_glGetMultiTexParameterIivEXT,
+    GLATTER_FN_glGetMultiTexParameterIuivEXT,
+    GLATTER_FN_glGetMultiTexParameterfvEXT,
+    GLATTER_FN_glGetMultiTexParameterivEXT,
+    GLATTER_FN_glGetMultisamplefv,
+    GLATTER_FN_glGetMultisamplefvNV,
+    GLATTER_FN_glGetNamedBufferParameteri64v,
+    GLATTER_FN_glGetNamedBufferParameteriv,
+    GLATTER_FN_glGetNamedBufferParameterivEXT,
+    GLATTER_FN_glGetNamedBufferParameterui64vNV,
+    GLATTER_FN_glGetNamedBufferPointerv,
+    GLATTER_FN_glGetNamedBufferPointervEXT,
+    GLATTER_FN_glGetNamedBufferSubData,
+    GLATTER_FN_glGetNamedBufferSubDataEXT,
+    GLATTER_FN_glGetNamedFramebufferAttachmentParameteriv,
+    GLATTER_FN_glGetNamedFramebufferAttachmentParameterivEXT,
+    GLATTER_FN_glGetNamedFramebufferParameterfvAMD,
+    GLATTER_FN_glGetNamedFramebufferParameteriv,
+    GLATTER_FN_glGetNamedFramebufferParameterivEXT,
+    GLATTER_FN_glGetNamedProgramLocalParameterIivEXT,
+    GLATTER_FN_glGetNamedProgramLocalParameterIuivEXT,
+    GLATTER_FN_glGetNamedProgramLocalParameterdvEXT,
+    GLATTER_FN_glGetNamedProgramLocalParameterfvEXT,
+    GLATTER_FN_glGetNamedProgramStringEXT,
+    GLATTER_FN_glGetNamedProgramivEXT,
+    GLATTER_FN_glGetNamedRenderbufferParameteriv,
+    GLATTER_FN_glGetNamedRenderbufferParameterivEXT,
+    GLATTER_FN_glGetNamedStringARB,
+    GLATTER_FN_glGetNamedStringivARB,
+    GLATTER_FN_glGetNextPerfQueryIdINTEL,
+    GLATTER_FN_glGetObjectBufferfvATI,
+    GLATTER_FN_glGetObjectBufferivATI,
+    GLATTER_FN_glGetObjectLabel,
+    GLATTER_FN_glGetObjectLabelEXT,
+    GLATTER_FN_glGetObjectParameterfvARB,
+    GLATTER_FN_glGetObjectParameterivAPPLE,
+    GLATTER_FN_glGetObjectParameterivARB,
+    GLATTER_FN_glGetObjectPtrLabel,
+    GLATTER_FN_glGetOcclusionQueryivNV,
+    GLATTER_FN_glGetOcclusionQueryuivNV,
+    GLATTER_FN_glGetPathColorGenfvNV,
+    GLATTER_FN_glGetPathColorGenivNV,
+    GLATTER_FN_glGetPathCommandsNV,
+    GLATTER_FN_glGetPathCoordsNV,
+    GLATTER_FN_glGetPathDashArrayNV,
+    GLATTER_FN_glGetPathLengthNV,
+    GLATTER_FN_glGetPathMetricRangeNV,
+    GLATTER_FN_glGetPathMetricsNV,
+    GLATTER_FN_glGetPathParameterfvNV,
+    GLATTER_FN_glGetPathParameterivNV,
+    GLATTER_FN_glGetPathSpacingNV,
+    GLATTER_FN_glGetPathTexGenfvNV,
+    GLATTER_FN_glGetPathTexGenivNV,
+    GLATTER_FN_glGetPerfCounterInfoINTEL,
+    GLATTER_FN_glGetPerfMonitorCounterDataAMD,
+    GLATTER_FN_glGetPerfMonitorCounterInfoAMD,
+    GLATTER_FN_glGetPerfMonitorCounterStringAMD,
+    GLATTER_FN_glGetPerfMonitorCountersAMD,
+    GLATTER_FN_glGetPerfMonitorGroupStringAMD,
+    GLATTER_FN_glGetPerfMonitorGroupsAMD,
+    GLATTER_FN_glGetPerfQueryDataINTEL,
+    GLATTER_FN_glGetPerfQueryIdByNameINTEL,
+    GLATTER_FN_glGetPerfQueryInfoINTEL,
+    GLATTER_FN_glGetPixelMapfv,
+    GLATTER_FN_glGetPixelMapuiv,
+    GLATTER_FN_glGetPixelMapusv,
+    GLATTER_FN_glGetPixelMapxv,
+    GLATTER_FN_glGetPixelTexGenParameterfvSGIS,
+    GLATTER_FN_glGetPixelTexGenParameterivSGIS,
+    GLATTER_FN_glGetPixelTransformParameterfvEXT,
+    GLATTER_FN_glGetPixelTransformParameterivEXT,
+    GLATTER_FN_glGetPointerIndexedvEXT,
+    GLATTER_FN_glGetPointeri_vEXT,
+    GLATTER_FN_glGetPointerv,
+    GLATTER_FN_glGetPointervEXT,
+    GLATTER_FN_glGetPolygonStipple,
+    GLATTER_FN_glGetProgramBinary,
+    GLATTER_FN_glGetProgramEnvParameterIivNV,
+    GLATTER_FN_glGetProgramEnvParameterIuivNV,
+    GLATTER_FN_glGetProgramEnvParameterdvARB,
+    GLATTER_FN_glGetProgramEnvParameterfvARB,
+    GLATTER_FN_glGetProgramInfoLog,
+    GLATTER_FN_glGetProgramInterfaceiv,
+    GLATTER_FN_glGetProgramLocalParameterIivNV,
+    GLATTER_FN_glGetProgramLocalParameterIuivNV,
+    GLATTER_FN_glGetProgramLocalParameterdvARB,
+    GLATTER_FN_glGetProgramLocalParameterfvARB,
+    GLATTER_FN_glGetProgramNamedParameterdvNV,
+    GLATTER_FN_glGetProgramNamedParameterfvNV,
+    GLATTER_FN_glGetProgramParameterdvNV,
+    GLATTER_FN_glGetProgramParameterfvNV,
+    GLATTER_FN_glGetProgramPipelineInfoLog,
+    GLATTER_FN_glGetProgramPipelineiv,
+    GLATTER_FN_glGetProgramResourceIndex,
+    GLATTER_FN_glGetProgramResourceLocation,
+    GLATTER_FN_glGetProgramResourceLocationIndex,
+    GLATTER_FN_glGetProgramResourceName,
+    GLATTER_FN_glGetProgramResourcefvNV,
+    GLATTER_FN_glGetProgramResourceiv,
+    GLATTER_FN_glGetProgramStageiv,
+    GLATTER_FN_glGetProgramStringARB,
+    GLATTER_FN_glGetProgramStringNV,
+    GLATTER_FN_glGetProgramSubroutineParameteruivNV,
+    GLATTER_FN_glGetProgramiv,
+    GLATTER_FN_glGetProgramivARB,
+    GLATTER_FN_glGetProgramivNV,
+    GLATTER_FN_glGetQueryBufferObjecti64v,
+    GLATTER_FN_glGetQueryBufferObjectiv,
+    GLATTER_FN_glGetQueryBufferObjectui64v,
+    GLATTER_FN_glGetQueryBufferObjectuiv,
+    GLATTER_FN_glGetQueryIndexediv,
+    GLATTER_FN_glGetQueryObjecti64v,
+    GLATTER_FN_glGetQueryObjecti64vEXT,
+    GLATTER_FN_glGetQueryObjectiv,
+    GLATTER_FN_glGetQueryObjectivARB,
+    GLATTER_FN_glGetQueryObjectui64v,
+    GLATTER_FN_glGetQueryObjectui64vEXT,
+    GLATTER_FN_glGetQueryObjectuiv,
+    GLATTER_FN_glGetQueryObjectuivARB,
+    GLATTER_FN_glGetQueryiv,
+    GLATTER_FN_glGetQueryivARB,
+    GLATTER_FN_glGetRenderbufferParameteriv,
+    GLATTER_FN_glGetRenderbufferParameterivEXT,
+    GLATTER_FN_glGetSamplerParameterIiv,
+    GLATTER_FN_glGetSamplerParameterIuiv,
+    GLATTER_FN_glGetSamplerParameterfv,
+    GLATTER_FN_glGetSamplerParameteriv,
+    GLATTER_FN_glGetSemaphoreParameterivNV,
+    GLATTER_FN_glGetSemaphoreParameterui64vEXT,
+    GLATTER_FN_glGetSeparableFilter,
+    GLATTER_FN_glGetSeparableFilterEXT,
+    GLATTER_FN_glGetShaderInfoLog,
+    GLATTER_FN_glGetShaderPrecisionFormat,
+    GLATTER_FN_glGetShaderSource,
+    GLATTER_FN_glGetShaderSourceARB,
+    GLATTER_FN_glGetShaderiv,
+    GLATTER_FN_glGetShadingRateImagePaletteNV,
+    GLATTER_FN_glGetShadingRateSampleLocationivNV,
+    GLATTER_FN_glGetSharpenTexFuncSGIS,
+    GLATTER_FN_glGetStageIndexNV,
+    GLATTER_FN_glGetString,
+    GLATTER_FN_glGetStringi,
+    GLATTER_FN_glGetSubroutineIndex,
+    GLATTER_FN_glGetSubroutineUniformLocation,
+    GLATTER_FN_glGetSynciv,
+    GLATTER_FN_glGetTexBumpParameterfvATI,
+    GLATTER_FN_glGetTexBumpParameterivATI,
+    GLATTER_FN_glGetTexEnvfv,
+    GLATTER_FN_glGetTexEnviv,
+    GLATTER_FN_glGetTexEnvxvOES,
+    GLATTER_FN_glGetTexFilterFuncSGIS,
+    GLATTER_FN_glGetTexGendv,
+    GLATTER_FN_glGetTexGenfv,
+    GLATTER_FN_glGetTexGeniv,
+    GLATTER_FN_glGetTexGenxvOES,
+    GLATTER_FN_glGetTexImage,
+    GLATTER_FN_glGetTexLevelParameterfv,
+    GLATTER_FN_glGetTexLevelParameteriv,
+    GLATTER_FN_glGetTexLevelParameterxvOES,
+    GLATTER_FN_glGetTexParameterIiv,
+    GLATTER_FN_glGetTexParameterIivEXT,
+    GLATTER_FN_glGetTexParameterIuiv,
+    GLATTER_FN_glGetTexParameterIuivEXT,
+    GLATTER_FN_glGetTexParameterPointervAPPLE,
+    GLATTER_FN_glGetTexParameterfv,
+    GLATTER_FN_glGetTexParameteriv,
+    GLATTER_FN_glGetTexParameterxvOES,
+    GLATTER_FN_glGetTextureHandleARB,
+    GLATTER_FN_glGetTextureHandleNV,
+    GLATTER_FN_glGetTextureImage,
+    GLATTER_FN_glGetTextureImageEXT,
+    GLATTER_FN_glGetTextureLevelParameterfv,
+    GLATTER_FN_glGetTextureLevelParameterfvEXT,
+    GLATTER_FN_glGetTextureLevelParameteriv,
+    GLATTER_FN_glGetTextureLevelParameterivEXT,
+    GLATTER_FN_glGetTextureParameterIiv,
+    GLATTER_FN_glGetTextureParameterIivEXT,
+    GLATTER_FN_glGetTextureParameterIuiv,
+    GLATTER_FN_glGetTextureParameterIuivEXT,
+    GLATTER_FN_glGetTextureParameterfv,
+    GLATTER_FN_glGetTextureParameterfvEXT,
+    GLATTER_FN_glGetTextureParameteriv,
+    GLATTER_FN_glGetTextureParameterivEXT,
+    GLATTER_FN_glGetTextureSamplerHandleARB,
+    GLATTER_FN_glGetTextureSamplerHandleNV,
+    GLATTER_FN_glGetTextureSubImage,
+    GLATTER_FN_glGetTrackMatrixivNV,
+    GLATTER_FN_glGetTransformFeedbackVarying,
+    GLATTER_FN_glGetTransformFeedbackVaryingEXT,
+    GLATTER_FN_glGetTransformFeedbackVaryingNV,
+    GLATTER_FN_glGetTransformFeedbacki64_v,
+    GLATTER_FN_glGetTransformFeedbacki_v,
+    GLATTER_FN_glGetTransformFeedbackiv,
+    GLATTER_FN_glGetUniformBlockIndex,
+    GLATTER_FN_glGetUniformBufferSizeEXT,
+    GLATTER_FN_glGetUniformIndices,
+    GLATTER_FN_glGetUniformLocation,
+    GLATTER_FN_glGetUniformLocationARB,
+    GLATTER_FN_glGetUniformOffsetEXT,
+    GLATTER_FN_glGetUniformSubroutineuiv,
+    GLATTER_FN_glGetUniformdv,
+    GLATTER_FN_glGetUniformfv,
+    GLATTER_FN_glGetUniformfvARB,
+    GLATTER_FN_glGetUniformi64vARB,
+    GLATTER_FN_glGetUniformi64vNV,
+    GLATTER_FN_glGetUniformiv,
+    GLATTER_FN_glGetUniformivARB,
+    GLATTER_FN_glGetUniformui64vARB,
+    GLATTER_FN_glGetUniformui64vNV,
+    GLATTER_FN_glGetUniformuiv,
+    GLATTER_FN_glGetUniformuivEXT,
+    GLATTER_FN_glGetUnsignedBytei_vEXT,
+    GLATTER_FN_glGetUnsignedBytevEXT,
+    GLATTER_FN_glGetVariantArrayObjectfvATI,
+    GLATTER_FN_glGetVariantArrayObjectivATI,
+    GLATTER_FN_glGetVariantBooleanvEXT,
+    GLATTER_FN_glGetVariantFloatvEXT,
+    GLATTER_FN_glGetVariantIntegervEXT,
+    GLATTER_FN_glGetVariantPointervEXT,
+    GLATTER_FN_glGetVaryingLocationNV,
+    GLATTER_FN_glGetVertexArrayIndexed64iv,
+    GLATTER_FN_glGetVertexArrayIndexediv,
+    GLATTER_FN_glGetVertexArrayIntegeri_vEXT,
+    GLATTER_FN_glGetVertexArrayIntegervEXT,
+    GLATTER_FN_glGetVertexArrayPointeri_vEXT,
+    GLATTER_FN_glGetVertexArrayPointervEXT,
+    GLATTER_FN_glGetVertexArrayiv,
+    GLATTER_FN_glGetVertexAttribArrayObjectfvATI,
+    GLATTER_FN_glGetVertexAttribArrayObjectivATI,
+    GLATTER_FN_glGetVertexAttribIiv,
+    GLATTER_FN_glGetVertexAttribIivEXT,
+    GLATTER_FN_glGetVertexAttribIuiv,
+    GLATTER_FN_glGetVertexAttribIuivEXT,
+    GLATTER_FN_glGetVertexAttribLdv,
+    GLATTER_FN_glGetVertexAttribLdvEXT,
+    GLATTER_FN_glGetVertexAttribLi64vNV,
+    GLATTER_FN_glGetVertexAttribLui64vARB,
+    GLATTER_FN_glGetVertexAttribLui64vNV,
+    GLATTER_FN_glGetVertexAttribPointerv,
+    GLATTER_FN_glGetVertexAttribPointervARB,
+    GLATTER_FN_glGetVertexAttribPointervNV,
+    GLATTER_FN_glGetVertexAttribdv,
+    GLATTER_FN_glGetVertexAttribdvARB,
+    GLATTER_FN_glGetVertexAttribdvNV,
+    GLATTER_FN_glGetVertexAttribfv,
+    GLATTER_FN_glGetVertexAttribfvARB,
+    GLATTER_FN_glGetVertexAttribfvNV,
+    GLATTER_FN_glGetVertexAttribiv,
+    GLATTER_FN_glGetVertexAttribivARB,
+    GLATTER_FN_glGetVertexAttribivNV,
+    GLATTER_FN_glGetVideoCaptureStreamdvNV,
+    GLATTER_FN_glGetVideoCaptureStreamfvNV,
+    GLATTER_FN_glGetVideoCaptureStreamivNV,
+    GLATTER_FN_glGetVideoCaptureivNV,
+    GLATTER_FN_glGetVideoi64vNV,
+    GLATTER_FN_glGetVideoivNV,
+    GLATTER_FN_glGetVideoui64vNV,
+    GLATTER_FN_glGetVideouivNV,
+    GLATTER_FN_glGetVkProcAddrNV,
+    GLATTER_FN_glGetnColorTable,
+    GLATTER_FN_glGetnColorTableARB,
+    GLATTER_FN_glGetnCompressedTexImage,
+    GLATTER_FN_glGetnCompressedTexImageARB,
+    GLATTER_FN_glGetnConvolutionFilter,
+    GLATTER_FN_glGetnConvolutionFilterARB,
+    GLATTER_FN_glGetnHistogram,
+    GLATTER_FN_glGetnHistogramARB,
+    GLATTER_FN_glGetnMapdv,
+    GLATTER_FN_glGetnMapdvARB,
+    GLATTER_FN_glGetnMapfv,
+    GLATTER_FN_glGetnMapfvARB,
+    GLATTER_FN_glGetnMapiv,
+    GLATTER_FN_glGetnMapivARB,
+    GLATTER_FN_glGetnMinmax,
+    GLATTER_FN_glGetnMinmaxARB,
+    GLATTER_FN_glGetnPixelMapfv,
+    GLATTER_FN_glGetnPixelMapfvARB,
+    GLATTER_FN_glGetnPixelMapuiv,
+    GLATTER_FN_glGetnPixelMapuivARB,
+    GLATTER_FN_glGetnPixelMapusv,
+    GLATTER_FN_glGetnPixelMapusvARB,
+    GLATTER_FN_glGetnPolygonStipple,
+    GLATTER_FN_glGetnPolygonStippleARB,
+    GLATTER_FN_glGetnSeparableFilter,
+    GLATTER_FN_glGetnSeparableFilterARB,
+    GLATTER_FN_glGetnTexImage,
+    GLATTER_FN_glGetnTexImageARB,
+    GLATTER_FN_glGetnUniformdv,
+    GLATTER_FN_glGetnUniformdvARB,
+    GLATTER_FN_glGetnUniformfv,
+    GLATTER_FN_glGetnUniformfvARB,
+    GLATTER_FN_glGetnUniformi64vARB,
+    GLATTER_FN_glGetnUniformiv,
+    GLATTER_FN_glGetnUniformivARB,
+    GLATTER_FN_glGetnUniformui64vARB,
+    GLATTER_FN_glGetnUniformuiv,
+    GLATTER_FN_glGetnUniformuivARB,
+    GLATTER_FN_glGlobalAlphaFactorbSUN,
+    GLATTER_FN_glGlobalAlphaFactordSUN,
+    GLATTER_FN_glGlobalAlphaFactorfSUN,
+    GLATTER_FN_glGlobalAlphaFactoriSUN,
+    GLATTER_FN_glGlobalAlphaFactorsSUN,
+    GLATTER_FN_glGlobalAlphaFactorubSUN,
+    GLATTER_FN_glGlobalAlphaFactoruiSUN,
+    GLATTER_FN_glGlobalAlphaFactorusSUN,
+    GLATTER_FN_glHint,
+    GLATTER_FN_glHintPGI,
+    GLATTER_FN_glHistogram,
+    GLATTER_FN_glHistogramEXT,
+    GLATTER_FN_glIglooInterfaceSGIX,
+    GLATTER_FN_glImageTransformParameterfHP,
+    GLATTER_FN_glImageTransformParameterfvHP,
+    GLATTER_FN_glImageTransformParameteriHP,
+    GLATTER_FN_glImageTransformParameterivHP,
+    GLATTER_FN_glImportMemoryFdEXT,
+    GLATTER_FN_glImportMemoryWin32HandleEXT,
+    GLATTER_FN_glImportMemoryWin32NameEXT,
+    GLATTER_FN_glImportSemaphoreFdEXT,
+    GLATTER_FN_glImportSemaphoreWin32HandleEXT,
+    GLATTER_FN_glImportSemaphoreWin32NameEXT,
+    GLATTER_FN_glImportSyncEXT,
+    GLATTER_FN_glIndexFormatNV,
+    GLATTER_FN_glIndexFuncEXT,
+    GLATTER_FN_glIndexMask,
+    GLATTER_FN_glIndexMaterialEXT,
+    GLATTER_FN_glIndexPointer,
+    GLATTER_FN_glIndexPointerEXT,
+    GLATTER_FN_glIndexPointerListIBM,
+    GLATTER_FN_glIndexd,
+    GLATTER_FN_glIndexdv,
+    GLATTER_FN_glIndexf,
+    GLATTER_FN_glIndexfv,
+    GLATTER_FN_glIndexi,
+    GLATTER_FN_glIndexiv,
+    GLATTER_FN_glIndexs,
+    GLATTER_FN_glIndexsv,
+    GLATTER_FN_glIndexub,
+    GLATTER_FN_glIndexubv,
+    GLATTER_FN_glIndexxOES,
+    GLATTER_FN_glIndexxvOES,
+    GLATTER_FN_glInitNames,
+    GLATTER_FN_glInsertComponentEXT,
+    GLATTER_FN_glInsertEventMarkerEXT,
+    GLATTER_FN_glInstrumentsBufferSGIX,
+    GLATTER_FN_glInterleavedArrays,
+    GLATTER_FN_glInterpolatePathsNV,
+    GLATTER_FN_glInvalidateBufferData,
+    GLATTER_FN_glInvalidateBufferSubData,
+    GLATTER_FN_glInvalidateNamedFramebufferData,
+    GLATTER_FN_glInvalidateNamedFramebufferSubData,
+    GLATTER_FN_glInvalidateSubFramebuffer,
+    GLATTER_FN_glInvalidateTexImage,
+    GLATTER_FN_glInvalidateTexSubImage,
+    GLATTER_FN_glIsAsyncMarkerSGIX,
+    GLATTER_FN_glIsBuffer,
+    GLATTER_FN_glIsBufferARB,
+    GLATTER_FN_glIsBufferResidentNV,
+    GLATTER_FN_glIsCommandListNV,
+    GLATTER_FN_glIsEnabled,
+    GLATTER_FN_glIsEnabledIndexedEXT,
+    GLATTER_FN_glIsEnabledi,
+    GLATTER_FN_glIsFenceAPPLE,
+    GLATTER_FN_glIsFenceNV,
+    GLATTER_FN_glIsFramebuffer,
+    GLATTER_FN_glIsFramebufferEXT,
+    GLATTER_FN_glIsImageHandleResidentARB,
+    GLATTER_FN_glIsImageHandleResidentNV,
+    GLATTER_FN_glIsList,
+    GLATTER_FN_glIsMemoryObjectEXT,
+    GLATTER_FN_glIsNameAMD,
+    GLATTER_FN_glIsNamedBufferResidentNV,
+    GLATTER_FN_glIsNamedStringARB,
+    GLATTER_FN_glIsObjectBufferATI,
+    GLATTER_FN_glIsOcclusionQueryNV,
+    GLATTER_FN_glIsPathNV,
+    GLATTER_FN_glIsPointInFillPathNV,
+    GLATTER_FN_glIsPointInStrokePathNV,
+    GLATTER_FN_glIsProgram,
+    GLATTER_FN_glIsProgramARB,
+    GLATTER_FN_glIsProgramNV,
+    GLATTER_FN_glIsProgramPipeline,
+    GLATTER_FN_glIsQuery,
+    GLATTER_FN_glIsQueryARB,
+    GLATTER_FN_glIsRenderbuffer,
+    GLATTER_FN_glIsRenderbufferEXT,
+    GLATTER_FN_glIsSampler,
+    GLATTER_FN_glIsSemaphoreEXT,
+    GLATTER_FN_glIsShader,
+    GLATTER_FN_glIsStateNV,
+    GLATTER_FN_glIsSync,
+    GLATTER_FN_glIsTexture,
+    GLATTER_FN_glIsTextureEXT,
+    GLATTER_FN_glIsTextureHandleResidentARB,
+    GLATTER_FN_glIsTextureHandleResidentNV,
+    GLATTER_FN_glIsTransformFeedback,
+    GLATTER_FN_glIsTransformFeedbackNV,
+    GLATTER_FN_glIsVariantEnabledEXT,
+    GLATTER_FN_glIsVertexArray,
+    GLATTER_FN_glIsVertexArrayAPPLE,
+    GLATTER_FN_glIsVertexAttribEnabledAPPLE,
+    GLATTER_FN_glLGPUCopyImageSubDataNVX,
+    GLATTER_FN_glLGPUInterlockNVX,
+    GLATTER_FN_glLGPUNamedBufferSubDataNVX,
+    GLATTER_FN_glLabelObjectEXT,
+    GLATTER_FN_glLightEnviSGIX,
+    GLATTER_FN_glLightModelf,
+    GLATTER_FN_glLightModelfv,
+    GLATTER_FN_glLightModeli,
+    GLATTER_FN_glLightModeliv,
+    GLATTER_FN_glLightModelxOES,
+    GLATTER_FN_glLightModelxvOES,
+    GLATTER_FN_glLightf,
+    GLATTER_FN_glLightfv,
+    GLATTER_FN_glLighti,
+    GLATTER_FN_glLightiv,
+    GLATTER_FN_glLightxOES,
+    GLATTER_FN_glLightxvOES,
+    GLATTER_FN_glLineStipple,
+    GLATTER_FN_glLineWidthxOES,
+    GLATTER_FN_glLinkProgram,
+    GLATTER_FN_glLinkProgramARB,
+    GLATTER_FN_glListBase,
+    GLATTER_FN_glListDrawCommandsStatesClientNV,
+    GLATTER_FN_glListParameterfSGIX,
+    GLATTER_FN_glListParameterfvSGIX,
+    GLATTER_FN_glListParameteriSGIX,
+    GLATTER_FN_glListParameterivSGIX,
+    GLATTER_FN_glLoadIdentity,
+    GLATTER_FN_glLoadIdentityDeformationMapSGIX,
+    GLATTER_FN_glLoadMatrixd,
+    GLATTER_FN_glLoadMatrixf,
+    GLATTER_FN_glLoadMatrixxOES,
+    GLATTER_FN_glLoadName,
+    GLATTER_FN_glLoadProgramNV,
+    GLATTER_FN_glLoadTransposeMatrixd,
+    GLATTER_FN_glLoadTransposeMatrixdARB,
+    GLATTER_FN_glLoadTransposeMatrixf,
+    GLATTER_FN_glLoadTransposeMatrixfARB,
+    GLATTER_FN_glLoadTransposeMatrixxOES,
+    GLATTER_FN_glLockArraysEXT,
+    GLATTER_FN_glLogicOp,
+    GLATTER_FN_glMakeBufferNonResidentNV,
+    GLATTER_FN_glMakeBufferResidentNV,
+    GLATTER_FN_glMakeImageHandleNonResidentARB,
+    GLATTER_FN_glMakeImageHandleNonResidentNV,
+    GLATTER_FN_glMakeImageHandleResidentARB,
+    GLATTER_FN_glMakeImageHandleResidentNV,
+    GLATTER_FN_glMakeNamedBufferNonResidentNV,
+    GLATTER_FN_glMakeNamedBufferResidentNV,
+    GLATTER_FN_glMakeTextureHandleNonResidentARB,
+    GLATTER_FN_glMakeTextureHandleNonResidentNV,
+    GLATTER_FN_glMakeTextureHandleResidentARB,
+    GLATTER_FN_glMakeTextureHandleResidentNV,
+    GLATTER_FN_glMap1d,
+    GLATTER_FN_glMap1f,
+    GLATTER_FN_glMap1xOES,
+    GLATTER_FN_glMap2d,
+    GLATTER_FN_glMap2f,
+    GLATTER_FN_glMap2xOES,
+    GLATTER_FN_glMapBuffer,
+    GLATTER_FN_glMapBufferARB,
+    GLATTER_FN_glMapControlPointsNV,
+    GLATTER_FN_glMapGrid1d,
+    GLATTER_FN_glMapGrid1f,
+    GLATTER_FN_glMapGrid1xOES,
+    GLATTER_FN_glMapGrid2d,
+    GLATTER_FN_glMapGrid2f,
+    GLATTER_FN_glMapGrid2xOES,
+    GLATTER_FN_glMapNamedBuffer,
+    GLATTER_FN_glMapNamedBufferEXT,
+    GLATTER_FN_glMapNamedBufferRange,
+    GLATTER_FN_glMapNamedBufferRangeEXT,
+    GLATTER_FN_glMapObjectBufferATI,
+    GLATTER_FN_glMapParameterfvNV,
+    GLATTER_FN_glMapParameterivNV,
+    GLATTER_FN_glMapTexture2DINTEL,
+    GLATTER_FN_glMapVertexAttrib1dAPPLE,
+    GLATTER_FN_glMapVertexAttrib1fAPPLE,
+    GLATTER_FN_glMapVertexAttrib2dAPPLE,
+    GLATTER_FN_glMapVertexAttrib2fAPPLE,
+    GLATTER_FN_glMaterialf,
+    GLATTER_FN_glMaterialfv,
+    GLATTER_FN_glMateriali,
+    GLATTER_FN_glMaterialiv,
+    GLATTER_FN_glMaterialxOES,
+    GLATTER_FN_glMaterialxvOES,
+    GLATTER_FN_glMatrixFrustumEXT,
+    GLATTER_FN_glMatrixIndexPointerARB,
+    GLATTER_FN_glMatrixIndexubvARB,
+    GLATTER_FN_glMatrixIndexuivARB,
+    GLATTER_FN_glMatrixIndexusvARB,
+    GLATTER_FN_glMatrixLoad3x2fNV,
+    GLATTER_FN_glMatrixLoad3x3fNV,
+    GLATTER_FN_glMatrixLoadIdentityEXT,
+    GLATTER_FN_glMatrixLoadTranspose3x3fNV,
+    GLATTER_FN_glMatrixLoadTransposedEXT,
+    GLATTER_FN_glMatrixLoadTransposefEXT,
+    GLATTER_FN_glMatrixLoaddEXT,
+    GLATTER_FN_glMatrixLoadfEXT,
+    GLATTER_FN_glMatrixMode,
+    GLATTER_FN_glMatrixMult3x2fNV,
+    GLATTER_FN_glMatrixMult3x3fNV,
+    GLATTER_FN_glMatrixMultTranspose3x3fNV,
+    GLATTER_FN_glMatrixMultTransposedEXT,
+    GLATTER_FN_glMatrixMultTransposefEXT,
+    GLATTER_FN_glMatrixMultdEXT,
+    GLATTER_FN_glMatrixMultfEXT,
+    GLATTER_FN_glMatrixOrthoEXT,
+    GLATTER_FN_glMatrixPopEXT,
+    GLATTER_FN_glMatrixPushEXT,
+    GLATTER_FN_glMatrixRotatedEXT,
+    GLATTER_FN_glMatrixRotatefEXT,
+    GLATTER_FN_glMatrixScaledEXT,
+    GLATTER_FN_glMatrixScalefEXT,
+    GLATTER_FN_glMatrixTranslatedEXT,
+    GLATTER_FN_glMatrixTranslatefEXT,
+    GLATTER_FN_glMaxShaderCompilerThreadsARB,
+    GLATTER_FN_glMaxShaderCompilerThreadsKHR,
+    GLATTER_FN_glMemoryBarrier,
+    GLATTER_FN_glMemoryBarrierByRegion,
+    GLATTER_FN_glMemoryBarrierEXT,
+    GLATTER_FN_glMemoryObjectParameterivEXT,
+    GLATTER_FN_glMinSampleShading,
+    GLATTER_FN_glMinSampleShadingARB,
+    GLATTER_FN_glMinmax,
+    GLATTER_FN_glMinmaxEXT,
+    GLATTER_FN_glMultMatrixd,
+    GLATTER_FN_glMultMatrixf,
+    GLATTER_FN_glMultMatrixxOES,
+    GLATTER_FN_glMultTransposeMatrixd,
+    GLATTER_FN_glMultTransposeMatrixdARB,
+    GLATTER_FN_glMultTransposeMatrixf,
+    GLATTER_FN_glMultTransposeMatrixfARB,
+    GLATTER_FN_glMultTransposeMatrixxOES,
+    GLATTER_FN_glMultiDrawArrays,
+    GLATTER_FN_glMultiDrawArraysEXT,
+    GLATTER_FN_glMultiDrawArraysIndirectAMD,
+    GLATTER_FN_glMultiDrawArraysIndirectBindlessCountNV,
+    GLATTER_FN_glMultiDrawArraysIndirectBindlessNV,
+    GLATTER_FN_glMultiDrawArraysIndirectCount,
+    GLATTER_FN_glMultiDrawArraysIndirectCountARB,
+    GLATTER_FN_glMultiDrawElementArrayAPPLE,
+    GLATTER_FN_glMultiDrawElements,
+    GLATTER_FN_glMultiDrawElementsBaseVertex,
+    GLATTER_FN_glMultiDrawElementsEXT,
+    GLATTER_FN_glMultiDrawElementsIndirectAMD,
+    GLATTER_FN_glMultiDrawElementsIndirectBindlessCountNV,
+    GLATTER_FN_glMultiDrawElementsIndirectBindlessNV,
+    GLATTER_FN_glMultiDrawElementsIndirectCount,
+    GLATTER_FN_glMultiDrawElementsIndirectCountARB,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectCountEXT,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectCountNV,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectEXT,
+    GLATTER_FN_glMultiDrawMeshTasksIndirectNV,
+    GLATTER_FN_glMultiDrawRangeElementArrayAPPLE,
+    GLATTER_FN_glMultiModeDrawArraysIBM,
+    GLATTER_FN_glMultiModeDrawElementsIBM,
+    GLATTER_FN_glMultiTexBufferEXT,
+    GLATTER_FN_glMultiTexCoord1bOES,
+    GLATTER_FN_glMultiTexCoord1bvOES,
+    GLATTER_FN_glMultiTexCoord1d,
+    GLATTER_FN_glMultiTexCoord1dARB,
+    GLATTER_FN_glMultiTexCoord1dv,
+    GLATTER_FN_glMultiTexCoord1dvARB,
+    GLATTER_FN_glMultiTexCoord1f,
+    GLATTER_FN_glMultiTexCoord1fARB,
+    GLATTER_FN_glMultiTexCoord1fv,
+    GLATTER_FN_glMultiTexCoord1fvARB,
+    GLATTER_FN_glMultiTexCoord1hNV,
+    GLATTER_FN_glMultiTexCoord1hvNV,
+    GLATTER_FN_glMultiTexCoord1i,
+    GLATTER_FN_glMultiTexCoord1iARB,
+    GLATTER_FN_glMultiTexCoord1iv,
+    GLATTER_FN_glMultiTexCoord1ivARB,
+    GLATTER_FN_glMultiTexCoord1s,
+    GLATTER_FN_glMultiTexCoord1sARB,
+    GLATTER_FN_glMultiTexCoord1sv,
+    GLATTER_FN_glMultiTexCoord1svARB,
+    GLATTER_FN_glMultiTexCoord1xOES,
+    GLATTER_FN_glMultiTexCoord1xvOES,
+    GLATTER_FN_glMultiTexCoord2bOES,
+    GLATTER_FN_glMultiTexCoord2bvOES,
+    GLATTER_FN_glMultiTexCoord2d,
+    GLATTER_FN_glMultiTexCoord2dARB,
+    GLATTER_FN_glMultiTexCoord2dv,
+    GLATTER_FN_glMultiTexCoord2dvARB,
+    GLATTER_FN_glMultiTexCoord2f,
+    GLATTER_FN_glMultiTexCoord2fARB,
+    GLATTER_FN_glMultiTexCoord2fv,
+    GLATTER_FN_glMultiTexCoord2fvARB,
+    GLATTER_FN_glMultiTexCoord2hNV,
+    GLATTER_FN_glMultiTexCoord2hvNV,
+    GLATTER_FN_glMultiTexCoord2i,
+    GLATTER_FN_glMultiTexCoord2iARB,
+    GLATTER_FN_glMultiTexCoord2iv,
+    GLATTER_FN_glMultiTexCoord2ivARB,
+    GLATTER_FN_glMultiTexCoord2s,
+    GLATTER_FN_glMultiTexCoord2sARB,
+    GLATTER_FN_glMultiTexCoord2sv,
+    GLATTER_FN_glMultiTexCoord2svARB,
+    GLATTER_FN_glMultiTexCoord2xOES,
+    GLATTER_FN_glMultiTexCoord2xvOES,
+    GLATTER_FN_glMultiTexCoord3bOES,
+    GLATTER_FN_glMultiTexCoord3bvOES,
+    GLATTER_FN_glMultiTexCoord3d,
+    GLATTER_FN_glMultiTexCoord3dARB,
+    GLATTER_FN_glMultiTexCoord3dv,
+    GLATTER_FN_glMultiTexCoord3dvARB,
+    GLATTER_FN_glMultiTexCoord3f,
+    GLATTER_FN_glMultiTexCoord3fARB,
+    GLATTER_FN_glMultiTexCoord3fv,
+    GLATTER_FN_glMultiTexCoord3fvARB,
+    GLATTER_FN_glMultiTexCoord3hNV,
+    GLATTER_FN_glMultiTexCoord3hvNV,
+    GLATTER_FN_glMultiTexCoord3i,
+    GLATTER_FN_glMultiTexCoord3iARB,
+    GLATTER_FN_glMultiTexCoord3iv,
+    GLATTER_FN_glMultiTexCoord3ivARB,
+    GLATTER_FN_glMultiTexCoord3s,
+    GLATTER_FN_glMultiTexCoord3sARB,
+    GLATTER_FN_glMultiTexCoord3sv,
+    GLATTER_FN_glMultiTexCoord3svARB,
+    GLATTER_FN_glMultiTexCoord3xOES,
+    GLATTER_FN_glMultiTexCoord3xvOES,
+    GLATTER_FN_glMultiTexCoord4bOES,
+    GLATTER_FN_glMultiTexCoord4bvOES,
+    GLATTER_FN_glMultiTexCoord4d,
+    GLATTER_FN_glMultiTexCoord4dARB,
+    GLATTER_FN_glMultiTexCoord4dv,
+    GLATTER_FN_glMultiTexCoord4dvARB,
+    GLATTER_FN_glMultiTexCoord4f,
+    GLATTER_FN_glMultiTexCoord4fARB,
+    GLATTER_FN_glMultiTexCoord4fv,
+    GLATTER_FN_glMultiTexCoord4fvARB,
+    GLATTER_FN_glMultiTexCoord4hNV,
+    GLATTER_FN_glMultiTexCoord4hvNV,
+    GLATTER_FN_glMultiTexCoord4i,
+    GLATTER_FN_glMultiTexCoord4iARB,
+    GLATTER_FN_glMultiTexCoord4iv,
+    GLATTER_FN_glMultiTexCoord4ivARB,
+    GLATTER_FN_glMultiTexCoord4s,
+    GLATTER_FN_glMultiTexCoord4sARB,
+    GLATTER_FN_glMultiTexCoord4sv,
+    GLATTER_FN_glMultiTexCoord4svARB,
+    GLATTER_FN_glMultiTexCoord4xOES,
+    GLATTER_FN_glMultiTexCoord4xvOES,
+    GLATTER_FN_glMultiTexCoordP1ui,
+    GLATTER_FN_glMultiTexCoordP1uiv,
+    GLATTER_FN_glMultiTexCoordP2ui,
+    GLATTER_FN_glMultiTexCoordP2uiv,
+    GLATTER_FN_glMultiTexCoordP3ui,
+    GLATTER_FN_glMultiTexCoordP3uiv,
+    GLATTER_FN_glMultiTexCoordP4ui,
+    GLATTER_FN_glMultiTexCoordP4uiv,
+    GLATTER_FN_glMultiTexCoordPointerEXT,
+    GLATTER_FN_glMultiTexEnvfEXT,
+    GLATTER_FN_glMultiTexEnvfvEXT,
+    GLATTER_FN_glMultiTexEnviEXT,
+    GLATTER_FN_glMultiTexEnvivEXT,
+    GLATTER_FN_glMultiTexGendEXT,
+    GLATTER_FN_glMultiTexGendvEXT,
+    GLATTER_FN_glMultiTexGenfEXT,
+    GLATTER_FN_glMultiTexGenfvEXT,
+    GLATTER_FN_glMultiTexGeniEXT,
+    GLATTER_FN_glMultiTexGenivEXT,
+    GLATTER_FN_glMultiTexImage1DEXT,
+    GLATTER_FN_glMultiTexImage2DEXT,
+    GLATTER_FN_glMultiTexImage3DEXT,
+    GLATTER_FN_glMultiTexParameterIivEXT,
+    GLATTER_FN_glMultiTexParameterIuivEXT,
+    GLATTER_FN_glMultiTexParameterfEXT,
+    GLATTER_FN_glMultiTexParameterfvEXT,
+    GLATTER_FN_glMultiTexParameteriEXT,
+    GLATTER_FN_glMultiTexParameterivEXT,
+    GLATTER_FN_glMultiTexRenderbufferEXT,
+    GLATTER_FN_glMultiTexSubImage1DEXT,
+    GLATTER_FN_glMultiTexSubImage2DEXT,
+    GLATTER_FN_glMultiTexSubImage3DEXT,
+    GLATTER_FN_glMulticastBarrierNV,
+    GLATTER_FN_glMulticastBlitFramebufferNV,
+    GLATTER_FN_glMulticastBufferSubDataNV,
+    GLATTER_FN_glMulticastCopyBufferSubDataNV,
+    GLATTER_FN_glMulticastCopyImageSubDataNV,
+    GLATTER_FN_glMulticastFramebufferSampleLocationsfvNV,
+    GLATTER_FN_glMulticastGetQueryObjecti64vNV,
+    GLATTER_FN_glMulticastGetQueryObjectivNV,
+    GLATTER_FN_glMulticastGetQueryObjectui64vNV,
+    GLATTER_FN_glMulticastGetQueryObjectuivNV,
+    GLATTER_FN_glMulticastScissorArrayvNVX,
+    GLATTER_FN_glMulticastViewportArrayvNVX,
+    GLATTER_FN_glMulticastViewportPositionWScaleNVX,
+    GLATTER_FN_glMulticastWaitSyncNV,
+    GLATTER_FN_glNamedBufferAttachMemoryNV,
+    GLATTER_FN_glNamedBufferData,
+    GLATTER_FN_glNamedBufferDataEXT,
+    GLATTER_FN_glNamedBufferPageCommitmentARB,
+    GLATTER_FN_glNamedBufferPageCommitmentEXT,
+    GLATTER_FN_glNamedBufferPageCommitmentMemNV,
+    GLATTER_FN_glNamedBufferStorage,
+    GLATTER_FN_glNamedBufferStorageEXT,
+    GLATTER_FN_glNamedBufferStorageExternalEXT,
+    GLATTER_FN_glNamedBufferStorageMemEXT,
+    GLATTER_FN_glNamedBufferSubData,
+    GLATTER_FN_glNamedBufferSubDataEXT,
+    GLATTER_FN_glNamedCopyBufferSubDataEXT,
+    GLATTER_FN_glNamedFramebufferDrawBuffer,
+    GLATTER_FN_glNamedFramebufferDrawBuffers,
+    GLATTER_FN_glNamedFramebufferParameteri,
+    GLATTER_FN_glNamedFramebufferParameteriEXT,
+    GLATTER_FN_glNamedFramebufferReadBuffer,
+    GLATTER_FN_glNamedFramebufferRenderbuffer,
+    GLATTER_FN_glNamedFramebufferRenderbufferEXT,
+    GLATTER_FN_glNamedFramebufferSampleLocationsfvARB,
+    GLATTER_FN_glNamedFramebufferSampleLocationsfvNV,
+    GLATTER_FN_glNamedFramebufferSamplePositionsfvAMD,
+    GLATTER_FN_glNamedFramebufferTexture,
+    GLATTER_FN_glNamedFramebufferTexture1DEXT,
+    GLATTER_FN_glNamedFramebufferTexture2DEXT,
+    GLATTER_FN_glNamedFramebufferTexture3DEXT,
+    GLATTER_FN_glNamedFramebufferTextureEXT,
+    GLATTER_FN_glNamedFramebufferTextureFaceEXT,
+    GLATTER_FN_glNamedFramebufferTextureLayer,
+    GLATTER_FN_glNamedFramebufferTextureLayerEXT,
+    GLATTER_FN_glNamedFramebufferTextureMultiviewOVR,
+    GLATTER_FN_glNamedProgramLocalParameter4dEXT,
+    GLATTER_FN_glNamedProgramLocalParameter4dvEXT,
+    GLATTER_FN_glNamedProgramLocalParameter4fEXT,
+    GLATTER_FN_glNamedProgramLocalParameter4fvEXT,
+    GLATTER_FN_glNamedProgramLocalParameterI4iEXT,
+    GLATTER_FN_glNamedProgramLocalParameterI4ivEXT,
+    GLATTER_FN_glNamedProgramLocalParameterI4uiEXT,
+    GLATTER_FN_glNamedProgramLocalParameterI4uivEXT,
+    GLATTER_FN_glNamedProgramLocalParameters4fvEXT,
+    GLATTER_FN_glNamedProgramLocalParametersI4ivEXT,
+    GLATTER_FN_glNamedProgramLocalParametersI4uivEXT,
+    GLATTER_FN_glNamedProgramStringEXT,
+    GLATTER_FN_glNamedRenderbufferStorage,
+    GLATTER_FN_glNamedRenderbufferStorageEXT,
+    GLATTER_FN_glNamedRenderbufferStorageMultisample,
+    GLATTER_FN_glNamedRenderbufferStorageMultisampleAdvancedAMD,
+    GLATTER_FN_glNamedRenderbufferStorageMultisampleCoverageEXT,
+    GLATTER_FN_glNamedRenderbufferStorageMultisampleEXT,
+    GLATTER_FN_glNamedStringARB,
+    GLATTER_FN_glNewList,
+    GLATTER_FN_glNewObjectBufferATI,
+    GLATTER_FN_glNormal3b,
+    GLATTER_FN_glNormal3bv,
+    GLATTER_FN_glNormal3d,
+    GLATTER_FN_glNormal3dv,
+    GLATTER_FN_glNormal3f,
+    GLATTER_FN_glNormal3fVertex3fSUN,
+    GLATTER_FN_glNormal3fVertex3fvSUN,
+    GLATTER_FN_glNormal3fv,
+    GLATTER_FN_glNormal3hNV,
+    GLATTER_FN_glNormal3hvNV,
+    GLATTER_FN_glNormal3i,
+    GLATTER_FN_glNormal3iv,
+    GLATTER_FN_glNormal3s,
+    GLATTER_FN_glNormal3sv,
+    GLATTER_FN_glNormal3xOES,
+    GLATTER_FN_glNormal3xvOES,
+    GLATTER_FN_glNormalFormatNV,
+    GLATTER_FN_glNormalP3ui,
+    GLATTER_FN_glNormalP3uiv,
+    GLATTER_FN_glNormalPointer,
+    GLATTER_FN_glNormalPointerEXT,
+    GLATTER_FN_glNormalPointerListIBM,
+    GLATTER_FN_glNormalPointervINTEL,
+    GLATTER_FN_glNormalStream3bATI,
+    GLATTER_FN_glNormalStream3bvATI,
+    GLATTER_FN_glNormalStream3dATI,
+    GLATTER_FN_glNormalStream3dvATI,
+    GLATTER_FN_glNormalStream3fATI,
+    GLATTER_FN_glNormalStream3fvATI,
+    GLATTER_FN_glNormalStream3iATI,
+    GLATTER_FN_glNormalStream3ivATI,
+    GLATTER_FN_glNormalStream3sATI,
+    GLATTER_FN_glNormalStream3svATI,
+    GLATTER_FN_glObjectLabel,
+    GLATTER_FN_glObjectPtrLabel,
+    GLATTER_FN_glObjectPurgeableAPPLE,
+    GLATTER_FN_glObjectUnpurgeableAPPLE,
+    GLATTER_FN_glOrtho,
+    GLATTER_FN_glOrthofOES,
+    GLATTER_FN_glOrthoxOES,
+    GLATTER_FN_glPNTrianglesfATI,
+    GLATTER_FN_glPNTrianglesiATI,
+    GLATTER_FN_glPassTexCoordATI,
+    GLATTER_FN_glPassThrough,
+    GLATTER_FN_glPassThroughxOES,
+    GLATTER_FN_glPatchParameterfv,
+    GLATTER_FN_glPatchParameteri,
+    GLATTER_FN_glPathColorGenNV,
+    GLATTER_FN_glPathCommandsNV,
+    GLATTER_FN_glPathCoordsNV,
+    GLATTER_FN_glPathCoverDepthFuncNV,
+    GLATTER_FN_glPathDashArrayNV,
+    GLATTER_FN_glPathFogGenNV,
+    GLATTER_FN_glPathGlyphIndexArrayNV,
+    GLATTER_FN_glPathGlyphIndexRangeNV,
+    GLATTER_FN_glPathGlyphRangeNV,
+    GLATTER_FN_glPathGlyphsNV,
+    GLATTER_FN_glPathMemoryGlyphIndexArrayNV,
+    GLATTER_FN_glPathParameterfNV,
+    GLATTER_FN_glPathParameterfvNV,
+    GLATTER_FN_glPathParameteriNV,
+    GLATTER_FN_glPathParameterivNV,
+    GLATTER_FN_glPathStencilDepthOffsetNV,
+    GLATTER_FN_glPathStencilFuncNV,
+    GLATTER_FN_glPathStringNV,
+    GLATTER_FN_glPathSubCommandsNV,
+    GLATTER_FN_glPathSubCoordsNV,
+    GLATTER_FN_glPathTexGenNV,
+    GLATTER_FN_glPauseTransformFeedback,
+    GLATTER_FN_glPauseTransformFeedbackNV,
+    GLATTER_FN_glPixelDataRangeNV,
+    GLATTER_FN_glPixelMapfv,
+    GLATTER_FN_glPixelMapuiv,
+    GLATTER_FN_glPixelMapusv,
+    GLATTER_FN_glPixelMapx,
+    GLATTER_FN_glPixelStoref,
+    GLATTER_FN_glPixelStorei,
+    GLATTER_FN_glPixelStorex,
+    GLATTER_FN_glPixelTexGenParameterfSGIS,
+    GLATTER_FN_glPixelTexGenParameterfvSGIS,
+    GLATTER_FN_glPixelTexGenParameteriSGIS,
+    GLATTER_FN_glPixelTexGenParameterivSGIS,
+    GLATTER_FN_glPixelTexGenSGIX,
+    GLATTER_FN_glPixelTransferf,
+    GLATTER_FN_glPixelTransferi,
+    GLATTER_FN_glPixelTransferxOES,
+    GLATTER_FN_glPixelTransformParameterfEXT,
+    GLATTER_FN_glPixelTransformParameterfvEXT,
+    GLATTER_FN_glPixelTransformParameteriEXT,
+    GLATTER_FN_glPixelTransformParameterivEXT,
+    GLATTER_FN_glPixelZoom,
+    GLATTER_FN_glPixelZoomxOES,
+    GLATTER_FN_glPointAlongPathNV,
+    GLATTER_FN_glPointParameterf,
+    GLATTER_FN_glPointParameterfARB,
+    GLATTER_FN_glPointParameterfEXT,
+    GLATTER_FN_glPointParameterfSGIS,
+    GLATTER_FN_glPointParameterfv,
+    GLATTER_FN_glPointParameterfvARB,
+    GLATTER_FN_glPointParameterfvEXT,
+    GLATTER_FN_glPointParameterfvSGIS,
+    GLATTER_FN_glPointParameteri,
+    GLATTER_FN_glPointParameteriNV,
+    GLATTER_FN_glPointParameteriv,
+    GLATTER_FN_glPointParameterivNV,
+    GLATTER_FN_glPointParameterxvOES,
+    GLATTER_FN_glPointSize,
+    GLATTER_FN_glPointSizexOES,
+    GLATTER_FN_glPollAsyncSGIX,
+    GLATTER_FN_glPollInstrumentsSGIX,
+    GLATTER_FN_glPolygonMode,
+    GLATTER_FN_glPolygonOffsetClamp,
+    GLATTER_FN_glPolygonOffsetClampEXT,
+    GLATTER_FN_glPolygonOffsetEXT,
+    GLATTER_FN_glPolygonOffsetxOES,
+    GLATTER_FN_glPolygonStipple,
+    GLATTER_FN_glPopAttrib,
+    GLATTER_FN_glPopClientAttrib,
+    GLATTER_FN_glPopDebugGroup,
+    GLATTER_FN_glPopGroupMarkerEXT,
+    GLATTER_FN_glPopMatrix,
+    GLATTER_FN_glPopName,
+    GLATTER_FN_glPresentFrameDualFillNV,
+    GLATTER_FN_glPresentFrameKeyedNV,
+    GLATTER_FN_glPrimitiveBoundingBoxARB,
+    GLATTER_FN_glPrimitiveRestartIndex,
+    GLATTER_FN_glPrimitiveRestartIndexNV,
+    GLATTER_FN_glPrimitiveRestartNV,
+    GLATTER_FN_glPrioritizeTextures,
+    GLATTER_FN_glPrioritizeTexturesEXT,
+    GLATTER_FN_glPrioritizeTexturesxOES,
+    GLATTER_FN_glProgramBinary,
+    GLATTER_FN_glProgramBufferParametersIivNV,
+    GLATTER_FN_glProgramBufferParametersIuivNV,
+    GLATTER_FN_glProgramBufferParametersfvNV,
+    GLATTER_FN_glProgramEnvParameter4dARB,
+    GLATTER_FN_glProgramEnvParameter4dvARB,
+    GLATTER_FN_glProgramEnvParameter4fARB,
+    GLATTER_FN_glProgramEnvParameter4fvARB,
+    GLATTER_FN_glProgramEnvParameterI4iNV,
+    GLATTER_FN_glProgramEnvParameterI4ivNV,
+    GLATTER_FN_glProgramEnvParameterI4uiNV,
+    GLATTER_FN_glProgramEnvParameterI4uivNV,
+    GLATTER_FN_glProgramEnvParameters4fvEXT,
+    GLATTER_FN_glProgramEnvParametersI4ivNV,
+    GLATTER_FN_glProgramEnvParametersI4uivNV,
+    GLATTER_FN_glProgramLocalParameter4dARB,
+    GLATTER_FN_glProgramLocalParameter4dvARB,
+    GLATTER_FN_glProgramLocalParameter4fARB,
+    GLATTER_FN_glProgramLocalParameter4fvARB,
+    GLATTER_FN_glProgramLocalParameterI4iNV,
+    GLATTER_FN_glProgramLocalParameterI4ivNV,
+    GLATTER_FN_glProgramLocalParameterI4uiNV,
+    GLATTER_FN_glProgramLocalParameterI4uivNV,
+    GLATTER_FN_glProgramLocalParameters4fvEXT,
+    GLATTER_FN_glProgramLocalParametersI4ivNV,
+    GLATTER_FN_glProgramLocalParametersI4uivNV,
+    GLATTER_FN_glProgramNamedParameter4dNV,
+    GLATTER_FN_glProgramNamedParameter4dvNV,
+    GLATTER_FN_glProgramNamedParameter4fNV,
+    GLATTER_FN_glProgramNamedParameter4fvNV,
+    GLATTER_FN_glProgramParameter4dNV,
+    GLATTER_FN_glProgramParameter4dvNV,
+    GLATTER_FN_glProgramParameter4fNV,
+    GLATTER_FN_glProgramParameter4fvNV,
+    GLATTER_FN_glProgramParameteri,
+    GLATTER_FN_glProgramParameteriARB,
+    GLATTER_FN_glProgramParameteriEXT,
+    GLATTER_FN_glProgramParameters4dvNV,
+    GLATTER_FN_glProgramParameters4fvNV,
+    GLATTER_FN_glProgramPathFragmentInputGenNV,
+    GLATTER_FN_glProgramStringARB,
+    GLATTER_FN_glProgramSubroutineParametersuivNV,
+    GLATTER_FN_glProgramUniform1d,
+    GLATTER_FN_glProgramUniform1dEXT,
+    GLATTER_FN_glProgramUniform1dv,
+    GLATTER_FN_glProgramUniform1dvEXT,
+    GLATTER_FN_glProgramUniform1f,
+    GLATTER_FN_glProgramUniform1fEXT,
+    GLATTER_FN_glProgramUniform1fv,
+    GLATTER_FN_glProgramUniform1fvEXT,
+    GLATTER_FN_glProgramUniform1i,
+    GLATTER_FN_glProgramUniform1i64ARB,
+    GLATTER_FN_glProgramUniform1i64NV,
+    GLATTER_FN_glProgramUniform1i64vARB,
+    GLATTER_FN_glProgramUniform1i64vNV,
+    GLATTER_FN_glProgramUniform1iEXT,
+    GLATTER_FN_glProgramUniform1iv,
+    GLATTER_FN_glProgramUniform1ivEXT,
+    GLATTER_FN_glProgramUniform1ui,
+    GLATTER_FN_glProgramUniform1ui64ARB,
+    GLATTER_FN_glProgramUniform1ui64NV,
+    GLATTER_FN_glProgramUniform1ui64vARB,
+    GLATTER_FN_glProgramUniform1ui64vNV,
+    GLATTER_FN_glProgramUniform1uiEXT,
+    GLATTER_FN_glProgramUniform1uiv,
+    GLATTER_FN_glProgramUniform1uivEXT,
+    GLATTER_FN_glProgramUniform2d,
+    GLATTER_FN_glProgramUniform2dEXT,
+    GLATTER_FN_glProgramUniform2dv,
+    GLATTER_FN_glProgramUniform2dvEXT,
+    GLATTER_FN_glProgramUniform2f,
+    GLATTER_FN_glProgramUniform2fEXT,
+    GLATTER_FN_glProgramUniform2fv,
+    GLATTER_FN_glProgramUniform2fvEXT,
+    GLATTER_FN_glProgramUniform2i,
+    GLATTER_FN_glProgramUniform2i64ARB,
+    GLATTER_FN_glProgramUniform2i64NV,
+    GLATTER_FN_glProgramUniform2i64vARB,
+    GLATTER_FN_glProgramUniform2i64vNV,
+    GLATTER_FN_glProgramUniform2iEXT,
+    GLATTER_FN_glProgramUniform2iv,
+    GLATTER_FN_glProgramUniform2ivEXT,
+    GLATTER_FN_glProgramUniform2ui,
+    GLATTER_FN_glProgramUniform2ui64ARB,
+    GLATTER_FN_glProgramUniform2ui64NV,
+    GLATTER_FN_glProgramUniform2ui64vARB,
+    GLATTER_FN_glProgramUniform2ui64vNV,
+    GLATTER_FN_glProgramUniform2uiEXT,
+    GLATTER_FN_glProgramUniform2uiv,
+    GLATTER_FN_glProgramUniform2uivEXT,
+    GLATTER_FN_glProgramUniform3d,
+    GLATTER_FN_glProgramUniform3dEXT,
+    GLATTER_FN_glProgramUniform3dv,
+    GLATTER_FN_glProgramUniform3dvEXT,
+    GLATTER_FN_glProgramUniform3f,
+    GLATTER_FN_glProgramUniform3fEXT,
+    GLATTER_FN_glProgramUniform3fv,
+    GLATTER_FN_glProgramUniform3fvEXT,
+    GLATTER_FN_glProgramUniform3i,
+    GLATTER_FN_glProgramUniform3i64ARB,
+    GLATTER_FN_glProgramUniform3i64NV,
+    GLATTER_FN_glProgramUniform3i64vARB,
+    GLATTER_FN_glProgramUniform3i64vNV,
+    GLATTER_FN_glProgramUniform3iEXT,
+    GLATTER_FN_glProgramUniform3iv,
+    GLATTER_FN_glProgramUniform3ivEXT,
+    GLATTER_FN_glProgramUniform3ui,
+    GLATTER_FN_glProgramUniform3ui64ARB,
+    GLATTER_FN_glProgramUniform3ui64NV,
+    GLATTER_FN_glProgramUniform3ui64vARB,
+    GLATTER_FN_glProgramUniform3ui64vNV,
+    GLATTER_FN_glProgramUniform3uiEXT,
+    GLATTER_FN_glProgramUniform3uiv,
+    GLATTER_FN_glProgramUniform3uivEXT,
+    GLATTER_FN_glProgramUniform4d,
+    GLATTER_FN_glProgramUniform4dEXT,
+    GLATTER_FN_glProgramUniform4dv,
+    GLATTER_FN_glProgramUniform4dvEXT,
+    GLATTER_FN_glProgramUniform4f,
+    GLATTER_FN_glProgramUniform4fEXT,
+    GLATTER_FN_glProgramUniform4fv,
+    GLATTER_FN_glProgramUniform4fvEXT,
+    GLATTER_FN_glProgramUniform4i,
+    GLATTER_FN_glProgramUniform4i64ARB,
+    GLATTER_FN_glProgramUniform4i64NV,
+    GLATTER_FN_glProgramUniform4i64vARB,
+    GLATTER_FN_glProgramUniform4i64vNV,
+    GLATTER_FN_glProgramUniform4iEXT,
+    GLATTER_FN_glProgramUniform4iv,
+    GLATTER_FN_glProgramUniform4ivEXT,
+    GLATTER_FN_glProgramUniform4ui,
+    GLATTER_FN_glProgramUniform4ui64ARB,
+    GLATTER_FN_glProgramUniform4ui64NV,
+    GLATTER_FN_glProgramUniform4ui64vARB,
+    GLATTER_FN_glProgramUniform4ui64vNV,
+    GLATTER_FN_glProgramUniform4uiEXT,
+    GLATTER_FN_glProgramUniform4uiv,
+    GLATTER_FN_glProgramUniform4uivEXT,
+    GLATTER_FN_glProgramUniformHandleui64ARB,
+    GLATTER_FN_glProgramUniformHandleui64NV,
+    GLATTER_FN_glProgramUniformHandleui64vARB,
+    GLATTER_FN_glProgramUniformHandleui64vNV,
+    GLATTER_FN_glProgramUniformMatrix2dv,
+    GLATTER_FN_glProgramUniformMatrix2dvEXT,
+    GLATTER_FN_glProgramUniformMatrix2fv,
+    GLATTER_FN_glProgramUniformMatrix2fvEXT,
+    GLATTER_FN_glProgramUniformMatrix2x3dv,
+    GLATTER_FN_glProgramUniformMatrix2x3dvEXT,
+    GLATTER_FN_glProgramUniformMatrix2x3fv,
+    GLATTER_FN_glProgramUniformMatrix2x3fvEXT,
+    GLATTER_FN_glProgramUniformMatrix2x4dv,
+    GLATTER_FN_glProgramUniformMatrix2x4dvEXT,
+    GLATTER_FN_glProgramUniformMatrix2x4fv,
+    GLATTER_FN_glProgramUniformMatrix2x4fvEXT,
+    GLATTER_FN_glProgramUniformMatrix3dv,
+    GLATTER_FN_glProgramUniformMatrix3dvEXT,
+    GLATTER_FN_glProgramUniformMatrix3fv,
+    GLATTER_FN_glProgramUniformMatrix3fvEXT,
+    GLATTER_FN_glProgramUniformMatrix3x2dv,
+    GLATTER_FN_glProgramUniformMatrix3x2dvEXT,
+    GLATTER_FN_glProgramUniformMatrix3x2fv,
+    GLATTER_FN_glProgramUniformMatrix3x2fvEXT,
+    GLATTER_FN_glProgramUniformMatrix3x4dv,
+    GLATTER_FN_glProgramUniformMatrix3x4dvEXT,
+    GLATTER_FN_glProgramUniformMatrix3x4fv,
+    GLATTER_FN_glProgramUniformMatrix3x4fvEXT,
+    GLATTER_FN_glProgramUniformMatrix4dv,
+    GLATTER_FN_glProgramUniformMatrix4dvEXT,
+    GLATTER_FN_glProgramUniformMatrix4fv,
+    GLATTER_FN_glProgramUniformMatrix4fvEXT,
+    GLATTER_FN_glProgramUniformMatrix4x2dv,
+    GLATTER_FN_glProgramUniformMatrix4x2dvEXT,
+    GLATTER_FN_glProgramUniformMatrix4x2fv,
+    GLATTER_FN_glProgramUniformMatrix4x2fvEXT,
+    GLATTER_FN_glProgramUniformMatrix4x3dv,
+    GLATTER_FN_glProgramUniformMatrix4x3dvEXT,
+    GLATTER_FN_glProgramUniformMatrix4x3fv,
+    GLATTER_FN_glProgramUniformMatrix4x3fvEXT,
+    GLATTER_FN_glProgramUniformui64NV,
+    GLATTER_FN_glProgramUniformui64vNV,
+    GLATTER_FN_glProgramVertexLimitNV,
+    GLATTER_FN_glProvokingVertex,
+    GLATTER_FN_glProvokingVertexEXT,
+    GLATTER_FN_glPushAttrib,
+    GLATTER_FN_glPushClientAttrib,
+    GLATTER_FN_glPushClientAttribDefaultEXT,
+    GLATTER_FN_glPushDebugGroup,
+    GLATTER_FN_glPushGroupMarkerEXT,
+    GLATTER_FN_glPushMatrix,
+    GLATTER_FN_glPushName,
+    GLATTER_FN_glQueryCounter,
+    GLATTER_FN_glQueryMatrixxOES,
+    GLATTER_FN_glQueryObjectParameteruiAMD,
+    GLATTER_FN_glQueryResourceNV,
+    GLATTER_FN_glQueryResourceTagNV,
+    GLATTER_FN_glRasterPos2d,
+    GLATTER_FN_glRasterPos2dv,
+    GLATTER_FN_glRasterPos2f,
+    GLATTER_FN_glRasterPos2fv,
+    GLATTER_FN_glRasterPos2i,
+    GLATTER_FN_glRasterPos2iv,
+    GLATTER_FN_glRasterPos2s,
+    GLATTER_FN_glRasterPos2sv,
+    GLATTER_FN_glRasterPos2xOES,
+    GLATTER_FN_glRasterPos2xvOES,
+    GLATTER_FN_glRasterPos3d,
+    GLATTER_FN_glRasterPos3dv,
+    GLATTER_FN_glRasterPos3f,
+    GLATTER_FN_glRasterPos3fv,
+    GLATTER_FN_glRasterPos3i,
+    GLATTER_FN_glRasterPos3iv,
+    GLATTER_FN_glRasterPos3s,
+    GLATTER_FN_glRasterPos3sv,
+    GLATTER_FN_glRasterPos3xOES,
+    GLATTER_FN_glRasterPos3xvOES,
+    GLATTER_FN_glRasterPos4d,
+    GLATTER_FN_glRasterPos4dv,
+    GLATTER_FN_glRasterPos4f,
+    GLATTER_FN_glRasterPos4fv,
+    GLATTER_FN_glRasterPos4i,
+    GLATTER_FN_glRasterPos4iv,
+    GLATTER_FN_glRasterPos4s,
+    GLATTER_FN_glRasterPos4sv,
+    GLATTER_FN_glRasterPos4xOES,
+    GLATTER_FN_glRasterPos4xvOES,
+    GLATTER_FN_glRasterSamplesEXT,
+    GLATTER_FN_glReadBuffer,
+    GLATTER_FN_glReadInstrumentsSGIX,
+    GLATTER_FN_glReadPixels,
+    GLATTER_FN_glReadnPixels,
+    GLATTER_FN_glReadnPixelsARB,
+    GLATTER_FN_glRectd,
+    GLATTER_FN_glRectdv,
+    GLATTER_FN_glRectf,
+    GLATTER_FN_glRectfv,
+    GLATTER_FN_glRecti,
+    GLATTER_FN_glRectiv,
+    GLATTER_FN_glRects,
+    GLATTER_FN_glRectsv,
+    GLATTER_FN_glRectxOES,
+    GLATTER_FN_glRectxvOES,
+    GLATTER_FN_glReferencePlaneSGIX,
+    GLATTER_FN_glReleaseKeyedMutexWin32EXT,
+    GLATTER_FN_glReleaseShaderCompiler,
+    GLATTER_FN_glRenderGpuMaskNV,
+    GLATTER_FN_glRenderMode,
+    GLATTER_FN_glRenderbufferStorage,
+    GLATTER_FN_glRenderbufferStorageEXT,
+    GLATTER_FN_glRenderbufferStorageMultisample,
+    GLATTER_FN_glRenderbufferStorageMultisampleAdvancedAMD,
+    GLATTER_FN_glRenderbufferStorageMultisampleCoverageNV,
+    GLATTER_FN_glRenderbufferStorageMultisampleEXT,
+    GLATTER_FN_glReplacementCodePointerSUN,
+    GLATTER_FN_glReplacementCodeubSUN,
+    GLATTER_FN_glReplacementCodeubvSUN,
+    GLATTER_FN_glReplacementCodeuiColor3fVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiColor3fVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiColor4fNormal3fVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiColor4fNormal3fVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiColor4ubVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiColor4ubVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiNormal3fVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiNormal3fVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiSUN,
+    GLATTER_FN_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiTexCoord2fVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiTexCoord2fVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuiVertex3fSUN,
+    GLATTER_FN_glReplacementCodeuiVertex3fvSUN,
+    GLATTER_FN_glReplacementCodeuivSUN,
+    GLATTER_FN_glReplacementCodeusSUN,
+    GLATTER_FN_glReplacementCodeusvSUN,
+    GLATTER_FN_glRequestResidentProgramsNV,
+    GLATTER_FN_glResetHistogram,
+    GLATTER_FN_glResetHistogramEXT,
+    GLATTER_FN_glResetMemoryObjectParameterNV,
+    GLATTER_FN_glResetMinmax,
+    GLATTER_FN_glResetMinmaxEXT,
+    GLATTER_FN_glResizeBuffersMESA,
+    GLATTER_FN_glResolveDepthValuesNV,
+    GLATTER_FN_glResumeTransformFeedback,
+    GLATTER_FN_glResumeTransformFeedbackNV,
+    GLATTER_FN_glRotated,
+    GLATTER_FN_glRotatef,
+    GLATTER_FN_glRotatexOES,
+    GLATTER_FN_glSampleCoverage,
+    GLATTER_FN_glSampleCoverageARB,
+    GLATTER_FN_glSampleMapATI,
+    GLATTER_FN_glSampleMaskEXT,
+    GLATTER_FN_glSampleMaskIndexedNV,
+    GLATTER_FN_glSampleMaskSGIS,
+    GLATTER_FN_glSampleMaski,
+    GLATTER_FN_glSamplePatternEXT,
+    GLATTER_FN_glSamplePatternSGIS,
+    GLATTER_FN_glSamplerParameterIiv,
+    GLATTER_FN_glSamplerParameterIuiv,
+    GLATTER_FN_glSamplerParameterf,
+    GLATTER_FN_glSamplerParameterfv,
+    GLATTER_FN_glSamplerParameteri,
+    GLATTER_FN_glSamplerParameteriv,
+    GLATTER_FN_glScaled,
+    GLATTER_FN_glScalef,
+    GLATTER_FN_glScalexOES,
+    GLATTER_FN_glScissorArrayv,
+    GLATTER_FN_glScissorExclusiveArrayvNV,
+    GLATTER_FN_glScissorExclusiveNV,
+    GLATTER_FN_glScissorIndexed,
+    GLATTER_FN_glScissorIndexedv,
+    GLATTER_FN_glSecondaryColor3b,
+    GLATTER_FN_glSecondaryColor3bEXT,
+    GLATTER_FN_glSecondaryColor3bv,
+    GLATTER_FN_glSecondaryColor3bvEXT,
+    GLATTER_FN_glSecondaryColor3d,
+    GLATTER_FN_glSecondaryColor3dEXT,
+    GLATTER_FN_glSecondaryColor3dv,
+    GLATTER_FN_glSecondaryColor3dvEXT,
+    GLATTER_FN_glSecondaryColor3f,
+    GLATTER_FN_glSecondaryColor3fEXT,
+    GLATTER_FN_glSecondaryColor3fv,
+    GLATTER_FN_glSecondaryColor3fvEXT,
+    GLATTER_FN_glSecondaryColor3hNV,
+    GLATTER_FN_glSecondaryColor3hvNV,
+    GLATTER_FN_glSecondaryColor3i,
+    GLATTER_FN_glSecondaryColor3iEXT,
+    GLATTER_FN_glSecondaryColor3iv,
+    GLATTER_FN_glSecondaryColor3ivEXT,
+    GLATTER_FN_glSecondaryColor3s,
+    GLATTER_FN_glSecondaryColor3sEXT,
+    GLATTER_FN_glSecondaryColor3sv,
+    GLATTER_FN_glSecondaryColor3svEXT,
+    GLATTER_FN_glSecondaryColor3ub,
+    GLATTER_FN_glSecondaryColor3ubEXT,
+    GLATTER_FN_glSecondaryColor3ubv,
+    GLATTER_FN_glSecondaryColor3ubvEXT,
+    GLATTER_FN_glSecondaryColor3ui,
+    GLATTER_FN_glSecondaryColor3uiEXT,
+    GLATTER_FN_glSecondaryColor3uiv,
+    GLATTER_FN_glSecondaryColor3uivEXT,
+    GLATTER_FN_glSecondaryColor3us,
+    GLATTER_FN_glSecondaryColor3usEXT,
+    GLATTER_FN_glSecondaryColor3usv,
+    GLATTER_FN_glSecondaryColor3usvEXT,
+    GLATTER_FN_glSecondaryColorFormatNV,
+    GLATTER_FN_glSecondaryColorP3ui,
+    GLATTER_FN_glSecondaryColorP3uiv,
+    GLATTER_FN_glSecondaryColorPointer,
+    GLATTER_FN_glSecondaryColorPointerEXT,
+    GLATTER_FN_glSecondaryColorPointerListIBM,
+    GLATTER_FN_glSelectBuffer,
+    GLATTER_FN_glSelectPerfMonitorCountersAMD,
+    GLATTER_FN_glSemaphoreParameterivNV,
+    GLATTER_FN_glSemaphoreParameterui64vEXT,
+    GLATTER_FN_glSeparableFilter2D,
+    GLATTER_FN_glSeparableFilter2DEXT,
+    GLATTER_FN_glSetFenceAPPLE,
+    GLATTER_FN_glSetFenceNV,
+    GLATTER_FN_glSetFragmentShaderConstantATI,
+    GLATTER_FN_glSetInvariantEXT,
+    GLATTER_FN_glSetLocalConstantEXT,
+    GLATTER_FN_glSetMultisamplefvAMD,
+    GLATTER_FN_glShadeModel,
+    GLATTER_FN_glShaderBinary,
+    GLATTER_FN_glShaderOp1EXT,
+    GLATTER_FN_glShaderOp2EXT,
+    GLATTER_FN_glShaderOp3EXT,
+    GLATTER_FN_glShaderSource,
+    GLATTER_FN_glShaderSourceARB,
+    GLATTER_FN_glShaderStorageBlockBinding,
+    GLATTER_FN_glShadingRateCombinerOpsEXT,
+    GLATTER_FN_glShadingRateEXT,
+    GLATTER_FN_glShadingRateImageBarrierNV,
+    GLATTER_FN_glShadingRateImagePaletteNV,
+    GLATTER_FN_glShadingRateSampleOrderCustomNV,
+    GLATTER_FN_glShadingRateSampleOrderNV,
+    GLATTER_FN_glSharpenTexFuncSGIS,
+    GLATTER_FN_glSignalSemaphoreEXT,
+    GLATTER_FN_glSignalSemaphoreui64NVX,
+    GLATTER_FN_glSignalVkFenceNV,
+    GLATTER_FN_glSignalVkSemaphoreNV,
+    GLATTER_FN_glSpecializeShader,
+    GLATTER_FN_glSpecializeShaderARB,
+    GLATTER_FN_glSpriteParameterfSGIX,
+    GLATTER_FN_glSpriteParameterfvSGIX,
+    GLATTER_FN_glSpriteParameteriSGIX,
+    GLATTER_FN_glSpriteParameterivSGIX,
+    GLATTER_FN_glStartInstrumentsSGIX,
+    GLATTER_FN_glStateCaptureNV,
+    GLATTER_FN_glStencilClearTagEXT,
+    GLATTER_FN_glStencilFillPathInstancedNV,
+    GLATTER_FN_glStencilFillPathNV,
+    GLATTER_FN_glStencilFuncSeparate,
+    GLATTER_FN_glStencilFuncSeparateATI,
+    GLATTER_FN_glStencilMaskSeparate,
+    GLATTER_FN_glStencilOpSeparate,
+    GLATTER_FN_glStencilOpSeparateATI,
+    GLATTER_FN_glStencilOpValueAMD,
+    GLATTER_FN_glStencilStrokePathInstancedNV,
+    GLATTER_FN_glStencilStrokePathNV,
+    GLATTER_FN_glStencilThenCoverFillPathInstancedNV,
+    GLATTER_FN_glStencilThenCoverFillPathNV,
+    GLATTER_FN_glStencilThenCoverStrokePathInstancedNV,
+    GLATTER_FN_glStencilThenCoverStrokePathNV,
+    GLATTER_FN_glStopInstrumentsSGIX,
+    GLATTER_FN_glStringMarkerGREMEDY,
+    GLATTER_FN_glSubpixelPrecisionBiasNV,
+    GLATTER_FN_glSwizzleEXT,
+    GLATTER_FN_glSyncTextureINTEL,
+    GLATTER_FN_glTagSampleBufferSGIX,
+    GLATTER_FN_glTangent3bEXT,
+    GLATTER_FN_glTangent3bvEXT,
+    GLATTER_FN_glTangent3dEXT,
+    GLATTER_FN_glTangent3dvEXT,
+    GLATTER_FN_glTangent3fEXT,
+    GLATTER_FN_glTangent3fvEXT,
+    GLATTER_FN_glTangent3iEXT,
+    GLATTER_FN_glTangent3ivEXT,
+    GLATTER_FN_glTangent3sEXT,
+    GLATTER_FN_glTangent3svEXT,
+    GLATTER_FN_glTangentPointerEXT,
+    GLATTER_FN_glTbufferMask3DFX,
+    GLATTER_FN_glTessellationFactorAMD,
+    GLATTER_FN_glTessellationModeAMD,
+    GLATTER_FN_glTestFenceAPPLE,
+    GLATTER_FN_glTestFenceNV,
+    GLATTER_FN_glTestObjectAPPLE,
+    GLATTER_FN_glTexAttachMemoryNV,
+    GLATTER_FN_glTexBuffer,
+    GLATTER_FN_glTexBufferARB,
+    GLATTER_FN_glTexBufferEXT,
+    GLATTER_FN_glTexBufferRange,
+    GLATTER_FN_glTexBumpParameterfvATI,
+    GLATTER_FN_glTexBumpParameterivATI,
+    GLATTER_FN_glTexCoord1bOES,
+    GLATTER_FN_glTexCoord1bvOES,
+    GLATTER_FN_glTexCoord1d,
+    GLATTER_FN_glTexCoord1dv,
+    GLATTER_FN_glTexCoord1f,
+    GLATTER_FN_glTexCoord1fv,
+    GLATTER_FN_glTexCoord1hNV,
+    GLATTER_FN_glTexCoord1hvNV,
+    GLATTER_FN_glTexCoord1i,
+    GLATTER_FN_glTexCoord1iv,
+    GLATTER_FN_glTexCoord1s,
+    GLATTER_FN_glTexCoord1sv,
+    GLATTER_FN_glTexCoord1xOES,
+    GLATTER_FN_glTexCoord1xvOES,
+    GLATTER_FN_glTexCoord2bOES,
+    GLATTER_FN_glTexCoord2bvOES,
+    GLATTER_FN_glTexCoord2d,
+    GLATTER_FN_glTexCoord2dv,
+    GLATTER_FN_glTexCoord2f,
+    GLATTER_FN_glTexCoord2fColor3fVertex3fSUN,
+    GLATTER_FN_glTexCoord2fColor3fVertex3fvSUN,
+    GLATTER_FN_glTexCoord2fColor4fNormal3fVertex3fSUN,
+    GLATTER_FN_glTexCoord2fColor4fNormal3fVertex3fvSUN,
+    GLATTER_FN_glTexCoord2fColor4ubVertex3fSUN,
+    GLATTER_FN_glTexCoord2fColor4ubVertex3fvSUN,
+    GLATTER_FN_glTexCoord2fNormal3fVertex3fSUN,
+    GLATTER_FN_glTexCoord2fNormal3fVertex3fvSUN,
+    GLATTER_FN_glTexCoord2fVertex3fSUN,
+    GLATTER_FN_glTexCoord2fVertex3fvSUN,
+    GLATTER_FN_glTexCoord2fv,
+    GLATTER_FN_glTexCoord2hNV,
+    GLATTER_FN_glTexCoord2hvNV,
+    GLATTER_FN_glTexCoord2i,
+    GLATTER_FN_glTexCoord2iv,
+    GLATTER_FN_glTexCoord2s,
+    GLATTER_FN_glTexCoord2sv,
+    GLATTER_FN_glTexCoord2xOES,
+    GLATTER_FN_glTexCoord2xvOES,
+    GLATTER_FN_glTexCoord3bOES,
+    GLATTER_FN_glTexCoord3bvOES,
+    GLATTER_FN_glTexCoord3d,
+    GLATTER_FN_glTexCoord3dv,
+    GLATTER_FN_glTexCoord3f,
+    GLATTER_FN_glTexCoord3fv,
+    GLATTER_FN_glTexCoord3hNV,
+    GLATTER_FN_glTexCoord3hvNV,
+    GLATTER_FN_glTexCoord3i,
+    GLATTER_FN_glTexCoord3iv,
+    GLATTER_FN_glTexCoord3s,
+    GLATTER_FN_glTexCoord3sv,
+    GLATTER_FN_glTexCoord3xOES,
+    GLATTER_FN_glTexCoord3xvOES,
+    GLATTER_FN_glTexCoord4bOES,
+    GLATTER_FN_glTexCoord4bvOES,
+    GLATTER_FN_glTexCoord4d,
+    GLATTER_FN_glTexCoord4dv,
+    GLATTER_FN_glTexCoord4f,
+    GLATTER_FN_glTexCoord4fColor4fNormal3fVertex4fSUN,
+    GLATTER_FN_glTexCoord4fColor4fNormal3fVertex4fvSUN,
+    GLATTER_FN_glTexCoord4fVertex4fSUN,
+    GLATTER_FN_glTexCoord4fVertex4fvSUN,
+    GLATTER_FN_glTexCoord4fv,
+    GLATTER_FN_glTexCoord4hNV,
+    GLATTER_FN_glTexCoord4hvNV,
+    GLATTER_FN_glTexCoord4i,
+    GLATTER_FN_glTexCoord4iv,
+    GLATTER_FN_glTexCoord4s,
+    GLATTER_FN_glTexCoord4sv,
+    GLATTER_FN_glTexCoord4xOES,
+    GLATTER_FN_glTexCoord4xvOES,
+    GLATTER_FN_glTexCoordFormatNV,
+    GLATTER_FN_glTexCoordP1ui,
+    GLATTER_FN_glTexCoordP1uiv,
+    GLATTER_FN_glTexCoordP2ui,
+    GLATTER_FN_glTexCoordP2uiv,
+    GLATTER_FN_glTexCoordP3ui,
+    GLATTER_FN_glTexCoordP3uiv,
+    GLATTER_FN_glTexCoordP4ui,
+    GLATTER_FN_glTexCoordP4uiv,
+    GLATTER_FN_glTexCoordPointer,
+    GLATTER_FN_glTexCoordPointerEXT,
+    GLATTER_FN_glTexCoordPointerListIBM,
+    GLATTER_FN_glTexCoordPointervINTEL,
+    GLATTER_FN_glTexEnvf,
+    GLATTER_FN_glTexEnvfv,
+    GLATTER_FN_glTexEnvi,
+    GLATTER_FN_glTexEnviv,
+    GLATTER_FN_glTexEnvxOES,
+    GLATTER_FN_glTexEnvxvOES,
+    GLATTER_FN_glTexFilterFuncSGIS,
+    GLATTER_FN_glTexGend,
+    GLATTER_FN_glTexGendv,
+    GLATTER_FN_glTexGenf,
+    GLATTER_FN_glTexGenfv,
+    GLATTER_FN_glTexGeni,
+    GLATTER_FN_glTexGeniv,
+    GLATTER_FN_glTexGenxOES,
+    GLATTER_FN_glTexGenxvOES,
+    GLATTER_FN_glTexImage1D,
+    GLATTER_FN_glTexImage2DMultisample,
+    GLATTER_FN_glTexImage2DMultisampleCoverageNV,
+    GLATTER_FN_glTexImage3D,
+    GLATTER_FN_glTexImage3DEXT,
+    GLATTER_FN_glTexImage3DMultisample,
+    GLATTER_FN_glTexImage3DMultisampleCoverageNV,
+    GLATTER_FN_glTexImage4DSGIS,
+    GLATTER_FN_glTexPageCommitmentARB,
+    GLATTER_FN_glTexPageCommitmentMemNV,
+    GLATTER_FN_glTexParameterIiv,
+    GLATTER_FN_glTexParameterIivEXT,
+    GLATTER_FN_glTexParameterIuiv,
+    GLATTER_FN_glTexParameterIuivEXT,
+    GLATTER_FN_glTexParameterf,
+    GLATTER_FN_glTexParameterfv,
+    GLATTER_FN_glTexParameteri,
+    GLATTER_FN_glTexParameteriv,
+    GLATTER_FN_glTexParameterxOES,
+    GLATTER_FN_glTexParameterxvOES,
+    GLATTER_FN_glTexRenderbufferNV,
+    GLATTER_FN_glTexStorage1D,
+    GLATTER_FN_glTexStorage1DEXT,
+    GLATTER_FN_glTexStorage2D,
+    GLATTER_FN_glTexStorage2DEXT,
+    GLATTER_FN_glTexStorage2DMultisample,
+    GLATTER_FN_glTexStorage3D,
+    GLATTER_FN_glTexStorage3DEXT,
+    GLATTER_FN_glTexStorage3DMultisample,
+    GLATTER_FN_glTexStorageMem1DEXT,
+    GLATTER_FN_glTexStorageMem2DEXT,
+    GLATTER_FN_glTexStorageMem2DMultisampleEXT,
+    GLATTER_FN_glTexStorageMem3DEXT,
+    GLATTER_FN_glTexStorageMem3DMultisampleEXT,
+    GLATTER_FN_glTexStorageSparseAMD,
+    GLATTER_FN_glTexSubImage1D,
+    GLATTER_FN_glTexSubImage1DEXT,
+    GLATTER_FN_glTexSubImage2DEXT,
+    GLATTER_FN_glTexSubImage3D,
+    GLATTER_FN_glTexSubImage3DEXT,
+    GLATTER_FN_glTexSubImage4DSGIS,
+    GLATTER_FN_glTextureAttachMemoryNV,
+    GLATTER_FN_glTextureBarrier,
+    GLATTER_FN_glTextureBarrierNV,
+    GLATTER_FN_glTextureBuffer,
+    GLATTER_FN_glTextureBufferEXT,
+    GLATTER_FN_glTextureBufferRange,
+    GLATTER_FN_glTextureBufferRangeEXT,
+    GLATTER_FN_glTextureColorMaskSGIS,
+    GLATTER_FN_glTextureImage1DEXT,
+    GLATTER_FN_glTextureImage2DEXT,
+    GLATTER_FN_glTextureImage2DMultisampleCoverageNV,
+    GLATTER_FN_glTextureImage2DMultisampleNV,
+    GLATTER_FN_glTextureImage3DEXT,
+    GLATTER_FN_glTextureImage3DMultisampleCoverageNV,
+    GLATTER_FN_glTextureImage3DMultisampleNV,
+    GLATTER_FN_glTextureLightEXT,
+    GLATTER_FN_glTextureMaterialEXT,
+    GLATTER_FN_glTextureNormalEXT,
+    GLATTER_FN_glTexturePageCommitmentEXT,
+    GLATTER_FN_glTexturePageCommitmentMemNV,
+    GLATTER_FN_glTextureParameterIiv,
+    GLATTER_FN_glTextureParameterIivEXT,
+    GLATTER_FN_glTextureParameterIuiv,
+    GLATTER_FN_glTextureParameterIuivEXT,
+    GLATTER_FN_glTextureParameterf,
+    GLATTER_FN_glTextureParameterfEXT,
+    GLATTER_FN_glTextureParameterfv,
+    GLATTER_FN_glTextureParameterfvEXT,
+    GLATTER_FN_glTextureParameteri,
+    GLATTER_FN_glTextureParameteriEXT,
+    GLATTER_FN_glTextureParameteriv,
+    GLATTER_FN_glTextureParameterivEXT,
+    GLATTER_FN_glTextureRangeAPPLE,
+    GLATTER_FN_glTextureRenderbufferEXT,
+    GLATTER_FN_glTextureStorage1D,
+    GLATTER_FN_glTextureStorage1DEXT,
+    GLATTER_FN_glTextureStorage2D,
+    GLATTER_FN_glTextureStorage2DEXT,
+    GLATTER_FN_glTextureStorage2DMultisample,
+    GLATTER_FN_glTextureStorage2DMultisampleEXT,
+    GLATTER_FN_glTextureStorage3D,
+    GLATTER_FN_glTextureStorage3DEXT,
+    GLATTER_FN_glTextureStorage3DMultisample,
+    GLATTER_FN_glTextureStorage3DMultisampleEXT,
+    GLATTER_FN_glTextureStorageMem1DEXT,
+    GLATTER_FN_glTextureStorageMem2DEXT,
+    GLATTER_FN_glTextureStorageMem2DMultisampleEXT,
+    GLATTER_FN_glTextureStorageMem3DEXT,
+    GLATTER_FN_glTextureStorageMem3DMultisampleEXT,
+    GLATTER_FN_glTextureStorageSparseAMD,
+    GLATTER_FN_glTextureSubImage1D,
+    GLATTER_FN_glTextureSubImage1DEXT,
+    GLATTER_FN_glTextureSubImage2D,
+    GLATTER_FN_glTextureSubImage2DEXT,
+    GLATTER_FN_glTextureSubImage3D,
+    GLATTER_FN_glTextureSubImage3DEXT,
+    GLATTER_FN_glTextureView,
+    GLATTER_FN_glTrackMatrixNV,
+    GLATTER_FN_glTransformFeedbackAttribsNV,
+    GLATTER_FN_glTransformFeedbackBufferBase,
+    GLATTER_FN_glTransformFeedbackBufferRange,
+    GLATTER_FN_glTransformFeedbackStreamAttribsNV,
+    GLATTER_FN_glTransformFeedbackVaryings,
+    GLATTER_FN_glTransformFeedbackVaryingsEXT,
+    GLATTER_FN_glTransformFeedbackVaryingsNV,
+    GLATTER_FN_glTransformPathNV,
+    GLATTER_FN_glTranslated,
+    GLATTER_FN_glTranslatef,
+    GLATTER_FN_glTranslatexOES,
+    GLATTER_FN_glUniform1d,
+    GLATTER_FN_glUniform1dv,
+    GLATTER_FN_glUniform1fARB,
+    GLATTER_FN_glUniform1fvARB,
+    GLATTER_FN_glUniform1i64ARB,
+    GLATTER_FN_glUniform1i64NV,
+    GLATTER_FN_glUniform1i64vARB,
+    GLATTER_FN_glUniform1i64vNV,
+    GLATTER_FN_glUniform1iARB,
+    GLATTER_FN_glUniform1ivARB,
+    GLATTER_FN_glUniform1ui,
+    GLATTER_FN_glUniform1ui64ARB,
+    GLATTER_FN_glUniform1ui64NV,
+    GLATTER_FN_glUniform1ui64vARB,
+    GLATTER_FN_glUniform1ui64vNV,
+    GLATTER_FN_glUniform1uiEXT,
+    GLATTER_FN_glUniform1uiv,
+    GLATTER_FN_glUniform1uivEXT,
+    GLATTER_FN_glUniform2d,
+    GLATTER_FN_glUniform2dv,
+    GLATTER_FN_glUniform2fARB,
+    GLATTER_FN_glUniform2fvARB,
+    GLATTER_FN_glUniform2i,
+    GLATTER_FN_glUniform2i64ARB,
+    GLATTER_FN_glUniform2i64NV,
+    GLATTER_FN_glUniform2i64vARB,
+    GLATTER_FN_glUniform2i64vNV,
+    GLATTER_FN_glUniform2iARB,
+    GLATTER_FN_glUniform2iv,
+    GLATTER_FN_glUniform2ivARB,
+    GLATTER_FN_glUniform2ui,
+    GLATTER_FN_glUniform2ui64ARB,
+    GLATTER_FN_glUniform2ui64NV,
+    GLATTER_FN_glUniform2ui64vARB,
+    GLATTER_FN_glUniform2ui64vNV,
+    GLATTER_FN_glUniform2uiEXT,
+    GLATTER_FN_glUniform2uiv,
+    GLATTER_FN_glUniform2uivEXT,
+    GLATTER_FN_glUniform3d,
+    GLATTER_FN_glUniform3dv,
+    GLATTER_FN_glUniform3fARB,
+    GLATTER_FN_glUniform3fvARB,
+    GLATTER_FN_glUniform3i,
+    GLATTER_FN_glUniform3i64ARB,
+    GLATTER_FN_glUniform3i64NV,
+    GLATTER_FN_glUniform3i64vARB,
+    GLATTER_FN_glUniform3i64vNV,
+    GLATTER_FN_glUniform3iARB,
+    GLATTER_FN_glUniform3iv,
+    GLATTER_FN_glUniform3ivARB,
+    GLATTER_FN_glUniform3ui,
+    GLATTER_FN_glUniform3ui64ARB,
+    GLATTER_FN_glUniform3ui64NV,
+    GLATTER_FN_glUniform3ui64vARB,
+    GLATTER_FN_glUniform3ui64vNV,
+    GLATTER_FN_glUniform3uiEXT,
+    GLATTER_FN_glUniform3uiv,
+    GLATTER_FN_glUniform3uivEXT,
+    GLATTER_FN_glUniform4d,
+    GLATTER_FN_glUniform4dv,
+    GLATTER_FN_glUniform4fARB,
+    GLATTER_FN_glUniform4fvARB,
+    GLATTER_FN_glUniform4i,
+    GLATTER_FN_glUniform4i64ARB,
+    GLATTER_FN_glUniform4i64NV,
+    GLATTER_FN_glUniform4i64vARB,
+    GLATTER_FN_glUniform4i64vNV,
+    GLATTER_FN_glUniform4iARB,
+    GLATTER_FN_glUniform4iv,
+    GLATTER_FN_glUniform4ivARB,
+    GLATTER_FN_glUniform4ui,
+    GLATTER_FN_glUniform4ui64ARB,
+    GLATTER_FN_glUniform4ui64NV,
+    GLATTER_FN_glUniform4ui64vARB,
+    GLATTER_FN_glUniform4ui64vNV,
+    GLATTER_FN_glUniform4uiEXT,
+    GLATTER_FN_glUniform4uiv,
+    GLATTER_FN_glUniform4uivEXT,
+    GLATTER_FN_glUniformBlockBinding,
+    GLATTER_FN_glUniformBufferEXT,
+    GLATTER_FN_glUniformHandleui64ARB,
+    GLATTER_FN_glUniformHandleui64NV,
+    GLATTER_FN_glUniformHandleui64vARB,
+    GLATTER_FN_glUniformHandleui64vNV,
+    GLATTER_FN_glUniformMatrix2dv,
+    GLATTER_FN_glUniformMatrix2fv,
+    GLATTER_FN_glUniformMatrix2fvARB,
+    GLATTER_FN_glUniformMatrix2x3dv,
+    GLATTER_FN_glUniformMatrix2x3fv,
+    GLATTER_FN_glUniformMatrix2x4dv,
+    GLATTER_FN_glUniformMatrix2x4fv,
+    GLATTER_FN_glUniformMatrix3dv,
+    GLATTER_FN_glUniformMatrix3fvARB,
+    GLATTER_FN_glUniformMatrix3x2dv,
+    GLATTER_FN_glUniformMatrix3x2fv,
+    GLATTER_FN_glUniformMatrix3x4dv,
+    GLATTER_FN_glUniformMatrix3x4fv,
+    GLATTER_FN_glUniformMatrix4dv,
+    GLATTER_FN_glUniformMatrix4fvARB,
+    GLATTER_FN_glUniformMatrix4x2dv,
+    GLATTER_FN_glUniformMatrix4x2fv,
+    GLATTER_FN_glUniformMatrix4x3dv,
+    GLATTER_FN_glUniformMatrix4x3fv,
+    GLATTER_FN_glUniformSubroutinesuiv,
+    GLATTER_FN_glUniformui64NV,
+    GLATTER_FN_glUniformui64vNV,
+    GLATTER_FN_glUnlockArraysEXT,
+    GLATTER_FN_glUnmapBufferARB,
+    GLATTER_FN_glUnmapNamedBuffer,
+    GLATTER_FN_glUnmapNamedBufferEXT,
+    GLATTER_FN_glUnmapObjectBufferATI,
+    GLATTER_FN_glUnmapTexture2DINTEL,
+    GLATTER_FN_glUpdateObjectBufferATI,
+    GLATTER_FN_glUploadGpuMaskNVX,
+    GLATTER_FN_glUseProgramObjectARB,
+    GLATTER_FN_glUseProgramStages,
+    GLATTER_FN_glUseShaderProgramEXT,
+    GLATTER_FN_glVDPAUFiniNV,
+    GLATTER_FN_glVDPAUGetSurfaceivNV,
+    GLATTER_FN_glVDPAUInitNV,
+    GLATTER_FN_glVDPAUIsSurfaceNV,
+    GLATTER_FN_glVDPAUMapSurfacesNV,
+    GLATTER_FN_glVDPAURegisterOutputSurfaceNV,
+    GLATTER_FN_glVDPAURegisterVideoSurfaceNV,
+    GLATTER_FN_glVDPAURegisterVideoSurfaceWithPictureStructureNV,
+    GLATTER_FN_glVDPAUSurfaceAccessNV,
+    GLATTER_FN_glVDPAUUnmapSurfacesNV,
+    GLATTER_FN_glVDPAUUnregisterSurfaceNV,
+    GLATTER_FN_glValidateProgram,
+    GLATTER_FN_glValidateProgramARB,
+    GLATTER_FN_glValidateProgramPipeline,
+    GLATTER_FN_glVariantArrayObjectATI,
+    GLATTER_FN_glVariantPointerEXT,
+    GLATTER_FN_glVariantbvEXT,
+    GLATTER_FN_glVariantdvEXT,
+    GLATTER_FN_glVariantfvEXT,
+    GLATTER_FN_glVariantivEXT,
+    GLATTER_FN_glVariantsvEXT,
+    GLATTER_FN_glVariantubvEXT,
+    GLATTER_FN_glVariantuivEXT,
+    GLATTER_FN_glVariantusvEXT,
+    GLATTER_FN_glVertex2bOES,
+    GLATTER_FN_glVertex2bvOES,
+    GLATTER_FN_glVertex2d,
+    GLATTER_FN_glVertex2dv,
+    GLATTER_FN_glVertex2f,
+    GLATTER_FN_glVertex2fv,
+    GLATTER_FN_glVertex2hNV,
+    GLATTER_FN_glVertex2hvNV,
+    GLATTER_FN_glVertex2i,
+    GLATTER_FN_glVertex2iv,
+    GLATTER_FN_glVertex2s,
+    GLATTER_FN_glVertex2sv,
+    GLATTER_FN_glVertex2xOES,
+    GLATTER_FN_glVertex2xvOES,
+    GLATTER_FN_glVertex3bOES,
+    GLATTER_FN_glVertex3bvOES,
+    GLATTER_FN_glVertex3d,
+    GLATTER_FN_glVertex3dv,
+    GLATTER_FN_glVertex3f,
+    GLATTER_FN_glVertex3fv,
+    GLATTER_FN_glVertex3hNV,
+    GLATTER_FN_glVertex3hvNV,
+    GLATTER_FN_glVertex3i,
+    GLATTER_FN_glVertex3iv,
+    GLATTER_FN_glVertex3s,
+    GLATTER_FN_glVertex3sv,
+    GLATTER_FN_glVertex3xOES,
+    GLATTER_FN_glVertex3xvOES,
+    GLATTER_FN_glVertex4bOES,
+    GLATTER_FN_glVertex4bvOES,
+    GLATTER_FN_glVertex4d,
+    GLATTER_FN_glVertex4dv,
+    GLATTER_FN_glVertex4f,
+    GLATTER_FN_glVertex4fv,
+    GLATTER_FN_glVertex4hNV,
+    GLATTER_FN_glVertex4hvNV,
+    GLATTER_FN_glVertex4i,
+    GLATTER_FN_glVertex4iv,
+    GLATTER_FN_glVertex4s,
+    GLATTER_FN_glVertex4sv,
+    GLATTER_FN_glVertex4xOES,
+    GLATTER_FN_glVertex4xvOES,
+    GLATTER_FN_glVertexArrayAttribBinding,
+    GLATTER_FN_glVertexArrayAttribFormat,
+    GLATTER_FN_glVertexArrayAttribIFormat,
+    GLATTER_FN_glVertexArrayAttribLFormat,
+    GLATTER_FN_glVertexArrayBindVertexBufferEXT,
+    GLATTER_FN_glVertexArrayBindingDivisor,
+    GLATTER_FN_glVertexArrayColorOffsetEXT,
+    GLATTER_FN_glVertexArrayEdgeFlagOffsetEXT,
+    GLATTER_FN_glVertexArrayElementBuffer,
+    GLATTER_FN_glVertexArrayFogCoordOffsetEXT,
+    GLATTER_FN_glVertexArrayIndexOffsetEXT,
+    GLATTER_FN_glVertexArrayMultiTexCoordOffsetEXT,
+    GLATTER_FN_glVertexArrayNormalOffsetEXT,
+    GLATTER_FN_glVertexArrayParameteriAPPLE,
+    GLATTER_FN_glVertexArrayRangeAPPLE,
+    GLATTER_FN_glVertexArrayRangeNV,
+    GLATTER_FN_glVertexArraySecondaryColorOffsetEXT,
+    GLATTER_FN_glVertexArrayTexCoordOffsetEXT,
+    GLATTER_FN_glVertexArrayVertexAttribBindingEXT,
+    GLATTER_FN_glVertexArrayVertexAttribDivisorEXT,
+    GLATTER_FN_glVertexArrayVertexAttribFormatEXT,
+    GLATTER_FN_glVertexArrayVertexAttribIFormatEXT,
+    GLATTER_FN_glVertexArrayVertexAttribIOffsetEXT,
+    GLATTER_FN_glVertexArrayVertexAttribLFormatEXT,
+    GLATTER_FN_glVertexArrayVertexAttribLOffsetEXT,
+    GLATTER_FN_glVertexArrayVertexAttribOffsetEXT,
+    GLATTER_FN_glVertexArrayVertexBindingDivisorEXT,
+    GLATTER_FN_glVertexArrayVertexBuffer,
+    GLATTER_FN_glVertexArrayVertexBuffers,
+    GLATTER_FN_glVertexArrayVertexOffsetEXT,
+    GLATTER_FN_glVertexAttrib1d,
+    GLATTER_FN_glVertexAttrib1dARB,
+    GLATTER_FN_glVertexAttrib1dNV,
+    GLATTER_FN_glVertexAttrib1dv,
+    GLATTER_FN_glVertexAttrib1dvARB,
+    GLATTER_FN_glVertexAttrib1dvNV,
+    GLATTER_FN_glVertexAttrib1f,
+    GLATTER_FN_glVertexAttrib1fARB,
+    GLATTER_FN_glVertexAttrib1fNV,
+    GLATTER_FN_glVertexAttrib1fv,
+    GLATTER_FN_glVertexAttrib1fvARB,
+    GLATTER_FN_glVertexAttrib1fvNV,
+    GLATTER_FN_glVertexAttrib1hNV,
+    GLATTER_FN_glVertexAttrib1hvNV,
+    GLATTER_FN_glVertexAttrib1s,
+    GLATTER_FN_glVertexAttrib1sARB,
+    GLATTER_FN_glVertexAttrib1sNV,
+    GLATTER_FN_glVertexAttrib1sv,
+    GLATTER_FN_glVertexAttrib1svARB,
+    GLATTER_FN_glVertexAttrib1svNV,
+    GLATTER_FN_glVertexAttrib2d,
+    GLATTER_FN_glVertexAttrib2dARB,
+    GLATTER_FN_glVertexAttrib2dNV,
+    GLATTER_FN_glVertexAttrib2dv,
+    GLATTER_FN_glVertexAttrib2dvARB,
+    GLATTER_FN_glVertexAttrib2dvNV,
+    GLATTER_FN_glVertexAttrib2f,
+    GLATTER_FN_glVertexAttrib2fARB,
+    GLATTER_FN_glVertexAttrib2fNV,
+    GLATTER_FN_glVertexAttrib2fv,
+    GLATTER_FN_glVertexAttrib2fvARB,
+    GLATTER_FN_glVertexAttrib2fvNV,
+    GLATTER_FN_glVertexAttrib2hNV,
+    GLATTER_FN_glVertexAttrib2hvNV,
+    GLATTER_FN_glVertexAttrib2s,
+    GLATTER_FN_glVertexAttrib2sARB,
+    GLATTER_FN_glVertexAttrib2sNV,
+    GLATTER_FN_glVertexAttrib2sv,
+    GLATTER_FN_glVertexAttrib2svARB,
+    GLATTER_FN_glVertexAttrib2svNV,
+    GLATTER_FN_glVertexAttrib3d,
+    GLATTER_FN_glVertexAttrib3dARB,
+    GLATTER_FN_glVertexAttrib3dNV,
+    GLATTER_FN_glVertexAttrib3dv,
+    GLATTER_FN_glVertexAttrib3dvARB,
+    GLATTER_FN_glVertexAttrib3dvNV,
+    GLATTER_FN_glVertexAttrib3f,
+    GLATTER_FN_glVertexAttrib3fARB,
+    GLATTER_FN_glVertexAttrib3fNV,
+    GLATTER_FN_glVertexAttrib3fv,
+    GLATTER_FN_glVertexAttrib3fvARB,
+    GLATTER_FN_glVertexAttrib3fvNV,
+    GLATTER_FN_glVertexAttrib3hNV,
+    GLATTER_FN_glVertexAttrib3hvNV,
+    GLATTER_FN_glVertexAttrib3s,
+    GLATTER_FN_glVertexAttrib3sARB,
+    GLATTER_FN_glVertexAttrib3sNV,
+    GLATTER_FN_glVertexAttrib3sv,
+    GLATTER_FN_glVertexAttrib3svARB,
+    GLATTER_FN_glVertexAttrib3svNV,
+    GLATTER_FN_glVertexAttrib4Nbv,
+    GLATTER_FN_glVertexAttrib4NbvARB,
+    GLATTER_FN_glVertexAttrib4Niv,
+    GLATTER_FN_glVertexAttrib4NivARB,
+    GLATTER_FN_glVertexAttrib4Nsv,
+    GLATTER_FN_glVertexAttrib4NsvARB,
+    GLATTER_FN_glVertexAttrib4Nub,
+    GLATTER_FN_glVertexAttrib4NubARB,
+    GLATTER_FN_glVertexAttrib4Nubv,
+    GLATTER_FN_glVertexAttrib4NubvARB,
+    GLATTER_FN_glVertexAttrib4Nuiv,
+    GLATTER_FN_glVertexAttrib4NuivARB,
+    GLATTER_FN_glVertexAttrib4Nusv,
+    GLATTER_FN_glVertexAttrib4NusvARB,
+    GLATTER_FN_glVertexAttrib4bv,
+    GLATTER_FN_glVertexAttrib4bvARB,
+    GLATTER_FN_glVertexAttrib4d,
+    GLATTER_FN_glVertexAttrib4dARB,
+    GLATTER_FN_glVertexAttrib4dNV,
+    GLATTER_FN_glVertexAttrib4dv,
+    GLATTER_FN_glVertexAttrib4dvARB,
+    GLATTER_FN_glVertexAttrib4dvNV,
+    GLATTER_FN_glVertexAttrib4f,
+    GLATTER_FN_glVertexAttrib4fARB,
+    GLATTER_FN_glVertexAttrib4fNV,
+    GLATTER_FN_glVertexAttrib4fv,
+    GLATTER_FN_glVertexAttrib4fvARB,
+    GLATTER_FN_glVertexAttrib4fvNV,
+    GLATTER_FN_glVertexAttrib4hNV,
+    GLATTER_FN_glVertexAttrib4hvNV,
+    GLATTER_FN_glVertexAttrib4iv,
+    GLATTER_FN_glVertexAttrib4ivARB,
+    GLATTER_FN_glVertexAttrib4s,
+    GLATTER_FN_glVertexAttrib4sARB,
+    GLATTER_FN_glVertexAttrib4sNV,
+    GLATTER_FN_glVertexAttrib4sv,
+    GLATTER_FN_glVertexAttrib4svARB,
+    GLATTER_FN_glVertexAttrib4svNV,
+    GLATTER_FN_glVertexAttrib4ubNV,
+    GLATTER_FN_glVertexAttrib4ubv,
+    GLATTER_FN_glVertexAttrib4ubvARB,
+    GLATTER_FN_glVertexAttrib4ubvNV,
+    GLATTER_FN_glVertexAttrib4uiv,
+    GLATTER_FN_glVertexAttrib4uivARB,
+    GLATTER_FN_glVertexAttrib4usv,
+    GLATTER_FN_glVertexAttrib4usvARB,
+    GLATTER_FN_glVertexAttribArrayObjectATI,
+    GLATTER_FN_glVertexAttribBinding,
+    GLATTER_FN_glVertexAttribDivisorARB,
+    GLATTER_FN_glVertexAttribFormat,
+    GLATTER_FN_glVertexAttribFormatNV,
+    GLATTER_FN_glVertexAttribI1i,
+    GLATTER_FN_glVertexAttribI1iEXT,
+    GLATTER_FN_glVertexAttribI1iv,
+    GLATTER_FN_glVertexAttribI1ivEXT,
+    GLATTER_FN_glVertexAttribI1ui,
+    GLATTER_FN_glVertexAttribI1uiEXT,
+    GLATTER_FN_glVertexAttribI1uiv,
+    GLATTER_FN_glVertexAttribI1uivEXT,
+    GLATTER_FN_glVertexAttribI2i,
+    GLATTER_FN_glVertexAttribI2iEXT,
+    GLATTER_FN_glVertexAttribI2iv,
+    GLATTER_FN_glVertexAttribI2ivEXT,
+    GLATTER_FN_glVertexAttribI2ui,
+    GLATTER_FN_glVertexAttribI2uiEXT,
+    GLATTER_FN_glVertexAttribI2uiv,
+    GLATTER_FN_glVertexAttribI2uivEXT,
+    GLATTER_FN_glVertexAttribI3i,
+    GLATTER_FN_glVertexAttribI3iEXT,
+    GLATTER_FN_glVertexAttribI3iv,
+    GLATTER_FN_glVertexAttribI3ivEXT,
+    GLATTER_FN_glVertexAttribI3ui,
+    GLATTER_FN_glVertexAttribI3uiEXT,
+    GLATTER_FN_glVertexAttribI3uiv,
+    GLATTER_FN_glVertexAttribI3uivEXT,
+    GLATTER_FN_glVertexAttribI4bv,
+    GLATTER_FN_glVertexAttribI4bvEXT,
+    GLATTER_FN_glVertexAttribI4i,
+    GLATTER_FN_glVertexAttribI4iEXT,
+    GLATTER_FN_glVertexAttribI4iv,
+    GLATTER_FN_glVertexAttribI4ivEXT,
+    GLATTER_FN_glVertexAttribI4sv,
+    GLATTER_FN_glVertexAttribI4svEXT,
+    GLATTER_FN_glVertexAttribI4ubv,
+    GLATTER_FN_glVertexAttribI4ubvEXT,
+    GLATTER_FN_glVertexAttribI4ui,
+    GLATTER_FN_glVertexAttribI4uiEXT,
+    GLATTER_FN_glVertexAttribI4uiv,
+    GLATTER_FN_glVertexAttribI4uivEXT,
+    GLATTER_FN_glVertexAttribI4usv,
+    GLATTER_FN_glVertexAttribI4usvEXT,
+    GLATTER_FN_glVertexAttribIFormat,
+    GLATTER_FN_glVertexAttribIFormatNV,
+    GLATTER_FN_glVertexAttribIPointerEXT,
+    GLATTER_FN_glVertexAttribL1d,
+    GLATTER_FN_glVertexAttribL1dEXT,
+    GLATTER_FN_glVertexAttribL1dv,
+    GLATTER_FN_glVertexAttribL1dvEXT,
+    GLATTER_FN_glVertexAttribL1i64NV,
+    GLATTER_FN_glVertexAttribL1i64vNV,
+    GLATTER_FN_glVertexAttribL1ui64ARB,
+    GLATTER_FN_glVertexAttribL1ui64NV,
+    GLATTER_FN_glVertexAttribL1ui64vARB,
+    GLATTER_FN_glVertexAttribL1ui64vNV,
+    GLATTER_FN_glVertexAttribL2d,
+    GLATTER_FN_glVertexAttribL2dEXT,
+    GLATTER_FN_glVertexAttribL2dv,
+    GLATTER_FN_glVertexAttribL2dvEXT,
+    GLATTER_FN_glVertexAttribL2i64NV,
+    GLATTER_FN_glVertexAttribL2i64vNV,
+    GLATTER_FN_glVertexAttribL2ui64NV,
+    GLATTER_FN_glVertexAttribL2ui64vNV,
+    GLATTER_FN_glVertexAttribL3d,
+    GLATTER_FN_glVertexAttribL3dEXT,
+    GLATTER_FN_glVertexAttribL3dv,
+    GLATTER_FN_glVertexAttribL3dvEXT,
+    GLATTER_FN_glVertexAttribL3i64NV,
+    GLATTER_FN_glVertexAttribL3i64vNV,
+    GLATTER_FN_glVertexAttribL3ui64NV,
+    GLATTER_FN_glVertexAttribL3ui64vNV,
+    GLATTER_FN_glVertexAttribL4d,
+    GLATTER_FN_glVertexAttribL4dEXT,
+    GLATTER_FN_glVertexAttribL4dv,
+    GLATTER_FN_glVertexAttribL4dvEXT,
+    GLATTER_FN_glVertexAttribL4i64NV,
+    GLATTER_FN_glVertexAttribL4i64vNV,
+    GLATTER_FN_glVertexAttribL4ui64NV,
+    GLATTER_FN_glVertexAttribL4ui64vNV,
+    GLATTER_FN_glVertexAttribLFormat,
+    GLATTER_FN_glVertexAttribLFormatNV,
+    GLATTER_FN_glVertexAttribLPointer,
+    GLATTER_FN_glVertexAttribLPointerEXT,
+    GLATTER_FN_glVertexAttribP1ui,
+    GLATTER_FN_glVertexAttribP1uiv,
+    GLATTER_FN_glVertexAttribP2ui,
+    GLATTER_FN_glVertexAttribP2uiv,
+    GLATTER_FN_glVertexAttribP3ui,
+    GLATTER_FN_glVertexAttribP3uiv,
+    GLATTER_FN_glVertexAttribP4ui,
+    GLATTER_FN_glVertexAttribP4uiv,
+    GLATTER_FN_glVertexAttribParameteriAMD,
+    GLATTER_FN_glVertexAttribPointerARB,
+    GLATTER_FN_glVertexAttribPointerNV,
+    GLATTER_FN_glVertexAttribs1dvNV,
+    GLATTER_FN_glVertexAttribs1fvNV,
+    GLATTER_FN_glVertexAttribs1hvNV,
+    GLATTER_FN_glVertexAttribs1svNV,
+    GLATTER_FN_glVertexAttribs2dvNV,
+    GLATTER_FN_glVertexAttribs2fvNV,
+    GLATTER_FN_glVertexAttribs2hvNV,
+    GLATTER_FN_glVertexAttribs2svNV,
+    GLATTER_FN_glVertexAttribs3dvNV,
+    GLATTER_FN_glVertexAttribs3fvNV,
+    GLATTER_FN_glVertexAttribs3hvNV,
+    GLATTER_FN_glVertexAttribs3svNV,
+    GLATTER_FN_glVertexAttribs4dvNV,
+    GLATTER_FN_glVertexAttribs4fvNV,
+    GLATTER_FN_glVertexAttribs4hvNV,
+    GLATTER_FN_glVertexAttribs4svNV,
+    GLATTER_FN_glVertexAttribs4ubvNV,
+    GLATTER_FN_glVertexBindingDivisor,
+    GLATTER_FN_glVertexBlendARB,
+    GLATTER_FN_glVertexBlendEnvfATI,
+    GLATTER_FN_glVertexBlendEnviATI,
+    GLATTER_FN_glVertexFormatNV,
+    GLATTER_FN_glVertexP2ui,
+    GLATTER_FN_glVertexP2uiv,
+    GLATTER_FN_glVertexP3ui,
+    GLATTER_FN_glVertexP3uiv,
+    GLATTER_FN_glVertexP4ui,
+    GLATTER_FN_glVertexP4uiv,
+    GLATTER_FN_glVertexPointer,
+    GLATTER_FN_glVertexPointerEXT,
+    GLATTER_FN_glVertexPointerListIBM,
+    GLATTER_FN_glVertexPointervINTEL,
+    GLATTER_FN_glVertexStream1dATI,
+    GLATTER_FN_glVertexStream1dvATI,
+    GLATTER_FN_glVertexStream1fATI,
+    GLATTER_FN_glVertexStream1fvATI,
+    GLATTER_FN_glVertexStream1iATI,
+    GLATTER_FN_glVertexStream1ivATI,
+    GLATTER_FN_glVertexStream1sATI,
+    GLATTER_FN_glVertexStream1svATI,
+    GLATTER_FN_glVertexStream2dATI,
+    GLATTER_FN_glVertexStream2dvATI,
+    GLATTER_FN_glVertexStream2fATI,
+    GLATTER_FN_glVertexStream2fvATI,
+    GLATTER_FN_glVertexStream2iATI,
+    GLATTER_FN_glVertexStream2ivATI,
+    GLATTER_FN_glVertexStream2sATI,
+    GLATTER_FN_glVertexStream2svATI,
+    GLATTER_FN_glVertexStream3dATI,
+    GLATTER_FN_glVertexStream3dvATI,
+    GLATTER_FN_glVertexStream3fATI,
+    GLATTER_FN_glVertexStream3fvATI,
+    GLATTER_FN_glVertexStream3iATI,
+    GLATTER_FN_glVertexStream3ivATI,
+    GLATTER_FN_glVertexStream3sATI,
+    GLATTER_FN_glVertexStream3svATI,
+    GLATTER_FN_glVertexStream4dATI,
+    GLATTER_FN_glVertexStream4dvATI,
+    GLATTER_FN_glVertexStream4fATI,
+    GLATTER_FN_glVertexStream4fvATI,
+    GLATTER_FN_glVertexStream4iATI,
+    GLATTER_FN_glVertexStream4ivATI,
+    GLATTER_FN_glVertexStream4sATI,
+    GLATTER_FN_glVertexStream4svATI,
+    GLATTER_FN_glVertexWeightPointerEXT,
+    GLATTER_FN_glVertexWeightfEXT,
+    GLATTER_FN_glVertexWeightfvEXT,
+    GLATTER_FN_glVertexWeighthNV,
+    GLATTER_FN_glVertexWeighthvNV,
+    GLATTER_FN_glVideoCaptureNV,
+    GLATTER_FN_glVideoCaptureStreamParameterdvNV,
+    GLATTER_FN_glVideoCaptureStreamParameterfvNV,
+    GLATTER_FN_glVideoCaptureStreamParameterivNV,
+    GLATTER_FN_glViewportArrayv,
+    GLATTER_FN_glViewportIndexedf,
+    GLATTER_FN_glViewportIndexedfv,
+    GLATTER_FN_glViewportPositionWScaleNV,
+    GLATTER_FN_glViewportSwizzleNV,
+    GLATTER_FN_glWaitSemaphoreEXT,
+    GLATTER_FN_glWaitSemaphoreui64NVX,
+    GLATTER_FN_glWaitVkSemaphoreNV,
+    GLATTER_FN_glWeightPathsNV,
+    GLATTER_FN_glWeightPointerARB,
+    GLATTER_FN_glWeightbvARB,
+    GLATTER_FN_glWeightdvARB,
+    GLATTER_FN_glWeightfvARB,
+    GLATTER_FN_glWeightivARB,
+    GLATTER_FN_glWeightsvARB,
+    GLATTER_FN_glWeightubvARB,
+    GLATTER_FN_glWeightuivARB,
+    GLATTER_FN_glWeightusvARB,
+    GLATTER_FN_glWindowPos2d,
+    GLATTER_FN_glWindowPos2dARB,
+    GLATTER_FN_glWindowPos2dMESA,
+    GLATTER_FN_glWindowPos2dv,
+    GLATTER_FN_glWindowPos2dvARB,
+    GLATTER_FN_glWindowPos2dvMESA,
+    GLATTER_FN_glWindowPos2f,
+    GLATTER_FN_glWindowPos2fARB,
+    GLATTER_FN_glWindowPos2fMESA,
+    GLATTER_FN_glWindowPos2fv,
+    GLATTER_FN_glWindowPos2fvARB,
+    GLATTER_FN_glWindowPos2fvMESA,
+    GLATTER_FN_glWindowPos2i,
+    GLATTER_FN_glWindowPos2iARB,
+    GLATTER_FN_glWindowPos2iMESA,
+    GLATTER_FN_glWindowPos2iv,
+    GLATTER_FN_glWindowPos2ivARB,
+    GLATTER_FN_glWindowPos2ivMESA,
+    GLATTER_FN_glWindowPos2s,
+    GLATTER_FN_glWindowPos2sARB,
+    GLATTER_FN_glWindowPos2sMESA,
+    GLATTER_FN_glWindowPos2sv,
+    GLATTER_FN_glWindowPos2svARB,
+    GLATTER_FN_glWindowPos2svMESA,
+    GLATTER_FN_glWindowPos3d,
+    GLATTER_FN_glWindowPos3dARB,
+    GLATTER_FN_glWindowPos3dMESA,
+    GLATTER_FN_glWindowPos3dv,
+    GLATTER_FN_glWindowPos3dvARB,
+    GLATTER_FN_glWindowPos3dvMESA,
+    GLATTER_FN_glWindowPos3f,
+    GLATTER_FN_glWindowPos3fARB,
+    GLATTER_FN_glWindowPos3fMESA,
+    GLATTER_FN_glWindowPos3fv,
+    GLATTER_FN_glWindowPos3fvARB,
+    GLATTER_FN_glWindowPos3fvMESA,
+    GLATTER_FN_glWindowPos3i,
+    GLATTER_FN_glWindowPos3iARB,
+    GLATTER_FN_glWindowPos3iMESA,
+    GLATTER_FN_glWindowPos3iv,
+    GLATTER_FN_glWindowPos3ivARB,
+    GLATTER_FN_glWindowPos3ivMESA,
+    GLATTER_FN_glWindowPos3s,
+    GLATTER_FN_glWindowPos3sARB,
+    GLATTER_FN_glWindowPos3sMESA,
+    GLATTER_FN_glWindowPos3sv,
+    GLATTER_FN_glWindowPos3svARB,
+    GLATTER_FN_glWindowPos3svMESA,
+    GLATTER_FN_glWindowPos4dMESA,
+    GLATTER_FN_glWindowPos4dvMESA,
+    GLATTER_FN_glWindowPos4fMESA,
+    GLATTER_FN_glWindowPos4fvMESA,
+    GLATTER_FN_glWindowPos4iMESA,
+    GLATTER_FN_glWindowPos4ivMESA,
+    GLATTER_FN_glWindowPos4sMESA,
+    GLATTER_FN_glWindowPos4svMESA,
+    GLATTER_FN_glWindowRectanglesEXT,
+    GLATTER_FN_glWriteMaskEXT,
+    GLATTER_FN_COUNT_GL
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_GL 0xe3effa58u
+
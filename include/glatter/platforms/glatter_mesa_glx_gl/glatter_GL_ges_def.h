@@ -27,1326 +27,1030 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#include <string.h> /* memcpy */
+/* ---- Extension name lookup (generated) ----
+ * Perfect hash over the GLATTER_EXT_* names of this family; see
+ * glatter_extension_index_ in glatter_def.h. */
+static const uint16_t glatter_ext_seeds_GL[512] = {
+    4, 0, 1, 3, 3, 1, 0, 1, 1, 0, 2, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 2, 1, 1, 0, 3, 1, 1, 4,
+    0, 0, 4, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0,
+    1, 4, 2, 1, 1, 0, 1, 1, 7, 1, 2, 2, 0, 1, 0, 1,
+    1, 1, 1, 2, 3, 1, 1, 0, 0, 1, 1, 2, 1, 2, 0, 1,
+    1, 2, 2, 3, 0, 2, 1, 1, 0, 1, 1, 2, 0, 0, 1, 0,
+    0, 2, 1, 1, 1, 1, 0, 1, 3, 2, 1, 2, 2, 0, 4, 1,
+    1, 2, 4, 1, 1, 1, 0, 1, 1, 2, 1, 1, 6, 3, 0, 1,
+    1, 2, 0, 1, 1, 1, 0, 0, 2, 1, 5, 1, 1, 0, 1, 1,
+    0, 6, 1, 1, 1, 1, 0, 0, 2, 1, 0, 2, 0, 1, 10, 2,
+    0, 0, 5, 3, 0, 1, 0, 1, 1, 0, 0, 1, 2, 2, 1, 3,
+    3, 0, 2, 2, 2, 0, 1, 0, 2, 3, 0, 0, 0, 2, 2, 1,
+    0, 0, 6, 0, 4, 1, 0, 0, 0, 1, 0, 1, 1, 2, 0, 1,
+    0, 1, 1, 0, 2, 1, 0, 6, 1, 0, 1, 1, 1, 1, 0, 3,
+    1, 4, 1, 1, 0, 0, 2, 0, 1, 1, 1, 4, 2, 0, 1, 3,
+    1, 0, 1, 3, 2, 3, 0, 1, 1, 1, 0, 1, 0, 2, 1, 1,
+    2, 0, 0, 0, 1, 2, 2, 0, 1, 0, 1, 5, 8, 4, 0, 2,
+    1, 0, 2, 1, 4, 1, 1, 0, 3, 0, 0, 2, 3, 0, 0, 1,
+    2, 1, 1, 0, 3, 1, 0, 1, 2, 1, 2, 3, 2, 1, 1, 0,
+    0, 1, 0, 0, 3, 2, 0, 1, 1, 5, 0, 1, 0, 1, 2, 5,
+    4, 6, 1, 0, 6, 6, 0, 1, 4, 1, 0, 2, 4, 1, 3, 0,
+    2, 0, 1, 0, 2, 0, 1, 2, 2, 11, 4, 2, 2, 3, 2, 1,
+    8, 1, 0, 1, 0, 4, 0, 2, 3, 2, 1, 3, 4, 0, 2, 1,
+    3, 2, 0, 0, 0, 2, 0, 1, 1, 2, 1, 0, 2, 3, 0, 0,
+    2, 0, 3, 1, 0, 2, 4, 1, 2, 1, 0, 0, 1, 1, 1, 4,
+    5, 2, 3, 1, 1, 0, 0, 3, 2, 3, 1, 1, 0, 5, 3, 5,
+    0, 2, 0, 1, 0, 1, 2, 3, 1, 3, 0, 0, 3, 2, 2, 0,
+    2, 2, 4, 2, 1, 0, 0, 3, 2, 1, 1, 1, 0, 0, 7, 2,
+    1, 0, 1, 2, 2, 1, 0, 4, 1, 3, 3, 1, 3, 1, 1, 0,
+    1, 0, 2, 3, 2, 0, 1, 2, 1, 0, 3, 5, 1, 7, 1, 1,
+    1, 0, 2, 1, 0, 0, 0, 1, 1, 1, 0, 6, 3, 1, 0, 0,
+    2, 0, 1, 1, 5, 2, 0, 4, 0, 0, 5, 3, 1, 1, 0, 1,
+};
 
-/* ---- Per-context, per-thread extension support cache (generated) ---- */
-#ifndef GLATTER_ES_CACHE_SLOTS
-#define GLATTER_ES_CACHE_SLOTS 8
-#endif
+static const uint16_t glatter_ext_slots_GL[1024] = {
+    65535, 65535, 183, 477, 303, 65535, 497, 65535, 615, 65535, 543, 65535, 131, 357, 161, 579,
+    14, 65535, 65535, 65535, 65535, 65535, 65535, 273, 230, 158, 65535, 281, 65535, 65535, 65535, 537,
+    221, 246, 65535, 240, 65535, 64, 65535, 65535, 396, 142, 65535, 583, 617, 31, 65535, 65535,
+    65535, 65535, 65535, 83, 331, 245, 333, 454, 65535, 380, 65535, 178, 401, 241, 363, 65535,
+    65535, 65535, 65535, 65535, 120, 414, 288, 335, 71, 65535, 137, 65535, 65535, 89, 500, 65535,
+    65535, 65535, 10, 50, 65535, 409, 584, 65535, 434, 65535, 175, 65535, 374, 597, 65535, 65535,
+    204, 65535, 356, 65535, 298, 199, 65535, 451, 65535, 65535, 588, 611, 65535, 556, 315, 65535,
+    111, 65535, 0, 65535, 318, 65535, 467, 65535, 309, 407, 413, 159, 124, 323, 65535, 438,
+    65535, 65535, 65535, 65535, 65535, 65535, 54, 113, 488, 65535, 65535, 453, 257, 74, 217, 558,
+    419, 65535, 51, 590, 411, 404, 65535, 501, 65535, 65535, 400, 65535, 310, 423, 616, 16,
+    418, 65535, 105, 223, 508, 75, 164, 65535, 65535, 65535, 65535, 491, 449, 65535, 354, 421,
+    585, 377, 236, 361, 568, 417, 534, 167, 483, 462, 307, 116, 65535, 346, 371, 238,
+    345, 471, 65535, 65535, 65535, 65535, 69, 613, 2, 65535, 65535, 46, 28, 109, 65535, 207,
+    65535, 510, 65535, 216, 489, 566, 133, 373, 65535, 65535, 65535, 52, 32, 65535, 93, 445,
+    279, 65535, 446, 65535, 614, 65535, 65535, 65535, 220, 299, 286, 65535, 342, 524, 350, 581,
+    149, 381, 532, 234, 65535, 65535, 65535, 65535, 560, 65535, 202, 469, 252, 366, 65535, 26,
+    235, 506, 65535, 468, 65535, 127, 65535, 73, 461, 65535, 65535, 65535, 65535, 65535, 99, 203,
+    65535, 65535, 65535, 65535, 200, 301, 598, 433, 244, 325, 65535, 485, 65535, 170, 295, 619,
+    321, 49, 65535, 65535, 577, 494, 138, 7, 290, 140, 165, 76, 261, 65535, 65535, 591,
+    65535, 322, 98, 493, 160, 444, 447, 320, 456, 65535, 148, 65535, 27, 65535, 247, 63,
+    65535, 65535, 586, 65535, 65535, 441, 270, 65535, 353, 65535, 162, 65535, 119, 65535, 192, 65535,
+    65535, 65535, 391, 65535, 45, 269, 186, 65535, 511, 502, 358, 65535, 65535, 355, 65535, 8,
+    402, 193, 352, 195, 311, 154, 503, 65535, 530, 480, 420, 4, 513, 65535, 65535, 65535,
+    458, 65535, 490, 384, 156, 65535, 552, 227, 476, 19, 387, 520, 589, 65535, 145, 65535,
+    208, 291, 30, 463, 360, 65535, 606, 565, 283, 123, 65535, 72, 65535, 65535, 514, 65535,
+    65535, 65535, 65535, 65535, 435, 499, 265, 512, 254, 85, 504, 259, 592, 65535, 65535, 153,
+    198, 65535, 65535, 177, 65535, 65535, 430, 65535, 176, 135, 147, 428, 427, 580, 284, 65535,
+    351, 65535, 272, 403, 293, 618, 181, 65535, 399, 65535, 408, 180, 65535, 157, 55, 65535,
+    196, 470, 65535, 65535, 398, 95, 65535, 297, 536, 61, 155, 334, 122, 601, 394, 65535,
+    549, 103, 65535, 65535, 201, 65535, 271, 523, 330, 65535, 336, 260, 65535, 65535, 555, 86,
+    189, 65535, 101, 94, 495, 432, 348, 460, 65535, 251, 108, 266, 188, 475, 375, 65535,
+    152, 36, 253, 280, 242, 595, 487, 139, 194, 65535, 82, 130, 65535, 575, 65535, 197,
+    65535, 305, 65535, 65535, 65535, 410, 1, 65535, 422, 302, 20, 87, 5, 452, 65535, 389,
+    65535, 65535, 65535, 65535, 65535, 168, 65535, 65535, 312, 65535, 519, 65535, 405, 65535, 65535, 57,
+    65535, 587, 65535, 205, 65535, 91, 386, 65535, 65535, 317, 84, 65535, 65535, 169, 34, 275,
+    459, 406, 224, 65535, 573, 594, 88, 65535, 65535, 65535, 563, 65535, 439, 390, 65535, 12,
+    474, 65535, 507, 429, 97, 498, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 29, 239,
+    65535, 541, 65535, 274, 65535, 65535, 65535, 65535, 554, 243, 65535, 440, 608, 65535, 526, 492,
+    214, 313, 38, 65535, 65535, 65535, 90, 65535, 65535, 65535, 255, 65535, 561, 65535, 65535, 92,
+    316, 268, 65535, 65535, 65535, 466, 65535, 65535, 65535, 65535, 65535, 33, 450, 538, 66, 574,
+    328, 65535, 229, 65535, 276, 443, 388, 39, 65535, 533, 65535, 308, 65535, 343, 118, 65535,
+    102, 22, 282, 65, 77, 125, 65535, 65535, 457, 173, 542, 478, 599, 65535, 65535, 15,
+    65535, 25, 6, 515, 65535, 65535, 65535, 65535, 571, 296, 412, 65535, 603, 65535, 65535, 300,
+    517, 65535, 442, 65535, 65535, 106, 65535, 65535, 65535, 486, 65535, 65535, 65535, 256, 559, 546,
+    65535, 436, 347, 426, 233, 522, 65535, 65535, 206, 518, 163, 395, 378, 44, 65535, 172,
+    535, 79, 65535, 65535, 415, 249, 96, 362, 65535, 248, 65535, 65535, 610, 65535, 65535, 264,
+    65535, 65535, 540, 379, 56, 621, 184, 232, 340, 65535, 65535, 65535, 484, 65535, 267, 569,
+    65535, 65535, 185, 306, 529, 473, 9, 21, 344, 304, 607, 416, 65535, 465, 117, 62,
+    24, 332, 65535, 545, 218, 65535, 115, 67, 593, 65535, 65535, 65535, 367, 225, 132, 65535,
+    65535, 65535, 287, 65535, 505, 112, 329, 516, 65535, 65535, 65535, 65535, 278, 65535, 65535, 65535,
+    70, 464, 65535, 359, 544, 527, 65535, 212, 65535, 372, 114, 370, 58, 65535, 365, 562,
+    376, 60, 190, 65535, 65535, 65535, 65535, 582, 65535, 110, 78, 65535, 65535, 65535, 65535, 65535,
+    263, 65535, 65535, 604, 211, 548, 17, 65535, 324, 182, 294, 455, 65535, 437, 364, 65535,
+    65535, 53, 319, 250, 47, 171, 65535, 285, 622, 65535, 289, 521, 65535, 65535, 65535, 65535,
+    210, 262, 209, 602, 65535, 612, 65535, 121, 65535, 482, 65535, 65535, 326, 557, 59, 222,
+    215, 65535, 136, 128, 65535, 150, 65535, 349, 65535, 531, 65535, 65535, 338, 337, 65535, 104,
+    166, 431, 80, 539, 65535, 65535, 550, 479, 65535, 213, 65535, 65535, 11, 567, 43, 424,
+    65535, 65535, 13, 397, 605, 277, 448, 65535, 620, 65535, 226, 65535, 228, 327, 141, 231,
+    339, 65535, 65535, 65535, 65535, 393, 191, 496, 219, 369, 65535, 144, 100, 65535, 65535, 525,
+    65535, 65535, 65535, 553, 65535, 65535, 40, 65535, 187, 126, 385, 143, 65535, 65535, 368, 65535,
+    35, 237, 68, 572, 551, 547, 134, 472, 65535, 65535, 179, 37, 3, 65535, 65535, 65535,
+    65535, 314, 576, 107, 600, 65535, 18, 65535, 81, 425, 382, 129, 596, 146, 623, 609,
+    65535, 528, 151, 578, 65535, 509, 564, 65535, 174, 392, 65535, 65535, 481, 292, 383, 258,
+    65535, 65535, 48, 65535, 570, 41, 65535, 65535, 65535, 65535, 23, 341, 65535, 65535, 42, 65535,
+};
 
-typedef struct {
-    uintptr_t key; /* context key from glatter_current_gl_context_key_() */
-    glatter_extension_support_status_GL_t ess;
-} glatter_es_cache_entry_GL_t;
+static const uint16_t glatter_ext_name_offsets_GL[GLATTER_EXT_COUNT_GL] = {
+    0, 20, 36, 69, 96, 122, 142, 170, 196, 236, 272, 290,
+    319, 343, 367, 395, 422, 445, 474, 501, 522, 549, 573, 609,
+    642, 663, 703, 745, 780, 809, 838, 860, 894, 925, 949, 992,
+    1019, 1046, 1079, 1115, 1142, 1166, 1189, 1204, 1226, 1254, 1280, 1297,
+    1316, 1341, 1364, 1388, 1417, 1445, 1480, 1499, 1524, 1551, 1578, 1603,
+    1627, 1648, 1672, 1699, 1721, 1737, 1764, 1785, 1805, 1831, 1852, 1892,
+    1914, 1949, 1984, 2010, 2029, 2047, 2068, 2088, 2114, 2133, 2154, 2180,
+    2207, 2227, 2253, 2286, 2307, 2329, 2353, 2385, 2418, 2452, 2483, 2507,
+    2538, 2561, 2594, 2628, 2654, 2678, 2702, 2728, 2757, 2773, 2792, 2815,
+    2839, 2863, 2888, 2903, 2930, 2954, 2982, 3011, 3037, 3065, 3089, 3111,
+    3129, 3156, 3175, 3195, 3218, 3242, 3273, 3306, 3333, 3357, 3377, 3405,
+    3432, 3463, 3487, 3514, 3551, 3569, 3597, 3621, 3643, 3666, 3691, 3727,
+    3758, 3791, 3821, 3842, 3869, 3889, 3919, 3944, 3975, 4000, 4022, 4046,
+    4075, 4111, 4136, 4172, 4198, 4233, 4261, 4293, 4325, 4357, 4371, 4393,
+    4414, 4436, 4459, 4487, 4511, 4536, 4548, 4575, 4598, 4626, 4655, 4690,
+    4718, 4745, 4777, 4809, 4833, 4863, 4886, 4913, 4941, 4965, 4999, 5028,
+    5049, 5071, 5107, 5138, 5165, 5197, 5225, 5250, 5275, 5293, 5319, 5343,
+    5366, 5401, 5424, 5444, 5463, 5490, 5517, 5553, 5594, 5618, 5647, 5672,
+    5699, 5726, 5755, 5775, 5803, 5825, 5846, 5881, 5915, 5937, 5955, 5986,
+    6006, 6027, 6049, 6072, 6097, 6112, 6138, 6158, 6182, 6210, 6238, 6259,
+    6286, 6313, 6347, 6369, 6387, 6412, 6428, 6440, 6452, 6476, 6495, 6526,
+    6553, 6575, 6595, 6617, 6641, 6654, 6676, 6705, 6724, 6748, 6768, 6787,
+    6806, 6826, 6851, 6878, 6899, 6921, 6948, 6971, 6988, 7017, 7041, 7072,
+    7103, 7146, 7172, 7196, 7220, 7250, 7269, 7286, 7313, 7331, 7353, 7374,
+    7395, 7416, 7440, 7467, 7486, 7508, 7533, 7552, 7598, 7635, 7664, 7692,
+    7712, 7733, 7757, 7784, 7807, 7842, 7866, 7888, 7916, 7943, 7967, 7993,
+    8015, 8038, 8055, 8075, 8098, 8129, 8160, 8192, 8237, 8272, 8303, 8329,
+    8361, 8381, 8411, 8434, 8459, 8483, 8503, 8521, 8536, 8553, 8574, 8603,
+    8635, 8667, 8699, 8723, 8746, 8773, 8797, 8831, 8860, 8883, 8907, 8935,
+    8957, 8987, 9007, 9030, 9054, 9081, 9107, 9138, 9159, 9182, 9205, 9224,
+    9250, 9270, 9295, 9322, 9343, 9367, 9392, 9417, 9440, 9468, 9493, 9524,
+    9546, 9567, 9590, 9609, 9638, 9660, 9679, 9710, 9736, 9764, 9784, 9807,
+    9833, 9869, 9903, 9929, 9950, 9975, 10002, 10033, 10073, 10102, 10115, 10131,
+    10162, 10199, 10217, 10240, 10276, 10312, 10354, 10377, 10404, 10431, 10459, 10479,
+    10508, 10539, 10562, 10595, 10627, 10653, 10672, 10694, 10744, 10770, 10793, 10815,
+    10843, 10865, 10904, 10939, 10980, 11003, 11033, 11072, 11098, 11117, 11144, 11163,
+    11186, 11219, 11244, 11270, 11303, 11338, 11383, 11425, 11451, 11468, 11489, 11514,
+    11532, 11551, 11575, 11592, 11619, 11631, 11652, 11671, 11690, 11723, 11746, 11770,
+    11794, 11824, 11858, 11890, 11922, 11961, 11985, 12008, 12042, 12062, 12081, 12100,
+    12132, 12150, 12167, 12201, 12226, 12250, 12277, 12295, 12322, 12352, 12374, 12401,
+    12431, 12462, 12483, 12516, 12539, 12558, 12578, 12602, 12631, 12652, 12677, 12702,
+    12728, 12763, 12799, 12822, 12858, 12882, 12911, 12937, 12965, 12997, 13023, 13048,
+    13074, 13109, 13143, 13174, 13200, 13228, 13253, 13281, 13309, 13329, 13353, 13375,
+    13405, 13432, 13460, 13486, 13510, 13545, 13566, 13588, 13610, 13635, 13660, 13686,
+    13721, 13757, 13777, 13798, 13823, 13849, 13883, 13918, 13939, 13963, 13985, 14014,
+    14036, 14058, 14078, 14100, 14123, 14147, 14182, 14201, 14221, 14240, 14264, 14281,
+    14297, 14314, 14331, 14349, 14367, 14387, 14414, 14425, 14448, 14469, 14493, 14513,
+    14535, 14561, 14586, 14610, 14628, 14657, 14684, 14711, 14735, 14755, 14778, 14792,
+    14816, 14836, 14863, 14893, 14909, 14938, 14968, 14990, 15011, 15030, 15056, 15074,
+    15098, 15118, 15136, 15159, 15181, 15203, 15223, 15246, 15270, 15287, 15310, 15325,
+    15348, 15363, 15381, 15407, 15431, 15464, 15489, 15518, 15545, 15568, 15582, 15606,
+    15621, 15641, 15660, 15687, 15709, 15741, 15761, 15779, 15798, 15819, 15833, 15854,
+};
 
-static GLATTER_THREAD_LOCAL glatter_es_cache_entry_GL_t
-    glatter_es_cache_GL[GLATTER_ES_CACHE_SLOTS];
+static const char glatter_ext_names_GL[] =
+    "GL_3DFX_multisample\0"
+    "GL_3DFX_tbuffer\0"
+    "GL_3DFX_texture_compression_FXT1\0"
+    "GL_AMD_blend_minmax_factor\0"
+    "GL_AMD_conservative_depth\0"
+    "GL_AMD_debug_output\0"
+    "GL_AMD_depth_clamp_separate\0"
+    "GL_AMD_draw_buffers_blend\0"
+    "GL_AMD_framebuffer_multisample_advanced\0"
+    "GL_AMD_framebuffer_sample_positions\0"
+    "GL_AMD_gcn_shader\0"
+    "GL_AMD_gpu_shader_half_float\0"
+    "GL_AMD_gpu_shader_int16\0"
+    "GL_AMD_gpu_shader_int64\0"
+    "GL_AMD_interleaved_elements\0"
+    "GL_AMD_multi_draw_indirect\0"
+    "GL_AMD_name_gen_delete\0"
+    "GL_AMD_occlusion_query_event\0"
+    "GL_AMD_performance_monitor\0"
+    "GL_AMD_pinned_memory\0"
+    "GL_AMD_query_buffer_object\0"
+    "GL_AMD_sample_positions\0"
+    "GL_AMD_seamless_cubemap_per_texture\0"
+    "GL_AMD_shader_atomic_counter_ops\0"
+    "GL_AMD_shader_ballot\0"
+    "GL_AMD_shader_explicit_vertex_parameter\0"
+    "GL_AMD_shader_gpu_shader_half_float_fetch\0"
+    "GL_AMD_shader_image_load_store_lod\0"
+    "GL_AMD_shader_stencil_export\0"
+    "GL_AMD_shader_trinary_minmax\0"
+    "GL_AMD_sparse_texture\0"
+    "GL_AMD_stencil_operation_extended\0"
+    "GL_AMD_texture_gather_bias_lod\0"
+    "GL_AMD_texture_texture4\0"
+    "GL_AMD_transform_feedback3_lines_triangles\0"
+    "GL_AMD_transform_feedback4\0"
+    "GL_AMD_vertex_shader_layer\0"
+    "GL_AMD_vertex_shader_tessellator\0"
+    "GL_AMD_vertex_shader_viewport_index\0"
+    "GL_APPLE_aux_depth_stencil\0"
+    "GL_APPLE_client_storage\0"
+    "GL_APPLE_element_array\0"
+    "GL_APPLE_fence\0"
+    "GL_APPLE_float_pixels\0"
+    "GL_APPLE_flush_buffer_range\0"
+    "GL_APPLE_object_purgeable\0"
+    "GL_APPLE_rgb_422\0"
+    "GL_APPLE_row_bytes\0"
+    "GL_APPLE_specular_vector\0"
+    "GL_APPLE_texture_range\0"
+    "GL_APPLE_transform_hint\0"
+    "GL_APPLE_vertex_array_object\0"
+    "GL_APPLE_vertex_array_range\0"
+    "GL_APPLE_vertex_program_evaluators\0"
+    "GL_APPLE_ycbcr_422\0"
+    "GL_ARB_ES2_compatibility\0"
+    "GL_ARB_ES3_1_compatibility\0"
+    "GL_ARB_ES3_2_compatibility\0"
+    "GL_ARB_ES3_compatibility\0"
+    "GL_ARB_arrays_of_arrays\0"
+    "GL_ARB_base_instance\0"
+    "GL_ARB_bindless_texture\0"
+    "GL_ARB_blend_func_extended\0"
+    "GL_ARB_buffer_storage\0"
+    "GL_ARB_cl_event\0"
+    "GL_ARB_clear_buffer_object\0"
+    "GL_ARB_clear_texture\0"
+    "GL_ARB_clip_control\0"
+    "GL_ARB_color_buffer_float\0"
+    "GL_ARB_compatibility\0"
+    "GL_ARB_compressed_texture_pixel_storage\0"
+    "GL_ARB_compute_shader\0"
+    "GL_ARB_compute_variable_group_size\0"
+    "GL_ARB_conditional_render_inverted\0"
+    "GL_ARB_conservative_depth\0"
+    "GL_ARB_copy_buffer\0"
+    "GL_ARB_copy_image\0"
+    "GL_ARB_cull_distance\0"
+    "GL_ARB_debug_output\0"
+    "GL_ARB_depth_buffer_float\0"
+    "GL_ARB_depth_clamp\0"
+    "GL_ARB_depth_texture\0"
+    "GL_ARB_derivative_control\0"
+    "GL_ARB_direct_state_access\0"
+    "GL_ARB_draw_buffers\0"
+    "GL_ARB_draw_buffers_blend\0"
+    "GL_ARB_draw_elements_base_vertex\0"
+    "GL_ARB_draw_indirect\0"
+    "GL_ARB_draw_instanced\0"
+    "GL_ARB_enhanced_layouts\0"
+    "GL_ARB_explicit_attrib_location\0"
+    "GL_ARB_explicit_uniform_location\0"
+    "GL_ARB_fragment_coord_conventions\0"
+    "GL_ARB_fragment_layer_viewport\0"
+    "GL_ARB_fragment_program\0"
+    "GL_ARB_fragment_program_shadow\0"
+    "GL_ARB_fragment_shader\0"
+    "GL_ARB_fragment_shader_interlock\0"
+    "GL_ARB_framebuffer_no_attachments\0"
+    "GL_ARB_framebuffer_object\0"
+    "GL_ARB_framebuffer_sRGB\0"
+    "GL_ARB_geometry_shader4\0"
+    "GL_ARB_get_program_binary\0"
+    "GL_ARB_get_texture_sub_image\0"
+    "GL_ARB_gl_spirv\0"
+    "GL_ARB_gpu_shader5\0"
+    "GL_ARB_gpu_shader_fp64\0"
+    "GL_ARB_gpu_shader_int64\0"
+    "GL_ARB_half_float_pixel\0"
+    "GL_ARB_half_float_vertex\0"
+    "GL_ARB_imaging\0"
+    "GL_ARB_indirect_parameters\0"
+    "GL_ARB_instanced_arrays\0"
+    "GL_ARB_internalformat_query\0"
+    "GL_ARB_internalformat_query2\0"
+    "GL_ARB_invalidate_subdata\0"
+    "GL_ARB_map_buffer_alignment\0"
+    "GL_ARB_map_buffer_range\0"
+    "GL_ARB_matrix_palette\0"
+    "GL_ARB_multi_bind\0"
+    "GL_ARB_multi_draw_indirect\0"
+    "GL_ARB_multisample\0"
+    "GL_ARB_multitexture\0"
+    "GL_ARB_occlusion_query\0"
+    "GL_ARB_occlusion_query2\0"
+    "GL_ARB_parallel_shader_compile\0"
+    "GL_ARB_pipeline_statistics_query\0"
+    "GL_ARB_pixel_buffer_object\0"
+    "GL_ARB_point_parameters\0"
+    "GL_ARB_point_sprite\0"
+    "GL_ARB_polygon_offset_clamp\0"
+    "GL_ARB_post_depth_coverage\0"
+    "GL_ARB_program_interface_query\0"
+    "GL_ARB_provoking_vertex\0"
+    "GL_ARB_query_buffer_object\0"
+    "GL_ARB_robust_buffer_access_behavior\0"
+    "GL_ARB_robustness\0"
+    "GL_ARB_robustness_isolation\0"
+    "GL_ARB_sample_locations\0"
+    "GL_ARB_sample_shading\0"
+    "GL_ARB_sampler_objects\0"
+    "GL_ARB_seamless_cube_map\0"
+    "GL_ARB_seamless_cubemap_per_texture\0"
+    "GL_ARB_separate_shader_objects\0"
+    "GL_ARB_shader_atomic_counter_ops\0"
+    "GL_ARB_shader_atomic_counters\0"
+    "GL_ARB_shader_ballot\0"
+    "GL_ARB_shader_bit_encoding\0"
+    "GL_ARB_shader_clock\0"
+    "GL_ARB_shader_draw_parameters\0"
+    "GL_ARB_shader_group_vote\0"
+    "GL_ARB_shader_image_load_store\0"
+    "GL_ARB_shader_image_size\0"
+    "GL_ARB_shader_objects\0"
+    "GL_ARB_shader_precision\0"
+    "GL_ARB_shader_stencil_export\0"
+    "GL_ARB_shader_storage_buffer_object\0"
+    "GL_ARB_shader_subroutine\0"
+    "GL_ARB_shader_texture_image_samples\0"
+    "GL_ARB_shader_texture_lod\0"
+    "GL_ARB_shader_viewport_layer_array\0"
+    "GL_ARB_shading_language_100\0"
+    "GL_ARB_shading_language_420pack\0"
+    "GL_ARB_shading_language_include\0"
+    "GL_ARB_shading_language_packing\0"
+    "GL_ARB_shadow\0"
+    "GL_ARB_shadow_ambient\0"
+    "GL_ARB_sparse_buffer\0"
+    "GL_ARB_sparse_texture\0"
+    "GL_ARB_sparse_texture2\0"
+    "GL_ARB_sparse_texture_clamp\0"
+    "GL_ARB_spirv_extensions\0"
+    "GL_ARB_stencil_texturing\0"
+    "GL_ARB_sync\0"
+    "GL_ARB_tessellation_shader\0"
+    "GL_ARB_texture_barrier\0"
+    "GL_ARB_texture_border_clamp\0"
+    "GL_ARB_texture_buffer_object\0"
+    "GL_ARB_texture_buffer_object_rgb32\0"
+    "GL_ARB_texture_buffer_range\0"
+    "GL_ARB_texture_compression\0"
+    "GL_ARB_texture_compression_bptc\0"
+    "GL_ARB_texture_compression_rgtc\0"
+    "GL_ARB_texture_cube_map\0"
+    "GL_ARB_texture_cube_map_array\0"
+    "GL_ARB_texture_env_add\0"
+    "GL_ARB_texture_env_combine\0"
+    "GL_ARB_texture_env_crossbar\0"
+    "GL_ARB_texture_env_dot3\0"
+    "GL_ARB_texture_filter_anisotropic\0"
+    "GL_ARB_texture_filter_minmax\0"
+    "GL_ARB_texture_float\0"
+    "GL_ARB_texture_gather\0"
+    "GL_ARB_texture_mirror_clamp_to_edge\0"
+    "GL_ARB_texture_mirrored_repeat\0"
+    "GL_ARB_texture_multisample\0"
+    "GL_ARB_texture_non_power_of_two\0"
+    "GL_ARB_texture_query_levels\0"
+    "GL_ARB_texture_query_lod\0"
+    "GL_ARB_texture_rectangle\0"
+    "GL_ARB_texture_rg\0"
+    "GL_ARB_texture_rgb10_a2ui\0"
+    "GL_ARB_texture_stencil8\0"
+    "GL_ARB_texture_storage\0"
+    "GL_ARB_texture_storage_multisample\0"
+    "GL_ARB_texture_swizzle\0"
+    "GL_ARB_texture_view\0"
+    "GL_ARB_timer_query\0"
+    "GL_ARB_transform_feedback2\0"
+    "GL_ARB_transform_feedback3\0"
+    "GL_ARB_transform_feedback_instanced\0"
+    "GL_ARB_transform_feedback_overflow_query\0"
+    "GL_ARB_transpose_matrix\0"
+    "GL_ARB_uniform_buffer_object\0"
+    "GL_ARB_vertex_array_bgra\0"
+    "GL_ARB_vertex_array_object\0"
+    "GL_ARB_vertex_attrib_64bit\0"
+    "GL_ARB_vertex_attrib_binding\0"
+    "GL_ARB_vertex_blend\0"
+    "GL_ARB_vertex_buffer_object\0"
+    "GL_ARB_vertex_program\0"
+    "GL_ARB_vertex_shader\0"
+    "GL_ARB_vertex_type_10f_11f_11f_rev\0"
+    "GL_ARB_vertex_type_2_10_10_10_rev\0"
+    "GL_ARB_viewport_array\0"
+    "GL_ARB_window_pos\0"
+    "GL_ATI_blend_equation_separate\0"
+    "GL_ATI_draw_buffers\0"
+    "GL_ATI_element_array\0"
+    "GL_ATI_envmap_bumpmap\0"
+    "GL_ATI_fragment_shader\0"
+    "GL_ATI_map_object_buffer\0"
+    "GL_ATI_meminfo\0"
+    "GL_ATI_pixel_format_float\0"
+    "GL_ATI_pn_triangles\0"
+    "GL_ATI_separate_stencil\0"
+    "GL_ATI_text_fragment_shader\0"
+    "GL_ATI_texture_env_combine3\0"
+    "GL_ATI_texture_float\0"
+    "GL_ATI_texture_mirror_once\0"
+    "GL_ATI_vertex_array_object\0"
+    "GL_ATI_vertex_attrib_array_object\0"
+    "GL_ATI_vertex_streams\0"
+    "GL_EXT_422_pixels\0"
+    "GL_EXT_EGL_image_storage\0"
+    "GL_EXT_EGL_sync\0"
+    "GL_EXT_abgr\0"
+    "GL_EXT_bgra\0"
+    "GL_EXT_bindable_uniform\0"
+    "GL_EXT_blend_color\0"
+    "GL_EXT_blend_equation_separate\0"
+    "GL_EXT_blend_func_separate\0"
+    "GL_EXT_blend_logic_op\0"
+    "GL_EXT_blend_minmax\0"
+    "GL_EXT_blend_subtract\0"
+    "GL_EXT_clip_volume_hint\0"
+    "GL_EXT_cmyka\0"
+    "GL_EXT_color_subtable\0"
+    "GL_EXT_compiled_vertex_array\0"
+    "GL_EXT_convolution\0"
+    "GL_EXT_coordinate_frame\0"
+    "GL_EXT_copy_texture\0"
+    "GL_EXT_cull_vertex\0"
+    "GL_EXT_debug_label\0"
+    "GL_EXT_debug_marker\0"
+    "GL_EXT_depth_bounds_test\0"
+    "GL_EXT_direct_state_access\0"
+    "GL_EXT_draw_buffers2\0"
+    "GL_EXT_draw_instanced\0"
+    "GL_EXT_draw_range_elements\0"
+    "GL_EXT_external_buffer\0"
+    "GL_EXT_fog_coord\0"
+    "GL_EXT_fragment_shading_rate\0"
+    "GL_EXT_framebuffer_blit\0"
+    "GL_EXT_framebuffer_blit_layers\0"
+    "GL_EXT_framebuffer_multisample\0"
+    "GL_EXT_framebuffer_multisample_blit_scaled\0"
+    "GL_EXT_framebuffer_object\0"
+    "GL_EXT_framebuffer_sRGB\0"
+    "GL_EXT_geometry_shader4\0"
+    "GL_EXT_gpu_program_parameters\0"
+    "GL_EXT_gpu_shader4\0"
+    "GL_EXT_histogram\0"
+    "GL_EXT_index_array_formats\0"
+    "GL_EXT_index_func\0"
+    "GL_EXT_index_material\0"
+    "GL_EXT_index_texture\0"
+    "GL_EXT_light_texture\0"
+    "GL_EXT_memory_object\0"
+    "GL_EXT_memory_object_fd\0"
+    "GL_EXT_memory_object_win32\0"
+    "GL_EXT_mesh_shader\0"
+    "GL_EXT_misc_attribute\0"
+    "GL_EXT_multi_draw_arrays\0"
+    "GL_EXT_multisample\0"
+    "GL_EXT_multiview_tessellation_geometry_shader\0"
+    "GL_EXT_multiview_texture_multisample\0"
+    "GL_EXT_multiview_timer_query\0"
+    "GL_EXT_packed_depth_stencil\0"
+    "GL_EXT_packed_float\0"
+    "GL_EXT_packed_pixels\0"
+    "GL_EXT_paletted_texture\0"
+    "GL_EXT_pixel_buffer_object\0"
+    "GL_EXT_pixel_transform\0"
+    "GL_EXT_pixel_transform_color_table\0"
+    "GL_EXT_point_parameters\0"
+    "GL_EXT_polygon_offset\0"
+    "GL_EXT_polygon_offset_clamp\0"
+    "GL_EXT_post_depth_coverage\0"
+    "GL_EXT_provoking_vertex\0"
+    "GL_EXT_raster_multisample\0"
+    "GL_EXT_rescale_normal\0"
+    "GL_EXT_secondary_color\0"
+    "GL_EXT_semaphore\0"
+    "GL_EXT_semaphore_fd\0"
+    "GL_EXT_semaphore_win32\0"
+    "GL_EXT_separate_shader_objects\0"
+    "GL_EXT_separate_specular_color\0"
+    "GL_EXT_shader_framebuffer_fetch\0"
+    "GL_EXT_shader_framebuffer_fetch_non_coherent\0"
+    "GL_EXT_shader_image_load_formatted\0"
+    "GL_EXT_shader_image_load_store\0"
+    "GL_EXT_shader_integer_mix\0"
+    "GL_EXT_shader_samples_identical\0"
+    "GL_EXT_shadow_funcs\0"
+    "GL_EXT_shared_texture_palette\0"
+    "GL_EXT_sparse_texture2\0"
+    "GL_EXT_stencil_clear_tag\0"
+    "GL_EXT_stencil_two_side\0"
+    "GL_EXT_stencil_wrap\0"
+    "GL_EXT_subtexture\0"
+    "GL_EXT_texture\0"
+    "GL_EXT_texture3D\0"
+    "GL_EXT_texture_array\0"
+    "GL_EXT_texture_buffer_object\0"
+    "GL_EXT_texture_compression_latc\0"
+    "GL_EXT_texture_compression_rgtc\0"
+    "GL_EXT_texture_compression_s3tc\0"
+    "GL_EXT_texture_cube_map\0"
+    "GL_EXT_texture_env_add\0"
+    "GL_EXT_texture_env_combine\0"
+    "GL_EXT_texture_env_dot3\0"
+    "GL_EXT_texture_filter_anisotropic\0"
+    "GL_EXT_texture_filter_minmax\0"
+    "GL_EXT_texture_integer\0"
+    "GL_EXT_texture_lod_bias\0"
+    "GL_EXT_texture_mirror_clamp\0"
+    "GL_EXT_texture_object\0"
+    "GL_EXT_texture_perturb_normal\0"
+    "GL_EXT_texture_sRGB\0"
+    "GL_EXT_texture_sRGB_R8\0"
+    "GL_EXT_texture_sRGB_RG8\0"
+    "GL_EXT_texture_sRGB_decode\0"
+    "GL_EXT_texture_shadow_lod\0"
+    "GL_EXT_texture_shared_exponent\0"
+    "GL_EXT_texture_snorm\0"
+    "GL_EXT_texture_storage\0"
+    "GL_EXT_texture_swizzle\0"
+    "GL_EXT_timer_query\0"
+    "GL_EXT_transform_feedback\0"
+    "GL_EXT_vertex_array\0"
+    "GL_EXT_vertex_array_bgra\0"
+    "GL_EXT_vertex_attrib_64bit\0"
+    "GL_EXT_vertex_shader\0"
+    "GL_EXT_vertex_weighting\0"
+    "GL_EXT_win32_keyed_mutex\0"
+    "GL_EXT_window_rectangles\0"
+    "GL_EXT_x11_sync_object\0"
+    "GL_GREMEDY_frame_terminator\0"
+    "GL_GREMEDY_string_marker\0"
+    "GL_HP_convolution_border_modes\0"
+    "GL_HP_image_transform\0"
+    "GL_HP_occlusion_test\0"
+    "GL_HP_texture_lighting\0"
+    "GL_IBM_cull_vertex\0"
+    "GL_IBM_multimode_draw_arrays\0"
+    "GL_IBM_rasterpos_clip\0"
+    "GL_IBM_static_data\0"
+    "GL_IBM_texture_mirrored_repeat\0"
+    "GL_IBM_vertex_array_lists\0"
+    "GL_INGR_blend_func_separate\0"
+    "GL_INGR_color_clamp\0"
+    "GL_INGR_interlace_read\0"
+    "GL_INTEL_blackhole_render\0"
+    "GL_INTEL_conservative_rasterization\0"
+    "GL_INTEL_fragment_shader_ordering\0"
+    "GL_INTEL_framebuffer_CMAA\0"
+    "GL_INTEL_map_texture\0"
+    "GL_INTEL_parallel_arrays\0"
+    "GL_INTEL_performance_query\0"
+    "GL_KHR_blend_equation_advanced\0"
+    "GL_KHR_blend_equation_advanced_coherent\0"
+    "GL_KHR_context_flush_control\0"
+    "GL_KHR_debug\0"
+    "GL_KHR_no_error\0"
+    "GL_KHR_parallel_shader_compile\0"
+    "GL_KHR_robust_buffer_access_behavior\0"
+    "GL_KHR_robustness\0"
+    "GL_KHR_shader_subgroup\0"
+    "GL_KHR_texture_compression_astc_hdr\0"
+    "GL_KHR_texture_compression_astc_ldr\0"
+    "GL_KHR_texture_compression_astc_sliced_3d\0"
+    "GL_MESAX_texture_stack\0"
+    "GL_MESA_framebuffer_flip_x\0"
+    "GL_MESA_framebuffer_flip_y\0"
+    "GL_MESA_framebuffer_swap_xy\0"
+    "GL_MESA_pack_invert\0"
+    "GL_MESA_packed_depth_stencil\0"
+    "GL_MESA_program_binary_formats\0"
+    "GL_MESA_resize_buffers\0"
+    "GL_MESA_shader_integer_functions\0"
+    "GL_MESA_texture_const_bandwidth\0"
+    "GL_MESA_tile_raster_order\0"
+    "GL_MESA_window_pos\0"
+    "GL_MESA_ycbcr_texture\0"
+    "GL_NVX_blend_equation_advanced_multi_draw_buffers\0"
+    "GL_NVX_conditional_render\0"
+    "GL_NVX_gpu_memory_info\0"
+    "GL_NVX_gpu_multicast2\0"
+    "GL_NVX_linked_gpu_multicast\0"
+    "GL_NVX_progress_fence\0"
+    "GL_NV_alpha_to_coverage_dither_control\0"
+    "GL_NV_bindless_multi_draw_indirect\0"
+    "GL_NV_bindless_multi_draw_indirect_count\0"
+    "GL_NV_bindless_texture\0"
+    "GL_NV_blend_equation_advanced\0"
+    "GL_NV_blend_equation_advanced_coherent\0"
+    "GL_NV_blend_minmax_factor\0"
+    "GL_NV_blend_square\0"
+    "GL_NV_clip_space_w_scaling\0"
+    "GL_NV_command_list\0"
+    "GL_NV_compute_program5\0"
+    "GL_NV_compute_shader_derivatives\0"
+    "GL_NV_conditional_render\0"
+    "GL_NV_conservative_raster\0"
+    "GL_NV_conservative_raster_dilate\0"
+    "GL_NV_conservative_raster_pre_snap\0"
+    "GL_NV_conservative_raster_pre_snap_triangles\0"
+    "GL_NV_conservative_raster_underestimation\0"
+    "GL_NV_copy_depth_to_color\0"
+    "GL_NV_copy_image\0"
+    "GL_NV_deep_texture3D\0"
+    "GL_NV_depth_buffer_float\0"
+    "GL_NV_depth_clamp\0"
+    "GL_NV_draw_texture\0"
+    "GL_NV_draw_vulkan_image\0"
+    "GL_NV_evaluators\0"
+    "GL_NV_explicit_multisample\0"
+    "GL_NV_fence\0"
+    "GL_NV_fill_rectangle\0"
+    "GL_NV_float_buffer\0"
+    "GL_NV_fog_distance\0"
+    "GL_NV_fragment_coverage_to_color\0"
+    "GL_NV_fragment_program\0"
+    "GL_NV_fragment_program2\0"
+    "GL_NV_fragment_program4\0"
+    "GL_NV_fragment_program_option\0"
+    "GL_NV_fragment_shader_barycentric\0"
+    "GL_NV_fragment_shader_interlock\0"
+    "GL_NV_framebuffer_mixed_samples\0"
+    "GL_NV_framebuffer_multisample_coverage\0"
+    "GL_NV_geometry_program4\0"
+    "GL_NV_geometry_shader4\0"
+    "GL_NV_geometry_shader_passthrough\0"
+    "GL_NV_gpu_multicast\0"
+    "GL_NV_gpu_program4\0"
+    "GL_NV_gpu_program5\0"
+    "GL_NV_gpu_program5_mem_extended\0"
+    "GL_NV_gpu_shader5\0"
+    "GL_NV_half_float\0"
+    "GL_NV_internalformat_sample_query\0"
+    "GL_NV_light_max_exponent\0"
+    "GL_NV_memory_attachment\0"
+    "GL_NV_memory_object_sparse\0"
+    "GL_NV_mesh_shader\0"
+    "GL_NV_multisample_coverage\0"
+    "GL_NV_multisample_filter_hint\0"
+    "GL_NV_occlusion_query\0"
+    "GL_NV_packed_depth_stencil\0"
+    "GL_NV_parameter_buffer_object\0"
+    "GL_NV_parameter_buffer_object2\0"
+    "GL_NV_path_rendering\0"
+    "GL_NV_path_rendering_shared_edge\0"
+    "GL_NV_pixel_data_range\0"
+    "GL_NV_point_sprite\0"
+    "GL_NV_present_video\0"
+    "GL_NV_primitive_restart\0"
+    "GL_NV_primitive_shading_rate\0"
+    "GL_NV_query_resource\0"
+    "GL_NV_query_resource_tag\0"
+    "GL_NV_register_combiners\0"
+    "GL_NV_register_combiners2\0"
+    "GL_NV_representative_fragment_test\0"
+    "GL_NV_robustness_video_memory_purge\0"
+    "GL_NV_sample_locations\0"
+    "GL_NV_sample_mask_override_coverage\0"
+    "GL_NV_scissor_exclusive\0"
+    "GL_NV_shader_atomic_counters\0"
+    "GL_NV_shader_atomic_float\0"
+    "GL_NV_shader_atomic_float64\0"
+    "GL_NV_shader_atomic_fp16_vector\0"
+    "GL_NV_shader_atomic_int64\0"
+    "GL_NV_shader_buffer_load\0"
+    "GL_NV_shader_buffer_store\0"
+    "GL_NV_shader_storage_buffer_object\0"
+    "GL_NV_shader_subgroup_partitioned\0"
+    "GL_NV_shader_texture_footprint\0"
+    "GL_NV_shader_thread_group\0"
+    "GL_NV_shader_thread_shuffle\0"
+    "GL_NV_shading_rate_image\0"
+    "GL_NV_stereo_view_rendering\0"
+    "GL_NV_tessellation_program5\0"
+    "GL_NV_texgen_emboss\0"
+    "GL_NV_texgen_reflection\0"
+    "GL_NV_texture_barrier\0"
+    "GL_NV_texture_compression_vtc\0"
+    "GL_NV_texture_env_combine4\0"
+    "GL_NV_texture_expand_normal\0"
+    "GL_NV_texture_multisample\0"
+    "GL_NV_texture_rectangle\0"
+    "GL_NV_texture_rectangle_compressed\0"
+    "GL_NV_texture_shader\0"
+    "GL_NV_texture_shader2\0"
+    "GL_NV_texture_shader3\0"
+    "GL_NV_timeline_semaphore\0"
+    "GL_NV_transform_feedback\0"
+    "GL_NV_transform_feedback2\0"
+    "GL_NV_uniform_buffer_std430_layout\0"
+    "GL_NV_uniform_buffer_unified_memory\0"
+    "GL_NV_vdpau_interop\0"
+    "GL_NV_vdpau_interop2\0"
+    "GL_NV_vertex_array_range\0"
+    "GL_NV_vertex_array_range2\0"
+    "GL_NV_vertex_attrib_integer_64bit\0"
+    "GL_NV_vertex_buffer_unified_memory\0"
+    "GL_NV_vertex_program\0"
+    "GL_NV_vertex_program1_1\0"
+    "GL_NV_vertex_program2\0"
+    "GL_NV_vertex_program2_option\0"
+    "GL_NV_vertex_program3\0"
+    "GL_NV_vertex_program4\0"
+    "GL_NV_video_capture\0"
+    "GL_NV_viewport_array2\0"
+    "GL_NV_viewport_swizzle\0"
+    "GL_OES_byte_coordinates\0"
+    "GL_OES_compressed_paletted_texture\0"
+    "GL_OES_fixed_point\0"
+    "GL_OES_query_matrix\0"
+    "GL_OES_read_format\0"
+    "GL_OES_single_precision\0"
+    "GL_OML_interlace\0"
+    "GL_OML_resample\0"
+    "GL_OML_subsample\0"
+    "GL_OVR_multiview\0"
+    "GL_OVR_multiview2\0"
+    "GL_PGI_misc_hints\0"
+    "GL_PGI_vertex_hints\0"
+    "GL_REND_screen_coordinates\0"
+    "GL_S3_s3tc\0"
+    "GL_SGIS_detail_texture\0"
+    "GL_SGIS_fog_function\0"
+    "GL_SGIS_generate_mipmap\0"
+    "GL_SGIS_multisample\0"
+    "GL_SGIS_pixel_texture\0"
+    "GL_SGIS_point_line_texgen\0"
+    "GL_SGIS_point_parameters\0"
+    "GL_SGIS_sharpen_texture\0"
+    "GL_SGIS_texture4D\0"
+    "GL_SGIS_texture_border_clamp\0"
+    "GL_SGIS_texture_color_mask\0"
+    "GL_SGIS_texture_edge_clamp\0"
+    "GL_SGIS_texture_filter4\0"
+    "GL_SGIS_texture_lod\0"
+    "GL_SGIS_texture_select\0"
+    "GL_SGIX_async\0"
+    "GL_SGIX_async_histogram\0"
+    "GL_SGIX_async_pixel\0"
+    "GL_SGIX_blend_alpha_minmax\0"
+    "GL_SGIX_calligraphic_fragment\0"
+    "GL_SGIX_clipmap\0"
+    "GL_SGIX_convolution_accuracy\0"
+    "GL_SGIX_depth_pass_instrument\0"
+    "GL_SGIX_depth_texture\0"
+    "GL_SGIX_flush_raster\0"
+    "GL_SGIX_fog_offset\0"
+    "GL_SGIX_fragment_lighting\0"
+    "GL_SGIX_framezoom\0"
+    "GL_SGIX_igloo_interface\0"
+    "GL_SGIX_instruments\0"
+    "GL_SGIX_interlace\0"
+    "GL_SGIX_ir_instrument1\0"
+    "GL_SGIX_list_priority\0"
+    "GL_SGIX_pixel_texture\0"
+    "GL_SGIX_pixel_tiles\0"
+    "GL_SGIX_polynomial_ffd\0"
+    "GL_SGIX_reference_plane\0"
+    "GL_SGIX_resample\0"
+    "GL_SGIX_scalebias_hint\0"
+    "GL_SGIX_shadow\0"
+    "GL_SGIX_shadow_ambient\0"
+    "GL_SGIX_sprite\0"
+    "GL_SGIX_subsample\0"
+    "GL_SGIX_tag_sample_buffer\0"
+    "GL_SGIX_texture_add_env\0"
+    "GL_SGIX_texture_coordinate_clamp\0"
+    "GL_SGIX_texture_lod_bias\0"
+    "GL_SGIX_texture_multi_buffer\0"
+    "GL_SGIX_texture_scale_bias\0"
+    "GL_SGIX_vertex_preclip\0"
+    "GL_SGIX_ycrcb\0"
+    "GL_SGIX_ycrcb_subsample\0"
+    "GL_SGIX_ycrcba\0"
+    "GL_SGI_color_matrix\0"
+    "GL_SGI_color_table\0"
+    "GL_SGI_texture_color_table\0"
+    "GL_SUNX_constant_data\0"
+    "GL_SUN_convolution_border_modes\0"
+    "GL_SUN_global_alpha\0"
+    "GL_SUN_mesh_array\0"
+    "GL_SUN_slice_accum\0"
+    "GL_SUN_triangle_list\0"
+    "GL_SUN_vertex\0"
+    "GL_WIN_phong_shading\0"
+    "GL_WIN_specular_fog\0";
 
-static GLATTER_THREAD_LOCAL unsigned glatter_es_cache_pos_GL = 0;
+static const glatter_extension_table_t glatter_ext_table_GL = {
+    512, 1024,
+    glatter_ext_seeds_GL, glatter_ext_slots_GL,
+    glatter_ext_name_offsets_GL, glatter_ext_names_GL
+};
 
-/* Optional: public invalidation for this family. */
-GLATTER_INLINE_OR_NOT void glatter_invalidate_extension_cache_GL(void) {
-    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
-        glatter_es_cache_GL[i].key = (uintptr_t)0;
-    }
-}
 
-GLATTER_INLINE_OR_NOT
-glatter_extension_support_status_GL_t glatter_get_extension_support_GL()
+/* ---- Context capabilities (generated) ---- */
+
+/* A GL context's cached set. glatter_get_extension_support_GL returns the
+ * address of the first member, glatter_get_context_caps finds the second. */
+typedef struct glatter_context_info_GL
 {
-    /* Per-thread scratch array to build the bitset before mapping into ess. */
-    static GLATTER_THREAD_LOCAL int indexed_extensions[624];
+    glatter_extension_support_status_GL_t extensions;
+    glatter_context_caps_t                caps;
+} glatter_context_info_GL_t;
 
-    /* Local result object (returned by value). */
-    glatter_extension_support_status_GL_t ess; /* will be filled then returned */
-    memset(&ess, 0, sizeof(ess));
+/* All zero: the set of "no current context". Never written. */
+static glatter_context_info_GL_t glatter_context_info_none_GL;
 
-    /* 1) Compute a key for the current context; 0 means "no current context". */
-    uintptr_t ctx_key = glatter_current_gl_context_key_();
+typedef struct glatter_context_limit
+{
+    uint16_t slot;      /* GLATTER_LIMIT_* */
+    uint8_t  gl, es;    /* first version with the query, major * 10 + minor; 0 for none */
+    GLenum   name;
+} glatter_context_limit_t;
 
-    /* 2) If no current context, return zeros without touching the cache. */
-    if (ctx_key == (uintptr_t)0) {
-        /* Leave ess zero-initialized to indicate "no extensions known". */
-        return ess;
-    }
+/* The limits of context_limits in glatter.py that these headers define. */
+static const glatter_context_limit_t glatter_context_limits_GL[] = {
+#ifdef GL_MAX_TEXTURE_SIZE
+    { GLATTER_LIMIT_MAX_TEXTURE_SIZE, 10, 10, GL_MAX_TEXTURE_SIZE },
+#endif
+#ifdef GL_MAX_CUBE_MAP_TEXTURE_SIZE
+    { GLATTER_LIMIT_MAX_CUBE_MAP_TEXTURE_SIZE, 13, 20, GL_MAX_CUBE_MAP_TEXTURE_SIZE },
+#endif
+#ifdef GL_MAX_3D_TEXTURE_SIZE
+    { GLATTER_LIMIT_MAX_3D_TEXTURE_SIZE, 12, 30, GL_MAX_3D_TEXTURE_SIZE },
+#endif
+#ifdef GL_MAX_ARRAY_TEXTURE_LAYERS
+    { GLATTER_LIMIT_MAX_ARRAY_TEXTURE_LAYERS, 30, 30, GL_MAX_ARRAY_TEXTURE_LAYERS },
+#endif
+#ifdef GL_MAX_RENDERBUFFER_SIZE
+    { GLATTER_LIMIT_MAX_RENDERBUFFER_SIZE, 30, 20, GL_MAX_RENDERBUFFER_SIZE },
+#endif
+#ifdef GL_MAX_SAMPLES
+    { GLATTER_LIMIT_MAX_SAMPLES, 30, 30, GL_MAX_SAMPLES },
+#endif
+#ifdef GL_MAX_COLOR_ATTACHMENTS
+    { GLATTER_LIMIT_MAX_COLOR_ATTACHMENTS, 30, 30, GL_MAX_COLOR_ATTACHMENTS },
+#endif
+#ifdef GL_MAX_DRAW_BUFFERS
+    { GLATTER_LIMIT_MAX_DRAW_BUFFERS, 20, 30, GL_MAX_DRAW_BUFFERS },
+#endif
+#ifdef GL_MAX_ELEMENTS_VERTICES
+    { GLATTER_LIMIT_MAX_ELEMENTS_VERTICES, 12, 30, GL_MAX_ELEMENTS_VERTICES },
+#endif
+#ifdef GL_MAX_ELEMENTS_INDICES
+    { GLATTER_LIMIT_MAX_ELEMENTS_INDICES, 12, 30, GL_MAX_ELEMENTS_INDICES },
+#endif
+#ifdef GL_MAX_VERTEX_ATTRIBS
+    { GLATTER_LIMIT_MAX_VERTEX_ATTRIBS, 20, 20, GL_MAX_VERTEX_ATTRIBS },
+#endif
+#ifdef GL_MAX_TEXTURE_IMAGE_UNITS
+    { GLATTER_LIMIT_MAX_TEXTURE_IMAGE_UNITS, 20, 20, GL_MAX_TEXTURE_IMAGE_UNITS },
+#endif
+#ifdef GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS
+    { GLATTER_LIMIT_MAX_VERTEX_TEXTURE_IMAGE_UNITS, 20, 20, GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS },
+#endif
+#ifdef GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS
+    { GLATTER_LIMIT_MAX_COMBINED_TEXTURE_IMAGE_UNITS, 20, 20, GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS },
+#endif
+#ifdef GL_MAX_VERTEX_UNIFORM_VECTORS
+    { GLATTER_LIMIT_MAX_VERTEX_UNIFORM_VECTORS, 41, 20, GL_MAX_VERTEX_UNIFORM_VECTORS },
+#endif
+#ifdef GL_MAX_FRAGMENT_UNIFORM_VECTORS
+    { GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_VECTORS, 41, 20, GL_MAX_FRAGMENT_UNIFORM_VECTORS },
+#endif
+#ifdef GL_MAX_FRAGMENT_INPUT_COMPONENTS
+    { GLATTER_LIMIT_MAX_FRAGMENT_INPUT_COMPONENTS, 32, 30, GL_MAX_FRAGMENT_INPUT_COMPONENTS },
+#endif
+#ifdef GL_MAX_UNIFORM_BLOCK_SIZE
+    { GLATTER_LIMIT_MAX_UNIFORM_BLOCK_SIZE, 31, 30, GL_MAX_UNIFORM_BLOCK_SIZE },
+#endif
+#ifdef GL_MAX_UNIFORM_BUFFER_BINDINGS
+    { GLATTER_LIMIT_MAX_UNIFORM_BUFFER_BINDINGS, 31, 30, GL_MAX_UNIFORM_BUFFER_BINDINGS },
+#endif
+#ifdef GL_MAX_VERTEX_UNIFORM_BLOCKS
+    { GLATTER_LIMIT_MAX_VERTEX_UNIFORM_BLOCKS, 31, 30, GL_MAX_VERTEX_UNIFORM_BLOCKS },
+#endif
+#ifdef GL_MAX_FRAGMENT_UNIFORM_BLOCKS
+    { GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_BLOCKS, 31, 30, GL_MAX_FRAGMENT_UNIFORM_BLOCKS },
+#endif
+#ifdef GL_MAX_COMBINED_UNIFORM_BLOCKS
+    { GLATTER_LIMIT_MAX_COMBINED_UNIFORM_BLOCKS, 31, 30, GL_MAX_COMBINED_UNIFORM_BLOCKS },
+#endif
+#ifdef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    { GLATTER_LIMIT_UNIFORM_BUFFER_OFFSET_ALIGNMENT, 31, 30, GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT },
+#endif
+#ifdef GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS
+    { GLATTER_LIMIT_MAX_SHADER_STORAGE_BUFFER_BINDINGS, 43, 31, GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS },
+#endif
+#ifdef GL_MAX_SHADER_STORAGE_BLOCK_SIZE
+    { GLATTER_LIMIT_MAX_SHADER_STORAGE_BLOCK_SIZE, 43, 31, GL_MAX_SHADER_STORAGE_BLOCK_SIZE },
+#endif
+#ifdef GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT
+    { GLATTER_LIMIT_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, 43, 31, GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT },
+#endif
+#ifdef GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS
+    { GLATTER_LIMIT_MAX_COMPUTE_WORK_GROUP_INVOCATIONS, 43, 31, GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS },
+#endif
+#ifdef GL_MAX_COMPUTE_SHARED_MEMORY_SIZE
+    { GLATTER_LIMIT_MAX_COMPUTE_SHARED_MEMORY_SIZE, 43, 31, GL_MAX_COMPUTE_SHARED_MEMORY_SIZE },
+#endif
+    { GLATTER_LIMIT_COUNT, 0, 0, 0 }
+};
 
-    /* 3) Cache lookup (TLS ring of 8 entries). */
-    for (unsigned i = 0; i < GLATTER_ES_CACHE_SLOTS; ++i) {
-        if (glatter_es_cache_GL[i].key == ctx_key) {
-            return glatter_es_cache_GL[i].ess; /* HIT */
-        }
-    }
+static int glatter_context_has_(const glatter_context_caps_t* caps, int gl, int es)
+{
+    int first = caps->es ? es : gl;
+    return first != 0 && caps->major * 10 + caps->minor >= first;
+}
 
-    /* 4) MISS: (re)build indexed_extensions[...] for the *current* context. */
-    /* Ensure scratch is cleared before probing. */
-    memset(indexed_extensions, 0, sizeof(indexed_extensions));
+/* Fills caps from GL_VERSION and the queries that version has, so that none
+ * of them raises GL_INVALID_ENUM. */
+static void glatter_query_context_caps_GL_(glatter_context_caps_t* caps, const uint8_t* version)
+{
+    caps->es = strncmp((const char*)version, "OpenGL ES", 9) == 0;
+    glatter_parse_version_(version, &caps->major, &caps->minor);
 
-    typedef glatter_es_record_t rt;
-#ifdef __cplusplus
-    static const rt zrt = {0, 0};
-#else
-#define zrt {0, 0}
+#ifdef GL_SHADING_LANGUAGE_VERSION
+    if (glatter_context_has_(caps, 20, 20)) {
+        int major, minor;
+        glatter_parse_version_((const uint8_t*)glatter_glGetString(GL_SHADING_LANGUAGE_VERSION), &major, &minor);
+        caps->glsl_version = major * 100 + (minor < 10 ? minor * 10 : minor);
+    }
 #endif
-    static rt e6   [] = {{3639508998, 569}, zrt};
-    static rt e11  [] = {{1861959697, 465}, zrt};
-    static rt e12  [] = {{1861959698, 466}, zrt};
-    static rt e46  [] = {{1261731910, 568}, zrt};
-    static rt e5e  [] = {{3703570526, 361}, zrt};
-    static rt e60  [] = {{348356704, 446}, zrt};
-    static rt eab  [] = {{725778603, 321}, zrt};
-    static rt ebd  [] = {{3453698237, 34}, zrt};
-    static rt ebe  [] = {{1173127358, 346}, zrt};
-    static rt edd  [] = {{1883619549, 608}, zrt};
-    static rt ee4  [] = {{2462531812, 577}, zrt};
-    static rt ef8  [] = {{1124811000, 109}, {1139425528, 275}, zrt};
-    static rt e12c [] = {{4113137964, 356}, zrt};
-    static rt e182 [] = {{2127217026, 531}, zrt};
-    static rt e199 [] = {{1249018265, 278}, {4292002201, 425}, zrt};
-    static rt e1be [] = {{2176500158, 477}, zrt};
-    static rt e1d7 [] = {{1870528983, 579}, zrt};
-    static rt e1d9 [] = {{2216133081, 457}, zrt};
-    static rt e1e1 [] = {{2887434721, 483}, zrt};
-    static rt e1e3 [] = {{2392228323, 210}, zrt};
-    static rt e1f7 [] = {{4037919223, 183}, zrt};
-    static rt e20e [] = {{366936590, 311}, zrt};
-    static rt e219 [] = {{3136979481, 1}, zrt};
-    static rt e23a [] = {{1676067386, 93}, zrt};
-    static rt e23e [] = {{4248027710, 623}, zrt};
-    static rt e24a [] = {{3024749130, 284}, zrt};
-    static rt e255 [] = {{276808277, 181}, zrt};
-    static rt e281 [] = {{1205240449, 18}, zrt};
-    static rt e2c1 [] = {{3085091521, 548}, zrt};
-    static rt e2ca [] = {{3279848138, 87}, zrt};
-    static rt e2d7 [] = {{2760213207, 598}, zrt};
-    static rt e2ea [] = {{2758443754, 90}, zrt};
-    static rt e314 [] = {{2139849492, 504}, zrt};
-    static rt e32e [] = {{1588495150, 482}, zrt};
-    static rt e356 [] = {{3586310998, 50}, zrt};
-    static rt e35a [] = {{984253274, 46}, zrt};
-    static rt e378 [] = {{3762258808, 336}, zrt};
-    static rt e39a [] = {{4229137306, 436}, zrt};
-    static rt e3fe [] = {{2524169214, 323}, zrt};
-    static rt e423 [] = {{1142178851, 247}, zrt};
-    static rt e42d [] = {{625443885, 154}, zrt};
-    static rt e43d [] = {{2662908989, 474}, zrt};
-    static rt e443 [] = {{2963096643, 360}, zrt};
-    static rt e453 [] = {{2353775699, 243}, zrt};
-    static rt e459 [] = {{2538226777, 538}, zrt};
-    static rt e478 [] = {{3523904632, 302}, zrt};
-    static rt e47a [] = {{1713407098, 142}, zrt};
-    static rt e49b [] = {{703038619, 443}, zrt};
-    static rt e4bc [] = {{1726989500, 161}, zrt};
-    static rt e4c2 [] = {{2834957506, 277}, zrt};
-    static rt e4e8 [] = {{3091268840, 128}, zrt};
-    static rt e521 [] = {{3775137057, 501}, zrt};
-    static rt e53d [] = {{2219377981, 622}, zrt};
-    static rt e54f [] = {{2979775823, 513}, zrt};
-    static rt e557 [] = {{3647259991, 486}, zrt};
-    static rt e558 [] = {{2274772312, 193}, zrt};
-    static rt e56f [] = {{3691857263, 614}, zrt};
-    static rt e576 [] = {{1090520438, 288}, zrt};
-    static rt e599 [] = {{151750041, 558}, zrt};
-    static rt e5a7 [] = {{1133184423, 420}, zrt};
-    static rt e5e3 [] = {{714507747, 592}, zrt};
-    static rt e5e5 [] = {{380569061, 49}, zrt};
-    static rt e5fa [] = {{444024314, 561}, zrt};
-    static rt e605 [] = {{1784088069, 250}, zrt};
-    static rt e628 [] = {{1979729448, 386}, zrt};
-    static rt e63d [] = {{2271970877, 442}, zrt};
-    static rt e674 [] = {{3791718004, 314}, zrt};
-    static rt e6bb [] = {{3331229371, 40}, zrt};
-    static rt e6d0 [] = {{2242889424, 199}, zrt};
-    static rt e6d2 [] = {{1605273298, 38}, zrt};
-    static rt e730 [] = {{1296729904, 41}, zrt};
-    static rt e748 [] = {{2604418888, 173}, zrt};
-    static rt e753 [] = {{66537299, 338}, zrt};
-    static rt e7a7 [] = {{3588016039, 578}, zrt};
-    static rt e7ee [] = {{3772499950, 227}, zrt};
-    static rt e7fb [] = {{330663931, 64}, zrt};
-    static rt e80a [] = {{1324533770, 249}, zrt};
-    static rt e837 [] = {{1750255671, 257}, zrt};
-    static rt e83f [] = {{3721939007, 221}, zrt};
-    static rt e878 [] = {{1839564920, 114}, zrt};
-    static rt e885 [] = {{2989705349, 611}, zrt};
-    static rt e887 [] = {{3095480455, 223}, zrt};
-    static rt e88a [] = {{3735177354, 380}, zrt};
-    static rt e897 [] = {{1796409495, 440}, zrt};
-    static rt e8b0 [] = {{3174795440, 536}, zrt};
-    static rt e8dd [] = {{2800486621, 215}, zrt};
-    static rt e8eb [] = {{2022082795, 544}, zrt};
-    static rt e946 [] = {{3442690374, 355}, zrt};
-    static rt e953 [] = {{642320723, 72}, zrt};
-    static rt e95a [] = {{538511706, 60}, zrt};
-    static rt e965 [] = {{2601519461, 77}, zrt};
-    static rt e9b7 [] = {{2082490807, 488}, zrt};
-    static rt e9c5 [] = {{2889107909, 418}, zrt};
-    static rt ea44 [] = {{3414854212, 305}, zrt};
-    static rt ea9d [] = {{4213361309, 25}, zrt};
-    static rt eab7 [] = {{4053191351, 252}, zrt};
-    static rt eabc [] = {{3333573308, 256}, zrt};
-    static rt ead1 [] = {{1513130705, 165}, zrt};
-    static rt eada [] = {{3730950874, 445}, zrt};
-    static rt eb57 [] = {{1272744791, 83}, zrt};
-    static rt eb5e [] = {{3027077982, 230}, zrt};
-    static rt eb65 [] = {{1869957989, 202}, zrt};
-    static rt eb72 [] = {{4208741234, 226}, zrt};
-    static rt eb7c [] = {{1320897404, 35}, zrt};
-    static rt eb9d [] = {{2668694429, 269}, {3925789597, 208}, zrt};
-    static rt eb9e [] = {{3925789598, 209}, zrt};
-    static rt eba2 [] = {{1271860130, 617}, zrt};
-    static rt ebc6 [] = {{1245678534, 366}, zrt};
-    static rt ebd9 [] = {{3623783385, 260}, zrt};
-    static rt ec29 [] = {{2222836777, 42}, zrt};
-    static rt ec4f [] = {{2889845839, 595}, zrt};
-    static rt ec56 [] = {{3421490262, 333}, zrt};
-    static rt ec5e [] = {{1367018590, 71}, zrt};
-    static rt ec6f [] = {{1730186351, 258}, zrt};
-    static rt ec73 [] = {{711363699, 254}, zrt};
-    static rt ec7b [] = {{1441680507, 316}, zrt};
-    static rt ec8b [] = {{1125780619, 153}, zrt};
-    static rt ec97 [] = {{1456966807, 496}, zrt};
-    static rt ecb5 [] = {{4188523701, 590}, zrt};
-    static rt ecf1 [] = {{3164261617, 191}, zrt};
-    static rt ecf8 [] = {{600788216, 255}, zrt};
-    static rt ed0d [] = {{3892579597, 566}, zrt};
-    static rt ed1d [] = {{897289501, 588}, zrt};
-    static rt ed21 [] = {{369233185, 394}, zrt};
-    static rt ed24 [] = {{442486052, 310}, zrt};
-    static rt ed38 [] = {{3708947768, 322}, zrt};
-    static rt ed3e [] = {{501959998, 19}, zrt};
-    static rt ed49 [] = {{4128574793, 296}, zrt};
-    static rt ed4c [] = {{3210054988, 371}, zrt};
-    static rt ed6e [] = {{2724089198, 528}, zrt};
-    static rt ed76 [] = {{2402504054, 94}, zrt};
-    static rt ed79 [] = {{1494945145, 384}, zrt};
-    static rt edba [] = {{3107147194, 390}, zrt};
-    static rt edc6 [] = {{160419270, 147}, zrt};
-    static rt edca [] = {{1702022602, 178}, zrt};
-    static rt edd3 [] = {{1170607571, 397}, zrt};
-    static rt ee10 [] = {{999198224, 388}, zrt};
-    static rt ee28 [] = {{3301002792, 398}, zrt};
-    static rt ee2f [] = {{3589361199, 377}, zrt};
-    static rt ee36 [] = {{2805648950, 10}, zrt};
-    static rt ee50 [] = {{1691536976, 159}, zrt};
-    static rt ee70 [] = {{2505887344, 166}, zrt};
-    static rt eeb4 [] = {{1295797940, 524}, zrt};
-    static rt eeb9 [] = {{3369537209, 271}, {3554594489, 556}, zrt};
-    static rt eec2 [] = {{3259993794, 370}, zrt};
-    static rt eec4 [] = {{2214629060, 481}, zrt};
-    static rt eeed [] = {{614256365, 148}, zrt};
-    static rt ef51 [] = {{292884305, 527}, zrt};
-    static rt ef7b [] = {{570953595, 353}, zrt};
-    static rt ef82 [] = {{1615187842, 214}, zrt};
-    static rt ef90 [] = {{858886032, 131}, zrt};
-    static rt efd2 [] = {{3631058898, 491}, zrt};
-    static rt efd4 [] = {{235098068, 373}, zrt};
-    static rt effb [] = {{1137430523, 245}, {2889224187, 580}, zrt};
-    static rt effc [] = {{4213821436, 575}, zrt};
-    static rt e1004[] = {{487133188, 295}, zrt};
-    static rt e101a[] = {{1990643738, 402}, zrt};
-    static rt e1024[] = {{1586974756, 303}, zrt};
-    static rt e103d[] = {{345051197, 570}, zrt};
-    static rt e104e[] = {{687804494, 458}, zrt};
-    static rt e1053[] = {{884232275, 593}, zrt};
-    static rt e106b[] = {{3146813547, 251}, zrt};
-    static rt e108c[] = {{3363262604, 612}, zrt};
-    static rt e1091[] = {{1531302033, 543}, zrt};
-    static rt e10b9[] = {{833622201, 557}, zrt};
-    static rt e10c3[] = {{2461601987, 429}, zrt};
-    static rt e10c8[] = {{267145416, 589}, zrt};
-    static rt e10dd[] = {{280580317, 511}, zrt};
-    static rt e111b[] = {{3388854555, 39}, zrt};
-    static rt e1144[] = {{2131693892, 399}, zrt};
-    static rt e1159[] = {{3110818137, 63}, zrt};
-    static rt e11c9[] = {{1156157897, 565}, zrt};
-    static rt e11d7[] = {{2291028439, 248}, zrt};
-    static rt e11fd[] = {{2526155261, 492}, zrt};
-    static rt e124a[] = {{441242186, 621}, zrt};
-    static rt e1257[] = {{2634486359, 454}, zrt};
-    static rt e1259[] = {{2634486361, 455}, zrt};
-    static rt e1287[] = {{2676052615, 201}, zrt};
-    static rt e130b[] = {{3420951307, 189}, zrt};
-    static rt e1316[] = {{2779075350, 125}, zrt};
-    static rt e1352[] = {{461886290, 54}, zrt};
-    static rt e1362[] = {{3771503458, 498}, zrt};
-    static rt e1374[] = {{1180701556, 225}, zrt};
-    static rt e1382[] = {{350245762, 437}, zrt};
-    static rt e1395[] = {{3215381397, 435}, zrt};
-    static rt e13a4[] = {{3474510756, 609}, zrt};
-    static rt e13a7[] = {{2923320231, 555}, zrt};
-    static rt e13c8[] = {{3006895048, 76}, zrt};
-    static rt e13d0[] = {{842388432, 29}, zrt};
-    static rt e13dd[] = {{22402013, 281}, zrt};
-    static rt e13fe[] = {{3819459582, 152}, zrt};
-    static rt e1403[] = {{2948207619, 272}, zrt};
-    static rt e1405[] = {{2357826565, 413}, zrt};
-    static rt e141a[] = {{652973082, 234}, zrt};
-    static rt e1456[] = {{367547478, 503}, zrt};
-    static rt e14a9[] = {{540578985, 407}, zrt};
-    static rt e14c6[] = {{1529435334, 103}, zrt};
-    static rt e14ee[] = {{2150372590, 8}, zrt};
-    static rt e151b[] = {{4090680603, 587}, zrt};
-    static rt e1525[] = {{2881410341, 130}, zrt};
-    static rt e1531[] = {{396645681, 89}, zrt};
-    static rt e1535[] = {{103273781, 550}, zrt};
-    static rt e153e[] = {{2395559230, 423}, zrt};
-    static rt e1545[] = {{1796248901, 349}, zrt};
-    static rt e154f[] = {{3203339599, 610}, zrt};
-    static rt e156d[] = {{3976828269, 180}, zrt};
-    static rt e157a[] = {{238753146, 327}, zrt};
-    static rt e15bf[] = {{62723519, 232}, zrt};
-    static rt e15e2[] = {{19895778, 175}, zrt};
-    static rt e15ec[] = {{794760684, 86}, zrt};
-    static rt e15f5[] = {{311809525, 449}, zrt};
-    static rt e1636[] = {{1883444790, 216}, zrt};
-    static rt e1667[] = {{3960329831, 359}, zrt};
-    static rt e1668[] = {{980637288, 158}, zrt};
-    static rt e1683[] = {{4291057283, 136}, zrt};
-    static rt e1687[] = {{1612306055, 615}, zrt};
-    static rt e169c[] = {{3198031516, 24}, zrt};
-    static rt e16a1[] = {{3659011745, 65}, zrt};
-    static rt e16aa[] = {{1314150058, 222}, zrt};
-    static rt e16b7[] = {{1516902071, 618}, zrt};
-    static rt e16df[] = {{1060280031, 497}, zrt};
-    static rt e175b[] = {{4066826075, 487}, zrt};
-    static rt e176f[] = {{2689816431, 44}, zrt};
-    static rt e1786[] = {{55744390, 113}, zrt};
-    static rt e178d[] = {{2127615885, 276}, zrt};
-    static rt e17a4[] = {{2987251620, 91}, zrt};
-    static rt e17ac[] = {{155506604, 534}, zrt};
-    static rt e17cf[] = {{3716552655, 58}, zrt};
-    static rt e1802[] = {{2080905218, 105}, zrt};
-    static rt e1816[] = {{2854426646, 328}, zrt};
-    static rt e181a[] = {{1231362074, 484}, zrt};
-    static rt e187f[] = {{942299263, 194}, zrt};
-    static rt e1887[] = {{57251975, 334}, zrt};
-    static rt e1888[] = {{2520045704, 164}, zrt};
-    static rt e18a4[] = {{1748768932, 320}, zrt};
-    static rt e18b2[] = {{3709409458, 406}, zrt};
-    static rt e18b5[] = {{2135234741, 567}, zrt};
-    static rt e18fa[] = {{1274616058, 238}, zrt};
-    static rt e1905[] = {{4220213509, 84}, zrt};
-    static rt e190d[] = {{1328552205, 312}, zrt};
-    static rt e1915[] = {{3561756949, 96}, zrt};
-    static rt e1927[] = {{3999619367, 133}, zrt};
-    static rt e194c[] = {{2487621964, 526}, zrt};
-    static rt e1956[] = {{643438934, 460}, zrt};
-    static rt e1967[] = {{1953126759, 607}, zrt};
-    static rt e196d[] = {{3269450093, 433}, zrt};
-    static rt e197b[] = {{3967146363, 464}, zrt};
-    static rt e1989[] = {{3782252937, 439}, zrt};
-    static rt e19ab[] = {{1707760043, 177}, zrt};
-    static rt e19d4[] = {{3022756308, 137}, zrt};
-    static rt e19f5[] = {{1523358197, 604}, zrt};
-    static rt e1a03[] = {{3443153411, 135}, zrt};
-    static rt e1a08[] = {{3643906568, 352}, zrt};
-    static rt e1a09[] = {{3205667337, 224}, zrt};
-    static rt e1a18[] = {{4157463064, 219}, zrt};
-    static rt e1a61[] = {{2973473377, 417}, zrt};
-    static rt e1a6b[] = {{1559550571, 150}, zrt};
-    static rt e1a7c[] = {{3614775932, 573}, zrt};
-    static rt e1acf[] = {{2832734927, 151}, zrt};
-    static rt e1ae2[] = {{1189288674, 66}, zrt};
-    static rt e1b15[] = {{1144249109, 253}, zrt};
-    static rt e1b18[] = {{1136843544, 376}, zrt};
-    static rt e1b1d[] = {{857938717, 315}, zrt};
-    static rt e1b3e[] = {{2826394430, 605}, zrt};
-    static rt e1b58[] = {{884824920, 174}, zrt};
-    static rt e1b63[] = {{235002723, 270}, zrt};
-    static rt e1b67[] = {{2854673255, 110}, zrt};
-    static rt e1b82[] = {{941267842, 149}, zrt};
-    static rt e1b9f[] = {{2471254943, 196}, zrt};
-    static rt e1ba0[] = {{1932139424, 490}, zrt};
-    static rt e1bbe[] = {{1364138942, 354}, zrt};
-    static rt e1c04[] = {{2180307972, 619}, zrt};
-    static rt e1c12[] = {{3568426002, 261}, zrt};
-    static rt e1c1a[] = {{272440346, 31}, zrt};
-    static rt e1c21[] = {{3633142817, 101}, zrt};
-    static rt e1c2a[] = {{50748458, 301}, zrt};
-    static rt e1c35[] = {{2149882933, 4}, zrt};
-    static rt e1cab[] = {{2140069035, 405}, zrt};
-    static rt e1cb3[] = {{2091031731, 267}, zrt};
-    static rt e1cb6[] = {{3584875702, 470}, zrt};
-    static rt e1cbf[] = {{2904153279, 519}, zrt};
-    static rt e1cc1[] = {{2397985985, 179}, zrt};
-    static rt e1cce[] = {{3192397006, 117}, zrt};
-    static rt e1cd4[] = {{3506281684, 581}, zrt};
-    static rt e1ce2[] = {{3206552802, 78}, zrt};
-    static rt e1cfe[] = {{4055719166, 476}, zrt};
-    static rt e1d46[] = {{444063046, 30}, zrt};
-    static rt e1d59[] = {{1554586969, 389}, zrt};
-    static rt e1d88[] = {{1757011336, 132}, zrt};
-    static rt e1dd2[] = {{2067537362, 119}, zrt};
-    static rt e1dd7[] = {{972856791, 551}, zrt};
-    static rt e1dda[] = {{4110048730, 525}, zrt};
-    static rt e1ddc[] = {{1276452316, 204}, zrt};
-    static rt e1ded[] = {{1935252973, 285}, zrt};
-    static rt e1e28[] = {{1155243560, 217}, zrt};
-    static rt e1e36[] = {{3958136374, 473}, zrt};
-    static rt e1e80[] = {{441704064, 162}, zrt};
-    static rt e1e83[] = {{28237443, 309}, zrt};
-    static rt e1e9b[] = {{3562364571, 160}, zrt};
-    static rt e1ecd[] = {{1195695821, 37}, zrt};
-    static rt e1f02[] = {{3664518914, 187}, zrt};
-    static rt e1f49[] = {{1373953865, 459}, zrt};
-    static rt e1f53[] = {{3672973139, 67}, zrt};
-    static rt e1f71[] = {{2963988337, 28}, zrt};
-    static rt e1f8c[] = {{2595954572, 319}, zrt};
-    static rt e1f92[] = {{3259129746, 489}, zrt};
-    static rt e1f9b[] = {{3137396635, 197}, zrt};
-    static rt e1fac[] = {{3762036652, 335}, zrt};
-    static rt e1fb2[] = {{936927154, 603}, zrt};
-    static rt e1fb3[] = {{2263130035, 463}, zrt};
-    static rt e2020[] = {{3345260576, 387}, zrt};
-    static rt e203a[] = {{385523770, 529}, zrt};
-    static rt e203c[] = {{3837550652, 372}, zrt};
-    static rt e2056[] = {{1367695446, 192}, zrt};
-    static rt e206c[] = {{4121567340, 106}, zrt};
-    static rt e2085[] = {{1686397061, 156}, zrt};
-    static rt e2090[] = {{825958544, 242}, zrt};
-    static rt e2098[] = {{2317918360, 138}, zrt};
-    static rt e20ab[] = {{1275437227, 313}, zrt};
-    static rt e20c5[] = {{3854016709, 344}, zrt};
-    static rt e20d8[] = {{1292869848, 317}, zrt};
-    static rt e20e9[] = {{3597082857, 450}, zrt};
-    static rt e20f3[] = {{2704597235, 584}, zrt};
-    static rt e20f5[] = {{1809211637, 244}, zrt};
-    static rt e2106[] = {{1163321606, 47}, zrt};
-    static rt e2118[] = {{1531601176, 0}, zrt};
-    static rt e211e[] = {{4197540126, 563}, zrt};
-    static rt e2123[] = {{1142137123, 246}, zrt};
-    static rt e2147[] = {{2471780679, 122}, zrt};
-    static rt e214f[] = {{973513039, 61}, zrt};
-    static rt e2166[] = {{3143410022, 172}, zrt};
-    static rt e217d[] = {{3956728189, 279}, zrt};
-    static rt e2185[] = {{2812993925, 453}, zrt};
-    static rt e21b8[] = {{2930647480, 26}, zrt};
-    static rt e21e0[] = {{3393544672, 220}, zrt};
-    static rt e21e2[] = {{3893715426, 236}, zrt};
-    static rt e21fd[] = {{4076151293, 6}, zrt};
-    static rt e2202[] = {{2858672642, 59}, zrt};
-    static rt e221c[] = {{277373468, 182}, zrt};
-    static rt e222f[] = {{632496687, 115}, zrt};
-    static rt e2248[] = {{2131698248, 400}, zrt};
-    static rt e2256[] = {{1248436822, 273}, zrt};
-    static rt e2283[] = {{3702104707, 300}, zrt};
-    static rt e22c3[] = {{2080826051, 239}, zrt};
-    static rt e22d2[] = {{254436050, 368}, {2341626578, 475}, zrt};
-    static rt e2333[] = {{3483788083, 266}, zrt};
-    static rt e2342[] = {{454386498, 403}, zrt};
-    static rt e2343[] = {{454386499, 404}, zrt};
-    static rt e2348[] = {{3792053064, 195}, zrt};
-    static rt e2374[] = {{2527388532, 294}, zrt};
-    static rt e2378[] = {{1428726648, 444}, zrt};
-    static rt e2390[] = {{1072472976, 426}, zrt};
-    static rt e239d[] = {{794567581, 280}, zrt};
-    static rt e23cf[] = {{906585039, 559}, zrt};
-    static rt e23d3[] = {{1747280851, 408}, zrt};
-    static rt e23d4[] = {{1176953812, 3}, zrt};
-    static rt e23d9[] = {{4037731289, 562}, zrt};
-    static rt e23f4[] = {{1045013492, 430}, zrt};
-    static rt e23f8[] = {{2098668536, 74}, zrt};
-    static rt e2411[] = {{32334865, 514}, {3268191249, 381}, zrt};
-    static rt e2435[] = {{976987189, 9}, zrt};
-    static rt e2488[] = {{872195208, 140}, zrt};
-    static rt e249d[] = {{3700892829, 188}, zrt};
-    static rt e24d1[] = {{3523699921, 391}, zrt};
-    static rt e251d[] = {{1521263901, 456}, zrt};
-    static rt e2520[] = {{3261850912, 451}, zrt};
-    static rt e256d[] = {{2175182189, 218}, {2416502125, 20}, zrt};
-    static rt e2585[] = {{3021333893, 506}, zrt};
-    static rt e2586[] = {{2501272966, 102}, zrt};
-    static rt e2590[] = {{726427024, 134}, zrt};
-    static rt e25a1[] = {{2694538657, 124}, zrt};
-    static rt e25b0[] = {{4223018416, 401}, zrt};
-    static rt e25cf[] = {{936109519, 428}, zrt};
-    static rt e25e7[] = {{638166503, 547}, zrt};
-    static rt e262f[] = {{140158511, 535}, zrt};
-    static rt e2640[] = {{4025312832, 186}, zrt};
-    static rt e2673[] = {{3796002419, 211}, zrt};
-    static rt e2678[] = {{2092131960, 36}, zrt};
-    static rt e269c[] = {{1979377308, 108}, zrt};
-    static rt e269e[] = {{2046584478, 82}, zrt};
-    static rt e269f[] = {{3548636831, 143}, zrt};
-    static rt e26b1[] = {{789587633, 468}, zrt};
-    static rt e26c0[] = {{2517870272, 116}, zrt};
-    static rt e26cf[] = {{2587141839, 2}, {3664275151, 286}, zrt};
-    static rt e26e1[] = {{2871289569, 107}, zrt};
-    static rt e26e5[] = {{3075073765, 265}, zrt};
-    static rt e271b[] = {{1694918427, 572}, zrt};
-    static rt e2720[] = {{623470368, 467}, zrt};
-    static rt e2767[] = {{3376015207, 259}, zrt};
-    static rt e276c[] = {{3069929324, 308}, zrt};
-    static rt e2775[] = {{1394698101, 45}, zrt};
-    static rt e2798[] = {{290924440, 121}, zrt};
-    static rt e27ac[] = {{4132349868, 530}, zrt};
-    static rt e27e7[] = {{2954717159, 602}, zrt};
-    static rt e2858[] = {{812902488, 68}, zrt};
-    static rt e285b[] = {{1736960091, 500}, zrt};
-    static rt e2881[] = {{2831394945, 307}, zrt};
-    static rt e2898[] = {{1180166296, 331}, zrt};
-    static rt e28a9[] = {{363423913, 304}, zrt};
-    static rt e28c7[] = {{3093031111, 564}, zrt};
-    static rt e28cf[] = {{3893356751, 264}, zrt};
-    static rt e28f4[] = {{2512464116, 507}, zrt};
-    static rt e28f6[] = {{1007511798, 206}, zrt};
-    static rt e28ff[] = {{545761535, 414}, zrt};
-    static rt e2914[] = {{2292820244, 345}, zrt};
-    static rt e2927[] = {{3332581671, 98}, zrt};
-    static rt e293a[] = {{3045255482, 51}, zrt};
-    static rt e294a[] = {{3865438538, 27}, zrt};
-    static rt e2964[] = {{490875236, 299}, zrt};
-    static rt e297c[] = {{483043708, 325}, zrt};
-    static rt e298a[] = {{2720246154, 542}, zrt};
-    static rt e2992[] = {{2018470290, 43}, zrt};
-    static rt e29a4[] = {{1361832356, 594}, zrt};
-    static rt e29d4[] = {{3439405524, 16}, zrt};
-    static rt e29f9[] = {{4024478201, 341}, zrt};
-    static rt e2a0e[] = {{977185294, 55}, {2733369870, 350}, zrt};
-    static rt e2a19[] = {{1288301081, 11}, zrt};
-    static rt e2a32[] = {{3250727474, 329}, zrt};
-    static rt e2a60[] = {{812067424, 126}, zrt};
-    static rt e2aab[] = {{1336781483, 23}, zrt};
-    static rt e2ab3[] = {{999320243, 520}, zrt};
-    static rt e2ae5[] = {{3040766693, 176}, zrt};
-    static rt e2b1b[] = {{3984878363, 363}, zrt};
-    static rt e2b3b[] = {{319597371, 12}, zrt};
-    static rt e2b46[] = {{2678008646, 7}, zrt};
-    static rt e2b5f[] = {{87780191, 5}, zrt};
-    static rt e2b80[] = {{698706816, 57}, zrt};
-    static rt e2bd3[] = {{765733843, 522}, zrt};
-    static rt e2bd4[] = {{765733844, 523}, zrt};
-    static rt e2bde[] = {{319597534, 13}, zrt};
-    static rt e2c02[] = {{2971249666, 53}, zrt};
-    static rt e2c05[] = {{1416113157, 70}, zrt};
-    static rt e2c09[] = {{1832987657, 502}, zrt};
-    static rt e2c28[] = {{1170648104, 290}, zrt};
-    static rt e2c33[] = {{1350626355, 205}, zrt};
-    static rt e2c41[] = {{330263617, 537}, zrt};
-    static rt e2c42[] = {{330263618, 539}, zrt};
-    static rt e2c43[] = {{330263619, 540}, zrt};
-    static rt e2c66[] = {{1384803430, 395}, zrt};
-    static rt e2c76[] = {{1007971446, 599}, zrt};
-    static rt e2c78[] = {{2227022968, 382}, zrt};
-    static rt e2c99[] = {{1531112601, 48}, zrt};
-    static rt e2c9c[] = {{1312861340, 127}, zrt};
-    static rt e2ca3[] = {{3936644259, 434}, zrt};
-    static rt e2cb0[] = {{141421744, 293}, zrt};
-    static rt e2ccf[] = {{3446631631, 574}, zrt};
-    static rt e2cdb[] = {{165129435, 369}, {3928911067, 169}, zrt};
-    static rt e2cf2[] = {{3303615730, 432}, zrt};
-    static rt e2cf7[] = {{2574986487, 22}, zrt};
-    static rt e2cfd[] = {{3362958589, 601}, zrt};
-    static rt e2d5c[] = {{2813799772, 375}, zrt};
-    static rt e2d7f[] = {{1481665919, 441}, zrt};
-    static rt e2d86[] = {{1391324550, 292}, zrt};
-    static rt e2d95[] = {{392637845, 112}, zrt};
-    static rt e2df5[] = {{6893045, 351}, zrt};
-    static rt e2e0a[] = {{3858116106, 364}, zrt};
-    static rt e2e0e[] = {{2046684686, 171}, zrt};
-    static rt e2e12[] = {{4094488082, 362}, zrt};
-    static rt e2e41[] = {{2083286593, 392}, zrt};
-    static rt e2e67[] = {{1641901671, 478}, zrt};
-    static rt e2e68[] = {{3443207784, 515}, zrt};
-    static rt e2e7f[] = {{179007103, 75}, zrt};
-    static rt e2e87[] = {{2858544775, 411}, zrt};
-    static rt e2ef5[] = {{2401185525, 385}, zrt};
-    static rt e2f28[] = {{2770317096, 600}, zrt};
-    static rt e2f49[] = {{2582048585, 505}, zrt};
-    static rt e2f4c[] = {{3585929036, 421}, zrt};
-    static rt e2f53[] = {{1342254931, 396}, zrt};
-    static rt e2f55[] = {{4124110677, 282}, zrt};
-    static rt e2f78[] = {{4231163768, 410}, zrt};
-    static rt e2f85[] = {{4117868421, 606}, zrt};
-    static rt e2ff5[] = {{3542102005, 170}, zrt};
-    static rt e3030[] = {{4043632688, 462}, zrt};
-    static rt e3053[] = {{3777966163, 553}, zrt};
-    static rt e30aa[] = {{3853709482, 92}, zrt};
-    static rt e30be[] = {{910143678, 212}, zrt};
-    static rt e30ec[] = {{112144620, 185}, zrt};
-    static rt e30f5[] = {{3496014069, 184}, zrt};
-    static rt e30f7[] = {{2353885431, 518}, zrt};
-    static rt e311b[] = {{3439030555, 472}, zrt};
-    static rt e311d[] = {{1841197341, 33}, zrt};
-    static rt e312a[] = {{1214705962, 549}, zrt};
-    static rt e3136[] = {{3994792246, 582}, zrt};
-    static rt e3141[] = {{945582401, 231}, zrt};
-    static rt e316a[] = {{1895723370, 291}, {3199086954, 552}, zrt};
-    static rt e3182[] = {{1188262274, 378}, zrt};
-    static rt e31a6[] = {{2343678374, 427}, zrt};
-    static rt e31f4[] = {{1478685172, 532}, zrt};
-    static rt e31fb[] = {{312046075, 448}, zrt};
-    static rt e3203[] = {{3771412995, 516}, zrt};
-    static rt e3212[] = {{2363372050, 517}, zrt};
-    static rt e322a[] = {{4184666666, 479}, zrt};
-    static rt e3254[] = {{75199060, 262}, zrt};
-    static rt e3263[] = {{2698244707, 348}, zrt};
-    static rt e326e[] = {{1925100142, 79}, zrt};
-    static rt e3279[] = {{4106220153, 452}, zrt};
-    static rt e32a5[] = {{3762238117, 337}, zrt};
-    static rt e32fb[] = {{1316680443, 374}, zrt};
-    static rt e3302[] = {{1601598210, 297}, zrt};
-    static rt e3309[] = {{2626794249, 85}, zrt};
-    static rt e330a[] = {{847672074, 596}, zrt};
-    static rt e336d[] = {{1027830637, 263}, zrt};
-    static rt e336e[] = {{1768665966, 347}, zrt};
-    static rt e338b[] = {{895169419, 129}, zrt};
-    static rt e338d[] = {{3751326605, 560}, zrt};
-    static rt e338f[] = {{2164061071, 123}, zrt};
-    static rt e3390[] = {{3149034384, 145}, zrt};
-    static rt e33d5[] = {{2500211669, 412}, zrt};
-    static rt e342f[] = {{1816458287, 198}, zrt};
-    static rt e3454[] = {{718206036, 155}, zrt};
-    static rt e346b[] = {{207254635, 62}, zrt};
-    static rt e3474[] = {{2150380660, 200}, zrt};
-    static rt e349c[] = {{2204611740, 228}, zrt};
-    static rt e34a5[] = {{4110808229, 274}, zrt};
-    static rt e34a7[] = {{2728408231, 494}, zrt};
-    static rt e34b1[] = {{64631985, 157}, zrt};
-    static rt e3509[] = {{1163605257, 419}, zrt};
-    static rt e351e[] = {{1514632478, 73}, zrt};
-    static rt e3543[] = {{3293230403, 510}, zrt};
-    static rt e3550[] = {{1922299216, 111}, zrt};
-    static rt e355e[] = {{1384002910, 424}, zrt};
-    static rt e356f[] = {{1005876591, 332}, zrt};
-    static rt e3573[] = {{3360355699, 233}, zrt};
-    static rt e358c[] = {{1541944716, 229}, zrt};
-    static rt e35d4[] = {{2407183828, 508}, zrt};
-    static rt e35dd[] = {{798668253, 358}, zrt};
-    static rt e35ec[] = {{1994356204, 80}, zrt};
-    static rt e35ed[] = {{3550672365, 268}, zrt};
-    static rt e35fb[] = {{1877046779, 95}, zrt};
-    static rt e360f[] = {{4223743503, 357}, zrt};
-    static rt e3614[] = {{4095424020, 545}, zrt};
-    static rt e3625[] = {{1350874661, 416}, zrt};
-    static rt e364a[] = {{1809479242, 597}, zrt};
-    static rt e365c[] = {{2696640092, 237}, zrt};
-    static rt e3665[] = {{2176431717, 509}, zrt};
-    static rt e3670[] = {{486258288, 52}, zrt};
-    static rt e3673[] = {{1018885747, 367}, zrt};
-    static rt e36b1[] = {{835696305, 485}, zrt};
-    static rt e36b7[] = {{2507060919, 326}, zrt};
-    static rt e36dd[] = {{2620503773, 365}, zrt};
-    static rt e36f2[] = {{3592730354, 167}, zrt};
-    static rt e3718[] = {{3348051736, 283}, zrt};
-    static rt e3750[] = {{1240020816, 203}, zrt};
-    static rt e377d[] = {{33748861, 438}, zrt};
-    static rt e3791[] = {{3463608209, 88}, zrt};
-    static rt e379c[] = {{655046556, 480}, zrt};
-    static rt e37a6[] = {{3282007974, 240}, zrt};
-    static rt e37e5[] = {{2408593381, 69}, zrt};
-    static rt e37f0[] = {{2590504944, 576}, zrt};
-    static rt e3866[] = {{2637805670, 99}, zrt};
-    static rt e387f[] = {{3038312575, 146}, zrt};
-    static rt e38a2[] = {{2344269986, 330}, zrt};
-    static rt e38b6[] = {{2260318390, 383}, {4179605686, 422}, zrt};
-    static rt e38d6[] = {{3871357142, 571}, zrt};
-    static rt e38d7[] = {{3591616727, 14}, zrt};
-    static rt e390e[] = {{3049748750, 144}, zrt};
-    static rt e392f[] = {{3191929135, 32}, zrt};
-    static rt e3991[] = {{1871264145, 461}, zrt};
-    static rt e39d1[] = {{3317103057, 104}, zrt};
-    static rt e39da[] = {{1934162394, 235}, zrt};
-    static rt e39eb[] = {{1407580651, 318}, zrt};
-    static rt e3a01[] = {{2857171457, 207}, zrt};
-    static rt e3a03[] = {{315456003, 431}, zrt};
-    static rt e3a20[] = {{2363734560, 616}, zrt};
-    static rt e3a34[] = {{4188142132, 415}, zrt};
-    static rt e3a6d[] = {{1696873069, 512}, zrt};
-    static rt e3aa4[] = {{875690660, 541}, zrt};
-    static rt e3ab1[] = {{2790242993, 21}, zrt};
-    static rt e3ac8[] = {{2985261768, 339}, zrt};
-    static rt e3ae5[] = {{118831845, 554}, zrt};
-    static rt e3ae6[] = {{1242839782, 343}, zrt};
-    static rt e3af1[] = {{3399006961, 15}, zrt};
-    static rt e3b0a[] = {{377387786, 139}, zrt};
-    static rt e3b0c[] = {{1178532620, 499}, zrt};
-    static rt e3b14[] = {{1708931860, 120}, zrt};
-    static rt e3b15[] = {{2652240661, 306}, zrt};
-    static rt e3b5f[] = {{1109556063, 97}, {2751478623, 289}, zrt};
-    static rt e3b67[] = {{1709996903, 342}, zrt};
-    static rt e3b81[] = {{2886515585, 521}, zrt};
-    static rt e3b89[] = {{3763272585, 168}, zrt};
-    static rt e3b8b[] = {{257080203, 324}, zrt};
-    static rt e3b96[] = {{1539570582, 546}, zrt};
-    static rt e3ba3[] = {{239270819, 583}, zrt};
-    static rt e3bbf[] = {{3363961791, 613}, zrt};
-    static rt e3be7[] = {{3020307431, 471}, zrt};
-    static rt e3bf0[] = {{3129129968, 81}, zrt};
-    static rt e3bfa[] = {{727071738, 213}, zrt};
-    static rt e3c0a[] = {{2893347850, 190}, zrt};
-    static rt e3c3d[] = {{925432893, 100}, zrt};
-    static rt e3c82[] = {{1535261826, 493}, zrt};
-    static rt e3c88[] = {{2063301768, 447}, zrt};
-    static rt e3cfa[] = {{2469510394, 585}, zrt};
-    static rt e3d6b[] = {{1038269803, 241}, zrt};
-    static rt e3d6e[] = {{3283271022, 591}, zrt};
-    static rt e3d8d[] = {{1078672781, 17}, zrt};
-    static rt e3d8f[] = {{2578513295, 163}, zrt};
-    static rt e3dbf[] = {{2254306751, 56}, zrt};
-    static rt e3dfa[] = {{481525242, 409}, zrt};
-    static rt e3e1c[] = {{1941388828, 340}, zrt};
-    static rt e3e22[] = {{597196322, 393}, zrt};
-    static rt e3e34[] = {{1806777908, 298}, zrt};
-    static rt e3ed2[] = {{60473042, 533}, zrt};
-    static rt e3efd[] = {{220610301, 620}, zrt};
-    static rt e3f4a[] = {{3098099530, 469}, zrt};
-    static rt e3f8f[] = {{2651373455, 287}, zrt};
-    static rt e3f91[] = {{3178561425, 495}, zrt};
-    static rt e3fa3[] = {{3220651939, 141}, zrt};
-    static rt e3fd8[] = {{3019341784, 379}, zrt};
-    static rt e3fe1[] = {{3199320033, 586}, zrt};
-    static rt e3fee[] = {{3070214126, 118}, zrt};
-
-#ifndef __cplusplus
-#undef zrt
+#ifdef GL_CONTEXT_PROFILE_MASK
+    if (glatter_context_has_(caps, 32, 0)) {
+        glatter_glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &caps->profile_mask);
+    }
+#endif
+#ifdef GL_CONTEXT_FLAGS
+    if (glatter_context_has_(caps, 30, 32)) {
+        glatter_glGetIntegerv(GL_CONTEXT_FLAGS, &caps->flags);
+    }
 #endif
+    for (const glatter_context_limit_t* limit = glatter_context_limits_GL; limit->slot != GLATTER_LIMIT_COUNT; ++limit) {
+        if (glatter_context_has_(caps, limit->gl, limit->es)) {
+            glatter_glGetIntegerv(limit->name, &caps->limits[limit->slot]);
+        }
+    }
+}
 
-    static glatter_es_record_t* es_dispatch[GLATTER_LOOKUP_SIZE] = {
-        0,0,0,0,0,0,e6,0,0,0,0,0,0,0,0,0,0,e11,e12,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e5e,0,e60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,eab,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,ebd,ebe,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,edd,0,0,0,0,0,0,ee4,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,ef8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e12c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e182,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e199,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1be,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1d7,0,e1d9,0,0,0,0,0,0,
-        0,e1e1,0,e1e3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1f7,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e20e,0,0,0,0,0,0,0,0,0,0,e219,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e23a,0,0,0,e23e,0,0,0,0,0,0,0,0,0,0,0,e24a,0,0,0,0,0,0,0,0,0,0,e255,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e281,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c1,0,0,0,0,0,0,0,0,e2ca,0,0,0,0,0,
-        0,0,0,0,0,0,0,e2d7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2ea,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e314,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e32e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e356,0,0,0,e35a,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e378,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e39a,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3fe,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e423,0,0,0,0,0,0,0,0,0,e42d,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e43d,0,0,0,0,0,e443,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e453,0,0,
-        0,0,0,e459,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e478,0,e47a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e49b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e4bc,0,0,0,0,0,e4c2,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e4e8,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e521,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e53d,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e54f,0,0,0,0,0,0,0,e557,e558,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e56f,0,0,0,0,0,0,e576,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e599,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e5a7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e5e3,0,e5e5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e5fa,0,0,0,0,0,0,0,0,0,0,e605,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e628,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e63d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e674,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e6bb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e6d0,0,e6d2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e730,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e748,0,0,0,0,0,0,0,0,0,0,e753,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e7a7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e7ee,0,0,0,0,0,0,0,0,0,
-        0,0,0,e7fb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e80a,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e837,0,0,0,0,0,0,0,e83f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e878,0,0,0,0,0,0,0,0,0,0,0,0,e885,0,e887,0,0,e88a,0,0,0,
-        0,0,0,0,0,0,0,0,0,e897,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e8b0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e8dd,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e8eb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e946,0,0,0,0,0,0,0,0,0,0,0,0,e953,0,0,0,0,0,0,e95a,0,0,0,0,0,
-        0,0,0,0,0,e965,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e9b7,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e9c5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ea44,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ea9d,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,eab7,0,0,0,0,eabc,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,ead1,0,0,0,0,0,0,0,0,eada,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,eb57,0,0,0,0,0,0,
-        eb5e,0,0,0,0,0,0,eb65,0,0,0,0,0,0,0,0,0,0,0,0,eb72,0,0,0,0,0,0,0,0,0,
-        eb7c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,eb9d,eb9e,0,0,0,eba2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,ebc6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,ebd9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ec29,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,ec4f,0,0,0,0,0,0,ec56,0,0,0,0,0,0,0,ec5e,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,ec6f,0,0,0,ec73,0,0,0,0,0,0,0,ec7b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,ec8b,0,0,0,0,0,0,0,0,0,0,0,ec97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,ecb5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,ecf1,0,0,0,0,0,0,ecf8,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,ed0d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ed1d,0,0,
-        0,ed21,0,0,ed24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ed38,0,0,0,0,0,
-        ed3e,0,0,0,0,0,0,0,0,0,0,ed49,0,0,ed4c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ed6e,0,0,0,0,0,0,0,ed76,0,0,ed79,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,edba,0,0,0,0,0,0,0,0,0,0,0,edc6,0,0,0,edca,0,0,0,0,0,0,0,0,edd3,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        ee10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ee28,0,0,0,0,0,
-        0,ee2f,0,0,0,0,0,0,ee36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,ee50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,ee70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,eeb4,0,0,0,0,eeb9,0,0,0,0,0,0,0,0,eec2,0,
-        eec4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,eeed,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,ef51,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,ef7b,0,0,0,0,0,0,ef82,0,0,0,0,0,0,0,0,0,0,0,0,0,ef90,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        efd2,0,efd4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,effb,effc,0,0,0,0,0,0,0,e1004,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e101a,0,0,0,0,0,0,0,0,0,e1024,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e103d,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e104e,0,0,0,0,e1053,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e106b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e108c,0,0,0,0,e1091,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e10b9,0,0,0,0,0,0,0,0,
-        0,e10c3,0,0,0,0,e10c8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e10dd,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e111b,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e1144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e1159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e11c9,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e11d7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e11fd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e124a,0,0,0,0,0,0,0,0,0,0,0,0,e1257,0,e1259,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e1287,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e130b,0,0,0,0,0,0,0,0,0,0,e1316,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1352,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e1362,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e1374,0,0,0,0,0,0,0,0,0,0,0,0,0,e1382,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e1395,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e13a4,0,0,e13a7,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e13c8,0,0,0,0,0,
-        0,0,e13d0,0,0,0,0,0,0,0,0,0,0,0,0,e13dd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e13fe,0,0,0,0,e1403,0,e1405,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e141a,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1456,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e14a9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e14c6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e14ee,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e151b,0,0,0,0,0,0,0,0,0,e1525,0,0,0,0,0,0,0,0,0,0,0,e1531,0,0,0,e1535,
-        0,0,0,0,0,0,0,0,e153e,0,0,0,0,0,0,e1545,0,0,0,0,0,0,0,0,0,e154f,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e156d,0,0,0,0,
-        0,0,0,0,0,0,0,0,e157a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e15bf,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e15e2,0,0,0,0,0,0,0,
-        0,0,e15ec,0,0,0,0,0,0,0,0,e15f5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1636,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e1667,e1668,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e1683,0,0,0,e1687,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e169c,0,
-        0,0,0,e16a1,0,0,0,0,0,0,0,0,e16aa,0,0,0,0,0,0,0,0,0,0,0,0,e16b7,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e16df,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e175b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e176f,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1786,0,0,0,0,0,0,e178d,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e17a4,0,0,0,0,0,0,0,
-        e17ac,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e17cf,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1802,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1816,0,0,0,e181a,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e187f,0,0,0,0,0,0,0,e1887,e1888,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e18a4,0,0,0,0,0,0,0,0,0,0,0,0,0,e18b2,0,0,e18b5,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e18fa,0,0,0,0,0,0,0,0,0,0,e1905,0,0,0,0,0,0,0,e190d,0,0,0,0,0,0,
-        0,e1915,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1927,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e194c,0,0,0,
-        0,0,0,0,0,0,e1956,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1967,0,0,0,0,0,e196d,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e197b,0,0,0,0,0,0,0,0,0,0,0,0,0,e1989,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e19ab,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e19d4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e19f5,0,0,0,0,0,0,0,0,0,0,0,0,0,e1a03,
-        0,0,0,0,e1a08,e1a09,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1a18,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e1a61,0,0,0,0,0,0,0,0,0,e1a6b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e1a7c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1acf,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e1ae2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e1b15,0,0,e1b18,0,0,0,0,e1b1d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1b3e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e1b58,0,0,0,0,0,0,0,0,0,0,e1b63,0,0,0,e1b67,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1b82,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1b9f,e1ba0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1bbe,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e1c04,0,0,0,0,0,0,0,0,0,0,0,0,0,e1c12,0,0,0,0,0,0,0,e1c1a,0,0,0,0,0,
-        0,e1c21,0,0,0,0,0,0,0,0,e1c2a,0,0,0,0,0,0,0,0,0,0,e1c35,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1cab,0,0,0,0,0,0,0,e1cb3,0,0,
-        e1cb6,0,0,0,0,0,0,0,0,e1cbf,0,e1cc1,0,0,0,0,0,0,0,0,0,0,0,0,e1cce,0,0,0,0,0,
-        e1cd4,0,0,0,0,0,0,0,0,0,0,0,0,0,e1ce2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e1cfe,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1d46,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e1d59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e1d88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1dd2,0,0,0,0,e1dd7,0,0,e1dda,0,e1ddc,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e1ded,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e1e28,0,0,0,0,0,0,0,0,0,0,0,0,0,e1e36,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e1e80,0,0,e1e83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e1e9b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1ecd,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1f02,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e1f49,
-        0,0,0,0,0,0,0,0,0,e1f53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e1f71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e1f8c,0,0,0,0,0,e1f92,0,0,0,0,0,0,0,0,e1f9b,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e1fac,0,0,0,0,0,e1fb2,e1fb3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e2020,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e203a,0,e203c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2056,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e206c,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2085,0,0,0,0,0,0,0,0,0,0,e2090,0,0,0,
-        0,0,0,0,e2098,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e20ab,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e20c5,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e20d8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e20e9,0,0,0,0,
-        0,0,0,0,0,e20f3,0,e20f5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2106,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2118,0,0,0,0,0,e211e,0,0,0,0,e2123,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2147,
-        0,0,0,0,0,0,0,e214f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e2166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e217d,0,0,0,0,0,0,
-        0,e2185,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e21b8,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e21e0,0,e21e2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e21fd,0,0,0,0,e2202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e221c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e222f,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2248,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e2256,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2283,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e22c3,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e22d2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e2333,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2342,e2343,0,0,
-        0,0,e2348,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2374,0,0,0,e2378,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2390,0,0,0,0,0,0,0,0,0,0,0,0,e239d,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e23cf,0,0,0,e23d3,e23d4,0,0,0,0,e23d9,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e23f4,0,0,0,e23f8,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2411,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2435,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2488,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e249d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e24d1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e251d,0,0,e2520,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e256d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e2585,e2586,0,0,0,0,0,0,0,0,0,e2590,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e25a1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e25b0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e25cf,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,e25e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e262f,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2640,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e2673,0,0,0,0,e2678,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e269c,0,e269e,e269f,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e26b1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e26c0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e26cf,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e26e1,0,0,0,e26e5,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e271b,0,0,0,0,e2720,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e2767,0,0,0,0,e276c,0,0,0,0,0,0,0,0,e2775,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2798,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e27ac,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e27e7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e2858,0,0,e285b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2881,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2898,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e28a9,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e28c7,
-        0,0,0,0,0,0,0,e28cf,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e28f4,0,e28f6,0,0,0,0,0,0,0,0,e28ff,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2914,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e2927,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e293a,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e294a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e2964,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e297c,0,0,0,0,0,0,0,0,0,0,0,0,0,e298a,0,0,0,0,0,0,0,e2992,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e29a4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e29d4,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e29f9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2a0e,0,0,0,
-        0,0,0,0,0,0,0,e2a19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e2a32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2a60,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e2aab,0,0,0,0,0,0,0,e2ab3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e2ae5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2b1b,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2b3b,0,0,
-        0,0,0,0,0,0,0,0,e2b46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e2b5f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e2b80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2bd3,
-        e2bd4,0,0,0,0,0,0,0,0,0,e2bde,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c02,0,0,e2c05,0,0,0,e2c09,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c28,0,0,0,0,0,
-        0,0,0,0,0,e2c33,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c41,e2c42,e2c43,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c66,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2c76,0,e2c78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2c99,0,0,e2c9c,0,0,0,0,0,0,e2ca3,0,0,
-        0,0,0,0,0,0,0,0,0,0,e2cb0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e2ccf,0,0,0,0,0,0,0,0,0,0,0,e2cdb,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2cf2,0,0,0,0,e2cf7,0,0,0,0,0,e2cfd,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e2d5c,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e2d7f,0,0,0,0,0,0,e2d86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2d95,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e2df5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2e0a,0,0,0,
-        e2e0e,0,0,0,e2e12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2e41,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2e67,
-        e2e68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2e7f,0,0,0,0,0,0,
-        0,e2e87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2ef5,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e2f28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e2f49,0,0,e2f4c,0,0,0,0,0,0,e2f53,0,e2f55,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e2f78,0,0,0,0,0,0,0,0,0,0,0,0,e2f85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e2ff5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,e3030,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e3053,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e30aa,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e30be,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e30ec,0,0,0,0,0,0,0,0,e30f5,0,e30f7,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e311b,0,e311d,0,0,0,0,0,0,0,0,0,0,0,0,e312a,0,0,0,0,0,0,0,0,0,0,0,e3136,0,
-        0,0,0,0,0,0,0,0,0,e3141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e316a,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3182,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e31a6,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e31f4,0,0,0,0,0,0,e31fb,0,0,0,0,0,0,0,e3203,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e3212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e322a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3263,
-        0,0,0,0,0,0,0,0,0,0,e326e,0,0,0,0,0,0,0,0,0,0,e3279,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e32a5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e32fb,0,0,0,0,0,0,e3302,0,0,0,0,0,0,e3309,e330a,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e336d,e336e,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e338b,0,e338d,0,e338f,
-        e3390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e33d5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e342f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3454,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e346b,0,0,0,0,0,0,0,0,e3474,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e349c,0,
-        0,0,0,0,0,0,0,e34a5,0,e34a7,0,0,0,0,0,0,0,0,0,e34b1,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3509,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e351e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3543,0,0,0,0,0,0,0,0,0,0,0,0,e3550,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e355e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e356f,
-        0,0,0,e3573,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e358c,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e35d4,0,0,0,0,0,0,0,0,e35dd,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e35ec,e35ed,0,0,0,0,0,0,0,0,0,0,0,0,0,e35fb,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,e360f,0,0,0,0,e3614,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e3625,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e364a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e365c,0,0,0,
-        0,0,0,0,0,e3665,0,0,0,0,0,0,0,0,0,0,e3670,0,0,e3673,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e36b1,0,0,0,0,0,e36b7,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e36dd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e36f2,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,e3718,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e3750,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e377d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e3791,0,0,0,0,0,0,0,0,0,0,e379c,0,0,0,0,0,0,0,0,0,e37a6,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e37e5,
-        0,0,0,0,0,0,0,0,0,0,e37f0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e3866,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e387f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,e38a2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e38b6,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e38d6,e38d7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e390e,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e392f,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e3991,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e39d1,0,0,0,0,0,0,0,0,e39da,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e39eb,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3a01,
-        0,e3a03,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e3a20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3a34,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3a6d,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,e3aa4,0,0,0,0,0,0,0,0,0,0,0,0,e3ab1,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3ac8,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3ae5,e3ae6,0,0,0,0,0,0,0,0,0,0,e3af1,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3b0a,0,e3b0c,0,0,0,
-        0,0,0,0,e3b14,e3b15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3b5f,0,0,0,0,0,0,0,e3b67,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3b81,0,0,0,0,0,0,
-        0,e3b89,0,e3b8b,0,0,0,0,0,0,0,0,0,0,e3b96,0,0,0,0,0,0,0,0,0,0,0,0,e3ba3,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3bbf,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,e3be7,0,0,0,0,0,0,0,0,e3bf0,0,0,0,0,0,0,0,0,0,e3bfa,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e3c0a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e3c3d,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e3c82,0,0,0,0,0,e3c88,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,e3cfa,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,e3d6b,0,0,e3d6e,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,e3d8d,0,e3d8f,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3dbf,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3dfa,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        e3e1c,0,0,0,0,0,e3e22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3e34,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3ed2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3efd,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,e3f4a,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,e3f8f,0,e3f91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,e3fa3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,e3fd8,0,0,0,0,0,
-        0,0,0,e3fe1,0,0,0,0,0,0,0,0,0,0,0,0,e3fee,0,0,0,0,0,0,0,0,0,0,0,0,0,
-        0,0,0,0
-    };
+/* ---- Per-context extension support cache (generated) ----
+ * A context cache shared by all threads; see "Context caches" in glatter_def.h. */
+GLATTER_LINKONCE glatter_context_cache_t glatter_es_cache_GL;
 
+/* Optional: public invalidation for this family. */
+GLATTER_INLINE_OR_NOT void glatter_invalidate_extension_cache_GL(void) {
+    GLATTER_REGISTRY_FORWARD_INVALIDATE(GL);
+    glatter_context_cache_clear_(&glatter_es_cache_GL);
+}
 
+/* Returns the extension bitset of the current context. The set is shared by
+ * all threads and stays valid for the process (see "Context caches" in
+ * glatter_def.h); once the cache is invalidated, the next call builds a new
+ * one. Without a current context it points to an all-zero set. */
+GLATTER_INLINE_OR_NOT
+const glatter_extension_support_status_GL_t* glatter_get_extension_support_GL(void)
+{
+    /* 0) With GLATTER_SHARED_REGISTRY, the root instance's cache may serve this one. */
+    GLATTER_REGISTRY_FORWARD_EXTENSIONS(GL);
 
-        const uint8_t* glv = NULL;
-        if (glatter_get_proc_address_GL("glGetString")) {
-            glv = (const uint8_t*)glatter_glGetString(GL_VERSION);
-        }
-        int new_way = 0;
-        if (!glv) {
-            return ess;
-        }
-        if (glv[0] < '0' || glv[0] > '9') {
-            new_way = 0;
-        }
-        else {
-            new_way = glv[0] > '2'; // i.e. gl version is 3 or higher
-        }
+    /* 1) Compute a key for the current context; 0 means "no current context". */
+    uintptr_t ctx_handle;
+    uintptr_t ctx_key = glatter_current_gl_context_(&ctx_handle);
 
-#ifdef GL_NUM_EXTENSIONS
-        if (new_way && glatter_get_proc_address_GL("glGetStringi") ) {
-            GLint n = 0; 
-            glGetIntegerv(GL_NUM_EXTENSIONS, &n); 
-            for (GLint i=0; i<n; i++)  { 
-                uint32_t hash = glatter_djb2( (const uint8_t*)glatter_glGetStringi(GL_EXTENSIONS, i) );
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-                if (index == -1) {
-                    // (1) This scope will be reached if the implementation supports an extension
-                    // not listed in the headers. This may happen if the headers are old or the
-                    // extension is deprecated. The same condition repeats two more times below.
-                    // It is not an error, thus there is nothing to do.
-                    // The statement is left for debug purposes.
-                }
-            }
-        }
-        else {
-#endif
-            uint32_t hash = 5381;
-            const uint8_t* ext_str = (const uint8_t*)glatter_glGetString(GL_EXTENSIONS);
-            for ( ; ext_str && *ext_str; ext_str++) {
-                if (*ext_str == ' ') {
-                    int index = -1;
-                    rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                    for ( ; r && (r->hash | r->index); r++ ) {
-                        if (r->hash == hash) {
-                            index = r->index;
-                            indexed_extensions[index] = 1;
-                            break;
-                        }
-                    }
+    /* 2) If no current context, report no extensions without touching the cache. */
+    if (ctx_key == (uintptr_t)0) {
+        return &glatter_context_info_none_GL.extensions;
+    }
 
-                    if (index == -1) {
-                        // (2)
-                    }
+    /* 3) Cache lookup, shared by all threads. */
+    const glatter_extension_support_status_GL_t* cached = (const glatter_extension_support_status_GL_t*)
+        glatter_context_cache_find_(&glatter_es_cache_GL, ctx_key);
+    if (cached) {
+        return cached; /* HIT */
+    }
 
-                    // reset
-                    hash = 5381;
-                    continue;
-                }
+    /* 4) MISS: build the bitset for the *current* context in a new entry,
+     * which is published only once complete. An early return below frees it
+     * and leaves nothing cached. */
+    glatter_context_set_t* set = glatter_context_set_new_(ctx_key, ctx_handle, sizeof(glatter_context_info_GL_t));
+    if (!set) {
+        return &glatter_context_info_none_GL.extensions;
+    }
+    glatter_context_info_GL_t* info = (glatter_context_info_GL_t*)glatter_context_set_data_(set);
+    glatter_extension_support_status_GL_t* ess = &info->extensions;
 
-                hash = ((hash << 5) + hash) + (int)(*ext_str);
+    const uint8_t* glv = NULL;
+    if (glatter_get_proc_address_GL("glGetString")) {
+        glv = (const uint8_t*)glatter_glGetString(GL_VERSION);
+    }
+    if (!glv) {
+        free(set);
+        return &glatter_context_info_none_GL.extensions;
+    }
+    glatter_query_context_caps_GL_(&info->caps, glv);
 
-            }
-            if (ext_str && hash != 5381) {
-                int index = -1;
-                rt* r = es_dispatch[ hash & (GLATTER_LOOKUP_SIZE-1) ];
-                for ( ; r && (r->hash | r->index); r++ ) {
-                    if (r->hash == hash) {
-                        index = r->index;
-                        indexed_extensions[index] = 1;
-                        break;
-                    }
-                }
-                if (index == -1) {
-                    // (3)
-                }
-            }
 #ifdef GL_NUM_EXTENSIONS
+    if (info->caps.major >= 3 && glatter_get_proc_address_GL("glGetStringi")) {
+        GLint n = 0;
+        glatter_glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+        for (GLint i = 0; i < n; i++) {
+            const uint8_t* name = (const uint8_t*)glatter_glGetStringi(GL_EXTENSIONS, i);
+            if (name) {
+                glatter_extension_mark_(ess->bits, &glatter_ext_table_GL, name, strlen((const char*)name));
+            }
         }
+    }
+    else
 #endif
+    {
+        glatter_extension_mark_list_(ess->bits, &glatter_ext_table_GL,
+            (const uint8_t*)glatter_glGetString(GL_EXTENSIONS));
+    }
 
-    // Map array to a struct without undefined behaviour.
-    // No actual copy is performed with even basic optimization e.g.: -Og
-    memcpy((void*)&ess, indexed_extensions, sizeof(ess));
-
-    glatter_es_cache_GL[glatter_es_cache_pos_GL].key = ctx_key;
-    glatter_es_cache_GL[glatter_es_cache_pos_GL].ess = ess;
-    glatter_es_cache_pos_GL = (glatter_es_cache_pos_GL + 1) % GLATTER_ES_CACHE_SLOTS;
+    return (const glatter_extension_support_status_GL_t*)
+        glatter_context_cache_publish_(&glatter_es_cache_GL, set);
+}
 
-    return ess;
+/* Returns the version, profile and limits of the current context. They are
+ * queried with its extensions, cached with them and invalidated with them.
+ * Without a current context every field is 0. */
+GLATTER_INLINE_OR_NOT
+const glatter_context_caps_t* glatter_get_context_caps(void)
+{
+    /* Every GL set, including the empty one, is a glatter_context_info_GL_t. */
+    return &((const glatter_context_info_GL_t*)glatter_get_extension_support_GL())->caps;
 }
 
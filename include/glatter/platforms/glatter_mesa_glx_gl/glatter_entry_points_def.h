@@ -0,0 +1,4396 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Perfect hash of every entry point name known to this platform, used by
+ * glatter_get_proc_address to cache resolved addresses (see glatter_def.h).
+ * The arrays are not const so that they can be link-once in header-only mode,
+ * but nothing writes to them. */
+
+#define GLATTER_ENTRY_POINT_COUNT 3127
+#define GLATTER_ENTRY_POINT_SLOTS 4096
+#define GLATTER_ENTRY_POINT_BUCKETS 2048
+
+GLATTER_LINKONCE uint32_t glatter_entry_point_seeds[GLATTER_ENTRY_POINT_BUCKETS] = {
+    2, 0, 2, 0, 1, 1, 1, 1,
+    1, 0, 3, 1, 1, 0, 0, 1,
+    1, 2, 0, 2, 1, 4, 3, 0,
+    2, 3, 1, 1, 1, 3, 2, 4,
+    1, 0, 1, 2, 1, 3, 0, 0,
+    1, 2, 3, 1, 0, 0, 0, 3,
+    1, 3, 0, 2, 3, 0, 1, 4,
+    0, 2, 1, 2, 0, 1, 3, 0,
+    1, 5, 4, 1, 1, 2, 0, 3,
+    1, 5, 0, 0, 0, 1, 1, 0,
+    1, 1, 4, 0, 6, 1, 2, 0,
+    1, 1, 0, 1, 3, 1, 1, 0,
+    3, 0, 3, 1, 2, 0, 1, 0,
+    1, 1, 1, 1, 3, 3, 0, 1,
+    3, 1, 3, 1, 2, 5, 1, 4,
+    1, 0, 1, 6, 1, 0, 1, 1,
+    3, 5, 2, 1, 0, 2, 0, 1,
+    1, 1, 2, 6, 1, 1, 2, 1,
+    2, 4, 13, 2, 9, 0, 1, 3,
+    2, 3, 0, 4, 0, 1, 2, 0,
+    1, 5, 1, 7, 2, 2, 0, 1,
+    0, 1, 8, 1, 1, 1, 3, 2,
+    0, 3, 3, 1, 2, 0, 1, 0,
+    1, 2, 1, 2, 2, 1, 2, 0,
+    2, 4, 3, 1, 3, 1, 3, 3,
+    4, 1, 3, 1, 1, 1, 1, 1,
+    1, 3, 0, 1, 1, 1, 3, 0,
+    1, 1, 1, 3, 0, 1, 2, 1,
+    1, 1, 1, 1, 0, 1, 4, 0,
+    1, 2, 1, 1, 1, 3, 1, 2,
+    2, 2, 1, 16, 0, 1, 0, 0,
+    1, 0, 0, 7, 0, 1, 1, 2,
+    0, 6, 4, 0, 4, 3, 1, 3,
+    1, 5, 0, 2, 2, 0, 1, 1,
+    2, 0, 3, 3, 2, 1, 0, 1,
+    0, 2, 0, 0, 5, 1, 1, 1,
+    2, 0, 3, 1, 1, 0, 1, 1,
+    1, 0, 4, 0, 1, 2, 0, 3,
+    1, 1, 3, 2, 1, 4, 2, 4,
+    0, 5, 1, 2, 0, 3, 0, 0,
+    1, 1, 1, 4, 2, 0, 0, 2,
+    4, 2, 0, 1, 1, 1, 5, 1,
+    1, 0, 2, 2, 5, 5, 2, 1,
+    1, 1, 1, 5, 3, 5, 1, 2,
+    7, 1, 1, 2, 0, 4, 2, 0,
+    2, 5, 0, 8, 3, 1, 1, 0,
+    1, 1, 2, 1, 1, 3, 3, 3,
+    0, 0, 1, 0, 1, 2, 1, 1,
+    2, 3, 1, 0, 0, 0, 5, 3,
+    4, 2, 4, 1, 3, 1, 0, 0,
+    1, 0, 0, 2, 0, 2, 3, 11,
+    1, 1, 1, 1, 5, 1, 0, 1,
+    2, 1, 0, 1, 10, 2, 3, 0,
+    1, 2, 0, 2, 2, 0, 5, 3,
+    0, 2, 3, 1, 3, 2, 2, 1,
+    3, 3, 3, 2, 0, 1, 1, 1,
+    3, 0, 1, 1, 4, 8, 1, 1,
+    4, 9, 2, 1, 2, 1, 4, 0,
+    0, 0, 6, 2, 2, 2, 1, 1,
+    1, 3, 3, 0, 6, 1, 3, 0,
+    1, 1, 1, 1, 2, 1, 1, 1,
+    3, 1, 6, 2, 1, 1, 6, 1,
+    0, 1, 3, 6, 2, 1, 1, 2,
+    0, 1, 1, 1, 2, 0, 1, 2,
+    4, 5, 8, 1, 1, 3, 0, 0,
+    3, 3, 0, 2, 3, 2, 0, 2,
+    3, 1, 1, 2, 0, 2, 2, 1,
+    5, 1, 1, 1, 2, 0, 0, 4,
+    0, 1, 2, 2, 3, 5, 5, 4,
+    1, 0, 5, 2, 7, 1, 2, 2,
+    1, 2, 10, 3, 1, 0, 1, 4,
+    1, 2, 9, 2, 2, 1, 1, 1,
+    2, 1, 2, 2, 3, 3, 1, 1,
+    6, 5, 1, 2, 1, 8, 4, 4,
+    0, 9, 1, 5, 1, 1, 0, 0,
+    3, 2, 1, 8, 2, 0, 1, 1,
+    2, 4, 2, 3, 0, 3, 2, 3,
+    1, 1, 0, 7, 1, 2, 1, 5,
+    1, 4, 0, 3, 1, 1, 4, 7,
+    3, 5, 2, 2, 0, 3, 2, 8,
+    1, 0, 1, 1, 1, 2, 5, 0,
+    2, 2, 2, 8, 1, 1, 0, 0,
+    4, 3, 0, 0, 3, 0, 0, 0,
+    1, 2, 6, 0, 7, 1, 0, 3,
+    0, 1, 0, 1, 2, 2, 1, 0,
+    2, 2, 3, 0, 3, 2, 0, 4,
+    3, 0, 4, 1, 10, 0, 1, 4,
+    1, 6, 2, 1, 1, 0, 0, 1,
+    1, 3, 0, 4, 4, 1, 1, 4,
+    0, 1, 1, 5, 1, 1, 2, 5,
+    5, 1, 5, 3, 1, 0, 2, 4,
+    0, 1, 2, 0, 2, 1, 1, 0,
+    0, 1, 2, 6, 2, 1, 2, 3,
+    0, 0, 1, 2, 3, 1, 5, 1,
+    1, 8, 1, 0, 0, 1, 2, 1,
+    2, 1, 2, 4, 6, 1, 1, 0,
+    3, 4, 0, 3, 2, 3, 0, 7,
+    3, 0, 0, 0, 13, 3, 0, 5,
+    2, 0, 1, 2, 3, 1, 1, 3,
+    5, 1, 1, 0, 4, 1, 4, 2,
+    1, 1, 1, 0, 2, 2, 1, 6,
+    0, 2, 4, 1, 3, 0, 1, 1,
+    1, 1, 1, 7, 1, 4, 0, 1,
+    2, 1, 1, 0, 3, 6, 1, 2,
+    0, 1, 12, 1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 1, 0, 2,
+    1, 0, 1, 3, 0, 0, 3, 1,
+    0, 1, 0, 2, 0, 2, 2, 3,
+    6, 2, 0, 0, 2, 3, 0, 2,
+    1, 1, 2, 1, 5, 1, 8, 1,
+    5, 1, 8, 7, 0, 1, 1, 0,
+    4, 1, 1, 0, 3, 0, 3, 2,
+    9, 4, 1, 3, 2, 9, 2, 2,
+    0, 0, 0, 1, 1, 5, 0, 1,
+    2, 1, 4, 1, 1, 1, 1, 5,
+    2, 7, 3, 0, 5, 1, 1, 3,
+    6, 1, 3, 1, 1, 0, 2, 0,
+    0, 2, 3, 4, 2, 0, 0, 2,
+    1, 0, 3, 0, 1, 2, 3, 2,
+    4, 6, 0, 0, 2, 3, 2, 1,
+    3, 2, 2, 0, 2, 2, 2, 1,
+    0, 2, 7, 1, 0, 4, 0, 0,
+    1, 1, 3, 3, 1, 1, 2, 1,
+    2, 4, 0, 3, 3, 2, 8, 1,
+    3, 1, 2, 2, 0, 2, 1, 1,
+    9, 1, 1, 1, 1, 7, 1, 1,
+    2, 6, 4, 4, 1, 1, 8, 0,
+    1, 3, 4, 2, 4, 1, 0, 0,
+    1, 8, 7, 1, 1, 1, 0, 4,
+    5, 2, 3, 1, 0, 2, 2, 0,
+    2, 0, 0, 2, 1, 0, 4, 4,
+    0, 1, 0, 0, 2, 2, 1, 2,
+    2, 2, 1, 0, 4, 1, 0, 1,
+    3, 0, 1, 2, 1, 1, 3, 1,
+    1, 1, 4, 1, 1, 1, 1, 1,
+    3, 1, 1, 4, 3, 2, 0, 7,
+    0, 0, 1, 4, 0, 2, 0, 0,
+    3, 3, 2, 1, 2, 2, 1, 1,
+    1, 6, 5, 2, 2, 3, 6, 1,
+    5, 2, 8, 4, 1, 1, 0, 1,
+    1, 2, 2, 2, 8, 1, 2, 2,
+    2, 3, 5, 5, 0, 7, 1, 0,
+    2, 0, 0, 0, 0, 6, 2, 3,
+    3, 1, 1, 3, 3, 12, 2, 4,
+    1, 1, 1, 4, 0, 0, 5, 13,
+    1, 6, 0, 1, 1, 5, 5, 11,
+    4, 4, 3, 1, 1, 8, 2, 4,
+    4, 3, 2, 7, 3, 3, 2, 2,
+    6, 2, 2, 1, 5, 2, 6, 5,
+    0, 2, 6, 5, 2, 2, 2, 4,
+    11, 1, 1, 2, 1, 2, 3, 0,
+    1, 0, 4, 1, 1, 1, 3, 1,
+    1, 3, 3, 0, 4, 4, 2, 3,
+    1, 0, 1, 5, 4, 0, 6, 0,
+    3, 1, 9, 6, 1, 2, 0, 2,
+    2, 1, 2, 4, 0, 1, 4, 1,
+    1, 0, 0, 7, 1, 5, 0, 0,
+    4, 3, 4, 2, 0, 1, 2, 4,
+    3, 6, 0, 1, 0, 1, 3, 1,
+    2, 1, 2, 5, 3, 4, 2, 11,
+    1, 2, 1, 2, 2, 0, 0, 0,
+    12, 1, 1, 4, 1, 3, 0, 1,
+    3, 0, 1, 2, 6, 0, 1, 0,
+    10, 4, 6, 0, 0, 4, 7, 7,
+    2, 1, 1, 0, 1, 2, 1, 6,
+    1, 3, 3, 0, 2, 0, 3, 3,
+    2, 7, 1, 0, 2, 0, 13, 3,
+    2, 2, 2, 2, 3, 2, 7, 7,
+    1, 0, 1, 5, 1, 2, 5, 0,
+    1, 3, 16, 2, 1, 1, 0, 0,
+    3, 0, 0, 1, 0, 0, 1, 8,
+    1, 5, 2, 1, 4, 2, 5, 5,
+    0, 1, 1, 1, 15, 3, 2, 2,
+    1, 0, 1, 3, 3, 13, 3, 0,
+    2, 0, 0, 0, 0, 2, 0, 8,
+    0, 1, 0, 0, 15, 1, 1, 1,
+    1, 5, 1, 6, 2, 0, 5, 1,
+    12, 1, 1, 1, 7, 3, 2, 2,
+    0, 4, 2, 0, 0, 3, 3, 1,
+    1, 2, 1, 13, 2, 3, 10, 3,
+    1, 2, 10, 0, 3, 10, 1, 15,
+    0, 1, 0, 0, 5, 0, 10, 0,
+    5, 4, 2, 2, 3, 3, 6, 3,
+    5, 2, 1, 1, 3, 3, 1, 5,
+    8, 5, 0, 0, 1, 6, 10, 10,
+    1, 2, 1, 4, 2, 1, 0, 2,
+    3, 1, 1, 1, 1, 3, 0, 0,
+    2, 5, 0, 0, 0, 3, 6, 1,
+    1, 0, 0, 3, 3, 14, 3, 1,
+    5, 10, 1, 2, 2, 6, 6, 0,
+    2, 1, 2, 5, 13, 3, 8, 0,
+    1, 17, 2, 2, 0, 2, 5, 4,
+    2, 4, 1, 0, 9, 1, 4, 1,
+    0, 3, 2, 22, 1, 0, 1, 0,
+    1, 6, 7, 2, 0, 1, 2, 4,
+    1, 14, 3, 0, 11, 2, 1, 15,
+    3, 3, 0, 4, 7, 2, 3, 0,
+    0, 4, 11, 9, 3, 0, 2, 1,
+    1, 2, 1, 3, 3, 3, 3, 2,
+    0, 1, 3, 0, 4, 6, 3, 1,
+    2, 1, 1, 3, 7, 4, 1, 9,
+    1, 3, 2, 2, 0, 5, 3, 4,
+    12, 0, 0, 1, 2, 0, 2, 2,
+    13, 2, 8, 1, 0, 3, 1, 1,
+    3, 0, 3, 6, 5, 3, 5, 3,
+    0, 2, 17, 0, 0, 7, 2, 2,
+    0, 0, 0, 2, 3, 0, 8, 3,
+    18, 0, 4, 0, 1, 0, 2, 1,
+    0, 5, 2, 2, 0, 2, 1, 1,
+    1, 3, 2, 2, 4, 1, 1, 1,
+    0, 0, 0, 1, 1, 0, 7, 2,
+    1, 2, 4, 8, 4, 0, 1, 0,
+    1, 0, 0, 3, 1, 3, 4, 1,
+    0, 10, 1, 0, 12, 0, 2, 2,
+    2, 4, 0, 2, 7, 1, 1, 12,
+    13, 3, 1, 1, 2, 1, 5, 0,
+    3, 8, 2, 6, 1, 3, 1, 4,
+    6, 0, 12, 6, 0, 11, 5, 2,
+    13, 0, 0, 1, 5, 5, 14, 1,
+    2, 4, 1, 3, 0, 0, 2, 0,
+    3, 1, 1, 0, 15, 1, 0, 6,
+    5, 2, 17, 5, 3, 7, 8, 5,
+    0, 4, 1, 1, 2, 0, 1, 0,
+    0, 3, 1, 15, 4, 3, 3, 3,
+    3, 1, 1, 0, 0, 8, 0, 3,
+    2, 23, 0, 8, 2, 17, 0, 3,
+    1, 4, 7, 2, 4, 0, 1, 5,
+    12, 0, 0, 1, 4, 4, 0, 1,
+    1, 0, 2, 0, 9, 1, 5, 0,
+    1, 1, 2, 0, 1, 2, 2, 5,
+    1, 10, 2, 3, 18, 1, 6, 1,
+    4, 8, 4, 0, 3, 4, 3, 2,
+    17, 0, 0, 2, 4, 0, 1, 4,
+    0, 1, 5, 2, 5, 1, 2, 3,
+    4, 4, 2, 1, 1, 5, 13, 0,
+    9, 1, 1, 5, 2, 6, 3, 0,
+    3, 0, 13, 1, 2, 1, 11, 1,
+    0, 6, 0, 0, 5, 0, 0, 5,
+    4, 1, 1, 5, 2, 1, 1, 1,
+    2, 0, 1, 2, 9, 5, 1, 4,
+    1, 5, 1, 1, 1, 7, 0, 4,
+    1, 0, 3, 1, 1, 0, 0, 3,
+    0, 13, 1, 2, 7, 0, 3, 0,
+    0, 8, 10, 0, 0, 0, 2, 2,
+    5, 9, 0, 0, 1, 0, 0, 3,
+    3, 2, 0, 18, 3, 9, 11, 0,
+    0, 10, 0, 4, 0, 1, 2, 2,
+    0, 2, 4, 2, 0, 10, 6, 9,
+    1, 35, 1, 5, 4, 1, 0, 1,
+    8, 5, 2, 3, 0, 1, 0, 2,
+    2, 0, 0, 1, 6, 2, 24, 4,
+    2, 2, 3, 0, 6, 6, 1, 19,
+    4, 3, 0, 6, 9, 0, 7, 2,
+    4, 0, 7, 4, 5, 8, 0, 3,
+    4, 6, 0, 6, 5, 0, 2, 2,
+    0, 0, 2, 15, 1, 11, 1, 1,
+};
+
+GLATTER_LINKONCE const char* glatter_entry_point_names[GLATTER_ENTRY_POINT_SLOTS] = {
+    "glBindVertexBuffers",
+    "glGetVariantArrayObjectivATI",
+    "glStencilStrokePathNV",
+    "glGetMinmaxParameteriv",
+    "glPointParameteriNV",
+    "glStencilThenCoverStrokePathNV",
+    NULL,
+    "glFogCoordhNV",
+    "glMultiTexSubImage2DEXT",
+    "glBindBuffer",
+    NULL,
+    "glEdgeFlagPointerListIBM",
+    "glNamedProgramLocalParameterI4ivEXT",
+    "glMultiTexCoord4fARB",
+    "glBlendFuncIndexedAMD",
+    "glProgramUniformMatrix3x4fvEXT",
+    NULL,
+    "glLineStipple",
+    NULL,
+    NULL,
+    "glSecondaryColor3uiEXT",
+    "glVertexAttribPointer",
+    "glFogi",
+    NULL,
+    "glGetCommandHeaderNV",
+    "glProgramParameters4fvNV",
+    "glVertexAttribP4ui",
+    "glColorPointerListIBM",
+    "glTextureMaterialEXT",
+    NULL,
+    "glBufferPageCommitmentARB",
+    "glDrawArraysInstancedEXT",
+    NULL,
+    "glPushAttrib",
+    NULL,
+    NULL,
+    "glResetMinmax",
+    "glIndexPointer",
+    "glVertexStream2ivATI",
+    NULL,
+    "glGenFramebuffers",
+    "glLoadMatrixxOES",
+    "glUniformMatrix4fv",
+    "glPopMatrix",
+    "glDrawBuffersATI",
+    NULL,
+    NULL,
+    "glEvalMapsNV",
+    NULL,
+    NULL,
+    "glGetnMapivARB",
+    NULL,
+    "glMemoryObjectParameterivEXT",
+    "glVertexAttribL1dvEXT",
+    "glTexCoord2hvNV",
+    "glVertexAttribL4dEXT",
+    "glGetnCompressedTexImageARB",
+    "glGetPathLengthNV",
+    NULL,
+    NULL,
+    "glReferencePlaneSGIX",
+    "glSecondaryColorP3uiv",
+    "glProgramUniform3ui64vARB",
+    "glSecondaryColor3sEXT",
+    "glApplyFramebufferAttachmentCMAAINTEL",
+    NULL,
+    NULL,
+    "glUniformMatrix3x2fv",
+    "glMapGrid2d",
+    NULL,
+    "glWindowPos2fvMESA",
+    "glTexGeniv",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+    "glFinalCombinerInputNV",
+    "glPixelTransferxOES",
+    "glGetConvolutionFilter",
+    "glVertexAttrib2sv",
+    "glGetIntegerui64vNV",
+    "glRasterPos4i",
+    "glClearAccumxOES",
+    NULL,
+    NULL,
+    "glProgramUniform1ui",
+    "glGenerateMipmapEXT",
+    "glPolygonStipple",
+    "glPatchParameterfv",
+    NULL,
+    NULL,
+    "glMulticastViewportArrayvNVX",
+    "glTexEnvfv",
+    "glCompressedTexSubImage3DARB",
+    "glPointParameteriv",
+    NULL,
+    "glXGetVideoInfoNV",
+    NULL,
+    NULL,
+    "glMultTransposeMatrixfARB",
+    "glRasterPos4s",
+    NULL,
+    "glVertexAttribI3iv",
+    "glTextureRangeAPPLE",
+    "glMulticastBarrierNV",
+    "glGetIntegeri_v",
+    "glTexStorage2DEXT",
+    "glTranslated",
+    "glUniformMatrix2fv",
+    "glXSet3DfxModeMESA",
+    "glGetDoublei_v",
+    "glTexCoord4fv",
+    "glFinishAsyncSGIX",
+    NULL,
+    "glDrawRangeElements",
+    "glStencilFillPathNV",
+    "glVertexAttrib4bv",
+    NULL,
+    "glMaterialf",
+    "glMultiTexGenivEXT",
+    "glPointParameterfv",
+    "glInvalidateFramebuffer",
+    "glRasterPos2d",
+    "glDrawElementsInstancedBaseInstance",
+    "glCopyPixels",
+    NULL,
+    "glProgramUniform3fEXT",
+    "glGetVideoCaptureivNV",
+    "glMultiDrawArraysIndirectBindlessNV",
+    "glListParameterfvSGIX",
+    NULL,
+    "glMultiTexCoord2dARB",
+    "glWindowPos2fARB",
+    "glBindBufferRangeNV",
+    "glUniform4ui64ARB",
+    NULL,
+    "glClearDepthf",
+    "glGetUniformuiv",
+    "glGenSemaphoresEXT",
+    "glVertexAttribI1uiv",
+    "glTexCoord4xOES",
+    "glSecondaryColor3svEXT",
+    "glEvalCoord1xOES",
+    "glTextureSubImage2D",
+    "glDepthFunc",
+    "glMultiTexCoord4d",
+    NULL,
+    NULL,
+    "glLoadTransposeMatrixfARB",
+    "glXMakeCurrentReadSGI",
+    "glLoadTransposeMatrixdARB",
+    "glCreateStatesNV",
+    "glRectxvOES",
+    NULL,
+    "glTexCoord4fColor4fNormal3fVertex4fSUN",
+    "glSecondaryColor3f",
+    "glRasterPos4d",
+    "glUniform4ui64vARB",
+    NULL,
+    "glMultiTexImage2DEXT",
+    "glTexBumpParameterivATI",
+    NULL,
+    "glUniform3i64NV",
+    "glVertexAttrib4Nsv",
+    "glMultiTexEnvfEXT",
+    NULL,
+    "glBeginPerfQueryINTEL",
+    "glCreateShader",
+    "glVertexAttribP2ui",
+    "glMultiDrawElementsIndirect",
+    "glInstrumentsBufferSGIX",
+    NULL,
+    "glVertexStream2sATI",
+    "glStencilThenCoverStrokePathInstancedNV",
+    "glDepthRangefOES",
+    "glRenderbufferStorageMultisampleAdvancedAMD",
+    "glClearAccum",
+    "glGetVertexArrayIntegervEXT",
+    "glUniform2i64ARB",
+    "glLightf",
+    "glGlobalAlphaFactorbSUN",
+    "glRasterPos2iv",
+    "glNormalStream3dvATI",
+    "glReplacementCodeubvSUN",
+    "glGetMultisamplefv",
+    "glBeginVideoCaptureNV",
+    "glVertexStream2iATI",
+    NULL,
+    "glGetCompressedTextureImageEXT",
+    "glVertexAttrib4d",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformMatrix3dv",
+    "glVertexAttrib4sv",
+    "glBindVertexBuffer",
+    "glReplacementCodeusSUN",
+    "glGetActiveUniform",
+    NULL,
+    "glFramebufferTexture2D",
+    NULL,
+    "glCopyTexSubImage3D",
+    "glPixelTransformParameterivEXT",
+    "glProgramUniformMatrix2x3dvEXT",
+    "glXDelayBeforeSwapNV",
+    "glResetHistogramEXT",
+    "glFlushMappedBufferRangeAPPLE",
+    "glVertexAttrib3dv",
+    "glColorP3uiv",
+    NULL,
+    "glTexParameterfv",
+    "glMulticastFramebufferSampleLocationsfvNV",
+    NULL,
+    "glGetVertexAttribdv",
+    "glDisable",
+    "glGenQueriesARB",
+    "glGlobalAlphaFactorsSUN",
+    NULL,
+    "glMultiTexGeniEXT",
+    "glOrthoxOES",
+    "glEndTransformFeedback",
+    "glMap2d",
+    "glMultiDrawElementsBaseVertex",
+    "glXGetVideoDeviceNV",
+    "glEnableVertexArrayAttribEXT",
+    "glClearBufferData",
+    "glMultiDrawArrays",
+    "glGetAttachedShaders",
+    "glVertexArrayVertexBuffers",
+    "glXGetProcAddress",
+    NULL,
+    "glUniform2ui64NV",
+    "glLoadTransposeMatrixf",
+    "glFrustumxOES",
+    "glGetMapiv",
+    "glLightModelf",
+    "glVertexAttrib1dNV",
+    "glAcquireKeyedMutexWin32EXT",
+    "glVertex2s",
+    "glDebugMessageControl",
+    "glDepthRangedNV",
+    NULL,
+    NULL,
+    "glCopyConvolutionFilter2D",
+    "glGetSynciv",
+    "glConvolutionParameterivEXT",
+    NULL,
+    "glIsVertexArrayAPPLE",
+    "glNamedBufferStorageExternalEXT",
+    "glIsFramebuffer",
+    NULL,
+    "glDrawArraysIndirect",
+    "glTextureParameterfEXT",
+    NULL,
+    "glNamedProgramLocalParameter4fvEXT",
+    "glUniform3f",
+    NULL,
+    "glCompressedMultiTexImage3DEXT",
+    "glGetTexLevelParameterfv",
+    NULL,
+    "glGetMultiTexLevelParameterfvEXT",
+    "glTexParameterxOES",
+    "glVertexStream2fATI",
+    "glGetnUniformi64vARB",
+    "glIsQueryARB",
+    "glGetProgramPipelineiv",
+    "glGenRenderbuffers",
+    "glGetNamedBufferPointerv",
+    "glColor4ubVertex3fvSUN",
+    "glUniformBlockBinding",
+    "glRasterPos4f",
+    "glCopyConvolutionFilter1DEXT",
+    "glViewport",
+    "glDeleteBuffers",
+    "glClearNamedBufferData",
+    NULL,
+    "glSecondaryColor3uiv",
+    NULL,
+    "glDisableVertexArrayEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glCopyTextureSubImage3DEXT",
+    "glProgramUniform2ui64vARB",
+    "glMakeTextureHandleNonResidentNV",
+    "glTexStorage1DEXT",
+    "glRasterPos3xOES",
+    "glTextureSubImage2DEXT",
+    "glWindowPos2ivARB",
+    "glGetGraphicsResetStatus",
+    NULL,
+    "glFeedbackBuffer",
+    "glMultiTexCoord4svARB",
+    "glGetnPixelMapusvARB",
+    "glUniform3ui64NV",
+    "glConvolutionParameteri",
+    "glXGetGPUInfoAMD",
+    "glSpriteParameterfSGIX",
+    "glVertexAttrib2fARB",
+    "glMultiDrawMeshTasksIndirectCountEXT",
+    "glClientWaitSync",
+    "glUniform2uiEXT",
+    "glMultiDrawArraysIndirectCount",
+    "glVertexArrayRangeAPPLE",
+    "glVertexStream4svATI",
+    NULL,
+    "glVertexArrayBindingDivisor",
+    "glSetLocalConstantEXT",
+    "glTexSubImage1D",
+    "glDeleteFencesNV",
+    "glIndexFuncEXT",
+    "glIsSync",
+    "glNamedProgramLocalParameterI4uiEXT",
+    NULL,
+    "glMakeBufferNonResidentNV",
+    "glProgramUniform3ui64NV",
+    NULL,
+    "glAlphaFunc",
+    "glCompressedMultiTexImage2DEXT",
+    "glVertexAttribL1dEXT",
+    "glGetNamedProgramLocalParameterfvEXT",
+    "glProgramUniformMatrix3x4dv",
+    "glWindowPos3i",
+    "glGetMapControlPointsNV",
+    "glProgramUniform2ui64vNV",
+    "glGetTextureLevelParameterivEXT",
+    "glGetConvolutionParameterfv",
+    "glTexStorageMem2DMultisampleEXT",
+    NULL,
+    "glGetNextPerfQueryIdINTEL",
+    NULL,
+    "glUniform4ui64NV",
+    "glGetPixelTransformParameterivEXT",
+    NULL,
+    "glFrontFace",
+    "glIsTransformFeedbackNV",
+    "glBindFramebufferEXT",
+    NULL,
+    "glImportMemoryFdEXT",
+    "glTransformFeedbackStreamAttribsNV",
+    "glWeightsvARB",
+    "glMultiDrawRangeElementArrayAPPLE",
+    "glMaxShaderCompilerThreadsKHR",
+    "glTextureStorage3DEXT",
+    "glMultiTexCoord1hNV",
+    "glVertexAttrib4usv",
+    "glPathStencilDepthOffsetNV",
+    "glColorMask",
+    "glColor3i",
+    "glXDestroyHyperpipeConfigSGIX",
+    "glClearNamedFramebufferuiv",
+    NULL,
+    "glGetMinmaxParameterfvEXT",
+    NULL,
+    "glProgramUniform1i64vARB",
+    "glGetProgramResourceLocation",
+    "glXGetFBConfigFromVisualSGIX",
+    "glXGetFBConfigs",
+    NULL,
+    "glXQueryDrawable",
+    NULL,
+    NULL,
+    "glVertexArrayVertexAttribFormatEXT",
+    NULL,
+    NULL,
+    "glVertexAttribI2i",
+    "glGetVertexArrayIndexed64iv",
+    "glFragmentLightfvSGIX",
+    "glUniformMatrix2x4dv",
+    "glProgramParameteriEXT",
+    "glBlendColorxOES",
+    "glUniform1i",
+    "glXFreeMemoryNV",
+    "glGetIntegerv",
+    "glXCreateContextWithConfigSGIX",
+    "glVertex4iv",
+    "glTexImage1D",
+    "glGetFirstPerfQueryIdINTEL",
+    "glUniformMatrix4x2dv",
+    "glTexCoord2sv",
+    "glCopyConvolutionFilter2DEXT",
+    "glTestFenceNV",
+    "glGetTransformFeedbackVaryingNV",
+    "glTranslatef",
+    "glFlushMappedNamedBufferRangeEXT",
+    "glFogCoorddEXT",
+    "glProgramUniform1uiv",
+    "glXSelectEventSGIX",
+    NULL,
+    "glProgramLocalParametersI4ivNV",
+    NULL,
+    "glGetCombinerInputParameterfvNV",
+    "glTexBufferARB",
+    "glColor4ub",
+    "glInvalidateBufferSubData",
+    "glIndexubv",
+    "glNormalPointerEXT",
+    "glProgramUniform1fvEXT",
+    "glGetBooleani_v",
+    "glVertexAttribLPointer",
+    "glStringMarkerGREMEDY",
+    NULL,
+    "glDeleteRenderbuffersEXT",
+    "glGetPointeri_vEXT",
+    "glEndQuery",
+    "glGetVertexAttribLui64vARB",
+    "glMultiDrawElementsIndirectBindlessCountNV",
+    "glGetAttribLocationARB",
+    "glGetProgramPipelineInfoLog",
+    "glCheckFramebufferStatus",
+    "glVertexAttribL1ui64NV",
+    "glVertexAttrib4Nub",
+    "glGetProgramLocalParameterIivNV",
+    "glGetVertexArrayPointervEXT",
+    "glInvalidateTexImage",
+    NULL,
+    "glXReleaseTexImageARB",
+    "glTextureParameterf",
+    "glGetVertexAttribfvARB",
+    "glEdgeFlagv",
+    "glProgramUniformMatrix4x3dv",
+    "glGetCompressedMultiTexImageEXT",
+    "glProgramUniform3f",
+    "glMultiTexCoord3xOES",
+    "glVertexAttrib4dNV",
+    "glPointParameterfvEXT",
+    "glDrawRangeElementArrayATI",
+    "glDrawTransformFeedback",
+    "glGetnSeparableFilter",
+    "glScalexOES",
+    "glSpecializeShaderARB",
+    NULL,
+    NULL,
+    NULL,
+    "glNamedBufferSubDataEXT",
+    "glImportSemaphoreWin32HandleEXT",
+    "glVDPAUSurfaceAccessNV",
+    "glFlush",
+    "glGetIntegerIndexedvEXT",
+    "glGenPathsNV",
+    NULL,
+    "glVertexAttrib4hNV",
+    "glUniform4iv",
+    "glTextureStorageMem2DMultisampleEXT",
+    "glTextureStorageMem1DEXT",
+    "glIsImageHandleResidentARB",
+    NULL,
+    "glColor3xOES",
+    "glObjectUnpurgeableAPPLE",
+    NULL,
+    "glFinishFenceAPPLE",
+    "glProgramUniformMatrix3x2dv",
+    "glVertexAttrib1fNV",
+    NULL,
+    "glGetUniformIndices",
+    "glCreatePerfQueryINTEL",
+    "glFogCoordf",
+    NULL,
+    NULL,
+    "glStencilClearTagEXT",
+    NULL,
+    "glTexCoordP1ui",
+    "glMultiTexCoord2i",
+    "glVertex4dv",
+    NULL,
+    "glMultiTexCoord1fvARB",
+    "glXQueryHyperpipeConfigSGIX",
+    NULL,
+    "glRasterPos2xOES",
+    "glBeginTransformFeedbackNV",
+    "glRasterPos4xOES",
+    "glBindMultiTextureEXT",
+    "glGetnCompressedTexImage",
+    NULL,
+    "glGetNamedProgramivEXT",
+    NULL,
+    "glScissorArrayv",
+    NULL,
+    NULL,
+    "glSecondaryColor3usvEXT",
+    "glVertexStream3sATI",
+    "glWindowPos4ivMESA",
+    "glVertex2sv",
+    "glNamedProgramLocalParametersI4ivEXT",
+    "glConvolutionFilter2DEXT",
+    "glTexImage2DMultisampleCoverageNV",
+    NULL,
+    "glProgramUniformMatrix3x4dvEXT",
+    "glBeginQuery",
+    "glMultiTexCoord3i",
+    "glGetShadingRateSampleLocationivNV",
+    NULL,
+    "glProgramLocalParameterI4ivNV",
+    "glReplacementCodeuiVertex3fvSUN",
+    "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+    NULL,
+    "glXSwapIntervalSGI",
+    NULL,
+    "glXReleaseBuffersMESA",
+    "glConvolutionParameterfv",
+    "glVertexAttribI3uivEXT",
+    "glSampleMaskIndexedNV",
+    "glScissor",
+    NULL,
+    "glRenderbufferStorageEXT",
+    "glVertexAttribL2ui64vNV",
+    NULL,
+    NULL,
+    "glStencilThenCoverFillPathNV",
+    "glProgramParameter4fvNV",
+    NULL,
+    "glUniform2dv",
+    "glNamedFramebufferReadBuffer",
+    NULL,
+    "glCopyConvolutionFilter1D",
+    NULL,
+    "glBlendEquationi",
+    NULL,
+    NULL,
+    NULL,
+    "glDebugMessageInsertAMD",
+    "glGetBufferParameteri64v",
+    "glDispatchComputeIndirect",
+    "glUniform1ui64vARB",
+    "glIsPointInFillPathNV",
+    NULL,
+    "glVertexAttribI4iEXT",
+    "glVertexAttrib4sNV",
+    "glGetMapAttribParameterivNV",
+    "glTexCoord2bOES",
+    NULL,
+    NULL,
+    NULL,
+    "glAsyncMarkerSGIX",
+    NULL,
+    "glMapObjectBufferATI",
+    "glReplacementCodeuiColor3fVertex3fvSUN",
+    "glVertexAttribP4uiv",
+    "glUniform1i64vARB",
+    "glMultiTexCoordP2uiv",
+    NULL,
+    "glGetVertexAttribPointervARB",
+    NULL,
+    NULL,
+    "glGetVertexAttribfvNV",
+    "glReplacementCodeuiNormal3fVertex3fvSUN",
+    NULL,
+    "glMakeNamedBufferNonResidentNV",
+    NULL,
+    "glXResetFrameCountNV",
+    "glRasterPos3sv",
+    "glCopyTexSubImage2D",
+    "glReadPixels",
+    NULL,
+    "glHint",
+    "glCompressedTextureSubImage2D",
+    "glXAllocateMemoryNV",
+    "glTexParameterIuiv",
+    "glMatrixPopEXT",
+    "glVertexPointerListIBM",
+    "glCompressedTexImage2D",
+    "glVertexAttrib4Nubv",
+    "glNewList",
+    "glVertexAttrib4uiv",
+    "glWeightusvARB",
+    "glGetVariantArrayObjectfvATI",
+    "glNamedFramebufferParameteriEXT",
+    "glTexStorage2DMultisample",
+    "glBlitFramebufferEXT",
+    "glStencilOpSeparateATI",
+    NULL,
+    "glVariantusvEXT",
+    "glVertexAttrib2sNV",
+    NULL,
+    NULL,
+    "glDeleteQueryResourceTagNV",
+    "glSharpenTexFuncSGIS",
+    "glBindVertexArray",
+    NULL,
+    "glUniform3uiv",
+    "glGetVertexArrayiv",
+    "glProgramUniform1ui64vNV",
+    "glGetUniformdv",
+    NULL,
+    "glAsyncCopyImageSubDataNVX",
+    "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glVertex3dv",
+    "glEdgeFlagPointer",
+    "glBeginConditionalRenderNV",
+    "glXReleaseVideoImageNV",
+    "glGetnUniformfvARB",
+    "glTexCoord1hNV",
+    NULL,
+    NULL,
+    "glClipPlanefOES",
+    NULL,
+    "glWaitSemaphoreui64NVX",
+    "glVertexAttribI4ubv",
+    "glTexCoordP2ui",
+    "glXGetCurrentReadDrawableSGI",
+    NULL,
+    "glGetFramebufferParameterfvAMD",
+    "glWindowPos2dvARB",
+    "glXQueryExtension",
+    NULL,
+    NULL,
+    NULL,
+    "glBindBuffersRange",
+    "glCopyColorTableSGI",
+    "glNormal3f",
+    "glFragmentLightModelivSGIX",
+    "glGetMaterialiv",
+    NULL,
+    NULL,
+    "glTexCoord4s",
+    "glNamedRenderbufferStorageMultisample",
+    "glCoverFillPathInstancedNV",
+    "glScissorExclusiveArrayvNV",
+    "glGenLists",
+    "glColorFormatNV",
+    "glGetNamedBufferSubDataEXT",
+    "glVariantsvEXT",
+    NULL,
+    "glTexCoord3bvOES",
+    "glCopyBufferSubData",
+    "glProgramUniformMatrix2x4fvEXT",
+    "glVertexP2ui",
+    NULL,
+    NULL,
+    "glProgramUniform2ui",
+    "glUniformMatrix3x4dv",
+    "glGetUnsignedBytei_vEXT",
+    NULL,
+    NULL,
+    "glGetNamedRenderbufferParameteriv",
+    "glLoadMatrixd",
+    NULL,
+    "glViewportIndexedfv",
+    NULL,
+    "glRectiv",
+    NULL,
+    "glUniformMatrix3fvARB",
+    "glIndexFormatNV",
+    "glGenProgramPipelines",
+    NULL,
+    NULL,
+    "glSecondaryColorPointerListIBM",
+    NULL,
+    "glMultiTexCoord2xOES",
+    NULL,
+    "glRequestResidentProgramsNV",
+    "glGetUniformivARB",
+    "glBinormal3svEXT",
+    "glEvalCoord1fv",
+    "glCompressedMultiTexSubImage2DEXT",
+    NULL,
+    "glCompressedMultiTexSubImage3DEXT",
+    NULL,
+    "glRasterPos2i",
+    "glMultiTexCoord1bOES",
+    "glFeedbackBufferxOES",
+    "glProgramLocalParameter4dvARB",
+    "glVertexArrayVertexBuffer",
+    NULL,
+    "glMultiTexCoord1f",
+    "glVertexAttribs4hvNV",
+    "glVertexAttrib4ivARB",
+    "glMultiTexCoord4dv",
+    "glReplacementCodeuiVertex3fSUN",
+    "glBlendEquationiARB",
+    "glVertexAttribL3dvEXT",
+    "glVertexAttrib1sARB",
+    "glVertex2xvOES",
+    "glVertex4hvNV",
+    "glDepthBoundsEXT",
+    "glPauseTransformFeedbackNV",
+    NULL,
+    "glNamedFramebufferSampleLocationsfvARB",
+    "glWindowPos4fvMESA",
+    NULL,
+    "glTextureStorage2DEXT",
+    NULL,
+    "glGetCoverageModulationTableNV",
+    "glPathTexGenNV",
+    "glEndPerfQueryINTEL",
+    NULL,
+    "glVertexAttribI4ubvEXT",
+    "glGetFramebufferParameterivMESA",
+    "glCreateVertexArrays",
+    "glMultiTexCoord2sv",
+    "glConvolutionFilter1D",
+    "glGetVertexAttribPointerv",
+    "glVertexAttrib3hvNV",
+    NULL,
+    "glTexCoordPointer",
+    "glGetnPolygonStipple",
+    "glTextureBarrierNV",
+    "glGetInteger64v",
+    "glMatrixRotatefEXT",
+    "glCompressedTexSubImage2DARB",
+    "glGetNamedFramebufferParameterfvAMD",
+    "glVertexAttrib3dNV",
+    NULL,
+    NULL,
+    NULL,
+    "glLinkProgramARB",
+    "glGetProgramiv",
+    NULL,
+    NULL,
+    "glMulticastGetQueryObjecti64vNV",
+    "glGetnUniformui64vARB",
+    "glProgramLocalParametersI4uivNV",
+    "glGenerateMultiTexMipmapEXT",
+    "glUniformHandleui64vNV",
+    "glProgramUniform4i64ARB",
+    "glVertexStream2fvATI",
+    "glClearColorxOES",
+    NULL,
+    NULL,
+    "glVertexAttrib4fvARB",
+    "glTexStorage3DMultisample",
+    "glImageTransformParameteriHP",
+    "glWindowPos3fvMESA",
+    "glMultiTexCoord3dvARB",
+    NULL,
+    "glVertexAttribL1d",
+    NULL,
+    "glXSwapIntervalEXT",
+    "glVertexAttribL4dvEXT",
+    "glWindowPos4dMESA",
+    "glMultiDrawMeshTasksIndirectNV",
+    "glXQueryContextInfoEXT",
+    "glGetTexLevelParameteriv",
+    "glTextureParameterIuivEXT",
+    "glGetNamedBufferParameterivEXT",
+    "glProgramUniform3uiEXT",
+    "glUniform1d",
+    "glVertexAttribs2fvNV",
+    NULL,
+    "glVertexAttrib4s",
+    "glMatrixMultTranspose3x3fNV",
+    "glDetachObjectARB",
+    "glXBindChannelToWindowSGIX",
+    "glGetProgramLocalParameterdvARB",
+    "glTexCoord1xvOES",
+    "glVertexWeightfEXT",
+    "glVertexAttrib3fARB",
+    "glGetStageIndexNV",
+    "glIndexdv",
+    NULL,
+    "glVertex3fv",
+    "glRenderbufferStorageMultisampleEXT",
+    NULL,
+    "glMultiDrawElementsIndirectAMD",
+    NULL,
+    "glGetObjectParameterivAPPLE",
+    "glProgramUniformHandleui64ARB",
+    "glTexEnviv",
+    "glUseProgramObjectARB",
+    "glGetVertexAttribArrayObjectivATI",
+    NULL,
+    "glReplacementCodeuivSUN",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glCurrentPaletteMatrixARB",
+    "glGetVertexAttribLi64vNV",
+    "glFlushVertexArrayRangeNV",
+    "glMultiTexCoordP4ui",
+    "glVertexAttribI1iEXT",
+    "glScaled",
+    "glGetConvolutionFilterEXT",
+    "glMulticastCopyImageSubDataNV",
+    "glRasterPos4xvOES",
+    "glWindowPos4sMESA",
+    "glMultiTexGenfEXT",
+    "glVDPAURegisterOutputSurfaceNV",
+    NULL,
+    "glMaterialiv",
+    NULL,
+    NULL,
+    "glGetVertexAttribivNV",
+    "glIndexi",
+    "glProgramUniformHandleui64vARB",
+    "glVertexAttribPointerARB",
+    NULL,
+    "glMapBuffer",
+    NULL,
+    "glGetNamedFramebufferAttachmentParameterivEXT",
+    "glBlitFramebufferLayersEXT",
+    NULL,
+    "glGetHistogramParameterfv",
+    "glPixelMapfv",
+    NULL,
+    "glVideoCaptureStreamParameterdvNV",
+    "glProgramUniform3fv",
+    "glMulticastGetQueryObjectuivNV",
+    "glCreateMemoryObjectsEXT",
+    "glIsObjectBufferATI",
+    "glFogCoorddv",
+    "glPopAttrib",
+    "glBindTextures",
+    "glTexCoord2dv",
+    NULL,
+    "glVertexAttribL2dEXT",
+    "glProgramLocalParameters4fvEXT",
+    NULL,
+    NULL,
+    "glGetTextureHandleARB",
+    "glGetMapfv",
+    "glGetProgramEnvParameterdvARB",
+    "glProgramUniformMatrix4dvEXT",
+    "glMinmax",
+    "glTextureSubImage3DEXT",
+    NULL,
+    "glXEnumerateVideoCaptureDevicesNV",
+    "glBindTextureUnitParameterEXT",
+    "glGetShadingRateImagePaletteNV",
+    NULL,
+    "glMapNamedBuffer",
+    "glSecondaryColor3iEXT",
+    "glIsTextureHandleResidentARB",
+    "glGetSamplerParameteriv",
+    "glFramebufferParameteri",
+    "glTexCoord1f",
+    "glMultiTexCoord3bOES",
+    "glGetMultiTexGendvEXT",
+    "glGetnTexImageARB",
+    NULL,
+    "glAttachShader",
+    "glMultiTexCoordP2ui",
+    NULL,
+    "glVertexAttribL4ui64NV",
+    "glBlendParameteriNV",
+    "glColorPointer",
+    "glColor3uiv",
+    NULL,
+    "glGetOcclusionQueryivNV",
+    NULL,
+    NULL,
+    NULL,
+    "glRenderbufferStorage",
+    "glBindFragmentShaderATI",
+    NULL,
+    "glMultiTexCoord4bvOES",
+    "glObjectPurgeableAPPLE",
+    "glMultiTexCoord2dv",
+    "glProgramLocalParameterI4uiNV",
+    "glUnmapBuffer",
+    NULL,
+    NULL,
+    "glBlitFramebuffer",
+    "glProgramParameteriARB",
+    "glBindProgramNV",
+    "glDeleteProgramsNV",
+    "glVertexAttribs1hvNV",
+    "glCallLists",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glViewportSwizzleNV",
+    NULL,
+    NULL,
+    NULL,
+    "glGetUniformui64vARB",
+    "glVertexArraySecondaryColorOffsetEXT",
+    "glGetTransformFeedbackiv",
+    NULL,
+    "glWindowPos3dvMESA",
+    "glGenSamplers",
+    "glCompressedTexSubImage3D",
+    "glPrimitiveRestartIndex",
+    NULL,
+    "glXCushionSGI",
+    "glPathDashArrayNV",
+    "glDepthMask",
+    "glAreTexturesResidentEXT",
+    "glWindowPos3sARB",
+    "glSemaphoreParameterivNV",
+    "glDeleteMemoryObjectsEXT",
+    "glBeginQueryIndexed",
+    "glGetInteger64i_v",
+    "glDrawCommandsStatesNV",
+    "glMatrixScalefEXT",
+    "glVertex2f",
+    "glNamedFramebufferTexture2DEXT",
+    "glTexCoord4sv",
+    "glMultiDrawArraysIndirectBindlessCountNV",
+    "glClearStencil",
+    "glMatrixPushEXT",
+    "glUniformMatrix3x4fv",
+    "glPixelZoom",
+    NULL,
+    NULL,
+    NULL,
+    "glNamedRenderbufferStorageEXT",
+    "glVertexAttrib4sARB",
+    "glNormal3xOES",
+    "glGenQueryResourceTagNV",
+    NULL,
+    "glTexCoord2xvOES",
+    "glVertexStream3iATI",
+    "glXBindVideoDeviceNV",
+    "glRasterPos3xvOES",
+    "glRasterPos2f",
+    "glEvalCoord1f",
+    NULL,
+    "glProgramUniform3fvEXT",
+    "glEvalPoint2",
+    "glMultiTexEnviEXT",
+    "glBeginPerfMonitorAMD",
+    "glTangent3bEXT",
+    "glTransformFeedbackVaryingsEXT",
+    "glVertexAttrib3fNV",
+    "glGetnConvolutionFilter",
+    "glCopyColorSubTableEXT",
+    "glFinishTextureSUNX",
+    "glXWaitGL",
+    "glSampleMaskSGIS",
+    "glDeleteQueries",
+    "glPixelStoref",
+    "glConvolutionFilter1DEXT",
+    "glProgramUniform2i",
+    NULL,
+    NULL,
+    "glIsRenderbuffer",
+    "glVariantubvEXT",
+    "glDetachShader",
+    NULL,
+    "glMatrixLoadfEXT",
+    "glColor4iv",
+    "glColor4fNormal3fVertex3fvSUN",
+    NULL,
+    NULL,
+    "glVertexArrayVertexOffsetEXT",
+    "glGetNamedProgramStringEXT",
+    NULL,
+    "glProgramLocalParameterI4iNV",
+    "glGetImageHandleNV",
+    NULL,
+    "glNormal3fVertex3fSUN",
+    "glXCreateGLXPixmapMESA",
+    "glUniform4uivEXT",
+    "glVertexAttrib4NbvARB",
+    "glColorPointervINTEL",
+    "glXBindTexImageARB",
+    "glVertexAttribL1i64NV",
+    "glGetListParameterivSGIX",
+    NULL,
+    "glVertexAttribs4dvNV",
+    "glUnmapObjectBufferATI",
+    "glXQueryChannelRectSGIX",
+    "glMakeImageHandleNonResidentNV",
+    "glTexCoordP2uiv",
+    NULL,
+    "glArrayElement",
+    NULL,
+    "glGetMinmaxParameterfv",
+    NULL,
+    "glVertexAttribI1iv",
+    NULL,
+    "glVertexAttrib4usvARB",
+    NULL,
+    "glTangent3fvEXT",
+    "glReplacementCodeuiNormal3fVertex3fSUN",
+    NULL,
+    NULL,
+    NULL,
+    "glDeleteProgramsARB",
+    "glVertexAttrib1dARB",
+    NULL,
+    "glPolygonOffsetClamp",
+    "glGetBufferPointervARB",
+    "glIsVertexArray",
+    "glGlobalAlphaFactorfSUN",
+    "glTextureRenderbufferEXT",
+    "glColorFragmentOp3ATI",
+    "glMultiTexCoord4fvARB",
+    "glUniform2fv",
+    "glTransformFeedbackVaryingsNV",
+    "glMultiDrawMeshTasksIndirectEXT",
+    "glGetInvariantBooleanvEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glGetTransformFeedbackVarying",
+    "glDisableClientStateiEXT",
+    NULL,
+    "glEnableVertexAttribArrayARB",
+    "glQueryMatrixxOES",
+    NULL,
+    "glVariantfvEXT",
+    NULL,
+    "glGetProgramBinary",
+    "glMultiTexEnvfvEXT",
+    "glVertex2hNV",
+    NULL,
+    NULL,
+    "glWindowPos3f",
+    "glGetClipPlanexOES",
+    NULL,
+    "glUseShaderProgramEXT",
+    "glVertexBlendEnvfATI",
+    "glNamedBufferPageCommitmentEXT",
+    "glFogFuncSGIS",
+    "glListParameteriSGIX",
+    NULL,
+    "glGetnUniformdv",
+    "glVertexAttrib3dARB",
+    "glGlobalAlphaFactorubSUN",
+    "glXQueryExtensionsString",
+    "glTagSampleBufferSGIX",
+    "glPointParameterfSGIS",
+    NULL,
+    "glXGetCurrentAssociatedContextAMD",
+    "glProgramUniformHandleui64NV",
+    NULL,
+    "glProgramSubroutineParametersuivNV",
+    "glProgramUniform2ui64NV",
+    NULL,
+    "glSemaphoreParameterui64vEXT",
+    NULL,
+    NULL,
+    "glVertexPointervINTEL",
+    "glProgramUniformui64vNV",
+    NULL,
+    "glSamplePatternEXT",
+    NULL,
+    NULL,
+    "glVertexStream1fATI",
+    "glUniformui64NV",
+    "glTexGenxOES",
+    "glVertexAttrib4ubNV",
+    NULL,
+    "glIsProgramARB",
+    "glNamedFramebufferTextureLayer",
+    "glBindLightParameterEXT",
+    "glConvolutionParameterf",
+    NULL,
+    "glGetInvariantFloatvEXT",
+    "glIndexiv",
+    "glGetSharpenTexFuncSGIS",
+    "glGenPerfMonitorsAMD",
+    "glTexImage4DSGIS",
+    "glMemoryBarrierEXT",
+    NULL,
+    "glTexCoord2xOES",
+    "glColor3b",
+    NULL,
+    "glTexParameteriv",
+    "glGetQueryObjectuivARB",
+    "glGetTexBumpParameterivATI",
+    "glGetArrayObjectfvATI",
+    "glUniform4iARB",
+    "glNormal3dv",
+    "glMultiTexCoord3sARB",
+    "glGetTransformFeedbackVaryingEXT",
+    NULL,
+    "glMultiTexCoord2hvNV",
+    "glGetLightfv",
+    "glReplacementCodePointerSUN",
+    NULL,
+    "glTranslatexOES",
+    "glSampleMaski",
+    NULL,
+    "glSecondaryColor3hvNV",
+    "glColor4hvNV",
+    NULL,
+    "glProgramUniform4uivEXT",
+    NULL,
+    "glGetVariantIntegervEXT",
+    "glCompressedTextureSubImage3DEXT",
+    "glTexStorageSparseAMD",
+    "glMultiTexCoord4ivARB",
+    "glFreeObjectBufferATI",
+    NULL,
+    "glDeleteVertexArraysAPPLE",
+    NULL,
+    "glProgramUniform3d",
+    "glPolygonOffsetEXT",
+    "glProgramUniform1dvEXT",
+    "glGetActiveSubroutineUniformName",
+    "glBinormal3fEXT",
+    "glScissorExclusiveNV",
+    NULL,
+    "glGetTexParameterIuivEXT",
+    "glColorTable",
+    "glRectd",
+    "glCopyTexSubImage1DEXT",
+    "glVertexAttribI4i",
+    "glGetVideoui64vNV",
+    "glVertexAttribL2dv",
+    "glTexCoord2iv",
+    NULL,
+    "glProgramUniform4dv",
+    "glDebugMessageCallbackARB",
+    NULL,
+    "glArrayObjectATI",
+    NULL,
+    NULL,
+    "glVertex3bOES",
+    "glColor4xOES",
+    NULL,
+    "glVDPAUMapSurfacesNV",
+    "glExtractComponentEXT",
+    NULL,
+    "glVertexAttribL3dEXT",
+    "glVertexArrayColorOffsetEXT",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+    "glMultMatrixxOES",
+    NULL,
+    "glBinormalPointerEXT",
+    "glWindowPos3dv",
+    "glTexStorage2D",
+    "glNamedRenderbufferStorageMultisampleCoverageEXT",
+    NULL,
+    "glTextureStorageMem2DEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glVertexAttribI2iEXT",
+    NULL,
+    "glDrawRangeElementsBaseVertex",
+    "glTexStorage1D",
+    "glClampColor",
+    "glEnableVertexArrayAttrib",
+    "glWindowPos2ivMESA",
+    NULL,
+    "glVertex4bvOES",
+    "glVertexAttribLPointerEXT",
+    NULL,
+    "glUniform4ui64vNV",
+    "glIsPointInStrokePathNV",
+    NULL,
+    "glVertex2fv",
+    NULL,
+    NULL,
+    "glGetSubroutineUniformLocation",
+    "glXGetVisualFromFBConfigSGIX",
+    "glBindTransformFeedback",
+    "glGetColorTableParameterfv",
+    "glGetVertexArrayIndexediv",
+    "glVertexAttribL3dv",
+    "glBindVideoCaptureStreamBufferNV",
+    NULL,
+    "glGenTransformFeedbacksNV",
+    "glDrawElementArrayAPPLE",
+    "glTexCoord2fColor3fVertex3fSUN",
+    "glSeparableFilter2D",
+    "glVertexPointer",
+    "glUniform1i64NV",
+    NULL,
+    NULL,
+    "glTexImage2D",
+    "glProgramUniform3dv",
+    NULL,
+    "glXGetVideoSyncSGI",
+    "glLightxvOES",
+    NULL,
+    "glGetNamedFramebufferParameterivEXT",
+    NULL,
+    "glProgramUniformMatrix4x3fv",
+    NULL,
+    NULL,
+    "glUniform3uivEXT",
+    "glStencilOpValueAMD",
+    "glSignalVkSemaphoreNV",
+    "glGetShaderSourceARB",
+    "glBindTextureUnit",
+    "glTexCoord4d",
+    "glIsProgram",
+    "glSignalVkFenceNV",
+    "glDeleteCommandListsNV",
+    NULL,
+    "glVertexAttribL1ui64vARB",
+    "glVertexAttribL4d",
+    NULL,
+    "glCreateShaderObjectARB",
+    "glDrawElements",
+    NULL,
+    NULL,
+    "glMultiTexCoord4xvOES",
+    "glUniform2i",
+    NULL,
+    "glNamedBufferDataEXT",
+    NULL,
+    "glValidateProgramPipeline",
+    "glTexEnvf",
+    NULL,
+    NULL,
+    "glTextureBarrier",
+    "glVertex4sv",
+    "glWindowPos2sARB",
+    "glIndexs",
+    NULL,
+    "glSecondaryColor3bEXT",
+    "glProgramUniform1i64vNV",
+    "glCreateTransformFeedbacks",
+    "glGetVideoi64vNV",
+    NULL,
+    "glXNamedCopyBufferSubDataNV",
+    "glTexCoord3s",
+    "glProgramParameter4dNV",
+    "glProgramLocalParameter4fARB",
+    NULL,
+    "glXGetConfig",
+    "glUniform2f",
+    "glCopyMultiTexImage1DEXT",
+    NULL,
+    "glColor3iv",
+    "glGetVertexArrayPointeri_vEXT",
+    "glNamedFramebufferDrawBuffers",
+    "glTransformFeedbackVaryings",
+    "glPrioritizeTexturesEXT",
+    NULL,
+    "glPopName",
+    "glXQueryHyperpipeAttribSGIX",
+    "glUniform1i64ARB",
+    "glCopyTexImage2DEXT",
+    "glRenderbufferStorageMultisample",
+    NULL,
+    NULL,
+    "glVertex2bOES",
+    "glVertexAttrib4bvARB",
+    "glXGetSyncValuesOML",
+    NULL,
+    NULL,
+    "glProgramUniform1fv",
+    "glGetFramebufferParameterivEXT",
+    NULL,
+    "glArrayElementEXT",
+    "glFragmentMaterialivSGIX",
+    "glGetUniformfvARB",
+    "glGetTextureImageEXT",
+    "glWindowPos2iARB",
+    "glGetBooleanIndexedvEXT",
+    "glMultiTexParameterIuivEXT",
+    "glVertexWeightPointerEXT",
+    NULL,
+    NULL,
+    "glClearBufferSubData",
+    NULL,
+    NULL,
+    "glUniform4dv",
+    NULL,
+    "glVertexAttrib4iv",
+    "glVertexAttrib4NubvARB",
+    NULL,
+    "glXReleaseVideoCaptureDeviceNV",
+    NULL,
+    "glSecondaryColor3ubEXT",
+    "glDrawMeshTasksEXT",
+    "glGetLocalConstantFloatvEXT",
+    "glSetFragmentShaderConstantATI",
+    "glFogCoordfEXT",
+    NULL,
+    "glMultiTexCoord2s",
+    "glWindowPos2fMESA",
+    "glCopyColorSubTable",
+    "glGetVertexAttribArrayObjectfvATI",
+    "glVertexAttrib3s",
+    "glWindowPos4iMESA",
+    "glVertex3bvOES",
+    NULL,
+    "glMultiTexCoord4sv",
+    "glGetVertexAttribiv",
+    "glGetColorTableParameterfvSGI",
+    NULL,
+    "glMemoryBarrierByRegion",
+    "glTexParameterf",
+    "glColorTableParameterfv",
+    "glNormalStream3fATI",
+    "glMatrixMult3x2fNV",
+    "glGetFogFuncSGIS",
+    "glClearDepth",
+    "glVertexWeighthvNV",
+    "glSampleCoverage",
+    "glMultiTexCoord3fvARB",
+    NULL,
+    "glGetMultiTexEnvfvEXT",
+    "glVertexStream1ivATI",
+    "glMultiTexCoord4hNV",
+    "glWindowPos3dMESA",
+    "glPathParameteriNV",
+    "glGetObjectPtrLabel",
+    "glGenRenderbuffersEXT",
+    "glColor3bv",
+    "glProgramUniform4ui64vNV",
+    "glDeleteSamplers",
+    NULL,
+    "glTestObjectAPPLE",
+    "glVertexStream3ivATI",
+    "glProgramEnvParameterI4uivNV",
+    "glProgramUniform4uiEXT",
+    NULL,
+    "glGetTexParameterfv",
+    "glGetFragDataIndex",
+    "glMultiTexGendEXT",
+    "glVertexAttrib4svNV",
+    "glNamedFramebufferRenderbufferEXT",
+    NULL,
+    "glShadeModel",
+    NULL,
+    "glBinormal3bvEXT",
+    "glStencilMask",
+    "glGetCompressedTextureSubImage",
+    NULL,
+    "glTexCoord3sv",
+    "glTangent3fEXT",
+    NULL,
+    "glGetFloatv",
+    NULL,
+    "glProgramEnvParametersI4uivNV",
+    "glGetImageTransformParameterivHP",
+    NULL,
+    "glVertexAttribL1i64vNV",
+    "glInterleavedArrays",
+    "glFramebufferTextureFaceEXT",
+    "glSamplerParameterfv",
+    NULL,
+    "glGetDebugMessageLog",
+    NULL,
+    "glProgramUniform2i64ARB",
+    "glPointParameterfARB",
+    "glTextureBuffer",
+    NULL,
+    "glMatrixLoadTransposefEXT",
+    "glMultiTexParameterfEXT",
+    "glFragmentLightiSGIX",
+    NULL,
+    "glXQueryMaxSwapGroupsNV",
+    "glGetUniformBlockIndex",
+    "glCreateFramebuffers",
+    "glPathGlyphRangeNV",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix4fv",
+    "glProgramUniform3ivEXT",
+    "glClientWaitSemaphoreui64NVX",
+    "glProgramUniform4fEXT",
+    "glGetUniformSubroutineuiv",
+    "glPathSubCoordsNV",
+    "glVertexAttribs1dvNV",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexArrayVertexAttribBindingEXT",
+    "glMultiTexCoord4i",
+    "glBindBufferOffsetNV",
+    "glNormal3fv",
+    "glMultiTexGendvEXT",
+    "glVertexStream4iATI",
+    NULL,
+    NULL,
+    NULL,
+    "glMulticastViewportPositionWScaleNVX",
+    NULL,
+    "glSetFenceNV",
+    "glCallList",
+    "glTestFenceAPPLE",
+    NULL,
+    "glTexCoord3iv",
+    "glPresentFrameDualFillNV",
+    "glGetCombinerOutputParameterfvNV",
+    "glGetMultiTexGenfvEXT",
+    "glTextureAttachMemoryNV",
+    "glClearNamedFramebufferiv",
+    "glVertexAttribs4svNV",
+    NULL,
+    "glWindowPos3iARB",
+    NULL,
+    "glGetProgramNamedParameterfvNV",
+    "glGetFramebufferParameteriv",
+    "glVertex2hvNV",
+    NULL,
+    "glGetUniformui64vNV",
+    "glPrimitiveRestartIndexNV",
+    "glMultiTexCoord1iv",
+    "glGetTexEnvxvOES",
+    "glNamedFramebufferTexture",
+    "glImportMemoryWin32NameEXT",
+    "glCheckNamedFramebufferStatus",
+    NULL,
+    "glGetVertexAttribPointervNV",
+    "glVertexArrayIndexOffsetEXT",
+    "glListBase",
+    "glUpdateObjectBufferATI",
+    "glProgramUniformMatrix4x3fvEXT",
+    "glTexStorageMem3DMultisampleEXT",
+    "glSecondaryColor3dv",
+    "glSpriteParameteriSGIX",
+    "glProgramUniform4f",
+    "glWeightPointerARB",
+    "glCompileShader",
+    NULL,
+    NULL,
+    "glGetPerfQueryInfoINTEL",
+    "glBeginFragmentShaderATI",
+    NULL,
+    "glResetMinmaxEXT",
+    "glUniformMatrix2dv",
+    "glColor4fv",
+    "glBlendEquationSeparateIndexedAMD",
+    "glRasterPos3fv",
+    "glPathStencilFuncNV",
+    "glSecondaryColor3ubv",
+    NULL,
+    "glVDPAUUnmapSurfacesNV",
+    "glMatrixLoadIdentityEXT",
+    "glXCreateWindow",
+    "glXSwapBuffers",
+    "glMakeImageHandleResidentNV",
+    "glVertexAttrib1f",
+    "glInvalidateNamedFramebufferData",
+    "glVertexAttrib1dv",
+    "glSecondaryColor3fvEXT",
+    "glSamplerParameterf",
+    "glFramebufferTexture1DEXT",
+    "glDrawElementsInstanced",
+    "glVertex4f",
+    NULL,
+    "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+    "glSetInvariantEXT",
+    "glBinormal3dEXT",
+    "glWindowPos2dvMESA",
+    "glGetMapParameterfvNV",
+    NULL,
+    "glVertexStream2dATI",
+    "glBindMaterialParameterEXT",
+    "glInitNames",
+    "glFogCoordPointerEXT",
+    "glRasterPos2dv",
+    NULL,
+    "glGetConvolutionParameterivEXT",
+    "glBlendFunci",
+    "glNamedFramebufferSampleLocationsfvNV",
+    "glStencilThenCoverFillPathInstancedNV",
+    "glPathGlyphIndexRangeNV",
+    "glVertexAttribI4usvEXT",
+    "glPixelTransferf",
+    "glRasterPos4iv",
+    NULL,
+    NULL,
+    NULL,
+    "glRasterPos3i",
+    "glIglooInterfaceSGIX",
+    "glRasterSamplesEXT",
+    "glFenceSync",
+    "glFinish",
+    "glVertexAttrib2dARB",
+    "glXGetContextIDEXT",
+    "glNamedRenderbufferStorageMultisampleEXT",
+    "glFlushMappedNamedBufferRange",
+    "glGetPixelTexGenParameterfvSGIS",
+    "glIsNamedStringARB",
+    "glXDestroyGLXPixmap",
+    "glEnableVertexAttribArray",
+    "glVertexArrayVertexBindingDivisorEXT",
+    NULL,
+    "glTexCoord1i",
+    NULL,
+    "glNormalFormatNV",
+    "glFramebufferDrawBufferEXT",
+    "glProgramUniform2d",
+    "glXCreateGLXPbufferSGIX",
+    "glVertexAttribL3ui64vNV",
+    "glCompressedTexSubImage1D",
+    "glConservativeRasterParameteriNV",
+    "glXUseXFont",
+    "glMatrixMult3x3fNV",
+    "glIndexsv",
+    "glGenerateTextureMipmap",
+    "glReplacementCodeusvSUN",
+    "glProgramUniform4i64vNV",
+    "glGetPixelTransformParameterfvEXT",
+    "glVertexAttribI1uivEXT",
+    "glXDestroyGLXVideoSourceSGIX",
+    "glClientActiveTexture",
+    "glColorFragmentOp2ATI",
+    "glMapGrid1f",
+    "glBinormal3iEXT",
+    NULL,
+    "glProgramUniformMatrix2x3fvEXT",
+    "glXBeginFrameTrackingMESA",
+    NULL,
+    "glMateriali",
+    "glIndexub",
+    NULL,
+    "glDeleteLists",
+    NULL,
+    "glXDestroyPixmap",
+    "glXWaitVideoSyncSGI",
+    NULL,
+    "glTexCoord3dv",
+    NULL,
+    "glProgramUniform4i",
+    NULL,
+    "glProgramUniform2fvEXT",
+    NULL,
+    "glImageTransformParameterfHP",
+    "glTexCoord4hvNV",
+    "glGetConvolutionParameterxvOES",
+    "glProgramLocalParameter4dARB",
+    "glProgramUniform1uiEXT",
+    "glIsTransformFeedback",
+    "glVertexPointerEXT",
+    "glTexCoord1dv",
+    "glGetShaderPrecisionFormat",
+    "glXCreateGLXVideoSourceSGIX",
+    NULL,
+    NULL,
+    "glGetCompressedTextureImage",
+    "glNamedProgramLocalParameter4fEXT",
+    "glViewportPositionWScaleNV",
+    "glBindRenderbuffer",
+    "glRectfv",
+    "glBlendFuncSeparateiARB",
+    "glVariantivEXT",
+    "glAccumxOES",
+    "glProgramUniform1dv",
+    "glGetProgramStageiv",
+    "glColorTableParameteriv",
+    "glWindowPos3fARB",
+    "glNormalStream3dATI",
+    "glGetVariantBooleanvEXT",
+    NULL,
+    "glGenProgramsNV",
+    "glGetActiveSubroutineUniformiv",
+    NULL,
+    "glVertexAttribs4ubvNV",
+    "glVertexStream1svATI",
+    "glColor3sv",
+    NULL,
+    "glTangent3svEXT",
+    NULL,
+    "glRecti",
+    NULL,
+    "glScissorIndexedv",
+    "glIsOcclusionQueryNV",
+    "glDrawArrays",
+    "glXQueryHyperpipeNetworkSGIX",
+    "glBlendEquationSeparateEXT",
+    "glDrawCommandsStatesAddressNV",
+    "glMultiTexParameterfvEXT",
+    "glGetCombinerStageParameterfvNV",
+    "glGetSeparableFilterEXT",
+    "glDeleteProgramPipelines",
+    "glVertexAttrib3sv",
+    "glPointParameterf",
+    "glXSendPbufferToVideoNV",
+    NULL,
+    "glDeleteNamesAMD",
+    NULL,
+    "glImportMemoryWin32HandleEXT",
+    "glGetVertexAttribfv",
+    NULL,
+    "glProgramUniform3dvEXT",
+    "glBindTexture",
+    "glTexCoord2fColor4ubVertex3fSUN",
+    NULL,
+    NULL,
+    "glBindTransformFeedbackNV",
+    "glClientActiveTextureARB",
+    "glVertexArrayVertexAttribLOffsetEXT",
+    "glLoadTransposeMatrixd",
+    "glDisableClientStateIndexedEXT",
+    NULL,
+    "glTexCoord2fColor3fVertex3fvSUN",
+    "glNamedProgramStringEXT",
+    "glUniformMatrix4x2fv",
+    "glMultiTexCoord1xvOES",
+    "glGetImageTransformParameterfvHP",
+    NULL,
+    "glUniform3ivARB",
+    "glProgramUniform4i64vARB",
+    NULL,
+    "glSecondaryColor3uivEXT",
+    "glDrawElementsIndirect",
+    "glProgramNamedParameter4fNV",
+    "glTexStorage3DEXT",
+    "glProgramUniform4ui",
+    "glProgramUniform3uivEXT",
+    "glGetMinmaxEXT",
+    NULL,
+    "glGenerateMipmap",
+    "glGlobalAlphaFactoriSUN",
+    "glXBindTexImageEXT",
+    "glGetPathCoordsNV",
+    "glDrawElementsInstancedEXT",
+    "glFramebufferSampleLocationsfvNV",
+    NULL,
+    "glEGLImageTargetTexStorageEXT",
+    "glVertexAttrib2svNV",
+    "glRectf",
+    "glGetnUniformiv",
+    "glUniform1fvARB",
+    "glMultiTexCoord2bvOES",
+    "glIsPathNV",
+    "glGetDebugMessageLogARB",
+    "glPixelTransformParameterfvEXT",
+    "glMapControlPointsNV",
+    NULL,
+    "glProgramUniformui64NV",
+    "glColorSubTableEXT",
+    "glStartInstrumentsSGIX",
+    NULL,
+    "glProgramUniform4dEXT",
+    "glSecondaryColorPointerEXT",
+    "glExecuteProgramNV",
+    "glCreateQueries",
+    NULL,
+    "glVertex4bOES",
+    "glVertexAttrib4dARB",
+    NULL,
+    "glTexStorage3D",
+    "glTexStorageMem1DEXT",
+    NULL,
+    NULL,
+    "glMultiTexCoord4f",
+    "glRenderMode",
+    "glGetString",
+    NULL,
+    "glHistogram",
+    NULL,
+    "glXSwapBuffersMscOML",
+    "glPixelStorei",
+    NULL,
+    "glShaderSourceARB",
+    "glTextureParameterIuiv",
+    "glDeleteProgram",
+    "glCopyTextureSubImage3D",
+    "glGetVertexAttribivARB",
+    "glVertexAttrib2svARB",
+    NULL,
+    "glGetSeparableFilter",
+    "glMap2f",
+    "glFramebufferTextureMultiviewOVR",
+    "glDispatchComputeGroupSizeARB",
+    "glUniform3ui64ARB",
+    "glGetQueryBufferObjecti64v",
+    NULL,
+    "glTexCoord2i",
+    NULL,
+    "glGenNamesAMD",
+    "glMultiTexCoord1dvARB",
+    NULL,
+    NULL,
+    "glPassTexCoordATI",
+    "glTexCoord2fVertex3fSUN",
+    "glVertexAttribI4ivEXT",
+    NULL,
+    "glVertexAttribL2ui64NV",
+    "glCopyColorTable",
+    "glTextureSubImage1D",
+    "glXQueryHyperpipeBestAttribSGIX",
+    "glVertexArrayVertexAttribOffsetEXT",
+    "glDepthRangef",
+    NULL,
+    "glAreTexturesResident",
+    NULL,
+    "glFramebufferTexture",
+    "glIndexxOES",
+    "glBeginTransformFeedback",
+    "glTextureStorage1DEXT",
+    "glIndexPointerListIBM",
+    NULL,
+    NULL,
+    "glGetnPixelMapuiv",
+    "glTextureSubImage1DEXT",
+    "glVertexStream2svATI",
+    "glBlitNamedFramebuffer",
+    NULL,
+    "glPrimitiveRestartNV",
+    "glUniform2iARB",
+    "glGetQueryBufferObjectui64v",
+    "glCreateSyncFromCLeventARB",
+    "glGetPerfQueryIdByNameINTEL",
+    NULL,
+    NULL,
+    "glGetFinalCombinerInputParameterfvNV",
+    "glProgramUniformMatrix2dv",
+    "glTexGenxvOES",
+    "glNormalStream3bvATI",
+    "glVDPAURegisterVideoSurfaceNV",
+    "glProgramBufferParametersIivNV",
+    "glVertexAttribIFormatNV",
+    "glUniform3iARB",
+    "glBindImageTextures",
+    NULL,
+    "glVertexAttrib2f",
+    "glEnableClientStateIndexedEXT",
+    NULL,
+    "glPixelMapusv",
+    "glIsTexture",
+    NULL,
+    "glWeightbvARB",
+    "glGetActiveUniformARB",
+    "glBinormal3fvEXT",
+    "glGetTexEnvfv",
+    "glVertexAttribL3i64NV",
+    "glUniformMatrix2x4fv",
+    NULL,
+    "glFramebufferReadBufferEXT",
+    "glGetShaderInfoLog",
+    "glXBindSwapBarrierSGIX",
+    "glXCopyImageSubDataNV",
+    NULL,
+    NULL,
+    "glXHyperpipeAttribSGIX",
+    "glCompressedTexImage1D",
+    NULL,
+    "glEnableClientState",
+    "glUniformHandleui64NV",
+    "glSecondaryColor3fv",
+    "glDrawArraysInstanced",
+    "glFlushPixelDataRangeNV",
+    NULL,
+    "glGetTransformFeedbacki_v",
+    NULL,
+    "glColorTableSGI",
+    "glSecondaryColor3hNV",
+    "glVideoCaptureStreamParameterfvNV",
+    "glUniform3i64vARB",
+    "glCopyPathNV",
+    "glColor4xvOES",
+    NULL,
+    "glDeletePathsNV",
+    "glProgramPathFragmentInputGenNV",
+    "glCompressedTexImage3DARB",
+    "glUniformSubroutinesuiv",
+    "glAsyncCopyBufferSubDataNVX",
+    "glGetTextureParameterivEXT",
+    "glGetPixelTexGenParameterivSGIS",
+    "glProgramUniform4i64NV",
+    NULL,
+    "glWindowPos3svARB",
+    "glTangent3ivEXT",
+    "glGetPerfMonitorCountersAMD",
+    "glUniform4i",
+    NULL,
+    "glVertexAttribs2svNV",
+    NULL,
+    "glWindowPos2fvARB",
+    "glProgramUniform4ivEXT",
+    "glProgramUniform2iv",
+    "glProgramUniform3ui64ARB",
+    NULL,
+    "glShaderStorageBlockBinding",
+    "glSecondaryColor3fEXT",
+    NULL,
+    "glMultMatrixf",
+    "glTexCoord1bOES",
+    "glXCopyContext",
+    "glGetInternalformativ",
+    NULL,
+    "glGetTexParameterxvOES",
+    "glXCopyBufferSubDataNV",
+    "glWindowPos3fv",
+    "glSamplerParameterIuiv",
+    "glInvalidateNamedFramebufferSubData",
+    "glWindowPos3s",
+    "glVertexAttrib2fvARB",
+    NULL,
+    "glVertexAttrib1svARB",
+    "glProgramUniformHandleui64vNV",
+    "glGetMapdv",
+    NULL,
+    "glMultiTexCoord2svARB",
+    "glGetnUniformfv",
+    NULL,
+    "glGetQueryObjectiv",
+    NULL,
+    NULL,
+    NULL,
+    "glMultMatrixd",
+    "glProgramUniformMatrix3x4fv",
+    "glXReleaseTexImageEXT",
+    "glProgramUniform1i64NV",
+    NULL,
+    "glSampleCoverageARB",
+    "glXLockVideoCaptureDeviceNV",
+    "glIsBufferResidentNV",
+    "glBlendFuncSeparatei",
+    NULL,
+    NULL,
+    NULL,
+    "glCompressedTexImage3D",
+    "glMultiTexCoord1d",
+    "glMapParameterivNV",
+    "glFogxOES",
+    "glGetQueryIndexediv",
+    NULL,
+    "glVertexP3ui",
+    "glXWaitX",
+    "glUniformMatrix4fvARB",
+    "glFramebufferParameteriMESA",
+    NULL,
+    "glGetnUniformuivARB",
+    "glNamedBufferPageCommitmentARB",
+    "glDeleteVertexShaderEXT",
+    NULL,
+    "glFragmentColorMaterialSGIX",
+    NULL,
+    "glApplyTextureEXT",
+    "glStencilMaskSeparate",
+    "glGetQueryObjectui64v",
+    "glVertexStream3dvATI",
+    "glEnable",
+    "glStencilFillPathInstancedNV",
+    "glMakeTextureHandleResidentNV",
+    "glIsVariantEnabledEXT",
+    "glVertexAttribI3uiv",
+    "glGetFragmentLightivSGIX",
+    "glCompressedTextureImage1DEXT",
+    "glXQueryVideoCaptureDeviceNV",
+    "glIsProgramNV",
+    "glClearDepthdNV",
+    NULL,
+    "glDisableVertexAttribAPPLE",
+    "glReplacementCodeuiTexCoord2fVertex3fSUN",
+    NULL,
+    "glVertexAttrib4NsvARB",
+    "glFramebufferTexture3D",
+    NULL,
+    "glStencilStrokePathInstancedNV",
+    "glVertexAttrib4Nusv",
+    "glXSelectEvent",
+    "glColorP3ui",
+    "glTexSubImage4DSGIS",
+    "glBufferSubData",
+    NULL,
+    "glIsProgramPipeline",
+    "glUniform4fvARB",
+    "glSecondaryColor3iv",
+    NULL,
+    NULL,
+    NULL,
+    "glSecondaryColor3ubvEXT",
+    NULL,
+    NULL,
+    "glVertexAttrib4f",
+    "glProgramBinary",
+    "glFogiv",
+    "glMultiTexCoord1fv",
+    NULL,
+    "glMatrixIndexuivARB",
+    NULL,
+    "glTexRenderbufferNV",
+    "glGetnMapdvARB",
+    NULL,
+    "glResumeTransformFeedbackNV",
+    "glRasterPos3s",
+    "glBinormal3sEXT",
+    NULL,
+    "glMultiDrawMeshTasksIndirectCountNV",
+    "glMultiTexCoord4dARB",
+    "glMatrixTranslatefEXT",
+    "glWeightfvARB",
+    "glProgramUniform1ivEXT",
+    "glEdgeFlagFormatNV",
+    "glGetFenceivNV",
+    NULL,
+    "glBlendEquationSeparatei",
+    "glMakeImageHandleNonResidentARB",
+    "glVertexAttrib1dvNV",
+    NULL,
+    "glUniform3uiEXT",
+    "glGenFencesAPPLE",
+    "glRasterPos3dv",
+    NULL,
+    "glPushName",
+    "glTexCoord2s",
+    NULL,
+    NULL,
+    "glDrawBuffersARB",
+    NULL,
+    "glGetProgramEnvParameterIivNV",
+    "glMultiTexCoord1svARB",
+    "glVertexAttrib4uivARB",
+    NULL,
+    "glCreateProgressFenceNVX",
+    "glDeleteTransformFeedbacks",
+    "glProgramUniformMatrix4x2dv",
+    "glGetPathParameterfvNV",
+    "glCompileShaderARB",
+    "glAlphaFragmentOp3ATI",
+    "glMultiTexCoord2fARB",
+    NULL,
+    "glClearTexSubImage",
+    NULL,
+    NULL,
+    NULL,
+    "glGetSamplerParameterIiv",
+    NULL,
+    "glVertexAttribI2iv",
+    "glImportSemaphoreFdEXT",
+    "glMultiTexCoord1ivARB",
+    NULL,
+    "glSecondaryColorP3ui",
+    NULL,
+    NULL,
+    "glEvalCoord2d",
+    "glLoadTransposeMatrixxOES",
+    "glGetTexParameterIuiv",
+    "glSecondaryColor3sv",
+    "glProgramUniform1f",
+    "glTexCoord3f",
+    "glXMakeContextCurrent",
+    NULL,
+    "glProgramUniform1d",
+    "glGetCompressedTexImage",
+    NULL,
+    "glCopyTextureSubImage1DEXT",
+    NULL,
+    "glWindowPos3sMESA",
+    "glGetHistogramParameterxvOES",
+    NULL,
+    NULL,
+    "glUnmapBufferARB",
+    "glCombinerParameterivNV",
+    "glMultiTexCoord2f",
+    "glVertexAttrib3svARB",
+    NULL,
+    "glTexCoord3hNV",
+    "glGetPointerIndexedvEXT",
+    "glTransformPathNV",
+    "glListParameterivSGIX",
+    "glVertexAttribP3ui",
+    "glIsAsyncMarkerSGIX",
+    "glGetQueryObjectivARB",
+    NULL,
+    "glIsQuery",
+    NULL,
+    "glTexGend",
+    "glDrawElementsInstancedBaseVertex",
+    "glDisableVertexArrayAttrib",
+    "glProgramNamedParameter4dNV",
+    "glBufferPageCommitmentMemNV",
+    "glColor4fNormal3fVertex3fSUN",
+    "glColor3dv",
+    "glCombinerInputNV",
+    "glProgramUniformMatrix4x3dvEXT",
+    "glColor4hNV",
+    "glFragmentMaterialfvSGIX",
+    "glBufferDataARB",
+    "glBegin",
+    "glStencilFuncSeparate",
+    "glWindowPos3ivARB",
+    "glBindRenderbufferEXT",
+    "glMultiTexParameterIivEXT",
+    NULL,
+    NULL,
+    "glGetClipPlanefOES",
+    NULL,
+    "glXIsDirect",
+    "glDeleteVertexArrays",
+    "glProgramEnvParameter4dARB",
+    NULL,
+    "glVertexStream4ivATI",
+    NULL,
+    "glGetPerfMonitorCounterDataAMD",
+    "glMultTransposeMatrixf",
+    NULL,
+    "glPathParameterivNV",
+    "glProgramUniform4iEXT",
+    "glEnableVariantClientStateEXT",
+    "glProgramUniform1fEXT",
+    "glProgramUniformMatrix3dvEXT",
+    "glGetMapAttribParameterfvNV",
+    "glStencilFunc",
+    NULL,
+    NULL,
+    "glGetProgramResourceiv",
+    "glWindowPos2i",
+    NULL,
+    "glVertexAttribI2uivEXT",
+    NULL,
+    "glVertexAttribI4sv",
+    "glGetMultiTexImageEXT",
+    "glGetVideouivNV",
+    "glGetTexGenfv",
+    "glGetDoublev",
+    "glNormalStream3ivATI",
+    "glSetFenceAPPLE",
+    "glXJoinSwapGroupNV",
+    "glVertex3d",
+    "glPixelMapx",
+    "glUniform1uiEXT",
+    "glWindowPos2s",
+    "glUniform1ui64ARB",
+    "glPrioritizeTextures",
+    NULL,
+    "glGetBooleanv",
+    "glGetLocalConstantIntegervEXT",
+    "glTexCoord3bOES",
+    "glVertexArrayTexCoordOffsetEXT",
+    "glGetTextureSubImage",
+    NULL,
+    "glFogCoordFormatNV",
+    "glUniform4uiEXT",
+    "glCopyMultiTexSubImage2DEXT",
+    "glDeleteAsyncMarkersSGIX",
+    "glMapVertexAttrib2dAPPLE",
+    "glMultiTexCoord1iARB",
+    "glGetInstrumentsSGIX",
+    "glProgramUniform3uiv",
+    "glEndFragmentShaderATI",
+    "glVertexStream3dATI",
+    "glVertexAttrib1sNV",
+    "glGetPointervEXT",
+    "glGetDetailTexFuncSGIS",
+    "glMapVertexAttrib1fAPPLE",
+    NULL,
+    NULL,
+    "glReadBuffer",
+    NULL,
+    "glVertexAttribL3d",
+    "glMapNamedBufferEXT",
+    "glCombinerStageParameterfvNV",
+    "glVertexAttribI2uiv",
+    "glFragmentLightModelfvSGIX",
+    "glGenerateTextureMipmapEXT",
+    "glProgramUniform3iv",
+    NULL,
+    "glLoadIdentityDeformationMapSGIX",
+    "glXQueryFrameTrackingMESA",
+    NULL,
+    "glWindowPos3dARB",
+    "glTextureImage2DMultisampleNV",
+    "glUniform4i64vARB",
+    NULL,
+    "glCompressedTexImage1DARB",
+    "glColorMaterial",
+    "glDisableVertexArrayAttribEXT",
+    "glTextureParameteriEXT",
+    "glXGetCurrentContext",
+    "glGetBufferParameteriv",
+    "glVertexAttribI3ui",
+    "glGetColorTableParameterfvEXT",
+    NULL,
+    "glPathGlyphIndexArrayNV",
+    "glTexCoord4dv",
+    NULL,
+    "glTextureStorage3DMultisampleEXT",
+    "glMultiTexCoord2dvARB",
+    "glUniform1i64vNV",
+    "glBlitFramebufferLayerEXT",
+    "glCombinerParameterfNV",
+    NULL,
+    "glWindowPos2iMESA",
+    "glGetProgramResourceLocationIndex",
+    NULL,
+    "glXMakeCurrent",
+    NULL,
+    "glProgramUniform4iv",
+    "glNormalStream3iATI",
+    "glBindVideoCaptureStreamTextureNV",
+    "glDeleteShader",
+    "glEdgeFlag",
+    "glTextureParameterivEXT",
+    NULL,
+    "glNormalP3ui",
+    "glFogCoordd",
+    "glVertexAttrib4ubvNV",
+    "glCreateShaderProgramv",
+    "glBindFragDataLocation",
+    NULL,
+    "glMatrixMultdEXT",
+    "glVertexAttrib3svNV",
+    "glTbufferMask3DFX",
+    "glVertexStream4dvATI",
+    "glVertex3sv",
+    "glBindFragDataLocationIndexed",
+    NULL,
+    "glProgramParameter4fNV",
+    "glVertexStream1dATI",
+    NULL,
+    "glBindBufferRangeEXT",
+    "glTexCoordP1uiv",
+    NULL,
+    NULL,
+    "glFramebufferTextureEXT",
+    "glXDrawableAttribARB",
+    "glUniformHandleui64vARB",
+    "glFogCoordPointer",
+    "glMultiTexCoord4xOES",
+    NULL,
+    "glTexCoord4xvOES",
+    "glDeleteQueriesARB",
+    NULL,
+    NULL,
+    "glGetMemoryObjectParameterivEXT",
+    "glColorP4uiv",
+    "glProgramNamedParameter4fvNV",
+    "glClearBufferfi",
+    "glVertexStream1fvATI",
+    "glGetError",
+    "glReplacementCodeuiColor3fVertex3fSUN",
+    NULL,
+    "glWindowPos3iv",
+    "glSignalSemaphoreui64NVX",
+    "glXQueryMaxSwapBarriersSGIX",
+    "glVertexAttrib3hNV",
+    NULL,
+    "glVertexAttribBinding",
+    "glGetTransformFeedbacki64_v",
+    "glRectxOES",
+    "glProgramUniform2iEXT",
+    "glGetUniformi64vNV",
+    NULL,
+    "glGetObjectParameterivARB",
+    "glSpriteParameterivSGIX",
+    "glPassThroughxOES",
+    NULL,
+    "glProvokingVertex",
+    "glPathMemoryGlyphIndexArrayNV",
+    "glRenderGpuMaskNV",
+    "glGetProgramNamedParameterdvNV",
+    "glNormalStream3sATI",
+    NULL,
+    "glFogCoordPointerListIBM",
+    NULL,
+    "glMapParameterfvNV",
+    NULL,
+    "glRasterPos2s",
+    "glVertexAttribI1ui",
+    NULL,
+    "glGetProgramStringARB",
+    "glLightModelxOES",
+    NULL,
+    "glPixelTransferi",
+    NULL,
+    NULL,
+    "glXWaitForSbcOML",
+    NULL,
+    "glWindowPos4svMESA",
+    NULL,
+    "glColor3s",
+    "glNamedBufferData",
+    "glProgramUniform3i64NV",
+    NULL,
+    "glGetColorTableParameterivSGI",
+    "glVertexArrayFogCoordOffsetEXT",
+    "glWindowRectanglesEXT",
+    "glTransformFeedbackBufferBase",
+    "glDrawCommandsNV",
+    NULL,
+    "glXQueryGLXPbufferSGIX",
+    NULL,
+    "glProgramUniformMatrix4x2fv",
+    "glElementPointerAPPLE",
+    "glGetProgramivARB",
+    "glTexEnvi",
+    "glGetShaderiv",
+    "glGetTextureParameterIuiv",
+    "glProgramUniform1ui64vARB",
+    "glGetQueryBufferObjectiv",
+    "glProgramUniformMatrix2x4fv",
+    "glXQueryVersion",
+    "glMultiTexEnvivEXT",
+    NULL,
+    "glEnableVertexAttribAPPLE",
+    "glFragmentMaterialiSGIX",
+    NULL,
+    "glPixelTexGenParameterfSGIS",
+    "glMultiTexCoord4dvARB",
+    NULL,
+    "glNamedFramebufferRenderbuffer",
+    "glColor3hvNV",
+    "glVertexArrayVertexAttribIOffsetEXT",
+    "glMulticastGetQueryObjectivNV",
+    "glGlobalAlphaFactordSUN",
+    "glRectsv",
+    "glWindowPos2dMESA",
+    "glGetObjectBufferivATI",
+    "glFinishObjectAPPLE",
+    "glIndexfv",
+    NULL,
+    "glVertex2bvOES",
+    "glVertexStream3fvATI",
+    "glGetFragmentShadingRatesEXT",
+    "glPointParameterxvOES",
+    "glTextureBufferRange",
+    "glWindowPos2f",
+    "glBindVertexShaderEXT",
+    "glVertexAttribs3fvNV",
+    NULL,
+    "glConservativeRasterParameterfNV",
+    NULL,
+    "glGetMapParameterivNV",
+    NULL,
+    "glGetProgramParameterdvNV",
+    "glColor3d",
+    NULL,
+    NULL,
+    "glDrawCommandsAddressNV",
+    "glFramebufferTextureLayerARB",
+    "glEdgeFlagPointerEXT",
+    "glGenOcclusionQueriesNV",
+    "glTexCoord1xOES",
+    "glDisableClientState",
+    "glViewportIndexedf",
+    NULL,
+    NULL,
+    "glLogicOp",
+    "glXDeleteAssociatedContextAMD",
+    NULL,
+    NULL,
+    "glTextureColorMaskSGIS",
+    "glColorPointerEXT",
+    "glGetObjectLabel",
+    "glGetPerfCounterInfoINTEL",
+    "glColor4b",
+    NULL,
+    "glXQueryCurrentRendererStringMESA",
+    "glAlphaFuncxOES",
+    NULL,
+    NULL,
+    "glCreateBuffers",
+    "glEndPerfMonitorAMD",
+    "glGetProgramSubroutineParameteruivNV",
+    "glMultiDrawArraysEXT",
+    "glGetVideoCaptureStreamfvNV",
+    "glVertexArrayAttribIFormat",
+    NULL,
+    "glPixelTexGenParameteriSGIS",
+    NULL,
+    "glUniform2ui64vARB",
+    "glUniform4fARB",
+    NULL,
+    "glElementPointerATI",
+    "glProgramEnvParameter4fARB",
+    "glGetProgramResourceIndex",
+    NULL,
+    "glDrawRangeElementArrayAPPLE",
+    NULL,
+    NULL,
+    "glDeletePerfQueryINTEL",
+    "glWeightdvARB",
+    "glNamedFramebufferTextureMultiviewOVR",
+    "glXDestroyContext",
+    "glGenProgramsARB",
+    "glPathFogGenNV",
+    NULL,
+    "glUniform3fARB",
+    "glCopyMultiTexImage2DEXT",
+    "glMultiTexCoordP4uiv",
+    "glTexCoord2d",
+    "glFrameZoomSGIX",
+    "glTexCoord4fVertex4fSUN",
+    "glUniform3i",
+    "glXQueryChannelDeltasSGIX",
+    "glTexSubImage3DEXT",
+    "glProgramUniform4ui64NV",
+    "glFogf",
+    "glVertexAttribFormatNV",
+    NULL,
+    "glProgramUniformMatrix3x2fvEXT",
+    "glMultiTexCoord3iv",
+    "glColor3ub",
+    "glGetTexParameterIivEXT",
+    "glVertexAttribL2d",
+    NULL,
+    "glTexBufferEXT",
+    "glTextureStorage2DMultisampleEXT",
+    "glVertexAttrib1svNV",
+    "glFragmentLightivSGIX",
+    NULL,
+    "glGetPathColorGenivNV",
+    "glScalef",
+    "glVertexAttribI1ivEXT",
+    "glVideoCaptureNV",
+    NULL,
+    "glGetnMinmax",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix2x3dv",
+    "glDebugMessageControlARB",
+    "glXGetSelectedEventSGIX",
+    "glVariantuivEXT",
+    "glFlushRasterSGIX",
+    NULL,
+    "glDebugMessageEnableAMD",
+    "glCopyTextureSubImage2DEXT",
+    "glDrawArraysInstancedARB",
+    "glWeightivARB",
+    NULL,
+    "glVertexAttrib4Nbv",
+    NULL,
+    "glMinSampleShadingARB",
+    "glNamedFramebufferSamplePositionsfvAMD",
+    "glPointSize",
+    "glMapVertexAttrib1dAPPLE",
+    "glVertexAttribLFormat",
+    NULL,
+    "glXBindSwapBarrierNV",
+    NULL,
+    "glSecondaryColor3b",
+    "glGetPathColorGenfvNV",
+    "glCompressedTextureSubImage2DEXT",
+    "glSelectPerfMonitorCountersAMD",
+    "glProgramLocalParameter4fvARB",
+    NULL,
+    NULL,
+    NULL,
+    "glEnableClientStateiEXT",
+    "glGetPerfMonitorGroupsAMD",
+    "glUniformMatrix3x2dv",
+    "glNamedFramebufferTextureEXT",
+    "glFragmentCoverageColorNV",
+    "glNormal3hvNV",
+    NULL,
+    "glVertexAttrib1fv",
+    "glUniform1ui64vNV",
+    NULL,
+    NULL,
+    "glUniform2uivEXT",
+    NULL,
+    NULL,
+    "glProgramUniform1ui64ARB",
+    "glVertexP4uiv",
+    NULL,
+    "glXCreateAssociatedContextAMD",
+    "glTexCoordPointerListIBM",
+    "glBindAttribLocationARB",
+    "glUniformMatrix4x3fv",
+    NULL,
+    "glGenTextures",
+    NULL,
+    "glMultiTexCoord4hvNV",
+    "glCopyTexImage1DEXT",
+    "glCopyTexSubImage1D",
+    "glMultiTexCoord1sv",
+    "glProgramParameters4dvNV",
+    "glGetnHistogram",
+    "glRasterPos2xvOES",
+    "glSecondaryColor3usEXT",
+    NULL,
+    NULL,
+    "glTexCoord3hvNV",
+    "glMultiTexCoord1dv",
+    NULL,
+    NULL,
+    "glXCreatePixmap",
+    NULL,
+    "glVertexAttribPointerNV",
+    "glNormal3d",
+    NULL,
+    "glGetnTexImage",
+    "glProgramUniform2uiv",
+    "glGenBuffers",
+    "glGetProgramStringNV",
+    "glVertexAttribLFormatNV",
+    NULL,
+    "glTextureImage2DEXT",
+    "glVDPAUUnregisterSurfaceNV",
+    NULL,
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glGetPixelMapuiv",
+    NULL,
+    "glCopyTextureSubImage2D",
+    NULL,
+    "glSecondaryColor3bvEXT",
+    "glGetVertexArrayIntegeri_vEXT",
+    "glMultiTexCoord4fv",
+    "glWaitSync",
+    "glTextureStorage1D",
+    "glGetTexParameterIiv",
+    "glPixelTexGenParameterivSGIS",
+    NULL,
+    "glVertexAttrib2fv",
+    "glTangent3dvEXT",
+    NULL,
+    "glPointParameteri",
+    "glTexCoord2bvOES",
+    NULL,
+    NULL,
+    NULL,
+    "glWindowPos2svMESA",
+    "glGetPixelMapfv",
+    "glRasterPos2fv",
+    NULL,
+    "glProgramUniform2dvEXT",
+    "glDepthRangeIndexeddNV",
+    "glColor4ubVertex2fvSUN",
+    "glBufferAddressRangeNV",
+    "glFogCoorddvEXT",
+    "glCopyNamedBufferSubData",
+    "glUniform1fARB",
+    "glEndConditionalRenderNVX",
+    "glMultiModeDrawArraysIBM",
+    "glGenFragmentShadersATI",
+    "glVertexAttrib3sNV",
+    "glRotated",
+    "glIsNameAMD",
+    NULL,
+    "glTextureParameterfv",
+    "glGetProgramivNV",
+    NULL,
+    "glTextureSubImage3D",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glMatrixMultTransposefEXT",
+    "glVertexAttribI4iv",
+    "glNormalStream3svATI",
+    "glRotatexOES",
+    "glGenVertexShadersEXT",
+    NULL,
+    NULL,
+    "glProgramUniform4fv",
+    NULL,
+    "glCompileCommandListNV",
+    "glXBlitContextFramebufferAMD",
+    "glTexCoordPointerEXT",
+    "glCreateTextures",
+    "glGetQueryivARB",
+    "glNormalStream3fvATI",
+    NULL,
+    "glXCreateContext",
+    "glNamedProgramLocalParameterI4uivEXT",
+    "glMap1xOES",
+    "glCopyImageSubDataNV",
+    "glTexCoord4iv",
+    "glReadInstrumentsSGIX",
+    "glMap1f",
+    NULL,
+    NULL,
+    "glVertexAttrib4dv",
+    "glMapBufferARB",
+    NULL,
+    "glProgramParameteri",
+    "glVertexAttrib1sv",
+    "glBinormal3bEXT",
+    "glVertexArrayVertexAttribIFormatEXT",
+    "glWindowPos4dvMESA",
+    "glListDrawCommandsStatesClientNV",
+    "glFragmentLightfSGIX",
+    "glMultiTexCoord3sv",
+    NULL,
+    NULL,
+    "glPathParameterfNV",
+    "glIsVertexAttribEnabledAPPLE",
+    "glDrawVkImageNV",
+    "glMapGrid2xOES",
+    "glDrawElementArrayATI",
+    NULL,
+    "glNormal3fVertex3fvSUN",
+    "glGetOcclusionQueryuivNV",
+    "glCompressedTexImage2DARB",
+    "glUniform2ui",
+    "glClearIndex",
+    "glGetProgramResourcefvNV",
+    NULL,
+    "glMultiDrawElementsIndirectCountARB",
+    "glBindBuffersBase",
+    "glGetMaterialxOES",
+    "glTexGeni",
+    NULL,
+    "glWriteMaskEXT",
+    NULL,
+    "glTexCoord4i",
+    NULL,
+    "glDeleteRenderbuffers",
+    NULL,
+    "glUniform1iv",
+    NULL,
+    NULL,
+    NULL,
+    "glUniform1fv",
+    "glMultiTexCoord3svARB",
+    "glVertexAttribParameteriAMD",
+    "glClearColorIiEXT",
+    "glShadingRateImageBarrierNV",
+    "glGetMultiTexParameterIivEXT",
+    "glProgramUniform4ui64ARB",
+    "glGetColorTable",
+    "glMatrixMultfEXT",
+    NULL,
+    NULL,
+    "glTextureLightEXT",
+    "glMultiTexCoord1hvNV",
+    "glUniform1ui64NV",
+    "glXGetFrameUsageMESA",
+    "glFogxvOES",
+    "glWindowPos2fv",
+    "glDrawRangeElementsEXT",
+    "glFramebufferFetchBarrierEXT",
+    "glDisableVertexAttribArray",
+    "glGetUniformOffsetEXT",
+    "glGetVertexAttribIuivEXT",
+    NULL,
+    "glTexImage3DMultisample",
+    NULL,
+    "glUniform2ivARB",
+    NULL,
+    NULL,
+    "glMultiDrawArraysIndirectCountARB",
+    "glClampColorARB",
+    "glSecondaryColor3usv",
+    "glGetMultiTexParameterivEXT",
+    NULL,
+    "glPatchParameteri",
+    "glPixelDataRangeNV",
+    "glMultiTexSubImage1DEXT",
+    "glMultiDrawArraysIndirect",
+    "glNamedProgramLocalParameter4dvEXT",
+    "glGetFloati_v",
+    "glFlushMappedBufferRange",
+    "glCoverStrokePathInstancedNV",
+    NULL,
+    "glUniform4uiv",
+    "glGetNamedBufferPointervEXT",
+    NULL,
+    "glFramebufferSampleLocationsfvARB",
+    "glAlphaFragmentOp2ATI",
+    NULL,
+    "glVertexAttrib4NivARB",
+    "glIndexf",
+    "glMultiTexCoord1i",
+    "glListParameterfSGIX",
+    "glProgramUniformMatrix2fvEXT",
+    NULL,
+    "glGetTexGenxvOES",
+    "glUniform3ui64vARB",
+    "glColor3fVertex3fSUN",
+    "glVertex3i",
+    "glStencilOp",
+    NULL,
+    "glVertexAttribI4bv",
+    "glTextureParameterfvEXT",
+    "glUniform2i64vARB",
+    "glSecondaryColor3ub",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexBlendEnviATI",
+    "glIsFenceAPPLE",
+    "glVertexAttrib4Niv",
+    "glTexCoord1d",
+    "glPresentFrameKeyedNV",
+    NULL,
+    "glImageTransformParameterfvHP",
+    "glGetNamedRenderbufferParameterivEXT",
+    "glXGetCurrentReadDrawable",
+    NULL,
+    NULL,
+    "glGetVertexAttribdvARB",
+    "glVertexAttrib4NubARB",
+    "glAttachObjectARB",
+    "glCreateProgramObjectARB",
+    NULL,
+    "glReplacementCodeuiColor4ubVertex3fSUN",
+    NULL,
+    "glDispatchCompute",
+    "glRasterPos2sv",
+    "glCoverageModulationTableNV",
+    "glGetActiveUniformName",
+    "glGetTextureParameterIuivEXT",
+    "glGetTextureParameteriv",
+    "glGetTexBumpParameterfvATI",
+    "glTessellationFactorAMD",
+    "glXChannelRectSGIX",
+    "glClearBufferuiv",
+    "glNamedFramebufferTextureLayerEXT",
+    "glTexCoord4bvOES",
+    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+    "glPointSizexOES",
+    "glShaderOp3EXT",
+    "glGetActiveSubroutineName",
+    "glGetTexEnviv",
+    NULL,
+    "glNamedProgramLocalParameterI4iEXT",
+    "glEndVertexShaderEXT",
+    NULL,
+    "glMaterialxvOES",
+    "glXDestroyPbuffer",
+    "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+    NULL,
+    NULL,
+    "glDrawBuffers",
+    NULL,
+    "glMultiTexCoord2fvARB",
+    "glCopyTextureSubImage1D",
+    NULL,
+    "glIsFenceNV",
+    "glLighti",
+    "glIsBufferARB",
+    "glTexCoord3d",
+    "glVertexAttrib2hvNV",
+    "glUniform3ui64vNV",
+    NULL,
+    "glMultiTexCoord3f",
+    "glProgramUniform4fvEXT",
+    NULL,
+    "glGetShaderSource",
+    "glDeformationMap3fSGIX",
+    "glReplacementCodeubSUN",
+    "glCompressedTextureSubImage1D",
+    "glTexCoord3i",
+    "glVertexAttrib1hvNV",
+    "glMultiTexCoordP3ui",
+    "glColor3hNV",
+    "glDeleteTexturesEXT",
+    "glVertexAttribI1uiEXT",
+    "glGetProgramEnvParameterfvARB",
+    "glUnmapNamedBuffer",
+    "glMultiTexCoord1dARB",
+    "glColor3ui",
+    "glMatrixFrustumEXT",
+    "glFlushStaticDataIBM",
+    "glBindShadingRateImageNV",
+    "glMakeBufferResidentNV",
+    "glVertexStream3fATI",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix2x3fv",
+    NULL,
+    NULL,
+    "glIsList",
+    NULL,
+    "glVertexArrayMultiTexCoordOffsetEXT",
+    NULL,
+    "glVertexAttrib1fvARB",
+    "glVertexAttribs4fvNV",
+    "glBlendEquationEXT",
+    "glPolygonOffsetxOES",
+    "glBlendFunciARB",
+    "glGlobalAlphaFactoruiSUN",
+    "glProgramUniformMatrix2x4dvEXT",
+    "glWindowPos2iv",
+    "glDrawMeshTasksIndirectNV",
+    "glVertexAttribL1ui64ARB",
+    "glGetPolygonStipple",
+    "glWindowPos3dvARB",
+    "glVertex4fv",
+    "glMatrixLoaddEXT",
+    "glVertexArrayParameteriAPPLE",
+    "glEnableVertexArrayEXT",
+    "glConvolutionParameterfEXT",
+    NULL,
+    NULL,
+    "glXCreateGLXPixmapWithConfigSGIX",
+    "glBindImageTextureEXT",
+    "glVertexAttribI4svEXT",
+    NULL,
+    "glXChannelRectSyncSGIX",
+    NULL,
+    "glPopDebugGroup",
+    "glVertex4xOES",
+    "glBlendEquationSeparate",
+    NULL,
+    "glDebugMessageCallbackAMD",
+    NULL,
+    "glGetTextureLevelParameterfvEXT",
+    "glTextureParameterIiv",
+    "glGenTexturesEXT",
+    "glGetTextureImage",
+    "glProgramParameter4dvNV",
+    "glGetnPixelMapfv",
+    "glTexParameterIiv",
+    "glEvalCoord2xvOES",
+    "glGetGraphicsResetStatusARB",
+    "glMultiDrawElementArrayAPPLE",
+    "glMakeNamedBufferResidentNV",
+    "glWindowPos3svMESA",
+    "glTexFilterFuncSGIS",
+    "glVertexP3uiv",
+    "glFramebufferTexture3DEXT",
+    "glRasterPos3d",
+    "glDrawMeshTasksNV",
+    NULL,
+    "glGetPointerv",
+    "glXCreateContextAttribsARB",
+    "glRectdv",
+    "glCreateSemaphoresNV",
+    "glPathSubCommandsNV",
+    "glMapNamedBufferRange",
+    NULL,
+    NULL,
+    "glCompressedMultiTexImage1DEXT",
+    "glProgramEnvParameterI4uiNV",
+    "glVertexAttrib2fNV",
+    "glGetnPixelMapusv",
+    "glNamedProgramLocalParametersI4uivEXT",
+    "glNormalPointervINTEL",
+    "glFinishFenceNV",
+    NULL,
+    NULL,
+    "glGetListParameterfvSGIX",
+    "glGetnConvolutionFilterARB",
+    "glFramebufferSamplePositionsfvAMD",
+    NULL,
+    "glGetTexLevelParameterxvOES",
+    "glTexCoord3xvOES",
+    "glUniform4ivARB",
+    "glVertexAttribI4ui",
+    "glCopyTexSubImage2DEXT",
+    NULL,
+    "glDepthRangexOES",
+    "glGetTextureParameterIiv",
+    "glIsTextureEXT",
+    "glMatrixIndexPointerARB",
+    NULL,
+    "glGetPerfMonitorCounterStringAMD",
+    "glRasterPos4dv",
+    NULL,
+    "glLightModeliv",
+    "glGetArrayObjectivATI",
+    "glGetnPixelMapfvARB",
+    "glPointParameterfEXT",
+    "glCreateProgramPipelines",
+    NULL,
+    "glUniform2ui64ARB",
+    "glSamplerParameteri",
+    "glDeformSGIX",
+    "glWindowPos3ivMESA",
+    NULL,
+    "glMultiTexCoord3s",
+    "glVertexWeighthNV",
+    "glColorTableEXT",
+    NULL,
+    NULL,
+    "glMultiDrawElementsIndirectBindlessNV",
+    NULL,
+    NULL,
+    "glEvalMesh2",
+    "glPathGlyphsNV",
+    "glMultiTexImage1DEXT",
+    "glProgramUniformMatrix2fv",
+    "glNormal3xvOES",
+    "glUniform3i64vNV",
+    NULL,
+    "glColor4us",
+    NULL,
+    NULL,
+    NULL,
+    "glDeformationMap3dSGIX",
+    "glDeleteOcclusionQueriesNV",
+    "glCopyTexImage2D",
+    "glTexCoord4hNV",
+    "glTessellationModeAMD",
+    "glVertexAttrib1dvARB",
+    NULL,
+    "glTexCoord2fNormal3fVertex3fvSUN",
+    "glLightModelxvOES",
+    "glNormal3sv",
+    "glClearDepthfOES",
+    "glLinkProgram",
+    "glFramebufferRenderbuffer",
+    NULL,
+    "glPopGroupMarkerEXT",
+    "glProgramUniform2ivEXT",
+    "glVertexAttribIPointer",
+    NULL,
+    "glMultiTexCoord4iARB",
+    NULL,
+    "glXGetSwapIntervalMESA",
+    NULL,
+    "glFramebufferShadingRateEXT",
+    "glBlendFuncSeparateINGR",
+    "glDrawTransformFeedbackNV",
+    "glLoadMatrixf",
+    "glVertexStream4dATI",
+    "glGetStringi",
+    "glShaderOp2EXT",
+    "glMatrixLoadTranspose3x3fNV",
+    "glSecondaryColor3bv",
+    "glValidateProgram",
+    "glMaterialfv",
+    "glXGetMscRateOML",
+    "glTextureParameteri",
+    "glNamedRenderbufferStorage",
+    "glGetColorTableSGI",
+    "glGenBuffersARB",
+    "glGetTextureLevelParameterfv",
+    "glNormal3bv",
+    "glGetBufferSubDataARB",
+    NULL,
+    "glVertexStream4fATI",
+    NULL,
+    "glMultiTexCoord3hvNV",
+    NULL,
+    "glVertexAttribP1uiv",
+    "glWindowPos2sMESA",
+    "glActiveTextureARB",
+    NULL,
+    NULL,
+    "glConvolutionParameteriEXT",
+    "glGetFragmentMaterialivSGIX",
+    NULL,
+    "glIsSampler",
+    "glVertexAttrib4Nuiv",
+    "glGetTrackMatrixivNV",
+    "glGetUniformLocationARB",
+    "glGetVideoivNV",
+    "glMultiTexCoord3ivARB",
+    "glEvalMesh1",
+    "glConvolutionParameterxOES",
+    "glPrioritizeTexturesxOES",
+    "glMultiTexCoord2xvOES",
+    "glXJoinSwapGroupSGIX",
+    "glXChooseFBConfig",
+    "glIndexPointerEXT",
+    "glVertexStream1sATI",
+    NULL,
+    NULL,
+    NULL,
+    "glLockArraysEXT",
+    "glGetInfoLogARB",
+    "glGetnColorTable",
+    NULL,
+    "glSamplerParameterIiv",
+    "glSecondaryColor3d",
+    "glVertexAttribFormat",
+    NULL,
+    "glProgramUniform1uivEXT",
+    "glGetProgramLocalParameterIuivNV",
+    NULL,
+    "glDeleteFragmentShaderATI",
+    "glOrthofOES",
+    "glSecondaryColor3dvEXT",
+    "glGetLightxOES",
+    "glBlendColorEXT",
+    NULL,
+    "glResetHistogram",
+    "glColor4sv",
+    "glGetMinmaxParameterivEXT",
+    "glEndVideoCaptureNV",
+    NULL,
+    NULL,
+    "glProgramUniform4d",
+    "glCopyImageSubData",
+    "glNormalP3uiv",
+    "glTextureBufferRangeEXT",
+    "glFramebufferTexture1D",
+    NULL,
+    NULL,
+    "glTexBumpParameterfvATI",
+    "glPollInstrumentsSGIX",
+    "glPointAlongPathNV",
+    "glVariantdvEXT",
+    NULL,
+    "glCoverageModulationNV",
+    "glWeightubvARB",
+    "glVertexAttrib4fv",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexGenfvEXT",
+    "glProgramVertexLimitNV",
+    "glCheckNamedFramebufferStatusEXT",
+    "glSecondaryColor3s",
+    "glTextureView",
+    "glVertexAttribI3i",
+    NULL,
+    "glTextureImage3DEXT",
+    "glTextureParameteriv",
+    "glMultiTexCoord3iARB",
+    NULL,
+    "glWindowPos3fvARB",
+    "glLightModeli",
+    "glPushDebugGroup",
+    NULL,
+    "glXQueryRendererStringMESA",
+    NULL,
+    NULL,
+    "glMatrixIndexusvARB",
+    "glGetMultiTexLevelParameterivEXT",
+    "glProvokingVertexEXT",
+    NULL,
+    "glGetRenderbufferParameteriv",
+    NULL,
+    "glEvalCoord1xvOES",
+    "glGetFloatIndexedvEXT",
+    "glVertexWeightfvEXT",
+    NULL,
+    "glGetUnsignedBytevEXT",
+    "glVertexAttrib2sARB",
+    NULL,
+    "glVDPAUGetSurfaceivNV",
+    "glProgramUniformMatrix4x2fvEXT",
+    NULL,
+    "glXImportContextEXT",
+    "glCompressedTextureImage3DEXT",
+    "glProgramUniform4ui64vARB",
+    "glEndList",
+    "glDrawArraysInstancedBaseInstance",
+    "glVertexAttribL1dv",
+    NULL,
+    NULL,
+    "glDeleteTextures",
+    "glRotatef",
+    NULL,
+    NULL,
+    "glVertexAttrib3dvNV",
+    NULL,
+    "glTextureStorage3D",
+    NULL,
+    NULL,
+    "glUseProgramStages",
+    "glGetCombinerInputParameterivNV",
+    NULL,
+    "glTextureImage2DMultisampleCoverageNV",
+    NULL,
+    "glInterpolatePathsNV",
+    "glNormal3b",
+    "glNormal3iv",
+    NULL,
+    NULL,
+    "glGetQueryiv",
+    NULL,
+    "glFrameTerminatorGREMEDY",
+    "glDisableVariantClientStateEXT",
+    "glEndConditionalRenderNV",
+    NULL,
+    "glVDPAURegisterVideoSurfaceWithPictureStructureNV",
+    "glVertexAttribL1ui64vNV",
+    "glGetFramebufferAttachmentParameterivEXT",
+    "glCopyMultiTexSubImage1DEXT",
+    "glGetLocalConstantBooleanvEXT",
+    "glProgramUniformMatrix3x2dvEXT",
+    NULL,
+    "glPNTrianglesiATI",
+    "glClearNamedFramebufferfi",
+    "glResolveDepthValuesNV",
+    "glXCopySubBufferMESA",
+    "glGetUniformuivEXT",
+    "glEvalCoord2dv",
+    "glGetInternalformatSampleivNV",
+    "glMultiTexCoord3fARB",
+    NULL,
+    "glHintPGI",
+    "glMap1d",
+    "glEndQueryIndexed",
+    "glBlendEquationIndexedAMD",
+    "glProgramUniform2dv",
+    "glBlendFuncSeparateIndexedAMD",
+    "glProgramBufferParametersIuivNV",
+    "glXGetVisualFromFBConfig",
+    NULL,
+    "glMemoryBarrier",
+    "glRects",
+    "glGetNamedStringARB",
+    "glXSwapIntervalMESA",
+    "glVertex3hvNV",
+    "glMultiTexCoord2sARB",
+    "glDeleteStatesNV",
+    NULL,
+    "glColor4bv",
+    NULL,
+    "glDeleteTransformFeedbacksNV",
+    "glFramebufferTextureARB",
+    "glDebugMessageCallback",
+    "glXGetCurrentDrawable",
+    "glVertex3xOES",
+    "glDeleteObjectARB",
+    "glGetBufferPointerv",
+    NULL,
+    "glMatrixLoad3x3fNV",
+    "glTexStorageMem2DEXT",
+    "glUniform2iv",
+    "glMatrixLoad3x2fNV",
+    "glNamedCopyBufferSubDataEXT",
+    "glProgramUniform2ui64ARB",
+    "glMultiTexCoord3dv",
+    "glMulticastScissorArrayvNVX",
+    "glStencilOpSeparate",
+    "glSamplerParameteriv",
+    "glWindowPos3d",
+    "glCullParameterdvEXT",
+    NULL,
+    "glUnlockArraysEXT",
+    "glCheckFramebufferStatusEXT",
+    "glGetnMapfv",
+    "glEndTransformFeedbackNV",
+    "glProgramUniform2fEXT",
+    "glVertexAttribs2dvNV",
+    "glLightxOES",
+    "glIsMemoryObjectEXT",
+    NULL,
+    "glBlendFuncSeparateEXT",
+    "glEnableIndexedEXT",
+    "glIsImageHandleResidentNV",
+    "glBufferStorageExternalEXT",
+    "glTexCoord4f",
+    "glGetObjectLabelEXT",
+    NULL,
+    "glDeleteFencesAPPLE",
+    "glVertexAttrib4NuivARB",
+    "glVertex4hNV",
+    "glWeightuivARB",
+    NULL,
+    "glUniform3i64ARB",
+    "glGetProgramInterfaceiv",
+    "glUniform4i64vNV",
+    "glPrimitiveBoundingBoxARB",
+    "glMultiDrawElements",
+    "glTexImage3DMultisampleCoverageNV",
+    "glColorMaskIndexedEXT",
+    NULL,
+    "glBufferAttachMemoryNV",
+    "glPauseTransformFeedback",
+    "glProgramEnvParameterI4ivNV",
+    "glMultiTexCoord3xvOES",
+    "glMultiTexCoord2ivARB",
+    "glColor4ubVertex3fSUN",
+    "glGetnPixelMapuivARB",
+    "glProgramEnvParameterI4iNV",
+    "glUniform2fvARB",
+    "glGetVertexAttribdvNV",
+    "glGetMaterialfv",
+    "glTexCoord2f",
+    "glEvaluateDepthValuesARB",
+    NULL,
+    "glCreateCommandListsNV",
+    "glVertexAttrib4ubvARB",
+    "glXGetAGPOffsetMESA",
+    "glColor4ubVertex2fSUN",
+    "glVertexAttrib4fvNV",
+    "glGetnHistogramARB",
+    "glVertexAttribP2uiv",
+    "glGetClipPlane",
+    "glWindowPos3iMESA",
+    "glUseProgram",
+    "glBlendFuncSeparate",
+    "glTexCoordP3uiv",
+    "glGetPathSpacingNV",
+    "glMultiTexCoord3d",
+    "glVertexStream4sATI",
+    NULL,
+    "glVertexAttrib2dv",
+    "glXCreatePbuffer",
+    "glIndexxvOES",
+    "glEvalCoord2fv",
+    NULL,
+    "glMultiDrawArraysIndirectAMD",
+    "glProgramUniform2uiEXT",
+    "glColor4d",
+    "glMultiTexCoord1bvOES",
+    "glUniform3fvARB",
+    "glProgramUniform4uiv",
+    NULL,
+    "glGetFragmentMaterialfvSGIX",
+    "glTexCoordP4ui",
+    "glVertexAttribL4ui64vNV",
+    NULL,
+    NULL,
+    "glVertexAttrib1fvNV",
+    "glLoadName",
+    "glCompressedTexSubImage2D",
+    "glUniform2uiv",
+    NULL,
+    "glEnd",
+    "glBlendEquationSeparateATI",
+    NULL,
+    "glTextureNormalEXT",
+    "glCombinerParameterfvNV",
+    "glVertexArrayEdgeFlagOffsetEXT",
+    "glTexCoordFormatNV",
+    "glGenSymbolsEXT",
+    NULL,
+    "glVertexP4ui",
+    "glGetPathParameterivNV",
+    "glGetFloati_vEXT",
+    "glGetDoubleIndexedvEXT",
+    "glGetInternalformati64v",
+    "glGetActiveUniformBlockiv",
+    "glXBindHyperpipeSGIX",
+    "glTexParameterxvOES",
+    "glMultiTexCoordP1ui",
+    "glGetPixelMapusv",
+    "glProgramUniform3i64ARB",
+    NULL,
+    "glGetCompressedTexImageARB",
+    "glProgramUniform2i64vARB",
+    "glGetBufferParameterui64vNV",
+    "glCopyTextureImage2DEXT",
+    "glGetUniformi64vARB",
+    "glMatrixRotatedEXT",
+    "glGetUniformBufferSizeEXT",
+    "glGetnUniformdvARB",
+    "glBindBufferBaseEXT",
+    "glUniform4i64NV",
+    "glStencilFuncSeparateATI",
+    "glCommandListSegmentsNV",
+    NULL,
+    NULL,
+    "glGetTextureParameterfv",
+    NULL,
+    "glLightModelfv",
+    "glIsCommandListNV",
+    "glProgramNamedParameter4dvNV",
+    "glGetMemoryObjectDetachedResourcesuivNV",
+    "glGetRenderbufferParameterivEXT",
+    "glGetnUniformivARB",
+    "glNamedBufferStorageEXT",
+    "glImportSemaphoreWin32NameEXT",
+    NULL,
+    "glCreateShaderProgramEXT",
+    "glMaterialxOES",
+    "glImportSyncEXT",
+    NULL,
+    NULL,
+    "glQueryCounter",
+    "glGetProgramInfoLog",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glDeleteFramebuffersEXT",
+    NULL,
+    NULL,
+    "glConvolutionParameterxvOES",
+    "glColor4f",
+    "glPixelTransformParameterfEXT",
+    "glProgramUniform1iEXT",
+    NULL,
+    "glGetFixedvOES",
+    "glGetnColorTableARB",
+    "glReplacementCodeuiColor4ubVertex3fvSUN",
+    "glProgramEnvParameter4fvARB",
+    "glDebugMessageInsertARB",
+    NULL,
+    "glColor4usv",
+    "glPointParameterivNV",
+    "glGetTexImage",
+    "glProgramUniform2i64NV",
+    "glPathParameterfvNV",
+    "glMap2xOES",
+    "glVariantArrayObjectATI",
+    "glGetPathTexGenivNV",
+    "glCoverFillPathNV",
+    "glGetFragmentLightfvSGIX",
+    "glMulticastCopyBufferSubDataNV",
+    NULL,
+    "glVertexAttribL3i64vNV",
+    "glVertexStream2dvATI",
+    "glAccum",
+    NULL,
+    "glXBindVideoImageNV",
+    "glNamedFramebufferParameteri",
+    "glClearNamedFramebufferfv",
+    "glShaderSource",
+    NULL,
+    NULL,
+    "glColor3usv",
+    NULL,
+    "glTexBufferRange",
+    "glColor4uiv",
+    "glGetMapxvOES",
+    "glTexImage2DMultisample",
+    "glVertexAttrib3fv",
+    "glOrtho",
+    NULL,
+    "glXCreateAssociatedContextAttribsAMD",
+    "glPathStringNV",
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glGetBufferParameterivARB",
+    "glTexSubImage1DEXT",
+    NULL,
+    NULL,
+    "glProgramEnvParametersI4ivNV",
+    "glActiveProgramEXT",
+    "glBindProgramPipeline",
+    "glGetObjectBufferfvATI",
+    "glLabelObjectEXT",
+    "glIsFramebufferEXT",
+    NULL,
+    NULL,
+    "glAreProgramsResidentNV",
+    "glUniformMatrix3fv",
+    "glWindowPos2dARB",
+    "glTexturePageCommitmentMemNV",
+    "glVertexAttrib3dvARB",
+    "glResizeBuffersMESA",
+    "glVertexAttrib2d",
+    NULL,
+    "glMinmaxEXT",
+    NULL,
+    NULL,
+    "glCompileShaderIncludeARB",
+    "glTangentPointerEXT",
+    "glGetQueryObjecti64v",
+    "glGetMultiTexEnvivEXT",
+    NULL,
+    "glVertexArrayRangeNV",
+    NULL,
+    "glShadingRateEXT",
+    "glSecondaryColor3us",
+    "glFragmentLightModeliSGIX",
+    "glNormal3i",
+    "glGetPathDashArrayNV",
+    NULL,
+    "glBindVertexArrayAPPLE",
+    "glIndexMaterialEXT",
+    NULL,
+    "glUniform2fARB",
+    "glWindowPos3sv",
+    NULL,
+    NULL,
+    "glTexCoordP4uiv",
+    NULL,
+    "glMapGrid2f",
+    "glVertex2iv",
+    "glVertexArrayVertexAttribLFormatEXT",
+    "glBufferSubDataARB",
+    "glDrawMeshArraysSUN",
+    "glPollAsyncSGIX",
+    "glGetCombinerOutputParameterivNV",
+    "glProgramUniform2f",
+    NULL,
+    "glTangent3bvEXT",
+    "glStateCaptureNV",
+    "glProgramUniformMatrix3fvEXT",
+    "glProgramUniformMatrix3x2fv",
+    "glReplacementCodeuiSUN",
+    "glBeginQueryARB",
+    "glNamedBufferStorage",
+    "glGetActiveUniformBlockName",
+    "glGetSamplerParameterfv",
+    "glDeleteFramebuffers",
+    "glGetVideoCaptureStreamivNV",
+    NULL,
+    "glPushMatrix",
+    NULL,
+    "glGetTextureHandleNV",
+    "glWeightPathsNV",
+    "glMapTexture2DINTEL",
+    NULL,
+    NULL,
+    "glTexAttachMemoryNV",
+    "glMultiTexCoord2d",
+    NULL,
+    "glMultiTexCoord2bOES",
+    "glTexSubImage2DEXT",
+    NULL,
+    "glClearNamedBufferSubData",
+    "glMultiTexCoord2iv",
+    NULL,
+    "glGetHistogram",
+    NULL,
+    "glVertexFormatNV",
+    NULL,
+    NULL,
+    "glLGPUInterlockNVX",
+    "glXWaitForMscOML",
+    "glMultiTexCoord1s",
+    "glEnablei",
+    "glValidateProgramARB",
+    "glDeleteBuffersARB",
+    "glGetActiveAttrib",
+    "glGetObjectParameterfvARB",
+    NULL,
+    "glIsShader",
+    NULL,
+    "glGetnMapiv",
+    NULL,
+    "glGetTextureSamplerHandleNV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glVertexAttrib4fNV",
+    "glPixelZoomxOES",
+    "glActiveVaryingNV",
+    "glSecondaryColor3ui",
+    "glGetProgramEnvParameterIuivNV",
+    "glEndOcclusionQueryNV",
+    "glUniformMatrix3dv",
+    NULL,
+    NULL,
+    "glDepthRangeArraydvNV",
+    "glVertex4xvOES",
+    NULL,
+    "glUniform4ui",
+    "glSampleMapATI",
+    "glMakeImageHandleResidentARB",
+    "glEvalCoord2xOES",
+    NULL,
+    "glMultiTexCoord4bOES",
+    "glBindBufferBase",
+    "glTexCoordPointervINTEL",
+    "glMapBufferRange",
+    "glBlendFunc",
+    "glBeginConditionalRender",
+    "glPolygonMode",
+    NULL,
+    "glBeginTransformFeedbackEXT",
+    NULL,
+    "glNormalPointer",
+    "glUniformMatrix4x3dv",
+    "glUniformHandleui64ARB",
+    NULL,
+    "glMultiTexCoordPointerEXT",
+    "glMultiTexCoord4s",
+    "glNamedBufferSubData",
+    NULL,
+    "glGetnUniformuiv",
+    NULL,
+    "glEvalCoord2f",
+    "glInvalidateBufferData",
+    "glSeparableFilter2DEXT",
+    "glGetTextureLevelParameteriv",
+    "glProgramUniform3dEXT",
+    "glVertexAttrib1s",
+    "glGenFramebuffersEXT",
+    "glRasterPos3iv",
+    "glTexImage3DEXT",
+    "glFogCoordfvEXT",
+    "glNamedFramebufferDrawBuffer",
+    "glGetActiveAtomicCounterBufferiv",
+    NULL,
+    "glDeleteSync",
+    "glMatrixTranslatedEXT",
+    "glObjectLabel",
+    "glGetPathMetricsNV",
+    NULL,
+    "glXDestroyWindow",
+    "glVertex3s",
+    "glGetConvolutionParameterfvEXT",
+    NULL,
+    NULL,
+    "glCombinerParameteriNV",
+    NULL,
+    "glDisableVertexAttribArrayARB",
+    "glColorFragmentOp1ATI",
+    "glBlendBarrierKHR",
+    "glTexCoord1s",
+    "glTexCoord4bOES",
+    "glUniform4fv",
+    "glPushGroupMarkerEXT",
+    "glTextureBufferEXT",
+    NULL,
+    NULL,
+    "glGetUniformfv",
+    "glXQueryServerString",
+    NULL,
+    "glDrawTransformFeedbackStreamInstanced",
+    NULL,
+    "glVertexAttribs3dvNV",
+    NULL,
+    "glMaxShaderCompilerThreadsARB",
+    "glVertexAttribI2ivEXT",
+    "glActiveStencilFaceEXT",
+    NULL,
+    NULL,
+    "glMultiTexCoord4sARB",
+    "glMatrixMultTransposedEXT",
+    "glFragmentLightModelfSGIX",
+    NULL,
+    "glMultiTexCoord3fv",
+    NULL,
+    "glVertexAttrib2dvARB",
+    NULL,
+    "glMultiTexRenderbufferEXT",
+    "glColor4ubv",
+    "glMultiTexCoord3bvOES",
+    NULL,
+    "glBindSampler",
+    NULL,
+    NULL,
+    "glIndexMask",
+    "glXQueryRendererIntegerMESA",
+    NULL,
+    "glNormal3s",
+    NULL,
+    "glMultiDrawElementsIndirectCount",
+    NULL,
+    "glVertexAttribL2i64NV",
+    NULL,
+    NULL,
+    "glVertexAttribL4i64NV",
+    NULL,
+    "glUnmapNamedBufferEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glGetProgramLocalParameterfvARB",
+    "glCullFace",
+    "glPixelMapuiv",
+    "glBlendColor",
+    NULL,
+    NULL,
+    "glTextureStorageMem3DMultisampleEXT",
+    "glSecondaryColor3i",
+    NULL,
+    NULL,
+    "glClear",
+    "glBlendEquationSeparateiARB",
+    NULL,
+    "glColor4i",
+    "glBindImageTexture",
+    "glColor3xvOES",
+    "glVertexAttribL4i64vNV",
+    "glGetTextureParameterIivEXT",
+    NULL,
+    "glViewportArrayv",
+    NULL,
+    NULL,
+    "glGetAttribLocation",
+    "glVertexAttribs1svNV",
+    "glMatrixScaledEXT",
+    "glWindowPos2sv",
+    "glBufferData",
+    "glNamedStringARB",
+    "glTexCoord3fv",
+    "glVertexAttrib1d",
+    "glPixelTexGenSGIX",
+    "glGetAttachedObjectsARB",
+    "glGetVertexAttribIuiv",
+    "glResumeTransformFeedback",
+    "glNamedProgramLocalParameters4fvEXT",
+    "glLightfv",
+    "glVertexAttribI4uivEXT",
+    "glSwizzleEXT",
+    "glUniform2d",
+    NULL,
+    "glGetHandleARB",
+    "glProgramUniformMatrix4fvEXT",
+    NULL,
+    "glGetQueryObjectui64vEXT",
+    "glDrawMeshTasksIndirectEXT",
+    "glFramebufferDrawBuffersEXT",
+    "glGenVertexArraysAPPLE",
+    "glVertex2dv",
+    "glNormalPointerListIBM",
+    "glUniform2ui64vNV",
+    NULL,
+    "glGetNamedBufferParameterui64vNV",
+    "glBindAttribLocation",
+    NULL,
+    "glDepthBoundsdNV",
+    "glConvolutionParameterfvEXT",
+    "glUniform3ui",
+    "glClearDepthxOES",
+    "glNamedProgramLocalParameter4dEXT",
+    "glBlendEquation",
+    NULL,
+    "glGetVertexAttribLdvEXT",
+    NULL,
+    "glShaderOp1EXT",
+    NULL,
+    "glClearBufferiv",
+    "glTexParameteri",
+    NULL,
+    "glMultTransposeMatrixd",
+    NULL,
+    NULL,
+    "glColor4ui",
+    NULL,
+    NULL,
+    "glSpriteParameterfvSGIX",
+    "glLineWidth",
+    "glGetVaryingLocationNV",
+    "glVideoCaptureStreamParameterivNV",
+    "glSecondaryColorPointer",
+    "glBlendBarrierNV",
+    "glGenAsyncMarkersSGIX",
+    "glMultiTexCoord3hNV",
+    "glTransformFeedbackBufferRange",
+    "glGetColorTableParameterivEXT",
+    "glBeginConditionalRenderNVX",
+    "glProgramUniformMatrix4dv",
+    "glMatrixMode",
+    NULL,
+    "glXChooseVisual",
+    NULL,
+    "glWindowPos2dv",
+    "glGetNamedStringivARB",
+    "glDrawBuffer",
+    "glNormalStream3bATI",
+    "glXReleaseVideoDeviceNV",
+    NULL,
+    "glShadingRateSampleOrderCustomNV",
+    "glGetSemaphoreParameterivNV",
+    "glGetQueryObjectuiv",
+    "glVertexArrayElementBuffer",
+    "glGetFinalCombinerInputParameterivNV",
+    NULL,
+    NULL,
+    NULL,
+    "glShaderBinary",
+    "glGetVertexAttribIivEXT",
+    "glEvalCoord1d",
+    "glDrawTransformFeedbackStream",
+    "glGetUniformLocation",
+    NULL,
+    "glFlushVertexArrayRangeAPPLE",
+    "glVertexAttribL2dvEXT",
+    "glBitmap",
+    "glSecondaryColor3dEXT",
+    "glLineWidthxOES",
+    "glProgramUniformMatrix2x4dv",
+    "glPolygonOffset",
+    "glPassThrough",
+    "glGetTexParameterPointervAPPLE",
+    "glMultiTexCoord4iv",
+    "glVertexAttribI4uiv",
+    "glMultTransposeMatrixxOES",
+    "glProgramUniform3iEXT",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glVertexAttribI3ivEXT",
+    "glGetTexGendv",
+    "glGetPerfMonitorGroupStringAMD",
+    "glPathCoordsNV",
+    "glCreateRenderbuffers",
+    NULL,
+    "glVertexAttrib2s",
+    "glScissorIndexed",
+    NULL,
+    NULL,
+    "glGetPerfQueryDataINTEL",
+    "glDepthRangeIndexed",
+    NULL,
+    "glCopyMultiTexSubImage3DEXT",
+    NULL,
+    "glXDestroyGLXPbufferSGIX",
+    "glVertexAttrib3fvNV",
+    "glProgramEnvParameters4fvEXT",
+    "glCopyTextureImage1DEXT",
+    "glUniform1dv",
+    "glXHyperpipeConfigSGIX",
+    NULL,
+    "glVertexAttrib4hvNV",
+    "glRasterPos4fv",
+    "glBindSamplers",
+    "glWaitVkSemaphoreNV",
+    "glMultTransposeMatrixdARB",
+    "glProgramUniform2dEXT",
+    "glUniform3dv",
+    "glVertexAttrib4dvNV",
+    "glTexCoord2fColor4ubVertex3fvSUN",
+    "glGetFramebufferAttachmentParameteriv",
+    "glEvalPoint1",
+    "glPathColorGenNV",
+    "glVertex2xOES",
+    "glQueryResourceNV",
+    "glPNTrianglesfATI",
+    "glTexCoord1bvOES",
+    "glVertexBlendARB",
+    "glNamedBufferPageCommitmentMemNV",
+    "glTexCoord1fv",
+    "glMultiTexParameteriEXT",
+    "glVertexAttribI4bvEXT",
+    "glMultiTexSubImage3DEXT",
+    "glCompressedTextureSubImage1DEXT",
+    "glVertexArrayVertexAttribDivisorEXT",
+    "glNormal3hNV",
+    "glDrawElementsInstancedARB",
+    "glGetnSeparableFilterARB",
+    "glMulticastGetQueryObjectui64vNV",
+    "glIsNamedBufferResidentNV",
+    "glXCreateNewContext",
+    "glIsEnabledi",
+    "glVertexAttribP1ui",
+    "glCreateSamplers",
+    "glProgramUniform2uivEXT",
+    NULL,
+    "glMatrixLoadTransposedEXT",
+    "glDeleteNamedStringARB",
+    "glGenVertexArrays",
+    "glTexGenf",
+    "glMapGrid1d",
+    "glNamedBufferStorageMemEXT",
+    "glProgramUniformMatrix2dvEXT",
+    "glProgramUniform3i64vNV",
+    "glTexStorageMem3DEXT",
+    "glProgramBufferParametersfvNV",
+    NULL,
+    NULL,
+    NULL,
+    "glCullParameterfvEXT",
+    "glDrawPixels",
+    NULL,
+    "glMultiTexCoord1sARB",
+    NULL,
+    "glConvolutionParameteriv",
+    "glIndexd",
+    "glVertexArrayAttribFormat",
+    "glVertexAttrib4svARB",
+    "glTexSubImage3D",
+    "glVertexAttribIFormat",
+    "glVertexAttrib2dNV",
+    NULL,
+    NULL,
+    "glDetailTexFuncSGIS",
+    "glRenderbufferStorageMultisampleCoverageNV",
+    NULL,
+    NULL,
+    "glNamedRenderbufferStorageMultisampleAdvancedAMD",
+    NULL,
+    "glGetActiveVaryingNV",
+    "glEGLImageTargetTextureStorageEXT",
+    "glVertexAttrib2hNV",
+    NULL,
+    "glNamedFramebufferTexture1DEXT",
+    NULL,
+    "glMakeTextureHandleNonResidentARB",
+    "glBindProgramARB",
+    "glAlphaFragmentOp1ATI",
+    "glUniformMatrix2x3fv",
+    NULL,
+    "glGetQueryObjecti64vEXT",
+    NULL,
+    "glVariantbvEXT",
+    "glPixelTransformParameteriEXT",
+    "glMatrixIndexubvARB",
+    "glProgramUniform1ui64NV",
+    "glVertexAttribI4usv",
+    "glMultiTexCoord2iARB",
+    "glProgramUniform3ui",
+    "glPolygonOffsetClampEXT",
+    "glProgramUniform1iv",
+    "glVertex4s",
+    "glTexBuffer",
+    NULL,
+    "glInvalidateSubFramebuffer",
+    NULL,
+    "glGetPathTexGenfvNV",
+    "glBinormal3dvEXT",
+    "glXGetFBConfigAttribSGIX",
+    "glMapNamedBufferRangeEXT",
+    "glXMakeAssociatedContextCurrentAMD",
+    NULL,
+    NULL,
+    "glVertexAttrib2fvNV",
+    NULL,
+    "glGetVideoCaptureStreamdvNV",
+    NULL,
+    "glGetHistogramEXT",
+    "glGetVariantPointervEXT",
+    "glVertexAttribI1i",
+    NULL,
+    NULL,
+    "glVertexAttrib2dvNV",
+    "glTexCoord2fv",
+    "glProgramUniformMatrix3fv",
+    "glColor4dv",
+    "glClientAttribDefaultEXT",
+    "glSelectBuffer",
+    NULL,
+    "glLGPUCopyImageSubDataNVX",
+    NULL,
+    "glGenQueries",
+    NULL,
+    "glReadnPixelsARB",
+    "glAlphaToCoverageDitherControlNV",
+    "glGetVertexAttribLdv",
+    "glActiveTexture",
+    "glGetHistogramParameterfvEXT",
+    "glUniform1uiv",
+    "glGetTexFilterFuncSGIS",
+    "glLoadProgramNV",
+    "glBindBufferARB",
+    NULL,
+    NULL,
+    "glUniformMatrix2fvARB",
+    "glMakeTextureHandleResidentARB",
+    NULL,
+    NULL,
+    "glIsSemaphoreEXT",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedFramebufferParameteriv",
+    NULL,
+    NULL,
+    "glIsRenderbufferEXT",
+    "glDrawTransformFeedbackInstanced",
+    "glImageTransformParameterivHP",
+    "glVertexAttrib4dvARB",
+    "glVertexAttribDivisorARB",
+    "glDeleteSemaphoresEXT",
+    "glGetTextureSamplerHandleARB",
+    "glBindFramebuffer",
+    NULL,
+    "glPixelTexGenParameterfvSGIS",
+    "glTexGendv",
+    "glGetMultiTexGenivEXT",
+    "glGetTextureParameterfvEXT",
+    NULL,
+    "glVertex3iv",
+    "glVertexStream3svATI",
+    "glVertexAttrib3fvARB",
+    "glBindBufferBaseNV",
+    "glSampleMaskEXT",
+    "glXBindVideoCaptureDeviceNV",
+    "glGetColorTableParameteriv",
+    "glGetImageHandleARB",
+    "glFrustum",
+    "glSecondaryColor3ivEXT",
+    NULL,
+    "glTexEnvxOES",
+    "glTextureParameterIivEXT",
+    "glUniform4i64ARB",
+    "glIsTextureHandleResidentNV",
+    "glTextureImage3DMultisampleNV",
+    "glSpecializeShader",
+    NULL,
+    "glGetMultiTexParameterfvEXT",
+    "glXGetGPUIDsAMD",
+    NULL,
+    "glVertexAttribs3hvNV",
+    "glGenFencesNV",
+    "glProgramLocalParameterI4uivNV",
+    "glTexParameterIivEXT",
+    NULL,
+    NULL,
+    "glVertexAttrib4ubv",
+    "glNamedFramebufferTextureFaceEXT",
+    "glGetColorTableEXT",
+    "glGetPerfMonitorCounterInfoAMD",
+    "glTexCoord2fColor4fNormal3fVertex3fSUN",
+    NULL,
+    "glVertex2i",
+    "glMultiTexCoordP3uiv",
+    "glTexCoord1sv",
+    "glSamplePatternSGIS",
+    "glGetSubroutineIndex",
+    NULL,
+    "glVertexAttribs3svNV",
+    "glMinSampleShading",
+    "glGetFragDataLocation",
+    "glStopInstrumentsSGIX",
+    "glDepthRangeArrayv",
+    "glVertex4i",
+    "glBufferParameteriAPPLE",
+    "glEndTransformFeedbackEXT",
+    "glWaitSemaphoreEXT",
+    "glGetTexParameteriv",
+    NULL,
+    "glMultiTexImage3DEXT",
+    "glClipControl",
+    "glVertexAttribL4dv",
+    NULL,
+    "glBindFragDataLocationEXT",
+    NULL,
+    "glGetPathCommandsNV",
+    "glSecondaryColorFormatNV",
+    "glUniform2i64NV",
+    "glVertexAttrib1fARB",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glXEnumerateVideoDevicesNV",
+    "glTexGenfv",
+    NULL,
+    "glBeginOcclusionQueryNV",
+    "glGetNamedProgramLocalParameterdvEXT",
+    "glVertex3f",
+    "glReadnPixels",
+    NULL,
+    "glGetDebugMessageLogAMD",
+    "glUploadGpuMaskNVX",
+    NULL,
+    "glFogfv",
+    "glVertexAttrib4fARB",
+    "glDeletePerfMonitorsAMD",
+    NULL,
+    "glClearColor",
+    "glCompressedTexSubImage1DARB",
+    "glFramebufferTextureFaceARB",
+    "glPushClientAttribDefaultEXT",
+    "glMultiTexCoord3dARB",
+    NULL,
+    "glCopyTexSubImage3DEXT",
+    NULL,
+    "glUniform2i64vNV",
+    NULL,
+    "glVertex4d",
+    "glMultiTexParameterivEXT",
+    "glFramebufferTexture2DEXT",
+    "glBitmapxOES",
+    "glGetBufferSubData",
+    "glFogCoordhvNV",
+    "glUniform1ui",
+    "glUniformBufferEXT",
+    "glLightiv",
+    "glXQuerySwapGroupNV",
+    "glColor3fVertex3fvSUN",
+    "glMultiDrawElementsEXT",
+    "glEndQueryARB",
+    "glUniformui64vNV",
+    "glXGetSelectedEvent",
+    "glXAssociateDMPbufferSGIX",
+    "glSetMultisamplefvAMD",
+    "glGetVariantFloatvEXT",
+    "glTextureStorage2D",
+    "glXEndFrameTrackingMESA",
+    "glXGetClientString",
+    "glFogCoordfv",
+    NULL,
+    "glColorTableParameterfvSGI",
+    "glTextureStorageSparseAMD",
+    NULL,
+    "glGetQueryBufferObjectuiv",
+    "glGetConvolutionParameteriv",
+    "glProgramUniform3ui64vNV",
+    "glBindBufferOffsetEXT",
+    "glGetHistogramParameterivEXT",
+    NULL,
+    "glPushClientAttrib",
+    "glGetDoublei_vEXT",
+    "glPathCoverDepthFuncNV",
+    "glGetPathMetricRangeNV",
+    "glProgramUniform3i",
+    "glUniform4d",
+    NULL,
+    "glIsBuffer",
+    NULL,
+    "glColorMaski",
+    "glColor3fv",
+    NULL,
+    NULL,
+    "glXCreateGLXPixmap",
+    "glMulticastWaitSyncNV",
+    "glGetNamedBufferParameteri64v",
+    "glUniform4f",
+    "glConvolutionFilter2D",
+    "glTexCoord3xOES",
+    "glTexParameterIuivEXT",
+    NULL,
+    "glDisablei",
+    "glDrawArraysEXT",
+    NULL,
+    "glVertex2d",
+    "glVDPAUIsSurfaceNV",
+    NULL,
+    "glVertexArrayBindVertexBufferEXT",
+    NULL,
+    "glCoverStrokePathNV",
+    "glVertex3hNV",
+    "glGetSemaphoreParameterui64vEXT",
+    NULL,
+    "glClearColorIuiEXT",
+    "glVertexAttrib1hNV",
+    "glShadingRateCombinerOpsEXT",
+    NULL,
+    NULL,
+    "glXGetCurrentDisplay",
+    NULL,
+    "glClearBufferfv",
+    NULL,
+    "glMatrixOrthoEXT",
+    "glClipPlane",
+    "glCreateProgram",
+    "glMultiTexBufferEXT",
+    "glVertexAttribI4uiEXT",
+    "glFragmentMaterialfSGIX",
+    "glTexCoord1hvNV",
+    "glDisableIndexedEXT",
+    "glNamedFramebufferTexture3DEXT",
+    NULL,
+    "glXGetContextGPUIDAMD",
+    "glXGetFBConfigAttrib",
+    "glTexEnvxvOES",
+    "glIsStateNV",
+    NULL,
+    NULL,
+    "glGetActiveUniformsiv",
+    "glBindParameterEXT",
+    NULL,
+    "glCompressedTextureImage2DEXT",
+    "glSubpixelPrecisionBiasNV",
+    "glGetnMapfvARB",
+    "glXFreeContextEXT",
+    "glFrustumfOES",
+    NULL,
+    "glDrawElementsBaseVertex",
+    "glGetnMapdv",
+    "glGetVertexAttribLui64vNV",
+    "glActiveShaderProgram",
+    "glPointParameterfvARB",
+    "glWindowPos2svARB",
+    "glGetVertexAttribIiv",
+    "glGetnPolygonStippleARB",
+    "glSignalSemaphoreEXT",
+    "glVertexAttribArrayObjectATI",
+    "glGetUniformiv",
+    "glGetProgramParameterfvNV",
+    "glTexImage3D",
+    "glShadingRateImagePaletteNV",
+    "glProgramUniform4dvEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glEndConditionalRender",
+    "glMapVertexAttrib2fAPPLE",
+    NULL,
+    "glClearNamedBufferDataEXT",
+    NULL,
+    NULL,
+    "glTexCoord2fNormal3fVertex3fSUN",
+    NULL,
+    "glVertexArrayAttribBinding",
+    NULL,
+    "glVertexAttrib3f",
+    "glTransformFeedbackAttribsNV",
+    "glLightEnviSGIX",
+    "glVertexStream1dvATI",
+    "glMultiTexCoord1xOES",
+    "glVertex3xvOES",
+    "glColor4s",
+    NULL,
+    NULL,
+    "glGetFragDataLocationEXT",
+    "glXGetCurrentDisplayEXT",
+    NULL,
+    "glVertexAttribL2i64vNV",
+    "glFramebufferRenderbufferEXT",
+    "glMultiTexCoord2hNV",
+    "glVertexAttribI2ui",
+    "glGetProgramResourceName",
+    "glShadingRateSampleOrderNV",
+    "glGetSamplerParameterIuiv",
+    NULL,
+    "glGetMultiTexParameterIuivEXT",
+    "glVertexAttribI3uiEXT",
+    "glIsEnabled",
+    "glGetPixelMapxv",
+    "glVertexBindingDivisor",
+    "glTangent3sEXT",
+    "glInvalidateTexSubImage",
+    "glBindBufferRange",
+    "glTextureStorage3DMultisample",
+    "glClientActiveVertexStreamATI",
+    "glUniform3fv",
+    "glDepthRange",
+    NULL,
+    "glPopClientAttrib",
+    "glTextureImage1DEXT",
+    NULL,
+    "glGetMinmax",
+    "glCombinerOutputNV",
+    "glColorSubTable",
+    "glHistogramEXT",
+    "glDebugMessageInsert",
+    "glMultiTexCoord1fARB",
+    "glWindowPos4fMESA",
+    "glIsEnabledIndexedEXT",
+    "glSyncTextureINTEL",
+    NULL,
+    NULL,
+    NULL,
+    "glPointParameterfvSGIS",
+    "glGetNamedProgramLocalParameterIuivEXT",
+    "glUniformMatrix2x3dv",
+    "glColor3f",
+    "glVertexAttrib3d",
+    "glBeginVertexShaderEXT",
+    "glXGetProcAddressARB",
+    "glGetnMinmaxARB",
+    "glVertexStream1iATI",
+    NULL,
+    "glProgramUniform2fv",
+    "glGetTexGeniv",
+    "glColorTableParameterivSGI",
+    "glUniform1f",
+    "glBufferStorageMemEXT",
+    NULL,
+    "glTrackMatrixNV",
+    "glGetActiveAttribARB",
+    NULL,
+    "glColor3us",
+    "glVertexAttribIPointerEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glTexPageCommitmentARB",
+    "glGlobalAlphaFactorusSUN",
+    "glMulticastBufferSubDataNV",
+    "glVariantPointerEXT",
+    "glLGPUNamedBufferSubDataNVX",
+    "glMulticastBlitFramebufferNV",
+    NULL,
+    "glRasterPos3f",
+    "glMultiTexCoord2fv",
+    NULL,
+    "glRasterPos4sv",
+    "glProgramUniform1i",
+    "glTexCoord1iv",
+    "glVertexAttribs1fvNV",
+    NULL,
+    "glWindowPos3fMESA",
+    "glTexSubImage2D",
+    "glUniform3d",
+    "glVertexAttribI2uiEXT",
+    "glVertexArrayAttribLFormat",
+    NULL,
+    "glCallCommandListNV",
+    "glCompressedMultiTexSubImage1DEXT",
+    "glUniform1iARB",
+    "glGetLightiv",
+    "glPathCommandsNV",
+    "glColor3ubv",
+    "glGetHistogramParameteriv",
+    "glTextureStorageMem3DEXT",
+    "glFramebufferTextureLayerEXT",
+    "glColorP4ui",
+    NULL,
+    "glVertexAttribDivisor",
+    "glWindowPos2d",
+    "glBufferStorage",
+    "glGetNamedProgramLocalParameterIivEXT",
+    "glVertexP2uiv",
+    "glProgramUniform3i64vARB",
+    NULL,
+    NULL,
+    "glReleaseShaderCompiler",
+    "glProgramUniform1i64ARB",
+    "glQueryObjectParameteruiAMD",
+    "glReleaseKeyedMutexWin32EXT",
+    "glTexPageCommitmentMemNV",
+    "glCompressedTextureSubImage3D",
+    NULL,
+    "glUniform3iv",
+    "glNamedBufferAttachMemoryNV",
+    "glUniform1ivARB",
+    "glDrawTextureNV",
+    NULL,
+    "glXQueryContext",
+    "glResetMemoryObjectParameterNV",
+    "glVDPAUInitNV",
+    NULL,
+    "glUniform1uivEXT",
+    "glCopyTexImage1D",
+    "glTextureStorage2DMultisample",
+    "glGetVkProcAddrNV",
+    "glObjectPtrLabel",
+    NULL,
+    "glMapGrid1xOES",
+    "glGetMultisamplefvNV",
+    "glTangent3iEXT",
+    "glTextureImage3DMultisampleCoverageNV",
+    "glXQueryCurrentRendererIntegerMESA",
+    NULL,
+    "glMultiModeDrawElementsIBM",
+    "glProgramUniform1dEXT",
+    "glEvalCoord1dv",
+    "glBindTextureEXT",
+    "glGetIntegerui64i_vNV",
+    "glVertexAttribL3ui64NV",
+    NULL,
+    "glVertexAttribs2hvNV",
+    "glXGetTransparentIndexSUN",
+    NULL,
+    "glGetInvariantIntegervEXT",
+    "glClearTexImage",
+    "glVertexArrayNormalOffsetEXT",
+    NULL,
+    "glInsertComponentEXT",
+    NULL,
+    NULL,
+    "glBinormal3ivEXT",
+    "glGetNamedBufferSubData",
+    "glVertexAttribI3iEXT",
+    NULL,
+    NULL,
+    "glQueryResourceTagNV",
+    NULL,
+    "glXQueryFrameCountNV",
+    NULL,
+    "glPixelStorex",
+    "glTangent3dEXT",
+    "glProgramEnvParameter4dvARB",
+    "glXChooseFBConfigSGIX",
+    NULL,
+    "glFramebufferTextureLayer",
+    "glGenTransformFeedbacks",
+    "glNewObjectBufferATI",
+    "glTexCoordP3ui",
+    "glVertexStream4fvATI",
+    NULL,
+    "glBindTexGenParameterEXT",
+    "glProgramUniformMatrix4x2dvEXT",
+    "glTexturePageCommitmentEXT",
+    "glTexCoord4fVertex4fvSUN",
+    "glUniformMatrix4dv",
+    "glInsertEventMarkerEXT",
+    "glProgramUniform2i64vNV",
+    "glVertexAttrib4NusvARB",
+    "glVertexAttribP3uiv",
+    "glClearNamedBufferSubDataEXT",
+    NULL,
+    "glLoadIdentity",
+    "glTexCoord2fVertex3fvSUN",
+    NULL,
+    "glProgramStringARB",
+    NULL,
+    "glTexCoord2hNV",
+    NULL,
+    NULL,
+    "glVertexAttrib3sARB",
+    "glClipPlanexOES",
+    NULL,
+    NULL,
+    "glVDPAUFiniNV",
+    "glUnmapTexture2DINTEL",
+};
+
@@ -0,0 +1,198 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Dense index of every EGL entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_EGL {
+    GLATTER_FN_eglSwapBuffers,
+    GLATTER_FN_eglMakeCurrent,
+    GLATTER_FN_eglGetCurrentContext,
+    GLATTER_FN_eglGetCurrentDisplay,
+    GLATTER_FN_eglGetCurrentSurface,
+    GLATTER_FN_eglGetError,
+    GLATTER_FN_eglSwapInterval,
+    GLATTER_FN_eglBindAPI,
+    GLATTER_FN_eglBindTexImage,
+    GLATTER_FN_eglBindWaylandDisplayWL,
+    GLATTER_FN_eglChooseConfig,
+    GLATTER_FN_eglClientSignalSyncEXT,
+    GLATTER_FN_eglClientWaitSync,
+    GLATTER_FN_eglClientWaitSyncKHR,
+    GLATTER_FN_eglClientWaitSyncNV,
+    GLATTER_FN_eglCompositorBindTexWindowEXT,
+    GLATTER_FN_eglCompositorSetContextAttributesEXT,
+    GLATTER_FN_eglCompositorSetContextListEXT,
+    GLATTER_FN_eglCompositorSetSizeEXT,
+    GLATTER_FN_eglCompositorSetWindowAttributesEXT,
+    GLATTER_FN_eglCompositorSetWindowListEXT,
+    GLATTER_FN_eglCompositorSwapPolicyEXT,
+    GLATTER_FN_eglCopyBuffers,
+    GLATTER_FN_eglCreateContext,
+    GLATTER_FN_eglCreateDRMImageMESA,
+    GLATTER_FN_eglCreateFenceSyncNV,
+    GLATTER_FN_eglCreateImage,
+    GLATTER_FN_eglCreateImageKHR,
+    GLATTER_FN_eglCreateNativeClientBufferANDROID,
+    GLATTER_FN_eglCreatePbufferFromClientBuffer,
+    GLATTER_FN_eglCreatePbufferSurface,
+    GLATTER_FN_eglCreatePixmapSurface,
+    GLATTER_FN_eglCreatePixmapSurfaceHI,
+    GLATTER_FN_eglCreatePlatformPixmapSurface,
+    GLATTER_FN_eglCreatePlatformPixmapSurfaceEXT,
+    GLATTER_FN_eglCreatePlatformWindowSurface,
+    GLATTER_FN_eglCreatePlatformWindowSurfaceEXT,
+    GLATTER_FN_eglCreateStreamAttribKHR,
+    GLATTER_FN_eglCreateStreamFromFileDescriptorKHR,
+    GLATTER_FN_eglCreateStreamKHR,
+    GLATTER_FN_eglCreateStreamProducerSurfaceKHR,
+    GLATTER_FN_eglCreateStreamSyncNV,
+    GLATTER_FN_eglCreateSync,
+    GLATTER_FN_eglCreateSync64KHR,
+    GLATTER_FN_eglCreateSyncKHR,
+    GLATTER_FN_eglCreateWaylandBufferFromImageWL,
+    GLATTER_FN_eglCreateWindowSurface,
+    GLATTER_FN_eglDebugMessageControlKHR,
+    GLATTER_FN_eglDestroyContext,
+    GLATTER_FN_eglDestroyDisplayEXT,
+    GLATTER_FN_eglDestroyImage,
+    GLATTER_FN_eglDestroyImageKHR,
+    GLATTER_FN_eglDestroyStreamKHR,
+    GLATTER_FN_eglDestroySurface,
+    GLATTER_FN_eglDestroySync,
+    GLATTER_FN_eglDestroySyncKHR,
+    GLATTER_FN_eglDestroySyncNV,
+    GLATTER_FN_eglDupNativeFenceFDANDROID,
+    GLATTER_FN_eglExportDMABUFImageMESA,
+    GLATTER_FN_eglExportDMABUFImageQueryMESA,
+    GLATTER_FN_eglExportDRMImageMESA,
+    GLATTER_FN_eglFenceNV,
+    GLATTER_FN_eglGetCompositorTimingANDROID,
+    GLATTER_FN_eglGetCompositorTimingSupportedANDROID,
+    GLATTER_FN_eglGetConfigAttrib,
+    GLATTER_FN_eglGetConfigs,
+    GLATTER_FN_eglGetDisplay,
+    GLATTER_FN_eglGetDisplayDriverConfig,
+    GLATTER_FN_eglGetDisplayDriverName,
+    GLATTER_FN_eglGetFrameTimestampSupportedANDROID,
+    GLATTER_FN_eglGetFrameTimestampsANDROID,
+    GLATTER_FN_eglGetMscRateANGLE,
+    GLATTER_FN_eglGetNativeClientBufferANDROID,
+    GLATTER_FN_eglGetNextFrameIdANDROID,
+    GLATTER_FN_eglGetOutputLayersEXT,
+    GLATTER_FN_eglGetOutputPortsEXT,
+    GLATTER_FN_eglGetPlatformDisplay,
+    GLATTER_FN_eglGetPlatformDisplayEXT,
+    GLATTER_FN_eglGetStreamFileDescriptorKHR,
+    GLATTER_FN_eglGetSyncAttrib,
+    GLATTER_FN_eglGetSyncAttribKHR,
+    GLATTER_FN_eglGetSyncAttribNV,
+    GLATTER_FN_eglGetSystemTimeFrequencyNV,
+    GLATTER_FN_eglGetSystemTimeNV,
+    GLATTER_FN_eglInitialize,
+    GLATTER_FN_eglLabelObjectKHR,
+    GLATTER_FN_eglLockSurfaceKHR,
+    GLATTER_FN_eglOutputLayerAttribEXT,
+    GLATTER_FN_eglOutputPortAttribEXT,
+    GLATTER_FN_eglPostSubBufferNV,
+    GLATTER_FN_eglPresentationTimeANDROID,
+    GLATTER_FN_eglQueryAPI,
+    GLATTER_FN_eglQueryContext,
+    GLATTER_FN_eglQueryDebugKHR,
+    GLATTER_FN_eglQueryDeviceAttribEXT,
+    GLATTER_FN_eglQueryDeviceBinaryEXT,
+    GLATTER_FN_eglQueryDeviceStringEXT,
+    GLATTER_FN_eglQueryDevicesEXT,
+    GLATTER_FN_eglQueryDisplayAttribEXT,
+    GLATTER_FN_eglQueryDisplayAttribKHR,
+    GLATTER_FN_eglQueryDisplayAttribNV,
+    GLATTER_FN_eglQueryDmaBufFormatsEXT,
+    GLATTER_FN_eglQueryDmaBufModifiersEXT,
+    GLATTER_FN_eglQueryNativeDisplayNV,
+    GLATTER_FN_eglQueryNativePixmapNV,
+    GLATTER_FN_eglQueryNativeWindowNV,
+    GLATTER_FN_eglQueryOutputLayerAttribEXT,
+    GLATTER_FN_eglQueryOutputLayerStringEXT,
+    GLATTER_FN_eglQueryOutputPortAttribEXT,
+    GLATTER_FN_eglQueryOutputPortStringEXT,
+    GLATTER_FN_eglQueryStreamAttribKHR,
+    GLATTER_FN_eglQueryStreamConsumerEventNV,
+    GLATTER_FN_eglQueryStreamKHR,
+    GLATTER_FN_eglQueryStreamMetadataNV,
+    GLATTER_FN_eglQueryStreamTimeKHR,
+    GLATTER_FN_eglQueryStreamu64KHR,
+    GLATTER_FN_eglQueryString,
+    GLATTER_FN_eglQuerySupportedCompressionRatesEXT,
+    GLATTER_FN_eglQuerySurface,
+    GLATTER_FN_eglQuerySurface64KHR,
+    GLATTER_FN_eglQuerySurfacePointerANGLE,
+    GLATTER_FN_eglQueryWaylandBufferWL,
+    GLATTER_FN_eglReleaseTexImage,
+    GLATTER_FN_eglReleaseThread,
+    GLATTER_FN_eglResetStreamNV,
+    GLATTER_FN_eglSetBlobCacheFuncsANDROID,
+    GLATTER_FN_eglSetDamageRegionKHR,
+    GLATTER_FN_eglSetStreamAttribKHR,
+    GLATTER_FN_eglSetStreamMetadataNV,
+    GLATTER_FN_eglSignalSyncKHR,
+    GLATTER_FN_eglSignalSyncNV,
+    GLATTER_FN_eglStreamAcquireImageNV,
+    GLATTER_FN_eglStreamAttribKHR,
+    GLATTER_FN_eglStreamConsumerAcquireAttribKHR,
+    GLATTER_FN_eglStreamConsumerAcquireKHR,
+    GLATTER_FN_eglStreamConsumerGLTextureExternalAttribsNV,
+    GLATTER_FN_eglStreamConsumerGLTextureExternalKHR,
+    GLATTER_FN_eglStreamConsumerOutputEXT,
+    GLATTER_FN_eglStreamConsumerReleaseAttribKHR,
+    GLATTER_FN_eglStreamConsumerReleaseKHR,
+    GLATTER_FN_eglStreamFlushNV,
+    GLATTER_FN_eglStreamImageConsumerConnectNV,
+    GLATTER_FN_eglStreamReleaseImageNV,
+    GLATTER_FN_eglSurfaceAttrib,
+    GLATTER_FN_eglSwapBuffersRegion2NOK,
+    GLATTER_FN_eglSwapBuffersRegionNOK,
+    GLATTER_FN_eglSwapBuffersWithDamageEXT,
+    GLATTER_FN_eglSwapBuffersWithDamageKHR,
+    GLATTER_FN_eglTerminate,
+    GLATTER_FN_eglUnbindWaylandDisplayWL,
+    GLATTER_FN_eglUnlockSurfaceKHR,
+    GLATTER_FN_eglUnsignalSyncEXT,
+    GLATTER_FN_eglWaitClient,
+    GLATTER_FN_eglWaitGL,
+    GLATTER_FN_eglWaitNative,
+    GLATTER_FN_eglWaitSync,
+    GLATTER_FN_eglWaitSyncKHR,
+    GLATTER_FN_COUNT_EGL
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_EGL 0xa982dbdfu
+
@@ -27,347 +27,346 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#ifndef GLATTER_LOOKUP_SIZE
-#define GLATTER_LOOKUP_SIZE 0x4000
+/* Reads one bit of an extension support bitset. */
+#ifndef GLATTER_EXTENSION_SUPPORTED
+#define GLATTER_EXTENSION_SUPPORTED(status, index) \
+    ((int)(((status)->bits[(index) >> 5] >> ((index) & 31)) & 1u))
 #endif
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4201)
-#endif
+/* Bit positions in glatter_extension_support_status_EGL_t::bits. */
+enum {
+    GLATTER_EXT_EGL_ANDROID_GLES_layers = 0,
+    GLATTER_EXT_EGL_ANDROID_blob_cache = 1,
+    GLATTER_EXT_EGL_ANDROID_create_native_client_buffer = 2,
+    GLATTER_EXT_EGL_ANDROID_framebuffer_target = 3,
+    GLATTER_EXT_EGL_ANDROID_front_buffer_auto_refresh = 4,
+    GLATTER_EXT_EGL_ANDROID_get_frame_timestamps = 5,
+    GLATTER_EXT_EGL_ANDROID_get_native_client_buffer = 6,
+    GLATTER_EXT_EGL_ANDROID_image_native_buffer = 7,
+    GLATTER_EXT_EGL_ANDROID_native_fence_sync = 8,
+    GLATTER_EXT_EGL_ANDROID_presentation_time = 9,
+    GLATTER_EXT_EGL_ANDROID_recordable = 10,
+    GLATTER_EXT_EGL_ANDROID_telemetry_hint = 11,
+    GLATTER_EXT_EGL_ANGLE_d3d_share_handle_client_buffer = 12,
+    GLATTER_EXT_EGL_ANGLE_device_d3d = 13,
+    GLATTER_EXT_EGL_ANGLE_query_surface_pointer = 14,
+    GLATTER_EXT_EGL_ANGLE_surface_d3d_texture_2d_share_handle = 15,
+    GLATTER_EXT_EGL_ANGLE_sync_control_rate = 16,
+    GLATTER_EXT_EGL_ANGLE_window_fixed_size = 17,
+    GLATTER_EXT_EGL_ARM_image_format = 18,
+    GLATTER_EXT_EGL_ARM_implicit_external_sync = 19,
+    GLATTER_EXT_EGL_ARM_pixmap_multisample_discard = 20,
+    GLATTER_EXT_EGL_EXT_bind_to_front = 21,
+    GLATTER_EXT_EGL_EXT_buffer_age = 22,
+    GLATTER_EXT_EGL_EXT_client_extensions = 23,
+    GLATTER_EXT_EGL_EXT_client_sync = 24,
+    GLATTER_EXT_EGL_EXT_compositor = 25,
+    GLATTER_EXT_EGL_EXT_config_select_group = 26,
+    GLATTER_EXT_EGL_EXT_create_context_robustness = 27,
+    GLATTER_EXT_EGL_EXT_device_base = 28,
+    GLATTER_EXT_EGL_EXT_device_drm = 29,
+    GLATTER_EXT_EGL_EXT_device_drm_render_node = 30,
+    GLATTER_EXT_EGL_EXT_device_enumeration = 31,
+    GLATTER_EXT_EGL_EXT_device_openwf = 32,
+    GLATTER_EXT_EGL_EXT_device_persistent_id = 33,
+    GLATTER_EXT_EGL_EXT_device_query = 34,
+    GLATTER_EXT_EGL_EXT_device_query_name = 35,
+    GLATTER_EXT_EGL_EXT_display_alloc = 36,
+    GLATTER_EXT_EGL_EXT_explicit_device = 37,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_bt2020_hlg = 38,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_bt2020_linear = 39,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_bt2020_pq = 40,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_display_p3 = 41,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_display_p3_linear = 42,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_display_p3_passthrough = 43,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_scrgb = 44,
+    GLATTER_EXT_EGL_EXT_gl_colorspace_scrgb_linear = 45,
+    GLATTER_EXT_EGL_EXT_image_dma_buf_import = 46,
+    GLATTER_EXT_EGL_EXT_image_dma_buf_import_modifiers = 47,
+    GLATTER_EXT_EGL_EXT_image_gl_colorspace = 48,
+    GLATTER_EXT_EGL_EXT_image_implicit_sync_control = 49,
+    GLATTER_EXT_EGL_EXT_multiview_window = 50,
+    GLATTER_EXT_EGL_EXT_output_base = 51,
+    GLATTER_EXT_EGL_EXT_output_drm = 52,
+    GLATTER_EXT_EGL_EXT_output_openwf = 53,
+    GLATTER_EXT_EGL_EXT_pixel_format_float = 54,
+    GLATTER_EXT_EGL_EXT_platform_base = 55,
+    GLATTER_EXT_EGL_EXT_platform_device = 56,
+    GLATTER_EXT_EGL_EXT_platform_wayland = 57,
+    GLATTER_EXT_EGL_EXT_platform_x11 = 58,
+    GLATTER_EXT_EGL_EXT_platform_xcb = 59,
+    GLATTER_EXT_EGL_EXT_present_opaque = 60,
+    GLATTER_EXT_EGL_EXT_protected_content = 61,
+    GLATTER_EXT_EGL_EXT_protected_surface = 62,
+    GLATTER_EXT_EGL_EXT_query_reset_notification_strategy = 63,
+    GLATTER_EXT_EGL_EXT_stream_consumer_egloutput = 64,
+    GLATTER_EXT_EGL_EXT_surface_CTA861_3_metadata = 65,
+    GLATTER_EXT_EGL_EXT_surface_SMPTE2086_metadata = 66,
+    GLATTER_EXT_EGL_EXT_surface_compression = 67,
+    GLATTER_EXT_EGL_EXT_swap_buffers_with_damage = 68,
+    GLATTER_EXT_EGL_EXT_sync_reuse = 69,
+    GLATTER_EXT_EGL_EXT_yuv_surface = 70,
+    GLATTER_EXT_EGL_HI_clientpixmap = 71,
+    GLATTER_EXT_EGL_HI_colorformats = 72,
+    GLATTER_EXT_EGL_IMG_context_priority = 73,
+    GLATTER_EXT_EGL_IMG_image_plane_attribs = 74,
+    GLATTER_EXT_EGL_KHR_cl_event = 75,
+    GLATTER_EXT_EGL_KHR_cl_event2 = 76,
+    GLATTER_EXT_EGL_KHR_client_get_all_proc_addresses = 77,
+    GLATTER_EXT_EGL_KHR_config_attribs = 78,
+    GLATTER_EXT_EGL_KHR_context_flush_control = 79,
+    GLATTER_EXT_EGL_KHR_create_context = 80,
+    GLATTER_EXT_EGL_KHR_create_context_no_error = 81,
+    GLATTER_EXT_EGL_KHR_debug = 82,
+    GLATTER_EXT_EGL_KHR_display_reference = 83,
+    GLATTER_EXT_EGL_KHR_fence_sync = 84,
+    GLATTER_EXT_EGL_KHR_get_all_proc_addresses = 85,
+    GLATTER_EXT_EGL_KHR_gl_colorspace = 86,
+    GLATTER_EXT_EGL_KHR_gl_renderbuffer_image = 87,
+    GLATTER_EXT_EGL_KHR_gl_texture_2D_image = 88,
+    GLATTER_EXT_EGL_KHR_gl_texture_3D_image = 89,
+    GLATTER_EXT_EGL_KHR_gl_texture_cubemap_image = 90,
+    GLATTER_EXT_EGL_KHR_image = 91,
+    GLATTER_EXT_EGL_KHR_image_base = 92,
+    GLATTER_EXT_EGL_KHR_image_pixmap = 93,
+    GLATTER_EXT_EGL_KHR_lock_surface = 94,
+    GLATTER_EXT_EGL_KHR_lock_surface2 = 95,
+    GLATTER_EXT_EGL_KHR_lock_surface3 = 96,
+    GLATTER_EXT_EGL_KHR_mutable_render_buffer = 97,
+    GLATTER_EXT_EGL_KHR_no_config_context = 98,
+    GLATTER_EXT_EGL_KHR_partial_update = 99,
+    GLATTER_EXT_EGL_KHR_platform_android = 100,
+    GLATTER_EXT_EGL_KHR_platform_gbm = 101,
+    GLATTER_EXT_EGL_KHR_platform_wayland = 102,
+    GLATTER_EXT_EGL_KHR_platform_x11 = 103,
+    GLATTER_EXT_EGL_KHR_reusable_sync = 104,
+    GLATTER_EXT_EGL_KHR_stream = 105,
+    GLATTER_EXT_EGL_KHR_stream_attrib = 106,
+    GLATTER_EXT_EGL_KHR_stream_consumer_gltexture = 107,
+    GLATTER_EXT_EGL_KHR_stream_cross_process_fd = 108,
+    GLATTER_EXT_EGL_KHR_stream_fifo = 109,
+    GLATTER_EXT_EGL_KHR_stream_producer_aldatalocator = 110,
+    GLATTER_EXT_EGL_KHR_stream_producer_eglsurface = 111,
+    GLATTER_EXT_EGL_KHR_surfaceless_context = 112,
+    GLATTER_EXT_EGL_KHR_swap_buffers_with_damage = 113,
+    GLATTER_EXT_EGL_KHR_vg_parent_image = 114,
+    GLATTER_EXT_EGL_KHR_wait_sync = 115,
+    GLATTER_EXT_EGL_MESA_drm_image = 116,
+    GLATTER_EXT_EGL_MESA_image_dma_buf_export = 117,
+    GLATTER_EXT_EGL_MESA_platform_gbm = 118,
+    GLATTER_EXT_EGL_MESA_platform_surfaceless = 119,
+    GLATTER_EXT_EGL_MESA_query_driver = 120,
+    GLATTER_EXT_EGL_NOK_swap_region = 121,
+    GLATTER_EXT_EGL_NOK_swap_region2 = 122,
+    GLATTER_EXT_EGL_NOK_texture_from_pixmap = 123,
+    GLATTER_EXT_EGL_NV_3dvision_surface = 124,
+    GLATTER_EXT_EGL_NV_context_priority_realtime = 125,
+    GLATTER_EXT_EGL_NV_coverage_sample = 126,
+    GLATTER_EXT_EGL_NV_coverage_sample_resolve = 127,
+    GLATTER_EXT_EGL_NV_cuda_event = 128,
+    GLATTER_EXT_EGL_NV_depth_nonlinear = 129,
+    GLATTER_EXT_EGL_NV_device_cuda = 130,
+    GLATTER_EXT_EGL_NV_native_query = 131,
+    GLATTER_EXT_EGL_NV_post_convert_rounding = 132,
+    GLATTER_EXT_EGL_NV_post_sub_buffer = 133,
+    GLATTER_EXT_EGL_NV_quadruple_buffer = 134,
+    GLATTER_EXT_EGL_NV_robustness_video_memory_purge = 135,
+    GLATTER_EXT_EGL_NV_stream_consumer_eglimage = 136,
+    GLATTER_EXT_EGL_NV_stream_consumer_eglimage_use_scanout_attrib = 137,
+    GLATTER_EXT_EGL_NV_stream_consumer_gltexture_yuv = 138,
+    GLATTER_EXT_EGL_NV_stream_cross_display = 139,
+    GLATTER_EXT_EGL_NV_stream_cross_object = 140,
+    GLATTER_EXT_EGL_NV_stream_cross_partition = 141,
+    GLATTER_EXT_EGL_NV_stream_cross_process = 142,
+    GLATTER_EXT_EGL_NV_stream_cross_system = 143,
+    GLATTER_EXT_EGL_NV_stream_dma = 144,
+    GLATTER_EXT_EGL_NV_stream_fifo_next = 145,
+    GLATTER_EXT_EGL_NV_stream_fifo_synchronous = 146,
+    GLATTER_EXT_EGL_NV_stream_flush = 147,
+    GLATTER_EXT_EGL_NV_stream_frame_limits = 148,
+    GLATTER_EXT_EGL_NV_stream_metadata = 149,
+    GLATTER_EXT_EGL_NV_stream_origin = 150,
+    GLATTER_EXT_EGL_NV_stream_remote = 151,
+    GLATTER_EXT_EGL_NV_stream_reset = 152,
+    GLATTER_EXT_EGL_NV_stream_socket = 153,
+    GLATTER_EXT_EGL_NV_stream_socket_inet = 154,
+    GLATTER_EXT_EGL_NV_stream_socket_unix = 155,
+    GLATTER_EXT_EGL_NV_stream_sync = 156,
+    GLATTER_EXT_EGL_NV_sync = 157,
+    GLATTER_EXT_EGL_NV_system_time = 158,
+    GLATTER_EXT_EGL_NV_triple_buffer = 159,
+    GLATTER_EXT_EGL_TIZEN_image_native_buffer = 160,
+    GLATTER_EXT_EGL_TIZEN_image_native_surface = 161,
+    GLATTER_EXT_COUNT_EGL = 162
+};
 
+/* One bit per extension, indexed by GLATTER_EXT_* above. */
 typedef struct glatter_extension_support_status_EGL
 {
-        int has_EGL_ANDROID_GLES_layers;
-        int has_EGL_ANDROID_blob_cache;
-        int has_EGL_ANDROID_create_native_client_buffer;
-        int has_EGL_ANDROID_framebuffer_target;
-        int has_EGL_ANDROID_front_buffer_auto_refresh;
-        int has_EGL_ANDROID_get_frame_timestamps;
-        int has_EGL_ANDROID_get_native_client_buffer;
-        int has_EGL_ANDROID_image_native_buffer;
-        int has_EGL_ANDROID_native_fence_sync;
-        int has_EGL_ANDROID_presentation_time;
-        int has_EGL_ANDROID_recordable;
-        int has_EGL_ANDROID_telemetry_hint;
-        int has_EGL_ANGLE_d3d_share_handle_client_buffer;
-        int has_EGL_ANGLE_device_d3d;
-        int has_EGL_ANGLE_query_surface_pointer;
-        int has_EGL_ANGLE_surface_d3d_texture_2d_share_handle;
-        int has_EGL_ANGLE_sync_control_rate;
-        int has_EGL_ANGLE_window_fixed_size;
-        int has_EGL_ARM_image_format;
-        int has_EGL_ARM_implicit_external_sync;
-        int has_EGL_ARM_pixmap_multisample_discard;
-        int has_EGL_EXT_bind_to_front;
-        int has_EGL_EXT_buffer_age;
-        int has_EGL_EXT_client_extensions;
-        int has_EGL_EXT_client_sync;
-        int has_EGL_EXT_compositor;
-        int has_EGL_EXT_config_select_group;
-        int has_EGL_EXT_create_context_robustness;
-        int has_EGL_EXT_device_base;
-        int has_EGL_EXT_device_drm;
-        int has_EGL_EXT_device_drm_render_node;
-        int has_EGL_EXT_device_enumeration;
-        int has_EGL_EXT_device_openwf;
-        int has_EGL_EXT_device_persistent_id;
-        int has_EGL_EXT_device_query;
-        int has_EGL_EXT_device_query_name;
-        int has_EGL_EXT_display_alloc;
-        int has_EGL_EXT_explicit_device;
-        int has_EGL_EXT_gl_colorspace_bt2020_hlg;
-        int has_EGL_EXT_gl_colorspace_bt2020_linear;
-        int has_EGL_EXT_gl_colorspace_bt2020_pq;
-        int has_EGL_EXT_gl_colorspace_display_p3;
-        int has_EGL_EXT_gl_colorspace_display_p3_linear;
-        int has_EGL_EXT_gl_colorspace_display_p3_passthrough;
-        int has_EGL_EXT_gl_colorspace_scrgb;
-        int has_EGL_EXT_gl_colorspace_scrgb_linear;
-        int has_EGL_EXT_image_dma_buf_import;
-        int has_EGL_EXT_image_dma_buf_import_modifiers;
-        int has_EGL_EXT_image_gl_colorspace;
-        int has_EGL_EXT_image_implicit_sync_control;
-        int has_EGL_EXT_multiview_window;
-        int has_EGL_EXT_output_base;
-        int has_EGL_EXT_output_drm;
-        int has_EGL_EXT_output_openwf;
-        int has_EGL_EXT_pixel_format_float;
-        int has_EGL_EXT_platform_base;
-        int has_EGL_EXT_platform_device;
-        int has_EGL_EXT_platform_wayland;
-        int has_EGL_EXT_platform_x11;
-        int has_EGL_EXT_platform_xcb;
-        int has_EGL_EXT_present_opaque;
-        int has_EGL_EXT_protected_content;
-        int has_EGL_EXT_protected_surface;
-        int has_EGL_EXT_query_reset_notification_strategy;
-        int has_EGL_EXT_stream_consumer_egloutput;
-        int has_EGL_EXT_surface_CTA861_3_metadata;
-        int has_EGL_EXT_surface_SMPTE2086_metadata;
-        int has_EGL_EXT_surface_compression;
-        int has_EGL_EXT_swap_buffers_with_damage;
-        int has_EGL_EXT_sync_reuse;
-        int has_EGL_EXT_yuv_surface;
-        int has_EGL_HI_clientpixmap;
-        int has_EGL_HI_colorformats;
-        int has_EGL_IMG_context_priority;
-        int has_EGL_IMG_image_plane_attribs;
-        int has_EGL_KHR_cl_event;
-        int has_EGL_KHR_cl_event2;
-        int has_EGL_KHR_client_get_all_proc_addresses;
-        int has_EGL_KHR_config_attribs;
-        int has_EGL_KHR_context_flush_control;
-        int has_EGL_KHR_create_context;
-        int has_EGL_KHR_create_context_no_error;
-        int has_EGL_KHR_debug;
-        int has_EGL_KHR_display_reference;
-        int has_EGL_KHR_fence_sync;
-        int has_EGL_KHR_get_all_proc_addresses;
-        int has_EGL_KHR_gl_colorspace;
-        int has_EGL_KHR_gl_renderbuffer_image;
-        int has_EGL_KHR_gl_texture_2D_image;
-        int has_EGL_KHR_gl_texture_3D_image;
-        int has_EGL_KHR_gl_texture_cubemap_image;
-        int has_EGL_KHR_image;
-        int has_EGL_KHR_image_base;
-        int has_EGL_KHR_image_pixmap;
-        int has_EGL_KHR_lock_surface;
-        int has_EGL_KHR_lock_surface2;
-        int has_EGL_KHR_lock_surface3;
-        int has_EGL_KHR_mutable_render_buffer;
-        int has_EGL_KHR_no_config_context;
-        int has_EGL_KHR_partial_update;
-        int has_EGL_KHR_platform_android;
-        int has_EGL_KHR_platform_gbm;
-        int has_EGL_KHR_platform_wayland;
-        int has_EGL_KHR_platform_x11;
-        int has_EGL_KHR_reusable_sync;
-        int has_EGL_KHR_stream;
-        int has_EGL_KHR_stream_attrib;
-        int has_EGL_KHR_stream_consumer_gltexture;
-        int has_EGL_KHR_stream_cross_process_fd;
-        int has_EGL_KHR_stream_fifo;
-        int has_EGL_KHR_stream_producer_aldatalocator;
-        int has_EGL_KHR_stream_producer_eglsurface;
-        int has_EGL_KHR_surfaceless_context;
-        int has_EGL_KHR_swap_buffers_with_damage;
-        int has_EGL_KHR_vg_parent_image;
-        int has_EGL_KHR_wait_sync;
-        int has_EGL_MESA_drm_image;
-        int has_EGL_MESA_image_dma_buf_export;
-        int has_EGL_MESA_platform_gbm;
-        int has_EGL_MESA_platform_surfaceless;
-        int has_EGL_MESA_query_driver;
-        int has_EGL_NOK_swap_region;
-        int has_EGL_NOK_swap_region2;
-        int has_EGL_NOK_texture_from_pixmap;
-        int has_EGL_NV_3dvision_surface;
-        int has_EGL_NV_context_priority_realtime;
-        int has_EGL_NV_coverage_sample;
-        int has_EGL_NV_coverage_sample_resolve;
-        int has_EGL_NV_cuda_event;
-        int has_EGL_NV_depth_nonlinear;
-        int has_EGL_NV_device_cuda;
-        int has_EGL_NV_native_query;
-        int has_EGL_NV_post_convert_rounding;
-        int has_EGL_NV_post_sub_buffer;
-        int has_EGL_NV_quadruple_buffer;
-        int has_EGL_NV_robustness_video_memory_purge;
-        int has_EGL_NV_stream_consumer_eglimage;
-        int has_EGL_NV_stream_consumer_eglimage_use_scanout_attrib;
-        int has_EGL_NV_stream_consumer_gltexture_yuv;
-        int has_EGL_NV_stream_cross_display;
-        int has_EGL_NV_stream_cross_object;
-        int has_EGL_NV_stream_cross_partition;
-        int has_EGL_NV_stream_cross_process;
-        int has_EGL_NV_stream_cross_system;
-        int has_EGL_NV_stream_dma;
-        int has_EGL_NV_stream_fifo_next;
-        int has_EGL_NV_stream_fifo_synchronous;
-        int has_EGL_NV_stream_flush;
-        int has_EGL_NV_stream_frame_limits;
-        int has_EGL_NV_stream_metadata;
-        int has_EGL_NV_stream_origin;
-        int has_EGL_NV_stream_remote;
-        int has_EGL_NV_stream_reset;
-        int has_EGL_NV_stream_socket;
-        int has_EGL_NV_stream_socket_inet;
-        int has_EGL_NV_stream_socket_unix;
-        int has_EGL_NV_stream_sync;
-        int has_EGL_NV_sync;
-        int has_EGL_NV_system_time;
-        int has_EGL_NV_triple_buffer;
-        int has_EGL_TIZEN_image_native_buffer;
-        int has_EGL_TIZEN_image_native_surface;
+    uint32_t bits[6];
 } glatter_extension_support_status_EGL_t;
 
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-
-#define glatter_EGL_ANDROID_GLES_layers glatter_get_extension_support_EGL().has_EGL_ANDROID_GLES_layers
-#define glatter_EGL_ANDROID_blob_cache glatter_get_extension_support_EGL().has_EGL_ANDROID_blob_cache
-#define glatter_EGL_ANDROID_create_native_client_buffer glatter_get_extension_support_EGL().has_EGL_ANDROID_create_native_client_buffer
-#define glatter_EGL_ANDROID_framebuffer_target glatter_get_extension_support_EGL().has_EGL_ANDROID_framebuffer_target
-#define glatter_EGL_ANDROID_front_buffer_auto_refresh glatter_get_extension_support_EGL().has_EGL_ANDROID_front_buffer_auto_refresh
-#define glatter_EGL_ANDROID_get_frame_timestamps glatter_get_extension_support_EGL().has_EGL_ANDROID_get_frame_timestamps
-#define glatter_EGL_ANDROID_get_native_client_buffer glatter_get_extension_support_EGL().has_EGL_ANDROID_get_native_client_buffer
-#define glatter_EGL_ANDROID_image_native_buffer glatter_get_extension_support_EGL().has_EGL_ANDROID_image_native_buffer
-#define glatter_EGL_ANDROID_native_fence_sync glatter_get_extension_support_EGL().has_EGL_ANDROID_native_fence_sync
-#define glatter_EGL_ANDROID_presentation_time glatter_get_extension_support_EGL().has_EGL_ANDROID_presentation_time
-#define glatter_EGL_ANDROID_recordable glatter_get_extension_support_EGL().has_EGL_ANDROID_recordable
-#define glatter_EGL_ANDROID_telemetry_hint glatter_get_extension_support_EGL().has_EGL_ANDROID_telemetry_hint
-#define glatter_EGL_ANGLE_d3d_share_handle_client_buffer glatter_get_extension_support_EGL().has_EGL_ANGLE_d3d_share_handle_client_buffer
-#define glatter_EGL_ANGLE_device_d3d glatter_get_extension_support_EGL().has_EGL_ANGLE_device_d3d
-#define glatter_EGL_ANGLE_query_surface_pointer glatter_get_extension_support_EGL().has_EGL_ANGLE_query_surface_pointer
-#define glatter_EGL_ANGLE_surface_d3d_texture_2d_share_handle glatter_get_extension_support_EGL().has_EGL_ANGLE_surface_d3d_texture_2d_share_handle
-#define glatter_EGL_ANGLE_sync_control_rate glatter_get_extension_support_EGL().has_EGL_ANGLE_sync_control_rate
-#define glatter_EGL_ANGLE_window_fixed_size glatter_get_extension_support_EGL().has_EGL_ANGLE_window_fixed_size
-#define glatter_EGL_ARM_image_format glatter_get_extension_support_EGL().has_EGL_ARM_image_format
-#define glatter_EGL_ARM_implicit_external_sync glatter_get_extension_support_EGL().has_EGL_ARM_implicit_external_sync
-#define glatter_EGL_ARM_pixmap_multisample_discard glatter_get_extension_support_EGL().has_EGL_ARM_pixmap_multisample_discard
-#define glatter_EGL_EXT_bind_to_front glatter_get_extension_support_EGL().has_EGL_EXT_bind_to_front
-#define glatter_EGL_EXT_buffer_age glatter_get_extension_support_EGL().has_EGL_EXT_buffer_age
-#define glatter_EGL_EXT_client_extensions glatter_get_extension_support_EGL().has_EGL_EXT_client_extensions
-#define glatter_EGL_EXT_client_sync glatter_get_extension_support_EGL().has_EGL_EXT_client_sync
-#define glatter_EGL_EXT_compositor glatter_get_extension_support_EGL().has_EGL_EXT_compositor
-#define glatter_EGL_EXT_config_select_group glatter_get_extension_support_EGL().has_EGL_EXT_config_select_group
-#define glatter_EGL_EXT_create_context_robustness glatter_get_extension_support_EGL().has_EGL_EXT_create_context_robustness
-#define glatter_EGL_EXT_device_base glatter_get_extension_support_EGL().has_EGL_EXT_device_base
-#define glatter_EGL_EXT_device_drm glatter_get_extension_support_EGL().has_EGL_EXT_device_drm
-#define glatter_EGL_EXT_device_drm_render_node glatter_get_extension_support_EGL().has_EGL_EXT_device_drm_render_node
-#define glatter_EGL_EXT_device_enumeration glatter_get_extension_support_EGL().has_EGL_EXT_device_enumeration
-#define glatter_EGL_EXT_device_openwf glatter_get_extension_support_EGL().has_EGL_EXT_device_openwf
-#define glatter_EGL_EXT_device_persistent_id glatter_get_extension_support_EGL().has_EGL_EXT_device_persistent_id
-#define glatter_EGL_EXT_device_query glatter_get_extension_support_EGL().has_EGL_EXT_device_query
-#define glatter_EGL_EXT_device_query_name glatter_get_extension_support_EGL().has_EGL_EXT_device_query_name
-#define glatter_EGL_EXT_display_alloc glatter_get_extension_support_EGL().has_EGL_EXT_display_alloc
-#define glatter_EGL_EXT_explicit_device glatter_get_extension_support_EGL().has_EGL_EXT_explicit_device
-#define glatter_EGL_EXT_gl_colorspace_bt2020_hlg glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_bt2020_hlg
-#define glatter_EGL_EXT_gl_colorspace_bt2020_linear glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_bt2020_linear
-#define glatter_EGL_EXT_gl_colorspace_bt2020_pq glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_bt2020_pq
-#define glatter_EGL_EXT_gl_colorspace_display_p3 glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_display_p3
-#define glatter_EGL_EXT_gl_colorspace_display_p3_linear glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_display_p3_linear
-#define glatter_EGL_EXT_gl_colorspace_display_p3_passthrough glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_display_p3_passthrough
-#define glatter_EGL_EXT_gl_colorspace_scrgb glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_scrgb
-#define glatter_EGL_EXT_gl_colorspace_scrgb_linear glatter_get_extension_support_EGL().has_EGL_EXT_gl_colorspace_scrgb_linear
-#define glatter_EGL_EXT_image_dma_buf_import glatter_get_extension_support_EGL().has_EGL_EXT_image_dma_buf_import
-#define glatter_EGL_EXT_image_dma_buf_import_modifiers glatter_get_extension_support_EGL().has_EGL_EXT_image_dma_buf_import_modifiers
-#define glatter_EGL_EXT_image_gl_colorspace glatter_get_extension_support_EGL().has_EGL_EXT_image_gl_colorspace
-#define glatter_EGL_EXT_image_implicit_sync_control glatter_get_extension_support_EGL().has_EGL_EXT_image_implicit_sync_control
-#define glatter_EGL_EXT_multiview_window glatter_get_extension_support_EGL().has_EGL_EXT_multiview_window
-#define glatter_EGL_EXT_output_base glatter_get_extension_support_EGL().has_EGL_EXT_output_base
-#define glatter_EGL_EXT_output_drm glatter_get_extension_support_EGL().has_EGL_EXT_output_drm
-#define glatter_EGL_EXT_output_openwf glatter_get_extension_support_EGL().has_EGL_EXT_output_openwf
-#define glatter_EGL_EXT_pixel_format_float glatter_get_extension_support_EGL().has_EGL_EXT_pixel_format_float
-#define glatter_EGL_EXT_platform_base glatter_get_extension_support_EGL().has_EGL_EXT_platform_base
-#define glatter_EGL_EXT_platform_device glatter_get_extension_support_EGL().has_EGL_EXT_platform_device
-#define glatter_EGL_EXT_platform_wayland glatter_get_extension_support_EGL().has_EGL_EXT_platform_wayland
-#define glatter_EGL_EXT_platform_x11 glatter_get_extension_support_EGL().has_EGL_EXT_platform_x11
-#define glatter_EGL_EXT_platform_xcb glatter_get_extension_support_EGL().has_EGL_EXT_platform_xcb
-#define glatter_EGL_EXT_present_opaque glatter_get_extension_support_EGL().has_EGL_EXT_present_opaque
-#define glatter_EGL_EXT_protected_content glatter_get_extension_support_EGL().has_EGL_EXT_protected_content
-#define glatter_EGL_EXT_protected_surface glatter_get_extension_support_EGL().has_EGL_EXT_protected_surface
-#define glatter_EGL_EXT_query_reset_notification_strategy glatter_get_extension_support_EGL().has_EGL_EXT_query_reset_notification_strategy
-#define glatter_EGL_EXT_stream_consumer_egloutput glatter_get_extension_support_EGL().has_EGL_EXT_stream_consumer_egloutput
-#define glatter_EGL_EXT_surface_CTA861_3_metadata glatter_get_extension_support_EGL().has_EGL_EXT_surface_CTA861_3_metadata
-#define glatter_EGL_EXT_surface_SMPTE2086_metadata glatter_get_extension_support_EGL().has_EGL_EXT_surface_SMPTE2086_metadata
-#define glatter_EGL_EXT_surface_compression glatter_get_extension_support_EGL().has_EGL_EXT_surface_compression
-#define glatter_EGL_EXT_swap_buffers_with_damage glatter_get_extension_support_EGL().has_EGL_EXT_swap_buffers_with_damage
-#define glatter_EGL_EXT_sync_reuse glatter_get_extension_support_EGL().has_EGL_EXT_sync_reuse
-#define glatter_EGL_EXT_yuv_surface glatter_get_extension_support_EGL().has_EGL_EXT_yuv_surface
-#define glatter_EGL_HI_clientpixmap glatter_get_extension_support_EGL().has_EGL_HI_clientpixmap
-#define glatter_EGL_HI_colorformats glatter_get_extension_support_EGL().has_EGL_HI_colorformats
-#define glatter_EGL_IMG_context_priority glatter_get_extension_support_EGL().has_EGL_IMG_context_priority
-#define glatter_EGL_IMG_image_plane_attribs glatter_get_extension_support_EGL().has_EGL_IMG_image_plane_attribs
-#define glatter_EGL_KHR_cl_event glatter_get_extension_support_EGL().has_EGL_KHR_cl_event
-#define glatter_EGL_KHR_cl_event2 glatter_get_extension_support_EGL().has_EGL_KHR_cl_event2
-#define glatter_EGL_KHR_client_get_all_proc_addresses glatter_get_extension_support_EGL().has_EGL_KHR_client_get_all_proc_addresses
-#define glatter_EGL_KHR_config_attribs glatter_get_extension_support_EGL().has_EGL_KHR_config_attribs
-#define glatter_EGL_KHR_context_flush_control glatter_get_extension_support_EGL().has_EGL_KHR_context_flush_control
-#define glatter_EGL_KHR_create_context glatter_get_extension_support_EGL().has_EGL_KHR_create_context
-#define glatter_EGL_KHR_create_context_no_error glatter_get_extension_support_EGL().has_EGL_KHR_create_context_no_error
-#define glatter_EGL_KHR_debug glatter_get_extension_support_EGL().has_EGL_KHR_debug
-#define glatter_EGL_KHR_display_reference glatter_get_extension_support_EGL().has_EGL_KHR_display_reference
-#define glatter_EGL_KHR_fence_sync glatter_get_extension_support_EGL().has_EGL_KHR_fence_sync
-#define glatter_EGL_KHR_get_all_proc_addresses glatter_get_extension_support_EGL().has_EGL_KHR_get_all_proc_addresses
-#define glatter_EGL_KHR_gl_colorspace glatter_get_extension_support_EGL().has_EGL_KHR_gl_colorspace
-#define glatter_EGL_KHR_gl_renderbuffer_image glatter_get_extension_support_EGL().has_EGL_KHR_gl_renderbuffer_image
-#define glatter_EGL_KHR_gl_texture_2D_image glatter_get_extension_support_EGL().has_EGL_KHR_gl_texture_2D_image
-#define glatter_EGL_KHR_gl_texture_3D_image glatter_get_extension_support_EGL().has_EGL_KHR_gl_texture_3D_image
-#define glatter_EGL_KHR_gl_texture_cubemap_image glatter_get_extension_support_EGL().has_EGL_KHR_gl_texture_cubemap_image
-#define glatter_EGL_KHR_image glatter_get_extension_support_EGL().has_EGL_KHR_image
-#define glatter_EGL_KHR_image_base glatter_get_extension_support_EGL().has_EGL_KHR_image_base
-#define glatter_EGL_KHR_image_pixmap glatter_get_extension_support_EGL().has_EGL_KHR_image_pixmap
-#define glatter_EGL_KHR_lock_surface glatter_get_extension_support_EGL().has_EGL_KHR_lock_surface
-#define glatter_EGL_KHR_lock_surface2 glatter_get_extension_support_EGL().has_EGL_KHR_lock_surface2
-#define glatter_EGL_KHR_lock_surface3 glatter_get_extension_support_EGL().has_EGL_KHR_lock_surface3
-#define glatter_EGL_KHR_mutable_render_buffer glatter_get_extension_support_EGL().has_EGL_KHR_mutable_render_buffer
-#define glatter_EGL_KHR_no_config_context glatter_get_extension_support_EGL().has_EGL_KHR_no_config_context
-#define glatter_EGL_KHR_partial_update glatter_get_extension_support_EGL().has_EGL_KHR_partial_update
-#define glatter_EGL_KHR_platform_android glatter_get_extension_support_EGL().has_EGL_KHR_platform_android
-#define glatter_EGL_KHR_platform_gbm glatter_get_extension_support_EGL().has_EGL_KHR_platform_gbm
-#define glatter_EGL_KHR_platform_wayland glatter_get_extension_support_EGL().has_EGL_KHR_platform_wayland
-#define glatter_EGL_KHR_platform_x11 glatter_get_extension_support_EGL().has_EGL_KHR_platform_x11
-#define glatter_EGL_KHR_reusable_sync glatter_get_extension_support_EGL().has_EGL_KHR_reusable_sync
-#define glatter_EGL_KHR_stream glatter_get_extension_support_EGL().has_EGL_KHR_stream
-#define glatter_EGL_KHR_stream_attrib glatter_get_extension_support_EGL().has_EGL_KHR_stream_attrib
-#define glatter_EGL_KHR_stream_consumer_gltexture glatter_get_extension_support_EGL().has_EGL_KHR_stream_consumer_gltexture
-#define glatter_EGL_KHR_stream_cross_process_fd glatter_get_extension_support_EGL().has_EGL_KHR_stream_cross_process_fd
-#define glatter_EGL_KHR_stream_fifo glatter_get_extension_support_EGL().has_EGL_KHR_stream_fifo
-#define glatter_EGL_KHR_stream_producer_aldatalocator glatter_get_extension_support_EGL().has_EGL_KHR_stream_producer_aldatalocator
-#define glatter_EGL_KHR_stream_producer_eglsurface glatter_get_extension_support_EGL().has_EGL_KHR_stream_producer_eglsurface
-#define glatter_EGL_KHR_surfaceless_context glatter_get_extension_support_EGL().has_EGL_KHR_surfaceless_context
-#define glatter_EGL_KHR_swap_buffers_with_damage glatter_get_extension_support_EGL().has_EGL_KHR_swap_buffers_with_damage
-#define glatter_EGL_KHR_vg_parent_image glatter_get_extension_support_EGL().has_EGL_KHR_vg_parent_image
-#define glatter_EGL_KHR_wait_sync glatter_get_extension_support_EGL().has_EGL_KHR_wait_sync
-#define glatter_EGL_MESA_drm_image glatter_get_extension_support_EGL().has_EGL_MESA_drm_image
-#define glatter_EGL_MESA_image_dma_buf_export glatter_get_extension_support_EGL().has_EGL_MESA_image_dma_buf_export
-#define glatter_EGL_MESA_platform_gbm glatter_get_extension_support_EGL().has_EGL_MESA_platform_gbm
-#define glatter_EGL_MESA_platform_surfaceless glatter_get_extension_support_EGL().has_EGL_MESA_platform_surfaceless
-#define glatter_EGL_MESA_query_driver glatter_get_extension_support_EGL().has_EGL_MESA_query_driver
-#define glatter_EGL_NOK_swap_region glatter_get_extension_support_EGL().has_EGL_NOK_swap_region
-#define glatter_EGL_NOK_swap_region2 glatter_get_extension_support_EGL().has_EGL_NOK_swap_region2
-#define glatter_EGL_NOK_texture_from_pixmap glatter_get_extension_support_EGL().has_EGL_NOK_texture_from_pixmap
-#define glatter_EGL_NV_3dvision_surface glatter_get_extension_support_EGL().has_EGL_NV_3dvision_surface
-#define glatter_EGL_NV_context_priority_realtime glatter_get_extension_support_EGL().has_EGL_NV_context_priority_realtime
-#define glatter_EGL_NV_coverage_sample glatter_get_extension_support_EGL().has_EGL_NV_coverage_sample
-#define glatter_EGL_NV_coverage_sample_resolve glatter_get_extension_support_EGL().has_EGL_NV_coverage_sample_resolve
-#define glatter_EGL_NV_cuda_event glatter_get_extension_support_EGL().has_EGL_NV_cuda_event
-#define glatter_EGL_NV_depth_nonlinear glatter_get_extension_support_EGL().has_EGL_NV_depth_nonlinear
-#define glatter_EGL_NV_device_cuda glatter_get_extension_support_EGL().has_EGL_NV_device_cuda
-#define glatter_EGL_NV_native_query glatter_get_extension_support_EGL().has_EGL_NV_native_query
-#define glatter_EGL_NV_post_convert_rounding glatter_get_extension_support_EGL().has_EGL_NV_post_convert_rounding
-#define glatter_EGL_NV_post_sub_buffer glatter_get_extension_support_EGL().has_EGL_NV_post_sub_buffer
-#define glatter_EGL_NV_quadruple_buffer glatter_get_extension_support_EGL().has_EGL_NV_quadruple_buffer
-#define glatter_EGL_NV_robustness_video_memory_purge glatter_get_extension_support_EGL().has_EGL_NV_robustness_video_memory_purge
-#define glatter_EGL_NV_stream_consumer_eglimage glatter_get_extension_support_EGL().has_EGL_NV_stream_consumer_eglimage
-#define glatter_EGL_NV_stream_consumer_eglimage_use_scanout_attrib glatter_get_extension_support_EGL().has_EGL_NV_stream_consumer_eglimage_use_scanout_attrib
-#define glatter_EGL_NV_stream_consumer_gltexture_yuv glatter_get_extension_support_EGL().has_EGL_NV_stream_consumer_gltexture_yuv
-#define glatter_EGL_NV_stream_cross_display glatter_get_extension_support_EGL().has_EGL_NV_stream_cross_display
-#define glatter_EGL_NV_stream_cross_object glatter_get_extension_support_EGL().has_EGL_NV_stream_cross_object
-#define glatter_EGL_NV_stream_cross_partition glatter_get_extension_support_EGL().has_EGL_NV_stream_cross_partition
-#define glatter_EGL_NV_stream_cross_process glatter_get_extension_support_EGL().has_EGL_NV_stream_cross_process
-#define glatter_EGL_NV_stream_cross_system glatter_get_extension_support_EGL().has_EGL_NV_stream_cross_system
-#define glatter_EGL_NV_stream_dma glatter_get_extension_support_EGL().has_EGL_NV_stream_dma
-#define glatter_EGL_NV_stream_fifo_next glatter_get_extension_support_EGL().has_EGL_NV_stream_fifo_next
-#define glatter_EGL_NV_stream_fifo_synchronous glatter_get_extension_support_EGL().has_EGL_NV_stream_fifo_synchronous
-#define glatter_EGL_NV_stream_flush glatter_get_extension_support_EGL().has_EGL_NV_stream_flush
-#define glatter_EGL_NV_stream_frame_limits glatter_get_extension_support_EGL().has_EGL_NV_stream_frame_limits
-#define glatter_EGL_NV_stream_metadata glatter_get_extension_support_EGL().has_EGL_NV_stream_metadata
-#define glatter_EGL_NV_stream_origin glatter_get_extension_support_EGL().has_EGL_NV_stream_origin
-#define glatter_EGL_NV_stream_remote glatter_get_extension_support_EGL().has_EGL_NV_stream_remote
-#define glatter_EGL_NV_stream_reset glatter_get_extension_support_EGL().has_EGL_NV_stream_reset
-#define glatter_EGL_NV_stream_socket glatter_get_extension_support_EGL().has_EGL_NV_stream_socket
-#define glatter_EGL_NV_stream_socket_inet glatter_get_extension_support_EGL().has_EGL_NV_stream_socket_inet
-#define glatter_EGL_NV_stream_socket_unix glatter_get_extension_support_EGL().has_EGL_NV_stream_socket_unix
-#define glatter_EGL_NV_stream_sync glatter_get_extension_support_EGL().has_EGL_NV_stream_sync
-#define glatter_EGL_NV_sync glatter_get_extension_support_EGL().has_EGL_NV_sync
-#define glatter_EGL_NV_system_time glatter_get_extension_support_EGL().has_EGL_NV_system_time
-#define glatter_EGL_NV_triple_buffer glatter_get_extension_support_EGL().has_EGL_NV_triple_buffer
-#define glatter_EGL_TIZEN_image_native_buffer glatter_get_extension_support_EGL().has_EGL_TIZEN_image_native_buffer
-#define glatter_EGL_TIZEN_image_native_surface glatter_get_extension_support_EGL().has_EGL_TIZEN_image_native_surface
+#define glatter_EGL_ANDROID_GLES_layers glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_GLES_layers)
+#define glatter_EGL_ANDROID_blob_cache glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_blob_cache)
+#define glatter_EGL_ANDROID_create_native_client_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_create_native_client_buffer)
+#define glatter_EGL_ANDROID_framebuffer_target glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_framebuffer_target)
+#define glatter_EGL_ANDROID_front_buffer_auto_refresh glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_front_buffer_auto_refresh)
+#define glatter_EGL_ANDROID_get_frame_timestamps glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_get_frame_timestamps)
+#define glatter_EGL_ANDROID_get_native_client_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_get_native_client_buffer)
+#define glatter_EGL_ANDROID_image_native_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_image_native_buffer)
+#define glatter_EGL_ANDROID_native_fence_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_native_fence_sync)
+#define glatter_EGL_ANDROID_presentation_time glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_presentation_time)
+#define glatter_EGL_ANDROID_recordable glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_recordable)
+#define glatter_EGL_ANDROID_telemetry_hint glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANDROID_telemetry_hint)
+#define glatter_EGL_ANGLE_d3d_share_handle_client_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANGLE_d3d_share_handle_client_buffer)
+#define glatter_EGL_ANGLE_device_d3d glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANGLE_device_d3d)
+#define glatter_EGL_ANGLE_query_surface_pointer glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANGLE_query_surface_pointer)
+#define glatter_EGL_ANGLE_surface_d3d_texture_2d_share_handle glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANGLE_surface_d3d_texture_2d_share_handle)
+#define glatter_EGL_ANGLE_sync_control_rate glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANGLE_sync_control_rate)
+#define glatter_EGL_ANGLE_window_fixed_size glatter_extension_supported_EGL(GLATTER_EXT_EGL_ANGLE_window_fixed_size)
+#define glatter_EGL_ARM_image_format glatter_extension_supported_EGL(GLATTER_EXT_EGL_ARM_image_format)
+#define glatter_EGL_ARM_implicit_external_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_ARM_implicit_external_sync)
+#define glatter_EGL_ARM_pixmap_multisample_discard glatter_extension_supported_EGL(GLATTER_EXT_EGL_ARM_pixmap_multisample_discard)
+#define glatter_EGL_EXT_bind_to_front glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_bind_to_front)
+#define glatter_EGL_EXT_buffer_age glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_buffer_age)
+#define glatter_EGL_EXT_client_extensions glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_client_extensions)
+#define glatter_EGL_EXT_client_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_client_sync)
+#define glatter_EGL_EXT_compositor glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_compositor)
+#define glatter_EGL_EXT_config_select_group glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_config_select_group)
+#define glatter_EGL_EXT_create_context_robustness glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_create_context_robustness)
+#define glatter_EGL_EXT_device_base glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_base)
+#define glatter_EGL_EXT_device_drm glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_drm)
+#define glatter_EGL_EXT_device_drm_render_node glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_drm_render_node)
+#define glatter_EGL_EXT_device_enumeration glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_enumeration)
+#define glatter_EGL_EXT_device_openwf glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_openwf)
+#define glatter_EGL_EXT_device_persistent_id glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_persistent_id)
+#define glatter_EGL_EXT_device_query glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_query)
+#define glatter_EGL_EXT_device_query_name glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_device_query_name)
+#define glatter_EGL_EXT_display_alloc glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_display_alloc)
+#define glatter_EGL_EXT_explicit_device glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_explicit_device)
+#define glatter_EGL_EXT_gl_colorspace_bt2020_hlg glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_bt2020_hlg)
+#define glatter_EGL_EXT_gl_colorspace_bt2020_linear glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_bt2020_linear)
+#define glatter_EGL_EXT_gl_colorspace_bt2020_pq glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_bt2020_pq)
+#define glatter_EGL_EXT_gl_colorspace_display_p3 glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_display_p3)
+#define glatter_EGL_EXT_gl_colorspace_display_p3_linear glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_display_p3_linear)
+#define glatter_EGL_EXT_gl_colorspace_display_p3_passthrough glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_display_p3_passthrough)
+#define glatter_EGL_EXT_gl_colorspace_scrgb glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_scrgb)
+#define glatter_EGL_EXT_gl_colorspace_scrgb_linear glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_gl_colorspace_scrgb_linear)
+#define glatter_EGL_EXT_image_dma_buf_import glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_image_dma_buf_import)
+#define glatter_EGL_EXT_image_dma_buf_import_modifiers glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_image_dma_buf_import_modifiers)
+#define glatter_EGL_EXT_image_gl_colorspace glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_image_gl_colorspace)
+#define glatter_EGL_EXT_image_implicit_sync_control glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_image_implicit_sync_control)
+#define glatter_EGL_EXT_multiview_window glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_multiview_window)
+#define glatter_EGL_EXT_output_base glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_output_base)
+#define glatter_EGL_EXT_output_drm glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_output_drm)
+#define glatter_EGL_EXT_output_openwf glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_output_openwf)
+#define glatter_EGL_EXT_pixel_format_float glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_pixel_format_float)
+#define glatter_EGL_EXT_platform_base glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_platform_base)
+#define glatter_EGL_EXT_platform_device glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_platform_device)
+#define glatter_EGL_EXT_platform_wayland glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_platform_wayland)
+#define glatter_EGL_EXT_platform_x11 glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_platform_x11)
+#define glatter_EGL_EXT_platform_xcb glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_platform_xcb)
+#define glatter_EGL_EXT_present_opaque glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_present_opaque)
+#define glatter_EGL_EXT_protected_content glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_protected_content)
+#define glatter_EGL_EXT_protected_surface glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_protected_surface)
+#define glatter_EGL_EXT_query_reset_notification_strategy glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_query_reset_notification_strategy)
+#define glatter_EGL_EXT_stream_consumer_egloutput glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_stream_consumer_egloutput)
+#define glatter_EGL_EXT_surface_CTA861_3_metadata glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_surface_CTA861_3_metadata)
+#define glatter_EGL_EXT_surface_SMPTE2086_metadata glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_surface_SMPTE2086_metadata)
+#define glatter_EGL_EXT_surface_compression glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_surface_compression)
+#define glatter_EGL_EXT_swap_buffers_with_damage glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_swap_buffers_with_damage)
+#define glatter_EGL_EXT_sync_reuse glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_sync_reuse)
+#define glatter_EGL_EXT_yuv_surface glatter_extension_supported_EGL(GLATTER_EXT_EGL_EXT_yuv_surface)
+#define glatter_EGL_HI_clientpixmap glatter_extension_supported_EGL(GLATTER_EXT_EGL_HI_clientpixmap)
+#define glatter_EGL_HI_colorformats glatter_extension_supported_EGL(GLATTER_EXT_EGL_HI_colorformats)
+#define glatter_EGL_IMG_context_priority glatter_extension_supported_EGL(GLATTER_EXT_EGL_IMG_context_priority)
+#define glatter_EGL_IMG_image_plane_attribs glatter_extension_supported_EGL(GLATTER_EXT_EGL_IMG_image_plane_attribs)
+#define glatter_EGL_KHR_cl_event glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_cl_event)
+#define glatter_EGL_KHR_cl_event2 glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_cl_event2)
+#define glatter_EGL_KHR_client_get_all_proc_addresses glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_client_get_all_proc_addresses)
+#define glatter_EGL_KHR_config_attribs glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_config_attribs)
+#define glatter_EGL_KHR_context_flush_control glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_context_flush_control)
+#define glatter_EGL_KHR_create_context glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_create_context)
+#define glatter_EGL_KHR_create_context_no_error glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_create_context_no_error)
+#define glatter_EGL_KHR_debug glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_debug)
+#define glatter_EGL_KHR_display_reference glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_display_reference)
+#define glatter_EGL_KHR_fence_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_fence_sync)
+#define glatter_EGL_KHR_get_all_proc_addresses glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_get_all_proc_addresses)
+#define glatter_EGL_KHR_gl_colorspace glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_gl_colorspace)
+#define glatter_EGL_KHR_gl_renderbuffer_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_gl_renderbuffer_image)
+#define glatter_EGL_KHR_gl_texture_2D_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_gl_texture_2D_image)
+#define glatter_EGL_KHR_gl_texture_3D_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_gl_texture_3D_image)
+#define glatter_EGL_KHR_gl_texture_cubemap_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_gl_texture_cubemap_image)
+#define glatter_EGL_KHR_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_image)
+#define glatter_EGL_KHR_image_base glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_image_base)
+#define glatter_EGL_KHR_image_pixmap glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_image_pixmap)
+#define glatter_EGL_KHR_lock_surface glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_lock_surface)
+#define glatter_EGL_KHR_lock_surface2 glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_lock_surface2)
+#define glatter_EGL_KHR_lock_surface3 glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_lock_surface3)
+#define glatter_EGL_KHR_mutable_render_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_mutable_render_buffer)
+#define glatter_EGL_KHR_no_config_context glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_no_config_context)
+#define glatter_EGL_KHR_partial_update glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_partial_update)
+#define glatter_EGL_KHR_platform_android glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_platform_android)
+#define glatter_EGL_KHR_platform_gbm glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_platform_gbm)
+#define glatter_EGL_KHR_platform_wayland glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_platform_wayland)
+#define glatter_EGL_KHR_platform_x11 glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_platform_x11)
+#define glatter_EGL_KHR_reusable_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_reusable_sync)
+#define glatter_EGL_KHR_stream glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream)
+#define glatter_EGL_KHR_stream_attrib glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream_attrib)
+#define glatter_EGL_KHR_stream_consumer_gltexture glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream_consumer_gltexture)
+#define glatter_EGL_KHR_stream_cross_process_fd glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream_cross_process_fd)
+#define glatter_EGL_KHR_stream_fifo glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream_fifo)
+#define glatter_EGL_KHR_stream_producer_aldatalocator glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream_producer_aldatalocator)
+#define glatter_EGL_KHR_stream_producer_eglsurface glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_stream_producer_eglsurface)
+#define glatter_EGL_KHR_surfaceless_context glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_surfaceless_context)
+#define glatter_EGL_KHR_swap_buffers_with_damage glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_swap_buffers_with_damage)
+#define glatter_EGL_KHR_vg_parent_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_vg_parent_image)
+#define glatter_EGL_KHR_wait_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_KHR_wait_sync)
+#define glatter_EGL_MESA_drm_image glatter_extension_supported_EGL(GLATTER_EXT_EGL_MESA_drm_image)
+#define glatter_EGL_MESA_image_dma_buf_export glatter_extension_supported_EGL(GLATTER_EXT_EGL_MESA_image_dma_buf_export)
+#define glatter_EGL_MESA_platform_gbm glatter_extension_supported_EGL(GLATTER_EXT_EGL_MESA_platform_gbm)
+#define glatter_EGL_MESA_platform_surfaceless glatter_extension_supported_EGL(GLATTER_EXT_EGL_MESA_platform_surfaceless)
+#define glatter_EGL_MESA_query_driver glatter_extension_supported_EGL(GLATTER_EXT_EGL_MESA_query_driver)
+#define glatter_EGL_NOK_swap_region glatter_extension_supported_EGL(GLATTER_EXT_EGL_NOK_swap_region)
+#define glatter_EGL_NOK_swap_region2 glatter_extension_supported_EGL(GLATTER_EXT_EGL_NOK_swap_region2)
+#define glatter_EGL_NOK_texture_from_pixmap glatter_extension_supported_EGL(GLATTER_EXT_EGL_NOK_texture_from_pixmap)
+#define glatter_EGL_NV_3dvision_surface glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_3dvision_surface)
+#define glatter_EGL_NV_context_priority_realtime glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_context_priority_realtime)
+#define glatter_EGL_NV_coverage_sample glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_coverage_sample)
+#define glatter_EGL_NV_coverage_sample_resolve glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_coverage_sample_resolve)
+#define glatter_EGL_NV_cuda_event glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_cuda_event)
+#define glatter_EGL_NV_depth_nonlinear glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_depth_nonlinear)
+#define glatter_EGL_NV_device_cuda glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_device_cuda)
+#define glatter_EGL_NV_native_query glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_native_query)
+#define glatter_EGL_NV_post_convert_rounding glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_post_convert_rounding)
+#define glatter_EGL_NV_post_sub_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_post_sub_buffer)
+#define glatter_EGL_NV_quadruple_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_quadruple_buffer)
+#define glatter_EGL_NV_robustness_video_memory_purge glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_robustness_video_memory_purge)
+#define glatter_EGL_NV_stream_consumer_eglimage glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_consumer_eglimage)
+#define glatter_EGL_NV_stream_consumer_eglimage_use_scanout_attrib glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_consumer_eglimage_use_scanout_attrib)
+#define glatter_EGL_NV_stream_consumer_gltexture_yuv glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_consumer_gltexture_yuv)
+#define glatter_EGL_NV_stream_cross_display glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_cross_display)
+#define glatter_EGL_NV_stream_cross_object glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_cross_object)
+#define glatter_EGL_NV_stream_cross_partition glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_cross_partition)
+#define glatter_EGL_NV_stream_cross_process glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_cross_process)
+#define glatter_EGL_NV_stream_cross_system glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_cross_system)
+#define glatter_EGL_NV_stream_dma glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_dma)
+#define glatter_EGL_NV_stream_fifo_next glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_fifo_next)
+#define glatter_EGL_NV_stream_fifo_synchronous glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_fifo_synchronous)
+#define glatter_EGL_NV_stream_flush glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_flush)
+#define glatter_EGL_NV_stream_frame_limits glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_frame_limits)
+#define glatter_EGL_NV_stream_metadata glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_metadata)
+#define glatter_EGL_NV_stream_origin glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_origin)
+#define glatter_EGL_NV_stream_remote glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_remote)
+#define glatter_EGL_NV_stream_reset glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_reset)
+#define glatter_EGL_NV_stream_socket glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_socket)
+#define glatter_EGL_NV_stream_socket_inet glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_socket_inet)
+#define glatter_EGL_NV_stream_socket_unix glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_socket_unix)
+#define glatter_EGL_NV_stream_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_stream_sync)
+#define glatter_EGL_NV_sync glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_sync)
+#define glatter_EGL_NV_system_time glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_system_time)
+#define glatter_EGL_NV_triple_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_NV_triple_buffer)
+#define glatter_EGL_TIZEN_image_native_buffer glatter_extension_supported_EGL(GLATTER_EXT_EGL_TIZEN_image_native_buffer)
+#define glatter_EGL_TIZEN_image_native_surface glatter_extension_supported_EGL(GLATTER_EXT_EGL_TIZEN_image_native_surface)
 
@@ -0,0 +1,333 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+#ifdef GLATTER_EGL
+#if defined(__egl_h_)
+#if defined(EGL_VERSION_1_0)
+GLATTER_IBLOCK(eglChooseConfig)
+GLATTER_IBLOCK(eglCopyBuffers)
+GLATTER_IBLOCK(eglCreateContext)
+GLATTER_IBLOCK(eglCreatePbufferSurface)
+GLATTER_IBLOCK(eglCreatePixmapSurface)
+GLATTER_IBLOCK(eglCreateWindowSurface)
+GLATTER_IBLOCK(eglDestroyContext)
+GLATTER_IBLOCK(eglDestroySurface)
+GLATTER_IBLOCK(eglGetConfigAttrib)
+GLATTER_IBLOCK(eglGetConfigs)
+GLATTER_IBLOCK(eglGetCurrentDisplay)
+GLATTER_IBLOCK(eglGetCurrentSurface)
+GLATTER_IBLOCK(eglGetDisplay)
+GLATTER_IBLOCK(eglGetError)
+GLATTER_IBLOCK(eglInitialize)
+GLATTER_IBLOCK(eglMakeCurrent)
+GLATTER_IBLOCK(eglQueryContext)
+GLATTER_IBLOCK(eglQueryString)
+GLATTER_IBLOCK(eglQuerySurface)
+GLATTER_IBLOCK(eglSwapBuffers)
+GLATTER_IBLOCK(eglTerminate)
+GLATTER_IBLOCK(eglWaitGL)
+GLATTER_IBLOCK(eglWaitNative)
+#endif // defined(EGL_VERSION_1_0)
+#if defined(EGL_VERSION_1_1)
+GLATTER_IBLOCK(eglBindTexImage)
+GLATTER_IBLOCK(eglReleaseTexImage)
+GLATTER_IBLOCK(eglSurfaceAttrib)
+GLATTER_IBLOCK(eglSwapInterval)
+#endif // defined(EGL_VERSION_1_1)
+#if defined(EGL_VERSION_1_2)
+GLATTER_IBLOCK(eglBindAPI)
+GLATTER_IBLOCK(eglCreatePbufferFromClientBuffer)
+GLATTER_IBLOCK(eglQueryAPI)
+GLATTER_IBLOCK(eglReleaseThread)
+GLATTER_IBLOCK(eglWaitClient)
+#endif // defined(EGL_VERSION_1_2)
+#if defined(EGL_VERSION_1_4)
+GLATTER_IBLOCK(eglGetCurrentContext)
+#endif // defined(EGL_VERSION_1_4)
+#if defined(EGL_VERSION_1_5)
+GLATTER_IBLOCK(eglClientWaitSync)
+GLATTER_IBLOCK(eglCreateImage)
+GLATTER_IBLOCK(eglCreatePlatformPixmapSurface)
+GLATTER_IBLOCK(eglCreatePlatformWindowSurface)
+GLATTER_IBLOCK(eglCreateSync)
+GLATTER_IBLOCK(eglDestroyImage)
+GLATTER_IBLOCK(eglDestroySync)
+GLATTER_IBLOCK(eglGetPlatformDisplay)
+GLATTER_IBLOCK(eglGetSyncAttrib)
+GLATTER_IBLOCK(eglWaitSync)
+#endif // defined(EGL_VERSION_1_5)
+#endif // defined(__egl_h_)
+#if defined(__eglext_h_)
+#if defined(EGL_ANDROID_blob_cache)
+GLATTER_IBLOCK(eglSetBlobCacheFuncsANDROID)
+#endif // defined(EGL_ANDROID_blob_cache)
+#if defined(EGL_ANDROID_create_native_client_buffer)
+GLATTER_IBLOCK(eglCreateNativeClientBufferANDROID)
+#endif // defined(EGL_ANDROID_create_native_client_buffer)
+#if defined(EGL_ANDROID_get_frame_timestamps)
+GLATTER_IBLOCK(eglGetCompositorTimingANDROID)
+GLATTER_IBLOCK(eglGetCompositorTimingSupportedANDROID)
+GLATTER_IBLOCK(eglGetFrameTimestampSupportedANDROID)
+GLATTER_IBLOCK(eglGetFrameTimestampsANDROID)
+GLATTER_IBLOCK(eglGetNextFrameIdANDROID)
+#endif // defined(EGL_ANDROID_get_frame_timestamps)
+#if defined(EGL_ANDROID_get_native_client_buffer)
+GLATTER_IBLOCK(eglGetNativeClientBufferANDROID)
+#endif // defined(EGL_ANDROID_get_native_client_buffer)
+#if defined(EGL_ANDROID_native_fence_sync)
+GLATTER_IBLOCK(eglDupNativeFenceFDANDROID)
+#endif // defined(EGL_ANDROID_native_fence_sync)
+#if defined(EGL_ANDROID_presentation_time)
+GLATTER_IBLOCK(eglPresentationTimeANDROID)
+#endif // defined(EGL_ANDROID_presentation_time)
+#if defined(EGL_ANGLE_query_surface_pointer)
+GLATTER_IBLOCK(eglQuerySurfacePointerANGLE)
+#endif // defined(EGL_ANGLE_query_surface_pointer)
+#if defined(EGL_ANGLE_sync_control_rate)
+GLATTER_IBLOCK(eglGetMscRateANGLE)
+#endif // defined(EGL_ANGLE_sync_control_rate)
+#if defined(EGL_EXT_client_sync)
+GLATTER_IBLOCK(eglClientSignalSyncEXT)
+#endif // defined(EGL_EXT_client_sync)
+#if defined(EGL_EXT_compositor)
+GLATTER_IBLOCK(eglCompositorBindTexWindowEXT)
+GLATTER_IBLOCK(eglCompositorSetContextAttributesEXT)
+GLATTER_IBLOCK(eglCompositorSetContextListEXT)
+GLATTER_IBLOCK(eglCompositorSetSizeEXT)
+GLATTER_IBLOCK(eglCompositorSetWindowAttributesEXT)
+GLATTER_IBLOCK(eglCompositorSetWindowListEXT)
+GLATTER_IBLOCK(eglCompositorSwapPolicyEXT)
+#endif // defined(EGL_EXT_compositor)
+#if defined(EGL_EXT_device_base)
+GLATTER_IBLOCK(eglQueryDeviceAttribEXT)
+GLATTER_IBLOCK(eglQueryDeviceStringEXT)
+GLATTER_IBLOCK(eglQueryDevicesEXT)
+GLATTER_IBLOCK(eglQueryDisplayAttribEXT)
+#endif // defined(EGL_EXT_device_base)
+#if defined(EGL_EXT_device_persistent_id)
+GLATTER_IBLOCK(eglQueryDeviceBinaryEXT)
+#endif // defined(EGL_EXT_device_persistent_id)
+#if defined(EGL_EXT_display_alloc)
+GLATTER_IBLOCK(eglDestroyDisplayEXT)
+#endif // defined(EGL_EXT_display_alloc)
+#if defined(EGL_EXT_image_dma_buf_import_modifiers)
+GLATTER_IBLOCK(eglQueryDmaBufFormatsEXT)
+GLATTER_IBLOCK(eglQueryDmaBufModifiersEXT)
+#endif // defined(EGL_EXT_image_dma_buf_import_modifiers)
+#if defined(EGL_EXT_output_base)
+GLATTER_IBLOCK(eglGetOutputLayersEXT)
+GLATTER_IBLOCK(eglGetOutputPortsEXT)
+GLATTER_IBLOCK(eglOutputLayerAttribEXT)
+GLATTER_IBLOCK(eglOutputPortAttribEXT)
+GLATTER_IBLOCK(eglQueryOutputLayerAttribEXT)
+GLATTER_IBLOCK(eglQueryOutputLayerStringEXT)
+GLATTER_IBLOCK(eglQueryOutputPortAttribEXT)
+GLATTER_IBLOCK(eglQueryOutputPortStringEXT)
+#endif // defined(EGL_EXT_output_base)
+#if defined(EGL_EXT_platform_base)
+GLATTER_IBLOCK(eglCreatePlatformPixmapSurfaceEXT)
+GLATTER_IBLOCK(eglCreatePlatformWindowSurfaceEXT)
+GLATTER_IBLOCK(eglGetPlatformDisplayEXT)
+#endif // defined(EGL_EXT_platform_base)
+#if defined(EGL_EXT_stream_consumer_egloutput)
+GLATTER_IBLOCK(eglStreamConsumerOutputEXT)
+#endif // defined(EGL_EXT_stream_consumer_egloutput)
+#if defined(EGL_EXT_surface_compression)
+GLATTER_IBLOCK(eglQuerySupportedCompressionRatesEXT)
+#endif // defined(EGL_EXT_surface_compression)
+#if defined(EGL_EXT_swap_buffers_with_damage)
+GLATTER_IBLOCK(eglSwapBuffersWithDamageEXT)
+#endif // defined(EGL_EXT_swap_buffers_with_damage)
+#if defined(EGL_EXT_sync_reuse)
+GLATTER_IBLOCK(eglUnsignalSyncEXT)
+#endif // defined(EGL_EXT_sync_reuse)
+#if defined(EGL_HI_clientpixmap)
+GLATTER_IBLOCK(eglCreatePixmapSurfaceHI)
+#endif // defined(EGL_HI_clientpixmap)
+#if defined(EGL_KHR_cl_event2)
+GLATTER_IBLOCK(eglCreateSync64KHR)
+#endif // defined(EGL_KHR_cl_event2)
+#if defined(EGL_KHR_debug)
+GLATTER_IBLOCK(eglDebugMessageControlKHR)
+GLATTER_IBLOCK(eglLabelObjectKHR)
+GLATTER_IBLOCK(eglQueryDebugKHR)
+#endif // defined(EGL_KHR_debug)
+#if defined(EGL_KHR_display_reference)
+GLATTER_IBLOCK(eglQueryDisplayAttribKHR)
+#endif // defined(EGL_KHR_display_reference)
+#if defined(EGL_KHR_fence_sync)
+#if defined(KHRONOS_SUPPORT_INT64)
+GLATTER_IBLOCK(eglClientWaitSyncKHR)
+GLATTER_IBLOCK(eglCreateSyncKHR)
+GLATTER_IBLOCK(eglDestroySyncKHR)
+GLATTER_IBLOCK(eglGetSyncAttribKHR)
+#endif // defined(KHRONOS_SUPPORT_INT64)
+#endif // defined(EGL_KHR_fence_sync)
+#if defined(EGL_KHR_image)
+GLATTER_IBLOCK(eglCreateImageKHR)
+GLATTER_IBLOCK(eglDestroyImageKHR)
+#endif // defined(EGL_KHR_image)
+#if defined(EGL_KHR_lock_surface)
+GLATTER_IBLOCK(eglLockSurfaceKHR)
+GLATTER_IBLOCK(eglUnlockSurfaceKHR)
+#endif // defined(EGL_KHR_lock_surface)
+#if defined(EGL_KHR_lock_surface3)
+GLATTER_IBLOCK(eglQuerySurface64KHR)
+#endif // defined(EGL_KHR_lock_surface3)
+#if defined(EGL_KHR_partial_update)
+GLATTER_IBLOCK(eglSetDamageRegionKHR)
+#endif // defined(EGL_KHR_partial_update)
+#if defined(EGL_KHR_reusable_sync)
+#if defined(KHRONOS_SUPPORT_INT64)
+GLATTER_IBLOCK(eglSignalSyncKHR)
+#endif // defined(KHRONOS_SUPPORT_INT64)
+#endif // defined(EGL_KHR_reusable_sync)
+#if defined(EGL_KHR_stream)
+#if defined(KHRONOS_SUPPORT_INT64)
+GLATTER_IBLOCK(eglCreateStreamKHR)
+GLATTER_IBLOCK(eglDestroyStreamKHR)
+GLATTER_IBLOCK(eglQueryStreamKHR)
+GLATTER_IBLOCK(eglQueryStreamu64KHR)
+GLATTER_IBLOCK(eglStreamAttribKHR)
+#endif // defined(KHRONOS_SUPPORT_INT64)
+#endif // defined(EGL_KHR_stream)
+#if defined(EGL_KHR_stream_attrib)
+#if defined(KHRONOS_SUPPORT_INT64)
+GLATTER_IBLOCK(eglCreateStreamAttribKHR)
+GLATTER_IBLOCK(eglQueryStreamAttribKHR)
+GLATTER_IBLOCK(eglSetStreamAttribKHR)
+GLATTER_IBLOCK(eglStreamConsumerAcquireAttribKHR)
+GLATTER_IBLOCK(eglStreamConsumerReleaseAttribKHR)
+#endif // defined(KHRONOS_SUPPORT_INT64)
+#endif // defined(EGL_KHR_stream_attrib)
+#if defined(EGL_KHR_stream_consumer_gltexture)
+#if defined(EGL_KHR_stream)
+GLATTER_IBLOCK(eglStreamConsumerAcquireKHR)
+GLATTER_IBLOCK(eglStreamConsumerGLTextureExternalKHR)
+GLATTER_IBLOCK(eglStreamConsumerReleaseKHR)
+#endif // defined(EGL_KHR_stream)
+#endif // defined(EGL_KHR_stream_consumer_gltexture)
+#if defined(EGL_KHR_stream_cross_process_fd)
+#if defined(EGL_KHR_stream)
+GLATTER_IBLOCK(eglCreateStreamFromFileDescriptorKHR)
+GLATTER_IBLOCK(eglGetStreamFileDescriptorKHR)
+#endif // defined(EGL_KHR_stream)
+#endif // defined(EGL_KHR_stream_cross_process_fd)
+#if defined(EGL_KHR_stream_fifo)
+#if defined(EGL_KHR_stream)
+GLATTER_IBLOCK(eglQueryStreamTimeKHR)
+#endif // defined(EGL_KHR_stream)
+#endif // defined(EGL_KHR_stream_fifo)
+#if defined(EGL_KHR_stream_producer_eglsurface)
+#if defined(EGL_KHR_stream)
+GLATTER_IBLOCK(eglCreateStreamProducerSurfaceKHR)
+#endif // defined(EGL_KHR_stream)
+#endif // defined(EGL_KHR_stream_producer_eglsurface)
+#if defined(EGL_KHR_swap_buffers_with_damage)
+GLATTER_IBLOCK(eglSwapBuffersWithDamageKHR)
+#endif // defined(EGL_KHR_swap_buffers_with_damage)
+#if defined(EGL_KHR_wait_sync)
+GLATTER_IBLOCK(eglWaitSyncKHR)
+#endif // defined(EGL_KHR_wait_sync)
+#if defined(EGL_MESA_drm_image)
+GLATTER_IBLOCK(eglCreateDRMImageMESA)
+GLATTER_IBLOCK(eglExportDRMImageMESA)
+#endif // defined(EGL_MESA_drm_image)
+#if defined(EGL_MESA_image_dma_buf_export)
+GLATTER_IBLOCK(eglExportDMABUFImageMESA)
+GLATTER_IBLOCK(eglExportDMABUFImageQueryMESA)
+#endif // defined(EGL_MESA_image_dma_buf_export)
+#if defined(EGL_MESA_query_driver)
+GLATTER_IBLOCK(eglGetDisplayDriverConfig)
+GLATTER_IBLOCK(eglGetDisplayDriverName)
+#endif // defined(EGL_MESA_query_driver)
+#if defined(EGL_NOK_swap_region)
+GLATTER_IBLOCK(eglSwapBuffersRegionNOK)
+#endif // defined(EGL_NOK_swap_region)
+#if defined(EGL_NOK_swap_region2)
+GLATTER_IBLOCK(eglSwapBuffersRegion2NOK)
+#endif // defined(EGL_NOK_swap_region2)
+#if defined(EGL_NV_native_query)
+GLATTER_IBLOCK(eglQueryNativeDisplayNV)
+GLATTER_IBLOCK(eglQueryNativePixmapNV)
+GLATTER_IBLOCK(eglQueryNativeWindowNV)
+#endif // defined(EGL_NV_native_query)
+#if defined(EGL_NV_post_sub_buffer)
+GLATTER_IBLOCK(eglPostSubBufferNV)
+#endif // defined(EGL_NV_post_sub_buffer)
+#if defined(EGL_NV_stream_consumer_eglimage)
+GLATTER_IBLOCK(eglQueryStreamConsumerEventNV)
+GLATTER_IBLOCK(eglStreamAcquireImageNV)
+GLATTER_IBLOCK(eglStreamImageConsumerConnectNV)
+GLATTER_IBLOCK(eglStreamReleaseImageNV)
+#endif // defined(EGL_NV_stream_consumer_eglimage)
+#if defined(EGL_NV_stream_consumer_gltexture_yuv)
+GLATTER_IBLOCK(eglStreamConsumerGLTextureExternalAttribsNV)
+#endif // defined(EGL_NV_stream_consumer_gltexture_yuv)
+#if defined(EGL_NV_stream_flush)
+GLATTER_IBLOCK(eglStreamFlushNV)
+#endif // defined(EGL_NV_stream_flush)
+#if defined(EGL_NV_stream_metadata)
+GLATTER_IBLOCK(eglQueryDisplayAttribNV)
+GLATTER_IBLOCK(eglQueryStreamMetadataNV)
+GLATTER_IBLOCK(eglSetStreamMetadataNV)
+#endif // defined(EGL_NV_stream_metadata)
+#if defined(EGL_NV_stream_reset)
+GLATTER_IBLOCK(eglResetStreamNV)
+#endif // defined(EGL_NV_stream_reset)
+#if defined(EGL_NV_stream_sync)
+GLATTER_IBLOCK(eglCreateStreamSyncNV)
+#endif // defined(EGL_NV_stream_sync)
+#if defined(EGL_NV_sync)
+#if defined(KHRONOS_SUPPORT_INT64)
+GLATTER_IBLOCK(eglClientWaitSyncNV)
+GLATTER_IBLOCK(eglCreateFenceSyncNV)
+GLATTER_IBLOCK(eglDestroySyncNV)
+GLATTER_IBLOCK(eglFenceNV)
+GLATTER_IBLOCK(eglGetSyncAttribNV)
+GLATTER_IBLOCK(eglSignalSyncNV)
+#endif // defined(KHRONOS_SUPPORT_INT64)
+#endif // defined(EGL_NV_sync)
+#if defined(EGL_NV_system_time)
+#if defined(KHRONOS_SUPPORT_INT64)
+GLATTER_IBLOCK(eglGetSystemTimeFrequencyNV)
+GLATTER_IBLOCK(eglGetSystemTimeNV)
+#endif // defined(KHRONOS_SUPPORT_INT64)
+#endif // defined(EGL_NV_system_time)
+#if defined(EGL_WL_bind_wayland_display)
+GLATTER_IBLOCK(eglBindWaylandDisplayWL)
+GLATTER_IBLOCK(eglQueryWaylandBufferWL)
+GLATTER_IBLOCK(eglUnbindWaylandDisplayWL)
+#endif // defined(EGL_WL_bind_wayland_display)
+#if defined(EGL_WL_create_wayland_buffer_from_image)
+GLATTER_IBLOCK(eglCreateWaylandBufferFromImageWL)
+#endif // defined(__eglext_h_)
+#endif // defined(EGL_WL_create_wayland_buffer_from_image)
+#endif // GLATTER_EGL
+
@@ -27,1267 +27,1312 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#ifndef GLATTER_LOOKUP_SIZE
-#define GLATTER_LOOKUP_SIZE 0x4000
+/* Reads one bit of an extension support bitset. */
+#ifndef GLATTER_EXTENSION_SUPPORTED
+#define GLATTER_EXTENSION_SUPPORTED(status, index) \
+    ((int)(((status)->bits[(index) >> 5] >> ((index) & 31)) & 1u))
 #endif
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4201)
-#endif
+/* Bit positions in glatter_extension_support_status_GL_t::bits. */
+enum {
+    GLATTER_EXT_GL_3DFX_multisample = 0,
+    GLATTER_EXT_GL_3DFX_tbuffer = 1,
+    GLATTER_EXT_GL_3DFX_texture_compression_FXT1 = 2,
+    GLATTER_EXT_GL_AMD_blend_minmax_factor = 3,
+    GLATTER_EXT_GL_AMD_conservative_depth = 4,
+    GLATTER_EXT_GL_AMD_debug_output = 5,
+    GLATTER_EXT_GL_AMD_depth_clamp_separate = 6,
+    GLATTER_EXT_GL_AMD_draw_buffers_blend = 7,
+    GLATTER_EXT_GL_AMD_framebuffer_multisample_advanced = 8,
+    GLATTER_EXT_GL_AMD_framebuffer_sample_positions = 9,
+    GLATTER_EXT_GL_AMD_gcn_shader = 10,
+    GLATTER_EXT_GL_AMD_gpu_shader_half_float = 11,
+    GLATTER_EXT_GL_AMD_gpu_shader_int16 = 12,
+    GLATTER_EXT_GL_AMD_gpu_shader_int64 = 13,
+    GLATTER_EXT_GL_AMD_interleaved_elements = 14,
+    GLATTER_EXT_GL_AMD_multi_draw_indirect = 15,
+    GLATTER_EXT_GL_AMD_name_gen_delete = 16,
+    GLATTER_EXT_GL_AMD_occlusion_query_event = 17,
+    GLATTER_EXT_GL_AMD_performance_monitor = 18,
+    GLATTER_EXT_GL_AMD_pinned_memory = 19,
+    GLATTER_EXT_GL_AMD_query_buffer_object = 20,
+    GLATTER_EXT_GL_AMD_sample_positions = 21,
+    GLATTER_EXT_GL_AMD_seamless_cubemap_per_texture = 22,
+    GLATTER_EXT_GL_AMD_shader_atomic_counter_ops = 23,
+    GLATTER_EXT_GL_AMD_shader_ballot = 24,
+    GLATTER_EXT_GL_AMD_shader_explicit_vertex_parameter = 25,
+    GLATTER_EXT_GL_AMD_shader_gpu_shader_half_float_fetch = 26,
+    GLATTER_EXT_GL_AMD_shader_image_load_store_lod = 27,
+    GLATTER_EXT_GL_AMD_shader_stencil_export = 28,
+    GLATTER_EXT_GL_AMD_shader_trinary_minmax = 29,
+    GLATTER_EXT_GL_AMD_sparse_texture = 30,
+    GLATTER_EXT_GL_AMD_stencil_operation_extended = 31,
+    GLATTER_EXT_GL_AMD_texture_gather_bias_lod = 32,
+    GLATTER_EXT_GL_AMD_texture_texture4 = 33,
+    GLATTER_EXT_GL_AMD_transform_feedback3_lines_triangles = 34,
+    GLATTER_EXT_GL_AMD_transform_feedback4 = 35,
+    GLATTER_EXT_GL_AMD_vertex_shader_layer = 36,
+    GLATTER_EXT_GL_AMD_vertex_shader_tessellator = 37,
+    GLATTER_EXT_GL_AMD_vertex_shader_viewport_index = 38,
+    GLATTER_EXT_GL_APPLE_aux_depth_stencil = 39,
+    GLATTER_EXT_GL_APPLE_client_storage = 40,
+    GLATTER_EXT_GL_APPLE_element_array = 41,
+    GLATTER_EXT_GL_APPLE_fence = 42,
+    GLATTER_EXT_GL_APPLE_float_pixels = 43,
+    GLATTER_EXT_GL_APPLE_flush_buffer_range = 44,
+    GLATTER_EXT_GL_APPLE_object_purgeable = 45,
+    GLATTER_EXT_GL_APPLE_rgb_422 = 46,
+    GLATTER_EXT_GL_APPLE_row_bytes = 47,
+    GLATTER_EXT_GL_APPLE_specular_vector = 48,
+    GLATTER_EXT_GL_APPLE_texture_range = 49,
+    GLATTER_EXT_GL_APPLE_transform_hint = 50,
+    GLATTER_EXT_GL_APPLE_vertex_array_object = 51,
+    GLATTER_EXT_GL_APPLE_vertex_array_range = 52,
+    GLATTER_EXT_GL_APPLE_vertex_program_evaluators = 53,
+    GLATTER_EXT_GL_APPLE_ycbcr_422 = 54,
+    GLATTER_EXT_GL_ARB_ES2_compatibility = 55,
+    GLATTER_EXT_GL_ARB_ES3_1_compatibility = 56,
+    GLATTER_EXT_GL_ARB_ES3_2_compatibility = 57,
+    GLATTER_EXT_GL_ARB_ES3_compatibility = 58,
+    GLATTER_EXT_GL_ARB_arrays_of_arrays = 59,
+    GLATTER_EXT_GL_ARB_base_instance = 60,
+    GLATTER_EXT_GL_ARB_bindless_texture = 61,
+    GLATTER_EXT_GL_ARB_blend_func_extended = 62,
+    GLATTER_EXT_GL_ARB_buffer_storage = 63,
+    GLATTER_EXT_GL_ARB_cl_event = 64,
+    GLATTER_EXT_GL_ARB_clear_buffer_object = 65,
+    GLATTER_EXT_GL_ARB_clear_texture = 66,
+    GLATTER_EXT_GL_ARB_clip_control = 67,
+    GLATTER_EXT_GL_ARB_color_buffer_float = 68,
+    GLATTER_EXT_GL_ARB_compatibility = 69,
+    GLATTER_EXT_GL_ARB_compressed_texture_pixel_storage = 70,
+    GLATTER_EXT_GL_ARB_compute_shader = 71,
+    GLATTER_EXT_GL_ARB_compute_variable_group_size = 72,
+    GLATTER_EXT_GL_ARB_conditional_render_inverted = 73,
+    GLATTER_EXT_GL_ARB_conservative_depth = 74,
+    GLATTER_EXT_GL_ARB_copy_buffer = 75,
+    GLATTER_EXT_GL_ARB_copy_image = 76,
+    GLATTER_EXT_GL_ARB_cull_distance = 77,
+    GLATTER_EXT_GL_ARB_debug_output = 78,
+    GLATTER_EXT_GL_ARB_depth_buffer_float = 79,
+    GLATTER_EXT_GL_ARB_depth_clamp = 80,
+    GLATTER_EXT_GL_ARB_depth_texture = 81,
+    GLATTER_EXT_GL_ARB_derivative_control = 82,
+    GLATTER_EXT_GL_ARB_direct_state_access = 83,
+    GLATTER_EXT_GL_ARB_draw_buffers = 84,
+    GLATTER_EXT_GL_ARB_draw_buffers_blend = 85,
+    GLATTER_EXT_GL_ARB_draw_elements_base_vertex = 86,
+    GLATTER_EXT_GL_ARB_draw_indirect = 87,
+    GLATTER_EXT_GL_ARB_draw_instanced = 88,
+    GLATTER_EXT_GL_ARB_enhanced_layouts = 89,
+    GLATTER_EXT_GL_ARB_explicit_attrib_location = 90,
+    GLATTER_EXT_GL_ARB_explicit_uniform_location = 91,
+    GLATTER_EXT_GL_ARB_fragment_coord_conventions = 92,
+    GLATTER_EXT_GL_ARB_fragment_layer_viewport = 93,
+    GLATTER_EXT_GL_ARB_fragment_program = 94,
+    GLATTER_EXT_GL_ARB_fragment_program_shadow = 95,
+    GLATTER_EXT_GL_ARB_fragment_shader = 96,
+    GLATTER_EXT_GL_ARB_fragment_shader_interlock = 97,
+    GLATTER_EXT_GL_ARB_framebuffer_no_attachments = 98,
+    GLATTER_EXT_GL_ARB_framebuffer_object = 99,
+    GLATTER_EXT_GL_ARB_framebuffer_sRGB = 100,
+    GLATTER_EXT_GL_ARB_geometry_shader4 = 101,
+    GLATTER_EXT_GL_ARB_get_program_binary = 102,
+    GLATTER_EXT_GL_ARB_get_texture_sub_image = 103,
+    GLATTER_EXT_GL_ARB_gl_spirv = 104,
+    GLATTER_EXT_GL_ARB_gpu_shader5 = 105,
+    GLATTER_EXT_GL_ARB_gpu_shader_fp64 = 106,
+    GLATTER_EXT_GL_ARB_gpu_shader_int64 = 107,
+    GLATTER_EXT_GL_ARB_half_float_pixel = 108,
+    GLATTER_EXT_GL_ARB_half_float_vertex = 109,
+    GLATTER_EXT_GL_ARB_imaging = 110,
+    GLATTER_EXT_GL_ARB_indirect_parameters = 111,
+    GLATTER_EXT_GL_ARB_instanced_arrays = 112,
+    GLATTER_EXT_GL_ARB_internalformat_query = 113,
+    GLATTER_EXT_GL_ARB_internalformat_query2 = 114,
+    GLATTER_EXT_GL_ARB_invalidate_subdata = 115,
+    GLATTER_EXT_GL_ARB_map_buffer_alignment = 116,
+    GLATTER_EXT_GL_ARB_map_buffer_range = 117,
+    GLATTER_EXT_GL_ARB_matrix_palette = 118,
+    GLATTER_EXT_GL_ARB_multi_bind = 119,
+    GLATTER_EXT_GL_ARB_multi_draw_indirect = 120,
+    GLATTER_EXT_GL_ARB_multisample = 121,
+    GLATTER_EXT_GL_ARB_multitexture = 122,
+    GLATTER_EXT_GL_ARB_occlusion_query = 123,
+    GLATTER_EXT_GL_ARB_occlusion_query2 = 124,
+    GLATTER_EXT_GL_ARB_parallel_shader_compile = 125,
+    GLATTER_EXT_GL_ARB_pipeline_statistics_query = 126,
+    GLATTER_EXT_GL_ARB_pixel_buffer_object = 127,
+    GLATTER_EXT_GL_ARB_point_parameters = 128,
+    GLATTER_EXT_GL_ARB_point_sprite = 129,
+    GLATTER_EXT_GL_ARB_polygon_offset_clamp = 130,
+    GLATTER_EXT_GL_ARB_post_depth_coverage = 131,
+    GLATTER_EXT_GL_ARB_program_interface_query = 132,
+    GLATTER_EXT_GL_ARB_provoking_vertex = 133,
+    GLATTER_EXT_GL_ARB_query_buffer_object = 134,
+    GLATTER_EXT_GL_ARB_robust_buffer_access_behavior = 135,
+    GLATTER_EXT_GL_ARB_robustness = 136,
+    GLATTER_EXT_GL_ARB_robustness_isolation = 137,
+    GLATTER_EXT_GL_ARB_sample_locations = 138,
+    GLATTER_EXT_GL_ARB_sample_shading = 139,
+    GLATTER_EXT_GL_ARB_sampler_objects = 140,
+    GLATTER_EXT_GL_ARB_seamless_cube_map = 141,
+    GLATTER_EXT_GL_ARB_seamless_cubemap_per_texture = 142,
+    GLATTER_EXT_GL_ARB_separate_shader_objects = 143,
+    GLATTER_EXT_GL_ARB_shader_atomic_counter_ops = 144,
+    GLATTER_EXT_GL_ARB_shader_atomic_counters = 145,
+    GLATTER_EXT_GL_ARB_shader_ballot = 146,
+    GLATTER_EXT_GL_ARB_shader_bit_encoding = 147,
+    GLATTER_EXT_GL_ARB_shader_clock = 148,
+    GLATTER_EXT_GL_ARB_shader_draw_parameters = 149,
+    GLATTER_EXT_GL_ARB_shader_group_vote = 150,
+    GLATTER_EXT_GL_ARB_shader_image_load_store = 151,
+    GLATTER_EXT_GL_ARB_shader_image_size = 152,
+    GLATTER_EXT_GL_ARB_shader_objects = 153,
+    GLATTER_EXT_GL_ARB_shader_precision = 154,
+    GLATTER_EXT_GL_ARB_shader_stencil_export = 155,
+    GLATTER_EXT_GL_ARB_shader_storage_buffer_object = 156,
+    GLATTER_EXT_GL_ARB_shader_subroutine = 157,
+    GLATTER_EXT_GL_ARB_shader_texture_image_samples = 158,
+    GLATTER_EXT_GL_ARB_shader_texture_lod = 159,
+    GLATTER_EXT_GL_ARB_shader_viewport_layer_array = 160,
+    GLATTER_EXT_GL_ARB_shading_language_100 = 161,
+    GLATTER_EXT_GL_ARB_shading_language_420pack = 162,
+    GLATTER_EXT_GL_ARB_shading_language_include = 163,
+    GLATTER_EXT_GL_ARB_shading_language_packing = 164,
+    GLATTER_EXT_GL_ARB_shadow = 165,
+    GLATTER_EXT_GL_ARB_shadow_ambient = 166,
+    GLATTER_EXT_GL_ARB_sparse_buffer = 167,
+    GLATTER_EXT_GL_ARB_sparse_texture = 168,
+    GLATTER_EXT_GL_ARB_sparse_texture2 = 169,
+    GLATTER_EXT_GL_ARB_sparse_texture_clamp = 170,
+    GLATTER_EXT_GL_ARB_spirv_extensions = 171,
+    GLATTER_EXT_GL_ARB_stencil_texturing = 172,
+    GLATTER_EXT_GL_ARB_sync = 173,
+    GLATTER_EXT_GL_ARB_tessellation_shader = 174,
+    GLATTER_EXT_GL_ARB_texture_barrier = 175,
+    GLATTER_EXT_GL_ARB_texture_border_clamp = 176,
+    GLATTER_EXT_GL_ARB_texture_buffer_object = 177,
+    GLATTER_EXT_GL_ARB_texture_buffer_object_rgb32 = 178,
+    GLATTER_EXT_GL_ARB_texture_buffer_range = 179,
+    GLATTER_EXT_GL_ARB_texture_compression = 180,
+    GLATTER_EXT_GL_ARB_texture_compression_bptc = 181,
+    GLATTER_EXT_GL_ARB_texture_compression_rgtc = 182,
+    GLATTER_EXT_GL_ARB_texture_cube_map = 183,
+    GLATTER_EXT_GL_ARB_texture_cube_map_array = 184,
+    GLATTER_EXT_GL_ARB_texture_env_add = 185,
+    GLATTER_EXT_GL_ARB_texture_env_combine = 186,
+    GLATTER_EXT_GL_ARB_texture_env_crossbar = 187,
+    GLATTER_EXT_GL_ARB_texture_env_dot3 = 188,
+    GLATTER_EXT_GL_ARB_texture_filter_anisotropic = 189,
+    GLATTER_EXT_GL_ARB_texture_filter_minmax = 190,
+    GLATTER_EXT_GL_ARB_texture_float = 191,
+    GLATTER_EXT_GL_ARB_texture_gather = 192,
+    GLATTER_EXT_GL_ARB_texture_mirror_clamp_to_edge = 193,
+    GLATTER_EXT_GL_ARB_texture_mirrored_repeat = 194,
+    GLATTER_EXT_GL_ARB_texture_multisample = 195,
+    GLATTER_EXT_GL_ARB_texture_non_power_of_two = 196,
+    GLATTER_EXT_GL_ARB_texture_query_levels = 197,
+    GLATTER_EXT_GL_ARB_texture_query_lod = 198,
+    GLATTER_EXT_GL_ARB_texture_rectangle = 199,
+    GLATTER_EXT_GL_ARB_texture_rg = 200,
+    GLATTER_EXT_GL_ARB_texture_rgb10_a2ui = 201,
+    GLATTER_EXT_GL_ARB_texture_stencil8 = 202,
+    GLATTER_EXT_GL_ARB_texture_storage = 203,
+    GLATTER_EXT_GL_ARB_texture_storage_multisample = 204,
+    GLATTER_EXT_GL_ARB_texture_swizzle = 205,
+    GLATTER_EXT_GL_ARB_texture_view = 206,
+    GLATTER_EXT_GL_ARB_timer_query = 207,
+    GLATTER_EXT_GL_ARB_transform_feedback2 = 208,
+    GLATTER_EXT_GL_ARB_transform_feedback3 = 209,
+    GLATTER_EXT_GL_ARB_transform_feedback_instanced = 210,
+    GLATTER_EXT_GL_ARB_transform_feedback_overflow_query = 211,
+    GLATTER_EXT_GL_ARB_transpose_matrix = 212,
+    GLATTER_EXT_GL_ARB_uniform_buffer_object = 213,
+    GLATTER_EXT_GL_ARB_vertex_array_bgra = 214,
+    GLATTER_EXT_GL_ARB_vertex_array_object = 215,
+    GLATTER_EXT_GL_ARB_vertex_attrib_64bit = 216,
+    GLATTER_EXT_GL_ARB_vertex_attrib_binding = 217,
+    GLATTER_EXT_GL_ARB_vertex_blend = 218,
+    GLATTER_EXT_GL_ARB_vertex_buffer_object = 219,
+    GLATTER_EXT_GL_ARB_vertex_program = 220,
+    GLATTER_EXT_GL_ARB_vertex_shader = 221,
+    GLATTER_EXT_GL_ARB_vertex_type_10f_11f_11f_rev = 222,
+    GLATTER_EXT_GL_ARB_vertex_type_2_10_10_10_rev = 223,
+    GLATTER_EXT_GL_ARB_viewport_array = 224,
+    GLATTER_EXT_GL_ARB_window_pos = 225,
+    GLATTER_EXT_GL_ATI_draw_buffers = 226,
+    GLATTER_EXT_GL_ATI_element_array = 227,
+    GLATTER_EXT_GL_ATI_envmap_bumpmap = 228,
+    GLATTER_EXT_GL_ATI_fragment_shader = 229,
+    GLATTER_EXT_GL_ATI_map_object_buffer = 230,
+    GLATTER_EXT_GL_ATI_meminfo = 231,
+    GLATTER_EXT_GL_ATI_pixel_format_float = 232,
+    GLATTER_EXT_GL_ATI_pn_triangles = 233,
+    GLATTER_EXT_GL_ATI_separate_stencil = 234,
+    GLATTER_EXT_GL_ATI_text_fragment_shader = 235,
+    GLATTER_EXT_GL_ATI_texture_env_combine3 = 236,
+    GLATTER_EXT_GL_ATI_texture_float = 237,
+    GLATTER_EXT_GL_ATI_texture_mirror_once = 238,
+    GLATTER_EXT_GL_ATI_vertex_array_object = 239,
+    GLATTER_EXT_GL_ATI_vertex_attrib_array_object = 240,
+    GLATTER_EXT_GL_ATI_vertex_streams = 241,
+    GLATTER_EXT_GL_EXT_422_pixels = 242,
+    GLATTER_EXT_GL_EXT_EGL_image_storage = 243,
+    GLATTER_EXT_GL_EXT_EGL_sync = 244,
+    GLATTER_EXT_GL_EXT_abgr = 245,
+    GLATTER_EXT_GL_EXT_bgra = 246,
+    GLATTER_EXT_GL_EXT_bindable_uniform = 247,
+    GLATTER_EXT_GL_EXT_blend_color = 248,
+    GLATTER_EXT_GL_EXT_blend_equation_separate = 249,
+    GLATTER_EXT_GL_EXT_blend_func_separate = 250,
+    GLATTER_EXT_GL_EXT_blend_logic_op = 251,
+    GLATTER_EXT_GL_EXT_blend_minmax = 252,
+    GLATTER_EXT_GL_EXT_blend_subtract = 253,
+    GLATTER_EXT_GL_EXT_clip_volume_hint = 254,
+    GLATTER_EXT_GL_EXT_cmyka = 255,
+    GLATTER_EXT_GL_EXT_color_subtable = 256,
+    GLATTER_EXT_GL_EXT_compiled_vertex_array = 257,
+    GLATTER_EXT_GL_EXT_convolution = 258,
+    GLATTER_EXT_GL_EXT_coordinate_frame = 259,
+    GLATTER_EXT_GL_EXT_copy_texture = 260,
+    GLATTER_EXT_GL_EXT_cull_vertex = 261,
+    GLATTER_EXT_GL_EXT_debug_label = 262,
+    GLATTER_EXT_GL_EXT_debug_marker = 263,
+    GLATTER_EXT_GL_EXT_depth_bounds_test = 264,
+    GLATTER_EXT_GL_EXT_direct_state_access = 265,
+    GLATTER_EXT_GL_EXT_draw_buffers2 = 266,
+    GLATTER_EXT_GL_EXT_draw_instanced = 267,
+    GLATTER_EXT_GL_EXT_draw_range_elements = 268,
+    GLATTER_EXT_GL_EXT_external_buffer = 269,
+    GLATTER_EXT_GL_EXT_fog_coord = 270,
+    GLATTER_EXT_GL_EXT_fragment_shading_rate = 271,
+    GLATTER_EXT_GL_EXT_framebuffer_blit = 272,
+    GLATTER_EXT_GL_EXT_framebuffer_blit_layers = 273,
+    GLATTER_EXT_GL_EXT_framebuffer_multisample = 274,
+    GLATTER_EXT_GL_EXT_framebuffer_multisample_blit_scaled = 275,
+    GLATTER_EXT_GL_EXT_framebuffer_object = 276,
+    GLATTER_EXT_GL_EXT_framebuffer_sRGB = 277,
+    GLATTER_EXT_GL_EXT_geometry_shader4 = 278,
+    GLATTER_EXT_GL_EXT_gpu_program_parameters = 279,
+    GLATTER_EXT_GL_EXT_gpu_shader4 = 280,
+    GLATTER_EXT_GL_EXT_histogram = 281,
+    GLATTER_EXT_GL_EXT_index_array_formats = 282,
+    GLATTER_EXT_GL_EXT_index_func = 283,
+    GLATTER_EXT_GL_EXT_index_material = 284,
+    GLATTER_EXT_GL_EXT_index_texture = 285,
+    GLATTER_EXT_GL_EXT_light_texture = 286,
+    GLATTER_EXT_GL_EXT_memory_object = 287,
+    GLATTER_EXT_GL_EXT_memory_object_fd = 288,
+    GLATTER_EXT_GL_EXT_memory_object_win32 = 289,
+    GLATTER_EXT_GL_EXT_mesh_shader = 290,
+    GLATTER_EXT_GL_EXT_misc_attribute = 291,
+    GLATTER_EXT_GL_EXT_multi_draw_arrays = 292,
+    GLATTER_EXT_GL_EXT_multisample = 293,
+    GLATTER_EXT_GL_EXT_multiview_tessellation_geometry_shader = 294,
+    GLATTER_EXT_GL_EXT_multiview_texture_multisample = 295,
+    GLATTER_EXT_GL_EXT_multiview_timer_query = 296,
+    GLATTER_EXT_GL_EXT_packed_depth_stencil = 297,
+    GLATTER_EXT_GL_EXT_packed_float = 298,
+    GLATTER_EXT_GL_EXT_packed_pixels = 299,
+    GLATTER_EXT_GL_EXT_paletted_texture = 300,
+    GLATTER_EXT_GL_EXT_pixel_buffer_object = 301,
+    GLATTER_EXT_GL_EXT_pixel_transform = 302,
+    GLATTER_EXT_GL_EXT_pixel_transform_color_table = 303,
+    GLATTER_EXT_GL_EXT_point_parameters = 304,
+    GLATTER_EXT_GL_EXT_polygon_offset = 305,
+    GLATTER_EXT_GL_EXT_polygon_offset_clamp = 306,
+    GLATTER_EXT_GL_EXT_post_depth_coverage = 307,
+    GLATTER_EXT_GL_EXT_provoking_vertex = 308,
+    GLATTER_EXT_GL_EXT_raster_multisample = 309,
+    GLATTER_EXT_GL_EXT_rescale_normal = 310,
+    GLATTER_EXT_GL_EXT_secondary_color = 311,
+    GLATTER_EXT_GL_EXT_semaphore = 312,
+    GLATTER_EXT_GL_EXT_semaphore_fd = 313,
+    GLATTER_EXT_GL_EXT_semaphore_win32 = 314,
+    GLATTER_EXT_GL_EXT_separate_shader_objects = 315,
+    GLATTER_EXT_GL_EXT_separate_specular_color = 316,
+    GLATTER_EXT_GL_EXT_shader_framebuffer_fetch = 317,
+    GLATTER_EXT_GL_EXT_shader_framebuffer_fetch_non_coherent = 318,
+    GLATTER_EXT_GL_EXT_shader_image_load_formatted = 319,
+    GLATTER_EXT_GL_EXT_shader_image_load_store = 320,
+    GLATTER_EXT_GL_EXT_shader_integer_mix = 321,
+    GLATTER_EXT_GL_EXT_shader_samples_identical = 322,
+    GLATTER_EXT_GL_EXT_shadow_funcs = 323,
+    GLATTER_EXT_GL_EXT_shared_texture_palette = 324,
+    GLATTER_EXT_GL_EXT_sparse_texture2 = 325,
+    GLATTER_EXT_GL_EXT_stencil_clear_tag = 326,
+    GLATTER_EXT_GL_EXT_stencil_two_side = 327,
+    GLATTER_EXT_GL_EXT_stencil_wrap = 328,
+    GLATTER_EXT_GL_EXT_subtexture = 329,
+    GLATTER_EXT_GL_EXT_texture = 330,
+    GLATTER_EXT_GL_EXT_texture3D = 331,
+    GLATTER_EXT_GL_EXT_texture_array = 332,
+    GLATTER_EXT_GL_EXT_texture_buffer_object = 333,
+    GLATTER_EXT_GL_EXT_texture_compression_latc = 334,
+    GLATTER_EXT_GL_EXT_texture_compression_rgtc = 335,
+    GLATTER_EXT_GL_EXT_texture_compression_s3tc = 336,
+    GLATTER_EXT_GL_EXT_texture_cube_map = 337,
+    GLATTER_EXT_GL_EXT_texture_env_add = 338,
+    GLATTER_EXT_GL_EXT_texture_env_combine = 339,
+    GLATTER_EXT_GL_EXT_texture_env_dot3 = 340,
+    GLATTER_EXT_GL_EXT_texture_filter_anisotropic = 341,
+    GLATTER_EXT_GL_EXT_texture_filter_minmax = 342,
+    GLATTER_EXT_GL_EXT_texture_integer = 343,
+    GLATTER_EXT_GL_EXT_texture_lod_bias = 344,
+    GLATTER_EXT_GL_EXT_texture_mirror_clamp = 345,
+    GLATTER_EXT_GL_EXT_texture_object = 346,
+    GLATTER_EXT_GL_EXT_texture_perturb_normal = 347,
+    GLATTER_EXT_GL_EXT_texture_sRGB = 348,
+    GLATTER_EXT_GL_EXT_texture_sRGB_R8 = 349,
+    GLATTER_EXT_GL_EXT_texture_sRGB_RG8 = 350,
+    GLATTER_EXT_GL_EXT_texture_sRGB_decode = 351,
+    GLATTER_EXT_GL_EXT_texture_shadow_lod = 352,
+    GLATTER_EXT_GL_EXT_texture_shared_exponent = 353,
+    GLATTER_EXT_GL_EXT_texture_snorm = 354,
+    GLATTER_EXT_GL_EXT_texture_storage = 355,
+    GLATTER_EXT_GL_EXT_texture_swizzle = 356,
+    GLATTER_EXT_GL_EXT_timer_query = 357,
+    GLATTER_EXT_GL_EXT_transform_feedback = 358,
+    GLATTER_EXT_GL_EXT_vertex_array = 359,
+    GLATTER_EXT_GL_EXT_vertex_array_bgra = 360,
+    GLATTER_EXT_GL_EXT_vertex_attrib_64bit = 361,
+    GLATTER_EXT_GL_EXT_vertex_shader = 362,
+    GLATTER_EXT_GL_EXT_vertex_weighting = 363,
+    GLATTER_EXT_GL_EXT_win32_keyed_mutex = 364,
+    GLATTER_EXT_GL_EXT_window_rectangles = 365,
+    GLATTER_EXT_GL_EXT_x11_sync_object = 366,
+    GLATTER_EXT_GL_GREMEDY_frame_terminator = 367,
+    GLATTER_EXT_GL_GREMEDY_string_marker = 368,
+    GLATTER_EXT_GL_HP_convolution_border_modes = 369,
+    GLATTER_EXT_GL_HP_image_transform = 370,
+    GLATTER_EXT_GL_HP_occlusion_test = 371,
+    GLATTER_EXT_GL_HP_texture_lighting = 372,
+    GLATTER_EXT_GL_IBM_cull_vertex = 373,
+    GLATTER_EXT_GL_IBM_multimode_draw_arrays = 374,
+    GLATTER_EXT_GL_IBM_rasterpos_clip = 375,
+    GLATTER_EXT_GL_IBM_static_data = 376,
+    GLATTER_EXT_GL_IBM_texture_mirrored_repeat = 377,
+    GLATTER_EXT_GL_IBM_vertex_array_lists = 378,
+    GLATTER_EXT_GL_INGR_blend_func_separate = 379,
+    GLATTER_EXT_GL_INGR_color_clamp = 380,
+    GLATTER_EXT_GL_INGR_interlace_read = 381,
+    GLATTER_EXT_GL_INTEL_blackhole_render = 382,
+    GLATTER_EXT_GL_INTEL_conservative_rasterization = 383,
+    GLATTER_EXT_GL_INTEL_fragment_shader_ordering = 384,
+    GLATTER_EXT_GL_INTEL_framebuffer_CMAA = 385,
+    GLATTER_EXT_GL_INTEL_map_texture = 386,
+    GLATTER_EXT_GL_INTEL_parallel_arrays = 387,
+    GLATTER_EXT_GL_INTEL_performance_query = 388,
+    GLATTER_EXT_GL_KHR_blend_equation_advanced = 389,
+    GLATTER_EXT_GL_KHR_blend_equation_advanced_coherent = 390,
+    GLATTER_EXT_GL_KHR_context_flush_control = 391,
+    GLATTER_EXT_GL_KHR_debug = 392,
+    GLATTER_EXT_GL_KHR_no_error = 393,
+    GLATTER_EXT_GL_KHR_parallel_shader_compile = 394,
+    GLATTER_EXT_GL_KHR_robust_buffer_access_behavior = 395,
+    GLATTER_EXT_GL_KHR_robustness = 396,
+    GLATTER_EXT_GL_KHR_shader_subgroup = 397,
+    GLATTER_EXT_GL_KHR_texture_compression_astc_hdr = 398,
+    GLATTER_EXT_GL_KHR_texture_compression_astc_ldr = 399,
+    GLATTER_EXT_GL_KHR_texture_compression_astc_sliced_3d = 400,
+    GLATTER_EXT_GL_MESAX_texture_stack = 401,
+    GLATTER_EXT_GL_MESA_framebuffer_flip_x = 402,
+    GLATTER_EXT_GL_MESA_framebuffer_flip_y = 403,
+    GLATTER_EXT_GL_MESA_framebuffer_swap_xy = 404,
+    GLATTER_EXT_GL_MESA_pack_invert = 405,
+    GLATTER_EXT_GL_MESA_program_binary_formats = 406,
+    GLATTER_EXT_GL_MESA_resize_buffers = 407,
+    GLATTER_EXT_GL_MESA_shader_integer_functions = 408,
+    GLATTER_EXT_GL_MESA_texture_const_bandwidth = 409,
+    GLATTER_EXT_GL_MESA_tile_raster_order = 410,
+    GLATTER_EXT_GL_MESA_window_pos = 411,
+    GLATTER_EXT_GL_MESA_ycbcr_texture = 412,
+    GLATTER_EXT_GL_NVX_blend_equation_advanced_multi_draw_buffers = 413,
+    GLATTER_EXT_GL_NVX_conditional_render = 414,
+    GLATTER_EXT_GL_NVX_gpu_memory_info = 415,
+    GLATTER_EXT_GL_NVX_gpu_multicast2 = 416,
+    GLATTER_EXT_GL_NVX_linked_gpu_multicast = 417,
+    GLATTER_EXT_GL_NVX_progress_fence = 418,
+    GLATTER_EXT_GL_NV_alpha_to_coverage_dither_control = 419,
+    GLATTER_EXT_GL_NV_bindless_multi_draw_indirect = 420,
+    GLATTER_EXT_GL_NV_bindless_multi_draw_indirect_count = 421,
+    GLATTER_EXT_GL_NV_bindless_texture = 422,
+    GLATTER_EXT_GL_NV_blend_equation_advanced = 423,
+    GLATTER_EXT_GL_NV_blend_equation_advanced_coherent = 424,
+    GLATTER_EXT_GL_NV_blend_minmax_factor = 425,
+    GLATTER_EXT_GL_NV_blend_square = 426,
+    GLATTER_EXT_GL_NV_clip_space_w_scaling = 427,
+    GLATTER_EXT_GL_NV_command_list = 428,
+    GLATTER_EXT_GL_NV_compute_program5 = 429,
+    GLATTER_EXT_GL_NV_compute_shader_derivatives = 430,
+    GLATTER_EXT_GL_NV_conditional_render = 431,
+    GLATTER_EXT_GL_NV_conservative_raster = 432,
+    GLATTER_EXT_GL_NV_conservative_raster_dilate = 433,
+    GLATTER_EXT_GL_NV_conservative_raster_pre_snap = 434,
+    GLATTER_EXT_GL_NV_conservative_raster_pre_snap_triangles = 435,
+    GLATTER_EXT_GL_NV_conservative_raster_underestimation = 436,
+    GLATTER_EXT_GL_NV_copy_depth_to_color = 437,
+    GLATTER_EXT_GL_NV_copy_image = 438,
+    GLATTER_EXT_GL_NV_deep_texture3D = 439,
+    GLATTER_EXT_GL_NV_depth_buffer_float = 440,
+    GLATTER_EXT_GL_NV_depth_clamp = 441,
+    GLATTER_EXT_GL_NV_draw_texture = 442,
+    GLATTER_EXT_GL_NV_draw_vulkan_image = 443,
+    GLATTER_EXT_GL_NV_evaluators = 444,
+    GLATTER_EXT_GL_NV_explicit_multisample = 445,
+    GLATTER_EXT_GL_NV_fence = 446,
+    GLATTER_EXT_GL_NV_fill_rectangle = 447,
+    GLATTER_EXT_GL_NV_float_buffer = 448,
+    GLATTER_EXT_GL_NV_fog_distance = 449,
+    GLATTER_EXT_GL_NV_fragment_coverage_to_color = 450,
+    GLATTER_EXT_GL_NV_fragment_program = 451,
+    GLATTER_EXT_GL_NV_fragment_program2 = 452,
+    GLATTER_EXT_GL_NV_fragment_program4 = 453,
+    GLATTER_EXT_GL_NV_fragment_program_option = 454,
+    GLATTER_EXT_GL_NV_fragment_shader_barycentric = 455,
+    GLATTER_EXT_GL_NV_fragment_shader_interlock = 456,
+    GLATTER_EXT_GL_NV_framebuffer_mixed_samples = 457,
+    GLATTER_EXT_GL_NV_framebuffer_multisample_coverage = 458,
+    GLATTER_EXT_GL_NV_geometry_program4 = 459,
+    GLATTER_EXT_GL_NV_geometry_shader4 = 460,
+    GLATTER_EXT_GL_NV_geometry_shader_passthrough = 461,
+    GLATTER_EXT_GL_NV_gpu_multicast = 462,
+    GLATTER_EXT_GL_NV_gpu_program4 = 463,
+    GLATTER_EXT_GL_NV_gpu_program5 = 464,
+    GLATTER_EXT_GL_NV_gpu_program5_mem_extended = 465,
+    GLATTER_EXT_GL_NV_gpu_shader5 = 466,
+    GLATTER_EXT_GL_NV_half_float = 467,
+    GLATTER_EXT_GL_NV_internalformat_sample_query = 468,
+    GLATTER_EXT_GL_NV_light_max_exponent = 469,
+    GLATTER_EXT_GL_NV_memory_attachment = 470,
+    GLATTER_EXT_GL_NV_memory_object_sparse = 471,
+    GLATTER_EXT_GL_NV_mesh_shader = 472,
+    GLATTER_EXT_GL_NV_multisample_coverage = 473,
+    GLATTER_EXT_GL_NV_multisample_filter_hint = 474,
+    GLATTER_EXT_GL_NV_occlusion_query = 475,
+    GLATTER_EXT_GL_NV_packed_depth_stencil = 476,
+    GLATTER_EXT_GL_NV_parameter_buffer_object = 477,
+    GLATTER_EXT_GL_NV_parameter_buffer_object2 = 478,
+    GLATTER_EXT_GL_NV_path_rendering = 479,
+    GLATTER_EXT_GL_NV_path_rendering_shared_edge = 480,
+    GLATTER_EXT_GL_NV_pixel_data_range = 481,
+    GLATTER_EXT_GL_NV_point_sprite = 482,
+    GLATTER_EXT_GL_NV_present_video = 483,
+    GLATTER_EXT_GL_NV_primitive_restart = 484,
+    GLATTER_EXT_GL_NV_primitive_shading_rate = 485,
+    GLATTER_EXT_GL_NV_query_resource = 486,
+    GLATTER_EXT_GL_NV_query_resource_tag = 487,
+    GLATTER_EXT_GL_NV_register_combiners = 488,
+    GLATTER_EXT_GL_NV_register_combiners2 = 489,
+    GLATTER_EXT_GL_NV_representative_fragment_test = 490,
+    GLATTER_EXT_GL_NV_robustness_video_memory_purge = 491,
+    GLATTER_EXT_GL_NV_sample_locations = 492,
+    GLATTER_EXT_GL_NV_sample_mask_override_coverage = 493,
+    GLATTER_EXT_GL_NV_scissor_exclusive = 494,
+    GLATTER_EXT_GL_NV_shader_atomic_counters = 495,
+    GLATTER_EXT_GL_NV_shader_atomic_float = 496,
+    GLATTER_EXT_GL_NV_shader_atomic_float64 = 497,
+    GLATTER_EXT_GL_NV_shader_atomic_fp16_vector = 498,
+    GLATTER_EXT_GL_NV_shader_atomic_int64 = 499,
+    GLATTER_EXT_GL_NV_shader_buffer_load = 500,
+    GLATTER_EXT_GL_NV_shader_buffer_store = 501,
+    GLATTER_EXT_GL_NV_shader_storage_buffer_object = 502,
+    GLATTER_EXT_GL_NV_shader_subgroup_partitioned = 503,
+    GLATTER_EXT_GL_NV_shader_texture_footprint = 504,
+    GLATTER_EXT_GL_NV_shader_thread_group = 505,
+    GLATTER_EXT_GL_NV_shader_thread_shuffle = 506,
+    GLATTER_EXT_GL_NV_shading_rate_image = 507,
+    GLATTER_EXT_GL_NV_stereo_view_rendering = 508,
+    GLATTER_EXT_GL_NV_tessellation_program5 = 509,
+    GLATTER_EXT_GL_NV_texgen_emboss = 510,
+    GLATTER_EXT_GL_NV_texgen_reflection = 511,
+    GLATTER_EXT_GL_NV_texture_barrier = 512,
+    GLATTER_EXT_GL_NV_texture_compression_vtc = 513,
+    GLATTER_EXT_GL_NV_texture_env_combine4 = 514,
+    GLATTER_EXT_GL_NV_texture_expand_normal = 515,
+    GLATTER_EXT_GL_NV_texture_multisample = 516,
+    GLATTER_EXT_GL_NV_texture_rectangle = 517,
+    GLATTER_EXT_GL_NV_texture_rectangle_compressed = 518,
+    GLATTER_EXT_GL_NV_texture_shader = 519,
+    GLATTER_EXT_GL_NV_texture_shader2 = 520,
+    GLATTER_EXT_GL_NV_texture_shader3 = 521,
+    GLATTER_EXT_GL_NV_timeline_semaphore = 522,
+    GLATTER_EXT_GL_NV_transform_feedback = 523,
+    GLATTER_EXT_GL_NV_transform_feedback2 = 524,
+    GLATTER_EXT_GL_NV_uniform_buffer_std430_layout = 525,
+    GLATTER_EXT_GL_NV_uniform_buffer_unified_memory = 526,
+    GLATTER_EXT_GL_NV_vdpau_interop = 527,
+    GLATTER_EXT_GL_NV_vdpau_interop2 = 528,
+    GLATTER_EXT_GL_NV_vertex_array_range = 529,
+    GLATTER_EXT_GL_NV_vertex_array_range2 = 530,
+    GLATTER_EXT_GL_NV_vertex_attrib_integer_64bit = 531,
+    GLATTER_EXT_GL_NV_vertex_buffer_unified_memory = 532,
+    GLATTER_EXT_GL_NV_vertex_program = 533,
+    GLATTER_EXT_GL_NV_vertex_program1_1 = 534,
+    GLATTER_EXT_GL_NV_vertex_program2 = 535,
+    GLATTER_EXT_GL_NV_vertex_program2_option = 536,
+    GLATTER_EXT_GL_NV_vertex_program3 = 537,
+    GLATTER_EXT_GL_NV_vertex_program4 = 538,
+    GLATTER_EXT_GL_NV_video_capture = 539,
+    GLATTER_EXT_GL_NV_viewport_array2 = 540,
+    GLATTER_EXT_GL_NV_viewport_swizzle = 541,
+    GLATTER_EXT_GL_OES_byte_coordinates = 542,
+    GLATTER_EXT_GL_OES_compressed_paletted_texture = 543,
+    GLATTER_EXT_GL_OES_fixed_point = 544,
+    GLATTER_EXT_GL_OES_query_matrix = 545,
+    GLATTER_EXT_GL_OES_read_format = 546,
+    GLATTER_EXT_GL_OES_single_precision = 547,
+    GLATTER_EXT_GL_OML_interlace = 548,
+    GLATTER_EXT_GL_OML_resample = 549,
+    GLATTER_EXT_GL_OML_subsample = 550,
+    GLATTER_EXT_GL_OVR_multiview = 551,
+    GLATTER_EXT_GL_OVR_multiview2 = 552,
+    GLATTER_EXT_GL_PGI_misc_hints = 553,
+    GLATTER_EXT_GL_PGI_vertex_hints = 554,
+    GLATTER_EXT_GL_REND_screen_coordinates = 555,
+    GLATTER_EXT_GL_S3_s3tc = 556,
+    GLATTER_EXT_GL_SGIS_detail_texture = 557,
+    GLATTER_EXT_GL_SGIS_fog_function = 558,
+    GLATTER_EXT_GL_SGIS_generate_mipmap = 559,
+    GLATTER_EXT_GL_SGIS_multisample = 560,
+    GLATTER_EXT_GL_SGIS_pixel_texture = 561,
+    GLATTER_EXT_GL_SGIS_point_line_texgen = 562,
+    GLATTER_EXT_GL_SGIS_point_parameters = 563,
+    GLATTER_EXT_GL_SGIS_sharpen_texture = 564,
+    GLATTER_EXT_GL_SGIS_texture4D = 565,
+    GLATTER_EXT_GL_SGIS_texture_border_clamp = 566,
+    GLATTER_EXT_GL_SGIS_texture_color_mask = 567,
+    GLATTER_EXT_GL_SGIS_texture_edge_clamp = 568,
+    GLATTER_EXT_GL_SGIS_texture_filter4 = 569,
+    GLATTER_EXT_GL_SGIS_texture_lod = 570,
+    GLATTER_EXT_GL_SGIS_texture_select = 571,
+    GLATTER_EXT_GL_SGIX_async = 572,
+    GLATTER_EXT_GL_SGIX_async_histogram = 573,
+    GLATTER_EXT_GL_SGIX_async_pixel = 574,
+    GLATTER_EXT_GL_SGIX_blend_alpha_minmax = 575,
+    GLATTER_EXT_GL_SGIX_calligraphic_fragment = 576,
+    GLATTER_EXT_GL_SGIX_clipmap = 577,
+    GLATTER_EXT_GL_SGIX_convolution_accuracy = 578,
+    GLATTER_EXT_GL_SGIX_depth_pass_instrument = 579,
+    GLATTER_EXT_GL_SGIX_depth_texture = 580,
+    GLATTER_EXT_GL_SGIX_flush_raster = 581,
+    GLATTER_EXT_GL_SGIX_fog_offset = 582,
+    GLATTER_EXT_GL_SGIX_fragment_lighting = 583,
+    GLATTER_EXT_GL_SGIX_framezoom = 584,
+    GLATTER_EXT_GL_SGIX_igloo_interface = 585,
+    GLATTER_EXT_GL_SGIX_instruments = 586,
+    GLATTER_EXT_GL_SGIX_interlace = 587,
+    GLATTER_EXT_GL_SGIX_ir_instrument1 = 588,
+    GLATTER_EXT_GL_SGIX_list_priority = 589,
+    GLATTER_EXT_GL_SGIX_pixel_texture = 590,
+    GLATTER_EXT_GL_SGIX_pixel_tiles = 591,
+    GLATTER_EXT_GL_SGIX_polynomial_ffd = 592,
+    GLATTER_EXT_GL_SGIX_reference_plane = 593,
+    GLATTER_EXT_GL_SGIX_resample = 594,
+    GLATTER_EXT_GL_SGIX_scalebias_hint = 595,
+    GLATTER_EXT_GL_SGIX_shadow = 596,
+    GLATTER_EXT_GL_SGIX_shadow_ambient = 597,
+    GLATTER_EXT_GL_SGIX_sprite = 598,
+    GLATTER_EXT_GL_SGIX_subsample = 599,
+    GLATTER_EXT_GL_SGIX_tag_sample_buffer = 600,
+    GLATTER_EXT_GL_SGIX_texture_add_env = 601,
+    GLATTER_EXT_GL_SGIX_texture_coordinate_clamp = 602,
+    GLATTER_EXT_GL_SGIX_texture_lod_bias = 603,
+    GLATTER_EXT_GL_SGIX_texture_multi_buffer = 604,
+    GLATTER_EXT_GL_SGIX_texture_scale_bias = 605,
+    GLATTER_EXT_GL_SGIX_vertex_preclip = 606,
+    GLATTER_EXT_GL_SGIX_ycrcb = 607,
+    GLATTER_EXT_GL_SGIX_ycrcb_subsample = 608,
+    GLATTER_EXT_GL_SGIX_ycrcba = 609,
+    GLATTER_EXT_GL_SGI_color_matrix = 610,
+    GLATTER_EXT_GL_SGI_color_table = 611,
+    GLATTER_EXT_GL_SGI_texture_color_table = 612,
+    GLATTER_EXT_GL_SUNX_constant_data = 613,
+    GLATTER_EXT_GL_SUN_convolution_border_modes = 614,
+    GLATTER_EXT_GL_SUN_global_alpha = 615,
+    GLATTER_EXT_GL_SUN_mesh_array = 616,
+    GLATTER_EXT_GL_SUN_slice_accum = 617,
+    GLATTER_EXT_GL_SUN_triangle_list = 618,
+    GLATTER_EXT_GL_SUN_vertex = 619,
+    GLATTER_EXT_GL_WIN_phong_shading = 620,
+    GLATTER_EXT_GL_WIN_specular_fog = 621,
+    GLATTER_EXT_COUNT_GL = 622
+};
 
+/* One bit per extension, indexed by GLATTER_EXT_* above. */
 typedef struct glatter_extension_support_status_GL
 {
-        int has_GL_3DFX_multisample;
-        int has_GL_3DFX_tbuffer;
-        int has_GL_3DFX_texture_compression_FXT1;
-        int has_GL_AMD_blend_minmax_factor;
-        int has_GL_AMD_conservative_depth;
-        int has_GL_AMD_debug_output;
-        int has_GL_AMD_depth_clamp_separate;
-        int has_GL_AMD_draw_buffers_blend;
-        int has_GL_AMD_framebuffer_multisample_advanced;
-        int has_GL_AMD_framebuffer_sample_positions;
-        int has_GL_AMD_gcn_shader;
-        int has_GL_AMD_gpu_shader_half_float;
-        int has_GL_AMD_gpu_shader_int16;
-        int has_GL_AMD_gpu_shader_int64;
-        int has_GL_AMD_interleaved_elements;
-        int has_GL_AMD_multi_draw_indirect;
-        int has_GL_AMD_name_gen_delete;
-        int has_GL_AMD_occlusion_query_event;
-        int has_GL_AMD_performance_monitor;
-        int has_GL_AMD_pinned_memory;
-        int has_GL_AMD_query_buffer_object;
-        int has_GL_AMD_sample_positions;
-        int has_GL_AMD_seamless_cubemap_per_texture;
-        int has_GL_AMD_shader_atomic_counter_ops;
-        int has_GL_AMD_shader_ballot;
-        int has_GL_AMD_shader_explicit_vertex_parameter;
-        int has_GL_AMD_shader_gpu_shader_half_float_fetch;
-        int has_GL_AMD_shader_image_load_store_lod;
-        int has_GL_AMD_shader_stencil_export;
-        int has_GL_AMD_shader_trinary_minmax;
-        int has_GL_AMD_sparse_texture;
-        int has_GL_AMD_stencil_operation_extended;
-        int has_GL_AMD_texture_gather_bias_lod;
-        int has_GL_AMD_texture_texture4;
-        int has_GL_AMD_transform_feedback3_lines_triangles;
-        int has_GL_AMD_transform_feedback4;
-        int has_GL_AMD_vertex_shader_layer;
-        int has_GL_AMD_vertex_shader_tessellator;
-        int has_GL_AMD_vertex_shader_viewport_index;
-        int has_GL_APPLE_aux_depth_stencil;
-        int has_GL_APPLE_client_storage;
-        int has_GL_APPLE_element_array;
-        int has_GL_APPLE_fence;
-        int has_GL_APPLE_float_pixels;
-        int has_GL_APPLE_flush_buffer_range;
-        int has_GL_APPLE_object_purgeable;
-        int has_GL_APPLE_rgb_422;
-        int has_GL_APPLE_row_bytes;
-        int has_GL_APPLE_specular_vector;
-        int has_GL_APPLE_texture_range;
-        int has_GL_APPLE_transform_hint;
-        int has_GL_APPLE_vertex_array_object;
-        int has_GL_APPLE_vertex_array_range;
-        int has_GL_APPLE_vertex_program_evaluators;
-        int has_GL_APPLE_ycbcr_422;
-        int has_GL_ARB_ES2_compatibility;
-        int has_GL_ARB_ES3_1_compatibility;
-        int has_GL_ARB_ES3_2_compatibility;
-        int has_GL_ARB_ES3_compatibility;
-        int has_GL_ARB_arrays_of_arrays;
-        int has_GL_ARB_base_instance;
-        int has_GL_ARB_bindless_texture;
-        int has_GL_ARB_blend_func_extended;
-        int has_GL_ARB_buffer_storage;
-        int has_GL_ARB_cl_event;
-        int has_GL_ARB_clear_buffer_object;
-        int has_GL_ARB_clear_texture;
-        int has_GL_ARB_clip_control;
-        int has_GL_ARB_color_buffer_float;
-        int has_GL_ARB_compatibility;
-        int has_GL_ARB_compressed_texture_pixel_storage;
-        int has_GL_ARB_compute_shader;
-        int has_GL_ARB_compute_variable_group_size;
-        int has_GL_ARB_conditional_render_inverted;
-        int has_GL_ARB_conservative_depth;
-        int has_GL_ARB_copy_buffer;
-        int has_GL_ARB_copy_image;
-        int has_GL_ARB_cull_distance;
-        int has_GL_ARB_debug_output;
-        int has_GL_ARB_depth_buffer_float;
-        int has_GL_ARB_depth_clamp;
-        int has_GL_ARB_depth_texture;
-        int has_GL_ARB_derivative_control;
-        int has_GL_ARB_direct_state_access;
-        int has_GL_ARB_draw_buffers;
-        int has_GL_ARB_draw_buffers_blend;
-        int has_GL_ARB_draw_elements_base_vertex;
-        int has_GL_ARB_draw_indirect;
-        int has_GL_ARB_draw_instanced;
-        int has_GL_ARB_enhanced_layouts;
-        int has_GL_ARB_explicit_attrib_location;
-        int has_GL_ARB_explicit_uniform_location;
-        int has_GL_ARB_fragment_coord_conventions;
-        int has_GL_ARB_fragment_layer_viewport;
-        int has_GL_ARB_fragment_program;
-        int has_GL_ARB_fragment_program_shadow;
-        int has_GL_ARB_fragment_shader;
-        int has_GL_ARB_fragment_shader_interlock;
-        int has_GL_ARB_framebuffer_no_attachments;
-        int has_GL_ARB_framebuffer_object;
-        int has_GL_ARB_framebuffer_sRGB;
-        int has_GL_ARB_geometry_shader4;
-        int has_GL_ARB_get_program_binary;
-        int has_GL_ARB_get_texture_sub_image;
-        int has_GL_ARB_gl_spirv;
-        int has_GL_ARB_gpu_shader5;
-        int has_GL_ARB_gpu_shader_fp64;
-        int has_GL_ARB_gpu_shader_int64;
-        int has_GL_ARB_half_float_pixel;
-        int has_GL_ARB_half_float_vertex;
-        int has_GL_ARB_imaging;
-        int has_GL_ARB_indirect_parameters;
-        int has_GL_ARB_instanced_arrays;
-        int has_GL_ARB_internalformat_query;
-        int has_GL_ARB_internalformat_query2;
-        int has_GL_ARB_invalidate_subdata;
-        int has_GL_ARB_map_buffer_alignment;
-        int has_GL_ARB_map_buffer_range;
-        int has_GL_ARB_matrix_palette;
-        int has_GL_ARB_multi_bind;
-        int has_GL_ARB_multi_draw_indirect;
-        int has_GL_ARB_multisample;
-        int has_GL_ARB_multitexture;
-        int has_GL_ARB_occlusion_query;
-        int has_GL_ARB_occlusion_query2;
-        int has_GL_ARB_parallel_shader_compile;
-        int has_GL_ARB_pipeline_statistics_query;
-        int has_GL_ARB_pixel_buffer_object;
-        int has_GL_ARB_point_parameters;
-        int has_GL_ARB_point_sprite;
-        int has_GL_ARB_polygon_offset_clamp;
-        int has_GL_ARB_post_depth_coverage;
-        int has_GL_ARB_program_interface_query;
-        int has_GL_ARB_provoking_vertex;
-        int has_GL_ARB_query_buffer_object;
-        int has_GL_ARB_robust_buffer_access_behavior;
-        int has_GL_ARB_robustness;
-        int has_GL_ARB_robustness_isolation;
-        int has_GL_ARB_sample_locations;
-        int has_GL_ARB_sample_shading;
-        int has_GL_ARB_sampler_objects;
-        int has_GL_ARB_seamless_cube_map;
-        int has_GL_ARB_seamless_cubemap_per_texture;
-        int has_GL_ARB_separate_shader_objects;
-        int has_GL_ARB_shader_atomic_counter_ops;
-        int has_GL_ARB_shader_atomic_counters;
-        int has_GL_ARB_shader_ballot;
-        int has_GL_ARB_shader_bit_encoding;
-        int has_GL_ARB_shader_clock;
-        int has_GL_ARB_shader_draw_parameters;
-        int has_GL_ARB_shader_group_vote;
-        int has_GL_ARB_shader_image_load_store;
-        int has_GL_ARB_shader_image_size;
-        int has_GL_ARB_shader_objects;
-        int has_GL_ARB_shader_precision;
-        int has_GL_ARB_shader_stencil_export;
-        int has_GL_ARB_shader_storage_buffer_object;
-        int has_GL_ARB_shader_subroutine;
-        int has_GL_ARB_shader_texture_image_samples;
-        int has_GL_ARB_shader_texture_lod;
-        int has_GL_ARB_shader_viewport_layer_array;
-        int has_GL_ARB_shading_language_100;
-        int has_GL_ARB_shading_language_420pack;
-        int has_GL_ARB_shading_language_include;
-        int has_GL_ARB_shading_language_packing;
-        int has_GL_ARB_shadow;
-        int has_GL_ARB_shadow_ambient;
-        int has_GL_ARB_sparse_buffer;
-        int has_GL_ARB_sparse_texture;
-        int has_GL_ARB_sparse_texture2;
-        int has_GL_ARB_sparse_texture_clamp;
-        int has_GL_ARB_spirv_extensions;
-        int has_GL_ARB_stencil_texturing;
-        int has_GL_ARB_sync;
-        int has_GL_ARB_tessellation_shader;
-        int has_GL_ARB_texture_barrier;
-        int has_GL_ARB_texture_border_clamp;
-        int has_GL_ARB_texture_buffer_object;
-        int has_GL_ARB_texture_buffer_object_rgb32;
-        int has_GL_ARB_texture_buffer_range;
-        int has_GL_ARB_texture_compression;
-        int has_GL_ARB_texture_compression_bptc;
-        int has_GL_ARB_texture_compression_rgtc;
-        int has_GL_ARB_texture_cube_map;
-        int has_GL_ARB_texture_cube_map_array;
-        int has_GL_ARB_texture_env_add;
-        int has_GL_ARB_texture_env_combine;
-        int has_GL_ARB_texture_env_crossbar;
-        int has_GL_ARB_texture_env_dot3;
-        int has_GL_ARB_texture_filter_anisotropic;
-        int has_GL_ARB_texture_filter_minmax;
-        int has_GL_ARB_texture_float;
-        int has_GL_ARB_texture_gather;
-        int has_GL_ARB_texture_mirror_clamp_to_edge;
-        int has_GL_ARB_texture_mirrored_repeat;
-        int has_GL_ARB_texture_multisample;
-        int has_GL_ARB_texture_non_power_of_two;
-        int has_GL_ARB_texture_query_levels;
-        int has_GL_ARB_texture_query_lod;
-        int has_GL_ARB_texture_rectangle;
-        int has_GL_ARB_texture_rg;
-        int has_GL_ARB_texture_rgb10_a2ui;
-        int has_GL_ARB_texture_stencil8;
-        int has_GL_ARB_texture_storage;
-        int has_GL_ARB_texture_storage_multisample;
-        int has_GL_ARB_texture_swizzle;
-        int has_GL_ARB_texture_view;
-        int has_GL_ARB_timer_query;
-        int has_GL_ARB_transform_feedback2;
-        int has_GL_ARB_transform_feedback3;
-        int has_GL_ARB_transform_feedback_instanced;
-        int has_GL_ARB_transform_feedback_overflow_query;
-        int has_GL_ARB_transpose_matrix;
-        int has_GL_ARB_uniform_buffer_object;
-        int has_GL_ARB_vertex_array_bgra;
-        int has_GL_ARB_vertex_array_object;
-        int has_GL_ARB_vertex_attrib_64bit;
-        int has_GL_ARB_vertex_attrib_binding;
-        int has_GL_ARB_vertex_blend;
-        int has_GL_ARB_vertex_buffer_object;
-        int has_GL_ARB_vertex_program;
-        int has_GL_ARB_vertex_shader;
-        int has_GL_ARB_vertex_type_10f_11f_11f_rev;
-        int has_GL_ARB_vertex_type_2_10_10_10_rev;
-        int has_GL_ARB_viewport_array;
-        int has_GL_ARB_window_pos;
-        int has_GL_ATI_draw_buffers;
-        int has_GL_ATI_element_array;
-        int has_GL_ATI_envmap_bumpmap;
-        int has_GL_ATI_fragment_shader;
-        int has_GL_ATI_map_object_buffer;
-        int has_GL_ATI_meminfo;
-        int has_GL_ATI_pixel_format_float;
-        int has_GL_ATI_pn_triangles;
-        int has_GL_ATI_separate_stencil;
-        int has_GL_ATI_text_fragment_shader;
-        int has_GL_ATI_texture_env_combine3;
-        int has_GL_ATI_texture_float;
-        int has_GL_ATI_texture_mirror_once;
-        int has_GL_ATI_vertex_array_object;
-        int has_GL_ATI_vertex_attrib_array_object;
-        int has_GL_ATI_vertex_streams;
-        int has_GL_EXT_422_pixels;
-        int has_GL_EXT_EGL_image_storage;
-        int has_GL_EXT_EGL_sync;
-        int has_GL_EXT_abgr;
-        int has_GL_EXT_bgra;
-        int has_GL_EXT_bindable_uniform;
-        int has_GL_EXT_blend_color;
-        int has_GL_EXT_blend_equation_separate;
-        int has_GL_EXT_blend_func_separate;
-        int has_GL_EXT_blend_logic_op;
-        int has_GL_EXT_blend_minmax;
-        int has_GL_EXT_blend_subtract;
-        int has_GL_EXT_clip_volume_hint;
-        int has_GL_EXT_cmyka;
-        int has_GL_EXT_color_subtable;
-        int has_GL_EXT_compiled_vertex_array;
-        int has_GL_EXT_convolution;
-        int has_GL_EXT_coordinate_frame;
-        int has_GL_EXT_copy_texture;
-        int has_GL_EXT_cull_vertex;
-        int has_GL_EXT_debug_label;
-        int has_GL_EXT_debug_marker;
-        int has_GL_EXT_depth_bounds_test;
-        int has_GL_EXT_direct_state_access;
-        int has_GL_EXT_draw_buffers2;
-        int has_GL_EXT_draw_instanced;
-        int has_GL_EXT_draw_range_elements;
-        int has_GL_EXT_external_buffer;
-        int has_GL_EXT_fog_coord;
-        int has_GL_EXT_fragment_shading_rate;
-        int has_GL_EXT_framebuffer_blit;
-        int has_GL_EXT_framebuffer_blit_layers;
-        int has_GL_EXT_framebuffer_multisample;
-        int has_GL_EXT_framebuffer_multisample_blit_scaled;
-        int has_GL_EXT_framebuffer_object;
-        int has_GL_EXT_framebuffer_sRGB;
-        int has_GL_EXT_geometry_shader4;
-        int has_GL_EXT_gpu_program_parameters;
-        int has_GL_EXT_gpu_shader4;
-        int has_GL_EXT_histogram;
-        int has_GL_EXT_index_array_formats;
-        int has_GL_EXT_index_func;
-        int has_GL_EXT_index_material;
-        int has_GL_EXT_index_texture;
-        int has_GL_EXT_light_texture;
-        int has_GL_EXT_memory_object;
-        int has_GL_EXT_memory_object_fd;
-        int has_GL_EXT_memory_object_win32;
-        int has_GL_EXT_mesh_shader;
-        int has_GL_EXT_misc_attribute;
-        int has_GL_EXT_multi_draw_arrays;
-        int has_GL_EXT_multisample;
-        int has_GL_EXT_multiview_tessellation_geometry_shader;
-        int has_GL_EXT_multiview_texture_multisample;
-        int has_GL_EXT_multiview_timer_query;
-        int has_GL_EXT_packed_depth_stencil;
-        int has_GL_EXT_packed_float;
-        int has_GL_EXT_packed_pixels;
-        int has_GL_EXT_paletted_texture;
-        int has_GL_EXT_pixel_buffer_object;
-        int has_GL_EXT_pixel_transform;
-        int has_GL_EXT_pixel_transform_color_table;
-        int has_GL_EXT_point_parameters;
-        int has_GL_EXT_polygon_offset;
-        int has_GL_EXT_polygon_offset_clamp;
-        int has_GL_EXT_post_depth_coverage;
-        int has_GL_EXT_provoking_vertex;
-        int has_GL_EXT_raster_multisample;
-        int has_GL_EXT_rescale_normal;
-        int has_GL_EXT_secondary_color;
-        int has_GL_EXT_semaphore;
-        int has_GL_EXT_semaphore_fd;
-        int has_GL_EXT_semaphore_win32;
-        int has_GL_EXT_separate_shader_objects;
-        int has_GL_EXT_separate_specular_color;
-        int has_GL_EXT_shader_framebuffer_fetch;
-        int has_GL_EXT_shader_framebuffer_fetch_non_coherent;
-        int has_GL_EXT_shader_image_load_formatted;
-        int has_GL_EXT_shader_image_load_store;
-        int has_GL_EXT_shader_integer_mix;
-        int has_GL_EXT_shader_samples_identical;
-        int has_GL_EXT_shadow_funcs;
-        int has_GL_EXT_shared_texture_palette;
-        int has_GL_EXT_sparse_texture2;
-        int has_GL_EXT_stencil_clear_tag;
-        int has_GL_EXT_stencil_two_side;
-        int has_GL_EXT_stencil_wrap;
-        int has_GL_EXT_subtexture;
-        int has_GL_EXT_texture;
-        int has_GL_EXT_texture3D;
-        int has_GL_EXT_texture_array;
-        int has_GL_EXT_texture_buffer_object;
-        int has_GL_EXT_texture_compression_latc;
-        int has_GL_EXT_texture_compression_rgtc;
-        int has_GL_EXT_texture_compression_s3tc;
-        int has_GL_EXT_texture_cube_map;
-        int has_GL_EXT_texture_env_add;
-        int has_GL_EXT_texture_env_combine;
-        int has_GL_EXT_texture_env_dot3;
-        int has_GL_EXT_texture_filter_anisotropic;
-        int has_GL_EXT_texture_filter_minmax;
-        int has_GL_EXT_texture_integer;
-        int has_GL_EXT_texture_lod_bias;
-        int has_GL_EXT_texture_mirror_clamp;
-        int has_GL_EXT_texture_object;
-        int has_GL_EXT_texture_perturb_normal;
-        int has_GL_EXT_texture_sRGB;
-        int has_GL_EXT_texture_sRGB_R8;
-        int has_GL_EXT_texture_sRGB_RG8;
-        int has_GL_EXT_texture_sRGB_decode;
-        int has_GL_EXT_texture_shadow_lod;
-        int has_GL_EXT_texture_shared_exponent;
-        int has_GL_EXT_texture_snorm;
-        int has_GL_EXT_texture_storage;
-        int has_GL_EXT_texture_swizzle;
-        int has_GL_EXT_timer_query;
-        int has_GL_EXT_transform_feedback;
-        int has_GL_EXT_vertex_array;
-        int has_GL_EXT_vertex_array_bgra;
-        int has_GL_EXT_vertex_attrib_64bit;
-        int has_GL_EXT_vertex_shader;
-        int has_GL_EXT_vertex_weighting;
-        int has_GL_EXT_win32_keyed_mutex;
-        int has_GL_EXT_window_rectangles;
-        int has_GL_EXT_x11_sync_object;
-        int has_GL_GREMEDY_frame_terminator;
-        int has_GL_GREMEDY_string_marker;
-        int has_GL_HP_convolution_border_modes;
-        int has_GL_HP_image_transform;
-        int has_GL_HP_occlusion_test;
-        int has_GL_HP_texture_lighting;
-        int has_GL_IBM_cull_vertex;
-        int has_GL_IBM_multimode_draw_arrays;
-        int has_GL_IBM_rasterpos_clip;
-        int has_GL_IBM_static_data;
-        int has_GL_IBM_texture_mirrored_repeat;
-        int has_GL_IBM_vertex_array_lists;
-        int has_GL_INGR_blend_func_separate;
-        int has_GL_INGR_color_clamp;
-        int has_GL_INGR_interlace_read;
-        int has_GL_INTEL_blackhole_render;
-        int has_GL_INTEL_conservative_rasterization;
-        int has_GL_INTEL_fragment_shader_ordering;
-        int has_GL_INTEL_framebuffer_CMAA;
-        int has_GL_INTEL_map_texture;
-        int has_GL_INTEL_parallel_arrays;
-        int has_GL_INTEL_performance_query;
-        int has_GL_KHR_blend_equation_advanced;
-        int has_GL_KHR_blend_equation_advanced_coherent;
-        int has_GL_KHR_context_flush_control;
-        int has_GL_KHR_debug;
-        int has_GL_KHR_no_error;
-        int has_GL_KHR_parallel_shader_compile;
-        int has_GL_KHR_robust_buffer_access_behavior;
-        int has_GL_KHR_robustness;
-        int has_GL_KHR_shader_subgroup;
-        int has_GL_KHR_texture_compression_astc_hdr;
-        int has_GL_KHR_texture_compression_astc_ldr;
-        int has_GL_KHR_texture_compression_astc_sliced_3d;
-        int has_GL_MESAX_texture_stack;
-        int has_GL_MESA_framebuffer_flip_x;
-        int has_GL_MESA_framebuffer_flip_y;
-        int has_GL_MESA_framebuffer_swap_xy;
-        int has_GL_MESA_pack_invert;
-        int has_GL_MESA_program_binary_formats;
-        int has_GL_MESA_resize_buffers;
-        int has_GL_MESA_shader_integer_functions;
-        int has_GL_MESA_texture_const_bandwidth;
-        int has_GL_MESA_tile_raster_order;
-        int has_GL_MESA_window_pos;
-        int has_GL_MESA_ycbcr_texture;
-        int has_GL_NVX_blend_equation_advanced_multi_draw_buffers;
-        int has_GL_NVX_conditional_render;
-        int has_GL_NVX_gpu_memory_info;
-        int has_GL_NVX_gpu_multicast2;
-        int has_GL_NVX_linked_gpu_multicast;
-        int has_GL_NVX_progress_fence;
-        int has_GL_NV_alpha_to_coverage_dither_control;
-        int has_GL_NV_bindless_multi_draw_indirect;
-        int has_GL_NV_bindless_multi_draw_indirect_count;
-        int has_GL_NV_bindless_texture;
-        int has_GL_NV_blend_equation_advanced;
-        int has_GL_NV_blend_equation_advanced_coherent;
-        int has_GL_NV_blend_minmax_factor;
-        int has_GL_NV_blend_square;
-        int has_GL_NV_clip_space_w_scaling;
-        int has_GL_NV_command_list;
-        int has_GL_NV_compute_program5;
-        int has_GL_NV_compute_shader_derivatives;
-        int has_GL_NV_conditional_render;
-        int has_GL_NV_conservative_raster;
-        int has_GL_NV_conservative_raster_dilate;
-        int has_GL_NV_conservative_raster_pre_snap;
-        int has_GL_NV_conservative_raster_pre_snap_triangles;
-        int has_GL_NV_conservative_raster_underestimation;
-        int has_GL_NV_copy_depth_to_color;
-        int has_GL_NV_copy_image;
-        int has_GL_NV_deep_texture3D;
-        int has_GL_NV_depth_buffer_float;
-        int has_GL_NV_depth_clamp;
-        int has_GL_NV_draw_texture;
-        int has_GL_NV_draw_vulkan_image;
-        int has_GL_NV_evaluators;
-        int has_GL_NV_explicit_multisample;
-        int has_GL_NV_fence;
-        int has_GL_NV_fill_rectangle;
-        int has_GL_NV_float_buffer;
-        int has_GL_NV_fog_distance;
-        int has_GL_NV_fragment_coverage_to_color;
-        int has_GL_NV_fragment_program;
-        int has_GL_NV_fragment_program2;
-        int has_GL_NV_fragment_program4;
-        int has_GL_NV_fragment_program_option;
-        int has_GL_NV_fragment_shader_barycentric;
-        int has_GL_NV_fragment_shader_interlock;
-        int has_GL_NV_framebuffer_mixed_samples;
-        int has_GL_NV_framebuffer_multisample_coverage;
-        int has_GL_NV_geometry_program4;
-        int has_GL_NV_geometry_shader4;
-        int has_GL_NV_geometry_shader_passthrough;
-        int has_GL_NV_gpu_multicast;
-        int has_GL_NV_gpu_program4;
-        int has_GL_NV_gpu_program5;
-        int has_GL_NV_gpu_program5_mem_extended;
-        int has_GL_NV_gpu_shader5;
-        int has_GL_NV_half_float;
-        int has_GL_NV_internalformat_sample_query;
-        int has_GL_NV_light_max_exponent;
-        int has_GL_NV_memory_attachment;
-        int has_GL_NV_memory_object_sparse;
-        int has_GL_NV_mesh_shader;
-        int has_GL_NV_multisample_coverage;
-        int has_GL_NV_multisample_filter_hint;
-        int has_GL_NV_occlusion_query;
-        int has_GL_NV_packed_depth_stencil;
-        int has_GL_NV_parameter_buffer_object;
-        int has_GL_NV_parameter_buffer_object2;
-        int has_GL_NV_path_rendering;
-        int has_GL_NV_path_rendering_shared_edge;
-        int has_GL_NV_pixel_data_range;
-        int has_GL_NV_point_sprite;
-        int has_GL_NV_present_video;
-        int has_GL_NV_primitive_restart;
-        int has_GL_NV_primitive_shading_rate;
-        int has_GL_NV_query_resource;
-        int has_GL_NV_query_resource_tag;
-        int has_GL_NV_register_combiners;
-        int has_GL_NV_register_combiners2;
-        int has_GL_NV_representative_fragment_test;
-        int has_GL_NV_robustness_video_memory_purge;
-        int has_GL_NV_sample_locations;
-        int has_GL_NV_sample_mask_override_coverage;
-        int has_GL_NV_scissor_exclusive;
-        int has_GL_NV_shader_atomic_counters;
-        int has_GL_NV_shader_atomic_float;
-        int has_GL_NV_shader_atomic_float64;
-        int has_GL_NV_shader_atomic_fp16_vector;
-        int has_GL_NV_shader_atomic_int64;
-        int has_GL_NV_shader_buffer_load;
-        int has_GL_NV_shader_buffer_store;
-        int has_GL_NV_shader_storage_buffer_object;
-        int has_GL_NV_shader_subgroup_partitioned;
-        int has_GL_NV_shader_texture_footprint;
-        int has_GL_NV_shader_thread_group;
-        int has_GL_NV_shader_thread_shuffle;
-        int has_GL_NV_shading_rate_image;
-        int has_GL_NV_stereo_view_rendering;
-        int has_GL_NV_tessellation_program5;
-        int has_GL_NV_texgen_emboss;
-        int has_GL_NV_texgen_reflection;
-        int has_GL_NV_texture_barrier;
-        int has_GL_NV_texture_compression_vtc;
-        int has_GL_NV_texture_env_combine4;
-        int has_GL_NV_texture_expand_normal;
-        int has_GL_NV_texture_multisample;
-        int has_GL_NV_texture_rectangle;
-        int has_GL_NV_texture_rectangle_compressed;
-        int has_GL_NV_texture_shader;
-        int has_GL_NV_texture_shader2;
-        int has_GL_NV_texture_shader3;
-        int has_GL_NV_timeline_semaphore;
-        int has_GL_NV_transform_feedback;
-        int has_GL_NV_transform_feedback2;
-        int has_GL_NV_uniform_buffer_std430_layout;
-        int has_GL_NV_uniform_buffer_unified_memory;
-        int has_GL_NV_vdpau_interop;
-        int has_GL_NV_vdpau_interop2;
-        int has_GL_NV_vertex_array_range;
-        int has_GL_NV_vertex_array_range2;
-        int has_GL_NV_vertex_attrib_integer_64bit;
-        int has_GL_NV_vertex_buffer_unified_memory;
-        int has_GL_NV_vertex_program;
-        int has_GL_NV_vertex_program1_1;
-        int has_GL_NV_vertex_program2;
-        int has_GL_NV_vertex_program2_option;
-        int has_GL_NV_vertex_program3;
-        int has_GL_NV_vertex_program4;
-        int has_GL_NV_video_capture;
-        int has_GL_NV_viewport_array2;
-        int has_GL_NV_viewport_swizzle;
-        int has_GL_OES_byte_coordinates;
-        int has_GL_OES_compressed_paletted_texture;
-        int has_GL_OES_fixed_point;
-        int has_GL_OES_query_matrix;
-        int has_GL_OES_read_format;
-        int has_GL_OES_single_precision;
-        int has_GL_OML_interlace;
-        int has_GL_OML_resample;
-        int has_GL_OML_subsample;
-        int has_GL_OVR_multiview;
-        int has_GL_OVR_multiview2;
-        int has_GL_PGI_misc_hints;
-        int has_GL_PGI_vertex_hints;
-        int has_GL_REND_screen_coordinates;
-        int has_GL_S3_s3tc;
-        int has_GL_SGIS_detail_texture;
-        int has_GL_SGIS_fog_function;
-        int has_GL_SGIS_generate_mipmap;
-        int has_GL_SGIS_multisample;
-        int has_GL_SGIS_pixel_texture;
-        int has_GL_SGIS_point_line_texgen;
-        int has_GL_SGIS_point_parameters;
-        int has_GL_SGIS_sharpen_texture;
-        int has_GL_SGIS_texture4D;
-        int has_GL_SGIS_texture_border_clamp;
-        int has_GL_SGIS_texture_color_mask;
-        int has_GL_SGIS_texture_edge_clamp;
-        int has_GL_SGIS_texture_filter4;
-        int has_GL_SGIS_texture_lod;
-        int has_GL_SGIS_texture_select;
-        int has_GL_SGIX_async;
-        int has_GL_SGIX_async_histogram;
-        int has_GL_SGIX_async_pixel;
-        int has_GL_SGIX_blend_alpha_minmax;
-        int has_GL_SGIX_calligraphic_fragment;
-        int has_GL_SGIX_clipmap;
-        int has_GL_SGIX_convolution_accuracy;
-        int has_GL_SGIX_depth_pass_instrument;
-        int has_GL_SGIX_depth_texture;
-        int has_GL_SGIX_flush_raster;
-        int has_GL_SGIX_fog_offset;
-        int has_GL_SGIX_fragment_lighting;
-        int has_GL_SGIX_framezoom;
-        int has_GL_SGIX_igloo_interface;
-        int has_GL_SGIX_instruments;
-        int has_GL_SGIX_interlace;
-        int has_GL_SGIX_ir_instrument1;
-        int has_GL_SGIX_list_priority;
-        int has_GL_SGIX_pixel_texture;
-        int has_GL_SGIX_pixel_tiles;
-        int has_GL_SGIX_polynomial_ffd;
-        int has_GL_SGIX_reference_plane;
-        int has_GL_SGIX_resample;
-        int has_GL_SGIX_scalebias_hint;
-        int has_GL_SGIX_shadow;
-        int has_GL_SGIX_shadow_ambient;
-        int has_GL_SGIX_sprite;
-        int has_GL_SGIX_subsample;
-        int has_GL_SGIX_tag_sample_buffer;
-        int has_GL_SGIX_texture_add_env;
-        int has_GL_SGIX_texture_coordinate_clamp;
-        int has_GL_SGIX_texture_lod_bias;
-        int has_GL_SGIX_texture_multi_buffer;
-        int has_GL_SGIX_texture_scale_bias;
-        int has_GL_SGIX_vertex_preclip;
-        int has_GL_SGIX_ycrcb;
-        int has_GL_SGIX_ycrcb_subsample;
-        int has_GL_SGIX_ycrcba;
-        int has_GL_SGI_color_matrix;
-        int has_GL_SGI_color_table;
-        int has_GL_SGI_texture_color_table;
-        int has_GL_SUNX_constant_data;
-        int has_GL_SUN_convolution_border_modes;
-        int has_GL_SUN_global_alpha;
-        int has_GL_SUN_mesh_array;
-        int has_GL_SUN_slice_accum;
-        int has_GL_SUN_triangle_list;
-        int has_GL_SUN_vertex;
-        int has_GL_WIN_phong_shading;
-        int has_GL_WIN_specular_fog;
+    uint32_t bits[20];
 } glatter_extension_support_status_GL_t;
 
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+#define glatter_GL_3DFX_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_3DFX_multisample)
+#define glatter_GL_3DFX_tbuffer glatter_extension_supported_GL(GLATTER_EXT_GL_3DFX_tbuffer)
+#define glatter_GL_3DFX_texture_compression_FXT1 glatter_extension_supported_GL(GLATTER_EXT_GL_3DFX_texture_compression_FXT1)
+#define glatter_GL_AMD_blend_minmax_factor glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_blend_minmax_factor)
+#define glatter_GL_AMD_conservative_depth glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_conservative_depth)
+#define glatter_GL_AMD_debug_output glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_debug_output)
+#define glatter_GL_AMD_depth_clamp_separate glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_depth_clamp_separate)
+#define glatter_GL_AMD_draw_buffers_blend glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_draw_buffers_blend)
+#define glatter_GL_AMD_framebuffer_multisample_advanced glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_framebuffer_multisample_advanced)
+#define glatter_GL_AMD_framebuffer_sample_positions glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_framebuffer_sample_positions)
+#define glatter_GL_AMD_gcn_shader glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_gcn_shader)
+#define glatter_GL_AMD_gpu_shader_half_float glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_gpu_shader_half_float)
+#define glatter_GL_AMD_gpu_shader_int16 glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_gpu_shader_int16)
+#define glatter_GL_AMD_gpu_shader_int64 glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_gpu_shader_int64)
+#define glatter_GL_AMD_interleaved_elements glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_interleaved_elements)
+#define glatter_GL_AMD_multi_draw_indirect glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_multi_draw_indirect)
+#define glatter_GL_AMD_name_gen_delete glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_name_gen_delete)
+#define glatter_GL_AMD_occlusion_query_event glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_occlusion_query_event)
+#define glatter_GL_AMD_performance_monitor glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_performance_monitor)
+#define glatter_GL_AMD_pinned_memory glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_pinned_memory)
+#define glatter_GL_AMD_query_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_query_buffer_object)
+#define glatter_GL_AMD_sample_positions glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_sample_positions)
+#define glatter_GL_AMD_seamless_cubemap_per_texture glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_seamless_cubemap_per_texture)
+#define glatter_GL_AMD_shader_atomic_counter_ops glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_atomic_counter_ops)
+#define glatter_GL_AMD_shader_ballot glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_ballot)
+#define glatter_GL_AMD_shader_explicit_vertex_parameter glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_explicit_vertex_parameter)
+#define glatter_GL_AMD_shader_gpu_shader_half_float_fetch glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_gpu_shader_half_float_fetch)
+#define glatter_GL_AMD_shader_image_load_store_lod glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_image_load_store_lod)
+#define glatter_GL_AMD_shader_stencil_export glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_stencil_export)
+#define glatter_GL_AMD_shader_trinary_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_shader_trinary_minmax)
+#define glatter_GL_AMD_sparse_texture glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_sparse_texture)
+#define glatter_GL_AMD_stencil_operation_extended glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_stencil_operation_extended)
+#define glatter_GL_AMD_texture_gather_bias_lod glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_texture_gather_bias_lod)
+#define glatter_GL_AMD_texture_texture4 glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_texture_texture4)
+#define glatter_GL_AMD_transform_feedback3_lines_triangles glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_transform_feedback3_lines_triangles)
+#define glatter_GL_AMD_transform_feedback4 glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_transform_feedback4)
+#define glatter_GL_AMD_vertex_shader_layer glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_vertex_shader_layer)
+#define glatter_GL_AMD_vertex_shader_tessellator glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_vertex_shader_tessellator)
+#define glatter_GL_AMD_vertex_shader_viewport_index glatter_extension_supported_GL(GLATTER_EXT_GL_AMD_vertex_shader_viewport_index)
+#define glatter_GL_APPLE_aux_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_aux_depth_stencil)
+#define glatter_GL_APPLE_client_storage glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_client_storage)
+#define glatter_GL_APPLE_element_array glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_element_array)
+#define glatter_GL_APPLE_fence glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_fence)
+#define glatter_GL_APPLE_float_pixels glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_float_pixels)
+#define glatter_GL_APPLE_flush_buffer_range glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_flush_buffer_range)
+#define glatter_GL_APPLE_object_purgeable glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_object_purgeable)
+#define glatter_GL_APPLE_rgb_422 glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_rgb_422)
+#define glatter_GL_APPLE_row_bytes glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_row_bytes)
+#define glatter_GL_APPLE_specular_vector glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_specular_vector)
+#define glatter_GL_APPLE_texture_range glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_texture_range)
+#define glatter_GL_APPLE_transform_hint glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_transform_hint)
+#define glatter_GL_APPLE_vertex_array_object glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_vertex_array_object)
+#define glatter_GL_APPLE_vertex_array_range glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_vertex_array_range)
+#define glatter_GL_APPLE_vertex_program_evaluators glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_vertex_program_evaluators)
+#define glatter_GL_APPLE_ycbcr_422 glatter_extension_supported_GL(GLATTER_EXT_GL_APPLE_ycbcr_422)
+#define glatter_GL_ARB_ES2_compatibility glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_ES2_compatibility)
+#define glatter_GL_ARB_ES3_1_compatibility glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_ES3_1_compatibility)
+#define glatter_GL_ARB_ES3_2_compatibility glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_ES3_2_compatibility)
+#define glatter_GL_ARB_ES3_compatibility glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_ES3_compatibility)
+#define glatter_GL_ARB_arrays_of_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_arrays_of_arrays)
+#define glatter_GL_ARB_base_instance glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_base_instance)
+#define glatter_GL_ARB_bindless_texture glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_bindless_texture)
+#define glatter_GL_ARB_blend_func_extended glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_blend_func_extended)
+#define glatter_GL_ARB_buffer_storage glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_buffer_storage)
+#define glatter_GL_ARB_cl_event glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_cl_event)
+#define glatter_GL_ARB_clear_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_clear_buffer_object)
+#define glatter_GL_ARB_clear_texture glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_clear_texture)
+#define glatter_GL_ARB_clip_control glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_clip_control)
+#define glatter_GL_ARB_color_buffer_float glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_color_buffer_float)
+#define glatter_GL_ARB_compatibility glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_compatibility)
+#define glatter_GL_ARB_compressed_texture_pixel_storage glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_compressed_texture_pixel_storage)
+#define glatter_GL_ARB_compute_shader glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_compute_shader)
+#define glatter_GL_ARB_compute_variable_group_size glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_compute_variable_group_size)
+#define glatter_GL_ARB_conditional_render_inverted glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_conditional_render_inverted)
+#define glatter_GL_ARB_conservative_depth glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_conservative_depth)
+#define glatter_GL_ARB_copy_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_copy_buffer)
+#define glatter_GL_ARB_copy_image glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_copy_image)
+#define glatter_GL_ARB_cull_distance glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_cull_distance)
+#define glatter_GL_ARB_debug_output glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_debug_output)
+#define glatter_GL_ARB_depth_buffer_float glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_depth_buffer_float)
+#define glatter_GL_ARB_depth_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_depth_clamp)
+#define glatter_GL_ARB_depth_texture glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_depth_texture)
+#define glatter_GL_ARB_derivative_control glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_derivative_control)
+#define glatter_GL_ARB_direct_state_access glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_direct_state_access)
+#define glatter_GL_ARB_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_draw_buffers)
+#define glatter_GL_ARB_draw_buffers_blend glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_draw_buffers_blend)
+#define glatter_GL_ARB_draw_elements_base_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_draw_elements_base_vertex)
+#define glatter_GL_ARB_draw_indirect glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_draw_indirect)
+#define glatter_GL_ARB_draw_instanced glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_draw_instanced)
+#define glatter_GL_ARB_enhanced_layouts glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_enhanced_layouts)
+#define glatter_GL_ARB_explicit_attrib_location glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_explicit_attrib_location)
+#define glatter_GL_ARB_explicit_uniform_location glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_explicit_uniform_location)
+#define glatter_GL_ARB_fragment_coord_conventions glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_fragment_coord_conventions)
+#define glatter_GL_ARB_fragment_layer_viewport glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_fragment_layer_viewport)
+#define glatter_GL_ARB_fragment_program glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_fragment_program)
+#define glatter_GL_ARB_fragment_program_shadow glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_fragment_program_shadow)
+#define glatter_GL_ARB_fragment_shader glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_fragment_shader)
+#define glatter_GL_ARB_fragment_shader_interlock glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_fragment_shader_interlock)
+#define glatter_GL_ARB_framebuffer_no_attachments glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_framebuffer_no_attachments)
+#define glatter_GL_ARB_framebuffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_framebuffer_object)
+#define glatter_GL_ARB_framebuffer_sRGB glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_framebuffer_sRGB)
+#define glatter_GL_ARB_geometry_shader4 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_geometry_shader4)
+#define glatter_GL_ARB_get_program_binary glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_get_program_binary)
+#define glatter_GL_ARB_get_texture_sub_image glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_get_texture_sub_image)
+#define glatter_GL_ARB_gl_spirv glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_gl_spirv)
+#define glatter_GL_ARB_gpu_shader5 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_gpu_shader5)
+#define glatter_GL_ARB_gpu_shader_fp64 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_gpu_shader_fp64)
+#define glatter_GL_ARB_gpu_shader_int64 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_gpu_shader_int64)
+#define glatter_GL_ARB_half_float_pixel glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_half_float_pixel)
+#define glatter_GL_ARB_half_float_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_half_float_vertex)
+#define glatter_GL_ARB_imaging glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_imaging)
+#define glatter_GL_ARB_indirect_parameters glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_indirect_parameters)
+#define glatter_GL_ARB_instanced_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_instanced_arrays)
+#define glatter_GL_ARB_internalformat_query glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_internalformat_query)
+#define glatter_GL_ARB_internalformat_query2 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_internalformat_query2)
+#define glatter_GL_ARB_invalidate_subdata glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_invalidate_subdata)
+#define glatter_GL_ARB_map_buffer_alignment glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_map_buffer_alignment)
+#define glatter_GL_ARB_map_buffer_range glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_map_buffer_range)
+#define glatter_GL_ARB_matrix_palette glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_matrix_palette)
+#define glatter_GL_ARB_multi_bind glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_multi_bind)
+#define glatter_GL_ARB_multi_draw_indirect glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_multi_draw_indirect)
+#define glatter_GL_ARB_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_multisample)
+#define glatter_GL_ARB_multitexture glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_multitexture)
+#define glatter_GL_ARB_occlusion_query glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_occlusion_query)
+#define glatter_GL_ARB_occlusion_query2 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_occlusion_query2)
+#define glatter_GL_ARB_parallel_shader_compile glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_parallel_shader_compile)
+#define glatter_GL_ARB_pipeline_statistics_query glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_pipeline_statistics_query)
+#define glatter_GL_ARB_pixel_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_pixel_buffer_object)
+#define glatter_GL_ARB_point_parameters glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_point_parameters)
+#define glatter_GL_ARB_point_sprite glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_point_sprite)
+#define glatter_GL_ARB_polygon_offset_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_polygon_offset_clamp)
+#define glatter_GL_ARB_post_depth_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_post_depth_coverage)
+#define glatter_GL_ARB_program_interface_query glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_program_interface_query)
+#define glatter_GL_ARB_provoking_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_provoking_vertex)
+#define glatter_GL_ARB_query_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_query_buffer_object)
+#define glatter_GL_ARB_robust_buffer_access_behavior glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_robust_buffer_access_behavior)
+#define glatter_GL_ARB_robustness glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_robustness)
+#define glatter_GL_ARB_robustness_isolation glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_robustness_isolation)
+#define glatter_GL_ARB_sample_locations glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sample_locations)
+#define glatter_GL_ARB_sample_shading glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sample_shading)
+#define glatter_GL_ARB_sampler_objects glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sampler_objects)
+#define glatter_GL_ARB_seamless_cube_map glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_seamless_cube_map)
+#define glatter_GL_ARB_seamless_cubemap_per_texture glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_seamless_cubemap_per_texture)
+#define glatter_GL_ARB_separate_shader_objects glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_separate_shader_objects)
+#define glatter_GL_ARB_shader_atomic_counter_ops glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_atomic_counter_ops)
+#define glatter_GL_ARB_shader_atomic_counters glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_atomic_counters)
+#define glatter_GL_ARB_shader_ballot glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_ballot)
+#define glatter_GL_ARB_shader_bit_encoding glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_bit_encoding)
+#define glatter_GL_ARB_shader_clock glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_clock)
+#define glatter_GL_ARB_shader_draw_parameters glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_draw_parameters)
+#define glatter_GL_ARB_shader_group_vote glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_group_vote)
+#define glatter_GL_ARB_shader_image_load_store glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_image_load_store)
+#define glatter_GL_ARB_shader_image_size glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_image_size)
+#define glatter_GL_ARB_shader_objects glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_objects)
+#define glatter_GL_ARB_shader_precision glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_precision)
+#define glatter_GL_ARB_shader_stencil_export glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_stencil_export)
+#define glatter_GL_ARB_shader_storage_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_storage_buffer_object)
+#define glatter_GL_ARB_shader_subroutine glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_subroutine)
+#define glatter_GL_ARB_shader_texture_image_samples glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_texture_image_samples)
+#define glatter_GL_ARB_shader_texture_lod glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_texture_lod)
+#define glatter_GL_ARB_shader_viewport_layer_array glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shader_viewport_layer_array)
+#define glatter_GL_ARB_shading_language_100 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shading_language_100)
+#define glatter_GL_ARB_shading_language_420pack glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shading_language_420pack)
+#define glatter_GL_ARB_shading_language_include glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shading_language_include)
+#define glatter_GL_ARB_shading_language_packing glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shading_language_packing)
+#define glatter_GL_ARB_shadow glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shadow)
+#define glatter_GL_ARB_shadow_ambient glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_shadow_ambient)
+#define glatter_GL_ARB_sparse_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sparse_buffer)
+#define glatter_GL_ARB_sparse_texture glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sparse_texture)
+#define glatter_GL_ARB_sparse_texture2 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sparse_texture2)
+#define glatter_GL_ARB_sparse_texture_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sparse_texture_clamp)
+#define glatter_GL_ARB_spirv_extensions glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_spirv_extensions)
+#define glatter_GL_ARB_stencil_texturing glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_stencil_texturing)
+#define glatter_GL_ARB_sync glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_sync)
+#define glatter_GL_ARB_tessellation_shader glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_tessellation_shader)
+#define glatter_GL_ARB_texture_barrier glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_barrier)
+#define glatter_GL_ARB_texture_border_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_border_clamp)
+#define glatter_GL_ARB_texture_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_buffer_object)
+#define glatter_GL_ARB_texture_buffer_object_rgb32 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_buffer_object_rgb32)
+#define glatter_GL_ARB_texture_buffer_range glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_buffer_range)
+#define glatter_GL_ARB_texture_compression glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_compression)
+#define glatter_GL_ARB_texture_compression_bptc glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_compression_bptc)
+#define glatter_GL_ARB_texture_compression_rgtc glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_compression_rgtc)
+#define glatter_GL_ARB_texture_cube_map glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_cube_map)
+#define glatter_GL_ARB_texture_cube_map_array glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_cube_map_array)
+#define glatter_GL_ARB_texture_env_add glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_env_add)
+#define glatter_GL_ARB_texture_env_combine glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_env_combine)
+#define glatter_GL_ARB_texture_env_crossbar glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_env_crossbar)
+#define glatter_GL_ARB_texture_env_dot3 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_env_dot3)
+#define glatter_GL_ARB_texture_filter_anisotropic glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_filter_anisotropic)
+#define glatter_GL_ARB_texture_filter_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_filter_minmax)
+#define glatter_GL_ARB_texture_float glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_float)
+#define glatter_GL_ARB_texture_gather glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_gather)
+#define glatter_GL_ARB_texture_mirror_clamp_to_edge glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_mirror_clamp_to_edge)
+#define glatter_GL_ARB_texture_mirrored_repeat glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_mirrored_repeat)
+#define glatter_GL_ARB_texture_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_multisample)
+#define glatter_GL_ARB_texture_non_power_of_two glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_non_power_of_two)
+#define glatter_GL_ARB_texture_query_levels glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_query_levels)
+#define glatter_GL_ARB_texture_query_lod glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_query_lod)
+#define glatter_GL_ARB_texture_rectangle glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_rectangle)
+#define glatter_GL_ARB_texture_rg glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_rg)
+#define glatter_GL_ARB_texture_rgb10_a2ui glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_rgb10_a2ui)
+#define glatter_GL_ARB_texture_stencil8 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_stencil8)
+#define glatter_GL_ARB_texture_storage glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_storage)
+#define glatter_GL_ARB_texture_storage_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_storage_multisample)
+#define glatter_GL_ARB_texture_swizzle glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_swizzle)
+#define glatter_GL_ARB_texture_view glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_texture_view)
+#define glatter_GL_ARB_timer_query glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_timer_query)
+#define glatter_GL_ARB_transform_feedback2 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_transform_feedback2)
+#define glatter_GL_ARB_transform_feedback3 glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_transform_feedback3)
+#define glatter_GL_ARB_transform_feedback_instanced glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_transform_feedback_instanced)
+#define glatter_GL_ARB_transform_feedback_overflow_query glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_transform_feedback_overflow_query)
+#define glatter_GL_ARB_transpose_matrix glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_transpose_matrix)
+#define glatter_GL_ARB_uniform_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_uniform_buffer_object)
+#define glatter_GL_ARB_vertex_array_bgra glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_array_bgra)
+#define glatter_GL_ARB_vertex_array_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_array_object)
+#define glatter_GL_ARB_vertex_attrib_64bit glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_attrib_64bit)
+#define glatter_GL_ARB_vertex_attrib_binding glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_attrib_binding)
+#define glatter_GL_ARB_vertex_blend glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_blend)
+#define glatter_GL_ARB_vertex_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_buffer_object)
+#define glatter_GL_ARB_vertex_program glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_program)
+#define glatter_GL_ARB_vertex_shader glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_shader)
+#define glatter_GL_ARB_vertex_type_10f_11f_11f_rev glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_type_10f_11f_11f_rev)
+#define glatter_GL_ARB_vertex_type_2_10_10_10_rev glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_vertex_type_2_10_10_10_rev)
+#define glatter_GL_ARB_viewport_array glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_viewport_array)
+#define glatter_GL_ARB_window_pos glatter_extension_supported_GL(GLATTER_EXT_GL_ARB_window_pos)
+#define glatter_GL_ATI_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_draw_buffers)
+#define glatter_GL_ATI_element_array glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_element_array)
+#define glatter_GL_ATI_envmap_bumpmap glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_envmap_bumpmap)
+#define glatter_GL_ATI_fragment_shader glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_fragment_shader)
+#define glatter_GL_ATI_map_object_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_map_object_buffer)
+#define glatter_GL_ATI_meminfo glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_meminfo)
+#define glatter_GL_ATI_pixel_format_float glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_pixel_format_float)
+#define glatter_GL_ATI_pn_triangles glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_pn_triangles)
+#define glatter_GL_ATI_separate_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_separate_stencil)
+#define glatter_GL_ATI_text_fragment_shader glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_text_fragment_shader)
+#define glatter_GL_ATI_texture_env_combine3 glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_texture_env_combine3)
+#define glatter_GL_ATI_texture_float glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_texture_float)
+#define glatter_GL_ATI_texture_mirror_once glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_texture_mirror_once)
+#define glatter_GL_ATI_vertex_array_object glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_vertex_array_object)
+#define glatter_GL_ATI_vertex_attrib_array_object glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_vertex_attrib_array_object)
+#define glatter_GL_ATI_vertex_streams glatter_extension_supported_GL(GLATTER_EXT_GL_ATI_vertex_streams)
+#define glatter_GL_EXT_422_pixels glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_422_pixels)
+#define glatter_GL_EXT_EGL_image_storage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_EGL_image_storage)
+#define glatter_GL_EXT_EGL_sync glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_EGL_sync)
+#define glatter_GL_EXT_abgr glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_abgr)
+#define glatter_GL_EXT_bgra glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_bgra)
+#define glatter_GL_EXT_bindable_uniform glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_bindable_uniform)
+#define glatter_GL_EXT_blend_color glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_color)
+#define glatter_GL_EXT_blend_equation_separate glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_equation_separate)
+#define glatter_GL_EXT_blend_func_separate glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_func_separate)
+#define glatter_GL_EXT_blend_logic_op glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_logic_op)
+#define glatter_GL_EXT_blend_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_minmax)
+#define glatter_GL_EXT_blend_subtract glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_blend_subtract)
+#define glatter_GL_EXT_clip_volume_hint glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_clip_volume_hint)
+#define glatter_GL_EXT_cmyka glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_cmyka)
+#define glatter_GL_EXT_color_subtable glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_color_subtable)
+#define glatter_GL_EXT_compiled_vertex_array glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_compiled_vertex_array)
+#define glatter_GL_EXT_convolution glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_convolution)
+#define glatter_GL_EXT_coordinate_frame glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_coordinate_frame)
+#define glatter_GL_EXT_copy_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_copy_texture)
+#define glatter_GL_EXT_cull_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_cull_vertex)
+#define glatter_GL_EXT_debug_label glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_debug_label)
+#define glatter_GL_EXT_debug_marker glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_debug_marker)
+#define glatter_GL_EXT_depth_bounds_test glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_depth_bounds_test)
+#define glatter_GL_EXT_direct_state_access glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_direct_state_access)
+#define glatter_GL_EXT_draw_buffers2 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_buffers2)
+#define glatter_GL_EXT_draw_instanced glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_instanced)
+#define glatter_GL_EXT_draw_range_elements glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_draw_range_elements)
+#define glatter_GL_EXT_external_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_external_buffer)
+#define glatter_GL_EXT_fog_coord glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_fog_coord)
+#define glatter_GL_EXT_fragment_shading_rate glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_fragment_shading_rate)
+#define glatter_GL_EXT_framebuffer_blit glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_blit)
+#define glatter_GL_EXT_framebuffer_blit_layers glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_blit_layers)
+#define glatter_GL_EXT_framebuffer_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_multisample)
+#define glatter_GL_EXT_framebuffer_multisample_blit_scaled glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_multisample_blit_scaled)
+#define glatter_GL_EXT_framebuffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_object)
+#define glatter_GL_EXT_framebuffer_sRGB glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_framebuffer_sRGB)
+#define glatter_GL_EXT_geometry_shader4 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_geometry_shader4)
+#define glatter_GL_EXT_gpu_program_parameters glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_gpu_program_parameters)
+#define glatter_GL_EXT_gpu_shader4 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_gpu_shader4)
+#define glatter_GL_EXT_histogram glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_histogram)
+#define glatter_GL_EXT_index_array_formats glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_index_array_formats)
+#define glatter_GL_EXT_index_func glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_index_func)
+#define glatter_GL_EXT_index_material glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_index_material)
+#define glatter_GL_EXT_index_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_index_texture)
+#define glatter_GL_EXT_light_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_light_texture)
+#define glatter_GL_EXT_memory_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_memory_object)
+#define glatter_GL_EXT_memory_object_fd glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_memory_object_fd)
+#define glatter_GL_EXT_memory_object_win32 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_memory_object_win32)
+#define glatter_GL_EXT_mesh_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_mesh_shader)
+#define glatter_GL_EXT_misc_attribute glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_misc_attribute)
+#define glatter_GL_EXT_multi_draw_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multi_draw_arrays)
+#define glatter_GL_EXT_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multisample)
+#define glatter_GL_EXT_multiview_tessellation_geometry_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_tessellation_geometry_shader)
+#define glatter_GL_EXT_multiview_texture_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_texture_multisample)
+#define glatter_GL_EXT_multiview_timer_query glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_multiview_timer_query)
+#define glatter_GL_EXT_packed_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_packed_depth_stencil)
+#define glatter_GL_EXT_packed_float glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_packed_float)
+#define glatter_GL_EXT_packed_pixels glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_packed_pixels)
+#define glatter_GL_EXT_paletted_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_paletted_texture)
+#define glatter_GL_EXT_pixel_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_pixel_buffer_object)
+#define glatter_GL_EXT_pixel_transform glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_pixel_transform)
+#define glatter_GL_EXT_pixel_transform_color_table glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_pixel_transform_color_table)
+#define glatter_GL_EXT_point_parameters glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_point_parameters)
+#define glatter_GL_EXT_polygon_offset glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_polygon_offset)
+#define glatter_GL_EXT_polygon_offset_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_polygon_offset_clamp)
+#define glatter_GL_EXT_post_depth_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_post_depth_coverage)
+#define glatter_GL_EXT_provoking_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_provoking_vertex)
+#define glatter_GL_EXT_raster_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_raster_multisample)
+#define glatter_GL_EXT_rescale_normal glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_rescale_normal)
+#define glatter_GL_EXT_secondary_color glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_secondary_color)
+#define glatter_GL_EXT_semaphore glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_semaphore)
+#define glatter_GL_EXT_semaphore_fd glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_semaphore_fd)
+#define glatter_GL_EXT_semaphore_win32 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_semaphore_win32)
+#define glatter_GL_EXT_separate_shader_objects glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_separate_shader_objects)
+#define glatter_GL_EXT_separate_specular_color glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_separate_specular_color)
+#define glatter_GL_EXT_shader_framebuffer_fetch glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_framebuffer_fetch)
+#define glatter_GL_EXT_shader_framebuffer_fetch_non_coherent glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_framebuffer_fetch_non_coherent)
+#define glatter_GL_EXT_shader_image_load_formatted glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_image_load_formatted)
+#define glatter_GL_EXT_shader_image_load_store glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_image_load_store)
+#define glatter_GL_EXT_shader_integer_mix glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_integer_mix)
+#define glatter_GL_EXT_shader_samples_identical glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shader_samples_identical)
+#define glatter_GL_EXT_shadow_funcs glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shadow_funcs)
+#define glatter_GL_EXT_shared_texture_palette glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_shared_texture_palette)
+#define glatter_GL_EXT_sparse_texture2 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_sparse_texture2)
+#define glatter_GL_EXT_stencil_clear_tag glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_stencil_clear_tag)
+#define glatter_GL_EXT_stencil_two_side glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_stencil_two_side)
+#define glatter_GL_EXT_stencil_wrap glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_stencil_wrap)
+#define glatter_GL_EXT_subtexture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_subtexture)
+#define glatter_GL_EXT_texture glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture)
+#define glatter_GL_EXT_texture3D glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture3D)
+#define glatter_GL_EXT_texture_array glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_array)
+#define glatter_GL_EXT_texture_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_buffer_object)
+#define glatter_GL_EXT_texture_compression_latc glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_latc)
+#define glatter_GL_EXT_texture_compression_rgtc glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_rgtc)
+#define glatter_GL_EXT_texture_compression_s3tc glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_compression_s3tc)
+#define glatter_GL_EXT_texture_cube_map glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_cube_map)
+#define glatter_GL_EXT_texture_env_add glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_env_add)
+#define glatter_GL_EXT_texture_env_combine glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_env_combine)
+#define glatter_GL_EXT_texture_env_dot3 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_env_dot3)
+#define glatter_GL_EXT_texture_filter_anisotropic glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_filter_anisotropic)
+#define glatter_GL_EXT_texture_filter_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_filter_minmax)
+#define glatter_GL_EXT_texture_integer glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_integer)
+#define glatter_GL_EXT_texture_lod_bias glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_lod_bias)
+#define glatter_GL_EXT_texture_mirror_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_mirror_clamp)
+#define glatter_GL_EXT_texture_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_object)
+#define glatter_GL_EXT_texture_perturb_normal glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_perturb_normal)
+#define glatter_GL_EXT_texture_sRGB glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB)
+#define glatter_GL_EXT_texture_sRGB_R8 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB_R8)
+#define glatter_GL_EXT_texture_sRGB_RG8 glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB_RG8)
+#define glatter_GL_EXT_texture_sRGB_decode glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_sRGB_decode)
+#define glatter_GL_EXT_texture_shadow_lod glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_shadow_lod)
+#define glatter_GL_EXT_texture_shared_exponent glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_shared_exponent)
+#define glatter_GL_EXT_texture_snorm glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_snorm)
+#define glatter_GL_EXT_texture_storage glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_storage)
+#define glatter_GL_EXT_texture_swizzle glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_texture_swizzle)
+#define glatter_GL_EXT_timer_query glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_timer_query)
+#define glatter_GL_EXT_transform_feedback glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_transform_feedback)
+#define glatter_GL_EXT_vertex_array glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_vertex_array)
+#define glatter_GL_EXT_vertex_array_bgra glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_vertex_array_bgra)
+#define glatter_GL_EXT_vertex_attrib_64bit glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_vertex_attrib_64bit)
+#define glatter_GL_EXT_vertex_shader glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_vertex_shader)
+#define glatter_GL_EXT_vertex_weighting glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_vertex_weighting)
+#define glatter_GL_EXT_win32_keyed_mutex glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_win32_keyed_mutex)
+#define glatter_GL_EXT_window_rectangles glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_window_rectangles)
+#define glatter_GL_EXT_x11_sync_object glatter_extension_supported_GL(GLATTER_EXT_GL_EXT_x11_sync_object)
+#define glatter_GL_GREMEDY_frame_terminator glatter_extension_supported_GL(GLATTER_EXT_GL_GREMEDY_frame_terminator)
+#define glatter_GL_GREMEDY_string_marker glatter_extension_supported_GL(GLATTER_EXT_GL_GREMEDY_string_marker)
+#define glatter_GL_HP_convolution_border_modes glatter_extension_supported_GL(GLATTER_EXT_GL_HP_convolution_border_modes)
+#define glatter_GL_HP_image_transform glatter_extension_supported_GL(GLATTER_EXT_GL_HP_image_transform)
+#define glatter_GL_HP_occlusion_test glatter_extension_supported_GL(GLATTER_EXT_GL_HP_occlusion_test)
+#define glatter_GL_HP_texture_lighting glatter_extension_supported_GL(GLATTER_EXT_GL_HP_texture_lighting)
+#define glatter_GL_IBM_cull_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_IBM_cull_vertex)
+#define glatter_GL_IBM_multimode_draw_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_IBM_multimode_draw_arrays)
+#define glatter_GL_IBM_rasterpos_clip glatter_extension_supported_GL(GLATTER_EXT_GL_IBM_rasterpos_clip)
+#define glatter_GL_IBM_static_data glatter_extension_supported_GL(GLATTER_EXT_GL_IBM_static_data)
+#define glatter_GL_IBM_texture_mirrored_repeat glatter_extension_supported_GL(GLATTER_EXT_GL_IBM_texture_mirrored_repeat)
+#define glatter_GL_IBM_vertex_array_lists glatter_extension_supported_GL(GLATTER_EXT_GL_IBM_vertex_array_lists)
+#define glatter_GL_INGR_blend_func_separate glatter_extension_supported_GL(GLATTER_EXT_GL_INGR_blend_func_separate)
+#define glatter_GL_INGR_color_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_INGR_color_clamp)
+#define glatter_GL_INGR_interlace_read glatter_extension_supported_GL(GLATTER_EXT_GL_INGR_interlace_read)
+#define glatter_GL_INTEL_blackhole_render glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_blackhole_render)
+#define glatter_GL_INTEL_conservative_rasterization glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_conservative_rasterization)
+#define glatter_GL_INTEL_fragment_shader_ordering glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_fragment_shader_ordering)
+#define glatter_GL_INTEL_framebuffer_CMAA glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_framebuffer_CMAA)
+#define glatter_GL_INTEL_map_texture glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_map_texture)
+#define glatter_GL_INTEL_parallel_arrays glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_parallel_arrays)
+#define glatter_GL_INTEL_performance_query glatter_extension_supported_GL(GLATTER_EXT_GL_INTEL_performance_query)
+#define glatter_GL_KHR_blend_equation_advanced glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_blend_equation_advanced)
+#define glatter_GL_KHR_blend_equation_advanced_coherent glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_blend_equation_advanced_coherent)
+#define glatter_GL_KHR_context_flush_control glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_context_flush_control)
+#define glatter_GL_KHR_debug glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_debug)
+#define glatter_GL_KHR_no_error glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_no_error)
+#define glatter_GL_KHR_parallel_shader_compile glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_parallel_shader_compile)
+#define glatter_GL_KHR_robust_buffer_access_behavior glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_robust_buffer_access_behavior)
+#define glatter_GL_KHR_robustness glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_robustness)
+#define glatter_GL_KHR_shader_subgroup glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_shader_subgroup)
+#define glatter_GL_KHR_texture_compression_astc_hdr glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_texture_compression_astc_hdr)
+#define glatter_GL_KHR_texture_compression_astc_ldr glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_texture_compression_astc_ldr)
+#define glatter_GL_KHR_texture_compression_astc_sliced_3d glatter_extension_supported_GL(GLATTER_EXT_GL_KHR_texture_compression_astc_sliced_3d)
+#define glatter_GL_MESAX_texture_stack glatter_extension_supported_GL(GLATTER_EXT_GL_MESAX_texture_stack)
+#define glatter_GL_MESA_framebuffer_flip_x glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_framebuffer_flip_x)
+#define glatter_GL_MESA_framebuffer_flip_y glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_framebuffer_flip_y)
+#define glatter_GL_MESA_framebuffer_swap_xy glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_framebuffer_swap_xy)
+#define glatter_GL_MESA_pack_invert glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_pack_invert)
+#define glatter_GL_MESA_program_binary_formats glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_program_binary_formats)
+#define glatter_GL_MESA_resize_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_resize_buffers)
+#define glatter_GL_MESA_shader_integer_functions glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_shader_integer_functions)
+#define glatter_GL_MESA_texture_const_bandwidth glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_texture_const_bandwidth)
+#define glatter_GL_MESA_tile_raster_order glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_tile_raster_order)
+#define glatter_GL_MESA_window_pos glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_window_pos)
+#define glatter_GL_MESA_ycbcr_texture glatter_extension_supported_GL(GLATTER_EXT_GL_MESA_ycbcr_texture)
+#define glatter_GL_NVX_blend_equation_advanced_multi_draw_buffers glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_blend_equation_advanced_multi_draw_buffers)
+#define glatter_GL_NVX_conditional_render glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_conditional_render)
+#define glatter_GL_NVX_gpu_memory_info glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_gpu_memory_info)
+#define glatter_GL_NVX_gpu_multicast2 glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_gpu_multicast2)
+#define glatter_GL_NVX_linked_gpu_multicast glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_linked_gpu_multicast)
+#define glatter_GL_NVX_progress_fence glatter_extension_supported_GL(GLATTER_EXT_GL_NVX_progress_fence)
+#define glatter_GL_NV_alpha_to_coverage_dither_control glatter_extension_supported_GL(GLATTER_EXT_GL_NV_alpha_to_coverage_dither_control)
+#define glatter_GL_NV_bindless_multi_draw_indirect glatter_extension_supported_GL(GLATTER_EXT_GL_NV_bindless_multi_draw_indirect)
+#define glatter_GL_NV_bindless_multi_draw_indirect_count glatter_extension_supported_GL(GLATTER_EXT_GL_NV_bindless_multi_draw_indirect_count)
+#define glatter_GL_NV_bindless_texture glatter_extension_supported_GL(GLATTER_EXT_GL_NV_bindless_texture)
+#define glatter_GL_NV_blend_equation_advanced glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_equation_advanced)
+#define glatter_GL_NV_blend_equation_advanced_coherent glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_equation_advanced_coherent)
+#define glatter_GL_NV_blend_minmax_factor glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_minmax_factor)
+#define glatter_GL_NV_blend_square glatter_extension_supported_GL(GLATTER_EXT_GL_NV_blend_square)
+#define glatter_GL_NV_clip_space_w_scaling glatter_extension_supported_GL(GLATTER_EXT_GL_NV_clip_space_w_scaling)
+#define glatter_GL_NV_command_list glatter_extension_supported_GL(GLATTER_EXT_GL_NV_command_list)
+#define glatter_GL_NV_compute_program5 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_compute_program5)
+#define glatter_GL_NV_compute_shader_derivatives glatter_extension_supported_GL(GLATTER_EXT_GL_NV_compute_shader_derivatives)
+#define glatter_GL_NV_conditional_render glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conditional_render)
+#define glatter_GL_NV_conservative_raster glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster)
+#define glatter_GL_NV_conservative_raster_dilate glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster_dilate)
+#define glatter_GL_NV_conservative_raster_pre_snap glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster_pre_snap)
+#define glatter_GL_NV_conservative_raster_pre_snap_triangles glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster_pre_snap_triangles)
+#define glatter_GL_NV_conservative_raster_underestimation glatter_extension_supported_GL(GLATTER_EXT_GL_NV_conservative_raster_underestimation)
+#define glatter_GL_NV_copy_depth_to_color glatter_extension_supported_GL(GLATTER_EXT_GL_NV_copy_depth_to_color)
+#define glatter_GL_NV_copy_image glatter_extension_supported_GL(GLATTER_EXT_GL_NV_copy_image)
+#define glatter_GL_NV_deep_texture3D glatter_extension_supported_GL(GLATTER_EXT_GL_NV_deep_texture3D)
+#define glatter_GL_NV_depth_buffer_float glatter_extension_supported_GL(GLATTER_EXT_GL_NV_depth_buffer_float)
+#define glatter_GL_NV_depth_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_NV_depth_clamp)
+#define glatter_GL_NV_draw_texture glatter_extension_supported_GL(GLATTER_EXT_GL_NV_draw_texture)
+#define glatter_GL_NV_draw_vulkan_image glatter_extension_supported_GL(GLATTER_EXT_GL_NV_draw_vulkan_image)
+#define glatter_GL_NV_evaluators glatter_extension_supported_GL(GLATTER_EXT_GL_NV_evaluators)
+#define glatter_GL_NV_explicit_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_NV_explicit_multisample)
+#define glatter_GL_NV_fence glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fence)
+#define glatter_GL_NV_fill_rectangle glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fill_rectangle)
+#define glatter_GL_NV_float_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_NV_float_buffer)
+#define glatter_GL_NV_fog_distance glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fog_distance)
+#define glatter_GL_NV_fragment_coverage_to_color glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_coverage_to_color)
+#define glatter_GL_NV_fragment_program glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_program)
+#define glatter_GL_NV_fragment_program2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_program2)
+#define glatter_GL_NV_fragment_program4 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_program4)
+#define glatter_GL_NV_fragment_program_option glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_program_option)
+#define glatter_GL_NV_fragment_shader_barycentric glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_shader_barycentric)
+#define glatter_GL_NV_fragment_shader_interlock glatter_extension_supported_GL(GLATTER_EXT_GL_NV_fragment_shader_interlock)
+#define glatter_GL_NV_framebuffer_mixed_samples glatter_extension_supported_GL(GLATTER_EXT_GL_NV_framebuffer_mixed_samples)
+#define glatter_GL_NV_framebuffer_multisample_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_NV_framebuffer_multisample_coverage)
+#define glatter_GL_NV_geometry_program4 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_geometry_program4)
+#define glatter_GL_NV_geometry_shader4 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_geometry_shader4)
+#define glatter_GL_NV_geometry_shader_passthrough glatter_extension_supported_GL(GLATTER_EXT_GL_NV_geometry_shader_passthrough)
+#define glatter_GL_NV_gpu_multicast glatter_extension_supported_GL(GLATTER_EXT_GL_NV_gpu_multicast)
+#define glatter_GL_NV_gpu_program4 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_gpu_program4)
+#define glatter_GL_NV_gpu_program5 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_gpu_program5)
+#define glatter_GL_NV_gpu_program5_mem_extended glatter_extension_supported_GL(GLATTER_EXT_GL_NV_gpu_program5_mem_extended)
+#define glatter_GL_NV_gpu_shader5 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_gpu_shader5)
+#define glatter_GL_NV_half_float glatter_extension_supported_GL(GLATTER_EXT_GL_NV_half_float)
+#define glatter_GL_NV_internalformat_sample_query glatter_extension_supported_GL(GLATTER_EXT_GL_NV_internalformat_sample_query)
+#define glatter_GL_NV_light_max_exponent glatter_extension_supported_GL(GLATTER_EXT_GL_NV_light_max_exponent)
+#define glatter_GL_NV_memory_attachment glatter_extension_supported_GL(GLATTER_EXT_GL_NV_memory_attachment)
+#define glatter_GL_NV_memory_object_sparse glatter_extension_supported_GL(GLATTER_EXT_GL_NV_memory_object_sparse)
+#define glatter_GL_NV_mesh_shader glatter_extension_supported_GL(GLATTER_EXT_GL_NV_mesh_shader)
+#define glatter_GL_NV_multisample_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_NV_multisample_coverage)
+#define glatter_GL_NV_multisample_filter_hint glatter_extension_supported_GL(GLATTER_EXT_GL_NV_multisample_filter_hint)
+#define glatter_GL_NV_occlusion_query glatter_extension_supported_GL(GLATTER_EXT_GL_NV_occlusion_query)
+#define glatter_GL_NV_packed_depth_stencil glatter_extension_supported_GL(GLATTER_EXT_GL_NV_packed_depth_stencil)
+#define glatter_GL_NV_parameter_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_NV_parameter_buffer_object)
+#define glatter_GL_NV_parameter_buffer_object2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_parameter_buffer_object2)
+#define glatter_GL_NV_path_rendering glatter_extension_supported_GL(GLATTER_EXT_GL_NV_path_rendering)
+#define glatter_GL_NV_path_rendering_shared_edge glatter_extension_supported_GL(GLATTER_EXT_GL_NV_path_rendering_shared_edge)
+#define glatter_GL_NV_pixel_data_range glatter_extension_supported_GL(GLATTER_EXT_GL_NV_pixel_data_range)
+#define glatter_GL_NV_point_sprite glatter_extension_supported_GL(GLATTER_EXT_GL_NV_point_sprite)
+#define glatter_GL_NV_present_video glatter_extension_supported_GL(GLATTER_EXT_GL_NV_present_video)
+#define glatter_GL_NV_primitive_restart glatter_extension_supported_GL(GLATTER_EXT_GL_NV_primitive_restart)
+#define glatter_GL_NV_primitive_shading_rate glatter_extension_supported_GL(GLATTER_EXT_GL_NV_primitive_shading_rate)
+#define glatter_GL_NV_query_resource glatter_extension_supported_GL(GLATTER_EXT_GL_NV_query_resource)
+#define glatter_GL_NV_query_resource_tag glatter_extension_supported_GL(GLATTER_EXT_GL_NV_query_resource_tag)
+#define glatter_GL_NV_register_combiners glatter_extension_supported_GL(GLATTER_EXT_GL_NV_register_combiners)
+#define glatter_GL_NV_register_combiners2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_register_combiners2)
+#define glatter_GL_NV_representative_fragment_test glatter_extension_supported_GL(GLATTER_EXT_GL_NV_representative_fragment_test)
+#define glatter_GL_NV_robustness_video_memory_purge glatter_extension_supported_GL(GLATTER_EXT_GL_NV_robustness_video_memory_purge)
+#define glatter_GL_NV_sample_locations glatter_extension_supported_GL(GLATTER_EXT_GL_NV_sample_locations)
+#define glatter_GL_NV_sample_mask_override_coverage glatter_extension_supported_GL(GLATTER_EXT_GL_NV_sample_mask_override_coverage)
+#define glatter_GL_NV_scissor_exclusive glatter_extension_supported_GL(GLATTER_EXT_GL_NV_scissor_exclusive)
+#define glatter_GL_NV_shader_atomic_counters glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_atomic_counters)
+#define glatter_GL_NV_shader_atomic_float glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_atomic_float)
+#define glatter_GL_NV_shader_atomic_float64 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_atomic_float64)
+#define glatter_GL_NV_shader_atomic_fp16_vector glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_atomic_fp16_vector)
+#define glatter_GL_NV_shader_atomic_int64 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_atomic_int64)
+#define glatter_GL_NV_shader_buffer_load glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_buffer_load)
+#define glatter_GL_NV_shader_buffer_store glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_buffer_store)
+#define glatter_GL_NV_shader_storage_buffer_object glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_storage_buffer_object)
+#define glatter_GL_NV_shader_subgroup_partitioned glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_subgroup_partitioned)
+#define glatter_GL_NV_shader_texture_footprint glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_texture_footprint)
+#define glatter_GL_NV_shader_thread_group glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_thread_group)
+#define glatter_GL_NV_shader_thread_shuffle glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shader_thread_shuffle)
+#define glatter_GL_NV_shading_rate_image glatter_extension_supported_GL(GLATTER_EXT_GL_NV_shading_rate_image)
+#define glatter_GL_NV_stereo_view_rendering glatter_extension_supported_GL(GLATTER_EXT_GL_NV_stereo_view_rendering)
+#define glatter_GL_NV_tessellation_program5 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_tessellation_program5)
+#define glatter_GL_NV_texgen_emboss glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texgen_emboss)
+#define glatter_GL_NV_texgen_reflection glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texgen_reflection)
+#define glatter_GL_NV_texture_barrier glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_barrier)
+#define glatter_GL_NV_texture_compression_vtc glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_compression_vtc)
+#define glatter_GL_NV_texture_env_combine4 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_env_combine4)
+#define glatter_GL_NV_texture_expand_normal glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_expand_normal)
+#define glatter_GL_NV_texture_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_multisample)
+#define glatter_GL_NV_texture_rectangle glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_rectangle)
+#define glatter_GL_NV_texture_rectangle_compressed glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_rectangle_compressed)
+#define glatter_GL_NV_texture_shader glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_shader)
+#define glatter_GL_NV_texture_shader2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_shader2)
+#define glatter_GL_NV_texture_shader3 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_texture_shader3)
+#define glatter_GL_NV_timeline_semaphore glatter_extension_supported_GL(GLATTER_EXT_GL_NV_timeline_semaphore)
+#define glatter_GL_NV_transform_feedback glatter_extension_supported_GL(GLATTER_EXT_GL_NV_transform_feedback)
+#define glatter_GL_NV_transform_feedback2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_transform_feedback2)
+#define glatter_GL_NV_uniform_buffer_std430_layout glatter_extension_supported_GL(GLATTER_EXT_GL_NV_uniform_buffer_std430_layout)
+#define glatter_GL_NV_uniform_buffer_unified_memory glatter_extension_supported_GL(GLATTER_EXT_GL_NV_uniform_buffer_unified_memory)
+#define glatter_GL_NV_vdpau_interop glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vdpau_interop)
+#define glatter_GL_NV_vdpau_interop2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vdpau_interop2)
+#define glatter_GL_NV_vertex_array_range glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_array_range)
+#define glatter_GL_NV_vertex_array_range2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_array_range2)
+#define glatter_GL_NV_vertex_attrib_integer_64bit glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_attrib_integer_64bit)
+#define glatter_GL_NV_vertex_buffer_unified_memory glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_buffer_unified_memory)
+#define glatter_GL_NV_vertex_program glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_program)
+#define glatter_GL_NV_vertex_program1_1 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_program1_1)
+#define glatter_GL_NV_vertex_program2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_program2)
+#define glatter_GL_NV_vertex_program2_option glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_program2_option)
+#define glatter_GL_NV_vertex_program3 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_program3)
+#define glatter_GL_NV_vertex_program4 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_vertex_program4)
+#define glatter_GL_NV_video_capture glatter_extension_supported_GL(GLATTER_EXT_GL_NV_video_capture)
+#define glatter_GL_NV_viewport_array2 glatter_extension_supported_GL(GLATTER_EXT_GL_NV_viewport_array2)
+#define glatter_GL_NV_viewport_swizzle glatter_extension_supported_GL(GLATTER_EXT_GL_NV_viewport_swizzle)
+#define glatter_GL_OES_byte_coordinates glatter_extension_supported_GL(GLATTER_EXT_GL_OES_byte_coordinates)
+#define glatter_GL_OES_compressed_paletted_texture glatter_extension_supported_GL(GLATTER_EXT_GL_OES_compressed_paletted_texture)
+#define glatter_GL_OES_fixed_point glatter_extension_supported_GL(GLATTER_EXT_GL_OES_fixed_point)
+#define glatter_GL_OES_query_matrix glatter_extension_supported_GL(GLATTER_EXT_GL_OES_query_matrix)
+#define glatter_GL_OES_read_format glatter_extension_supported_GL(GLATTER_EXT_GL_OES_read_format)
+#define glatter_GL_OES_single_precision glatter_extension_supported_GL(GLATTER_EXT_GL_OES_single_precision)
+#define glatter_GL_OML_interlace glatter_extension_supported_GL(GLATTER_EXT_GL_OML_interlace)
+#define glatter_GL_OML_resample glatter_extension_supported_GL(GLATTER_EXT_GL_OML_resample)
+#define glatter_GL_OML_subsample glatter_extension_supported_GL(GLATTER_EXT_GL_OML_subsample)
+#define glatter_GL_OVR_multiview glatter_extension_supported_GL(GLATTER_EXT_GL_OVR_multiview)
+#define glatter_GL_OVR_multiview2 glatter_extension_supported_GL(GLATTER_EXT_GL_OVR_multiview2)
+#define glatter_GL_PGI_misc_hints glatter_extension_supported_GL(GLATTER_EXT_GL_PGI_misc_hints)
+#define glatter_GL_PGI_vertex_hints glatter_extension_supported_GL(GLATTER_EXT_GL_PGI_vertex_hints)
+#define glatter_GL_REND_screen_coordinates glatter_extension_supported_GL(GLATTER_EXT_GL_REND_screen_coordinates)
+#define glatter_GL_S3_s3tc glatter_extension_supported_GL(GLATTER_EXT_GL_S3_s3tc)
+#define glatter_GL_SGIS_detail_texture glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_detail_texture)
+#define glatter_GL_SGIS_fog_function glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_fog_function)
+#define glatter_GL_SGIS_generate_mipmap glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_generate_mipmap)
+#define glatter_GL_SGIS_multisample glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_multisample)
+#define glatter_GL_SGIS_pixel_texture glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_pixel_texture)
+#define glatter_GL_SGIS_point_line_texgen glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_point_line_texgen)
+#define glatter_GL_SGIS_point_parameters glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_point_parameters)
+#define glatter_GL_SGIS_sharpen_texture glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_sharpen_texture)
+#define glatter_GL_SGIS_texture4D glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture4D)
+#define glatter_GL_SGIS_texture_border_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture_border_clamp)
+#define glatter_GL_SGIS_texture_color_mask glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture_color_mask)
+#define glatter_GL_SGIS_texture_edge_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture_edge_clamp)
+#define glatter_GL_SGIS_texture_filter4 glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture_filter4)
+#define glatter_GL_SGIS_texture_lod glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture_lod)
+#define glatter_GL_SGIS_texture_select glatter_extension_supported_GL(GLATTER_EXT_GL_SGIS_texture_select)
+#define glatter_GL_SGIX_async glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_async)
+#define glatter_GL_SGIX_async_histogram glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_async_histogram)
+#define glatter_GL_SGIX_async_pixel glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_async_pixel)
+#define glatter_GL_SGIX_blend_alpha_minmax glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_blend_alpha_minmax)
+#define glatter_GL_SGIX_calligraphic_fragment glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_calligraphic_fragment)
+#define glatter_GL_SGIX_clipmap glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_clipmap)
+#define glatter_GL_SGIX_convolution_accuracy glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_convolution_accuracy)
+#define glatter_GL_SGIX_depth_pass_instrument glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_depth_pass_instrument)
+#define glatter_GL_SGIX_depth_texture glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_depth_texture)
+#define glatter_GL_SGIX_flush_raster glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_flush_raster)
+#define glatter_GL_SGIX_fog_offset glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_fog_offset)
+#define glatter_GL_SGIX_fragment_lighting glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_fragment_lighting)
+#define glatter_GL_SGIX_framezoom glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_framezoom)
+#define glatter_GL_SGIX_igloo_interface glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_igloo_interface)
+#define glatter_GL_SGIX_instruments glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_instruments)
+#define glatter_GL_SGIX_interlace glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_interlace)
+#define glatter_GL_SGIX_ir_instrument1 glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_ir_instrument1)
+#define glatter_GL_SGIX_list_priority glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_list_priority)
+#define glatter_GL_SGIX_pixel_texture glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_pixel_texture)
+#define glatter_GL_SGIX_pixel_tiles glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_pixel_tiles)
+#define glatter_GL_SGIX_polynomial_ffd glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_polynomial_ffd)
+#define glatter_GL_SGIX_reference_plane glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_reference_plane)
+#define glatter_GL_SGIX_resample glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_resample)
+#define glatter_GL_SGIX_scalebias_hint glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_scalebias_hint)
+#define glatter_GL_SGIX_shadow glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_shadow)
+#define glatter_GL_SGIX_shadow_ambient glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_shadow_ambient)
+#define glatter_GL_SGIX_sprite glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_sprite)
+#define glatter_GL_SGIX_subsample glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_subsample)
+#define glatter_GL_SGIX_tag_sample_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_tag_sample_buffer)
+#define glatter_GL_SGIX_texture_add_env glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_texture_add_env)
+#define glatter_GL_SGIX_texture_coordinate_clamp glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_texture_coordinate_clamp)
+#define glatter_GL_SGIX_texture_lod_bias glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_texture_lod_bias)
+#define glatter_GL_SGIX_texture_multi_buffer glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_texture_multi_buffer)
+#define glatter_GL_SGIX_texture_scale_bias glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_texture_scale_bias)
+#define glatter_GL_SGIX_vertex_preclip glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_vertex_preclip)
+#define glatter_GL_SGIX_ycrcb glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_ycrcb)
+#define glatter_GL_SGIX_ycrcb_subsample glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_ycrcb_subsample)
+#define glatter_GL_SGIX_ycrcba glatter_extension_supported_GL(GLATTER_EXT_GL_SGIX_ycrcba)
+#define glatter_GL_SGI_color_matrix glatter_extension_supported_GL(GLATTER_EXT_GL_SGI_color_matrix)
+#define glatter_GL_SGI_color_table glatter_extension_supported_GL(GLATTER_EXT_GL_SGI_color_table)
+#define glatter_GL_SGI_texture_color_table glatter_extension_supported_GL(GLATTER_EXT_GL_SGI_texture_color_table)
+#define glatter_GL_SUNX_constant_data glatter_extension_supported_GL(GLATTER_EXT_GL_SUNX_constant_data)
+#define glatter_GL_SUN_convolution_border_modes glatter_extension_supported_GL(GLATTER_EXT_GL_SUN_convolution_border_modes)
+#define glatter_GL_SUN_global_alpha glatter_extension_supported_GL(GLATTER_EXT_GL_SUN_global_alpha)
+#define glatter_GL_SUN_mesh_array glatter_extension_supported_GL(GLATTER_EXT_GL_SUN_mesh_array)
+#define glatter_GL_SUN_slice_accum glatter_extension_supported_GL(GLATTER_EXT_GL_SUN_slice_accum)
+#define glatter_GL_SUN_triangle_list glatter_extension_supported_GL(GLATTER_EXT_GL_SUN_triangle_list)
+#define glatter_GL_SUN_vertex glatter_extension_supported_GL(GLATTER_EXT_GL_SUN_vertex)
+#define glatter_GL_WIN_phong_shading glatter_extension_supported_GL(GLATTER_EXT_GL_WIN_phong_shading)
+#define glatter_GL_WIN_specular_fog glatter_extension_supported_GL(GLATTER_EXT_GL_WIN_specular_fog)
 
 
-#define glatter_GL_3DFX_multisample glatter_get_extension_support_GL().has_GL_3DFX_multisample
-#define glatter_GL_3DFX_tbuffer glatter_get_extension_support_GL().has_GL_3DFX_tbuffer
-#define glatter_GL_3DFX_texture_compression_FXT1 glatter_get_extension_support_GL().has_GL_3DFX_texture_compression_FXT1
-#define glatter_GL_AMD_blend_minmax_factor glatter_get_extension_support_GL().has_GL_AMD_blend_minmax_factor
-#define glatter_GL_AMD_conservative_depth glatter_get_extension_support_GL().has_GL_AMD_conservative_depth
-#define glatter_GL_AMD_debug_output glatter_get_extension_support_GL().has_GL_AMD_debug_output
-#define glatter_GL_AMD_depth_clamp_separate glatter_get_extension_support_GL().has_GL_AMD_depth_clamp_separate
-#define glatter_GL_AMD_draw_buffers_blend glatter_get_extension_support_GL().has_GL_AMD_draw_buffers_blend
-#define glatter_GL_AMD_framebuffer_multisample_advanced glatter_get_extension_support_GL().has_GL_AMD_framebuffer_multisample_advanced
-#define glatter_GL_AMD_framebuffer_sample_positions glatter_get_extension_support_GL().has_GL_AMD_framebuffer_sample_positions
-#define glatter_GL_AMD_gcn_shader glatter_get_extension_support_GL().has_GL_AMD_gcn_shader
-#define glatter_GL_AMD_gpu_shader_half_float glatter_get_extension_support_GL().has_GL_AMD_gpu_shader_half_float
-#define glatter_GL_AMD_gpu_shader_int16 glatter_get_extension_support_GL().has_GL_AMD_gpu_shader_int16
-#define glatter_GL_AMD_gpu_shader_int64 glatter_get_extension_support_GL().has_GL_AMD_gpu_shader_int64
-#define glatter_GL_AMD_interleaved_elements glatter_get_extension_support_GL().has_GL_AMD_interleaved_elements
-#define glatter_GL_AMD_multi_draw_indirect glatter_get_extension_support_GL().has_GL_AMD_multi_draw_indirect
-#define glatter_GL_AMD_name_gen_delete glatter_get_extension_support_GL().has_GL_AMD_name_gen_delete
-#define glatter_GL_AMD_occlusion_query_event glatter_get_extension_support_GL().has_GL_AMD_occlusion_query_event
-#define glatter_GL_AMD_performance_monitor glatter_get_extension_support_GL().has_GL_AMD_performance_monitor
-#define glatter_GL_AMD_pinned_memory glatter_get_extension_support_GL().has_GL_AMD_pinned_memory
-#define glatter_GL_AMD_query_buffer_object glatter_get_extension_support_GL().has_GL_AMD_query_buffer_object
-#define glatter_GL_AMD_sample_positions glatter_get_extension_support_GL().has_GL_AMD_sample_positions
-#define glatter_GL_AMD_seamless_cubemap_per_texture glatter_get_extension_support_GL().has_GL_AMD_seamless_cubemap_per_texture
-#define glatter_GL_AMD_shader_atomic_counter_ops glatter_get_extension_support_GL().has_GL_AMD_shader_atomic_counter_ops
-#define glatter_GL_AMD_shader_ballot glatter_get_extension_support_GL().has_GL_AMD_shader_ballot
-#define glatter_GL_AMD_shader_explicit_vertex_parameter glatter_get_extension_support_GL().has_GL_AMD_shader_explicit_vertex_parameter
-#define glatter_GL_AMD_shader_gpu_shader_half_float_fetch glatter_get_extension_support_GL().has_GL_AMD_shader_gpu_shader_half_float_fetch
-#define glatter_GL_AMD_shader_image_load_store_lod glatter_get_extension_support_GL().has_GL_AMD_shader_image_load_store_lod
-#define glatter_GL_AMD_shader_stencil_export glatter_get_extension_support_GL().has_GL_AMD_shader_stencil_export
-#define glatter_GL_AMD_shader_trinary_minmax glatter_get_extension_support_GL().has_GL_AMD_shader_trinary_minmax
-#define glatter_GL_AMD_sparse_texture glatter_get_extension_support_GL().has_GL_AMD_sparse_texture
-#define glatter_GL_AMD_stencil_operation_extended glatter_get_extension_support_GL().has_GL_AMD_stencil_operation_extended
-#define glatter_GL_AMD_texture_gather_bias_lod glatter_get_extension_support_GL().has_GL_AMD_texture_gather_bias_lod
-#define glatter_GL_AMD_texture_texture4 glatter_get_extension_support_GL().has_GL_AMD_texture_texture4
-#define glatter_GL_AMD_transform_feedback3_lines_triangles glatter_get_extension_support_GL().has_GL_AMD_transform_feedback3_lines_triangles
-#define glatter_GL_AMD_transform_feedback4 glatter_get_extension_support_GL().has_GL_AMD_transform_feedback4
-#define glatter_GL_AMD_vertex_shader_layer glatter_get_extension_support_GL().has_GL_AMD_vertex_shader_layer
-#define glatter_GL_AMD_vertex_shader_tessellator glatter_get_extension_support_GL().has_GL_AMD_vertex_shader_tessellator
-#define glatter_GL_AMD_vertex_shader_viewport_index glatter_get_extension_support_GL().has_GL_AMD_vertex_shader_viewport_index
-#define glatter_GL_APPLE_aux_depth_stencil glatter_get_extension_support_GL().has_GL_APPLE_aux_depth_stencil
-#define glatter_GL_APPLE_client_storage glatter_get_extension_support_GL().has_GL_APPLE_client_storage
-#define glatter_GL_APPLE_element_array glatter_get_extension_support_GL().has_GL_APPLE_element_array
-#define glatter_GL_APPLE_fence glatter_get_extension_support_GL().has_GL_APPLE_fence
-#define glatter_GL_APPLE_float_pixels glatter_get_extension_support_GL().has_GL_APPLE_float_pixels
-#define glatter_GL_APPLE_flush_buffer_range glatter_get_extension_support_GL().has_GL_APPLE_flush_buffer_range
-#define glatter_GL_APPLE_object_purgeable glatter_get_extension_support_GL().has_GL_APPLE_object_purgeable
-#define glatter_GL_APPLE_rgb_422 glatter_get_extension_support_GL().has_GL_APPLE_rgb_422
-#define glatter_GL_APPLE_row_bytes glatter_get_extension_support_GL().has_GL_APPLE_row_bytes
-#define glatter_GL_APPLE_specular_vector glatter_get_extension_support_GL().has_GL_APPLE_specular_vector
-#define glatter_GL_APPLE_texture_range glatter_get_extension_support_GL().has_GL_APPLE_texture_range
-#define glatter_GL_APPLE_transform_hint glatter_get_extension_support_GL().has_GL_APPLE_transform_hint
-#define glatter_GL_APPLE_vertex_array_object glatter_get_extension_support_GL().has_GL_APPLE_vertex_array_object
-#define glatter_GL_APPLE_vertex_array_range glatter_get_extension_support_GL().has_GL_APPLE_vertex_array_range
-#define glatter_GL_APPLE_vertex_program_evaluators glatter_get_extension_support_GL().has_GL_APPLE_vertex_program_evaluators
-#define glatter_GL_APPLE_ycbcr_422 glatter_get_extension_support_GL().has_GL_APPLE_ycbcr_422
-#define glatter_GL_ARB_ES2_compatibility glatter_get_extension_support_GL().has_GL_ARB_ES2_compatibility
-#define glatter_GL_ARB_ES3_1_compatibility glatter_get_extension_support_GL().has_GL_ARB_ES3_1_compatibility
-#define glatter_GL_ARB_ES3_2_compatibility glatter_get_extension_support_GL().has_GL_ARB_ES3_2_compatibility
-#define glatter_GL_ARB_ES3_compatibility glatter_get_extension_support_GL().has_GL_ARB_ES3_compatibility
-#define glatter_GL_ARB_arrays_of_arrays glatter_get_extension_support_GL().has_GL_ARB_arrays_of_arrays
-#define glatter_GL_ARB_base_instance glatter_get_extension_support_GL().has_GL_ARB_base_instance
-#define glatter_GL_ARB_bindless_texture glatter_get_extension_support_GL().has_GL_ARB_bindless_texture
-#define glatter_GL_ARB_blend_func_extended glatter_get_extension_support_GL().has_GL_ARB_blend_func_extended
-#define glatter_GL_ARB_buffer_storage glatter_get_extension_support_GL().has_GL_ARB_buffer_storage
-#define glatter_GL_ARB_cl_event glatter_get_extension_support_GL().has_GL_ARB_cl_event
-#define glatter_GL_ARB_clear_buffer_object glatter_get_extension_support_GL().has_GL_ARB_clear_buffer_object
-#define glatter_GL_ARB_clear_texture glatter_get_extension_support_GL().has_GL_ARB_clear_texture
-#define glatter_GL_ARB_clip_control glatter_get_extension_support_GL().has_GL_ARB_clip_control
-#define glatter_GL_ARB_color_buffer_float glatter_get_extension_support_GL().has_GL_ARB_color_buffer_float
-#define glatter_GL_ARB_compatibility glatter_get_extension_support_GL().has_GL_ARB_compatibility
-#define glatter_GL_ARB_compressed_texture_pixel_storage glatter_get_extension_support_GL().has_GL_ARB_compressed_texture_pixel_storage
-#define glatter_GL_ARB_compute_shader glatter_get_extension_support_GL().has_GL_ARB_compute_shader
-#define glatter_GL_ARB_compute_variable_group_size glatter_get_extension_support_GL().has_GL_ARB_compute_variable_group_size
-#define glatter_GL_ARB_conditional_render_inverted glatter_get_extension_support_GL().has_GL_ARB_conditional_render_inverted
-#define glatter_GL_ARB_conservative_depth glatter_get_extension_support_GL().has_GL_ARB_conservative_depth
-#define glatter_GL_ARB_copy_buffer glatter_get_extension_support_GL().has_GL_ARB_copy_buffer
-#define glatter_GL_ARB_copy_image glatter_get_extension_support_GL().has_GL_ARB_copy_image
-#define glatter_GL_ARB_cull_distance glatter_get_extension_support_GL().has_GL_ARB_cull_distance
-#define glatter_GL_ARB_debug_output glatter_get_extension_support_GL().has_GL_ARB_debug_output
-#define glatter_GL_ARB_depth_buffer_float glatter_get_extension_support_GL().has_GL_ARB_depth_buffer_float
-#define glatter_GL_ARB_depth_clamp glatter_get_extension_support_GL().has_GL_ARB_depth_clamp
-#define glatter_GL_ARB_depth_texture glatter_get_extension_support_GL().has_GL_ARB_depth_texture
-#define glatter_GL_ARB_derivative_control glatter_get_extension_support_GL().has_GL_ARB_derivative_control
-#define glatter_GL_ARB_direct_state_access glatter_get_extension_support_GL().has_GL_ARB_direct_state_access
-#define glatter_GL_ARB_draw_buffers glatter_get_extension_support_GL().has_GL_ARB_draw_buffers
-#define glatter_GL_ARB_draw_buffers_blend glatter_get_extension_support_GL().has_GL_ARB_draw_buffers_blend
-#define glatter_GL_ARB_draw_elements_base_vertex glatter_get_extension_support_GL().has_GL_ARB_draw_elements_base_vertex
-#define glatter_GL_ARB_draw_indirect glatter_get_extension_support_GL().has_GL_ARB_draw_indirect
-#define glatter_GL_ARB_draw_instanced glatter_get_extension_support_GL().has_GL_ARB_draw_instanced
-#define glatter_GL_ARB_enhanced_layouts glatter_get_extension_support_GL().has_GL_ARB_enhanced_layouts
-#define glatter_GL_ARB_explicit_attrib_location glatter_get_extension_support_GL().has_GL_ARB_explicit_attrib_location
-#define glatter_GL_ARB_explicit_uniform_location glatter_get_extension_support_GL().has_GL_ARB_explicit_uniform_location
-#define glatter_GL_ARB_fragment_coord_conventions glatter_get_extension_support_GL().has_GL_ARB_fragment_coord_conventions
-#define glatter_GL_ARB_fragment_layer_viewport glatter_get_extension_support_GL().has_GL_ARB_fragment_layer_viewport
-#define glatter_GL_ARB_fragment_program glatter_get_extension_support_GL().has_GL_ARB_fragment_program
-#define glatter_GL_ARB_fragment_program_shadow glatter_get_extension_support_GL().has_GL_ARB_fragment_program_shadow
-#define glatter_GL_ARB_fragment_shader glatter_get_extension_support_GL().has_GL_ARB_fragment_shader
-#define glatter_GL_ARB_fragment_shader_interlock glatter_get_extension_support_GL().has_GL_ARB_fragment_shader_interlock
-#define glatter_GL_ARB_framebuffer_no_attachments glatter_get_extension_support_GL().has_GL_ARB_framebuffer_no_attachments
-#define glatter_GL_ARB_framebuffer_object glatter_get_extension_support_GL().has_GL_ARB_framebuffer_object
-#define glatter_GL_ARB_framebuffer_sRGB glatter_get_extension_support_GL().has_GL_ARB_framebuffer_sRGB
-#define glatter_GL_ARB_geometry_shader4 glatter_get_extension_support_GL().has_GL_ARB_geometry_shader4
-#define glatter_GL_ARB_get_program_binary glatter_get_extension_support_GL().has_GL_ARB_get_program_binary
-#define glatter_GL_ARB_get_texture_sub_image glatter_get_extension_support_GL().has_GL_ARB_get_texture_sub_image
-#define glatter_GL_ARB_gl_spirv glatter_get_extension_support_GL().has_GL_ARB_gl_spirv
-#define glatter_GL_ARB_gpu_shader5 glatter_get_extension_support_GL().has_GL_ARB_gpu_shader5
-#define glatter_GL_ARB_gpu_shader_fp64 glatter_get_extension_support_GL().has_GL_ARB_gpu_shader_fp64
-#define glatter_GL_ARB_gpu_shader_int64 glatter_get_extension_support_GL().has_GL_ARB_gpu_shader_int64
-#define glatter_GL_ARB_half_float_pixel glatter_get_extension_support_GL().has_GL_ARB_half_float_pixel
-#define glatter_GL_ARB_half_float_vertex glatter_get_extension_support_GL().has_GL_ARB_half_float_vertex
-#define glatter_GL_ARB_imaging glatter_get_extension_support_GL().has_GL_ARB_imaging
-#define glatter_GL_ARB_indirect_parameters glatter_get_extension_support_GL().has_GL_ARB_indirect_parameters
-#define glatter_GL_ARB_instanced_arrays glatter_get_extension_support_GL().has_GL_ARB_instanced_arrays
-#define glatter_GL_ARB_internalformat_query glatter_get_extension_support_GL().has_GL_ARB_internalformat_query
-#define glatter_GL_ARB_internalformat_query2 glatter_get_extension_support_GL().has_GL_ARB_internalformat_query2
-#define glatter_GL_ARB_invalidate_subdata glatter_get_extension_support_GL().has_GL_ARB_invalidate_subdata
-#define glatter_GL_ARB_map_buffer_alignment glatter_get_extension_support_GL().has_GL_ARB_map_buffer_alignment
-#define glatter_GL_ARB_map_buffer_range glatter_get_extension_support_GL().has_GL_ARB_map_buffer_range
-#define glatter_GL_ARB_matrix_palette glatter_get_extension_support_GL().has_GL_ARB_matrix_palette
-#define glatter_GL_ARB_multi_bind glatter_get_extension_support_GL().has_GL_ARB_multi_bind
-#define glatter_GL_ARB_multi_draw_indirect glatter_get_extension_support_GL().has_GL_ARB_multi_draw_indirect
-#define glatter_GL_ARB_multisample glatter_get_extension_support_GL().has_GL_ARB_multisample
-#define glatter_GL_ARB_multitexture glatter_get_extension_support_GL().has_GL_ARB_multitexture
-#define glatter_GL_ARB_occlusion_query glatter_get_extension_support_GL().has_GL_ARB_occlusion_query
-#define glatter_GL_ARB_occlusion_query2 glatter_get_extension_support_GL().has_GL_ARB_occlusion_query2
-#define glatter_GL_ARB_parallel_shader_compile glatter_get_extension_support_GL().has_GL_ARB_parallel_shader_compile
-#define glatter_GL_ARB_pipeline_statistics_query glatter_get_extension_support_GL().has_GL_ARB_pipeline_statistics_query
-#define glatter_GL_ARB_pixel_buffer_object glatter_get_extension_support_GL().has_GL_ARB_pixel_buffer_object
-#define glatter_GL_ARB_point_parameters glatter_get_extension_support_GL().has_GL_ARB_point_parameters
-#define glatter_GL_ARB_point_sprite glatter_get_extension_support_GL().has_GL_ARB_point_sprite
-#define glatter_GL_ARB_polygon_offset_clamp glatter_get_extension_support_GL().has_GL_ARB_polygon_offset_clamp
-#define glatter_GL_ARB_post_depth_coverage glatter_get_extension_support_GL().has_GL_ARB_post_depth_coverage
-#define glatter_GL_ARB_program_interface_query glatter_get_extension_support_GL().has_GL_ARB_program_interface_query
-#define glatter_GL_ARB_provoking_vertex glatter_get_extension_support_GL().has_GL_ARB_provoking_vertex
-#define glatter_GL_ARB_query_buffer_object glatter_get_extension_support_GL().has_GL_ARB_query_buffer_object
-#define glatter_GL_ARB_robust_buffer_access_behavior glatter_get_extension_support_GL().has_GL_ARB_robust_buffer_access_behavior
-#define glatter_GL_ARB_robustness glatter_get_extension_support_GL().has_GL_ARB_robustness
-#define glatter_GL_ARB_robustness_isolation glatter_get_extension_support_GL().has_GL_ARB_robustness_isolation
-#define glatter_GL_ARB_sample_locations glatter_get_extension_support_GL().has_GL_ARB_sample_locations
-#define glatter_GL_ARB_sample_shading glatter_get_extension_support_GL().has_GL_ARB_sample_shading
-#define glatter_GL_ARB_sampler_objects glatter_get_extension_support_GL().has_GL_ARB_sampler_objects
-#define glatter_GL_ARB_seamless_cube_map glatter_get_extension_support_GL().has_GL_ARB_seamless_cube_map
-#define glatter_GL_ARB_seamless_cubemap_per_texture glatter_get_extension_support_GL().has_GL_ARB_seamless_cubemap_per_texture
-#define glatter_GL_ARB_separate_shader_objects glatter_get_extension_support_GL().has_GL_ARB_separate_shader_objects
-#define glatter_GL_ARB_shader_atomic_counter_ops glatter_get_extension_support_GL().has_GL_ARB_shader_atomic_counter_ops
-#define glatter_GL_ARB_shader_atomic_counters glatter_get_extension_support_GL().has_GL_ARB_shader_atomic_counters
-#define glatter_GL_ARB_shader_ballot glatter_get_extension_support_GL().has_GL_ARB_shader_ballot
-#define glatter_GL_ARB_shader_bit_encoding glatter_get_extension_support_GL().has_GL_ARB_shader_bit_encoding
-#define glatter_GL_ARB_shader_clock glatter_get_extension_support_GL().has_GL_ARB_shader_clock
-#define glatter_GL_ARB_shader_draw_parameters glatter_get_extension_support_GL().has_GL_ARB_shader_draw_parameters
-#define glatter_GL_ARB_shader_group_vote glatter_get_extension_support_GL().has_GL_ARB_shader_group_vote
-#define glatter_GL_ARB_shader_image_load_store glatter_get_extension_support_GL().has_GL_ARB_shader_image_load_store
-#define glatter_GL_ARB_shader_image_size glatter_get_extension_support_GL().has_GL_ARB_shader_image_size
-#define glatter_GL_ARB_shader_objects glatter_get_extension_support_GL().has_GL_ARB_shader_objects
-#define glatter_GL_ARB_shader_precision glatter_get_extension_support_GL().has_GL_ARB_shader_precision
-#define glatter_GL_ARB_shader_stencil_export glatter_get_extension_support_GL().has_GL_ARB_shader_stencil_export
-#define glatter_GL_ARB_shader_storage_buffer_object glatter_get_extension_support_GL().has_GL_ARB_shader_storage_buffer_object
-#define glatter_GL_ARB_shader_subroutine glatter_get_extension_support_GL().has_GL_ARB_shader_subroutine
-#define glatter_GL_ARB_shader_texture_image_samples glatter_get_extension_support_GL().has_GL_ARB_shader_texture_image_samples
-#define glatter_GL_ARB_shader_texture_lod glatter_get_extension_support_GL().has_GL_ARB_shader_texture_lod
-#define glatter_GL_ARB_shader_viewport_layer_array glatter_get_extension_support_GL().has_GL_ARB_shader_viewport_layer_array
-#define glatter_GL_ARB_shading_language_100 glatter_get_extension_support_GL().has_GL_ARB_shading_language_100
-#define glatter_GL_ARB_shading_language_420pack glatter_get_extension_support_GL().has_GL_ARB_shading_language_420pack
-#define glatter_GL_ARB_shading_language_include glatter_get_extension_support_GL().has_GL_ARB_shading_language_include
-#define glatter_GL_ARB_shading_language_packing glatter_get_extension_support_GL().has_GL_ARB_shading_language_packing
-#define glatter_GL_ARB_shadow glatter_get_extension_support_GL().has_GL_ARB_shadow
-#define glatter_GL_ARB_shadow_ambient glatter_get_extension_support_GL().has_GL_ARB_shadow_ambient
-#define glatter_GL_ARB_sparse_buffer glatter_get_extension_support_GL().has_GL_ARB_sparse_buffer
-#define glatter_GL_ARB_sparse_texture glatter_get_extension_support_GL().has_GL_ARB_sparse_texture
-#define glatter_GL_ARB_sparse_texture2 glatter_get_extension_support_GL().has_GL_ARB_sparse_texture2
-#define glatter_GL_ARB_sparse_texture_clamp glatter_get_extension_support_GL().has_GL_ARB_sparse_texture_clamp
-#define glatter_GL_ARB_spirv_extensions glatter_get_extension_support_GL().has_GL_ARB_spirv_extensions
-#define glatter_GL_ARB_stencil_texturing glatter_get_extension_support_GL().has_GL_ARB_stencil_texturing
-#define glatter_GL_ARB_sync glatter_get_extension_support_GL().has_GL_ARB_sync
-#define glatter_GL_ARB_tessellation_shader glatter_get_extension_support_GL().has_GL_ARB_tessellation_shader
-#define glatter_GL_ARB_texture_barrier glatter_get_extension_support_GL().has_GL_ARB_texture_barrier
-#define glatter_GL_ARB_texture_border_clamp glatter_get_extension_support_GL().has_GL_ARB_texture_border_clamp
-#define glatter_GL_ARB_texture_buffer_object glatter_get_extension_support_GL().has_GL_ARB_texture_buffer_object
-#define glatter_GL_ARB_texture_buffer_object_rgb32 glatter_get_extension_support_GL().has_GL_ARB_texture_buffer_object_rgb32
-#define glatter_GL_ARB_texture_buffer_range glatter_get_extension_support_GL().has_GL_ARB_texture_buffer_range
-#define glatter_GL_ARB_texture_compression glatter_get_extension_support_GL().has_GL_ARB_texture_compression
-#define glatter_GL_ARB_texture_compression_bptc glatter_get_extension_support_GL().has_GL_ARB_texture_compression_bptc
-#define glatter_GL_ARB_texture_compression_rgtc glatter_get_extension_support_GL().has_GL_ARB_texture_compression_rgtc
-#define glatter_GL_ARB_texture_cube_map glatter_get_extension_support_GL().has_GL_ARB_texture_cube_map
-#define glatter_GL_ARB_texture_cube_map_array glatter_get_extension_support_GL().has_GL_ARB_texture_cube_map_array
-#define glatter_GL_ARB_texture_env_add glatter_get_extension_support_GL().has_GL_ARB_texture_env_add
-#define glatter_GL_ARB_texture_env_combine glatter_get_extension_support_GL().has_GL_ARB_texture_env_combine
-#define glatter_GL_ARB_texture_env_crossbar glatter_get_extension_support_GL().has_GL_ARB_texture_env_crossbar
-#define glatter_GL_ARB_texture_env_dot3 glatter_get_extension_support_GL().has_GL_ARB_texture_env_dot3
-#define glatter_GL_ARB_texture_filter_anisotropic glatter_get_extension_support_GL().has_GL_ARB_texture_filter_anisotropic
-#define glatter_GL_ARB_texture_filter_minmax glatter_get_extension_support_GL().has_GL_ARB_texture_filter_minmax
-#define glatter_GL_ARB_texture_float glatter_get_extension_support_GL().has_GL_ARB_texture_float
-#define glatter_GL_ARB_texture_gather glatter_get_extension_support_GL().has_GL_ARB_texture_gather
-#define glatter_GL_ARB_texture_mirror_clamp_to_edge glatter_get_extension_support_GL().has_GL_ARB_texture_mirror_clamp_to_edge
-#define glatter_GL_ARB_texture_mirrored_repeat glatter_get_extension_support_GL().has_GL_ARB_texture_mirrored_repeat
-#define glatter_GL_ARB_texture_multisample glatter_get_extension_support_GL().has_GL_ARB_texture_multisample
-#define glatter_GL_ARB_texture_non_power_of_two glatter_get_extension_support_GL().has_GL_ARB_texture_non_power_of_two
-#define glatter_GL_ARB_texture_query_levels glatter_get_extension_support_GL().has_GL_ARB_texture_query_levels
-#define glatter_GL_ARB_texture_query_lod glatter_get_extension_support_GL().has_GL_ARB_texture_query_lod
-#define glatter_GL_ARB_texture_rectangle glatter_get_extension_support_GL().has_GL_ARB_texture_rectangle
-#define glatter_GL_ARB_texture_rg glatter_get_extension_support_GL().has_GL_ARB_texture_rg
-#define glatter_GL_ARB_texture_rgb10_a2ui glatter_get_extension_support_GL().has_GL_ARB_texture_rgb10_a2ui
-#define glatter_GL_ARB_texture_stencil8 glatter_get_extension_support_GL().has_GL_ARB_texture_stencil8
-#define glatter_GL_ARB_texture_storage glatter_get_extension_support_GL().has_GL_ARB_texture_storage
-#define glatter_GL_ARB_texture_storage_multisample glatter_get_extension_support_GL().has_GL_ARB_texture_storage_multisample
-#define glatter_GL_ARB_texture_swizzle glatter_get_extension_support_GL().has_GL_ARB_texture_swizzle
-#define glatter_GL_ARB_texture_view glatter_get_extension_support_GL().has_GL_ARB_texture_view
-#define glatter_GL_ARB_timer_query glatter_get_extension_support_GL().has_GL_ARB_timer_query
-#define glatter_GL_ARB_transform_feedback2 glatter_get_extension_support_GL().has_GL_ARB_transform_feedback2
-#define glatter_GL_ARB_transform_feedback3 glatter_get_extension_support_GL().has_GL_ARB_transform_feedback3
-#define glatter_GL_ARB_transform_feedback_instanced glatter_get_extension_support_GL().has_GL_ARB_transform_feedback_instanced
-#define glatter_GL_ARB_transform_feedback_overflow_query glatter_get_extension_support_GL().has_GL_ARB_transform_feedback_overflow_query
-#define glatter_GL_ARB_transpose_matrix glatter_get_extension_support_GL().has_GL_ARB_transpose_matrix
-#define glatter_GL_ARB_uniform_buffer_object glatter_get_extension_support_GL().has_GL_ARB_uniform_buffer_object
-#define glatter_GL_ARB_vertex_array_bgra glatter_get_extension_support_GL().has_GL_ARB_vertex_array_bgra
-#define glatter_GL_ARB_vertex_array_object glatter_get_extension_support_GL().has_GL_ARB_vertex_array_object
-#define glatter_GL_ARB_vertex_attrib_64bit glatter_get_extension_support_GL().has_GL_ARB_vertex_attrib_64bit
-#define glatter_GL_ARB_vertex_attrib_binding glatter_get_extension_support_GL().has_GL_ARB_vertex_attrib_binding
-#define glatter_GL_ARB_vertex_blend glatter_get_extension_support_GL().has_GL_ARB_vertex_blend
-#define glatter_GL_ARB_vertex_buffer_object glatter_get_extension_support_GL().has_GL_ARB_vertex_buffer_object
-#define glatter_GL_ARB_vertex_program glatter_get_extension_support_GL().has_GL_ARB_vertex_program
-#define glatter_GL_ARB_vertex_shader glatter_get_extension_support_GL().has_GL_ARB_vertex_shader
-#define glatter_GL_ARB_vertex_type_10f_11f_11f_rev glatter_get_extension_support_GL().has_GL_ARB_vertex_type_10f_11f_11f_rev
-#define glatter_GL_ARB_vertex_type_2_10_10_10_rev glatter_get_extension_support_GL().has_GL_ARB_vertex_type_2_10_10_10_rev
-#define glatter_GL_ARB_viewport_array glatter_get_extension_support_GL().has_GL_ARB_viewport_array
-#define glatter_GL_ARB_window_pos glatter_get_extension_support_GL().has_GL_ARB_window_pos
-#define glatter_GL_ATI_draw_buffers glatter_get_extension_support_GL().has_GL_ATI_draw_buffers
-#define glatter_GL_ATI_element_array glatter_get_extension_support_GL().has_GL_ATI_element_array
-#define glatter_GL_ATI_envmap_bumpmap glatter_get_extension_support_GL().has_GL_ATI_envmap_bumpmap
-#define glatter_GL_ATI_fragment_shader glatter_get_extension_support_GL().has_GL_ATI_fragment_shader
-#define glatter_GL_ATI_map_object_buffer glatter_get_extension_support_GL().has_GL_ATI_map_object_buffer
-#define glatter_GL_ATI_meminfo glatter_get_extension_support_GL().has_GL_ATI_meminfo
-#define glatter_GL_ATI_pixel_format_float glatter_get_extension_support_GL().has_GL_ATI_pixel_format_float
-#define glatter_GL_ATI_pn_triangles glatter_get_extension_support_GL().has_GL_ATI_pn_triangles
-#define glatter_GL_ATI_separate_stencil glatter_get_extension_support_GL().has_GL_ATI_separate_stencil
-#define glatter_GL_ATI_text_fragment_shader glatter_get_extension_support_GL().has_GL_ATI_text_fragment_shader
-#define glatter_GL_ATI_texture_env_combine3 glatter_get_extension_support_GL().has_GL_ATI_texture_env_combine3
-#define glatter_GL_ATI_texture_float glatter_get_extension_support_GL().has_GL_ATI_texture_float
-#define glatter_GL_ATI_texture_mirror_once glatter_get_extension_support_GL().has_GL_ATI_texture_mirror_once
-#define glatter_GL_ATI_vertex_array_object glatter_get_extension_support_GL().has_GL_ATI_vertex_array_object
-#define glatter_GL_ATI_vertex_attrib_array_object glatter_get_extension_support_GL().has_GL_ATI_vertex_attrib_array_object
-#define glatter_GL_ATI_vertex_streams glatter_get_extension_support_GL().has_GL_ATI_vertex_streams
-#define glatter_GL_EXT_422_pixels glatter_get_extension_support_GL().has_GL_EXT_422_pixels
-#define glatter_GL_EXT_EGL_image_storage glatter_get_extension_support_GL().has_GL_EXT_EGL_image_storage
-#define glatter_GL_EXT_EGL_sync glatter_get_extension_support_GL().has_GL_EXT_EGL_sync
-#define glatter_GL_EXT_abgr glatter_get_extension_support_GL().has_GL_EXT_abgr
-#define glatter_GL_EXT_bgra glatter_get_extension_support_GL().has_GL_EXT_bgra
-#define glatter_GL_EXT_bindable_uniform glatter_get_extension_support_GL().has_GL_EXT_bindable_uniform
-#define glatter_GL_EXT_blend_color glatter_get_extension_support_GL().has_GL_EXT_blend_color
-#define glatter_GL_EXT_blend_equation_separate glatter_get_extension_support_GL().has_GL_EXT_blend_equation_separate
-#define glatter_GL_EXT_blend_func_separate glatter_get_extension_support_GL().has_GL_EXT_blend_func_separate
-#define glatter_GL_EXT_blend_logic_op glatter_get_extension_support_GL().has_GL_EXT_blend_logic_op
-#define glatter_GL_EXT_blend_minmax glatter_get_extension_support_GL().has_GL_EXT_blend_minmax
-#define glatter_GL_EXT_blend_subtract glatter_get_extension_support_GL().has_GL_EXT_blend_subtract
-#define glatter_GL_EXT_clip_volume_hint glatter_get_extension_support_GL().has_GL_EXT_clip_volume_hint
-#define glatter_GL_EXT_cmyka glatter_get_extension_support_GL().has_GL_EXT_cmyka
-#define glatter_GL_EXT_color_subtable glatter_get_extension_support_GL().has_GL_EXT_color_subtable
-#define glatter_GL_EXT_compiled_vertex_array glatter_get_extension_support_GL().has_GL_EXT_compiled_vertex_array
-#define glatter_GL_EXT_convolution glatter_get_extension_support_GL().has_GL_EXT_convolution
-#define glatter_GL_EXT_coordinate_frame glatter_get_extension_support_GL().has_GL_EXT_coordinate_frame
-#define glatter_GL_EXT_copy_texture glatter_get_extension_support_GL().has_GL_EXT_copy_texture
-#define glatter_GL_EXT_cull_vertex glatter_get_extension_support_GL().has_GL_EXT_cull_vertex
-#define glatter_GL_EXT_debug_label glatter_get_extension_support_GL().has_GL_EXT_debug_label
-#define glatter_GL_EXT_debug_marker glatter_get_extension_support_GL().has_GL_EXT_debug_marker
-#define glatter_GL_EXT_depth_bounds_test glatter_get_extension_support_GL().has_GL_EXT_depth_bounds_test
-#define glatter_GL_EXT_direct_state_access glatter_get_extension_support_GL().has_GL_EXT_direct_state_access
-#define glatter_GL_EXT_draw_buffers2 glatter_get_extension_support_GL().has_GL_EXT_draw_buffers2
-#define glatter_GL_EXT_draw_instanced glatter_get_extension_support_GL().has_GL_EXT_draw_instanced
-#define glatter_GL_EXT_draw_range_elements glatter_get_extension_support_GL().has_GL_EXT_draw_range_elements
-#define glatter_GL_EXT_external_buffer glatter_get_extension_support_GL().has_GL_EXT_external_buffer
-#define glatter_GL_EXT_fog_coord glatter_get_extension_support_GL().has_GL_EXT_fog_coord
-#define glatter_GL_EXT_fragment_shading_rate glatter_get_extension_support_GL().has_GL_EXT_fragment_shading_rate
-#define glatter_GL_EXT_framebuffer_blit glatter_get_extension_support_GL().has_GL_EXT_framebuffer_blit
-#define glatter_GL_EXT_framebuffer_blit_layers glatter_get_extension_support_GL().has_GL_EXT_framebuffer_blit_layers
-#define glatter_GL_EXT_framebuffer_multisample glatter_get_extension_support_GL().has_GL_EXT_framebuffer_multisample
-#define glatter_GL_EXT_framebuffer_multisample_blit_scaled glatter_get_extension_support_GL().has_GL_EXT_framebuffer_multisample_blit_scaled
-#define glatter_GL_EXT_framebuffer_object glatter_get_extension_support_GL().has_GL_EXT_framebuffer_object
-#define glatter_GL_EXT_framebuffer_sRGB glatter_get_extension_support_GL().has_GL_EXT_framebuffer_sRGB
-#define glatter_GL_EXT_geometry_shader4 glatter_get_extension_support_GL().has_GL_EXT_geometry_shader4
-#define glatter_GL_EXT_gpu_program_parameters glatter_get_extension_support_GL().has_GL_EXT_gpu_program_parameters
-#define glatter_GL_EXT_gpu_shader4 glatter_get_extension_support_GL().has_GL_EXT_gpu_shader4
-#define glatter_GL_EXT_histogram glatter_get_extension_support_GL().has_GL_EXT_histogram
-#define glatter_GL_EXT_index_array_formats glatter_get_extension_support_GL().has_GL_EXT_index_array_formats
-#define glatter_GL_EXT_index_func glatter_get_extension_support_GL().has_GL_EXT_index_func
-#define glatter_GL_EXT_index_material glatter_get_extension_support_GL().has_GL_EXT_index_material
-#define glatter_GL_EXT_index_texture glatter_get_extension_support_GL().has_GL_EXT_index_texture
-#define glatter_GL_EXT_light_texture glatter_get_extension_support_GL().has_GL_EXT_light_texture
-#define glatter_GL_EXT_memory_object glatter_get_extension_support_GL().has_GL_EXT_memory_object
-#define glatter_GL_EXT_memory_object_fd glatter_get_extension_support_GL().has_GL_EXT_memory_object_fd
-#define glatter_GL_EXT_memory_object_win32 glatter_get_extension_support_GL().has_GL_EXT_memory_object_win32
-#define glatter_GL_EXT_mesh_shader glatter_get_extension_support_GL().has_GL_EXT_mesh_shader
-#define glatter_GL_EXT_misc_attribute glatter_get_extension_support_GL().has_GL_EXT_misc_attribute
-#define glatter_GL_EXT_multi_draw_arrays glatter_get_extension_support_GL().has_GL_EXT_multi_draw_arrays
-#define glatter_GL_EXT_multisample glatter_get_extension_support_GL().has_GL_EXT_multisample
-#define glatter_GL_EXT_multiview_tessellation_geometry_shader glatter_get_extension_support_GL().has_GL_EXT_multiview_tessellation_geometry_shader
-#define glatter_GL_EXT_multiview_texture_multisample glatter_get_extension_support_GL().has_GL_EXT_multiview_texture_multisample
-#define glatter_GL_EXT_multiview_timer_query glatter_get_extension_support_GL().has_GL_EXT_multiview_timer_query
-#define glatter_GL_EXT_packed_depth_stencil glatter_get_extension_support_GL().has_GL_EXT_packed_depth_stencil
-#define glatter_GL_EXT_packed_float glatter_get_extension_support_GL().has_GL_EXT_packed_float
-#define glatter_GL_EXT_packed_pixels glatter_get_extension_support_GL().has_GL_EXT_packed_pixels
-#define glatter_GL_EXT_paletted_texture glatter_get_extension_support_GL().has_GL_EXT_paletted_texture
-#define glatter_GL_EXT_pixel_buffer_object glatter_get_extension_support_GL().has_GL_EXT_pixel_buffer_object
-#define glatter_GL_EXT_pixel_transform glatter_get_extension_support_GL().has_GL_EXT_pixel_transform
-#define glatter_GL_EXT_pixel_transform_color_table glatter_get_extension_support_GL().has_GL_EXT_pixel_transform_color_table
-#define glatter_GL_EXT_point_parameters glatter_get_extension_support_GL().has_GL_EXT_point_parameters
-#define glatter_GL_EXT_polygon_offset glatter_get_extension_support_GL().has_GL_EXT_polygon_offset
-#define glatter_GL_EXT_polygon_offset_clamp glatter_get_extension_support_GL().has_GL_EXT_polygon_offset_clamp
-#define glatter_GL_EXT_post_depth_coverage glatter_get_extension_support_GL().has_GL_EXT_post_depth_coverage
-#define glatter_GL_EXT_provoking_vertex glatter_get_extension_support_GL().has_GL_EXT_provoking_vertex
-#define glatter_GL_EXT_raster_multisample glatter_get_extension_support_GL().has_GL_EXT_raster_multisample
-#define glatter_GL_EXT_rescale_normal glatter_get_extension_support_GL().has_GL_EXT_rescale_normal
-#define glatter_GL_EXT_secondary_color glatter_get_extension_support_GL().has_GL_EXT_secondary_color
-#define glatter_GL_EXT_semaphore glatter_get_extension_support_GL().has_GL_EXT_semaphore
-#define glatter_GL_EXT_semaphore_fd glatter_get_extension_support_GL().has_GL_EXT_semaphore_fd
-#define glatter_GL_EXT_semaphore_win32 glatter_get_extension_support_GL().has_GL_EXT_semaphore_win32
-#define glatter_GL_EXT_separate_shader_objects glatter_get_extension_support_GL().has_GL_EXT_separate_shader_objects
-#define glatter_GL_EXT_separate_specular_color glatter_get_extension_support_GL().has_GL_EXT_separate_specular_color
-#define glatter_GL_EXT_shader_framebuffer_fetch glatter_get_extension_support_GL().has_GL_EXT_shader_framebuffer_fetch
-#define glatter_GL_EXT_shader_framebuffer_fetch_non_coherent glatter_get_extension_support_GL().has_GL_EXT_shader_framebuffer_fetch_non_coherent
-#define glatter_GL_EXT_shader_image_load_formatted glatter_get_extension_support_GL().has_GL_EXT_shader_image_load_formatted
-#define glatter_GL_EXT_shader_image_load_store glatter_get_extension_support_GL().has_GL_EXT_shader_image_load_store
-#define glatter_GL_EXT_shader_integer_mix glatter_get_extension_support_GL().has_GL_EXT_shader_integer_mix
-#define glatter_GL_EXT_shader_samples_identical glatter_get_extension_support_GL().has_GL_EXT_shader_samples_identical
-#define glatter_GL_EXT_shadow_funcs glatter_get_extension_support_GL().has_GL_EXT_shadow_funcs
-#define glatter_GL_EXT_shared_texture_palette glatter_get_extension_support_GL().has_GL_EXT_shared_texture_palette
-#define glatter_GL_EXT_sparse_texture2 glatter_get_extension_support_GL().has_GL_EXT_sparse_texture2
-#define glatter_GL_EXT_stencil_clear_tag glatter_get_extension_support_GL().has_GL_EXT_stencil_clear_tag
-#define glatter_GL_EXT_stencil_two_side glatter_get_extension_support_GL().has_GL_EXT_stencil_two_side
-#define glatter_GL_EXT_stencil_wrap glatter_get_extension_support_GL().has_GL_EXT_stencil_wrap
-#define glatter_GL_EXT_subtexture glatter_get_extension_support_GL().has_GL_EXT_subtexture
-#define glatter_GL_EXT_texture glatter_get_extension_support_GL().has_GL_EXT_texture
-#define glatter_GL_EXT_texture3D glatter_get_extension_support_GL().has_GL_EXT_texture3D
-#define glatter_GL_EXT_texture_array glatter_get_extension_support_GL().has_GL_EXT_texture_array
-#define glatter_GL_EXT_texture_buffer_object glatter_get_extension_support_GL().has_GL_EXT_texture_buffer_object
-#define glatter_GL_EXT_texture_compression_latc glatter_get_extension_support_GL().has_GL_EXT_texture_compression_latc
-#define glatter_GL_EXT_texture_compression_rgtc glatter_get_extension_support_GL().has_GL_EXT_texture_compression_rgtc
-#define glatter_GL_EXT_texture_compression_s3tc glatter_get_extension_support_GL().has_GL_EXT_texture_compression_s3tc
-#define glatter_GL_EXT_texture_cube_map glatter_get_extension_support_GL().has_GL_EXT_texture_cube_map
-#define glatter_GL_EXT_texture_env_add glatter_get_extension_support_GL().has_GL_EXT_texture_env_add
-#define glatter_GL_EXT_texture_env_combine glatter_get_extension_support_GL().has_GL_EXT_texture_env_combine
-#define glatter_GL_EXT_texture_env_dot3 glatter_get_extension_support_GL().has_GL_EXT_texture_env_dot3
-#define glatter_GL_EXT_texture_filter_anisotropic glatter_get_extension_support_GL().has_GL_EXT_texture_filter_anisotropic
-#define glatter_GL_EXT_texture_filter_minmax glatter_get_extension_support_GL().has_GL_EXT_texture_filter_minmax
-#define glatter_GL_EXT_texture_integer glatter_get_extension_support_GL().has_GL_EXT_texture_integer
-#define glatter_GL_EXT_texture_lod_bias glatter_get_extension_support_GL().has_GL_EXT_texture_lod_bias
-#define glatter_GL_EXT_texture_mirror_clamp glatter_get_extension_support_GL().has_GL_EXT_texture_mirror_clamp
-#define glatter_GL_EXT_texture_object glatter_get_extension_support_GL().has_GL_EXT_texture_object
-#define glatter_GL_EXT_texture_perturb_normal glatter_get_extension_support_GL().has_GL_EXT_texture_perturb_normal
-#define glatter_GL_EXT_texture_sRGB glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB
-#define glatter_GL_EXT_texture_sRGB_R8 glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB_R8
-#define glatter_GL_EXT_texture_sRGB_RG8 glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB_RG8
-#define glatter_GL_EXT_texture_sRGB_decode glatter_get_extension_support_GL().has_GL_EXT_texture_sRGB_decode
-#define glatter_GL_EXT_texture_shadow_lod glatter_get_extension_support_GL().has_GL_EXT_texture_shadow_lod
-#define glatter_GL_EXT_texture_shared_exponent glatter_get_extension_support_GL().has_GL_EXT_texture_shared_exponent
-#define glatter_GL_EXT_texture_snorm glatter_get_extension_support_GL().has_GL_EXT_texture_snorm
-#define glatter_GL_EXT_texture_storage glatter_get_extension_support_GL().has_GL_EXT_texture_storage
-#define glatter_GL_EXT_texture_swizzle glatter_get_extension_support_GL().has_GL_EXT_texture_swizzle
-#define glatter_GL_EXT_timer_query glatter_get_extension_support_GL().has_GL_EXT_timer_query
-#define glatter_GL_EXT_transform_feedback glatter_get_extension_support_GL().has_GL_EXT_transform_feedback
-#define glatter_GL_EXT_vertex_array glatter_get_extension_support_GL().has_GL_EXT_vertex_array
-#define glatter_GL_EXT_vertex_array_bgra glatter_get_extension_support_GL().has_GL_EXT_vertex_array_bgra
-#define glatter_GL_EXT_vertex_attrib_64bit glatter_get_extension_support_GL().has_GL_EXT_vertex_attrib_64bit
-#define glatter_GL_EXT_vertex_shader glatter_get_extension_support_GL().has_GL_EXT_vertex_shader
-#define glatter_GL_EXT_vertex_weighting glatter_get_extension_support_GL().has_GL_EXT_vertex_weighting
-#define glatter_GL_EXT_win32_keyed_mutex glatter_get_extension_support_GL().has_GL_EXT_win32_keyed_mutex
-#define glatter_GL_EXT_window_rectangles glatter_get_extension_support_GL().has_GL_EXT_window_rectangles
-#define glatter_GL_EXT_x11_sync_object glatter_get_extension_support_GL().has_GL_EXT_x11_sync_object
-#define glatter_GL_GREMEDY_frame_terminator glatter_get_extension_support_GL().has_GL_GREMEDY_frame_terminator
-#define glatter_GL_GREMEDY_string_marker glatter_get_extension_support_GL().has_GL_GREMEDY_string_marker
-#define glatter_GL_HP_convolution_border_modes glatter_get_extension_support_GL().has_GL_HP_convolution_border_modes
-#define glatter_GL_HP_image_transform glatter_get_extension_support_GL().has_GL_HP_image_transform
-#define glatter_GL_HP_occlusion_test glatter_get_extension_support_GL().has_GL_HP_occlusion_test
-#define glatter_GL_HP_texture_lighting glatter_get_extension_support_GL().has_GL_HP_texture_lighting
-#define glatter_GL_IBM_cull_vertex glatter_get_extension_support_GL().has_GL_IBM_cull_vertex
-#define glatter_GL_IBM_multimode_draw_arrays glatter_get_extension_support_GL().has_GL_IBM_multimode_draw_arrays
-#define glatter_GL_IBM_rasterpos_clip glatter_get_extension_support_GL().has_GL_IBM_rasterpos_clip
-#define glatter_GL_IBM_static_data glatter_get_extension_support_GL().has_GL_IBM_static_data
-#define glatter_GL_IBM_texture_mirrored_repeat glatter_get_extension_support_GL().has_GL_IBM_texture_mirrored_repeat
-#define glatter_GL_IBM_vertex_array_lists glatter_get_extension_support_GL().has_GL_IBM_vertex_array_lists
-#define glatter_GL_INGR_blend_func_separate glatter_get_extension_support_GL().has_GL_INGR_blend_func_separate
-#define glatter_GL_INGR_color_clamp glatter_get_extension_support_GL().has_GL_INGR_color_clamp
-#define glatter_GL_INGR_interlace_read glatter_get_extension_support_GL().has_GL_INGR_interlace_read
-#define glatter_GL_INTEL_blackhole_render glatter_get_extension_support_GL().has_GL_INTEL_blackhole_render
-#define glatter_GL_INTEL_conservative_rasterization glatter_get_extension_support_GL().has_GL_INTEL_conservative_rasterization
-#define glatter_GL_INTEL_fragment_shader_ordering glatter_get_extension_support_GL().has_GL_INTEL_fragment_shader_ordering
-#define glatter_GL_INTEL_framebuffer_CMAA glatter_get_extension_support_GL().has_GL_INTEL_framebuffer_CMAA
-#define glatter_GL_INTEL_map_texture glatter_get_extension_support_GL().has_GL_INTEL_map_texture
-#define glatter_GL_INTEL_parallel_arrays glatter_get_extension_support_GL().has_GL_INTEL_parallel_arrays
-#define glatter_GL_INTEL_performance_query glatter_get_extension_support_GL().has_GL_INTEL_performance_query
-#define glatter_GL_KHR_blend_equation_advanced glatter_get_extension_support_GL().has_GL_KHR_blend_equation_advanced
-#define glatter_GL_KHR_blend_equation_advanced_coherent glatter_get_extension_support_GL().has_GL_KHR_blend_equation_advanced_coherent
-#define glatter_GL_KHR_context_flush_control glatter_get_extension_support_GL().has_GL_KHR_context_flush_control
-#define glatter_GL_KHR_debug glatter_get_extension_support_GL().has_GL_KHR_debug
-#define glatter_GL_KHR_no_error glatter_get_extension_support_GL().has_GL_KHR_no_error
-#define glatter_GL_KHR_parallel_shader_compile glatter_get_extension_support_GL().has_GL_KHR_parallel_shader_compile
-#define glatter_GL_KHR_robust_buffer_access_behavior glatter_get_extension_support_GL().has_GL_KHR_robust_buffer_access_behavior
-#define glatter_GL_KHR_robustness glatter_get_extension_support_GL().has_GL_KHR_robustness
-#define glatter_GL_KHR_shader_subgroup glatter_get_extension_support_GL().has_GL_KHR_shader_subgroup
-#define glatter_GL_KHR_texture_compression_astc_hdr glatter_get_extension_support_GL().has_GL_KHR_texture_compression_astc_hdr
-#define glatter_GL_KHR_texture_compression_astc_ldr glatter_get_extension_support_GL().has_GL_KHR_texture_compression_astc_ldr
-#define glatter_GL_KHR_texture_compression_astc_sliced_3d glatter_get_extension_support_GL().has_GL_KHR_texture_compression_astc_sliced_3d
-#define glatter_GL_MESAX_texture_stack glatter_get_extension_support_GL().has_GL_MESAX_texture_stack
-#define glatter_GL_MESA_framebuffer_flip_x glatter_get_extension_support_GL().has_GL_MESA_framebuffer_flip_x
-#define glatter_GL_MESA_framebuffer_flip_y glatter_get_extension_support_GL().has_GL_MESA_framebuffer_flip_y
-#define glatter_GL_MESA_framebuffer_swap_xy glatter_get_extension_support_GL().has_GL_MESA_framebuffer_swap_xy
-#define glatter_GL_MESA_pack_invert glatter_get_extension_support_GL().has_GL_MESA_pack_invert
-#define glatter_GL_MESA_program_binary_formats glatter_get_extension_support_GL().has_GL_MESA_program_binary_formats
-#define glatter_GL_MESA_resize_buffers glatter_get_extension_support_GL().has_GL_MESA_resize_buffers
-#define glatter_GL_MESA_shader_integer_functions glatter_get_extension_support_GL().has_GL_MESA_shader_integer_functions
-#define glatter_GL_MESA_texture_const_bandwidth glatter_get_extension_support_GL().has_GL_MESA_texture_const_bandwidth
-#define glatter_GL_MESA_tile_raster_order glatter_get_extension_support_GL().has_GL_MESA_tile_raster_order
-#define glatter_GL_MESA_window_pos glatter_get_extension_support_GL().has_GL_MESA_window_pos
-#define glatter_GL_MESA_ycbcr_texture glatter_get_extension_support_GL().has_GL_MESA_ycbcr_texture
-#define glatter_GL_NVX_blend_equation_advanced_multi_draw_buffers glatter_get_extension_support_GL().has_GL_NVX_blend_equation_advanced_multi_draw_buffers
-#define glatter_GL_NVX_conditional_render glatter_get_extension_support_GL().has_GL_NVX_conditional_render
-#define glatter_GL_NVX_gpu_memory_info glatter_get_extension_support_GL().has_GL_NVX_gpu_memory_info
-#define glatter_GL_NVX_gpu_multicast2 glatter_get_extension_support_GL().has_GL_NVX_gpu_multicast2
-#define glatter_GL_NVX_linked_gpu_multicast glatter_get_extension_support_GL().has_GL_NVX_linked_gpu_multicast
-#define glatter_GL_NVX_progress_fence glatter_get_extension_support_GL().has_GL_NVX_progress_fence
-#define glatter_GL_NV_alpha_to_coverage_dither_control glatter_get_extension_support_GL().has_GL_NV_alpha_to_coverage_dither_control
-#define glatter_GL_NV_bindless_multi_draw_indirect glatter_get_extension_support_GL().has_GL_NV_bindless_multi_draw_indirect
-#define glatter_GL_NV_bindless_multi_draw_indirect_count glatter_get_extension_support_GL().has_GL_NV_bindless_multi_draw_indirect_count
-#define glatter_GL_NV_bindless_texture glatter_get_extension_support_GL().has_GL_NV_bindless_texture
-#define glatter_GL_NV_blend_equation_advanced glatter_get_extension_support_GL().has_GL_NV_blend_equation_advanced
-#define glatter_GL_NV_blend_equation_advanced_coherent glatter_get_extension_support_GL().has_GL_NV_blend_equation_advanced_coherent
-#define glatter_GL_NV_blend_minmax_factor glatter_get_extension_support_GL().has_GL_NV_blend_minmax_factor
-#define glatter_GL_NV_blend_square glatter_get_extension_support_GL().has_GL_NV_blend_square
-#define glatter_GL_NV_clip_space_w_scaling glatter_get_extension_support_GL().has_GL_NV_clip_space_w_scaling
-#define glatter_GL_NV_command_list glatter_get_extension_support_GL().has_GL_NV_command_list
-#define glatter_GL_NV_compute_program5 glatter_get_extension_support_GL().has_GL_NV_compute_program5
-#define glatter_GL_NV_compute_shader_derivatives glatter_get_extension_support_GL().has_GL_NV_compute_shader_derivatives
-#define glatter_GL_NV_conditional_render glatter_get_extension_support_GL().has_GL_NV_conditional_render
-#define glatter_GL_NV_conservative_raster glatter_get_extension_support_GL().has_GL_NV_conservative_raster
-#define glatter_GL_NV_conservative_raster_dilate glatter_get_extension_support_GL().has_GL_NV_conservative_raster_dilate
-#define glatter_GL_NV_conservative_raster_pre_snap glatter_get_extension_support_GL().has_GL_NV_conservative_raster_pre_snap
-#define glatter_GL_NV_conservative_raster_pre_snap_triangles glatter_get_extension_support_GL().has_GL_NV_conservative_raster_pre_snap_triangles
-#define glatter_GL_NV_conservative_raster_underestimation glatter_get_extension_support_GL().has_GL_NV_conservative_raster_underestimation
-#define glatter_GL_NV_copy_depth_to_color glatter_get_extension_support_GL().has_GL_NV_copy_depth_to_color
-#define glatter_GL_NV_copy_image glatter_get_extension_support_GL().has_GL_NV_copy_image
-#define glatter_GL_NV_deep_texture3D glatter_get_extension_support_GL().has_GL_NV_deep_texture3D
-#define glatter_GL_NV_depth_buffer_float glatter_get_extension_support_GL().has_GL_NV_depth_buffer_float
-#define glatter_GL_NV_depth_clamp glatter_get_extension_support_GL().has_GL_NV_depth_clamp
-#define glatter_GL_NV_draw_texture glatter_get_extension_support_GL().has_GL_NV_draw_texture
-#define glatter_GL_NV_draw_vulkan_image glatter_get_extension_support_GL().has_GL_NV_draw_vulkan_image
-#define glatter_GL_NV_evaluators glatter_get_extension_support_GL().has_GL_NV_evaluators
-#define glatter_GL_NV_explicit_multisample glatter_get_extension_support_GL().has_GL_NV_explicit_multisample
-#define glatter_GL_NV_fence glatter_get_extension_support_GL().has_GL_NV_fence
-#define glatter_GL_NV_fill_rectangle glatter_get_extension_support_GL().has_GL_NV_fill_rectangle
-#define glatter_GL_NV_float_buffer glatter_get_extension_support_GL().has_GL_NV_float_buffer
-#define glatter_GL_NV_fog_distance glatter_get_extension_support_GL().has_GL_NV_fog_distance
-#define glatter_GL_NV_fragment_coverage_to_color glatter_get_extension_support_GL().has_GL_NV_fragment_coverage_to_color
-#define glatter_GL_NV_fragment_program glatter_get_extension_support_GL().has_GL_NV_fragment_program
-#define glatter_GL_NV_fragment_program2 glatter_get_extension_support_GL().has_GL_NV_fragment_program2
-#define glatter_GL_NV_fragment_program4 glatter_get_extension_support_GL().has_GL_NV_fragment_program4
-#define glatter_GL_NV_fragment_program_option glatter_get_extension_support_GL().has_GL_NV_fragment_program_option
-#define glatter_GL_NV_fragment_shader_barycentric glatter_get_extension_support_GL().has_GL_NV_fragment_shader_barycentric
-#define glatter_GL_NV_fragment_shader_interlock glatter_get_extension_support_GL().has_GL_NV_fragment_shader_interlock
-#define glatter_GL_NV_framebuffer_mixed_samples glatter_get_extension_support_GL().has_GL_NV_framebuffer_mixed_samples
-#define glatter_GL_NV_framebuffer_multisample_coverage glatter_get_extension_support_GL().has_GL_NV_framebuffer_multisample_coverage
-#define glatter_GL_NV_geometry_program4 glatter_get_extension_support_GL().has_GL_NV_geometry_program4
-#define glatter_GL_NV_geometry_shader4 glatter_get_extension_support_GL().has_GL_NV_geometry_shader4
-#define glatter_GL_NV_geometry_shader_passthrough glatter_get_extension_support_GL().has_GL_NV_geometry_shader_passthrough
-#define glatter_GL_NV_gpu_multicast glatter_get_extension_support_GL().has_GL_NV_gpu_multicast
-#define glatter_GL_NV_gpu_program4 glatter_get_extension_support_GL().has_GL_NV_gpu_program4
-#define glatter_GL_NV_gpu_program5 glatter_get_extension_support_GL().has_GL_NV_gpu_program5
-#define glatter_GL_NV_gpu_program5_mem_extended glatter_get_extension_support_GL().has_GL_NV_gpu_program5_mem_extended
-#define glatter_GL_NV_gpu_shader5 glatter_get_extension_support_GL().has_GL_NV_gpu_shader5
-#define glatter_GL_NV_half_float glatter_get_extension_support_GL().has_GL_NV_half_float
-#define glatter_GL_NV_internalformat_sample_query glatter_get_extension_support_GL().has_GL_NV_internalformat_sample_query
-#define glatter_GL_NV_light_max_exponent glatter_get_extension_support_GL().has_GL_NV_light_max_exponent
-#define glatter_GL_NV_memory_attachment glatter_get_extension_support_GL().has_GL_NV_memory_attachment
-#define glatter_GL_NV_memory_object_sparse glatter_get_extension_support_GL().has_GL_NV_memory_object_sparse
-#define glatter_GL_NV_mesh_shader glatter_get_extension_support_GL().has_GL_NV_mesh_shader
-#define glatter_GL_NV_multisample_coverage glatter_get_extension_support_GL().has_GL_NV_multisample_coverage
-#define glatter_GL_NV_multisample_filter_hint glatter_get_extension_support_GL().has_GL_NV_multisample_filter_hint
-#define glatter_GL_NV_occlusion_query glatter_get_extension_support_GL().has_GL_NV_occlusion_query
-#define glatter_GL_NV_packed_depth_stencil glatter_get_extension_support_GL().has_GL_NV_packed_depth_stencil
-#define glatter_GL_NV_parameter_buffer_object glatter_get_extension_support_GL().has_GL_NV_parameter_buffer_object
-#define glatter_GL_NV_parameter_buffer_object2 glatter_get_extension_support_GL().has_GL_NV_parameter_buffer_object2
-#define glatter_GL_NV_path_rendering glatter_get_extension_support_GL().has_GL_NV_path_rendering
-#define glatter_GL_NV_path_rendering_shared_edge glatter_get_extension_support_GL().has_GL_NV_path_rendering_shared_edge
-#define glatter_GL_NV_pixel_data_range glatter_get_extension_support_GL().has_GL_NV_pixel_data_range
-#define glatter_GL_NV_point_sprite glatter_get_extension_support_GL().has_GL_NV_point_sprite
-#define glatter_GL_NV_present_video glatter_get_extension_support_GL().has_GL_NV_present_video
-#define glatter_GL_NV_primitive_restart glatter_get_extension_support_GL().has_GL_NV_primitive_restart
-#define glatter_GL_NV_primitive_shading_rate glatter_get_extension_support_GL().has_GL_NV_primitive_shading_rate
-#define glatter_GL_NV_query_resource glatter_get_extension_support_GL().has_GL_NV_query_resource
-#define glatter_GL_NV_query_resource_tag glatter_get_extension_support_GL().has_GL_NV_query_resource_tag
-#define glatter_GL_NV_register_combiners glatter_get_extension_support_GL().has_GL_NV_register_combiners
-#define glatter_GL_NV_register_combiners2 glatter_get_extension_support_GL().has_GL_NV_register_combiners2
-#define glatter_GL_NV_representative_fragment_test glatter_get_extension_support_GL().has_GL_NV_representative_fragment_test
-#define glatter_GL_NV_robustness_video_memory_purge glatter_get_extension_support_GL().has_GL_NV_robustness_video_memory_purge
-#define glatter_GL_NV_sample_locations glatter_get_extension_support_GL().has_GL_NV_sample_locations
-#define glatter_GL_NV_sample_mask_override_coverage glatter_get_extension_support_GL().has_GL_NV_sample_mask_override_coverage
-#define glatter_GL_NV_scissor_exclusive glatter_get_extension_support_GL().has_GL_NV_scissor_exclusive
-#define glatter_GL_NV_shader_atomic_counters glatter_get_extension_support_GL().has_GL_NV_shader_atomic_counters
-#define glatter_GL_NV_shader_atomic_float glatter_get_extension_support_GL().has_GL_NV_shader_atomic_float
-#define glatter_GL_NV_shader_atomic_float64 glatter_get_extension_support_GL().has_GL_NV_shader_atomic_float64
-#define glatter_GL_NV_shader_atomic_fp16_vector glatter_get_extension_support_GL().has_GL_NV_shader_atomic_fp16_vector
-#define glatter_GL_NV_shader_atomic_int64 glatter_get_extension_support_GL().has_GL_NV_shader_atomic_int64
-#define glatter_GL_NV_shader_buffer_load glatter_get_extension_support_GL().has_GL_NV_shader_buffer_load
-#define glatter_GL_NV_shader_buffer_store glatter_get_extension_support_GL().has_GL_NV_shader_buffer_store
-#define glatter_GL_NV_shader_storage_buffer_object glatter_get_extension_support_GL().has_GL_NV_shader_storage_buffer_object
-#define glatter_GL_NV_shader_subgroup_partitioned glatter_get_extension_support_GL().has_GL_NV_shader_subgroup_partitioned
-#define glatter_GL_NV_shader_texture_footprint glatter_get_extension_support_GL().has_GL_NV_shader_texture_footprint
-#define glatter_GL_NV_shader_thread_group glatter_get_extension_support_GL().has_GL_NV_shader_thread_group
-#define glatter_GL_NV_shader_thread_shuffle glatter_get_extension_support_GL().has_GL_NV_shader_thread_shuffle
-#define glatter_GL_NV_shading_rate_image glatter_get_extension_support_GL().has_GL_NV_shading_rate_image
-#define glatter_GL_NV_stereo_view_rendering glatter_get_extension_support_GL().has_GL_NV_stereo_view_rendering
-#define glatter_GL_NV_tessellation_program5 glatter_get_extension_support_GL().has_GL_NV_tessellation_program5
-#define glatter_GL_NV_texgen_emboss glatter_get_extension_support_GL().has_GL_NV_texgen_emboss
-#define glatter_GL_NV_texgen_reflection glatter_get_extension_support_GL().has_GL_NV_texgen_reflection
-#define glatter_GL_NV_texture_barrier glatter_get_extension_support_GL().has_GL_NV_texture_barrier
-#define glatter_GL_NV_texture_compression_vtc glatter_get_extension_support_GL().has_GL_NV_texture_compression_vtc
-#define glatter_GL_NV_texture_env_combine4 glatter_get_extension_support_GL().has_GL_NV_texture_env_combine4
-#define glatter_GL_NV_texture_expand_normal glatter_get_extension_support_GL().has_GL_NV_texture_expand_normal
-#define glatter_GL_NV_texture_multisample glatter_get_extension_support_GL().has_GL_NV_texture_multisample
-#define glatter_GL_NV_texture_rectangle glatter_get_extension_support_GL().has_GL_NV_texture_rectangle
-#define glatter_GL_NV_texture_rectangle_compressed glatter_get_extension_support_GL().has_GL_NV_texture_rectangle_compressed
-#define glatter_GL_NV_texture_shader glatter_get_extension_support_GL().has_GL_NV_texture_shader
-#define glatter_GL_NV_texture_shader2 glatter_get_extension_support_GL().has_GL_NV_texture_shader2
-#define glatter_GL_NV_texture_shader3 glatter_get_extension_support_GL().has_GL_NV_texture_shader3
-#define glatter_GL_NV_timeline_semaphore glatter_get_extension_support_GL().has_GL_NV_timeline_semaphore
-#define glatter_GL_NV_transform_feedback glatter_get_extension_support_GL().has_GL_NV_transform_feedback
-#define glatter_GL_NV_transform_feedback2 glatter_get_extension_support_GL().has_GL_NV_transform_feedback2
-#define glatter_GL_NV_uniform_buffer_std430_layout glatter_get_extension_support_GL().has_GL_NV_uniform_buffer_std430_layout
-#define glatter_GL_NV_uniform_buffer_unified_memory glatter_get_extension_support_GL().has_GL_NV_uniform_buffer_unified_memory
-#define glatter_GL_NV_vdpau_interop glatter_get_extension_support_GL().has_GL_NV_vdpau_interop
-#define glatter_GL_NV_vdpau_interop2 glatter_get_extension_support_GL().has_GL_NV_vdpau_interop2
-#define glatter_GL_NV_vertex_array_range glatter_get_extension_support_GL().has_GL_NV_vertex_array_range
-#define glatter_GL_NV_vertex_array_range2 glatter_get_extension_support_GL().has_GL_NV_vertex_array_range2
-#define glatter_GL_NV_vertex_attrib_integer_64bit glatter_get_extension_support_GL().has_GL_NV_vertex_attrib_integer_64bit
-#define glatter_GL_NV_vertex_buffer_unified_memory glatter_get_extension_support_GL().has_GL_NV_vertex_buffer_unified_memory
-#define glatter_GL_NV_vertex_program glatter_get_extension_support_GL().has_GL_NV_vertex_program
-#define glatter_GL_NV_vertex_program1_1 glatter_get_extension_support_GL().has_GL_NV_vertex_program1_1
-#define glatter_GL_NV_vertex_program2 glatter_get_extension_support_GL().has_GL_NV_vertex_program2
-#define glatter_GL_NV_vertex_program2_option glatter_get_extension_support_GL().has_GL_NV_vertex_program2_option
-#define glatter_GL_NV_vertex_program3 glatter_get_extension_support_GL().has_GL_NV_vertex_program3
-#define glatter_GL_NV_vertex_program4 glatter_get_extension_support_GL().has_GL_NV_vertex_program4
-#define glatter_GL_NV_video_capture glatter_get_extension_support_GL().has_GL_NV_video_capture
-#define glatter_GL_NV_viewport_array2 glatter_get_extension_support_GL().has_GL_NV_viewport_array2
-#define glatter_GL_NV_viewport_swizzle glatter_get_extension_support_GL().has_GL_NV_viewport_swizzle
-#define glatter_GL_OES_byte_coordinates glatter_get_extension_support_GL().has_GL_OES_byte_coordinates
-#define glatter_GL_OES_compressed_paletted_texture glatter_get_extension_support_GL().has_GL_OES_compressed_paletted_texture
-#define glatter_GL_OES_fixed_point glatter_get_extension_support_GL().has_GL_OES_fixed_point
-#define glatter_GL_OES_query_matrix glatter_get_extension_support_GL().has_GL_OES_query_matrix
-#define glatter_GL_OES_read_format glatter_get_extension_support_GL().has_GL_OES_read_format
-#define glatter_GL_OES_single_precision glatter_get_extension_support_GL().has_GL_OES_single_precision
-#define glatter_GL_OML_interlace glatter_get_extension_support_GL().has_GL_OML_interlace
-#define glatter_GL_OML_resample glatter_get_extension_support_GL().has_GL_OML_resample
-#define glatter_GL_OML_subsample glatter_get_extension_support_GL().has_GL_OML_subsample
-#define glatter_GL_OVR_multiview glatter_get_extension_support_GL().has_GL_OVR_multiview
-#define glatter_GL_OVR_multiview2 glatter_get_extension_support_GL().has_GL_OVR_multiview2
-#define glatter_GL_PGI_misc_hints glatter_get_extension_support_GL().has_GL_PGI_misc_hints
-#define glatter_GL_PGI_vertex_hints glatter_get_extension_support_GL().has_GL_PGI_vertex_hints
-#define glatter_GL_REND_screen_coordinates glatter_get_extension_support_GL().has_GL_REND_screen_coordinates
-#define glatter_GL_S3_s3tc glatter_get_extension_support_GL().has_GL_S3_s3tc
-#define glatter_GL_SGIS_detail_texture glatter_get_extension_support_GL().has_GL_SGIS_detail_texture
-#define glatter_GL_SGIS_fog_function glatter_get_extension_support_GL().has_GL_SGIS_fog_function
-#define glatter_GL_SGIS_generate_mipmap glatter_get_extension_support_GL().has_GL_SGIS_generate_mipmap
-#define glatter_GL_SGIS_multisample glatter_get_extension_support_GL().has_GL_SGIS_multisample
-#define glatter_GL_SGIS_pixel_texture glatter_get_extension_support_GL().has_GL_SGIS_pixel_texture
-#define glatter_GL_SGIS_point_line_texgen glatter_get_extension_support_GL().has_GL_SGIS_point_line_texgen
-#define glatter_GL_SGIS_point_parameters glatter_get_extension_support_GL().has_GL_SGIS_point_parameters
-#define glatter_GL_SGIS_sharpen_texture glatter_get_extension_support_GL().has_GL_SGIS_sharpen_texture
-#define glatter_GL_SGIS_texture4D glatter_get_extension_support_GL().has_GL_SGIS_texture4D
-#define glatter_GL_SGIS_texture_border_clamp glatter_get_extension_support_GL().has_GL_SGIS_texture_border_clamp
-#define glatter_GL_SGIS_texture_color_mask glatter_get_extension_support_GL().has_GL_SGIS_texture_color_mask
-#define glatter_GL_SGIS_texture_edge_clamp glatter_get_extension_support_GL().has_GL_SGIS_texture_edge_clamp
-#define glatter_GL_SGIS_texture_filter4 glatter_get_extension_support_GL().has_GL_SGIS_texture_filter4
-#define glatter_GL_SGIS_texture_lod glatter_get_extension_support_GL().has_GL_SGIS_texture_lod
-#define glatter_GL_SGIS_texture_select glatter_get_extension_support_GL().has_GL_SGIS_texture_select
-#define glatter_GL_SGIX_async glatter_get_extension_support_GL().has_GL_SGIX_async
-#define glatter_GL_SGIX_async_histogram glatter_get_extension_support_GL().has_GL_SGIX_async_histogram
-#define glatter_GL_SGIX_async_pixel glatter_get_extension_support_GL().has_GL_SGIX_async_pixel
-#define glatter_GL_SGIX_blend_alpha_minmax glatter_get_extension_support_GL().has_GL_SGIX_blend_alpha_minmax
-#define glatter_GL_SGIX_calligraphic_fragment glatter_get_extension_support_GL().has_GL_SGIX_calligraphic_fragment
-#define glatter_GL_SGIX_clipmap glatter_get_extension_support_GL().has_GL_SGIX_clipmap
-#define glatter_GL_SGIX_convolution_accuracy glatter_get_extension_support_GL().has_GL_SGIX_convolution_accuracy
-#define glatter_GL_SGIX_depth_pass_instrument glatter_get_extension_support_GL().has_GL_SGIX_depth_pass_instrument
-#define glatter_GL_SGIX_depth_texture glatter_get_extension_support_GL().has_GL_SGIX_depth_texture
-#define glatter_GL_SGIX_flush_raster glatter_get_extension_support_GL().has_GL_SGIX_flush_raster
-#define glatter_GL_SGIX_fog_offset glatter_get_extension_support_GL().has_GL_SGIX_fog_offset
-#define glatter_GL_SGIX_fragment_lighting glatter_get_extension_support_GL().has_GL_SGIX_fragment_lighting
-#define glatter_GL_SGIX_framezoom glatter_get_extension_support_GL().has_GL_SGIX_framezoom
-#define glatter_GL_SGIX_igloo_interface glatter_get_extension_support_GL().has_GL_SGIX_igloo_interface
-#define glatter_GL_SGIX_instruments glatter_get_extension_support_GL().has_GL_SGIX_instruments
-#define glatter_GL_SGIX_interlace glatter_get_extension_support_GL().has_GL_SGIX_interlace
-#define glatter_GL_SGIX_ir_instrument1 glatter_get_extension_support_GL().has_GL_SGIX_ir_instrument1
-#define glatter_GL_SGIX_list_priority glatter_get_extension_support_GL().has_GL_SGIX_list_priority
-#define glatter_GL_SGIX_pixel_texture glatter_get_extension_support_GL().has_GL_SGIX_pixel_texture
-#define glatter_GL_SGIX_pixel_tiles glatter_get_extension_support_GL().has_GL_SGIX_pixel_tiles
-#define glatter_GL_SGIX_polynomial_ffd glatter_get_extension_support_GL().has_GL_SGIX_polynomial_ffd
-#define glatter_GL_SGIX_reference_plane glatter_get_extension_support_GL().has_GL_SGIX_reference_plane
-#define glatter_GL_SGIX_resample glatter_get_extension_support_GL().has_GL_SGIX_resample
-#define glatter_GL_SGIX_scalebias_hint glatter_get_extension_support_GL().has_GL_SGIX_scalebias_hint
-#define glatter_GL_SGIX_shadow glatter_get_extension_support_GL().has_GL_SGIX_shadow
-#define glatter_GL_SGIX_shadow_ambient glatter_get_extension_support_GL().has_GL_SGIX_shadow_ambient
-#define glatter_GL_SGIX_sprite glatter_get_extension_support_GL().has_GL_SGIX_sprite
-#define glatter_GL_SGIX_subsample glatter_get_extension_support_GL().has_GL_SGIX_subsample
-#define glatter_GL_SGIX_tag_sample_buffer glatter_get_extension_support_GL().has_GL_SGIX_tag_sample_buffer
-#define glatter_GL_SGIX_texture_add_env glatter_get_extension_support_GL().has_GL_SGIX_texture_add_env
-#define glatter_GL_SGIX_texture_coordinate_clamp glatter_get_extension_support_GL().has_GL_SGIX_texture_coordinate_clamp
-#define glatter_GL_SGIX_texture_lod_bias glatter_get_extension_support_GL().has_GL_SGIX_texture_lod_bias
-#define glatter_GL_SGIX_texture_multi_buffer glatter_get_extension_support_GL().has_GL_SGIX_texture_multi_buffer
-#define glatter_GL_SGIX_texture_scale_bias glatter_get_extension_support_GL().has_GL_SGIX_texture_scale_bias
-#define glatter_GL_SGIX_vertex_preclip glatter_get_extension_support_GL().has_GL_SGIX_vertex_preclip
-#define glatter_GL_SGIX_ycrcb glatter_get_extension_support_GL().has_GL_SGIX_ycrcb
-#define glatter_GL_SGIX_ycrcb_subsample glatter_get_extension_support_GL().has_GL_SGIX_ycrcb_subsample
-#define glatter_GL_SGIX_ycrcba glatter_get_extension_support_GL().has_GL_SGIX_ycrcba
-#define glatter_GL_SGI_color_matrix glatter_get_extension_support_GL().has_GL_SGI_color_matrix
-#define glatter_GL_SGI_color_table glatter_get_extension_support_GL().has_GL_SGI_color_table
-#define glatter_GL_SGI_texture_color_table glatter_get_extension_support_GL().has_GL_SGI_texture_color_table
-#define glatter_GL_SUNX_constant_data glatter_get_extension_support_GL().has_GL_SUNX_constant_data
-#define glatter_GL_SUN_convolution_border_modes glatter_get_extension_support_GL().has_GL_SUN_convolution_border_modes
-#define glatter_GL_SUN_global_alpha glatter_get_extension_support_GL().has_GL_SUN_global_alpha
-#define glatter_GL_SUN_mesh_array glatter_get_extension_support_GL().has_GL_SUN_mesh_array
-#define glatter_GL_SUN_slice_accum glatter_get_extension_support_GL().has_GL_SUN_slice_accum
-#define glatter_GL_SUN_triangle_list glatter_get_extension_support_GL().has_GL_SUN_triangle_list
-#define glatter_GL_SUN_vertex glatter_get_extension_support_GL().has_GL_SUN_vertex
-#define glatter_GL_WIN_phong_shading glatter_get_extension_support_GL().has_GL_WIN_phong_shading
-#define glatter_GL_WIN_specular_fog glatter_get_extension_support_GL().has_GL_WIN_specular_fog
+/* Slots of glatter_context_caps_t::limits, each read with glGetIntegerv. */
+enum {
+    GLATTER_LIMIT_MAX_TEXTURE_SIZE = 0,
+    GLATTER_LIMIT_MAX_CUBE_MAP_TEXTURE_SIZE = 1,
+    GLATTER_LIMIT_MAX_3D_TEXTURE_SIZE = 2,
+    GLATTER_LIMIT_MAX_ARRAY_TEXTURE_LAYERS = 3,
+    GLATTER_LIMIT_MAX_RENDERBUFFER_SIZE = 4,
+    GLATTER_LIMIT_MAX_SAMPLES = 5,
+    GLATTER_LIMIT_MAX_COLOR_ATTACHMENTS = 6,
+    GLATTER_LIMIT_MAX_DRAW_BUFFERS = 7,
+    GLATTER_LIMIT_MAX_ELEMENTS_VERTICES = 8,
+    GLATTER_LIMIT_MAX_ELEMENTS_INDICES = 9,
+    GLATTER_LIMIT_MAX_VERTEX_ATTRIBS = 10,
+    GLATTER_LIMIT_MAX_TEXTURE_IMAGE_UNITS = 11,
+    GLATTER_LIMIT_MAX_VERTEX_TEXTURE_IMAGE_UNITS = 12,
+    GLATTER_LIMIT_MAX_COMBINED_TEXTURE_IMAGE_UNITS = 13,
+    GLATTER_LIMIT_MAX_VERTEX_UNIFORM_VECTORS = 14,
+    GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_VECTORS = 15,
+    GLATTER_LIMIT_MAX_FRAGMENT_INPUT_COMPONENTS = 16,
+    GLATTER_LIMIT_MAX_UNIFORM_BLOCK_SIZE = 17,
+    GLATTER_LIMIT_MAX_UNIFORM_BUFFER_BINDINGS = 18,
+    GLATTER_LIMIT_MAX_VERTEX_UNIFORM_BLOCKS = 19,
+    GLATTER_LIMIT_MAX_FRAGMENT_UNIFORM_BLOCKS = 20,
+    GLATTER_LIMIT_MAX_COMBINED_UNIFORM_BLOCKS = 21,
+    GLATTER_LIMIT_UNIFORM_BUFFER_OFFSET_ALIGNMENT = 22,
+    GLATTER_LIMIT_MAX_SHADER_STORAGE_BUFFER_BINDINGS = 23,
+    GLATTER_LIMIT_MAX_SHADER_STORAGE_BLOCK_SIZE = 24,
+    GLATTER_LIMIT_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT = 25,
+    GLATTER_LIMIT_MAX_COMPUTE_WORK_GROUP_INVOCATIONS = 26,
+    GLATTER_LIMIT_MAX_COMPUTE_SHARED_MEMORY_SIZE = 27,
+    GLATTER_LIMIT_COUNT = 28
+};
+
+/* What glatter_get_context_caps() reports of a context. Whatever the version
+ * of the context does not have stays 0. */
+typedef struct glatter_context_caps
+{
+    int   major, minor;                 /* GL_VERSION, e.g. 4 and 6 */
+    int   es;                           /* nonzero for OpenGL ES */
+    int   glsl_version;                 /* GL_SHADING_LANGUAGE_VERSION as in #version, e.g. 460 */
+    GLint profile_mask;                 /* GL_CONTEXT_PROFILE_MASK, from GL 3.2 */
+    GLint flags;                        /* GL_CONTEXT_FLAGS, from GL 3.0 and GLES 3.2 */
+    GLint limits[GLATTER_LIMIT_COUNT];  /* by GLATTER_LIMIT_* */
+} glatter_context_caps_t;
 
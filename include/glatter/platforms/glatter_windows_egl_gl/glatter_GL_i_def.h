@@ -0,0 +1,3840 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+#ifdef GLATTER_GL
+#if !defined(GL_VERSION_ES_CM_1_0)
+#if defined(__GL_H__)
+#if defined(__gl_h_)
+GLATTER_IVERSION(0, 0)
+GLATTER_IBLOCK(glAccum)
+GLATTER_IBLOCK(glAlphaFunc)
+GLATTER_IBLOCK(glAreTexturesResident)
+GLATTER_IBLOCK(glArrayElement)
+GLATTER_IBLOCK(glBegin)
+GLATTER_IBLOCK(glBindTexture)
+GLATTER_IBLOCK(glBitmap)
+GLATTER_IBLOCK(glBlendFunc)
+GLATTER_IBLOCK(glCallList)
+GLATTER_IBLOCK(glCallLists)
+GLATTER_IBLOCK(glClear)
+GLATTER_IBLOCK(glClearAccum)
+GLATTER_IBLOCK(glClearColor)
+GLATTER_IBLOCK(glClearDepth)
+GLATTER_IBLOCK(glClearIndex)
+GLATTER_IBLOCK(glClearStencil)
+GLATTER_IBLOCK(glClipPlane)
+GLATTER_IBLOCK(glColor3b)
+GLATTER_IBLOCK(glColor3bv)
+GLATTER_IBLOCK(glColor3d)
+GLATTER_IBLOCK(glColor3dv)
+GLATTER_IBLOCK(glColor3f)
+GLATTER_IBLOCK(glColor3fv)
+GLATTER_IBLOCK(glColor3i)
+GLATTER_IBLOCK(glColor3iv)
+GLATTER_IBLOCK(glColor3s)
+GLATTER_IBLOCK(glColor3sv)
+GLATTER_IBLOCK(glColor3ub)
+GLATTER_IBLOCK(glColor3ubv)
+GLATTER_IBLOCK(glColor3ui)
+GLATTER_IBLOCK(glColor3uiv)
+GLATTER_IBLOCK(glColor3us)
+GLATTER_IBLOCK(glColor3usv)
+GLATTER_IBLOCK(glColor4b)
+GLATTER_IBLOCK(glColor4bv)
+GLATTER_IBLOCK(glColor4d)
+GLATTER_IBLOCK(glColor4dv)
+GLATTER_IBLOCK(glColor4f)
+GLATTER_IBLOCK(glColor4fv)
+GLATTER_IBLOCK(glColor4i)
+GLATTER_IBLOCK(glColor4iv)
+GLATTER_IBLOCK(glColor4s)
+GLATTER_IBLOCK(glColor4sv)
+GLATTER_IBLOCK(glColor4ub)
+GLATTER_IBLOCK(glColor4ubv)
+GLATTER_IBLOCK(glColor4ui)
+GLATTER_IBLOCK(glColor4uiv)
+GLATTER_IBLOCK(glColor4us)
+GLATTER_IBLOCK(glColor4usv)
+GLATTER_IBLOCK(glColorMask)
+GLATTER_IBLOCK(glColorMaterial)
+GLATTER_IBLOCK(glColorPointer)
+GLATTER_IBLOCK(glCopyPixels)
+GLATTER_IBLOCK(glCopyTexImage1D)
+GLATTER_IBLOCK(glCopyTexImage2D)
+GLATTER_IBLOCK(glCopyTexSubImage1D)
+GLATTER_IBLOCK(glCopyTexSubImage2D)
+GLATTER_IBLOCK(glCullFace)
+GLATTER_IBLOCK(glDeleteLists)
+GLATTER_IBLOCK(glDeleteTextures)
+GLATTER_IBLOCK(glDepthFunc)
+GLATTER_IBLOCK(glDepthMask)
+GLATTER_IBLOCK(glDepthRange)
+GLATTER_IBLOCK(glDisable)
+GLATTER_IBLOCK(glDisableClientState)
+GLATTER_IBLOCK(glDrawArrays)
+GLATTER_IBLOCK(glDrawBuffer)
+GLATTER_IBLOCK(glDrawElements)
+GLATTER_IBLOCK(glDrawPixels)
+GLATTER_IBLOCK(glEdgeFlag)
+GLATTER_IBLOCK(glEdgeFlagPointer)
+GLATTER_IBLOCK(glEdgeFlagv)
+GLATTER_IBLOCK(glEnable)
+GLATTER_IBLOCK(glEnableClientState)
+GLATTER_IBLOCK(glEnd)
+GLATTER_IBLOCK(glEndList)
+GLATTER_IBLOCK(glEvalCoord1d)
+GLATTER_IBLOCK(glEvalCoord1dv)
+GLATTER_IBLOCK(glEvalCoord1f)
+GLATTER_IBLOCK(glEvalCoord1fv)
+GLATTER_IBLOCK(glEvalCoord2d)
+GLATTER_IBLOCK(glEvalCoord2dv)
+GLATTER_IBLOCK(glEvalCoord2f)
+GLATTER_IBLOCK(glEvalCoord2fv)
+GLATTER_IBLOCK(glEvalMesh1)
+GLATTER_IBLOCK(glEvalMesh2)
+GLATTER_IBLOCK(glEvalPoint1)
+GLATTER_IBLOCK(glEvalPoint2)
+GLATTER_IBLOCK(glFeedbackBuffer)
+GLATTER_IBLOCK(glFinish)
+GLATTER_IBLOCK(glFlush)
+GLATTER_IBLOCK(glFogf)
+GLATTER_IBLOCK(glFogfv)
+GLATTER_IBLOCK(glFogi)
+GLATTER_IBLOCK(glFogiv)
+GLATTER_IBLOCK(glFrontFace)
+GLATTER_IBLOCK(glFrustum)
+GLATTER_IBLOCK(glGenLists)
+GLATTER_IBLOCK(glGenTextures)
+GLATTER_IBLOCK(glGetBooleanv)
+GLATTER_IBLOCK(glGetClipPlane)
+GLATTER_IBLOCK(glGetDoublev)
+GLATTER_IBLOCK(glGetError)
+GLATTER_IBLOCK(glGetFloatv)
+GLATTER_IBLOCK(glGetIntegerv)
+GLATTER_IBLOCK(glGetLightfv)
+GLATTER_IBLOCK(glGetLightiv)
+GLATTER_IBLOCK(glGetMapdv)
+GLATTER_IBLOCK(glGetMapfv)
+GLATTER_IBLOCK(glGetMapiv)
+GLATTER_IBLOCK(glGetMaterialfv)
+GLATTER_IBLOCK(glGetMaterialiv)
+GLATTER_IBLOCK(glGetPixelMapfv)
+GLATTER_IBLOCK(glGetPixelMapuiv)
+GLATTER_IBLOCK(glGetPixelMapusv)
+GLATTER_IBLOCK(glGetPointerv)
+GLATTER_IBLOCK(glGetPolygonStipple)
+GLATTER_IBLOCK(glGetString)
+GLATTER_IBLOCK(glGetTexEnvfv)
+GLATTER_IBLOCK(glGetTexEnviv)
+GLATTER_IBLOCK(glGetTexGendv)
+GLATTER_IBLOCK(glGetTexGenfv)
+GLATTER_IBLOCK(glGetTexGeniv)
+GLATTER_IBLOCK(glGetTexImage)
+GLATTER_IBLOCK(glGetTexLevelParameterfv)
+GLATTER_IBLOCK(glGetTexLevelParameteriv)
+GLATTER_IBLOCK(glGetTexParameterfv)
+GLATTER_IBLOCK(glGetTexParameteriv)
+GLATTER_IBLOCK(glHint)
+GLATTER_IBLOCK(glIndexMask)
+GLATTER_IBLOCK(glIndexPointer)
+GLATTER_IBLOCK(glIndexd)
+GLATTER_IBLOCK(glIndexdv)
+GLATTER_IBLOCK(glIndexf)
+GLATTER_IBLOCK(glIndexfv)
+GLATTER_IBLOCK(glIndexi)
+GLATTER_IBLOCK(glIndexiv)
+GLATTER_IBLOCK(glIndexs)
+GLATTER_IBLOCK(glIndexsv)
+GLATTER_IBLOCK(glIndexub)
+GLATTER_IBLOCK(glIndexubv)
+GLATTER_IBLOCK(glInitNames)
+GLATTER_IBLOCK(glInterleavedArrays)
+GLATTER_IBLOCK(glIsEnabled)
+GLATTER_IBLOCK(glIsList)
+GLATTER_IBLOCK(glIsTexture)
+GLATTER_IBLOCK(glLightModelf)
+GLATTER_IBLOCK(glLightModelfv)
+GLATTER_IBLOCK(glLightModeli)
+GLATTER_IBLOCK(glLightModeliv)
+GLATTER_IBLOCK(glLightf)
+GLATTER_IBLOCK(glLightfv)
+GLATTER_IBLOCK(glLighti)
+GLATTER_IBLOCK(glLightiv)
+GLATTER_IBLOCK(glLineStipple)
+GLATTER_IBLOCK(glLineWidth)
+GLATTER_IBLOCK(glListBase)
+GLATTER_IBLOCK(glLoadIdentity)
+GLATTER_IBLOCK(glLoadMatrixd)
+GLATTER_IBLOCK(glLoadMatrixf)
+GLATTER_IBLOCK(glLoadName)
+GLATTER_IBLOCK(glLogicOp)
+GLATTER_IBLOCK(glMap1d)
+GLATTER_IBLOCK(glMap1f)
+GLATTER_IBLOCK(glMap2d)
+GLATTER_IBLOCK(glMap2f)
+GLATTER_IBLOCK(glMapGrid1d)
+GLATTER_IBLOCK(glMapGrid1f)
+GLATTER_IBLOCK(glMapGrid2d)
+GLATTER_IBLOCK(glMapGrid2f)
+GLATTER_IBLOCK(glMaterialf)
+GLATTER_IBLOCK(glMaterialfv)
+GLATTER_IBLOCK(glMateriali)
+GLATTER_IBLOCK(glMaterialiv)
+GLATTER_IBLOCK(glMatrixMode)
+GLATTER_IBLOCK(glMultMatrixd)
+GLATTER_IBLOCK(glMultMatrixf)
+GLATTER_IBLOCK(glNewList)
+GLATTER_IBLOCK(glNormal3b)
+GLATTER_IBLOCK(glNormal3bv)
+GLATTER_IBLOCK(glNormal3d)
+GLATTER_IBLOCK(glNormal3dv)
+GLATTER_IBLOCK(glNormal3f)
+GLATTER_IBLOCK(glNormal3fv)
+GLATTER_IBLOCK(glNormal3i)
+GLATTER_IBLOCK(glNormal3iv)
+GLATTER_IBLOCK(glNormal3s)
+GLATTER_IBLOCK(glNormal3sv)
+GLATTER_IBLOCK(glNormalPointer)
+GLATTER_IBLOCK(glOrtho)
+GLATTER_IBLOCK(glPassThrough)
+GLATTER_IBLOCK(glPixelMapfv)
+GLATTER_IBLOCK(glPixelMapuiv)
+GLATTER_IBLOCK(glPixelMapusv)
+GLATTER_IBLOCK(glPixelStoref)
+GLATTER_IBLOCK(glPixelStorei)
+GLATTER_IBLOCK(glPixelTransferf)
+GLATTER_IBLOCK(glPixelTransferi)
+GLATTER_IBLOCK(glPixelZoom)
+GLATTER_IBLOCK(glPointSize)
+GLATTER_IBLOCK(glPolygonMode)
+GLATTER_IBLOCK(glPolygonOffset)
+GLATTER_IBLOCK(glPolygonStipple)
+GLATTER_IBLOCK(glPopAttrib)
+GLATTER_IBLOCK(glPopClientAttrib)
+GLATTER_IBLOCK(glPopMatrix)
+GLATTER_IBLOCK(glPopName)
+GLATTER_IBLOCK(glPrioritizeTextures)
+GLATTER_IBLOCK(glPushAttrib)
+GLATTER_IBLOCK(glPushClientAttrib)
+GLATTER_IBLOCK(glPushMatrix)
+GLATTER_IBLOCK(glPushName)
+GLATTER_IBLOCK(glRasterPos2d)
+GLATTER_IBLOCK(glRasterPos2dv)
+GLATTER_IBLOCK(glRasterPos2f)
+GLATTER_IBLOCK(glRasterPos2fv)
+GLATTER_IBLOCK(glRasterPos2i)
+GLATTER_IBLOCK(glRasterPos2iv)
+GLATTER_IBLOCK(glRasterPos2s)
+GLATTER_IBLOCK(glRasterPos2sv)
+GLATTER_IBLOCK(glRasterPos3d)
+GLATTER_IBLOCK(glRasterPos3dv)
+GLATTER_IBLOCK(glRasterPos3f)
+GLATTER_IBLOCK(glRasterPos3fv)
+GLATTER_IBLOCK(glRasterPos3i)
+GLATTER_IBLOCK(glRasterPos3iv)
+GLATTER_IBLOCK(glRasterPos3s)
+GLATTER_IBLOCK(glRasterPos3sv)
+GLATTER_IBLOCK(glRasterPos4d)
+GLATTER_IBLOCK(glRasterPos4dv)
+GLATTER_IBLOCK(glRasterPos4f)
+GLATTER_IBLOCK(glRasterPos4fv)
+GLATTER_IBLOCK(glRasterPos4i)
+GLATTER_IBLOCK(glRasterPos4iv)
+GLATTER_IBLOCK(glRasterPos4s)
+GLATTER_IBLOCK(glRasterPos4sv)
+GLATTER_IBLOCK(glReadBuffer)
+GLATTER_IBLOCK(glReadPixels)
+GLATTER_IBLOCK(glRectd)
+GLATTER_IBLOCK(glRectdv)
+GLATTER_IBLOCK(glRectf)
+GLATTER_IBLOCK(glRectfv)
+GLATTER_IBLOCK(glRecti)
+GLATTER_IBLOCK(glRectiv)
+GLATTER_IBLOCK(glRects)
+GLATTER_IBLOCK(glRectsv)
+GLATTER_IBLOCK(glRenderMode)
+GLATTER_IBLOCK(glRotated)
+GLATTER_IBLOCK(glRotatef)
+GLATTER_IBLOCK(glScaled)
+GLATTER_IBLOCK(glScalef)
+GLATTER_IBLOCK(glScissor)
+GLATTER_IBLOCK(glSelectBuffer)
+GLATTER_IBLOCK(glShadeModel)
+GLATTER_IBLOCK(glStencilFunc)
+GLATTER_IBLOCK(glStencilMask)
+GLATTER_IBLOCK(glStencilOp)
+GLATTER_IBLOCK(glTexCoord1d)
+GLATTER_IBLOCK(glTexCoord1dv)
+GLATTER_IBLOCK(glTexCoord1f)
+GLATTER_IBLOCK(glTexCoord1fv)
+GLATTER_IBLOCK(glTexCoord1i)
+GLATTER_IBLOCK(glTexCoord1iv)
+GLATTER_IBLOCK(glTexCoord1s)
+GLATTER_IBLOCK(glTexCoord1sv)
+GLATTER_IBLOCK(glTexCoord2d)
+GLATTER_IBLOCK(glTexCoord2dv)
+GLATTER_IBLOCK(glTexCoord2f)
+GLATTER_IBLOCK(glTexCoord2fv)
+GLATTER_IBLOCK(glTexCoord2i)
+GLATTER_IBLOCK(glTexCoord2iv)
+GLATTER_IBLOCK(glTexCoord2s)
+GLATTER_IBLOCK(glTexCoord2sv)
+GLATTER_IBLOCK(glTexCoord3d)
+GLATTER_IBLOCK(glTexCoord3dv)
+GLATTER_IBLOCK(glTexCoord3f)
+GLATTER_IBLOCK(glTexCoord3fv)
+GLATTER_IBLOCK(glTexCoord3i)
+GLATTER_IBLOCK(glTexCoord3iv)
+GLATTER_IBLOCK(glTexCoord3s)
+GLATTER_IBLOCK(glTexCoord3sv)
+GLATTER_IBLOCK(glTexCoord4d)
+GLATTER_IBLOCK(glTexCoord4dv)
+GLATTER_IBLOCK(glTexCoord4f)
+GLATTER_IBLOCK(glTexCoord4fv)
+GLATTER_IBLOCK(glTexCoord4i)
+GLATTER_IBLOCK(glTexCoord4iv)
+GLATTER_IBLOCK(glTexCoord4s)
+GLATTER_IBLOCK(glTexCoord4sv)
+GLATTER_IBLOCK(glTexCoordPointer)
+GLATTER_IBLOCK(glTexEnvf)
+GLATTER_IBLOCK(glTexEnvfv)
+GLATTER_IBLOCK(glTexEnvi)
+GLATTER_IBLOCK(glTexEnviv)
+GLATTER_IBLOCK(glTexGend)
+GLATTER_IBLOCK(glTexGendv)
+GLATTER_IBLOCK(glTexGenf)
+GLATTER_IBLOCK(glTexGenfv)
+GLATTER_IBLOCK(glTexGeni)
+GLATTER_IBLOCK(glTexGeniv)
+GLATTER_IBLOCK(glTexImage1D)
+GLATTER_IBLOCK(glTexImage2D)
+GLATTER_IBLOCK(glTexParameterf)
+GLATTER_IBLOCK(glTexParameterfv)
+GLATTER_IBLOCK(glTexParameteri)
+GLATTER_IBLOCK(glTexParameteriv)
+GLATTER_IBLOCK(glTexSubImage1D)
+GLATTER_IBLOCK(glTexSubImage2D)
+GLATTER_IBLOCK(glTranslated)
+GLATTER_IBLOCK(glTranslatef)
+GLATTER_IBLOCK(glVertex2d)
+GLATTER_IBLOCK(glVertex2dv)
+GLATTER_IBLOCK(glVertex2f)
+GLATTER_IBLOCK(glVertex2fv)
+GLATTER_IBLOCK(glVertex2i)
+GLATTER_IBLOCK(glVertex2iv)
+GLATTER_IBLOCK(glVertex2s)
+GLATTER_IBLOCK(glVertex2sv)
+GLATTER_IBLOCK(glVertex3d)
+GLATTER_IBLOCK(glVertex3dv)
+GLATTER_IBLOCK(glVertex3f)
+GLATTER_IBLOCK(glVertex3fv)
+GLATTER_IBLOCK(glVertex3i)
+GLATTER_IBLOCK(glVertex3iv)
+GLATTER_IBLOCK(glVertex3s)
+GLATTER_IBLOCK(glVertex3sv)
+GLATTER_IBLOCK(glVertex4d)
+GLATTER_IBLOCK(glVertex4dv)
+GLATTER_IBLOCK(glVertex4f)
+GLATTER_IBLOCK(glVertex4fv)
+GLATTER_IBLOCK(glVertex4i)
+GLATTER_IBLOCK(glVertex4iv)
+GLATTER_IBLOCK(glVertex4s)
+GLATTER_IBLOCK(glVertex4sv)
+GLATTER_IBLOCK(glVertexPointer)
+GLATTER_IBLOCK(glViewport)
+#endif // defined(__gl_h_)
+#endif // defined(__GL_H__)
+#endif // !defined(GL_VERSION_ES_CM_1_0)
+#if defined(__gl_glext_h_)
+#if defined(GL_3DFX_tbuffer)
+GLATTER_IEXTENSION(GL_3DFX_tbuffer)
+GLATTER_IBLOCK(glTbufferMask3DFX)
+#endif // defined(GL_3DFX_tbuffer)
+#if defined(GL_AMD_debug_output)
+GLATTER_IEXTENSION(GL_AMD_debug_output)
+GLATTER_IBLOCK(glDebugMessageCallbackAMD)
+GLATTER_IBLOCK(glDebugMessageEnableAMD)
+GLATTER_IBLOCK(glDebugMessageInsertAMD)
+GLATTER_IBLOCK(glGetDebugMessageLogAMD)
+#endif // defined(GL_AMD_debug_output)
+#if defined(GL_AMD_draw_buffers_blend)
+GLATTER_IEXTENSION(GL_AMD_draw_buffers_blend)
+GLATTER_IBLOCK(glBlendEquationIndexedAMD)
+GLATTER_IBLOCK(glBlendEquationSeparateIndexedAMD)
+GLATTER_IBLOCK(glBlendFuncIndexedAMD)
+GLATTER_IBLOCK(glBlendFuncSeparateIndexedAMD)
+#endif // defined(GL_AMD_draw_buffers_blend)
+#if defined(GL_AMD_framebuffer_multisample_advanced)
+GLATTER_IEXTENSION(GL_AMD_framebuffer_multisample_advanced)
+GLATTER_IBLOCK(glNamedRenderbufferStorageMultisampleAdvancedAMD)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleAdvancedAMD)
+#endif // defined(GL_AMD_framebuffer_multisample_advanced)
+#if defined(GL_AMD_framebuffer_sample_positions)
+GLATTER_IEXTENSION(GL_AMD_framebuffer_sample_positions)
+GLATTER_IBLOCK(glFramebufferSamplePositionsfvAMD)
+GLATTER_IBLOCK(glGetFramebufferParameterfvAMD)
+GLATTER_IBLOCK(glGetNamedFramebufferParameterfvAMD)
+GLATTER_IBLOCK(glNamedFramebufferSamplePositionsfvAMD)
+#endif // defined(GL_AMD_framebuffer_sample_positions)
+#if defined(GL_AMD_gpu_shader_int64)
+GLATTER_IEXTENSION(GL_AMD_gpu_shader_int64)
+GLATTER_IBLOCK(glGetUniformi64vNV)
+GLATTER_IBLOCK(glGetUniformui64vNV)
+GLATTER_IBLOCK(glProgramUniform1i64NV)
+GLATTER_IBLOCK(glProgramUniform1i64vNV)
+GLATTER_IBLOCK(glProgramUniform1ui64NV)
+GLATTER_IBLOCK(glProgramUniform1ui64vNV)
+GLATTER_IBLOCK(glProgramUniform2i64NV)
+GLATTER_IBLOCK(glProgramUniform2i64vNV)
+GLATTER_IBLOCK(glProgramUniform2ui64NV)
+GLATTER_IBLOCK(glProgramUniform2ui64vNV)
+GLATTER_IBLOCK(glProgramUniform3i64NV)
+GLATTER_IBLOCK(glProgramUniform3i64vNV)
+GLATTER_IBLOCK(glProgramUniform3ui64NV)
+GLATTER_IBLOCK(glProgramUniform3ui64vNV)
+GLATTER_IBLOCK(glProgramUniform4i64NV)
+GLATTER_IBLOCK(glProgramUniform4i64vNV)
+GLATTER_IBLOCK(glProgramUniform4ui64NV)
+GLATTER_IBLOCK(glProgramUniform4ui64vNV)
+GLATTER_IBLOCK(glUniform1i64NV)
+GLATTER_IBLOCK(glUniform1i64vNV)
+GLATTER_IBLOCK(glUniform1ui64NV)
+GLATTER_IBLOCK(glUniform1ui64vNV)
+GLATTER_IBLOCK(glUniform2i64NV)
+GLATTER_IBLOCK(glUniform2i64vNV)
+GLATTER_IBLOCK(glUniform2ui64NV)
+GLATTER_IBLOCK(glUniform2ui64vNV)
+GLATTER_IBLOCK(glUniform3i64NV)
+GLATTER_IBLOCK(glUniform3i64vNV)
+GLATTER_IBLOCK(glUniform3ui64NV)
+GLATTER_IBLOCK(glUniform3ui64vNV)
+GLATTER_IBLOCK(glUniform4i64NV)
+GLATTER_IBLOCK(glUniform4i64vNV)
+GLATTER_IBLOCK(glUniform4ui64NV)
+GLATTER_IBLOCK(glUniform4ui64vNV)
+#endif // defined(GL_AMD_gpu_shader_int64)
+#if defined(GL_AMD_interleaved_elements)
+GLATTER_IEXTENSION(GL_AMD_interleaved_elements)
+GLATTER_IBLOCK(glVertexAttribParameteriAMD)
+#endif // defined(GL_AMD_interleaved_elements)
+#if defined(GL_AMD_multi_draw_indirect)
+GLATTER_IEXTENSION(GL_AMD_multi_draw_indirect)
+GLATTER_IBLOCK(glMultiDrawArraysIndirectAMD)
+GLATTER_IBLOCK(glMultiDrawElementsIndirectAMD)
+#endif // defined(GL_AMD_multi_draw_indirect)
+#if defined(GL_AMD_name_gen_delete)
+GLATTER_IEXTENSION(GL_AMD_name_gen_delete)
+GLATTER_IBLOCK(glDeleteNamesAMD)
+GLATTER_IBLOCK(glGenNamesAMD)
+GLATTER_IBLOCK(glIsNameAMD)
+#endif // defined(GL_AMD_name_gen_delete)
+#if defined(GL_AMD_occlusion_query_event)
+GLATTER_IEXTENSION(GL_AMD_occlusion_query_event)
+GLATTER_IBLOCK(glQueryObjectParameteruiAMD)
+#endif // defined(GL_AMD_occlusion_query_event)
+#if defined(GL_AMD_performance_monitor)
+GLATTER_IEXTENSION(GL_AMD_performance_monitor)
+GLATTER_IBLOCK(glBeginPerfMonitorAMD)
+GLATTER_IBLOCK(glDeletePerfMonitorsAMD)
+GLATTER_IBLOCK(glEndPerfMonitorAMD)
+GLATTER_IBLOCK(glGenPerfMonitorsAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCounterDataAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCounterInfoAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCounterStringAMD)
+GLATTER_IBLOCK(glGetPerfMonitorCountersAMD)
+GLATTER_IBLOCK(glGetPerfMonitorGroupStringAMD)
+GLATTER_IBLOCK(glGetPerfMonitorGroupsAMD)
+GLATTER_IBLOCK(glSelectPerfMonitorCountersAMD)
+#endif // defined(GL_AMD_performance_monitor)
+#if defined(GL_AMD_sample_positions)
+GLATTER_IEXTENSION(GL_AMD_sample_positions)
+GLATTER_IBLOCK(glSetMultisamplefvAMD)
+#endif // defined(GL_AMD_sample_positions)
+#if defined(GL_AMD_sparse_texture)
+GLATTER_IEXTENSION(GL_AMD_sparse_texture)
+GLATTER_IBLOCK(glTexStorageSparseAMD)
+GLATTER_IBLOCK(glTextureStorageSparseAMD)
+#endif // defined(GL_AMD_sparse_texture)
+#if defined(GL_AMD_stencil_operation_extended)
+GLATTER_IEXTENSION(GL_AMD_stencil_operation_extended)
+GLATTER_IBLOCK(glStencilOpValueAMD)
+#endif // defined(GL_AMD_stencil_operation_extended)
+#if defined(GL_AMD_vertex_shader_tessellator)
+GLATTER_IEXTENSION(GL_AMD_vertex_shader_tessellator)
+GLATTER_IBLOCK(glTessellationFactorAMD)
+GLATTER_IBLOCK(glTessellationModeAMD)
+#endif // defined(GL_AMD_vertex_shader_tessellator)
+#if defined(GL_APPLE_element_array)
+GLATTER_IEXTENSION(GL_APPLE_element_array)
+GLATTER_IBLOCK(glDrawElementArrayAPPLE)
+GLATTER_IBLOCK(glDrawRangeElementArrayAPPLE)
+GLATTER_IBLOCK(glElementPointerAPPLE)
+GLATTER_IBLOCK(glMultiDrawElementArrayAPPLE)
+GLATTER_IBLOCK(glMultiDrawRangeElementArrayAPPLE)
+#endif // defined(GL_APPLE_element_array)
+#if defined(GL_APPLE_fence)
+GLATTER_IEXTENSION(GL_APPLE_fence)
+GLATTER_IBLOCK(glDeleteFencesAPPLE)
+GLATTER_IBLOCK(glFinishFenceAPPLE)
+GLATTER_IBLOCK(glFinishObjectAPPLE)
+GLATTER_IBLOCK(glGenFencesAPPLE)
+GLATTER_IBLOCK(glIsFenceAPPLE)
+GLATTER_IBLOCK(glSetFenceAPPLE)
+GLATTER_IBLOCK(glTestFenceAPPLE)
+GLATTER_IBLOCK(glTestObjectAPPLE)
+#endif // defined(GL_APPLE_fence)
+#if defined(GL_APPLE_flush_buffer_range)
+GLATTER_IEXTENSION(GL_APPLE_flush_buffer_range)
+GLATTER_IBLOCK(glBufferParameteriAPPLE)
+GLATTER_IBLOCK(glFlushMappedBufferRangeAPPLE)
+#endif // defined(GL_APPLE_flush_buffer_range)
+#if defined(GL_APPLE_object_purgeable)
+GLATTER_IEXTENSION(GL_APPLE_object_purgeable)
+GLATTER_IBLOCK(glGetObjectParameterivAPPLE)
+GLATTER_IBLOCK(glObjectPurgeableAPPLE)
+GLATTER_IBLOCK(glObjectUnpurgeableAPPLE)
+#endif // defined(GL_APPLE_object_purgeable)
+#if defined(GL_APPLE_texture_range)
+GLATTER_IEXTENSION(GL_APPLE_texture_range)
+GLATTER_IBLOCK(glGetTexParameterPointervAPPLE)
+GLATTER_IBLOCK(glTextureRangeAPPLE)
+#endif // defined(GL_APPLE_texture_range)
+#if defined(GL_APPLE_vertex_array_object)
+GLATTER_IEXTENSION(GL_APPLE_vertex_array_object)
+GLATTER_IBLOCK(glBindVertexArrayAPPLE)
+GLATTER_IBLOCK(glDeleteVertexArraysAPPLE)
+GLATTER_IBLOCK(glGenVertexArraysAPPLE)
+GLATTER_IBLOCK(glIsVertexArrayAPPLE)
+#endif // defined(GL_APPLE_vertex_array_object)
+#if defined(GL_APPLE_vertex_array_range)
+GLATTER_IEXTENSION(GL_APPLE_vertex_array_range)
+GLATTER_IBLOCK(glFlushVertexArrayRangeAPPLE)
+GLATTER_IBLOCK(glVertexArrayParameteriAPPLE)
+GLATTER_IBLOCK(glVertexArrayRangeAPPLE)
+#endif // defined(GL_APPLE_vertex_array_range)
+#if defined(GL_APPLE_vertex_program_evaluators)
+GLATTER_IEXTENSION(GL_APPLE_vertex_program_evaluators)
+GLATTER_IBLOCK(glDisableVertexAttribAPPLE)
+GLATTER_IBLOCK(glEnableVertexAttribAPPLE)
+GLATTER_IBLOCK(glIsVertexAttribEnabledAPPLE)
+GLATTER_IBLOCK(glMapVertexAttrib1dAPPLE)
+GLATTER_IBLOCK(glMapVertexAttrib1fAPPLE)
+GLATTER_IBLOCK(glMapVertexAttrib2dAPPLE)
+GLATTER_IBLOCK(glMapVertexAttrib2fAPPLE)
+#endif // defined(GL_APPLE_vertex_program_evaluators)
+#if defined(GL_ARB_ES3_2_compatibility)
+GLATTER_IEXTENSION(GL_ARB_ES3_2_compatibility)
+GLATTER_IBLOCK(glPrimitiveBoundingBoxARB)
+#endif // defined(GL_ARB_ES3_2_compatibility)
+#if defined(GL_ARB_bindless_texture)
+GLATTER_IEXTENSION(GL_ARB_bindless_texture)
+GLATTER_IBLOCK(glGetImageHandleARB)
+GLATTER_IBLOCK(glGetTextureHandleARB)
+GLATTER_IBLOCK(glGetTextureSamplerHandleARB)
+GLATTER_IBLOCK(glGetVertexAttribLui64vARB)
+GLATTER_IBLOCK(glIsImageHandleResidentARB)
+GLATTER_IBLOCK(glIsTextureHandleResidentARB)
+GLATTER_IBLOCK(glMakeImageHandleNonResidentARB)
+GLATTER_IBLOCK(glMakeImageHandleResidentARB)
+GLATTER_IBLOCK(glMakeTextureHandleNonResidentARB)
+GLATTER_IBLOCK(glMakeTextureHandleResidentARB)
+GLATTER_IBLOCK(glProgramUniformHandleui64ARB)
+GLATTER_IBLOCK(glProgramUniformHandleui64vARB)
+GLATTER_IBLOCK(glUniformHandleui64ARB)
+GLATTER_IBLOCK(glUniformHandleui64vARB)
+GLATTER_IBLOCK(glVertexAttribL1ui64ARB)
+GLATTER_IBLOCK(glVertexAttribL1ui64vARB)
+#endif // defined(GL_ARB_bindless_texture)
+#if defined(GL_ARB_cl_event)
+GLATTER_IEXTENSION(GL_ARB_cl_event)
+GLATTER_IBLOCK(glCreateSyncFromCLeventARB)
+#endif // defined(GL_ARB_cl_event)
+#if defined(GL_ARB_color_buffer_float)
+GLATTER_IEXTENSION(GL_ARB_color_buffer_float)
+GLATTER_IBLOCK(glClampColorARB)
+#endif // defined(GL_ARB_color_buffer_float)
+#if defined(GL_ARB_compute_variable_group_size)
+GLATTER_IEXTENSION(GL_ARB_compute_variable_group_size)
+GLATTER_IBLOCK(glDispatchComputeGroupSizeARB)
+#endif // defined(GL_ARB_compute_variable_group_size)
+#if defined(GL_ARB_debug_output)
+GLATTER_IEXTENSION(GL_ARB_debug_output)
+GLATTER_IBLOCK(glDebugMessageCallbackARB)
+GLATTER_IBLOCK(glDebugMessageControlARB)
+GLATTER_IBLOCK(glDebugMessageInsertARB)
+GLATTER_IBLOCK(glGetDebugMessageLogARB)
+#endif // defined(GL_ARB_debug_output)
+#if defined(GL_ARB_draw_buffers)
+GLATTER_IEXTENSION(GL_ARB_draw_buffers)
+GLATTER_IBLOCK(glDrawBuffersARB)
+#endif // defined(GL_ARB_draw_buffers)
+#if defined(GL_ARB_draw_buffers_blend)
+GLATTER_IEXTENSION(GL_ARB_draw_buffers_blend)
+GLATTER_IBLOCK(glBlendEquationSeparateiARB)
+GLATTER_IBLOCK(glBlendEquationiARB)
+GLATTER_IBLOCK(glBlendFuncSeparateiARB)
+GLATTER_IBLOCK(glBlendFunciARB)
+#endif // defined(GL_ARB_draw_buffers_blend)
+#if defined(GL_ARB_draw_instanced)
+GLATTER_IEXTENSION(GL_ARB_draw_instanced)
+GLATTER_IBLOCK(glDrawArraysInstancedARB)
+GLATTER_IBLOCK(glDrawElementsInstancedARB)
+#endif // defined(GL_ARB_draw_instanced)
+#if defined(GL_ARB_fragment_program)
+GLATTER_IEXTENSION(GL_ARB_fragment_program)
+GLATTER_IBLOCK(glBindProgramARB)
+GLATTER_IBLOCK(glDeleteProgramsARB)
+GLATTER_IBLOCK(glGenProgramsARB)
+GLATTER_IBLOCK(glGetProgramEnvParameterdvARB)
+GLATTER_IBLOCK(glGetProgramEnvParameterfvARB)
+GLATTER_IBLOCK(glGetProgramLocalParameterdvARB)
+GLATTER_IBLOCK(glGetProgramLocalParameterfvARB)
+GLATTER_IBLOCK(glGetProgramStringARB)
+GLATTER_IBLOCK(glGetProgramivARB)
+GLATTER_IBLOCK(glIsProgramARB)
+GLATTER_IBLOCK(glProgramEnvParameter4dARB)
+GLATTER_IBLOCK(glProgramEnvParameter4dvARB)
+GLATTER_IBLOCK(glProgramEnvParameter4fARB)
+GLATTER_IBLOCK(glProgramEnvParameter4fvARB)
+GLATTER_IBLOCK(glProgramLocalParameter4dARB)
+GLATTER_IBLOCK(glProgramLocalParameter4dvARB)
+GLATTER_IBLOCK(glProgramLocalParameter4fARB)
+GLATTER_IBLOCK(glProgramLocalParameter4fvARB)
+GLATTER_IBLOCK(glProgramStringARB)
+#endif // defined(GL_ARB_fragment_program)
+#if defined(GL_ARB_geometry_shader4)
+GLATTER_IEXTENSION(GL_ARB_geometry_shader4)
+GLATTER_IBLOCK(glFramebufferTextureARB)
+GLATTER_IBLOCK(glFramebufferTextureFaceARB)
+GLATTER_IBLOCK(glFramebufferTextureLayerARB)
+GLATTER_IBLOCK(glProgramParameteriARB)
+#endif // defined(GL_ARB_geometry_shader4)
+#if defined(GL_ARB_gl_spirv)
+GLATTER_IEXTENSION(GL_ARB_gl_spirv)
+GLATTER_IBLOCK(glSpecializeShaderARB)
+#endif // defined(GL_ARB_gl_spirv)
+#if defined(GL_ARB_gpu_shader_int64)
+GLATTER_IEXTENSION(GL_ARB_gpu_shader_int64)
+GLATTER_IBLOCK(glGetUniformi64vARB)
+GLATTER_IBLOCK(glGetUniformui64vARB)
+GLATTER_IBLOCK(glGetnUniformi64vARB)
+GLATTER_IBLOCK(glGetnUniformui64vARB)
+GLATTER_IBLOCK(glProgramUniform1i64ARB)
+GLATTER_IBLOCK(glProgramUniform1i64vARB)
+GLATTER_IBLOCK(glProgramUniform1ui64ARB)
+GLATTER_IBLOCK(glProgramUniform1ui64vARB)
+GLATTER_IBLOCK(glProgramUniform2i64ARB)
+GLATTER_IBLOCK(glProgramUniform2i64vARB)
+GLATTER_IBLOCK(glProgramUniform2ui64ARB)
+GLATTER_IBLOCK(glProgramUniform2ui64vARB)
+GLATTER_IBLOCK(glProgramUniform3i64ARB)
+GLATTER_IBLOCK(glProgramUniform3i64vARB)
+GLATTER_IBLOCK(glProgramUniform3ui64ARB)
+GLATTER_IBLOCK(glProgramUniform3ui64vARB)
+GLATTER_IBLOCK(glProgramUniform4i64ARB)
+GLATTER_IBLOCK(glProgramUniform4i64vARB)
+GLATTER_IBLOCK(glProgramUniform4ui64ARB)
+GLATTER_IBLOCK(glProgramUniform4ui64vARB)
+GLATTER_IBLOCK(glUniform1i64ARB)
+GLATTER_IBLOCK(glUniform1i64vARB)
+GLATTER_IBLOCK(glUniform1ui64ARB)
+GLATTER_IBLOCK(glUniform1ui64vARB)
+GLATTER_IBLOCK(glUniform2i64ARB)
+GLATTER_IBLOCK(glUniform2i64vARB)
+GLATTER_IBLOCK(glUniform2ui64ARB)
+GLATTER_IBLOCK(glUniform2ui64vARB)
+GLATTER_IBLOCK(glUniform3i64ARB)
+GLATTER_IBLOCK(glUniform3i64vARB)
+GLATTER_IBLOCK(glUniform3ui64ARB)
+GLATTER_IBLOCK(glUniform3ui64vARB)
+GLATTER_IBLOCK(glUniform4i64ARB)
+GLATTER_IBLOCK(glUniform4i64vARB)
+GLATTER_IBLOCK(glUniform4ui64ARB)
+GLATTER_IBLOCK(glUniform4ui64vARB)
+#endif // defined(GL_ARB_gpu_shader_int64)
+#if defined(GL_ARB_imaging)
+GLATTER_IEXTENSION(GL_ARB_imaging)
+GLATTER_IBLOCK(glColorSubTable)
+GLATTER_IBLOCK(glColorTable)
+GLATTER_IBLOCK(glColorTableParameterfv)
+GLATTER_IBLOCK(glColorTableParameteriv)
+GLATTER_IBLOCK(glConvolutionFilter1D)
+GLATTER_IBLOCK(glConvolutionFilter2D)
+GLATTER_IBLOCK(glConvolutionParameterf)
+GLATTER_IBLOCK(glConvolutionParameterfv)
+GLATTER_IBLOCK(glConvolutionParameteri)
+GLATTER_IBLOCK(glConvolutionParameteriv)
+GLATTER_IBLOCK(glCopyColorSubTable)
+GLATTER_IBLOCK(glCopyColorTable)
+GLATTER_IBLOCK(glCopyConvolutionFilter1D)
+GLATTER_IBLOCK(glCopyConvolutionFilter2D)
+GLATTER_IBLOCK(glGetColorTable)
+GLATTER_IBLOCK(glGetColorTableParameterfv)
+GLATTER_IBLOCK(glGetColorTableParameteriv)
+GLATTER_IBLOCK(glGetConvolutionFilter)
+GLATTER_IBLOCK(glGetConvolutionParameterfv)
+GLATTER_IBLOCK(glGetConvolutionParameteriv)
+GLATTER_IBLOCK(glGetHistogram)
+GLATTER_IBLOCK(glGetHistogramParameterfv)
+GLATTER_IBLOCK(glGetHistogramParameteriv)
+GLATTER_IBLOCK(glGetMinmax)
+GLATTER_IBLOCK(glGetMinmaxParameterfv)
+GLATTER_IBLOCK(glGetMinmaxParameteriv)
+GLATTER_IBLOCK(glGetSeparableFilter)
+GLATTER_IBLOCK(glHistogram)
+GLATTER_IBLOCK(glMinmax)
+GLATTER_IBLOCK(glResetHistogram)
+GLATTER_IBLOCK(glResetMinmax)
+GLATTER_IBLOCK(glSeparableFilter2D)
+#endif // defined(GL_ARB_imaging)
+#if defined(GL_ARB_indirect_parameters)
+GLATTER_IEXTENSION(GL_ARB_indirect_parameters)
+GLATTER_IBLOCK(glMultiDrawArraysIndirectCountARB)
+GLATTER_IBLOCK(glMultiDrawElementsIndirectCountARB)
+#endif // defined(GL_ARB_indirect_parameters)
+#if defined(GL_ARB_instanced_arrays)
+GLATTER_IEXTENSION(GL_ARB_instanced_arrays)
+GLATTER_IBLOCK(glVertexAttribDivisorARB)
+#endif // defined(GL_ARB_instanced_arrays)
+#if defined(GL_ARB_matrix_palette)
+GLATTER_IEXTENSION(GL_ARB_matrix_palette)
+GLATTER_IBLOCK(glCurrentPaletteMatrixARB)
+GLATTER_IBLOCK(glMatrixIndexPointerARB)
+GLATTER_IBLOCK(glMatrixIndexubvARB)
+GLATTER_IBLOCK(glMatrixIndexuivARB)
+GLATTER_IBLOCK(glMatrixIndexusvARB)
+#endif // defined(GL_ARB_matrix_palette)
+#if defined(GL_ARB_multisample)
+GLATTER_IEXTENSION(GL_ARB_multisample)
+GLATTER_IBLOCK(glSampleCoverageARB)
+#endif // defined(GL_ARB_multisample)
+#if defined(GL_ARB_multitexture)
+GLATTER_IEXTENSION(GL_ARB_multitexture)
+GLATTER_IBLOCK(glActiveTextureARB)
+GLATTER_IBLOCK(glClientActiveTextureARB)
+GLATTER_IBLOCK(glMultiTexCoord1dARB)
+GLATTER_IBLOCK(glMultiTexCoord1dvARB)
+GLATTER_IBLOCK(glMultiTexCoord1fARB)
+GLATTER_IBLOCK(glMultiTexCoord1fvARB)
+GLATTER_IBLOCK(glMultiTexCoord1iARB)
+GLATTER_IBLOCK(glMultiTexCoord1ivARB)
+GLATTER_IBLOCK(glMultiTexCoord1sARB)
+GLATTER_IBLOCK(glMultiTexCoord1svARB)
+GLATTER_IBLOCK(glMultiTexCoord2dARB)
+GLATTER_IBLOCK(glMultiTexCoord2dvARB)
+GLATTER_IBLOCK(glMultiTexCoord2fARB)
+GLATTER_IBLOCK(glMultiTexCoord2fvARB)
+GLATTER_IBLOCK(glMultiTexCoord2iARB)
+GLATTER_IBLOCK(glMultiTexCoord2ivARB)
+GLATTER_IBLOCK(glMultiTexCoord2sARB)
+GLATTER_IBLOCK(glMultiTexCoord2svARB)
+GLATTER_IBLOCK(glMultiTexCoord3dARB)
+GLATTER_IBLOCK(glMultiTexCoord3dvARB)
+GLATTER_IBLOCK(glMultiTexCoord3fARB)
+GLATTER_IBLOCK(glMultiTexCoord3fvARB)
+GLATTER_IBLOCK(glMultiTexCoord3iARB)
+GLATTER_IBLOCK(glMultiTexCoord3ivARB)
+GLATTER_IBLOCK(glMultiTexCoord3sARB)
+GLATTER_IBLOCK(glMultiTexCoord3svARB)
+GLATTER_IBLOCK(glMultiTexCoord4dARB)
+GLATTER_IBLOCK(glMultiTexCoord4dvARB)
+GLATTER_IBLOCK(glMultiTexCoord4fARB)
+GLATTER_IBLOCK(glMultiTexCoord4fvARB)
+GLATTER_IBLOCK(glMultiTexCoord4iARB)
+GLATTER_IBLOCK(glMultiTexCoord4ivARB)
+GLATTER_IBLOCK(glMultiTexCoord4sARB)
+GLATTER_IBLOCK(glMultiTexCoord4svARB)
+#endif // defined(GL_ARB_multitexture)
+#if defined(GL_ARB_occlusion_query)
+GLATTER_IEXTENSION(GL_ARB_occlusion_query)
+GLATTER_IBLOCK(glBeginQueryARB)
+GLATTER_IBLOCK(glDeleteQueriesARB)
+GLATTER_IBLOCK(glEndQueryARB)
+GLATTER_IBLOCK(glGenQueriesARB)
+GLATTER_IBLOCK(glGetQueryObjectivARB)
+GLATTER_IBLOCK(glGetQueryObjectuivARB)
+GLATTER_IBLOCK(glGetQueryivARB)
+GLATTER_IBLOCK(glIsQueryARB)
+#endif // defined(GL_ARB_occlusion_query)
+#if defined(GL_ARB_parallel_shader_compile)
+GLATTER_IEXTENSION(GL_ARB_parallel_shader_compile)
+GLATTER_IBLOCK(glMaxShaderCompilerThreadsARB)
+#endif // defined(GL_ARB_parallel_shader_compile)
+#if defined(GL_ARB_point_parameters)
+GLATTER_IEXTENSION(GL_ARB_point_parameters)
+GLATTER_IBLOCK(glPointParameterfARB)
+GLATTER_IBLOCK(glPointParameterfvARB)
+#endif // defined(GL_ARB_point_parameters)
+#if defined(GL_ARB_robustness)
+GLATTER_IEXTENSION(GL_ARB_robustness)
+GLATTER_IBLOCK(glGetGraphicsResetStatusARB)
+GLATTER_IBLOCK(glGetnColorTableARB)
+GLATTER_IBLOCK(glGetnCompressedTexImageARB)
+GLATTER_IBLOCK(glGetnConvolutionFilterARB)
+GLATTER_IBLOCK(glGetnHistogramARB)
+GLATTER_IBLOCK(glGetnMapdvARB)
+GLATTER_IBLOCK(glGetnMapfvARB)
+GLATTER_IBLOCK(glGetnMapivARB)
+GLATTER_IBLOCK(glGetnMinmaxARB)
+GLATTER_IBLOCK(glGetnPixelMapfvARB)
+GLATTER_IBLOCK(glGetnPixelMapuivARB)
+GLATTER_IBLOCK(glGetnPixelMapusvARB)
+GLATTER_IBLOCK(glGetnPolygonStippleARB)
+GLATTER_IBLOCK(glGetnSeparableFilterARB)
+GLATTER_IBLOCK(glGetnTexImageARB)
+GLATTER_IBLOCK(glGetnUniformdvARB)
+GLATTER_IBLOCK(glGetnUniformfvARB)
+GLATTER_IBLOCK(glGetnUniformivARB)
+GLATTER_IBLOCK(glGetnUniformuivARB)
+GLATTER_IBLOCK(glReadnPixelsARB)
+#endif // defined(GL_ARB_robustness)
+#if defined(GL_ARB_sample_locations)
+GLATTER_IEXTENSION(GL_ARB_sample_locations)
+GLATTER_IBLOCK(glEvaluateDepthValuesARB)
+GLATTER_IBLOCK(glFramebufferSampleLocationsfvARB)
+GLATTER_IBLOCK(glNamedFramebufferSampleLocationsfvARB)
+#endif // defined(GL_ARB_sample_locations)
+#if defined(GL_ARB_sample_shading)
+GLATTER_IEXTENSION(GL_ARB_sample_shading)
+GLATTER_IBLOCK(glMinSampleShadingARB)
+#endif // defined(GL_ARB_sample_shading)
+#if defined(GL_ARB_shader_objects)
+GLATTER_IEXTENSION(GL_ARB_shader_objects)
+GLATTER_IBLOCK(glAttachObjectARB)
+GLATTER_IBLOCK(glCompileShaderARB)
+GLATTER_IBLOCK(glCreateProgramObjectARB)
+GLATTER_IBLOCK(glCreateShaderObjectARB)
+GLATTER_IBLOCK(glDeleteObjectARB)
+GLATTER_IBLOCK(glDetachObjectARB)
+GLATTER_IBLOCK(glGetActiveUniformARB)
+GLATTER_IBLOCK(glGetAttachedObjectsARB)
+GLATTER_IBLOCK(glGetHandleARB)
+GLATTER_IBLOCK(glGetInfoLogARB)
+GLATTER_IBLOCK(glGetObjectParameterfvARB)
+GLATTER_IBLOCK(glGetObjectParameterivARB)
+GLATTER_IBLOCK(glGetShaderSourceARB)
+GLATTER_IBLOCK(glGetUniformLocationARB)
+GLATTER_IBLOCK(glGetUniformfvARB)
+GLATTER_IBLOCK(glGetUniformivARB)
+GLATTER_IBLOCK(glLinkProgramARB)
+GLATTER_IBLOCK(glShaderSourceARB)
+GLATTER_IBLOCK(glUniform1fARB)
+GLATTER_IBLOCK(glUniform1fvARB)
+GLATTER_IBLOCK(glUniform1iARB)
+GLATTER_IBLOCK(glUniform1ivARB)
+GLATTER_IBLOCK(glUniform2fARB)
+GLATTER_IBLOCK(glUniform2fvARB)
+GLATTER_IBLOCK(glUniform2iARB)
+GLATTER_IBLOCK(glUniform2ivARB)
+GLATTER_IBLOCK(glUniform3fARB)
+GLATTER_IBLOCK(glUniform3fvARB)
+GLATTER_IBLOCK(glUniform3iARB)
+GLATTER_IBLOCK(glUniform3ivARB)
+GLATTER_IBLOCK(glUniform4fARB)
+GLATTER_IBLOCK(glUniform4fvARB)
+GLATTER_IBLOCK(glUniform4iARB)
+GLATTER_IBLOCK(glUniform4ivARB)
+GLATTER_IBLOCK(glUniformMatrix2fvARB)
+GLATTER_IBLOCK(glUniformMatrix3fvARB)
+GLATTER_IBLOCK(glUniformMatrix4fvARB)
+GLATTER_IBLOCK(glUseProgramObjectARB)
+GLATTER_IBLOCK(glValidateProgramARB)
+#endif // defined(GL_ARB_shader_objects)
+#if defined(GL_ARB_shading_language_include)
+GLATTER_IEXTENSION(GL_ARB_shading_language_include)
+GLATTER_IBLOCK(glCompileShaderIncludeARB)
+GLATTER_IBLOCK(glDeleteNamedStringARB)
+GLATTER_IBLOCK(glGetNamedStringARB)
+GLATTER_IBLOCK(glGetNamedStringivARB)
+GLATTER_IBLOCK(glIsNamedStringARB)
+GLATTER_IBLOCK(glNamedStringARB)
+#endif // defined(GL_ARB_shading_language_include)
+#if defined(GL_ARB_sparse_buffer)
+GLATTER_IEXTENSION(GL_ARB_sparse_buffer)
+GLATTER_IBLOCK(glBufferPageCommitmentARB)
+GLATTER_IBLOCK(glNamedBufferPageCommitmentARB)
+GLATTER_IBLOCK(glNamedBufferPageCommitmentEXT)
+#endif // defined(GL_ARB_sparse_buffer)
+#if defined(GL_ARB_sparse_texture)
+GLATTER_IEXTENSION(GL_ARB_sparse_texture)
+GLATTER_IBLOCK(glTexPageCommitmentARB)
+#endif // defined(GL_ARB_sparse_texture)
+#if defined(GL_ARB_texture_buffer_object)
+GLATTER_IEXTENSION(GL_ARB_texture_buffer_object)
+GLATTER_IBLOCK(glTexBufferARB)
+#endif // defined(GL_ARB_texture_buffer_object)
+#if defined(GL_ARB_texture_compression)
+GLATTER_IEXTENSION(GL_ARB_texture_compression)
+GLATTER_IBLOCK(glCompressedTexImage1DARB)
+GLATTER_IBLOCK(glCompressedTexImage2DARB)
+GLATTER_IBLOCK(glCompressedTexImage3DARB)
+GLATTER_IBLOCK(glCompressedTexSubImage1DARB)
+GLATTER_IBLOCK(glCompressedTexSubImage2DARB)
+GLATTER_IBLOCK(glCompressedTexSubImage3DARB)
+GLATTER_IBLOCK(glGetCompressedTexImageARB)
+#endif // defined(GL_ARB_texture_compression)
+#if defined(GL_ARB_transpose_matrix)
+GLATTER_IEXTENSION(GL_ARB_transpose_matrix)
+GLATTER_IBLOCK(glLoadTransposeMatrixdARB)
+GLATTER_IBLOCK(glLoadTransposeMatrixfARB)
+GLATTER_IBLOCK(glMultTransposeMatrixdARB)
+GLATTER_IBLOCK(glMultTransposeMatrixfARB)
+#endif // defined(GL_ARB_transpose_matrix)
+#if defined(GL_ARB_vertex_blend)
+GLATTER_IEXTENSION(GL_ARB_vertex_blend)
+GLATTER_IBLOCK(glVertexBlendARB)
+GLATTER_IBLOCK(glWeightPointerARB)
+GLATTER_IBLOCK(glWeightbvARB)
+GLATTER_IBLOCK(glWeightdvARB)
+GLATTER_IBLOCK(glWeightfvARB)
+GLATTER_IBLOCK(glWeightivARB)
+GLATTER_IBLOCK(glWeightsvARB)
+GLATTER_IBLOCK(glWeightubvARB)
+GLATTER_IBLOCK(glWeightuivARB)
+GLATTER_IBLOCK(glWeightusvARB)
+#endif // defined(GL_ARB_vertex_blend)
+#if defined(GL_ARB_vertex_buffer_object)
+GLATTER_IEXTENSION(GL_ARB_vertex_buffer_object)
+GLATTER_IBLOCK(glBindBufferARB)
+GLATTER_IBLOCK(glBufferDataARB)
+GLATTER_IBLOCK(glBufferSubDataARB)
+GLATTER_IBLOCK(glDeleteBuffersARB)
+GLATTER_IBLOCK(glGenBuffersARB)
+GLATTER_IBLOCK(glGetBufferParameterivARB)
+GLATTER_IBLOCK(glGetBufferPointervARB)
+GLATTER_IBLOCK(glGetBufferSubDataARB)
+GLATTER_IBLOCK(glIsBufferARB)
+GLATTER_IBLOCK(glMapBufferARB)
+GLATTER_IBLOCK(glUnmapBufferARB)
+#endif // defined(GL_ARB_vertex_buffer_object)
+#if defined(GL_ARB_vertex_program)
+GLATTER_IEXTENSION(GL_ARB_vertex_program)
+GLATTER_IBLOCK(glDisableVertexAttribArrayARB)
+GLATTER_IBLOCK(glEnableVertexAttribArrayARB)
+GLATTER_IBLOCK(glGetVertexAttribPointervARB)
+GLATTER_IBLOCK(glGetVertexAttribdvARB)
+GLATTER_IBLOCK(glGetVertexAttribfvARB)
+GLATTER_IBLOCK(glGetVertexAttribivARB)
+GLATTER_IBLOCK(glVertexAttrib1dARB)
+GLATTER_IBLOCK(glVertexAttrib1dvARB)
+GLATTER_IBLOCK(glVertexAttrib1fARB)
+GLATTER_IBLOCK(glVertexAttrib1fvARB)
+GLATTER_IBLOCK(glVertexAttrib1sARB)
+GLATTER_IBLOCK(glVertexAttrib1svARB)
+GLATTER_IBLOCK(glVertexAttrib2dARB)
+GLATTER_IBLOCK(glVertexAttrib2dvARB)
+GLATTER_IBLOCK(glVertexAttrib2fARB)
+GLATTER_IBLOCK(glVertexAttrib2fvARB)
+GLATTER_IBLOCK(glVertexAttrib2sARB)
+GLATTER_IBLOCK(glVertexAttrib2svARB)
+GLATTER_IBLOCK(glVertexAttrib3dARB)
+GLATTER_IBLOCK(glVertexAttrib3dvARB)
+GLATTER_IBLOCK(glVertexAttrib3fARB)
+GLATTER_IBLOCK(glVertexAttrib3fvARB)
+GLATTER_IBLOCK(glVertexAttrib3sARB)
+GLATTER_IBLOCK(glVertexAttrib3svARB)
+GLATTER_IBLOCK(glVertexAttrib4NbvARB)
+GLATTER_IBLOCK(glVertexAttrib4NivARB)
+GLATTER_IBLOCK(glVertexAttrib4NsvARB)
+GLATTER_IBLOCK(glVertexAttrib4NubARB)
+GLATTER_IBLOCK(glVertexAttrib4NubvARB)
+GLATTER_IBLOCK(glVertexAttrib4NuivARB)
+GLATTER_IBLOCK(glVertexAttrib4NusvARB)
+GLATTER_IBLOCK(glVertexAttrib4bvARB)
+GLATTER_IBLOCK(glVertexAttrib4dARB)
+GLATTER_IBLOCK(glVertexAttrib4dvARB)
+GLATTER_IBLOCK(glVertexAttrib4fARB)
+GLATTER_IBLOCK(glVertexAttrib4fvARB)
+GLATTER_IBLOCK(glVertexAttrib4ivARB)
+GLATTER_IBLOCK(glVertexAttrib4sARB)
+GLATTER_IBLOCK(glVertexAttrib4svARB)
+GLATTER_IBLOCK(glVertexAttrib4ubvARB)
+GLATTER_IBLOCK(glVertexAttrib4uivARB)
+GLATTER_IBLOCK(glVertexAttrib4usvARB)
+GLATTER_IBLOCK(glVertexAttribPointerARB)
+#endif // defined(GL_ARB_vertex_program)
+#if defined(GL_ARB_vertex_shader)
+GLATTER_IEXTENSION(GL_ARB_vertex_shader)
+GLATTER_IBLOCK(glBindAttribLocationARB)
+GLATTER_IBLOCK(glGetActiveAttribARB)
+GLATTER_IBLOCK(glGetAttribLocationARB)
+#endif // defined(GL_ARB_vertex_shader)
+#if defined(GL_ARB_viewport_array)
+GLATTER_IEXTENSION(GL_ARB_viewport_array)
+GLATTER_IBLOCK(glDepthRangeArraydvNV)
+GLATTER_IBLOCK(glDepthRangeIndexeddNV)
+#endif // defined(GL_ARB_viewport_array)
+#if defined(GL_ARB_window_pos)
+GLATTER_IEXTENSION(GL_ARB_window_pos)
+GLATTER_IBLOCK(glWindowPos2dARB)
+GLATTER_IBLOCK(glWindowPos2dvARB)
+GLATTER_IBLOCK(glWindowPos2fARB)
+GLATTER_IBLOCK(glWindowPos2fvARB)
+GLATTER_IBLOCK(glWindowPos2iARB)
+GLATTER_IBLOCK(glWindowPos2ivARB)
+GLATTER_IBLOCK(glWindowPos2sARB)
+GLATTER_IBLOCK(glWindowPos2svARB)
+GLATTER_IBLOCK(glWindowPos3dARB)
+GLATTER_IBLOCK(glWindowPos3dvARB)
+GLATTER_IBLOCK(glWindowPos3fARB)
+GLATTER_IBLOCK(glWindowPos3fvARB)
+GLATTER_IBLOCK(glWindowPos3iARB)
+GLATTER_IBLOCK(glWindowPos3ivARB)
+GLATTER_IBLOCK(glWindowPos3sARB)
+GLATTER_IBLOCK(glWindowPos3svARB)
+#endif // defined(GL_ARB_window_pos)
+#if defined(GL_ATI_draw_buffers)
+GLATTER_IEXTENSION(GL_ATI_draw_buffers)
+GLATTER_IBLOCK(glDrawBuffersATI)
+#endif // defined(GL_ATI_draw_buffers)
+#if defined(GL_ATI_element_array)
+GLATTER_IEXTENSION(GL_ATI_element_array)
+GLATTER_IBLOCK(glDrawElementArrayATI)
+GLATTER_IBLOCK(glDrawRangeElementArrayATI)
+GLATTER_IBLOCK(glElementPointerATI)
+#endif // defined(GL_ATI_element_array)
+#if defined(GL_ATI_envmap_bumpmap)
+GLATTER_IEXTENSION(GL_ATI_envmap_bumpmap)
+GLATTER_IBLOCK(glGetTexBumpParameterfvATI)
+GLATTER_IBLOCK(glGetTexBumpParameterivATI)
+GLATTER_IBLOCK(glTexBumpParameterfvATI)
+GLATTER_IBLOCK(glTexBumpParameterivATI)
+#endif // defined(GL_ATI_envmap_bumpmap)
+#if defined(GL_ATI_fragment_shader)
+GLATTER_IEXTENSION(GL_ATI_fragment_shader)
+GLATTER_IBLOCK(glAlphaFragmentOp1ATI)
+GLATTER_IBLOCK(glAlphaFragmentOp2ATI)
+GLATTER_IBLOCK(glAlphaFragmentOp3ATI)
+GLATTER_IBLOCK(glBeginFragmentShaderATI)
+GLATTER_IBLOCK(glBindFragmentShaderATI)
+GLATTER_IBLOCK(glColorFragmentOp1ATI)
+GLATTER_IBLOCK(glColorFragmentOp2ATI)
+GLATTER_IBLOCK(glColorFragmentOp3ATI)
+GLATTER_IBLOCK(glDeleteFragmentShaderATI)
+GLATTER_IBLOCK(glEndFragmentShaderATI)
+GLATTER_IBLOCK(glGenFragmentShadersATI)
+GLATTER_IBLOCK(glPassTexCoordATI)
+GLATTER_IBLOCK(glSampleMapATI)
+GLATTER_IBLOCK(glSetFragmentShaderConstantATI)
+#endif // defined(GL_ATI_fragment_shader)
+#if defined(GL_ATI_map_object_buffer)
+GLATTER_IEXTENSION(GL_ATI_map_object_buffer)
+GLATTER_IBLOCK(glMapObjectBufferATI)
+GLATTER_IBLOCK(glUnmapObjectBufferATI)
+#endif // defined(GL_ATI_map_object_buffer)
+#if defined(GL_ATI_pn_triangles)
+GLATTER_IEXTENSION(GL_ATI_pn_triangles)
+GLATTER_IBLOCK(glPNTrianglesfATI)
+GLATTER_IBLOCK(glPNTrianglesiATI)
+#endif // defined(GL_ATI_pn_triangles)
+#if defined(GL_ATI_separate_stencil)
+GLATTER_IEXTENSION(GL_ATI_separate_stencil)
+GLATTER_IBLOCK(glStencilFuncSeparateATI)
+GLATTER_IBLOCK(glStencilOpSeparateATI)
+#endif // defined(GL_ATI_separate_stencil)
+#if defined(GL_ATI_vertex_array_object)
+GLATTER_IEXTENSION(GL_ATI_vertex_array_object)
+GLATTER_IBLOCK(glArrayObjectATI)
+GLATTER_IBLOCK(glFreeObjectBufferATI)
+GLATTER_IBLOCK(glGetArrayObjectfvATI)
+GLATTER_IBLOCK(glGetArrayObjectivATI)
+GLATTER_IBLOCK(glGetObjectBufferfvATI)
+GLATTER_IBLOCK(glGetObjectBufferivATI)
+GLATTER_IBLOCK(glGetVariantArrayObjectfvATI)
+GLATTER_IBLOCK(glGetVariantArrayObjectivATI)
+GLATTER_IBLOCK(glIsObjectBufferATI)
+GLATTER_IBLOCK(glNewObjectBufferATI)
+GLATTER_IBLOCK(glUpdateObjectBufferATI)
+GLATTER_IBLOCK(glVariantArrayObjectATI)
+#endif // defined(GL_ATI_vertex_array_object)
+#if defined(GL_ATI_vertex_attrib_array_object)
+GLATTER_IEXTENSION(GL_ATI_vertex_attrib_array_object)
+GLATTER_IBLOCK(glGetVertexAttribArrayObjectfvATI)
+GLATTER_IBLOCK(glGetVertexAttribArrayObjectivATI)
+GLATTER_IBLOCK(glVertexAttribArrayObjectATI)
+#endif // defined(GL_ATI_vertex_attrib_array_object)
+#if defined(GL_ATI_vertex_streams)
+GLATTER_IEXTENSION(GL_ATI_vertex_streams)
+GLATTER_IBLOCK(glClientActiveVertexStreamATI)
+GLATTER_IBLOCK(glNormalStream3bATI)
+GLATTER_IBLOCK(glNormalStream3bvATI)
+GLATTER_IBLOCK(glNormalStream3dATI)
+GLATTER_IBLOCK(glNormalStream3dvATI)
+GLATTER_IBLOCK(glNormalStream3fATI)
+GLATTER_IBLOCK(glNormalStream3fvATI)
+GLATTER_IBLOCK(glNormalStream3iATI)
+GLATTER_IBLOCK(glNormalStream3ivATI)
+GLATTER_IBLOCK(glNormalStream3sATI)
+GLATTER_IBLOCK(glNormalStream3svATI)
+GLATTER_IBLOCK(glVertexBlendEnvfATI)
+GLATTER_IBLOCK(glVertexBlendEnviATI)
+GLATTER_IBLOCK(glVertexStream1dATI)
+GLATTER_IBLOCK(glVertexStream1dvATI)
+GLATTER_IBLOCK(glVertexStream1fATI)
+GLATTER_IBLOCK(glVertexStream1fvATI)
+GLATTER_IBLOCK(glVertexStream1iATI)
+GLATTER_IBLOCK(glVertexStream1ivATI)
+GLATTER_IBLOCK(glVertexStream1sATI)
+GLATTER_IBLOCK(glVertexStream1svATI)
+GLATTER_IBLOCK(glVertexStream2dATI)
+GLATTER_IBLOCK(glVertexStream2dvATI)
+GLATTER_IBLOCK(glVertexStream2fATI)
+GLATTER_IBLOCK(glVertexStream2fvATI)
+GLATTER_IBLOCK(glVertexStream2iATI)
+GLATTER_IBLOCK(glVertexStream2ivATI)
+GLATTER_IBLOCK(glVertexStream2sATI)
+GLATTER_IBLOCK(glVertexStream2svATI)
+GLATTER_IBLOCK(glVertexStream3dATI)
+GLATTER_IBLOCK(glVertexStream3dvATI)
+GLATTER_IBLOCK(glVertexStream3fATI)
+GLATTER_IBLOCK(glVertexStream3fvATI)
+GLATTER_IBLOCK(glVertexStream3iATI)
+GLATTER_IBLOCK(glVertexStream3ivATI)
+GLATTER_IBLOCK(glVertexStream3sATI)
+GLATTER_IBLOCK(glVertexStream3svATI)
+GLATTER_IBLOCK(glVertexStream4dATI)
+GLATTER_IBLOCK(glVertexStream4dvATI)
+GLATTER_IBLOCK(glVertexStream4fATI)
+GLATTER_IBLOCK(glVertexStream4fvATI)
+GLATTER_IBLOCK(glVertexStream4iATI)
+GLATTER_IBLOCK(glVertexStream4ivATI)
+GLATTER_IBLOCK(glVertexStream4sATI)
+GLATTER_IBLOCK(glVertexStream4svATI)
+#endif // defined(GL_ATI_vertex_streams)
+#if defined(GL_EXT_EGL_image_storage)
+GLATTER_IEXTENSION(GL_EXT_EGL_image_storage)
+GLATTER_IBLOCK(glEGLImageTargetTexStorageEXT)
+GLATTER_IBLOCK(glEGLImageTargetTextureStorageEXT)
+#endif // defined(GL_EXT_EGL_image_storage)
+#if defined(GL_EXT_bindable_uniform)
+GLATTER_IEXTENSION(GL_EXT_bindable_uniform)
+GLATTER_IBLOCK(glGetUniformBufferSizeEXT)
+GLATTER_IBLOCK(glGetUniformOffsetEXT)
+GLATTER_IBLOCK(glUniformBufferEXT)
+#endif // defined(GL_EXT_bindable_uniform)
+#if defined(GL_EXT_blend_color)
+GLATTER_IEXTENSION(GL_EXT_blend_color)
+GLATTER_IBLOCK(glBlendColorEXT)
+#endif // defined(GL_EXT_blend_color)
+#if defined(GL_EXT_blend_equation_separate)
+GLATTER_IEXTENSION(GL_EXT_blend_equation_separate)
+GLATTER_IBLOCK(glBlendEquationSeparateEXT)
+#endif // defined(GL_EXT_blend_equation_separate)
+#if defined(GL_EXT_blend_func_separate)
+GLATTER_IEXTENSION(GL_EXT_blend_func_separate)
+GLATTER_IBLOCK(glBlendFuncSeparateEXT)
+#endif // defined(GL_EXT_blend_func_separate)
+#if defined(GL_EXT_blend_minmax)
+GLATTER_IEXTENSION(GL_EXT_blend_minmax)
+GLATTER_IBLOCK(glBlendEquationEXT)
+#endif // defined(GL_EXT_blend_minmax)
+#if defined(GL_EXT_color_subtable)
+GLATTER_IEXTENSION(GL_EXT_color_subtable)
+GLATTER_IBLOCK(glColorSubTableEXT)
+GLATTER_IBLOCK(glCopyColorSubTableEXT)
+#endif // defined(GL_EXT_color_subtable)
+#if defined(GL_EXT_compiled_vertex_array)
+GLATTER_IEXTENSION(GL_EXT_compiled_vertex_array)
+GLATTER_IBLOCK(glLockArraysEXT)
+GLATTER_IBLOCK(glUnlockArraysEXT)
+#endif // defined(GL_EXT_compiled_vertex_array)
+#if defined(GL_EXT_convolution)
+GLATTER_IEXTENSION(GL_EXT_convolution)
+GLATTER_IBLOCK(glConvolutionFilter1DEXT)
+GLATTER_IBLOCK(glConvolutionFilter2DEXT)
+GLATTER_IBLOCK(glConvolutionParameterfEXT)
+GLATTER_IBLOCK(glConvolutionParameterfvEXT)
+GLATTER_IBLOCK(glConvolutionParameteriEXT)
+GLATTER_IBLOCK(glConvolutionParameterivEXT)
+GLATTER_IBLOCK(glCopyConvolutionFilter1DEXT)
+GLATTER_IBLOCK(glCopyConvolutionFilter2DEXT)
+GLATTER_IBLOCK(glGetConvolutionFilterEXT)
+GLATTER_IBLOCK(glGetConvolutionParameterfvEXT)
+GLATTER_IBLOCK(glGetConvolutionParameterivEXT)
+GLATTER_IBLOCK(glGetSeparableFilterEXT)
+GLATTER_IBLOCK(glSeparableFilter2DEXT)
+#endif // defined(GL_EXT_convolution)
+#if defined(GL_EXT_coordinate_frame)
+GLATTER_IEXTENSION(GL_EXT_coordinate_frame)
+GLATTER_IBLOCK(glBinormal3bEXT)
+GLATTER_IBLOCK(glBinormal3bvEXT)
+GLATTER_IBLOCK(glBinormal3dEXT)
+GLATTER_IBLOCK(glBinormal3dvEXT)
+GLATTER_IBLOCK(glBinormal3fEXT)
+GLATTER_IBLOCK(glBinormal3fvEXT)
+GLATTER_IBLOCK(glBinormal3iEXT)
+GLATTER_IBLOCK(glBinormal3ivEXT)
+GLATTER_IBLOCK(glBinormal3sEXT)
+GLATTER_IBLOCK(glBinormal3svEXT)
+GLATTER_IBLOCK(glBinormalPointerEXT)
+GLATTER_IBLOCK(glTangent3bEXT)
+GLATTER_IBLOCK(glTangent3bvEXT)
+GLATTER_IBLOCK(glTangent3dEXT)
+GLATTER_IBLOCK(glTangent3dvEXT)
+GLATTER_IBLOCK(glTangent3fEXT)
+GLATTER_IBLOCK(glTangent3fvEXT)
+GLATTER_IBLOCK(glTangent3iEXT)
+GLATTER_IBLOCK(glTangent3ivEXT)
+GLATTER_IBLOCK(glTangent3sEXT)
+GLATTER_IBLOCK(glTangent3svEXT)
+GLATTER_IBLOCK(glTangentPointerEXT)
+#endif // defined(GL_EXT_coordinate_frame)
+#if defined(GL_EXT_copy_texture)
+GLATTER_IEXTENSION(GL_EXT_copy_texture)
+GLATTER_IBLOCK(glCopyTexImage1DEXT)
+GLATTER_IBLOCK(glCopyTexImage2DEXT)
+GLATTER_IBLOCK(glCopyTexSubImage1DEXT)
+GLATTER_IBLOCK(glCopyTexSubImage2DEXT)
+GLATTER_IBLOCK(glCopyTexSubImage3DEXT)
+#endif // defined(GL_EXT_copy_texture)
+#if defined(GL_EXT_cull_vertex)
+GLATTER_IEXTENSION(GL_EXT_cull_vertex)
+GLATTER_IBLOCK(glCullParameterdvEXT)
+GLATTER_IBLOCK(glCullParameterfvEXT)
+#endif // defined(GL_EXT_cull_vertex)
+#if defined(GL_EXT_debug_label)
+GLATTER_IEXTENSION(GL_EXT_debug_label)
+GLATTER_IBLOCK(glGetObjectLabelEXT)
+GLATTER_IBLOCK(glLabelObjectEXT)
+#endif // defined(GL_EXT_debug_label)
+#if defined(GL_EXT_debug_marker)
+GLATTER_IEXTENSION(GL_EXT_debug_marker)
+GLATTER_IBLOCK(glInsertEventMarkerEXT)
+GLATTER_IBLOCK(glPopGroupMarkerEXT)
+GLATTER_IBLOCK(glPushGroupMarkerEXT)
+#endif // defined(GL_EXT_debug_marker)
+#if defined(GL_EXT_depth_bounds_test)
+GLATTER_IEXTENSION(GL_EXT_depth_bounds_test)
+GLATTER_IBLOCK(glDepthBoundsEXT)
+#endif // defined(GL_EXT_depth_bounds_test)
+#if defined(GL_EXT_direct_state_access)
+GLATTER_IEXTENSION(GL_EXT_direct_state_access)
+GLATTER_IBLOCK(glBindMultiTextureEXT)
+GLATTER_IBLOCK(glCheckNamedFramebufferStatusEXT)
+GLATTER_IBLOCK(glClearNamedBufferDataEXT)
+GLATTER_IBLOCK(glClearNamedBufferSubDataEXT)
+GLATTER_IBLOCK(glClientAttribDefaultEXT)
+GLATTER_IBLOCK(glCompressedMultiTexImage1DEXT)
+GLATTER_IBLOCK(glCompressedMultiTexImage2DEXT)
+GLATTER_IBLOCK(glCompressedMultiTexImage3DEXT)
+GLATTER_IBLOCK(glCompressedMultiTexSubImage1DEXT)
+GLATTER_IBLOCK(glCompressedMultiTexSubImage2DEXT)
+GLATTER_IBLOCK(glCompressedMultiTexSubImage3DEXT)
+GLATTER_IBLOCK(glCompressedTextureImage1DEXT)
+GLATTER_IBLOCK(glCompressedTextureImage2DEXT)
+GLATTER_IBLOCK(glCompressedTextureImage3DEXT)
+GLATTER_IBLOCK(glCompressedTextureSubImage1DEXT)
+GLATTER_IBLOCK(glCompressedTextureSubImage2DEXT)
+GLATTER_IBLOCK(glCompressedTextureSubImage3DEXT)
+GLATTER_IBLOCK(glCopyMultiTexImage1DEXT)
+GLATTER_IBLOCK(glCopyMultiTexImage2DEXT)
+GLATTER_IBLOCK(glCopyMultiTexSubImage1DEXT)
+GLATTER_IBLOCK(glCopyMultiTexSubImage2DEXT)
+GLATTER_IBLOCK(glCopyMultiTexSubImage3DEXT)
+GLATTER_IBLOCK(glCopyTextureImage1DEXT)
+GLATTER_IBLOCK(glCopyTextureImage2DEXT)
+GLATTER_IBLOCK(glCopyTextureSubImage1DEXT)
+GLATTER_IBLOCK(glCopyTextureSubImage2DEXT)
+GLATTER_IBLOCK(glCopyTextureSubImage3DEXT)
+GLATTER_IBLOCK(glDisableClientStateIndexedEXT)
+GLATTER_IBLOCK(glDisableClientStateiEXT)
+GLATTER_IBLOCK(glDisableIndexedEXT)
+GLATTER_IBLOCK(glDisableVertexArrayAttribEXT)
+GLATTER_IBLOCK(glDisableVertexArrayEXT)
+GLATTER_IBLOCK(glEnableClientStateIndexedEXT)
+GLATTER_IBLOCK(glEnableClientStateiEXT)
+GLATTER_IBLOCK(glEnableIndexedEXT)
+GLATTER_IBLOCK(glEnableVertexArrayAttribEXT)
+GLATTER_IBLOCK(glEnableVertexArrayEXT)
+GLATTER_IBLOCK(glFlushMappedNamedBufferRangeEXT)
+GLATTER_IBLOCK(glFramebufferDrawBufferEXT)
+GLATTER_IBLOCK(glFramebufferDrawBuffersEXT)
+GLATTER_IBLOCK(glFramebufferReadBufferEXT)
+GLATTER_IBLOCK(glGenerateMultiTexMipmapEXT)
+GLATTER_IBLOCK(glGenerateTextureMipmapEXT)
+GLATTER_IBLOCK(glGetBooleanIndexedvEXT)
+GLATTER_IBLOCK(glGetCompressedMultiTexImageEXT)
+GLATTER_IBLOCK(glGetCompressedTextureImageEXT)
+GLATTER_IBLOCK(glGetDoubleIndexedvEXT)
+GLATTER_IBLOCK(glGetDoublei_vEXT)
+GLATTER_IBLOCK(glGetFloatIndexedvEXT)
+GLATTER_IBLOCK(glGetFloati_vEXT)
+GLATTER_IBLOCK(glGetFramebufferParameterivEXT)
+GLATTER_IBLOCK(glGetIntegerIndexedvEXT)
+GLATTER_IBLOCK(glGetMultiTexEnvfvEXT)
+GLATTER_IBLOCK(glGetMultiTexEnvivEXT)
+GLATTER_IBLOCK(glGetMultiTexGendvEXT)
+GLATTER_IBLOCK(glGetMultiTexGenfvEXT)
+GLATTER_IBLOCK(glGetMultiTexGenivEXT)
+GLATTER_IBLOCK(glGetMultiTexImageEXT)
+GLATTER_IBLOCK(glGetMultiTexLevelParameterfvEXT)
+GLATTER_IBLOCK(glGetMultiTexLevelParameterivEXT)
+GLATTER_IBLOCK(glGetMultiTexParameterIivEXT)
+GLATTER_IBLOCK(glGetMultiTexParameterIuivEXT)
+GLATTER_IBLOCK(glGetMultiTexParameterfvEXT)
+GLATTER_IBLOCK(glGetMultiTexParameterivEXT)
+GLATTER_IBLOCK(glGetNamedBufferParameterivEXT)
+GLATTER_IBLOCK(glGetNamedBufferPointervEXT)
+GLATTER_IBLOCK(glGetNamedBufferSubDataEXT)
+GLATTER_IBLOCK(glGetNamedFramebufferAttachmentParameterivEXT)
+GLATTER_IBLOCK(glGetNamedFramebufferParameterivEXT)
+GLATTER_IBLOCK(glGetNamedProgramLocalParameterIivEXT)
+GLATTER_IBLOCK(glGetNamedProgramLocalParameterIuivEXT)
+GLATTER_IBLOCK(glGetNamedProgramLocalParameterdvEXT)
+GLATTER_IBLOCK(glGetNamedProgramLocalParameterfvEXT)
+GLATTER_IBLOCK(glGetNamedProgramStringEXT)
+GLATTER_IBLOCK(glGetNamedProgramivEXT)
+GLATTER_IBLOCK(glGetNamedRenderbufferParameterivEXT)
+GLATTER_IBLOCK(glGetPointerIndexedvEXT)
+GLATTER_IBLOCK(glGetPointeri_vEXT)
+GLATTER_IBLOCK(glGetTextureImageEXT)
+GLATTER_IBLOCK(glGetTextureLevelParameterfvEXT)
+GLATTER_IBLOCK(glGetTextureLevelParameterivEXT)
+GLATTER_IBLOCK(glGetTextureParameterIivEXT)
+GLATTER_IBLOCK(glGetTextureParameterIuivEXT)
+GLATTER_IBLOCK(glGetTextureParameterfvEXT)
+GLATTER_IBLOCK(glGetTextureParameterivEXT)
+GLATTER_IBLOCK(glGetVertexArrayIntegeri_vEXT)
+GLATTER_IBLOCK(glGetVertexArrayIntegervEXT)
+GLATTER_IBLOCK(glGetVertexArrayPointeri_vEXT)
+GLATTER_IBLOCK(glGetVertexArrayPointervEXT)
+GLATTER_IBLOCK(glIsEnabledIndexedEXT)
+GLATTER_IBLOCK(glMapNamedBufferEXT)
+GLATTER_IBLOCK(glMapNamedBufferRangeEXT)
+GLATTER_IBLOCK(glMatrixFrustumEXT)
+GLATTER_IBLOCK(glMatrixLoadIdentityEXT)
+GLATTER_IBLOCK(glMatrixLoadTransposedEXT)
+GLATTER_IBLOCK(glMatrixLoadTransposefEXT)
+GLATTER_IBLOCK(glMatrixLoaddEXT)
+GLATTER_IBLOCK(glMatrixLoadfEXT)
+GLATTER_IBLOCK(glMatrixMultTransposedEXT)
+GLATTER_IBLOCK(glMatrixMultTransposefEXT)
+GLATTER_IBLOCK(glMatrixMultdEXT)
+GLATTER_IBLOCK(glMatrixMultfEXT)
+GLATTER_IBLOCK(glMatrixOrthoEXT)
+GLATTER_IBLOCK(glMatrixPopEXT)
+GLATTER_IBLOCK(glMatrixPushEXT)
+GLATTER_IBLOCK(glMatrixRotatedEXT)
+GLATTER_IBLOCK(glMatrixRotatefEXT)
+GLATTER_IBLOCK(glMatrixScaledEXT)
+GLATTER_IBLOCK(glMatrixScalefEXT)
+GLATTER_IBLOCK(glMatrixTranslatedEXT)
+GLATTER_IBLOCK(glMatrixTranslatefEXT)
+GLATTER_IBLOCK(glMultiTexBufferEXT)
+GLATTER_IBLOCK(glMultiTexCoordPointerEXT)
+GLATTER_IBLOCK(glMultiTexEnvfEXT)
+GLATTER_IBLOCK(glMultiTexEnvfvEXT)
+GLATTER_IBLOCK(glMultiTexEnviEXT)
+GLATTER_IBLOCK(glMultiTexEnvivEXT)
+GLATTER_IBLOCK(glMultiTexGendEXT)
+GLATTER_IBLOCK(glMultiTexGendvEXT)
+GLATTER_IBLOCK(glMultiTexGenfEXT)
+GLATTER_IBLOCK(glMultiTexGenfvEXT)
+GLATTER_IBLOCK(glMultiTexGeniEXT)
+GLATTER_IBLOCK(glMultiTexGenivEXT)
+GLATTER_IBLOCK(glMultiTexImage1DEXT)
+GLATTER_IBLOCK(glMultiTexImage2DEXT)
+GLATTER_IBLOCK(glMultiTexImage3DEXT)
+GLATTER_IBLOCK(glMultiTexParameterIivEXT)
+GLATTER_IBLOCK(glMultiTexParameterIuivEXT)
+GLATTER_IBLOCK(glMultiTexParameterfEXT)
+GLATTER_IBLOCK(glMultiTexParameterfvEXT)
+GLATTER_IBLOCK(glMultiTexParameteriEXT)
+GLATTER_IBLOCK(glMultiTexParameterivEXT)
+GLATTER_IBLOCK(glMultiTexRenderbufferEXT)
+GLATTER_IBLOCK(glMultiTexSubImage1DEXT)
+GLATTER_IBLOCK(glMultiTexSubImage2DEXT)
+GLATTER_IBLOCK(glMultiTexSubImage3DEXT)
+GLATTER_IBLOCK(glNamedBufferDataEXT)
+GLATTER_IBLOCK(glNamedBufferStorageEXT)
+GLATTER_IBLOCK(glNamedBufferSubDataEXT)
+GLATTER_IBLOCK(glNamedCopyBufferSubDataEXT)
+GLATTER_IBLOCK(glNamedFramebufferParameteriEXT)
+GLATTER_IBLOCK(glNamedFramebufferRenderbufferEXT)
+GLATTER_IBLOCK(glNamedFramebufferTexture1DEXT)
+GLATTER_IBLOCK(glNamedFramebufferTexture2DEXT)
+GLATTER_IBLOCK(glNamedFramebufferTexture3DEXT)
+GLATTER_IBLOCK(glNamedFramebufferTextureEXT)
+GLATTER_IBLOCK(glNamedFramebufferTextureFaceEXT)
+GLATTER_IBLOCK(glNamedFramebufferTextureLayerEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameter4dEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameter4dvEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameter4fEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameter4fvEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameterI4iEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameterI4ivEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameterI4uiEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameterI4uivEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParameters4fvEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParametersI4ivEXT)
+GLATTER_IBLOCK(glNamedProgramLocalParametersI4uivEXT)
+GLATTER_IBLOCK(glNamedProgramStringEXT)
+GLATTER_IBLOCK(glNamedRenderbufferStorageEXT)
+GLATTER_IBLOCK(glNamedRenderbufferStorageMultisampleCoverageEXT)
+GLATTER_IBLOCK(glNamedRenderbufferStorageMultisampleEXT)
+GLATTER_IBLOCK(glProgramUniform1dEXT)
+GLATTER_IBLOCK(glProgramUniform1dvEXT)
+GLATTER_IBLOCK(glProgramUniform1fEXT)
+GLATTER_IBLOCK(glProgramUniform1fvEXT)
+GLATTER_IBLOCK(glProgramUniform1iEXT)
+GLATTER_IBLOCK(glProgramUniform1ivEXT)
+GLATTER_IBLOCK(glProgramUniform1uiEXT)
+GLATTER_IBLOCK(glProgramUniform1uivEXT)
+GLATTER_IBLOCK(glProgramUniform2dEXT)
+GLATTER_IBLOCK(glProgramUniform2dvEXT)
+GLATTER_IBLOCK(glProgramUniform2fEXT)
+GLATTER_IBLOCK(glProgramUniform2fvEXT)
+GLATTER_IBLOCK(glProgramUniform2iEXT)
+GLATTER_IBLOCK(glProgramUniform2ivEXT)
+GLATTER_IBLOCK(glProgramUniform2uiEXT)
+GLATTER_IBLOCK(glProgramUniform2uivEXT)
+GLATTER_IBLOCK(glProgramUniform3dEXT)
+GLATTER_IBLOCK(glProgramUniform3dvEXT)
+GLATTER_IBLOCK(glProgramUniform3fEXT)
+GLATTER_IBLOCK(glProgramUniform3fvEXT)
+GLATTER_IBLOCK(glProgramUniform3iEXT)
+GLATTER_IBLOCK(glProgramUniform3ivEXT)
+GLATTER_IBLOCK(glProgramUniform3uiEXT)
+GLATTER_IBLOCK(glProgramUniform3uivEXT)
+GLATTER_IBLOCK(glProgramUniform4dEXT)
+GLATTER_IBLOCK(glProgramUniform4dvEXT)
+GLATTER_IBLOCK(glProgramUniform4fEXT)
+GLATTER_IBLOCK(glProgramUniform4fvEXT)
+GLATTER_IBLOCK(glProgramUniform4iEXT)
+GLATTER_IBLOCK(glProgramUniform4ivEXT)
+GLATTER_IBLOCK(glProgramUniform4uiEXT)
+GLATTER_IBLOCK(glProgramUniform4uivEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2fvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3dvEXT)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3fvEXT)
+GLATTER_IBLOCK(glPushClientAttribDefaultEXT)
+GLATTER_IBLOCK(glTextureBufferEXT)
+GLATTER_IBLOCK(glTextureBufferRangeEXT)
+GLATTER_IBLOCK(glTextureImage1DEXT)
+GLATTER_IBLOCK(glTextureImage2DEXT)
+GLATTER_IBLOCK(glTextureImage3DEXT)
+GLATTER_IBLOCK(glTexturePageCommitmentEXT)
+GLATTER_IBLOCK(glTextureParameterIivEXT)
+GLATTER_IBLOCK(glTextureParameterIuivEXT)
+GLATTER_IBLOCK(glTextureParameterfEXT)
+GLATTER_IBLOCK(glTextureParameterfvEXT)
+GLATTER_IBLOCK(glTextureParameteriEXT)
+GLATTER_IBLOCK(glTextureParameterivEXT)
+GLATTER_IBLOCK(glTextureRenderbufferEXT)
+GLATTER_IBLOCK(glTextureStorage1DEXT)
+GLATTER_IBLOCK(glTextureStorage2DEXT)
+GLATTER_IBLOCK(glTextureStorage2DMultisampleEXT)
+GLATTER_IBLOCK(glTextureStorage3DEXT)
+GLATTER_IBLOCK(glTextureStorage3DMultisampleEXT)
+GLATTER_IBLOCK(glTextureSubImage1DEXT)
+GLATTER_IBLOCK(glTextureSubImage2DEXT)
+GLATTER_IBLOCK(glTextureSubImage3DEXT)
+GLATTER_IBLOCK(glUnmapNamedBufferEXT)
+GLATTER_IBLOCK(glVertexArrayBindVertexBufferEXT)
+GLATTER_IBLOCK(glVertexArrayColorOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayEdgeFlagOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayFogCoordOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayIndexOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayMultiTexCoordOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayNormalOffsetEXT)
+GLATTER_IBLOCK(glVertexArraySecondaryColorOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayTexCoordOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribBindingEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribDivisorEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribFormatEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribIFormatEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribIOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribLFormatEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribLOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayVertexAttribOffsetEXT)
+GLATTER_IBLOCK(glVertexArrayVertexBindingDivisorEXT)
+GLATTER_IBLOCK(glVertexArrayVertexOffsetEXT)
+#endif // defined(GL_EXT_direct_state_access)
+#if defined(GL_EXT_draw_buffers2)
+GLATTER_IEXTENSION(GL_EXT_draw_buffers2)
+GLATTER_IBLOCK(glColorMaskIndexedEXT)
+#endif // defined(GL_EXT_draw_buffers2)
+#if defined(GL_EXT_draw_instanced)
+GLATTER_IEXTENSION(GL_EXT_draw_instanced)
+GLATTER_IBLOCK(glDrawArraysInstancedEXT)
+GLATTER_IBLOCK(glDrawElementsInstancedEXT)
+#endif // defined(GL_EXT_draw_instanced)
+#if defined(GL_EXT_draw_range_elements)
+GLATTER_IEXTENSION(GL_EXT_draw_range_elements)
+GLATTER_IBLOCK(glDrawRangeElementsEXT)
+#endif // defined(GL_EXT_draw_range_elements)
+#if defined(GL_EXT_external_buffer)
+GLATTER_IEXTENSION(GL_EXT_external_buffer)
+GLATTER_IBLOCK(glBufferStorageExternalEXT)
+GLATTER_IBLOCK(glNamedBufferStorageExternalEXT)
+#endif // defined(GL_EXT_external_buffer)
+#if defined(GL_EXT_fog_coord)
+GLATTER_IEXTENSION(GL_EXT_fog_coord)
+GLATTER_IBLOCK(glFogCoordPointerEXT)
+GLATTER_IBLOCK(glFogCoorddEXT)
+GLATTER_IBLOCK(glFogCoorddvEXT)
+GLATTER_IBLOCK(glFogCoordfEXT)
+GLATTER_IBLOCK(glFogCoordfvEXT)
+#endif // defined(GL_EXT_fog_coord)
+#if defined(GL_EXT_fragment_shading_rate)
+GLATTER_IEXTENSION(GL_EXT_fragment_shading_rate)
+GLATTER_IBLOCK(glFramebufferShadingRateEXT)
+GLATTER_IBLOCK(glGetFragmentShadingRatesEXT)
+GLATTER_IBLOCK(glShadingRateCombinerOpsEXT)
+GLATTER_IBLOCK(glShadingRateEXT)
+#endif // defined(GL_EXT_fragment_shading_rate)
+#if defined(GL_EXT_framebuffer_blit)
+GLATTER_IEXTENSION(GL_EXT_framebuffer_blit)
+GLATTER_IBLOCK(glBlitFramebufferEXT)
+#endif // defined(GL_EXT_framebuffer_blit)
+#if defined(GL_EXT_framebuffer_blit_layers)
+GLATTER_IEXTENSION(GL_EXT_framebuffer_blit_layers)
+GLATTER_IBLOCK(glBlitFramebufferLayerEXT)
+GLATTER_IBLOCK(glBlitFramebufferLayersEXT)
+#endif // defined(GL_EXT_framebuffer_blit_layers)
+#if defined(GL_EXT_framebuffer_multisample)
+GLATTER_IEXTENSION(GL_EXT_framebuffer_multisample)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleEXT)
+#endif // defined(GL_EXT_framebuffer_multisample)
+#if defined(GL_EXT_framebuffer_object)
+GLATTER_IEXTENSION(GL_EXT_framebuffer_object)
+GLATTER_IBLOCK(glBindFramebufferEXT)
+GLATTER_IBLOCK(glBindRenderbufferEXT)
+GLATTER_IBLOCK(glCheckFramebufferStatusEXT)
+GLATTER_IBLOCK(glDeleteFramebuffersEXT)
+GLATTER_IBLOCK(glDeleteRenderbuffersEXT)
+GLATTER_IBLOCK(glFramebufferRenderbufferEXT)
+GLATTER_IBLOCK(glFramebufferTexture1DEXT)
+GLATTER_IBLOCK(glFramebufferTexture2DEXT)
+GLATTER_IBLOCK(glFramebufferTexture3DEXT)
+GLATTER_IBLOCK(glGenFramebuffersEXT)
+GLATTER_IBLOCK(glGenRenderbuffersEXT)
+GLATTER_IBLOCK(glGenerateMipmapEXT)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameterivEXT)
+GLATTER_IBLOCK(glGetRenderbufferParameterivEXT)
+GLATTER_IBLOCK(glIsFramebufferEXT)
+GLATTER_IBLOCK(glIsRenderbufferEXT)
+GLATTER_IBLOCK(glRenderbufferStorageEXT)
+#endif // defined(GL_EXT_framebuffer_object)
+#if defined(GL_EXT_geometry_shader4)
+GLATTER_IEXTENSION(GL_EXT_geometry_shader4)
+GLATTER_IBLOCK(glProgramParameteriEXT)
+#endif // defined(GL_EXT_geometry_shader4)
+#if defined(GL_EXT_gpu_program_parameters)
+GLATTER_IEXTENSION(GL_EXT_gpu_program_parameters)
+GLATTER_IBLOCK(glProgramEnvParameters4fvEXT)
+GLATTER_IBLOCK(glProgramLocalParameters4fvEXT)
+#endif // defined(GL_EXT_gpu_program_parameters)
+#if defined(GL_EXT_gpu_shader4)
+GLATTER_IEXTENSION(GL_EXT_gpu_shader4)
+GLATTER_IBLOCK(glBindFragDataLocationEXT)
+GLATTER_IBLOCK(glGetFragDataLocationEXT)
+GLATTER_IBLOCK(glGetUniformuivEXT)
+GLATTER_IBLOCK(glGetVertexAttribIivEXT)
+GLATTER_IBLOCK(glGetVertexAttribIuivEXT)
+GLATTER_IBLOCK(glUniform1uiEXT)
+GLATTER_IBLOCK(glUniform1uivEXT)
+GLATTER_IBLOCK(glUniform2uiEXT)
+GLATTER_IBLOCK(glUniform2uivEXT)
+GLATTER_IBLOCK(glUniform3uiEXT)
+GLATTER_IBLOCK(glUniform3uivEXT)
+GLATTER_IBLOCK(glUniform4uiEXT)
+GLATTER_IBLOCK(glUniform4uivEXT)
+GLATTER_IBLOCK(glVertexAttribI1iEXT)
+GLATTER_IBLOCK(glVertexAttribI1ivEXT)
+GLATTER_IBLOCK(glVertexAttribI1uiEXT)
+GLATTER_IBLOCK(glVertexAttribI1uivEXT)
+GLATTER_IBLOCK(glVertexAttribI2iEXT)
+GLATTER_IBLOCK(glVertexAttribI2ivEXT)
+GLATTER_IBLOCK(glVertexAttribI2uiEXT)
+GLATTER_IBLOCK(glVertexAttribI2uivEXT)
+GLATTER_IBLOCK(glVertexAttribI3iEXT)
+GLATTER_IBLOCK(glVertexAttribI3ivEXT)
+GLATTER_IBLOCK(glVertexAttribI3uiEXT)
+GLATTER_IBLOCK(glVertexAttribI3uivEXT)
+GLATTER_IBLOCK(glVertexAttribI4bvEXT)
+GLATTER_IBLOCK(glVertexAttribI4iEXT)
+GLATTER_IBLOCK(glVertexAttribI4ivEXT)
+GLATTER_IBLOCK(glVertexAttribI4svEXT)
+GLATTER_IBLOCK(glVertexAttribI4ubvEXT)
+GLATTER_IBLOCK(glVertexAttribI4uiEXT)
+GLATTER_IBLOCK(glVertexAttribI4uivEXT)
+GLATTER_IBLOCK(glVertexAttribI4usvEXT)
+GLATTER_IBLOCK(glVertexAttribIPointerEXT)
+#endif // defined(GL_EXT_gpu_shader4)
+#if defined(GL_EXT_histogram)
+GLATTER_IEXTENSION(GL_EXT_histogram)
+GLATTER_IBLOCK(glGetHistogramEXT)
+GLATTER_IBLOCK(glGetHistogramParameterfvEXT)
+GLATTER_IBLOCK(glGetHistogramParameterivEXT)
+GLATTER_IBLOCK(glGetMinmaxEXT)
+GLATTER_IBLOCK(glGetMinmaxParameterfvEXT)
+GLATTER_IBLOCK(glGetMinmaxParameterivEXT)
+GLATTER_IBLOCK(glHistogramEXT)
+GLATTER_IBLOCK(glMinmaxEXT)
+GLATTER_IBLOCK(glResetHistogramEXT)
+GLATTER_IBLOCK(glResetMinmaxEXT)
+#endif // defined(GL_EXT_histogram)
+#if defined(GL_EXT_index_func)
+GLATTER_IEXTENSION(GL_EXT_index_func)
+GLATTER_IBLOCK(glIndexFuncEXT)
+#endif // defined(GL_EXT_index_func)
+#if defined(GL_EXT_index_material)
+GLATTER_IEXTENSION(GL_EXT_index_material)
+GLATTER_IBLOCK(glIndexMaterialEXT)
+#endif // defined(GL_EXT_index_material)
+#if defined(GL_EXT_light_texture)
+GLATTER_IEXTENSION(GL_EXT_light_texture)
+GLATTER_IBLOCK(glApplyTextureEXT)
+GLATTER_IBLOCK(glTextureLightEXT)
+GLATTER_IBLOCK(glTextureMaterialEXT)
+#endif // defined(GL_EXT_light_texture)
+#if defined(GL_EXT_memory_object)
+GLATTER_IEXTENSION(GL_EXT_memory_object)
+GLATTER_IBLOCK(glBufferStorageMemEXT)
+GLATTER_IBLOCK(glCreateMemoryObjectsEXT)
+GLATTER_IBLOCK(glDeleteMemoryObjectsEXT)
+GLATTER_IBLOCK(glGetMemoryObjectParameterivEXT)
+GLATTER_IBLOCK(glGetUnsignedBytei_vEXT)
+GLATTER_IBLOCK(glGetUnsignedBytevEXT)
+GLATTER_IBLOCK(glIsMemoryObjectEXT)
+GLATTER_IBLOCK(glMemoryObjectParameterivEXT)
+GLATTER_IBLOCK(glNamedBufferStorageMemEXT)
+GLATTER_IBLOCK(glTexStorageMem1DEXT)
+GLATTER_IBLOCK(glTexStorageMem2DEXT)
+GLATTER_IBLOCK(glTexStorageMem2DMultisampleEXT)
+GLATTER_IBLOCK(glTexStorageMem3DEXT)
+GLATTER_IBLOCK(glTexStorageMem3DMultisampleEXT)
+GLATTER_IBLOCK(glTextureStorageMem1DEXT)
+GLATTER_IBLOCK(glTextureStorageMem2DEXT)
+GLATTER_IBLOCK(glTextureStorageMem2DMultisampleEXT)
+GLATTER_IBLOCK(glTextureStorageMem3DEXT)
+GLATTER_IBLOCK(glTextureStorageMem3DMultisampleEXT)
+#endif // defined(GL_EXT_memory_object)
+#if defined(GL_EXT_memory_object_fd)
+GLATTER_IEXTENSION(GL_EXT_memory_object_fd)
+GLATTER_IBLOCK(glImportMemoryFdEXT)
+#endif // defined(GL_EXT_memory_object_fd)
+#if defined(GL_EXT_memory_object_win32)
+GLATTER_IEXTENSION(GL_EXT_memory_object_win32)
+GLATTER_IBLOCK(glImportMemoryWin32HandleEXT)
+GLATTER_IBLOCK(glImportMemoryWin32NameEXT)
+#endif // defined(GL_EXT_memory_object_win32)
+#if defined(GL_EXT_mesh_shader)
+GLATTER_IEXTENSION(GL_EXT_mesh_shader)
+GLATTER_IBLOCK(glDrawMeshTasksEXT)
+GLATTER_IBLOCK(glDrawMeshTasksIndirectEXT)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectCountEXT)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectEXT)
+#endif // defined(GL_EXT_mesh_shader)
+#if defined(GL_EXT_multi_draw_arrays)
+GLATTER_IEXTENSION(GL_EXT_multi_draw_arrays)
+GLATTER_IBLOCK(glMultiDrawArraysEXT)
+GLATTER_IBLOCK(glMultiDrawElementsEXT)
+#endif // defined(GL_EXT_multi_draw_arrays)
+#if defined(GL_EXT_multisample)
+GLATTER_IEXTENSION(GL_EXT_multisample)
+GLATTER_IBLOCK(glSampleMaskEXT)
+GLATTER_IBLOCK(glSamplePatternEXT)
+#endif // defined(GL_EXT_multisample)
+#if defined(GL_EXT_paletted_texture)
+GLATTER_IEXTENSION(GL_EXT_paletted_texture)
+GLATTER_IBLOCK(glColorTableEXT)
+GLATTER_IBLOCK(glGetColorTableEXT)
+GLATTER_IBLOCK(glGetColorTableParameterfvEXT)
+GLATTER_IBLOCK(glGetColorTableParameterivEXT)
+#endif // defined(GL_EXT_paletted_texture)
+#if defined(GL_EXT_pixel_transform)
+GLATTER_IEXTENSION(GL_EXT_pixel_transform)
+GLATTER_IBLOCK(glGetPixelTransformParameterfvEXT)
+GLATTER_IBLOCK(glGetPixelTransformParameterivEXT)
+GLATTER_IBLOCK(glPixelTransformParameterfEXT)
+GLATTER_IBLOCK(glPixelTransformParameterfvEXT)
+GLATTER_IBLOCK(glPixelTransformParameteriEXT)
+GLATTER_IBLOCK(glPixelTransformParameterivEXT)
+#endif // defined(GL_EXT_pixel_transform)
+#if defined(GL_EXT_point_parameters)
+GLATTER_IEXTENSION(GL_EXT_point_parameters)
+GLATTER_IBLOCK(glPointParameterfEXT)
+GLATTER_IBLOCK(glPointParameterfvEXT)
+#endif // defined(GL_EXT_point_parameters)
+#if defined(GL_EXT_polygon_offset)
+GLATTER_IEXTENSION(GL_EXT_polygon_offset)
+GLATTER_IBLOCK(glPolygonOffsetEXT)
+#endif // defined(GL_EXT_polygon_offset)
+#if defined(GL_EXT_polygon_offset_clamp)
+GLATTER_IEXTENSION(GL_EXT_polygon_offset_clamp)
+GLATTER_IBLOCK(glPolygonOffsetClampEXT)
+#endif // defined(GL_EXT_polygon_offset_clamp)
+#if defined(GL_EXT_provoking_vertex)
+GLATTER_IEXTENSION(GL_EXT_provoking_vertex)
+GLATTER_IBLOCK(glProvokingVertexEXT)
+#endif // defined(GL_EXT_provoking_vertex)
+#if defined(GL_EXT_raster_multisample)
+GLATTER_IEXTENSION(GL_EXT_raster_multisample)
+GLATTER_IBLOCK(glRasterSamplesEXT)
+#endif // defined(GL_EXT_raster_multisample)
+#if defined(GL_EXT_secondary_color)
+GLATTER_IEXTENSION(GL_EXT_secondary_color)
+GLATTER_IBLOCK(glSecondaryColor3bEXT)
+GLATTER_IBLOCK(glSecondaryColor3bvEXT)
+GLATTER_IBLOCK(glSecondaryColor3dEXT)
+GLATTER_IBLOCK(glSecondaryColor3dvEXT)
+GLATTER_IBLOCK(glSecondaryColor3fEXT)
+GLATTER_IBLOCK(glSecondaryColor3fvEXT)
+GLATTER_IBLOCK(glSecondaryColor3iEXT)
+GLATTER_IBLOCK(glSecondaryColor3ivEXT)
+GLATTER_IBLOCK(glSecondaryColor3sEXT)
+GLATTER_IBLOCK(glSecondaryColor3svEXT)
+GLATTER_IBLOCK(glSecondaryColor3ubEXT)
+GLATTER_IBLOCK(glSecondaryColor3ubvEXT)
+GLATTER_IBLOCK(glSecondaryColor3uiEXT)
+GLATTER_IBLOCK(glSecondaryColor3uivEXT)
+GLATTER_IBLOCK(glSecondaryColor3usEXT)
+GLATTER_IBLOCK(glSecondaryColor3usvEXT)
+GLATTER_IBLOCK(glSecondaryColorPointerEXT)
+#endif // defined(GL_EXT_secondary_color)
+#if defined(GL_EXT_semaphore)
+GLATTER_IEXTENSION(GL_EXT_semaphore)
+GLATTER_IBLOCK(glDeleteSemaphoresEXT)
+GLATTER_IBLOCK(glGenSemaphoresEXT)
+GLATTER_IBLOCK(glGetSemaphoreParameterui64vEXT)
+GLATTER_IBLOCK(glIsSemaphoreEXT)
+GLATTER_IBLOCK(glSemaphoreParameterui64vEXT)
+GLATTER_IBLOCK(glSignalSemaphoreEXT)
+GLATTER_IBLOCK(glWaitSemaphoreEXT)
+#endif // defined(GL_EXT_semaphore)
+#if defined(GL_EXT_semaphore_fd)
+GLATTER_IEXTENSION(GL_EXT_semaphore_fd)
+GLATTER_IBLOCK(glImportSemaphoreFdEXT)
+#endif // defined(GL_EXT_semaphore_fd)
+#if defined(GL_EXT_semaphore_win32)
+GLATTER_IEXTENSION(GL_EXT_semaphore_win32)
+GLATTER_IBLOCK(glImportSemaphoreWin32HandleEXT)
+GLATTER_IBLOCK(glImportSemaphoreWin32NameEXT)
+#endif // defined(GL_EXT_semaphore_win32)
+#if defined(GL_EXT_separate_shader_objects)
+GLATTER_IEXTENSION(GL_EXT_separate_shader_objects)
+GLATTER_IBLOCK(glActiveProgramEXT)
+GLATTER_IBLOCK(glCreateShaderProgramEXT)
+GLATTER_IBLOCK(glUseShaderProgramEXT)
+#endif // defined(GL_EXT_separate_shader_objects)
+#if defined(GL_EXT_shader_framebuffer_fetch_non_coherent)
+GLATTER_IEXTENSION(GL_EXT_shader_framebuffer_fetch_non_coherent)
+GLATTER_IBLOCK(glFramebufferFetchBarrierEXT)
+#endif // defined(GL_EXT_shader_framebuffer_fetch_non_coherent)
+#if defined(GL_EXT_shader_image_load_store)
+GLATTER_IEXTENSION(GL_EXT_shader_image_load_store)
+GLATTER_IBLOCK(glBindImageTextureEXT)
+GLATTER_IBLOCK(glMemoryBarrierEXT)
+#endif // defined(GL_EXT_shader_image_load_store)
+#if defined(GL_EXT_stencil_clear_tag)
+GLATTER_IEXTENSION(GL_EXT_stencil_clear_tag)
+GLATTER_IBLOCK(glStencilClearTagEXT)
+#endif // defined(GL_EXT_stencil_clear_tag)
+#if defined(GL_EXT_stencil_two_side)
+GLATTER_IEXTENSION(GL_EXT_stencil_two_side)
+GLATTER_IBLOCK(glActiveStencilFaceEXT)
+#endif // defined(GL_EXT_stencil_two_side)
+#if defined(GL_EXT_subtexture)
+GLATTER_IEXTENSION(GL_EXT_subtexture)
+GLATTER_IBLOCK(glTexSubImage1DEXT)
+GLATTER_IBLOCK(glTexSubImage2DEXT)
+#endif // defined(GL_EXT_subtexture)
+#if defined(GL_EXT_texture3D)
+GLATTER_IEXTENSION(GL_EXT_texture3D)
+GLATTER_IBLOCK(glTexImage3DEXT)
+GLATTER_IBLOCK(glTexSubImage3DEXT)
+#endif // defined(GL_EXT_texture3D)
+#if defined(GL_EXT_texture_array)
+GLATTER_IEXTENSION(GL_EXT_texture_array)
+GLATTER_IBLOCK(glFramebufferTextureLayerEXT)
+#endif // defined(GL_EXT_texture_array)
+#if defined(GL_EXT_texture_buffer_object)
+GLATTER_IEXTENSION(GL_EXT_texture_buffer_object)
+GLATTER_IBLOCK(glTexBufferEXT)
+#endif // defined(GL_EXT_texture_buffer_object)
+#if defined(GL_EXT_texture_integer)
+GLATTER_IEXTENSION(GL_EXT_texture_integer)
+GLATTER_IBLOCK(glClearColorIiEXT)
+GLATTER_IBLOCK(glClearColorIuiEXT)
+GLATTER_IBLOCK(glGetTexParameterIivEXT)
+GLATTER_IBLOCK(glGetTexParameterIuivEXT)
+GLATTER_IBLOCK(glTexParameterIivEXT)
+GLATTER_IBLOCK(glTexParameterIuivEXT)
+#endif // defined(GL_EXT_texture_integer)
+#if defined(GL_EXT_texture_object)
+GLATTER_IEXTENSION(GL_EXT_texture_object)
+GLATTER_IBLOCK(glAreTexturesResidentEXT)
+GLATTER_IBLOCK(glBindTextureEXT)
+GLATTER_IBLOCK(glDeleteTexturesEXT)
+GLATTER_IBLOCK(glGenTexturesEXT)
+GLATTER_IBLOCK(glIsTextureEXT)
+GLATTER_IBLOCK(glPrioritizeTexturesEXT)
+#endif // defined(GL_EXT_texture_object)
+#if defined(GL_EXT_texture_perturb_normal)
+GLATTER_IEXTENSION(GL_EXT_texture_perturb_normal)
+GLATTER_IBLOCK(glTextureNormalEXT)
+#endif // defined(GL_EXT_texture_perturb_normal)
+#if defined(GL_EXT_texture_storage)
+GLATTER_IEXTENSION(GL_EXT_texture_storage)
+GLATTER_IBLOCK(glTexStorage1DEXT)
+GLATTER_IBLOCK(glTexStorage2DEXT)
+GLATTER_IBLOCK(glTexStorage3DEXT)
+#endif // defined(GL_EXT_texture_storage)
+#if defined(GL_EXT_timer_query)
+GLATTER_IEXTENSION(GL_EXT_timer_query)
+GLATTER_IBLOCK(glGetQueryObjecti64vEXT)
+GLATTER_IBLOCK(glGetQueryObjectui64vEXT)
+#endif // defined(GL_EXT_timer_query)
+#if defined(GL_EXT_transform_feedback)
+GLATTER_IEXTENSION(GL_EXT_transform_feedback)
+GLATTER_IBLOCK(glBeginTransformFeedbackEXT)
+GLATTER_IBLOCK(glBindBufferBaseEXT)
+GLATTER_IBLOCK(glBindBufferOffsetEXT)
+GLATTER_IBLOCK(glBindBufferRangeEXT)
+GLATTER_IBLOCK(glEndTransformFeedbackEXT)
+GLATTER_IBLOCK(glGetTransformFeedbackVaryingEXT)
+GLATTER_IBLOCK(glTransformFeedbackVaryingsEXT)
+#endif // defined(GL_EXT_transform_feedback)
+#if defined(GL_EXT_vertex_array)
+GLATTER_IEXTENSION(GL_EXT_vertex_array)
+GLATTER_IBLOCK(glArrayElementEXT)
+GLATTER_IBLOCK(glColorPointerEXT)
+GLATTER_IBLOCK(glDrawArraysEXT)
+GLATTER_IBLOCK(glEdgeFlagPointerEXT)
+GLATTER_IBLOCK(glGetPointervEXT)
+GLATTER_IBLOCK(glIndexPointerEXT)
+GLATTER_IBLOCK(glNormalPointerEXT)
+GLATTER_IBLOCK(glTexCoordPointerEXT)
+GLATTER_IBLOCK(glVertexPointerEXT)
+#endif // defined(GL_EXT_vertex_array)
+#if defined(GL_EXT_vertex_attrib_64bit)
+GLATTER_IEXTENSION(GL_EXT_vertex_attrib_64bit)
+GLATTER_IBLOCK(glGetVertexAttribLdvEXT)
+GLATTER_IBLOCK(glVertexAttribL1dEXT)
+GLATTER_IBLOCK(glVertexAttribL1dvEXT)
+GLATTER_IBLOCK(glVertexAttribL2dEXT)
+GLATTER_IBLOCK(glVertexAttribL2dvEXT)
+GLATTER_IBLOCK(glVertexAttribL3dEXT)
+GLATTER_IBLOCK(glVertexAttribL3dvEXT)
+GLATTER_IBLOCK(glVertexAttribL4dEXT)
+GLATTER_IBLOCK(glVertexAttribL4dvEXT)
+GLATTER_IBLOCK(glVertexAttribLPointerEXT)
+#endif // defined(GL_EXT_vertex_attrib_64bit)
+#if defined(GL_EXT_vertex_shader)
+GLATTER_IEXTENSION(GL_EXT_vertex_shader)
+GLATTER_IBLOCK(glBeginVertexShaderEXT)
+GLATTER_IBLOCK(glBindLightParameterEXT)
+GLATTER_IBLOCK(glBindMaterialParameterEXT)
+GLATTER_IBLOCK(glBindParameterEXT)
+GLATTER_IBLOCK(glBindTexGenParameterEXT)
+GLATTER_IBLOCK(glBindTextureUnitParameterEXT)
+GLATTER_IBLOCK(glBindVertexShaderEXT)
+GLATTER_IBLOCK(glDeleteVertexShaderEXT)
+GLATTER_IBLOCK(glDisableVariantClientStateEXT)
+GLATTER_IBLOCK(glEnableVariantClientStateEXT)
+GLATTER_IBLOCK(glEndVertexShaderEXT)
+GLATTER_IBLOCK(glExtractComponentEXT)
+GLATTER_IBLOCK(glGenSymbolsEXT)
+GLATTER_IBLOCK(glGenVertexShadersEXT)
+GLATTER_IBLOCK(glGetInvariantBooleanvEXT)
+GLATTER_IBLOCK(glGetInvariantFloatvEXT)
+GLATTER_IBLOCK(glGetInvariantIntegervEXT)
+GLATTER_IBLOCK(glGetLocalConstantBooleanvEXT)
+GLATTER_IBLOCK(glGetLocalConstantFloatvEXT)
+GLATTER_IBLOCK(glGetLocalConstantIntegervEXT)
+GLATTER_IBLOCK(glGetVariantBooleanvEXT)
+GLATTER_IBLOCK(glGetVariantFloatvEXT)
+GLATTER_IBLOCK(glGetVariantIntegervEXT)
+GLATTER_IBLOCK(glGetVariantPointervEXT)
+GLATTER_IBLOCK(glInsertComponentEXT)
+GLATTER_IBLOCK(glIsVariantEnabledEXT)
+GLATTER_IBLOCK(glSetInvariantEXT)
+GLATTER_IBLOCK(glSetLocalConstantEXT)
+GLATTER_IBLOCK(glShaderOp1EXT)
+GLATTER_IBLOCK(glShaderOp2EXT)
+GLATTER_IBLOCK(glShaderOp3EXT)
+GLATTER_IBLOCK(glSwizzleEXT)
+GLATTER_IBLOCK(glVariantPointerEXT)
+GLATTER_IBLOCK(glVariantbvEXT)
+GLATTER_IBLOCK(glVariantdvEXT)
+GLATTER_IBLOCK(glVariantfvEXT)
+GLATTER_IBLOCK(glVariantivEXT)
+GLATTER_IBLOCK(glVariantsvEXT)
+GLATTER_IBLOCK(glVariantubvEXT)
+GLATTER_IBLOCK(glVariantuivEXT)
+GLATTER_IBLOCK(glVariantusvEXT)
+GLATTER_IBLOCK(glWriteMaskEXT)
+#endif // defined(GL_EXT_vertex_shader)
+#if defined(GL_EXT_vertex_weighting)
+GLATTER_IEXTENSION(GL_EXT_vertex_weighting)
+GLATTER_IBLOCK(glVertexWeightPointerEXT)
+GLATTER_IBLOCK(glVertexWeightfEXT)
+GLATTER_IBLOCK(glVertexWeightfvEXT)
+#endif // defined(GL_EXT_vertex_weighting)
+#if defined(GL_EXT_win32_keyed_mutex)
+GLATTER_IEXTENSION(GL_EXT_win32_keyed_mutex)
+GLATTER_IBLOCK(glAcquireKeyedMutexWin32EXT)
+GLATTER_IBLOCK(glReleaseKeyedMutexWin32EXT)
+#endif // defined(GL_EXT_win32_keyed_mutex)
+#if defined(GL_EXT_window_rectangles)
+GLATTER_IEXTENSION(GL_EXT_window_rectangles)
+GLATTER_IBLOCK(glWindowRectanglesEXT)
+#endif // defined(GL_EXT_window_rectangles)
+#if defined(GL_EXT_x11_sync_object)
+GLATTER_IEXTENSION(GL_EXT_x11_sync_object)
+GLATTER_IBLOCK(glImportSyncEXT)
+#endif // defined(GL_EXT_x11_sync_object)
+#if defined(GL_GREMEDY_frame_terminator)
+GLATTER_IEXTENSION(GL_GREMEDY_frame_terminator)
+GLATTER_IBLOCK(glFrameTerminatorGREMEDY)
+#endif // defined(GL_GREMEDY_frame_terminator)
+#if defined(GL_GREMEDY_string_marker)
+GLATTER_IEXTENSION(GL_GREMEDY_string_marker)
+GLATTER_IBLOCK(glStringMarkerGREMEDY)
+#endif // defined(GL_GREMEDY_string_marker)
+#if defined(GL_HP_image_transform)
+GLATTER_IEXTENSION(GL_HP_image_transform)
+GLATTER_IBLOCK(glGetImageTransformParameterfvHP)
+GLATTER_IBLOCK(glGetImageTransformParameterivHP)
+GLATTER_IBLOCK(glImageTransformParameterfHP)
+GLATTER_IBLOCK(glImageTransformParameterfvHP)
+GLATTER_IBLOCK(glImageTransformParameteriHP)
+GLATTER_IBLOCK(glImageTransformParameterivHP)
+#endif // defined(GL_HP_image_transform)
+#if defined(GL_IBM_multimode_draw_arrays)
+GLATTER_IEXTENSION(GL_IBM_multimode_draw_arrays)
+GLATTER_IBLOCK(glMultiModeDrawArraysIBM)
+GLATTER_IBLOCK(glMultiModeDrawElementsIBM)
+#endif // defined(GL_IBM_multimode_draw_arrays)
+#if defined(GL_IBM_static_data)
+GLATTER_IEXTENSION(GL_IBM_static_data)
+GLATTER_IBLOCK(glFlushStaticDataIBM)
+#endif // defined(GL_IBM_static_data)
+#if defined(GL_IBM_vertex_array_lists)
+GLATTER_IEXTENSION(GL_IBM_vertex_array_lists)
+GLATTER_IBLOCK(glColorPointerListIBM)
+GLATTER_IBLOCK(glEdgeFlagPointerListIBM)
+GLATTER_IBLOCK(glFogCoordPointerListIBM)
+GLATTER_IBLOCK(glIndexPointerListIBM)
+GLATTER_IBLOCK(glNormalPointerListIBM)
+GLATTER_IBLOCK(glSecondaryColorPointerListIBM)
+GLATTER_IBLOCK(glTexCoordPointerListIBM)
+GLATTER_IBLOCK(glVertexPointerListIBM)
+#endif // defined(GL_IBM_vertex_array_lists)
+#if defined(GL_INGR_blend_func_separate)
+GLATTER_IEXTENSION(GL_INGR_blend_func_separate)
+GLATTER_IBLOCK(glBlendFuncSeparateINGR)
+#endif // defined(GL_INGR_blend_func_separate)
+#if defined(GL_INTEL_framebuffer_CMAA)
+GLATTER_IEXTENSION(GL_INTEL_framebuffer_CMAA)
+GLATTER_IBLOCK(glApplyFramebufferAttachmentCMAAINTEL)
+#endif // defined(GL_INTEL_framebuffer_CMAA)
+#if defined(GL_INTEL_map_texture)
+GLATTER_IEXTENSION(GL_INTEL_map_texture)
+GLATTER_IBLOCK(glMapTexture2DINTEL)
+GLATTER_IBLOCK(glSyncTextureINTEL)
+GLATTER_IBLOCK(glUnmapTexture2DINTEL)
+#endif // defined(GL_INTEL_map_texture)
+#if defined(GL_INTEL_parallel_arrays)
+GLATTER_IEXTENSION(GL_INTEL_parallel_arrays)
+GLATTER_IBLOCK(glColorPointervINTEL)
+GLATTER_IBLOCK(glNormalPointervINTEL)
+GLATTER_IBLOCK(glTexCoordPointervINTEL)
+GLATTER_IBLOCK(glVertexPointervINTEL)
+#endif // defined(GL_INTEL_parallel_arrays)
+#if defined(GL_INTEL_performance_query)
+GLATTER_IEXTENSION(GL_INTEL_performance_query)
+GLATTER_IBLOCK(glBeginPerfQueryINTEL)
+GLATTER_IBLOCK(glCreatePerfQueryINTEL)
+GLATTER_IBLOCK(glDeletePerfQueryINTEL)
+GLATTER_IBLOCK(glEndPerfQueryINTEL)
+GLATTER_IBLOCK(glGetFirstPerfQueryIdINTEL)
+GLATTER_IBLOCK(glGetNextPerfQueryIdINTEL)
+GLATTER_IBLOCK(glGetPerfCounterInfoINTEL)
+GLATTER_IBLOCK(glGetPerfQueryDataINTEL)
+GLATTER_IBLOCK(glGetPerfQueryIdByNameINTEL)
+GLATTER_IBLOCK(glGetPerfQueryInfoINTEL)
+#endif // defined(GL_INTEL_performance_query)
+#if defined(GL_KHR_blend_equation_advanced)
+GLATTER_IEXTENSION(GL_KHR_blend_equation_advanced)
+GLATTER_IBLOCK(glBlendBarrierKHR)
+#endif // defined(GL_KHR_blend_equation_advanced)
+#if defined(GL_KHR_parallel_shader_compile)
+GLATTER_IEXTENSION(GL_KHR_parallel_shader_compile)
+GLATTER_IBLOCK(glMaxShaderCompilerThreadsKHR)
+#endif // defined(GL_KHR_parallel_shader_compile)
+#if defined(GL_MESA_framebuffer_flip_y)
+GLATTER_IEXTENSION(GL_MESA_framebuffer_flip_y)
+GLATTER_IBLOCK(glFramebufferParameteriMESA)
+GLATTER_IBLOCK(glGetFramebufferParameterivMESA)
+#endif // defined(GL_MESA_framebuffer_flip_y)
+#if defined(GL_MESA_resize_buffers)
+GLATTER_IEXTENSION(GL_MESA_resize_buffers)
+GLATTER_IBLOCK(glResizeBuffersMESA)
+#endif // defined(GL_MESA_resize_buffers)
+#if defined(GL_MESA_window_pos)
+GLATTER_IEXTENSION(GL_MESA_window_pos)
+GLATTER_IBLOCK(glWindowPos2dMESA)
+GLATTER_IBLOCK(glWindowPos2dvMESA)
+GLATTER_IBLOCK(glWindowPos2fMESA)
+GLATTER_IBLOCK(glWindowPos2fvMESA)
+GLATTER_IBLOCK(glWindowPos2iMESA)
+GLATTER_IBLOCK(glWindowPos2ivMESA)
+GLATTER_IBLOCK(glWindowPos2sMESA)
+GLATTER_IBLOCK(glWindowPos2svMESA)
+GLATTER_IBLOCK(glWindowPos3dMESA)
+GLATTER_IBLOCK(glWindowPos3dvMESA)
+GLATTER_IBLOCK(glWindowPos3fMESA)
+GLATTER_IBLOCK(glWindowPos3fvMESA)
+GLATTER_IBLOCK(glWindowPos3iMESA)
+GLATTER_IBLOCK(glWindowPos3ivMESA)
+GLATTER_IBLOCK(glWindowPos3sMESA)
+GLATTER_IBLOCK(glWindowPos3svMESA)
+GLATTER_IBLOCK(glWindowPos4dMESA)
+GLATTER_IBLOCK(glWindowPos4dvMESA)
+GLATTER_IBLOCK(glWindowPos4fMESA)
+GLATTER_IBLOCK(glWindowPos4fvMESA)
+GLATTER_IBLOCK(glWindowPos4iMESA)
+GLATTER_IBLOCK(glWindowPos4ivMESA)
+GLATTER_IBLOCK(glWindowPos4sMESA)
+GLATTER_IBLOCK(glWindowPos4svMESA)
+#endif // defined(GL_MESA_window_pos)
+#if defined(GL_NVX_conditional_render)
+GLATTER_IEXTENSION(GL_NVX_conditional_render)
+GLATTER_IBLOCK(glBeginConditionalRenderNVX)
+GLATTER_IBLOCK(glEndConditionalRenderNVX)
+#endif // defined(GL_NVX_conditional_render)
+#if defined(GL_NVX_gpu_multicast2)
+GLATTER_IEXTENSION(GL_NVX_gpu_multicast2)
+GLATTER_IBLOCK(glAsyncCopyBufferSubDataNVX)
+GLATTER_IBLOCK(glAsyncCopyImageSubDataNVX)
+GLATTER_IBLOCK(glMulticastScissorArrayvNVX)
+GLATTER_IBLOCK(glMulticastViewportArrayvNVX)
+GLATTER_IBLOCK(glMulticastViewportPositionWScaleNVX)
+GLATTER_IBLOCK(glUploadGpuMaskNVX)
+#endif // defined(GL_NVX_gpu_multicast2)
+#if defined(GL_NVX_linked_gpu_multicast)
+GLATTER_IEXTENSION(GL_NVX_linked_gpu_multicast)
+GLATTER_IBLOCK(glLGPUCopyImageSubDataNVX)
+GLATTER_IBLOCK(glLGPUInterlockNVX)
+GLATTER_IBLOCK(glLGPUNamedBufferSubDataNVX)
+#endif // defined(GL_NVX_linked_gpu_multicast)
+#if defined(GL_NVX_progress_fence)
+GLATTER_IEXTENSION(GL_NVX_progress_fence)
+GLATTER_IBLOCK(glClientWaitSemaphoreui64NVX)
+GLATTER_IBLOCK(glCreateProgressFenceNVX)
+GLATTER_IBLOCK(glSignalSemaphoreui64NVX)
+GLATTER_IBLOCK(glWaitSemaphoreui64NVX)
+#endif // defined(GL_NVX_progress_fence)
+#if defined(GL_NV_alpha_to_coverage_dither_control)
+GLATTER_IEXTENSION(GL_NV_alpha_to_coverage_dither_control)
+GLATTER_IBLOCK(glAlphaToCoverageDitherControlNV)
+#endif // defined(GL_NV_alpha_to_coverage_dither_control)
+#if defined(GL_NV_bindless_multi_draw_indirect)
+GLATTER_IEXTENSION(GL_NV_bindless_multi_draw_indirect)
+GLATTER_IBLOCK(glMultiDrawArraysIndirectBindlessNV)
+GLATTER_IBLOCK(glMultiDrawElementsIndirectBindlessNV)
+#endif // defined(GL_NV_bindless_multi_draw_indirect)
+#if defined(GL_NV_bindless_multi_draw_indirect_count)
+GLATTER_IEXTENSION(GL_NV_bindless_multi_draw_indirect_count)
+GLATTER_IBLOCK(glMultiDrawArraysIndirectBindlessCountNV)
+GLATTER_IBLOCK(glMultiDrawElementsIndirectBindlessCountNV)
+#endif // defined(GL_NV_bindless_multi_draw_indirect_count)
+#if defined(GL_NV_bindless_texture)
+GLATTER_IEXTENSION(GL_NV_bindless_texture)
+GLATTER_IBLOCK(glGetImageHandleNV)
+GLATTER_IBLOCK(glGetTextureHandleNV)
+GLATTER_IBLOCK(glGetTextureSamplerHandleNV)
+GLATTER_IBLOCK(glIsImageHandleResidentNV)
+GLATTER_IBLOCK(glIsTextureHandleResidentNV)
+GLATTER_IBLOCK(glMakeImageHandleNonResidentNV)
+GLATTER_IBLOCK(glMakeImageHandleResidentNV)
+GLATTER_IBLOCK(glMakeTextureHandleNonResidentNV)
+GLATTER_IBLOCK(glMakeTextureHandleResidentNV)
+GLATTER_IBLOCK(glProgramUniformHandleui64NV)
+GLATTER_IBLOCK(glProgramUniformHandleui64vNV)
+GLATTER_IBLOCK(glUniformHandleui64NV)
+GLATTER_IBLOCK(glUniformHandleui64vNV)
+#endif // defined(GL_NV_bindless_texture)
+#if defined(GL_NV_blend_equation_advanced)
+GLATTER_IEXTENSION(GL_NV_blend_equation_advanced)
+GLATTER_IBLOCK(glBlendBarrierNV)
+GLATTER_IBLOCK(glBlendParameteriNV)
+#endif // defined(GL_NV_blend_equation_advanced)
+#if defined(GL_NV_clip_space_w_scaling)
+GLATTER_IEXTENSION(GL_NV_clip_space_w_scaling)
+GLATTER_IBLOCK(glViewportPositionWScaleNV)
+#endif // defined(GL_NV_clip_space_w_scaling)
+#if defined(GL_NV_command_list)
+GLATTER_IEXTENSION(GL_NV_command_list)
+GLATTER_IBLOCK(glCallCommandListNV)
+GLATTER_IBLOCK(glCommandListSegmentsNV)
+GLATTER_IBLOCK(glCompileCommandListNV)
+GLATTER_IBLOCK(glCreateCommandListsNV)
+GLATTER_IBLOCK(glCreateStatesNV)
+GLATTER_IBLOCK(glDeleteCommandListsNV)
+GLATTER_IBLOCK(glDeleteStatesNV)
+GLATTER_IBLOCK(glDrawCommandsAddressNV)
+GLATTER_IBLOCK(glDrawCommandsNV)
+GLATTER_IBLOCK(glDrawCommandsStatesAddressNV)
+GLATTER_IBLOCK(glDrawCommandsStatesNV)
+GLATTER_IBLOCK(glGetCommandHeaderNV)
+GLATTER_IBLOCK(glGetStageIndexNV)
+GLATTER_IBLOCK(glIsCommandListNV)
+GLATTER_IBLOCK(glIsStateNV)
+GLATTER_IBLOCK(glListDrawCommandsStatesClientNV)
+GLATTER_IBLOCK(glStateCaptureNV)
+#endif // defined(GL_NV_command_list)
+#if defined(GL_NV_conditional_render)
+GLATTER_IEXTENSION(GL_NV_conditional_render)
+GLATTER_IBLOCK(glBeginConditionalRenderNV)
+GLATTER_IBLOCK(glEndConditionalRenderNV)
+#endif // defined(GL_NV_conditional_render)
+#if defined(GL_NV_conservative_raster)
+GLATTER_IEXTENSION(GL_NV_conservative_raster)
+GLATTER_IBLOCK(glSubpixelPrecisionBiasNV)
+#endif // defined(GL_NV_conservative_raster)
+#if defined(GL_NV_conservative_raster_dilate)
+GLATTER_IEXTENSION(GL_NV_conservative_raster_dilate)
+GLATTER_IBLOCK(glConservativeRasterParameterfNV)
+#endif // defined(GL_NV_conservative_raster_dilate)
+#if defined(GL_NV_conservative_raster_pre_snap_triangles)
+GLATTER_IEXTENSION(GL_NV_conservative_raster_pre_snap_triangles)
+GLATTER_IBLOCK(glConservativeRasterParameteriNV)
+#endif // defined(GL_NV_conservative_raster_pre_snap_triangles)
+#if defined(GL_NV_copy_image)
+GLATTER_IEXTENSION(GL_NV_copy_image)
+GLATTER_IBLOCK(glCopyImageSubDataNV)
+#endif // defined(GL_NV_copy_image)
+#if defined(GL_NV_depth_buffer_float)
+GLATTER_IEXTENSION(GL_NV_depth_buffer_float)
+GLATTER_IBLOCK(glClearDepthdNV)
+GLATTER_IBLOCK(glDepthBoundsdNV)
+GLATTER_IBLOCK(glDepthRangedNV)
+#endif // defined(GL_NV_depth_buffer_float)
+#if defined(GL_NV_draw_texture)
+GLATTER_IEXTENSION(GL_NV_draw_texture)
+GLATTER_IBLOCK(glDrawTextureNV)
+#endif // defined(GL_NV_draw_texture)
+#if defined(GL_NV_draw_vulkan_image)
+GLATTER_IEXTENSION(GL_NV_draw_vulkan_image)
+GLATTER_IBLOCK(glDrawVkImageNV)
+GLATTER_IBLOCK(glGetVkProcAddrNV)
+GLATTER_IBLOCK(glSignalVkFenceNV)
+GLATTER_IBLOCK(glSignalVkSemaphoreNV)
+GLATTER_IBLOCK(glWaitVkSemaphoreNV)
+#endif // defined(GL_NV_draw_vulkan_image)
+#if defined(GL_NV_evaluators)
+GLATTER_IEXTENSION(GL_NV_evaluators)
+GLATTER_IBLOCK(glEvalMapsNV)
+GLATTER_IBLOCK(glGetMapAttribParameterfvNV)
+GLATTER_IBLOCK(glGetMapAttribParameterivNV)
+GLATTER_IBLOCK(glGetMapControlPointsNV)
+GLATTER_IBLOCK(glGetMapParameterfvNV)
+GLATTER_IBLOCK(glGetMapParameterivNV)
+GLATTER_IBLOCK(glMapControlPointsNV)
+GLATTER_IBLOCK(glMapParameterfvNV)
+GLATTER_IBLOCK(glMapParameterivNV)
+#endif // defined(GL_NV_evaluators)
+#if defined(GL_NV_explicit_multisample)
+GLATTER_IEXTENSION(GL_NV_explicit_multisample)
+GLATTER_IBLOCK(glGetMultisamplefvNV)
+GLATTER_IBLOCK(glSampleMaskIndexedNV)
+GLATTER_IBLOCK(glTexRenderbufferNV)
+#endif // defined(GL_NV_explicit_multisample)
+#if defined(GL_NV_fence)
+GLATTER_IEXTENSION(GL_NV_fence)
+GLATTER_IBLOCK(glDeleteFencesNV)
+GLATTER_IBLOCK(glFinishFenceNV)
+GLATTER_IBLOCK(glGenFencesNV)
+GLATTER_IBLOCK(glGetFenceivNV)
+GLATTER_IBLOCK(glIsFenceNV)
+GLATTER_IBLOCK(glSetFenceNV)
+GLATTER_IBLOCK(glTestFenceNV)
+#endif // defined(GL_NV_fence)
+#if defined(GL_NV_fragment_coverage_to_color)
+GLATTER_IEXTENSION(GL_NV_fragment_coverage_to_color)
+GLATTER_IBLOCK(glFragmentCoverageColorNV)
+#endif // defined(GL_NV_fragment_coverage_to_color)
+#if defined(GL_NV_fragment_program)
+GLATTER_IEXTENSION(GL_NV_fragment_program)
+GLATTER_IBLOCK(glGetProgramNamedParameterdvNV)
+GLATTER_IBLOCK(glGetProgramNamedParameterfvNV)
+GLATTER_IBLOCK(glProgramNamedParameter4dNV)
+GLATTER_IBLOCK(glProgramNamedParameter4dvNV)
+GLATTER_IBLOCK(glProgramNamedParameter4fNV)
+GLATTER_IBLOCK(glProgramNamedParameter4fvNV)
+#endif // defined(GL_NV_fragment_program)
+#if defined(GL_NV_framebuffer_mixed_samples)
+GLATTER_IEXTENSION(GL_NV_framebuffer_mixed_samples)
+GLATTER_IBLOCK(glCoverageModulationNV)
+GLATTER_IBLOCK(glCoverageModulationTableNV)
+GLATTER_IBLOCK(glGetCoverageModulationTableNV)
+#endif // defined(GL_NV_framebuffer_mixed_samples)
+#if defined(GL_NV_framebuffer_multisample_coverage)
+GLATTER_IEXTENSION(GL_NV_framebuffer_multisample_coverage)
+GLATTER_IBLOCK(glRenderbufferStorageMultisampleCoverageNV)
+#endif // defined(GL_NV_framebuffer_multisample_coverage)
+#if defined(GL_NV_geometry_program4)
+GLATTER_IEXTENSION(GL_NV_geometry_program4)
+GLATTER_IBLOCK(glFramebufferTextureEXT)
+GLATTER_IBLOCK(glFramebufferTextureFaceEXT)
+GLATTER_IBLOCK(glProgramVertexLimitNV)
+#endif // defined(GL_NV_geometry_program4)
+#if defined(GL_NV_gpu_multicast)
+GLATTER_IEXTENSION(GL_NV_gpu_multicast)
+GLATTER_IBLOCK(glMulticastBarrierNV)
+GLATTER_IBLOCK(glMulticastBlitFramebufferNV)
+GLATTER_IBLOCK(glMulticastBufferSubDataNV)
+GLATTER_IBLOCK(glMulticastCopyBufferSubDataNV)
+GLATTER_IBLOCK(glMulticastCopyImageSubDataNV)
+GLATTER_IBLOCK(glMulticastFramebufferSampleLocationsfvNV)
+GLATTER_IBLOCK(glMulticastGetQueryObjecti64vNV)
+GLATTER_IBLOCK(glMulticastGetQueryObjectivNV)
+GLATTER_IBLOCK(glMulticastGetQueryObjectui64vNV)
+GLATTER_IBLOCK(glMulticastGetQueryObjectuivNV)
+GLATTER_IBLOCK(glMulticastWaitSyncNV)
+GLATTER_IBLOCK(glRenderGpuMaskNV)
+#endif // defined(GL_NV_gpu_multicast)
+#if defined(GL_NV_gpu_program4)
+GLATTER_IEXTENSION(GL_NV_gpu_program4)
+GLATTER_IBLOCK(glGetProgramEnvParameterIivNV)
+GLATTER_IBLOCK(glGetProgramEnvParameterIuivNV)
+GLATTER_IBLOCK(glGetProgramLocalParameterIivNV)
+GLATTER_IBLOCK(glGetProgramLocalParameterIuivNV)
+GLATTER_IBLOCK(glProgramEnvParameterI4iNV)
+GLATTER_IBLOCK(glProgramEnvParameterI4ivNV)
+GLATTER_IBLOCK(glProgramEnvParameterI4uiNV)
+GLATTER_IBLOCK(glProgramEnvParameterI4uivNV)
+GLATTER_IBLOCK(glProgramEnvParametersI4ivNV)
+GLATTER_IBLOCK(glProgramEnvParametersI4uivNV)
+GLATTER_IBLOCK(glProgramLocalParameterI4iNV)
+GLATTER_IBLOCK(glProgramLocalParameterI4ivNV)
+GLATTER_IBLOCK(glProgramLocalParameterI4uiNV)
+GLATTER_IBLOCK(glProgramLocalParameterI4uivNV)
+GLATTER_IBLOCK(glProgramLocalParametersI4ivNV)
+GLATTER_IBLOCK(glProgramLocalParametersI4uivNV)
+#endif // defined(GL_NV_gpu_program4)
+#if defined(GL_NV_gpu_program5)
+GLATTER_IEXTENSION(GL_NV_gpu_program5)
+GLATTER_IBLOCK(glGetProgramSubroutineParameteruivNV)
+GLATTER_IBLOCK(glProgramSubroutineParametersuivNV)
+#endif // defined(GL_NV_gpu_program5)
+#if defined(GL_NV_half_float)
+GLATTER_IEXTENSION(GL_NV_half_float)
+GLATTER_IBLOCK(glColor3hNV)
+GLATTER_IBLOCK(glColor3hvNV)
+GLATTER_IBLOCK(glColor4hNV)
+GLATTER_IBLOCK(glColor4hvNV)
+GLATTER_IBLOCK(glFogCoordhNV)
+GLATTER_IBLOCK(glFogCoordhvNV)
+GLATTER_IBLOCK(glMultiTexCoord1hNV)
+GLATTER_IBLOCK(glMultiTexCoord1hvNV)
+GLATTER_IBLOCK(glMultiTexCoord2hNV)
+GLATTER_IBLOCK(glMultiTexCoord2hvNV)
+GLATTER_IBLOCK(glMultiTexCoord3hNV)
+GLATTER_IBLOCK(glMultiTexCoord3hvNV)
+GLATTER_IBLOCK(glMultiTexCoord4hNV)
+GLATTER_IBLOCK(glMultiTexCoord4hvNV)
+GLATTER_IBLOCK(glNormal3hNV)
+GLATTER_IBLOCK(glNormal3hvNV)
+GLATTER_IBLOCK(glSecondaryColor3hNV)
+GLATTER_IBLOCK(glSecondaryColor3hvNV)
+GLATTER_IBLOCK(glTexCoord1hNV)
+GLATTER_IBLOCK(glTexCoord1hvNV)
+GLATTER_IBLOCK(glTexCoord2hNV)
+GLATTER_IBLOCK(glTexCoord2hvNV)
+GLATTER_IBLOCK(glTexCoord3hNV)
+GLATTER_IBLOCK(glTexCoord3hvNV)
+GLATTER_IBLOCK(glTexCoord4hNV)
+GLATTER_IBLOCK(glTexCoord4hvNV)
+GLATTER_IBLOCK(glVertex2hNV)
+GLATTER_IBLOCK(glVertex2hvNV)
+GLATTER_IBLOCK(glVertex3hNV)
+GLATTER_IBLOCK(glVertex3hvNV)
+GLATTER_IBLOCK(glVertex4hNV)
+GLATTER_IBLOCK(glVertex4hvNV)
+GLATTER_IBLOCK(glVertexAttrib1hNV)
+GLATTER_IBLOCK(glVertexAttrib1hvNV)
+GLATTER_IBLOCK(glVertexAttrib2hNV)
+GLATTER_IBLOCK(glVertexAttrib2hvNV)
+GLATTER_IBLOCK(glVertexAttrib3hNV)
+GLATTER_IBLOCK(glVertexAttrib3hvNV)
+GLATTER_IBLOCK(glVertexAttrib4hNV)
+GLATTER_IBLOCK(glVertexAttrib4hvNV)
+GLATTER_IBLOCK(glVertexAttribs1hvNV)
+GLATTER_IBLOCK(glVertexAttribs2hvNV)
+GLATTER_IBLOCK(glVertexAttribs3hvNV)
+GLATTER_IBLOCK(glVertexAttribs4hvNV)
+GLATTER_IBLOCK(glVertexWeighthNV)
+GLATTER_IBLOCK(glVertexWeighthvNV)
+#endif // defined(GL_NV_half_float)
+#if defined(GL_NV_internalformat_sample_query)
+GLATTER_IEXTENSION(GL_NV_internalformat_sample_query)
+GLATTER_IBLOCK(glGetInternalformatSampleivNV)
+#endif // defined(GL_NV_internalformat_sample_query)
+#if defined(GL_NV_memory_attachment)
+GLATTER_IEXTENSION(GL_NV_memory_attachment)
+GLATTER_IBLOCK(glBufferAttachMemoryNV)
+GLATTER_IBLOCK(glGetMemoryObjectDetachedResourcesuivNV)
+GLATTER_IBLOCK(glNamedBufferAttachMemoryNV)
+GLATTER_IBLOCK(glResetMemoryObjectParameterNV)
+GLATTER_IBLOCK(glTexAttachMemoryNV)
+GLATTER_IBLOCK(glTextureAttachMemoryNV)
+#endif // defined(GL_NV_memory_attachment)
+#if defined(GL_NV_memory_object_sparse)
+GLATTER_IEXTENSION(GL_NV_memory_object_sparse)
+GLATTER_IBLOCK(glBufferPageCommitmentMemNV)
+GLATTER_IBLOCK(glNamedBufferPageCommitmentMemNV)
+GLATTER_IBLOCK(glTexPageCommitmentMemNV)
+GLATTER_IBLOCK(glTexturePageCommitmentMemNV)
+#endif // defined(GL_NV_memory_object_sparse)
+#if defined(GL_NV_mesh_shader)
+GLATTER_IEXTENSION(GL_NV_mesh_shader)
+GLATTER_IBLOCK(glDrawMeshTasksIndirectNV)
+GLATTER_IBLOCK(glDrawMeshTasksNV)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectCountNV)
+GLATTER_IBLOCK(glMultiDrawMeshTasksIndirectNV)
+#endif // defined(GL_NV_mesh_shader)
+#if defined(GL_NV_occlusion_query)
+GLATTER_IEXTENSION(GL_NV_occlusion_query)
+GLATTER_IBLOCK(glBeginOcclusionQueryNV)
+GLATTER_IBLOCK(glDeleteOcclusionQueriesNV)
+GLATTER_IBLOCK(glEndOcclusionQueryNV)
+GLATTER_IBLOCK(glGenOcclusionQueriesNV)
+GLATTER_IBLOCK(glGetOcclusionQueryivNV)
+GLATTER_IBLOCK(glGetOcclusionQueryuivNV)
+GLATTER_IBLOCK(glIsOcclusionQueryNV)
+#endif // defined(GL_NV_occlusion_query)
+#if defined(GL_NV_parameter_buffer_object)
+GLATTER_IEXTENSION(GL_NV_parameter_buffer_object)
+GLATTER_IBLOCK(glProgramBufferParametersIivNV)
+GLATTER_IBLOCK(glProgramBufferParametersIuivNV)
+GLATTER_IBLOCK(glProgramBufferParametersfvNV)
+#endif // defined(GL_NV_parameter_buffer_object)
+#if defined(GL_NV_path_rendering)
+GLATTER_IEXTENSION(GL_NV_path_rendering)
+GLATTER_IBLOCK(glCopyPathNV)
+GLATTER_IBLOCK(glCoverFillPathInstancedNV)
+GLATTER_IBLOCK(glCoverFillPathNV)
+GLATTER_IBLOCK(glCoverStrokePathInstancedNV)
+GLATTER_IBLOCK(glCoverStrokePathNV)
+GLATTER_IBLOCK(glDeletePathsNV)
+GLATTER_IBLOCK(glGenPathsNV)
+GLATTER_IBLOCK(glGetPathColorGenfvNV)
+GLATTER_IBLOCK(glGetPathColorGenivNV)
+GLATTER_IBLOCK(glGetPathCommandsNV)
+GLATTER_IBLOCK(glGetPathCoordsNV)
+GLATTER_IBLOCK(glGetPathDashArrayNV)
+GLATTER_IBLOCK(glGetPathLengthNV)
+GLATTER_IBLOCK(glGetPathMetricRangeNV)
+GLATTER_IBLOCK(glGetPathMetricsNV)
+GLATTER_IBLOCK(glGetPathParameterfvNV)
+GLATTER_IBLOCK(glGetPathParameterivNV)
+GLATTER_IBLOCK(glGetPathSpacingNV)
+GLATTER_IBLOCK(glGetPathTexGenfvNV)
+GLATTER_IBLOCK(glGetPathTexGenivNV)
+GLATTER_IBLOCK(glGetProgramResourcefvNV)
+GLATTER_IBLOCK(glInterpolatePathsNV)
+GLATTER_IBLOCK(glIsPathNV)
+GLATTER_IBLOCK(glIsPointInFillPathNV)
+GLATTER_IBLOCK(glIsPointInStrokePathNV)
+GLATTER_IBLOCK(glMatrixLoad3x2fNV)
+GLATTER_IBLOCK(glMatrixLoad3x3fNV)
+GLATTER_IBLOCK(glMatrixLoadTranspose3x3fNV)
+GLATTER_IBLOCK(glMatrixMult3x2fNV)
+GLATTER_IBLOCK(glMatrixMult3x3fNV)
+GLATTER_IBLOCK(glMatrixMultTranspose3x3fNV)
+GLATTER_IBLOCK(glPathColorGenNV)
+GLATTER_IBLOCK(glPathCommandsNV)
+GLATTER_IBLOCK(glPathCoordsNV)
+GLATTER_IBLOCK(glPathCoverDepthFuncNV)
+GLATTER_IBLOCK(glPathDashArrayNV)
+GLATTER_IBLOCK(glPathFogGenNV)
+GLATTER_IBLOCK(glPathGlyphIndexArrayNV)
+GLATTER_IBLOCK(glPathGlyphIndexRangeNV)
+GLATTER_IBLOCK(glPathGlyphRangeNV)
+GLATTER_IBLOCK(glPathGlyphsNV)
+GLATTER_IBLOCK(glPathMemoryGlyphIndexArrayNV)
+GLATTER_IBLOCK(glPathParameterfNV)
+GLATTER_IBLOCK(glPathParameterfvNV)
+GLATTER_IBLOCK(glPathParameteriNV)
+GLATTER_IBLOCK(glPathParameterivNV)
+GLATTER_IBLOCK(glPathStencilDepthOffsetNV)
+GLATTER_IBLOCK(glPathStencilFuncNV)
+GLATTER_IBLOCK(glPathStringNV)
+GLATTER_IBLOCK(glPathSubCommandsNV)
+GLATTER_IBLOCK(glPathSubCoordsNV)
+GLATTER_IBLOCK(glPathTexGenNV)
+GLATTER_IBLOCK(glPointAlongPathNV)
+GLATTER_IBLOCK(glProgramPathFragmentInputGenNV)
+GLATTER_IBLOCK(glStencilFillPathInstancedNV)
+GLATTER_IBLOCK(glStencilFillPathNV)
+GLATTER_IBLOCK(glStencilStrokePathInstancedNV)
+GLATTER_IBLOCK(glStencilStrokePathNV)
+GLATTER_IBLOCK(glStencilThenCoverFillPathInstancedNV)
+GLATTER_IBLOCK(glStencilThenCoverFillPathNV)
+GLATTER_IBLOCK(glStencilThenCoverStrokePathInstancedNV)
+GLATTER_IBLOCK(glStencilThenCoverStrokePathNV)
+GLATTER_IBLOCK(glTransformPathNV)
+GLATTER_IBLOCK(glWeightPathsNV)
+#endif // defined(GL_NV_path_rendering)
+#if defined(GL_NV_pixel_data_range)
+GLATTER_IEXTENSION(GL_NV_pixel_data_range)
+GLATTER_IBLOCK(glFlushPixelDataRangeNV)
+GLATTER_IBLOCK(glPixelDataRangeNV)
+#endif // defined(GL_NV_pixel_data_range)
+#if defined(GL_NV_point_sprite)
+GLATTER_IEXTENSION(GL_NV_point_sprite)
+GLATTER_IBLOCK(glPointParameteriNV)
+GLATTER_IBLOCK(glPointParameterivNV)
+#endif // defined(GL_NV_point_sprite)
+#if defined(GL_NV_present_video)
+GLATTER_IEXTENSION(GL_NV_present_video)
+GLATTER_IBLOCK(glGetVideoi64vNV)
+GLATTER_IBLOCK(glGetVideoivNV)
+GLATTER_IBLOCK(glGetVideoui64vNV)
+GLATTER_IBLOCK(glGetVideouivNV)
+GLATTER_IBLOCK(glPresentFrameDualFillNV)
+GLATTER_IBLOCK(glPresentFrameKeyedNV)
+#endif // defined(GL_NV_present_video)
+#if defined(GL_NV_primitive_restart)
+GLATTER_IEXTENSION(GL_NV_primitive_restart)
+GLATTER_IBLOCK(glPrimitiveRestartIndexNV)
+GLATTER_IBLOCK(glPrimitiveRestartNV)
+#endif // defined(GL_NV_primitive_restart)
+#if defined(GL_NV_query_resource)
+GLATTER_IEXTENSION(GL_NV_query_resource)
+GLATTER_IBLOCK(glQueryResourceNV)
+#endif // defined(GL_NV_query_resource)
+#if defined(GL_NV_query_resource_tag)
+GLATTER_IEXTENSION(GL_NV_query_resource_tag)
+GLATTER_IBLOCK(glDeleteQueryResourceTagNV)
+GLATTER_IBLOCK(glGenQueryResourceTagNV)
+GLATTER_IBLOCK(glQueryResourceTagNV)
+#endif // defined(GL_NV_query_resource_tag)
+#if defined(GL_NV_register_combiners)
+GLATTER_IEXTENSION(GL_NV_register_combiners)
+GLATTER_IBLOCK(glCombinerInputNV)
+GLATTER_IBLOCK(glCombinerOutputNV)
+GLATTER_IBLOCK(glCombinerParameterfNV)
+GLATTER_IBLOCK(glCombinerParameterfvNV)
+GLATTER_IBLOCK(glCombinerParameteriNV)
+GLATTER_IBLOCK(glCombinerParameterivNV)
+GLATTER_IBLOCK(glFinalCombinerInputNV)
+GLATTER_IBLOCK(glGetCombinerInputParameterfvNV)
+GLATTER_IBLOCK(glGetCombinerInputParameterivNV)
+GLATTER_IBLOCK(glGetCombinerOutputParameterfvNV)
+GLATTER_IBLOCK(glGetCombinerOutputParameterivNV)
+GLATTER_IBLOCK(glGetFinalCombinerInputParameterfvNV)
+GLATTER_IBLOCK(glGetFinalCombinerInputParameterivNV)
+#endif // defined(GL_NV_register_combiners)
+#if defined(GL_NV_register_combiners2)
+GLATTER_IEXTENSION(GL_NV_register_combiners2)
+GLATTER_IBLOCK(glCombinerStageParameterfvNV)
+GLATTER_IBLOCK(glGetCombinerStageParameterfvNV)
+#endif // defined(GL_NV_register_combiners2)
+#if defined(GL_NV_sample_locations)
+GLATTER_IEXTENSION(GL_NV_sample_locations)
+GLATTER_IBLOCK(glFramebufferSampleLocationsfvNV)
+GLATTER_IBLOCK(glNamedFramebufferSampleLocationsfvNV)
+GLATTER_IBLOCK(glResolveDepthValuesNV)
+#endif // defined(GL_NV_sample_locations)
+#if defined(GL_NV_scissor_exclusive)
+GLATTER_IEXTENSION(GL_NV_scissor_exclusive)
+GLATTER_IBLOCK(glScissorExclusiveArrayvNV)
+GLATTER_IBLOCK(glScissorExclusiveNV)
+#endif // defined(GL_NV_scissor_exclusive)
+#if defined(GL_NV_shader_buffer_load)
+GLATTER_IEXTENSION(GL_NV_shader_buffer_load)
+GLATTER_IBLOCK(glGetBufferParameterui64vNV)
+GLATTER_IBLOCK(glGetIntegerui64vNV)
+GLATTER_IBLOCK(glGetNamedBufferParameterui64vNV)
+GLATTER_IBLOCK(glIsBufferResidentNV)
+GLATTER_IBLOCK(glIsNamedBufferResidentNV)
+GLATTER_IBLOCK(glMakeBufferNonResidentNV)
+GLATTER_IBLOCK(glMakeBufferResidentNV)
+GLATTER_IBLOCK(glMakeNamedBufferNonResidentNV)
+GLATTER_IBLOCK(glMakeNamedBufferResidentNV)
+GLATTER_IBLOCK(glProgramUniformui64NV)
+GLATTER_IBLOCK(glProgramUniformui64vNV)
+GLATTER_IBLOCK(glUniformui64NV)
+GLATTER_IBLOCK(glUniformui64vNV)
+#endif // defined(GL_NV_shader_buffer_load)
+#if defined(GL_NV_shading_rate_image)
+GLATTER_IEXTENSION(GL_NV_shading_rate_image)
+GLATTER_IBLOCK(glBindShadingRateImageNV)
+GLATTER_IBLOCK(glGetShadingRateImagePaletteNV)
+GLATTER_IBLOCK(glGetShadingRateSampleLocationivNV)
+GLATTER_IBLOCK(glShadingRateImageBarrierNV)
+GLATTER_IBLOCK(glShadingRateImagePaletteNV)
+GLATTER_IBLOCK(glShadingRateSampleOrderCustomNV)
+GLATTER_IBLOCK(glShadingRateSampleOrderNV)
+#endif // defined(GL_NV_shading_rate_image)
+#if defined(GL_NV_texture_barrier)
+GLATTER_IEXTENSION(GL_NV_texture_barrier)
+GLATTER_IBLOCK(glTextureBarrierNV)
+#endif // defined(GL_NV_texture_barrier)
+#if defined(GL_NV_texture_multisample)
+GLATTER_IEXTENSION(GL_NV_texture_multisample)
+GLATTER_IBLOCK(glTexImage2DMultisampleCoverageNV)
+GLATTER_IBLOCK(glTexImage3DMultisampleCoverageNV)
+GLATTER_IBLOCK(glTextureImage2DMultisampleCoverageNV)
+GLATTER_IBLOCK(glTextureImage2DMultisampleNV)
+GLATTER_IBLOCK(glTextureImage3DMultisampleCoverageNV)
+GLATTER_IBLOCK(glTextureImage3DMultisampleNV)
+#endif // defined(GL_NV_texture_multisample)
+#if defined(GL_NV_timeline_semaphore)
+GLATTER_IEXTENSION(GL_NV_timeline_semaphore)
+GLATTER_IBLOCK(glCreateSemaphoresNV)
+GLATTER_IBLOCK(glGetSemaphoreParameterivNV)
+GLATTER_IBLOCK(glSemaphoreParameterivNV)
+#endif // defined(GL_NV_timeline_semaphore)
+#if defined(GL_NV_transform_feedback)
+GLATTER_IEXTENSION(GL_NV_transform_feedback)
+GLATTER_IBLOCK(glActiveVaryingNV)
+GLATTER_IBLOCK(glBeginTransformFeedbackNV)
+GLATTER_IBLOCK(glBindBufferBaseNV)
+GLATTER_IBLOCK(glBindBufferOffsetNV)
+GLATTER_IBLOCK(glBindBufferRangeNV)
+GLATTER_IBLOCK(glEndTransformFeedbackNV)
+GLATTER_IBLOCK(glGetActiveVaryingNV)
+GLATTER_IBLOCK(glGetTransformFeedbackVaryingNV)
+GLATTER_IBLOCK(glGetVaryingLocationNV)
+GLATTER_IBLOCK(glTransformFeedbackAttribsNV)
+GLATTER_IBLOCK(glTransformFeedbackStreamAttribsNV)
+GLATTER_IBLOCK(glTransformFeedbackVaryingsNV)
+#endif // defined(GL_NV_transform_feedback)
+#if defined(GL_NV_transform_feedback2)
+GLATTER_IEXTENSION(GL_NV_transform_feedback2)
+GLATTER_IBLOCK(glBindTransformFeedbackNV)
+GLATTER_IBLOCK(glDeleteTransformFeedbacksNV)
+GLATTER_IBLOCK(glDrawTransformFeedbackNV)
+GLATTER_IBLOCK(glGenTransformFeedbacksNV)
+GLATTER_IBLOCK(glIsTransformFeedbackNV)
+GLATTER_IBLOCK(glPauseTransformFeedbackNV)
+GLATTER_IBLOCK(glResumeTransformFeedbackNV)
+#endif // defined(GL_NV_transform_feedback2)
+#if defined(GL_NV_vdpau_interop)
+GLATTER_IEXTENSION(GL_NV_vdpau_interop)
+GLATTER_IBLOCK(glVDPAUFiniNV)
+GLATTER_IBLOCK(glVDPAUGetSurfaceivNV)
+GLATTER_IBLOCK(glVDPAUInitNV)
+GLATTER_IBLOCK(glVDPAUIsSurfaceNV)
+GLATTER_IBLOCK(glVDPAUMapSurfacesNV)
+GLATTER_IBLOCK(glVDPAURegisterOutputSurfaceNV)
+GLATTER_IBLOCK(glVDPAURegisterVideoSurfaceNV)
+GLATTER_IBLOCK(glVDPAUSurfaceAccessNV)
+GLATTER_IBLOCK(glVDPAUUnmapSurfacesNV)
+GLATTER_IBLOCK(glVDPAUUnregisterSurfaceNV)
+#endif // defined(GL_NV_vdpau_interop)
+#if defined(GL_NV_vdpau_interop2)
+GLATTER_IEXTENSION(GL_NV_vdpau_interop2)
+GLATTER_IBLOCK(glVDPAURegisterVideoSurfaceWithPictureStructureNV)
+#endif // defined(GL_NV_vdpau_interop2)
+#if defined(GL_NV_vertex_array_range)
+GLATTER_IEXTENSION(GL_NV_vertex_array_range)
+GLATTER_IBLOCK(glFlushVertexArrayRangeNV)
+GLATTER_IBLOCK(glVertexArrayRangeNV)
+#endif // defined(GL_NV_vertex_array_range)
+#if defined(GL_NV_vertex_attrib_integer_64bit)
+GLATTER_IEXTENSION(GL_NV_vertex_attrib_integer_64bit)
+GLATTER_IBLOCK(glGetVertexAttribLi64vNV)
+GLATTER_IBLOCK(glGetVertexAttribLui64vNV)
+GLATTER_IBLOCK(glVertexAttribL1i64NV)
+GLATTER_IBLOCK(glVertexAttribL1i64vNV)
+GLATTER_IBLOCK(glVertexAttribL1ui64NV)
+GLATTER_IBLOCK(glVertexAttribL1ui64vNV)
+GLATTER_IBLOCK(glVertexAttribL2i64NV)
+GLATTER_IBLOCK(glVertexAttribL2i64vNV)
+GLATTER_IBLOCK(glVertexAttribL2ui64NV)
+GLATTER_IBLOCK(glVertexAttribL2ui64vNV)
+GLATTER_IBLOCK(glVertexAttribL3i64NV)
+GLATTER_IBLOCK(glVertexAttribL3i64vNV)
+GLATTER_IBLOCK(glVertexAttribL3ui64NV)
+GLATTER_IBLOCK(glVertexAttribL3ui64vNV)
+GLATTER_IBLOCK(glVertexAttribL4i64NV)
+GLATTER_IBLOCK(glVertexAttribL4i64vNV)
+GLATTER_IBLOCK(glVertexAttribL4ui64NV)
+GLATTER_IBLOCK(glVertexAttribL4ui64vNV)
+GLATTER_IBLOCK(glVertexAttribLFormatNV)
+#endif // defined(GL_NV_vertex_attrib_integer_64bit)
+#if defined(GL_NV_vertex_buffer_unified_memory)
+GLATTER_IEXTENSION(GL_NV_vertex_buffer_unified_memory)
+GLATTER_IBLOCK(glBufferAddressRangeNV)
+GLATTER_IBLOCK(glColorFormatNV)
+GLATTER_IBLOCK(glEdgeFlagFormatNV)
+GLATTER_IBLOCK(glFogCoordFormatNV)
+GLATTER_IBLOCK(glGetIntegerui64i_vNV)
+GLATTER_IBLOCK(glIndexFormatNV)
+GLATTER_IBLOCK(glNormalFormatNV)
+GLATTER_IBLOCK(glSecondaryColorFormatNV)
+GLATTER_IBLOCK(glTexCoordFormatNV)
+GLATTER_IBLOCK(glVertexAttribFormatNV)
+GLATTER_IBLOCK(glVertexAttribIFormatNV)
+GLATTER_IBLOCK(glVertexFormatNV)
+#endif // defined(GL_NV_vertex_buffer_unified_memory)
+#if defined(GL_NV_vertex_program)
+GLATTER_IEXTENSION(GL_NV_vertex_program)
+GLATTER_IBLOCK(glAreProgramsResidentNV)
+GLATTER_IBLOCK(glBindProgramNV)
+GLATTER_IBLOCK(glDeleteProgramsNV)
+GLATTER_IBLOCK(glExecuteProgramNV)
+GLATTER_IBLOCK(glGenProgramsNV)
+GLATTER_IBLOCK(glGetProgramParameterdvNV)
+GLATTER_IBLOCK(glGetProgramParameterfvNV)
+GLATTER_IBLOCK(glGetProgramStringNV)
+GLATTER_IBLOCK(glGetProgramivNV)
+GLATTER_IBLOCK(glGetTrackMatrixivNV)
+GLATTER_IBLOCK(glGetVertexAttribPointervNV)
+GLATTER_IBLOCK(glGetVertexAttribdvNV)
+GLATTER_IBLOCK(glGetVertexAttribfvNV)
+GLATTER_IBLOCK(glGetVertexAttribivNV)
+GLATTER_IBLOCK(glIsProgramNV)
+GLATTER_IBLOCK(glLoadProgramNV)
+GLATTER_IBLOCK(glProgramParameter4dNV)
+GLATTER_IBLOCK(glProgramParameter4dvNV)
+GLATTER_IBLOCK(glProgramParameter4fNV)
+GLATTER_IBLOCK(glProgramParameter4fvNV)
+GLATTER_IBLOCK(glProgramParameters4dvNV)
+GLATTER_IBLOCK(glProgramParameters4fvNV)
+GLATTER_IBLOCK(glRequestResidentProgramsNV)
+GLATTER_IBLOCK(glTrackMatrixNV)
+GLATTER_IBLOCK(glVertexAttrib1dNV)
+GLATTER_IBLOCK(glVertexAttrib1dvNV)
+GLATTER_IBLOCK(glVertexAttrib1fNV)
+GLATTER_IBLOCK(glVertexAttrib1fvNV)
+GLATTER_IBLOCK(glVertexAttrib1sNV)
+GLATTER_IBLOCK(glVertexAttrib1svNV)
+GLATTER_IBLOCK(glVertexAttrib2dNV)
+GLATTER_IBLOCK(glVertexAttrib2dvNV)
+GLATTER_IBLOCK(glVertexAttrib2fNV)
+GLATTER_IBLOCK(glVertexAttrib2fvNV)
+GLATTER_IBLOCK(glVertexAttrib2sNV)
+GLATTER_IBLOCK(glVertexAttrib2svNV)
+GLATTER_IBLOCK(glVertexAttrib3dNV)
+GLATTER_IBLOCK(glVertexAttrib3dvNV)
+GLATTER_IBLOCK(glVertexAttrib3fNV)
+GLATTER_IBLOCK(glVertexAttrib3fvNV)
+GLATTER_IBLOCK(glVertexAttrib3sNV)
+GLATTER_IBLOCK(glVertexAttrib3svNV)
+GLATTER_IBLOCK(glVertexAttrib4dNV)
+GLATTER_IBLOCK(glVertexAttrib4dvNV)
+GLATTER_IBLOCK(glVertexAttrib4fNV)
+GLATTER_IBLOCK(glVertexAttrib4fvNV)
+GLATTER_IBLOCK(glVertexAttrib4sNV)
+GLATTER_IBLOCK(glVertexAttrib4svNV)
+GLATTER_IBLOCK(glVertexAttrib4ubNV)
+GLATTER_IBLOCK(glVertexAttrib4ubvNV)
+GLATTER_IBLOCK(glVertexAttribPointerNV)
+GLATTER_IBLOCK(glVertexAttribs1dvNV)
+GLATTER_IBLOCK(glVertexAttribs1fvNV)
+GLATTER_IBLOCK(glVertexAttribs1svNV)
+GLATTER_IBLOCK(glVertexAttribs2dvNV)
+GLATTER_IBLOCK(glVertexAttribs2fvNV)
+GLATTER_IBLOCK(glVertexAttribs2svNV)
+GLATTER_IBLOCK(glVertexAttribs3dvNV)
+GLATTER_IBLOCK(glVertexAttribs3fvNV)
+GLATTER_IBLOCK(glVertexAttribs3svNV)
+GLATTER_IBLOCK(glVertexAttribs4dvNV)
+GLATTER_IBLOCK(glVertexAttribs4fvNV)
+GLATTER_IBLOCK(glVertexAttribs4svNV)
+GLATTER_IBLOCK(glVertexAttribs4ubvNV)
+#endif // defined(GL_NV_vertex_program)
+#if defined(GL_NV_video_capture)
+GLATTER_IEXTENSION(GL_NV_video_capture)
+GLATTER_IBLOCK(glBeginVideoCaptureNV)
+GLATTER_IBLOCK(glBindVideoCaptureStreamBufferNV)
+GLATTER_IBLOCK(glBindVideoCaptureStreamTextureNV)
+GLATTER_IBLOCK(glEndVideoCaptureNV)
+GLATTER_IBLOCK(glGetVideoCaptureStreamdvNV)
+GLATTER_IBLOCK(glGetVideoCaptureStreamfvNV)
+GLATTER_IBLOCK(glGetVideoCaptureStreamivNV)
+GLATTER_IBLOCK(glGetVideoCaptureivNV)
+GLATTER_IBLOCK(glVideoCaptureNV)
+GLATTER_IBLOCK(glVideoCaptureStreamParameterdvNV)
+GLATTER_IBLOCK(glVideoCaptureStreamParameterfvNV)
+GLATTER_IBLOCK(glVideoCaptureStreamParameterivNV)
+#endif // defined(GL_NV_video_capture)
+#if defined(GL_NV_viewport_swizzle)
+GLATTER_IEXTENSION(GL_NV_viewport_swizzle)
+GLATTER_IBLOCK(glViewportSwizzleNV)
+#endif // defined(GL_NV_viewport_swizzle)
+#if defined(GL_OES_byte_coordinates)
+GLATTER_IEXTENSION(GL_OES_byte_coordinates)
+GLATTER_IBLOCK(glMultiTexCoord1bOES)
+GLATTER_IBLOCK(glMultiTexCoord1bvOES)
+GLATTER_IBLOCK(glMultiTexCoord2bOES)
+GLATTER_IBLOCK(glMultiTexCoord2bvOES)
+GLATTER_IBLOCK(glMultiTexCoord3bOES)
+GLATTER_IBLOCK(glMultiTexCoord3bvOES)
+GLATTER_IBLOCK(glMultiTexCoord4bOES)
+GLATTER_IBLOCK(glMultiTexCoord4bvOES)
+GLATTER_IBLOCK(glTexCoord1bOES)
+GLATTER_IBLOCK(glTexCoord1bvOES)
+GLATTER_IBLOCK(glTexCoord2bOES)
+GLATTER_IBLOCK(glTexCoord2bvOES)
+GLATTER_IBLOCK(glTexCoord3bOES)
+GLATTER_IBLOCK(glTexCoord3bvOES)
+GLATTER_IBLOCK(glTexCoord4bOES)
+GLATTER_IBLOCK(glTexCoord4bvOES)
+GLATTER_IBLOCK(glVertex2bOES)
+GLATTER_IBLOCK(glVertex2bvOES)
+GLATTER_IBLOCK(glVertex3bOES)
+GLATTER_IBLOCK(glVertex3bvOES)
+GLATTER_IBLOCK(glVertex4bOES)
+GLATTER_IBLOCK(glVertex4bvOES)
+#endif // defined(GL_OES_byte_coordinates)
+#if defined(GL_OES_fixed_point)
+GLATTER_IEXTENSION(GL_OES_fixed_point)
+GLATTER_IBLOCK(glAccumxOES)
+GLATTER_IBLOCK(glAlphaFuncxOES)
+GLATTER_IBLOCK(glBitmapxOES)
+GLATTER_IBLOCK(glBlendColorxOES)
+GLATTER_IBLOCK(glClearAccumxOES)
+GLATTER_IBLOCK(glClearColorxOES)
+GLATTER_IBLOCK(glClearDepthxOES)
+GLATTER_IBLOCK(glClipPlanexOES)
+GLATTER_IBLOCK(glColor3xOES)
+GLATTER_IBLOCK(glColor3xvOES)
+GLATTER_IBLOCK(glColor4xOES)
+GLATTER_IBLOCK(glColor4xvOES)
+GLATTER_IBLOCK(glConvolutionParameterxOES)
+GLATTER_IBLOCK(glConvolutionParameterxvOES)
+GLATTER_IBLOCK(glDepthRangexOES)
+GLATTER_IBLOCK(glEvalCoord1xOES)
+GLATTER_IBLOCK(glEvalCoord1xvOES)
+GLATTER_IBLOCK(glEvalCoord2xOES)
+GLATTER_IBLOCK(glEvalCoord2xvOES)
+GLATTER_IBLOCK(glFeedbackBufferxOES)
+GLATTER_IBLOCK(glFogxOES)
+GLATTER_IBLOCK(glFogxvOES)
+GLATTER_IBLOCK(glFrustumxOES)
+GLATTER_IBLOCK(glGetClipPlanexOES)
+GLATTER_IBLOCK(glGetConvolutionParameterxvOES)
+GLATTER_IBLOCK(glGetFixedvOES)
+GLATTER_IBLOCK(glGetHistogramParameterxvOES)
+GLATTER_IBLOCK(glGetLightxOES)
+GLATTER_IBLOCK(glGetMapxvOES)
+GLATTER_IBLOCK(glGetMaterialxOES)
+GLATTER_IBLOCK(glGetPixelMapxv)
+GLATTER_IBLOCK(glGetTexEnvxvOES)
+GLATTER_IBLOCK(glGetTexGenxvOES)
+GLATTER_IBLOCK(glGetTexLevelParameterxvOES)
+GLATTER_IBLOCK(glGetTexParameterxvOES)
+GLATTER_IBLOCK(glIndexxOES)
+GLATTER_IBLOCK(glIndexxvOES)
+GLATTER_IBLOCK(glLightModelxOES)
+GLATTER_IBLOCK(glLightModelxvOES)
+GLATTER_IBLOCK(glLightxOES)
+GLATTER_IBLOCK(glLightxvOES)
+GLATTER_IBLOCK(glLineWidthxOES)
+GLATTER_IBLOCK(glLoadMatrixxOES)
+GLATTER_IBLOCK(glLoadTransposeMatrixxOES)
+GLATTER_IBLOCK(glMap1xOES)
+GLATTER_IBLOCK(glMap2xOES)
+GLATTER_IBLOCK(glMapGrid1xOES)
+GLATTER_IBLOCK(glMapGrid2xOES)
+GLATTER_IBLOCK(glMaterialxOES)
+GLATTER_IBLOCK(glMaterialxvOES)
+GLATTER_IBLOCK(glMultMatrixxOES)
+GLATTER_IBLOCK(glMultTransposeMatrixxOES)
+GLATTER_IBLOCK(glMultiTexCoord1xOES)
+GLATTER_IBLOCK(glMultiTexCoord1xvOES)
+GLATTER_IBLOCK(glMultiTexCoord2xOES)
+GLATTER_IBLOCK(glMultiTexCoord2xvOES)
+GLATTER_IBLOCK(glMultiTexCoord3xOES)
+GLATTER_IBLOCK(glMultiTexCoord3xvOES)
+GLATTER_IBLOCK(glMultiTexCoord4xOES)
+GLATTER_IBLOCK(glMultiTexCoord4xvOES)
+GLATTER_IBLOCK(glNormal3xOES)
+GLATTER_IBLOCK(glNormal3xvOES)
+GLATTER_IBLOCK(glOrthoxOES)
+GLATTER_IBLOCK(glPassThroughxOES)
+GLATTER_IBLOCK(glPixelMapx)
+GLATTER_IBLOCK(glPixelStorex)
+GLATTER_IBLOCK(glPixelTransferxOES)
+GLATTER_IBLOCK(glPixelZoomxOES)
+GLATTER_IBLOCK(glPointParameterxvOES)
+GLATTER_IBLOCK(glPointSizexOES)
+GLATTER_IBLOCK(glPolygonOffsetxOES)
+GLATTER_IBLOCK(glPrioritizeTexturesxOES)
+GLATTER_IBLOCK(glRasterPos2xOES)
+GLATTER_IBLOCK(glRasterPos2xvOES)
+GLATTER_IBLOCK(glRasterPos3xOES)
+GLATTER_IBLOCK(glRasterPos3xvOES)
+GLATTER_IBLOCK(glRasterPos4xOES)
+GLATTER_IBLOCK(glRasterPos4xvOES)
+GLATTER_IBLOCK(glRectxOES)
+GLATTER_IBLOCK(glRectxvOES)
+GLATTER_IBLOCK(glRotatexOES)
+GLATTER_IBLOCK(glScalexOES)
+GLATTER_IBLOCK(glTexCoord1xOES)
+GLATTER_IBLOCK(glTexCoord1xvOES)
+GLATTER_IBLOCK(glTexCoord2xOES)
+GLATTER_IBLOCK(glTexCoord2xvOES)
+GLATTER_IBLOCK(glTexCoord3xOES)
+GLATTER_IBLOCK(glTexCoord3xvOES)
+GLATTER_IBLOCK(glTexCoord4xOES)
+GLATTER_IBLOCK(glTexCoord4xvOES)
+GLATTER_IBLOCK(glTexEnvxOES)
+GLATTER_IBLOCK(glTexEnvxvOES)
+GLATTER_IBLOCK(glTexGenxOES)
+GLATTER_IBLOCK(glTexGenxvOES)
+GLATTER_IBLOCK(glTexParameterxOES)
+GLATTER_IBLOCK(glTexParameterxvOES)
+GLATTER_IBLOCK(glTranslatexOES)
+GLATTER_IBLOCK(glVertex2xOES)
+GLATTER_IBLOCK(glVertex2xvOES)
+GLATTER_IBLOCK(glVertex3xOES)
+GLATTER_IBLOCK(glVertex3xvOES)
+GLATTER_IBLOCK(glVertex4xOES)
+GLATTER_IBLOCK(glVertex4xvOES)
+#endif // defined(GL_OES_fixed_point)
+#if defined(GL_OES_query_matrix)
+GLATTER_IEXTENSION(GL_OES_query_matrix)
+GLATTER_IBLOCK(glQueryMatrixxOES)
+#endif // defined(GL_OES_query_matrix)
+#if defined(GL_OES_single_precision)
+GLATTER_IEXTENSION(GL_OES_single_precision)
+GLATTER_IBLOCK(glClearDepthfOES)
+GLATTER_IBLOCK(glClipPlanefOES)
+GLATTER_IBLOCK(glDepthRangefOES)
+GLATTER_IBLOCK(glFrustumfOES)
+GLATTER_IBLOCK(glGetClipPlanefOES)
+GLATTER_IBLOCK(glOrthofOES)
+#endif // defined(GL_OES_single_precision)
+#if defined(GL_OVR_multiview)
+GLATTER_IEXTENSION(GL_OVR_multiview)
+GLATTER_IBLOCK(glFramebufferTextureMultiviewOVR)
+GLATTER_IBLOCK(glNamedFramebufferTextureMultiviewOVR)
+#endif // defined(GL_OVR_multiview)
+#if defined(GL_PGI_misc_hints)
+GLATTER_IEXTENSION(GL_PGI_misc_hints)
+GLATTER_IBLOCK(glHintPGI)
+#endif // defined(GL_PGI_misc_hints)
+#if defined(GL_SGIS_detail_texture)
+GLATTER_IEXTENSION(GL_SGIS_detail_texture)
+GLATTER_IBLOCK(glDetailTexFuncSGIS)
+GLATTER_IBLOCK(glGetDetailTexFuncSGIS)
+#endif // defined(GL_SGIS_detail_texture)
+#if defined(GL_SGIS_fog_function)
+GLATTER_IEXTENSION(GL_SGIS_fog_function)
+GLATTER_IBLOCK(glFogFuncSGIS)
+GLATTER_IBLOCK(glGetFogFuncSGIS)
+#endif // defined(GL_SGIS_fog_function)
+#if defined(GL_SGIS_multisample)
+GLATTER_IEXTENSION(GL_SGIS_multisample)
+GLATTER_IBLOCK(glSampleMaskSGIS)
+GLATTER_IBLOCK(glSamplePatternSGIS)
+#endif // defined(GL_SGIS_multisample)
+#if defined(GL_SGIS_pixel_texture)
+GLATTER_IEXTENSION(GL_SGIS_pixel_texture)
+GLATTER_IBLOCK(glGetPixelTexGenParameterfvSGIS)
+GLATTER_IBLOCK(glGetPixelTexGenParameterivSGIS)
+GLATTER_IBLOCK(glPixelTexGenParameterfSGIS)
+GLATTER_IBLOCK(glPixelTexGenParameterfvSGIS)
+GLATTER_IBLOCK(glPixelTexGenParameteriSGIS)
+GLATTER_IBLOCK(glPixelTexGenParameterivSGIS)
+#endif // defined(GL_SGIS_pixel_texture)
+#if defined(GL_SGIS_point_parameters)
+GLATTER_IEXTENSION(GL_SGIS_point_parameters)
+GLATTER_IBLOCK(glPointParameterfSGIS)
+GLATTER_IBLOCK(glPointParameterfvSGIS)
+#endif // defined(GL_SGIS_point_parameters)
+#if defined(GL_SGIS_sharpen_texture)
+GLATTER_IEXTENSION(GL_SGIS_sharpen_texture)
+GLATTER_IBLOCK(glGetSharpenTexFuncSGIS)
+GLATTER_IBLOCK(glSharpenTexFuncSGIS)
+#endif // defined(GL_SGIS_sharpen_texture)
+#if defined(GL_SGIS_texture4D)
+GLATTER_IEXTENSION(GL_SGIS_texture4D)
+GLATTER_IBLOCK(glTexImage4DSGIS)
+GLATTER_IBLOCK(glTexSubImage4DSGIS)
+#endif // defined(GL_SGIS_texture4D)
+#if defined(GL_SGIS_texture_color_mask)
+GLATTER_IEXTENSION(GL_SGIS_texture_color_mask)
+GLATTER_IBLOCK(glTextureColorMaskSGIS)
+#endif // defined(GL_SGIS_texture_color_mask)
+#if defined(GL_SGIS_texture_filter4)
+GLATTER_IEXTENSION(GL_SGIS_texture_filter4)
+GLATTER_IBLOCK(glGetTexFilterFuncSGIS)
+GLATTER_IBLOCK(glTexFilterFuncSGIS)
+#endif // defined(GL_SGIS_texture_filter4)
+#if defined(GL_SGIX_async)
+GLATTER_IEXTENSION(GL_SGIX_async)
+GLATTER_IBLOCK(glAsyncMarkerSGIX)
+GLATTER_IBLOCK(glDeleteAsyncMarkersSGIX)
+GLATTER_IBLOCK(glFinishAsyncSGIX)
+GLATTER_IBLOCK(glGenAsyncMarkersSGIX)
+GLATTER_IBLOCK(glIsAsyncMarkerSGIX)
+GLATTER_IBLOCK(glPollAsyncSGIX)
+#endif // defined(GL_SGIX_async)
+#if defined(GL_SGIX_flush_raster)
+GLATTER_IEXTENSION(GL_SGIX_flush_raster)
+GLATTER_IBLOCK(glFlushRasterSGIX)
+#endif // defined(GL_SGIX_flush_raster)
+#if defined(GL_SGIX_fragment_lighting)
+GLATTER_IEXTENSION(GL_SGIX_fragment_lighting)
+GLATTER_IBLOCK(glFragmentColorMaterialSGIX)
+GLATTER_IBLOCK(glFragmentLightModelfSGIX)
+GLATTER_IBLOCK(glFragmentLightModelfvSGIX)
+GLATTER_IBLOCK(glFragmentLightModeliSGIX)
+GLATTER_IBLOCK(glFragmentLightModelivSGIX)
+GLATTER_IBLOCK(glFragmentLightfSGIX)
+GLATTER_IBLOCK(glFragmentLightfvSGIX)
+GLATTER_IBLOCK(glFragmentLightiSGIX)
+GLATTER_IBLOCK(glFragmentLightivSGIX)
+GLATTER_IBLOCK(glFragmentMaterialfSGIX)
+GLATTER_IBLOCK(glFragmentMaterialfvSGIX)
+GLATTER_IBLOCK(glFragmentMaterialiSGIX)
+GLATTER_IBLOCK(glFragmentMaterialivSGIX)
+GLATTER_IBLOCK(glGetFragmentLightfvSGIX)
+GLATTER_IBLOCK(glGetFragmentLightivSGIX)
+GLATTER_IBLOCK(glGetFragmentMaterialfvSGIX)
+GLATTER_IBLOCK(glGetFragmentMaterialivSGIX)
+GLATTER_IBLOCK(glLightEnviSGIX)
+#endif // defined(GL_SGIX_fragment_lighting)
+#if defined(GL_SGIX_framezoom)
+GLATTER_IEXTENSION(GL_SGIX_framezoom)
+GLATTER_IBLOCK(glFrameZoomSGIX)
+#endif // defined(GL_SGIX_framezoom)
+#if defined(GL_SGIX_igloo_interface)
+GLATTER_IEXTENSION(GL_SGIX_igloo_interface)
+GLATTER_IBLOCK(glIglooInterfaceSGIX)
+#endif // defined(GL_SGIX_igloo_interface)
+#if defined(GL_SGIX_instruments)
+GLATTER_IEXTENSION(GL_SGIX_instruments)
+GLATTER_IBLOCK(glGetInstrumentsSGIX)
+GLATTER_IBLOCK(glInstrumentsBufferSGIX)
+GLATTER_IBLOCK(glPollInstrumentsSGIX)
+GLATTER_IBLOCK(glReadInstrumentsSGIX)
+GLATTER_IBLOCK(glStartInstrumentsSGIX)
+GLATTER_IBLOCK(glStopInstrumentsSGIX)
+#endif // defined(GL_SGIX_instruments)
+#if defined(GL_SGIX_list_priority)
+GLATTER_IEXTENSION(GL_SGIX_list_priority)
+GLATTER_IBLOCK(glGetListParameterfvSGIX)
+GLATTER_IBLOCK(glGetListParameterivSGIX)
+GLATTER_IBLOCK(glListParameterfSGIX)
+GLATTER_IBLOCK(glListParameterfvSGIX)
+GLATTER_IBLOCK(glListParameteriSGIX)
+GLATTER_IBLOCK(glListParameterivSGIX)
+#endif // defined(GL_SGIX_list_priority)
+#if defined(GL_SGIX_pixel_texture)
+GLATTER_IEXTENSION(GL_SGIX_pixel_texture)
+GLATTER_IBLOCK(glPixelTexGenSGIX)
+#endif // defined(GL_SGIX_pixel_texture)
+#if defined(GL_SGIX_polynomial_ffd)
+GLATTER_IEXTENSION(GL_SGIX_polynomial_ffd)
+GLATTER_IBLOCK(glDeformSGIX)
+GLATTER_IBLOCK(glDeformationMap3dSGIX)
+GLATTER_IBLOCK(glDeformationMap3fSGIX)
+GLATTER_IBLOCK(glLoadIdentityDeformationMapSGIX)
+#endif // defined(GL_SGIX_polynomial_ffd)
+#if defined(GL_SGIX_reference_plane)
+GLATTER_IEXTENSION(GL_SGIX_reference_plane)
+GLATTER_IBLOCK(glReferencePlaneSGIX)
+#endif // defined(GL_SGIX_reference_plane)
+#if defined(GL_SGIX_sprite)
+GLATTER_IEXTENSION(GL_SGIX_sprite)
+GLATTER_IBLOCK(glSpriteParameterfSGIX)
+GLATTER_IBLOCK(glSpriteParameterfvSGIX)
+GLATTER_IBLOCK(glSpriteParameteriSGIX)
+GLATTER_IBLOCK(glSpriteParameterivSGIX)
+#endif // defined(GL_SGIX_sprite)
+#if defined(GL_SGIX_tag_sample_buffer)
+GLATTER_IEXTENSION(GL_SGIX_tag_sample_buffer)
+GLATTER_IBLOCK(glTagSampleBufferSGIX)
+#endif // defined(GL_SGIX_tag_sample_buffer)
+#if defined(GL_SGI_color_table)
+GLATTER_IEXTENSION(GL_SGI_color_table)
+GLATTER_IBLOCK(glColorTableParameterfvSGI)
+GLATTER_IBLOCK(glColorTableParameterivSGI)
+GLATTER_IBLOCK(glColorTableSGI)
+GLATTER_IBLOCK(glCopyColorTableSGI)
+GLATTER_IBLOCK(glGetColorTableParameterfvSGI)
+GLATTER_IBLOCK(glGetColorTableParameterivSGI)
+GLATTER_IBLOCK(glGetColorTableSGI)
+#endif // defined(GL_SGI_color_table)
+#if defined(GL_SUNX_constant_data)
+GLATTER_IEXTENSION(GL_SUNX_constant_data)
+GLATTER_IBLOCK(glFinishTextureSUNX)
+#endif // defined(GL_SUNX_constant_data)
+#if defined(GL_SUN_global_alpha)
+GLATTER_IEXTENSION(GL_SUN_global_alpha)
+GLATTER_IBLOCK(glGlobalAlphaFactorbSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactordSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactorfSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactoriSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactorsSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactorubSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactoruiSUN)
+GLATTER_IBLOCK(glGlobalAlphaFactorusSUN)
+#endif // defined(GL_SUN_global_alpha)
+#if defined(GL_SUN_mesh_array)
+GLATTER_IEXTENSION(GL_SUN_mesh_array)
+GLATTER_IBLOCK(glDrawMeshArraysSUN)
+#endif // defined(GL_SUN_mesh_array)
+#if defined(GL_SUN_triangle_list)
+GLATTER_IEXTENSION(GL_SUN_triangle_list)
+GLATTER_IBLOCK(glReplacementCodePointerSUN)
+GLATTER_IBLOCK(glReplacementCodeubSUN)
+GLATTER_IBLOCK(glReplacementCodeubvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiSUN)
+GLATTER_IBLOCK(glReplacementCodeuivSUN)
+GLATTER_IBLOCK(glReplacementCodeusSUN)
+GLATTER_IBLOCK(glReplacementCodeusvSUN)
+#endif // defined(GL_SUN_triangle_list)
+#if defined(GL_SUN_vertex)
+GLATTER_IEXTENSION(GL_SUN_vertex)
+GLATTER_IBLOCK(glColor3fVertex3fSUN)
+GLATTER_IBLOCK(glColor3fVertex3fvSUN)
+GLATTER_IBLOCK(glColor4fNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glColor4fNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glColor4ubVertex2fSUN)
+GLATTER_IBLOCK(glColor4ubVertex2fvSUN)
+GLATTER_IBLOCK(glColor4ubVertex3fSUN)
+GLATTER_IBLOCK(glColor4ubVertex3fvSUN)
+GLATTER_IBLOCK(glNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiColor3fVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiColor3fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiColor4fNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiColor4fNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiColor4ubVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiColor4ubVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiTexCoord2fVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiTexCoord2fVertex3fvSUN)
+GLATTER_IBLOCK(glReplacementCodeuiVertex3fSUN)
+GLATTER_IBLOCK(glReplacementCodeuiVertex3fvSUN)
+GLATTER_IBLOCK(glTexCoord2fColor3fVertex3fSUN)
+GLATTER_IBLOCK(glTexCoord2fColor3fVertex3fvSUN)
+GLATTER_IBLOCK(glTexCoord2fColor4fNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glTexCoord2fColor4fNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glTexCoord2fColor4ubVertex3fSUN)
+GLATTER_IBLOCK(glTexCoord2fColor4ubVertex3fvSUN)
+GLATTER_IBLOCK(glTexCoord2fNormal3fVertex3fSUN)
+GLATTER_IBLOCK(glTexCoord2fNormal3fVertex3fvSUN)
+GLATTER_IBLOCK(glTexCoord2fVertex3fSUN)
+GLATTER_IBLOCK(glTexCoord2fVertex3fvSUN)
+GLATTER_IBLOCK(glTexCoord4fColor4fNormal3fVertex4fSUN)
+GLATTER_IBLOCK(glTexCoord4fColor4fNormal3fVertex4fvSUN)
+GLATTER_IBLOCK(glTexCoord4fVertex4fSUN)
+GLATTER_IBLOCK(glTexCoord4fVertex4fvSUN)
+#endif // defined(GL_SUN_vertex)
+#if defined(GL_VERSION_1_2)
+GLATTER_IVERSION(1, 2)
+GLATTER_IBLOCK(glCopyTexSubImage3D)
+GLATTER_IBLOCK(glDrawRangeElements)
+GLATTER_IBLOCK(glTexImage3D)
+GLATTER_IBLOCK(glTexSubImage3D)
+#endif // defined(GL_VERSION_1_2)
+#if defined(GL_VERSION_1_3)
+GLATTER_IVERSION(1, 3)
+GLATTER_IBLOCK(glActiveTexture)
+GLATTER_IBLOCK(glClientActiveTexture)
+GLATTER_IBLOCK(glCompressedTexImage1D)
+GLATTER_IBLOCK(glCompressedTexImage2D)
+GLATTER_IBLOCK(glCompressedTexImage3D)
+GLATTER_IBLOCK(glCompressedTexSubImage1D)
+GLATTER_IBLOCK(glCompressedTexSubImage2D)
+GLATTER_IBLOCK(glCompressedTexSubImage3D)
+GLATTER_IBLOCK(glGetCompressedTexImage)
+GLATTER_IBLOCK(glLoadTransposeMatrixd)
+GLATTER_IBLOCK(glLoadTransposeMatrixf)
+GLATTER_IBLOCK(glMultTransposeMatrixd)
+GLATTER_IBLOCK(glMultTransposeMatrixf)
+GLATTER_IBLOCK(glMultiTexCoord1d)
+GLATTER_IBLOCK(glMultiTexCoord1dv)
+GLATTER_IBLOCK(glMultiTexCoord1f)
+GLATTER_IBLOCK(glMultiTexCoord1fv)
+GLATTER_IBLOCK(glMultiTexCoord1i)
+GLATTER_IBLOCK(glMultiTexCoord1iv)
+GLATTER_IBLOCK(glMultiTexCoord1s)
+GLATTER_IBLOCK(glMultiTexCoord1sv)
+GLATTER_IBLOCK(glMultiTexCoord2d)
+GLATTER_IBLOCK(glMultiTexCoord2dv)
+GLATTER_IBLOCK(glMultiTexCoord2f)
+GLATTER_IBLOCK(glMultiTexCoord2fv)
+GLATTER_IBLOCK(glMultiTexCoord2i)
+GLATTER_IBLOCK(glMultiTexCoord2iv)
+GLATTER_IBLOCK(glMultiTexCoord2s)
+GLATTER_IBLOCK(glMultiTexCoord2sv)
+GLATTER_IBLOCK(glMultiTexCoord3d)
+GLATTER_IBLOCK(glMultiTexCoord3dv)
+GLATTER_IBLOCK(glMultiTexCoord3f)
+GLATTER_IBLOCK(glMultiTexCoord3fv)
+GLATTER_IBLOCK(glMultiTexCoord3i)
+GLATTER_IBLOCK(glMultiTexCoord3iv)
+GLATTER_IBLOCK(glMultiTexCoord3s)
+GLATTER_IBLOCK(glMultiTexCoord3sv)
+GLATTER_IBLOCK(glMultiTexCoord4d)
+GLATTER_IBLOCK(glMultiTexCoord4dv)
+GLATTER_IBLOCK(glMultiTexCoord4f)
+GLATTER_IBLOCK(glMultiTexCoord4fv)
+GLATTER_IBLOCK(glMultiTexCoord4i)
+GLATTER_IBLOCK(glMultiTexCoord4iv)
+GLATTER_IBLOCK(glMultiTexCoord4s)
+GLATTER_IBLOCK(glMultiTexCoord4sv)
+GLATTER_IBLOCK(glSampleCoverage)
+#endif // defined(GL_VERSION_1_3)
+#if defined(GL_VERSION_1_4)
+GLATTER_IVERSION(1, 4)
+GLATTER_IBLOCK(glBlendColor)
+GLATTER_IBLOCK(glBlendEquation)
+GLATTER_IBLOCK(glBlendFuncSeparate)
+GLATTER_IBLOCK(glFogCoordPointer)
+GLATTER_IBLOCK(glFogCoordd)
+GLATTER_IBLOCK(glFogCoorddv)
+GLATTER_IBLOCK(glFogCoordf)
+GLATTER_IBLOCK(glFogCoordfv)
+GLATTER_IBLOCK(glMultiDrawArrays)
+GLATTER_IBLOCK(glMultiDrawElements)
+GLATTER_IBLOCK(glPointParameterf)
+GLATTER_IBLOCK(glPointParameterfv)
+GLATTER_IBLOCK(glPointParameteri)
+GLATTER_IBLOCK(glPointParameteriv)
+GLATTER_IBLOCK(glSecondaryColor3b)
+GLATTER_IBLOCK(glSecondaryColor3bv)
+GLATTER_IBLOCK(glSecondaryColor3d)
+GLATTER_IBLOCK(glSecondaryColor3dv)
+GLATTER_IBLOCK(glSecondaryColor3f)
+GLATTER_IBLOCK(glSecondaryColor3fv)
+GLATTER_IBLOCK(glSecondaryColor3i)
+GLATTER_IBLOCK(glSecondaryColor3iv)
+GLATTER_IBLOCK(glSecondaryColor3s)
+GLATTER_IBLOCK(glSecondaryColor3sv)
+GLATTER_IBLOCK(glSecondaryColor3ub)
+GLATTER_IBLOCK(glSecondaryColor3ubv)
+GLATTER_IBLOCK(glSecondaryColor3ui)
+GLATTER_IBLOCK(glSecondaryColor3uiv)
+GLATTER_IBLOCK(glSecondaryColor3us)
+GLATTER_IBLOCK(glSecondaryColor3usv)
+GLATTER_IBLOCK(glSecondaryColorPointer)
+GLATTER_IBLOCK(glWindowPos2d)
+GLATTER_IBLOCK(glWindowPos2dv)
+GLATTER_IBLOCK(glWindowPos2f)
+GLATTER_IBLOCK(glWindowPos2fv)
+GLATTER_IBLOCK(glWindowPos2i)
+GLATTER_IBLOCK(glWindowPos2iv)
+GLATTER_IBLOCK(glWindowPos2s)
+GLATTER_IBLOCK(glWindowPos2sv)
+GLATTER_IBLOCK(glWindowPos3d)
+GLATTER_IBLOCK(glWindowPos3dv)
+GLATTER_IBLOCK(glWindowPos3f)
+GLATTER_IBLOCK(glWindowPos3fv)
+GLATTER_IBLOCK(glWindowPos3i)
+GLATTER_IBLOCK(glWindowPos3iv)
+GLATTER_IBLOCK(glWindowPos3s)
+GLATTER_IBLOCK(glWindowPos3sv)
+#endif // defined(GL_VERSION_1_4)
+#if defined(GL_VERSION_1_5)
+GLATTER_IVERSION(1, 5)
+GLATTER_IBLOCK(glBeginQuery)
+GLATTER_IBLOCK(glBindBuffer)
+GLATTER_IBLOCK(glBufferData)
+GLATTER_IBLOCK(glBufferSubData)
+GLATTER_IBLOCK(glDeleteBuffers)
+GLATTER_IBLOCK(glDeleteQueries)
+GLATTER_IBLOCK(glEndQuery)
+GLATTER_IBLOCK(glGenBuffers)
+GLATTER_IBLOCK(glGenQueries)
+GLATTER_IBLOCK(glGetBufferParameteriv)
+GLATTER_IBLOCK(glGetBufferPointerv)
+GLATTER_IBLOCK(glGetBufferSubData)
+GLATTER_IBLOCK(glGetQueryObjectiv)
+GLATTER_IBLOCK(glGetQueryObjectuiv)
+GLATTER_IBLOCK(glGetQueryiv)
+GLATTER_IBLOCK(glIsBuffer)
+GLATTER_IBLOCK(glIsQuery)
+GLATTER_IBLOCK(glMapBuffer)
+GLATTER_IBLOCK(glUnmapBuffer)
+#endif // defined(GL_VERSION_1_5)
+#if defined(GL_VERSION_2_0)
+GLATTER_IVERSION(2, 0)
+GLATTER_IBLOCK(glAttachShader)
+GLATTER_IBLOCK(glBindAttribLocation)
+GLATTER_IBLOCK(glBlendEquationSeparate)
+GLATTER_IBLOCK(glCompileShader)
+GLATTER_IBLOCK(glCreateProgram)
+GLATTER_IBLOCK(glCreateShader)
+GLATTER_IBLOCK(glDeleteProgram)
+GLATTER_IBLOCK(glDeleteShader)
+GLATTER_IBLOCK(glDetachShader)
+GLATTER_IBLOCK(glDisableVertexAttribArray)
+GLATTER_IBLOCK(glDrawBuffers)
+GLATTER_IBLOCK(glEnableVertexAttribArray)
+GLATTER_IBLOCK(glGetActiveAttrib)
+GLATTER_IBLOCK(glGetActiveUniform)
+GLATTER_IBLOCK(glGetAttachedShaders)
+GLATTER_IBLOCK(glGetAttribLocation)
+GLATTER_IBLOCK(glGetProgramInfoLog)
+GLATTER_IBLOCK(glGetProgramiv)
+GLATTER_IBLOCK(glGetShaderInfoLog)
+GLATTER_IBLOCK(glGetShaderSource)
+GLATTER_IBLOCK(glGetShaderiv)
+GLATTER_IBLOCK(glGetUniformLocation)
+GLATTER_IBLOCK(glGetUniformfv)
+GLATTER_IBLOCK(glGetUniformiv)
+GLATTER_IBLOCK(glGetVertexAttribPointerv)
+GLATTER_IBLOCK(glGetVertexAttribdv)
+GLATTER_IBLOCK(glGetVertexAttribfv)
+GLATTER_IBLOCK(glGetVertexAttribiv)
+GLATTER_IBLOCK(glIsProgram)
+GLATTER_IBLOCK(glIsShader)
+GLATTER_IBLOCK(glLinkProgram)
+GLATTER_IBLOCK(glShaderSource)
+GLATTER_IBLOCK(glStencilFuncSeparate)
+GLATTER_IBLOCK(glStencilMaskSeparate)
+GLATTER_IBLOCK(glStencilOpSeparate)
+GLATTER_IBLOCK(glUniform1f)
+GLATTER_IBLOCK(glUniform1fv)
+GLATTER_IBLOCK(glUniform1i)
+GLATTER_IBLOCK(glUniform1iv)
+GLATTER_IBLOCK(glUniform2f)
+GLATTER_IBLOCK(glUniform2fv)
+GLATTER_IBLOCK(glUniform2i)
+GLATTER_IBLOCK(glUniform2iv)
+GLATTER_IBLOCK(glUniform3f)
+GLATTER_IBLOCK(glUniform3fv)
+GLATTER_IBLOCK(glUniform3i)
+GLATTER_IBLOCK(glUniform3iv)
+GLATTER_IBLOCK(glUniform4f)
+GLATTER_IBLOCK(glUniform4fv)
+GLATTER_IBLOCK(glUniform4i)
+GLATTER_IBLOCK(glUniform4iv)
+GLATTER_IBLOCK(glUniformMatrix2fv)
+GLATTER_IBLOCK(glUniformMatrix3fv)
+GLATTER_IBLOCK(glUniformMatrix4fv)
+GLATTER_IBLOCK(glUseProgram)
+GLATTER_IBLOCK(glValidateProgram)
+GLATTER_IBLOCK(glVertexAttrib1d)
+GLATTER_IBLOCK(glVertexAttrib1dv)
+GLATTER_IBLOCK(glVertexAttrib1f)
+GLATTER_IBLOCK(glVertexAttrib1fv)
+GLATTER_IBLOCK(glVertexAttrib1s)
+GLATTER_IBLOCK(glVertexAttrib1sv)
+GLATTER_IBLOCK(glVertexAttrib2d)
+GLATTER_IBLOCK(glVertexAttrib2dv)
+GLATTER_IBLOCK(glVertexAttrib2f)
+GLATTER_IBLOCK(glVertexAttrib2fv)
+GLATTER_IBLOCK(glVertexAttrib2s)
+GLATTER_IBLOCK(glVertexAttrib2sv)
+GLATTER_IBLOCK(glVertexAttrib3d)
+GLATTER_IBLOCK(glVertexAttrib3dv)
+GLATTER_IBLOCK(glVertexAttrib3f)
+GLATTER_IBLOCK(glVertexAttrib3fv)
+GLATTER_IBLOCK(glVertexAttrib3s)
+GLATTER_IBLOCK(glVertexAttrib3sv)
+GLATTER_IBLOCK(glVertexAttrib4Nbv)
+GLATTER_IBLOCK(glVertexAttrib4Niv)
+GLATTER_IBLOCK(glVertexAttrib4Nsv)
+GLATTER_IBLOCK(glVertexAttrib4Nub)
+GLATTER_IBLOCK(glVertexAttrib4Nubv)
+GLATTER_IBLOCK(glVertexAttrib4Nuiv)
+GLATTER_IBLOCK(glVertexAttrib4Nusv)
+GLATTER_IBLOCK(glVertexAttrib4bv)
+GLATTER_IBLOCK(glVertexAttrib4d)
+GLATTER_IBLOCK(glVertexAttrib4dv)
+GLATTER_IBLOCK(glVertexAttrib4f)
+GLATTER_IBLOCK(glVertexAttrib4fv)
+GLATTER_IBLOCK(glVertexAttrib4iv)
+GLATTER_IBLOCK(glVertexAttrib4s)
+GLATTER_IBLOCK(glVertexAttrib4sv)
+GLATTER_IBLOCK(glVertexAttrib4ubv)
+GLATTER_IBLOCK(glVertexAttrib4uiv)
+GLATTER_IBLOCK(glVertexAttrib4usv)
+GLATTER_IBLOCK(glVertexAttribPointer)
+#endif // defined(GL_VERSION_2_0)
+#if defined(GL_VERSION_2_1)
+GLATTER_IVERSION(2, 1)
+GLATTER_IBLOCK(glUniformMatrix2x3fv)
+GLATTER_IBLOCK(glUniformMatrix2x4fv)
+GLATTER_IBLOCK(glUniformMatrix3x2fv)
+GLATTER_IBLOCK(glUniformMatrix3x4fv)
+GLATTER_IBLOCK(glUniformMatrix4x2fv)
+GLATTER_IBLOCK(glUniformMatrix4x3fv)
+#endif // defined(GL_VERSION_2_1)
+#if defined(GL_VERSION_3_0)
+GLATTER_IVERSION(3, 0)
+GLATTER_IBLOCK(glBeginConditionalRender)
+GLATTER_IBLOCK(glBeginTransformFeedback)
+GLATTER_IBLOCK(glBindBufferBase)
+GLATTER_IBLOCK(glBindBufferRange)
+GLATTER_IBLOCK(glBindFragDataLocation)
+GLATTER_IBLOCK(glBindFramebuffer)
+GLATTER_IBLOCK(glBindRenderbuffer)
+GLATTER_IBLOCK(glBindVertexArray)
+GLATTER_IBLOCK(glBlitFramebuffer)
+GLATTER_IBLOCK(glCheckFramebufferStatus)
+GLATTER_IBLOCK(glClampColor)
+GLATTER_IBLOCK(glClearBufferfi)
+GLATTER_IBLOCK(glClearBufferfv)
+GLATTER_IBLOCK(glClearBufferiv)
+GLATTER_IBLOCK(glClearBufferuiv)
+GLATTER_IBLOCK(glColorMaski)
+GLATTER_IBLOCK(glDeleteFramebuffers)
+GLATTER_IBLOCK(glDeleteRenderbuffers)
+GLATTER_IBLOCK(glDeleteVertexArrays)
+GLATTER_IBLOCK(glDisablei)
+GLATTER_IBLOCK(glEnablei)
+GLATTER_IBLOCK(glEndConditionalRender)
+GLATTER_IBLOCK(glEndTransformFeedback)
+GLATTER_IBLOCK(glFlushMappedBufferRange)
+GLATTER_IBLOCK(glFramebufferRenderbuffer)
+GLATTER_IBLOCK(glFramebufferTexture1D)
+GLATTER_IBLOCK(glFramebufferTexture2D)
+GLATTER_IBLOCK(glFramebufferTexture3D)
+GLATTER_IBLOCK(glFramebufferTextureLayer)
+GLATTER_IBLOCK(glGenFramebuffers)
+GLATTER_IBLOCK(glGenRenderbuffers)
+GLATTER_IBLOCK(glGenVertexArrays)
+GLATTER_IBLOCK(glGenerateMipmap)
+GLATTER_IBLOCK(glGetBooleani_v)
+GLATTER_IBLOCK(glGetFragDataLocation)
+GLATTER_IBLOCK(glGetFramebufferAttachmentParameteriv)
+GLATTER_IBLOCK(glGetIntegeri_v)
+GLATTER_IBLOCK(glGetRenderbufferParameteriv)
+GLATTER_IBLOCK(glGetStringi)
+GLATTER_IBLOCK(glGetTexParameterIiv)
+GLATTER_IBLOCK(glGetTexParameterIuiv)
+GLATTER_IBLOCK(glGetTransformFeedbackVarying)
+GLATTER_IBLOCK(glGetUniformuiv)
+GLATTER_IBLOCK(glGetVertexAttribIiv)
+GLATTER_IBLOCK(glGetVertexAttribIuiv)
+GLATTER_IBLOCK(glIsEnabledi)
+GLATTER_IBLOCK(glIsFramebuffer)
+GLATTER_IBLOCK(glIsRenderbuffer)
+GLATTER_IBLOCK(glIsVertexArray)
+GLATTER_IBLOCK(glMapBufferRange)
+GLATTER_IBLOCK(glRenderbufferStorage)
+GLATTER_IBLOCK(glRenderbufferStorageMultisample)
+GLATTER_IBLOCK(glTexParameterIiv)
+GLATTER_IBLOCK(glTexParameterIuiv)
+GLATTER_IBLOCK(glTransformFeedbackVaryings)
+GLATTER_IBLOCK(glUniform1ui)
+GLATTER_IBLOCK(glUniform1uiv)
+GLATTER_IBLOCK(glUniform2ui)
+GLATTER_IBLOCK(glUniform2uiv)
+GLATTER_IBLOCK(glUniform3ui)
+GLATTER_IBLOCK(glUniform3uiv)
+GLATTER_IBLOCK(glUniform4ui)
+GLATTER_IBLOCK(glUniform4uiv)
+GLATTER_IBLOCK(glVertexAttribI1i)
+GLATTER_IBLOCK(glVertexAttribI1iv)
+GLATTER_IBLOCK(glVertexAttribI1ui)
+GLATTER_IBLOCK(glVertexAttribI1uiv)
+GLATTER_IBLOCK(glVertexAttribI2i)
+GLATTER_IBLOCK(glVertexAttribI2iv)
+GLATTER_IBLOCK(glVertexAttribI2ui)
+GLATTER_IBLOCK(glVertexAttribI2uiv)
+GLATTER_IBLOCK(glVertexAttribI3i)
+GLATTER_IBLOCK(glVertexAttribI3iv)
+GLATTER_IBLOCK(glVertexAttribI3ui)
+GLATTER_IBLOCK(glVertexAttribI3uiv)
+GLATTER_IBLOCK(glVertexAttribI4bv)
+GLATTER_IBLOCK(glVertexAttribI4i)
+GLATTER_IBLOCK(glVertexAttribI4iv)
+GLATTER_IBLOCK(glVertexAttribI4sv)
+GLATTER_IBLOCK(glVertexAttribI4ubv)
+GLATTER_IBLOCK(glVertexAttribI4ui)
+GLATTER_IBLOCK(glVertexAttribI4uiv)
+GLATTER_IBLOCK(glVertexAttribI4usv)
+GLATTER_IBLOCK(glVertexAttribIPointer)
+#endif // defined(GL_VERSION_3_0)
+#if defined(GL_VERSION_3_1)
+GLATTER_IVERSION(3, 1)
+GLATTER_IBLOCK(glCopyBufferSubData)
+GLATTER_IBLOCK(glDrawArraysInstanced)
+GLATTER_IBLOCK(glDrawElementsInstanced)
+GLATTER_IBLOCK(glGetActiveUniformBlockName)
+GLATTER_IBLOCK(glGetActiveUniformBlockiv)
+GLATTER_IBLOCK(glGetActiveUniformName)
+GLATTER_IBLOCK(glGetActiveUniformsiv)
+GLATTER_IBLOCK(glGetUniformBlockIndex)
+GLATTER_IBLOCK(glGetUniformIndices)
+GLATTER_IBLOCK(glPrimitiveRestartIndex)
+GLATTER_IBLOCK(glTexBuffer)
+GLATTER_IBLOCK(glUniformBlockBinding)
+#endif // defined(GL_VERSION_3_1)
+#if defined(GL_VERSION_3_2)
+GLATTER_IVERSION(3, 2)
+GLATTER_IBLOCK(glClientWaitSync)
+GLATTER_IBLOCK(glDeleteSync)
+GLATTER_IBLOCK(glDrawElementsBaseVertex)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseVertex)
+GLATTER_IBLOCK(glDrawRangeElementsBaseVertex)
+GLATTER_IBLOCK(glFenceSync)
+GLATTER_IBLOCK(glFramebufferTexture)
+GLATTER_IBLOCK(glGetBufferParameteri64v)
+GLATTER_IBLOCK(glGetInteger64i_v)
+GLATTER_IBLOCK(glGetInteger64v)
+GLATTER_IBLOCK(glGetMultisamplefv)
+GLATTER_IBLOCK(glGetSynciv)
+GLATTER_IBLOCK(glIsSync)
+GLATTER_IBLOCK(glMultiDrawElementsBaseVertex)
+GLATTER_IBLOCK(glProvokingVertex)
+GLATTER_IBLOCK(glSampleMaski)
+GLATTER_IBLOCK(glTexImage2DMultisample)
+GLATTER_IBLOCK(glTexImage3DMultisample)
+GLATTER_IBLOCK(glWaitSync)
+#endif // defined(GL_VERSION_3_2)
+#if defined(GL_VERSION_3_3)
+GLATTER_IVERSION(3, 3)
+GLATTER_IBLOCK(glBindFragDataLocationIndexed)
+GLATTER_IBLOCK(glBindSampler)
+GLATTER_IBLOCK(glColorP3ui)
+GLATTER_IBLOCK(glColorP3uiv)
+GLATTER_IBLOCK(glColorP4ui)
+GLATTER_IBLOCK(glColorP4uiv)
+GLATTER_IBLOCK(glDeleteSamplers)
+GLATTER_IBLOCK(glGenSamplers)
+GLATTER_IBLOCK(glGetFragDataIndex)
+GLATTER_IBLOCK(glGetQueryObjecti64v)
+GLATTER_IBLOCK(glGetQueryObjectui64v)
+GLATTER_IBLOCK(glGetSamplerParameterIiv)
+GLATTER_IBLOCK(glGetSamplerParameterIuiv)
+GLATTER_IBLOCK(glGetSamplerParameterfv)
+GLATTER_IBLOCK(glGetSamplerParameteriv)
+GLATTER_IBLOCK(glIsSampler)
+GLATTER_IBLOCK(glMultiTexCoordP1ui)
+GLATTER_IBLOCK(glMultiTexCoordP1uiv)
+GLATTER_IBLOCK(glMultiTexCoordP2ui)
+GLATTER_IBLOCK(glMultiTexCoordP2uiv)
+GLATTER_IBLOCK(glMultiTexCoordP3ui)
+GLATTER_IBLOCK(glMultiTexCoordP3uiv)
+GLATTER_IBLOCK(glMultiTexCoordP4ui)
+GLATTER_IBLOCK(glMultiTexCoordP4uiv)
+GLATTER_IBLOCK(glNormalP3ui)
+GLATTER_IBLOCK(glNormalP3uiv)
+GLATTER_IBLOCK(glQueryCounter)
+GLATTER_IBLOCK(glSamplerParameterIiv)
+GLATTER_IBLOCK(glSamplerParameterIuiv)
+GLATTER_IBLOCK(glSamplerParameterf)
+GLATTER_IBLOCK(glSamplerParameterfv)
+GLATTER_IBLOCK(glSamplerParameteri)
+GLATTER_IBLOCK(glSamplerParameteriv)
+GLATTER_IBLOCK(glSecondaryColorP3ui)
+GLATTER_IBLOCK(glSecondaryColorP3uiv)
+GLATTER_IBLOCK(glTexCoordP1ui)
+GLATTER_IBLOCK(glTexCoordP1uiv)
+GLATTER_IBLOCK(glTexCoordP2ui)
+GLATTER_IBLOCK(glTexCoordP2uiv)
+GLATTER_IBLOCK(glTexCoordP3ui)
+GLATTER_IBLOCK(glTexCoordP3uiv)
+GLATTER_IBLOCK(glTexCoordP4ui)
+GLATTER_IBLOCK(glTexCoordP4uiv)
+GLATTER_IBLOCK(glVertexAttribDivisor)
+GLATTER_IBLOCK(glVertexAttribP1ui)
+GLATTER_IBLOCK(glVertexAttribP1uiv)
+GLATTER_IBLOCK(glVertexAttribP2ui)
+GLATTER_IBLOCK(glVertexAttribP2uiv)
+GLATTER_IBLOCK(glVertexAttribP3ui)
+GLATTER_IBLOCK(glVertexAttribP3uiv)
+GLATTER_IBLOCK(glVertexAttribP4ui)
+GLATTER_IBLOCK(glVertexAttribP4uiv)
+GLATTER_IBLOCK(glVertexP2ui)
+GLATTER_IBLOCK(glVertexP2uiv)
+GLATTER_IBLOCK(glVertexP3ui)
+GLATTER_IBLOCK(glVertexP3uiv)
+GLATTER_IBLOCK(glVertexP4ui)
+GLATTER_IBLOCK(glVertexP4uiv)
+#endif // defined(GL_VERSION_3_3)
+#if defined(GL_VERSION_4_0)
+GLATTER_IVERSION(4, 0)
+GLATTER_IBLOCK(glBeginQueryIndexed)
+GLATTER_IBLOCK(glBindTransformFeedback)
+GLATTER_IBLOCK(glBlendEquationSeparatei)
+GLATTER_IBLOCK(glBlendEquationi)
+GLATTER_IBLOCK(glBlendFuncSeparatei)
+GLATTER_IBLOCK(glBlendFunci)
+GLATTER_IBLOCK(glDeleteTransformFeedbacks)
+GLATTER_IBLOCK(glDrawArraysIndirect)
+GLATTER_IBLOCK(glDrawElementsIndirect)
+GLATTER_IBLOCK(glDrawTransformFeedback)
+GLATTER_IBLOCK(glDrawTransformFeedbackStream)
+GLATTER_IBLOCK(glEndQueryIndexed)
+GLATTER_IBLOCK(glGenTransformFeedbacks)
+GLATTER_IBLOCK(glGetActiveSubroutineName)
+GLATTER_IBLOCK(glGetActiveSubroutineUniformName)
+GLATTER_IBLOCK(glGetActiveSubroutineUniformiv)
+GLATTER_IBLOCK(glGetProgramStageiv)
+GLATTER_IBLOCK(glGetQueryIndexediv)
+GLATTER_IBLOCK(glGetSubroutineIndex)
+GLATTER_IBLOCK(glGetSubroutineUniformLocation)
+GLATTER_IBLOCK(glGetUniformSubroutineuiv)
+GLATTER_IBLOCK(glGetUniformdv)
+GLATTER_IBLOCK(glIsTransformFeedback)
+GLATTER_IBLOCK(glMinSampleShading)
+GLATTER_IBLOCK(glPatchParameterfv)
+GLATTER_IBLOCK(glPatchParameteri)
+GLATTER_IBLOCK(glPauseTransformFeedback)
+GLATTER_IBLOCK(glResumeTransformFeedback)
+GLATTER_IBLOCK(glUniform1d)
+GLATTER_IBLOCK(glUniform1dv)
+GLATTER_IBLOCK(glUniform2d)
+GLATTER_IBLOCK(glUniform2dv)
+GLATTER_IBLOCK(glUniform3d)
+GLATTER_IBLOCK(glUniform3dv)
+GLATTER_IBLOCK(glUniform4d)
+GLATTER_IBLOCK(glUniform4dv)
+GLATTER_IBLOCK(glUniformMatrix2dv)
+GLATTER_IBLOCK(glUniformMatrix2x3dv)
+GLATTER_IBLOCK(glUniformMatrix2x4dv)
+GLATTER_IBLOCK(glUniformMatrix3dv)
+GLATTER_IBLOCK(glUniformMatrix3x2dv)
+GLATTER_IBLOCK(glUniformMatrix3x4dv)
+GLATTER_IBLOCK(glUniformMatrix4dv)
+GLATTER_IBLOCK(glUniformMatrix4x2dv)
+GLATTER_IBLOCK(glUniformMatrix4x3dv)
+GLATTER_IBLOCK(glUniformSubroutinesuiv)
+#endif // defined(GL_VERSION_4_0)
+#if defined(GL_VERSION_4_1)
+GLATTER_IVERSION(4, 1)
+GLATTER_IBLOCK(glActiveShaderProgram)
+GLATTER_IBLOCK(glBindProgramPipeline)
+GLATTER_IBLOCK(glClearDepthf)
+GLATTER_IBLOCK(glCreateShaderProgramv)
+GLATTER_IBLOCK(glDeleteProgramPipelines)
+GLATTER_IBLOCK(glDepthRangeArrayv)
+GLATTER_IBLOCK(glDepthRangeIndexed)
+GLATTER_IBLOCK(glDepthRangef)
+GLATTER_IBLOCK(glGenProgramPipelines)
+GLATTER_IBLOCK(glGetDoublei_v)
+GLATTER_IBLOCK(glGetFloati_v)
+GLATTER_IBLOCK(glGetProgramBinary)
+GLATTER_IBLOCK(glGetProgramPipelineInfoLog)
+GLATTER_IBLOCK(glGetProgramPipelineiv)
+GLATTER_IBLOCK(glGetShaderPrecisionFormat)
+GLATTER_IBLOCK(glGetVertexAttribLdv)
+GLATTER_IBLOCK(glIsProgramPipeline)
+GLATTER_IBLOCK(glProgramBinary)
+GLATTER_IBLOCK(glProgramParameteri)
+GLATTER_IBLOCK(glProgramUniform1d)
+GLATTER_IBLOCK(glProgramUniform1dv)
+GLATTER_IBLOCK(glProgramUniform1f)
+GLATTER_IBLOCK(glProgramUniform1fv)
+GLATTER_IBLOCK(glProgramUniform1i)
+GLATTER_IBLOCK(glProgramUniform1iv)
+GLATTER_IBLOCK(glProgramUniform1ui)
+GLATTER_IBLOCK(glProgramUniform1uiv)
+GLATTER_IBLOCK(glProgramUniform2d)
+GLATTER_IBLOCK(glProgramUniform2dv)
+GLATTER_IBLOCK(glProgramUniform2f)
+GLATTER_IBLOCK(glProgramUniform2fv)
+GLATTER_IBLOCK(glProgramUniform2i)
+GLATTER_IBLOCK(glProgramUniform2iv)
+GLATTER_IBLOCK(glProgramUniform2ui)
+GLATTER_IBLOCK(glProgramUniform2uiv)
+GLATTER_IBLOCK(glProgramUniform3d)
+GLATTER_IBLOCK(glProgramUniform3dv)
+GLATTER_IBLOCK(glProgramUniform3f)
+GLATTER_IBLOCK(glProgramUniform3fv)
+GLATTER_IBLOCK(glProgramUniform3i)
+GLATTER_IBLOCK(glProgramUniform3iv)
+GLATTER_IBLOCK(glProgramUniform3ui)
+GLATTER_IBLOCK(glProgramUniform3uiv)
+GLATTER_IBLOCK(glProgramUniform4d)
+GLATTER_IBLOCK(glProgramUniform4dv)
+GLATTER_IBLOCK(glProgramUniform4f)
+GLATTER_IBLOCK(glProgramUniform4fv)
+GLATTER_IBLOCK(glProgramUniform4i)
+GLATTER_IBLOCK(glProgramUniform4iv)
+GLATTER_IBLOCK(glProgramUniform4ui)
+GLATTER_IBLOCK(glProgramUniform4uiv)
+GLATTER_IBLOCK(glProgramUniformMatrix2dv)
+GLATTER_IBLOCK(glProgramUniformMatrix2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3dv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x3fv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4dv)
+GLATTER_IBLOCK(glProgramUniformMatrix2x4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3dv)
+GLATTER_IBLOCK(glProgramUniformMatrix3fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2dv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4dv)
+GLATTER_IBLOCK(glProgramUniformMatrix3x4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4dv)
+GLATTER_IBLOCK(glProgramUniformMatrix4fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2dv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x2fv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3dv)
+GLATTER_IBLOCK(glProgramUniformMatrix4x3fv)
+GLATTER_IBLOCK(glReleaseShaderCompiler)
+GLATTER_IBLOCK(glScissorArrayv)
+GLATTER_IBLOCK(glScissorIndexed)
+GLATTER_IBLOCK(glScissorIndexedv)
+GLATTER_IBLOCK(glShaderBinary)
+GLATTER_IBLOCK(glUseProgramStages)
+GLATTER_IBLOCK(glValidateProgramPipeline)
+GLATTER_IBLOCK(glVertexAttribL1d)
+GLATTER_IBLOCK(glVertexAttribL1dv)
+GLATTER_IBLOCK(glVertexAttribL2d)
+GLATTER_IBLOCK(glVertexAttribL2dv)
+GLATTER_IBLOCK(glVertexAttribL3d)
+GLATTER_IBLOCK(glVertexAttribL3dv)
+GLATTER_IBLOCK(glVertexAttribL4d)
+GLATTER_IBLOCK(glVertexAttribL4dv)
+GLATTER_IBLOCK(glVertexAttribLPointer)
+GLATTER_IBLOCK(glViewportArrayv)
+GLATTER_IBLOCK(glViewportIndexedf)
+GLATTER_IBLOCK(glViewportIndexedfv)
+#endif // defined(GL_VERSION_4_1)
+#if defined(GL_VERSION_4_2)
+GLATTER_IVERSION(4, 2)
+GLATTER_IBLOCK(glBindImageTexture)
+GLATTER_IBLOCK(glDrawArraysInstancedBaseInstance)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseInstance)
+GLATTER_IBLOCK(glDrawElementsInstancedBaseVertexBaseInstance)
+GLATTER_IBLOCK(glDrawTransformFeedbackInstanced)
+GLATTER_IBLOCK(glDrawTransformFeedbackStreamInstanced)
+GLATTER_IBLOCK(glGetActiveAtomicCounterBufferiv)
+GLATTER_IBLOCK(glGetInternalformativ)
+GLATTER_IBLOCK(glMemoryBarrier)
+GLATTER_IBLOCK(glTexStorage1D)
+GLATTER_IBLOCK(glTexStorage2D)
+GLATTER_IBLOCK(glTexStorage3D)
+#endif // defined(GL_VERSION_4_2)
+#if defined(GL_VERSION_4_3)
+GLATTER_IVERSION(4, 3)
+GLATTER_IBLOCK(glBindVertexBuffer)
+GLATTER_IBLOCK(glClearBufferData)
+GLATTER_IBLOCK(glClearBufferSubData)
+GLATTER_IBLOCK(glCopyImageSubData)
+GLATTER_IBLOCK(glDebugMessageCallback)
+GLATTER_IBLOCK(glDebugMessageControl)
+GLATTER_IBLOCK(glDebugMessageInsert)
+GLATTER_IBLOCK(glDispatchCompute)
+GLATTER_IBLOCK(glDispatchComputeIndirect)
+GLATTER_IBLOCK(glFramebufferParameteri)
+GLATTER_IBLOCK(glGetDebugMessageLog)
+GLATTER_IBLOCK(glGetFramebufferParameteriv)
+GLATTER_IBLOCK(glGetInternalformati64v)
+GLATTER_IBLOCK(glGetObjectLabel)
+GLATTER_IBLOCK(glGetObjectPtrLabel)
+GLATTER_IBLOCK(glGetProgramInterfaceiv)
+GLATTER_IBLOCK(glGetProgramResourceIndex)
+GLATTER_IBLOCK(glGetProgramResourceLocation)
+GLATTER_IBLOCK(glGetProgramResourceLocationIndex)
+GLATTER_IBLOCK(glGetProgramResourceName)
+GLATTER_IBLOCK(glGetProgramResourceiv)
+GLATTER_IBLOCK(glInvalidateBufferData)
+GLATTER_IBLOCK(glInvalidateBufferSubData)
+GLATTER_IBLOCK(glInvalidateFramebuffer)
+GLATTER_IBLOCK(glInvalidateSubFramebuffer)
+GLATTER_IBLOCK(glInvalidateTexImage)
+GLATTER_IBLOCK(glInvalidateTexSubImage)
+GLATTER_IBLOCK(glMultiDrawArraysIndirect)
+GLATTER_IBLOCK(glMultiDrawElementsIndirect)
+GLATTER_IBLOCK(glObjectLabel)
+GLATTER_IBLOCK(glObjectPtrLabel)
+GLATTER_IBLOCK(glPopDebugGroup)
+GLATTER_IBLOCK(glPushDebugGroup)
+GLATTER_IBLOCK(glShaderStorageBlockBinding)
+GLATTER_IBLOCK(glTexBufferRange)
+GLATTER_IBLOCK(glTexStorage2DMultisample)
+GLATTER_IBLOCK(glTexStorage3DMultisample)
+GLATTER_IBLOCK(glTextureView)
+GLATTER_IBLOCK(glVertexAttribBinding)
+GLATTER_IBLOCK(glVertexAttribFormat)
+GLATTER_IBLOCK(glVertexAttribIFormat)
+GLATTER_IBLOCK(glVertexAttribLFormat)
+GLATTER_IBLOCK(glVertexBindingDivisor)
+#endif // defined(GL_VERSION_4_3)
+#if defined(GL_VERSION_4_4)
+GLATTER_IVERSION(4, 4)
+GLATTER_IBLOCK(glBindBuffersBase)
+GLATTER_IBLOCK(glBindBuffersRange)
+GLATTER_IBLOCK(glBindImageTextures)
+GLATTER_IBLOCK(glBindSamplers)
+GLATTER_IBLOCK(glBindTextures)
+GLATTER_IBLOCK(glBindVertexBuffers)
+GLATTER_IBLOCK(glBufferStorage)
+GLATTER_IBLOCK(glClearTexImage)
+GLATTER_IBLOCK(glClearTexSubImage)
+#endif // defined(GL_VERSION_4_4)
+#if defined(GL_VERSION_4_5)
+GLATTER_IVERSION(4, 5)
+GLATTER_IBLOCK(glBindTextureUnit)
+GLATTER_IBLOCK(glBlitNamedFramebuffer)
+GLATTER_IBLOCK(glCheckNamedFramebufferStatus)
+GLATTER_IBLOCK(glClearNamedBufferData)
+GLATTER_IBLOCK(glClearNamedBufferSubData)
+GLATTER_IBLOCK(glClearNamedFramebufferfi)
+GLATTER_IBLOCK(glClearNamedFramebufferfv)
+GLATTER_IBLOCK(glClearNamedFramebufferiv)
+GLATTER_IBLOCK(glClearNamedFramebufferuiv)
+GLATTER_IBLOCK(glClipControl)
+GLATTER_IBLOCK(glCompressedTextureSubImage1D)
+GLATTER_IBLOCK(glCompressedTextureSubImage2D)
+GLATTER_IBLOCK(glCompressedTextureSubImage3D)
+GLATTER_IBLOCK(glCopyNamedBufferSubData)
+GLATTER_IBLOCK(glCopyTextureSubImage1D)
+GLATTER_IBLOCK(glCopyTextureSubImage2D)
+GLATTER_IBLOCK(glCopyTextureSubImage3D)
+GLATTER_IBLOCK(glCreateBuffers)
+GLATTER_IBLOCK(glCreateFramebuffers)
+GLATTER_IBLOCK(glCreateProgramPipelines)
+GLATTER_IBLOCK(glCreateQueries)
+GLATTER_IBLOCK(glCreateRenderbuffers)
+GLATTER_IBLOCK(glCreateSamplers)
+GLATTER_IBLOCK(glCreateTextures)
+GLATTER_IBLOCK(glCreateTransformFeedbacks)
+GLATTER_IBLOCK(glCreateVertexArrays)
+GLATTER_IBLOCK(glDisableVertexArrayAttrib)
+GLATTER_IBLOCK(glEnableVertexArrayAttrib)
+GLATTER_IBLOCK(glFlushMappedNamedBufferRange)
+GLATTER_IBLOCK(glGenerateTextureMipmap)
+GLATTER_IBLOCK(glGetCompressedTextureImage)
+GLATTER_IBLOCK(glGetCompressedTextureSubImage)
+GLATTER_IBLOCK(glGetGraphicsResetStatus)
+GLATTER_IBLOCK(glGetNamedBufferParameteri64v)
+GLATTER_IBLOCK(glGetNamedBufferParameteriv)
+GLATTER_IBLOCK(glGetNamedBufferPointerv)
+GLATTER_IBLOCK(glGetNamedBufferSubData)
+GLATTER_IBLOCK(glGetNamedFramebufferAttachmentParameteriv)
+GLATTER_IBLOCK(glGetNamedFramebufferParameteriv)
+GLATTER_IBLOCK(glGetNamedRenderbufferParameteriv)
+GLATTER_IBLOCK(glGetQueryBufferObjecti64v)
+GLATTER_IBLOCK(glGetQueryBufferObjectiv)
+GLATTER_IBLOCK(glGetQueryBufferObjectui64v)
+GLATTER_IBLOCK(glGetQueryBufferObjectuiv)
+GLATTER_IBLOCK(glGetTextureImage)
+GLATTER_IBLOCK(glGetTextureLevelParameterfv)
+GLATTER_IBLOCK(glGetTextureLevelParameteriv)
+GLATTER_IBLOCK(glGetTextureParameterIiv)
+GLATTER_IBLOCK(glGetTextureParameterIuiv)
+GLATTER_IBLOCK(glGetTextureParameterfv)
+GLATTER_IBLOCK(glGetTextureParameteriv)
+GLATTER_IBLOCK(glGetTextureSubImage)
+GLATTER_IBLOCK(glGetTransformFeedbacki64_v)
+GLATTER_IBLOCK(glGetTransformFeedbacki_v)
+GLATTER_IBLOCK(glGetTransformFeedbackiv)
+GLATTER_IBLOCK(glGetVertexArrayIndexed64iv)
+GLATTER_IBLOCK(glGetVertexArrayIndexediv)
+GLATTER_IBLOCK(glGetVertexArrayiv)
+GLATTER_IBLOCK(glGetnColorTable)
+GLATTER_IBLOCK(glGetnCompressedTexImage)
+GLATTER_IBLOCK(glGetnConvolutionFilter)
+GLATTER_IBLOCK(glGetnHistogram)
+GLATTER_IBLOCK(glGetnMapdv)
+GLATTER_IBLOCK(glGetnMapfv)
+GLATTER_IBLOCK(glGetnMapiv)
+GLATTER_IBLOCK(glGetnMinmax)
+GLATTER_IBLOCK(glGetnPixelMapfv)
+GLATTER_IBLOCK(glGetnPixelMapuiv)
+GLATTER_IBLOCK(glGetnPixelMapusv)
+GLATTER_IBLOCK(glGetnPolygonStipple)
+GLATTER_IBLOCK(glGetnSeparableFilter)
+GLATTER_IBLOCK(glGetnTexImage)
+GLATTER_IBLOCK(glGetnUniformdv)
+GLATTER_IBLOCK(glGetnUniformfv)
+GLATTER_IBLOCK(glGetnUniformiv)
+GLATTER_IBLOCK(glGetnUniformuiv)
+GLATTER_IBLOCK(glInvalidateNamedFramebufferData)
+GLATTER_IBLOCK(glInvalidateNamedFramebufferSubData)
+GLATTER_IBLOCK(glMapNamedBuffer)
+GLATTER_IBLOCK(glMapNamedBufferRange)
+GLATTER_IBLOCK(glMemoryBarrierByRegion)
+GLATTER_IBLOCK(glNamedBufferData)
+GLATTER_IBLOCK(glNamedBufferStorage)
+GLATTER_IBLOCK(glNamedBufferSubData)
+GLATTER_IBLOCK(glNamedFramebufferDrawBuffer)
+GLATTER_IBLOCK(glNamedFramebufferDrawBuffers)
+GLATTER_IBLOCK(glNamedFramebufferParameteri)
+GLATTER_IBLOCK(glNamedFramebufferReadBuffer)
+GLATTER_IBLOCK(glNamedFramebufferRenderbuffer)
+GLATTER_IBLOCK(glNamedFramebufferTexture)
+GLATTER_IBLOCK(glNamedFramebufferTextureLayer)
+GLATTER_IBLOCK(glNamedRenderbufferStorage)
+GLATTER_IBLOCK(glNamedRenderbufferStorageMultisample)
+GLATTER_IBLOCK(glReadnPixels)
+GLATTER_IBLOCK(glTextureBarrier)
+GLATTER_IBLOCK(glTextureBuffer)
+GLATTER_IBLOCK(glTextureBufferRange)
+GLATTER_IBLOCK(glTextureParameterIiv)
+GLATTER_IBLOCK(glTextureParameterIuiv)
+GLATTER_IBLOCK(glTextureParameterf)
+GLATTER_IBLOCK(glTextureParameterfv)
+GLATTER_IBLOCK(glTextureParameteri)
+GLATTER_IBLOCK(glTextureParameteriv)
+GLATTER_IBLOCK(glTextureStorage1D)
+GLATTER_IBLOCK(glTextureStorage2D)
+GLATTER_IBLOCK(glTextureStorage2DMultisample)
+GLATTER_IBLOCK(glTextureStorage3D)
+GLATTER_IBLOCK(glTextureStorage3DMultisample)
+GLATTER_IBLOCK(glTextureSubImage1D)
+GLATTER_IBLOCK(glTextureSubImage2D)
+GLATTER_IBLOCK(glTextureSubImage3D)
+GLATTER_IBLOCK(glTransformFeedbackBufferBase)
+GLATTER_IBLOCK(glTransformFeedbackBufferRange)
+GLATTER_IBLOCK(glUnmapNamedBuffer)
+GLATTER_IBLOCK(glVertexArrayAttribBinding)
+GLATTER_IBLOCK(glVertexArrayAttribFormat)
+GLATTER_IBLOCK(glVertexArrayAttribIFormat)
+GLATTER_IBLOCK(glVertexArrayAttribLFormat)
+GLATTER_IBLOCK(glVertexArrayBindingDivisor)
+GLATTER_IBLOCK(glVertexArrayElementBuffer)
+GLATTER_IBLOCK(glVertexArrayVertexBuffer)
+GLATTER_IBLOCK(glVertexArrayVertexBuffers)
+#endif // defined(GL_VERSION_4_5)
+#if defined(GL_VERSION_4_6)
+GLATTER_IVERSION(4, 6)
+GLATTER_IBLOCK(glMultiDrawArraysIndirectCount)
+GLATTER_IBLOCK(glMultiDrawElementsIndirectCount)
+GLATTER_IBLOCK(glPolygonOffsetClamp)
+GLATTER_IBLOCK(glSpecializeShader)
+#endif // defined(__gl_glext_h_)
+#endif // defined(GL_VERSION_4_6)
+#endif // GLATTER_GL
+
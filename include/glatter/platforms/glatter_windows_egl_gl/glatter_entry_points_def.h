@@ -0,0 +1,4396 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Perfect hash of every entry point name known to this platform, used by
+ * glatter_get_proc_address to cache resolved addresses (see glatter_def.h).
+ * The arrays are not const so that they can be link-once in header-only mode,
+ * but nothing writes to them. */
+
+#define GLATTER_ENTRY_POINT_COUNT 3141
+#define GLATTER_ENTRY_POINT_SLOTS 4096
+#define GLATTER_ENTRY_POINT_BUCKETS 2048
+
+GLATTER_LINKONCE uint32_t glatter_entry_point_seeds[GLATTER_ENTRY_POINT_BUCKETS] = {
+    2, 0, 2, 0, 1, 6, 1, 1,
+    1, 0, 5, 2, 1, 0, 0, 1,
+    1, 2, 0, 3, 1, 3, 1, 0,
+    1, 3, 1, 1, 1, 5, 4, 2,
+    1, 0, 1, 2, 1, 1, 0, 0,
+    1, 2, 2, 4, 7, 0, 0, 2,
+    1, 3, 0, 1, 1, 0, 2, 4,
+    0, 2, 1, 2, 0, 1, 3, 0,
+    1, 2, 4, 5, 1, 2, 0, 5,
+    1, 6, 0, 0, 0, 3, 3, 0,
+    1, 10, 2, 0, 2, 1, 2, 0,
+    1, 2, 0, 1, 3, 1, 4, 0,
+    2, 0, 4, 1, 2, 0, 2, 0,
+    1, 1, 1, 0, 2, 5, 0, 1,
+    3, 1, 4, 1, 9, 2, 5, 2,
+    1, 0, 1, 6, 8, 0, 1, 1,
+    5, 0, 1, 1, 0, 5, 1, 1,
+    1, 1, 2, 6, 1, 1, 2, 4,
+    1, 5, 14, 6, 9, 0, 1, 2,
+    2, 2, 0, 3, 0, 1, 2, 0,
+    1, 3, 1, 1, 3, 4, 0, 4,
+    0, 0, 4, 0, 1, 1, 1, 2,
+    0, 3, 3, 1, 2, 0, 3, 0,
+    7, 2, 1, 6, 1, 5, 4, 0,
+    22, 4, 1, 1, 1, 1, 3, 3,
+    4, 1, 3, 1, 1, 1, 1, 1,
+    4, 3, 0, 1, 1, 4, 1, 0,
+    1, 3, 2, 9, 0, 1, 2, 1,
+    1, 1, 4, 1, 0, 1, 10, 0,
+    1, 2, 2, 1, 1, 3, 1, 2,
+    2, 1, 1, 2, 3, 1, 2, 0,
+    1, 0, 3, 6, 0, 1, 2, 1,
+    0, 4, 2, 0, 3, 3, 1, 4,
+    1, 5, 0, 5, 2, 0, 2, 2,
+    1, 0, 3, 3, 2, 3, 4, 5,
+    0, 1, 0, 0, 6, 1, 1, 1,
+    5, 0, 3, 2, 6, 0, 1, 1,
+    2, 0, 4, 0, 3, 1, 0, 4,
+    1, 2, 4, 2, 0, 4, 1, 17,
+    0, 11, 1, 2, 0, 2, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 3,
+    4, 3, 0, 1, 2, 1, 1, 1,
+    1, 0, 2, 3, 7, 5, 1, 1,
+    1, 1, 1, 3, 3, 10, 2, 3,
+    3, 1, 1, 2, 0, 2, 2, 0,
+    2, 1, 0, 1, 3, 0, 1, 0,
+    1, 1, 4, 5, 1, 0, 3, 0,
+    0, 4, 1, 0, 1, 5, 1, 1,
+    2, 3, 1, 0, 2, 0, 1, 1,
+    1, 2, 5, 1, 3, 4, 0, 0,
+    1, 0, 0, 2, 0, 1, 1, 7,
+    1, 1, 1, 4, 3, 1, 0, 1,
+    1, 4, 0, 6, 4, 2, 5, 0,
+    1, 2, 0, 8, 1, 0, 2, 4,
+    0, 3, 3, 1, 1, 2, 1, 1,
+    10, 2, 3, 2, 0, 1, 1, 4,
+    3, 0, 2, 1, 1, 8, 1, 1,
+    1, 1, 2, 1, 2, 1, 1, 0,
+    0, 0, 3, 5, 2, 2, 1, 1,
+    3, 1, 3, 0, 4, 1, 3, 0,
+    2, 2, 1, 1, 0, 1, 1, 4,
+    3, 1, 6, 2, 5, 1, 6, 1,
+    0, 3, 3, 2, 2, 1, 4, 2,
+    0, 1, 1, 1, 2, 0, 1, 3,
+    4, 5, 8, 1, 1, 1, 0, 0,
+    4, 4, 0, 3, 2, 2, 0, 2,
+    2, 1, 1, 2, 0, 2, 2, 1,
+    1, 4, 4, 3, 2, 0, 0, 4,
+    0, 1, 2, 2, 1, 1, 2, 2,
+    1, 0, 4, 3, 7, 1, 2, 2,
+    4, 2, 6, 1, 1, 0, 1, 1,
+    1, 2, 0, 1, 4, 2, 3, 3,
+    2, 4, 2, 2, 3, 2, 1, 1,
+    6, 2, 1, 2, 1, 13, 2, 0,
+    0, 3, 1, 2, 1, 1, 0, 0,
+    0, 3, 1, 10, 2, 0, 1, 3,
+    1, 2, 1, 8, 0, 1, 1, 3,
+    3, 1, 0, 3, 3, 4, 1, 4,
+    1, 2, 0, 8, 2, 1, 1, 2,
+    3, 5, 0, 1, 0, 7, 1, 1,
+    1, 0, 3, 1, 1, 1, 5, 0,
+    1, 4, 2, 1, 1, 7, 0, 0,
+    3, 3, 0, 0, 2, 0, 1, 0,
+    2, 3, 1, 0, 1, 1, 0, 3,
+    1, 1, 0, 1, 2, 0, 1, 0,
+    2, 8, 3, 0, 3, 7, 0, 4,
+    3, 2, 1, 1, 2, 0, 1, 1,
+    1, 2, 1, 3, 1, 0, 0, 1,
+    1, 1, 0, 2, 1, 5, 1, 4,
+    0, 1, 6, 4, 1, 1, 2, 1,
+    5, 3, 5, 3, 1, 0, 7, 3,
+    0, 1, 1, 3, 1, 1, 2, 3,
+    5, 2, 2, 4, 5, 4, 3, 3,
+    0, 0, 1, 2, 1, 2, 5, 1,
+    2, 8, 1, 0, 0, 1, 12, 4,
+    2, 7, 1, 2, 7, 1, 1, 0,
+    10, 4, 0, 3, 1, 2, 0, 1,
+    1, 0, 0, 0, 4, 3, 0, 5,
+    1, 0, 4, 1, 2, 3, 1, 1,
+    2, 1, 1, 0, 3, 1, 0, 2,
+    3, 2, 1, 0, 3, 4, 1, 6,
+    0, 2, 9, 1, 3, 1, 2, 4,
+    3, 1, 1, 6, 1, 4, 0, 1,
+    2, 1, 1, 0, 4, 5, 1, 1,
+    0, 3, 3, 1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 1, 0, 2,
+    1, 0, 3, 3, 0, 0, 3, 3,
+    0, 1, 0, 2, 0, 3, 1, 6,
+    3, 14, 0, 0, 2, 6, 0, 3,
+    1, 1, 1, 1, 2, 1, 1, 1,
+    6, 1, 1, 7, 0, 1, 3, 0,
+    3, 1, 2, 0, 2, 0, 3, 2,
+    9, 6, 1, 4, 3, 8, 1, 0,
+    0, 0, 0, 1, 0, 5, 0, 1,
+    2, 1, 4, 1, 1, 1, 1, 1,
+    2, 4, 3, 0, 5, 2, 0, 3,
+    1, 1, 3, 2, 1, 0, 1, 1,
+    0, 2, 1, 3, 2, 0, 0, 3,
+    0, 1, 3, 0, 1, 2, 11, 2,
+    3, 6, 3, 0, 2, 5, 2, 1,
+    3, 1, 2, 0, 2, 2, 2, 1,
+    0, 15, 8, 1, 0, 4, 0, 0,
+    1, 1, 2, 5, 1, 1, 4, 1,
+    1, 4, 0, 3, 4, 1, 2, 2,
+    4, 1, 3, 2, 0, 2, 1, 1,
+    9, 6, 3, 1, 11, 7, 1, 1,
+    2, 3, 4, 1, 4, 1, 9, 0,
+    2, 5, 6, 1, 3, 1, 0, 0,
+    4, 2, 1, 1, 1, 4, 0, 3,
+    1, 4, 2, 1, 0, 3, 7, 2,
+    2, 0, 0, 2, 1, 0, 1, 4,
+    0, 2, 0, 0, 2, 3, 1, 2,
+    5, 2, 1, 0, 3, 1, 0, 1,
+    2, 0, 1, 3, 2, 1, 1, 1,
+    2, 1, 4, 1, 1, 1, 1, 2,
+    3, 1, 1, 2, 0, 2, 0, 3,
+    0, 3, 1, 3, 0, 1, 0, 0,
+    1, 3, 2, 1, 2, 2, 1, 11,
+    1, 4, 4, 2, 1, 11, 4, 1,
+    2, 2, 8, 1, 11, 1, 0, 1,
+    10, 1, 2, 2, 3, 1, 3, 1,
+    1, 3, 2, 5, 0, 2, 2, 0,
+    2, 0, 0, 0, 0, 6, 1, 3,
+    1, 8, 1, 8, 3, 5, 2, 4,
+    1, 5, 1, 4, 0, 7, 2, 9,
+    1, 6, 0, 2, 5, 3, 1, 14,
+    2, 1, 0, 7, 1, 8, 2, 4,
+    13, 3, 1, 7, 3, 3, 6, 1,
+    6, 21, 3, 1, 4, 2, 13, 5,
+    0, 11, 6, 5, 2, 4, 1, 8,
+    3, 1, 1, 6, 1, 2, 3, 0,
+    1, 0, 0, 5, 1, 1, 3, 1,
+    4, 1, 1, 0, 4, 8, 3, 1,
+    4, 0, 1, 10, 7, 1, 7, 0,
+    1, 1, 6, 6, 2, 2, 0, 1,
+    2, 1, 2, 5, 0, 1, 10, 3,
+    1, 0, 5, 7, 1, 2, 0, 0,
+    12, 1, 3, 2, 0, 3, 2, 14,
+    2, 6, 0, 1, 0, 3, 3, 7,
+    1, 1, 2, 6, 3, 1, 2, 10,
+    1, 2, 5, 2, 1, 0, 0, 0,
+    8, 1, 2, 2, 1, 3, 0, 1,
+    2, 0, 5, 8, 3, 0, 1, 0,
+    8, 8, 4, 0, 0, 1, 11, 2,
+    2, 1, 1, 0, 1, 2, 1, 6,
+    6, 2, 2, 0, 1, 0, 1, 1,
+    2, 3, 1, 0, 1, 0, 2, 3,
+    2, 2, 2, 1, 4, 2, 3, 2,
+    1, 0, 1, 4, 1, 2, 1, 0,
+    1, 3, 1, 7, 3, 1, 0, 0,
+    3, 0, 0, 1, 0, 0, 1, 6,
+    1, 5, 3, 1, 2, 2, 3, 5,
+    0, 2, 1, 4, 3, 8, 2, 8,
+    3, 0, 1, 7, 2, 12, 3, 4,
+    2, 0, 2, 0, 0, 2, 0, 8,
+    3, 2, 0, 0, 6, 8, 5, 3,
+    1, 1, 1, 8, 3, 0, 10, 4,
+    10, 1, 1, 5, 11, 3, 3, 2,
+    0, 4, 6, 0, 0, 5, 2, 1,
+    1, 2, 4, 11, 1, 9, 7, 7,
+    4, 2, 10, 0, 3, 2, 1, 16,
+    0, 4, 0, 0, 1, 0, 5, 0,
+    4, 4, 3, 2, 0, 5, 6, 4,
+    4, 2, 1, 5, 3, 3, 1, 5,
+    4, 4, 0, 0, 1, 3, 10, 4,
+    2, 2, 3, 1, 2, 2, 0, 2,
+    1, 1, 1, 4, 1, 2, 0, 0,
+    1, 7, 0, 0, 0, 3, 14, 1,
+    1, 0, 0, 3, 7, 2, 3, 9,
+    9, 1, 3, 1, 4, 4, 2, 0,
+    3, 1, 1, 2, 2, 6, 7, 0,
+    3, 11, 2, 2, 0, 2, 6, 4,
+    2, 4, 1, 4, 6, 0, 4, 4,
+    0, 6, 2, 2, 1, 12, 7, 0,
+    10, 6, 2, 2, 1, 1, 2, 3,
+    1, 2, 3, 0, 1, 2, 1, 7,
+    1, 2, 0, 4, 3, 2, 1, 0,
+    0, 0, 3, 1, 2, 1, 12, 3,
+    1, 1, 4, 3, 7, 3, 2, 1,
+    0, 1, 4, 0, 1, 3, 2, 2,
+    1, 6, 1, 2, 7, 4, 4, 2,
+    1, 3, 13, 3, 0, 10, 3, 2,
+    7, 0, 1, 5, 2, 0, 2, 2,
+    15, 3, 2, 2, 0, 3, 1, 4,
+    3, 0, 3, 3, 6, 1, 2, 6,
+    0, 1, 7, 0, 0, 4, 5, 1,
+    0, 0, 0, 2, 3, 0, 15, 6,
+    6, 0, 4, 0, 1, 0, 4, 1,
+    0, 3, 2, 2, 0, 2, 1, 1,
+    1, 5, 9, 3, 4, 1, 1, 1,
+    0, 0, 0, 1, 2, 0, 1, 8,
+    1, 5, 9, 1, 6, 0, 1, 0,
+    1, 0, 0, 3, 3, 1, 4, 1,
+    0, 8, 7, 1, 2, 0, 2, 2,
+    6, 3, 0, 2, 7, 1, 1, 9,
+    3, 3, 1, 1, 5, 1, 8, 0,
+    1, 5, 1, 6, 1, 13, 2, 4,
+    4, 0, 4, 6, 0, 11, 5, 1,
+    7, 0, 0, 1, 0, 3, 1, 1,
+    0, 7, 1, 2, 0, 0, 2, 0,
+    6, 2, 3, 0, 6, 1, 0, 6,
+    2, 2, 17, 5, 2, 1, 1, 2,
+    0, 1, 2, 3, 2, 0, 1, 0,
+    0, 5, 1, 2, 3, 1, 3, 3,
+    3, 1, 5, 3, 0, 3, 0, 3,
+    2, 7, 0, 5, 2, 1, 0, 3,
+    1, 14, 9, 2, 2, 0, 5, 15,
+    6, 1, 0, 3, 1, 5, 0, 1,
+    1, 0, 2, 0, 9, 1, 5, 0,
+    4, 1, 2, 0, 1, 2, 2, 3,
+    4, 2, 2, 4, 7, 2, 1, 0,
+    4, 7, 5, 0, 8, 2, 1, 2,
+    3, 1, 0, 4, 3, 0, 1, 4,
+    0, 1, 7, 2, 2, 0, 1, 4,
+    2, 4, 0, 1, 1, 8, 4, 0,
+    1, 4, 1, 3, 2, 6, 3, 0,
+    3, 5, 13, 4, 6, 2, 1, 1,
+    0, 1, 0, 0, 0, 0, 0, 11,
+    1, 1, 1, 5, 2, 1, 1, 10,
+    5, 0, 4, 2, 9, 1, 1, 2,
+    6, 2, 1, 1, 1, 2, 0, 4,
+    1, 0, 2, 1, 1, 0, 0, 2,
+    3, 5, 6, 6, 2, 0, 4, 0,
+    0, 2, 3, 0, 0, 0, 2, 9,
+    1, 13, 0, 0, 12, 0, 0, 3,
+    2, 5, 0, 7, 3, 9, 6, 0,
+    0, 10, 0, 13, 0, 1, 2, 2,
+    0, 1, 4, 2, 0, 9, 2, 4,
+    3, 4, 1, 1, 1, 2, 0, 3,
+    3, 2, 1, 3, 0, 1, 0, 2,
+    1, 0, 0, 5, 3, 7, 10, 4,
+    2, 2, 6, 0, 6, 6, 1, 4,
+    4, 3, 0, 6, 5, 0, 1, 2,
+    1, 0, 4, 4, 11, 8, 0, 11,
+    6, 6, 0, 12, 4, 0, 2, 2,
+    0, 0, 5, 9, 5, 7, 5, 1,
+};
+
+GLATTER_LINKONCE const char* glatter_entry_point_names[GLATTER_ENTRY_POINT_SLOTS] = {
+    "glBindVertexBuffers",
+    "glDrawElementsInstanced",
+    NULL,
+    "glGetMinmaxParameteriv",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniform2i64vNV",
+    "glMultiTexSubImage2DEXT",
+    "glBindBuffer",
+    NULL,
+    "glEdgeFlagPointerListIBM",
+    "glUniform3ui64NV",
+    NULL,
+    "glBlendFuncIndexedAMD",
+    "glGetMultiTexParameterIuivEXT",
+    "glGetFloati_vEXT",
+    "glLineStipple",
+    NULL,
+    NULL,
+    "glSecondaryColor3uiEXT",
+    "glGenProgramsARB",
+    NULL,
+    NULL,
+    "eglQueryString",
+    "glGetFragmentLightfvSGIX",
+    "glVertexAttribP4ui",
+    "glColorPointerListIBM",
+    "glTextureMaterialEXT",
+    NULL,
+    "glUniform2ivARB",
+    "glDrawArraysInstancedEXT",
+    "glUniform4fARB",
+    "glPushAttrib",
+    NULL,
+    "eglCompositorSetContextListEXT",
+    "glProgramUniform4i64NV",
+    "glIndexPointer",
+    "glTexImage4DSGIS",
+    "glPolygonOffsetClampEXT",
+    "glTransformFeedbackBufferBase",
+    "glBindImageTextureEXT",
+    "glUniformMatrix4fv",
+    "glPopMatrix",
+    "glDrawBuffersATI",
+    NULL,
+    NULL,
+    "glViewportArrayv",
+    NULL,
+    "glDeletePerfMonitorsAMD",
+    "glTexBufferRange",
+    NULL,
+    "glBlendEquation",
+    "glEnableVertexArrayAttrib",
+    "glIndexPointerEXT",
+    NULL,
+    "glLGPUCopyImageSubDataNVX",
+    "glGetPathLengthNV",
+    "glTexCoord1hNV",
+    NULL,
+    "glReferencePlaneSGIX",
+    "glSecondaryColorP3uiv",
+    "glProgramUniform3ui64vARB",
+    "glGetTextureImage",
+    "glApplyFramebufferAttachmentCMAAINTEL",
+    NULL,
+    NULL,
+    "eglStreamAttribKHR",
+    NULL,
+    NULL,
+    "glWindowPos2fvMESA",
+    "glColorP3ui",
+    "eglSwapInterval",
+    "glFinalCombinerInputNV",
+    "glPixelTransferxOES",
+    "glGetConvolutionFilter",
+    "glVertexAttrib2sv",
+    "glGetIntegerui64vNV",
+    "glRasterPos4i",
+    "glGetVertexAttribArrayObjectfvATI",
+    "glNamedFramebufferParameteriEXT",
+    "glVDPAUSurfaceAccessNV",
+    "glBindParameterEXT",
+    "glGenerateMipmapEXT",
+    "glTexCoord1bOES",
+    "glPatchParameterfv",
+    NULL,
+    NULL,
+    "glGetPerfMonitorGroupStringAMD",
+    "glUniformMatrix3x2fv",
+    NULL,
+    "glPointParameteriv",
+    "glMakeTextureHandleResidentNV",
+    "eglDebugMessageControlKHR",
+    "glClearTexImage",
+    NULL,
+    "glMultTransposeMatrixfARB",
+    "glRasterPos4s",
+    "glColor4fNormal3fVertex3fSUN",
+    "glProgramUniform3iEXT",
+    "glTextureRangeAPPLE",
+    "glTexParameterxOES",
+    "eglCreateWindowSurface",
+    "glBinormal3ivEXT",
+    "glTranslated",
+    "glUniformMatrix2fv",
+    "eglQueryDisplayAttribKHR",
+    "glProgramUniform1fEXT",
+    "eglDestroySyncKHR",
+    NULL,
+    "glUniformMatrix2x4fv",
+    "glMultiTexCoord4iv",
+    "glStencilFillPathNV",
+    "glVertexAttrib4bv",
+    NULL,
+    "glPixelTransformParameterfEXT",
+    "eglBindAPI",
+    NULL,
+    "glInvalidateFramebuffer",
+    "glRasterPos2d",
+    "glUniformMatrix2x4dv",
+    "glCopyPixels",
+    "glDepthRangeArrayv",
+    "glProgramUniform3fEXT",
+    "glGetVideoCaptureivNV",
+    "glMultiDrawArraysIndirectBindlessNV",
+    "glListParameterfvSGIX",
+    NULL,
+    "glGetMultiTexEnvivEXT",
+    "glWindowPos2fARB",
+    "glBindBufferRangeNV",
+    "glUniform4ui64ARB",
+    "glBindFragDataLocationEXT",
+    "glDeleteTexturesEXT",
+    "glGetUniformuiv",
+    "glGenSemaphoresEXT",
+    "glVertexAttribI1uiv",
+    "glTexCoord4xOES",
+    "glSecondaryColor3svEXT",
+    "glEvalMapsNV",
+    "glTextureSubImage2D",
+    "glDepthFunc",
+    NULL,
+    "glVertexAttribL1dv",
+    "eglSignalSyncKHR",
+    "glClearDepthxOES",
+    "glStateCaptureNV",
+    "glLoadTransposeMatrixdARB",
+    NULL,
+    "glRectxvOES",
+    NULL,
+    "glTexCoord4fColor4fNormal3fVertex4fSUN",
+    "glNamedFramebufferDrawBuffers",
+    "glRasterPos4d",
+    "glUniform4ui64vARB",
+    "glTextureParameterIuiv",
+    "glMultiTexImage2DEXT",
+    "glTexBumpParameterivATI",
+    NULL,
+    "glUniform3i64NV",
+    NULL,
+    "glMultiTexEnvfEXT",
+    "eglClientWaitSync",
+    "glBeginPerfQueryINTEL",
+    "eglGetError",
+    "glVertexAttribP2ui",
+    "glMultiDrawElementsIndirect",
+    NULL,
+    NULL,
+    "glGetCompressedMultiTexImageEXT",
+    "glStencilThenCoverStrokePathInstancedNV",
+    "glGetInvariantBooleanvEXT",
+    "glBindTextureEXT",
+    "glClearAccum",
+    "glGetVertexArrayIntegervEXT",
+    "glGetImageHandleNV",
+    "glEndQueryARB",
+    "glGetObjectParameterivARB",
+    "glProgramLocalParameterI4uivNV",
+    "glNormalStream3dvATI",
+    NULL,
+    "glGetMultisamplefv",
+    "glBeginVideoCaptureNV",
+    "glVertexStream2iATI",
+    NULL,
+    "eglGetSystemTimeFrequencyNV",
+    "glVertexAttrib4d",
+    "glGetVertexAttribPointerv",
+    NULL,
+    "glFramebufferDrawBuffersEXT",
+    NULL,
+    "glVertexAttrib4sv",
+    "glBindVertexBuffer",
+    "glReplacementCodeusSUN",
+    "glGetActiveUniform",
+    "glBinormal3dEXT",
+    NULL,
+    NULL,
+    "glCopyTexSubImage3D",
+    NULL,
+    "glTextureParameterIuivEXT",
+    NULL,
+    "glTextureStorageMem2DEXT",
+    "glFlushMappedBufferRangeAPPLE",
+    "glVertexAttrib3dv",
+    NULL,
+    NULL,
+    "glVertexAttribL1dvEXT",
+    "glMulticastFramebufferSampleLocationsfvNV",
+    NULL,
+    "glGetVertexAttribdv",
+    "glFramebufferTextureFaceARB",
+    "glGenQueriesARB",
+    "glGlobalAlphaFactorsSUN",
+    "glProgramVertexLimitNV",
+    "glMultiTexGeniEXT",
+    "glOrthoxOES",
+    NULL,
+    "glMap2d",
+    "glMultiDrawElementsBaseVertex",
+    NULL,
+    "glEnableVertexArrayAttribEXT",
+    "glClearBufferData",
+    "glMultiDrawArrays",
+    "glGetAttachedShaders",
+    "glVertexArrayVertexBuffers",
+    NULL,
+    "eglWaitNative",
+    "glMultiTexCoord4i",
+    "glMultMatrixxOES",
+    "glFrustumxOES",
+    "glMultiTexCoord2dvARB",
+    "glLightModelf",
+    "glVertexAttrib1dNV",
+    "glSetInvariantEXT",
+    "glIsEnabledIndexedEXT",
+    "glDebugMessageControl",
+    "glDepthRangedNV",
+    "glIsList",
+    "glGetVaryingLocationNV",
+    "glTexCoord4dv",
+    "glGetSynciv",
+    "glConvolutionParameterfvEXT",
+    "glVertexAttribI4uiEXT",
+    "glSelectPerfMonitorCountersAMD",
+    NULL,
+    "glIsFramebuffer",
+    "glIsPathNV",
+    "glImportSemaphoreWin32HandleEXT",
+    "glTextureParameterfEXT",
+    NULL,
+    "glNamedProgramLocalParameter4fvEXT",
+    "glUniform3f",
+    NULL,
+    "glProgramUniform3fv",
+    "glGetTexLevelParameterfv",
+    "glFragmentLightfSGIX",
+    "glGetMultiTexLevelParameterfvEXT",
+    "glUnmapNamedBuffer",
+    "glGetVertexAttribfvARB",
+    "glGetnUniformi64vARB",
+    "glTexEnvfv",
+    "glGetProgramPipelineiv",
+    "glGenRenderbuffers",
+    "glGetNamedBufferPointerv",
+    "glColor4ubVertex3fvSUN",
+    NULL,
+    "glRasterPos4f",
+    "glGetProgramLocalParameterfvARB",
+    "glSecondaryColor3sv",
+    "glIsNameAMD",
+    "glClearNamedBufferData",
+    "glSpriteParameterfvSGIX",
+    "glSecondaryColor3uiv",
+    "glColorPointervINTEL",
+    NULL,
+    "glTessellationFactorAMD",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniform2ui64vARB",
+    "glMakeTextureHandleNonResidentNV",
+    "glTexStorage1DEXT",
+    "glGetProgramStageiv",
+    "glTextureSubImage2DEXT",
+    "glColorTableParameterfv",
+    "glGetGraphicsResetStatus",
+    "glDeformationMap3dSGIX",
+    "glFeedbackBuffer",
+    "glMultiTexCoord4svARB",
+    "glGetnPixelMapusvARB",
+    "glMultiTexCoord1sv",
+    NULL,
+    NULL,
+    "glSpriteParameterfSGIX",
+    "glVertexAttrib2fARB",
+    "glMultiDrawMeshTasksIndirectCountEXT",
+    "glClientWaitSync",
+    "glProgramUniform1uiv",
+    "glMultiDrawArraysIndirectCount",
+    NULL,
+    "glListParameterfSGIX",
+    "glMakeBufferResidentNV",
+    "glUniform4i",
+    "glWindowPos4fvMESA",
+    "glActiveTextureARB",
+    NULL,
+    "glIndexFuncEXT",
+    "glIsSync",
+    "glNamedProgramLocalParameterI4uiEXT",
+    NULL,
+    "glMakeBufferNonResidentNV",
+    NULL,
+    NULL,
+    "glAlphaFunc",
+    NULL,
+    "glVertexAttribL1dEXT",
+    "glGetNamedProgramLocalParameterfvEXT",
+    "glProgramUniformMatrix3x4dv",
+    "glWindowPos3i",
+    "eglQueryDevicesEXT",
+    "eglCreateStreamKHR",
+    NULL,
+    "glVertexAttribL1i64NV",
+    "glVertexAttrib4fARB",
+    NULL,
+    "glGetNextPerfQueryIdINTEL",
+    NULL,
+    "glNormal3sv",
+    "glGetUniformfv",
+    "glVertexArrayVertexAttribIFormatEXT",
+    "glFrontFace",
+    "glIsTransformFeedbackNV",
+    "glIndexiv",
+    NULL,
+    "glImportMemoryFdEXT",
+    "glTransformFeedbackStreamAttribsNV",
+    "glWeightsvARB",
+    "glBlitFramebufferEXT",
+    "eglSwapBuffersRegionNOK",
+    NULL,
+    "glTexCoord4d",
+    "glGetTexImage",
+    "glPathStencilDepthOffsetNV",
+    "glColorMask",
+    "glMultiTexCoord1bOES",
+    NULL,
+    "glClearNamedFramebufferuiv",
+    "glGetClipPlane",
+    "glLightModelxOES",
+    "glDispatchComputeGroupSizeARB",
+    "glProgramUniform1i64vARB",
+    "glGetProgramResourceLocation",
+    "eglGetCurrentSurface",
+    "eglCreateImageKHR",
+    "glProgramUniform4ivEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexArrayVertexAttribFormatEXT",
+    NULL,
+    NULL,
+    "glVertexAttribI2i",
+    NULL,
+    "glFragmentLightfvSGIX",
+    "glBindMultiTextureEXT",
+    "glMemoryObjectParameterivEXT",
+    NULL,
+    "glUniform1i",
+    "glGetTexParameterIuivEXT",
+    "glGetIntegerv",
+    "glColorTableEXT",
+    "glVertex4iv",
+    "glTexImage1D",
+    "glRasterPos2xOES",
+    "glGetColorTableParameteriv",
+    "glTexCoord2sv",
+    "glDeleteVertexArrays",
+    "glTestFenceNV",
+    "eglCreateSyncKHR",
+    "glBindFramebufferEXT",
+    "glMultiDrawElementsIndirectCount",
+    "glFogCoorddEXT",
+    "glGetSamplerParameterfv",
+    NULL,
+    "glMultiTexCoordPointerEXT",
+    "glProgramLocalParametersI4ivNV",
+    NULL,
+    NULL,
+    "glTexBufferARB",
+    "glColor4ub",
+    "glInvalidateBufferSubData",
+    "glVertexAttribI4uivEXT",
+    "glReplacementCodeuiNormal3fVertex3fSUN",
+    "glProgramUniform1fvEXT",
+    "glGetBooleani_v",
+    "glBeginQueryIndexed",
+    "glStringMarkerGREMEDY",
+    "glDrawArraysInstancedARB",
+    "glDeleteRenderbuffersEXT",
+    "glFrameTerminatorGREMEDY",
+    "glEndQuery",
+    "glGetActiveUniformARB",
+    "glMultiDrawElementsIndirectBindlessCountNV",
+    "glGenFragmentShadersATI",
+    "glTexImage3DMultisampleCoverageNV",
+    "glCheckFramebufferStatus",
+    "glVertexAttribL1ui64NV",
+    "glVertexAttrib4NubvARB",
+    "glGetProgramLocalParameterIivNV",
+    "glGetVertexArrayPointervEXT",
+    "glGetFinalCombinerInputParameterivNV",
+    "glWindowPos2iv",
+    "glMapGrid2xOES",
+    "glGetPointerv",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix4x3dv",
+    NULL,
+    "glProgramUniform3f",
+    NULL,
+    "glVertexAttrib4dNV",
+    "glPointParameterfvEXT",
+    "glDrawRangeElementArrayATI",
+    "glDrawTransformFeedback",
+    "glTextureStorageMem3DEXT",
+    "glVideoCaptureStreamParameterfvNV",
+    "glGetQueryBufferObjecti64v",
+    NULL,
+    "glGetInternalformati64v",
+    NULL,
+    NULL,
+    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+    "glVertexAttrib3hNV",
+    "glFlush",
+    "glGetIntegerIndexedvEXT",
+    "glGenPathsNV",
+    NULL,
+    "glVertexAttrib4hNV",
+    "glUniform4iv",
+    "glTextureStorageMem2DMultisampleEXT",
+    NULL,
+    "glIsImageHandleResidentARB",
+    NULL,
+    "glColor3xOES",
+    "glProgramUniformMatrix3dv",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix3x2dv",
+    "glVertexAttrib1fNV",
+    NULL,
+    "glGetUniformIndices",
+    "glCreatePerfQueryINTEL",
+    "glFogCoordf",
+    NULL,
+    NULL,
+    "glIsQueryARB",
+    NULL,
+    "glTexCoordP1ui",
+    "glMultiTexCoord2i",
+    "glVertex4dv",
+    "glFinishObjectAPPLE",
+    NULL,
+    "glVertexAttrib4fNV",
+    NULL,
+    NULL,
+    "glMultiTexCoord1d",
+    "glMultiTexCoord3dvARB",
+    "glSubpixelPrecisionBiasNV",
+    "glGetnCompressedTexImage",
+    NULL,
+    "glGetNamedProgramivEXT",
+    "glTexCoordFormatNV",
+    "glScissorArrayv",
+    NULL,
+    "eglReleaseThread",
+    "glEvalCoord1xOES",
+    "glShadingRateSampleOrderNV",
+    "glWindowPos4ivMESA",
+    "glEvalCoord1xvOES",
+    "glCompressedMultiTexImage2DEXT",
+    "glShaderStorageBlockBinding",
+    "glTexImage2DMultisampleCoverageNV",
+    "glMultiTexGendvEXT",
+    "glProgramUniformMatrix3x4dvEXT",
+    "glBeginQuery",
+    "glMultiTexCoord3i",
+    "glGetShadingRateSampleLocationivNV",
+    "glVertex4sv",
+    "glProgramLocalParameterI4ivNV",
+    "glFlushMappedNamedBufferRangeEXT",
+    "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+    NULL,
+    "glEvalPoint2",
+    NULL,
+    "glMultiTexCoord1fv",
+    "glConvolutionParameterfv",
+    "glVertexAttribI3uivEXT",
+    "glProgramPathFragmentInputGenNV",
+    "glSecondaryColor3ub",
+    NULL,
+    "eglQueryOutputPortStringEXT",
+    "glVertexAttribL2ui64vNV",
+    "glMultiDrawElementsIndirectCountARB",
+    "glGetProgramParameterfvNV",
+    "glStencilThenCoverFillPathNV",
+    "glProgramParameter4fvNV",
+    NULL,
+    "glUniform2dv",
+    "glNamedFramebufferReadBuffer",
+    NULL,
+    NULL,
+    NULL,
+    "glBlendEquationi",
+    NULL,
+    "glMultiTexCoord3hvNV",
+    "glCopyTextureImage1DEXT",
+    "glMultiTexCoord4xOES",
+    "glGetBufferParameteri64v",
+    "glDispatchComputeIndirect",
+    "glUniform1ui64vARB",
+    "glBitmap",
+    NULL,
+    "glColor4ubVertex2fvSUN",
+    "glVertexStream3svATI",
+    "glDrawArraysIndirect",
+    "glTexCoord2bOES",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glMapObjectBufferATI",
+    "glBeginTransformFeedbackEXT",
+    NULL,
+    "glUniform1i64vARB",
+    "glMultiTexCoordP2uiv",
+    "glVertexAttrib4ubvNV",
+    "glInvalidateBufferData",
+    NULL,
+    "glTexCoord4hNV",
+    "glGetVertexAttribfvNV",
+    "glReplacementCodeuiNormal3fVertex3fvSUN",
+    NULL,
+    "glMakeNamedBufferNonResidentNV",
+    NULL,
+    NULL,
+    "glRasterPos3sv",
+    "glGetProgramParameterdvNV",
+    "glReadPixels",
+    NULL,
+    "glReleaseShaderCompiler",
+    "glCompressedTextureSubImage2D",
+    "glWindowPos2fv",
+    "glTexParameterIuiv",
+    "glMatrixPopEXT",
+    NULL,
+    "glVertexStream4sATI",
+    "glVertexAttrib4Nubv",
+    "glMultiTexCoordP4ui",
+    "glVertexAttrib4uiv",
+    "glWeightusvARB",
+    "glGetVariantArrayObjectfvATI",
+    "glTexGenxOES",
+    NULL,
+    "glMultiTexBufferEXT",
+    "glStencilOpSeparateATI",
+    "glRasterPos3xOES",
+    "glVariantusvEXT",
+    "glVertexAttrib2sNV",
+    "eglDestroySurface",
+    "glRasterSamplesEXT",
+    "glDeleteQueryResourceTagNV",
+    "glSharpenTexFuncSGIS",
+    "glBindVertexArray",
+    NULL,
+    "glUniform3uiv",
+    "glUniformMatrix3x2dv",
+    "glProgramUniform1ui64vNV",
+    "glMatrixMultdEXT",
+    "glTexCoord3s",
+    "glAsyncCopyImageSubDataNVX",
+    "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+    NULL,
+    "glEdgeFlagPointer",
+    "glBeginConditionalRenderNV",
+    "glDisableIndexedEXT",
+    "glDrawElementsIndirect",
+    "glVertexStream1sATI",
+    NULL,
+    "glColor4xvOES",
+    "glClipPlanefOES",
+    NULL,
+    "glRasterPos2xvOES",
+    "glUniformui64vNV",
+    "glBinormal3fvEXT",
+    "glTexSubImage1D",
+    NULL,
+    "glRenderbufferStorageEXT",
+    "glWindowPos2dvARB",
+    "glVertexArrayVertexBuffer",
+    "glVertexAttrib2svARB",
+    "eglReleaseTexImage",
+    "glDisableClientStateIndexedEXT",
+    "glBindBuffersRange",
+    "glCopyColorTableSGI",
+    "glNormal3f",
+    "glFragmentLightModelivSGIX",
+    "glUniform2uiEXT",
+    NULL,
+    NULL,
+    "glTexCoord4s",
+    "glTransformFeedbackVaryingsEXT",
+    "glCoverFillPathInstancedNV",
+    "glInterleavedArrays",
+    "glGenLists",
+    "glColorFormatNV",
+    "glGetNamedBufferSubDataEXT",
+    "glVariantsvEXT",
+    "glFragmentLightModeliSGIX",
+    "glTexCoord3bvOES",
+    "glCopyBufferSubData",
+    "glAccum",
+    "glVertexP2ui",
+    "glGetTextureSubImage",
+    "glVertexAttribI1ui",
+    "glTextureStorageSparseAMD",
+    "glUniformMatrix3x4dv",
+    "glGetUnsignedBytei_vEXT",
+    "glProgramUniformHandleui64vARB",
+    "glProgramParameters4dvNV",
+    "glGetNamedRenderbufferParameteriv",
+    "glLoadMatrixd",
+    NULL,
+    NULL,
+    "glGetVertexArrayIndexed64iv",
+    "glTextureSubImage3DEXT",
+    NULL,
+    "glBlendFuncSeparateEXT",
+    "glTexParameterfv",
+    "glGenProgramPipelines",
+    NULL,
+    "glActiveStencilFaceEXT",
+    "glSecondaryColorPointerListIBM",
+    NULL,
+    "glMultiTexCoord2xOES",
+    "glRectiv",
+    "glRequestResidentProgramsNV",
+    "glGetUniformivARB",
+    "glBinormal3svEXT",
+    "glEvalCoord1fv",
+    "glCompressedMultiTexSubImage2DEXT",
+    NULL,
+    "glCompressedMultiTexSubImage3DEXT",
+    NULL,
+    "glRasterPos2i",
+    NULL,
+    "glGetCoverageModulationTableNV",
+    NULL,
+    NULL,
+    "eglGetProcAddress",
+    "glSpecializeShaderARB",
+    "glVertexAttribs4hvNV",
+    NULL,
+    "glMultiTexCoord4dv",
+    "glGenerateTextureMipmapEXT",
+    "glBlendEquationiARB",
+    "glVertexAttribL3dvEXT",
+    "glVertexAttrib1sARB",
+    "glVertex2xvOES",
+    "glVertex4hvNV",
+    "glDepthBoundsEXT",
+    "glDeleteNamedStringARB",
+    "glUniform2fvARB",
+    "glNamedFramebufferSampleLocationsfvARB",
+    "glCopyConvolutionFilter1D",
+    "glVertexAttribI4uiv",
+    "glTextureStorage2DEXT",
+    NULL,
+    "glVertexAttrib4Nsv",
+    "glUniform1iARB",
+    "glEndPerfQueryINTEL",
+    "glSamplerParameteriv",
+    "glVertexAttribI4ubvEXT",
+    "glGetFramebufferParameterivMESA",
+    "glRectxOES",
+    "glWindowPos2svARB",
+    "glConvolutionFilter1D",
+    "glVertexStream1ivATI",
+    "glBlendEquationSeparatei",
+    NULL,
+    "glTexCoordPointer",
+    "glVertexAttribs4ubvNV",
+    "glTextureBarrierNV",
+    "glGetInteger64v",
+    "eglStreamFlushNV",
+    "glCompressedTexSubImage2DARB",
+    "glCreateRenderbuffers",
+    "glVertexAttrib3dNV",
+    "glEvalCoord2f",
+    NULL,
+    NULL,
+    "glFogfv",
+    "glGetProgramiv",
+    NULL,
+    NULL,
+    "glGetBooleanv",
+    "glGetnUniformui64vARB",
+    "glProgramLocalParametersI4uivNV",
+    "glGenerateMultiTexMipmapEXT",
+    "glUniformHandleui64vNV",
+    "glProgramUniform4i64ARB",
+    "glVertexStream2fvATI",
+    "glClearColorxOES",
+    "glUniformMatrix2dv",
+    NULL,
+    "glTexCoord3f",
+    "glTexStorage3DMultisample",
+    "glImageTransformParameteriHP",
+    "glVertex2sv",
+    "glGetTextureParameterfv",
+    NULL,
+    "glLightModelfv",
+    NULL,
+    "glSecondaryColor3f",
+    NULL,
+    "eglUnbindWaylandDisplayWL",
+    NULL,
+    NULL,
+    "glPixelTransformParameterivEXT",
+    NULL,
+    "glGetNamedBufferParameterivEXT",
+    "glProgramUniform3uiEXT",
+    "glUniform1d",
+    "glVertexAttribs2fvNV",
+    NULL,
+    "glVertexAttrib4s",
+    "glMatrixMultTranspose3x3fNV",
+    "glDetachObjectARB",
+    "glVertexStream1dATI",
+    "glDisableVertexArrayAttrib",
+    "glTexCoord1xvOES",
+    "glVertexWeightfEXT",
+    "glVertexP3uiv",
+    "glGetStageIndexNV",
+    "glIndexdv",
+    NULL,
+    NULL,
+    "glFragmentColorMaterialSGIX",
+    "glIsTextureHandleResidentARB",
+    "glNamedBufferStorageExternalEXT",
+    NULL,
+    "glGetObjectParameterivAPPLE",
+    "glProgramUniformHandleui64ARB",
+    "glTexEnviv",
+    "glSecondaryColor3usvEXT",
+    "glGetVertexAttribArrayObjectivATI",
+    NULL,
+    "glGetNamedStringARB",
+    NULL,
+    NULL,
+    "glBeginFragmentShaderATI",
+    NULL,
+    "glMaxShaderCompilerThreadsKHR",
+    "glGetTexParameterxvOES",
+    "eglCreatePbufferSurface",
+    "glTexCoord4fVertex4fSUN",
+    "glSecondaryColor3usEXT",
+    "glScaled",
+    "glVertexAttrib2hvNV",
+    "glMulticastCopyImageSubDataNV",
+    "glRasterPos4xvOES",
+    "glWindowPos4sMESA",
+    "glMultiTexGenfEXT",
+    NULL,
+    "glFlushVertexArrayRangeAPPLE",
+    "glGetTransformFeedbackVarying",
+    NULL,
+    "glGenProgramsNV",
+    "glGetVertexAttribivNV",
+    "glMultiDrawRangeElementArrayAPPLE",
+    "glGenBuffersARB",
+    "glVertexAttribPointerARB",
+    "glCreateTransformFeedbacks",
+    "glMultiTexCoord1xvOES",
+    NULL,
+    "glGetNamedFramebufferAttachmentParameterivEXT",
+    "glBlitFramebufferLayersEXT",
+    NULL,
+    "glGetHistogramParameterfv",
+    "glPixelMapfv",
+    NULL,
+    "glVideoCaptureStreamParameterdvNV",
+    "glUniform4dv",
+    "glMulticastGetQueryObjectuivNV",
+    "glCreateMemoryObjectsEXT",
+    "glIsObjectBufferATI",
+    "glFogCoorddv",
+    "glPopAttrib",
+    "glBindTextures",
+    "glVertexAttribI2iv",
+    "glReplacementCodeuiVertex3fSUN",
+    NULL,
+    "glGetUniformi64vNV",
+    NULL,
+    NULL,
+    "glGetTextureHandleARB",
+    "glGetMapfv",
+    "glGetProgramEnvParameterdvARB",
+    "glNamedProgramLocalParametersI4ivEXT",
+    "glMinmax",
+    "glVertexAttribL1i64vNV",
+    "glDispatchCompute",
+    "glWindowPos3fvMESA",
+    "eglLabelObjectKHR",
+    "glGetShadingRateImagePaletteNV",
+    NULL,
+    "glMapNamedBuffer",
+    "glSecondaryColor3iEXT",
+    "glIndexFormatNV",
+    "glGetSamplerParameteriv",
+    "glReplacementCodeuiColor3fVertex3fvSUN",
+    NULL,
+    "glMultiTexCoord3bOES",
+    "glVertexAttrib4NbvARB",
+    NULL,
+    NULL,
+    NULL,
+    "glMultiTexCoordP2ui",
+    NULL,
+    "glVertex3s",
+    "eglGetSyncAttribKHR",
+    "glVertexAttribI4iEXT",
+    "glNamedProgramLocalParameterI4ivEXT",
+    NULL,
+    "glGetOcclusionQueryivNV",
+    NULL,
+    "glGetAttribLocationARB",
+    NULL,
+    "glRenderbufferStorage",
+    "glBindFragmentShaderATI",
+    "glUniform3d",
+    "glMultiTexCoord4bvOES",
+    "glMultiTexCoord2s",
+    "glMultiTexCoord2dv",
+    "glProgramLocalParameterI4uiNV",
+    "glUnmapBuffer",
+    "glProgramUniform3ui64NV",
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glBlitFramebuffer",
+    "glProgramParameteriARB",
+    "glGetPixelMapxv",
+    "glDeleteProgramsNV",
+    NULL,
+    "glWindowPos2sMESA",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glViewportSwizzleNV",
+    NULL,
+    "glMultiTexCoord1dARB",
+    NULL,
+    "glBlendFunciARB",
+    "glVertexArraySecondaryColorOffsetEXT",
+    "glGetTransformFeedbackiv",
+    "glIsRenderbufferEXT",
+    "glWindowPos3dvMESA",
+    "glIndexi",
+    NULL,
+    "glPrimitiveRestartIndex",
+    "glUseProgramStages",
+    NULL,
+    "glVertexStream2ivATI",
+    "glDepthMask",
+    "glAreTexturesResidentEXT",
+    "glSamplerParameterf",
+    "glSemaphoreParameterivNV",
+    "glDeleteMemoryObjectsEXT",
+    "glGetHistogramParameterfvEXT",
+    "glGetInteger64i_v",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+    "glMultiTexCoord3dARB",
+    "glVertex2f",
+    "glNamedFramebufferTexture2DEXT",
+    "glTexCoord4sv",
+    "glMultiDrawArraysIndirectBindlessCountNV",
+    "glClearStencil",
+    "glMatrixPushEXT",
+    "glUniformMatrix3x4fv",
+    NULL,
+    NULL,
+    NULL,
+    "eglQueryStreamTimeKHR",
+    "glNamedRenderbufferStorageEXT",
+    "glVertexAttrib4sARB",
+    NULL,
+    "glProgramUniform2uiv",
+    NULL,
+    "glTexCoord2xvOES",
+    "glVertexStream3iATI",
+    "glProgramUniformMatrix4dvEXT",
+    "glRasterPos3xvOES",
+    "glRasterPos2f",
+    "eglGetCurrentDisplay",
+    NULL,
+    "glWeightbvARB",
+    NULL,
+    NULL,
+    "glBeginPerfMonitorAMD",
+    NULL,
+    "eglCompositorSetWindowAttributesEXT",
+    "glVertexAttrib3fNV",
+    "glActiveVaryingNV",
+    "glCopyColorSubTableEXT",
+    "glFinishTextureSUNX",
+    "glTexImage2D",
+    "glSampleMaskSGIS",
+    "glDeleteQueries",
+    "glMapGrid2d",
+    "glProgramUniformMatrix4x3fvEXT",
+    "glProgramUniform2i",
+    NULL,
+    NULL,
+    "glIsRenderbuffer",
+    NULL,
+    "glDetachShader",
+    NULL,
+    "glMatrixLoadfEXT",
+    "glColor4iv",
+    "glColor4ui",
+    NULL,
+    NULL,
+    "glGetFenceivNV",
+    "glFogxvOES",
+    "glGetObjectParameterfvARB",
+    "glProgramLocalParameterI4iNV",
+    "glClearDepthf",
+    NULL,
+    NULL,
+    "glProgramUniform4f",
+    "glMaterialiv",
+    "glGetPathMetricRangeNV",
+    "eglDupNativeFenceFDANDROID",
+    "glVertexArrayBindingDivisor",
+    NULL,
+    "glGetListParameterivSGIX",
+    NULL,
+    "glVertexAttribs4dvNV",
+    "glUnmapObjectBufferATI",
+    "eglGetStreamFileDescriptorKHR",
+    NULL,
+    "glProgramUniformMatrix4x3fv",
+    NULL,
+    NULL,
+    "glGetShaderPrecisionFormat",
+    NULL,
+    NULL,
+    "glVertexAttribI1iv",
+    NULL,
+    "glVertexAttrib4usvARB",
+    NULL,
+    "glProgramEnvParametersI4ivNV",
+    "glVertexAttribP1ui",
+    "glCopyTexSubImage1DEXT",
+    NULL,
+    NULL,
+    "glDeleteProgramsARB",
+    "glVertexAttrib1dARB",
+    NULL,
+    "glPolygonOffsetClamp",
+    "glConvolutionParameteri",
+    "glIsVertexArray",
+    "glGlobalAlphaFactorfSUN",
+    "glTextureRenderbufferEXT",
+    "glColorFragmentOp3ATI",
+    "glProgramEnvParameterI4iNV",
+    "glUniform2fv",
+    "glTransformFeedbackVaryingsNV",
+    NULL,
+    "glBlendFuncSeparateINGR",
+    "glFramebufferParameteriMESA",
+    "eglClientSignalSyncEXT",
+    "glSamplerParameterIiv",
+    NULL,
+    "glUniform3fv",
+    NULL,
+    "glDrawTransformFeedbackStream",
+    "glReadnPixelsARB",
+    NULL,
+    "glVariantfvEXT",
+    NULL,
+    NULL,
+    "glMultiTexEnvfvEXT",
+    "glLoadTransposeMatrixxOES",
+    NULL,
+    "glGetVertexArrayIndexediv",
+    "glWindowPos3f",
+    "glGetClipPlanexOES",
+    NULL,
+    "glUseShaderProgramEXT",
+    "glVertexBlendEnvfATI",
+    "glNamedBufferPageCommitmentEXT",
+    "eglQueryStreamConsumerEventNV",
+    "glListParameteriSGIX",
+    "glGetFragDataLocationEXT",
+    NULL,
+    "glGetQueryObjecti64vEXT",
+    "glGetRenderbufferParameterivEXT",
+    "glFramebufferTexture1DEXT",
+    "glSecondaryColorFormatNV",
+    "glIsVertexArrayAPPLE",
+    NULL,
+    "glProgramUniform2d",
+    "glMultiTexCoord1dv",
+    NULL,
+    "glProgramSubroutineParametersuivNV",
+    "glProgramUniform2ui64NV",
+    NULL,
+    "glSemaphoreParameterui64vEXT",
+    NULL,
+    "glVertexAttribI2ui",
+    "glVertexPointervINTEL",
+    "glProgramUniformui64vNV",
+    "glGetInvariantIntegervEXT",
+    "glSampleCoverage",
+    "glEvalCoord1f",
+    "glGetProgramResourceIndex",
+    NULL,
+    NULL,
+    "glPointParameteri",
+    "glVertexAttrib4ubNV",
+    "glLoadMatrixxOES",
+    "glIsProgramARB",
+    "glNamedFramebufferTextureLayer",
+    "glBindLightParameterEXT",
+    "eglDestroyImage",
+    NULL,
+    "glGetInvariantFloatvEXT",
+    "eglCreateSync",
+    "glGetSharpenTexFuncSGIS",
+    "glGenPerfMonitorsAMD",
+    NULL,
+    NULL,
+    NULL,
+    "glTexCoord2xOES",
+    "glColorTable",
+    NULL,
+    "glTexParameteriv",
+    "glTexStorage2DEXT",
+    "glGetTexBumpParameterivATI",
+    "glProgramLocalParameter4fvARB",
+    "glUniform4iARB",
+    NULL,
+    "glNamedRenderbufferStorageMultisample",
+    "glGetTransformFeedbackVaryingEXT",
+    NULL,
+    "glCopyTexSubImage2D",
+    "glGetLightfv",
+    "glGetMultisamplefvNV",
+    "glColorPointer",
+    "glEvalCoord2fv",
+    "glSampleMaski",
+    NULL,
+    "glSecondaryColor3hvNV",
+    NULL,
+    NULL,
+    "glProgramUniform4uivEXT",
+    "glVertexAttrib2dv",
+    "glPointParameterfv",
+    "glCompressedTextureSubImage3DEXT",
+    "glTexStorageSparseAMD",
+    "glTexturePageCommitmentMemNV",
+    "glFreeObjectBufferATI",
+    NULL,
+    "glDeleteVertexArraysAPPLE",
+    NULL,
+    "glProgramUniform3d",
+    "glPolygonOffsetEXT",
+    "glProgramUniform1dvEXT",
+    "glGetActiveSubroutineUniformName",
+    "eglSwapBuffers",
+    "glScissorExclusiveNV",
+    "glCreateSamplers",
+    "glFramebufferTextureARB",
+    "glVertex4d",
+    "glTexStorageMem3DMultisampleEXT",
+    NULL,
+    "glVertexAttribI4i",
+    "glGetVideoui64vNV",
+    "glVertexAttribL2dv",
+    "glTexCoord2iv",
+    NULL,
+    "glProgramUniform4dv",
+    "glDebugMessageCallbackARB",
+    NULL,
+    "glArrayObjectATI",
+    NULL,
+    "glInvalidateNamedFramebufferData",
+    "glVertex3bOES",
+    NULL,
+    "glBeginTransformFeedbackNV",
+    "glMultiTexCoord2hvNV",
+    "glExtractComponentEXT",
+    NULL,
+    NULL,
+    "glTangent3bvEXT",
+    NULL,
+    "glProgramUniform2i64NV",
+    NULL,
+    "glBinormalPointerEXT",
+    "glWindowPos3dv",
+    "glTexStorage2D",
+    NULL,
+    NULL,
+    NULL,
+    "glVertex2hvNV",
+    NULL,
+    NULL,
+    "glDeleteFencesNV",
+    "glVertex3xOES",
+    "glUniform1fvARB",
+    "glDrawRangeElementsBaseVertex",
+    "glTexStorage1D",
+    "glMapParameterivNV",
+    "glGetArrayObjectfvATI",
+    "glWindowPos2ivMESA",
+    "glNamedFramebufferSamplePositionsfvAMD",
+    "glVertex4bvOES",
+    "glVertexAttribLPointerEXT",
+    NULL,
+    "glUniform4ui64vNV",
+    "glCheckNamedFramebufferStatusEXT",
+    NULL,
+    "glVertex2fv",
+    NULL,
+    NULL,
+    "glGetSubroutineUniformLocation",
+    "glDrawArrays",
+    NULL,
+    "glUseProgram",
+    "glGetInternalformativ",
+    "glTangent3ivEXT",
+    "glBindVideoCaptureStreamBufferNV",
+    NULL,
+    "eglGetDisplayDriverConfig",
+    "glDrawElementArrayAPPLE",
+    "glTexCoord2fColor3fVertex3fSUN",
+    "glSeparableFilter2D",
+    "glVertexAttribL4ui64NV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glGetnHistogramARB",
+    NULL,
+    "glVertexAttribI4usv",
+    "glBindBuffersBase",
+    "glSecondaryColor3fv",
+    "glGetNamedFramebufferParameterivEXT",
+    NULL,
+    "glCallCommandListNV",
+    "glVertexAttrib2dvNV",
+    "eglStreamConsumerOutputEXT",
+    "glUniform3uivEXT",
+    "glGetFragmentMaterialfvSGIX",
+    "glSignalVkSemaphoreNV",
+    "glGetShaderSourceARB",
+    "glFogCoordhvNV",
+    "glNamedFramebufferTextureMultiviewOVR",
+    "glIsProgram",
+    "glGetProgramBinary",
+    "glDeleteCommandListsNV",
+    NULL,
+    "glVertexAttribL1ui64vARB",
+    NULL,
+    "glTexFilterFuncSGIS",
+    "glDrawCommandsStatesNV",
+    NULL,
+    "glPathParameteriNV",
+    "glColor3ubv",
+    NULL,
+    "glUniform2i",
+    "glMatrixScalefEXT",
+    "glMatrixIndexPointerARB",
+    "glIndexsv",
+    "glValidateProgramPipeline",
+    "glTexEnvf",
+    NULL,
+    "eglSurfaceAttrib",
+    "glWaitSemaphoreui64NVX",
+    "glProgramUniform3dv",
+    "glWindowPos2sARB",
+    "glIndexs",
+    NULL,
+    "glSecondaryColor3bEXT",
+    "glReplacementCodeubvSUN",
+    NULL,
+    "glMemoryBarrierEXT",
+    NULL,
+    "glUniformMatrix4x2dv",
+    "glVertexAttrib4dv",
+    "glProgramParameter4dNV",
+    "glProgramLocalParameter4fARB",
+    NULL,
+    NULL,
+    "glUniform2f",
+    "glGetTextureParameterfvEXT",
+    NULL,
+    "glVertexAttrib4Nuiv",
+    "glGetVertexArrayPointeri_vEXT",
+    "glUniform1ivARB",
+    "glTransformFeedbackVaryings",
+    "glPrioritizeTexturesEXT",
+    NULL,
+    "glPopName",
+    "glAlphaToCoverageDitherControlNV",
+    "glUniform1i64ARB",
+    "glCopyTexImage2DEXT",
+    "glGetProgramPipelineInfoLog",
+    NULL,
+    NULL,
+    NULL,
+    "glGenVertexArrays",
+    "glVertexAttrib3dARB",
+    NULL,
+    NULL,
+    "glProgramUniform1fv",
+    "eglQueryDmaBufFormatsEXT",
+    NULL,
+    "glArrayElementEXT",
+    NULL,
+    "glGetUniformfvARB",
+    "glGetTextureImageEXT",
+    "glMultiDrawElementArrayAPPLE",
+    "glGetMapControlPointsNV",
+    "glMultiTexParameterIuivEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glClearBufferSubData",
+    "glViewportPositionWScaleNV",
+    NULL,
+    "glCreateShaderProgramEXT",
+    NULL,
+    "eglSignalSyncNV",
+    "glWindowPos3d",
+    NULL,
+    "glProgramUniform4iv",
+    "glVertexStream3dvATI",
+    "glSecondaryColor3ubEXT",
+    "glDrawMeshTasksEXT",
+    "glConvolutionParameterivEXT",
+    "glPathCommandsNV",
+    NULL,
+    NULL,
+    "glGetnConvolutionFilterARB",
+    "glWindowPos2fMESA",
+    "glCopyColorSubTable",
+    NULL,
+    NULL,
+    "glWindowPos4iMESA",
+    "glVertex3bvOES",
+    NULL,
+    "glMultiTexCoord4sv",
+    "glGetVertexAttribiv",
+    "glGetColorTableParameterfvSGI",
+    "glTexCoord4fVertex4fvSUN",
+    "glVertexBindingDivisor",
+    "glTexParameterf",
+    "glGetQueryivARB",
+    "glNormalStream3fATI",
+    "glMatrixMult3x2fNV",
+    NULL,
+    "glBlendColorxOES",
+    "glColorFragmentOp1ATI",
+    "glVertexAttribL1ui64ARB",
+    "glMultiTexCoord3fvARB",
+    "glTagSampleBufferSGIX",
+    "glGetMultiTexEnvfvEXT",
+    "eglUnsignalSyncEXT",
+    "glMultiTexCoord4hNV",
+    "glWindowPos3dMESA",
+    "glBindProgramNV",
+    "glGetObjectPtrLabel",
+    "glGenRenderbuffersEXT",
+    "glColor3bv",
+    "glGetnMapdv",
+    "glMultiTexCoord4ivARB",
+    NULL,
+    "glTestObjectAPPLE",
+    "glVertexStream3ivATI",
+    "glProgramEnvParameterI4uivNV",
+    NULL,
+    "glTexCoord3i",
+    "glGetTexParameterfv",
+    "glTexCoord1iv",
+    "eglQueryAPI",
+    "glVertexAttrib4svNV",
+    "glNamedFramebufferRenderbufferEXT",
+    "glTexCoord2bvOES",
+    "glShadeModel",
+    NULL,
+    NULL,
+    "eglDestroyStreamKHR",
+    "glGetColorTable",
+    "eglStreamAcquireImageNV",
+    "glTexCoord3sv",
+    NULL,
+    NULL,
+    "glGetFloatv",
+    NULL,
+    "glMultiTexCoord1hNV",
+    "glGetImageTransformParameterivHP",
+    "glPointSize",
+    NULL,
+    NULL,
+    "glMinmaxEXT",
+    "glSamplerParameterfv",
+    "glGlobalAlphaFactorbSUN",
+    "glGetDebugMessageLog",
+    NULL,
+    "glProgramUniform2i64ARB",
+    "glPointParameterfARB",
+    NULL,
+    "glUniform3ui64vNV",
+    "glMatrixLoadTransposefEXT",
+    "glColorP3uiv",
+    "eglGetSyncAttrib",
+    "glNormalP3ui",
+    NULL,
+    "glGetUniformBlockIndex",
+    NULL,
+    "glPathGlyphRangeNV",
+    "glVertexAttrib4svARB",
+    NULL,
+    "glProgramUniformMatrix4fv",
+    "glGetPathMetricsNV",
+    "glPointAlongPathNV",
+    "glProgramUniform4fEXT",
+    "glGetUniformSubroutineuiv",
+    "glPathSubCoordsNV",
+    "glProgramEnvParametersI4uivNV",
+    NULL,
+    "glValidateProgram",
+    NULL,
+    "glVertexArrayVertexAttribBindingEXT",
+    "glInstrumentsBufferSGIX",
+    "glBindBufferOffsetNV",
+    "glNormal3fv",
+    "glUniform4ui64NV",
+    "glVertexStream4iATI",
+    NULL,
+    NULL,
+    NULL,
+    "glCreateFramebuffers",
+    NULL,
+    "glSetFenceNV",
+    "glCallList",
+    "glTestFenceAPPLE",
+    NULL,
+    "glTexCoord3iv",
+    "glPresentFrameDualFillNV",
+    "glGetCombinerOutputParameterfvNV",
+    "glGetMultiTexGenfvEXT",
+    "glTextureAttachMemoryNV",
+    "glClearNamedFramebufferiv",
+    "glVertexStream3dATI",
+    NULL,
+    "glGetVertexAttribivARB",
+    NULL,
+    "glGetProgramNamedParameterfvNV",
+    "glGetFramebufferParameteriv",
+    "glGetProgramSubroutineParameteruivNV",
+    "glTextureImage3DMultisampleCoverageNV",
+    NULL,
+    "glPrimitiveRestartIndexNV",
+    "eglWaitClient",
+    "glGetTexEnvxvOES",
+    "glNamedFramebufferTexture",
+    "glImportMemoryWin32NameEXT",
+    "glCheckNamedFramebufferStatus",
+    "glMultiTexCoord3s",
+    "glGetVertexAttribPointervNV",
+    "glVertex3fv",
+    "glListBase",
+    "glUpdateObjectBufferATI",
+    "glObjectPurgeableAPPLE",
+    "glProgramUniformMatrix2x4fv",
+    "glSecondaryColor3dv",
+    "glSpriteParameteriSGIX",
+    "glGetSamplerParameterIuiv",
+    "glWeightPointerARB",
+    "glCompileShader",
+    NULL,
+    NULL,
+    "glGetPerfQueryInfoINTEL",
+    "glGetMapAttribParameterivNV",
+    NULL,
+    NULL,
+    "glGetnUniformivARB",
+    "glColor3uiv",
+    "glGetPerfMonitorCountersAMD",
+    "glRasterPos3fv",
+    "glPathStencilFuncNV",
+    "glUniform1ui64vNV",
+    "glGetFogFuncSGIS",
+    "glVDPAUUnmapSurfacesNV",
+    "glMatrixLoadIdentityEXT",
+    "glTexPageCommitmentARB",
+    "glVertexAttrib1sv",
+    "glMakeImageHandleResidentNV",
+    "glVertexAttrib1f",
+    NULL,
+    NULL,
+    "glVertex4xOES",
+    "glVideoCaptureNV",
+    "glUniformHandleui64ARB",
+    "glBindVertexArrayAPPLE",
+    "glReadnPixels",
+    NULL,
+    "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+    "glVertex4bOES",
+    "glUniformMatrix4x3fv",
+    "glWindowPos2dvMESA",
+    "glGetMapParameterfvNV",
+    NULL,
+    "glProgramUniform4fv",
+    "glProgramUniform3ivEXT",
+    "glInitNames",
+    "glFogCoordPointerEXT",
+    "glMapTexture2DINTEL",
+    NULL,
+    "glGetConvolutionParameterivEXT",
+    "glVertexAttrib4NubARB",
+    "glIsAsyncMarkerSGIX",
+    "glStencilThenCoverFillPathInstancedNV",
+    "glPathGlyphIndexRangeNV",
+    "glDepthRangeIndexeddNV",
+    "glPixelTransferf",
+    "glRasterPos4iv",
+    "eglWaitSyncKHR",
+    NULL,
+    "glMapNamedBufferRangeEXT",
+    "glRasterPos3i",
+    "glIglooInterfaceSGIX",
+    "glGetVertexArrayiv",
+    "glFenceSync",
+    "glFinish",
+    "glShadingRateEXT",
+    "glMultiTexCoord2sv",
+    "glNamedRenderbufferStorageMultisampleEXT",
+    NULL,
+    "glGetActiveSubroutineName",
+    "glIsNamedStringARB",
+    NULL,
+    "glCopyConvolutionFilter2D",
+    "glVertexArrayVertexBindingDivisorEXT",
+    NULL,
+    "glTexCoord1i",
+    NULL,
+    "glNormalFormatNV",
+    "glFramebufferDrawBufferEXT",
+    NULL,
+    "glSecondaryColor3d",
+    NULL,
+    "glCompressedTexSubImage1D",
+    "glConservativeRasterParameteriNV",
+    "glBeginConditionalRenderNVX",
+    "glMatrixMult3x3fNV",
+    "glMultiTexCoord4xvOES",
+    "glGenerateTextureMipmap",
+    "glReplacementCodeusvSUN",
+    "glProgramUniform4i64vNV",
+    NULL,
+    "glVertexAttribI1uivEXT",
+    NULL,
+    NULL,
+    "glColorFragmentOp2ATI",
+    "glVertexAttribI4ui",
+    "glBinormal3iEXT",
+    "glGetColorTableSGI",
+    "glProgramUniformMatrix2x3fvEXT",
+    "glMapBufferARB",
+    "glVertexAttrib3fARB",
+    "glMateriali",
+    "glIndexub",
+    NULL,
+    "glDeleteLists",
+    NULL,
+    "glAttachShader",
+    NULL,
+    "glIsPointInFillPathNV",
+    "glTexCoord3dv",
+    "glGetnPixelMapuivARB",
+    NULL,
+    NULL,
+    "glProgramUniform2fvEXT",
+    NULL,
+    "glImageTransformParameterfHP",
+    "eglQueryDisplayAttribNV",
+    "glGetConvolutionParameterxvOES",
+    "glProgramUniform4dEXT",
+    "glProgramUniform1uiEXT",
+    "glIsTransformFeedback",
+    "glVertexPointerEXT",
+    "glVertexAttribL3dv",
+    "glBufferStorage",
+    "glProgramUniform1d",
+    NULL,
+    "glGetTexParameteriv",
+    "glGetCompressedTextureImage",
+    "glNamedProgramLocalParameter4fEXT",
+    NULL,
+    NULL,
+    "glRectfv",
+    "glBlendFuncSeparateiARB",
+    "glVariantivEXT",
+    NULL,
+    "glPathTexGenNV",
+    "glGetVariantArrayObjectivATI",
+    "glColorTableParameteriv",
+    "glWindowPos3fARB",
+    "glNormalStream3dATI",
+    "glPushDebugGroup",
+    NULL,
+    "glGetProgramivARB",
+    "glGetActiveSubroutineUniformiv",
+    NULL,
+    "glUniform4uivEXT",
+    "glVertexStream1svATI",
+    "glMatrixScaledEXT",
+    "glResetMinmax",
+    "glTangent3svEXT",
+    NULL,
+    "glRecti",
+    NULL,
+    NULL,
+    "glIsOcclusionQueryNV",
+    "glTexRenderbufferNV",
+    NULL,
+    "glBlendEquationSeparateEXT",
+    "glDrawCommandsStatesAddressNV",
+    "glResumeTransformFeedback",
+    "glGetCombinerStageParameterfvNV",
+    "glGetSeparableFilterEXT",
+    "eglDestroyContext",
+    "glVertexAttrib3sv",
+    "eglInitialize",
+    NULL,
+    "glGetVideoCaptureStreamivNV",
+    "glDeleteNamesAMD",
+    "glEvalMesh1",
+    "glImportMemoryWin32HandleEXT",
+    "glGetVertexAttribfv",
+    NULL,
+    "glProgramUniform3dvEXT",
+    "glTexCoord3fv",
+    "glTexCoord2fColor4ubVertex3fSUN",
+    NULL,
+    "glVertexP4ui",
+    "glLinkProgramARB",
+    "glProgramParameters4fvNV",
+    "glVertexArrayVertexAttribLOffsetEXT",
+    "glLoadTransposeMatrixd",
+    "glGetFragDataIndex",
+    NULL,
+    "glTexCoord2fColor3fVertex3fvSUN",
+    "glNamedProgramStringEXT",
+    "glUniformMatrix4x2fv",
+    "eglCreateNativeClientBufferANDROID",
+    "glGetImageTransformParameterfvHP",
+    "eglGetNativeClientBufferANDROID",
+    "glUniform3ivARB",
+    "glMultiTexCoord4fARB",
+    "glReplacementCodePointerSUN",
+    NULL,
+    NULL,
+    "glTextureBufferRange",
+    NULL,
+    "glGetCommandHeaderNV",
+    NULL,
+    "glGetMinmaxEXT",
+    "glColorTableSGI",
+    "glGenerateMipmap",
+    "glGlobalAlphaFactoriSUN",
+    "glGetActiveAttribARB",
+    "glGetPathCoordsNV",
+    NULL,
+    "glFramebufferSampleLocationsfvNV",
+    NULL,
+    "glEGLImageTargetTexStorageEXT",
+    "glVertexAttrib2svNV",
+    "glRectf",
+    "glFramebufferTexture2D",
+    NULL,
+    "glSetLocalConstantEXT",
+    NULL,
+    "glGetDebugMessageLogARB",
+    "glPixelTransformParameterfvEXT",
+    "glUniform4ivARB",
+    NULL,
+    "glProgramUniformui64NV",
+    "glColorSubTableEXT",
+    "glStartInstrumentsSGIX",
+    "glGlobalAlphaFactorubSUN",
+    "glBindImageTexture",
+    "glSecondaryColorPointerEXT",
+    NULL,
+    "glCreateQueries",
+    "glGetTexEnviv",
+    NULL,
+    "glVertexAttrib4dARB",
+    "glGetTransformFeedbackVaryingNV",
+    "glCopyMultiTexImage2DEXT",
+    "glTexStorageMem1DEXT",
+    NULL,
+    "glDetailTexFuncSGIS",
+    "glMultiTexCoord4f",
+    "glRenderMode",
+    "glGetString",
+    NULL,
+    "glProgramUniform1f",
+    "glColor4s",
+    NULL,
+    "glPixelStorei",
+    NULL,
+    "glShaderSourceARB",
+    "glGetHistogramParameteriv",
+    NULL,
+    "glCopyTextureSubImage3D",
+    "glClearColor",
+    "glBinormal3dvEXT",
+    "glMultiTexCoord3xOES",
+    "eglQuerySurface",
+    "glProgramUniform4dvEXT",
+    "glProgramUniformMatrix3dvEXT",
+    NULL,
+    "glUniform3ui64ARB",
+    NULL,
+    NULL,
+    "glPixelZoom",
+    NULL,
+    "glBlitNamedFramebuffer",
+    "glMultiTexCoord1dvARB",
+    NULL,
+    "glMulticastBarrierNV",
+    "glPassTexCoordATI",
+    "glTexCoord2fVertex3fSUN",
+    "glVertexAttribI4ivEXT",
+    NULL,
+    "glVertexAttribL2ui64NV",
+    "glCopyColorTable",
+    "glWindowPos2f",
+    "eglStreamConsumerGLTextureExternalKHR",
+    "glLighti",
+    "glDepthRangef",
+    "glPauseTransformFeedbackNV",
+    "glAreTexturesResident",
+    NULL,
+    "glFramebufferTexture",
+    "glIndexxOES",
+    "glBeginTransformFeedback",
+    "glTextureStorage1DEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glGetnPixelMapuiv",
+    "glTextureSubImage1DEXT",
+    "glNormal3b",
+    "glTexCoordP2ui",
+    "glVertexStream4dvATI",
+    "glPrimitiveRestartNV",
+    "glUniform2iARB",
+    NULL,
+    "glCreateSyncFromCLeventARB",
+    "glGetPerfQueryIdByNameINTEL",
+    NULL,
+    "eglQueryStreamAttribKHR",
+    "glGetFinalCombinerInputParameterfvNV",
+    "glProgramUniformMatrix2dv",
+    "glTexGenxvOES",
+    "glNormalStream3bvATI",
+    "glVDPAURegisterVideoSurfaceNV",
+    "glGetLightiv",
+    "glFogCoordfEXT",
+    "glUniform3iARB",
+    "glBindImageTextures",
+    "glFogCoordfv",
+    "glVertexAttrib2f",
+    "glEnableClientStateIndexedEXT",
+    NULL,
+    NULL,
+    "glIsTexture",
+    NULL,
+    "glGetVertexAttribLui64vARB",
+    NULL,
+    "glPixelTransformParameteriEXT",
+    "glGetTexEnvfv",
+    "glVertexAttribL3i64NV",
+    "eglTerminate",
+    "glGetFramebufferParameterivEXT",
+    "glImportSyncEXT",
+    "glGenSamplers",
+    "glNormal3dv",
+    NULL,
+    "glFragmentLightivSGIX",
+    "glPolygonStipple",
+    "glProgramUniform1ui",
+    "glGetVideoivNV",
+    NULL,
+    "glEnableClientState",
+    "glUniformHandleui64NV",
+    "glColorP4ui",
+    "glDrawArraysInstanced",
+    "glFlushPixelDataRangeNV",
+    "glStencilOpValueAMD",
+    "glClearNamedBufferSubDataEXT",
+    "glWeightPathsNV",
+    "glGenTransformFeedbacksNV",
+    "glSecondaryColor3b",
+    "glVertexAttribL4dvEXT",
+    NULL,
+    "glCopyPathNV",
+    "glMultiModeDrawElementsIBM",
+    NULL,
+    "glDeletePathsNV",
+    "glVertexAttribL1d",
+    "glEnableVertexAttribArrayARB",
+    "glUniformSubroutinesuiv",
+    "glProgramUniform4d",
+    "glGetTextureParameterivEXT",
+    "glGetPixelTexGenParameterivSGIS",
+    "glMultTransposeMatrixd",
+    "glStencilClearTagEXT",
+    NULL,
+    "glMatrixMultfEXT",
+    NULL,
+    "glTangent3bEXT",
+    "glSetFragmentShaderConstantATI",
+    "glVertexAttribs2svNV",
+    NULL,
+    "glWindowPos2fvARB",
+    "glGetBufferParameterui64vNV",
+    "glProgramUniform2iv",
+    NULL,
+    NULL,
+    "glVertexStream3sATI",
+    "glSecondaryColor3fEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformMatrix2x4dvEXT",
+    "glMultiModeDrawArraysIBM",
+    NULL,
+    "glTexCoord2hvNV",
+    "glProgramParameter4fNV",
+    "glSamplerParameterIuiv",
+    "glInvalidateNamedFramebufferSubData",
+    "glWindowPos3s",
+    "glVertexAttrib2fvARB",
+    NULL,
+    "glVertexAttrib1svARB",
+    "glTexStorageMem2DEXT",
+    "glGetShaderiv",
+    "eglWaitSync",
+    "glMultiTexCoord2svARB",
+    "glGetnUniformfv",
+    "glReplacementCodeuiColor3fVertex3fSUN",
+    "glGetQueryObjectiv",
+    NULL,
+    NULL,
+    NULL,
+    "glMultMatrixd",
+    "glProgramUniformMatrix3x4fv",
+    "glClearColorIuiEXT",
+    "glProgramUniform1i64NV",
+    NULL,
+    "glSampleCoverageARB",
+    "glTexStorageMem3DEXT",
+    "glIsBufferResidentNV",
+    "glBlendFuncSeparatei",
+    "eglCompositorSetContextAttributesEXT",
+    NULL,
+    "glSecondaryColor3s",
+    NULL,
+    "glMatrixLoadTranspose3x3fNV",
+    NULL,
+    "glGetnUniformdv",
+    "glPathDashArrayNV",
+    NULL,
+    "glVertexP3ui",
+    "glFramebufferTextureMultiviewOVR",
+    "glUniformMatrix4fvARB",
+    "eglExportDMABUFImageQueryMESA",
+    "glGetMaterialiv",
+    "glVertexAttribP4uiv",
+    "glNamedBufferPageCommitmentARB",
+    "glDeleteVertexShaderEXT",
+    "glInsertComponentEXT",
+    NULL,
+    "glVertex4s",
+    "glApplyTextureEXT",
+    "glStencilMaskSeparate",
+    "glTexCoord2d",
+    "glDisable",
+    "glEnable",
+    "glStencilFillPathInstancedNV",
+    "glGetnSeparableFilter",
+    NULL,
+    "glVertexAttribI3uiv",
+    "glGetFragmentLightivSGIX",
+    "glCompressedTextureImage1DEXT",
+    "glGetPerfMonitorGroupsAMD",
+    "glIsProgramNV",
+    "glClearDepthdNV",
+    NULL,
+    "glDisableVertexAttribAPPLE",
+    "glVertexAttrib3sARB",
+    NULL,
+    "glVertexAttrib4NsvARB",
+    "glFramebufferTexture3D",
+    "glNamedFramebufferTextureLayerEXT",
+    "eglFenceNV",
+    "glVertexAttrib4Nusv",
+    "glBindTextureUnitParameterEXT",
+    NULL,
+    "glTexSubImage4DSGIS",
+    "glBufferSubData",
+    NULL,
+    NULL,
+    "glDeleteShader",
+    "glSecondaryColor3iv",
+    NULL,
+    NULL,
+    NULL,
+    "glEndConditionalRender",
+    NULL,
+    "glGetUniformLocation",
+    "glVertexAttrib4f",
+    "glVertexAttribL3dEXT",
+    "glFogiv",
+    "glVertexAttribLFormat",
+    NULL,
+    "glGetProgramInterfaceiv",
+    "eglGetCompositorTimingANDROID",
+    "glTexImage3D",
+    "glProgramUniform2fEXT",
+    "glGetFirstPerfQueryIdINTEL",
+    "glResumeTransformFeedbackNV",
+    "glRasterPos3s",
+    "glBinormal3sEXT",
+    NULL,
+    "glMultiDrawMeshTasksIndirectCountNV",
+    "glMultiTexCoord4dARB",
+    "glMatrixTranslatefEXT",
+    "glAsyncMarkerSGIX",
+    "glProgramUniform1ivEXT",
+    "glEdgeFlagFormatNV",
+    NULL,
+    "glTexCoordPointervINTEL",
+    "glBlendFunci",
+    "glMakeImageHandleNonResidentARB",
+    "glVertexAttrib1dvNV",
+    NULL,
+    "glUniform3uiEXT",
+    "glGenFencesAPPLE",
+    "glRasterPos3dv",
+    "glTextureStorage3DEXT",
+    "glPushName",
+    NULL,
+    NULL,
+    NULL,
+    "glDrawBuffersARB",
+    "eglCreateSync64KHR",
+    "glGetProgramEnvParameterIivNV",
+    "glMultiTexCoord1svARB",
+    "glTextureParameterf",
+    "glTextureNormalEXT",
+    "glCreateProgressFenceNVX",
+    "glDeleteTransformFeedbacks",
+    "glProgramUniformMatrix4x2dv",
+    "glGetPathParameterfvNV",
+    "glGetTexGenxvOES",
+    "glMultiTexCoord3sARB",
+    "glMultiTexCoord2fARB",
+    "glProgramUniformMatrix3x4fvEXT",
+    "glClearTexSubImage",
+    NULL,
+    NULL,
+    "glEnableVertexAttribArray",
+    "glGetSamplerParameterIiv",
+    NULL,
+    "glMinSampleShadingARB",
+    "glMatrixFrustumEXT",
+    "glMultiTexCoord1ivARB",
+    "glMulticastViewportPositionWScaleNVX",
+    "glGetPointeri_vEXT",
+    NULL,
+    NULL,
+    "glEvalCoord2d",
+    NULL,
+    NULL,
+    "glVertexAttribI3uiEXT",
+    "glVertexStream1fATI",
+    NULL,
+    NULL,
+    NULL,
+    "glMulticastViewportArrayvNVX",
+    "eglQueryDisplayAttribEXT",
+    "glGetnSeparableFilterARB",
+    "glCopyTextureSubImage1DEXT",
+    NULL,
+    "glWindowPos3sMESA",
+    "glGetHistogramParameterxvOES",
+    NULL,
+    "glUniform1uivEXT",
+    "glUnmapBufferARB",
+    "glScissorIndexedv",
+    NULL,
+    "glVertexAttrib3svARB",
+    NULL,
+    "glTexCoord3hNV",
+    "glGetPointerIndexedvEXT",
+    "glTransformPathNV",
+    "glColor3xvOES",
+    "glStencilMask",
+    "glGetBufferSubData",
+    "glGetQueryObjectivARB",
+    "glSecondaryColor3us",
+    "glIsQuery",
+    "glProgramUniform2fv",
+    "glInvalidateTexImage",
+    "glDrawElementsInstancedBaseVertex",
+    "eglQueryStreamMetadataNV",
+    "glCompressedTexSubImage3D",
+    "glBufferPageCommitmentMemNV",
+    "glVertex2s",
+    "glBlendEquationEXT",
+    "glCombinerInputNV",
+    "glProgramUniformMatrix4x3dvEXT",
+    "glColor4hNV",
+    "glProgramUniform3ui",
+    "glBufferDataARB",
+    "glBegin",
+    "glStencilFuncSeparate",
+    "glWindowPos3ivARB",
+    "glBindRenderbufferEXT",
+    "glMultiTexParameterIivEXT",
+    NULL,
+    NULL,
+    "glGetClipPlanefOES",
+    NULL,
+    "glBindTextureUnit",
+    "glTexCoord1s",
+    "glProgramEnvParameter4dARB",
+    NULL,
+    "glVertexStream4ivATI",
+    NULL,
+    "glGetPerfMonitorCounterDataAMD",
+    "glMultTransposeMatrixf",
+    "glWindowPos3fv",
+    "glPathParameterivNV",
+    "glProgramUniform4iEXT",
+    "glEnableVariantClientStateEXT",
+    NULL,
+    "glVertexArrayVertexAttribOffsetEXT",
+    "glGetMapAttribParameterfvNV",
+    "glStencilFunc",
+    "glProgramUniform3uiv",
+    NULL,
+    "glGetProgramResourceiv",
+    NULL,
+    NULL,
+    "glVertexAttribI2uivEXT",
+    NULL,
+    NULL,
+    "glGetMultiTexImageEXT",
+    "glGetVideouivNV",
+    "glGetTexGenfv",
+    "glVertexAttrib4sNV",
+    "glNormalStream3ivATI",
+    "glSetFenceAPPLE",
+    "glClearDepth",
+    "glReplacementCodeuivSUN",
+    "glPixelMapx",
+    "glUniform1uiEXT",
+    "glWindowPos2s",
+    "glUniform1ui64ARB",
+    "glVertexAttrib1fvARB",
+    "glWeightfvARB",
+    "glLinkProgram",
+    "glProgramEnvParameterI4ivNV",
+    "glNewList",
+    "glVertexArrayTexCoordOffsetEXT",
+    "glFragmentLightiSGIX",
+    "glRasterPos2iv",
+    NULL,
+    "glUniform4uiEXT",
+    "glCopyMultiTexSubImage2DEXT",
+    "glDeleteAsyncMarkersSGIX",
+    "glMapVertexAttrib2dAPPLE",
+    "glMultiTexCoord1iARB",
+    "glGetInstrumentsSGIX",
+    "glCopyImageSubData",
+    "glEndFragmentShaderATI",
+    NULL,
+    "glVertexAttrib1sNV",
+    "glGetPointervEXT",
+    "glMap2xOES",
+    "glDrawVkImageNV",
+    NULL,
+    "glLightModelxvOES",
+    "glReadBuffer",
+    NULL,
+    "glVertexAttribL3d",
+    "glMapNamedBufferEXT",
+    "glCombinerStageParameterfvNV",
+    "glVertexAttribI2uiv",
+    "glFragmentLightModelfvSGIX",
+    "glProgramUniform2ui64vNV",
+    "glMemoryBarrierByRegion",
+    "eglStreamReleaseImageNV",
+    "glGetPathParameterivNV",
+    "glUniform1i64NV",
+    "glVertexAttribs1hvNV",
+    "glWindowPos3dARB",
+    "glTextureImage2DMultisampleNV",
+    "glColor3sv",
+    NULL,
+    "glEnd",
+    "glIsVertexAttribEnabledAPPLE",
+    NULL,
+    "glTextureParameteriEXT",
+    NULL,
+    "glGetBufferParameteriv",
+    "glVertexAttribI3ui",
+    "glGetMultiTexParameterfvEXT",
+    NULL,
+    "glPathGlyphIndexArrayNV",
+    "glGetPathTexGenivNV",
+    NULL,
+    "glExecuteProgramNV",
+    "glEdgeFlagv",
+    "glUniform1i64vNV",
+    "glBlitFramebufferLayerEXT",
+    "glCombinerParameterfNV",
+    NULL,
+    "eglQueryDeviceStringEXT",
+    "glGetProgramResourceLocationIndex",
+    "glGetCompressedTextureImageEXT",
+    "glMapBufferRange",
+    NULL,
+    NULL,
+    "glNormalStream3iATI",
+    "glBindVideoCaptureStreamTextureNV",
+    "eglCompositorBindTexWindowEXT",
+    "glEdgeFlag",
+    "glMultiTexSubImage3DEXT",
+    NULL,
+    "eglQueryDebugKHR",
+    "glFogCoordd",
+    "glMultiTexCoord2iARB",
+    "glCreateShaderProgramv",
+    "glWeightuivARB",
+    NULL,
+    "eglCreateWaylandBufferFromImageWL",
+    "glVertexAttrib3svNV",
+    "glTbufferMask3DFX",
+    "glViewportIndexedfv",
+    "glResetMinmaxEXT",
+    "glBindFragDataLocationIndexed",
+    NULL,
+    NULL,
+    "glGetUniformdv",
+    "eglGetFrameTimestampsANDROID",
+    NULL,
+    "glTexCoordP1uiv",
+    "glTexCoord1dv",
+    "glPathParameterfvNV",
+    "glFramebufferTextureEXT",
+    NULL,
+    "glUniformHandleui64vARB",
+    "glFogCoordPointer",
+    "glVertexAttribI3iv",
+    "glTexCoord4fv",
+    "glTexCoord4xvOES",
+    "glDeleteQueriesARB",
+    "glVertexAttrib4Nub",
+    "glTexCoord4i",
+    "glGetMemoryObjectParameterivEXT",
+    "glColorP4uiv",
+    "glProgramNamedParameter4fvNV",
+    "glClearBufferfi",
+    "glVertexStream1fvATI",
+    "eglWaitGL",
+    "glGetMinmaxParameterfv",
+    NULL,
+    "glWindowPos3iv",
+    NULL,
+    "glUniform1ui",
+    "glTextureSubImage1D",
+    NULL,
+    "glVertexAttribBinding",
+    "glGetTransformFeedbacki64_v",
+    "glGetVertexAttribIiv",
+    "glProgramUniform2iEXT",
+    "glGetMultiTexParameterIivEXT",
+    NULL,
+    "glFramebufferSamplePositionsfvAMD",
+    "glSpriteParameterivSGIX",
+    "glPassThroughxOES",
+    "glProgramBufferParametersIivNV",
+    "glProvokingVertex",
+    "glPathMemoryGlyphIndexArrayNV",
+    "glRenderGpuMaskNV",
+    "glGetProgramNamedParameterdvNV",
+    "glNormalStream3sATI",
+    "glGetQueryBufferObjectiv",
+    "glFogCoordPointerListIBM",
+    NULL,
+    "glMapParameterfvNV",
+    NULL,
+    "glRasterPos2s",
+    "glRasterPos2sv",
+    NULL,
+    "glGetProgramStringARB",
+    "eglStreamConsumerReleaseKHR",
+    "glGetMultiTexGendvEXT",
+    "glPixelTransferi",
+    "glDisableVertexArrayEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glWindowPos4svMESA",
+    NULL,
+    "glColor3s",
+    "glPixelTexGenParameterivSGIS",
+    "glProgramUniform3i64NV",
+    NULL,
+    "glGetColorTableParameterivSGI",
+    "glVertexArrayFogCoordOffsetEXT",
+    NULL,
+    "glVertexAttribs2hvNV",
+    "glDrawCommandsNV",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformMatrix4x2fv",
+    "glElementPointerAPPLE",
+    "glStencilThenCoverStrokePathNV",
+    NULL,
+    "glStencilStrokePathNV",
+    "glProgramUniform4i",
+    "glSecondaryColor3fvEXT",
+    "glGetCombinerInputParameterfvNV",
+    "glConvolutionParameterf",
+    NULL,
+    "glMultiTexEnvivEXT",
+    NULL,
+    "glMultiTexCoord3iv",
+    "eglClientWaitSyncKHR",
+    NULL,
+    NULL,
+    "glMultiTexCoord4dvARB",
+    NULL,
+    "glNamedFramebufferRenderbuffer",
+    "glColor3hvNV",
+    "glVertexArrayVertexAttribIOffsetEXT",
+    "glMulticastGetQueryObjectivNV",
+    NULL,
+    "glRectsv",
+    "glWindowPos2dMESA",
+    "glGetObjectBufferivATI",
+    "glMatrixRotatedEXT",
+    "glNamedCopyBufferSubDataEXT",
+    "eglGetMscRateANGLE",
+    "glVertex2bvOES",
+    "glVertexStream3fvATI",
+    "glGetFragmentShadingRatesEXT",
+    "glBindTransformFeedbackNV",
+    "eglCreatePixmapSurface",
+    "glGetMapdv",
+    "glVertex4f",
+    "glVertexAttribs3fvNV",
+    "glVertexAttrib4fvNV",
+    "glConservativeRasterParameterfNV",
+    NULL,
+    "glGetMapParameterivNV",
+    NULL,
+    NULL,
+    "glColor3d",
+    NULL,
+    NULL,
+    "glDrawCommandsAddressNV",
+    "glImportSemaphoreFdEXT",
+    "glEdgeFlagPointerEXT",
+    "glGenOcclusionQueriesNV",
+    "glTexCoord1xOES",
+    "glVertexAttrib4Niv",
+    "glViewportIndexedf",
+    NULL,
+    NULL,
+    "glLogicOp",
+    NULL,
+    NULL,
+    NULL,
+    "glTextureColorMaskSGIS",
+    "glColorPointerEXT",
+    "glGetObjectLabel",
+    "glGetPerfCounterInfoINTEL",
+    "glProgramEnvParameterI4uiNV",
+    NULL,
+    "eglQueryNativeWindowNV",
+    "glAlphaFuncxOES",
+    "glRasterPos3d",
+    "glGetNamedProgramStringEXT",
+    "glCreateBuffers",
+    "glEndPerfMonitorAMD",
+    NULL,
+    "glMultiDrawArraysEXT",
+    "glGetVideoCaptureStreamfvNV",
+    "glVertexArrayAttribIFormat",
+    NULL,
+    "glPixelTexGenParameteriSGIS",
+    "glPrioritizeTextures",
+    "glUniform2ui64vARB",
+    NULL,
+    NULL,
+    "glElementPointerATI",
+    "glProgramEnvParameter4fARB",
+    NULL,
+    NULL,
+    "glDrawRangeElementArrayAPPLE",
+    NULL,
+    NULL,
+    "glDeletePerfQueryINTEL",
+    "glTextureBufferRangeEXT",
+    NULL,
+    NULL,
+    "eglQueryContext",
+    "glPathFogGenNV",
+    NULL,
+    "glUniform3fARB",
+    NULL,
+    "glMultiTexCoordP4uiv",
+    "glGetnMapfv",
+    NULL,
+    "glLightfv",
+    "glUniform3i",
+    "glScissorIndexed",
+    "glTexSubImage3DEXT",
+    "glProgramUniform4ui64NV",
+    "glFogf",
+    "glMultiTexCoord2f",
+    NULL,
+    "glProgramUniformMatrix3x2fvEXT",
+    "glUniform2ui64NV",
+    "glColor4i",
+    NULL,
+    "glVertexAttribL2d",
+    NULL,
+    "glTexBufferEXT",
+    NULL,
+    "glVertexAttrib1svNV",
+    "eglDestroySync",
+    "glIsTextureHandleResidentNV",
+    "glGetPathColorGenivNV",
+    "glScalef",
+    "glVertex3d",
+    "glCullParameterdvEXT",
+    NULL,
+    "glGetnMinmax",
+    "glGetObjectBufferfvATI",
+    "glVDPAURegisterOutputSurfaceNV",
+    "glProgramUniformMatrix2x3dv",
+    "glDebugMessageControlARB",
+    "glCopyTexSubImage3DEXT",
+    "glProgramLocalParameters4fvEXT",
+    "glFlushRasterSGIX",
+    NULL,
+    "glDebugMessageEnableAMD",
+    "glCopyTextureSubImage2DEXT",
+    "glProgramUniform4uiEXT",
+    NULL,
+    NULL,
+    "glVertexAttrib4Nbv",
+    NULL,
+    NULL,
+    NULL,
+    "glCreateProgram",
+    "glMapVertexAttrib1dAPPLE",
+    "glCompressedTexImage2D",
+    NULL,
+    NULL,
+    NULL,
+    "glGetHistogramEXT",
+    "glGetPathColorGenfvNV",
+    "glTexCoord2i",
+    "glProgramUniform1i64vNV",
+    NULL,
+    NULL,
+    "glViewport",
+    "eglStreamConsumerAcquireAttribKHR",
+    "glEnableClientStateiEXT",
+    NULL,
+    "glLightEnviSGIX",
+    "glNamedFramebufferTextureEXT",
+    "glPollAsyncSGIX",
+    "glNormal3hvNV",
+    NULL,
+    "glVertexAttrib1fv",
+    "glGetDetailTexFuncSGIS",
+    "eglQueryNativeDisplayNV",
+    "glConvolutionParameteriEXT",
+    "glUniform2uivEXT",
+    NULL,
+    NULL,
+    "glGetVertexAttribIivEXT",
+    "glVertexP4uiv",
+    "glUseProgramObjectARB",
+    "glPauseTransformFeedback",
+    "glTexCoordPointerListIBM",
+    "glBindAttribLocationARB",
+    "glGetnMapdvARB",
+    NULL,
+    "glGenTextures",
+    "glProgramUniform1dv",
+    "glMultiTexCoord4hvNV",
+    "glCopyTexImage1DEXT",
+    "eglQueryOutputLayerStringEXT",
+    "glWeightivARB",
+    NULL,
+    NULL,
+    "glMulticastGetQueryObjecti64vNV",
+    NULL,
+    "eglGetFrameTimestampSupportedANDROID",
+    "glRectd",
+    "glTexCoord3hvNV",
+    "glCompressedTexImage1D",
+    "glGetTextureParameterIuivEXT",
+    NULL,
+    NULL,
+    "glFramebufferTexture3DEXT",
+    "glVertexAttribPointerNV",
+    "glNormal3d",
+    "glCompressedTextureImage3DEXT",
+    "glGetnTexImage",
+    "glProgramUniformMatrix2fv",
+    "glGenBuffers",
+    "glGetProgramStringNV",
+    "glMultiTexCoord2hNV",
+    "glCreateProgramPipelines",
+    NULL,
+    "glVDPAUUnregisterSurfaceNV",
+    "glGetnTexImageARB",
+    "glProgramUniform1ui64vARB",
+    "glGetPixelMapuiv",
+    NULL,
+    "glProgramBufferParametersIuivNV",
+    NULL,
+    "glSecondaryColor3bvEXT",
+    "glGetVertexArrayIntegeri_vEXT",
+    "glMultiTexCoord4fv",
+    "glWaitSync",
+    "glVertex2hNV",
+    "glGetTexParameterIiv",
+    "glUniformBlockBinding",
+    NULL,
+    "glVertexAttrib2fv",
+    NULL,
+    "glCopyMultiTexImage1DEXT",
+    NULL,
+    NULL,
+    "glGetTexParameterIivEXT",
+    NULL,
+    "glUniform4fv",
+    "glWindowPos2svMESA",
+    "glGetPixelMapfv",
+    "glTexCoord2s",
+    NULL,
+    "glProgramUniform2dvEXT",
+    NULL,
+    "glColor3dv",
+    "glBufferAddressRangeNV",
+    "glConvolutionFilter2DEXT",
+    "glColor3i",
+    NULL,
+    "glEndConditionalRenderNVX",
+    "glCullParameterfvEXT",
+    NULL,
+    "glVertexAttrib3sNV",
+    "glRotated",
+    NULL,
+    "glUniform2ui",
+    NULL,
+    "glGetProgramivNV",
+    "glVertexAttrib3s",
+    "glTextureSubImage3D",
+    "glVDPAUFiniNV",
+    "glUniformMatrix2fvARB",
+    NULL,
+    "glIsStateNV",
+    "glGetUniformui64vARB",
+    NULL,
+    "glNormalStream3svATI",
+    "eglCreatePlatformPixmapSurfaceEXT",
+    "glGenVertexShadersEXT",
+    "glTextureStorage3DMultisampleEXT",
+    NULL,
+    "glPixelStoref",
+    NULL,
+    "glCompileCommandListNV",
+    "glCurrentPaletteMatrixARB",
+    "glTexCoordPointerEXT",
+    "glCreateTextures",
+    "glGetVideoCaptureStreamdvNV",
+    "glFinishFenceNV",
+    "glTexCoord4hvNV",
+    NULL,
+    "glNamedProgramLocalParameterI4uivEXT",
+    "glMap1xOES",
+    "glCopyImageSubDataNV",
+    "glCopyTextureSubImage3DEXT",
+    "glUniform4i64vNV",
+    "glMap1f",
+    "glVertex3dv",
+    "glMultiTexCoordP3uiv",
+    "glFragmentMaterialivSGIX",
+    "glEnablei",
+    "glReplacementCodeuiVertex3fvSUN",
+    "glProgramParameteri",
+    NULL,
+    "glBinormal3bEXT",
+    "glGenFramebuffers",
+    "glWindowPos4dvMESA",
+    "glListDrawCommandsStatesClientNV",
+    "glPixelMapusv",
+    "glMultiTexCoord3sv",
+    "glTexGendv",
+    NULL,
+    "glPathParameterfNV",
+    "glGetMinmaxParameterfvEXT",
+    "glGlobalAlphaFactorusSUN",
+    NULL,
+    "glDrawElementArrayATI",
+    NULL,
+    "glNormal3fVertex3fvSUN",
+    "glGetOcclusionQueryuivNV",
+    "glCompressedTexImage2DARB",
+    "glMatrixLoad3x2fNV",
+    "glClearIndex",
+    "glGetProgramResourcefvNV",
+    NULL,
+    "glVertexAttribI4iv",
+    "glNamedBufferDataEXT",
+    NULL,
+    "glTexGeni",
+    "glVertexAttrib4uivARB",
+    "glWriteMaskEXT",
+    "glShaderOp1EXT",
+    "glUniformMatrix3fvARB",
+    "glGenTexturesEXT",
+    "glDeleteRenderbuffers",
+    "glColor4us",
+    "glUniform1iv",
+    NULL,
+    "glMaterialxvOES",
+    NULL,
+    "glUniform1fv",
+    "glMultiTexCoord3svARB",
+    "glVertexAttribParameteriAMD",
+    "glProgramUniform3i64vARB",
+    "glShadingRateImageBarrierNV",
+    "glProgramUniform1dEXT",
+    NULL,
+    "glCopyTexImage1D",
+    NULL,
+    "eglCreatePbufferFromClientBuffer",
+    NULL,
+    "glTextureLightEXT",
+    "glVertexAttribL2i64vNV",
+    "glUniform1ui64NV",
+    "glVertexAttrib4ubvARB",
+    NULL,
+    "glTextureBarrier",
+    "glRotatexOES",
+    "glFramebufferFetchBarrierEXT",
+    "glDisableVertexAttribArray",
+    "glGetUniformOffsetEXT",
+    "glGetVertexAttribIuivEXT",
+    "eglBindTexImage",
+    "glDebugMessageInsertAMD",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexArrayIndexOffsetEXT",
+    "glMultiDrawArraysIndirectCountARB",
+    "glClampColorARB",
+    "glSecondaryColor3usv",
+    "glGetMultiTexParameterivEXT",
+    NULL,
+    "glPatchParameteri",
+    "glPixelDataRangeNV",
+    "glMultiTexSubImage1DEXT",
+    "glMultiDrawArraysIndirect",
+    "glNamedProgramLocalParameter4dvEXT",
+    "glGetFloati_v",
+    "glUniform2iv",
+    "glCoverStrokePathInstancedNV",
+    NULL,
+    "glBindFragDataLocation",
+    "glGetNamedBufferPointervEXT",
+    "eglGetSystemTimeNV",
+    "glFramebufferSampleLocationsfvARB",
+    "glAlphaFragmentOp2ATI",
+    NULL,
+    "glVertexAttrib4NivARB",
+    "glIndexf",
+    "glMultiTexCoord1i",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glSignalSemaphoreui64NVX",
+    "glVertex3i",
+    NULL,
+    NULL,
+    "glBindBufferRangeEXT",
+    "glTextureParameterfvEXT",
+    "glUniform2i64vARB",
+    "eglSetBlobCacheFuncsANDROID",
+    "glFramebufferReadBufferEXT",
+    NULL,
+    NULL,
+    "glVertexBlendEnviATI",
+    "glColor3ub",
+    NULL,
+    "glTexCoord1d",
+    "glTexCoord2fNormal3fVertex3fSUN",
+    NULL,
+    "glImageTransformParameterfvHP",
+    "glGetNamedRenderbufferParameterivEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glGetVertexAttribdvARB",
+    "glNamedRenderbufferStorageMultisampleCoverageEXT",
+    "glAttachObjectARB",
+    "glCommandListSegmentsNV",
+    "glIndexubv",
+    "glReplacementCodeuiColor4ubVertex3fSUN",
+    "glGetnUniformiv",
+    "glQueryMatrixxOES",
+    "glCopyNamedBufferSubData",
+    "glCoverageModulationTableNV",
+    "glGetActiveUniformName",
+    "glGenTransformFeedbacks",
+    "glGetTextureParameteriv",
+    "glGetTexBumpParameterfvATI",
+    "glWindowPos3ivMESA",
+    "glLoadIdentityDeformationMapSGIX",
+    "glDisableClientState",
+    NULL,
+    "glTexCoord4bvOES",
+    "glProgramUniform3iv",
+    "glPointSizexOES",
+    "glShaderOp3EXT",
+    "glFragmentCoverageColorNV",
+    "glVertexStream2sATI",
+    NULL,
+    "glNamedProgramLocalParameterI4iEXT",
+    "glEndVertexShaderEXT",
+    NULL,
+    NULL,
+    "glMultiTexCoord3ivARB",
+    "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+    "eglStreamConsumerGLTextureExternalAttribsNV",
+    NULL,
+    "glDrawBuffers",
+    NULL,
+    "glMultiTexCoord2fvARB",
+    "glCopyTextureSubImage1D",
+    "glMaterialxOES",
+    "glIsFenceNV",
+    NULL,
+    NULL,
+    "glTexCoord3d",
+    "glMapBuffer",
+    NULL,
+    NULL,
+    "glMultiTexCoord3f",
+    "glProgramUniform4fvEXT",
+    NULL,
+    "glFragmentMaterialfvSGIX",
+    "glDeformationMap3fSGIX",
+    "glReplacementCodeubSUN",
+    "glCompressedTextureSubImage1D",
+    "glTextureStorage1D",
+    "glVertexAttrib1hvNV",
+    "glMultiTexCoordP3ui",
+    NULL,
+    NULL,
+    "glVertexAttribI1uiEXT",
+    "glGetProgramEnvParameterfvARB",
+    "glBindBufferBaseNV",
+    "glColor4dv",
+    "glColor3ui",
+    NULL,
+    NULL,
+    "glUniform3iv",
+    NULL,
+    "glVertexStream3fATI",
+    NULL,
+    "glTangent3dvEXT",
+    "glProgramUniformMatrix2x3fv",
+    NULL,
+    NULL,
+    "glGetNamedProgramLocalParameterIivEXT",
+    "glTextureStorage2DMultisampleEXT",
+    "glVertexArrayMultiTexCoordOffsetEXT",
+    NULL,
+    "eglCreateStreamFromFileDescriptorKHR",
+    "glVertexAttribs4fvNV",
+    NULL,
+    "glPolygonOffsetxOES",
+    "glVertexAttrib2fvNV",
+    "glGlobalAlphaFactoruiSUN",
+    "glDepthRangefOES",
+    NULL,
+    "glSecondaryColor3hNV",
+    NULL,
+    "glGetPolygonStipple",
+    "glWindowPos3dvARB",
+    "glVertex4fv",
+    "glMatrixLoaddEXT",
+    "glVertexArrayParameteriAPPLE",
+    "glEnableVertexArrayEXT",
+    "glConvolutionParameterfEXT",
+    NULL,
+    NULL,
+    "glMapControlPointsNV",
+    NULL,
+    "glVertexAttribI4svEXT",
+    "glGetTexGeniv",
+    NULL,
+    NULL,
+    "glPopDebugGroup",
+    NULL,
+    "glBlendEquationSeparate",
+    NULL,
+    "glDebugMessageCallbackAMD",
+    "glGetCombinerInputParameterivNV",
+    "glGetTextureLevelParameterfvEXT",
+    "glTextureParameterIiv",
+    "eglQuerySurface64KHR",
+    "eglCreateDRMImageMESA",
+    "glSecondaryColorP3ui",
+    "glGetnPixelMapfv",
+    NULL,
+    "glEvalCoord2xvOES",
+    "glGetGraphicsResetStatusARB",
+    NULL,
+    "glMatrixRotatefEXT",
+    "glPointParameterivNV",
+    "glUniformui64NV",
+    "eglQueryOutputLayerAttribEXT",
+    "glBinormal3fEXT",
+    "glGetnPixelMapfvARB",
+    "glDrawMeshTasksNV",
+    "glGetSeparableFilter",
+    "glDrawElements",
+    "glNamedBufferStorageMemEXT",
+    "glVertexAttribI1ivEXT",
+    "glCreateSemaphoresNV",
+    "glPathSubCommandsNV",
+    "glMapNamedBufferRange",
+    NULL,
+    "eglSetDamageRegionKHR",
+    "glCompressedMultiTexImage1DEXT",
+    "eglExportDMABUFImageMESA",
+    "glVertexAttrib2fNV",
+    NULL,
+    "glGetIntegerui64i_vNV",
+    "glNormalPointervINTEL",
+    NULL,
+    "glVertexAttribIFormatNV",
+    "glGetColorTableParameterfvEXT",
+    "glGetListParameterfvSGIX",
+    "glVertexAttrib4fvARB",
+    "glGetQueryObjectuivARB",
+    NULL,
+    "glGetTexLevelParameterxvOES",
+    "glTexCoord3xvOES",
+    "eglClientWaitSyncNV",
+    "eglCreatePixmapSurfaceHI",
+    "glBindBufferOffsetEXT",
+    NULL,
+    "glDepthRangexOES",
+    "glGetTextureParameterIiv",
+    "glIsTextureEXT",
+    NULL,
+    NULL,
+    "glGetPerfMonitorCounterStringAMD",
+    "glRasterPos4dv",
+    "eglQueryDeviceAttribEXT",
+    "glLightModeliv",
+    "glFrustum",
+    "glDeleteProgramPipelines",
+    "glPointParameterfEXT",
+    "glGetnPolygonStipple",
+    NULL,
+    "glBindTransformFeedback",
+    "glBindVertexShaderEXT",
+    "glDeformSGIX",
+    "glProgramUniformMatrix2x4dv",
+    "eglGetDisplayDriverName",
+    "glPassThrough",
+    "glVertexWeighthNV",
+    "glBinormal3bvEXT",
+    "glVertexAttrib3hvNV",
+    "glScissor",
+    "glMultiDrawElementsIndirectBindlessNV",
+    NULL,
+    NULL,
+    "glEvalMesh2",
+    "glPathGlyphsNV",
+    "glMultiTexImage1DEXT",
+    NULL,
+    "glNormal3xvOES",
+    "glUniform3i64vNV",
+    "glColor3fv",
+    "glWindowPos3svARB",
+    NULL,
+    NULL,
+    NULL,
+    "glTextureParameterfv",
+    "glDeleteOcclusionQueriesNV",
+    "glTexStorage3DEXT",
+    "glCopyMultiTexSubImage1DEXT",
+    "glTessellationModeAMD",
+    "glVertexAttrib1dvARB",
+    "glCopyTexSubImage1D",
+    "glTexCoord2fNormal3fVertex3fvSUN",
+    "glRenderbufferStorageMultisample",
+    "glVertexAttrib4dvNV",
+    "glClearDepthfOES",
+    NULL,
+    "glTexGend",
+    "eglCompositorSetWindowListEXT",
+    NULL,
+    "glProgramUniform2ivEXT",
+    "glTangent3fvEXT",
+    NULL,
+    "glMultiTexCoord4iARB",
+    "glVertexAttrib4ubv",
+    "glWindowPos4dMESA",
+    "glFragmentMaterialiSGIX",
+    "glFramebufferShadingRateEXT",
+    "glGetMultiTexLevelParameterivEXT",
+    "glDrawTransformFeedbackNV",
+    "glLoadMatrixf",
+    "glPathStringNV",
+    "glGetStringi",
+    "glGetBufferSubDataARB",
+    "glGenSymbolsEXT",
+    "glVDPAUMapSurfacesNV",
+    "eglExportDRMImageMESA",
+    "glMaterialfv",
+    "eglGetSyncAttribNV",
+    "glBitmapxOES",
+    "glNamedRenderbufferStorage",
+    "eglCreatePlatformWindowSurface",
+    "glVertexAttribI4usvEXT",
+    "glGetTextureLevelParameterfv",
+    "glNormal3bv",
+    "glScalexOES",
+    "eglStreamImageConsumerConnectNV",
+    "glVertexStream4fATI",
+    NULL,
+    "glNamedProgramLocalParameters4fvEXT",
+    "glGetnMapivARB",
+    "glVertexAttribI2iEXT",
+    "glPolygonMode",
+    NULL,
+    NULL,
+    NULL,
+    "glGetCompressedTextureSubImage",
+    "glAlphaFragmentOp3ATI",
+    "glColor4fNormal3fVertex3fvSUN",
+    NULL,
+    "glCopyConvolutionFilter1DEXT",
+    "glGetTrackMatrixivNV",
+    "glGetUniformLocationARB",
+    "glGetQueryObjectui64v",
+    "glGetCompressedTexImage",
+    NULL,
+    "glConvolutionParameterxOES",
+    "glPrioritizeTexturesxOES",
+    "glMultiTexCoord2xvOES",
+    "glProgramUniform3fvEXT",
+    "glVertexAttribL4d",
+    NULL,
+    NULL,
+    NULL,
+    "glGetPathCommandsNV",
+    "glVertexAttribPointer",
+    "glLockArraysEXT",
+    "glGetInfoLogARB",
+    "glGetnColorTable",
+    NULL,
+    "glDrawElementsInstancedBaseInstance",
+    "glWindowRectanglesEXT",
+    "eglStreamConsumerReleaseAttribKHR",
+    NULL,
+    "glProgramUniform1uivEXT",
+    "glGetProgramLocalParameterIuivNV",
+    NULL,
+    NULL,
+    "glOrthofOES",
+    "glSecondaryColor3dvEXT",
+    "glGetLightxOES",
+    "glBlendColorEXT",
+    NULL,
+    "glResetHistogram",
+    "glProgramUniformHandleui64vNV",
+    "glGetMinmaxParameterivEXT",
+    "glEndVideoCaptureNV",
+    "glVertexAttribs1dvNV",
+    NULL,
+    "glUniform4i64vARB",
+    "glVertexAttribP3ui",
+    "glNormalP3uiv",
+    "glMultiTexGenivEXT",
+    "glFramebufferTexture1D",
+    "glRenderbufferStorageMultisampleAdvancedAMD",
+    "glTexCoord4iv",
+    "glTexBumpParameterfvATI",
+    "glPollInstrumentsSGIX",
+    "glCreateProgramObjectARB",
+    "glVariantdvEXT",
+    NULL,
+    NULL,
+    "glWeightubvARB",
+    "glVertexAttrib4fv",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexGenfvEXT",
+    "glProgramUniformMatrix2x4fvEXT",
+    "glVertexAttribs4svNV",
+    "eglSwapBuffersWithDamageEXT",
+    "glTextureView",
+    NULL,
+    NULL,
+    "glTextureImage3DEXT",
+    "glCallLists",
+    "glMultiTexCoord3iARB",
+    NULL,
+    NULL,
+    "glLightModeli",
+    "glProgramUniformHandleui64NV",
+    "glCopyTexImage2D",
+    "glGetnPixelMapusv",
+    "glGetnConvolutionFilter",
+    "glGetQueryBufferObjectui64v",
+    "glMatrixIndexusvARB",
+    "glSecondaryColor3dEXT",
+    "glProvokingVertexEXT",
+    NULL,
+    "glGetRenderbufferParameteriv",
+    NULL,
+    "glAsyncCopyBufferSubDataNVX",
+    "glGetFloatIndexedvEXT",
+    "glVertexWeightfvEXT",
+    NULL,
+    "glGetUnsignedBytevEXT",
+    "eglDestroyImageKHR",
+    NULL,
+    "glVDPAUGetSurfaceivNV",
+    "glProgramUniformMatrix4x2fvEXT",
+    "glRasterPos2dv",
+    NULL,
+    "glFramebufferRenderbuffer",
+    "glProgramUniform4ui64vARB",
+    "glEndList",
+    "glDrawArraysInstancedBaseInstance",
+    "glVertexPointer",
+    NULL,
+    NULL,
+    "glDeleteTextures",
+    "glRotatef",
+    NULL,
+    "eglCopyBuffers",
+    "glVertexAttrib3dvNV",
+    NULL,
+    "glTextureStorage3D",
+    NULL,
+    "glGetMaterialxOES",
+    "glTextureParameterIivEXT",
+    "glCreateStatesNV",
+    NULL,
+    "glTextureImage2DMultisampleCoverageNV",
+    NULL,
+    "glInterpolatePathsNV",
+    "glIsProgramPipeline",
+    "glNormal3iv",
+    "glNormal3hNV",
+    NULL,
+    "glGetQueryiv",
+    "glCompressedTexImage3DARB",
+    "glDepthRangeArraydvNV",
+    NULL,
+    "glEndConditionalRenderNV",
+    "eglSetStreamAttribKHR",
+    "glVDPAURegisterVideoSurfaceWithPictureStructureNV",
+    "glVertexAttribL1ui64vNV",
+    "glGetFramebufferAttachmentParameterivEXT",
+    NULL,
+    "eglCreatePlatformPixmapSurface",
+    NULL,
+    "glShaderOp2EXT",
+    "glPNTrianglesiATI",
+    "glClearNamedFramebufferfi",
+    "glResolveDepthValuesNV",
+    "glDebugMessageInsertARB",
+    "glGetUniformuivEXT",
+    "glEvalCoord2dv",
+    "glGetInternalformatSampleivNV",
+    "glUniform4uiv",
+    NULL,
+    "glHintPGI",
+    "glMap1d",
+    "glEndQueryIndexed",
+    "glBlendEquationIndexedAMD",
+    "glProgramUniform2dv",
+    "glVertexAttrib2s",
+    "glAlphaFragmentOp1ATI",
+    NULL,
+    "glGetLocalConstantBooleanvEXT",
+    "glMemoryBarrier",
+    "glCompressedTextureSubImage2DEXT",
+    "glReplacementCodeuiTexCoord2fVertex3fSUN",
+    "glWindowPos2iARB",
+    NULL,
+    "glMultiTexCoord2sARB",
+    "glDeleteStatesNV",
+    NULL,
+    "glGetTexLevelParameteriv",
+    NULL,
+    "glDeleteTransformFeedbacksNV",
+    NULL,
+    "glDebugMessageCallback",
+    "glGetTexParameterIuiv",
+    NULL,
+    "glDeleteObjectARB",
+    "glGetBufferPointerv",
+    "glTexParameterxvOES",
+    "glGetPixelTransformParameterivEXT",
+    "eglQuerySupportedCompressionRatesEXT",
+    "glIsVariantEnabledEXT",
+    "glTexCoord3bOES",
+    "glMultiTexCoord2bvOES",
+    "glProgramUniform2ui64ARB",
+    "glMultiTexCoord3dv",
+    "glMulticastScissorArrayvNVX",
+    "glStencilOpSeparate",
+    "glProgramUniform2uivEXT",
+    "glClearBufferuiv",
+    NULL,
+    NULL,
+    "glUnlockArraysEXT",
+    "glCheckFramebufferStatusEXT",
+    "glVertexAttribFormat",
+    "glEndTransformFeedbackNV",
+    NULL,
+    "glMatrixTranslatedEXT",
+    "glLightxOES",
+    "glIsMemoryObjectEXT",
+    "glIsPointInStrokePathNV",
+    NULL,
+    "glEnableIndexedEXT",
+    "glIsImageHandleResidentNV",
+    "glFlushStaticDataIBM",
+    "glTexCoord4f",
+    "glGetObjectLabelEXT",
+    NULL,
+    "glDeleteFencesAPPLE",
+    "glVertexAttrib4NuivARB",
+    "glVertex4hNV",
+    "glGetnHistogram",
+    NULL,
+    "glUniform3i64ARB",
+    "glTexCoord1fv",
+    "glBlendEquationSeparateIndexedAMD",
+    "glProgramUniform4ui64vNV",
+    "glMultiDrawElements",
+    NULL,
+    NULL,
+    NULL,
+    "glBufferAttachMemoryNV",
+    NULL,
+    NULL,
+    "glMultiTexCoord3xvOES",
+    "glMultiTexCoord2ivARB",
+    "glVertexAttribI3i",
+    "glColor4bv",
+    "glColor4xOES",
+    "glIsBuffer",
+    "glGetVertexAttribdvNV",
+    "glGetMaterialfv",
+    "glTexCoord2f",
+    "glEvaluateDepthValuesARB",
+    "glGetNamedProgramLocalParameterIuivEXT",
+    "glCreateCommandListsNV",
+    "glRasterPos3f",
+    NULL,
+    "glColor4ubVertex2fSUN",
+    "glGetColorTableParameterivEXT",
+    "glVertexAttribI4sv",
+    "glVertexAttribP2uiv",
+    "glSampleMaskIndexedNV",
+    "glWindowPos3iMESA",
+    "glVertexAttrib2sARB",
+    "glBlendFuncSeparate",
+    "glTexCoordP3uiv",
+    "glPresentFrameKeyedNV",
+    "glGetnUniformfvARB",
+    "glDeleteFragmentShaderATI",
+    NULL,
+    "glWindowPos2ivARB",
+    NULL,
+    "glIndexxvOES",
+    NULL,
+    NULL,
+    "glMultiDrawArraysIndirectAMD",
+    "glProgramUniform2uiEXT",
+    "glColor4d",
+    "glMultiTexCoord1bvOES",
+    "glUniform3fvARB",
+    "glColor3b",
+    "eglResetStreamNV",
+    "glGetDoublei_v",
+    "glSecondaryColor3bv",
+    "glVertexAttribL4ui64vNV",
+    NULL,
+    NULL,
+    "glVertexAttrib1fvNV",
+    "glLoadName",
+    "glCompressedTexSubImage2D",
+    "glGetConvolutionFilterEXT",
+    "glWindowPos2iMESA",
+    "glGetLocalConstantIntegervEXT",
+    "glNormalPointerEXT",
+    NULL,
+    "glColorMaterial",
+    "glVertexAttribIPointerEXT",
+    "glMatrixLoadTransposedEXT",
+    "glProgramUniformMatrix2fvEXT",
+    "glMultiTexCoord1iv",
+    "glPixelTexGenParameterfSGIS",
+    "eglGetNextFrameIdANDROID",
+    "glSignalVkFenceNV",
+    NULL,
+    "glGetDoubleIndexedvEXT",
+    "glColor4fv",
+    "glGetActiveUniformBlockiv",
+    "glCopyTextureSubImage2D",
+    "glColor4sv",
+    "glMultiTexCoordP1ui",
+    "glGetPixelMapusv",
+    "glWindowPos3iARB",
+    "glGetLocalConstantFloatvEXT",
+    "glGetCompressedTexImageARB",
+    "glProgramUniform2i64vARB",
+    "glGetMapxvOES",
+    NULL,
+    "glProgramUniform4ui64ARB",
+    "glProgramUniformMatrix2x3dvEXT",
+    "glGetUniformBufferSizeEXT",
+    "glGetnUniformdvARB",
+    NULL,
+    "glTangent3fEXT",
+    "glStencilFuncSeparateATI",
+    "glVertexArrayVertexOffsetEXT",
+    NULL,
+    NULL,
+    "glGetVertexAttribLdvEXT",
+    NULL,
+    NULL,
+    "glIsCommandListNV",
+    "glProgramNamedParameter4dvNV",
+    "glGetMemoryObjectDetachedResourcesuivNV",
+    NULL,
+    "glUniform2uiv",
+    "glNamedBufferStorageEXT",
+    "glClipPlanexOES",
+    "glVertexArrayVertexAttribLFormatEXT",
+    "glCombinerParameterivNV",
+    "glEnableVertexAttribAPPLE",
+    "glClientActiveTextureARB",
+    NULL,
+    NULL,
+    "glQueryCounter",
+    "glGetProgramInfoLog",
+    NULL,
+    "glRasterPos4fv",
+    "eglGetConfigs",
+    "glHint",
+    "glDeleteFramebuffersEXT",
+    "glProgramUniform4i64vARB",
+    "glProgramNamedParameter4fNV",
+    "glConvolutionParameterxvOES",
+    "glProgramUniformMatrix3x2dvEXT",
+    "glFeedbackBufferxOES",
+    "glProgramUniform1iEXT",
+    NULL,
+    "glGetFixedvOES",
+    "glGetnColorTableARB",
+    "glReplacementCodeuiColor4ubVertex3fvSUN",
+    "glProgramEnvParameter4fvARB",
+    NULL,
+    "glBindRenderbuffer",
+    "glColor4usv",
+    "glPointParameteriNV",
+    "glBufferPageCommitmentARB",
+    "glNamedFramebufferTexture1DEXT",
+    "eglGetDisplay",
+    NULL,
+    "glVariantArrayObjectATI",
+    "eglQuerySurfacePointerANGLE",
+    "glCoverFillPathNV",
+    "glVertexAttribP1uiv",
+    "glMulticastCopyBufferSubDataNV",
+    "glGetPathDashArrayNV",
+    NULL,
+    "glVertexStream2dvATI",
+    "glGetTransformFeedbacki_v",
+    NULL,
+    "glNamedFramebufferSampleLocationsfvNV",
+    "glNamedFramebufferParameteri",
+    "glClearNamedFramebufferfv",
+    "glShaderSource",
+    NULL,
+    NULL,
+    "glColor3usv",
+    "glGetPixelTexGenParameterfvSGIS",
+    "glTexGenf",
+    "glColor4uiv",
+    NULL,
+    "glTexImage2DMultisample",
+    "glVertexAttrib3fv",
+    "glOrtho",
+    NULL,
+    "glGenQueryResourceTagNV",
+    NULL,
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glGetBufferParameterivARB",
+    "glGetDoublev",
+    NULL,
+    "glProgramUniform4uiv",
+    "glCombinerParameterfvNV",
+    "glActiveProgramEXT",
+    "glBindProgramPipeline",
+    "glFramebufferParameteri",
+    "glLabelObjectEXT",
+    "glIsFramebufferEXT",
+    NULL,
+    NULL,
+    "glAreProgramsResidentNV",
+    "glUniformMatrix3fv",
+    "glWindowPos2dARB",
+    "glColor3hNV",
+    "glVertexAttrib3dvARB",
+    NULL,
+    NULL,
+    NULL,
+    "glBlendColor",
+    NULL,
+    NULL,
+    "glCompileShaderIncludeARB",
+    "glTangentPointerEXT",
+    "glGetQueryObjecti64v",
+    "glRasterPos4xOES",
+    "eglDestroySyncNV",
+    "glVertexArrayRangeNV",
+    NULL,
+    "glVertexAttrib1dv",
+    "glColor4f",
+    NULL,
+    "eglGetCompositorTimingSupportedANDROID",
+    "glVertexAttribL2dEXT",
+    NULL,
+    "glTexCoordP2uiv",
+    "glIndexMaterialEXT",
+    NULL,
+    "glUniform2fARB",
+    "glCompressedTexImage1DARB",
+    NULL,
+    NULL,
+    "glTexCoordP4uiv",
+    "eglCreateContext",
+    "glMapGrid2f",
+    "glVertex2iv",
+    "glMultiTexCoord3d",
+    "glBufferSubDataARB",
+    "glFinishAsyncSGIX",
+    "glTextureParameterivEXT",
+    "glGetCombinerOutputParameterivNV",
+    "glProgramUniform2f",
+    NULL,
+    "glWindowPos2dv",
+    NULL,
+    "glProgramUniformMatrix3fvEXT",
+    "glProgramUniformMatrix3x2fv",
+    "glReplacementCodeuiSUN",
+    "glBeginQueryARB",
+    "glNamedBufferStorage",
+    "eglCreateStreamSyncNV",
+    "glGetVariantBooleanvEXT",
+    "glDeleteFramebuffers",
+    NULL,
+    "glUniform2i64ARB",
+    "glPushMatrix",
+    "glFlushVertexArrayRangeNV",
+    "glGetTextureHandleNV",
+    "glAcquireKeyedMutexWin32EXT",
+    "glColor4b",
+    NULL,
+    NULL,
+    "glTexAttachMemoryNV",
+    "glMultiTexCoord2d",
+    NULL,
+    "glMultiTexCoord2bOES",
+    "glVariantubvEXT",
+    NULL,
+    "glClearNamedBufferSubData",
+    "glMultiTexCoord2iv",
+    NULL,
+    "glGetHistogram",
+    NULL,
+    "glVertexFormatNV",
+    NULL,
+    "glUniform1f",
+    "glLGPUInterlockNVX",
+    "glUniform3i64vARB",
+    "glMultiTexCoord1s",
+    "glFinishFenceAPPLE",
+    "glValidateProgramARB",
+    "glDeleteBuffersARB",
+    "glGetActiveAttrib",
+    "glGetSemaphoreParameterui64vEXT",
+    NULL,
+    "glIsShader",
+    NULL,
+    "glGetnMapiv",
+    NULL,
+    "glGetTextureSamplerHandleNV",
+    "eglGetPlatformDisplayEXT",
+    "glDeleteSamplers",
+    NULL,
+    NULL,
+    "glMultiTexParameterfvEXT",
+    "glPixelZoomxOES",
+    "glIndexPointerListIBM",
+    "glSecondaryColor3ui",
+    "glGetProgramEnvParameterIuivNV",
+    "glEndOcclusionQueryNV",
+    "glUniformMatrix3dv",
+    "glVertexWeightPointerEXT",
+    NULL,
+    "eglQueryWaylandBufferWL",
+    NULL,
+    NULL,
+    "glUniform4ui",
+    "glSampleMapATI",
+    "glProgramUniform4ui",
+    "glEvalCoord2xOES",
+    NULL,
+    "glMultiTexCoord4bOES",
+    "glBindBufferBase",
+    "eglCompositorSetSizeEXT",
+    "glBindShadingRateImageNV",
+    "glBlendFunc",
+    "glBeginConditionalRender",
+    "glVertexPointerListIBM",
+    NULL,
+    "glTextureImage2DEXT",
+    "glDrawElementsInstancedARB",
+    "glNormalPointer",
+    "glTrackMatrixNV",
+    "eglLockSurfaceKHR",
+    NULL,
+    "glLGPUNamedBufferSubDataNVX",
+    "glMultiTexCoord4s",
+    "glNamedBufferSubData",
+    "glNamedBufferAttachMemoryNV",
+    "glGetnUniformuiv",
+    NULL,
+    "glCopyTexSubImage2DEXT",
+    "glTexStorageMem2DMultisampleEXT",
+    "glSeparableFilter2DEXT",
+    "glGetTextureLevelParameteriv",
+    "glProgramUniform3dEXT",
+    "glVertexAttrib1s",
+    "glGenFramebuffersEXT",
+    "glRasterPos3iv",
+    "glTexImage3DEXT",
+    "glFogCoordfvEXT",
+    "glNamedFramebufferDrawBuffer",
+    "glGetActiveAtomicCounterBufferiv",
+    NULL,
+    "glDeleteSync",
+    "glMultiTexCoord4d",
+    "glObjectLabel",
+    "glTextureParameteri",
+    NULL,
+    NULL,
+    "glCompressedTexImage3D",
+    "glGetConvolutionParameterfvEXT",
+    NULL,
+    "eglGetPlatformDisplay",
+    "glCombinerParameteriNV",
+    "glBindBufferRange",
+    "glDisableVertexAttribArrayARB",
+    NULL,
+    "glBlendBarrierKHR",
+    NULL,
+    "glTexCoord4bOES",
+    "glVertexAttribFormatNV",
+    "glPushGroupMarkerEXT",
+    "glTextureBufferEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glPointParameterf",
+    NULL,
+    "glTexCoord3xOES",
+    "glGetVertexAttribPointervARB",
+    "glVertexAttribs3dvNV",
+    NULL,
+    "glMaxShaderCompilerThreadsARB",
+    "glVertexAttribI2ivEXT",
+    NULL,
+    NULL,
+    "glCreateShader",
+    "glMultiTexCoord4sARB",
+    "glMatrixMultTransposedEXT",
+    "glFragmentLightModelfSGIX",
+    NULL,
+    "glMultiTexCoord3fv",
+    "glMultiDrawMeshTasksIndirectEXT",
+    "glGetTextureLevelParameterivEXT",
+    "glRasterPos4sv",
+    "glMultiTexRenderbufferEXT",
+    "glColor4ubv",
+    "glClampColor",
+    "glVertexStream2dATI",
+    "glBindSampler",
+    "glVertexAttrib2d",
+    NULL,
+    "glIndexMask",
+    "glFlushMappedNamedBufferRange",
+    NULL,
+    "glNormal3s",
+    NULL,
+    NULL,
+    "glVertexStream4dATI",
+    "glVertexAttribL2i64NV",
+    "glColor3iv",
+    "glGetIntegeri_v",
+    "glVertexAttribL4i64NV",
+    NULL,
+    "glUnmapNamedBufferEXT",
+    NULL,
+    "glCompressedTexSubImage3DARB",
+    NULL,
+    NULL,
+    "glCullFace",
+    "glPixelMapuiv",
+    NULL,
+    "glFrameZoomSGIX",
+    "glVertexAttribL3ui64vNV",
+    "glTextureStorageMem3DMultisampleEXT",
+    "glSecondaryColor3i",
+    "eglGetOutputPortsEXT",
+    NULL,
+    "glProgramBinary",
+    "glBlendEquationSeparateiARB",
+    NULL,
+    "glUniform4i64NV",
+    NULL,
+    "glIndexfv",
+    "glVertexAttribL4i64vNV",
+    "glGetTextureParameterIivEXT",
+    "glProgramUniform1i",
+    "eglPresentationTimeANDROID",
+    "glVertexArrayEdgeFlagOffsetEXT",
+    NULL,
+    "glGetAttribLocation",
+    "glVertexAttribs1svNV",
+    NULL,
+    "glWindowPos2sv",
+    "glLoadTransposeMatrixfARB",
+    "glNamedStringARB",
+    "eglBindWaylandDisplayWL",
+    "glVertexAttrib1d",
+    "glPixelTexGenSGIX",
+    "glGetnUniformuivARB",
+    NULL,
+    "glNamedBufferData",
+    "glClearColorIiEXT",
+    "glDisableVariantClientStateEXT",
+    "glCopyTextureImage2DEXT",
+    "glSwizzleEXT",
+    "glUniform2d",
+    "glEndTransformFeedback",
+    "glGetHandleARB",
+    "glProgramUniformMatrix4fvEXT",
+    "glVertexAttribI4ubv",
+    "glGetQueryObjectui64vEXT",
+    "glDrawMeshTasksIndirectEXT",
+    "glIsSampler",
+    "glMapVertexAttrib1fAPPLE",
+    "glDisableClientStateiEXT",
+    "glNormalPointerListIBM",
+    "glVertexAttrib4ivARB",
+    NULL,
+    "glGetNamedBufferParameterui64vNV",
+    "glBindAttribLocation",
+    "glWindowPos3svMESA",
+    "glDepthBoundsdNV",
+    NULL,
+    "glUniform3ui",
+    "glDrawMeshTasksIndirectNV",
+    "glNamedProgramLocalParameter4dEXT",
+    "glMultiTexCoord1hvNV",
+    "glFogCoorddvEXT",
+    NULL,
+    NULL,
+    "glGetConvolutionParameterfv",
+    NULL,
+    "glClearBufferiv",
+    "glTexParameteri",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glBindBufferBaseEXT",
+    NULL,
+    "glSecondaryColor3uivEXT",
+    "glLineWidth",
+    "glTexCoord1f",
+    "glVideoCaptureStreamParameterivNV",
+    "glSecondaryColorPointer",
+    "glBlendBarrierNV",
+    "glGenAsyncMarkersSGIX",
+    "glMultiTexCoord3hNV",
+    "glTransformFeedbackBufferRange",
+    "glTexImage3DMultisample",
+    "glColorMaskIndexedEXT",
+    "glProgramUniformMatrix4dv",
+    "glMatrixMode",
+    NULL,
+    "glGetTextureParameterIuiv",
+    NULL,
+    "glTextureStorageMem1DEXT",
+    "glGetNamedStringivARB",
+    "glDrawBuffer",
+    "glNormalStream3bATI",
+    "glActiveTexture",
+    "glMultiTexParameterfEXT",
+    "glShadingRateSampleOrderCustomNV",
+    "glGetSemaphoreParameterivNV",
+    "glGetQueryObjectuiv",
+    "glVertexArrayElementBuffer",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glShaderBinary",
+    "glMatrixMultTransposefEXT",
+    "glEvalCoord1d",
+    NULL,
+    "glPixelTexGenParameterfvSGIS",
+    NULL,
+    "glFogCoordhNV",
+    "glVertexAttribL2dvEXT",
+    "glProgramLocalParameter4dARB",
+    "glFlushMappedBufferRange",
+    "glLineWidthxOES",
+    "glGlobalAlphaFactordSUN",
+    "glPolygonOffset",
+    "eglCreateStreamProducerSurfaceKHR",
+    "glGetTexParameterPointervAPPLE",
+    "glWindowPos3sv",
+    "glFramebufferTextureLayerARB",
+    "glMultTransposeMatrixxOES",
+    NULL,
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glVertexAttribI3ivEXT",
+    "glListParameterivSGIX",
+    "glVertexAttrib4iv",
+    "glPathCoordsNV",
+    NULL,
+    "eglStreamConsumerAcquireKHR",
+    "glCreateShaderObjectARB",
+    NULL,
+    NULL,
+    NULL,
+    "glGetPerfQueryDataINTEL",
+    "glDepthRangeIndexed",
+    "glMultiTexCoord2dARB",
+    "glCopyMultiTexSubImage3DEXT",
+    NULL,
+    NULL,
+    "glVertexAttrib3fvNV",
+    "glProgramEnvParameters4fvEXT",
+    "glNamedProgramLocalParametersI4uivEXT",
+    "glUniform1dv",
+    "glSpecializeShader",
+    "glMakeImageHandleNonResidentNV",
+    "glVertexAttrib4hvNV",
+    "eglQueryDeviceBinaryEXT",
+    "glBindSamplers",
+    "glWaitVkSemaphoreNV",
+    "glMultTransposeMatrixdARB",
+    "glProgramUniform2dEXT",
+    "glUniform3dv",
+    "glProgramNamedParameter4dNV",
+    "glTexCoord2fColor4ubVertex3fvSUN",
+    "glGetFramebufferAttachmentParameteriv",
+    "glEvalPoint1",
+    "glPathColorGenNV",
+    "glVertex2xOES",
+    "glQueryResourceNV",
+    "glPNTrianglesfATI",
+    "glTexCoord1bvOES",
+    "glVertexBlendARB",
+    "glNamedBufferPageCommitmentMemNV",
+    "glProgramUniform3uivEXT",
+    "glMultiTexParameteriEXT",
+    "glVertexAttribI4bvEXT",
+    "glClientWaitSemaphoreui64NVX",
+    "glCompressedTextureSubImage1DEXT",
+    "glVertexArrayVertexAttribDivisorEXT",
+    "glMultiTexEnviEXT",
+    NULL,
+    "eglSwapBuffersRegion2NOK",
+    "glMulticastGetQueryObjectui64vNV",
+    "glIsNamedBufferResidentNV",
+    "glSamplerParameteri",
+    "glIsEnabledi",
+    "glBufferStorageExternalEXT",
+    "glVertexP2uiv",
+    NULL,
+    "glMatrixLoad3x3fNV",
+    "glWindowPos2i",
+    "eglQueryStreamu64KHR",
+    "glMultMatrixf",
+    "glProgramUniform1iv",
+    NULL,
+    "glGenNamesAMD",
+    "glBindMaterialParameterEXT",
+    "glProgramUniform3i64vNV",
+    "glIsFenceAPPLE",
+    "glProgramBufferParametersfvNV",
+    "glVertexAttribI4bv",
+    NULL,
+    NULL,
+    "glNormal3i",
+    NULL,
+    "glTexCoordP4ui",
+    "glMultiTexCoord1sARB",
+    "glMultiTexCoord1f",
+    "glConvolutionParameteriv",
+    "glIndexd",
+    "glVertexArrayAttribFormat",
+    "eglCreateStreamAttribKHR",
+    "glTexSubImage3D",
+    "glVertexAttribIFormat",
+    "glVertexAttrib2dNV",
+    NULL,
+    "glTexSubImage1DEXT",
+    NULL,
+    "glRenderbufferStorageMultisampleCoverageNV",
+    "glTexEnvxOES",
+    "glTangent3iEXT",
+    "glNamedRenderbufferStorageMultisampleAdvancedAMD",
+    "glCreateVertexArrays",
+    "glGetActiveVaryingNV",
+    "glEGLImageTargetTextureStorageEXT",
+    "glVertexAttrib2hNV",
+    "glGetAttachedObjectsARB",
+    "glLightf",
+    NULL,
+    "glMakeTextureHandleNonResidentARB",
+    "glBindProgramARB",
+    "glGetVertexAttribLi64vNV",
+    "glUniformMatrix2x3fv",
+    "glGetQueryIndexediv",
+    "glUniformMatrix4x3dv",
+    "glMultiDrawElementsIndirectAMD",
+    "glVariantbvEXT",
+    "glDeleteBuffers",
+    "glMatrixIndexubvARB",
+    "glProgramUniform1ui64NV",
+    "glWindowPos3sARB",
+    "glDrawPixels",
+    "glProgramUniform2ui",
+    "glMakeNamedBufferResidentNV",
+    NULL,
+    NULL,
+    "glTexBuffer",
+    "glTexCoordP3ui",
+    "glInvalidateSubFramebuffer",
+    NULL,
+    "glGetPathTexGenfvNV",
+    "glGetnCompressedTexImageARB",
+    "glMapGrid1d",
+    "glCopyConvolutionFilter2DEXT",
+    NULL,
+    "glGetArrayObjectivATI",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glVertex3hvNV",
+    "glGetVariantPointervEXT",
+    "glVertexAttribI1i",
+    "glClear",
+    NULL,
+    "glLightxvOES",
+    "glTexCoord2fv",
+    "glProgramUniformMatrix3fv",
+    NULL,
+    "glClientAttribDefaultEXT",
+    "glSelectBuffer",
+    NULL,
+    "eglCreateImage",
+    NULL,
+    "glGenQueries",
+    NULL,
+    NULL,
+    "glProgramLocalParameter4dvARB",
+    "glGetVertexAttribLdv",
+    "glVertexAttribL3i64vNV",
+    "glGetProgramLocalParameterdvARB",
+    "glUniform1uiv",
+    "glGetTexFilterFuncSGIS",
+    "glLoadProgramNV",
+    "glBindBufferARB",
+    "glVertexStream2fATI",
+    NULL,
+    "glUniform1fARB",
+    "glMakeTextureHandleResidentARB",
+    "glGetPathSpacingNV",
+    "glVertexStream4svATI",
+    "glIsSemaphoreEXT",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedFramebufferParameteriv",
+    NULL,
+    "glVertexAttribs2dvNV",
+    "eglQueryStreamKHR",
+    "glDrawTransformFeedbackInstanced",
+    "glImageTransformParameterivHP",
+    "glVertexAttrib4dvARB",
+    "glVertexAttribDivisorARB",
+    "glDeleteSemaphoresEXT",
+    "glDrawRangeElementsEXT",
+    "glBindFramebuffer",
+    "glBlendFuncSeparateIndexedAMD",
+    "eglQueryNativePixmapNV",
+    "glNormal3xOES",
+    "glGetMultiTexGenivEXT",
+    NULL,
+    NULL,
+    "glVertex3iv",
+    NULL,
+    "glVertexAttrib3fvARB",
+    "glMultiDrawMeshTasksIndirectNV",
+    "glSampleMaskEXT",
+    NULL,
+    "glRasterPos2fv",
+    "glGetImageHandleARB",
+    NULL,
+    "glSecondaryColor3ivEXT",
+    NULL,
+    "glScissorExclusiveArrayvNV",
+    "glDrawElementsInstancedEXT",
+    "glUniform4i64ARB",
+    "glProgramParameter4dvNV",
+    "glTextureImage3DMultisampleNV",
+    "glGetVertexAttribIuiv",
+    "glBeginOcclusionQueryNV",
+    "glTexCoord2dv",
+    "glPathCoverDepthFuncNV",
+    "glVertexAttrib4bvARB",
+    "glVertexAttribs3hvNV",
+    "glGenFencesNV",
+    NULL,
+    "glTexParameterIivEXT",
+    "glFogxOES",
+    "glColor4ubVertex3fSUN",
+    "glTexSubImage2DEXT",
+    "glNamedFramebufferTextureFaceEXT",
+    "glGetColorTableEXT",
+    "glGetPerfMonitorCounterInfoAMD",
+    "glTexCoord2fColor4fNormal3fVertex3fSUN",
+    NULL,
+    "glVertex2i",
+    "glNormal3fVertex3fSUN",
+    "glTexCoord1sv",
+    "glSamplePatternSGIS",
+    "glGetSubroutineIndex",
+    NULL,
+    "glVertexAttribs3svNV",
+    "glMinSampleShading",
+    "glGetFragDataLocation",
+    "glStopInstrumentsSGIX",
+    "glTextureParameteriv",
+    "glVertex4i",
+    "glBufferParameteriAPPLE",
+    "glEndTransformFeedbackEXT",
+    "glWaitSemaphoreEXT",
+    "eglCreatePlatformWindowSurfaceEXT",
+    NULL,
+    "glMultiTexImage3DEXT",
+    "glClipControl",
+    "glVertexAttribL4dv",
+    "glGenVertexArraysAPPLE",
+    NULL,
+    "glLoadTransposeMatrixf",
+    "eglSetStreamMetadataNV",
+    "glMultiTexCoord1fvARB",
+    "glUniform2i64NV",
+    "glVertexAttrib1fARB",
+    "glQueryObjectParameteruiAMD",
+    "glTexEnvxvOES",
+    "glVertexAttribI1iEXT",
+    NULL,
+    "glSecondaryColor3ubv",
+    "glTexGenfv",
+    "glProgramUniform3i64ARB",
+    "eglGetCurrentContext",
+    "glGetNamedProgramLocalParameterdvEXT",
+    "glVertex3f",
+    NULL,
+    NULL,
+    "glGetDebugMessageLogAMD",
+    "glUploadGpuMaskNVX",
+    NULL,
+    "glMapGrid1f",
+    "glSecondaryColor3ubvEXT",
+    "glPointParameterfSGIS",
+    "glTransformFeedbackAttribsNV",
+    "glUniform3ui64vARB",
+    "glCompressedTexSubImage1DARB",
+    NULL,
+    "glPushClientAttribDefaultEXT",
+    "glGetBufferPointervARB",
+    NULL,
+    "eglChooseConfig",
+    NULL,
+    "glUniform2i64vNV",
+    "glConvolutionFilter1DEXT",
+    "glGetMapiv",
+    "glMultiTexParameterivEXT",
+    "glFramebufferTexture2DEXT",
+    "glMultiTexCoord4fvARB",
+    "glVertexArrayBindVertexBufferEXT",
+    NULL,
+    "glTexPageCommitmentMemNV",
+    "glUniformBufferEXT",
+    "glLightiv",
+    "glTextureBuffer",
+    "glColor3fVertex3fvSUN",
+    "glMultiDrawElementsEXT",
+    NULL,
+    "glCoverageModulationNV",
+    "glCombinerOutputNV",
+    NULL,
+    "glSetMultisamplefvAMD",
+    "glGetVariantFloatvEXT",
+    "glTextureStorage2D",
+    "glRenderbufferStorageMultisampleEXT",
+    "eglOutputPortAttribEXT",
+    "glGetFragmentMaterialivSGIX",
+    "glVertexStream2svATI",
+    "glColorTableParameterfvSGI",
+    "glUniform2ui64ARB",
+    NULL,
+    "glGetQueryBufferObjectuiv",
+    "glGetConvolutionParameteriv",
+    "glProgramUniform3ui64vNV",
+    "glNormalStream3fvATI",
+    "glGetHistogramParameterivEXT",
+    "glMultiTexCoord3bvOES",
+    "glPushClientAttrib",
+    "glGetDoublei_vEXT",
+    "glGetTextureSamplerHandleARB",
+    NULL,
+    "glProgramUniform3i",
+    "glUniform4d",
+    "glColor3fVertex3fSUN",
+    "glFramebufferRenderbufferEXT",
+    NULL,
+    "glColorMaski",
+    NULL,
+    NULL,
+    NULL,
+    "glMultiTexGendEXT",
+    "glMulticastWaitSyncNV",
+    "glGetNamedBufferParameteri64v",
+    "glUniform4f",
+    "glConvolutionFilter2D",
+    "glVertex3sv",
+    "glTexParameterIuivEXT",
+    "glClearAccumxOES",
+    "glDisablei",
+    "glDrawArraysEXT",
+    NULL,
+    "glVertex2d",
+    "glVDPAUIsSurfaceNV",
+    NULL,
+    "glReadInstrumentsSGIX",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+    "glCoverStrokePathNV",
+    "glVertex3hNV",
+    "glCompressedMultiTexImage3DEXT",
+    NULL,
+    "glVertexArrayRangeAPPLE",
+    "glVertexAttrib1hNV",
+    "glShadingRateCombinerOpsEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glClearBufferfv",
+    NULL,
+    "glMatrixOrthoEXT",
+    "glClipPlane",
+    "glWeightdvARB",
+    "glTranslatef",
+    "glVertexAttribLPointer",
+    "glFragmentMaterialfSGIX",
+    "glTexCoord1hvNV",
+    NULL,
+    "glNamedFramebufferTexture3DEXT",
+    NULL,
+    "glResizeBuffersMESA",
+    NULL,
+    "glPopGroupMarkerEXT",
+    "glGetNamedFramebufferParameterfvAMD",
+    NULL,
+    "glMultiTexCoord3fARB",
+    "glGetActiveUniformsiv",
+    NULL,
+    NULL,
+    "glCompressedTextureImage2DEXT",
+    "glTexStorage3D",
+    "glGetnMapfvARB",
+    "glSecondaryColor3sEXT",
+    "glFrustumfOES",
+    NULL,
+    "glDrawElementsBaseVertex",
+    "glUniform2ui64vNV",
+    "glGetVertexAttribLui64vNV",
+    "glActiveShaderProgram",
+    "glPointParameterfvARB",
+    "glGetVariantIntegervEXT",
+    NULL,
+    "glGetnPolygonStippleARB",
+    "glSignalSemaphoreEXT",
+    "glVertexAttribArrayObjectATI",
+    "glGetUniformiv",
+    "eglUnlockSurfaceKHR",
+    "glGetFramebufferParameterfvAMD",
+    "glShadingRateImagePaletteNV",
+    NULL,
+    "glVertexAttribL4dEXT",
+    "glGetUniformui64vNV",
+    NULL,
+    NULL,
+    "glTexStorage2DMultisample",
+    "glMapVertexAttrib2fAPPLE",
+    "eglPostSubBufferNV",
+    "glClearNamedBufferDataEXT",
+    NULL,
+    NULL,
+    "glDisableVertexArrayAttribEXT",
+    NULL,
+    "glVertexArrayAttribBinding",
+    NULL,
+    "glVertexAttrib3f",
+    "glArrayElement",
+    "glFogFuncSGIS",
+    "glVertexStream1dvATI",
+    "glMultiTexCoord1xOES",
+    "glVertex3xvOES",
+    "glVertexAttrib2dARB",
+    "glGetShaderInfoLog",
+    "glNamedBufferSubDataEXT",
+    "glGetActiveUniformBlockName",
+    "glStencilOp",
+    NULL,
+    "glMap2f",
+    "glIsBufferARB",
+    "glObjectUnpurgeableAPPLE",
+    "eglOutputLayerAttribEXT",
+    "glGetProgramResourceName",
+    "glGetBooleanIndexedvEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glIsEnabled",
+    NULL,
+    NULL,
+    "glTangent3sEXT",
+    "glInvalidateTexSubImage",
+    "glImportSemaphoreWin32NameEXT",
+    "glTextureStorage3DMultisample",
+    "glClientActiveVertexStreamATI",
+    NULL,
+    "glDepthRange",
+    NULL,
+    "glPopClientAttrib",
+    "glTextureImage1DEXT",
+    NULL,
+    "glGetMinmax",
+    "glDrawRangeElements",
+    "glColorSubTable",
+    "glHistogramEXT",
+    "glDebugMessageInsert",
+    "glMultiTexCoord1fARB",
+    "glWindowPos4fMESA",
+    NULL,
+    "glSyncTextureINTEL",
+    NULL,
+    "glVertexArrayNormalOffsetEXT",
+    "eglCompositorSwapPolicyEXT",
+    "glPointParameterfvSGIS",
+    NULL,
+    "glUniformMatrix2x3dv",
+    "glColor3f",
+    "glVertexAttrib3d",
+    "glBeginVertexShaderEXT",
+    "glMakeImageHandleResidentARB",
+    "glGetnMinmaxARB",
+    "glVertexStream1iATI",
+    NULL,
+    "glClientActiveTexture",
+    "glAccumxOES",
+    "glColorTableParameterivSGI",
+    "glBindTexture",
+    "glBufferStorageMemEXT",
+    "eglGetOutputLayersEXT",
+    NULL,
+    NULL,
+    "eglQueryDmaBufModifiersEXT",
+    "glColor3us",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glFramebufferTextureFaceEXT",
+    "glMaterialf",
+    "glMulticastBufferSubDataNV",
+    "glVariantPointerEXT",
+    "glVertexWeighthvNV",
+    "glMulticastBlitFramebufferNV",
+    NULL,
+    "glWindowPos3fvARB",
+    "glMultiTexCoord2fv",
+    "eglDestroyDisplayEXT",
+    "glStencilStrokePathInstancedNV",
+    "glHistogram",
+    "eglSwapBuffersWithDamageKHR",
+    "glVertexAttribs1fvNV",
+    NULL,
+    "glWindowPos3fMESA",
+    "glTexSubImage2D",
+    "glBlendParameteriNV",
+    "glCompileShaderARB",
+    "glVertexArrayAttribLFormat",
+    NULL,
+    "glProgramUniform3ui64ARB",
+    "glCompressedMultiTexSubImage1DEXT",
+    "glVertex2bOES",
+    "glColor4hvNV",
+    "glTexEnvi",
+    "glFogCoordFormatNV",
+    "glTexGeniv",
+    NULL,
+    "glFramebufferTextureLayerEXT",
+    "glGetShaderSource",
+    "glGetVideoi64vNV",
+    "glVertexAttribDivisor",
+    "glWindowPos2d",
+    "glVertexAttrib4usv",
+    NULL,
+    NULL,
+    "glRectdv",
+    "glFogi",
+    NULL,
+    NULL,
+    "glProgramUniform1i64ARB",
+    "glProgramUniform1ui64ARB",
+    "glReleaseKeyedMutexWin32EXT",
+    NULL,
+    "glCompressedTextureSubImage3D",
+    "glVertexAttribLFormatNV",
+    NULL,
+    "glUniform4fvARB",
+    "glTexCoord2fVertex3fvSUN",
+    "eglCreateFenceSyncNV",
+    NULL,
+    "glVariantuivEXT",
+    "glResetMemoryObjectParameterNV",
+    "glVDPAUInitNV",
+    NULL,
+    NULL,
+    NULL,
+    "glTextureStorage2DMultisample",
+    "glGetVkProcAddrNV",
+    "glObjectPtrLabel",
+    NULL,
+    "glMapGrid1xOES",
+    "glGetPixelTransformParameterfvEXT",
+    "glVertexAttribIPointer",
+    "glProgramParameteriEXT",
+    "glPointParameterxvOES",
+    NULL,
+    "glDrawTextureNV",
+    "glResetHistogramEXT",
+    "glEvalCoord1dv",
+    NULL,
+    "glGetError",
+    "glVertexAttribL3ui64NV",
+    "glBufferData",
+    "glGetUniformi64vARB",
+    NULL,
+    NULL,
+    "glSamplePatternEXT",
+    "glPrimitiveBoundingBoxARB",
+    "glVertexArrayColorOffsetEXT",
+    "glDrawMeshArraysSUN",
+    "glVertexAttribI2uiEXT",
+    NULL,
+    NULL,
+    "glDeleteProgram",
+    "glGetNamedBufferSubData",
+    "glVertexAttribI3iEXT",
+    NULL,
+    NULL,
+    "glQueryResourceTagNV",
+    "glGetTexGendv",
+    "glProgramUniformMatrix2dvEXT",
+    NULL,
+    "glPixelStorex",
+    "glTangent3dEXT",
+    "glProgramEnvParameter4dvARB",
+    "eglQueryOutputPortAttribEXT",
+    NULL,
+    "glFramebufferTextureLayer",
+    "eglMakeCurrent",
+    "glNewObjectBufferATI",
+    NULL,
+    "glVertexStream4fvATI",
+    "glGetColorTableParameterfv",
+    "glBindTexGenParameterEXT",
+    "glProgramUniformMatrix4x2dvEXT",
+    "glTexturePageCommitmentEXT",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glUniformMatrix4dv",
+    "glInsertEventMarkerEXT",
+    NULL,
+    "glVertexAttrib4NusvARB",
+    "glVertexAttribP3uiv",
+    NULL,
+    NULL,
+    "glLoadIdentity",
+    NULL,
+    "glTranslatexOES",
+    "glProgramStringARB",
+    "eglGetConfigAttrib",
+    "glTexCoord2hNV",
+    "glMatrixIndexuivARB",
+    "glRects",
+    "glTexParameterIiv",
+    "glVertexAttrib2dvARB",
+    "glVertex4xvOES",
+    NULL,
+    "glVertex2dv",
+    "glUnmapTexture2DINTEL",
+};
+
@@ -0,0 +1,160 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Dense index of every WGL entry point: the slot of the entry point in
+ * the dispatch tables of glatter_def.h. The entry points a render loop calls
+ * every frame come first, the rest follow in name order. */
+enum glatter_fn_WGL {
+    GLATTER_FN_wglMakeContextCurrentARB,
+    GLATTER_FN_wglSwapIntervalEXT,
+    GLATTER_FN_wglAllocateMemoryNV,
+    GLATTER_FN_wglAssociateImageBufferEventsI3D,
+    GLATTER_FN_wglBeginFrameTrackingI3D,
+    GLATTER_FN_wglBindDisplayColorTableEXT,
+    GLATTER_FN_wglBindSwapBarrierNV,
+    GLATTER_FN_wglBindTexImageARB,
+    GLATTER_FN_wglBindVideoCaptureDeviceNV,
+    GLATTER_FN_wglBindVideoDeviceNV,
+    GLATTER_FN_wglBindVideoImageNV,
+    GLATTER_FN_wglBlitContextFramebufferAMD,
+    GLATTER_FN_wglChoosePixelFormatARB,
+    GLATTER_FN_wglChoosePixelFormatEXT,
+    GLATTER_FN_wglCopyImageSubDataNV,
+    GLATTER_FN_wglCreateAffinityDCNV,
+    GLATTER_FN_wglCreateAssociatedContextAMD,
+    GLATTER_FN_wglCreateAssociatedContextAttribsAMD,
+    GLATTER_FN_wglCreateBufferRegionARB,
+    GLATTER_FN_wglCreateContextAttribsARB,
+    GLATTER_FN_wglCreateDisplayColorTableEXT,
+    GLATTER_FN_wglCreateImageBufferI3D,
+    GLATTER_FN_wglCreatePbufferARB,
+    GLATTER_FN_wglCreatePbufferEXT,
+    GLATTER_FN_wglDXCloseDeviceNV,
+    GLATTER_FN_wglDXLockObjectsNV,
+    GLATTER_FN_wglDXObjectAccessNV,
+    GLATTER_FN_wglDXOpenDeviceNV,
+    GLATTER_FN_wglDXRegisterObjectNV,
+    GLATTER_FN_wglDXSetResourceShareHandleNV,
+    GLATTER_FN_wglDXUnlockObjectsNV,
+    GLATTER_FN_wglDXUnregisterObjectNV,
+    GLATTER_FN_wglDelayBeforeSwapNV,
+    GLATTER_FN_wglDeleteAssociatedContextAMD,
+    GLATTER_FN_wglDeleteBufferRegionARB,
+    GLATTER_FN_wglDeleteDCNV,
+    GLATTER_FN_wglDestroyDisplayColorTableEXT,
+    GLATTER_FN_wglDestroyImageBufferI3D,
+    GLATTER_FN_wglDestroyPbufferARB,
+    GLATTER_FN_wglDestroyPbufferEXT,
+    GLATTER_FN_wglDisableFrameLockI3D,
+    GLATTER_FN_wglDisableGenlockI3D,
+    GLATTER_FN_wglEnableFrameLockI3D,
+    GLATTER_FN_wglEnableGenlockI3D,
+    GLATTER_FN_wglEndFrameTrackingI3D,
+    GLATTER_FN_wglEnumGpuDevicesNV,
+    GLATTER_FN_wglEnumGpusFromAffinityDCNV,
+    GLATTER_FN_wglEnumGpusNV,
+    GLATTER_FN_wglEnumerateVideoCaptureDevicesNV,
+    GLATTER_FN_wglEnumerateVideoDevicesNV,
+    GLATTER_FN_wglFreeMemoryNV,
+    GLATTER_FN_wglGenlockSampleRateI3D,
+    GLATTER_FN_wglGenlockSourceDelayI3D,
+    GLATTER_FN_wglGenlockSourceEdgeI3D,
+    GLATTER_FN_wglGenlockSourceI3D,
+    GLATTER_FN_wglGetContextGPUIDAMD,
+    GLATTER_FN_wglGetCurrentAssociatedContextAMD,
+    GLATTER_FN_wglGetCurrentReadDCARB,
+    GLATTER_FN_wglGetCurrentReadDCEXT,
+    GLATTER_FN_wglGetDigitalVideoParametersI3D,
+    GLATTER_FN_wglGetExtensionsStringARB,
+    GLATTER_FN_wglGetExtensionsStringEXT,
+    GLATTER_FN_wglGetFrameUsageI3D,
+    GLATTER_FN_wglGetGPUIDsAMD,
+    GLATTER_FN_wglGetGPUInfoAMD,
+    GLATTER_FN_wglGetGammaTableI3D,
+    GLATTER_FN_wglGetGammaTableParametersI3D,
+    GLATTER_FN_wglGetGenlockSampleRateI3D,
+    GLATTER_FN_wglGetGenlockSourceDelayI3D,
+    GLATTER_FN_wglGetGenlockSourceEdgeI3D,
+    GLATTER_FN_wglGetGenlockSourceI3D,
+    GLATTER_FN_wglGetMscRateOML,
+    GLATTER_FN_wglGetPbufferDCARB,
+    GLATTER_FN_wglGetPbufferDCEXT,
+    GLATTER_FN_wglGetPixelFormatAttribfvARB,
+    GLATTER_FN_wglGetPixelFormatAttribfvEXT,
+    GLATTER_FN_wglGetPixelFormatAttribivARB,
+    GLATTER_FN_wglGetPixelFormatAttribivEXT,
+    GLATTER_FN_wglGetSwapIntervalEXT,
+    GLATTER_FN_wglGetSyncValuesOML,
+    GLATTER_FN_wglGetVideoDeviceNV,
+    GLATTER_FN_wglGetVideoInfoNV,
+    GLATTER_FN_wglIsEnabledFrameLockI3D,
+    GLATTER_FN_wglIsEnabledGenlockI3D,
+    GLATTER_FN_wglJoinSwapGroupNV,
+    GLATTER_FN_wglLoadDisplayColorTableEXT,
+    GLATTER_FN_wglLockVideoCaptureDeviceNV,
+    GLATTER_FN_wglMakeAssociatedContextCurrentAMD,
+    GLATTER_FN_wglMakeContextCurrentEXT,
+    GLATTER_FN_wglQueryCurrentContextNV,
+    GLATTER_FN_wglQueryFrameCountNV,
+    GLATTER_FN_wglQueryFrameLockMasterI3D,
+    GLATTER_FN_wglQueryFrameTrackingI3D,
+    GLATTER_FN_wglQueryGenlockMaxSourceDelayI3D,
+    GLATTER_FN_wglQueryMaxSwapGroupsNV,
+    GLATTER_FN_wglQueryPbufferARB,
+    GLATTER_FN_wglQueryPbufferEXT,
+    GLATTER_FN_wglQuerySwapGroupNV,
+    GLATTER_FN_wglQueryVideoCaptureDeviceNV,
+    GLATTER_FN_wglReleaseImageBufferEventsI3D,
+    GLATTER_FN_wglReleasePbufferDCARB,
+    GLATTER_FN_wglReleasePbufferDCEXT,
+    GLATTER_FN_wglReleaseTexImageARB,
+    GLATTER_FN_wglReleaseVideoCaptureDeviceNV,
+    GLATTER_FN_wglReleaseVideoDeviceNV,
+    GLATTER_FN_wglReleaseVideoImageNV,
+    GLATTER_FN_wglResetFrameCountNV,
+    GLATTER_FN_wglRestoreBufferRegionARB,
+    GLATTER_FN_wglSaveBufferRegionARB,
+    GLATTER_FN_wglSendPbufferToVideoNV,
+    GLATTER_FN_wglSetDigitalVideoParametersI3D,
+    GLATTER_FN_wglSetGammaTableI3D,
+    GLATTER_FN_wglSetGammaTableParametersI3D,
+    GLATTER_FN_wglSetPbufferAttribARB,
+    GLATTER_FN_wglSetStereoEmitterState3DL,
+    GLATTER_FN_wglSwapBuffersMscOML,
+    GLATTER_FN_wglSwapLayerBuffersMscOML,
+    GLATTER_FN_wglWaitForMscOML,
+    GLATTER_FN_wglWaitForSbcOML,
+    GLATTER_FN_COUNT_WGL
+};
+
+/* Fingerprint of the order above, of the GLATTER_EXT_ bit positions and of the
+ * GLATTER_LIMIT_ slots. Two glatter builds share tables through
+ * GLATTER_SHARED_REGISTRY only if it matches. */
+#define GLATTER_FN_LAYOUT_WGL 0xf555e56cu
+
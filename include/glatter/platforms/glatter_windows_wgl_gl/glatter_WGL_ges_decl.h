@@ -27,137 +27,136 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 
-#ifndef GLATTER_LOOKUP_SIZE
-#define GLATTER_LOOKUP_SIZE 0x4000
+/* Reads one bit of an extension support bitset. */
+#ifndef GLATTER_EXTENSION_SUPPORTED
+#define GLATTER_EXTENSION_SUPPORTED(status, index) \
+    ((int)(((status)->bits[(index) >> 5] >> ((index) & 31)) & 1u))
 #endif
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4201)
-#endif
+/* Bit positions in glatter_extension_support_status_WGL_t::bits. */
+enum {
+    GLATTER_EXT_WGL_3DFX_multisample = 0,
+    GLATTER_EXT_WGL_3DL_stereo_control = 1,
+    GLATTER_EXT_WGL_AMD_gpu_association = 2,
+    GLATTER_EXT_WGL_ARB_buffer_region = 3,
+    GLATTER_EXT_WGL_ARB_context_flush_control = 4,
+    GLATTER_EXT_WGL_ARB_create_context = 5,
+    GLATTER_EXT_WGL_ARB_create_context_no_error = 6,
+    GLATTER_EXT_WGL_ARB_create_context_profile = 7,
+    GLATTER_EXT_WGL_ARB_create_context_robustness = 8,
+    GLATTER_EXT_WGL_ARB_extensions_string = 9,
+    GLATTER_EXT_WGL_ARB_framebuffer_sRGB = 10,
+    GLATTER_EXT_WGL_ARB_make_current_read = 11,
+    GLATTER_EXT_WGL_ARB_multisample = 12,
+    GLATTER_EXT_WGL_ARB_pbuffer = 13,
+    GLATTER_EXT_WGL_ARB_pixel_format = 14,
+    GLATTER_EXT_WGL_ARB_pixel_format_float = 15,
+    GLATTER_EXT_WGL_ARB_render_texture = 16,
+    GLATTER_EXT_WGL_ARB_robustness_application_isolation = 17,
+    GLATTER_EXT_WGL_ARB_robustness_share_group_isolation = 18,
+    GLATTER_EXT_WGL_ATI_pixel_format_float = 19,
+    GLATTER_EXT_WGL_ATI_render_texture_rectangle = 20,
+    GLATTER_EXT_WGL_EXT_colorspace = 21,
+    GLATTER_EXT_WGL_EXT_create_context_es2_profile = 22,
+    GLATTER_EXT_WGL_EXT_create_context_es_profile = 23,
+    GLATTER_EXT_WGL_EXT_depth_float = 24,
+    GLATTER_EXT_WGL_EXT_display_color_table = 25,
+    GLATTER_EXT_WGL_EXT_extensions_string = 26,
+    GLATTER_EXT_WGL_EXT_framebuffer_sRGB = 27,
+    GLATTER_EXT_WGL_EXT_make_current_read = 28,
+    GLATTER_EXT_WGL_EXT_multisample = 29,
+    GLATTER_EXT_WGL_EXT_pbuffer = 30,
+    GLATTER_EXT_WGL_EXT_pixel_format = 31,
+    GLATTER_EXT_WGL_EXT_pixel_format_packed_float = 32,
+    GLATTER_EXT_WGL_EXT_swap_control = 33,
+    GLATTER_EXT_WGL_EXT_swap_control_tear = 34,
+    GLATTER_EXT_WGL_I3D_digital_video_control = 35,
+    GLATTER_EXT_WGL_I3D_gamma = 36,
+    GLATTER_EXT_WGL_I3D_genlock = 37,
+    GLATTER_EXT_WGL_I3D_image_buffer = 38,
+    GLATTER_EXT_WGL_I3D_swap_frame_lock = 39,
+    GLATTER_EXT_WGL_I3D_swap_frame_usage = 40,
+    GLATTER_EXT_WGL_NV_DX_interop = 41,
+    GLATTER_EXT_WGL_NV_DX_interop2 = 42,
+    GLATTER_EXT_WGL_NV_copy_image = 43,
+    GLATTER_EXT_WGL_NV_delay_before_swap = 44,
+    GLATTER_EXT_WGL_NV_float_buffer = 45,
+    GLATTER_EXT_WGL_NV_gpu_affinity = 46,
+    GLATTER_EXT_WGL_NV_multigpu_context = 47,
+    GLATTER_EXT_WGL_NV_multisample_coverage = 48,
+    GLATTER_EXT_WGL_NV_present_video = 49,
+    GLATTER_EXT_WGL_NV_render_depth_texture = 50,
+    GLATTER_EXT_WGL_NV_render_texture_rectangle = 51,
+    GLATTER_EXT_WGL_NV_swap_group = 52,
+    GLATTER_EXT_WGL_NV_vertex_array_range = 53,
+    GLATTER_EXT_WGL_NV_video_capture = 54,
+    GLATTER_EXT_WGL_NV_video_output = 55,
+    GLATTER_EXT_WGL_OML_sync_control = 56,
+    GLATTER_EXT_COUNT_WGL = 57
+};
 
+/* One bit per extension, indexed by GLATTER_EXT_* above. */
 typedef struct glatter_extension_support_status_WGL
 {
-        int has_WGL_3DFX_multisample;
-        int has_WGL_3DL_stereo_control;
-        int has_WGL_AMD_gpu_association;
-        int has_WGL_ARB_buffer_region;
-        int has_WGL_ARB_context_flush_control;
-        int has_WGL_ARB_create_context;
-        int has_WGL_ARB_create_context_no_error;
-        int has_WGL_ARB_create_context_profile;
-        int has_WGL_ARB_create_context_robustness;
-        int has_WGL_ARB_extensions_string;
-        int has_WGL_ARB_framebuffer_sRGB;
-        int has_WGL_ARB_make_current_read;
-        int has_WGL_ARB_multisample;
-        int has_WGL_ARB_pbuffer;
-        int has_WGL_ARB_pixel_format;
-        int has_WGL_ARB_pixel_format_float;
-        int has_WGL_ARB_render_texture;
-        int has_WGL_ARB_robustness_application_isolation;
-        int has_WGL_ARB_robustness_share_group_isolation;
-        int has_WGL_ATI_pixel_format_float;
-        int has_WGL_ATI_render_texture_rectangle;
-        int has_WGL_EXT_colorspace;
-        int has_WGL_EXT_create_context_es2_profile;
-        int has_WGL_EXT_create_context_es_profile;
-        int has_WGL_EXT_depth_float;
-        int has_WGL_EXT_display_color_table;
-        int has_WGL_EXT_extensions_string;
-        int has_WGL_EXT_framebuffer_sRGB;
-        int has_WGL_EXT_make_current_read;
-        int has_WGL_EXT_multisample;
-        int has_WGL_EXT_pbuffer;
-        int has_WGL_EXT_pixel_format;
-        int has_WGL_EXT_pixel_format_packed_float;
-        int has_WGL_EXT_swap_control;
-        int has_WGL_EXT_swap_control_tear;
-        int has_WGL_I3D_digital_video_control;
-        int has_WGL_I3D_gamma;
-        int has_WGL_I3D_genlock;
-        int has_WGL_I3D_image_buffer;
-        int has_WGL_I3D_swap_frame_lock;
-        int has_WGL_I3D_swap_frame_usage;
-        int has_WGL_NV_DX_interop;
-        int has_WGL_NV_DX_interop2;
-        int has_WGL_NV_copy_image;
-        int has_WGL_NV_delay_before_swap;
-        int has_WGL_NV_float_buffer;
-        int has_WGL_NV_gpu_affinity;
-        int has_WGL_NV_multigpu_context;
-        int has_WGL_NV_multisample_coverage;
-        int has_WGL_NV_present_video;
-        int has_WGL_NV_render_depth_texture;
-        int has_WGL_NV_render_texture_rectangle;
-        int has_WGL_NV_swap_group;
-        int has_WGL_NV_vertex_array_range;
-        int has_WGL_NV_video_capture;
-        int has_WGL_NV_video_output;
-        int has_WGL_OML_sync_control;
+    uint32_t bits[2];
 } glatter_extension_support_status_WGL_t;
 
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-
-#define glatter_WGL_3DFX_multisample glatter_get_extension_support_WGL().has_WGL_3DFX_multisample
-#define glatter_WGL_3DL_stereo_control glatter_get_extension_support_WGL().has_WGL_3DL_stereo_control
-#define glatter_WGL_AMD_gpu_association glatter_get_extension_support_WGL().has_WGL_AMD_gpu_association
-#define glatter_WGL_ARB_buffer_region glatter_get_extension_support_WGL().has_WGL_ARB_buffer_region
-#define glatter_WGL_ARB_context_flush_control glatter_get_extension_support_WGL().has_WGL_ARB_context_flush_control
-#define glatter_WGL_ARB_create_context glatter_get_extension_support_WGL().has_WGL_ARB_create_context
-#define glatter_WGL_ARB_create_context_no_error glatter_get_extension_support_WGL().has_WGL_ARB_create_context_no_error
-#define glatter_WGL_ARB_create_context_profile glatter_get_extension_support_WGL().has_WGL_ARB_create_context_profile
-#define glatter_WGL_ARB_create_context_robustness glatter_get_extension_support_WGL().has_WGL_ARB_create_context_robustness
-#define glatter_WGL_ARB_extensions_string glatter_get_extension_support_WGL().has_WGL_ARB_extensions_string
-#define glatter_WGL_ARB_framebuffer_sRGB glatter_get_extension_support_WGL().has_WGL_ARB_framebuffer_sRGB
-#define glatter_WGL_ARB_make_current_read glatter_get_extension_support_WGL().has_WGL_ARB_make_current_read
-#define glatter_WGL_ARB_multisample glatter_get_extension_support_WGL().has_WGL_ARB_multisample
-#define glatter_WGL_ARB_pbuffer glatter_get_extension_support_WGL().has_WGL_ARB_pbuffer
-#define glatter_WGL_ARB_pixel_format glatter_get_extension_support_WGL().has_WGL_ARB_pixel_format
-#define glatter_WGL_ARB_pixel_format_float glatter_get_extension_support_WGL().has_WGL_ARB_pixel_format_float
-#define glatter_WGL_ARB_render_texture glatter_get_extension_support_WGL().has_WGL_ARB_render_texture
-#define glatter_WGL_ARB_robustness_application_isolation glatter_get_extension_support_WGL().has_WGL_ARB_robustness_application_isolation
-#define glatter_WGL_ARB_robustness_share_group_isolation glatter_get_extension_support_WGL().has_WGL_ARB_robustness_share_group_isolation
-#define glatter_WGL_ATI_pixel_format_float glatter_get_extension_support_WGL().has_WGL_ATI_pixel_format_float
-#define glatter_WGL_ATI_render_texture_rectangle glatter_get_extension_support_WGL().has_WGL_ATI_render_texture_rectangle
-#define glatter_WGL_EXT_colorspace glatter_get_extension_support_WGL().has_WGL_EXT_colorspace
-#define glatter_WGL_EXT_create_context_es2_profile glatter_get_extension_support_WGL().has_WGL_EXT_create_context_es2_profile
-#define glatter_WGL_EXT_create_context_es_profile glatter_get_extension_support_WGL().has_WGL_EXT_create_context_es_profile
-#define glatter_WGL_EXT_depth_float glatter_get_extension_support_WGL().has_WGL_EXT_depth_float
-#define glatter_WGL_EXT_display_color_table glatter_get_extension_support_WGL().has_WGL_EXT_display_color_table
-#define glatter_WGL_EXT_extensions_string glatter_get_extension_support_WGL().has_WGL_EXT_extensions_string
-#define glatter_WGL_EXT_framebuffer_sRGB glatter_get_extension_support_WGL().has_WGL_EXT_framebuffer_sRGB
-#define glatter_WGL_EXT_make_current_read glatter_get_extension_support_WGL().has_WGL_EXT_make_current_read
-#define glatter_WGL_EXT_multisample glatter_get_extension_support_WGL().has_WGL_EXT_multisample
-#define glatter_WGL_EXT_pbuffer glatter_get_extension_support_WGL().has_WGL_EXT_pbuffer
-#define glatter_WGL_EXT_pixel_format glatter_get_extension_support_WGL().has_WGL_EXT_pixel_format
-#define glatter_WGL_EXT_pixel_format_packed_float glatter_get_extension_support_WGL().has_WGL_EXT_pixel_format_packed_float
-#define glatter_WGL_EXT_swap_control glatter_get_extension_support_WGL().has_WGL_EXT_swap_control
-#define glatter_WGL_EXT_swap_control_tear glatter_get_extension_support_WGL().has_WGL_EXT_swap_control_tear
-#define glatter_WGL_I3D_digital_video_control glatter_get_extension_support_WGL().has_WGL_I3D_digital_video_control
-#define glatter_WGL_I3D_gamma glatter_get_extension_support_WGL().has_WGL_I3D_gamma
-#define glatter_WGL_I3D_genlock glatter_get_extension_support_WGL().has_WGL_I3D_genlock
-#define glatter_WGL_I3D_image_buffer glatter_get_extension_support_WGL().has_WGL_I3D_image_buffer
-#define glatter_WGL_I3D_swap_frame_lock glatter_get_extension_support_WGL().has_WGL_I3D_swap_frame_lock
-#define glatter_WGL_I3D_swap_frame_usage glatter_get_extension_support_WGL().has_WGL_I3D_swap_frame_usage
-#define glatter_WGL_NV_DX_interop glatter_get_extension_support_WGL().has_WGL_NV_DX_interop
-#define glatter_WGL_NV_DX_interop2 glatter_get_extension_support_WGL().has_WGL_NV_DX_interop2
-#define glatter_WGL_NV_copy_image glatter_get_extension_support_WGL().has_WGL_NV_copy_image
-#define glatter_WGL_NV_delay_before_swap glatter_get_extension_support_WGL().has_WGL_NV_delay_before_swap
-#define glatter_WGL_NV_float_buffer glatter_get_extension_support_WGL().has_WGL_NV_float_buffer
-#define glatter_WGL_NV_gpu_affinity glatter_get_extension_support_WGL().has_WGL_NV_gpu_affinity
-#define glatter_WGL_NV_multigpu_context glatter_get_extension_support_WGL().has_WGL_NV_multigpu_context
-#define glatter_WGL_NV_multisample_coverage glatter_get_extension_support_WGL().has_WGL_NV_multisample_coverage
-#define glatter_WGL_NV_present_video glatter_get_extension_support_WGL().has_WGL_NV_present_video
-#define glatter_WGL_NV_render_depth_texture glatter_get_extension_support_WGL().has_WGL_NV_render_depth_texture
-#define glatter_WGL_NV_render_texture_rectangle glatter_get_extension_support_WGL().has_WGL_NV_render_texture_rectangle
-#define glatter_WGL_NV_swap_group glatter_get_extension_support_WGL().has_WGL_NV_swap_group
-#define glatter_WGL_NV_vertex_array_range glatter_get_extension_support_WGL().has_WGL_NV_vertex_array_range
-#define glatter_WGL_NV_video_capture glatter_get_extension_support_WGL().has_WGL_NV_video_capture
-#define glatter_WGL_NV_video_output glatter_get_extension_support_WGL().has_WGL_NV_video_output
-#define glatter_WGL_OML_sync_control glatter_get_extension_support_WGL().has_WGL_OML_sync_control
+#define glatter_WGL_3DFX_multisample glatter_extension_supported_WGL(GLATTER_EXT_WGL_3DFX_multisample)
+#define glatter_WGL_3DL_stereo_control glatter_extension_supported_WGL(GLATTER_EXT_WGL_3DL_stereo_control)
+#define glatter_WGL_AMD_gpu_association glatter_extension_supported_WGL(GLATTER_EXT_WGL_AMD_gpu_association)
+#define glatter_WGL_ARB_buffer_region glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_buffer_region)
+#define glatter_WGL_ARB_context_flush_control glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_context_flush_control)
+#define glatter_WGL_ARB_create_context glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_create_context)
+#define glatter_WGL_ARB_create_context_no_error glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_create_context_no_error)
+#define glatter_WGL_ARB_create_context_profile glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_create_context_profile)
+#define glatter_WGL_ARB_create_context_robustness glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_create_context_robustness)
+#define glatter_WGL_ARB_extensions_string glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_extensions_string)
+#define glatter_WGL_ARB_framebuffer_sRGB glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_framebuffer_sRGB)
+#define glatter_WGL_ARB_make_current_read glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_make_current_read)
+#define glatter_WGL_ARB_multisample glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_multisample)
+#define glatter_WGL_ARB_pbuffer glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_pbuffer)
+#define glatter_WGL_ARB_pixel_format glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_pixel_format)
+#define glatter_WGL_ARB_pixel_format_float glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_pixel_format_float)
+#define glatter_WGL_ARB_render_texture glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_render_texture)
+#define glatter_WGL_ARB_robustness_application_isolation glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_robustness_application_isolation)
+#define glatter_WGL_ARB_robustness_share_group_isolation glatter_extension_supported_WGL(GLATTER_EXT_WGL_ARB_robustness_share_group_isolation)
+#define glatter_WGL_ATI_pixel_format_float glatter_extension_supported_WGL(GLATTER_EXT_WGL_ATI_pixel_format_float)
+#define glatter_WGL_ATI_render_texture_rectangle glatter_extension_supported_WGL(GLATTER_EXT_WGL_ATI_render_texture_rectangle)
+#define glatter_WGL_EXT_colorspace glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_colorspace)
+#define glatter_WGL_EXT_create_context_es2_profile glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_create_context_es2_profile)
+#define glatter_WGL_EXT_create_context_es_profile glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_create_context_es_profile)
+#define glatter_WGL_EXT_depth_float glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_depth_float)
+#define glatter_WGL_EXT_display_color_table glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_display_color_table)
+#define glatter_WGL_EXT_extensions_string glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_extensions_string)
+#define glatter_WGL_EXT_framebuffer_sRGB glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_framebuffer_sRGB)
+#define glatter_WGL_EXT_make_current_read glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_make_current_read)
+#define glatter_WGL_EXT_multisample glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_multisample)
+#define glatter_WGL_EXT_pbuffer glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_pbuffer)
+#define glatter_WGL_EXT_pixel_format glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_pixel_format)
+#define glatter_WGL_EXT_pixel_format_packed_float glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_pixel_format_packed_float)
+#define glatter_WGL_EXT_swap_control glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_swap_control)
+#define glatter_WGL_EXT_swap_control_tear glatter_extension_supported_WGL(GLATTER_EXT_WGL_EXT_swap_control_tear)
+#define glatter_WGL_I3D_digital_video_control glatter_extension_supported_WGL(GLATTER_EXT_WGL_I3D_digital_video_control)
+#define glatter_WGL_I3D_gamma glatter_extension_supported_WGL(GLATTER_EXT_WGL_I3D_gamma)
+#define glatter_WGL_I3D_genlock glatter_extension_supported_WGL(GLATTER_EXT_WGL_I3D_genlock)
+#define glatter_WGL_I3D_image_buffer glatter_extension_supported_WGL(GLATTER_EXT_WGL_I3D_image_buffer)
+#define glatter_WGL_I3D_swap_frame_lock glatter_extension_supported_WGL(GLATTER_EXT_WGL_I3D_swap_frame_lock)
+#define glatter_WGL_I3D_swap_frame_usage glatter_extension_supported_WGL(GLATTER_EXT_WGL_I3D_swap_frame_usage)
+#define glatter_WGL_NV_DX_interop glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_DX_interop)
+#define glatter_WGL_NV_DX_interop2 glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_DX_interop2)
+#define glatter_WGL_NV_copy_image glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_copy_image)
+#define glatter_WGL_NV_delay_before_swap glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_delay_before_swap)
+#define glatter_WGL_NV_float_buffer glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_float_buffer)
+#define glatter_WGL_NV_gpu_affinity glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_gpu_affinity)
+#define glatter_WGL_NV_multigpu_context glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_multigpu_context)
+#define glatter_WGL_NV_multisample_coverage glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_multisample_coverage)
+#define glatter_WGL_NV_present_video glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_present_video)
+#define glatter_WGL_NV_render_depth_texture glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_render_depth_texture)
+#define glatter_WGL_NV_render_texture_rectangle glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_render_texture_rectangle)
+#define glatter_WGL_NV_swap_group glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_swap_group)
+#define glatter_WGL_NV_vertex_array_range glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_vertex_array_range)
+#define glatter_WGL_NV_video_capture glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_video_capture)
+#define glatter_WGL_NV_video_output glatter_extension_supported_WGL(GLATTER_EXT_WGL_NV_video_output)
+#define glatter_WGL_OML_sync_control glatter_extension_supported_WGL(GLATTER_EXT_WGL_OML_sync_control)
 
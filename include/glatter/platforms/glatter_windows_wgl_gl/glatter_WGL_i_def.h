@@ -0,0 +1,215 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+#ifdef GLATTER_WGL
+#if defined(__wgl_wglext_h_)
+#if defined(WGL_3DL_stereo_control)
+GLATTER_IBLOCK(wglSetStereoEmitterState3DL)
+#endif // defined(WGL_3DL_stereo_control)
+#if defined(WGL_AMD_gpu_association)
+GLATTER_IBLOCK(wglBlitContextFramebufferAMD)
+GLATTER_IBLOCK(wglCreateAssociatedContextAMD)
+GLATTER_IBLOCK(wglCreateAssociatedContextAttribsAMD)
+GLATTER_IBLOCK(wglDeleteAssociatedContextAMD)
+GLATTER_IBLOCK(wglGetContextGPUIDAMD)
+GLATTER_IBLOCK(wglGetCurrentAssociatedContextAMD)
+GLATTER_IBLOCK(wglGetGPUIDsAMD)
+GLATTER_IBLOCK(wglGetGPUInfoAMD)
+GLATTER_IBLOCK(wglMakeAssociatedContextCurrentAMD)
+#endif // defined(WGL_AMD_gpu_association)
+#if defined(WGL_ARB_buffer_region)
+GLATTER_IBLOCK(wglCreateBufferRegionARB)
+GLATTER_IBLOCK(wglDeleteBufferRegionARB)
+GLATTER_IBLOCK(wglRestoreBufferRegionARB)
+GLATTER_IBLOCK(wglSaveBufferRegionARB)
+#endif // defined(WGL_ARB_buffer_region)
+#if defined(WGL_ARB_create_context)
+GLATTER_IBLOCK(wglCreateContextAttribsARB)
+#endif // defined(WGL_ARB_create_context)
+#if defined(WGL_ARB_extensions_string)
+GLATTER_IBLOCK(wglGetExtensionsStringARB)
+#endif // defined(WGL_ARB_extensions_string)
+#if defined(WGL_ARB_make_current_read)
+GLATTER_IBLOCK(wglGetCurrentReadDCARB)
+GLATTER_IBLOCK(wglMakeContextCurrentARB)
+#endif // defined(WGL_ARB_make_current_read)
+#if defined(WGL_ARB_pbuffer)
+GLATTER_IBLOCK(wglCreatePbufferARB)
+GLATTER_IBLOCK(wglDestroyPbufferARB)
+GLATTER_IBLOCK(wglGetPbufferDCARB)
+GLATTER_IBLOCK(wglQueryPbufferARB)
+GLATTER_IBLOCK(wglReleasePbufferDCARB)
+#endif // defined(WGL_ARB_pbuffer)
+#if defined(WGL_ARB_pixel_format)
+GLATTER_IBLOCK(wglChoosePixelFormatARB)
+GLATTER_IBLOCK(wglGetPixelFormatAttribfvARB)
+GLATTER_IBLOCK(wglGetPixelFormatAttribivARB)
+#endif // defined(WGL_ARB_pixel_format)
+#if defined(WGL_ARB_render_texture)
+GLATTER_IBLOCK(wglBindTexImageARB)
+GLATTER_IBLOCK(wglReleaseTexImageARB)
+GLATTER_IBLOCK(wglSetPbufferAttribARB)
+#endif // defined(WGL_ARB_render_texture)
+#if defined(WGL_EXT_display_color_table)
+GLATTER_IBLOCK(wglBindDisplayColorTableEXT)
+GLATTER_IBLOCK(wglCreateDisplayColorTableEXT)
+GLATTER_IBLOCK(wglDestroyDisplayColorTableEXT)
+GLATTER_IBLOCK(wglLoadDisplayColorTableEXT)
+#endif // defined(WGL_EXT_display_color_table)
+#if defined(WGL_EXT_extensions_string)
+GLATTER_IBLOCK(wglGetExtensionsStringEXT)
+#endif // defined(WGL_EXT_extensions_string)
+#if defined(WGL_EXT_make_current_read)
+GLATTER_IBLOCK(wglGetCurrentReadDCEXT)
+GLATTER_IBLOCK(wglMakeContextCurrentEXT)
+#endif // defined(WGL_EXT_make_current_read)
+#if defined(WGL_EXT_pbuffer)
+GLATTER_IBLOCK(wglCreatePbufferEXT)
+GLATTER_IBLOCK(wglDestroyPbufferEXT)
+GLATTER_IBLOCK(wglGetPbufferDCEXT)
+GLATTER_IBLOCK(wglQueryPbufferEXT)
+GLATTER_IBLOCK(wglReleasePbufferDCEXT)
+#endif // defined(WGL_EXT_pbuffer)
+#if defined(WGL_EXT_pixel_format)
+GLATTER_IBLOCK(wglChoosePixelFormatEXT)
+GLATTER_IBLOCK(wglGetPixelFormatAttribfvEXT)
+GLATTER_IBLOCK(wglGetPixelFormatAttribivEXT)
+#endif // defined(WGL_EXT_pixel_format)
+#if defined(WGL_EXT_swap_control)
+GLATTER_IBLOCK(wglGetSwapIntervalEXT)
+GLATTER_IBLOCK(wglSwapIntervalEXT)
+#endif // defined(WGL_EXT_swap_control)
+#if defined(WGL_I3D_digital_video_control)
+GLATTER_IBLOCK(wglGetDigitalVideoParametersI3D)
+GLATTER_IBLOCK(wglSetDigitalVideoParametersI3D)
+#endif // defined(WGL_I3D_digital_video_control)
+#if defined(WGL_I3D_gamma)
+GLATTER_IBLOCK(wglGetGammaTableI3D)
+GLATTER_IBLOCK(wglGetGammaTableParametersI3D)
+GLATTER_IBLOCK(wglSetGammaTableI3D)
+GLATTER_IBLOCK(wglSetGammaTableParametersI3D)
+#endif // defined(WGL_I3D_gamma)
+#if defined(WGL_I3D_genlock)
+GLATTER_IBLOCK(wglDisableGenlockI3D)
+GLATTER_IBLOCK(wglEnableGenlockI3D)
+GLATTER_IBLOCK(wglGenlockSampleRateI3D)
+GLATTER_IBLOCK(wglGenlockSourceDelayI3D)
+GLATTER_IBLOCK(wglGenlockSourceEdgeI3D)
+GLATTER_IBLOCK(wglGenlockSourceI3D)
+GLATTER_IBLOCK(wglGetGenlockSampleRateI3D)
+GLATTER_IBLOCK(wglGetGenlockSourceDelayI3D)
+GLATTER_IBLOCK(wglGetGenlockSourceEdgeI3D)
+GLATTER_IBLOCK(wglGetGenlockSourceI3D)
+GLATTER_IBLOCK(wglIsEnabledGenlockI3D)
+GLATTER_IBLOCK(wglQueryGenlockMaxSourceDelayI3D)
+#endif // defined(WGL_I3D_genlock)
+#if defined(WGL_I3D_image_buffer)
+GLATTER_IBLOCK(wglAssociateImageBufferEventsI3D)
+GLATTER_IBLOCK(wglCreateImageBufferI3D)
+GLATTER_IBLOCK(wglDestroyImageBufferI3D)
+GLATTER_IBLOCK(wglReleaseImageBufferEventsI3D)
+#endif // defined(WGL_I3D_image_buffer)
+#if defined(WGL_I3D_swap_frame_lock)
+GLATTER_IBLOCK(wglDisableFrameLockI3D)
+GLATTER_IBLOCK(wglEnableFrameLockI3D)
+GLATTER_IBLOCK(wglIsEnabledFrameLockI3D)
+GLATTER_IBLOCK(wglQueryFrameLockMasterI3D)
+#endif // defined(WGL_I3D_swap_frame_lock)
+#if defined(WGL_I3D_swap_frame_usage)
+GLATTER_IBLOCK(wglBeginFrameTrackingI3D)
+GLATTER_IBLOCK(wglEndFrameTrackingI3D)
+GLATTER_IBLOCK(wglGetFrameUsageI3D)
+GLATTER_IBLOCK(wglQueryFrameTrackingI3D)
+#endif // defined(WGL_I3D_swap_frame_usage)
+#if defined(WGL_NV_DX_interop)
+GLATTER_IBLOCK(wglDXCloseDeviceNV)
+GLATTER_IBLOCK(wglDXLockObjectsNV)
+GLATTER_IBLOCK(wglDXObjectAccessNV)
+GLATTER_IBLOCK(wglDXOpenDeviceNV)
+GLATTER_IBLOCK(wglDXRegisterObjectNV)
+GLATTER_IBLOCK(wglDXSetResourceShareHandleNV)
+GLATTER_IBLOCK(wglDXUnlockObjectsNV)
+GLATTER_IBLOCK(wglDXUnregisterObjectNV)
+#endif // defined(WGL_NV_DX_interop)
+#if defined(WGL_NV_copy_image)
+GLATTER_IBLOCK(wglCopyImageSubDataNV)
+#endif // defined(WGL_NV_copy_image)
+#if defined(WGL_NV_delay_before_swap)
+GLATTER_IBLOCK(wglDelayBeforeSwapNV)
+#endif // defined(WGL_NV_delay_before_swap)
+#if defined(WGL_NV_gpu_affinity)
+GLATTER_IBLOCK(wglCreateAffinityDCNV)
+GLATTER_IBLOCK(wglDeleteDCNV)
+GLATTER_IBLOCK(wglEnumGpuDevicesNV)
+GLATTER_IBLOCK(wglEnumGpusFromAffinityDCNV)
+GLATTER_IBLOCK(wglEnumGpusNV)
+#endif // defined(WGL_NV_gpu_affinity)
+#if defined(WGL_NV_present_video)
+GLATTER_IBLOCK(wglBindVideoDeviceNV)
+GLATTER_IBLOCK(wglEnumerateVideoDevicesNV)
+GLATTER_IBLOCK(wglQueryCurrentContextNV)
+#endif // defined(WGL_NV_present_video)
+#if defined(WGL_NV_swap_group)
+GLATTER_IBLOCK(wglBindSwapBarrierNV)
+GLATTER_IBLOCK(wglJoinSwapGroupNV)
+GLATTER_IBLOCK(wglQueryFrameCountNV)
+GLATTER_IBLOCK(wglQueryMaxSwapGroupsNV)
+GLATTER_IBLOCK(wglQuerySwapGroupNV)
+GLATTER_IBLOCK(wglResetFrameCountNV)
+#endif // defined(WGL_NV_swap_group)
+#if defined(WGL_NV_vertex_array_range)
+GLATTER_IBLOCK(wglAllocateMemoryNV)
+GLATTER_IBLOCK(wglFreeMemoryNV)
+#endif // defined(WGL_NV_vertex_array_range)
+#if defined(WGL_NV_video_capture)
+GLATTER_IBLOCK(wglBindVideoCaptureDeviceNV)
+GLATTER_IBLOCK(wglEnumerateVideoCaptureDevicesNV)
+GLATTER_IBLOCK(wglLockVideoCaptureDeviceNV)
+GLATTER_IBLOCK(wglQueryVideoCaptureDeviceNV)
+GLATTER_IBLOCK(wglReleaseVideoCaptureDeviceNV)
+#endif // defined(WGL_NV_video_capture)
+#if defined(WGL_NV_video_output)
+GLATTER_IBLOCK(wglBindVideoImageNV)
+GLATTER_IBLOCK(wglGetVideoDeviceNV)
+GLATTER_IBLOCK(wglGetVideoInfoNV)
+GLATTER_IBLOCK(wglReleaseVideoDeviceNV)
+GLATTER_IBLOCK(wglReleaseVideoImageNV)
+GLATTER_IBLOCK(wglSendPbufferToVideoNV)
+#endif // defined(WGL_NV_video_output)
+#if defined(WGL_OML_sync_control)
+GLATTER_IBLOCK(wglGetMscRateOML)
+GLATTER_IBLOCK(wglGetSyncValuesOML)
+GLATTER_IBLOCK(wglSwapBuffersMscOML)
+GLATTER_IBLOCK(wglSwapLayerBuffersMscOML)
+GLATTER_IBLOCK(wglWaitForMscOML)
+GLATTER_IBLOCK(wglWaitForSbcOML)
+#endif // defined(__wgl_wglext_h_)
+#endif // defined(WGL_OML_sync_control)
+#endif // GLATTER_WGL
+
@@ -0,0 +1,4396 @@
+/*
+Copyright 2018 Ioannis Makris
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file was generated by glatter.py script.
+
+
+
+/* Perfect hash of every entry point name known to this platform, used by
+ * glatter_get_proc_address to cache resolved addresses (see glatter_def.h).
+ * The arrays are not const so that they can be link-once in header-only mode,
+ * but nothing writes to them. */
+
+#define GLATTER_ENTRY_POINT_COUNT 3102
+#define GLATTER_ENTRY_POINT_SLOTS 4096
+#define GLATTER_ENTRY_POINT_BUCKETS 2048
+
+GLATTER_LINKONCE uint32_t glatter_entry_point_seeds[GLATTER_ENTRY_POINT_BUCKETS] = {
+    2, 2, 2, 0, 1, 1, 2, 1,
+    2, 0, 2, 1, 1, 0, 0, 1,
+    4, 2, 4, 2, 1, 3, 1, 0,
+    1, 3, 1, 1, 1, 0, 4, 2,
+    1, 0, 1, 2, 1, 6, 0, 0,
+    1, 7, 2, 4, 0, 0, 1, 3,
+    1, 1, 0, 2, 1, 0, 1, 1,
+    0, 4, 1, 2, 0, 1, 3, 0,
+    1, 5, 2, 1, 1, 2, 0, 3,
+    2, 6, 0, 0, 0, 1, 1, 0,
+    1, 3, 1, 0, 2, 1, 2, 0,
+    1, 2, 0, 1, 3, 2, 2, 0,
+    2, 0, 1, 1, 2, 0, 1, 0,
+    2, 1, 4, 0, 2, 5, 0, 1,
+    3, 1, 4, 5, 6, 10, 1, 2,
+    1, 0, 5, 6, 1, 0, 1, 1,
+    3, 0, 2, 1, 0, 5, 0, 1,
+    1, 1, 1, 9, 1, 1, 2, 4,
+    1, 4, 10, 1, 9, 0, 1, 2,
+    1, 2, 0, 2, 0, 1, 2, 0,
+    1, 7, 1, 4, 2, 1, 0, 3,
+    0, 0, 4, 0, 1, 1, 3, 2,
+    0, 3, 3, 1, 1, 0, 2, 0,
+    1, 2, 1, 5, 1, 5, 2, 0,
+    2, 1, 3, 2, 1, 1, 3, 3,
+    4, 1, 1, 1, 1, 1, 1, 1,
+    1, 3, 0, 1, 1, 1, 2, 0,
+    3, 2, 1, 3, 0, 3, 3, 1,
+    1, 1, 4, 1, 0, 1, 2, 0,
+    1, 5, 2, 1, 1, 3, 1, 2,
+    2, 1, 1, 2, 0, 1, 0, 0,
+    1, 1, 0, 7, 0, 1, 1, 1,
+    0, 3, 4, 0, 1, 1, 1, 3,
+    3, 5, 0, 12, 2, 0, 1, 2,
+    2, 0, 7, 3, 2, 1, 0, 5,
+    0, 6, 0, 0, 1, 5, 2, 1,
+    2, 0, 3, 2, 12, 0, 1, 1,
+    2, 0, 4, 0, 1, 3, 0, 3,
+    1, 2, 3, 2, 0, 4, 2, 4,
+    0, 1, 1, 2, 0, 3, 0, 1,
+    1, 1, 1, 0, 3, 0, 0, 3,
+    6, 3, 0, 1, 1, 1, 7, 1,
+    1, 0, 2, 2, 5, 5, 1, 1,
+    1, 1, 1, 3, 3, 10, 1, 3,
+    3, 1, 2, 2, 0, 2, 2, 0,
+    2, 1, 0, 1, 3, 0, 1, 0,
+    1, 1, 1, 1, 2, 0, 3, 0,
+    0, 0, 1, 0, 1, 5, 1, 1,
+    2, 3, 1, 0, 0, 0, 3, 3,
+    4, 2, 14, 1, 2, 1, 0, 0,
+    1, 0, 0, 2, 0, 1, 1, 4,
+    1, 1, 3, 1, 3, 1, 0, 1,
+    1, 1, 0, 4, 3, 2, 2, 0,
+    1, 5, 0, 6, 1, 0, 5, 6,
+    0, 2, 3, 1, 1, 2, 2, 1,
+    3, 4, 5, 2, 0, 1, 1, 1,
+    3, 0, 1, 1, 1, 8, 1, 1,
+    1, 1, 2, 1, 2, 3, 1, 0,
+    0, 0, 6, 2, 1, 2, 1, 1,
+    1, 1, 3, 0, 6, 2, 3, 0,
+    5, 1, 1, 2, 0, 1, 1, 1,
+    3, 1, 6, 2, 2, 1, 3, 1,
+    0, 5, 3, 4, 2, 3, 4, 2,
+    0, 1, 1, 1, 2, 0, 1, 3,
+    6, 5, 8, 1, 1, 3, 0, 0,
+    3, 8, 0, 3, 5, 3, 0, 2,
+    3, 1, 1, 2, 0, 2, 2, 5,
+    5, 1, 1, 1, 2, 0, 0, 2,
+    2, 1, 2, 2, 1, 1, 2, 2,
+    1, 0, 4, 4, 4, 1, 2, 2,
+    5, 2, 6, 3, 2, 0, 1, 1,
+    1, 2, 0, 2, 2, 3, 3, 1,
+    2, 4, 1, 2, 3, 1, 1, 1,
+    8, 2, 1, 2, 1, 1, 2, 0,
+    0, 1, 1, 2, 1, 1, 0, 0,
+    0, 2, 1, 10, 2, 0, 1, 1,
+    1, 2, 1, 4, 0, 1, 2, 3,
+    2, 1, 0, 3, 1, 1, 1, 5,
+    1, 2, 0, 3, 2, 1, 2, 3,
+    2, 5, 0, 1, 0, 8, 3, 1,
+    1, 0, 3, 1, 1, 2, 2, 0,
+    1, 9, 2, 1, 5, 1, 3, 0,
+    4, 6, 0, 0, 3, 0, 0, 0,
+    4, 3, 3, 0, 1, 2, 0, 8,
+    0, 1, 0, 1, 11, 0, 1, 0,
+    2, 1, 3, 0, 3, 2, 0, 4,
+    3, 0, 1, 1, 2, 0, 1, 1,
+    1, 3, 2, 1, 1, 0, 0, 1,
+    1, 1, 0, 4, 1, 5, 1, 1,
+    0, 1, 6, 1, 1, 1, 2, 1,
+    3, 1, 5, 3, 1, 3, 2, 1,
+    0, 2, 1, 4, 1, 1, 5, 0,
+    0, 1, 1, 5, 3, 1, 9, 3,
+    0, 0, 1, 2, 1, 1, 5, 1,
+    2, 8, 1, 0, 0, 1, 2, 3,
+    2, 7, 2, 2, 6, 1, 1, 0,
+    2, 5, 0, 3, 2, 2, 0, 1,
+    2, 0, 0, 0, 1, 3, 0, 3,
+    1, 0, 1, 1, 2, 1, 1, 16,
+    5, 1, 1, 0, 3, 1, 0, 2,
+    1, 6, 1, 0, 2, 5, 1, 4,
+    0, 4, 4, 1, 5, 0, 1, 1,
+    1, 2, 4, 2, 1, 4, 0, 3,
+    2, 1, 4, 0, 3, 5, 1, 1,
+    0, 3, 2, 1, 0, 0, 1, 1,
+    1, 1, 0, 0, 0, 1, 0, 1,
+    1, 0, 2, 3, 0, 0, 3, 1,
+    0, 2, 0, 2, 0, 2, 2, 1,
+    3, 14, 0, 0, 2, 2, 0, 2,
+    1, 7, 1, 1, 2, 1, 3, 1,
+    5, 1, 2, 7, 0, 1, 1, 0,
+    4, 1, 1, 0, 2, 0, 3, 2,
+    7, 6, 1, 3, 2, 4, 4, 0,
+    0, 0, 0, 2, 0, 6, 0, 1,
+    2, 2, 4, 5, 1, 1, 1, 1,
+    2, 1, 3, 0, 3, 1, 0, 3,
+    5, 1, 3, 4, 3, 0, 1, 0,
+    0, 2, 1, 3, 2, 0, 0, 2,
+    0, 0, 3, 0, 1, 2, 3, 1,
+    4, 1, 0, 0, 2, 3, 2, 1,
+    3, 1, 2, 0, 2, 1, 2, 1,
+    0, 2, 3, 1, 0, 4, 0, 0,
+    1, 1, 2, 2, 1, 2, 2, 1,
+    2, 4, 0, 3, 4, 2, 5, 1,
+    3, 1, 1, 2, 0, 6, 2, 1,
+    9, 1, 1, 1, 1, 4, 1, 1,
+    2, 3, 4, 4, 4, 1, 9, 0,
+    2, 5, 1, 1, 4, 1, 0, 0,
+    1, 7, 1, 1, 1, 1, 0, 7,
+    3, 4, 2, 1, 0, 2, 7, 0,
+    1, 0, 0, 2, 1, 0, 1, 4,
+    0, 1, 0, 0, 2, 2, 1, 2,
+    6, 4, 1, 0, 4, 1, 0, 1,
+    3, 0, 1, 2, 1, 7, 1, 1,
+    3, 1, 4, 1, 1, 1, 1, 3,
+    4, 1, 1, 4, 2, 2, 0, 12,
+    0, 0, 1, 6, 0, 2, 0, 2,
+    1, 1, 1, 4, 2, 2, 1, 7,
+    1, 1, 1, 2, 3, 2, 4, 1,
+    5, 2, 8, 8, 15, 1, 0, 1,
+    1, 2, 5, 1, 13, 5, 2, 1,
+    2, 3, 5, 4, 0, 2, 1, 0,
+    2, 0, 0, 0, 0, 5, 1, 3,
+    3, 3, 1, 6, 5, 5, 3, 4,
+    1, 6, 1, 2, 0, 0, 5, 2,
+    15, 6, 0, 1, 1, 1, 5, 1,
+    3, 1, 0, 7, 1, 7, 1, 4,
+    20, 4, 1, 3, 2, 4, 3, 1,
+    6, 2, 2, 1, 1, 2, 2, 1,
+    0, 1, 7, 5, 2, 2, 1, 5,
+    3, 1, 1, 2, 1, 2, 3, 0,
+    1, 1, 8, 1, 8, 2, 13, 7,
+    1, 1, 3, 0, 5, 8, 3, 3,
+    4, 0, 1, 1, 2, 0, 2, 0,
+    3, 4, 8, 3, 1, 2, 0, 2,
+    1, 1, 2, 1, 0, 1, 1, 1,
+    1, 0, 0, 7, 2, 3, 0, 1,
+    3, 1, 3, 5, 0, 1, 1, 4,
+    2, 5, 0, 1, 0, 5, 3, 1,
+    1, 7, 2, 7, 3, 1, 2, 10,
+    1, 2, 1, 2, 1, 0, 0, 0,
+    3, 1, 2, 2, 1, 2, 0, 1,
+    5, 0, 5, 5, 6, 0, 1, 2,
+    5, 2, 6, 0, 0, 11, 6, 8,
+    2, 1, 1, 0, 1, 2, 1, 6,
+    7, 2, 2, 0, 9, 0, 1, 5,
+    2, 6, 1, 0, 1, 0, 2, 4,
+    3, 2, 2, 1, 3, 2, 6, 2,
+    3, 0, 1, 4, 2, 2, 1, 1,
+    1, 3, 1, 1, 1, 2, 2, 0,
+    4, 0, 0, 1, 0, 0, 1, 5,
+    1, 5, 1, 1, 2, 2, 4, 5,
+    0, 4, 1, 4, 5, 8, 2, 8,
+    3, 0, 2, 8, 3, 11, 3, 0,
+    4, 0, 0, 0, 0, 1, 0, 3,
+    0, 6, 0, 0, 6, 1, 1, 3,
+    2, 5, 1, 2, 3, 0, 4, 1,
+    12, 1, 1, 5, 7, 1, 2, 2,
+    0, 4, 3, 0, 0, 3, 7, 1,
+    1, 2, 5, 6, 1, 3, 7, 11,
+    3, 2, 2, 0, 3, 1, 1, 14,
+    0, 4, 0, 0, 2, 0, 10, 0,
+    7, 3, 2, 9, 0, 2, 1, 4,
+    4, 2, 1, 5, 4, 3, 1, 5,
+    5, 1, 0, 0, 1, 4, 3, 9,
+    1, 2, 4, 4, 1, 1, 0, 2,
+    3, 1, 1, 2, 1, 3, 0, 0,
+    2, 7, 0, 6, 0, 3, 1, 1,
+    1, 0, 0, 3, 7, 14, 3, 1,
+    5, 10, 1, 5, 2, 4, 6, 0,
+    2, 1, 2, 2, 2, 3, 10, 0,
+    1, 4, 2, 2, 0, 8, 2, 4,
+    2, 6, 1, 0, 1, 0, 5, 1,
+    0, 4, 8, 2, 1, 0, 1, 0,
+    4, 6, 1, 2, 0, 1, 1, 1,
+    1, 12, 2, 0, 3, 4, 6, 7,
+    1, 4, 0, 4, 2, 1, 3, 0,
+    3, 0, 1, 1, 5, 0, 12, 1,
+    1, 5, 1, 1, 7, 3, 3, 1,
+    0, 4, 3, 0, 1, 3, 3, 2,
+    1, 4, 1, 7, 7, 5, 10, 10,
+    1, 5, 6, 3, 0, 10, 3, 2,
+    7, 0, 0, 1, 2, 0, 1, 2,
+    2, 3, 4, 1, 0, 3, 1, 4,
+    2, 0, 3, 2, 5, 1, 2, 6,
+    0, 2, 5, 0, 0, 4, 3, 1,
+    0, 0, 0, 2, 3, 0, 8, 13,
+    3, 0, 10, 10, 1, 0, 2, 1,
+    0, 3, 1, 2, 0, 2, 1, 1,
+    1, 5, 2, 15, 4, 1, 1, 1,
+    0, 0, 0, 3, 1, 0, 1, 10,
+    1, 2, 2, 6, 5, 0, 1, 0,
+    6, 0, 0, 2, 2, 4, 7, 1,
+    0, 8, 1, 0, 3, 0, 2, 2,
+    0, 6, 0, 1, 7, 3, 1, 1,
+    3, 3, 1, 1, 2, 2, 8, 0,
+    1, 8, 5, 1, 4, 1, 1, 2,
+    4, 0, 16, 1, 0, 5, 10, 1,
+    8, 0, 0, 1, 0, 5, 12, 1,
+    0, 7, 1, 6, 0, 0, 2, 0,
+    6, 8, 1, 7, 14, 3, 0, 3,
+    1, 2, 17, 3, 2, 5, 3, 5,
+    0, 1, 2, 3, 2, 0, 1, 0,
+    0, 3, 1, 3, 3, 3, 3, 3,
+    3, 1, 1, 0, 0, 8, 0, 3,
+    5, 8, 0, 5, 3, 2, 0, 3,
+    1, 11, 7, 2, 4, 0, 5, 8,
+    6, 0, 0, 3, 2, 7, 0, 1,
+    1, 0, 2, 0, 1, 1, 5, 0,
+    1, 1, 2, 0, 1, 2, 2, 3,
+    3, 1, 2, 4, 7, 1, 2, 0,
+    4, 4, 4, 0, 3, 5, 3, 2,
+    17, 0, 0, 4, 4, 0, 1, 27,
+    0, 1, 9, 2, 6, 0, 7, 2,
+    2, 4, 6, 14, 1, 5, 4, 0,
+    2, 4, 1, 3, 5, 2, 3, 0,
+    1, 0, 10, 4, 2, 1, 1, 10,
+    0, 6, 0, 0, 0, 0, 0, 5,
+    3, 1, 1, 2, 2, 1, 1, 7,
+    2, 0, 2, 1, 9, 2, 3, 27,
+    6, 4, 1, 1, 1, 2, 0, 3,
+    1, 0, 17, 1, 1, 0, 0, 4,
+    0, 7, 4, 1, 2, 0, 5, 0,
+    0, 2, 11, 1, 0, 0, 2, 6,
+    1, 6, 0, 0, 1, 0, 0, 3,
+    3, 2, 0, 4, 4, 9, 9, 0,
+    0, 5, 0, 3, 0, 1, 2, 2,
+    0, 1, 6, 1, 0, 20, 3, 9,
+    2, 11, 5, 1, 1, 2, 0, 3,
+    2, 2, 1, 7, 0, 1, 0, 2,
+    1, 0, 0, 1, 6, 2, 10, 4,
+    2, 2, 3, 0, 6, 4, 1, 6,
+    7, 5, 0, 6, 49, 0, 1, 3,
+    9, 0, 1, 4, 5, 1, 0, 13,
+    4, 3, 0, 4, 4, 0, 2, 2,
+    0, 0, 2, 6, 11, 11, 5, 1,
+};
+
+GLATTER_LINKONCE const char* glatter_entry_point_names[GLATTER_ENTRY_POINT_SLOTS] = {
+    "glBindVertexBuffers",
+    "glSecondaryColor3iEXT",
+    "glStencilStrokePathNV",
+    "glGetMinmaxParameteriv",
+    NULL,
+    NULL,
+    "glIndexPointerEXT",
+    "glFogCoordhNV",
+    "glIndexubv",
+    "glBindBuffer",
+    NULL,
+    "glEdgeFlagPointerListIBM",
+    "glUniform3ui64NV",
+    "glMultiTexCoord4fARB",
+    "glBlendFuncIndexedAMD",
+    "glGetMultiTexParameterIuivEXT",
+    "glStencilClearTagEXT",
+    "glLineStipple",
+    NULL,
+    NULL,
+    "glSecondaryColor3uiEXT",
+    "glVertexAttribPointer",
+    NULL,
+    "glVertexAttribP3ui",
+    "glGetCommandHeaderNV",
+    "glGetFragmentLightfvSGIX",
+    "glGetnCompressedTexImageARB",
+    "glColorPointerListIBM",
+    "glTextureMaterialEXT",
+    NULL,
+    "glBufferPageCommitmentARB",
+    NULL,
+    NULL,
+    "glPushAttrib",
+    NULL,
+    "glSubpixelPrecisionBiasNV",
+    "glResetMinmax",
+    "glColor3iv",
+    "glMultiTexCoord2dARB",
+    "glPolygonOffsetClampEXT",
+    "glGenFramebuffers",
+    "glLoadMatrixxOES",
+    "glUniformMatrix4fv",
+    "glPopMatrix",
+    "glDrawBuffersATI",
+    "glTexGend",
+    "glSecondaryColor3b",
+    "glViewportArrayv",
+    NULL,
+    "wglGetGenlockSourceI3D",
+    "glGetnMapivARB",
+    NULL,
+    "glBlendEquation",
+    "glEnableVertexArrayAttrib",
+    "glTransformFeedbackBufferRange",
+    "glMatrixOrthoEXT",
+    NULL,
+    "glGetPathLengthNV",
+    NULL,
+    NULL,
+    "glReferencePlaneSGIX",
+    "glGetHistogramParameterxvOES",
+    "glProgramUniform3ui64vARB",
+    "glClientAttribDefaultEXT",
+    "glApplyFramebufferAttachmentCMAAINTEL",
+    "glCopyMultiTexImage2DEXT",
+    NULL,
+    "glUniformMatrix3x2fv",
+    NULL,
+    NULL,
+    "glWindowPos2fvMESA",
+    "glColorP3ui",
+    "glEvalMapsNV",
+    "glFinalCombinerInputNV",
+    "glPixelTransferxOES",
+    "glGetConvolutionFilter",
+    "glBindLightParameterEXT",
+    "glGetIntegerui64vNV",
+    NULL,
+    "glGetVertexAttribArrayObjectfvATI",
+    NULL,
+    "glUniform3dv",
+    "glBindParameterEXT",
+    "glGenerateMipmapEXT",
+    "glTexCoord1bOES",
+    "glPatchParameterfv",
+    NULL,
+    NULL,
+    "glMulticastViewportArrayvNVX",
+    "glTexEnvfv",
+    "glCompressedTexSubImage3DARB",
+    "glPointParameteriv",
+    NULL,
+    "glGetPerfCounterInfoINTEL",
+    NULL,
+    NULL,
+    "glMultTransposeMatrixfARB",
+    "glRasterPos4s",
+    NULL,
+    "glProgramUniform3iEXT",
+    "glTexCoord1hNV",
+    "glTexParameterxOES",
+    "glUniform1ivARB",
+    "glPathStencilFuncNV",
+    "glTranslated",
+    "glUniformMatrix2fv",
+    NULL,
+    "glProgramUniform1fEXT",
+    "glEndTransformFeedback",
+    "glFinishAsyncSGIX",
+    NULL,
+    "glDrawRangeElements",
+    "glStencilFillPathNV",
+    "glVertexAttrib4bv",
+    NULL,
+    "glPixelTransformParameterfEXT",
+    "glGetTexGendv",
+    "glPointParameterfv",
+    NULL,
+    "glRasterPos2d",
+    "glDrawElementsInstancedBaseInstance",
+    "glCopyPixels",
+    NULL,
+    "glProgramUniform3fEXT",
+    "glGetVideoCaptureivNV",
+    "glMultiDrawArraysIndirectBindlessNV",
+    "glListParameterfvSGIX",
+    NULL,
+    "glGetMultiTexEnvivEXT",
+    "glWindowPos2fARB",
+    "glBindBufferRangeNV",
+    "glUniform4ui64ARB",
+    "glDrawMeshTasksIndirectNV",
+    "glGetFramebufferAttachmentParameterivEXT",
+    "glGetUniformuiv",
+    "glGenSemaphoresEXT",
+    "glVertexAttribI1uiv",
+    "glTexCoord2iv",
+    "glSecondaryColor3svEXT",
+    "glEvalCoord1xOES",
+    "glTextureSubImage2D",
+    "glProgramUniform2ui64vARB",
+    "glMultiTexCoord4d",
+    NULL,
+    NULL,
+    "glMultiTexSubImage2DEXT",
+    "glStateCaptureNV",
+    "glLoadTransposeMatrixdARB",
+    NULL,
+    "glRectxvOES",
+    NULL,
+    "wglGetPbufferDCEXT",
+    "glSecondaryColor3f",
+    "glNamedFramebufferTexture3DEXT",
+    "glTextureImage2DMultisampleCoverageNV",
+    NULL,
+    "glMultiTexImage2DEXT",
+    "glTexBumpParameterivATI",
+    NULL,
+    "glUniform3i64NV",
+    "glVertexAttrib4Nsv",
+    "glMultiTexEnvfEXT",
+    NULL,
+    "glBeginPerfQueryINTEL",
+    "glNormalP3ui",
+    NULL,
+    "glMultiDrawElementsIndirect",
+    "glGlobalAlphaFactorsSUN",
+    NULL,
+    "glVertexStream2sATI",
+    "glWeightivARB",
+    "glDepthRangefOES",
+    "glMultiTexCoord4hNV",
+    "glClearAccum",
+    "glGetVertexArrayIntegervEXT",
+    "glClearDepth",
+    "glBlendFuncSeparateEXT",
+    "glGlobalAlphaFactorbSUN",
+    "glProgramLocalParameterI4uivNV",
+    "glNormalStream3dvATI",
+    "glReplacementCodeubvSUN",
+    "wglDXObjectAccessNV",
+    "glCopyTextureImage2DEXT",
+    "glVertexStream2iATI",
+    "glSecondaryColorP3uiv",
+    "glGetCompressedTextureImageEXT",
+    "glVertexAttrib4d",
+    NULL,
+    "glBinormal3sEXT",
+    "glFramebufferDrawBuffersEXT",
+    "glProgramUniformMatrix3dv",
+    "glVertexAttrib4sv",
+    "glBindVertexBuffer",
+    "glReplacementCodeusSUN",
+    "glGetActiveUniform",
+    "glDeleteTransformFeedbacks",
+    NULL,
+    NULL,
+    "glVertexAttrib4NbvARB",
+    "glGetnHistogram",
+    "glProgramUniformMatrix2x3dvEXT",
+    NULL,
+    "glTextureStorageMem2DEXT",
+    "glUniform1iARB",
+    "glVertexAttrib3dv",
+    "glColorP3uiv",
+    "glBlendFunciARB",
+    "glVertexAttribL1dvEXT",
+    "glTangent3bEXT",
+    "glVertexAttrib2sv",
+    "glGetVertexAttribdv",
+    "glDisable",
+    "glPixelTransformParameteriEXT",
+    "wglGetGPUInfoAMD",
+    "glBindTextureEXT",
+    "glMultiTexGeniEXT",
+    "glOrthoxOES",
+    "glIsList",
+    NULL,
+    "glMultiDrawElementsBaseVertex",
+    "glCopyImageSubData",
+    "glEnableVertexArrayAttribEXT",
+    "glClearBufferData",
+    "glMultiDrawArrays",
+    "glGetAttachedShaders",
+    "glVertexArrayVertexBuffers",
+    NULL,
+    NULL,
+    "glMultiTexCoord4i",
+    "glLoadTransposeMatrixf",
+    "glTextureStorage2D",
+    "glGetMapiv",
+    "glLightModelf",
+    "glVertexAttrib1dNV",
+    "glSetInvariantEXT",
+    "glVertex2s",
+    "glDebugMessageControl",
+    "glDepthRangedNV",
+    "glMatrixIndexPointerARB",
+    "glGetVaryingLocationNV",
+    "glCopyConvolutionFilter2D",
+    "glGetSynciv",
+    "glConvolutionParameterivEXT",
+    "glVertexAttribI4uiEXT",
+    "glSelectPerfMonitorCountersAMD",
+    "glNamedBufferStorageExternalEXT",
+    "glIsFramebuffer",
+    "glProgramUniform2dEXT",
+    "glImportSemaphoreWin32HandleEXT",
+    "glTextureParameterfEXT",
+    NULL,
+    "glNamedProgramLocalParameter4fvEXT",
+    "glUniform3f",
+    NULL,
+    "wglGetPixelFormatAttribivARB",
+    "glGetTexLevelParameterfv",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexStream2fATI",
+    "glGetnUniformi64vARB",
+    "glCullParameterdvEXT",
+    NULL,
+    "glGenRenderbuffers",
+    "glGetNamedBufferPointerv",
+    "glColor4ubVertex3fvSUN",
+    "glGetMultisamplefv",
+    "glRasterPos4f",
+    "glCopyConvolutionFilter1DEXT",
+    "glSecondaryColor3sv",
+    NULL,
+    "glWindowPos3sARB",
+    "glDepthBoundsdNV",
+    "glSecondaryColor3uiv",
+    NULL,
+    "glDisableVertexArrayEXT",
+    "glEndPerfMonitorAMD",
+    NULL,
+    "glMultiTexCoord2fvARB",
+    NULL,
+    "glTexStorage3D",
+    NULL,
+    "glMakeTextureHandleNonResidentNV",
+    "glTexStorage1DEXT",
+    "glRasterPos3xOES",
+    "glTextureSubImage2DEXT",
+    "glColorTableParameterfv",
+    "glGetGraphicsResetStatus",
+    NULL,
+    "glFeedbackBuffer",
+    "glMultiTexCoord4svARB",
+    "glGetnPixelMapusvARB",
+    "glVertexWeightfEXT",
+    "glConvolutionParameteri",
+    NULL,
+    "glSpriteParameterfSGIX",
+    "glVertexAttrib2fARB",
+    "glMultiDrawMeshTasksIndirectCountEXT",
+    "glClientWaitSync",
+    "glUniform2uiEXT",
+    "glMultiDrawArraysIndirectCount",
+    NULL,
+    "glVertexStream4svATI",
+    "glMakeBufferResidentNV",
+    NULL,
+    "glGetVideoui64vNV",
+    "glActiveTextureARB",
+    "glDeleteFencesNV",
+    "glIndexFuncEXT",
+    "glIsSync",
+    "glNamedProgramLocalParameterI4uiEXT",
+    NULL,
+    "glMakeBufferNonResidentNV",
+    NULL,
+    "glColor4fNormal3fVertex3fvSUN",
+    "glAlphaFunc",
+    NULL,
+    "glVertexAttribL1dEXT",
+    "glGetNamedProgramLocalParameterfvEXT",
+    "glProgramUniformMatrix3x4dv",
+    "glWindowPos3i",
+    NULL,
+    "glMatrixMultfEXT",
+    "glGetTextureLevelParameterivEXT",
+    "glVertex4d",
+    "glVertexAttrib4fARB",
+    NULL,
+    "glGetNextPerfQueryIdINTEL",
+    NULL,
+    "glUniform4ui64NV",
+    "glGetPixelTransformParameterivEXT",
+    NULL,
+    "glFrontFace",
+    "glGetNamedStringARB",
+    "glUniform2ui64NV",
+    NULL,
+    NULL,
+    "glTransformFeedbackStreamAttribsNV",
+    "glWeightsvARB",
+    "glBlitFramebufferEXT",
+    "glMaxShaderCompilerThreadsKHR",
+    NULL,
+    "glTexCoord4d",
+    "glVertexAttrib4usv",
+    "glPathStencilDepthOffsetNV",
+    "glColorMask",
+    "glSecondaryColor3ubvEXT",
+    NULL,
+    "glClearNamedFramebufferuiv",
+    NULL,
+    "glGetMinmaxParameterfvEXT",
+    "glGetHistogramEXT",
+    "glProgramUniform1i64vARB",
+    "glCreateRenderbuffers",
+    "glGetNamedFramebufferAttachmentParameterivEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glRasterPos3s",
+    NULL,
+    "glVertexArrayVertexAttribFormatEXT",
+    "glMatrixScalefEXT",
+    NULL,
+    NULL,
+    "wglDXUnlockObjectsNV",
+    "glFragmentLightfvSGIX",
+    "glFlushMappedBufferRange",
+    "glFogCoordfvEXT",
+    "glBlendColorxOES",
+    "wglGetVideoDeviceNV",
+    "glGetTexParameterIuivEXT",
+    "glGetIntegerv",
+    "glColorTableEXT",
+    "glVertex4iv",
+    "glVertexAttribP4ui",
+    "glRasterPos2xOES",
+    "glTexImage2DMultisampleCoverageNV",
+    "glTexCoord2sv",
+    "glDeleteVertexArrays",
+    "glTestFenceNV",
+    "glGetTransformFeedbackVaryingNV",
+    "glBindFramebufferEXT",
+    "glMultiDrawElementsIndirectCount",
+    "glFogCoorddEXT",
+    "glGetSamplerParameterfv",
+    NULL,
+    NULL,
+    "glProgramLocalParametersI4ivNV",
+    NULL,
+    NULL,
+    "glTexBufferARB",
+    "glColor4ub",
+    "glInvalidateBufferSubData",
+    "glVertex4f",
+    "glCopyTexSubImage3D",
+    "glProgramUniform1fvEXT",
+    NULL,
+    "glVertexAttribLPointer",
+    "glVertex2bvOES",
+    "glDrawArraysInstancedARB",
+    "glDeleteRenderbuffersEXT",
+    "wglGetCurrentAssociatedContextAMD",
+    "glEndQuery",
+    "glGetVertexAttribLui64vARB",
+    "glGetBooleani_v",
+    "glGetAttribLocationARB",
+    "glTexImage3DMultisampleCoverageNV",
+    "glTextureStorage2DEXT",
+    "glVertexAttribL1ui64NV",
+    "glVertexAttrib4NubvARB",
+    "glGetProgramLocalParameterIivNV",
+    "glGetVertexArrayPointervEXT",
+    "glUniform2uivEXT",
+    "glGetBufferSubData",
+    "glMapGrid2xOES",
+    "glGetPointerv",
+    "glGetVertexAttribfvARB",
+    NULL,
+    "glProgramUniformMatrix4x3dv",
+    "glGetCompressedMultiTexImageEXT",
+    "glProgramUniform3f",
+    NULL,
+    "glVertexAttrib4dNV",
+    "glClearColor",
+    "glFogCoordfEXT",
+    "glDrawTransformFeedback",
+    "glClearDepthdNV",
+    "glVideoCaptureStreamParameterfvNV",
+    "glVertexAttribDivisor",
+    "glVertexAttribI2ivEXT",
+    NULL,
+    NULL,
+    "glNamedBufferSubDataEXT",
+    "glGetVertexAttribIuiv",
+    "glVDPAUSurfaceAccessNV",
+    "glFlush",
+    "glGetIntegerIndexedvEXT",
+    "glGenPathsNV",
+    "glReleaseShaderCompiler",
+    "glVertexAttrib4hNV",
+    "glUniform4iv",
+    "glTextureStorageMem2DMultisampleEXT",
+    "glVertexAttribL1i64NV",
+    "glIsImageHandleResidentARB",
+    NULL,
+    "glColor3xOES",
+    "glObjectUnpurgeableAPPLE",
+    NULL,
+    "glFinishFenceAPPLE",
+    NULL,
+    "glImportMemoryWin32HandleEXT",
+    "glBufferPageCommitmentMemNV",
+    "glGetUniformIndices",
+    "glCreatePerfQueryINTEL",
+    "glFogCoordf",
+    NULL,
+    NULL,
+    "glIsQueryARB",
+    NULL,
+    "glTexCoordP1ui",
+    "glMultiTexCoord2i",
+    "glVertex4dv",
+    NULL,
+    NULL,
+    "glTexGendv",
+    NULL,
+    NULL,
+    NULL,
+    "glAsyncCopyImageSubDataNVX",
+    "glBindMultiTextureEXT",
+    "glGetnCompressedTexImage",
+    "glMultiTexCoord1svARB",
+    "glGetNamedProgramivEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glSecondaryColor3usvEXT",
+    NULL,
+    "glWindowPos4ivMESA",
+    NULL,
+    "wglEndFrameTrackingI3D",
+    "glShaderStorageBlockBinding",
+    "glGetUniformui64vNV",
+    "glMultiTexGendvEXT",
+    "glProgramUniformMatrix3x4dvEXT",
+    "glBeginQuery",
+    "glMultiTexCoord3i",
+    "glGetShadingRateSampleLocationivNV",
+    NULL,
+    "glCompileShaderARB",
+    NULL,
+    "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+    NULL,
+    "glEvalPoint2",
+    "glTextureBufferEXT",
+    "glMultiTexCoord1fv",
+    "glConvolutionParameterfv",
+    "glVertexAttribI3uivEXT",
+    "glSampleMaskIndexedNV",
+    "glSecondaryColor3ub",
+    "glCombinerParameteriNV",
+    "glRenderbufferStorageEXT",
+    "glVertexAttribL2ui64vNV",
+    "glProgramUniformMatrix3x2fv",
+    "glGetProgramParameterfvNV",
+    "glStencilThenCoverFillPathNV",
+    "glProgramParameter4fvNV",
+    NULL,
+    NULL,
+    "glNamedFramebufferReadBuffer",
+    NULL,
+    "glCopyConvolutionFilter1D",
+    "glGetnUniformfvARB",
+    "glBlendEquationi",
+    NULL,
+    "glDebugMessageInsertAMD",
+    NULL,
+    NULL,
+    "glGetBufferParameteri64v",
+    "glDispatchComputeIndirect",
+    "glUniform1ui64vARB",
+    "glIsPointInFillPathNV",
+    NULL,
+    NULL,
+    "glVertexStream3svATI",
+    NULL,
+    "glTexCoord2bOES",
+    "wglGenlockSourceI3D",
+    NULL,
+    NULL,
+    "glSampleMaskSGIS",
+    NULL,
+    "glMapObjectBufferATI",
+    "glBeginTransformFeedbackEXT",
+    "glVertexAttribP4uiv",
+    "glUniform1i64vARB",
+    "glMultiTexCoordP2uiv",
+    "glFramebufferTextureLayerARB",
+    NULL,
+    NULL,
+    NULL,
+    "glGetVertexAttribfvNV",
+    "glReplacementCodeuiNormal3fVertex3fvSUN",
+    "glBeginVideoCaptureNV",
+    "glMakeNamedBufferNonResidentNV",
+    NULL,
+    "glClipControl",
+    "glRasterPos3sv",
+    "glCopyTexSubImage2D",
+    "glReadPixels",
+    NULL,
+    "glHint",
+    "glCompressedTextureSubImage2D",
+    "glFramebufferTextureFaceARB",
+    "glTexParameterIuiv",
+    "glMatrixPopEXT",
+    "glFragmentColorMaterialSGIX",
+    NULL,
+    "glWindowPos3dvMESA",
+    "glMultiTexCoordP4ui",
+    "glVertexAttrib4uiv",
+    "glWeightusvARB",
+    NULL,
+    "glNamedFramebufferParameteriEXT",
+    "glTexGeni",
+    "glMultiTexBufferEXT",
+    "glStencilOpSeparateATI",
+    "glVertexStream2ivATI",
+    "glVariantusvEXT",
+    NULL,
+    "wglGetCurrentReadDCEXT",
+    NULL,
+    "glDeleteQueryResourceTagNV",
+    "glSharpenTexFuncSGIS",
+    "glBindVertexArray",
+    "glProgramUniform1uiv",
+    "glUniform3uiv",
+    "glGetVertexArrayiv",
+    "glProgramUniform1ui64vNV",
+    NULL,
+    "glTexCoord3s",
+    NULL,
+    "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glMapVertexAttrib1dAPPLE",
+    "glEdgeFlagPointer",
+    "glMulticastBlitFramebufferNV",
+    "glDisableIndexedEXT",
+    "glGetVariantArrayObjectfvATI",
+    "glVertexStream1sATI",
+    NULL,
+    NULL,
+    "glClipPlanefOES",
+    "glFramebufferRenderbuffer",
+    "glTexCoord3d",
+    "glUniformui64vNV",
+    "glTexCoordP2ui",
+    "glVertexArrayAttribLFormat",
+    NULL,
+    "glGetFramebufferParameterfvAMD",
+    "glWindowPos2dvARB",
+    "glGenTextures",
+    NULL,
+    NULL,
+    "glDisableClientStateIndexedEXT",
+    "glBindBuffersRange",
+    "glCopyColorTableSGI",
+    "glNormal3f",
+    "glFragmentLightModelivSGIX",
+    "glGetMaterialiv",
+    NULL,
+    NULL,
+    "glTexCoord4s",
+    "glNamedRenderbufferStorageMultisample",
+    "glCoverFillPathInstancedNV",
+    "glMultiTexCoord4iv",
+    NULL,
+    "glColorFormatNV",
+    "glGetNamedBufferSubDataEXT",
+    "glVariantsvEXT",
+    NULL,
+    "glTexCoord3bvOES",
+    "glCopyBufferSubData",
+    "glProgramUniformMatrix2x4fvEXT",
+    "glVertexP2ui",
+    "glBlendFuncSeparate",
+    "glVertexAttribI1ui",
+    "glProgramUniform2ui",
+    "glUniformMatrix3x4dv",
+    "glGetUnsignedBytei_vEXT",
+    "glProgramPathFragmentInputGenNV",
+    NULL,
+    "glGetNamedRenderbufferParameteriv",
+    "glLoadMatrixd",
+    NULL,
+    NULL,
+    "glGetVertexArrayIndexed64iv",
+    "glTextureSubImage3DEXT",
+    NULL,
+    "glUniformMatrix3fvARB",
+    "glTexParameterfv",
+    "glGenProgramPipelines",
+    NULL,
+    "glIsEnabledi",
+    "glSecondaryColorPointerListIBM",
+    NULL,
+    "glGetBufferPointervARB",
+    NULL,
+    "glNamedFramebufferDrawBuffers",
+    "glGetUniformivARB",
+    "glBinormal3svEXT",
+    "glVertexArrayAttribBinding",
+    "glCompressedMultiTexSubImage2DEXT",
+    NULL,
+    "glCompressedMultiTexSubImage3DEXT",
+    "glUploadGpuMaskNVX",
+    "glRasterPos2i",
+    NULL,
+    "glVertexArrayRangeAPPLE",
+    "glProgramLocalParameter4dvARB",
+    "glVertexArrayVertexBuffer",
+    "wglQueryPbufferEXT",
+    "glSpecializeShaderARB",
+    "glVertexAttribs4hvNV",
+    NULL,
+    "glMultiTexCoord4dv",
+    "glGenerateTextureMipmapEXT",
+    "glBlendEquationiARB",
+    "glVertexAttribL3dvEXT",
+    "glVertexAttrib1sARB",
+    "glVertex2xvOES",
+    "glVertex4hvNV",
+    "glDepthBoundsEXT",
+    "glDeleteNamedStringARB",
+    "wglCopyImageSubDataNV",
+    "glNamedFramebufferSampleLocationsfvARB",
+    "glWindowPos4fvMESA",
+    "glGetLocalConstantFloatvEXT",
+    "glReplacementCodeuiVertex3fvSUN",
+    NULL,
+    "glGetCoverageModulationTableNV",
+    "glTexEnvxOES",
+    "glEndPerfQueryINTEL",
+    NULL,
+    "glVertexAttribI4ubvEXT",
+    "glGetFramebufferParameterivMESA",
+    "glGetTexGeniv",
+    "glWindowPos2svARB",
+    "glConvolutionFilter1D",
+    "glGetVertexAttribPointerv",
+    "glVertexAttrib3hvNV",
+    NULL,
+    "glTexCoordPointer",
+    "glUniformMatrix2x3fv",
+    "glTextureBarrierNV",
+    "glGetInteger64v",
+    "glMatrixRotatefEXT",
+    "glCompressedTexSubImage2DARB",
+    "glGetNamedFramebufferParameterfvAMD",
+    "glVertexAttrib3dNV",
+    NULL,
+    NULL,
+    NULL,
+    "glLinkProgramARB",
+    "glGetProgramiv",
+    "wglSwapLayerBuffersMscOML",
+    NULL,
+    "glGetBooleanv",
+    "glGetnUniformui64vARB",
+    "glProgramLocalParametersI4uivNV",
+    "glGetImageHandleARB",
+    "glUniformHandleui64vNV",
+    "glProgramUniform4i64ARB",
+    "glVertexStream2fvATI",
+    "glClearColorxOES",
+    "glVertexAttrib1fvARB",
+    "glReadInstrumentsSGIX",
+    "glTessellationFactorAMD",
+    "glColor3xvOES",
+    "glImageTransformParameteriHP",
+    "glWindowPos3fvMESA",
+    "glMultiTexCoord3dvARB",
+    "glProgramUniform3i64ARB",
+    "glVertexAttribL1d",
+    NULL,
+    "wglQueryFrameCountNV",
+    "glVertexAttribL4dvEXT",
+    "glWindowPos4dMESA",
+    NULL,
+    NULL,
+    "glGetTexLevelParameteriv",
+    "glTextureParameterIuivEXT",
+    "glGetNamedBufferParameterivEXT",
+    "glFramebufferDrawBufferEXT",
+    "glUniform1d",
+    "glVertexAttribs2fvNV",
+    NULL,
+    "glVertexAttrib4s",
+    "glMatrixMultTranspose3x3fNV",
+    "glDetachObjectARB",
+    "glVertexStream1dATI",
+    "glDisableVertexArrayAttrib",
+    "glTexCoord1xvOES",
+    "glTextureStorageMem3DMultisampleEXT",
+    "glDrawRangeElementsEXT",
+    "glGetStageIndexNV",
+    "glIndexdv",
+    NULL,
+    "glVertex3fv",
+    "glMemoryObjectParameterivEXT",
+    "glIsTextureHandleResidentARB",
+    "glMultiDrawElementsIndirectAMD",
+    NULL,
+    NULL,
+    "glProgramUniformHandleui64ARB",
+    "glTexEnviv",
+    "glUseProgramObjectARB",
+    "glGetVertexAttribArrayObjectivATI",
+    NULL,
+    "glTexRenderbufferNV",
+    NULL,
+    NULL,
+    "glBeginFragmentShaderATI",
+    "glImageTransformParameterfvHP",
+    "glFlushVertexArrayRangeNV",
+    NULL,
+    "glMultiTexCoord3xOES",
+    "glTexCoord4fVertex4fSUN",
+    "wglDestroyImageBufferI3D",
+    "glScaled",
+    NULL,
+    "wglGetPixelFormatAttribfvEXT",
+    "glRasterPos4xvOES",
+    "glWindowPos4sMESA",
+    "glMultiTexGenfEXT",
+    "glVDPAURegisterOutputSurfaceNV",
+    "glUniformMatrix2fvARB",
+    "glMaterialiv",
+    NULL,
+    "glGenProgramsNV",
+    "glMultiTexCoord1bOES",
+    "glMultiDrawRangeElementArrayAPPLE",
+    "glGenBuffersARB",
+    "glVertexAttribPointerARB",
+    NULL,
+    "glMultiTexCoord1xvOES",
+    NULL,
+    "glTextureAttachMemoryNV",
+    "glBlitFramebufferLayersEXT",
+    NULL,
+    "glGetHistogramParameterfv",
+    "glPixelMapfv",
+    "glUniform4iARB",
+    "glVideoCaptureStreamParameterdvNV",
+    "glProgramUniform3fv",
+    "glMulticastGetQueryObjectuivNV",
+    "glCreateMemoryObjectsEXT",
+    NULL,
+    "glFogCoorddv",
+    "glPopAttrib",
+    "glBindTextures",
+    "glTexCoord2dv",
+    "glTexStorage3DMultisample",
+    "glVertexAttribL2dEXT",
+    NULL,
+    "glRasterPos4d",
+    NULL,
+    "glGetTextureHandleARB",
+    "glGetMapfv",
+    "glGetProgramEnvParameterdvARB",
+    "glNamedProgramLocalParametersI4ivEXT",
+    "glMinmax",
+    "glTextureBuffer",
+    NULL,
+    "glNamedFramebufferSampleLocationsfvNV",
+    "glMultiModeDrawArraysIBM",
+    "glGetShadingRateImagePaletteNV",
+    NULL,
+    "glMapNamedBuffer",
+    "glCreateTransformFeedbacks",
+    "glIndexFormatNV",
+    "glGetSamplerParameteriv",
+    "glFramebufferParameteri",
+    "glGetInvariantBooleanvEXT",
+    NULL,
+    "glTexGenf",
+    "glGetnTexImageARB",
+    NULL,
+    NULL,
+    "glMultiTexCoordP2ui",
+    NULL,
+    "glVertexAttribL4ui64NV",
+    "glBlendParameteriNV",
+    "glVertexAttribI4iEXT",
+    "glColor3uiv",
+    NULL,
+    "glGetOcclusionQueryivNV",
+    NULL,
+    NULL,
+    NULL,
+    "glRenderbufferStorage",
+    "glBindFragmentShaderATI",
+    "glUniform3d",
+    "glMultiTexCoord4bvOES",
+    "glObjectPurgeableAPPLE",
+    "glMultiTexCoord2dv",
+    "glProgramLocalParameterI4uiNV",
+    "glUnmapBuffer",
+    NULL,
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+    "glBlitFramebuffer",
+    "glProgramParameteriARB",
+    "glGetPixelMapxv",
+    "glDeleteProgramsNV",
+    NULL,
+    "glCallLists",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glViewportSwizzleNV",
+    NULL,
+    NULL,
+    NULL,
+    "glGetUniformui64vARB",
+    "glUniformBlockBinding",
+    "glGetTransformFeedbackiv",
+    "glGetColorTableParameterfvEXT",
+    "glCopyImageSubDataNV",
+    "glGenSamplers",
+    "glCompressedTexSubImage3D",
+    "glPrimitiveRestartIndex",
+    NULL,
+    "wglBlitContextFramebufferAMD",
+    "glPathDashArrayNV",
+    "glGetMapControlPointsNV",
+    "glGetClipPlane",
+    "glSamplerParameterf",
+    "glSemaphoreParameterivNV",
+    "glDeleteMemoryObjectsEXT",
+    "glGetHistogramParameterfvEXT",
+    "glGetInteger64i_v",
+    "wglGetGenlockSampleRateI3D",
+    "glMultiTexCoord3dARB",
+    "glVertex2f",
+    "glNamedFramebufferTexture2DEXT",
+    "glTexCoord4sv",
+    NULL,
+    "glClearStencil",
+    "glUnmapObjectBufferATI",
+    "glUniformMatrix3x4fv",
+    "glPixelZoom",
+    NULL,
+    NULL,
+    "glTexSubImage1D",
+    "wglReleasePbufferDCEXT",
+    NULL,
+    NULL,
+    "glGetFragmentMaterialfvSGIX",
+    NULL,
+    "glTexCoord2xvOES",
+    "glVertexStream3iATI",
+    "wglGetMscRateOML",
+    "glRasterPos3xvOES",
+    "glRasterPos2f",
+    "glEvalCoord1f",
+    "glUnmapNamedBuffer",
+    "glProgramUniformMatrix3dvEXT",
+    NULL,
+    "glMultiTexEnviEXT",
+    "glBeginPerfMonitorAMD",
+    "glGetMultiTexGenivEXT",
+    "glTransformFeedbackVaryingsEXT",
+    "glVertexAttrib3fNV",
+    "glActiveVaryingNV",
+    "glCopyColorSubTableEXT",
+    "glMultMatrixf",
+    NULL,
+    "glBinormal3bEXT",
+    "glDeleteQueries",
+    "glMapGrid2d",
+    "glConvolutionFilter1DEXT",
+    "glProgramUniform2i",
+    NULL,
+    NULL,
+    "glIsRenderbuffer",
+    "glWeightfvARB",
+    "glDetachShader",
+    "glUniform1i64ARB",
+    "glMatrixLoadfEXT",
+    "glColor4iv",
+    "glColor4ui",
+    NULL,
+    NULL,
+    "glSamplerParameterIuiv",
+    "wglIsEnabledFrameLockI3D",
+    "glGetObjectParameterfvARB",
+    "glProgramLocalParameterI4iNV",
+    "glClearDepthf",
+    NULL,
+    "wglDelayBeforeSwapNV",
+    "glProgramUniform4f",
+    "glUniform4uivEXT",
+    "glProgramUniform3dEXT",
+    "glColorPointervINTEL",
+    "glVertexArrayBindingDivisor",
+    "wglQueryFrameTrackingI3D",
+    "glGetListParameterivSGIX",
+    NULL,
+    "glVertexAttribs4dvNV",
+    "glNamedBufferPageCommitmentEXT",
+    "glSampleCoverageARB",
+    NULL,
+    "glTexCoordP2uiv",
+    NULL,
+    "glDetailTexFuncSGIS",
+    "glBinormal3dEXT",
+    NULL,
+    NULL,
+    "glVertexAttribI1iv",
+    NULL,
+    "glVertexAttrib4usvARB",
+    NULL,
+    "glProgramEnvParametersI4ivNV",
+    "glReplacementCodeuiNormal3fVertex3fSUN",
+    NULL,
+    NULL,
+    NULL,
+    "glDeleteProgramsARB",
+    "glVertexAttrib1dARB",
+    NULL,
+    "glPolygonOffsetClamp",
+    "wglDestroyDisplayColorTableEXT",
+    NULL,
+    "glGlobalAlphaFactorfSUN",
+    "glTextureRenderbufferEXT",
+    "glColorFragmentOp3ATI",
+    "glMultiTexCoord4fvARB",
+    "glUniform2fv",
+    "glTransformFeedbackVaryingsNV",
+    NULL,
+    "glBlendFuncSeparateINGR",
+    NULL,
+    NULL,
+    NULL,
+    "glGetTransformFeedbackVarying",
+    "glUniform3fv",
+    NULL,
+    "glDrawTransformFeedbackStream",
+    NULL,
+    NULL,
+    "glVariantfvEXT",
+    NULL,
+    NULL,
+    "glMultiTexEnvfvEXT",
+    "glNamedProgramLocalParameterI4ivEXT",
+    NULL,
+    "glGetVertexArrayIndexediv",
+    "glWindowPos3f",
+    "glGetClipPlanexOES",
+    "wglGetContextGPUIDAMD",
+    "glUseShaderProgramEXT",
+    "glVertexBlendEnvfATI",
+    "glVertexAttrib4NsvARB",
+    "wglDXLockObjectsNV",
+    "glListParameteriSGIX",
+    "glGetFragDataLocationEXT",
+    "glVertexAttribI4iv",
+    "glVertexAttrib3dARB",
+    "wglSetStereoEmitterState3DL",
+    "wglMakeAssociatedContextCurrentAMD",
+    "glSecondaryColorFormatNV",
+    "glPointParameterfSGIS",
+    NULL,
+    "glGetQueryivARB",
+    "glMultiTexCoord1dv",
+    NULL,
+    "glProgramSubroutineParametersuivNV",
+    NULL,
+    NULL,
+    "glSemaphoreParameterui64vEXT",
+    NULL,
+    "glVertexAttribI2ui",
+    "glVertexPointervINTEL",
+    "glProgramUniformui64vNV",
+    "glGetInvariantIntegervEXT",
+    "glSampleCoverage",
+    NULL,
+    "glGetProgramResourceIndex",
+    NULL,
+    NULL,
+    "glProgramUniform3ui",
+    "glVertexAttrib4ubNV",
+    NULL,
+    "glIsProgramARB",
+    "wglGetExtensionsStringEXT",
+    "wglGetSyncValuesOML",
+    "glConvolutionParameterf",
+    NULL,
+    NULL,
+    "glIndexiv",
+    "glGetSharpenTexFuncSGIS",
+    "glRasterPos2iv",
+    NULL,
+    "glMemoryBarrierEXT",
+    NULL,
+    "glTexCoord2xOES",
+    "glGetMultisamplefvNV",
+    NULL,
+    "glTexParameteriv",
+    "glUniform3ui64ARB",
+    "glGetTexBumpParameterivATI",
+    "glProgramLocalParameter4fvARB",
+    NULL,
+    "glGenFencesNV",
+    "glDrawVkImageNV",
+    "glMultiTexSubImage3DEXT",
+    "glPNTrianglesiATI",
+    NULL,
+    "glGetLightfv",
+    "glReplacementCodePointerSUN",
+    "glColorPointer",
+    "glTranslatexOES",
+    "glSampleMaski",
+    NULL,
+    "glSecondaryColor3hvNV",
+    NULL,
+    NULL,
+    "glProgramUniform4uivEXT",
+    "glVertexAttrib2dv",
+    "glMatrixPushEXT",
+    "glCompressedTextureSubImage3DEXT",
+    "glTexStorageSparseAMD",
+    NULL,
+    "glFreeObjectBufferATI",
+    NULL,
+    "glGenTransformFeedbacksNV",
+    "wglWaitForSbcOML",
+    "glProgramUniform3d",
+    "glPolygonOffsetEXT",
+    "glElementPointerATI",
+    "glUnmapBufferARB",
+    NULL,
+    "glScissorExclusiveNV",
+    "glCreateSamplers",
+    "glFramebufferTextureARB",
+    "glColorTable",
+    "glTexStorageMem3DMultisampleEXT",
+    "glCopyTexSubImage1DEXT",
+    "glVertexAttribI4i",
+    "glCheckFramebufferStatus",
+    "glVertexAttribL2dv",
+    NULL,
+    "glGetTransformFeedbacki_v",
+    "glProgramUniform4dv",
+    "glDebugMessageCallbackARB",
+    NULL,
+    "glArrayObjectATI",
+    NULL,
+    NULL,
+    "glRasterSamplesEXT",
+    "glMapGrid1f",
+    "glBeginTransformFeedbackNV",
+    "glMultiTexCoord2hvNV",
+    "glExtractComponentEXT",
+    NULL,
+    NULL,
+    "glVertexArrayColorOffsetEXT",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+    "glMultMatrixxOES",
+    NULL,
+    "glRasterPos3d",
+    "glWindowPos3dv",
+    "wglDXCloseDeviceNV",
+    NULL,
+    "glClearNamedFramebufferiv",
+    NULL,
+    "glVertex2hvNV",
+    NULL,
+    NULL,
+    NULL,
+    "glVertex3xOES",
+    NULL,
+    "glDrawRangeElementsBaseVertex",
+    "glTexStorage1D",
+    "glMapParameterivNV",
+    "glGetArrayObjectfvATI",
+    "glWindowPos2ivMESA",
+    NULL,
+    "glVertex4bvOES",
+    "glVertexAttribLPointerEXT",
+    NULL,
+    "glUniform4ui64vNV",
+    "glCheckNamedFramebufferStatusEXT",
+    NULL,
+    "glVertex2fv",
+    "glMapBufferARB",
+    NULL,
+    "glGetSubroutineUniformLocation",
+    "glVertexAttrib1hvNV",
+    NULL,
+    "glGetNamedBufferParameteriv",
+    "glGetInternalformativ",
+    "glVertexAttribL3dv",
+    "glBindVideoCaptureStreamBufferNV",
+    NULL,
+    NULL,
+    "glDrawElementArrayAPPLE",
+    "glTexCoord2fColor3fVertex3fSUN",
+    NULL,
+    "glVertexPointer",
+    NULL,
+    NULL,
+    NULL,
+    "glTexImage2D",
+    "glGetnHistogramARB",
+    NULL,
+    "glMultiTexCoord2s",
+    "glBindBuffersBase",
+    "glSecondaryColor3fv",
+    "glGetNamedFramebufferParameterivEXT",
+    NULL,
+    "glProgramUniformMatrix4x3fv",
+    "glVertexStream4sATI",
+    "glGetPixelTexGenParameterfvSGIS",
+    "glUniform3uivEXT",
+    "glStencilOpValueAMD",
+    "glSignalVkSemaphoreNV",
+    "glGetShaderSourceARB",
+    "glFogCoordhvNV",
+    "glNamedFramebufferTextureMultiviewOVR",
+    "glIsProgram",
+    "glGetProgramBinary",
+    "glDeleteCommandListsNV",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glTexImage2DMultisample",
+    "glGetBooleanIndexedvEXT",
+    "glUniformMatrix4x2dv",
+    "wglReleaseTexImageARB",
+    "glUniform2i",
+    NULL,
+    "glCoverFillPathNV",
+    NULL,
+    "glValidateProgramPipeline",
+    "wglReleaseImageBufferEventsI3D",
+    NULL,
+    NULL,
+    "glTextureBarrier",
+    "glVertex4sv",
+    "glWindowPos2sARB",
+    "glIndexs",
+    "glSelectBuffer",
+    "glSecondaryColor3bEXT",
+    NULL,
+    "glVertexAttrib4Nubv",
+    "glGetVideoi64vNV",
+    NULL,
+    NULL,
+    "glVertexAttrib4dv",
+    "glProgramParameter4dNV",
+    "glProgramLocalParameter4fARB",
+    NULL,
+    NULL,
+    "glUniform2f",
+    "glCopyMultiTexImage1DEXT",
+    NULL,
+    "glVertexAttrib4Nuiv",
+    "glGetVertexArrayPointeri_vEXT",
+    NULL,
+    "glTransformFeedbackVaryings",
+    "glPrioritizeTexturesEXT",
+    NULL,
+    "glPopName",
+    "glAlphaToCoverageDitherControlNV",
+    NULL,
+    "glCopyTexImage2DEXT",
+    "glGetProgramPipelineInfoLog",
+    NULL,
+    NULL,
+    "glVertex2bOES",
+    "glDepthFunc",
+    "glVertexAttribL3ui64NV",
+    NULL,
+    NULL,
+    "glProgramUniform1fv",
+    "glGetFramebufferParameterivEXT",
+    NULL,
+    "glArrayElementEXT",
+    "glFragmentMaterialivSGIX",
+    "glGetUniformfvARB",
+    "glGetTextureImageEXT",
+    "glMultiDrawElementArrayAPPLE",
+    "glVertexAttribI1iEXT",
+    "glMultiTexParameterIuivEXT",
+    "glGetImageTransformParameterivHP",
+    "glRenderbufferStorageMultisampleCoverageNV",
+    NULL,
+    "glClearBufferSubData",
+    "glPointSize",
+    NULL,
+    "glUniform4dv",
+    NULL,
+    "glEdgeFlagPointerEXT",
+    "glGetnUniformdv",
+    NULL,
+    "glProgramUniform4iv",
+    NULL,
+    "glVertexAttrib2sNV",
+    "glDrawMeshTasksEXT",
+    "glGetVideoCaptureStreamdvNV",
+    "glSetFragmentShaderConstantATI",
+    NULL,
+    NULL,
+    "glVertexAttribLFormat",
+    "glWindowPos2fMESA",
+    "glCopyColorSubTable",
+    NULL,
+    NULL,
+    "glWindowPos4iMESA",
+    "glVertex3bvOES",
+    NULL,
+    "wglBindSwapBarrierNV",
+    "glGetVertexAttribiv",
+    "glGetColorTableParameterfvSGI",
+    "glProgramUniform2dv",
+    "glMemoryBarrierByRegion",
+    NULL,
+    "glEnableVertexAttribAPPLE",
+    "glNormalStream3fATI",
+    "glMatrixMult3x2fNV",
+    "glGetFogFuncSGIS",
+    "glSamplerParameteriv",
+    "glColorFragmentOp1ATI",
+    "glVertexAttribL1ui64ARB",
+    NULL,
+    "glTagSampleBufferSGIX",
+    "glGetMultiTexEnvfvEXT",
+    "glNormalPointer",
+    "glIsMemoryObjectEXT",
+    "glWindowPos3dMESA",
+    "glEvalCoord1fv",
+    NULL,
+    "glGenRenderbuffersEXT",
+    "glColor3bv",
+    "glGetnMapdv",
+    "glMultiTexCoord4ivARB",
+    NULL,
+    "glTestObjectAPPLE",
+    "glVertexStream3ivATI",
+    "glProgramEnvParameterI4uivNV",
+    "glImportSemaphoreWin32NameEXT",
+    NULL,
+    "glGetTexParameterfv",
+    "glTexCoord1iv",
+    "wglCreateBufferRegionARB",
+    "glVertexAttrib4svNV",
+    "glNamedFramebufferRenderbufferEXT",
+    "glColor3i",
+    "glShadeModel",
+    NULL,
+    NULL,
+    "glStencilMask",
+    "glGetCompressedTextureSubImage",
+    "glMapParameterfvNV",
+    "glTexCoord3sv",
+    "glMulticastCopyImageSubDataNV",
+    NULL,
+    "glGetFloatv",
+    "wglCreateAffinityDCNV",
+    "glMultiTexCoord1hNV",
+    "glGetObjectParameterivAPPLE",
+    NULL,
+    "glVertexAttribL1i64vNV",
+    "glMultiDrawArraysEXT",
+    "glEdgeFlagv",
+    "glSamplerParameterfv",
+    NULL,
+    "glGetDebugMessageLog",
+    "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+    "glProgramUniform2i64ARB",
+    "glPointParameterfARB",
+    NULL,
+    "glMapGrid1d",
+    "glMatrixLoadTransposefEXT",
+    "wglQueryPbufferARB",
+    "glFragmentLightiSGIX",
+    NULL,
+    NULL,
+    "glGetUniformBlockIndex",
+    NULL,
+    "glPathGlyphRangeNV",
+    "glVertexAttrib4svARB",
+    NULL,
+    "glMakeTextureHandleResidentARB",
+    NULL,
+    "glPointAlongPathNV",
+    "wglDeleteBufferRegionARB",
+    "wglDXOpenDeviceNV",
+    "glPathSubCoordsNV",
+    "glBindShadingRateImageNV",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexArrayVertexAttribBindingEXT",
+    "glInstrumentsBufferSGIX",
+    "glBindBufferOffsetNV",
+    "glNormal3fv",
+    "glMultiTexCoord3sARB",
+    "glVertexStream4iATI",
+    "glScalexOES",
+    "glVertexAttribI4uivEXT",
+    NULL,
+    "glCreateFramebuffers",
+    NULL,
+    "glSetFenceNV",
+    "glCallList",
+    NULL,
+    NULL,
+    "glFlushStaticDataIBM",
+    "glPresentFrameDualFillNV",
+    "glVertex3xvOES",
+    "glGetMultiTexGenfvEXT",
+    NULL,
+    "glNamedRenderbufferStorageEXT",
+    "glVertexAttribs4svNV",
+    NULL,
+    "glMultiTexCoord2xOES",
+    NULL,
+    "glGetProgramNamedParameterfvNV",
+    NULL,
+    "glGetProgramSubroutineParameteruivNV",
+    "glTextureImage3DMultisampleCoverageNV",
+    NULL,
+    "glPrimitiveRestartIndexNV",
+    "glNormalStream3iATI",
+    "glGetTexEnvxvOES",
+    "glGetObjectPtrLabel",
+    "glImportMemoryWin32NameEXT",
+    "glFlushMappedBufferRangeAPPLE",
+    "glConvolutionParameterfvEXT",
+    "glGetVertexAttribPointervNV",
+    "glVertexArrayIndexOffsetEXT",
+    "glListBase",
+    "glUpdateObjectBufferATI",
+    "glProgramUniformMatrix4x3fvEXT",
+    "glSecondaryColor3sEXT",
+    "glSecondaryColor3dv",
+    "glSpriteParameteriSGIX",
+    "glGetSamplerParameterIuiv",
+    "glWeightPointerARB",
+    "glGetVideoivNV",
+    NULL,
+    "glVertexAttribs3svNV",
+    "glGetPerfQueryInfoINTEL",
+    "glGetMapAttribParameterivNV",
+    NULL,
+    NULL,
+    "glGetnUniformivARB",
+    "glColor4fv",
+    "glBlendEquationSeparateIndexedAMD",
+    "glRasterPos3fv",
+    "glProgramParameter4dvNV",
+    "glUniform1ui64vNV",
+    NULL,
+    "glVDPAUUnmapSurfacesNV",
+    "glMatrixLoadIdentityEXT",
+    NULL,
+    "glVertexAttrib1sv",
+    "glMakeImageHandleResidentNV",
+    "glVertexAttrib1f",
+    "glInvalidateNamedFramebufferData",
+    "glVertexAttrib1dv",
+    "glSecondaryColor3fvEXT",
+    "glVideoCaptureNV",
+    "glFramebufferTexture1DEXT",
+    "glTexStorageMem3DEXT",
+    "glReadnPixels",
+    "glProgramVertexLimitNV",
+    "glMatrixIndexuivARB",
+    "glVertex4bOES",
+    "wglQueryVideoCaptureDeviceNV",
+    "glWindowPos2dvMESA",
+    "glGetMapParameterfvNV",
+    NULL,
+    "glProgramUniform4fv",
+    "glProgramUniform3ivEXT",
+    "glInitNames",
+    "glFogCoordPointerEXT",
+    "glMapTexture2DINTEL",
+    "glBlendColorEXT",
+    "glGetConvolutionParameterivEXT",
+    "glVertexAttrib4NubARB",
+    "glTextureBufferRange",
+    "glStencilThenCoverFillPathInstancedNV",
+    "glPathGlyphIndexRangeNV",
+    "glDepthRangeIndexeddNV",
+    "glPixelTransferf",
+    "glRasterPos4iv",
+    "glFrustumxOES",
+    NULL,
+    "glMapNamedBufferRangeEXT",
+    "glRasterPos3i",
+    "glIglooInterfaceSGIX",
+    "glFramebufferSamplePositionsfvAMD",
+    "glFenceSync",
+    "glFinish",
+    "glShadingRateEXT",
+    "glMultiTexCoord2sv",
+    "glProgramUniform1f",
+    "glTexCoord3fv",
+    "glGetActiveSubroutineName",
+    "wglGetPixelFormatAttribfvARB",
+    NULL,
+    "glEnableVertexAttribArray",
+    "glVertexArrayVertexBindingDivisorEXT",
+    "glBindTransformFeedbackNV",
+    "glTexCoord1i",
+    NULL,
+    "glNormalFormatNV",
+    "glVertexAttrib3fARB",
+    "glProgramUniform2d",
+    "glProgramUniform2ui64NV",
+    "glIsNamedStringARB",
+    "glCompressedTexSubImage1D",
+    "glConservativeRasterParameteriNV",
+    "glMatrixMultTransposefEXT",
+    "glMatrixMult3x3fNV",
+    "glIndexsv",
+    "glGenerateTextureMipmap",
+    "glReplacementCodeusvSUN",
+    "glProgramUniform4i64vNV",
+    "glGetPixelTransformParameterfvEXT",
+    "glVertexAttribI1uivEXT",
+    NULL,
+    NULL,
+    "glColorFragmentOp2ATI",
+    NULL,
+    "glSecondaryColor3usEXT",
+    NULL,
+    "glTexCoord2hNV",
+    "glGetProgramResourceName",
+    NULL,
+    "glMateriali",
+    "glIndexub",
+    "glIsVertexArray",
+    "glDeleteLists",
+    NULL,
+    "glAttachShader",
+    "glCopyTexImage1D",
+    NULL,
+    "glTexCoord3dv",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniform2fvEXT",
+    NULL,
+    "glImageTransformParameterfHP",
+    "glIsFramebufferEXT",
+    NULL,
+    "glProgramUniform4dEXT",
+    "glProgramUniform1uiEXT",
+    "glIsTransformFeedback",
+    "glVertexPointerEXT",
+    "glTexCoord1dv",
+    "glGetShaderPrecisionFormat",
+    "glProgramUniform1d",
+    NULL,
+    "glConvolutionFilter2DEXT",
+    "glGetCompressedTextureImage",
+    "glNamedProgramLocalParameter4fEXT",
+    "glViewportPositionWScaleNV",
+    "glBindRenderbuffer",
+    "glRectfv",
+    "glBlendFuncSeparateiARB",
+    "glVariantivEXT",
+    "glClearColorIuiEXT",
+    "glPathTexGenNV",
+    "glGetProgramStageiv",
+    "glColorTableParameteriv",
+    "glWindowPos3fARB",
+    "glNormalStream3dATI",
+    "glPushDebugGroup",
+    NULL,
+    "glGetProgramivARB",
+    "glGetActiveSubroutineUniformiv",
+    NULL,
+    "glVertexAttribs4ubvNV",
+    "glTextureParameterf",
+    NULL,
+    NULL,
+    "glTangent3svEXT",
+    NULL,
+    "glRecti",
+    "glClientActiveVertexStreamATI",
+    "glScissorIndexedv",
+    "glCoverageModulationNV",
+    "glDrawArrays",
+    "glTexStorage2D",
+    "glBlendEquationSeparateEXT",
+    "glDrawCommandsStatesAddressNV",
+    "glResumeTransformFeedback",
+    "glGetCombinerStageParameterfvNV",
+    "glGetSeparableFilterEXT",
+    "glDeleteProgramPipelines",
+    "glVertexAttrib3sv",
+    "glPointParameterf",
+    NULL,
+    NULL,
+    "glDeleteNamesAMD",
+    "glBeginTransformFeedback",
+    "glCombinerStageParameterfvNV",
+    "glGetVertexAttribfv",
+    NULL,
+    "glProgramUniform3dvEXT",
+    "glCreateQueries",
+    "glTexCoord2fColor4ubVertex3fSUN",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix4dvEXT",
+    "wglBindVideoDeviceNV",
+    "glVertexArrayVertexAttribLOffsetEXT",
+    "glLoadTransposeMatrixd",
+    "glGetFragDataIndex",
+    NULL,
+    "glTexCoord2fColor3fVertex3fvSUN",
+    "glNamedProgramStringEXT",
+    "glUniformMatrix4x2fv",
+    NULL,
+    "glGetImageTransformParameterfvHP",
+    NULL,
+    "glUniform3ivARB",
+    "glProgramUniform4i64vARB",
+    "wglQueryGenlockMaxSourceDelayI3D",
+    "glGetVertexAttribdvNV",
+    "glDrawElementsIndirect",
+    "glProgramNamedParameter4fNV",
+    "glFragmentMaterialfvSGIX",
+    "glProgramUniform4ui",
+    "glProgramUniform3uivEXT",
+    "glGetMinmaxEXT",
+    "glColorTableSGI",
+    "wglEnumerateVideoCaptureDevicesNV",
+    "glGlobalAlphaFactoriSUN",
+    NULL,
+    "glGetPathCoordsNV",
+    "glDrawElementsInstancedEXT",
+    "wglGetGenlockSourceEdgeI3D",
+    NULL,
+    "glEGLImageTargetTexStorageEXT",
+    "glVertexAttrib2svNV",
+    "glRectf",
+    "glVertexStream4fATI",
+    "glUniform1fvARB",
+    NULL,
+    NULL,
+    "glGetDebugMessageLogARB",
+    "glPixelTransformParameterfvEXT",
+    "glMapControlPointsNV",
+    NULL,
+    "glProgramUniformui64NV",
+    "glEnablei",
+    "glStartInstrumentsSGIX",
+    "glVertexArrayVertexOffsetEXT",
+    "glBindImageTexture",
+    "glSecondaryColorPointerEXT",
+    NULL,
+    "glGetListParameterfvSGIX",
+    NULL,
+    NULL,
+    "glVertexAttrib4dARB",
+    NULL,
+    "glNamedFramebufferTextureFaceEXT",
+    "glTexStorageMem1DEXT",
+    "glBindProgramNV",
+    "glRectiv",
+    "glGetUniformSubroutineuiv",
+    "glRenderMode",
+    "glGetString",
+    NULL,
+    "glCullParameterfvEXT",
+    "glColor4s",
+    NULL,
+    "glPixelStorei",
+    NULL,
+    "glShaderSourceARB",
+    "glTextureParameterIuiv",
+    "glDeleteProgram",
+    "glCopyTextureSubImage3D",
+    "glGetVertexAttribivARB",
+    "glVertexAttrib2svARB",
+    NULL,
+    "wglReleaseVideoImageNV",
+    "glMap2f",
+    "glNamedFramebufferTextureLayer",
+    NULL,
+    "glVertexStream1svATI",
+    "glGetQueryBufferObjecti64v",
+    NULL,
+    "glTexCoord2i",
+    NULL,
+    "glBlitNamedFramebuffer",
+    "glMultiTexCoord1dvARB",
+    NULL,
+    "glGenerateMultiTexMipmapEXT",
+    "glPassTexCoordATI",
+    "glTexCoord2fVertex3fSUN",
+    "glNamedProgramLocalParametersI4uivEXT",
+    NULL,
+    "glVertexAttribL2ui64NV",
+    "wglLockVideoCaptureDeviceNV",
+    "glWindowPos2f",
+    "glColorSubTableEXT",
+    "glTextureStorageSparseAMD",
+    "glDepthRangef",
+    "glPauseTransformFeedbackNV",
+    "glAreTexturesResident",
+    "glTessellationModeAMD",
+    "glFramebufferTexture",
+    "glIndexxOES",
+    "glGetFragmentLightivSGIX",
+    "glTextureStorage1DEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glGetnPixelMapuiv",
+    NULL,
+    "glNormal3b",
+    "glPixelDataRangeNV",
+    "wglBindDisplayColorTableEXT",
+    "glProgramEnvParametersI4uivNV",
+    "glUniform2iARB",
+    NULL,
+    "glCreateSyncFromCLeventARB",
+    "glGetPerfQueryIdByNameINTEL",
+    NULL,
+    NULL,
+    "glGetFinalCombinerInputParameterfvNV",
+    "glProgramUniformMatrix2dv",
+    "glTexGenxvOES",
+    "glNormalStream3bvATI",
+    "glVDPAURegisterVideoSurfaceNV",
+    NULL,
+    NULL,
+    "glUniform3iARB",
+    "glBindImageTextures",
+    "glFogCoordfv",
+    NULL,
+    "glEnableClientStateIndexedEXT",
+    NULL,
+    NULL,
+    "glIsTexture",
+    NULL,
+    "glMap2d",
+    "glGetActiveUniformARB",
+    "glBinormal3fvEXT",
+    "glGetTexEnvfv",
+    "glVertexAttribL3i64NV",
+    "glUniformMatrix2x4fv",
+    NULL,
+    "glImportSyncEXT",
+    "glDeleteVertexArraysAPPLE",
+    "glNormal3dv",
+    "glIndexd",
+    NULL,
+    "glPolygonStipple",
+    "glProgramUniform1ui",
+    NULL,
+    "glTextureBufferRangeEXT",
+    "glGetProgramParameterdvNV",
+    "glUniformHandleui64NV",
+    "glColorP4ui",
+    "glDrawArraysInstanced",
+    "glFlushPixelDataRangeNV",
+    NULL,
+    "glWindowPos2iMESA",
+    "glWeightPathsNV",
+    NULL,
+    "glSecondaryColor3hNV",
+    "wglGetSwapIntervalEXT",
+    "glUniformMatrix4x3fv",
+    "glCopyPathNV",
+    "glColor4xvOES",
+    NULL,
+    "glDeletePathsNV",
+    "glProgramUniformMatrix3x2dv",
+    "glEnableVertexAttribArrayARB",
+    "glUniformSubroutinesuiv",
+    "glAsyncCopyBufferSubDataNVX",
+    "glGetTextureParameterivEXT",
+    "glGetPixelTexGenParameterivSGIS",
+    "glMultTransposeMatrixd",
+    "wglDXUnregisterObjectNV",
+    NULL,
+    "glGetVariantPointervEXT",
+    "glGetPerfMonitorCountersAMD",
+    "glUniform4i",
+    NULL,
+    "glVertexAttribs2svNV",
+    NULL,
+    "glWindowPos2fvARB",
+    "glProgramUniform4ivEXT",
+    "glProgramUniform2iv",
+    NULL,
+    NULL,
+    "glVertexStream3sATI",
+    "glSecondaryColor3fEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexAttribI3iv",
+    "glProgramUniformMatrix2x4dvEXT",
+    "wglDeleteAssociatedContextAMD",
+    "glGetTexParameterxvOES",
+    "glTexCoord2hvNV",
+    "glWindowPos3fv",
+    "glGetTextureParameterfv",
+    "glInvalidateNamedFramebufferSubData",
+    "glWindowPos3s",
+    "glVertexAttrib2fvARB",
+    NULL,
+    NULL,
+    "glProgramUniformHandleui64vNV",
+    "glVertexAttribI2uiEXT",
+    "glVertexAttrib2hvNV",
+    "glMultiTexCoord2svARB",
+    "glGetnUniformfv",
+    "glReplacementCodeuiColor3fVertex3fSUN",
+    "glGetQueryObjectiv",
+    NULL,
+    NULL,
+    NULL,
+    "glMultMatrixd",
+    "glProgramUniformMatrix3x4fv",
+    "glGetPerfMonitorGroupStringAMD",
+    "glProgramUniform1i64NV",
+    "glFramebufferReadBufferEXT",
+    NULL,
+    "glMultiTexCoord3fvARB",
+    "glIsBufferResidentNV",
+    "glBlendFuncSeparatei",
+    NULL,
+    NULL,
+    NULL,
+    "glCompressedTexImage3D",
+    "glMultiTexCoord1d",
+    NULL,
+    "glFogxOES",
+    "glGetQueryIndexediv",
+    NULL,
+    "wglSendPbufferToVideoNV",
+    "glFramebufferTextureMultiviewOVR",
+    "glUniformMatrix4fvARB",
+    "glFramebufferParameteriMESA",
+    NULL,
+    "glGetnUniformuivARB",
+    "glShadingRateSampleOrderNV",
+    "glDeleteVertexShaderEXT",
+    NULL,
+    NULL,
+    "glVertex4s",
+    "glApplyTextureEXT",
+    "glStencilMaskSeparate",
+    "glGetQueryObjectui64v",
+    "glVertexStream3dvATI",
+    "glEnable",
+    "glStencilFillPathInstancedNV",
+    "glMakeTextureHandleResidentNV",
+    NULL,
+    "glVertexAttribI3uiv",
+    NULL,
+    "glCompressedTextureImage1DEXT",
+    "glGetPerfMonitorGroupsAMD",
+    "glIsProgramNV",
+    "glGetProgramResourceLocation",
+    "glDrawArraysInstancedEXT",
+    "glDisableVertexAttribAPPLE",
+    "wglFreeMemoryNV",
+    NULL,
+    NULL,
+    "glDrawBuffersARB",
+    NULL,
+    "glStencilStrokePathInstancedNV",
+    "glVertexAttrib4Nusv",
+    "glBindTextureUnitParameterEXT",
+    NULL,
+    "glTexSubImage4DSGIS",
+    "glBufferSubData",
+    "glGetVariantBooleanvEXT",
+    NULL,
+    NULL,
+    "glSecondaryColor3iv",
+    NULL,
+    NULL,
+    NULL,
+    "wglCreateAssociatedContextAMD",
+    NULL,
+    NULL,
+    "glVertexAttrib4f",
+    "glVertexAttribL3dEXT",
+    "glFogiv",
+    "glGetFramebufferAttachmentParameteriv",
+    NULL,
+    "glRectsv",
+    "glMakeImageHandleNonResidentNV",
+    NULL,
+    "glProgramUniform2fEXT",
+    "glGetFirstPerfQueryIdINTEL",
+    "glResumeTransformFeedbackNV",
+    NULL,
+    "glShaderOp1EXT",
+    NULL,
+    "glMultiDrawMeshTasksIndirectCountNV",
+    "glMultiTexCoord4dARB",
+    "glMatrixTranslatefEXT",
+    "glAsyncMarkerSGIX",
+    "glResetMinmaxEXT",
+    "glEdgeFlagFormatNV",
+    "glGetQueryObjectuivARB",
+    NULL,
+    "glBlendEquationSeparatei",
+    "glMakeImageHandleNonResidentARB",
+    "glVertexAttrib1dvNV",
+    "glMulticastViewportPositionWScaleNVX",
+    "glUniform3uiEXT",
+    "glGenFencesAPPLE",
+    "glRasterPos3dv",
+    "glTextureStorage3DEXT",
+    NULL,
+    "glTexCoord2s",
+    "glTexPageCommitmentARB",
+    NULL,
+    "glFinishFenceNV",
+    NULL,
+    "glGetProgramEnvParameterIivNV",
+    "glPopGroupMarkerEXT",
+    "glMultiTexCoordP3uiv",
+    "glFlushVertexArrayRangeAPPLE",
+    "glCreateProgressFenceNVX",
+    NULL,
+    "glMultiTexParameterfEXT",
+    "glGetPathParameterfvNV",
+    "glVariantArrayObjectATI",
+    "glAlphaFragmentOp3ATI",
+    "glMultiTexCoord2fARB",
+    "glProgramUniformMatrix3x4fvEXT",
+    "glClearTexSubImage",
+    NULL,
+    "glGetTexParameterIiv",
+    NULL,
+    "glGetSamplerParameterIiv",
+    NULL,
+    "glVertexAttribI2iv",
+    "glImportSemaphoreFdEXT",
+    "glMultiTexCoord1ivARB",
+    NULL,
+    "glSecondaryColorP3ui",
+    "glSecondaryColor3bv",
+    NULL,
+    "glEvalCoord2d",
+    NULL,
+    NULL,
+    "glSignalSemaphoreui64NVX",
+    "glVertexStream1fATI",
+    "glTexCoord3f",
+    NULL,
+    NULL,
+    NULL,
+    "glGetCompressedTexImage",
+    NULL,
+    "glCopyTextureSubImage1DEXT",
+    NULL,
+    "glWindowPos3sMESA",
+    "glNormalP3uiv",
+    "glPushName",
+    NULL,
+    "glUniform3ui64vNV",
+    "glCombinerParameterivNV",
+    NULL,
+    "glCompressedMultiTexImage3DEXT",
+    NULL,
+    "glTexCoord3hNV",
+    "glGetPointerIndexedvEXT",
+    "glTransformPathNV",
+    "glMultiTexCoord2bvOES",
+    NULL,
+    "glLinkProgram",
+    "glVertexAttrib2dARB",
+    "glSecondaryColor3us",
+    "glIsQuery",
+    "glProgramUniform2fv",
+    "glInvalidateTexImage",
+    "glDrawElementsInstancedBaseVertex",
+    NULL,
+    "glProgramNamedParameter4dNV",
+    "glWindowPos2iARB",
+    "glColor4fNormal3fVertex3fSUN",
+    "glColor3dv",
+    "glCombinerInputNV",
+    "wglSwapBuffersMscOML",
+    "glColor4hNV",
+    "wglIsEnabledGenlockI3D",
+    "glBufferDataARB",
+    "glGetTextureLevelParameteriv",
+    "glStencilFuncSeparate",
+    "glWindowPos3ivARB",
+    "glBindRenderbufferEXT",
+    "glMultiTexParameterIivEXT",
+    NULL,
+    "wglCreatePbufferARB",
+    NULL,
+    NULL,
+    "glBindTextureUnit",
+    "glTexCoord1s",
+    "glProgramEnvParameter4dARB",
+    "glProgramUniformMatrix2dvEXT",
+    "glVertexStream4ivATI",
+    NULL,
+    "glGetPerfMonitorCounterDataAMD",
+    "glMultTransposeMatrixf",
+    "glBeginQueryIndexed",
+    "glPathParameterivNV",
+    "glProgramUniform4iEXT",
+    "glEnableVariantClientStateEXT",
+    NULL,
+    "glVertexArrayVertexAttribOffsetEXT",
+    "glGetMapAttribParameterfvNV",
+    "glStencilFunc",
+    "glProgramUniform3uiv",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glVertexAttribI2uivEXT",
+    NULL,
+    "glVertexAttribI4sv",
+    "glGetMultiTexImageEXT",
+    "glGetVideouivNV",
+    "glGetTexGenfv",
+    "wglAllocateMemoryNV",
+    "glNormalStream3ivATI",
+    "glSetFenceAPPLE",
+    "wglChoosePixelFormatARB",
+    "glReplacementCodeuivSUN",
+    "glPixelMapx",
+    "glUniform1uiEXT",
+    "glWindowPos2s",
+    "glUniform1ui64ARB",
+    "glCreateShader",
+    "glProgramUniform1iEXT",
+    "wglDestroyPbufferARB",
+    "glProgramEnvParameterI4ivNV",
+    "glNewList",
+    "glVertexArrayTexCoordOffsetEXT",
+    "glGetTextureSubImage",
+    NULL,
+    NULL,
+    "glBeginConditionalRenderNV",
+    "glCopyMultiTexSubImage2DEXT",
+    "glDeleteAsyncMarkersSGIX",
+    "glMapVertexAttrib2dAPPLE",
+    "glMultiTexCoord1iARB",
+    "glUniformMatrix2dv",
+    "wglDisableFrameLockI3D",
+    "glEndFragmentShaderATI",
+    NULL,
+    "glMulticastBarrierNV",
+    "glGetPointervEXT",
+    "glMap2xOES",
+    "glMapVertexAttrib1fAPPLE",
+    NULL,
+    "glLightModelxvOES",
+    "glReadBuffer",
+    NULL,
+    "glVertexAttribL3d",
+    "glMapNamedBufferEXT",
+    NULL,
+    "glVertexAttribI2uiv",
+    "glFragmentLightModelfvSGIX",
+    "glProgramUniform2ui64vNV",
+    "glUniform4ui64vARB",
+    NULL,
+    "glTangent3ivEXT",
+    "glUniform1i64NV",
+    "glVertexAttribs1hvNV",
+    "glWindowPos3dARB",
+    "glTextureImage2DMultisampleNV",
+    "glGetVariantArrayObjectivATI",
+    NULL,
+    "glActiveShaderProgram",
+    "glIsVertexAttribEnabledAPPLE",
+    "glTexImage4DSGIS",
+    NULL,
+    NULL,
+    "glGetBufferParameteriv",
+    "glVertexAttribI3ui",
+    "glFramebufferTexture3D",
+    NULL,
+    "glPathGlyphIndexArrayNV",
+    "glTexCoord4dv",
+    "glCurrentPaletteMatrixARB",
+    "glExecuteProgramNV",
+    "glMultiTexCoord2dvARB",
+    "glUniform1i64vNV",
+    "glBlitFramebufferLayerEXT",
+    "glCombinerParameterfNV",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformHandleui64vARB",
+    "glMapBufferRange",
+    NULL,
+    NULL,
+    "glMultiTexGenfvEXT",
+    NULL,
+    NULL,
+    "glEdgeFlag",
+    "glTextureParameterivEXT",
+    NULL,
+    "wglGenlockSampleRateI3D",
+    "glFogCoordd",
+    "glVertexAttrib4ubvNV",
+    "glCreateShaderProgramv",
+    "glWeightuivARB",
+    NULL,
+    "glMatrixMultdEXT",
+    "glGetTransformFeedbackVaryingEXT",
+    "glTbufferMask3DFX",
+    "glVertexStream4dvATI",
+    "glMultiTexCoord4xvOES",
+    "glBindFragDataLocationIndexed",
+    NULL,
+    NULL,
+    "glGetUniformdv",
+    NULL,
+    "glBindBufferRangeEXT",
+    "glTexCoordP1uiv",
+    NULL,
+    "glConvolutionParameteriEXT",
+    "glFramebufferTextureEXT",
+    "glGenTexturesEXT",
+    "glUniformHandleui64vARB",
+    "glFogCoordPointer",
+    "glMultiTexCoord4xOES",
+    "glGetTexEnviv",
+    "glTexCoord4xvOES",
+    "glDeleteQueriesARB",
+    "glVertexAttrib4Nub",
+    "glGenPerfMonitorsAMD",
+    "glGetMemoryObjectParameterivEXT",
+    "glColorP4uiv",
+    "glGetPixelMapusv",
+    "glClearBufferfi",
+    "glVertexStream1fvATI",
+    "glGetError",
+    "glGetMinmaxParameterfv",
+    NULL,
+    "glWindowPos3iv",
+    NULL,
+    NULL,
+    "glVertexAttrib3hNV",
+    NULL,
+    "glVertexAttribBinding",
+    "glGetTransformFeedbacki64_v",
+    "glGetPathTexGenfvNV",
+    "glProgramUniform2iEXT",
+    "glGetMultiTexParameterIivEXT",
+    NULL,
+    "glGetObjectParameterivARB",
+    "glMultiTexCoord2f",
+    "glPassThroughxOES",
+    NULL,
+    "glProvokingVertex",
+    "glPathMemoryGlyphIndexArrayNV",
+    "glRenderGpuMaskNV",
+    "glGetProgramNamedParameterdvNV",
+    "glNormalStream3sATI",
+    "glGetQueryBufferObjectiv",
+    "glFogCoordPointerListIBM",
+    "glSpriteParameterfvSGIX",
+    "wglDeleteDCNV",
+    NULL,
+    "glRasterPos2s",
+    "glSecondaryColor3dvEXT",
+    NULL,
+    "glGetProgramStringARB",
+    "glLightModelxOES",
+    "glGetMultiTexGendvEXT",
+    "glPixelTransferi",
+    "wglCreatePbufferEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glWindowPos4svMESA",
+    NULL,
+    "glColor3s",
+    "glPixelTexGenParameterivSGIS",
+    "glProgramUniform3i64NV",
+    NULL,
+    "glGetColorTableParameterivSGI",
+    "glVertexArrayFogCoordOffsetEXT",
+    "glWindowRectanglesEXT",
+    "glTransformFeedbackBufferBase",
+    "glScissorArrayv",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformMatrix4x2fv",
+    "glElementPointerAPPLE",
+    "glStencilThenCoverStrokePathNV",
+    NULL,
+    "glVertexAttribL1dv",
+    "glProgramUniform4i",
+    "glProgramUniform1ui64vARB",
+    "glGetCombinerInputParameterfvNV",
+    "glVertexAttribI4ivEXT",
+    NULL,
+    "glMultiTexEnvivEXT",
+    "wglGetFrameUsageI3D",
+    "glMultiTexCoord3iv",
+    "glFragmentMaterialiSGIX",
+    "glTexBufferRange",
+    "glPixelTexGenParameterfSGIS",
+    "glMultiTexCoord4dvARB",
+    "glTextureNormalEXT",
+    "glNamedFramebufferRenderbuffer",
+    "glColor3hvNV",
+    "glVertexArrayVertexAttribIOffsetEXT",
+    "glMulticastGetQueryObjectivNV",
+    NULL,
+    "glColor4uiv",
+    "glWindowPos2dMESA",
+    "glGetObjectBufferivATI",
+    "glFinishObjectAPPLE",
+    "glIndexfv",
+    "wglAssociateImageBufferEventsI3D",
+    NULL,
+    "glVertexStream3fvATI",
+    "glGetFragmentShadingRatesEXT",
+    "glGetQueryObjectivARB",
+    NULL,
+    "glProgramUniform3i",
+    "glBindVertexShaderEXT",
+    "glVertexAttribs3fvNV",
+    "glVertexAttrib4fvNV",
+    "glConservativeRasterParameterfNV",
+    NULL,
+    "glGetMapParameterivNV",
+    "wglCreateContextAttribsARB",
+    "glEvalCoord2f",
+    "glColor3d",
+    "glTextureRangeAPPLE",
+    NULL,
+    "glDrawCommandsAddressNV",
+    "glGetTexGenxvOES",
+    NULL,
+    "glProgramLocalParameter4dARB",
+    "glTexCoord1xOES",
+    "glDisableClientState",
+    "glViewportIndexedf",
+    NULL,
+    NULL,
+    "glLogicOp",
+    "glWindowPos2dv",
+    NULL,
+    "glCheckNamedFramebufferStatus",
+    "glIndexxvOES",
+    "glColorPointerEXT",
+    "glBitmap",
+    NULL,
+    NULL,
+    "glVertexP3ui",
+    "glVariantuivEXT",
+    "glAlphaFuncxOES",
+    NULL,
+    NULL,
+    "glCreateBuffers",
+    "glProgramUniform3dv",
+    NULL,
+    NULL,
+    "glGetVideoCaptureStreamfvNV",
+    "glVertexArrayAttribIFormat",
+    NULL,
+    "glPixelTexGenParameteriSGIS",
+    NULL,
+    "glUniform2ui64vARB",
+    "glUniform4fARB",
+    NULL,
+    "glVertexAttrib3fvARB",
+    "glProgramEnvParameter4fARB",
+    "glVertexAttribL4d",
+    NULL,
+    "glDrawRangeElementArrayAPPLE",
+    "glGetTexParameteriv",
+    NULL,
+    "glDeletePerfQueryINTEL",
+    "glWeightdvARB",
+    "glVertexAttribI4usv",
+    "glColor3hNV",
+    "glMultiTexImage3DEXT",
+    "glTexStorage2DEXT",
+    NULL,
+    "glUniform3fARB",
+    NULL,
+    "glMultiTexCoordP4uiv",
+    "glTexCoord2d",
+    "glDrawMeshArraysSUN",
+    "glLightfv",
+    "glUniform3i",
+    "glScissorIndexed",
+    "glTexSubImage3DEXT",
+    "glProgramUniform4ui64NV",
+    "glFogf",
+    "glVertexAttribFormatNV",
+    NULL,
+    "glProgramUniformMatrix3x2fvEXT",
+    NULL,
+    "glColor3ub",
+    "glVertexAttrib3sNV",
+    "glVertexAttribL2d",
+    NULL,
+    "glDrawArraysIndirect",
+    NULL,
+    "glVertexAttrib1svNV",
+    "glFragmentLightivSGIX",
+    "wglDXRegisterObjectNV",
+    "glGetPathColorGenivNV",
+    "glScalef",
+    "glVertex3d",
+    NULL,
+    "glVertexAttribP2uiv",
+    "glGetnMinmax",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix2x3dv",
+    "glDebugMessageControlARB",
+    NULL,
+    "glProgramLocalParameters4fvEXT",
+    "glFlushRasterSGIX",
+    "glRequestResidentProgramsNV",
+    "glDebugMessageEnableAMD",
+    "glCopyTextureSubImage2DEXT",
+    "glProgramUniform4uiEXT",
+    "glGetMaterialfv",
+    NULL,
+    "glGetNamedProgramStringEXT",
+    NULL,
+    "glMinSampleShadingARB",
+    "glNamedFramebufferSamplePositionsfvAMD",
+    "glCreateProgram",
+    "glMultiTexCoord2hNV",
+    "glCompressedTexImage2D",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glGetPathColorGenfvNV",
+    "glVertexAttribP2ui",
+    "glProgramUniform1i64vNV",
+    "glTextureParameterIivEXT",
+    NULL,
+    "glViewport",
+    "glBindVideoCaptureStreamTextureNV",
+    "glEnableClientStateiEXT",
+    "wglGetGammaTableParametersI3D",
+    "glUniformMatrix3x2dv",
+    "glNamedFramebufferTextureEXT",
+    "glCreateStatesNV",
+    "glWaitSemaphoreui64NVX",
+    "glGetVideoCaptureStreamivNV",
+    "glVertexAttrib1fv",
+    "glGetDetailTexFuncSGIS",
+    NULL,
+    NULL,
+    "glGlobalAlphaFactorubSUN",
+    NULL,
+    NULL,
+    "glProgramUniform1ui64ARB",
+    "glVertexP4uiv",
+    "glTexFilterFuncSGIS",
+    "glPauseTransformFeedback",
+    "glTexCoordPointerListIBM",
+    "glBindAttribLocationARB",
+    "glGetnMapdvARB",
+    "glEnableClientState",
+    "glCopyConvolutionFilter2DEXT",
+    "glProgramUniform1dv",
+    "glMultiTexCoord4hvNV",
+    "glCopyTexImage1DEXT",
+    "glCopyTexSubImage1D",
+    "glMultiTexCoord1sv",
+    "glProgramParameters4dvNV",
+    NULL,
+    "glMulticastGetQueryObjecti64vNV",
+    NULL,
+    "glLoadTransposeMatrixxOES",
+    "glRectd",
+    "glTexCoord3hvNV",
+    "glCompressedTexImage1D",
+    "glFramebufferTexture1D",
+    NULL,
+    "wglEnumerateVideoDevicesNV",
+    NULL,
+    "glVertexAttribPointerNV",
+    "glNormal3d",
+    "glCompressedTextureImage3DEXT",
+    "glGetnTexImage",
+    "glProgramUniform2uiv",
+    "glGenBuffers",
+    "glGetProgramStringNV",
+    "glVertexAttribLFormatNV",
+    "glCreateProgramPipelines",
+    NULL,
+    "glVDPAUUnregisterSurfaceNV",
+    NULL,
+    "glPathParameterfNV",
+    "glPixelTransformParameterivEXT",
+    NULL,
+    "glProgramBufferParametersIuivNV",
+    NULL,
+    "glSecondaryColor3bvEXT",
+    "glGetVertexArrayIntegeri_vEXT",
+    NULL,
+    NULL,
+    "glTextureStorage1D",
+    "glStringMarkerGREMEDY",
+    NULL,
+    NULL,
+    "glVertexAttrib2fv",
+    NULL,
+    NULL,
+    NULL,
+    "glVertexWeighthvNV",
+    "glGetTexParameterIivEXT",
+    NULL,
+    NULL,
+    "glWindowPos2svMESA",
+    "glBindImageTextureEXT",
+    "glRasterPos2fv",
+    NULL,
+    "glProgramUniform2dvEXT",
+    NULL,
+    "glColor4ubVertex2fvSUN",
+    "glBufferAddressRangeNV",
+    "glFogCoorddvEXT",
+    "glCopyNamedBufferSubData",
+    "glVertex3s",
+    "glVertex2sv",
+    NULL,
+    "wglSwapIntervalEXT",
+    "glListDrawCommandsStatesClientNV",
+    "glRotated",
+    "glIsNameAMD",
+    "glUniform2ui",
+    "glEnd",
+    "glGetProgramivNV",
+    NULL,
+    "glTextureSubImage3D",
+    NULL,
+    NULL,
+    NULL,
+    "glUniform4d",
+    "glFragmentLightfSGIX",
+    "glPathParameteriNV",
+    "glNormalStream3svATI",
+    NULL,
+    "glGenVertexShadersEXT",
+    "glTextureStorage3DMultisampleEXT",
+    NULL,
+    "glPixelStoref",
+    "glProgramUniform4fEXT",
+    "glCompileCommandListNV",
+    "glProgramEnvParameterI4iNV",
+    "glTexCoordPointerEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glTexCoord4hvNV",
+    "glDeleteShader",
+    "glNamedProgramLocalParameterI4uivEXT",
+    "glMap1xOES",
+    "glVertexStream3fATI",
+    "glCopyTextureSubImage3DEXT",
+    "glUniform1ui",
+    "glMap1f",
+    "glVertex3dv",
+    "glTexCoord4hNV",
+    NULL,
+    "glProgramUniformMatrix2x4dv",
+    "glGetPixelMapfv",
+    "glProgramParameteri",
+    NULL,
+    "glVertex3sv",
+    "glVertexArrayVertexAttribIFormatEXT",
+    "glWindowPos4dvMESA",
+    NULL,
+    "glPixelMapusv",
+    "glMultiTexCoord3sv",
+    NULL,
+    NULL,
+    "glTexSubImage2DEXT",
+    "glDrawElementArrayATI",
+    "glGlobalAlphaFactorusSUN",
+    NULL,
+    "glProgramUniform1dvEXT",
+    "glLightModeliv",
+    "glNormal3fVertex3fvSUN",
+    "glGetOcclusionQueryuivNV",
+    "glCompressedTexImage2DARB",
+    "glMatrixLoad3x2fNV",
+    "glClearIndex",
+    "glProgramUniform3iv",
+    NULL,
+    "glMultiDrawElementsIndirectCountARB",
+    "glUniform2dv",
+    NULL,
+    "glMultiTexCoord1iv",
+    NULL,
+    "glWriteMaskEXT",
+    "glTexStorageMem2DMultisampleEXT",
+    "glTexCoord4i",
+    "glClearColorIiEXT",
+    "glDeleteRenderbuffers",
+    "glColor4us",
+    "glUniform1iv",
+    NULL,
+    NULL,
+    NULL,
+    "glUniform1fv",
+    "glMultiTexCoord3svARB",
+    "glVertexAttribParameteriAMD",
+    "glProgramUniform3i64vARB",
+    "glShadingRateImageBarrierNV",
+    "glProgramUniform1dEXT",
+    NULL,
+    "glGetColorTable",
+    NULL,
+    NULL,
+    NULL,
+    "glTextureLightEXT",
+    "glMultiTexCoord1hvNV",
+    "glUniform1ui64NV",
+    NULL,
+    NULL,
+    "glWindowPos2fv",
+    "glRotatexOES",
+    "glFramebufferFetchBarrierEXT",
+    "glDisableVertexAttribArray",
+    "glGetUniformOffsetEXT",
+    "glGetVertexAttribIuivEXT",
+    NULL,
+    "glTexImage3DMultisample",
+    "glIsTransformFeedbackNV",
+    "glUniform2ivARB",
+    "glViewportIndexedfv",
+    NULL,
+    "glMultiDrawArraysIndirectCountARB",
+    "glClampColorARB",
+    "glSecondaryColor3usv",
+    "glGetMultiTexParameterivEXT",
+    NULL,
+    "glPatchParameteri",
+    "glIsOcclusionQueryNV",
+    "glMultiTexSubImage1DEXT",
+    "glMultiDrawArraysIndirect",
+    "glNamedProgramLocalParameter4dvEXT",
+    "glGetFloati_v",
+    "glUniform2iv",
+    "glCoverStrokePathInstancedNV",
+    "glPathParameterfvNV",
+    "glBindFragDataLocation",
+    "glGetNamedBufferPointervEXT",
+    NULL,
+    "glFramebufferSampleLocationsfvARB",
+    "glAlphaFragmentOp2ATI",
+    NULL,
+    "glVertexAttrib4NivARB",
+    "wglRestoreBufferRegionARB",
+    "glMultiTexCoord1i",
+    "glListParameterfSGIX",
+    "glGetActiveSubroutineUniformName",
+    NULL,
+    NULL,
+    "glGetFenceivNV",
+    "glSignalVkFenceNV",
+    "glVertex3i",
+    "glFramebufferTexture2D",
+    NULL,
+    "glVertexAttribI4bv",
+    "glTextureParameterfvEXT",
+    "glUniform2i64vARB",
+    "glGetProgramResourcefvNV",
+    NULL,
+    "glUniformMatrix2x4dv",
+    "glGetImageHandleNV",
+    "glVertexBlendEnviATI",
+    "glIsFenceAPPLE",
+    "glVertexAttrib4Niv",
+    "glTexCoord1d",
+    "glPresentFrameKeyedNV",
+    NULL,
+    "glColor3ubv",
+    "glIsAsyncMarkerSGIX",
+    NULL,
+    "glObjectPtrLabel",
+    NULL,
+    "glGetVertexAttribdvARB",
+    "glNamedRenderbufferStorageMultisampleCoverageEXT",
+    "glAttachObjectARB",
+    "glCommandListSegmentsNV",
+    NULL,
+    "glReplacementCodeuiColor4ubVertex3fSUN",
+    "glGetnUniformiv",
+    "glDispatchCompute",
+    "glRasterPos2sv",
+    "glCoverageModulationTableNV",
+    "glGetActiveUniformName",
+    "glGetTextureParameterIuivEXT",
+    "glGetTextureParameteriv",
+    "glGetTexBumpParameterfvATI",
+    "glIsObjectBufferATI",
+    "glLoadIdentityDeformationMapSGIX",
+    "glProgramNamedParameter4fvNV",
+    "glNamedFramebufferTextureLayerEXT",
+    "glTexCoord4bvOES",
+    "glBindFragDataLocationEXT",
+    "glPointSizexOES",
+    "glShaderOp3EXT",
+    "glPixelTexGenParameterfvSGIS",
+    "glVDPAUMapSurfacesNV",
+    "glActiveStencilFaceEXT",
+    "glNamedProgramLocalParameterI4iEXT",
+    "glEndVertexShaderEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+    NULL,
+    NULL,
+    "glDrawBuffers",
+    NULL,
+    "wglGetPbufferDCARB",
+    "glCopyTextureSubImage1D",
+    "wglGetGammaTableI3D",
+    "glIsFenceNV",
+    "glLighti",
+    "glIsBufferARB",
+    "wglGetGenlockSourceDelayI3D",
+    "glMapBuffer",
+    "glMaterialf",
+    NULL,
+    "glMultiTexCoord3f",
+    "glProgramUniform4fvEXT",
+    NULL,
+    "glGetShaderSource",
+    "glDeformationMap3fSGIX",
+    "glReplacementCodeubSUN",
+    "glCompressedTextureSubImage1D",
+    "glTexCoord3i",
+    "glFragmentCoverageColorNV",
+    "glMultiTexCoordP3ui",
+    NULL,
+    "glDeleteTexturesEXT",
+    "glVertexAttribI1uiEXT",
+    "glGetProgramEnvParameterfvARB",
+    "glVertexAttrib4Nbv",
+    "glMultiTexCoord1dARB",
+    "glTexCoord2bvOES",
+    "glMatrixFrustumEXT",
+    NULL,
+    "glUniform3iv",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glProgramUniformMatrix2x3fv",
+    NULL,
+    NULL,
+    "glVertexAttribI2i",
+    "glTextureStorage2DMultisampleEXT",
+    "glVertexArrayMultiTexCoordOffsetEXT",
+    NULL,
+    "glProgramUniform3ui64vNV",
+    "glVertexAttribs4fvNV",
+    "glBlendEquationEXT",
+    NULL,
+    "glGetnSeparableFilter",
+    "glGlobalAlphaFactoruiSUN",
+    NULL,
+    "wglEnumGpusFromAffinityDCNV",
+    "glMapVertexAttrib2fAPPLE",
+    NULL,
+    "glGetPolygonStipple",
+    "glWindowPos3dvARB",
+    "glVertex4fv",
+    "glMatrixLoaddEXT",
+    "glVertexArrayParameteriAPPLE",
+    "glEnableVertexArrayEXT",
+    "glConvolutionParameterfEXT",
+    NULL,
+    NULL,
+    "glEndQueryARB",
+    NULL,
+    "glTexCoord4fv",
+    NULL,
+    NULL,
+    "glLightEnviSGIX",
+    "glInterleavedArrays",
+    "glCompileShader",
+    "glBlendEquationSeparate",
+    "wglEnableGenlockI3D",
+    NULL,
+    "glBufferData",
+    "glGetTextureLevelParameterfvEXT",
+    "glTextureParameterIiv",
+    "glIsPathNV",
+    NULL,
+    "glBinormal3ivEXT",
+    "glGetnPixelMapfv",
+    "glBindMaterialParameterEXT",
+    "glEvalCoord2xvOES",
+    "glGetGraphicsResetStatusARB",
+    NULL,
+    "glMakeNamedBufferResidentNV",
+    "glWindowPos3svMESA",
+    "glNamedBufferPageCommitmentARB",
+    "glVertexP3uiv",
+    NULL,
+    NULL,
+    "glDrawMeshTasksNV",
+    "glGetSeparableFilter",
+    "glDrawElements",
+    "glNamedBufferStorageMemEXT",
+    NULL,
+    "glCreateSemaphoresNV",
+    "glPathSubCommandsNV",
+    "glMapNamedBufferRange",
+    "glTextureParameteri",
+    NULL,
+    "glCompressedMultiTexImage1DEXT",
+    "glProgramEnvParameterI4uiNV",
+    "glVertexAttrib2fNV",
+    "glGetnPixelMapusv",
+    "glLGPUInterlockNVX",
+    "glNormalPointervINTEL",
+    NULL,
+    "glVertexAttribIFormatNV",
+    "glIsVertexArrayAPPLE",
+    "glGetMapdv",
+    "glVertexAttrib4fvARB",
+    NULL,
+    NULL,
+    "glGetTexLevelParameterxvOES",
+    "glTexCoord3xvOES",
+    "glUniform4ivARB",
+    "glVertexAttribI4ui",
+    "glVertexAttrib3fvNV",
+    "glGenLists",
+    "glDepthRangexOES",
+    "glGetTextureParameterIiv",
+    "glIsTextureEXT",
+    NULL,
+    NULL,
+    "glGetPerfMonitorCounterStringAMD",
+    "glRasterPos4dv",
+    NULL,
+    "glPathCommandsNV",
+    "glGetArrayObjectivATI",
+    "glGetnPixelMapfvARB",
+    "glPointParameterfEXT",
+    "glGetnPolygonStipple",
+    NULL,
+    "glBindTransformFeedback",
+    "glSamplerParameteri",
+    "glDeformSGIX",
+    "glMultiTexCoord2iARB",
+    NULL,
+    "glMultiTexCoord3s",
+    "glVertexWeighthNV",
+    "glMultiTexParameterfvEXT",
+    NULL,
+    "glScissor",
+    "glMultiDrawElementsIndirectBindlessNV",
+    NULL,
+    NULL,
+    "glTrackMatrixNV",
+    "glPathGlyphsNV",
+    "glMultiTexImage1DEXT",
+    "glProgramUniformMatrix2fv",
+    "glNormal3xvOES",
+    "glUniform3i64vNV",
+    NULL,
+    "glWindowPos3svARB",
+    "glWindowPos2iv",
+    NULL,
+    "glVertexAttribs1dvNV",
+    "glDeformationMap3dSGIX",
+    "glDeleteOcclusionQueriesNV",
+    "glTexStorage3DEXT",
+    "glCopyMultiTexSubImage1DEXT",
+    "glGetLightiv",
+    "glVertexAttrib1dvARB",
+    NULL,
+    "glTexCoord2fNormal3fVertex3fvSUN",
+    "glRenderbufferStorageMultisample",
+    "glNormal3sv",
+    "glClearDepthfOES",
+    NULL,
+    "glVertex3iv",
+    NULL,
+    NULL,
+    "glProgramUniform2ivEXT",
+    "glTangent3fvEXT",
+    "wglSaveBufferRegionARB",
+    "glMultiTexCoord4iARB",
+    "glVertexAttrib4ubv",
+    "glGetPointeri_vEXT",
+    NULL,
+    "glFramebufferShadingRateEXT",
+    "glBlendFunci",
+    "glDrawTransformFeedbackNV",
+    "glLoadMatrixf",
+    "glPathStringNV",
+    "glGetStringi",
+    NULL,
+    "glGenSymbolsEXT",
+    NULL,
+    "glValidateProgram",
+    "glMaterialfv",
+    "glEvalMesh2",
+    "glBitmapxOES",
+    "glNamedRenderbufferStorage",
+    "glGetColorTableSGI",
+    "glVertexAttribI4usvEXT",
+    "glGetTextureLevelParameterfv",
+    "glNormal3bv",
+    "glGetBufferSubDataARB",
+    NULL,
+    "glVertex2dv",
+    "glCreateShaderProgramEXT",
+    "glMultiTexCoord3hvNV",
+    NULL,
+    "glVertexAttribI2iEXT",
+    "glPolygonMode",
+    "glMultiTexCoordP1uiv",
+    NULL,
+    NULL,
+    "glWindowPos2sMESA",
+    "glAlphaFragmentOp1ATI",
+    NULL,
+    NULL,
+    "glEndConditionalRenderNVX",
+    "glGetTrackMatrixivNV",
+    "glGetUniformLocationARB",
+    NULL,
+    "glMultiTexCoord3ivARB",
+    "glEvalMesh1",
+    "glConvolutionParameterxOES",
+    "glPrioritizeTexturesxOES",
+    "glMultiTexCoord2xvOES",
+    "glProgramUniform3fvEXT",
+    "wglMakeContextCurrentEXT",
+    "glUniform4f",
+    NULL,
+    NULL,
+    "glGetPathCommandsNV",
+    "glNamedRenderbufferStorageMultisampleEXT",
+    "glLockArraysEXT",
+    "glGetInfoLogARB",
+    "glGetnColorTable",
+    NULL,
+    "glSamplerParameterIiv",
+    "glSecondaryColor3d",
+    "glVertexAttribFormat",
+    NULL,
+    "glProgramUniform1uivEXT",
+    "glGetProgramLocalParameterIuivNV",
+    "wglQuerySwapGroupNV",
+    "glEvaluateDepthValuesARB",
+    "glOrthofOES",
+    NULL,
+    "glGetLightxOES",
+    "glDebugMessageCallbackAMD",
+    NULL,
+    "glResetHistogram",
+    "glColor4sv",
+    "glGetMinmaxParameterivEXT",
+    "glEndVideoCaptureNV",
+    NULL,
+    NULL,
+    "glProgramUniform4d",
+    "wglDestroyPbufferEXT",
+    NULL,
+    "glMultiTexGenivEXT",
+    "glBinormalPointerEXT",
+    "glGenQueryResourceTagNV",
+    "glTexCoord4iv",
+    "glTexBumpParameterfvATI",
+    "glPollInstrumentsSGIX",
+    NULL,
+    "glVariantdvEXT",
+    NULL,
+    NULL,
+    "glWeightubvARB",
+    "glVertexAttrib4fv",
+    "glDebugMessageCallback",
+    NULL,
+    "glVertexAttrib3svNV",
+    "glNamedBufferDataEXT",
+    "glSecondaryColor3s",
+    "glTextureView",
+    "glVertexAttribI3i",
+    NULL,
+    "glTextureImage3DEXT",
+    "glTextureParameteriv",
+    NULL,
+    NULL,
+    "wglGenlockSourceDelayI3D",
+    "glLightModeli",
+    "glProgramUniformHandleui64NV",
+    NULL,
+    "glSecondaryColor3ubv",
+    "glGetnConvolutionFilter",
+    "glGetQueryBufferObjectui64v",
+    "glMatrixIndexusvARB",
+    NULL,
+    "glProvokingVertexEXT",
+    NULL,
+    "glGetRenderbufferParameteriv",
+    NULL,
+    "glEvalCoord1xvOES",
+    "glGetFloatIndexedvEXT",
+    "glVertexWeightfvEXT",
+    NULL,
+    "glGetUnsignedBytevEXT",
+    "glVertexAttrib2sARB",
+    "glDrawElementsInstanced",
+    "glVDPAUGetSurfaceivNV",
+    "glProgramUniformMatrix4x2fvEXT",
+    "glRasterPos2dv",
+    NULL,
+    "wglDisableGenlockI3D",
+    "glProgramUniform4ui64vARB",
+    "glEndList",
+    "glDrawArraysInstancedBaseInstance",
+    "glGetFramebufferParameteriv",
+    "glUniform1i",
+    NULL,
+    "glDeleteTextures",
+    "glRotatef",
+    NULL,
+    NULL,
+    "glVertexAttrib3dvNV",
+    NULL,
+    "glTextureStorage3D",
+    NULL,
+    "glGetMaterialxOES",
+    "glUseProgramStages",
+    "glGetCombinerInputParameterivNV",
+    NULL,
+    "glGetProgramResourceLocationIndex",
+    NULL,
+    "glInterpolatePathsNV",
+    "glIsProgramPipeline",
+    "glNormal3iv",
+    NULL,
+    NULL,
+    "glGetQueryiv",
+    "glCompressedTexImage3DARB",
+    "glDepthRangeArraydvNV",
+    "glUniform4uiEXT",
+    "glEndConditionalRenderNV",
+    NULL,
+    NULL,
+    "glVertexAttribL1ui64vNV",
+    "glTexCoord4fColor4fNormal3fVertex4fSUN",
+    NULL,
+    "glGetLocalConstantBooleanvEXT",
+    "glUniform1f",
+    "glShaderOp2EXT",
+    "glCompressedTexSubImage1DARB",
+    "glClearNamedFramebufferfi",
+    "glResolveDepthValuesNV",
+    "glDebugMessageInsertARB",
+    "glGetUniformuivEXT",
+    "glEvalCoord2dv",
+    "glGetInternalformatSampleivNV",
+    "glUniform4uiv",
+    NULL,
+    "glHintPGI",
+    "glMap1d",
+    "glEndQueryIndexed",
+    "glBlendEquationIndexedAMD",
+    "glUniform2ui64vNV",
+    "glVertexAttrib2s",
+    NULL,
+    "wglReleasePbufferDCARB",
+    NULL,
+    "glMemoryBarrier",
+    "glCompressedTextureSubImage2DEXT",
+    "glReplacementCodeuiTexCoord2fVertex3fSUN",
+    "glMultiDrawMeshTasksIndirectNV",
+    "glVertex3hvNV",
+    "glMultiTexCoord2sARB",
+    "glDeleteStatesNV",
+    NULL,
+    "glColor4bv",
+    "wglGetDigitalVideoParametersI3D",
+    "glDeleteTransformFeedbacksNV",
+    NULL,
+    NULL,
+    "glGetTexParameterIuiv",
+    NULL,
+    "glDeleteObjectARB",
+    "glGetBufferPointerv",
+    "glTexParameterxvOES",
+    "glTexCoord4bOES",
+    "glTexStorageMem2DEXT",
+    "glIsVariantEnabledEXT",
+    "glTexCoord3bOES",
+    "glNamedCopyBufferSubDataEXT",
+    "glProgramUniform2ui64ARB",
+    "glMultiTexCoord3dv",
+    "glMulticastScissorArrayvNVX",
+    "glStencilOpSeparate",
+    "glProgramUniform2uivEXT",
+    "glClearBufferuiv",
+    NULL,
+    NULL,
+    "glTextureSubImage1D",
+    "glCheckFramebufferStatusEXT",
+    "glGetnMapfv",
+    "glEndTransformFeedbackNV",
+    "glGetConvolutionParameteriv",
+    "glVertexAttribs2dvNV",
+    "glLightxOES",
+    "glUniform4fvARB",
+    "glIsPointInStrokePathNV",
+    "glClampColor",
+    "glEnableIndexedEXT",
+    "glIsImageHandleResidentNV",
+    "glBufferStorageExternalEXT",
+    "glTexCoord4f",
+    NULL,
+    NULL,
+    "glDeleteFencesAPPLE",
+    "wglGenlockSourceEdgeI3D",
+    "glVertex4hNV",
+    "wglEnableFrameLockI3D",
+    NULL,
+    "glUniform3i64ARB",
+    "glGetProgramInterfaceiv",
+    "glUniform4i64vNV",
+    "glProgramUniform4ui64vNV",
+    "glMultiDrawElements",
+    "glUniformMatrix4dv",
+    "glColorMaskIndexedEXT",
+    NULL,
+    "glBufferAttachMemoryNV",
+    NULL,
+    NULL,
+    "glMultiTexCoord3xvOES",
+    "glMultiTexCoord2ivARB",
+    "glColor4ubVertex3fSUN",
+    "glGetnPixelMapuivARB",
+    "glColor4xOES",
+    "glIsBuffer",
+    NULL,
+    "glGenFragmentShadersATI",
+    "glTexCoord2f",
+    "glGetnMinmaxARB",
+    NULL,
+    "glCreateCommandListsNV",
+    "glMultiTexCoord1sARB",
+    NULL,
+    "glColor4ubVertex2fSUN",
+    "glGetColorTableParameterivEXT",
+    "glWindowPos2sv",
+    "glBindSamplers",
+    "glStencilThenCoverStrokePathInstancedNV",
+    "glWindowPos3iMESA",
+    "glUseProgram",
+    NULL,
+    "glTexCoordP3uiv",
+    "glGetPathSpacingNV",
+    "glProgramUniformMatrix2x4fv",
+    "glDeleteFragmentShaderATI",
+    "glDrawCommandsStatesNV",
+    NULL,
+    "glMultiDrawElementsIndirectBindlessCountNV",
+    "glSeparableFilter2D",
+    "glEvalCoord2fv",
+    "glProgramUniformMatrix2x3fvEXT",
+    "glMultiDrawArraysIndirectAMD",
+    "glProgramUniform2uiEXT",
+    "glColor4d",
+    "glMultiTexCoord1bvOES",
+    "glUniform3fvARB",
+    "glProgramUniform4uiv",
+    NULL,
+    "glGetDoublei_v",
+    "wglDXSetResourceShareHandleNV",
+    "glVertexAttribL4ui64vNV",
+    "glIndexMaterialEXT",
+    NULL,
+    NULL,
+    "glLoadName",
+    "glCompressedTexSubImage2D",
+    "glGetConvolutionFilterEXT",
+    "wglEnumGpuDevicesNV",
+    "glColor3ui",
+    "glNormalPointerEXT",
+    NULL,
+    "glColorMaterial",
+    NULL,
+    "glMatrixLoadTransposedEXT",
+    "glTexCoordFormatNV",
+    NULL,
+    "glTextureParameteriEXT",
+    "glVertexP4ui",
+    "glGetPathParameterivNV",
+    "glGetFloati_vEXT",
+    "glGetDoubleIndexedvEXT",
+    "glGetInternalformati64v",
+    "glGetActiveUniformBlockiv",
+    "glCopyTextureSubImage2D",
+    NULL,
+    "glMultiTexCoordP1ui",
+    "glFogxvOES",
+    "glWindowPos3iARB",
+    NULL,
+    "glSampleMaskEXT",
+    "glProgramUniform2i64vARB",
+    "glGetMapxvOES",
+    NULL,
+    "glProgramUniform4ui64ARB",
+    "glMatrixRotatedEXT",
+    "glGetUniformBufferSizeEXT",
+    "glGetnUniformdvARB",
+    NULL,
+    "glUniform4i64NV",
+    "glStencilFuncSeparateATI",
+    "glGetObjectLabel",
+    NULL,
+    NULL,
+    "glGetVertexAttribLdvEXT",
+    NULL,
+    "glLightModelfv",
+    NULL,
+    "glProgramNamedParameter4dvNV",
+    "glGetMemoryObjectDetachedResourcesuivNV",
+    "glGetRenderbufferParameterivEXT",
+    "glUniform2uiv",
+    "glNamedBufferStorageEXT",
+    "glClipPlanexOES",
+    "glVertexArrayVertexAttribLFormatEXT",
+    NULL,
+    "glMaterialxOES",
+    "glClientActiveTextureARB",
+    NULL,
+    "glGetInstrumentsSGIX",
+    "glQueryCounter",
+    "glGetProgramInfoLog",
+    "glAreTexturesResidentEXT",
+    "glRasterPos4fv",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glConvolutionParameterxvOES",
+    "glProgramUniformMatrix3x2dvEXT",
+    "glFeedbackBufferxOES",
+    NULL,
+    "glTexEnvf",
+    "glGetFixedvOES",
+    "glGetnColorTableARB",
+    "glReplacementCodeuiColor4ubVertex3fvSUN",
+    "glProgramEnvParameter4fvARB",
+    NULL,
+    "glVertex2hNV",
+    "glColor4usv",
+    "glPointParameterivNV",
+    "glGetTexImage",
+    "glNamedFramebufferTexture1DEXT",
+    "glGetConvolutionParameterxvOES",
+    NULL,
+    "glVertexAttribI4ubv",
+    "glGetPathTexGenivNV",
+    "wglBindVideoImageNV",
+    "glVertexAttribP1uiv",
+    "glMulticastCopyBufferSubDataNV",
+    NULL,
+    NULL,
+    "glVertexStream2dvATI",
+    "glAccum",
+    "wglBindTexImageARB",
+    "glGenerateMipmap",
+    "glNamedFramebufferParameteri",
+    "glClearNamedFramebufferfv",
+    "glShaderSource",
+    NULL,
+    NULL,
+    "glColor3usv",
+    NULL,
+    "glMaxShaderCompilerThreadsARB",
+    "glWindowPos3d",
+    NULL,
+    "glSetLocalConstantEXT",
+    "glVertexAttrib3fv",
+    "glOrtho",
+    "glProgramParameters4fvNV",
+    "glBegin",
+    NULL,
+    "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+    "glTextureColorMaskSGIS",
+    "glDeleteFramebuffersEXT",
+    NULL,
+    NULL,
+    "glCombinerParameterfvNV",
+    "glActiveProgramEXT",
+    "glBindProgramPipeline",
+    "glGetObjectBufferfvATI",
+    "glLabelObjectEXT",
+    "glIndexPointer",
+    NULL,
+    "glMultiTexCoord1fARB",
+    "glAreProgramsResidentNV",
+    "glUniformMatrix3fv",
+    "glWindowPos2dARB",
+    "glTexturePageCommitmentMemNV",
+    "glVertexAttrib3dvARB",
+    "glVertexAttrib4NuivARB",
+    "glVertexAttrib2d",
+    NULL,
+    "glMinmaxEXT",
+    NULL,
+    NULL,
+    "glTestFenceAPPLE",
+    "glTangentPointerEXT",
+    "glGetQueryObjecti64v",
+    "glRasterPos4xOES",
+    "glFrameTerminatorGREMEDY",
+    "glVertexArrayRangeNV",
+    NULL,
+    "glRasterPos4i",
+    "glColor4f",
+    "glFragmentLightModeliSGIX",
+    "glNormal3i",
+    "glGetPathDashArrayNV",
+    "glIsCommandListNV",
+    "glBindVertexArrayAPPLE",
+    "glVDPAURegisterVideoSurfaceWithPictureStructureNV",
+    "glColor3b",
+    "glUniform2fARB",
+    NULL,
+    "glWaitSync",
+    NULL,
+    "glTexCoordP4uiv",
+    NULL,
+    "glMapGrid2f",
+    "glVertex2iv",
+    "glMultiTexCoord3d",
+    "glBufferSubDataARB",
+    "wglResetFrameCountNV",
+    "glPollAsyncSGIX",
+    "glGetCombinerOutputParameterivNV",
+    "glProgramUniform2f",
+    NULL,
+    "glTangent3bvEXT",
+    NULL,
+    "glProgramUniformMatrix3fvEXT",
+    "glProgramUniformMatrix4fv",
+    NULL,
+    "glBeginQueryARB",
+    "glNamedBufferStorage",
+    NULL,
+    NULL,
+    "glDeleteFramebuffers",
+    NULL,
+    NULL,
+    "glPushMatrix",
+    NULL,
+    "glGetTextureHandleNV",
+    "glAcquireKeyedMutexWin32EXT",
+    "glColor4b",
+    NULL,
+    "glTexCoord4fVertex4fvSUN",
+    "glTexAttachMemoryNV",
+    "glMultiTexCoord2d",
+    NULL,
+    "glMultiTexCoord2bOES",
+    "glVariantubvEXT",
+    "glGetQueryBufferObjectuiv",
+    "glClearNamedBufferSubData",
+    "glMultiTexCoord2iv",
+    NULL,
+    "glGetHistogram",
+    NULL,
+    "glVertexFormatNV",
+    "wglQueryCurrentContextNV",
+    NULL,
+    "glVertex4xOES",
+    "glTexCoord3iv",
+    "glMultiTexCoord1s",
+    "glDrawRangeElementArrayATI",
+    "glValidateProgramARB",
+    "glDeleteBuffersARB",
+    "glGetActiveAttrib",
+    "glGetSemaphoreParameterui64vEXT",
+    NULL,
+    "glIsShader",
+    NULL,
+    "glGetnMapiv",
+    NULL,
+    "glInvalidateFramebuffer",
+    "glVertexAttrib4ubvARB",
+    "glDeleteSamplers",
+    NULL,
+    NULL,
+    "glVertexAttrib4fNV",
+    "glPixelZoomxOES",
+    "glIndexPointerListIBM",
+    "glUniform2fvARB",
+    "glProgramUniform1i64ARB",
+    "glEndOcclusionQueryNV",
+    "glUniformMatrix3dv",
+    "glVertexWeightPointerEXT",
+    "glIndexi",
+    "glUniform2i64ARB",
+    NULL,
+    NULL,
+    "glUniform4ui",
+    "glSampleMapATI",
+    "glMakeImageHandleResidentARB",
+    "glEvalCoord2xOES",
+    "glRenderbufferStorageMultisampleAdvancedAMD",
+    "glMultiTexCoord4bOES",
+    "glBindBufferBase",
+    "glTexCoordPointervINTEL",
+    "glMultiDrawArraysIndirectBindlessCountNV",
+    "glBlendFunc",
+    "glBeginConditionalRender",
+    "glVertexPointerListIBM",
+    NULL,
+    "glTextureImage2DEXT",
+    NULL,
+    NULL,
+    "glUniformMatrix4x3dv",
+    "glUniformHandleui64ARB",
+    NULL,
+    "glMultiTexCoordPointerEXT",
+    "glMultiTexCoord4s",
+    "glNamedBufferSubData",
+    "glNamedBufferAttachMemoryNV",
+    "glGetnUniformuiv",
+    NULL,
+    "glVertexAttrib4uivARB",
+    "glInvalidateBufferData",
+    "glGetQueryObjecti64vEXT",
+    NULL,
+    NULL,
+    "glVertexAttrib1s",
+    "glGenFramebuffersEXT",
+    "glRasterPos3iv",
+    "glTexImage3DEXT",
+    "glBinormal3fEXT",
+    "glNamedFramebufferDrawBuffer",
+    NULL,
+    NULL,
+    "glDeleteSync",
+    "glCreateProgramObjectARB",
+    "glClearTexImage",
+    "glGetPathMetricsNV",
+    NULL,
+    "glVertexAttrib3sARB",
+    "glTexBufferEXT",
+    "glGetConvolutionParameterfvEXT",
+    "glSpriteParameterivSGIX",
+    NULL,
+    "wglBeginFrameTrackingI3D",
+    "glBindBufferRange",
+    "glDisableVertexAttribArrayARB",
+    NULL,
+    "glBlendBarrierKHR",
+    "glProgramUniform4i64NV",
+    "glWeightbvARB",
+    "glUniform4fv",
+    "glGetBufferParameterivARB",
+    "glTextureImage3DMultisampleNV",
+    NULL,
+    "glFinishTextureSUNX",
+    "wglGetGPUIDsAMD",
+    "glGetVertexAttribPointervARB",
+    NULL,
+    "glDrawTransformFeedbackStreamInstanced",
+    NULL,
+    "glVertexAttribs3dvNV",
+    NULL,
+    "glNormalStream3fvATI",
+    "glGetLocalConstantIntegervEXT",
+    "glGetVertexAttribivNV",
+    "glUniform4i64vARB",
+    "glProgramUniformMatrix4x3dvEXT",
+    "glMultiTexCoord4sARB",
+    "glMatrixMultTransposedEXT",
+    "glFragmentLightModelfSGIX",
+    NULL,
+    "glMultiTexCoord3fv",
+    "glMultiDrawMeshTasksIndirectEXT",
+    "glVertexAttrib2dvARB",
+    NULL,
+    "glMultiTexRenderbufferEXT",
+    "glColor4ubv",
+    "wglJoinSwapGroupNV",
+    "glVertexStream2dATI",
+    NULL,
+    "glMultiTexCoord3fARB",
+    NULL,
+    "glIndexMask",
+    "glFlushMappedNamedBufferRange",
+    NULL,
+    "glNormal3s",
+    "glMulticastFramebufferSampleLocationsfvNV",
+    NULL,
+    "glVertexStream4dATI",
+    "glVertexAttribL2i64NV",
+    "glFrustum",
+    "glGetIntegeri_v",
+    "glVertexAttribL4i64NV",
+    NULL,
+    "glUnmapNamedBufferEXT",
+    NULL,
+    NULL,
+    "glEndConditionalRender",
+    "glGetProgramLocalParameterfvARB",
+    "glCullFace",
+    "glPixelMapuiv",
+    "glBlendColor",
+    "glFrameZoomSGIX",
+    "glVertexAttribL3ui64vNV",
+    "glGetDoublev",
+    "glSecondaryColor3i",
+    NULL,
+    NULL,
+    "glProgramBinary",
+    "glBlendEquationSeparateiARB",
+    NULL,
+    "glColor4i",
+    "glTexGenxOES",
+    NULL,
+    "glVertexAttribL4i64vNV",
+    "glGetTextureParameterIivEXT",
+    "glRasterPos2xvOES",
+    NULL,
+    "glVertexArrayEdgeFlagOffsetEXT",
+    NULL,
+    "glGetAttribLocation",
+    "glVertexAttribs1svNV",
+    "glMatrixScaledEXT",
+    "glPointParameterfvEXT",
+    "glLoadTransposeMatrixfARB",
+    "glNamedStringARB",
+    "glGetProgramResourceiv",
+    "glVertexAttrib1d",
+    "glPixelTexGenSGIX",
+    "glGetAttachedObjectsARB",
+    "glBinormal3dvEXT",
+    "glNamedBufferData",
+    "glConvolutionParameteriv",
+    "glDisableVariantClientStateEXT",
+    "glClearAccumxOES",
+    "glSwizzleEXT",
+    "glUniform2d",
+    NULL,
+    "glGetHandleARB",
+    "glProgramUniformMatrix4fvEXT",
+    NULL,
+    "glGetQueryObjectui64vEXT",
+    "glDrawMeshTasksIndirectEXT",
+    "glIsSampler",
+    "glGenVertexArraysAPPLE",
+    "glDisableClientStateiEXT",
+    "glNormalPointerListIBM",
+    "glVertexAttrib4ivARB",
+    NULL,
+    "glGetNamedBufferParameterui64vNV",
+    "glBindAttribLocation",
+    NULL,
+    "glVertexAttrib3s",
+    NULL,
+    "glUniform3ui",
+    "glClearDepthxOES",
+    "glNamedProgramLocalParameter4dEXT",
+    "glPointParameteriNV",
+    NULL,
+    "glProgramParameter4fNV",
+    NULL,
+    "glGetConvolutionParameterfv",
+    NULL,
+    "glClearBufferiv",
+    "glTexParameteri",
+    NULL,
+    NULL,
+    "glListParameterivSGIX",
+    NULL,
+    "glPrioritizeTextures",
+    NULL,
+    "glMultiTexCoord4f",
+    "glSecondaryColor3uivEXT",
+    "glLineWidth",
+    "glTexCoord1f",
+    "glGetVertexAttribLi64vNV",
+    "glSecondaryColorPointer",
+    "glBlendBarrierNV",
+    "glGenAsyncMarkersSGIX",
+    NULL,
+    "glMultiTexCoord3bOES",
+    "glProgramUniform3ui64NV",
+    "glBeginConditionalRenderNVX",
+    "glProgramUniformMatrix4dv",
+    "glMatrixMode",
+    "glMatrixLoadTranspose3x3fNV",
+    "glGetTextureParameterIuiv",
+    NULL,
+    "glTextureStorageMem1DEXT",
+    "glNamedProgramLocalParameters4fvEXT",
+    "glDrawBuffer",
+    "glNormalStream3bATI",
+    "glActiveTexture",
+    "glBindBufferBaseEXT",
+    "glShadingRateSampleOrderCustomNV",
+    "glGetSemaphoreParameterivNV",
+    "glGetQueryObjectuiv",
+    "glVertexArrayElementBuffer",
+    NULL,
+    "glClearNamedBufferData",
+    "glProgramUniformMatrix4x2dv",
+    "wglSetGammaTableI3D",
+    "glShaderBinary",
+    "glGetVertexAttribIivEXT",
+    "glEvalCoord1d",
+    NULL,
+    "glGetUniformLocation",
+    NULL,
+    NULL,
+    "glVertexAttribL2dvEXT",
+    "wglBindVideoCaptureDeviceNV",
+    "glSecondaryColor3dEXT",
+    "glMatrixTranslatedEXT",
+    "glGlobalAlphaFactordSUN",
+    "glPolygonOffset",
+    "glPassThrough",
+    "glGetTexParameterPointervAPPLE",
+    "glWindowPos3sv",
+    "glVertexAttribI4uiv",
+    "glMultTransposeMatrixxOES",
+    NULL,
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glVertexAttribI3ivEXT",
+    "glDepthMask",
+    "glVertexAttrib4iv",
+    "glPathCoordsNV",
+    "glGetUniformi64vARB",
+    NULL,
+    "glCreateShaderObjectARB",
+    "glLineWidthxOES",
+    NULL,
+    NULL,
+    "glGetPerfQueryDataINTEL",
+    "glDepthRangeIndexed",
+    "wglQueryMaxSwapGroupsNV",
+    "glCopyMultiTexSubImage3DEXT",
+    "glGetCombinerOutputParameterfvNV",
+    NULL,
+    "glLoadIdentity",
+    "glProgramEnvParameters4fvEXT",
+    NULL,
+    "glUniform1dv",
+    NULL,
+    NULL,
+    "glVertexAttrib4hvNV",
+    "glVideoCaptureStreamParameterivNV",
+    "glFramebufferTexture3DEXT",
+    "glWaitVkSemaphoreNV",
+    "glMultTransposeMatrixdARB",
+    NULL,
+    "glReplacementCodeuiSUN",
+    "glVertexAttrib4dvNV",
+    "glTexCoord2fColor4ubVertex3fvSUN",
+    "glGetPixelMapuiv",
+    "glEvalPoint1",
+    "glPathColorGenNV",
+    "glVertex2xOES",
+    "glQueryResourceNV",
+    "glPNTrianglesfATI",
+    "glTexCoord1bvOES",
+    "glVertexBlendARB",
+    "glNamedBufferPageCommitmentMemNV",
+    "glTexCoord1fv",
+    "glMultiTexParameteriEXT",
+    "glVertexAttribI4bvEXT",
+    "glClientWaitSemaphoreui64NVX",
+    "glCompressedTextureSubImage1DEXT",
+    "glVertexArrayVertexAttribDivisorEXT",
+    "glNormal3hNV",
+    "glDrawElementsInstancedARB",
+    "glGetnSeparableFilterARB",
+    "glMulticastGetQueryObjectui64vNV",
+    "glIsNamedBufferResidentNV",
+    "glGetnConvolutionFilterARB",
+    "glEvalCoord1dv",
+    "glVertexAttribP1ui",
+    "wglSetDigitalVideoParametersI3D",
+    NULL,
+    "glMatrixLoad3x3fNV",
+    "glWindowPos2i",
+    NULL,
+    "glGenVertexArrays",
+    "glProgramUniform1iv",
+    "glGetFinalCombinerInputParameterivNV",
+    "glGenNamesAMD",
+    "glDispatchComputeGroupSizeARB",
+    "glProgramUniform3i64vNV",
+    "glWindowPos2ivARB",
+    "glProgramBufferParametersfvNV",
+    NULL,
+    NULL,
+    NULL,
+    "glNamedFramebufferTexture",
+    "glMaterialxvOES",
+    "glTexCoordP4ui",
+    NULL,
+    "glMultiTexCoord1f",
+    NULL,
+    NULL,
+    "glCompressedTexImage1DARB",
+    "wglSetGammaTableParametersI3D",
+    "glTexSubImage3D",
+    "glVertexAttribIFormat",
+    "glVertexAttrib2dNV",
+    NULL,
+    "glTexSubImage1DEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glCopyTextureImage1DEXT",
+    "glNamedRenderbufferStorageMultisampleAdvancedAMD",
+    "glCreateVertexArrays",
+    "glGetActiveVaryingNV",
+    "glEGLImageTargetTextureStorageEXT",
+    "glVertexAttrib2hNV",
+    "glProgramUniform1ivEXT",
+    "glLightf",
+    NULL,
+    "glMakeTextureHandleNonResidentARB",
+    "glBindProgramARB",
+    "glDisableVertexArrayAttribEXT",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "glVariantbvEXT",
+    "glDeleteBuffers",
+    "glMatrixIndexubvARB",
+    "glProgramUniform1ui64NV",
+    "glVertexAttrib1svARB",
+    "glDrawPixels",
+    "glVertexArraySecondaryColorOffsetEXT",
+    "glPointParameteri",
+    NULL,
+    NULL,
+    "glTexBuffer",
+    "glTexCoordP3ui",
+    "glInvalidateSubFramebuffer",
+    NULL,
+    NULL,
+    "glProgramUniformMatrix2fvEXT",
+    "glTextureParameterfv",
+    NULL,
+    "glMultiTexCoord3iARB",
+    NULL,
+    NULL,
+    "glVertexAttrib2fvNV",
+    NULL,
+    "wglSetPbufferAttribARB",
+    NULL,
+    "wglMakeContextCurrentARB",
+    "glGetProgramEnvParameterIuivNV",
+    "glVertexAttribI1i",
+    "glClear",
+    NULL,
+    "glLightxvOES",
+    "glTexCoord2fv",
+    "glProgramUniformMatrix3fv",
+    "glColor4dv",
+    "glVertexStream2svATI",
+    "glMultiTexCoord4sv",
+    NULL,
+    "glLGPUCopyImageSubDataNVX",
+    NULL,
+    "glGenQueries",
+    NULL,
+    "glReadnPixelsARB",
+    "glObjectLabel",
+    "glGetVertexAttribLdv",
+    "glVertexAttribL3i64vNV",
+    "glGetProgramLocalParameterdvARB",
+    "glUniform1uiv",
+    "glGetTexFilterFuncSGIS",
+    "wglReleaseVideoCaptureDeviceNV",
+    "glBindBufferARB",
+    NULL,
+    NULL,
+    "glUniform1fARB",
+    "glGetUniformfv",
+    NULL,
+    "glMultiTexCoord4fv",
+    "glIsSemaphoreEXT",
+    "glTexParameterIiv",
+    "glGetNamedFramebufferParameteriv",
+    NULL,
+    "wglLoadDisplayColorTableEXT",
+    "glIsRenderbufferEXT",
+    "glDrawTransformFeedbackInstanced",
+    "glImageTransformParameterivHP",
+    "glVertexAttrib4dvARB",
+    "glVertexAttribDivisorARB",
+    "glDeleteSemaphoresEXT",
+    "glTexCoord4xOES",
+    "glBindFramebuffer",
+    "glBlendFuncSeparateIndexedAMD",
+    "glUniform3i64vARB",
+    "glNormal3xOES",
+    NULL,
+    "glGetTextureParameterfvEXT",
+    "glCallCommandListNV",
+    NULL,
+    "glTexImage1D",
+    "glImportMemoryFdEXT",
+    "glBindBufferBaseNV",
+    "glGenOcclusionQueriesNV",
+    NULL,
+    "glGetColorTableParameteriv",
+    NULL,
+    NULL,
+    "glSecondaryColor3ivEXT",
+    NULL,
+    "glScissorExclusiveArrayvNV",
+    "glPathFogGenNV",
+    "glUniform4i64ARB",
+    "glIsTextureHandleResidentNV",
+    "glGetVertexAttribLui64vNV",
+    "glSpecializeShader",
+    "glGetObjectLabelEXT",
+    "glGetMultiTexParameterfvEXT",
+    "glPathCoverDepthFuncNV",
+    NULL,
+    "glVertexAttribs3hvNV",
+    "glGetShaderInfoLog",
+    NULL,
+    "glTexParameterIivEXT",
+    "glVertexAttribI4svEXT",
+    "glVertexAttrib2f",
+    "glPushGroupMarkerEXT",
+    "glBindSampler",
+    "glGetColorTableEXT",
+    "glGetPerfMonitorCounterInfoAMD",
+    "glTexCoord2fColor4fNormal3fVertex3fSUN",
+    NULL,
+    "glVertex2i",
+    "glNormal3fVertex3fSUN",
+    "glTexCoord1sv",
+    "glSamplePatternSGIS",
+    "glGetSubroutineIndex",
+    "glCreateTextures",
+    "glUnlockArraysEXT",
+    "glMinSampleShading",
+    "glGetFragDataLocation",
+    "glStopInstrumentsSGIX",
+    "glDepthRangeArrayv",
+    "glVertex4i",
+    "glBufferParameteriAPPLE",
+    "glEndTransformFeedbackEXT",
+    "glWaitSemaphoreEXT",
+    "glReplacementCodeuiColor3fVertex3fvSUN",
+    "glVertexAttrib1fvNV",
+    "wglChoosePixelFormatEXT",
+    "glProgramBufferParametersIivNV",
+    "glVertexAttribL4dv",
+    "glCompressedMultiTexImage2DEXT",
+    NULL,
+    "glGetClipPlanefOES",
+    "glWindowPos3fvARB",
+    "glMultiTexCoord1fvARB",
+    "glUniform2i64NV",
+    "glVertexAttrib1fARB",
+    "glQueryObjectParameteruiAMD",
+    NULL,
+    NULL,
+    "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+    "glVertexAttrib1sNV",
+    "glTexGenfv",
+    NULL,
+    "glBeginOcclusionQueryNV",
+    "glGetNamedProgramLocalParameterdvEXT",
+    "glVertex3f",
+    NULL,
+    "wglGetCurrentReadDCARB",
+    "glGetDebugMessageLogAMD",
+    NULL,
+    NULL,
+    "glFogfv",
+    "glVertexAttribL1ui64vARB",
+    "glDeletePerfMonitorsAMD",
+    NULL,
+    "glUniform3ui64vARB",
+    "wglGetPixelFormatAttribivEXT",
+    NULL,
+    "glPushClientAttribDefaultEXT",
+    NULL,
+    NULL,
+    "glCopyTexSubImage3DEXT",
+    NULL,
+    "glUniform2i64vNV",
+    "wglQueryFrameLockMasterI3D",
+    NULL,
+    "glMultiTexParameterivEXT",
+    "glFramebufferTexture2DEXT",
+    NULL,
+    "glBinormal3iEXT",
+    NULL,
+    "glVertexAttribI1ivEXT",
+    "glUniformBufferEXT",
+    "glLightiv",
+    NULL,
+    "glColor3fVertex3fvSUN",
+    "wglEnumGpusNV",
+    NULL,
+    "glGetTextureImage",
+    NULL,
+    NULL,
+    "glSetMultisamplefvAMD",
+    "glGetVariantFloatvEXT",
+    "glGetNamedStringivARB",
+    "glRenderbufferStorageMultisampleEXT",
+    NULL,
+    "glGetFragmentMaterialivSGIX",
+    NULL,
+    "glColorTableParameterfvSGI",
+    "glUniform2ui64ARB",
+    "wglWaitForMscOML",
+    "wglCreateImageBufferI3D",
+    NULL,
+    "glGenQueriesARB",
+    "glBindBufferOffsetEXT",
+    "glGetHistogramParameterivEXT",
+    "glMultiTexCoord3bvOES",
+    "glPushClientAttrib",
+    "glGetDoublei_vEXT",
+    "glGetTextureSamplerHandleARB",
+    "glGetPathMetricRangeNV",
+    "glFlushMappedNamedBufferRangeEXT",
+    NULL,
+    "glColor3fVertex3fSUN",
+    "glFramebufferRenderbufferEXT",
+    NULL,
+    "glColorMaski",
+    "glColor3fv",
+    NULL,
+    NULL,
+    "glMultiTexGendEXT",
+    "glMulticastWaitSyncNV",
+    "glGetNamedBufferParameteri64v",
+    "glVertexAttrib2dvNV",
+    "glConvolutionFilter2D",
+    "glTexCoord3xOES",
+    "glTexParameterIuivEXT",
+    "glGetHistogramParameteriv",
+    "glDisablei",
+    "glDrawArraysEXT",
+    "glLoadProgramNV",
+    "glVertex2d",
+    "glVDPAUIsSurfaceNV",
+    NULL,
+    "glVertexArrayBindVertexBufferEXT",
+    "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+    "glCoverStrokePathNV",
+    "glVertex3hNV",
+    NULL,
+    "glVertexStream1ivATI",
+    NULL,
+    "glVertexAttrib1hNV",
+    "glShadingRateCombinerOpsEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glProgramLocalParameterI4ivNV",
+    "wglCreateAssociatedContextAttribsAMD",
+    NULL,
+    "glGetShaderiv",
+    "glClipPlane",
+    "glMultiDrawElementsEXT",
+    "glTranslatef",
+    NULL,
+    "glGetActiveAtomicCounterBufferiv",
+    "glTexCoord1hvNV",
+    NULL,
+    "glProgramUniform2i64NV",
+    "glColor3sv",
+    "glGetProgramPipelineiv",
+    "glProgramUniform3uiEXT",
+    "glTexEnvxvOES",
+    "glIsStateNV",
+    NULL,
+    NULL,
+    "glGetActiveUniformsiv",
+    "glVertexAttrib1fNV",
+    NULL,
+    "glCompressedTextureImage2DEXT",
+    "glVertexAttrib4bvARB",
+    "glGetnMapfvARB",
+    NULL,
+    "glFrustumfOES",
+    NULL,
+    "glDrawElementsBaseVertex",
+    "glGetNamedRenderbufferParameterivEXT",
+    NULL,
+    "glVertexAttrib4sARB",
+    "glPointParameterfvARB",
+    "glGetVariantIntegervEXT",
+    "glGetVertexAttribIiv",
+    "glGetnPolygonStippleARB",
+    "glSignalSemaphoreEXT",
+    "glVertexAttribArrayObjectATI",
+    "glGetUniformiv",
+    "glArrayElement",
+    "glTexImage3D",
+    "glShadingRateImagePaletteNV",
+    "glProgramUniform4dvEXT",
+    "glVertexAttribL4dEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glTexStorage2DMultisample",
+    "glPolygonOffsetxOES",
+    NULL,
+    "glClearNamedBufferDataEXT",
+    NULL,
+    NULL,
+    "glTexCoord2fNormal3fVertex3fSUN",
+    "wglGetVideoInfoNV",
+    "glVertexArrayAttribFormat",
+    NULL,
+    "glVertexAttrib3f",
+    "glTransformFeedbackAttribsNV",
+    "glFogFuncSGIS",
+    "glVertexStream1dvATI",
+    "glMultiTexCoord1xOES",
+    NULL,
+    "glGetTextureSamplerHandleNV",
+    NULL,
+    NULL,
+    "glGetActiveUniformBlockName",
+    "glStencilOp",
+    NULL,
+    "glVertexAttribL2i64vNV",
+    "glSeparableFilter2DEXT",
+    "glClearBufferfv",
+    "glGetBufferParameterui64vNV",
+    "glUniformui64NV",
+    "glVertexAttrib3svARB",
+    NULL,
+    "glVertexAttribIPointer",
+    NULL,
+    "glVertexAttribI3uiEXT",
+    "glIsEnabled",
+    NULL,
+    "glVertexBindingDivisor",
+    "glTangent3sEXT",
+    "glInvalidateTexSubImage",
+    "glCopyColorTable",
+    "glTextureStorage3DMultisample",
+    "wglReleaseVideoDeviceNV",
+    "glGetCompressedTexImageARB",
+    "glDepthRange",
+    NULL,
+    "glPopClientAttrib",
+    "glTextureImage1DEXT",
+    NULL,
+    "glGetMinmax",
+    "glCombinerOutputNV",
+    "glColorSubTable",
+    "glHistogramEXT",
+    "glDebugMessageInsert",
+    "glTangent3dvEXT",
+    "glWindowPos4fMESA",
+    "glIsEnabledIndexedEXT",
+    "glSyncTextureINTEL",
+    "glIndexf",
+    "glFragmentMaterialfSGIX",
+    NULL,
+    "glPointParameterfvSGIS",
+    "glGetNamedProgramLocalParameterIuivEXT",
+    "glUniformMatrix2x3dv",
+    "glColor3f",
+    "glVertexAttrib3d",
+    "glBeginVertexShaderEXT",
+    NULL,
+    "glUniform1uivEXT",
+    "glVertexStream1iATI",
+    NULL,
+    "glClientActiveTexture",
+    "glAccumxOES",
+    "glColorTableParameterivSGI",
+    "glBindTexture",
+    "glBufferStorageMemEXT",
+    NULL,
+    NULL,
+    "glGetActiveAttribARB",
+    NULL,
+    "glColor3us",
+    "glVertexAttribIPointerEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glFramebufferTextureFaceEXT",
+    "glVertexAttrib4sNV",
+    "glMulticastBufferSubDataNV",
+    "glVariantPointerEXT",
+    "glLGPUNamedBufferSubDataNVX",
+    "glWindowPos3ivMESA",
+    NULL,
+    "glRasterPos3f",
+    "glMultiTexCoord2fv",
+    NULL,
+    "glRasterPos4sv",
+    "glProgramUniform1i",
+    "glVertexStream3dATI",
+    "glVertexAttribs1fvNV",
+    NULL,
+    "glWindowPos3fMESA",
+    "glTexSubImage2D",
+    NULL,
+    "glMultiTexCoord3hNV",
+    "glNormal3hvNV",
+    NULL,
+    "glProgramUniform3ui64ARB",
+    "glCompressedMultiTexSubImage1DEXT",
+    "glCopyTexSubImage2DEXT",
+    "glColor4hvNV",
+    "glTexEnvi",
+    "glFogCoordFormatNV",
+    "glTexGeniv",
+    "glTextureStorageMem3DEXT",
+    "glFramebufferTextureLayerEXT",
+    NULL,
+    NULL,
+    "glVertex3bOES",
+    "glWindowPos2d",
+    "glBufferStorage",
+    "glGetNamedProgramLocalParameterIivEXT",
+    "glVertexP2uiv",
+    "glRectdv",
+    "glFogi",
+    NULL,
+    "glCopyTexImage2D",
+    "glPopDebugGroup",
+    NULL,
+    "glReleaseKeyedMutexWin32EXT",
+    "glTexPageCommitmentMemNV",
+    "glCompressedTextureSubImage3D",
+    NULL,
+    "glTexParameterf",
+    "wglCreateDisplayColorTableEXT",
+    "glRectxOES",
+    "glDrawTextureNV",
+    "wglGetExtensionsStringARB",
+    "glTextureSubImage1DEXT",
+    "glResetMemoryObjectParameterNV",
+    "glVDPAUInitNV",
+    NULL,
+    NULL,
+    "glFramebufferSampleLocationsfvNV",
+    "glTextureStorage2DMultisample",
+    "glGetVkProcAddrNV",
+    "glSecondaryColor3ui",
+    NULL,
+    "glMapGrid1xOES",
+    "glGenProgramsARB",
+    "glTangent3iEXT",
+    "glProgramParameteriEXT",
+    "glPointParameterxvOES",
+    NULL,
+    "glMultiModeDrawElementsIBM",
+    "glResetHistogramEXT",
+    "glGetInvariantFloatvEXT",
+    "glSecondaryColor3ubEXT",
+    "glGetIntegerui64i_vNV",
+    "glPrimitiveRestartNV",
+    NULL,
+    "glVertexAttribs2hvNV",
+    "glHistogram",
+    NULL,
+    "glSamplePatternEXT",
+    "glPrimitiveBoundingBoxARB",
+    "glVertexArrayNormalOffsetEXT",
+    NULL,
+    "glInsertComponentEXT",
+    NULL,
+    NULL,
+    NULL,
+    "glGetNamedBufferSubData",
+    "glVertexAttribI3iEXT",
+    NULL,
+    "glTangent3fEXT",
+    "glQueryResourceTagNV",
+    "glDrawCommandsNV",
+    "glGetMultiTexLevelParameterfvEXT",
+    NULL,
+    "glPixelStorex",
+    "glTangent3dEXT",
+    "glProgramEnvParameter4dvARB",
+    "glGetMultiTexLevelParameterivEXT",
+    NULL,
+    "glFramebufferTextureLayer",
+    "glGenTransformFeedbacks",
+    "glNewObjectBufferATI",
+    NULL,
+    "glVertexStream4fvATI",
+    "glGetColorTableParameterfv",
+    "glBindTexGenParameterEXT",
+    "glProgramUniformMatrix4x2dvEXT",
+    "glTexturePageCommitmentEXT",
+    NULL,
+    "glResizeBuffersMESA",
+    "glInsertEventMarkerEXT",
+    "glProgramUniform2i64vNV",
+    "glVertexAttrib4NusvARB",
+    "glVertexAttribP3uiv",
+    "glClearNamedBufferSubDataEXT",
+    NULL,
+    "glQueryMatrixxOES",
+    "glTexCoord2fVertex3fvSUN",
+    "glReplacementCodeuiVertex3fSUN",
+    "glProgramStringARB",
+    "glBinormal3bvEXT",
+    "glCompileShaderIncludeARB",
+    NULL,
+    "glRects",
+    NULL,
+    "glGetUniformi64vNV",
+    "glVertex4xvOES",
+    NULL,
+    "glVDPAUFiniNV",
+    "glUnmapTexture2DINTEL",
+};
+
@@ -1,3 +1,9 @@
+/* GLATTER_SHARED_REGISTRY walks the loaded objects with dl_iterate_phdr(),
+ * which glibc only declares for _GNU_SOURCE. */
+#if defined(GLATTER_SHARED_REGISTRY) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 /* Always include Windows/POSIX system headers BEFORE any GL headers. */
 #include <glatter/glatter_config.h>
 
@@ -0,0 +1,205 @@
+/*
+ * Microbenchmark: cost of the dispatch slots a render frame touches when the
+ * caches are cold, as they are after the driver has done a frame's work.
+ *
+ * A frame makes the same 24 calls twice: through glatter's header-only
+ * wrappers, whose slots share the hot front of the GL dispatch table, and
+ * through one pointer per 4 KiB page, which is how separately defined
+ * per-entry-point variables end up spread over the data segment. The calls
+ * land in no-op functions handed out by a proc-address provider, so no
+ * driver or context is needed and only dispatch is measured.
+ *
+ * Built with -DGLATTER_BUILD_BENCHMARKS=ON as glatter-bench-dispatch.
+ */
+
+/* Release wrappers for the platform's default WSI, without the error logging
+ * that the stock glatter_config_user.h turns on. */
+#define GLATTER_CONFIG_H_DEFINED
+#define GLATTER_HEADER_ONLY
+#define GLATTER_GL
+#if defined(_WIN32)
+#  define GLATTER_WINDOWS_WGL_GL
+#  define GLATTER_WGL
+#else
+#  define GLATTER_MESA_GLX_GL
+#  define GLATTER_GLX
+#endif
+#ifndef NDEBUG
+#  define NDEBUG
+#endif
+
+#include <glatter/glatter.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <vector>
+
+static unsigned long g_calls = 0;
+
+static void GLAPIENTRY fake_glBindVertexArray(GLuint) { ++g_calls; }
+static void GLAPIENTRY fake_glUseProgram(GLuint) { ++g_calls; }
+static void GLAPIENTRY fake_glBindBuffer(GLenum, GLuint) { ++g_calls; }
+static void GLAPIENTRY fake_glBindTexture(GLenum, GLuint) { ++g_calls; }
+static void GLAPIENTRY fake_glActiveTexture(GLenum) { ++g_calls; }
+static void GLAPIENTRY fake_glUniform1i(GLint, GLint) { ++g_calls; }
+static void GLAPIENTRY fake_glUniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) { ++g_calls; }
+static void GLAPIENTRY fake_glUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*) { ++g_calls; }
+static void GLAPIENTRY fake_glEnable(GLenum) { ++g_calls; }
+static void GLAPIENTRY fake_glDisable(GLenum) { ++g_calls; }
+static void GLAPIENTRY fake_glBlendFunc(GLenum, GLenum) { ++g_calls; }
+static void GLAPIENTRY fake_glDepthFunc(GLenum) { ++g_calls; }
+static void GLAPIENTRY fake_glDepthMask(GLboolean) { ++g_calls; }
+static void GLAPIENTRY fake_glViewport(GLint, GLint, GLsizei, GLsizei) { ++g_calls; }
+static void GLAPIENTRY fake_glScissor(GLint, GLint, GLsizei, GLsizei) { ++g_calls; }
+static void GLAPIENTRY fake_glClear(GLbitfield) { ++g_calls; }
+static void GLAPIENTRY fake_glClearColor(GLfloat, GLfloat, GLfloat, GLfloat) { ++g_calls; }
+static void GLAPIENTRY fake_glDrawArrays(GLenum, GLint, GLsizei) { ++g_calls; }
+static void GLAPIENTRY fake_glDrawElements(GLenum, GLsizei, GLenum, const void*) { ++g_calls; }
+static void GLAPIENTRY fake_glBindFramebuffer(GLenum, GLuint) { ++g_calls; }
+static void GLAPIENTRY fake_glColorMask(GLboolean, GLboolean, GLboolean, GLboolean) { ++g_calls; }
+static void GLAPIENTRY fake_glCullFace(GLenum) { ++g_calls; }
+static void GLAPIENTRY fake_glStencilMask(GLuint) { ++g_calls; }
+static GLenum GLAPIENTRY fake_glGetError(void) { ++g_calls; return GL_NO_ERROR; }
+
+#define BENCH_FRAME_ENTRY_POINTS(X) \
+    X(glBindFramebuffer) X(glViewport) X(glScissor) X(glClearColor) X(glClear) \
+    X(glEnable) X(glDisable) X(glDepthFunc) X(glDepthMask) X(glBlendFunc) \
+    X(glCullFace) X(glColorMask) X(glStencilMask) X(glUseProgram) X(glBindVertexArray) \
+    X(glActiveTexture) X(glBindTexture) X(glBindBuffer) X(glUniform1i) X(glUniform4f) \
+    X(glUniformMatrix4fv) X(glDrawArrays) X(glDrawElements) X(glGetError)
+
+enum {
+#define X(name) bench_##name,
+    BENCH_FRAME_ENTRY_POINTS(X)
+#undef X
+    bench_count
+};
+
+static void* provider(const char* name, void*)
+{
+#define X(fn) if (std::strcmp(name, #fn) == 0) return reinterpret_cast<void*>(&fake_##fn);
+    BENCH_FRAME_ENTRY_POINTS(X)
+#undef X
+    return nullptr;
+}
+
+static const GLfloat g_matrix[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+
+static void frame_through_glatter()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, 640, 480);
+    glScissor(0, 0, 640, 480);
+    glClearColor(0.f, 0.f, 0.f, 1.f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+    glBlendFunc(GL_ONE, GL_ZERO);
+    glCullFace(GL_BACK);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glStencilMask(0xff);
+    glUseProgram(1);
+    glBindVertexArray(1);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 1);
+    glUniform1i(0, 0);
+    glUniform4f(1, 0.f, 0.f, 0.f, 1.f);
+    glUniformMatrix4fv(2, 1, GL_FALSE, g_matrix);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, nullptr);
+    (void)glGetError();
+}
+
+/* One slot per page, read the way the former per-entry-point variables were. */
+struct alignas(4096) scattered_slot { std::atomic<void*> fn; };
+static std::vector<scattered_slot> g_scattered(bench_count);
+
+#define SCATTERED(name) \
+    reinterpret_cast<decltype(&fake_##name)>(g_scattered[bench_##name].fn.load(std::memory_order_acquire))
+
+static void frame_through_scattered_slots()
+{
+    SCATTERED(glBindFramebuffer)(GL_FRAMEBUFFER, 0);
+    SCATTERED(glViewport)(0, 0, 640, 480);
+    SCATTERED(glScissor)(0, 0, 640, 480);
+    SCATTERED(glClearColor)(0.f, 0.f, 0.f, 1.f);
+    SCATTERED(glClear)(GL_COLOR_BUFFER_BIT);
+    SCATTERED(glEnable)(GL_DEPTH_TEST);
+    SCATTERED(glDisable)(GL_BLEND);
+    SCATTERED(glDepthFunc)(GL_LESS);
+    SCATTERED(glDepthMask)(GL_TRUE);
+    SCATTERED(glBlendFunc)(GL_ONE, GL_ZERO);
+    SCATTERED(glCullFace)(GL_BACK);
+    SCATTERED(glColorMask)(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    SCATTERED(glStencilMask)(0xff);
+    SCATTERED(glUseProgram)(1);
+    SCATTERED(glBindVertexArray)(1);
+    SCATTERED(glActiveTexture)(GL_TEXTURE0);
+    SCATTERED(glBindTexture)(GL_TEXTURE_2D, 1);
+    SCATTERED(glBindBuffer)(GL_ARRAY_BUFFER, 1);
+    SCATTERED(glUniform1i)(0, 0);
+    SCATTERED(glUniform4f)(1, 0.f, 0.f, 0.f, 1.f);
+    SCATTERED(glUniformMatrix4fv)(2, 1, GL_FALSE, g_matrix);
+    SCATTERED(glDrawArrays)(GL_TRIANGLES, 0, 3);
+    SCATTERED(glDrawElements)(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, nullptr);
+    (void)SCATTERED(glGetError)();
+}
+
+/* Stands in for the driver's work between frames: evicts the data caches. */
+static std::vector<unsigned char> g_evict(32u << 20);
+
+static void evict_caches()
+{
+    for (size_t i = 0; i < g_evict.size(); i += 64) {
+        g_evict[i] = (unsigned char)(g_evict[i] + 1);
+    }
+}
+
+static double nanoseconds_per_frame(void (*frame)(), int frames)
+{
+    double total = 0.0;
+    for (int i = 0; i < frames; ++i) {
+        evict_caches();
+        auto begin = std::chrono::steady_clock::now();
+        frame();
+        auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double, std::nano>(end - begin).count();
+    }
+    return total / frames;
+}
+
+int main()
+{
+    glatter_set_proc_address_provider(provider, nullptr);
+#define X(name) g_scattered[bench_##name].fn.store(reinterpret_cast<void*>(&fake_##name));
+    BENCH_FRAME_ENTRY_POINTS(X)
+#undef X
+
+    /* Resolve everything once, outside the measurement. */
+    frame_through_glatter();
+    frame_through_scattered_slots();
+
+    std::set<uintptr_t> lines;
+#define X(name) lines.insert(reinterpret_cast<uintptr_t>(&glatter_fn_table_GL[GLATTER_FN_##name]) / 64);
+    BENCH_FRAME_ENTRY_POINTS(X)
+#undef X
+
+    const int frames = 2000;
+    double table = 0.0, scattered = 0.0;
+    for (int round = 0; round < 3; ++round) {
+        table     += nanoseconds_per_frame(frame_through_glatter, frames);
+        scattered += nanoseconds_per_frame(frame_through_scattered_slots, frames);
+    }
+
+    std::printf("%d calls per frame, cold caches, mean of %d frames\n", (int)bench_count, 3 * frames);
+    std::printf("  glatter table  : %8.1f ns/frame, slots in %zu cache lines\n", table / 3, lines.size());
+    std::printf("  scattered slots: %8.1f ns/frame, slots in %d pages\n", scattered / 3, (int)bench_count);
+    return g_calls == 0;
+}
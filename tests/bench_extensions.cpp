@@ -0,0 +1,128 @@
+/*
+ * Microbenchmark: parsing a space-separated extension string, as every cache
+ * miss of glatter_get_extension_support_GL/GLX/EGL/WGL does on contexts that
+ * report their extensions in one string.
+ *
+ * The string lists every GL extension of the generated headers, several times
+ * the length of what a desktop driver reports, in header order. It is parsed
+ * twice per round: by a byte-at-a-time tokenizer, which is how the generated
+ * parsers walked the string before, and by glatter_extension_mark_list_. Both
+ * look each name up in the same perfect hash, so only the scan differs; a
+ * third pass scans without looking anything up.
+ *
+ * Built with -DGLATTER_BUILD_BENCHMARKS=ON as glatter-bench-extensions. Pass
+ * -mavx2 (or /arch:AVX2) to measure the 32-byte scanner.
+ */
+
+#define GLATTER_CONFIG_H_DEFINED
+#define GLATTER_HEADER_ONLY
+#define GLATTER_GL
+#if defined(_WIN32)
+#  define GLATTER_WINDOWS_WGL_GL
+#  define GLATTER_WGL
+#else
+#  define GLATTER_MESA_GLX_GL
+#  define GLATTER_GLX
+#endif
+#ifndef NDEBUG
+#  define NDEBUG
+#endif
+
+#include <glatter/glatter.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static void mark_list_bytewise(uint32_t* bits, const glatter_extension_table_t* table, const uint8_t* list)
+{
+    for (const uint8_t* p = list; *p; ) {
+        while (*p == ' ') {
+            ++p;
+        }
+        const uint8_t* name = p;
+        while (*p && *p != ' ') {
+            ++p;
+        }
+        if (p != name) {
+            glatter_extension_mark_(bits, table, name, (size_t)(p - name));
+        }
+    }
+}
+
+static size_t count_bytewise(const uint8_t* list)
+{
+    size_t names = 0;
+    for (const uint8_t* p = list; *p; ) {
+        while (*p == ' ') {
+            ++p;
+        }
+        const uint8_t* name = p;
+        while (*p && *p != ' ') {
+            ++p;
+        }
+        names += p != name;
+    }
+    return names;
+}
+
+static size_t count_vectorized(const uint8_t* list)
+{
+    size_t names = 0;
+    for (const uint8_t* p = list; *p; ) {
+        while (*p == ' ') {
+            ++p;
+        }
+        const uint8_t* name = p;
+        p = glatter_extension_separator_(p);
+        names += p != name;
+    }
+    return names;
+}
+
+static glatter_extension_support_status_GL_t g_status;
+static volatile size_t g_sink = 0;
+
+template <typename F>
+static double microseconds_per_parse(F parse, int parses)
+{
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < parses; ++i) {
+        parse();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - begin).count() / parses;
+}
+
+int main()
+{
+    const glatter_extension_table_t* table = &glatter_ext_table_GL;
+    std::string list;
+    for (int i = 0; i < GLATTER_EXT_COUNT_GL; ++i) {
+        list += table->names + table->offsets[i];
+        list += ' ';
+    }
+    const uint8_t* str = (const uint8_t*)list.c_str();
+
+    const int parses = 2000;
+    double bytewise = 0.0, vectorized = 0.0, bytewise_scan = 0.0, vectorized_scan = 0.0;
+    for (int round = 0; round < 3; ++round) {
+        bytewise        += microseconds_per_parse([&] { mark_list_bytewise(g_status.bits, table, str); }, parses);
+        vectorized      += microseconds_per_parse([&] { glatter_extension_mark_list_(g_status.bits, table, str); }, parses);
+        bytewise_scan   += microseconds_per_parse([&] { g_sink = g_sink + count_bytewise(str); }, parses);
+        vectorized_scan += microseconds_per_parse([&] { g_sink = g_sink + count_vectorized(str); }, parses);
+    }
+
+    int marked = 0;
+    for (int i = 0; i < GLATTER_EXT_COUNT_GL; ++i) {
+        marked += GLATTER_EXTENSION_SUPPORTED(&g_status, i) ? 1 : 0;
+    }
+
+    std::printf("%zu bytes, %d names, mean of %d parses\n", list.size(), marked, 3 * parses);
+    std::printf("                 scan + lookup   scan only\n");
+    std::printf("  byte at a time: %8.2f us   %8.2f us\n", bytewise / 3, bytewise_scan / 3);
+    std::printf("  vectorized    : %8.2f us   %8.2f us\n", vectorized / 3, vectorized_scan / 3);
+    return marked != GLATTER_EXT_COUNT_GL;
+}
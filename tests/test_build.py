@@ -9,6 +9,7 @@ implementation are caught early without requiring a rendering environment.
 from __future__ import annotations
 
 import os
+import platform
 import shutil
 import subprocess
 import sys
@@ -1043,6 +1044,3140 @@ def test_context_key_mixer_behaves_with_stubbed_egl(tmp_path: Path) -> None:
     _run_command([output])
 
 
+def test_compiled_posix_entry_point_is_repointed_after_first_call(tmp_path: Path) -> None:
+    """In compiled mode the public pointer must stop at the driver after one call."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("exercises the GLX loader on a POSIX host")
+
+    cc = _require_tool("cc")
+
+    source = tmp_path / "repoint_test.c"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <glatter/glatter.h>
+
+            int main(void)
+            {
+                const glatter_glGetString_t initial = glatter_glGetString;
+                void* direct = glatter_get_proc_address("glGetString");
+                if (direct == NULL) {
+                    return 77; /* no GL driver on this host */
+                }
+
+                (void)glGetString(GL_VERSION);
+
+                if (glatter_glGetString == initial) {
+                    fprintf(stderr, "pointer still targets the resolver\\n");
+                    return 1;
+                }
+                if ((void*)glatter_glGetString != direct) {
+                    fprintf(stderr, "pointer does not target the driver entry\\n");
+                    return 2;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_GL=1",
+        "-DGLATTER_GLX=1",
+        "-DGLATTER_MESA_GLX_GL=1",
+    ]
+
+    output = tmp_path / "repoint_test"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            str(REPO_ROOT / "src" / "glatter" / "glatter.c"),
+            str(source),
+            "-lGL",
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    if result.returncode == 77:
+        pytest.skip("no GL driver could be loaded")
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_extension_flags_read_a_packed_bitset(tmp_path: Path) -> None:
+    """Extension flags are single-bit reads of a bitset handed out by pointer."""
+
+    cc = _require_tool("cc")
+
+    source = tmp_path / "extension_bitset_test.c"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <glatter/glatter.h>
+
+            int main(void)
+            {
+                if (sizeof(glatter_extension_support_status_EGL_t) !=
+                    sizeof(uint32_t) * ((GLATTER_EXT_COUNT_EGL + 31) / 32)) {
+                    fprintf(stderr, "extension status is not a packed bitset\\n");
+                    return 1;
+                }
+
+                const glatter_extension_support_status_EGL_t* status =
+                    glatter_get_extension_support_EGL();
+                if (status == NULL || status != glatter_get_extension_support_EGL()) {
+                    fprintf(stderr, "status is not handed out by stable pointer\\n");
+                    return 2;
+                }
+
+                /* The stubs report no current context, so nothing is supported. */
+                if (glatter_EGL_KHR_image_base != 0) {
+                    fprintf(stderr, "extension reported without a context\\n");
+                    return 3;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    egl_stub = _write_egl_stub(tmp_path)
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        *_khronos_static_flags(),
+    ]
+
+    output = tmp_path / "extension_bitset_test"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(REPO_ROOT / "src" / "glatter" / "glatter.c"),
+            str(egl_stub),
+            str(source),
+            *_dl_flags(),
+            *_opengl_libs(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    _run_command([output])
+
+
+def test_extension_sets_are_shared_by_the_threads_of_a_context(tmp_path: Path) -> None:
+    """A context's extension set is built once for the process, whichever thread asks."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "shared_extension_cache_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <atomic>
+            #include <string.h>
+            #include <thread>
+            #include <glatter/glatter.h>
+
+            static int context, display;
+            static thread_local EGLContext current_context = EGL_NO_CONTEXT;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            static std::atomic<int> queries(0);
+
+            static const char* EGLAPIENTRY fake_eglQueryString(EGLDisplay, EGLint name)
+            {
+                if (name == EGL_EXTENSIONS) {
+                    ++queries;
+                    return "EGL_KHR_fence_sync EGL_KHR_image_base";
+                }
+                return nullptr;
+            }
+            static EGLint EGLAPIENTRY fake_eglGetError(void) { return EGL_SUCCESS; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglQueryString") == 0) return reinterpret_cast<void*>(&fake_eglQueryString);
+                if (strcmp(name, "eglGetError") == 0)    return reinterpret_cast<void*>(&fake_eglGetError);
+                return nullptr;
+            }
+
+            static const glatter_extension_support_status_EGL_t* seen[4];
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+
+                /* Each thread makes the same context current in turn. */
+                for (int i = 0; i < 4; ++i) {
+                    std::thread([i] {
+                        current_context = (EGLContext)&context;
+                        seen[i] = glatter_get_extension_support_EGL();
+                    }).join();
+                }
+                if (queries != 1) {
+                    return 1;
+                }
+                for (int i = 1; i < 4; ++i) {
+                    if (seen[i] != seen[0]) {
+                        return 2;
+                    }
+                }
+                if (!GLATTER_EXTENSION_SUPPORTED(seen[0], GLATTER_EXT_EGL_KHR_image_base) ||
+                    GLATTER_EXTENSION_SUPPORTED(seen[0], GLATTER_EXT_EGL_KHR_gl_texture_2D_image)) {
+                    return 3;
+                }
+
+                /* Invalidation from any thread applies to all of them. */
+                std::thread([] { glatter_invalidate_all_extension_caches(); }).join();
+                current_context = (EGLContext)&context;
+                if (!glatter_EGL_KHR_fence_sync || queries != 2) {
+                    return 4;
+                }
+                return GLATTER_EXTENSION_SUPPORTED(glatter_get_extension_support_EGL(),
+                    GLATTER_EXT_EGL_KHR_fence_sync) ? 0 : 5;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "shared_extension_cache_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_extension_names_are_matched_in_full(tmp_path: Path) -> None:
+    """Every generated name finds its own bit; prefixes and unknown names find none."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "extension_lookup_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static int context, display;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return (EGLContext)&context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void) { return (EGLDisplay)&display; }
+
+            static const char* EGLAPIENTRY fake_eglQueryString(EGLDisplay, EGLint name)
+            {
+                if (name == EGL_EXTENSIONS) {
+                    return "  EGL_KHR_fence_sync   EGL_KHR_image_bas EGL_KHR_image_base_ "
+                           "EGL_VENDOR_not_in_the_headers EGL_KHR_gl_texture_2D_image";
+                }
+                return nullptr;
+            }
+            static EGLint EGLAPIENTRY fake_eglGetError(void) { return EGL_SUCCESS; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglQueryString") == 0) return reinterpret_cast<void*>(&fake_eglQueryString);
+                if (strcmp(name, "eglGetError") == 0)    return reinterpret_cast<void*>(&fake_eglGetError);
+                return nullptr;
+            }
+
+            int main()
+            {
+                const glatter_extension_table_t* table = &glatter_ext_table_EGL;
+                for (int i = 0; i < GLATTER_EXT_COUNT_EGL; ++i) {
+                    const char* name = table->names + table->offsets[i];
+                    if (glatter_extension_index_(table, (const uint8_t*)name, strlen(name)) != i) {
+                        return 1;
+                    }
+                }
+
+                glatter_set_proc_address_provider(provider, nullptr);
+                const glatter_extension_support_status_EGL_t* ess = glatter_get_extension_support_EGL();
+                int found = 0;
+                for (int i = 0; i < GLATTER_EXT_COUNT_EGL; ++i) {
+                    found += GLATTER_EXTENSION_SUPPORTED(ess, i) ? 1 : 0;
+                }
+                if (found != 2) {
+                    return 2;
+                }
+                return glatter_EGL_KHR_fence_sync && glatter_EGL_KHR_gl_texture_2D_image ? 0 : 3;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "extension_lookup_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+@pytest.mark.parametrize("vector_flags", [[], ["-mavx2"]], ids=["default", "avx2"])
+def test_extension_scanner_handles_every_alignment(tmp_path: Path, vector_flags: list) -> None:
+    """The vectorized tokenizer finds the same names wherever the string starts and ends."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+    if vector_flags:
+        cpuinfo = Path("/proc/cpuinfo")
+        if not cpuinfo.exists() or " avx2" not in cpuinfo.read_text():
+            pytest.skip("the host cannot run AVX2 code")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "extension_scanner_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static const char list[] =
+                "EGL_KHR_fence_sync  EGL_KHR_image_base EGL_VENDOR_not_in_the_headers_but_long_enough_to_span_blocks "
+                " EGL_KHR_gl_texture_2D_image";
+
+            int main()
+            {
+                alignas(64) static uint8_t buffer[64 + sizeof(list) + 64];
+                for (size_t offset = 0; offset < 64; ++offset) {
+                    /* Filler on both sides must not leak into the first or last name. */
+                    memset(buffer, 'x', sizeof(buffer));
+                    memcpy(buffer + offset, list, sizeof(list));
+
+                    glatter_extension_support_status_EGL_t ess;
+                    memset(&ess, 0, sizeof(ess));
+                    glatter_extension_mark_list_(ess.bits, &glatter_ext_table_EGL, buffer + offset);
+
+                    int found = 0;
+                    for (int i = 0; i < GLATTER_EXT_COUNT_EGL; ++i) {
+                        found += GLATTER_EXTENSION_SUPPORTED(&ess, i) ? 1 : 0;
+                    }
+                    if (found != 3 ||
+                        !GLATTER_EXTENSION_SUPPORTED(&ess, GLATTER_EXT_EGL_KHR_fence_sync) ||
+                        !GLATTER_EXTENSION_SUPPORTED(&ess, GLATTER_EXT_EGL_KHR_image_base) ||
+                        !GLATTER_EXTENSION_SUPPORTED(&ess, GLATTER_EXT_EGL_KHR_gl_texture_2D_image))
+                    {
+                        return 1 + (int)offset;
+                    }
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "extension_scanner_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-O2",
+            *vector_flags,
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_context_caps_are_queried_once_with_the_extensions(tmp_path: Path) -> None:
+    """The caps of a context come from one pass that asks only what its version knows."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "context_caps_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static int context, display;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return (EGLContext)&context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void) { return (EGLDisplay)&display; }
+
+            static int queries = 0, unexpected = 0;
+
+            static const GLubyte* GL_APIENTRY fake_glGetString(GLenum name)
+            {
+                ++queries;
+                if (name == GL_VERSION) return (const GLubyte*)"OpenGL ES 3.0 fake";
+                if (name == GL_SHADING_LANGUAGE_VERSION) return (const GLubyte*)"OpenGL ES GLSL ES 3.00";
+                ++unexpected;
+                return nullptr;
+            }
+            static const GLubyte* GL_APIENTRY fake_glGetStringi(GLenum, GLuint index)
+            {
+                return (const GLubyte*)(index == 0 ? "GL_OES_depth24" : "GL_EXT_texture_format_BGRA8888");
+            }
+            static void GL_APIENTRY fake_glGetIntegerv(GLenum name, GLint* value)
+            {
+                ++queries;
+                switch (name) {
+                    case GL_NUM_EXTENSIONS:       *value = 2; break;
+                    case GL_MAX_TEXTURE_SIZE:     *value = 16384; break;
+                    case GL_MAX_UNIFORM_BLOCK_SIZE: *value = 65536; break;
+                    /* Not in GLES 3.0: asking would raise GL_INVALID_ENUM. */
+                    case GL_CONTEXT_FLAGS:
+                    case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS:
+                    case GL_MAX_COMPUTE_SHARED_MEMORY_SIZE: ++unexpected; break;
+                    default:                      *value = 1; break;
+                }
+            }
+            static GLenum GL_APIENTRY fake_glGetError(void) { return GL_NO_ERROR; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "glGetString") == 0)   return reinterpret_cast<void*>(&fake_glGetString);
+                if (strcmp(name, "glGetStringi") == 0)  return reinterpret_cast<void*>(&fake_glGetStringi);
+                if (strcmp(name, "glGetIntegerv") == 0) return reinterpret_cast<void*>(&fake_glGetIntegerv);
+                if (strcmp(name, "glGetError") == 0)    return reinterpret_cast<void*>(&fake_glGetError);
+                return nullptr;
+            }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+
+                const glatter_context_caps_t* caps = glatter_get_context_caps();
+                if (caps->major != 3 || caps->minor != 0 || !caps->es || caps->glsl_version != 300) {
+                    return 1;
+                }
+                if (caps->limits[GLATTER_LIMIT_MAX_TEXTURE_SIZE] != 16384 ||
+                    caps->limits[GLATTER_LIMIT_MAX_UNIFORM_BLOCK_SIZE] != 65536 ||
+                    caps->limits[GLATTER_LIMIT_MAX_SHADER_STORAGE_BUFFER_BINDINGS] != 0 ||
+                    caps->flags != 0 || unexpected != 0)
+                {
+                    return 2;
+                }
+                if (!glatter_GL_OES_depth24 || !glatter_GL_EXT_texture_format_BGRA8888) {
+                    return 3;
+                }
+
+                /* Both come from the one cached set. */
+                int issued = queries;
+                if (glatter_get_context_caps() != caps || queries != issued) {
+                    return 4;
+                }
+                glatter_invalidate_all_extension_caches();
+                const glatter_context_caps_t* again = glatter_get_context_caps();
+                if (queries == issued || again->limits[GLATTER_LIMIT_MAX_TEXTURE_SIZE] != 16384) {
+                    return 5;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES_3_2",
+        "-DGLATTER_EGL",
+        "-DGLATTER_GL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "context_caps_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_destroyed_contexts_leave_the_extension_cache(tmp_path: Path) -> None:
+    """Destroying a context evicts its cached sets, and only its sets, also when destruction is deferred."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "context_eviction_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static int context_a, context_b, display;
+            static EGLContext current_context = EGL_NO_CONTEXT;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            static int queries = 0;
+
+            static const char* EGLAPIENTRY fake_eglQueryString(EGLDisplay, EGLint name)
+            {
+                if (name == EGL_EXTENSIONS) {
+                    ++queries;
+                    return "EGL_KHR_image_base";
+                }
+                return nullptr;
+            }
+            static EGLBoolean EGLAPIENTRY fake_eglMakeCurrent(EGLDisplay, EGLSurface, EGLSurface, EGLContext ctx)
+            {
+                current_context = ctx;
+                return EGL_TRUE;
+            }
+            static EGLBoolean EGLAPIENTRY fake_eglDestroyContext(EGLDisplay, EGLContext) { return EGL_TRUE; }
+            static EGLint EGLAPIENTRY fake_eglGetError(void) { return EGL_SUCCESS; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglQueryString") == 0)    return reinterpret_cast<void*>(&fake_eglQueryString);
+                if (strcmp(name, "eglMakeCurrent") == 0)    return reinterpret_cast<void*>(&fake_eglMakeCurrent);
+                if (strcmp(name, "eglDestroyContext") == 0) return reinterpret_cast<void*>(&fake_eglDestroyContext);
+                if (strcmp(name, "eglGetError") == 0)       return reinterpret_cast<void*>(&fake_eglGetError);
+                return nullptr;
+            }
+
+            static void use(EGLContext ctx)
+            {
+                eglMakeCurrent((EGLDisplay)&display, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx);
+                (void)glatter_EGL_KHR_image_base;
+            }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                EGLContext a = (EGLContext)&context_a, b = (EGLContext)&context_b;
+
+                use(a);
+                use(b);
+                use(a);
+                if (queries != 2) {
+                    return 1;
+                }
+
+                /* b is not current, so it is gone at once: only its set goes. */
+                eglDestroyContext((EGLDisplay)&display, b);
+                use(a);
+                if (queries != 2) {
+                    return 2;
+                }
+                use(b); /* a new context at the old address */
+                if (queries != 3) {
+                    return 3;
+                }
+
+                /* a is current, so it lives on until released, and its set is
+                 * cached again meanwhile. A new context at its address must
+                 * not find that set. */
+                use(a);
+                eglDestroyContext((EGLDisplay)&display, a);
+                (void)glatter_EGL_KHR_image_base;
+                if (queries != 4) {
+                    return 4;
+                }
+                use(b);
+                use(a);
+                if (queries != 5) {
+                    return 5;
+                }
+                use(a);
+                return queries == 5 ? 0 : 6;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "context_eviction_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_logged_make_current_and_destroy_still_evict(tmp_path: Path) -> None:
+    """With GLATTER_LOG_CALLS the routed make-current and destroy calls are logged and still evict."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "logged_lifetime_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <string>
+            #include <glatter/glatter.h>
+
+            static int context, display;
+            static EGLContext current_context = EGL_NO_CONTEXT;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            static int queries = 0;
+
+            static const char* EGLAPIENTRY fake_eglQueryString(EGLDisplay, EGLint name)
+            {
+                if (name == EGL_EXTENSIONS) {
+                    ++queries;
+                    return "EGL_KHR_image_base";
+                }
+                return nullptr;
+            }
+            static EGLBoolean EGLAPIENTRY fake_eglMakeCurrent(EGLDisplay, EGLSurface, EGLSurface, EGLContext ctx)
+            {
+                current_context = ctx;
+                return EGL_TRUE;
+            }
+            static EGLBoolean EGLAPIENTRY fake_eglDestroyContext(EGLDisplay, EGLContext) { return EGL_TRUE; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglQueryString") == 0)    return reinterpret_cast<void*>(&fake_eglQueryString);
+                if (strcmp(name, "eglMakeCurrent") == 0)    return reinterpret_cast<void*>(&fake_eglMakeCurrent);
+                if (strcmp(name, "eglDestroyContext") == 0) return reinterpret_cast<void*>(&fake_eglDestroyContext);
+                return nullptr;
+            }
+
+            static std::string logged;
+            static void capture(const char* text) { logged += text; }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                glatter_set_log_handler(capture);
+                EGLContext ctx = (EGLContext)&context;
+
+                eglMakeCurrent((EGLDisplay)&display, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx);
+                (void)glatter_EGL_KHR_image_base;
+                eglMakeCurrent((EGLDisplay)&display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                eglDestroyContext((EGLDisplay)&display, ctx);
+
+                /* The call site is the caller's, not glatter's. */
+                if (logged.find("eglMakeCurrent") == std::string::npos ||
+                    logged.find("eglDestroyContext") == std::string::npos ||
+                    logged.find("logged_lifetime_test.cpp") == std::string::npos) {
+                    return 1;
+                }
+
+                eglMakeCurrent((EGLDisplay)&display, EGL_NO_SURFACE, EGL_NO_SURFACE, ctx);
+                (void)glatter_EGL_KHR_image_base;
+                return queries == 2 ? 0 : 2;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DGLATTER_LOG_CALLS",
+    ]
+
+    output = tmp_path / "logged_lifetime_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_dropped_extension_sets_are_kept_and_reused(tmp_path: Path) -> None:
+    """Sets dropped by invalidation and eviction stay readable through held pointers and do not add up."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    probe = tmp_path / "asan_probe.cpp"
+    probe.write_text("int main() { return 0; }\n")
+    if subprocess.run([cxx, "-fsanitize=address", str(probe), "-o", str(tmp_path / "asan_probe")]).returncode:
+        pytest.skip("AddressSanitizer is not available")
+
+    source = tmp_path / "kept_sets_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <atomic>
+            #include <string.h>
+            #include <thread>
+            #include <vector>
+            #include <glatter/glatter.h>
+
+            static int contexts[4], display;
+            static thread_local EGLContext current_context = EGL_NO_CONTEXT;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            static const char* EGLAPIENTRY fake_eglQueryString(EGLDisplay, EGLint name)
+            {
+                return name == EGL_EXTENSIONS ? "EGL_KHR_fence_sync EGL_KHR_image_base" : nullptr;
+            }
+            static EGLBoolean EGLAPIENTRY fake_eglDestroyContext(EGLDisplay, EGLContext) { return EGL_TRUE; }
+            static EGLint EGLAPIENTRY fake_eglGetError(void) { return EGL_SUCCESS; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglQueryString") == 0)    return reinterpret_cast<void*>(&fake_eglQueryString);
+                if (strcmp(name, "eglDestroyContext") == 0) return reinterpret_cast<void*>(&fake_eglDestroyContext);
+                if (strcmp(name, "eglGetError") == 0)       return reinterpret_cast<void*>(&fake_eglGetError);
+                return nullptr;
+            }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+
+                std::atomic<bool> done(false);
+                std::atomic<int> wrong(0);
+                std::vector<std::thread> readers;
+                for (int i = 0; i < 4; ++i) {
+                    readers.emplace_back([i, &done, &wrong] {
+                        current_context = (EGLContext)&contexts[i];
+                        /* A held pointer is read while its set leaves the cache. */
+                        const glatter_extension_support_status_EGL_t* held = glatter_get_extension_support_EGL();
+                        while (!done) {
+                            if (!glatter_EGL_KHR_image_base || glatter_EGL_KHR_gl_texture_2D_image ||
+                                !GLATTER_EXTENSION_SUPPORTED(held, GLATTER_EXT_EGL_KHR_fence_sync)) {
+                                ++wrong;
+                            }
+                        }
+                    });
+                }
+                for (int i = 0; i < 2000; ++i) {
+                    if (i & 1) {
+                        glatter_invalidate_all_extension_caches();
+                    }
+                    else {
+                        eglDestroyContext((EGLDisplay)&display, (EGLContext)&contexts[(i >> 1) & 3]);
+                    }
+                }
+                done = true;
+                for (std::thread& reader : readers) {
+                    reader.join();
+                }
+                if (wrong) {
+                    return 1;
+                }
+
+                /* Each context's set was rebuilt equal, so one of each is kept. */
+                int kept = 0;
+                for (glatter_context_set_t* set = (glatter_context_set_t*)GLATTER_ATOMIC_LOAD(glatter_es_cache_EGL.kept);
+                     set; set = set->kept_next)
+                {
+                    ++kept;
+                }
+                return kept <= 4 ? 0 : 2;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "kept_sets_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-g",
+            "-fsanitize=address",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_header_only_missing_entry_point_is_not_looked_up_again(tmp_path: Path) -> None:
+    """Once the WSI is latched, a miss is logged once per generation instead of per call."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("exercises the EGL loader on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "negative_cache_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static int g_misses = 0;
+
+            static void counting_sink(const char* line)
+            {
+                if (strstr(line, "eglCreateStreamKHR") != nullptr) {
+                    ++g_misses;
+                }
+            }
+
+            int main()
+            {
+                if (glatter_get_proc_address("eglGetError") == nullptr) {
+                    return 77; /* no EGL library on this host */
+                }
+                if (glatter_get_proc_address("eglCreateStreamKHR") != nullptr) {
+                    return 77; /* the probe entry point exists here */
+                }
+
+                glatter_set_log_handler(counting_sink);
+                for (int i = 0; i < 3; ++i) {
+                    (void)eglCreateStreamKHR(EGL_NO_DISPLAY, nullptr);
+                }
+                if (g_misses != 1) {
+                    return 1;
+                }
+
+                glatter_reset_missing_entry_points();
+                (void)eglCreateStreamKHR(EGL_NO_DISPLAY, nullptr);
+                (void)eglCreateStreamKHR(EGL_NO_DISPLAY, nullptr);
+                if (g_misses != 2) {
+                    return 2;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "negative_cache_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    if result.returncode == 77:
+        pytest.skip("no EGL library with a missing probe entry point")
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_proc_address_cache_matches_the_loader(tmp_path: Path) -> None:
+    """Cached lookups must agree with the loader, for known and unknown names."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("exercises the GLX loader on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "proc_cache_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <glatter/glatter_solo.h>
+
+            int main()
+            {
+                /* The generator and glatter_def.h must agree on every slot. */
+                for (uint32_t i = 0; i < GLATTER_ENTRY_POINT_SLOTS; ++i) {
+                    const char* name = glatter_entry_point_names[i];
+                    if (name && glatter_entry_point_slot_(glatter_entry_point_hash_(name)) != i) {
+                        fprintf(stderr, "%s is not in its hashed slot\\n", name);
+                        return 1;
+                    }
+                }
+
+                if (glatter_get_proc_address("glClear") == nullptr) {
+                    return 77; /* no GL driver on this host */
+                }
+
+                glatter_loader_state* state = glatter_loader_state_get();
+                const char* names[] = { "glGetString", "glatterNotAnEntryPoint" };
+                for (const char* name : names) {
+                    void* direct = glatter_resolve_through_(
+                        state, GLATTER_ATOMIC_INT_LOAD(state->active), name);
+                    for (int i = 0; i < 3; ++i) {
+                        if (glatter_get_proc_address(name) != direct) {
+                            fprintf(stderr, "cached %s differs from the loader\\n", name);
+                            return 2;
+                        }
+                    }
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "proc_cache_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            *_opengl_libs(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    if result.returncode == 77:
+        pytest.skip("no GL driver could be loaded")
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_eager_init_binds_every_entry_point_up_front(tmp_path: Path) -> None:
+    """GLATTER_EAGER binds the link-once table slots in one pass and reports the outcome."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("exercises the GLX loader on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "eager_init_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <glatter/glatter.h>
+
+            int main()
+            {
+                if (glatter_fn_table_GL[GLATTER_FN_glGetString] != nullptr) {
+                    return 1; /* bound before glatter_init_GL */
+                }
+
+                glatter_init_report_t report;
+                if (!glatter_init_GL(&report)) {
+                    return 77; /* no GL driver on this host */
+                }
+                if (report.resolved == 0) {
+                    return 2;
+                }
+                if (glatter_fn_table_GL[GLATTER_FN_glGetString] != glatter_get_proc_address("glGetString")) {
+                    fprintf(stderr, "glGetString is not bound to the driver entry\\n");
+                    return 3;
+                }
+                for (unsigned i = 0; i < report.missing && i < GLATTER_INIT_REPORT_NAMES; ++i) {
+                    if (report.missing_names[i] == nullptr) {
+                        return 4;
+                    }
+                }
+
+                (void)glGetString(GL_VERSION);
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_GL=1",
+        "-DGLATTER_GLX=1",
+        "-DGLATTER_MESA_GLX_GL=1",
+        "-DGLATTER_EAGER",
+    ]
+
+    output = tmp_path / "eager_init_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            str(source),
+            "-lGL",
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    if result.returncode == 77:
+        pytest.skip("no GL driver could be loaded")
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_async_warmup_fills_the_address_cache(tmp_path: Path) -> None:
+    """The warm-up worker latches the WSI and fills the address cache and the entry point slots."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("exercises the GLX loader on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "warmup_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <glatter/glatter_solo.h>
+
+            int main()
+            {
+                glatter_warmup_t* warmup = glatter_warmup_async();
+                if (warmup == nullptr) {
+                    return 1;
+                }
+                if (glatter_warmup_async() != warmup) {
+                    return 2; /* a second call must not start another worker */
+                }
+
+                /* Races the worker on purpose. */
+                void* raced = glatter_get_proc_address("glClear");
+
+                glatter_warmup_wait(warmup);
+                if (!glatter_warmup_poll(warmup)) {
+                    return 3;
+                }
+
+                glatter_loader_state* state = glatter_loader_state_get();
+                if (GLATTER_ATOMIC_INT_LOAD(state->phase) != GLATTER_PHASE_RESOLVED) {
+                    return 77; /* no GL driver on this host */
+                }
+                if (glatter_get_proc_address("glClear") != raced) {
+                    return 4;
+                }
+
+                uint32_t slot = glatter_entry_point_slot_(glatter_entry_point_hash_("glGetString"));
+                if (GLATTER_ATOMIC_LOAD(glatter_entry_point_cache[slot]) == nullptr) {
+                    return 5; /* the worker did not fill the cache */
+                }
+                if (GLATTER_ATOMIC_LOAD(GLATTER_FN_SLOT(GL, glGetString)) == nullptr) {
+                    return 6; /* nor the slot of the entry point */
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "warmup_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            "-lX11",
+            *_dl_flags(),
+            *_opengl_libs(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    if result.returncode == 77:
+        pytest.skip("no GL driver could be loaded")
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_library_paths_and_dlopen_policy_are_honoured(tmp_path: Path) -> None:
+    """Pinned paths replace soname probing, and noload never maps a new library."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("exercises the dlopen loader on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "loader_policy_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter_solo.h>
+
+            int main(int argc, char** argv)
+            {
+                const char* mode = argc > 1 ? argv[1] : "";
+
+                if (strcmp(mode, "pinned") == 0) {
+                    if (!glatter_set_library_path(GLATTER_LIBRARY_GL, "/nonexistent/libGL.so.1") ||
+                        !glatter_set_library_path(GLATTER_LIBRARY_EGL, "/nonexistent/libEGL.so.1")) {
+                        return 1;
+                    }
+                    if (glatter_get_proc_address("glClear") != nullptr) {
+                        return 2; /* resolved past the pinned paths */
+                    }
+                    if (glatter_set_library_path(GLATTER_LIBRARY_GL, nullptr)) {
+                        return 3; /* accepted after the libraries were opened */
+                    }
+                    return 0;
+                }
+
+                /* "noload": nothing maps libGL or libEGL before glatter does. */
+                if (glatter_get_proc_address("glClear") != nullptr) {
+                    return 4;
+                }
+                if (!glatter_set_dlopen_policy(GLATTER_DLOPEN_LAZY)) {
+                    /* expected: the libraries were already opened with noload */
+                    return 0;
+                }
+                return 5;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "loader_policy_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            *_opengl_libs(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    env = dict(os.environ)
+    env.pop("GLATTER_GL_LIBRARY", None)
+    env.pop("GLATTER_EGL_LIBRARY", None)
+    env["GLATTER_DLOPEN"] = "now,noload"
+    for mode in ("pinned", "noload"):
+        result = subprocess.run([str(output), mode], capture_output=True, text=True, env=env)
+        assert result.returncode == 0, mode + ": " + result.stdout + result.stderr
+
+
+def test_proc_address_provider_replaces_the_wsi_loaders(tmp_path: Path) -> None:
+    """An installed provider resolves everything and no WSI library is opened."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("inspects mapped libraries through dlopen on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "provider_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <dlfcn.h>
+            #include <string.h>
+            #include <glatter/glatter_solo.h>
+
+            static int provider_calls = 0;
+
+            static void fake_clear(GLbitfield mask)
+            {
+                (void)mask;
+            }
+
+            static void* provider(const char* name, void* user_data)
+            {
+                ++provider_calls;
+                if (user_data != &provider_calls) {
+                    return nullptr;
+                }
+                return strcmp(name, "glClear") == 0 ? reinterpret_cast<void*>(&fake_clear) : nullptr;
+            }
+
+            int main()
+            {
+                if (!glatter_set_proc_address_provider(provider, &provider_calls)) {
+                    return 1;
+                }
+                if (glatter_get_proc_address("glNotAnEntryPoint") != nullptr) {
+                    return 2;
+                }
+                if (!glatter_set_proc_address_provider(provider, &provider_calls)) {
+                    return 3; /* a miss latches nothing */
+                }
+
+                for (int i = 0; i < 5; ++i) {
+                    if (glatter_get_proc_address("glClear") != reinterpret_cast<void*>(&fake_clear)) {
+                        return 4;
+                    }
+                }
+                /* the miss, the latching lookup, and the one that fills the cache */
+                if (provider_calls != 3) {
+                    return 5;
+                }
+                if (glatter_set_proc_address_provider(nullptr, nullptr)) {
+                    return 6; /* accepted after the latch */
+                }
+                if (dlopen("libGL.so.1", RTLD_LAZY | RTLD_NOLOAD) ||
+                    dlopen("libEGL.so.1", RTLD_LAZY | RTLD_NOLOAD)) {
+                    return 7; /* a WSI library was probed */
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "provider_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-DNDEBUG",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            *_opengl_libs(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_context_dispatch_switches_tables_on_make_current(tmp_path: Path) -> None:
+    """Each context resolves into its own table, selected per thread by eglMakeCurrent."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "context_dispatch_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <thread>
+            #include <glatter/glatter.h>
+
+            /* Contexts are faked: a provider hands out a different glClear for
+             * each one, and eglMakeCurrent only records the current context. */
+            static int context_a, context_b, display;
+            static thread_local EGLContext current_context = EGL_NO_CONTEXT;
+
+            /* glatter's own lookups call these directly; the parentheses keep
+             * its wrapper macros from expanding. */
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            static EGLBoolean EGLAPIENTRY fake_make_current(EGLDisplay, EGLSurface, EGLSurface, EGLContext ctx)
+            {
+                current_context = ctx;
+                return EGL_TRUE;
+            }
+
+            static EGLBoolean EGLAPIENTRY fake_destroy_context(EGLDisplay, EGLContext)
+            {
+                return EGL_TRUE;
+            }
+
+            static int clears_a = 0, clears_b = 0, clear_lookups = 0, flush_lookups = 0;
+            static void GL_APIENTRY clear_a(GLbitfield) { ++clears_a; }
+            static void GL_APIENTRY clear_b(GLbitfield) { ++clears_b; }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglMakeCurrent") == 0) {
+                    return reinterpret_cast<void*>(&fake_make_current);
+                }
+                if (strcmp(name, "eglDestroyContext") == 0) {
+                    return reinterpret_cast<void*>(&fake_destroy_context);
+                }
+                if (strcmp(name, "glClear") == 0) {
+                    ++clear_lookups;
+                    return current_context == (EGLContext)&context_a
+                        ? reinterpret_cast<void*>(&clear_a)
+                        : reinterpret_cast<void*>(&clear_b);
+                }
+                if (strcmp(name, "glFlush") == 0) {
+                    ++flush_lookups;
+                }
+                return nullptr;
+            }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                EGLDisplay dpy = (EGLDisplay)&display;
+
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_a);
+                glClear(GL_COLOR_BUFFER_BIT);
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_b);
+                glClear(GL_COLOR_BUFFER_BIT);
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_a);
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (clears_a != 2 || clears_b != 1 || clear_lookups != 2) {
+                    return 1;
+                }
+
+                /* Another thread keeps its own current context and table. */
+                std::thread worker([dpy] {
+                    eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_b);
+                    glClear(GL_COLOR_BUFFER_BIT);
+                });
+                worker.join();
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (clears_a != 3 || clears_b != 2 || clear_lookups != 2) {
+                    return 2;
+                }
+
+                /* A switch that bypassed the wrappers needs an explicit rebind. */
+                current_context = (EGLContext)&context_b;
+                glatter_bind_dispatch_to_current_context();
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (clears_b != 3) {
+                    return 3;
+                }
+
+                /* A miss is remembered per context. */
+                glFlush();
+                glFlush();
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_a);
+                glFlush();
+                if (flush_lookups != 2) {
+                    return 4;
+                }
+
+                /* A new context at a destroyed one's address starts afresh. */
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                eglDestroyContext(dpy, (EGLContext)&context_a);
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_a);
+                glFlush();
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (flush_lookups != 3 || clear_lookups != 3 || clears_a != 4) {
+                    return 5;
+                }
+
+                /* Forgetting one context's misses leaves the other's. */
+                glatter_reset_missing_entry_points_for_current_context();
+                glFlush();
+                glFlush();
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_b);
+                glFlush();
+                if (flush_lookups != 4) {
+                    return 6;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DGLATTER_GL",
+        "-DGLATTER_CONTEXT_DISPATCH",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "context_dispatch_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_ifunc_entry_points_bind_to_the_driver_at_load_time(tmp_path: Path) -> None:
+    """With GLATTER_IFUNC the PLT slot of a lazily bound call holds the driver entry once it is resolved."""
+
+    if not sys.platform.startswith("linux"):
+        pytest.skip("GNU IFUNC is only available on Linux")
+
+    cc = _require_tool("cc")
+
+    source = tmp_path / "ifunc_test.c"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <link.h>
+            #include <stdio.h>
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            #if __SIZEOF_POINTER__ == 8
+            #define RELA_SYM ELF64_R_SYM
+            #else
+            #define RELA_SYM ELF32_R_SYM
+            #endif
+
+            static int calls = 0;
+
+            static const GLubyte* fake_get_string(GLenum name)
+            {
+                (void)name;
+                ++calls;
+                return (const GLubyte*)"fake";
+            }
+
+            static GLenum fake_get_error(void)
+            {
+                ++calls;
+                return GL_NO_ERROR;
+            }
+
+            static void* provider(const char* name, void* user_data)
+            {
+                (void)user_data;
+                if (strcmp(name, "glGetString") == 0) return (void*)&fake_get_string;
+                if (strcmp(name, "glGetError") == 0) return (void*)&fake_get_error;
+                return NULL;
+            }
+
+            /* Current target of the executable's PLT slot for 'symbol'. */
+            static void* plt_target(const char* symbol)
+            {
+                const struct link_map* map = _r_debug.r_map;
+                const ElfW(Rela)* rela = NULL;
+                size_t size = 0;
+                const ElfW(Sym)* symtab = NULL;
+                const char* strtab = NULL;
+                for (const ElfW(Dyn)* d = map->l_ld; d->d_tag != DT_NULL; ++d) {
+                    switch (d->d_tag) {
+                        case DT_JMPREL:   rela   = (const ElfW(Rela)*)d->d_un.d_ptr; break;
+                        case DT_PLTRELSZ: size   = d->d_un.d_val; break;
+                        case DT_SYMTAB:   symtab = (const ElfW(Sym)*)d->d_un.d_ptr; break;
+                        case DT_STRTAB:   strtab = (const char*)d->d_un.d_ptr; break;
+                    }
+                }
+                for (size_t i = 0; rela && i < size / sizeof(*rela); ++i) {
+                    if (strcmp(strtab + symtab[RELA_SYM(rela[i].r_info)].st_name, symbol) == 0) {
+                        return *(void**)(map->l_addr + rela[i].r_offset);
+                    }
+                }
+                return NULL;
+            }
+
+            int main(void)
+            {
+                glatter_set_proc_address_provider(provider, NULL);
+
+                /* Bound before anything is resolved: the resolver loads nothing. */
+                if (glGetError() != GL_NO_ERROR) {
+                    return 1;
+                }
+
+                /* Bound after glatter has cached the address. */
+                if (glatter_get_proc_address("glGetString") != (void*)&fake_get_string) {
+                    return 2;
+                }
+                if (strcmp((const char*)glGetString(GL_VERSION), "fake") != 0) {
+                    return 3;
+                }
+                (void)glGetString(GL_VERSION);
+                if (calls != 3) {
+                    return 4;
+                }
+                printf("%s %s\\n",
+                    plt_target("glatter_glGetError") == (void*)&fake_get_error ? "driver" : "glatter",
+                    plt_target("glatter_glGetString") == (void*)&fake_get_string ? "driver" : "glatter");
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_GL=1",
+        "-DGLATTER_GLX=1",
+        "-DGLATTER_MESA_GLX_GL=1",
+        "-DGLATTER_IFUNC",
+        "-DNDEBUG",
+    ]
+
+    library = tmp_path / "libglatter.so"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            "-fPIC",
+            "-shared",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            str(REPO_ROOT / "src" / "glatter" / "glatter.c"),
+            "-lGL",
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(library),
+        ]
+    )
+
+    output = tmp_path / "ifunc_test"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            "-D_GNU_SOURCE",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            str(source),
+            str(library),
+            f"-Wl,-rpath,{tmp_path}",
+            "-Wl,-z,lazy",
+            "-o",
+            str(output),
+        ]
+    )
+
+    lazy = subprocess.run([str(output)], capture_output=True, text=True)
+    assert lazy.returncode == 0, lazy.stdout + lazy.stderr
+    assert lazy.stdout.strip() == "glatter driver"
+    assert "bound before glatter was initialized" not in lazy.stderr
+
+    # Bound during relocation: falls back to glatter's resolve-on-first-call path, with a warning.
+    eager_env = dict(os.environ, LD_BIND_NOW="1")
+    eager = subprocess.run([str(output)], capture_output=True, text=True, env=eager_env)
+    assert eager.returncode == 0, eager.stdout + eager.stderr
+    assert eager.stdout.strip() == "glatter glatter"
+    assert eager.stderr.count("bound before glatter was initialized") == 1
+
+
+def test_trampolines_leave_no_glatter_frame(tmp_path: Path) -> None:
+    """With GLATTER_TRAMPOLINES the driver entry returns straight to the application."""
+
+    if not sys.platform.startswith("linux") or platform.machine().lower() not in ("x86_64", "amd64", "aarch64", "arm64"):
+        pytest.skip("trampolines are assembled for x86-64 and AArch64 ELF")
+
+    cc = _require_tool("cc")
+
+    source = tmp_path / "trampoline_test.c"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <dlfcn.h>
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static void* caller = NULL;
+
+            __attribute__((noinline))
+            static const GLubyte* fake_get_string(GLenum name)
+            {
+                (void)name;
+                caller = __builtin_return_address(0);
+                return (const GLubyte*)"fake";
+            }
+
+            static void* provider(const char* name, void* user_data)
+            {
+                (void)user_data;
+                return strcmp(name, "glGetString") == 0 ? (void*)&fake_get_string : NULL;
+            }
+
+            static const void* object_of(const void* address)
+            {
+                Dl_info info;
+                return dladdr(address, &info) ? info.dli_fbase : NULL;
+            }
+
+            int main(void)
+            {
+                glatter_set_proc_address_provider(provider, NULL);
+                (void)glGetString(GL_VERSION); /* resolves */
+                caller = NULL;
+                if (strcmp((const char*)glGetString(GL_VERSION), "fake") != 0) {
+                    return 1;
+                }
+                if (caller == NULL || object_of(caller) != object_of((const void*)&main)) {
+                    return 2; /* returned into glatter, not into the application */
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_GL=1",
+        "-DGLATTER_GLX=1",
+        "-DGLATTER_MESA_GLX_GL=1",
+        "-DGLATTER_TRAMPOLINES",
+        "-DNDEBUG",
+    ]
+
+    # Unoptimized, so that a C wrapper would keep its frame.
+    library = tmp_path / "libglatter.so"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            "-O0",
+            "-fPIC",
+            "-shared",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            str(REPO_ROOT / "src" / "glatter" / "glatter.c"),
+            "-lGL",
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(library),
+        ]
+    )
+
+    output = tmp_path / "trampoline_test"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            "-D_GNU_SOURCE",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            str(source),
+            str(library),
+            f"-Wl,-rpath,{tmp_path}",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_glvnd_libraries_replace_the_libgl_compatibility_library(tmp_path: Path) -> None:
+    """GL comes from libOpenGL and libGLX where both exist, and from libGL otherwise."""
+
+    if not sys.platform.startswith("linux"):
+        pytest.skip("GLVND sonames are Linux-specific")
+
+    cc = _require_tool("cc")
+    cxx = _require_tool("c++")
+
+    stubs = tmp_path / "stubs"
+    stubs.mkdir()
+    stub_sources = {
+        "libOpenGL.so.0": "void glClear(unsigned mask) { (void)mask; }\n",
+        "libGLX.so.0": textwrap.dedent(
+            """
+            #include <string.h>
+            void stub_vendor_entry(void) {}
+            void* glXGetProcAddressARB(const unsigned char* name)
+            {
+                return strcmp((const char*)name, "glVendorEntryTEST") == 0 ? (void*)&stub_vendor_entry : 0;
+            }
+            """
+        ),
+        "libGL.so.1": textwrap.dedent(
+            """
+            void glClear(unsigned mask) { (void)mask; }
+            void* glXGetProcAddressARB(const unsigned char* name) { (void)name; return 0; }
+            """
+        ),
+    }
+    for soname, text in stub_sources.items():
+        stub_source = tmp_path / (soname.split(".")[0] + ".c")
+        stub_source.write_text(text)
+        _run_command(
+            [cc, "-shared", "-fPIC", f"-Wl,-soname,{soname}", str(stub_source), "-o", str(stubs / soname)]
+        )
+
+    source = tmp_path / "glvnd_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <dlfcn.h>
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static void* mapped(const char* soname)
+            {
+                return dlopen(soname, RTLD_LAZY | RTLD_NOLOAD);
+            }
+
+            int main(int argc, char** argv)
+            {
+                const bool legacy = argc > 1 && strcmp(argv[1], "legacy") == 0;
+                if (legacy) {
+                    /* A process that only has libGL, as on a system without GLVND. */
+                    if (!dlopen("libGL.so.1", RTLD_LAZY | RTLD_GLOBAL)) {
+                        return 1;
+                    }
+                    glatter_set_dlopen_policy(GLATTER_DLOPEN_NOLOAD);
+                }
+
+                void* clear = glatter_get_proc_address("glClear");
+                if (legacy) {
+                    void* libgl = mapped("libGL.so.1");
+                    if (clear == nullptr || clear != dlsym(libgl, "glClear")) {
+                        return 2;
+                    }
+                    return mapped("libOpenGL.so.0") ? 3 : 0;
+                }
+
+                void* opengl = mapped("libOpenGL.so.0");
+                void* glx    = mapped("libGLX.so.0");
+                if (!opengl || !glx || clear == nullptr || clear != dlsym(opengl, "glClear")) {
+                    return 4;
+                }
+                if (glatter_get_proc_address("glVendorEntryTEST") != dlsym(glx, "stub_vendor_entry")) {
+                    return 5; /* not resolved through libGLX's glXGetProcAddressARB */
+                }
+                return mapped("libGL.so.1") ? 6 : 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "glvnd_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-DGLATTER_CONFIG_H_DEFINED",
+            "-DGLATTER_HEADER_ONLY",
+            "-DGLATTER_GL",
+            "-DGLATTER_GLX",
+            "-DGLATTER_MESA_GLX_GL",
+            "-DNDEBUG",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    env = dict(os.environ, LD_LIBRARY_PATH=str(stubs))
+    for mode in ("glvnd", "legacy"):
+        result = subprocess.run([str(output), mode], capture_output=True, text=True, env=env)
+        assert result.returncode == 0, f"{mode}: {result.returncode}\n" + result.stdout + result.stderr
+
+
+def test_shared_registry_resolves_once_across_plugins(tmp_path: Path) -> None:
+    """With GLATTER_SHARED_REGISTRY, plugins opened with RTLD_LOCAL share one resolution."""
+
+    if not sys.platform.startswith("linux"):
+        pytest.skip("the shared registry is discovered through the ELF dynamic loader")
+
+    cc = _require_tool("cc")
+    cxx = _require_tool("c++")
+
+    header_plugin = tmp_path / "header_plugin.cpp"
+    header_plugin.write_text(
+        textwrap.dedent(
+            """
+            #include <glatter/glatter.h>
+
+            extern "C" __attribute__((visibility("default")))
+            void plugin_configure(glatter_proc_address_provider_fn provider)
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                glFlush(); /* latches the configuration */
+            }
+
+            extern "C" __attribute__((visibility("default")))
+            void plugin_draw(void)
+            {
+                glClear(GL_COLOR_BUFFER_BIT);
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+    compiled_plugin = tmp_path / "compiled_plugin.c"
+    compiled_plugin.write_text(
+        textwrap.dedent(
+            """
+            #include <glatter/glatter.h>
+
+            __attribute__((visibility("default")))
+            void plugin_draw(void)
+            {
+                glClear(GL_COLOR_BUFFER_BIT);
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+    host = tmp_path / "host.c"
+    host.write_text(
+        textwrap.dedent(
+            """
+            #include <dlfcn.h>
+            #include <stdio.h>
+            #include <string.h>
+
+            static int lookups = 0;
+            static int clears = 0;
+
+            static void fake_glClear(unsigned mask) { (void)mask; ++clears; }
+            static void fake_glFlush(void) {}
+
+            static void* provider(const char* name, void* user_data)
+            {
+                (void)user_data;
+                if (strcmp(name, "glFlush") == 0) {
+                    return (void*)&fake_glFlush;
+                }
+                if (strcmp(name, "glClear") != 0) {
+                    return NULL;
+                }
+                ++lookups;
+                return (void*)&fake_glClear;
+            }
+
+            static void* open_plugin(const char* path)
+            {
+                void* handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+                if (!handle) {
+                    fprintf(stderr, "%s\\n", dlerror());
+                }
+                return handle;
+            }
+
+            static void draw(void* handle)
+            {
+                ((void (*)(void))dlsym(handle, "plugin_draw"))();
+            }
+
+            int main(int argc, char** argv)
+            {
+                if (argc != 4) {
+                    return 1;
+                }
+                void* a = open_plugin(argv[1]);
+                if (!a) {
+                    return 2;
+                }
+                ((void (*)(void* (*)(const char*, void*)))dlsym(a, "plugin_configure"))(provider);
+                draw(a);
+
+                void* b = open_plugin(argv[2]);
+                void* c = open_plugin(argv[3]);
+                if (!b || !c) {
+                    return 2;
+                }
+                draw(b);
+                draw(c);
+
+                /* The others call into the first plugin's glatter, which stays loaded. */
+                dlclose(a);
+                draw(b);
+                draw(c);
+
+                printf("%d %d\\n", lookups, clears);
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_GL=1",
+        "-DGLATTER_GLX=1",
+        "-DGLATTER_MESA_GLX_GL=1",
+        "-DGLATTER_SHARED_REGISTRY",
+        "-DNDEBUG",
+    ]
+    plugin_flags = ["-fPIC", "-shared", "-fvisibility=hidden", *config_flags, "-I", str(REPO_ROOT / "include")]
+    plugin_libs = ["-lGL", "-lX11", *_thread_flags(), *_dl_flags()]
+
+    plugins = []
+    for name in ("a", "c"):
+        plugin = tmp_path / f"libplugin_{name}.so"
+        _run_command(
+            [cxx, "-std=c++17", "-DGLATTER_HEADER_ONLY", *plugin_flags, str(header_plugin), *plugin_libs, "-o", str(plugin)]
+        )
+        plugins.append(plugin)
+    plugin_b = tmp_path / "libplugin_b.so"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            *plugin_flags,
+            str(REPO_ROOT / "src" / "glatter" / "glatter.c"),
+            str(compiled_plugin),
+            *plugin_libs,
+            "-o",
+            str(plugin_b),
+        ]
+    )
+
+    output = tmp_path / "host"
+    _run_command([cc, "-std=c11", str(host), *_dl_flags(), "-o", str(output)])
+
+    result = subprocess.run(
+        [str(output), str(plugins[0]), str(plugin_b), str(plugins[1])], capture_output=True, text=True
+    )
+    assert result.returncode == 0, result.stdout + result.stderr
+    assert result.stdout.split() == ["1", "5"], result.stdout + result.stderr
+
+
+def test_function_availability_is_probed_once_per_context(tmp_path: Path) -> None:
+    """Availability comes from one silent pass over the loader, cached per context."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("fakes EGL contexts on a POSIX host")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "function_availability_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static int context_a, context_b, display;
+            static EGLContext current_context = EGL_NO_CONTEXT;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            /* Context a has glClear only, context b also has glDrawArrays.
+             * glFlush is never served, so each pass looks it up once. */
+            static int passes = 0, logged = 0;
+            static void GL_APIENTRY fake_gl(void) {}
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "glFlush") == 0) {
+                    ++passes;
+                }
+                if (strcmp(name, "glClear") == 0) {
+                    return reinterpret_cast<void*>(&fake_gl);
+                }
+                if (strcmp(name, "glDrawArrays") == 0 && current_context == (EGLContext)&context_b) {
+                    return reinterpret_cast<void*>(&fake_gl);
+                }
+                return nullptr;
+            }
+
+            static void count_log(const char*) { ++logged; }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                glatter_set_log_handler(count_log);
+
+                uint32_t bitmap[GLATTER_FN_BITMAP_WORDS(GL)];
+                glatter_query_available_functions_GL(bitmap);
+                for (int i = 0; i < GLATTER_FN_BITMAP_WORDS(GL); ++i) {
+                    if (bitmap[i] != 0) {
+                        return 1;
+                    }
+                }
+                if (glatter_function_available_GL(GLATTER_FN_glClear) || passes != 0) {
+                    return 2;
+                }
+
+                current_context = (EGLContext)&context_a;
+                if (!glatter_function_available_GL(GLATTER_FN_glClear) ||
+                    glatter_function_available_GL(GLATTER_FN_glDrawArrays) ||
+                    glatter_function_available_GL(GLATTER_FN_glFlush)) {
+                    return 3;
+                }
+                if (passes != 1) {
+                    return 4;
+                }
+
+                current_context = (EGLContext)&context_b;
+                glatter_query_available_functions_GL(bitmap);
+                if (!GLATTER_FN_BITMAP_TEST(bitmap, GLATTER_FN_glClear) ||
+                    !GLATTER_FN_BITMAP_TEST(bitmap, GLATTER_FN_glDrawArrays) ||
+                    GLATTER_FN_BITMAP_TEST(bitmap, GLATTER_FN_glFlush)) {
+                    return 5;
+                }
+
+                /* Both sets are cached until invalidated. */
+                current_context = (EGLContext)&context_a;
+                glatter_function_available_GL(GLATTER_FN_glDrawArrays);
+                glatter_query_available_functions_GL(bitmap);
+                if (passes != 2 || GLATTER_FN_BITMAP_TEST(bitmap, GLATTER_FN_glDrawArrays)) {
+                    return 6;
+                }
+                glatter_invalidate_all_extension_caches();
+                glatter_function_available_GL(GLATTER_FN_glClear);
+                if (passes != 3) {
+                    return 7;
+                }
+
+                /* Out of range indices are simply unavailable. */
+                if (glatter_function_available_GL(-1) ||
+                    glatter_function_available_GL(GLATTER_FN_COUNT_GL)) {
+                    return 8;
+                }
+                return logged == 0 ? 0 : 9;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    # Without NDEBUG and with error logging on, a miss through a wrapper would
+    # log and abort; probing must do neither.
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DGLATTER_GL",
+        "-DGLATTER_LOG_ERRORS",
+    ]
+
+    output = tmp_path / "function_availability_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_function_availability_checks_the_version_and_extensions_on_glx(tmp_path: Path) -> None:
+    """glXGetProcAddress answers any name, so GLX availability also asks the context."""
+
+    if not sys.platform.startswith("linux"):
+        pytest.skip("fakes a GLX library on Linux")
+
+    cc = _require_tool("cc")
+    cxx = _require_tool("c++")
+
+    # Like Mesa's, the fake library hands out an address for every gl* name.
+    # Context a is a 2.1 context with GL_AMD_debug_output, context b a 4.6 one.
+    stubs = tmp_path / "stubs"
+    stubs.mkdir()
+    stub_source = tmp_path / "libfakegl.c"
+    stub_source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            static void* current;
+            static int display, context_b;
+            void* fake_glx_context_b(void) { return &context_b; }
+            static void fake_gl(void) {}
+            static const unsigned char* fake_get_string(unsigned name)
+            {
+                if (name == 0x1F02) { /* GL_VERSION */
+                    return (const unsigned char*)(current == &context_b ? "4.6 Fake" : "2.1 Fake");
+                }
+                if (name == 0x1F03) { /* GL_EXTENSIONS */
+                    return (const unsigned char*)"GL_AMD_debug_output";
+                }
+                return (const unsigned char*)"";
+            }
+            int glXMakeCurrent(void* dpy, unsigned long drawable, void* ctx)
+            {
+                (void)dpy; (void)drawable;
+                current = ctx;
+                return 1;
+            }
+            void* glXGetCurrentContext(void) { return current; }
+            void* glXGetCurrentDisplay(void) { return current ? &display : 0; }
+            void* glXGetProcAddressARB(const unsigned char* name)
+            {
+                if (strcmp((const char*)name, "glGetString") == 0) return (void*)&fake_get_string;
+                if (strcmp((const char*)name, "glXMakeCurrent") == 0) return (void*)&glXMakeCurrent;
+                return strncmp((const char*)name, "gl", 2) == 0 ? (void*)&fake_gl : 0;
+            }
+            """
+        )
+    )
+    _run_command([cc, "-shared", "-fPIC", str(stub_source), "-o", str(stubs / "libfakegl.so")])
+
+    source = tmp_path / "glx_availability_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string>
+            #include <glatter/glatter.h>
+
+            extern "C" void* fake_glx_context_b(void);
+
+            static int context_a;
+
+            int main(int, char** argv)
+            {
+                glatter_set_library_path(GLATTER_LIBRARY_GL, (std::string(argv[1]) + "/libfakegl.so").c_str());
+
+                glXMakeCurrent(nullptr, 0, (GLXContext)&context_a);
+                if (!glatter_function_available_GL(GLATTER_FN_glClear) ||
+                    !glatter_function_available_GL(GLATTER_FN_glUseProgram)) {
+                    return 1;
+                }
+                if (glatter_function_available_GL(GLATTER_FN_glBindVertexArray)) {
+                    return 2;
+                }
+                if (!glatter_function_available_GL(GLATTER_FN_glDebugMessageCallbackAMD) ||
+                    glatter_function_available_GL(GLATTER_FN_glDebugMessageCallbackARB)) {
+                    return 3;
+                }
+
+                glXMakeCurrent(nullptr, 0, (GLXContext)fake_glx_context_b());
+                if (!glatter_function_available_GL(GLATTER_FN_glBindVertexArray) ||
+                    glatter_function_available_GL(GLATTER_FN_glDebugMessageCallbackARB)) {
+                    return 4;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "glx_availability_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-DGLATTER_CONFIG_H_DEFINED",
+            "-DGLATTER_HEADER_ONLY",
+            "-DGLATTER_GL",
+            "-DGLATTER_GLX",
+            "-DGLATTER_MESA_GLX_GL",
+            "-DNDEBUG",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            str(stubs / "libfakegl.so"),
+            f"-Wl,-rpath,{stubs}",
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output), str(stubs)], capture_output=True, text=True, timeout=60)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_configuration_waiters_block_until_the_outcome_is_published(tmp_path: Path) -> None:
+    """Threads that arrive while another one decides block once and are counted."""
+
+    if os.name == "nt":
+        pytest.skip("waiters block only on POSIX")
+
+    cxx = _require_tool("c++")
+
+    source = tmp_path / "configuration_wait_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <string.h>
+            #include <atomic>
+            #include <chrono>
+            #include <thread>
+            #include <vector>
+            #include <glatter/glatter.h>
+
+            /* The first lookup holds the configuration the way a cold dlopen
+             * sequence does, and lets the waiters in while it does. */
+            static std::atomic<int> deciding(0);
+            static void GL_APIENTRY fake_gl(void) {}
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "glFlush") == 0) {
+                    deciding = 1;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+                return reinterpret_cast<void*>(&fake_gl);
+            }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+
+                std::thread owner([] { glatter_get_proc_address("glFlush"); });
+                while (!deciding) {
+                    std::this_thread::yield();
+                }
+                std::vector<std::thread> waiters;
+                std::atomic<int> resolved(0);
+                for (int i = 0; i < 8; ++i) {
+                    waiters.emplace_back([&resolved] {
+                        if (glatter_get_proc_address("glClear")) {
+                            ++resolved;
+                        }
+                    });
+                }
+                owner.join();
+                for (auto& waiter : waiters) {
+                    waiter.join();
+                }
+
+                glatter_configuration_stats_t stats;
+                glatter_get_configuration_stats(&stats);
+                printf("%d %llu %llu %llu %llu\\n", resolved.load(),
+                    (unsigned long long)stats.waits, (unsigned long long)stats.blocks,
+                    (unsigned long long)stats.spins, (unsigned long long)stats.blocked_ns);
+                if (resolved != 8 || stats.waits == 0) {
+                    return 1;
+                }
+                /* A blocked waiter is only woken with the outcome, so it blocks once. */
+                if (stats.blocks != stats.waits || stats.spins != 64 * stats.waits) {
+                    return 2;
+                }
+                return stats.blocked_ns > 0 ? 0 : 3;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_HEADER_ONLY",
+        "-DGLATTER_EGL_GLES2_2_0",
+        "-DGLATTER_EGL",
+        "-DGLATTER_GL",
+        "-DNDEBUG",
+    ]
+
+    output = tmp_path / "configuration_wait_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            *config_flags,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True, timeout=60)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_context_dispatch_resolves_through_each_contexts_wsi(tmp_path: Path) -> None:
+    """A GLX and an EGL context are used at once, each through its own WSI's loader."""
+
+    if not sys.platform.startswith("linux"):
+        pytest.skip("fakes GLX and EGL libraries on Linux")
+
+    cc = _require_tool("cc")
+    cxx = _require_tool("c++")
+
+    # Each fake library hands out its own glClear and keeps its own current
+    # context per thread.
+    stubs = tmp_path / "stubs"
+    stubs.mkdir()
+    stub_sources = {
+        "libfakegl.so": textwrap.dedent(
+            """
+            #include <string.h>
+            static __thread void* current;
+            static int display, clears;
+            int fake_glx_clears(void) { return __atomic_load_n(&clears, __ATOMIC_SEQ_CST); }
+            static void glx_clear(unsigned mask) { (void)mask; __atomic_add_fetch(&clears, 1, __ATOMIC_SEQ_CST); }
+            int glXMakeCurrent(void* dpy, unsigned long drawable, void* ctx)
+            {
+                (void)dpy; (void)drawable;
+                current = ctx;
+                return 1;
+            }
+            void* glXGetCurrentContext(void) { return current; }
+            void* glXGetCurrentDisplay(void) { return current ? &display : 0; }
+            void* glXGetProcAddressARB(const unsigned char* name)
+            {
+                if (strcmp((const char*)name, "glClear") == 0) return (void*)&glx_clear;
+                if (strcmp((const char*)name, "glXMakeCurrent") == 0) return (void*)&glXMakeCurrent;
+                return 0;
+            }
+            """
+        ),
+        "libfakeegl.so": textwrap.dedent(
+            """
+            #include <string.h>
+            static __thread void* current;
+            static int display, clears;
+            int fake_egl_clears(void) { return __atomic_load_n(&clears, __ATOMIC_SEQ_CST); }
+            static void egl_clear(unsigned mask) { (void)mask; __atomic_add_fetch(&clears, 1, __ATOMIC_SEQ_CST); }
+            unsigned eglMakeCurrent(void* dpy, void* draw, void* read, void* ctx)
+            {
+                (void)dpy; (void)draw; (void)read;
+                current = ctx;
+                return 1;
+            }
+            void* eglGetCurrentContext(void) { return current; }
+            void* eglGetCurrentDisplay(void) { return current ? &display : 0; }
+            void* eglGetProcAddress(const char* name)
+            {
+                return strcmp(name, "glClear") == 0 ? (void*)&egl_clear : 0;
+            }
+            """
+        ),
+    }
+    for name, text in stub_sources.items():
+        stub_source = tmp_path / (name.split(".")[0] + ".c")
+        stub_source.write_text(text)
+        _run_command([cc, "-shared", "-fPIC", str(stub_source), "-o", str(stubs / name)])
+
+    source = tmp_path / "context_wsi_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <dlfcn.h>
+            #include <atomic>
+            #include <string>
+            #include <thread>
+            #include <glatter/glatter.h>
+
+            /* The GLX side is the build's own WSI; EGL is only reached through
+             * its loader, as for a headless worker in a desktop GL build. */
+            extern "C" int fake_glx_clears(void);
+
+            static int glx_context, egl_context;
+
+            int main(int, char** argv)
+            {
+                std::string dir = argv[1];
+                glatter_set_library_path(GLATTER_LIBRARY_GL, (dir + "/libfakegl.so").c_str());
+                glatter_set_library_path(GLATTER_LIBRARY_EGL, (dir + "/libfakeegl.so").c_str());
+                void* egl = dlopen((dir + "/libfakeegl.so").c_str(), RTLD_NOW);
+                if (!egl) {
+                    return 1;
+                }
+                typedef unsigned (*make_current_fn)(void*, void*, void*, void*);
+                make_current_fn egl_make_current = (make_current_fn)dlsym(egl, "eglMakeCurrent");
+                int (*egl_clears)(void) = (int (*)(void))dlsym(egl, "fake_egl_clears");
+
+                glXMakeCurrent(nullptr, 0, (GLXContext)&glx_context);
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (fake_glx_clears() != 1 || glatter_get_wsi() != GLATTER_WSI_GLX) {
+                    return 2;
+                }
+
+                std::atomic<int> turn(0);
+                std::thread worker([&] {
+                    egl_make_current(nullptr, nullptr, nullptr, &egl_context);
+                    glatter_bind_dispatch_to_wsi(GLATTER_WSI_EGL);
+                    for (int i = 0; i < 1000; ++i) {
+                        glClear(GL_COLOR_BUFFER_BIT);
+                        if (i == 0) {
+                            turn = 1;
+                        }
+                    }
+                });
+                while (!turn) {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < 1000; ++i) {
+                    glClear(GL_COLOR_BUFFER_BIT);
+                }
+                worker.join();
+                if (fake_glx_clears() != 1001 || egl_clears() != 1000) {
+                    return 3;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "context_wsi_test"
+    _run_command(
+        [
+            cxx,
+            "-std=c++17",
+            "-DGLATTER_CONFIG_H_DEFINED",
+            "-DGLATTER_HEADER_ONLY",
+            "-DGLATTER_GL",
+            "-DGLATTER_GLX",
+            "-DGLATTER_MESA_GLX_GL",
+            "-DGLATTER_CONTEXT_DISPATCH",
+            "-DNDEBUG",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_stub_include_flags(),
+            *_thread_flags(),
+            str(source),
+            str(stubs / "libfakegl.so"),
+            f"-Wl,-rpath,{stubs}",
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output), str(stubs)], capture_output=True, text=True, timeout=60)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+@pytest.mark.parametrize("mode", ["header_only", "compiled"])
+def test_call_hooks_see_arguments_and_results(mode: str, tmp_path: Path) -> None:
+    """Hooks see each hooked call with its arguments and result, and can be removed."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("builds the GLX configuration on a POSIX host")
+
+    source = tmp_path / ("hooks_test.cpp" if mode == "header_only" else "hooks_test.c")
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static int cleared = 0;
+            static int pre_calls = 0;
+            static int post_calls = 0;
+            static int last_argc = -1;
+            static GLfloat seen_green = 0.0f;
+            static GLenum seen_error = GL_NO_ERROR;
+            static int void_result = 1;
+
+            static void GLAPIENTRY fake_glClear(GLbitfield mask) { (void)mask; ++cleared; }
+            static void GLAPIENTRY fake_glClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) { (void)r; (void)g; (void)b; (void)a; }
+            static void GLAPIENTRY fake_glFlush(void) {}
+            static GLenum GLAPIENTRY fake_glGetError(void) { return GL_OUT_OF_MEMORY; }
+
+            static void* provider(const char* name, void* user_data)
+            {
+                (void)user_data;
+                if (strcmp(name, "glClear") == 0)      return (void*)&fake_glClear;
+                if (strcmp(name, "glClearColor") == 0) return (void*)&fake_glClearColor;
+                if (strcmp(name, "glFlush") == 0)      return (void*)&fake_glFlush;
+                if (strcmp(name, "glGetError") == 0)   return (void*)&fake_glGetError;
+                return NULL;
+            }
+
+            static void pre(const glatter_call_t* call, void* user_data)
+            {
+                if (user_data != &pre_calls || call->family != GLATTER_FAMILY_GL) {
+                    return;
+                }
+                ++pre_calls;
+                last_argc = call->argc;
+                if (call->function == GLATTER_FN_glClearColor) {
+                    seen_green = *(const GLfloat*)call->args[1];
+                }
+                if (call->function == GLATTER_FN_glFlush) {
+                    (void)glGetError(); /* not hooked again */
+                }
+            }
+
+            static void post(const glatter_call_t* call, void* user_data)
+            {
+                (void)user_data;
+                ++post_calls;
+                if (call->function == GLATTER_FN_glGetError) {
+                    seen_error = *(const GLenum*)call->result;
+                }
+                else if (call->result) {
+                    void_result = 0;
+                }
+            }
+
+            int main(void)
+            {
+                glatter_set_proc_address_provider(provider, NULL);
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (!glatter_set_call_hooks(pre, post, &pre_calls)) {
+                    return 1;
+                }
+
+                glClearColor(0.25f, 0.5f, 0.75f, 1.0f);
+                if (pre_calls != 1 || post_calls != 1 || last_argc != 4 || seen_green != 0.5f) {
+                    return 2;
+                }
+                if (glGetError() != GL_OUT_OF_MEMORY || seen_error != GL_OUT_OF_MEMORY || last_argc != 0) {
+                    return 3;
+                }
+                glFlush();
+                if (pre_calls != 3 || post_calls != 3 || !void_result) {
+                    return 4;
+                }
+
+                uint32_t mask[GLATTER_FN_BITMAP_WORDS(GL)];
+                memset(mask, 0xff, sizeof(mask));
+                mask[GLATTER_FN_glClear >> 5] &= ~(1u << (GLATTER_FN_glClear & 31));
+                glatter_set_call_hook_mask_GL(mask);
+                glClear(GL_COLOR_BUFFER_BIT);
+                glFlush();
+                if (pre_calls != 4 || cleared != 2) {
+                    return 5;
+                }
+                glatter_set_call_hook_mask_GL(NULL);
+                glClear(GL_COLOR_BUFFER_BIT);
+                if (pre_calls != 5 || cleared != 3) {
+                    return 6;
+                }
+
+                if (!glatter_set_call_hooks(NULL, NULL, NULL)) {
+                    return 7;
+                }
+                glClear(GL_COLOR_BUFFER_BIT);
+                glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+                if (pre_calls != 5 || post_calls != 5 || cleared != 4) {
+                    return 8;
+                }
+            #if !defined(GLATTER_HEADER_ONLY)
+                if ((void*)glatter_glClear != (void*)&fake_glClear) {
+                    return 9; /* still swapped */
+                }
+            #else
+                if (GLATTER_ATOMIC_LOAD(glatter_retired_objects) != NULL) {
+                    return 10; /* replaced hooks and masks not freed */
+                }
+            #endif
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_GL",
+        "-DGLATTER_GLX",
+        "-DGLATTER_MESA_GLX_GL",
+        "-DNDEBUG",
+    ]
+    output = tmp_path / "hooks_test"
+    if mode == "header_only":
+        command = [_require_tool("c++"), "-std=c++17", "-DGLATTER_HEADER_ONLY", *config_flags]
+        sources = [source]
+    else:
+        command = [_require_tool("cc"), "-std=c11", *config_flags]
+        sources = [REPO_ROOT / "src" / "glatter" / "glatter.c", source, "-lGL"]
+    _run_command(
+        [
+            *command,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            *sources,
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+def test_hook_installation_is_not_starved_by_hooked_calls(tmp_path: Path) -> None:
+    """Replacing hooks while other threads keep making hooked calls finishes and frees the old records."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("builds the GLX configuration on a POSIX host")
+
+    source = tmp_path / "hooks_drain_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <atomic>
+            #include <string.h>
+            #include <thread>
+            #include <vector>
+            #include <glatter/glatter.h>
+
+            static void GLAPIENTRY fake_glClear(GLbitfield mask) { (void)mask; }
+
+            static void* provider(const char* name, void*)
+            {
+                return strcmp(name, "glClear") == 0 ? reinterpret_cast<void*>(&fake_glClear) : nullptr;
+            }
+
+            static std::atomic<int> hooked(0);
+            static void pre(const glatter_call_t*, void*) { ++hooked; }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                glatter_set_call_hooks(pre, nullptr, nullptr);
+
+                /* The callers keep read sections open nearly all the time, so
+                 * the readers are rarely all out at once. */
+                std::atomic<bool> done(false);
+                std::vector<std::thread> callers;
+                for (int i = 0; i < 4; ++i) {
+                    callers.emplace_back([&done] {
+                        while (!done) {
+                            glClear(GL_COLOR_BUFFER_BIT);
+                        }
+                    });
+                }
+                for (int i = 0; i < 2000; ++i) {
+                    if (!glatter_set_call_hooks(pre, nullptr, nullptr)) {
+                        return 1;
+                    }
+                }
+                done = true;
+                for (std::thread& caller : callers) {
+                    caller.join();
+                }
+                if (hooked == 0) {
+                    return 2;
+                }
+
+                glatter_set_call_hooks(nullptr, nullptr, nullptr);
+                return GLATTER_ATOMIC_LOAD(glatter_retired_objects) == nullptr ? 0 : 3;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    output = tmp_path / "hooks_drain_test"
+    _run_command(
+        [
+            _require_tool("c++"),
+            "-std=c++17",
+            "-DGLATTER_HEADER_ONLY",
+            "-DGLATTER_CONFIG_H_DEFINED",
+            "-DGLATTER_GL",
+            "-DGLATTER_GLX",
+            "-DGLATTER_MESA_GLX_GL",
+            "-DNDEBUG",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            str(source),
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    result = subprocess.run([str(output)], capture_output=True, text=True, timeout=60)
+    assert result.returncode == 0, result.stdout + result.stderr
+
+
+@pytest.mark.parametrize("mode", ["header_only", "compiled"])
+def test_layers_chain_only_the_entry_points_they_intercept(mode: str, tmp_path: Path) -> None:
+    """GLATTER_LAYERS layers chain in order in front of the driver, and only where they intercept."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("loads layers with dlopen on a POSIX host")
+
+    layer_source = tmp_path / "layer.c"
+    layer_source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <glatter/glatter.h>
+
+            static void (GLAPIENTRY *next_glClear)(GLbitfield);
+
+            static void GLAPIENTRY layer_glClear(GLbitfield mask)
+            {
+                printf("%s %u\\n", LAYER_NAME, (unsigned)mask);
+                next_glClear(mask);
+            }
+
+            const glatter_layer_entry_t glatter_layer_v1[] = {
+                { "glClear", (void*)&layer_glClear, (void**)&next_glClear },
+                { NULL, NULL, NULL }
+            };
+            """
+        ).strip()
+        + "\n"
+    )
+
+    source = tmp_path / ("layers_test.cpp" if mode == "header_only" else "layers_test.c")
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            static void GLAPIENTRY fake_glClear(GLbitfield mask) { printf("driver %u\\n", (unsigned)mask); }
+            static void GLAPIENTRY fake_glFlush(void) {}
+
+            static void* provider(const char* name, void* user_data)
+            {
+                (void)user_data;
+                if (strcmp(name, "glClear") == 0) return (void*)&fake_glClear;
+                if (strcmp(name, "glFlush") == 0) return (void*)&fake_glFlush;
+                return NULL;
+            }
+
+            int main(void)
+            {
+                glatter_set_proc_address_provider(provider, NULL);
+                glClear(GL_COLOR_BUFFER_BIT);
+                glFlush();
+                if (glatter_get_proc_address("glFlush") != (void*)&fake_glFlush) {
+                    return 1;
+                }
+                if (glatter_get_proc_address("glClear") == (void*)&fake_glClear) {
+                    return 2;
+                }
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    cc = _require_tool("cc")
+    config_flags = [
+        "-DGLATTER_CONFIG_H_DEFINED",
+        "-DGLATTER_GL",
+        "-DGLATTER_GLX",
+        "-DGLATTER_MESA_GLX_GL",
+        "-DNDEBUG",
+    ]
+    layers = []
+    for name in ("outer", "inner"):
+        layer = tmp_path / f"lib{name}.so"
+        _run_command(
+            [
+                cc,
+                "-std=c11",
+                "-shared",
+                "-fPIC",
+                *config_flags,
+                f'-DLAYER_NAME="{name}"',
+                "-I",
+                str(REPO_ROOT / "include"),
+                str(layer_source),
+                "-o",
+                str(layer),
+            ]
+        )
+        layers.append(str(layer))
+
+    output = tmp_path / "layers_test"
+    if mode == "header_only":
+        command = [_require_tool("c++"), "-std=c++17", "-DGLATTER_HEADER_ONLY", *config_flags]
+        sources = [source]
+    else:
+        command = [cc, "-std=c11", *config_flags]
+        sources = [REPO_ROOT / "src" / "glatter" / "glatter.c", source, "-lGL"]
+    _run_command(
+        [
+            *command,
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            *sources,
+            "-lX11",
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    env = dict(os.environ, GLATTER_LAYERS=":".join([*layers, str(tmp_path / "libmissing.so")]))
+    result = subprocess.run([str(output)], capture_output=True, text=True, env=env)
+    assert result.returncode == 0, result.stdout + result.stderr
+    assert result.stdout.split("\n")[:3] == ["outer 16384", "inner 16384", "driver 16384"], result.stdout
+    assert "could not load layer" in result.stdout + result.stderr
+
+
+def test_layers_log_once_when_another_context_bypasses_them(tmp_path: Path) -> None:
+    """A context whose entry point differs from the one a layer calls on bypasses it, and that is logged once."""
+
+    if os.name == "nt" or sys.platform == "darwin":
+        pytest.skip("loads layers with dlopen on a POSIX host")
+
+    layer_source = tmp_path / "layer.c"
+    layer_source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <glatter/glatter.h>
+
+            static void (GLAPIENTRY *next_glClear)(GLbitfield);
+
+            static void GLAPIENTRY layer_glClear(GLbitfield mask)
+            {
+                printf("layer\\n");
+                next_glClear(mask);
+            }
+
+            const glatter_layer_entry_t glatter_layer_v1[] = {
+                { "glClear", (void*)&layer_glClear, (void**)&next_glClear },
+                { NULL, NULL, NULL }
+            };
+            """
+        ).strip()
+        + "\n"
+    )
+
+    source = tmp_path / "layer_bypass_test.cpp"
+    source.write_text(
+        textwrap.dedent(
+            """
+            #include <stdio.h>
+            #include <string.h>
+            #include <glatter/glatter.h>
+
+            /* Contexts are faked as in the context dispatch test. */
+            static int context_a, context_b, display;
+            static EGLContext current_context = EGL_NO_CONTEXT;
+
+            extern "C" EGLContext EGLAPIENTRY (eglGetCurrentContext)(void) { return current_context; }
+            extern "C" EGLDisplay EGLAPIENTRY (eglGetCurrentDisplay)(void)
+            {
+                return current_context ? (EGLDisplay)&display : EGL_NO_DISPLAY;
+            }
+
+            static EGLBoolean EGLAPIENTRY fake_make_current(EGLDisplay, EGLSurface, EGLSurface, EGLContext ctx)
+            {
+                current_context = ctx;
+                return EGL_TRUE;
+            }
+
+            static void GL_APIENTRY clear_a(GLbitfield) { printf("a\\n"); }
+            static void GL_APIENTRY clear_b(GLbitfield) { printf("b\\n"); }
+
+            static void* provider(const char* name, void*)
+            {
+                if (strcmp(name, "eglMakeCurrent") == 0) {
+                    return reinterpret_cast<void*>(&fake_make_current);
+                }
+                if (strcmp(name, "glClear") == 0) {
+                    return current_context == (EGLContext)&context_a
+                        ? reinterpret_cast<void*>(&clear_a)
+                        : reinterpret_cast<void*>(&clear_b);
+                }
+                return nullptr;
+            }
+
+            int main()
+            {
+                glatter_set_proc_address_provider(provider, nullptr);
+                EGLDisplay dpy = (EGLDisplay)&display;
+
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_a);
+                glClear(GL_COLOR_BUFFER_BIT);
+                eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, (EGLContext)&context_b);
+                glClear(GL_COLOR_BUFFER_BIT);
+                (void)glatter_get_proc_address("glClear");
+                glClear(GL_COLOR_BUFFER_BIT);
+                fflush(stdout);
+                return 0;
+            }
+            """
+        ).strip()
+        + "\n"
+    )
+
+    cc = _require_tool("cc")
+    layer = tmp_path / "liblayer.so"
+    _run_command(
+        [
+            cc,
+            "-std=c11",
+            "-shared",
+            "-fPIC",
+            "-DGLATTER_CONFIG_H_DEFINED",
+            "-DGLATTER_GL",
+            "-DGLATTER_GLX",
+            "-DGLATTER_MESA_GLX_GL",
+            "-I",
+            str(REPO_ROOT / "include"),
+            str(layer_source),
+            "-o",
+            str(layer),
+        ]
+    )
+
+    output = tmp_path / "layer_bypass_test"
+    _run_command(
+        [
+            _require_tool("c++"),
+            "-std=c++17",
+            "-DGLATTER_CONFIG_H_DEFINED",
+            "-DGLATTER_HEADER_ONLY",
+            "-DGLATTER_EGL_GLES2_2_0",
+            "-DGLATTER_EGL",
+            "-DGLATTER_GL",
+            "-DGLATTER_CONTEXT_DISPATCH",
+            "-DNDEBUG",
+            "-I",
+            str(REPO_ROOT / "include"),
+            *_thread_flags(),
+            str(source),
+            *_dl_flags(),
+            "-o",
+            str(output),
+        ]
+    )
+
+    env = dict(os.environ, GLATTER_LAYERS=str(layer))
+    result = subprocess.run([str(output)], capture_output=True, text=True, env=env)
+    assert result.returncode == 0, result.stdout + result.stderr
+    assert result.stdout.split()[:4] == ["layer", "a", "b", "b"], result.stdout
+    assert (result.stdout + result.stderr).count("the layer is bypassed") == 1, result.stdout + result.stderr
+
+
 def test_wgl_headers_compile_with_stubs(tmp_path: Path) -> None:
     """Verify WGL-enabled builds compile when using stubbed Windows headers."""
 